@@ -28,6 +28,14 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+// MAME local modification: fm_channel parking.  Channels whose operators
+// are all fully released are "parked" by fm_engine_base::clock(); their
+// clocks are counted and applied in one go by catch_up_parked() before the
+// next prepare or save/restore, instead of clocking them every sample.
+// Upstream ymfm doesn't have this.  Every changed region in ymfm_fm.h and
+// ymfm_fm.ipp is enclosed in "MAME local change begin/end" comments so the
+// patch can be carried over when ymfm is re-vendored.
+
 #ifndef YMFM_FM_H
 #define YMFM_FM_H
 
@@ -190,6 +198,15 @@ public:
 	// master clocking function
 	void clock(uint32_t env_counter, int32_t lfo_raw_pm);
 
+	// MAME local change begin (deferred clocking)
+	// are we parked? silent, with an envelope that clocking leaves alone
+	// and a fixed phase step, so clocking only advances the phase
+	bool parked() const;
+
+	// apply a number of clocks while parked
+	void clock_parked(uint32_t clocks) { m_phase += m_cache.phase_step * clocks; }
+	// MAME local change end
+
 	// return the current phase value
 	uint32_t phase() const { return m_phase >> 10; }
 
@@ -282,6 +299,17 @@ public:
 	// master clocking function
 	void clock(uint32_t env_counter, int32_t lfo_raw_pm);
 
+	// MAME local change begin (deferred clocking)
+	// are all of our operators parked?
+	bool parked() const;
+
+	// count a clock while parked, deferring its effects
+	void clock_parked() { m_parked_clocks++; }
+
+	// apply the clocks deferred while parked
+	void catch_up();
+	// MAME local change end
+
 	// specific 2-operator and 4-operator output handlers
 	void output_2op(output_data &output, uint32_t rshift, int32_t clipmax) const;
 	void output_4op(output_data &output, uint32_t rshift, int32_t clipmax) const;
@@ -330,6 +358,9 @@ private:
 	uint32_t m_choffs;                     // channel offset in registers
 	int16_t m_feedback[2];                 // feedback memory for operator 1
 	mutable int16_t m_feedback_in;         // next input value for op 1 feedback (set in output)
+	// MAME local change begin (deferred clocking)
+	uint32_t m_parked_clocks;              // clocks deferred while parked
+	// MAME local change end
 	fm_operator<RegisterType> *m_op[4];    // up to 4 operators
 	RegisterType &m_regs;                  // direct reference to registers
 	fm_engine_base<RegisterType> &m_owner; // reference to the owning engine
@@ -435,6 +466,11 @@ protected:
 	// assign the current set of operators to channels
 	void assign_operators();
 
+	// MAME local change begin (deferred clocking)
+	// bring any parked channels up to date
+	void catch_up_parked();
+	// MAME local change end
+
 	// update the state of the given timer
 	void update_timer(uint32_t which, uint32_t enable, int32_t delta_clocks);
 
@@ -448,6 +484,9 @@ protected:
 	uint8_t m_timer_running[2];      // current timer running state
 	uint8_t m_total_clocks;          // low 8 bits of the total number of clocks processed
 	uint32_t m_active_channels;      // mask of active channels (computed by prepare)
+	// MAME local change begin (deferred clocking)
+	uint32_t m_parked_channels;      // mask of parked channels (computed by prepare)
+	// MAME local change end
 	uint32_t m_modified_channels;    // mask of channels that have been modified
 	uint32_t m_prepare_count;        // counter to do periodic prepare sweeps
 	RegisterType m_regs;             // register accessor
@@ -28,6 +28,14 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+// MAME local modification: fm_channel parking.  Channels whose operators
+// are all fully released are "parked" by fm_engine_base::clock(); their
+// clocks are counted and applied in one go by catch_up_parked() before the
+// next prepare or save/restore, instead of clocking them every sample.
+// Upstream ymfm doesn't have this.  Every changed region in ymfm_fm.h and
+// ymfm_fm.ipp is enclosed in "MAME local change begin/end" comments so the
+// patch can be carried over when ymfm is re-vendored.
+
 namespace ymfm
 {
 
@@ -460,6 +468,30 @@ void fm_operator<RegisterType>::clock(uint32_t env_counter, int32_t lfo_raw_pm)
 }
 
 
+// MAME local change begin (deferred clocking)
+
+//-------------------------------------------------
+//  parked - return true if the operator is fully
+//  released and not using SSG-EG or dynamic phase
+//  steps; clocking then leaves the envelope at
+//  maximum attenuation and just adds the cached
+//  step to the phase, so the clocks can be applied
+//  all at once later
+//-------------------------------------------------
+
+template<class RegisterType>
+bool fm_operator<RegisterType>::parked() const
+{
+	return (m_env_state == (RegisterType::EG_HAS_REVERB ? EG_REVERB : EG_RELEASE) &&
+		m_env_attenuation == 0x3ff &&
+		!m_ssg_inverted &&
+		!m_regs.op_ssg_eg_enable(m_opoffs) &&
+		m_cache.phase_step != opdata_cache::PHASE_STEP_DYNAMIC);
+}
+
+// MAME local change end
+
+
 //-------------------------------------------------
 //  compute_volume - compute the 14-bit signed
 //  volume of this operator, given a phase
@@ -799,6 +831,9 @@ fm_channel<RegisterType>::fm_channel(fm_engine_base<RegisterType> &owner, uint32
 	m_choffs(choffs),
 	m_feedback{ 0, 0 },
 	m_feedback_in(0),
+	// MAME local change begin (deferred clocking)
+	m_parked_clocks(0),
+	// MAME local change end
 	m_op{ nullptr, nullptr, nullptr, nullptr },
 	m_regs(owner.regs()),
 	m_owner(owner)
@@ -816,6 +851,9 @@ void fm_channel<RegisterType>::reset()
 	// reset our data
 	m_feedback[0] = m_feedback[1] = 0;
 	m_feedback_in = 0;
+	// MAME local change begin (deferred clocking)
+	m_parked_clocks = 0;
+	// MAME local change end
 }
 
 
@@ -869,6 +907,48 @@ bool fm_channel<RegisterType>::prepare()
 }
 
 
+// MAME local change begin (deferred clocking)
+
+//-------------------------------------------------
+//  parked - return true if all of our operators
+//  are parked
+//-------------------------------------------------
+
+template<class RegisterType>
+bool fm_channel<RegisterType>::parked() const
+{
+	for (uint32_t opnum = 0; opnum < array_size(m_op); opnum++)
+		if (m_op[opnum] != nullptr && !m_op[opnum]->parked())
+			return false;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  catch_up - apply the clocks deferred while
+//  parked
+//-------------------------------------------------
+
+template<class RegisterType>
+void fm_channel<RegisterType>::catch_up()
+{
+	if (m_parked_clocks == 0)
+		return;
+
+	// nothing is output while parked, so the feedback input is unchanged
+	// and the history settles to it after two clocks
+	m_feedback[0] = (m_parked_clocks >= 2) ? m_feedback_in : m_feedback[1];
+	m_feedback[1] = m_feedback_in;
+
+	for (uint32_t opnum = 0; opnum < array_size(m_op); opnum++)
+		if (m_op[opnum] != nullptr)
+			m_op[opnum]->clock_parked(m_parked_clocks);
+	m_parked_clocks = 0;
+}
+
+// MAME local change end
+
+
 //-------------------------------------------------
 //  clock - master clock of all operators
 //-------------------------------------------------
@@ -1187,6 +1267,9 @@ fm_engine_base<RegisterType>::fm_engine_base(ymfm_interface &intf) :
 	m_timer_running{0,0},
 	m_total_clocks(0),
 	m_active_channels(ALL_CHANNELS),
+	// MAME local change begin (deferred clocking)
+	m_parked_channels(0),
+	// MAME local change end
 	m_modified_channels(ALL_CHANNELS),
 	m_prepare_count(0)
 {
@@ -1231,6 +1314,9 @@ void fm_engine_base<RegisterType>::reset()
 	// reset the channels
 	for (auto &chan : m_channel)
 		chan->reset();
+	// MAME local change begin (deferred clocking)
+	m_parked_channels = 0;
+	// MAME local change end
 
 	// reset the operators
 	for (auto &op : m_operator)
@@ -1255,6 +1341,11 @@ void fm_engine_base<RegisterType>::save_restore(ymfm_saved_state &state)
 	state.save_restore(m_timer_running[1]);
 	state.save_restore(m_total_clocks);
 
+	// MAME local change begin (deferred clocking)
+	// the state doesn't include deferred clocks, so apply them first
+	catch_up_parked();
+	// MAME local change end
+
 	// save the register/family data
 	m_regs.save_restore(state);
 
@@ -1286,16 +1377,36 @@ uint32_t fm_engine_base<RegisterType>::clock(uint32_t chanmask)
 	// also prepare every 4k samples to catch ending notes
 	if (m_modified_channels != 0 || m_prepare_count++ >= 4096)
 	{
+		// MAME local change begin (deferred clocking)
+		// apply clocks deferred with the old state before anything changes
+		catch_up_parked();
+		// MAME local change end
+
 		// reassign operators to channels if dynamic
 		if (RegisterType::DYNAMIC_OPS)
 			assign_operators();
 
-		// call each channel to prepare
+		// MAME local change begin (deferred clocking)
+		// the OPL rhythm outputs read the phases of operators 13 and 17
+		// whether or not their channels are active, so those can't be parked
+		uint32_t parkable = YMFM_DEBUG_LOG_WAVFILES ? 0 : ALL_CHANNELS;
+		if (m_regs.rhythm_enable())
+			parkable &= ~(7 << 6);
+		// MAME local change end
+
+		// call each channel to prepare; inactive channels that are parked
+		// skip clocking until the next prepare (MAME local change)
 		m_active_channels = 0;
 		for (uint32_t chnum = 0; chnum < CHANNELS; chnum++)
 			if (bitfield(chanmask, chnum))
+			{
 				if (m_channel[chnum]->prepare())
 					m_active_channels |= 1 << chnum;
+				// MAME local change begin (deferred clocking)
+				else if (bitfield(parkable, chnum) && m_channel[chnum]->parked())
+					m_parked_channels |= 1 << chnum;
+				// MAME local change end
+			}
 
 		// reset the modified channels and prepare count
 		m_modified_channels = m_prepare_count = 0;
@@ -1313,8 +1424,15 @@ uint32_t fm_engine_base<RegisterType>::clock(uint32_t chanmask)
 
 	// now update the state of all the channels and operators
 	for (uint32_t chnum = 0; chnum < CHANNELS; chnum++)
+		// MAME local change begin (deferred clocking)
 		if (bitfield(chanmask, chnum))
-			m_channel[chnum]->clock(m_env_counter, lfo_raw_pm);
+		{
+			if (bitfield(m_parked_channels, chnum))
+				m_channel[chnum]->clock_parked();
+			else
+				m_channel[chnum]->clock(m_env_counter, lfo_raw_pm);
+		}
+		// MAME local change end
 
 	// return the envelope counter as it is used to clock ADPCM-A
 	return m_env_counter;
@@ -1465,6 +1583,25 @@ void fm_engine_base<RegisterType>::assign_operators()
 }
 
 
+// MAME local change begin (deferred clocking)
+
+//-------------------------------------------------
+//  catch_up_parked - apply the deferred clocks of
+//  any parked channels and unpark them
+//-------------------------------------------------
+
+template<class RegisterType>
+void fm_engine_base<RegisterType>::catch_up_parked()
+{
+	for (uint32_t chnum = 0; chnum < CHANNELS; chnum++)
+		if (bitfield(m_parked_channels, chnum))
+			m_channel[chnum]->catch_up();
+	m_parked_channels = 0;
+}
+
+// MAME local change end
+
+
 //-------------------------------------------------
 //  update_timer - update the state of the given
 //  timer
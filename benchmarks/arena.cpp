@@ -0,0 +1,102 @@
+#include "benchmark/benchmark_api.h"
+#include "arena.h"
+
+#include "strformat.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// building a tree of small polymorphic objects with composed tags, the way
+// a machine configuration builds its devices, first on the heap and then
+// in a util::arena that is released all at once
+
+namespace {
+
+constexpr int NODE_COUNT = 2000;
+
+std::vector<std::string> const &base_tags()
+{
+	static std::vector<std::string> s_tags;
+	if (s_tags.empty())
+	{
+		s_tags.reserve(NODE_COUNT);
+		for (int i = 0; i < NODE_COUNT; i++)
+			s_tags.emplace_back(util::string_format("device%d", i));
+	}
+	return s_tags;
+}
+
+class heap_node
+{
+public:
+	heap_node(heap_node const *owner, std::string_view tag)
+		: m_basetag(tag)
+	{
+		if (owner)
+			m_tag.assign(owner->m_tag).append(":").append(tag);
+		else
+			m_tag.assign(":");
+	}
+	virtual ~heap_node() { }
+
+	std::string m_tag;
+	std::string m_basetag;
+	std::vector<std::unique_ptr<heap_node> > m_children;
+};
+
+class arena_node : public util::arena_object
+{
+public:
+	arena_node(util::arena &arena, arena_node const *owner, std::string_view tag)
+		: m_basetag(arena.copy(tag))
+	{
+		if (owner)
+			m_tag = arena.copy({ owner->m_tag, ":", tag });
+		else
+			m_tag = ":";
+	}
+	virtual ~arena_node() { }
+
+	std::string_view m_tag;
+	std::string_view m_basetag;
+	std::vector<std::unique_ptr<arena_node> > m_children;
+};
+
+void BM_heap_config(benchmark::State& state) {
+	std::vector<std::string> const &tags = base_tags();
+	while (state.KeepRunning()) {
+		auto root = std::make_unique<heap_node>(nullptr, "root");
+		heap_node *parent = root.get();
+		for (int i = 0; i < NODE_COUNT; i++) {
+			parent->m_children.emplace_back(std::make_unique<heap_node>(parent, tags[i]));
+			if (!(i % 8))
+				parent = parent->m_children.back().get();
+		}
+		benchmark::DoNotOptimize(root.get());
+	}
+	state.SetItemsProcessed(state.iterations() * NODE_COUNT);
+}
+
+void BM_arena_config(benchmark::State& state) {
+	std::vector<std::string> const &tags = base_tags();
+	while (state.KeepRunning()) {
+		util::arena arena;
+		std::unique_ptr<arena_node> root(new (arena) arena_node(arena, nullptr, "root"));
+		arena_node *parent = root.get();
+		for (int i = 0; i < NODE_COUNT; i++) {
+			parent->m_children.emplace_back(new (arena) arena_node(arena, parent, tags[i]));
+			if (!(i % 8))
+				parent = parent->m_children.back().get();
+		}
+		benchmark::DoNotOptimize(root.get());
+		root.reset();
+	}
+	state.SetItemsProcessed(state.iterations() * NODE_COUNT);
+}
+
+} // anonymous namespace
+
+BENCHMARK(BM_heap_config);
+BENCHMARK(BM_arena_config);
@@ -0,0 +1,125 @@
+#include "benchmark/benchmark_api.h"
+#include "chd.h"
+#include "ioprocsvec.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <vector>
+
+// chd_file::read_hunk on a CHD held in memory, compressed with one codec
+// at a time, so the cost is the hunk map lookup plus decompression; the
+// source is 16-bit stereo audio with a little noise, which every codec
+// (FLAC included) can do something with
+
+namespace {
+
+constexpr uint32_t HUNK_BYTES = 8192;
+constexpr uint32_t HUNK_COUNT = 64;
+constexpr uint32_t UNIT_BYTES = 4;
+
+class memory_compressor : public chd_file_compressor
+{
+public:
+	memory_compressor(std::vector<uint8_t> const &data) : m_data(data) { }
+
+protected:
+	virtual uint32_t read_data(void *dest, uint64_t offset, uint32_t length) override
+	{
+		uint64_t const available = (offset < m_data.size()) ? (m_data.size() - offset) : 0;
+		uint32_t const actual = uint32_t(std::min<uint64_t>(length, available));
+		std::memcpy(dest, m_data.data() + offset, actual);
+		std::memset(reinterpret_cast<uint8_t *>(dest) + actual, 0, length - actual);
+		return length;
+	}
+
+private:
+	std::vector<uint8_t> const &m_data;
+};
+
+std::vector<uint8_t> const &source_data()
+{
+	static std::vector<uint8_t> s_data;
+	if (s_data.empty())
+	{
+		s_data.resize(HUNK_BYTES * HUNK_COUNT);
+		uint32_t seed = 0x2468ace0;
+		for (uint32_t i = 0; i < (s_data.size() / UNIT_BYTES); i++)
+		{
+			seed = seed * 1103515245 + 12345;
+			int16_t const noise = int16_t((seed >> 16) & 0x3f) - 0x20;
+			int16_t const left = int16_t(std::sin(float(i) * 0.031f) * 12000.0f) + noise;
+			int16_t const right = int16_t(std::sin(float(i) * 0.017f) * 9000.0f) - noise;
+			s_data[i * 4 + 0] = uint8_t(left);
+			s_data[i * 4 + 1] = uint8_t(left >> 8);
+			s_data[i * 4 + 2] = uint8_t(right);
+			s_data[i * 4 + 3] = uint8_t(right >> 8);
+		}
+	}
+	return s_data;
+}
+
+// the images are made once and shared by every run of a benchmark
+std::vector<uint8_t> &chd_image(chd_codec_type codec)
+{
+	static std::map<chd_codec_type, std::vector<uint8_t> > s_images;
+	auto const found = s_images.find(codec);
+	if (s_images.end() != found)
+		return found->second;
+
+	std::vector<uint8_t> &image = s_images[codec];
+	std::vector<uint8_t> const &data = source_data();
+	chd_codec_type const compression[4] = { codec, CHD_CODEC_NONE, CHD_CODEC_NONE, CHD_CODEC_NONE };
+	if (CHD_CODEC_NONE == codec)
+	{
+		chd_file chd;
+		if (!chd.create(std::make_unique<util::vector_read_write_adapter<uint8_t> >(image), data.size(), HUNK_BYTES, UNIT_BYTES, compression))
+		{
+			for (uint32_t hunk = 0; hunk < HUNK_COUNT; hunk++)
+				chd.write_hunk(hunk, &data[hunk * HUNK_BYTES]);
+		}
+	}
+	else
+	{
+		memory_compressor chd(data);
+		if (!chd.create(std::make_unique<util::vector_read_write_adapter<uint8_t> >(image), data.size(), HUNK_BYTES, UNIT_BYTES, compression))
+		{
+			double progress, ratio;
+			std::error_condition err;
+			chd.compress_begin();
+			do
+				err = chd.compress_continue(progress, ratio);
+			while ((chd_file::error::COMPRESSING == err) || (chd_file::error::WALKING_PARENT == err));
+		}
+	}
+	return image;
+}
+
+template <chd_codec_type Codec>
+void BM_chd_read_hunk(benchmark::State& state) {
+	chd_file chd;
+	if (chd.open(std::make_unique<util::vector_read_write_adapter<uint8_t> >(chd_image(Codec)))) {
+		state.SkipWithError("unable to create the CHD");
+		return;
+	}
+	std::vector<uint8_t> buffer(HUNK_BYTES);
+	uint32_t hunk = 0;
+	while (state.KeepRunning()) {
+		chd.read_hunk(hunk, buffer.data());
+		hunk = (hunk + 1) % HUNK_COUNT;
+	}
+	benchmark::DoNotOptimize(buffer.data());
+	state.SetBytesProcessed(state.iterations() * HUNK_BYTES);
+}
+
+} // anonymous namespace
+
+BENCHMARK_TEMPLATE(BM_chd_read_hunk, CHD_CODEC_NONE);
+BENCHMARK_TEMPLATE(BM_chd_read_hunk, CHD_CODEC_ZLIB);
+BENCHMARK_TEMPLATE(BM_chd_read_hunk, CHD_CODEC_ZSTD);
+BENCHMARK_TEMPLATE(BM_chd_read_hunk, CHD_CODEC_LZMA);
+BENCHMARK_TEMPLATE(BM_chd_read_hunk, CHD_CODEC_HUFFMAN);
+BENCHMARK_TEMPLATE(BM_chd_read_hunk, CHD_CODEC_FLAC);
@@ -0,0 +1,79 @@
+#include "benchmark/benchmark_api.h"
+#include "emu.h"
+
+// a 320x240 screen of 16x16 4bpp tiles drawn into an indexed bitmap, the
+// way a sprite or tile layer is drawn, opaque and with pen 0 transparent;
+// indexed bitmaps don't go through a palette, so no device is needed
+
+namespace {
+
+constexpr int TILE_COUNT = 256;
+constexpr int SCREEN_WIDTH = 320;
+constexpr int SCREEN_HEIGHT = 240;
+
+const gfx_layout s_layout =
+{
+	16, 16,
+	TILE_COUNT,
+	4,
+	{ STEP4(0, 1) },
+	{ STEP16(0, 4) },
+	{ STEP16(0, 16 * 4) },
+	16 * 16 * 4
+};
+
+struct tile_data
+{
+	tile_data() : bitmap(SCREEN_WIDTH, SCREEN_HEIGHT)
+	{
+		// mostly solid tiles with a transparent border, like typical sprites
+		u32 seed = 0x12345678;
+		for (int tile = 0; tile < TILE_COUNT; tile++)
+		{
+			for (int y = 0; y < 16; y++)
+			{
+				for (int x = 0; x < 16; x += 2)
+				{
+					seed = seed * 1103515245 + 12345;
+					u8 const edge = ((y < 2) || (y > 13) || (x < 2) || (x > 12)) ? 0x00 : 0xff;
+					source[(tile * 16 * 16 + y * 16 + x) / 2] = u8(seed >> 16) & edge;
+				}
+			}
+		}
+		gfx = std::make_unique<gfx_element>(nullptr, s_layout, source, 0, 16, 0);
+		for (int tile = 0; tile < TILE_COUNT; tile++)
+			gfx->get_data(tile);
+	}
+
+	u8 source[TILE_COUNT * 16 * 16 / 2];
+	std::unique_ptr<gfx_element> gfx;
+	bitmap_ind16 bitmap;
+};
+
+template <bool Transparent, bool Flip>
+void BM_drawgfx_ind16(benchmark::State& state) {
+	tile_data data;
+	rectangle const clip(0, SCREEN_WIDTH - 1, 0, SCREEN_HEIGHT - 1);
+	u32 code = 0;
+	while (state.KeepRunning()) {
+		// offset by half a tile so the edges are clipped
+		for (int y = -8; y < SCREEN_HEIGHT; y += 16) {
+			for (int x = -8; x < SCREEN_WIDTH; x += 16) {
+				if (Transparent)
+					data.gfx->transpen(data.bitmap, clip, code, code >> 4, Flip, Flip, x, y, 0);
+				else
+					data.gfx->opaque(data.bitmap, clip, code, code >> 4, Flip, Flip, x, y);
+				code = (code + 1) % TILE_COUNT;
+			}
+		}
+		benchmark::DoNotOptimize(data.bitmap.pix(0));
+	}
+	state.SetItemsProcessed(state.iterations() * (SCREEN_WIDTH / 16 + 1) * (SCREEN_HEIGHT / 16 + 1));
+}
+
+} // anonymous namespace
+
+BENCHMARK_TEMPLATE(BM_drawgfx_ind16, false, false);
+BENCHMARK_TEMPLATE(BM_drawgfx_ind16, false, true);
+BENCHMARK_TEMPLATE(BM_drawgfx_ind16, true, false);
+BENCHMARK_TEMPLATE(BM_drawgfx_ind16, true, true);
@@ -0,0 +1,89 @@
+#include "benchmark/benchmark_api.h"
+#include "emu.h"
+
+// memory_read_generic/memory_write_generic over a plain array, reached
+// through function pointers the way handlers are reached through virtual
+// calls; the unaligned variants take the general path for the same aligned
+// addresses, which is what aligned accesses used before they had a fast
+// path of their own
+
+namespace {
+
+u8 s_memory[0x10000];
+
+template <int Width>
+emu::detail::handler_entry_size_t<Width> bench_read_native(offs_t address, emu::detail::handler_entry_size_t<Width> mask)
+{
+	using NativeType = emu::detail::handler_entry_size_t<Width>;
+	NativeType value;
+	memcpy(&value, &s_memory[address & 0xfff8], sizeof(value));
+	return value & mask;
+}
+
+template <int Width>
+void bench_write_native(offs_t address, emu::detail::handler_entry_size_t<Width> data, emu::detail::handler_entry_size_t<Width> mask)
+{
+	data &= mask;
+	memcpy(&s_memory[address & 0xfff8], &data, sizeof(data));
+}
+
+template <int Width> emu::detail::handler_entry_size_t<Width> (*volatile s_read_native)(offs_t, emu::detail::handler_entry_size_t<Width>) = &bench_read_native<Width>;
+template <int Width> void (*volatile s_write_native)(offs_t, emu::detail::handler_entry_size_t<Width>, emu::detail::handler_entry_size_t<Width>) = &bench_write_native<Width>;
+
+template <int Width, endianness_t Endian, int TargetWidth, bool Aligned>
+void BM_memory_read_generic(benchmark::State& state) {
+	using NativeType = emu::detail::handler_entry_size_t<Width>;
+	offs_t address = 0;
+	auto const read = s_read_native<Width>;
+	u64 sum = 0;
+	while (state.KeepRunning()) {
+		sum += memory_read_generic<Width, 0, Endian, TargetWidth, Aligned>(
+				[read] (offs_t offset, NativeType mask) -> NativeType { return read(offset, mask); },
+				address,
+				~emu::detail::handler_entry_size_t<TargetWidth>(0));
+		address = (address + (1 << TargetWidth)) & 0xffff;
+	}
+	benchmark::DoNotOptimize(sum);
+}
+
+template <int Width, endianness_t Endian, int TargetWidth, bool Aligned>
+void BM_memory_write_generic(benchmark::State& state) {
+	using NativeType = emu::detail::handler_entry_size_t<Width>;
+	offs_t address = 0;
+	auto const write = s_write_native<Width>;
+	emu::detail::handler_entry_size_t<TargetWidth> data = 0;
+	while (state.KeepRunning()) {
+		memory_write_generic<Width, 0, Endian, TargetWidth, Aligned>(
+				[write] (offs_t offset, NativeType data, NativeType mask) { write(offset, data, mask); },
+				address,
+				data++,
+				~emu::detail::handler_entry_size_t<TargetWidth>(0));
+		address = (address + (1 << TargetWidth)) & 0xffff;
+	}
+}
+
+} // anonymous namespace
+
+// 8-bit bus, 16-bit access (6809, Z80 word moves)
+BENCHMARK_TEMPLATE(BM_memory_read_generic, 0, ENDIANNESS_BIG, 1, true);
+BENCHMARK_TEMPLATE(BM_memory_read_generic, 0, ENDIANNESS_BIG, 1, false);
+
+// 16-bit bus, 32-bit access (68000)
+BENCHMARK_TEMPLATE(BM_memory_read_generic, 1, ENDIANNESS_BIG, 2, true);
+BENCHMARK_TEMPLATE(BM_memory_read_generic, 1, ENDIANNESS_BIG, 2, false);
+BENCHMARK_TEMPLATE(BM_memory_write_generic, 1, ENDIANNESS_BIG, 2, true);
+BENCHMARK_TEMPLATE(BM_memory_write_generic, 1, ENDIANNESS_BIG, 2, false);
+
+// 16-bit bus, 32-bit access (i386SX, V60)
+BENCHMARK_TEMPLATE(BM_memory_read_generic, 1, ENDIANNESS_LITTLE, 2, true);
+BENCHMARK_TEMPLATE(BM_memory_read_generic, 1, ENDIANNESS_LITTLE, 2, false);
+
+// 32-bit bus, 64-bit access (SH-4, PowerPC 603 on a 32-bit bus)
+BENCHMARK_TEMPLATE(BM_memory_read_generic, 2, ENDIANNESS_BIG, 3, true);
+BENCHMARK_TEMPLATE(BM_memory_read_generic, 2, ENDIANNESS_BIG, 3, false);
+BENCHMARK_TEMPLATE(BM_memory_write_generic, 2, ENDIANNESS_LITTLE, 3, true);
+BENCHMARK_TEMPLATE(BM_memory_write_generic, 2, ENDIANNESS_LITTLE, 3, false);
+
+// 32-bit bus, 8-bit access (sub-width, for comparison)
+BENCHMARK_TEMPLATE(BM_memory_read_generic, 2, ENDIANNESS_LITTLE, 0, true);
+BENCHMARK_TEMPLATE(BM_memory_read_generic, 2, ENDIANNESS_LITTLE, 0, false);
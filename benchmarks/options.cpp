@@ -0,0 +1,133 @@
+#include "benchmark/benchmark_api.h"
+#include "options.h"
+
+#include "corefile.h"
+#include "strformat.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// core_options with a table about the size of the emulator's own: adding
+// the entries, parsing a command line that sets some of them, and parsing
+// an INI file that sets all of them
+
+namespace {
+
+constexpr int OPTION_COUNT = 60;
+
+struct option_table
+{
+	option_table()
+	{
+		names.reserve(OPTION_COUNT);
+		defaults.reserve(OPTION_COUNT);
+		for (int i = 0; i < OPTION_COUNT; i++)
+		{
+			names.emplace_back(util::string_format("option%02d", i));
+			switch (i % 4)
+			{
+			case 0: defaults.emplace_back("0"); break;
+			case 1: defaults.emplace_back(util::string_format("%d", i)); break;
+			case 2: defaults.emplace_back("1.0"); break;
+			default: defaults.emplace_back("default"); break;
+			}
+		}
+
+		static core_options::option_type const types[4] = {
+				core_options::option_type::BOOLEAN,
+				core_options::option_type::INTEGER,
+				core_options::option_type::FLOAT,
+				core_options::option_type::STRING };
+		entries.push_back(options_entry{ nullptr, nullptr, core_options::option_type::HEADER, "BENCHMARK OPTIONS" });
+		for (int i = 0; i < OPTION_COUNT; i++)
+			entries.push_back(options_entry{ names[i].c_str(), defaults[i].c_str(), types[i % 4], "benchmark option" });
+		entries.push_back(options_entry{ nullptr });
+
+		args.emplace_back("mame");
+		for (int i = 0; i < OPTION_COUNT; i += 3)
+		{
+			if (core_options::option_type::BOOLEAN == types[i % 4])
+			{
+				args.emplace_back("-" + names[i]);
+			}
+			else
+			{
+				args.emplace_back("-" + names[i]);
+				args.emplace_back(util::string_format("%d", i * 2));
+			}
+		}
+
+		for (int i = 0; i < OPTION_COUNT; i++)
+			ini += util::string_format("%-26s %d\n", names[i], (i % 4) ? (i * 3) : 1);
+	}
+
+	std::vector<std::string> names;
+	std::vector<std::string> defaults;
+	std::vector<options_entry> entries;
+	std::vector<std::string> args;
+	std::string ini;
+};
+
+option_table const &table()
+{
+	static option_table const s_table;
+	return s_table;
+}
+
+void BM_options_add_entries(benchmark::State& state) {
+	option_table const &t = table();
+	while (state.KeepRunning()) {
+		core_options opts;
+		opts.add_entries(t.entries.data());
+		benchmark::DoNotOptimize(&opts);
+	}
+	state.SetItemsProcessed(state.iterations() * OPTION_COUNT);
+}
+
+void BM_options_parse_command_line(benchmark::State& state) {
+	option_table const &t = table();
+	core_options opts;
+	opts.add_entries(t.entries.data());
+	while (state.KeepRunning()) {
+		opts.parse_command_line(t.args, OPTION_PRIORITY_HIGH);
+		benchmark::DoNotOptimize(&opts);
+	}
+	state.SetItemsProcessed(state.iterations() * (t.args.size() - 1));
+}
+
+void BM_options_parse_ini_file(benchmark::State& state) {
+	option_table const &t = table();
+	core_options opts;
+	opts.add_entries(t.entries.data());
+	while (state.KeepRunning()) {
+		util::core_file::ptr file;
+		if (util::core_file::open_ram(t.ini.data(), t.ini.length(), OPEN_FLAG_READ, file)) {
+			state.SkipWithError("unable to open the INI data");
+			return;
+		}
+		opts.parse_ini_file(*file, OPTION_PRIORITY_NORMAL, false, false);
+		benchmark::DoNotOptimize(&opts);
+	}
+	state.SetBytesProcessed(state.iterations() * t.ini.length());
+}
+
+void BM_options_int_value(benchmark::State& state) {
+	option_table const &t = table();
+	core_options opts;
+	opts.add_entries(t.entries.data());
+	while (state.KeepRunning()) {
+		int total = 0;
+		for (int i = 1; i < OPTION_COUNT; i += 4)
+			total += opts.int_value(t.names[i]);
+		benchmark::DoNotOptimize(total);
+	}
+	state.SetItemsProcessed(state.iterations() * (OPTION_COUNT / 4));
+}
+
+} // anonymous namespace
+
+BENCHMARK(BM_options_add_entries);
+BENCHMARK(BM_options_parse_command_line);
+BENCHMARK(BM_options_parse_ini_file);
+BENCHMARK(BM_options_int_value);
@@ -0,0 +1,63 @@
+#include "benchmark/benchmark_api.h"
+#include "emucore.h"
+#include "video/rendspan.h"
+
+#include <vector>
+
+// software renderer row operations over a 256-texel row, for a 32bpp and
+// an RGB565 destination; the texels are a mix of transparent, opaque and
+// translucent pixels, as in typical artwork
+
+namespace {
+
+constexpr u32 ROW_PIXELS = 256;
+
+std::vector<u32> make_texels()
+{
+	std::vector<u32> result(ROW_PIXELS);
+	for (u32 i = 0; i < ROW_PIXELS; i++)
+		result[i] = (i * 0x00030507) | (((i & 0x30) == 0x30) ? 0x80000000 : (i & 0x40) ? 0xff000000 : 0);
+	return result;
+}
+
+template <typename PixelType, int SrcShiftR, int SrcShiftG, int SrcShiftB, int DstShiftR, int DstShiftG, int DstShiftB>
+void BM_render_span_alpha(benchmark::State& state) {
+	using span = render_span<PixelType, SrcShiftR, SrcShiftG, SrcShiftB, DstShiftR, DstShiftG, DstShiftB>;
+	std::vector<u32> const texels = make_texels();
+	std::vector<PixelType> dest(ROW_PIXELS, PixelType(0x5a5a5a5a));
+	while (state.KeepRunning()) {
+		span::alpha(dest.data(), texels.data(), ROW_PIXELS);
+		benchmark::DoNotOptimize(dest.data());
+	}
+}
+
+template <typename PixelType, int SrcShiftR, int SrcShiftG, int SrcShiftB, int DstShiftR, int DstShiftG, int DstShiftB>
+void BM_render_span_blend(benchmark::State& state) {
+	using span = render_span<PixelType, SrcShiftR, SrcShiftG, SrcShiftB, DstShiftR, DstShiftG, DstShiftB>;
+	std::vector<u32> const texels = make_texels();
+	std::vector<PixelType> dest(ROW_PIXELS, PixelType(0x5a5a5a5a));
+	while (state.KeepRunning()) {
+		span::blend(dest.data(), texels.data(), ROW_PIXELS, 0xc0, 0xc0, 0xc0, 0x40);
+		benchmark::DoNotOptimize(dest.data());
+	}
+}
+
+template <typename PixelType, int SrcShiftR, int SrcShiftG, int SrcShiftB, int DstShiftR, int DstShiftG, int DstShiftB>
+void BM_render_span_copy(benchmark::State& state) {
+	using span = render_span<PixelType, SrcShiftR, SrcShiftG, SrcShiftB, DstShiftR, DstShiftG, DstShiftB>;
+	std::vector<u32> const texels = make_texels();
+	std::vector<PixelType> dest(ROW_PIXELS);
+	while (state.KeepRunning()) {
+		span::copy(dest.data(), texels.data(), ROW_PIXELS);
+		benchmark::DoNotOptimize(dest.data());
+	}
+}
+
+} // anonymous namespace
+
+BENCHMARK_TEMPLATE(BM_render_span_alpha, u32, 0,0,0, 16,8,0);
+BENCHMARK_TEMPLATE(BM_render_span_alpha, u16, 3,2,3, 11,5,0);
+BENCHMARK_TEMPLATE(BM_render_span_blend, u32, 0,0,0, 16,8,0);
+BENCHMARK_TEMPLATE(BM_render_span_blend, u16, 3,2,3, 11,5,0);
+BENCHMARK_TEMPLATE(BM_render_span_copy, u32, 0,0,0, 24,16,8);
+BENCHMARK_TEMPLATE(BM_render_span_copy, u16, 3,2,3, 11,5,0);
@@ -0,0 +1,37 @@
+#include "benchmark/benchmark_api.h"
+#include "emucore.h"
+#include "resample.h"
+
+#include <cmath>
+#include <vector>
+
+// default resampler stream kernels over a 20ms update at 48kHz, from a
+// 44.1kHz source (upsampling, the common CD-rate case) and from a 55.93kHz
+// source (downsampling, typical of an FM chip's native rate)
+
+namespace {
+
+constexpr u32 OUTPUT_RATE = 48000;
+constexpr u32 OUTPUT_SAMPLES = OUTPUT_RATE / 50;
+
+template <u32 InputRate>
+void BM_resample(benchmark::State& state) {
+	float const step = float(InputRate) / float(OUTPUT_RATE);
+	u32 const srccount = u32(std::ceil(float(OUTPUT_SAMPLES) * step)) + 2;
+	std::vector<float> src(srccount);
+	for (u32 i = 0; i < srccount; i++)
+		src[i] = std::sin(float(i) * 0.05f);
+	std::vector<float> dest(OUTPUT_SAMPLES);
+	while (state.KeepRunning()) {
+		if (step < 1.0f)
+			resample_up(dest.data(), OUTPUT_SAMPLES, src.data(), srccount, 0.3f, step, 1.0f / step);
+		else
+			resample_down(dest.data(), OUTPUT_SAMPLES, src.data(), srccount, 0.3f, step, 1.0f / step);
+		benchmark::DoNotOptimize(dest.data());
+	}
+}
+
+} // anonymous namespace
+
+BENCHMARK_TEMPLATE(BM_resample, 44100);
+BENCHMARK_TEMPLATE(BM_resample, 55930);
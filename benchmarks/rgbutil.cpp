@@ -0,0 +1,89 @@
+#include "benchmark/benchmark_api.h"
+#include "emucore.h"
+#include "video/rgbutil.h"
+
+// blend and scale_and_clamp over a row of pixels, one pixel at a time and
+// two at a time; the _x2 versions pair up pixels in one register when the
+// build targets AVX2, and fall back to the single operations otherwise
+
+namespace {
+
+constexpr int ROW_PIXELS = 256;
+
+struct row_data
+{
+	row_data()
+	{
+		for (int i = 0; i < ROW_PIXELS; i++)
+		{
+			color[i].set(u32(i * 0x01030507));
+			other[i].set(u32(i * 0x07050301) ^ 0x80808080);
+			scale[i].set(0x100 - (i & 0x3f), 0x100 - (i & 0xff), 0x80 + (i & 0x7f), i);
+			factor[i] = u8(i * 37);
+		}
+	}
+
+	rgbaint_t color[ROW_PIXELS];
+	rgbaint_t other[ROW_PIXELS];
+	rgbaint_t scale[ROW_PIXELS];
+	u8 factor[ROW_PIXELS];
+};
+
+void BM_rgbaint_blend(benchmark::State& state) {
+	row_data data;
+	u32 sum = 0;
+	while (state.KeepRunning()) {
+		for (int i = 0; i < ROW_PIXELS; i++) {
+			rgbaint_t color(data.color[i]);
+			color.blend(data.other[i], data.factor[i]);
+			sum += color.to_rgba();
+		}
+	}
+	benchmark::DoNotOptimize(sum);
+}
+
+void BM_rgbaint_blend_x2(benchmark::State& state) {
+	row_data data;
+	u32 sum = 0;
+	while (state.KeepRunning()) {
+		for (int i = 0; i < ROW_PIXELS; i += 2) {
+			rgbaint_t color0(data.color[i]), color1(data.color[i + 1]);
+			rgbaint_t::blend_x2(color0, color1, data.other[i], data.other[i + 1], data.factor[i], data.factor[i + 1]);
+			sum += color0.to_rgba() + color1.to_rgba();
+		}
+	}
+	benchmark::DoNotOptimize(sum);
+}
+
+void BM_rgbaint_scale_and_clamp(benchmark::State& state) {
+	row_data data;
+	u32 sum = 0;
+	while (state.KeepRunning()) {
+		for (int i = 0; i < ROW_PIXELS; i++) {
+			rgbaint_t color(data.color[i]);
+			color.scale_and_clamp(data.scale[i]);
+			sum += color.to_rgba();
+		}
+	}
+	benchmark::DoNotOptimize(sum);
+}
+
+void BM_rgbaint_scale_and_clamp_x2(benchmark::State& state) {
+	row_data data;
+	u32 sum = 0;
+	while (state.KeepRunning()) {
+		for (int i = 0; i < ROW_PIXELS; i += 2) {
+			rgbaint_t color0(data.color[i]), color1(data.color[i + 1]);
+			rgbaint_t::scale_and_clamp_x2(color0, color1, data.scale[i], data.scale[i + 1]);
+			sum += color0.to_rgba() + color1.to_rgba();
+		}
+	}
+	benchmark::DoNotOptimize(sum);
+}
+
+} // anonymous namespace
+
+BENCHMARK(BM_rgbaint_blend);
+BENCHMARK(BM_rgbaint_blend_x2);
+BENCHMARK(BM_rgbaint_scale_and_clamp);
+BENCHMARK(BM_rgbaint_scale_and_clamp_x2);
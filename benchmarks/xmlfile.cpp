@@ -0,0 +1,80 @@
+#include "benchmark/benchmark_api.h"
+#include "xmlfile.h"
+
+#include "strformat.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// util::xml::file::string_read on a software list shaped document, which
+// is what most of the XML read at startup looks like, then a walk over the
+// parsed tree looking up attributes the way the software list code does
+
+namespace {
+
+constexpr int SOFTWARE_COUNT = 500;
+
+std::string const &software_list()
+{
+	static std::string s_text;
+	if (s_text.empty())
+	{
+		s_text = "<?xml version=\"1.0\"?>\n<softwarelist name=\"bench\" description=\"Benchmark list\">\n";
+		for (int i = 0; i < SOFTWARE_COUNT; i++)
+		{
+			s_text += util::string_format(
+					"\t<software name=\"soft%04d\"%s>\n"
+					"\t\t<description>Software title number %d (Rev %c)</description>\n"
+					"\t\t<year>19%02d</year>\n"
+					"\t\t<publisher>Publisher &amp; Sons</publisher>\n"
+					"\t\t<part name=\"cart\" interface=\"bench_cart\">\n"
+					"\t\t\t<dataarea name=\"rom\" size=\"%u\">\n"
+					"\t\t\t\t<rom name=\"soft%04d.bin\" size=\"%u\" crc=\"%08x\" sha1=\"%08x%08x%08x%08x%08x\" offset=\"0\"/>\n"
+					"\t\t\t</dataarea>\n"
+					"\t\t</part>\n"
+					"\t</software>\n",
+					i, (i % 3) ? util::string_format(" cloneof=\"soft%04d\"", i - (i % 3)) : std::string(),
+					i, 'A' + (i % 5), 80 + (i % 20),
+					0x8000 << (i % 4),
+					i, 0x8000 << (i % 4), i * 0x9e3779b9, i, i * 3, i * 5, i * 7, i * 11);
+		}
+		s_text += "</softwarelist>\n";
+	}
+	return s_text;
+}
+
+void BM_xml_string_read(benchmark::State& state) {
+	std::string const &text = software_list();
+	while (state.KeepRunning()) {
+		util::xml::file::ptr const root = util::xml::file::string_read(text.c_str(), nullptr);
+		benchmark::DoNotOptimize(root.get());
+	}
+	state.SetBytesProcessed(state.iterations() * text.length());
+}
+
+void BM_xml_walk(benchmark::State& state) {
+	util::xml::file::ptr const root = util::xml::file::string_read(software_list().c_str(), nullptr);
+	util::xml::data_node const *const list = root ? root->get_child("softwarelist") : nullptr;
+	if (!list) {
+		state.SkipWithError("unable to parse the document");
+		return;
+	}
+	uint64_t total = 0;
+	while (state.KeepRunning()) {
+		for (util::xml::data_node const *software = list->get_child("software"); software; software = software->get_next_sibling("software")) {
+			total += std::strlen(software->get_attribute_string("name", ""));
+			util::xml::data_node const *const part = software->get_child("part");
+			util::xml::data_node const *const area = part ? part->get_child("dataarea") : nullptr;
+			if (area)
+				total += area->get_attribute_int("size", 0);
+		}
+	}
+	benchmark::DoNotOptimize(total);
+	state.SetItemsProcessed(state.iterations() * SOFTWARE_COUNT);
+}
+
+} // anonymous namespace
+
+BENCHMARK(BM_xml_string_read);
+BENCHMARK(BM_xml_walk);
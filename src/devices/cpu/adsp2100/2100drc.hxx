@@ -0,0 +1,1727 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    2100drc.hxx
+
+    Universal machine language-based ADSP-21xx recompiler
+
+****************************************************************************
+
+    Notes:
+
+    ** The generated code works on the interpreter's own state: the
+       register file, DAG registers, stacks, PC and cycle counter are
+       loaded and stored in place, so a call back into the interpreter
+       needs nothing copied in either direction.
+
+    ** ALU and MAC operations are generated inline, together with the
+       memory reads and writes, register moves and dual fetches that
+       the multifunction instructions fuse with them.  Register loads
+       and moves within groups 0-2, immediate and DAG memory accesses,
+       DAG modify, jumps, calls, DO and IDLE are inline as well.
+       Shifts, divide steps, stack and mode control, returns, indirect
+       jumps, flag out, I/O, the group 3 registers and the ADSP-218x
+       constant-operand MAC forms run the interpreter's opcode switch.
+
+    ** The interpreter checks for the end of the current DO loop before
+       every instruction.  Here the check is compiled only in front of
+       the addresses known to end a loop: the front-end records every
+       DO it describes, and the loop stack is scanned on entry to catch
+       loops set up elsewhere.  Finding a new loop end flushes the
+       cache so that code compiled earlier picks up the check.  The
+       loop-back itself is a hash jump to the address on the PC stack,
+       and CE counted loops decrement the counter inline.
+
+    ** A short backward jump whose loop body only reads registers it
+       never writes and RAM it never writes (a status polling loop) is
+       recognised when it is compiled.  Once such a loop has gone round
+       once from the top, nothing it looks at can change until another
+       device runs, so the rest of the timeslice is burned at once
+       instead of being executed.  A jump to itself is treated the
+       same way, as the interpreter does.
+
+    ** The PC is written back at sequence boundaries and before every
+       callout; memory handlers invoked from a compiled read or write
+       see the PC of the last callout or sequence start.
+
+***************************************************************************/
+
+
+/***************************************************************************
+    DEBUGGING
+***************************************************************************/
+
+#define SINGLE_INSTRUCTION_MODE         (0)
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+#include "2100fe.hxx"
+
+// map variables
+#define MAPVAR_PC                       uml::M0
+
+// size of the execution code cache
+#define CACHE_SIZE                      (16 * 1024 * 1024)
+
+// compilation boundaries -- how far back/forward does the analysis extend?
+#define COMPILE_BACKWARDS_WORDS         64
+#define COMPILE_FORWARDS_WORDS          192
+#define COMPILE_MAX_SEQUENCE            64
+
+// exit codes
+#define EXECUTE_OUT_OF_CYCLES           0
+#define EXECUTE_MISSING_CODE            1
+
+// longest loop body checked for idling
+#define IDLE_LOOP_MAX_WORDS             8
+
+// state tracked by the idle loop analysis
+enum
+{
+	IDLE_RES_REG0   = 0,                // 16 group 0 registers, by register code
+	IDLE_RES_AF     = 16,
+	IDLE_RES_ASTAT  = 17,
+	IDLE_RES_I      = 18,               // 8 DAG index registers
+	IDLE_RES_M      = 26,               // 8 DAG modify registers
+	IDLE_RES_L      = 34                // 8 DAG length registers
+};
+
+
+/***************************************************************************
+    MACROS
+***************************************************************************/
+
+// state the generated code touches
+#define DRC_LOADVAR(block, dst, var)    UML_LOAD(block, dst, &(var), 0, uml::SIZE_DWORD, uml::SCALE_x1)
+#define DRC_STOREVAR(block, var, src)   UML_STORE(block, &(var), 0, src, uml::SIZE_DWORD, uml::SCALE_x1)
+
+
+
+/***************************************************************************
+    INLINE FUNCTIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    alloc_handle - allocate a handle if not
+    already allocated
+-------------------------------------------------*/
+
+static inline void alloc_handle(drcuml_state &drcuml, uml::code_handle *&handleptr, const char *name)
+{
+	if (handleptr == nullptr)
+		handleptr = drcuml.handle_alloc(name);
+}
+
+
+/*-------------------------------------------------
+    reg0_write_mask - return the group 0 registers
+    a write to a register code changes
+-------------------------------------------------*/
+
+static inline uint64_t reg0_write_mask(int regnum)
+{
+	// MR1 sign-extends into MR2
+	if (regnum == 0x0c)
+		return uint64_t(3) << (IDLE_RES_REG0 + 0x0c);
+	return uint64_t(1) << (IDLE_RES_REG0 + regnum);
+}
+
+
+/*-------------------------------------------------
+    cfunc_* - C callbacks from the generated code
+-------------------------------------------------*/
+
+static void cfunc_execute_op(void *param)
+{
+	((adsp21xx_device *)param)->func_execute_op();
+}
+
+static void cfunc_loop_end(void *param)
+{
+	((adsp21xx_device *)param)->func_loop_end();
+}
+
+static void cfunc_counter_expired(void *param)
+{
+	((adsp21xx_device *)param)->func_counter_expired();
+}
+
+static void cfunc_slow_condition(void *param)
+{
+	((adsp21xx_device *)param)->func_slow_condition();
+}
+
+static void cfunc_pc_stack_push(void *param)
+{
+	((adsp21xx_device *)param)->func_pc_stack_push();
+}
+
+static void cfunc_do_loop(void *param)
+{
+	((adsp21xx_device *)param)->func_do_loop();
+}
+
+static void cfunc_idle_loop(void *param)
+{
+	((adsp21xx_device *)param)->func_idle_loop();
+}
+
+
+
+/***************************************************************************
+    CORE CALLBACKS
+***************************************************************************/
+
+/*-------------------------------------------------
+    drc_init - initialize the recompiler
+-------------------------------------------------*/
+
+void adsp21xx_device::drc_init()
+{
+	// allocate the cache
+	try { m_drc_cache = std::make_unique<drc_cache>(CACHE_SIZE); }
+	catch (std::bad_alloc const &) { throw emu_fatalerror("Unable to allocate cache of size %d\n", (uint32_t)CACHE_SIZE); }
+
+	// initialize the UML generator; every instruction is a single word
+	m_drcuml = std::make_unique<drcuml_state>(*this, *m_drc_cache, 0, 1, 14, 0);
+
+	// add symbols for our stuff
+	m_drcuml->symbol_add(&m_pc, sizeof(m_pc), "pc");
+	m_drcuml->symbol_add(&m_icount, sizeof(m_icount), "icount");
+	m_drcuml->symbol_add(&m_astat, sizeof(m_astat), "astat");
+	m_drcuml->symbol_add(&m_cntr, sizeof(m_cntr), "cntr");
+	m_drcuml->symbol_add(&m_core, sizeof(m_core), "core");
+
+	// initialize the front-end helper
+	m_drcfe = std::make_unique<adsp21xx_frontend>(this, COMPILE_BACKWARDS_WORDS, COMPILE_FORWARDS_WORDS, SINGLE_INSTRUCTION_MODE ? 1 : COMPILE_MAX_SEQUENCE);
+
+	// mark the cache dirty so it is updated on next execute
+	m_drc_cache_dirty = true;
+}
+
+
+/*-------------------------------------------------
+    drc_execute - run compiled code until the
+    cycles run out
+-------------------------------------------------*/
+
+void adsp21xx_device::drc_execute()
+{
+	// every loop on the loop stack needs its end check compiled in
+	for (int i = 0; i < m_loop_sp && i < LOOP_STACK_DEPTH; i++)
+		if (drc_mark_loop_end(BIT(m_loop_stack[i], 4, 14)))
+			m_drc_cache_dirty = true;
+
+	// reset the cache if dirty
+	if (m_drc_cache_dirty)
+		code_flush_cache();
+	m_drc_cache_dirty = false;
+
+	// an idle loop has to go round in full within one timeslice
+	m_drc_idle_pc = ~0;
+
+	// execute
+	int execute_result;
+	do
+	{
+		execute_result = m_drcuml->execute(*m_drc_entry);
+
+		// if we need to recompile, do it
+		if (execute_result == EXECUTE_MISSING_CODE)
+			code_compile_block(m_pc);
+	}
+	while (execute_result != EXECUTE_OUT_OF_CYCLES);
+}
+
+
+/*-------------------------------------------------
+    drc_mark_loop_end - record that an address
+    ends a DO loop; returns true if it is new
+-------------------------------------------------*/
+
+bool adsp21xx_device::drc_mark_loop_end(offs_t pc)
+{
+	uint32_t &word = m_drc_loop_ends[(pc >> 5) & 0x1ff];
+	const uint32_t bit = 1 << (pc & 31);
+	if (word & bit)
+		return false;
+	word |= bit;
+	return true;
+}
+
+
+/*-------------------------------------------------
+    func_execute_op - run one instruction through
+    the interpreter
+-------------------------------------------------*/
+
+void adsp21xx_device::func_execute_op()
+{
+	execute_op(m_drc_op);
+}
+
+
+/*-------------------------------------------------
+    func_loop_end - check the loop condition at
+    the end of a DO loop; the PC already points
+    past the last instruction
+-------------------------------------------------*/
+
+void adsp21xx_device::func_loop_end()
+{
+	if (condition(m_loop_condition))
+		m_pc = pc_stack_top();
+	else
+	{
+		loop_stack_pop();
+		pc_stack_pop_val();
+	}
+}
+
+
+/*-------------------------------------------------
+    func_counter_expired - leave a counted loop
+    whose counter has run out
+-------------------------------------------------*/
+
+void adsp21xx_device::func_counter_expired()
+{
+	cntr_stack_pop();
+	loop_stack_pop();
+	pc_stack_pop_val();
+}
+
+
+/*-------------------------------------------------
+    func_slow_condition - count down CNTR for a
+    CE condition
+-------------------------------------------------*/
+
+void adsp21xx_device::func_slow_condition()
+{
+	m_drc_arg = slow_condition();
+}
+
+
+/*-------------------------------------------------
+    func_pc_stack_push - push the PC for a call
+-------------------------------------------------*/
+
+void adsp21xx_device::func_pc_stack_push()
+{
+	pc_stack_push();
+}
+
+
+/*-------------------------------------------------
+    func_do_loop - set up a DO loop
+-------------------------------------------------*/
+
+void adsp21xx_device::func_do_loop()
+{
+	loop_stack_push(m_drc_arg);
+	pc_stack_push();
+}
+
+
+/*-------------------------------------------------
+    func_idle_loop - skip the rest of the
+    timeslice in the idle loop from the address
+    in drc_arg to the jump in drc_idle_pc
+-------------------------------------------------*/
+
+void adsp21xx_device::func_idle_loop()
+{
+	idle_loop_skip(m_drc_arg, m_drc_idle_pc);
+}
+
+
+
+/***************************************************************************
+    CACHE MANAGEMENT
+***************************************************************************/
+
+/*-------------------------------------------------
+    code_flush_cache - flush the cache and
+    regenerate static code
+-------------------------------------------------*/
+
+void adsp21xx_device::code_flush_cache()
+{
+	// empty the transient cache contents
+	m_drcuml->reset();
+
+	try
+	{
+		// generate the entry point and out-of-cycles handlers
+		static_generate_entry_point();
+		static_generate_nocode_handler();
+		static_generate_out_of_cycles();
+	}
+	catch (drcuml_block::abort_compilation &)
+	{
+		fatalerror("Unrecoverable error generating static code\n");
+	}
+}
+
+
+/*-------------------------------------------------
+    code_compile_block - compile a block at the
+    specified pc
+-------------------------------------------------*/
+
+void adsp21xx_device::code_compile_block(offs_t pc)
+{
+	drcuml_state &drcuml = *m_drcuml;
+	const opcode_desc *seqhead, *seqlast;
+	bool override = false;
+
+	auto profile = g_profiler.start(PROFILER_DRC_COMPILE);
+
+	// get a description of this sequence
+	const opcode_desc *desclist = m_drcfe->describe_code(pc);
+
+	// a newly found loop end needs a check in code compiled before, so start
+	// again from an empty cache
+	if (m_drc_loops_changed)
+	{
+		code_flush_cache();
+		desclist = m_drcfe->describe_code(pc);
+		m_drc_loops_changed = false;
+	}
+
+	// if we get an error back, flush the cache and try again
+	bool succeeded = false;
+	while (!succeeded)
+	{
+		try
+		{
+			// start the block
+			drcuml_block &block(drcuml.begin_block(32768));
+			compiler_state compiler;
+			compiler.labelnum = 1;
+
+			// loop until we get through all instruction sequences
+			for (seqhead = desclist; seqhead != nullptr; seqhead = seqlast->next())
+			{
+				// add a code log entry
+				if (drcuml.logging())
+					block.append_comment("-------------------------");                 // comment
+
+				// determine the last instruction in this sequence
+				for (seqlast = seqhead; seqlast != nullptr; seqlast = seqlast->next())
+					if (seqlast->flags & OPFLAG_END_SEQUENCE)
+						break;
+				assert(seqlast != nullptr);
+
+				// if we don't have a hash for this pc, or if we are overriding all, add one
+				if (override || !drcuml.hash_exists(0, seqhead->pc))
+					UML_HASH(block, 0, seqhead->pc);                                    // hash    0,pc
+
+				// if we already have a hash, and this is the first sequence, assume that we
+				// are recompiling due to being out of sync and allow future overrides
+				else if (seqhead == desclist)
+				{
+					override = true;
+					UML_HASH(block, 0, seqhead->pc);                                    // hash    0,pc
+				}
+
+				// otherwise, redispatch to that fixed PC and skip the rest of the processing
+				else
+				{
+					UML_HASHJMP(block, 0, seqhead->pc, *m_drc_nocode);                  // hashjmp 0,seqhead->pc,nocode
+					continue;
+				}
+
+				// validate any of this code that lives in RAM
+				generate_checksum_block(block, compiler, seqhead, seqlast);
+
+				// iterate over instructions in the sequence and compile them
+				for (const opcode_desc *curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+					generate_sequence_instruction(block, compiler, curdesc);
+
+				// count off cycles and go to the next instruction
+				const offs_t nextpc = seqlast->pc + seqlast->length;
+				generate_update_cycles(block, compiler, nextpc);                        // <subtract cycles>
+				if (seqlast->next() == nullptr || seqlast->next()->pc != nextpc)
+					UML_HASHJMP(block, 0, nextpc, *m_drc_nocode);                       // hashjmp 0,nextpc,nocode
+			}
+
+			// end the sequence
+			block.end();
+			succeeded = true;
+		}
+		catch (drcuml_block::abort_compilation &)
+		{
+			code_flush_cache();
+		}
+	}
+}
+
+
+
+/***************************************************************************
+    STATIC CODEGEN
+***************************************************************************/
+
+/*-------------------------------------------------
+    static_generate_entry_point - generate a
+    static entry point
+-------------------------------------------------*/
+
+void adsp21xx_device::static_generate_entry_point()
+{
+	drcuml_state &drcuml = *m_drcuml;
+
+	// begin generating
+	drcuml_block &block(drcuml.begin_block(20));
+
+	// forward references
+	alloc_handle(drcuml, m_drc_nocode, "nocode");
+
+	alloc_handle(drcuml, m_drc_entry, "entry");
+	UML_HANDLE(block, *m_drc_entry);                                                    // handle  entry
+
+	// generate a hash jump via the current PC
+	DRC_LOADVAR(block, uml::I0, m_pc);                                                  // load    i0,[pc]
+	UML_HASHJMP(block, 0, uml::I0, *m_drc_nocode);                                      // hashjmp 0,i0,nocode
+
+	block.end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_nocode_handler - generate an
+    exception handler for "out of code"
+-------------------------------------------------*/
+
+void adsp21xx_device::static_generate_nocode_handler()
+{
+	drcuml_state &drcuml = *m_drcuml;
+
+	// begin generating
+	drcuml_block &block(drcuml.begin_block(10));
+
+	// store the PC and ask for a compile
+	alloc_handle(drcuml, m_drc_nocode, "nocode");
+	UML_HANDLE(block, *m_drc_nocode);                                                   // handle  nocode
+	UML_GETEXP(block, uml::I0);                                                         // getexp  i0
+	DRC_STOREVAR(block, m_pc, uml::I0);                                                 // store   [pc],i0
+	UML_EXIT(block, EXECUTE_MISSING_CODE);                                              // exit    EXECUTE_MISSING_CODE
+
+	block.end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_out_of_cycles - generate an
+    out of cycles exception handler
+-------------------------------------------------*/
+
+void adsp21xx_device::static_generate_out_of_cycles()
+{
+	drcuml_state &drcuml = *m_drcuml;
+
+	// begin generating
+	drcuml_block &block(drcuml.begin_block(10));
+
+	// store the PC and return to the core
+	alloc_handle(drcuml, m_drc_out_of_cycles, "out_of_cycles");
+	UML_HANDLE(block, *m_drc_out_of_cycles);                                            // handle  out_of_cycles
+	UML_GETEXP(block, uml::I0);                                                         // getexp  i0
+	DRC_STOREVAR(block, m_pc, uml::I0);                                                 // store   [pc],i0
+	UML_EXIT(block, EXECUTE_OUT_OF_CYCLES);                                             // exit    EXECUTE_OUT_OF_CYCLES
+
+	block.end();
+}
+
+
+
+/***************************************************************************
+    CODE GENERATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    generate_update_cycles - generate code to
+    subtract cycles from the icount and generate
+    an exception if out; the PC parameter must not
+    be I5
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param)
+{
+	if (compiler.cycles > 0)
+	{
+		DRC_LOADVAR(block, uml::I5, m_icount);                                          // load    i5,[icount]
+		UML_SUB(block, uml::I5, uml::I5, compiler.cycles);                              // sub     i5,i5,cycles
+		DRC_STOREVAR(block, m_icount, uml::I5);                                         // store   [icount],i5
+		UML_CMP(block, uml::I5, 0);                                                     // cmp     i5,0
+		UML_EXHc(block, uml::COND_LE, *m_drc_out_of_cycles, param);                     // exh     out_of_cycles,param,LE
+	}
+	compiler.cycles = 0;
+}
+
+
+/*-------------------------------------------------
+    generate_checksum_block - generate code to
+    validate a sequence of opcodes
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_checksum_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *seqhead, const opcode_desc *seqlast)
+{
+	uint32_t sum = 0;
+	bool first = true;
+
+	// sum every word in RAM the sequence was compiled from
+	for (const opcode_desc *curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+	{
+		const void *base = m_program.space().get_write_ptr(curdesc->physpc);
+		if (base == nullptr)
+			continue;
+		if (first && m_drcuml->logging())
+			block.append_comment("[Validation for %04X]", seqhead->pc);                // comment
+		UML_LOAD(block, first ? uml::I0 : uml::I1, base, 0, uml::SIZE_DWORD, uml::SCALE_x4);   // load    i0/i1,base,0,dword
+		if (!first)
+			UML_ADD(block, uml::I0, uml::I0, uml::I1);                                  // add     i0,i0,i1
+		sum += curdesc->opptr.l[0];
+		first = false;
+	}
+
+	if (!first)
+	{
+		UML_CMP(block, uml::I0, sum);                                                   // cmp     i0,sum
+		UML_EXHc(block, uml::COND_NE, *m_drc_nocode, seqhead->pc);                      // exne    nocode,seqhead->pc
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_sequence_instruction - generate code
+    for a single instruction in a sequence
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	// add an entry for the log
+	if (m_drcuml->logging())
+		block.append_comment("%04X: %06X", desc->pc, desc->opptr.l[0]);                // comment
+
+	// set the PC map variable
+	UML_MAPVAR(block, MAPVAR_PC, desc->pc);                                             // mapvar  PC,desc->pc
+
+	// accumulate total cycles
+	compiler.cycles += desc->cycles;
+
+	// at the end of the current loop the next PC is picked before the
+	// instruction runs, and the instruction is followed by a dispatch on it
+	if (desc->userflags & ADSP_USERFLAG_LOOP_END)
+	{
+		uml::code_label skip = compiler.labelnum++;
+		compiler_state compiler_temp(compiler);
+		compiler_temp.dynamic_next = true;
+
+		DRC_LOADVAR(block, uml::I0, m_loop);                                            // load    i0,[loop]
+		UML_CMP(block, uml::I0, desc->pc);                                              // cmp     i0,pc
+		UML_JMPc(block, uml::COND_NE, skip);                                            // jmp     skip,NE
+		generate_loop_end(block, compiler_temp, desc);                                  // <pick the next pc>
+		generate_instruction(block, compiler_temp, desc);                               // <instruction>
+		DRC_LOADVAR(block, uml::I0, m_pc);                                              // load    i0,[pc]
+		generate_branch(block, compiler_temp, uml::I0);                                 // <branch to i0>
+		UML_LABEL(block, skip);                                                         // skip:
+
+		compiler.labelnum = compiler_temp.labelnum;
+	}
+
+	generate_instruction(block, compiler, desc);
+}
+
+
+/*-------------------------------------------------
+    generate_instruction - compile an instruction,
+    or hand it to the interpreter
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	if (!generate_opcode(block, compiler, desc))
+		generate_interpret(block, compiler, desc);
+}
+
+
+/*-------------------------------------------------
+    generate_loop_end - generate the loop check
+    for the last instruction of the current loop,
+    leaving the next PC in [pc]
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_loop_end(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	uml::code_label generic = compiler.labelnum++;
+	uml::code_label expired = compiler.labelnum++;
+	uml::code_label done = compiler.labelnum++;
+
+	// going round again re-enters the loop body from its top
+	DRC_STOREVAR(block, m_drc_idle_pc, ~0);                                             // store   [idle_pc],~0
+	DRC_STOREVAR(block, m_pc, desc->pc + 1);                                            // store   [pc],pc+1
+
+	// counted loops are checked inline, anything else through the condition table
+	DRC_LOADVAR(block, uml::I0, m_loop_condition);                                      // load    i0,[loop_condition]
+	UML_CMP(block, uml::I0, 14);                                                        // cmp     i0,14
+	UML_JMPc(block, uml::COND_NE, generic);                                             // jmp     generic,NE
+	DRC_LOADVAR(block, uml::I0, m_cntr);                                                // load    i0,[cntr]
+	UML_SUB(block, uml::I0, uml::I0, 1);                                                // sub     i0,i0,1
+	DRC_STOREVAR(block, m_cntr, uml::I0);                                               // store   [cntr],i0
+	UML_CMP(block, uml::I0, 0);                                                         // cmp     i0,0
+	UML_JMPc(block, uml::COND_LE, expired);                                             // jmp     expired,LE
+
+	// the loop top is on the PC stack
+	DRC_LOADVAR(block, uml::I0, m_pc_sp);                                               // load    i0,[pc_sp]
+	UML_SUB(block, uml::I1, uml::I0, 1);                                                // sub     i1,i0,1
+	UML_CMP(block, uml::I0, 0);                                                         // cmp     i0,0
+	UML_MOVc(block, uml::COND_LE, uml::I1, 0);                                          // mov     i1,0,LE
+	UML_LOAD(block, uml::I1, m_pc_stack, uml::I1, uml::SIZE_DWORD, uml::SCALE_x4);      // load    i1,pc_stack,i1,dword
+	DRC_STOREVAR(block, m_pc, uml::I1);                                                 // store   [pc],i1
+	UML_JMP(block, done);                                                               // jmp     done
+
+	UML_LABEL(block, expired);                                                          // expired:
+	UML_CALLC(block, cfunc_counter_expired, this);                                      // callc   cfunc_counter_expired
+	UML_JMP(block, done);                                                               // jmp     done
+
+	UML_LABEL(block, generic);                                                          // generic:
+	UML_CALLC(block, cfunc_loop_end, this);                                             // callc   cfunc_loop_end
+
+	UML_LABEL(block, done);                                                             // done:
+}
+
+
+/*-------------------------------------------------
+    generate_interpret - generate a call to the
+    interpreter for an instruction
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_interpret(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	DRC_STOREVAR(block, m_drc_op, desc->opptr.l[0]);                                    // store   [drc_op],op
+	DRC_STOREVAR(block, m_ppc, desc->pc);                                               // store   [ppc],pc
+	generate_set_next_pc(block, compiler, desc);                                        // <store the next pc>
+	UML_CALLC(block, cfunc_execute_op, this);                                           // callc   cfunc_execute_op
+
+	// at the end of a loop the caller dispatches on the PC anyway
+	if (!compiler.dynamic_next)
+		generate_redirect(block, compiler, desc->pc + 1);                               // <redirect if the pc moved>
+}
+
+
+/*-------------------------------------------------
+    generate_branch - generate the code for a
+    taken branch
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_branch(drcuml_block &block, compiler_state &compiler, uml::parameter targetpc)
+{
+	compiler_state compiler_temp(compiler);
+
+	generate_update_cycles(block, compiler_temp, targetpc);                             // <subtract cycles>
+	UML_HASHJMP(block, 0, targetpc, *m_drc_nocode);                                     // hashjmp 0,targetpc,nocode
+
+	// update the label
+	compiler.labelnum = compiler_temp.labelnum;
+}
+
+
+/*-------------------------------------------------
+    generate_redirect - generate code to follow
+    the PC if a callout moved it away from the
+    expected address
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_redirect(drcuml_block &block, compiler_state &compiler, offs_t expected)
+{
+	uml::code_label skip = compiler.labelnum++;
+
+	DRC_LOADVAR(block, uml::I0, m_pc);                                                  // load    i0,[pc]
+	UML_CMP(block, uml::I0, expected);                                                  // cmp     i0,expected
+	UML_JMPc(block, uml::COND_E, skip);                                                 // jmp     skip,E
+	DRC_STOREVAR(block, m_drc_idle_pc, ~0);                                             // store   [idle_pc],~0
+	generate_branch(block, compiler, uml::I0);                                          // <branch to i0>
+	UML_LABEL(block, skip);                                                             // skip:
+}
+
+
+/*-------------------------------------------------
+    generate_set_next_pc - store the address of
+    the next instruction unless the loop check
+    already has
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_set_next_pc(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	if (!compiler.dynamic_next)
+		DRC_STOREVAR(block, m_pc, desc->pc + 1);                                        // store   [pc],pc+1
+}
+
+
+/*-------------------------------------------------
+    generate_condition - generate code to jump to
+    the skip label if a condition does not hold
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_condition(drcuml_block &block, compiler_state &compiler, uint32_t cond, uml::code_label skip)
+{
+	if (cond == 15)
+		return;
+
+	// CE counts down CNTR and may pop the counter stack
+	if (cond == 14)
+	{
+		UML_CALLC(block, cfunc_slow_condition, this);                                   // callc   cfunc_slow_condition
+		DRC_LOADVAR(block, uml::I3, m_drc_arg);                                         // load    i3,[drc_arg]
+	}
+	else
+	{
+		DRC_LOADVAR(block, uml::I3, m_astat);                                           // load    i3,[astat]
+		UML_LOAD(block, uml::I3, &m_condition_table[cond << 8], uml::I3, uml::SIZE_BYTE, uml::SCALE_x1);   // load    i3,condition_table,i3,byte
+	}
+	UML_TEST(block, uml::I3, 1);                                                        // test    i3,1
+	UML_JMPc(block, uml::COND_Z, skip);                                                 // jmp     skip,Z
+}
+
+
+/*-------------------------------------------------
+    generate_read_reg0/generate_write_reg0 - move
+    a group 0 register to or from a parameter;
+    writes use I6
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_read_reg0(drcuml_block &block, uml::parameter dst, int regnum)
+{
+	UML_LOADS(block, dst, m_read0_ptr[regnum], 0, uml::SIZE_WORD, uml::SCALE_x1);      // loads   dst,reg,word
+}
+
+void adsp21xx_device::generate_write_reg0(drcuml_block &block, int regnum, uml::parameter src)
+{
+	switch (regnum)
+	{
+		case 0x09:
+		case 0x0d:
+			// SE and MR2 are eight bits, sign-extended
+			UML_SEXT(block, uml::I6, src, uml::SIZE_BYTE);                              // sext    i6,src,byte
+			UML_STORE(block, m_read0_ptr[regnum], 0, uml::I6, uml::SIZE_WORD, uml::SCALE_x1);   // store   reg,i6,word
+			break;
+
+		case 0x0c:
+			// MR1 sign-extends into MR2
+			UML_STORE(block, &m_core.mr.mrx.mr1, 0, src, uml::SIZE_WORD, uml::SCALE_x1);   // store   [mr1],src,word
+			UML_SEXT(block, uml::I6, src, uml::SIZE_WORD);                              // sext    i6,src,word
+			UML_SAR(block, uml::I6, uml::I6, 15);                                       // sar     i6,i6,15
+			UML_STORE(block, &m_core.mr.mrx.mr2, 0, uml::I6, uml::SIZE_WORD, uml::SCALE_x1);   // store   [mr2],i6,word
+			break;
+
+		default:
+			UML_STORE(block, m_read0_ptr[regnum], 0, src, uml::SIZE_WORD, uml::SCALE_x1);  // store   reg,src,word
+			break;
+	}
+}
+
+
+/*-------------------------------------------------
+    reg12_supported - return true if a group 1 or
+    2 register access is generated inline
+-------------------------------------------------*/
+
+bool adsp21xx_device::reg12_supported(int group, int regnum, bool write) const
+{
+	// the 218x overlay registers go through the interpreter
+	if (write)
+		return (regnum >> 2) != 3;
+	return group != 1 || m_chip_type != CHIP_TYPE_ADSP2181 || regnum < 0x0e;
+}
+
+
+/*-------------------------------------------------
+    generate_read_reg12/generate_write_reg12 -
+    move a DAG register to or from a parameter;
+    writes use I5 and I6
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_read_reg12(drcuml_block &block, uml::parameter dst, int group, int regnum)
+{
+	DRC_LOADVAR(block, dst, *(group == 1 ? m_read1_ptr : m_read2_ptr)[regnum]);         // load    dst,[reg]
+}
+
+void adsp21xx_device::generate_write_reg12(drcuml_block &block, int group, int regnum, uml::parameter src)
+{
+	const int index = (group == 1 ? 0 : 4) + (regnum & 3);
+
+	switch (regnum >> 2)
+	{
+		case 0:
+			// I updates the circular buffer base
+			UML_AND(block, uml::I6, src, 0x3fff);                                       // and     i6,src,0x3fff
+			DRC_STOREVAR(block, m_i[index], uml::I6);                                   // store   [i],i6
+			DRC_LOADVAR(block, uml::I5, m_lmask[index]);                                // load    i5,[lmask]
+			UML_AND(block, uml::I5, uml::I5, uml::I6);                                  // and     i5,i5,i6
+			DRC_STOREVAR(block, m_base[index], uml::I5);                                // store   [base],i5
+			break;
+
+		case 1:
+			// M is a signed 14-bit value
+			UML_SHL(block, uml::I6, src, 18);                                           // shl     i6,src,18
+			UML_SAR(block, uml::I6, uml::I6, 18);                                       // sar     i6,i6,18
+			DRC_STOREVAR(block, m_m[index], uml::I6);                                   // store   [m],i6
+			break;
+
+		case 2:
+			// L updates the mask and the circular buffer base
+			UML_AND(block, uml::I6, src, 0x3fff);                                       // and     i6,src,0x3fff
+			DRC_STOREVAR(block, m_l[index], uml::I6);                                   // store   [l],i6
+			UML_LOAD(block, uml::I5, m_mask_table, uml::I6, uml::SIZE_WORD, uml::SCALE_x2);   // load    i5,mask_table,i6,word
+			DRC_STOREVAR(block, m_lmask[index], uml::I5);                               // store   [lmask],i5
+			DRC_LOADVAR(block, uml::I6, m_i[index]);                                    // load    i6,[i]
+			UML_AND(block, uml::I5, uml::I5, uml::I6);                                  // and     i5,i5,i6
+			DRC_STOREVAR(block, m_base[index], uml::I5);                                // store   [base],i5
+			break;
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_dag - generate code to fetch the
+    address from a DAG and post-modify the index
+    register with circular wrap; the destination
+    must not be I4-I6
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_dag(drcuml_block &block, compiler_state &compiler, uml::parameter dst, int ireg, int mreg, bool reverse)
+{
+	uml::code_label below = compiler.labelnum++;
+	uml::code_label done = compiler.labelnum++;
+
+	DRC_LOADVAR(block, uml::I5, m_i[ireg]);                                             // load    i5,[i]
+	UML_MOV(block, dst, uml::I5);                                                       // mov     dst,i5
+
+	// DAG1 can output bit-reversed addresses
+	if (reverse)
+	{
+		uml::code_label skip = compiler.labelnum++;
+		DRC_LOADVAR(block, uml::I6, m_mstat);                                           // load    i6,[mstat]
+		UML_TEST(block, uml::I6, MSTAT_REVERSE);                                        // test    i6,MSTAT_REVERSE
+		UML_JMPc(block, uml::COND_Z, skip);                                             // jmp     skip,Z
+		UML_LOAD(block, dst, m_reverse_table, uml::I5, uml::SIZE_WORD, uml::SCALE_x2);  // load    dst,reverse_table,i5,word
+		UML_LABEL(block, skip);                                                         // skip:
+	}
+
+	// post-modify and wrap within the circular buffer
+	DRC_LOADVAR(block, uml::I6, m_m[mreg]);                                             // load    i6,[m]
+	UML_ADD(block, uml::I5, uml::I5, uml::I6);                                          // add     i5,i5,i6
+	UML_AND(block, uml::I5, uml::I5, 0x3fff);                                           // and     i5,i5,0x3fff
+	DRC_LOADVAR(block, uml::I6, m_base[ireg]);                                          // load    i6,[base]
+	DRC_LOADVAR(block, uml::I4, m_l[ireg]);                                             // load    i4,[l]
+	UML_CMP(block, uml::I5, uml::I6);                                                   // cmp     i5,i6
+	UML_JMPc(block, uml::COND_B, below);                                                // jmp     below,B
+	UML_ADD(block, uml::I6, uml::I6, uml::I4);                                          // add     i6,i6,i4
+	UML_CMP(block, uml::I5, uml::I6);                                                   // cmp     i5,i6
+	UML_JMPc(block, uml::COND_B, done);                                                 // jmp     done,B
+	UML_SUB(block, uml::I5, uml::I5, uml::I4);                                          // sub     i5,i5,i4
+	UML_JMP(block, done);                                                               // jmp     done
+	UML_LABEL(block, below);                                                            // below:
+	UML_ADD(block, uml::I5, uml::I5, uml::I4);                                          // add     i5,i5,i4
+	UML_LABEL(block, done);                                                             // done:
+	DRC_STOREVAR(block, m_i[ireg], uml::I5);                                            // store   [i],i5
+}
+
+
+/*-------------------------------------------------
+    generate_data_read_dag/generate_data_write_dag
+    - generate a data memory access through DAG1
+    or DAG2; writes use I3 for the address
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_data_read_dag(drcuml_block &block, compiler_state &compiler, uml::parameter dst, uint32_t op, bool dag2)
+{
+	const int base = dag2 ? 4 : 0;
+	generate_dag(block, compiler, dst, base + BIT(op, 2, 2), base + BIT(op, 0, 2), !dag2);   // <dag address>
+	UML_READ(block, dst, dst, uml::SIZE_WORD, uml::SPACE_DATA);                         // read    dst,dst,word,data
+}
+
+void adsp21xx_device::generate_data_write_dag(drcuml_block &block, compiler_state &compiler, uint32_t op, bool dag2, uml::parameter src)
+{
+	const int base = dag2 ? 4 : 0;
+	generate_dag(block, compiler, uml::I3, base + BIT(op, 2, 2), base + BIT(op, 0, 2), !dag2);   // <dag address>
+	UML_WRITE(block, uml::I3, src, uml::SIZE_WORD, uml::SPACE_DATA);                    // write   i3,src,word,data
+}
+
+
+/*-------------------------------------------------
+    generate_pgm_read_dag2/generate_pgm_write_dag2
+    - generate a program memory access through
+    DAG2, with PX holding the low eight bits;
+    writes use I2-I4
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_pgm_read_dag2(drcuml_block &block, compiler_state &compiler, uml::parameter dst, uint32_t op)
+{
+	generate_dag(block, compiler, dst, 4 + BIT(op, 2, 2), 4 + BIT(op, 0, 2), false);   // <dag address>
+	UML_READ(block, dst, dst, uml::SIZE_DWORD, uml::SPACE_PROGRAM);                     // read    dst,dst,dword,program
+	UML_STORE(block, &m_px, 0, dst, uml::SIZE_BYTE, uml::SCALE_x1);                     // store   [px],dst,byte
+	UML_SHR(block, dst, dst, 8);                                                        // shr     dst,dst,8
+}
+
+void adsp21xx_device::generate_pgm_write_dag2(drcuml_block &block, compiler_state &compiler, uint32_t op, uml::parameter src)
+{
+	generate_dag(block, compiler, uml::I3, 4 + BIT(op, 2, 2), 4 + BIT(op, 0, 2), false);   // <dag address>
+	UML_SHL(block, uml::I2, src, 8);                                                    // shl     i2,src,8
+	UML_LOAD(block, uml::I4, &m_px, 0, uml::SIZE_BYTE, uml::SCALE_x1);                  // load    i4,[px],byte
+	UML_OR(block, uml::I2, uml::I2, uml::I4);                                           // or      i2,i2,i4
+	UML_AND(block, uml::I2, uml::I2, 0xffffff);                                         // and     i2,i2,0xffffff
+	UML_WRITE(block, uml::I3, uml::I2, uml::SIZE_DWORD, uml::SPACE_PROGRAM);            // write   i3,i2,dword,program
+}
+
+
+/*-------------------------------------------------
+    generate_alu - generate an ALU operation to
+    AR or AF, updating ASTAT; uses I0-I6
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_alu(drcuml_block &block, compiler_state &compiler, uint32_t op, bool to_af, bool const_y)
+{
+	const uint32_t func = BIT(op, 13, 4);
+	const uint32_t xop = BIT(op, 8, 3);
+	const uint32_t yop = BIT(op, 11, 2);
+
+	// fetch the operands the function uses
+	if (func >= 2 && func != 4 && func != 5 && func != 8)
+		UML_LOAD(block, uml::I0, m_alu_xregs[xop], 0, uml::SIZE_WORD, uml::SCALE_x1);   // load    i0,xop,word
+	if (func != 11 && func != 15)
+	{
+		if (const_y)
+			UML_MOV(block, uml::I1, constants[BIT(op, 5, 3) | yop << 3]);               // mov     i1,constant
+		else
+			UML_LOAD(block, uml::I1, m_alu_yregs[yop], 0, uml::SIZE_WORD, uml::SCALE_x1);   // load    i1,yop,word
+	}
+
+	// flag calculations on the result in I2, collecting the flags in I3
+	auto carry_in = [&] ()
+	{
+		DRC_LOADVAR(block, uml::I4, m_astat);                                           // load    i4,[astat]
+		UML_SHR(block, uml::I4, uml::I4, 3);                                            // shr     i4,i4,3
+		UML_AND(block, uml::I4, uml::I4, 1);                                            // and     i4,i4,1
+	};
+	auto calc_nz = [&] ()
+	{
+		UML_SHR(block, uml::I3, uml::I2, 14);                                           // shr     i3,i2,14
+		UML_AND(block, uml::I3, uml::I3, NFLAG);                                        // and     i3,i3,NFLAG
+		UML_TEST(block, uml::I2, 0xffff);                                               // test    i2,0xffff
+		UML_SETc(block, uml::COND_Z, uml::I4);                                          // set     i4,Z
+		UML_OR(block, uml::I3, uml::I3, uml::I4);                                       // or      i3,i3,i4
+	};
+	auto calc_v = [&] (uml::parameter s, uml::parameter d)
+	{
+		UML_SHR(block, uml::I4, uml::I2, 1);                                            // shr     i4,i2,1
+		UML_XOR(block, uml::I4, uml::I4, uml::I2);                                      // xor     i4,i4,i2
+		UML_XOR(block, uml::I4, uml::I4, s);                                            // xor     i4,i4,s
+		UML_XOR(block, uml::I4, uml::I4, d);                                            // xor     i4,i4,d
+		UML_SHR(block, uml::I4, uml::I4, 13);                                           // shr     i4,i4,13
+		UML_AND(block, uml::I4, uml::I4, VFLAG);                                        // and     i4,i4,VFLAG
+		UML_OR(block, uml::I3, uml::I3, uml::I4);                                       // or      i3,i3,i4
+	};
+	auto calc_c = [&] (bool sub)
+	{
+		UML_SHR(block, uml::I4, uml::I2, 13);                                           // shr     i4,i2,13
+		UML_AND(block, uml::I4, uml::I4, CFLAG);                                        // and     i4,i4,CFLAG
+		if (sub)
+			UML_XOR(block, uml::I4, uml::I4, CFLAG);                                    // xor     i4,i4,CFLAG
+		UML_OR(block, uml::I3, uml::I3, uml::I4);                                       // or      i3,i3,i4
+	};
+	auto flag_if = [&] (uml::parameter src, uint32_t value, int flagbit)
+	{
+		UML_CMP(block, src, value);                                                     // cmp     src,value
+		UML_SETc(block, uml::COND_E, uml::I4);                                          // set     i4,E
+		if (flagbit != 0)
+			UML_SHL(block, uml::I4, uml::I4, flagbit);                                  // shl     i4,i4,flagbit
+		UML_OR(block, uml::I3, uml::I3, uml::I4);                                       // or      i3,i3,i4
+	};
+
+	switch (func)
+	{
+		case 0x00:  // Y
+			UML_MOV(block, uml::I2, uml::I1);                                           // mov     i2,i1
+			calc_nz();
+			break;
+
+		case 0x01:  // Y + 1
+			UML_ADD(block, uml::I2, uml::I1, 1);                                        // add     i2,i1,1
+			calc_nz();
+			flag_if(uml::I1, 0x7fff, 2);
+			flag_if(uml::I1, 0xffff, 3);
+			break;
+
+		case 0x02:  // X + Y + C
+			carry_in();
+			UML_ADD(block, uml::I1, uml::I1, uml::I4);                                  // add     i1,i1,i4
+			[[fallthrough]];
+		case 0x03:  // X + Y
+			UML_ADD(block, uml::I2, uml::I0, uml::I1);                                  // add     i2,i0,i1
+			calc_nz();
+			calc_v(uml::I0, uml::I1);
+			calc_c(false);
+			break;
+
+		case 0x04:  // NOT Y
+			UML_XOR(block, uml::I2, uml::I1, 0xffff);                                   // xor     i2,i1,0xffff
+			calc_nz();
+			break;
+
+		case 0x05:  // -Y
+			UML_SUB(block, uml::I2, 0, uml::I1);                                        // sub     i2,0,i1
+			calc_nz();
+			flag_if(uml::I1, 0x8000, 2);
+			flag_if(uml::I1, 0x0000, 3);
+			break;
+
+		case 0x06:  // X - Y + C - 1
+		case 0x07:  // X - Y
+			UML_SUB(block, uml::I2, uml::I0, uml::I1);                                  // sub     i2,i0,i1
+			if (func == 0x06)
+			{
+				carry_in();
+				UML_ADD(block, uml::I2, uml::I2, uml::I4);                              // add     i2,i2,i4
+				UML_SUB(block, uml::I2, uml::I2, 1);                                    // sub     i2,i2,1
+			}
+			calc_nz();
+			calc_v(uml::I0, uml::I1);
+			calc_c(true);
+			break;
+
+		case 0x08:  // Y - 1
+			UML_SUB(block, uml::I2, uml::I1, 1);                                        // sub     i2,i1,1
+			calc_nz();
+			flag_if(uml::I1, 0x8000, 2);
+			flag_if(uml::I1, 0x0000, 3);
+			break;
+
+		case 0x09:  // Y - X
+		case 0x0a:  // Y - X + C - 1
+			UML_SUB(block, uml::I2, uml::I1, uml::I0);                                  // sub     i2,i1,i0
+			if (func == 0x0a)
+			{
+				carry_in();
+				UML_ADD(block, uml::I2, uml::I2, uml::I4);                              // add     i2,i2,i4
+				UML_SUB(block, uml::I2, uml::I2, 1);                                    // sub     i2,i2,1
+			}
+			calc_nz();
+			calc_v(uml::I1, uml::I0);
+			calc_c(true);
+			break;
+
+		case 0x0b:  // NOT X
+			UML_XOR(block, uml::I2, uml::I0, 0xffff);                                   // xor     i2,i0,0xffff
+			calc_nz();
+			break;
+
+		case 0x0c:  // X AND Y
+			UML_AND(block, uml::I2, uml::I0, uml::I1);                                  // and     i2,i0,i1
+			calc_nz();
+			break;
+
+		case 0x0d:  // X OR Y
+			UML_OR(block, uml::I2, uml::I0, uml::I1);                                   // or      i2,i0,i1
+			calc_nz();
+			break;
+
+		case 0x0e:  // X XOR Y
+			UML_XOR(block, uml::I2, uml::I0, uml::I1);                                  // xor     i2,i0,i1
+			calc_nz();
+			break;
+
+		case 0x0f:  // ABS X
+			UML_SUB(block, uml::I2, 0, uml::I0);                                        // sub     i2,0,i0
+			UML_TEST(block, uml::I0, 0x8000);                                           // test    i0,0x8000
+			UML_MOVc(block, uml::COND_Z, uml::I2, uml::I0);                             // mov     i2,i0,Z
+			UML_CMP(block, uml::I0, 0);                                                 // cmp     i0,0
+			UML_SETc(block, uml::COND_E, uml::I3);                                      // set     i3,E
+			UML_CMP(block, uml::I0, 0x8000);                                            // cmp     i0,0x8000
+			UML_SETc(block, uml::COND_E, uml::I4);                                      // set     i4,E
+			UML_SUB(block, uml::I4, 0, uml::I4);                                        // sub     i4,0,i4
+			UML_AND(block, uml::I4, uml::I4, NFLAG | VFLAG);                            // and     i4,i4,NFLAG|VFLAG
+			UML_OR(block, uml::I3, uml::I3, uml::I4);                                   // or      i3,i3,i4
+			UML_SHR(block, uml::I4, uml::I0, 11);                                       // shr     i4,i0,11
+			UML_AND(block, uml::I4, uml::I4, SFLAG);                                    // and     i4,i4,SFLAG
+			UML_OR(block, uml::I3, uml::I3, uml::I4);                                   // or      i3,i3,i4
+			break;
+	}
+
+	// merge the new flags; ABS also replaces S
+	DRC_LOADVAR(block, uml::I4, m_astat);                                               // load    i4,[astat]
+	DRC_LOADVAR(block, uml::I5, m_astat_clear);                                         // load    i5,[astat_clear]
+	UML_AND(block, uml::I4, uml::I4, uml::I5);                                          // and     i4,i4,i5
+	if (func == 0x0f)
+		UML_AND(block, uml::I4, uml::I4, ~uint32_t(SFLAG));                             // and     i4,i4,~SFLAG
+	UML_OR(block, uml::I4, uml::I4, uml::I3);                                           // or      i4,i4,i3
+	DRC_STOREVAR(block, m_astat, uml::I4);                                              // store   [astat],i4
+
+	// AR saturates on overflow when enabled
+	if (!to_af)
+	{
+		uml::code_label skip = compiler.labelnum++;
+		DRC_LOADVAR(block, uml::I5, m_mstat);                                           // load    i5,[mstat]
+		UML_TEST(block, uml::I5, MSTAT_SATURATE);                                       // test    i5,MSTAT_SATURATE
+		UML_JMPc(block, uml::COND_Z, skip);                                             // jmp     skip,Z
+		UML_TEST(block, uml::I4, VFLAG);                                                // test    i4,VFLAG
+		UML_JMPc(block, uml::COND_Z, skip);                                             // jmp     skip,Z
+		UML_MOV(block, uml::I2, 0x7fff);                                                // mov     i2,0x7fff
+		UML_TEST(block, uml::I4, CFLAG);                                                // test    i4,CFLAG
+		UML_MOVc(block, uml::COND_NZ, uml::I2, 0x8000);                                 // mov     i2,0x8000,NZ
+		UML_LABEL(block, skip);                                                         // skip:
+	}
+
+	UML_STORE(block, to_af ? &m_core.af : &m_core.ar, 0, uml::I2, uml::SIZE_WORD, uml::SCALE_x1);   // store   [ar/af],i2,word
+}
+
+
+/*-------------------------------------------------
+    generate_mac - generate a MAC operation to MR
+    or MF; uses I0-I4
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_mac(drcuml_block &block, compiler_state &compiler, uint32_t op, bool to_mf)
+{
+	const uint32_t func = BIT(op, 13, 4);
+	const uint32_t xop = BIT(op, 8, 3);
+	const uint32_t yop = BIT(op, 11, 2);
+
+	// function 0 is a no-op that leaves the flags alone
+	if (func == 0)
+		return;
+
+	// fetch the operands, signed or unsigned by function
+	if (BIT(0x333e, func))
+		UML_LOADS(block, uml::I0, m_mac_xregs[xop], 0, uml::SIZE_WORD, uml::SCALE_x1);  // loads   i0,xop,word
+	else
+		UML_LOAD(block, uml::I0, m_mac_xregs[xop], 0, uml::SIZE_WORD, uml::SCALE_x1);   // load    i0,xop,word
+	if (BIT(0x555e, func))
+		UML_LOADS(block, uml::I1, m_mac_yregs[yop], 0, uml::SIZE_WORD, uml::SCALE_x1);  // loads   i1,yop,word
+	else
+		UML_LOAD(block, uml::I1, m_mac_yregs[yop], 0, uml::SIZE_WORD, uml::SCALE_x1);   // load    i1,yop,word
+
+	// the 32-bit product is shifted left once in fractional mode
+	UML_MULU(block, uml::I2, uml::I3, uml::I0, uml::I1);                                // mulu    i2,i3,i0,i1
+	DRC_LOADVAR(block, uml::I4, m_mstat);                                               // load    i4,[mstat]
+	UML_TEST(block, uml::I4, MSTAT_INTEGER);                                            // test    i4,MSTAT_INTEGER
+	UML_SETc(block, uml::COND_Z, uml::I4);                                              // set     i4,Z
+	UML_SHL(block, uml::I2, uml::I2, uml::I4);                                          // shl     i2,i2,i4
+	UML_DSEXT(block, uml::I0, uml::I2, uml::SIZE_DWORD);                                // dsext   i0,i2,dword
+
+	// accumulate into MR
+	if (func == 0x02 || (func >= 0x08 && func <= 0x0b))
+	{
+		UML_DLOAD(block, uml::I1, &m_core.mr.mr, 0, uml::SIZE_QWORD, uml::SCALE_x1);    // dload   i1,[mr],qword
+		UML_DADD(block, uml::I0, uml::I1, uml::I0);                                     // dadd    i0,i1,i0
+	}
+	else if (func == 0x03 || func >= 0x0c)
+	{
+		UML_DLOAD(block, uml::I1, &m_core.mr.mr, 0, uml::SIZE_QWORD, uml::SCALE_x1);    // dload   i1,[mr],qword
+		UML_DSUB(block, uml::I0, uml::I1, uml::I0);                                     // dsub    i0,i1,i0
+	}
+
+	// rounding is biased unless the low half of the product is exactly 0x8000
+	if (func <= 0x03)
+	{
+		uml::code_label skip = compiler.labelnum++;
+		UML_DADD(block, uml::I0, uml::I0, 0x8000);                                      // dadd    i0,i0,0x8000
+		UML_AND(block, uml::I2, uml::I2, 0xffff);                                       // and     i2,i2,0xffff
+		UML_CMP(block, uml::I2, 0x8000);                                                // cmp     i2,0x8000
+		UML_JMPc(block, uml::COND_NE, skip);                                            // jmp     skip,NE
+		UML_DAND(block, uml::I0, uml::I0, ~uint64_t(0x10000));                          // dand    i0,i0,~0x10000
+		UML_LABEL(block, skip);                                                         // skip:
+	}
+
+	if (to_mf)
+	{
+		UML_SHR(block, uml::I0, uml::I0, 16);                                           // shr     i0,i0,16
+		UML_STORE(block, &m_core.mf, 0, uml::I0, uml::SIZE_WORD, uml::SCALE_x1);        // store   [mf],i0,word
+	}
+	else
+	{
+		// MV is set unless bits 31-39 are all the same
+		UML_DSHR(block, uml::I1, uml::I0, 31);                                          // dshr    i1,i0,31
+		UML_ADD(block, uml::I1, uml::I1, 1);                                            // add     i1,i1,1
+		UML_TEST(block, uml::I1, 0x1fe);                                                // test    i1,0x1fe
+		UML_SETc(block, uml::COND_NZ, uml::I1);                                         // set     i1,NZ
+		UML_SHL(block, uml::I1, uml::I1, 6);                                            // shl     i1,i1,6
+		DRC_LOADVAR(block, uml::I2, m_astat);                                           // load    i2,[astat]
+		UML_AND(block, uml::I2, uml::I2, ~uint32_t(MVFLAG));                            // and     i2,i2,~MVFLAG
+		UML_OR(block, uml::I2, uml::I2, uml::I1);                                       // or      i2,i2,i1
+		DRC_STOREVAR(block, m_astat, uml::I2);                                          // store   [astat],i2
+		UML_DSTORE(block, &m_core.mr.mr, 0, uml::I0, uml::SIZE_QWORD, uml::SCALE_x1);   // dstore  [mr],i0,qword
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_jump - generate a taken jump or call
+    to a fixed address
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_jump(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, offs_t target, bool call)
+{
+	// a short backward jump may close a loop that can only wait
+	if (!call && !compiler.dynamic_next && target <= desc->pc && idle_detection() && idle_loop_candidate(target, desc->pc))
+	{
+		generate_idle_loop(block, compiler, desc, target);
+		return;
+	}
+
+	// any other taken jump leaves a candidate idle loop
+	DRC_STOREVAR(block, m_drc_idle_pc, ~0);                                             // store   [idle_pc],~0
+	if (call)
+	{
+		generate_set_next_pc(block, compiler, desc);                                    // <store the next pc>
+		UML_CALLC(block, cfunc_pc_stack_push, this);                                    // callc   cfunc_pc_stack_push
+	}
+	generate_branch(block, compiler, target);                                           // <branch to target>
+}
+
+
+/*-------------------------------------------------
+    idle_loop_candidate - return true if the loop
+    from start to the jump at end can only repeat
+    until something outside the core changes
+-------------------------------------------------*/
+
+bool adsp21xx_device::idle_loop_candidate(offs_t start, offs_t end)
+{
+	if (end - start >= IDLE_LOOP_MAX_WORDS)
+		return false;
+
+	// collect what the body reads before writing it, and what it writes
+	uint64_t read_first = 0, written = 0;
+	auto reads = [&] (uint64_t mask) { read_first |= mask & ~written; };
+	auto writes = [&] (uint64_t mask) { written |= mask; };
+
+	// ALU operand registers, as bits
+	static const uint8_t alu_x[8] = { 0x00, 0x01, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+	static const uint8_t alu_y[4] = { 0x04, 0x05, IDLE_RES_AF, 0xff };
+	auto alu = [&] (uint32_t op, bool const_y)
+	{
+		const uint32_t func = BIT(op, 13, 4);
+		if (func >= 2 && func != 4 && func != 5 && func != 8)
+			reads(uint64_t(1) << alu_x[BIT(op, 8, 3)]);
+		if (func != 11 && func != 15 && !const_y && BIT(op, 11, 2) != 3)
+			reads(uint64_t(1) << alu_y[BIT(op, 11, 2)]);
+		if (func == 2 || func == 6 || func == 10)
+			reads(uint64_t(1) << IDLE_RES_ASTAT);
+		writes((uint64_t(1) << (BIT(op, 18) ? IDLE_RES_AF : 0x0a)) | (uint64_t(1) << IDLE_RES_ASTAT));
+	};
+
+	for (offs_t pc = start; pc <= end; pc++)
+	{
+		if (drc_is_loop_end(pc))
+			return false;
+
+		const uint32_t op = m_cache.read_dword(pc);
+		const uint32_t cond = BIT(op, 0, 4);
+		switch (BIT(op, 16, 8))
+		{
+			case 0x00:                                                  // NOP
+			case 0x08:                                                  // reserved
+				break;
+
+			case 0x03:                                                  // jump on flag in
+				// other jumps may only leave the loop
+				if (BIT(op, 0))
+					return false;
+				if (pc != end)
+				{
+					const offs_t target = BIT(op, 4, 12) | BIT(op, 2, 2) << 12;
+					if (target >= start && target <= end)
+						return false;
+				}
+				break;
+
+			case 0x0d:                                                  // register move within group 0
+				if (BIT(op, 8, 4) != 0)
+					return false;
+				reads(uint64_t(1) << (IDLE_RES_REG0 + BIT(op, 0, 4)));
+				writes(reg0_write_mask(BIT(op, 4, 4)));
+				break;
+
+			case 0x18: case 0x19: case 0x1a: case 0x1b:                 // conditional jump
+				if (cond == 14)
+					return false;
+				if (pc != end && BIT(op, 4, 14) >= start && BIT(op, 4, 14) <= end)
+					return false;
+				if (cond != 15)
+					reads(uint64_t(1) << IDLE_RES_ASTAT);
+				break;
+
+			case 0x22: case 0x23: case 0x26: case 0x27:                 // conditional ALU
+				if (cond == 14)
+					return false;
+				if (cond != 15)
+					reads(uint64_t(1) << IDLE_RES_ASTAT);
+				alu(op, m_chip_type >= CHIP_TYPE_ADSP2181 && BIT(op, 4));
+				break;
+
+			case 0x2a: case 0x2b: case 0x2e: case 0x2f:                 // ALU with register move
+				if (m_chip_type >= CHIP_TYPE_ADSP2181 && BIT(op, 16, 8) <= 0x2b && BIT(op, 0, 8) == 0xaa)
+					return false;
+				reads(uint64_t(1) << (IDLE_RES_REG0 + BIT(op, 0, 4)));
+				alu(op, false);
+				writes(reg0_write_mask(BIT(op, 4, 4)));
+				break;
+
+			case 0x30: case 0x31: case 0x32: case 0x33:                 // group 0 immediate
+			case 0x40: case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47:
+			case 0x48: case 0x49: case 0x4a: case 0x4b: case 0x4c: case 0x4d: case 0x4e: case 0x4f:
+				writes(reg0_write_mask(BIT(op, 0, 4)));
+				break;
+
+			case 0x34: case 0x35: case 0x36: case 0x37:                 // DAG register immediate
+			case 0x38: case 0x39: case 0x3a: case 0x3b:
+			{
+				const int index = (BIT(op, 18, 2) == 1 ? 0 : 4) + BIT(op, 0, 2);
+				switch (BIT(op, 2, 2))
+				{
+					case 0: reads(uint64_t(1) << (IDLE_RES_L + index)); writes(uint64_t(1) << (IDLE_RES_I + index)); break;
+					case 1: writes(uint64_t(1) << (IDLE_RES_M + index)); break;
+					case 2: reads(uint64_t(1) << (IDLE_RES_I + index)); writes(uint64_t(1) << (IDLE_RES_L + index)); break;
+					case 3: return false;
+				}
+				break;
+			}
+
+			case 0x80: case 0x81: case 0x82: case 0x83:                 // group 0 read from RAM
+				if (m_data.space().get_read_ptr(BIT(op, 4, 14)) == nullptr)
+					return false;
+				writes(reg0_write_mask(BIT(op, 0, 4)));
+				break;
+
+			default:
+				return false;
+		}
+	}
+
+	// the loop repeats unchanged if no iteration feeds the next
+	return (read_first & written) == 0;
+}
+
+
+/*-------------------------------------------------
+    generate_idle_loop - generate a taken jump
+    that closes an idle loop candidate
+-------------------------------------------------*/
+
+void adsp21xx_device::generate_idle_loop(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, offs_t target)
+{
+	// a jump to itself waits at once
+	if (target == desc->pc)
+	{
+		DRC_STOREVAR(block, m_drc_arg, target);                                         // store   [arg],target
+		DRC_STOREVAR(block, m_drc_idle_pc, desc->pc);                                   // store   [idle_pc],pc
+		UML_CALLC(block, cfunc_idle_loop, this);                                        // callc   cfunc_idle_loop
+		generate_branch(block, compiler, target);                                       // <branch to target>
+		return;
+	}
+
+	uml::code_label first = compiler.labelnum++;
+
+	// the loop has gone round in full once it comes back here with no
+	// other jump taken in between
+	DRC_LOADVAR(block, uml::I0, m_drc_idle_pc);                                         // load    i0,[idle_pc]
+	UML_CMP(block, uml::I0, desc->pc);                                                  // cmp     i0,pc
+	UML_JMPc(block, uml::COND_NE, first);                                               // jmp     first,NE
+
+	// and the body in RAM must still be the one analysed
+	uint32_t sum = 0;
+	bool any = false;
+	for (offs_t pc = target; pc < desc->pc; pc++)
+	{
+		const void *base = m_program.space().get_write_ptr(pc);
+		if (base == nullptr)
+			continue;
+		UML_LOAD(block, any ? uml::I1 : uml::I0, base, 0, uml::SIZE_DWORD, uml::SCALE_x4);   // load    i0/i1,base,0,dword
+		if (any)
+			UML_ADD(block, uml::I0, uml::I0, uml::I1);                                  // add     i0,i0,i1
+		sum += m_cache.read_dword(pc);
+		any = true;
+	}
+	if (any)
+	{
+		UML_CMP(block, uml::I0, sum);                                                   // cmp     i0,sum
+		UML_JMPc(block, uml::COND_NE, first);                                           // jmp     first,NE
+	}
+
+	// nothing the loop looks at can change until another device runs
+	DRC_STOREVAR(block, m_drc_arg, target);                                             // store   [arg],target
+	UML_CALLC(block, cfunc_idle_loop, this);                                            // callc   cfunc_idle_loop
+	generate_branch(block, compiler, target);                                           // <branch to target>
+
+	UML_LABEL(block, first);                                                            // first:
+	DRC_STOREVAR(block, m_drc_idle_pc, desc->pc);                                       // store   [idle_pc],pc
+	generate_branch(block, compiler, target);                                           // <branch to target>
+}
+
+
+/*-------------------------------------------------
+    generate_multifunction - generate an ALU or
+    MAC operation with its fused condition, move
+    or memory accesses
+-------------------------------------------------*/
+
+bool adsp21xx_device::generate_multifunction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	const uint32_t op = desc->opptr.l[0];
+	const uint32_t index = BIT(op, 16, 8);
+	const bool is_alu = BIT(op, 17);
+
+	auto compute = [&] (bool to_f, bool const_y)
+	{
+		if (is_alu)
+			generate_alu(block, compiler, op, to_f, const_y);
+		else
+			generate_mac(block, compiler, op, to_f);
+	};
+
+	// 0x20-0x27: conditional ALU/MAC
+	if (index < 0x28)
+	{
+		// the 218x MAC forms that square X go through the interpreter
+		if (!is_alu && m_chip_type >= CHIP_TYPE_ADSP2181 && (op & 0x0018f0) == 0x000010)
+			return false;
+
+		uml::code_label skip = compiler.labelnum++;
+		generate_condition(block, compiler, BIT(op, 0, 4), skip);                       // <skip unless cond>
+		compute(BIT(op, 18), is_alu && m_chip_type >= CHIP_TYPE_ADSP2181 && BIT(op, 4));
+		UML_LABEL(block, skip);                                                         // skip:
+	}
+
+	// 0x28-0x2f: ALU/MAC with register move
+	else if (index < 0x30)
+	{
+		if (index <= 0x2b && is_alu && m_chip_type >= CHIP_TYPE_ADSP2181 && BIT(op, 0, 8) == 0xaa)
+			return false;
+
+		generate_read_reg0(block, uml::I7, BIT(op, 0, 4));                              // <read source>
+		compute(BIT(op, 18), false);
+		generate_write_reg0(block, BIT(op, 4, 4), uml::I7);                             // <write destination>
+	}
+
+	// 0x50-0x7f: ALU/MAC with memory read or write
+	else if (index < 0x80)
+	{
+		const uint32_t mem = BIT(op, 20, 2);
+		const int reg = BIT(op, 4, 4);
+
+		// writes take the register before the operation, reads land after it
+		if (BIT(op, 19))
+		{
+			generate_read_reg0(block, uml::I7, reg);                                    // <read source>
+			if (mem == 1)
+				generate_pgm_write_dag2(block, compiler, op, uml::I7);                  // <write pgm>
+			else
+				generate_data_write_dag(block, compiler, op, mem == 3, uml::I7);        // <write data>
+			compute(BIT(op, 18), false);
+		}
+		else
+		{
+			compute(BIT(op, 18), false);
+			if (mem == 1)
+				generate_pgm_read_dag2(block, compiler, uml::I7, op);                   // <read pgm>
+			else
+				generate_data_read_dag(block, compiler, uml::I7, op, mem == 3);         // <read data>
+			generate_write_reg0(block, reg, uml::I7);                                   // <write destination>
+		}
+	}
+
+	// 0xc0-0xff: ALU to AR or MAC to MR with a data and a program fetch
+	else
+	{
+		static const int xdst[4] = { 0x00, 0x01, 0x02, 0x03 };         // AX0, AX1, MX0, MX1
+		static const int ydst[4] = { 0x04, 0x05, 0x06, 0x07 };         // AY0, AY1, MY0, MY1
+
+		compute(false, false);
+		generate_data_read_dag(block, compiler, uml::I7, op, false);                    // <read data>
+		UML_STORE(block, m_read0_ptr[xdst[BIT(op, 18, 2)]], 0, uml::I7, uml::SIZE_WORD, uml::SCALE_x1);   // store   xreg,i7,word
+		generate_pgm_read_dag2(block, compiler, uml::I7, op >> 4);                      // <read pgm>
+		UML_STORE(block, m_read0_ptr[ydst[BIT(op, 20, 2)]], 0, uml::I7, uml::SIZE_WORD, uml::SCALE_x1);   // store   yreg,i7,word
+	}
+	return true;
+}
+
+
+/*-------------------------------------------------
+    generate_opcode - generate code for a single
+    instruction; returns false to use the
+    interpreter
+-------------------------------------------------*/
+
+bool adsp21xx_device::generate_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	const uint32_t op = desc->opptr.l[0];
+	const uint32_t cond = BIT(op, 0, 4);
+
+	switch (BIT(op, 16, 8))
+	{
+		case 0x00:                                                      // NOP
+		case 0x08:                                                      // reserved
+			return true;
+
+		case 0x02:                                                      // IDLE
+		{
+			if (!BIT(op, 15))
+				return false;
+
+			// only an interrupt ends it, and those are taken between timeslices
+			DRC_STOREVAR(block, m_idle, 1);                                             // store   [idle],1
+			DRC_STOREVAR(block, m_icount, 0);                                           // store   [icount],0
+			if (compiler.dynamic_next)
+			{
+				DRC_LOADVAR(block, uml::I0, m_pc);                                      // load    i0,[pc]
+				generate_branch(block, compiler, uml::I0);                              // <branch to i0>
+			}
+			else
+				generate_branch(block, compiler, desc->pc + 1);                         // <branch to pc+1>
+			return true;
+		}
+
+		case 0x03:                                                      // jump/call on flag in
+		{
+			uml::code_label skip = compiler.labelnum++;
+			UML_LOAD(block, uml::I0, &m_flagin, 0, uml::SIZE_BYTE, uml::SCALE_x1);      // load    i0,[flagin],byte
+			UML_TEST(block, uml::I0, 0xff);                                             // test    i0,0xff
+			UML_JMPc(block, BIT(op, 1) ? uml::COND_Z : uml::COND_NZ, skip);             // jmp     skip,Z/NZ
+			generate_jump(block, compiler, desc, BIT(op, 4, 12) | BIT(op, 2, 2) << 12, BIT(op, 0));
+			UML_LABEL(block, skip);                                                     // skip:
+			return true;
+		}
+
+		case 0x09:                                                      // modify address register
+		{
+			const int ireg = BIT(op, 2, 3);
+			generate_dag(block, compiler, uml::I0, ireg, (ireg & 4) | (op & 3), false); // <modify>
+			return true;
+		}
+
+		case 0x0d:                                                      // internal data move
+		{
+			const int dgroup = BIT(op, 10, 2);
+			const int sgroup = BIT(op, 8, 2);
+			if (dgroup == 3 || sgroup == 3)
+				return false;
+			if ((dgroup != 0 && !reg12_supported(dgroup, BIT(op, 4, 4), true)) || (sgroup != 0 && !reg12_supported(sgroup, BIT(op, 0, 4), false)))
+				return false;
+
+			if (sgroup == 0)
+				generate_read_reg0(block, uml::I0, BIT(op, 0, 4));                      // <read source>
+			else
+				generate_read_reg12(block, uml::I0, sgroup, BIT(op, 0, 4));             // <read source>
+			if (dgroup == 0)
+				generate_write_reg0(block, BIT(op, 4, 4), uml::I0);                     // <write destination>
+			else
+				generate_write_reg12(block, dgroup, BIT(op, 4, 4), uml::I0);            // <write destination>
+			return true;
+		}
+
+		case 0x14: case 0x15: case 0x16: case 0x17:                     // DO
+			generate_set_next_pc(block, compiler, desc);                                // <store the next pc>
+			DRC_STOREVAR(block, m_drc_arg, op & 0x3ffff);                               // store   [drc_arg],op & 0x3ffff
+			UML_CALLC(block, cfunc_do_loop, this);                                      // callc   cfunc_do_loop
+			return true;
+
+		case 0x18: case 0x19: case 0x1a: case 0x1b:                     // conditional jump
+		case 0x1c: case 0x1d: case 0x1e: case 0x1f:                     // conditional call
+		{
+			uml::code_label skip = compiler.labelnum++;
+			generate_condition(block, compiler, cond, skip);                            // <skip unless cond>
+			generate_jump(block, compiler, desc, BIT(op, 4, 14), BIT(op, 18));
+			UML_LABEL(block, skip);                                                     // skip:
+			return true;
+		}
+
+		case 0x20: case 0x21: case 0x22: case 0x23: case 0x24: case 0x25: case 0x26: case 0x27:
+		case 0x28: case 0x29: case 0x2a: case 0x2b: case 0x2c: case 0x2d: case 0x2e: case 0x2f:
+		case 0x50: case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57:
+		case 0x58: case 0x59: case 0x5a: case 0x5b: case 0x5c: case 0x5d: case 0x5e: case 0x5f:
+		case 0x60: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+		case 0x68: case 0x69: case 0x6a: case 0x6b: case 0x6c: case 0x6d: case 0x6e: case 0x6f:
+		case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77:
+		case 0x78: case 0x79: case 0x7a: case 0x7b: case 0x7c: case 0x7d: case 0x7e: case 0x7f:
+		case 0xc0: case 0xc1: case 0xc2: case 0xc3: case 0xc4: case 0xc5: case 0xc6: case 0xc7:
+		case 0xc8: case 0xc9: case 0xca: case 0xcb: case 0xcc: case 0xcd: case 0xce: case 0xcf:
+		case 0xd0: case 0xd1: case 0xd2: case 0xd3: case 0xd4: case 0xd5: case 0xd6: case 0xd7:
+		case 0xd8: case 0xd9: case 0xda: case 0xdb: case 0xdc: case 0xdd: case 0xde: case 0xdf:
+		case 0xe0: case 0xe1: case 0xe2: case 0xe3: case 0xe4: case 0xe5: case 0xe6: case 0xe7:
+		case 0xe8: case 0xe9: case 0xea: case 0xeb: case 0xec: case 0xed: case 0xee: case 0xef:
+		case 0xf0: case 0xf1: case 0xf2: case 0xf3: case 0xf4: case 0xf5: case 0xf6: case 0xf7:
+		case 0xf8: case 0xf9: case 0xfa: case 0xfb: case 0xfc: case 0xfd: case 0xfe: case 0xff:
+			return generate_multifunction(block, compiler, desc);
+
+		case 0x30: case 0x31: case 0x32: case 0x33:                     // load register immediate
+		case 0x34: case 0x35: case 0x36: case 0x37:
+		case 0x38: case 0x39: case 0x3a: case 0x3b:
+		{
+			const int group = BIT(op, 18, 2);
+			if (group != 0 && !reg12_supported(group, cond, true))
+				return false;
+
+			UML_MOV(block, uml::I0, util::sext(op >> 4, 14) & 0xffff);                  // mov     i0,imm
+			if (group == 0)
+				generate_write_reg0(block, cond, uml::I0);                              // <write register>
+			else
+				generate_write_reg12(block, group, cond, uml::I0);                      // <write register>
+			return true;
+		}
+
+		case 0x40: case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47:
+		case 0x48: case 0x49: case 0x4a: case 0x4b: case 0x4c: case 0x4d: case 0x4e: case 0x4f:
+			// load data register immediate
+			UML_MOV(block, uml::I0, BIT(op, 4, 16));                                    // mov     i0,imm
+			generate_write_reg0(block, cond, uml::I0);                                  // <write register>
+			return true;
+
+		case 0x80: case 0x81: case 0x82: case 0x83:                     // read data memory (immediate addr)
+		case 0x84: case 0x85: case 0x86: case 0x87:
+		case 0x88: case 0x89: case 0x8a: case 0x8b:
+		{
+			const int group = BIT(op, 18, 2);
+			if (group != 0 && !reg12_supported(group, cond, true))
+				return false;
+
+			UML_READ(block, uml::I0, BIT(op, 4, 14), uml::SIZE_WORD, uml::SPACE_DATA);  // read    i0,addr,word,data
+			if (group == 0)
+				generate_write_reg0(block, cond, uml::I0);                              // <write register>
+			else
+				generate_write_reg12(block, group, cond, uml::I0);                      // <write register>
+			return true;
+		}
+
+		case 0x90: case 0x91: case 0x92: case 0x93:                     // write data memory (immediate addr)
+		case 0x94: case 0x95: case 0x96: case 0x97:
+		case 0x98: case 0x99: case 0x9a: case 0x9b:
+		{
+			const int group = BIT(op, 18, 2);
+			if (group != 0 && !reg12_supported(group, cond, false))
+				return false;
+
+			if (group == 0)
+				generate_read_reg0(block, uml::I0, cond);                               // <read register>
+			else
+				generate_read_reg12(block, uml::I0, group, cond);                       // <read register>
+			UML_WRITE(block, BIT(op, 4, 14), uml::I0, uml::SIZE_WORD, uml::SPACE_DATA); // write   addr,i0,word,data
+			return true;
+		}
+
+		case 0xa0: case 0xa1: case 0xa2: case 0xa3: case 0xa4: case 0xa5: case 0xa6: case 0xa7:
+		case 0xa8: case 0xa9: case 0xaa: case 0xab: case 0xac: case 0xad: case 0xae: case 0xaf:
+		case 0xb0: case 0xb1: case 0xb2: case 0xb3: case 0xb4: case 0xb5: case 0xb6: case 0xb7:
+		case 0xb8: case 0xb9: case 0xba: case 0xbb: case 0xbc: case 0xbd: case 0xbe: case 0xbf:
+			// data memory write (immediate) through a DAG
+			generate_data_write_dag(block, compiler, op, BIT(op, 20), BIT(op, 4, 16));    // <write data>
+			return true;
+	}
+	return false;
+}
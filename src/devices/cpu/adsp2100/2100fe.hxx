@@ -0,0 +1,98 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    2100fe.hxx
+
+    Front-end for the ADSP-21xx recompiler
+
+    Every instruction is one 24-bit word and takes one cycle.  Jumps
+    and calls are described with their targets so short loops stay
+    inside a block.  DO describes the first instruction of its loop as
+    a branch target so the loop top always has an entry point, and
+    records the loop's last instruction so the code generator puts the
+    end-of-loop check in front of it.
+
+***************************************************************************/
+
+
+//**************************************************************************
+//  MACROS
+//**************************************************************************
+
+// user flags
+#define ADSP_USERFLAG_LOOP_END          (1 << 0)    // instruction ends a DO loop
+
+
+
+//**************************************************************************
+//  ADSP21XX FRONTEND
+//**************************************************************************
+
+//-------------------------------------------------
+//  adsp21xx_frontend - constructor
+//-------------------------------------------------
+
+adsp21xx_frontend::adsp21xx_frontend(adsp21xx_device *adsp, uint32_t window_start, uint32_t window_end, uint32_t max_sequence)
+	: drc_frontend(*adsp, window_start, window_end, max_sequence),
+		m_adsp(adsp)
+{
+}
+
+
+//-------------------------------------------------
+//  describe - build a description of a single
+//  instruction
+//-------------------------------------------------
+
+bool adsp21xx_frontend::describe(opcode_desc &desc, const opcode_desc *prev)
+{
+	const uint32_t op = m_adsp->m_cache.read_dword(desc.physpc);
+	const uint32_t cond = BIT(op, 0, 4);
+
+	desc.opptr.l[0] = op;
+	desc.length = 1;
+	desc.cycles = 1;
+
+	// the end of a loop picks its successor before it runs
+	if (m_adsp->drc_is_loop_end(desc.pc))
+		desc.userflags |= ADSP_USERFLAG_LOOP_END;
+
+	switch (BIT(op, 16, 8))
+	{
+		case 0x02:                                                      // IDLE
+			if (BIT(op, 15))
+				desc.flags |= OPFLAG_END_SEQUENCE;
+			break;
+
+		case 0x03:                                                      // jump/call on flag in
+			desc.targetpc = BIT(op, 4, 12) | BIT(op, 2, 2) << 12;
+			desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+			break;
+
+		case 0x0a:                                                      // RTS/RTI
+		case 0x0b:                                                      // indirect jump/call
+			if (cond == 15)
+				desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+			else
+				desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+			break;
+
+		case 0x14: case 0x15: case 0x16: case 0x17:                     // DO
+			if (m_adsp->drc_mark_loop_end(BIT(op, 4, 14)))
+				m_adsp->m_drc_loops_changed = true;
+			desc.targetpc = desc.pc + 1;
+			desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+			break;
+
+		case 0x18: case 0x19: case 0x1a: case 0x1b:                     // jump
+		case 0x1c: case 0x1d: case 0x1e: case 0x1f:                     // call
+			desc.targetpc = BIT(op, 4, 14);
+			if (cond == 15)
+				desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+			else
+				desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+			break;
+	}
+	return true;
+}
@@ -13,6 +13,9 @@
 
 #pragma once
 
+#include "cpu/drcfe.h"
+#include "cpu/drcuml.h"
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -182,8 +185,12 @@ enum
 
 // ======================> adsp21xx_device
 
+class adsp21xx_frontend;
+
 class adsp21xx_device : public cpu_device
 {
+	friend class adsp21xx_frontend;
+
 public:
 	virtual ~adsp21xx_device();
 
@@ -198,6 +205,15 @@ public:
 	// Returns base address for circular dag
 	uint32_t get_ibase(int index) { return m_base[index]; }
 
+	// recompiler callbacks
+	void func_execute_op();
+	void func_loop_end();
+	void func_counter_expired();
+	void func_slow_condition();
+	void func_pc_stack_push();
+	void func_do_loop();
+	void func_idle_loop();
+
 protected:
 	enum
 	{
@@ -267,6 +283,7 @@ protected:
 	void mac_op_mf_xop(uint32_t op);
 	void shift_op(uint32_t op);
 	void shift_op_imm(uint32_t op);
+	inline void execute_op(uint32_t op);
 
 	// memory access
 	inline uint16_t data_read(uint32_t addr);
@@ -294,6 +311,54 @@ protected:
 	virtual bool generate_irq(int which, int indx = 0) = 0;
 	virtual void check_irqs() = 0;
 
+	// internal compiler state
+	struct compiler_state
+	{
+		compiler_state &operator=(compiler_state const &) = delete;
+
+		uint32_t            cycles = 0;         // accumulated cycles
+		bool                dynamic_next = false; // the loop logic has already stored the next PC
+		uml::code_label     labelnum;           // index for local labels
+	};
+
+	// recompiler
+	void drc_init();
+	void drc_execute();
+	bool drc_mark_loop_end(offs_t pc);
+	bool drc_is_loop_end(offs_t pc) const { return BIT(m_drc_loop_ends[(pc >> 5) & 0x1ff], pc & 31); }
+	void code_flush_cache();
+	void code_compile_block(offs_t pc);
+	void static_generate_entry_point();
+	void static_generate_nocode_handler();
+	void static_generate_out_of_cycles();
+	void generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param);
+	void generate_checksum_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *seqhead, const opcode_desc *seqlast);
+	void generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_loop_end(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_interpret(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_branch(drcuml_block &block, compiler_state &compiler, uml::parameter targetpc);
+	void generate_redirect(drcuml_block &block, compiler_state &compiler, offs_t expected);
+	void generate_set_next_pc(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_condition(drcuml_block &block, compiler_state &compiler, uint32_t cond, uml::code_label skip);
+	void generate_read_reg0(drcuml_block &block, uml::parameter dst, int regnum);
+	void generate_write_reg0(drcuml_block &block, int regnum, uml::parameter src);
+	bool reg12_supported(int group, int regnum, bool write) const;
+	void generate_read_reg12(drcuml_block &block, uml::parameter dst, int group, int regnum);
+	void generate_write_reg12(drcuml_block &block, int group, int regnum, uml::parameter src);
+	void generate_dag(drcuml_block &block, compiler_state &compiler, uml::parameter dst, int ireg, int mreg, bool reverse);
+	void generate_data_read_dag(drcuml_block &block, compiler_state &compiler, uml::parameter dst, uint32_t op, bool dag2);
+	void generate_data_write_dag(drcuml_block &block, compiler_state &compiler, uint32_t op, bool dag2, uml::parameter src);
+	void generate_pgm_read_dag2(drcuml_block &block, compiler_state &compiler, uml::parameter dst, uint32_t op);
+	void generate_pgm_write_dag2(drcuml_block &block, compiler_state &compiler, uint32_t op, uml::parameter src);
+	void generate_alu(drcuml_block &block, compiler_state &compiler, uint32_t op, bool to_af, bool const_y);
+	void generate_mac(drcuml_block &block, compiler_state &compiler, uint32_t op, bool to_mf);
+	void generate_jump(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, offs_t target, bool call);
+	bool idle_loop_candidate(offs_t start, offs_t end);
+	void generate_idle_loop(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, offs_t target);
+	bool generate_multifunction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	bool generate_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+
 	// internal state
 	static const int PC_STACK_DEPTH     = 16;
 	static const int CNTR_STACK_DEPTH   = 4;
@@ -450,6 +515,20 @@ protected:
 	devcb_write_line        m_timer_fired_cb; // callback for timer fired
 	devcb_write32           m_dmovlay_cb;     // callback for DMOVLAY instruction
 
+	// recompiler state
+	std::unique_ptr<drc_cache>          m_drc_cache;            // code cache
+	std::unique_ptr<drcuml_state>       m_drcuml;               // UML generator state
+	std::unique_ptr<adsp21xx_frontend>  m_drcfe;                // front-end state
+	bool                m_drc_cache_dirty;  // true if the cache must be flushed before running
+	bool                m_drc_loops_changed; // true if the front-end found a new loop end
+	uint32_t            m_drc_op;           // opcode handed to the interpreter
+	uint32_t            m_drc_arg;          // argument to or result from a recompiler callback
+	uint32_t            m_drc_idle_pc;      // backward jump that just closed a candidate idle loop
+	uint32_t            m_drc_loop_ends[0x4000 / 32]; // addresses that end a DO loop somewhere
+	uml::code_handle *  m_drc_entry;        // entry point
+	uml::code_handle *  m_drc_nocode;       // nocode exception handler
+	uml::code_handle *  m_drc_out_of_cycles; // out of cycles exception handler
+
 	// debugging
 #if ADSP_TRACK_HOTSPOTS
 	uint32_t              m_pcbucket[0x4000];
@@ -564,6 +643,24 @@ public:
 
 
 
+// ======================> adsp21xx_frontend
+
+class adsp21xx_frontend : public drc_frontend
+{
+public:
+	// construction/destruction
+	adsp21xx_frontend(adsp21xx_device *adsp, uint32_t window_start, uint32_t window_end, uint32_t max_sequence);
+
+protected:
+	// required overrides
+	virtual bool describe(opcode_desc &desc, const opcode_desc *prev) override;
+
+private:
+	adsp21xx_device *m_adsp;
+};
+
+
+
 // device type definition
 DECLARE_DEVICE_TYPE(ADSP2100, adsp2100_device)
 DECLARE_DEVICE_TYPE(ADSP2101, adsp2101_device)
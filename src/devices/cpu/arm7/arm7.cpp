@@ -26,7 +26,7 @@
 
 TODO:
 - Cleanups
-- Fix and finish the DRC code, or remove it entirely
+- Compile the remaining instruction classes in the DRC
 
 *****************************************************************************/
 
@@ -111,6 +111,8 @@ arm7_cpu_device::arm7_cpu_device(const machine_config &mconfig, device_type type
 	m_insn_prefetch_index = 0;
 	m_tlb_log = 0;
 	m_actual_log = 0;
+	m_drc_compiled = 0;
+	m_drc_interpreted = 0;
 }
 
 
@@ -929,6 +931,7 @@ bool arm7_cpu_device::memory_translate(int spacenum, int intention, offs_t &addr
 void arm7_cpu_device::postload()
 {
 	update_reg_ptr();
+	m_impstate.cache_dirty = true;
 }
 
 void arm7_cpu_device::device_start()
@@ -990,6 +993,10 @@ void arm7_cpu_device::device_start()
 
 	set_icountptr(m_icount);
 
+	// the recompiler is opt-in until it has been checked against the interpreter
+	if (allow_unverified_drc())
+		drc_init();
+
 	state_add( ARM7_PC,    "PC", m_pc).callexport().formatstr("%08X");
 	state_add(STATE_GENPC, "GENPC", m_pc).callexport().noshow();
 	state_add(STATE_GENPCBASE, "CURPC", m_pc).callexport().noshow();
@@ -1038,6 +1045,8 @@ void arm7_cpu_device::device_start()
 	state_add( ARM7_UR14,  "UR14", m_r[eR14_UND] ).formatstr("%08X");
 	state_add( ARM7_USPSR, "UR16", m_r[eSPSR_UND]).formatstr("%08X");
 	state_add( ARM7_LOGTLB, "LOGTLB", m_actual_log).formatstr("%01X");
+	state_add( ARM7_DRC_COMPILED, "DRCCOMP", m_drc_compiled).noshow();
+	state_add( ARM7_DRC_INTERPRETED, "DRCINTERP", m_drc_interpreted).noshow();
 
 	state_add(STATE_GENFLAGS, "GENFLAGS", m_r[eCPSR]).formatstr("%13s").noshow();
 
@@ -1243,6 +1252,19 @@ void arm7_cpu_device::execute_run()
 
 	do
 	{
+		/* run compiled code for as long as it can handle the current state */
+		if (m_impstate.drcuml && drc_can_execute())
+		{
+			bool interpret = drc_execute();
+			m_insn_prefetch_count = 0;
+			m_insn_prefetch_index = 0;
+			if (!interpret)
+			{
+				arm7_check_irq_state();
+				continue;
+			}
+		}
+
 		uint32_t pc = GET_PC;
 
 #if PRINT_HAPYFSH2
@@ -1442,6 +1464,7 @@ void arm7_cpu_device::execute_run()
 		m_tlb_log = 0;
 		debugger_instruction_hook(pc);
 		m_tlb_log = m_actual_log;
+		m_drc_interpreted++;
 
 		/* handle Thumb instructions if active */
 		if (T_IS_SET(m_r[eCPSR]))
@@ -1924,6 +1947,10 @@ void arm7_cpu_device::arm7_rt_w_callback(offs_t offset, uint32_t data)
 			LOGMASKED(LOG_COPRO_WRITES, "arm7_rt_w_callback Test / Clock / Idle = %08x (%d) (%d)\n", data, op2, op3);
 			break;
 	}
+
+	/* translations the compiled code was fetched through may have changed */
+	if (cReg == 1 || cReg == 2 || cReg == 3 || cReg == 8 || cReg == 13)
+		m_impstate.cache_dirty = true;
 }
 
 uint32_t arm946es_cpu_device::arm7_rt_r_callback(offs_t offset)
@@ -2264,6 +2291,8 @@ void arm1176jzf_s_cpu_device::arm7_rt_w_callback(offs_t offset, uint32_t data)
 	{
 		LOGMASKED(LOG_COPRO_WRITES, "arm7_rt_w_callback: CP15 CRn %02x Op1 %02x CRm %02x Op2 %02x data %08x\n", crn, op1, crm, op2, data);
 		if(crn == 1 && op1 == 0 && crm == 0 && op2 == 0) m_control = data;
+		if (crn == 1 || crn == 2 || crn == 3 || crn == 8 || crn == 13)
+			m_impstate.cache_dirty = true;
 	}
 }
 
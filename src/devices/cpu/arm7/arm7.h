@@ -30,31 +30,32 @@
 #include "cpu/drcumlsh.h"
 
 
-#define ARM7_MAX_FASTRAM       4
 #define ARM7_MAX_HOTSPOTS      16
 
-/***************************************************************************
-    COMPILER-SPECIFIC OPTIONS
-***************************************************************************/
-
-#define ARM7DRC_STRICT_VERIFY      0x0001          /* verify all instructions */
-#define ARM7DRC_FLUSH_PC           0x0008          /* flush the PC value before each memory access */
-
-#define ARM7DRC_COMPATIBLE_OPTIONS (ARM7DRC_STRICT_VERIFY | ARM7DRC_FLUSH_PC)
-#define ARM7DRC_FASTEST_OPTIONS    (0)
-
 /****************************************************************************************************
  *  PUBLIC FUNCTIONS
  ***************************************************************************************************/
 
+class arm7_frontend;
+
 class arm7_cpu_device : public cpu_device, public arm7_disassembler::config
 {
+	friend class arm7_frontend;
+
 public:
 	// construction/destruction
 	arm7_cpu_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock);
 
 	void set_high_vectors() { m_vectorbase = 0xffff0000; }
 
+	// memory accesses made by the recompiled code
+	void func_read8();
+	void func_read16();
+	void func_read32();
+	void func_write8();
+	void func_write16();
+	void func_write32();
+
 protected:
 	enum
 	{
@@ -399,20 +400,22 @@ protected:
 	// DRC
 	//
 
-	/* fast RAM info */
-	struct fast_ram_info
+	/* state shared with the recompiled code */
+	struct internal_arm7_state
 	{
-		offs_t              start = 0;                  /* start of the RAM block */
-		offs_t              end = 0;                    /* end of the RAM block */
-		bool                readonly = false;           /* true if read-only */
-		void *              base = nullptr;             /* base in memory where the RAM lives */
-	};
-
-	struct hotspot_info
-	{
-		uint32_t             pc = 0;
-		uint32_t             opcode = 0;
-		uint32_t             cycles = 0;
+		uint32_t            r[16];                      /* registers of the current bank */
+		uint32_t            cpsr;                       /* current program status register */
+		int32_t             icount;                     /* cycles left to run */
+		uint32_t            mode;                       /* mode the current code is compiled for */
+		uint32_t            jmpdest;                    /* destination of an indirect branch */
+		uint32_t            arg0;                       /* memory callback address */
+		uint32_t            arg1;                       /* memory callback data */
+		uint32_t            fault;                      /* set when a memory callback aborted */
+		uint32_t            irq_pending;                /* set when a memory callback raised an interrupt */
+		uint32_t            compiled;                   /* compiled instructions executed */
+		uint32_t            tmp[16];                    /* block load staging */
+		uint32_t            add_flags[16];              /* UML flags to CPSR after an addition */
+		uint32_t            sub_flags[16];              /* UML flags to CPSR after a subtraction */
 	};
 
 	/* internal compiler state */
@@ -421,200 +424,102 @@ protected:
 		compiler_state &operator=(compiler_state const &) = delete;
 
 		uint32_t         cycles = 0;                 /* accumulated cycles */
-		uint8_t          checkints = 0;              /* need to check interrupts before next instruction */
-		uint8_t          checksoftints = 0;          /* need to check software interrupts before next instruction */
+		uint32_t         insns = 0;                  /* accumulated instructions */
+		uint8_t          mode = 0;                   /* mode being compiled */
 		uml::code_label  labelnum;                   /* index for local labels */
 	};
 
-	/* ARM7 registers */
+	/* ARM7 recompiler state */
 	struct arm7imp_state
 	{
 		/* core state */
 		std::unique_ptr<drc_cache> cache;               /* pointer to the DRC code cache */
 		std::unique_ptr<drcuml_state> drcuml;           /* DRC UML generator state */
-		//arm7_frontend *     drcfe = nullptr;            /* pointer to the DRC front-end state */
-		uint32_t            drcoptions = 0;             /* configurable DRC options */
+		std::unique_ptr<arm7_frontend> drcfe;           /* pointer to the DRC front-end state */
+		internal_arm7_state *state = nullptr;           /* state shared with the generated code */
 
 		/* internal stuff */
-		uint8_t             cache_dirty = 0;            /* true if we need to flush the cache */
-		uint32_t            jmpdest = 0;                /* destination jump target */
-
-		/* parameters for subroutines */
-		uint64_t            numcycles = 0;              /* return value from gettotalcycles */
-		uint32_t            mode = 0;                   /* current global mode */
-		const char *        format = nullptr;           /* format string for print_debug */
-		uint32_t            arg0 = 0;                   /* print_debug argument 1 */
-		uint32_t            arg1 = 0;                   /* print_debug argument 2 */
-
-		/* register mappings */
-		uml::parameter      regmap[/*NUM_REGS*/37];     /* parameter to register mappings for all 16 integer registers */
+		bool                cache_dirty = false;        /* true if we need to flush the cache */
+		uint32_t            tlb_retry = ~0;             /* PC of the last code TLB mismatch */
 
 		/* subroutines */
 		uml::code_handle *  entry = nullptr;            /* entry point */
 		uml::code_handle *  nocode = nullptr;           /* nocode exception handler */
 		uml::code_handle *  out_of_cycles = nullptr;    /* out of cycles exception handler */
-		uml::code_handle *  tlb_translate = nullptr;    /* tlb translation handler */
-		uml::code_handle *  detect_fault = nullptr;     /* tlb fault detection handler */
-		uml::code_handle *  check_irq = nullptr;        /* irq check handler */
-		uml::code_handle *  read8 = nullptr;            /* read byte */
-		uml::code_handle *  write8 = nullptr;           /* write byte */
-		uml::code_handle *  read16 = nullptr;           /* read half */
-		uml::code_handle *  write16 = nullptr;          /* write half */
-		uml::code_handle *  read32 = nullptr;           /* read word */
-		uml::code_handle *  write32 = nullptr;          /* write word */
-
-		/* fast RAM */
-		uint32_t            fastram_select = 0;
-		fast_ram_info       fastram[ARM7_MAX_FASTRAM];
-
-		/* hotspots */
-		uint32_t            hotspot_select = 0;
-		hotspot_info        hotspot[ARM7_MAX_HOTSPOTS];
+		uml::code_handle *  interpret = nullptr;        /* hand an instruction to the interpreter */
+		uml::code_handle *  tlb_mismatch = nullptr;     /* code fetch abort handler */
 	} m_impstate;
 
-	typedef void ( arm7_cpu_device::*arm7thumb_drcophandler)(drcuml_block &, compiler_state &, const opcode_desc *);
-	static const arm7thumb_drcophandler drcthumb_handler[0x40*0x10];
-
-	void drctg00_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Shift left */
-	void drctg00_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Shift right */
-	void drctg01_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg01_10(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg01_11(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* SUB Rd, Rs, Rn */
-	void drctg01_12(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ADD Rd, Rs, #imm */
-	void drctg01_13(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* SUB Rd, Rs, #imm */
-	void drctg02_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg02_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg03_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ADD Rd, #Offset8 */
-	void drctg03_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* SUB Rd, #Offset8 */
-	void drctg04_00_00(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* AND Rd, Rs */
-	void drctg04_00_01(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* EOR Rd, Rs */
-	void drctg04_00_02(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* LSL Rd, Rs */
-	void drctg04_00_03(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* LSR Rd, Rs */
-	void drctg04_00_04(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ASR Rd, Rs */
-	void drctg04_00_05(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ADC Rd, Rs */
-	void drctg04_00_06(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* SBC Rd, Rs */
-	void drctg04_00_07(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ROR Rd, Rs */
-	void drctg04_00_08(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* TST Rd, Rs */
-	void drctg04_00_09(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* NEG Rd, Rs */
-	void drctg04_00_0a(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* CMP Rd, Rs */
-	void drctg04_00_0b(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* CMN Rd, Rs - check flags, add dasm */
-	void drctg04_00_0c(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ORR Rd, Rs */
-	void drctg04_00_0d(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* MUL Rd, Rs */
-	void drctg04_00_0e(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* BIC Rd, Rs */
-	void drctg04_00_0f(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* MVN Rd, Rs */
-	void drctg04_01_00(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg04_01_01(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ADD Rd, HRs */
-	void drctg04_01_02(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ADD HRd, Rs */
-	void drctg04_01_03(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Add HRd, HRs */
-	void drctg04_01_10(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* CMP Rd, Rs */
-	void drctg04_01_11(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* CMP Rd, Hs */
-	void drctg04_01_12(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* CMP Hd, Rs */
-	void drctg04_01_13(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* CMP Hd, Hs */
-	void drctg04_01_20(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* MOV Rd, Rs (undefined) */
-	void drctg04_01_21(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* MOV Rd, Hs */
-	void drctg04_01_22(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* MOV Hd, Rs */
-	void drctg04_01_23(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* MOV Hd, Hs */
-	void drctg04_01_30(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg04_01_31(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg04_01_32(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg04_01_33(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg04_0203(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg05_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* STR Rd, [Rn, Rm] */
-	void drctg05_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* STRH Rd, [Rn, Rm] */
-	void drctg05_2(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* STRB Rd, [Rn, Rm] */
-	void drctg05_3(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* LDSB Rd, [Rn, Rm] todo, add dasm */
-	void drctg05_4(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* LDR Rd, [Rn, Rm] */
-	void drctg05_5(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* LDRH Rd, [Rn, Rm] */
-	void drctg05_6(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* LDRB Rd, [Rn, Rm] */
-	void drctg05_7(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* LDSH Rd, [Rn, Rm] */
-	void drctg06_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Store */
-	void drctg06_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Load */
-	void drctg07_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Store */
-	void drctg07_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* Load */
-	void drctg08_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Store */
-	void drctg08_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Load */
-	void drctg09_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Store */
-	void drctg09_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Load */
-	void drctg0a_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);  /* ADD Rd, PC, #nn */
-	void drctg0a_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ADD Rd, SP, #nn */
-	void drctg0b_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* ADD SP, #imm */
-	void drctg0b_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_2(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_3(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_4(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* PUSH {Rlist} */
-	void drctg0b_5(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* PUSH {Rlist}{LR} */
-	void drctg0b_6(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_7(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_8(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_9(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_a(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_b(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_c(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* POP {Rlist} */
-	void drctg0b_d(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* POP {Rlist}{PC} */
-	void drctg0b_e(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0b_f(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0c_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Store */
-	void drctg0c_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* Load */
-	void drctg0d_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_EQ:
-	void drctg0d_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_NE:
-	void drctg0d_2(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_CS:
-	void drctg0d_3(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_CC:
-	void drctg0d_4(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_MI:
-	void drctg0d_5(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_PL:
-	void drctg0d_6(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_VS:
-	void drctg0d_7(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_VC:
-	void drctg0d_8(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_HI:
-	void drctg0d_9(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_LS:
-	void drctg0d_a(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_GE:
-	void drctg0d_b(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_LT:
-	void drctg0d_c(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_GT:
-	void drctg0d_d(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_LE:
-	void drctg0d_e(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // COND_AL:
-	void drctg0d_f(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); // SWI (this is sort of a "hole" in the opcode encoding)
-	void drctg0e_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0e_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0f_0(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void drctg0f_1(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc); /* BL */
+	uint64_t m_drc_compiled;        /* instructions executed as compiled code */
+	uint64_t m_drc_interpreted;     /* instructions executed by the interpreter */
 
 	void update_reg_ptr();
 	const int* m_reg_group;
-	void load_fast_iregs(drcuml_block &block);
-	void save_fast_iregs(drcuml_block &block);
-	void arm7_drc_init();
-	void arm7_drc_exit();
-	void execute_run_drc();
-	void arm7drc_set_options(uint32_t options);
-	void arm7drc_add_fastram(offs_t start, offs_t end, uint8_t readonly, void *base);
-	void arm7drc_add_hotspot(offs_t pc, uint32_t opcode, uint32_t cycles);
+	void drc_init();
+	bool drc_can_execute() const;
+	uint8_t code_mode() const;
+	void drc_load_state();
+	void drc_save_state();
+	bool drc_execute();
+	void func_finish_access();
 	void code_flush_cache();
 	void code_compile_block(uint8_t mode, offs_t pc);
-	void cfunc_get_cycles();
-	void cfunc_unimplemented();
 	void static_generate_entry_point();
-	void static_generate_check_irq();
 	void static_generate_nocode_handler();
 	void static_generate_out_of_cycles();
-	void static_generate_detect_fault(uml::code_handle **handleptr);
-	void static_generate_tlb_translate(uml::code_handle **handleptr);
-	void static_generate_memory_accessor(int size, bool istlb, bool iswrite, const char *name, uml::code_handle *&handleptr);
+	void static_generate_interpret();
+	void static_generate_tlb_mismatch();
 	void generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param);
 	void generate_checksum_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *seqhead, const opcode_desc *seqlast);
 	void generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
-	void generate_delay_slot_and_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint8_t linkreg);
-
-	typedef bool ( arm7_cpu_device::*drcarm7ops_ophandler)(drcuml_block &, compiler_state &, const opcode_desc *, uint32_t);
-	static const drcarm7ops_ophandler drcops_handler[0x10];
-
-	void saturate_qbit_overflow(drcuml_block &block);
-	bool drcarm7ops_0123(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
-	bool drcarm7ops_4567(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
-	bool drcarm7ops_89(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
-	bool drcarm7ops_ab(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
-	bool drcarm7ops_cd(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
-	bool drcarm7ops_e(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
-	bool drcarm7ops_f(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
+	void generate_branch(drcuml_block &block, compiler_state &compiler, offs_t targetpc);
+	void generate_exchange(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, bool exchange);
+	void generate_indirect_branch(drcuml_block &block, compiler_state &compiler, bool exchange);
+	void generate_condition(drcuml_block &block, uint32_t cond, uint32_t refund);
+	void generate_shift(drcuml_block &block, uml::parameter src, uint32_t type, uint32_t amount, bool carry);
+	void generate_arith_flags(drcuml_block &block, bool subtract);
+	void generate_logical_flags(drcuml_block &block, bool carry);
+	void generate_read(drcuml_block &block, const opcode_desc *desc, uml::parameter address, int size);
+	void generate_write(drcuml_block &block, const opcode_desc *desc, uml::parameter address, uml::parameter data, int size);
+	void generate_load_store(drcuml_block &block, const opcode_desc *desc, uint32_t type, uml::parameter reg);
+	uml::parameter drc_reg(uint32_t regnum, uint32_t pcvalue);
 	bool generate_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	bool generate_arm(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op);
+	bool generate_arm_bx(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op, bool conditional);
+	bool generate_arm_alu(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op, bool conditional);
+	bool generate_arm_mul(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op, bool conditional);
+	void generate_arm_address(drcuml_block &block, const opcode_desc *desc, uint32_t op, uml::parameter offset);
+	bool generate_arm_single(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op, bool conditional);
+	bool generate_arm_halfword(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op, bool conditional);
+	bool generate_arm_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op, bool conditional);
+	bool generate_arm_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op, bool conditional);
+	bool generate_thumb(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t op);
+	bool generate_thumb_alu(drcuml_block &block, const opcode_desc *desc, uint16_t op);
+	bool generate_thumb_hireg(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t op);
+	bool generate_thumb_stack(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t op);
+	bool generate_thumb_block(drcuml_block &block, const opcode_desc *desc, uint16_t op);
+};
+
+
+class arm7_frontend : public drc_frontend
+{
+public:
+	// construction/destruction
+	arm7_frontend(arm7_cpu_device *arm7, uint32_t window_start, uint32_t window_end, uint32_t max_sequence);
 
+protected:
+	// required overrides
+	virtual bool describe(opcode_desc &desc, const opcode_desc *prev) override;
+
+private:
+	bool describe_arm(opcode_desc &desc, uint32_t op);
+	bool describe_arm_alu(opcode_desc &desc, uint32_t op, bool conditional);
+	bool describe_arm_halfword(opcode_desc &desc, uint32_t op, bool conditional);
+	bool describe_thumb(opcode_desc &desc, uint16_t op);
+	bool describe_branch(opcode_desc &desc, bool conditional, offs_t targetpc);
+	bool describe_interpret(opcode_desc &desc);
+
+	arm7_cpu_device *m_arm7;
 };
 
 
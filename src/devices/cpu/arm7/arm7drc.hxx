@@ -24,6 +24,28 @@
 
        See the notes in the arm7core.c file itself regarding issues/limitations of the arm7 core.
     **
+
+    ** The recompiler covers 32-bit ARM and Thumb code outside the
+       debugger.  Data processing, multiplies, single and block
+       transfers and branches are compiled, including their conditional
+       forms, which evaluate the condition once into a register and
+       commit their results with conditional moves instead of branching
+       around each instruction.  Anything else ends its sequence and is
+       handed back to the interpreter one instruction at a time, as are
+       BX/BLX targets the interpreter would not execute as plain ARM or
+       Thumb code.
+
+       Compiled code is keyed on the Thumb bit, the MMU enable bit and,
+       with the MMU on, user mode, so a switch between ARM and Thumb is
+       just a hash jump into code compiled for the other mode.  Code is
+       fetched through the core's own TLB, and the cache is flushed on
+       any CP15 write that can change a translation.
+
+       Memory is accessed through C callbacks.  An access that aborts
+       abandons the instruction and lets the interpreter re-execute it
+       and take the abort; block loads leave the base register and the
+       PC alone until every word has been read.
+    **
 *****************************************************************************/
 
 
@@ -37,11 +59,12 @@
     CONSTANTS
 ***************************************************************************/
 
-#include "arm7tdrc.hxx"
+#include "arm7fe.hxx"
 
 /* map variables */
 #define MAPVAR_PC                       uml::M0
 #define MAPVAR_CYCLES                   uml::M1
+#define MAPVAR_INSNS                    uml::M2
 
 /* size of the execution code cache */
 #define CACHE_SIZE                      (32 * 1024 * 1024)
@@ -49,7 +72,6 @@
 /* compilation boundaries -- how far back/forward does the analysis extend? */
 #define COMPILE_BACKWARDS_BYTES         128
 #define COMPILE_FORWARDS_BYTES          512
-#define COMPILE_MAX_INSTRUCTIONS        ((COMPILE_BACKWARDS_BYTES/4) + (COMPILE_FORWARDS_BYTES/4))
 #define COMPILE_MAX_SEQUENCE            64
 
 /* exit codes */
@@ -57,22 +79,30 @@
 #define EXECUTE_MISSING_CODE            1
 #define EXECUTE_UNMAPPED_CODE           2
 #define EXECUTE_RESET_CACHE             3
+#define EXECUTE_TLB_MISMATCH            4
+#define EXECUTE_INTERPRET               5
 
 
 /***************************************************************************
-    INLINE FUNCTIONS
+    MACROS
 ***************************************************************************/
 
-/*-------------------------------------------------
-    epc - compute the exception PC from a
-    descriptor
--------------------------------------------------*/
+#define DRC_REG(n)                      uml::mem(&m_impstate.state->r[(n)])
+#define DRC_CPSR                        uml::mem(&m_impstate.state->cpsr)
+#define DRC_ICOUNT                      uml::mem(&m_impstate.state->icount)
+#define DRC_MODE                        uml::mem(&m_impstate.state->mode)
+#define DRC_JMPDEST                     uml::mem(&m_impstate.state->jmpdest)
+#define DRC_ARG0                        uml::mem(&m_impstate.state->arg0)
+#define DRC_ARG1                        uml::mem(&m_impstate.state->arg1)
+#define DRC_FAULT                       uml::mem(&m_impstate.state->fault)
+#define DRC_IRQ_PENDING                 uml::mem(&m_impstate.state->irq_pending)
+#define DRC_COMPILED                    uml::mem(&m_impstate.state->compiled)
+#define DRC_TMP(n)                      uml::mem(&m_impstate.state->tmp[(n)])
 
-static inline uint32_t epc(const opcode_desc *desc)
-{
-	return desc->pc;
-}
 
+/***************************************************************************
+    INLINE FUNCTIONS
+***************************************************************************/
 
 /*-------------------------------------------------
     alloc_handle - allocate a handle if not
@@ -87,32 +117,76 @@ static inline void alloc_handle(drcuml_state &drcuml, uml::code_handle *&handlep
 
 
 /*-------------------------------------------------
-    load_fast_iregs - load any fast integer
-    registers
+    cond_pass_mask - return a mask with one bit
+    for each value of the NZCV nibble, set where
+    the condition passes
 -------------------------------------------------*/
 
-void arm7_cpu_device::load_fast_iregs(drcuml_block &block)
+static inline uint32_t cond_pass_mask(uint32_t cond)
 {
-	int regnum;
-
-	for (regnum = 0; regnum < std::size(m_impstate.regmap); regnum++)
-		if (m_impstate.regmap[regnum].is_int_register())
-			UML_DMOV(block, uml::ireg(m_impstate.regmap[regnum].ireg() - uml::REG_I0), uml::mem(&m_r[regnum]));
+	uint32_t mask = 0;
+	for (int nzcv = 0; nzcv < 16; nzcv++)
+	{
+		const bool n = BIT(nzcv, 3), z = BIT(nzcv, 2), c = BIT(nzcv, 1), v = BIT(nzcv, 0);
+		bool pass;
+		switch (cond)
+		{
+			case COND_EQ:   pass = z;                   break;
+			case COND_NE:   pass = !z;                  break;
+			case COND_CS:   pass = c;                   break;
+			case COND_CC:   pass = !c;                  break;
+			case COND_MI:   pass = n;                   break;
+			case COND_PL:   pass = !n;                  break;
+			case COND_VS:   pass = v;                   break;
+			case COND_VC:   pass = !v;                  break;
+			case COND_HI:   pass = c && !z;             break;
+			case COND_LS:   pass = !c || z;             break;
+			case COND_GE:   pass = n == v;              break;
+			case COND_LT:   pass = n != v;              break;
+			case COND_GT:   pass = !z && (n == v);      break;
+			case COND_LE:   pass = z || (n != v);       break;
+			case COND_NV:   pass = false;               break;
+			default:        pass = true;                break;
+		}
+		if (pass)
+			mask |= 1 << nzcv;
+	}
+	return mask;
 }
 
 
 /*-------------------------------------------------
-    save_fast_iregs - save any fast integer
-    registers
+    cfunc wrappers for the memory callbacks
 -------------------------------------------------*/
 
-void arm7_cpu_device::save_fast_iregs(drcuml_block &block)
+static void cfunc_read8(void *param)
+{
+	((arm7_cpu_device *)param)->func_read8();
+}
+
+static void cfunc_read16(void *param)
+{
+	((arm7_cpu_device *)param)->func_read16();
+}
+
+static void cfunc_read32(void *param)
+{
+	((arm7_cpu_device *)param)->func_read32();
+}
+
+static void cfunc_write8(void *param)
 {
-	int regnum;
+	((arm7_cpu_device *)param)->func_write8();
+}
+
+static void cfunc_write16(void *param)
+{
+	((arm7_cpu_device *)param)->func_write16();
+}
 
-	for (regnum = 0; regnum < std::size(m_impstate.regmap); regnum++)
-		if (m_impstate.regmap[regnum].is_int_register())
-			UML_DMOV(block, uml::mem(&m_r[regnum]), uml::ireg(m_impstate.regmap[regnum].ireg() - uml::REG_I0));
+static void cfunc_write32(void *param)
+{
+	((arm7_cpu_device *)param)->func_write32();
 }
 
 
@@ -122,159 +196,256 @@ void arm7_cpu_device::save_fast_iregs(drcuml_block &block)
 ***************************************************************************/
 
 /*-------------------------------------------------
-    arm7_init - initialize the processor
+    drc_init - allocate the recompiler state
 -------------------------------------------------*/
 
-void arm7_cpu_device::arm7_drc_init()
+void arm7_cpu_device::drc_init()
 {
-	drcbe_info beinfo;
-	uint32_t flags = 0;
-
-	/* allocate enough space for the cache and the core */
-
-	/* allocate the implementation-specific state from the full cache */
-	m_impstate = arm7imp_state();
-	try { m_impstate.cache = std::make_unique<drc_cache>(CACHE_SIZE); }
-	catch (std::bad_alloc const &) { throw emu_fatalerror("Unable to allocate cache of size %d\n", (uint32_t)(CACHE_SIZE)); }
+	/* allocate the cache, with room for the state shared with the generated code */
+	try { m_impstate.cache = std::make_unique<drc_cache>(CACHE_SIZE + sizeof(internal_arm7_state)); }
+	catch (std::bad_alloc const &) { throw emu_fatalerror("Unable to allocate cache of size %d\n", (uint32_t)(CACHE_SIZE + sizeof(internal_arm7_state))); }
+
+	/* allocate the shared state in the near cache and initialize it */
+	m_impstate.state = (internal_arm7_state *)m_impstate.cache->alloc_near(sizeof(internal_arm7_state));
+	memset(m_impstate.state, 0, sizeof(*m_impstate.state));
+	for (int i = 0; i < 16; i++)
+	{
+		/* indexed by the UML S|Z|V|C flags; SUB leaves a borrow where ARM wants a carry */
+		const uint32_t nzv = ((i & 8) ? N_MASK : 0) | ((i & 4) ? Z_MASK : 0) | ((i & 2) ? V_MASK : 0);
+		m_impstate.state->add_flags[i] = nzv | ((i & 1) ? C_MASK : 0);
+		m_impstate.state->sub_flags[i] = nzv | ((i & 1) ? 0 : C_MASK);
+	}
 
-	/* initialize the UML generator */
-	m_impstate.drcuml = std::make_unique<drcuml_state>(*this, *m_impstate.cache, flags, 1, 32, 1);
+	/* initialize the UML generator; Thumb code can start on any halfword */
+	m_impstate.drcuml = std::make_unique<drcuml_state>(*this, *m_impstate.cache, 0, 8, 32, 1);
 
 	/* add symbols for our stuff */
-	m_impstate.drcuml->symbol_add(&m_icount, sizeof(m_icount), "icount");
-	for (int regnum = 0; regnum < 37; regnum++)
+	for (int regnum = 0; regnum < 16; regnum++)
 	{
 		char buf[10];
 		sprintf(buf, "r%d", regnum);
-		m_impstate.drcuml->symbol_add(&m_r[regnum], sizeof(m_r[regnum]), buf);
+		m_impstate.drcuml->symbol_add(&m_impstate.state->r[regnum], sizeof(m_impstate.state->r[regnum]), buf);
 	}
-	m_impstate.drcuml->symbol_add(&m_impstate.mode, sizeof(m_impstate.mode), "mode");
-	m_impstate.drcuml->symbol_add(&m_impstate.arg0, sizeof(m_impstate.arg0), "arg0");
-	m_impstate.drcuml->symbol_add(&m_impstate.arg1, sizeof(m_impstate.arg1), "arg1");
-	m_impstate.drcuml->symbol_add(&m_impstate.numcycles, sizeof(m_impstate.numcycles), "numcycles");
-	//m_impstate.drcuml->symbol_add(&m_impstate.fpmode, sizeof(m_impstate.fpmode), "fpmode"); // TODO
+	m_impstate.drcuml->symbol_add(&m_impstate.state->cpsr, sizeof(m_impstate.state->cpsr), "cpsr");
+	m_impstate.drcuml->symbol_add(&m_impstate.state->icount, sizeof(m_impstate.state->icount), "icount");
+	m_impstate.drcuml->symbol_add(&m_impstate.state->mode, sizeof(m_impstate.state->mode), "mode");
+	m_impstate.drcuml->symbol_add(&m_impstate.state->jmpdest, sizeof(m_impstate.state->jmpdest), "jmpdest");
+	m_impstate.drcuml->symbol_add(&m_impstate.state->arg0, sizeof(m_impstate.state->arg0), "arg0");
+	m_impstate.drcuml->symbol_add(&m_impstate.state->arg1, sizeof(m_impstate.state->arg1), "arg1");
 
 	/* initialize the front-end helper */
-	//m_impstate.drcfe = std::make_unique<arm7_frontend>(this, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, SINGLE_INSTRUCTION_MODE ? 1 : COMPILE_MAX_SEQUENCE);
+	m_impstate.drcfe = std::make_unique<arm7_frontend>(this, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, SINGLE_INSTRUCTION_MODE ? 1 : COMPILE_MAX_SEQUENCE);
+
+	/* mark the cache dirty so it is updated on next execute */
+	m_impstate.cache_dirty = true;
+	m_impstate.tlb_retry = ~0;
+}
 
-	/* allocate memory for cache-local state and initialize it */
-	//memcpy(&m_impstate.fpmode, fpmode_source, sizeof(fpmode_source)); // TODO
 
-	/* compute the register parameters */
-	for (int regnum = 0; regnum < 37; regnum++)
-	{
-		m_impstate.regmap[regnum] = (regnum == 0) ? uml::parameter(0) : uml::parameter::make_memory(&m_r[regnum]);
-	}
+/*-------------------------------------------------
+    drc_can_execute - return true if the current
+    state is one the compiled code handles
+-------------------------------------------------*/
+
+bool arm7_cpu_device::drc_can_execute() const
+{
+	if (machine().debug_flags & DEBUG_FLAG_ENABLED)
+		return false;
+	if (!MODE32)
+		return false;
+
+	/* pending exceptions are taken by the interpreter */
+	if (m_pendingAbtD || m_pendingAbtP || m_pendingUnd || m_pendingSwi)
+		return false;
+	if ((m_pendingFiq && !(GET_CPSR & F_MASK)) || (m_pendingIrq && !(GET_CPSR & I_MASK)))
+		return false;
+
+	/* the hash ignores bit 0 of the PC, so only enter at an aligned instruction */
+	return (R15 & (T_IS_SET(GET_CPSR) ? 1 : 3)) == 0;
+}
+
+
+/*-------------------------------------------------
+    code_mode - return the mode the compiled code
+    is keyed on
+-------------------------------------------------*/
 
-	/* if we have registers to spare, assign r2, r3, r4 to leftovers */
-	//if (!DISABLE_FAST_REGISTERS) // TODO
+uint8_t arm7_cpu_device::code_mode() const
+{
+	uint8_t mode = T_IS_SET(GET_CPSR) ? ARM7_DRC_MODE_THUMB : 0;
+	if (m_control & COPRO_CTRL_MMU_EN)
 	{
-		m_impstate.drcuml->get_backend_info(beinfo);
-		if (beinfo.direct_iregs > 4)
-		{   // PC
-			m_impstate.regmap[eR15] = uml::I4;
-		}
-		if (beinfo.direct_iregs > 5)
-		{   // Status
-			m_impstate.regmap[eCPSR] = uml::I5;
-		}
-		if (beinfo.direct_iregs > 6)
-		{   // SP
-			m_impstate.regmap[eR13] = uml::I6;
-		}
+		/* page permissions depend on the privilege level */
+		mode |= ARM7_DRC_MODE_MMU;
+		if (GET_MODE == eARM7_MODE_USER)
+			mode |= ARM7_DRC_MODE_USER;
 	}
+	return mode;
+}
 
-	/* mark the cache dirty so it is updated on next execute */
-	m_impstate.cache_dirty = true;
+
+/*-------------------------------------------------
+    drc_load_state - copy the interpreter state
+    into the recompiler state
+-------------------------------------------------*/
+
+void arm7_cpu_device::drc_load_state()
+{
+	internal_arm7_state &state = *m_impstate.state;
+
+	for (int regnum = 0; regnum < 16; regnum++)
+		state.r[regnum] = GetRegister(regnum);
+	state.cpsr = GET_CPSR;
+	state.icount = m_icount;
+	state.mode = code_mode();
+	state.fault = 0;
+	state.irq_pending = 0;
+	state.compiled = 0;
 }
 
 
 /*-------------------------------------------------
-    arm7_execute - execute the CPU for the
-    specified number of cycles
+    drc_save_state - copy the recompiler state
+    back to the interpreter
 -------------------------------------------------*/
 
-void arm7_cpu_device::execute_run_drc()
+void arm7_cpu_device::drc_save_state()
 {
-	drcuml_state &drcuml = *m_impstate.drcuml;
-	int execute_result;
+	const internal_arm7_state &state = *m_impstate.state;
+
+	/* the compiled code never changes the register bank */
+	for (int regnum = 0; regnum < 16; regnum++)
+		SetRegister(regnum, state.r[regnum]);
+	set_cpsr(state.cpsr);
+	m_icount = state.icount;
+	m_drc_compiled += state.compiled;
+}
+
+
+/*-------------------------------------------------
+    drc_execute - run compiled code until the
+    cycles run out; returns true if the current
+    instruction must be interpreted
+-------------------------------------------------*/
+
+bool arm7_cpu_device::drc_execute()
+{
+	internal_arm7_state &state = *m_impstate.state;
 
 	/* reset the cache if dirty */
 	if (m_impstate.cache_dirty)
 		code_flush_cache();
 	m_impstate.cache_dirty = false;
 
+	drc_load_state();
+
 	/* execute */
+	bool interpret = false;
+	int execute_result;
 	do
 	{
-		/* run as much as we can */
-		execute_result = drcuml.execute(*m_impstate.entry);
+		execute_result = m_impstate.drcuml->execute(*m_impstate.entry);
 
 		/* if we need to recompile, do it */
 		if (execute_result == EXECUTE_MISSING_CODE)
-			code_compile_block(m_impstate.mode, m_r[eR15]);
+			code_compile_block(state.mode, state.r[eR15]);
 		else if (execute_result == EXECUTE_UNMAPPED_CODE)
-			fatalerror("Attempted to execute unmapped code at PC=%08X\n", m_r[eR15]);
+			fatalerror("Attempted to execute unmapped code at PC=%08X\n", state.r[eR15]);
 		else if (execute_result == EXECUTE_RESET_CACHE)
 			code_flush_cache();
+		else if (execute_result == EXECUTE_TLB_MISMATCH)
+		{
+			/* a prefetch abort has to be taken by the interpreter */
+			offs_t address = state.r[eR15];
+			if (!translate_vaddr_to_paddr(address, ARM7_TLB_ABORT_P | ARM7_TLB_READ))
+				interpret = true;
+
+			/* a second mismatch at the same address means the mapping changed */
+			else if (m_impstate.tlb_retry == state.r[eR15])
+				code_compile_block(state.mode, state.r[eR15]);
+			m_impstate.tlb_retry = state.r[eR15];
+			continue;
+		}
+		else if (execute_result == EXECUTE_INTERPRET)
+			interpret = true;
+		m_impstate.tlb_retry = ~0;
+	}
+	while (execute_result != EXECUTE_OUT_OF_CYCLES && !interpret);
 
-	} while (execute_result != EXECUTE_OUT_OF_CYCLES);
+	drc_save_state();
+	return interpret;
 }
 
+
 /*-------------------------------------------------
-    arm7_exit - cleanup from execution
+    func_read8/16/32, func_write8/16/32 - memory
+    accesses made on behalf of the compiled code;
+    a data abort sets the fault flag instead of
+    being raised
 -------------------------------------------------*/
 
-void arm7_cpu_device::arm7_drc_exit()
+void arm7_cpu_device::func_read8()
 {
-	/* clean up the DRC */
-	//m_impstate.drcfe.reset();
-	m_impstate.drcuml.reset();
-	m_impstate.cache.reset();
+	m_icount = m_impstate.state->icount;
+	m_impstate.state->arg1 = READ8(m_impstate.state->arg0);
+	func_finish_access();
 }
 
+void arm7_cpu_device::func_read16()
+{
+	m_icount = m_impstate.state->icount;
+	m_impstate.state->arg1 = READ16(m_impstate.state->arg0);
+	func_finish_access();
+}
 
-/*-------------------------------------------------
-    arm7drc_set_options - configure DRC options
--------------------------------------------------*/
-
-void arm7_cpu_device::arm7drc_set_options(uint32_t options)
+void arm7_cpu_device::func_read32()
 {
-	m_impstate.drcoptions = options;
+	m_icount = m_impstate.state->icount;
+	m_impstate.state->arg1 = READ32(m_impstate.state->arg0);
+	func_finish_access();
 }
 
+void arm7_cpu_device::func_write8()
+{
+	m_icount = m_impstate.state->icount;
+	WRITE8(m_impstate.state->arg0, uint8_t(m_impstate.state->arg1));
+	func_finish_access();
+}
 
-/*-------------------------------------------------
-    arm7drc_add_fastram - add a new fastram
-    region
--------------------------------------------------*/
+void arm7_cpu_device::func_write16()
+{
+	m_icount = m_impstate.state->icount;
+	WRITE16(m_impstate.state->arg0, uint16_t(m_impstate.state->arg1));
+	func_finish_access();
+}
 
-void arm7_cpu_device::arm7drc_add_fastram(offs_t start, offs_t end, uint8_t readonly, void *base)
+void arm7_cpu_device::func_write32()
 {
-	if (m_impstate.fastram_select < std::size(m_impstate.fastram))
-	{
-		m_impstate.fastram[m_impstate.fastram_select].start = start;
-		m_impstate.fastram[m_impstate.fastram_select].end = end;
-		m_impstate.fastram[m_impstate.fastram_select].readonly = readonly;
-		m_impstate.fastram[m_impstate.fastram_select].base = base;
-		m_impstate.fastram_select++;
-	}
+	m_icount = m_impstate.state->icount;
+	WRITE32(m_impstate.state->arg0, m_impstate.state->arg1);
+	func_finish_access();
 }
 
 
 /*-------------------------------------------------
-    arm7drc_add_hotspot - add a new hotspot
+    func_finish_access - hand a data abort back
+    to the compiled code, and note an interrupt
+    the access raised
 -------------------------------------------------*/
 
-void arm7_cpu_device::arm7drc_add_hotspot(offs_t pc, uint32_t opcode, uint32_t cycles)
+void arm7_cpu_device::func_finish_access()
 {
-	if (m_impstate.hotspot_select < std::size(m_impstate.hotspot))
+	internal_arm7_state &state = *m_impstate.state;
+
+	/* the interpreter re-executes the instruction and raises the abort itself */
+	if (m_pendingAbtD)
 	{
-		m_impstate.hotspot[m_impstate.hotspot_select].pc = pc;
-		m_impstate.hotspot[m_impstate.hotspot_select].opcode = opcode;
-		m_impstate.hotspot[m_impstate.hotspot_select].cycles = cycles;
-		m_impstate.hotspot_select++;
+		m_pendingAbtD = false;
+		update_irq_state();
+		state.fault = 1;
 	}
+	state.irq_pending = ((m_pendingIrq && !(state.cpsr & I_MASK)) || (m_pendingFiq && !(state.cpsr & F_MASK))) ? 1 : 0;
+	state.icount = m_icount;
 }
 
 
@@ -299,17 +470,8 @@ void arm7_cpu_device::code_flush_cache()
 		static_generate_entry_point();
 		static_generate_nocode_handler();
 		static_generate_out_of_cycles();
-		static_generate_tlb_translate(nullptr); // TODO FIXME
-		static_generate_detect_fault(nullptr); // TODO FIXME
-		//static_generate_tlb_mismatch();
-
-		/* add subroutines for memory accesses */
-		static_generate_memory_accessor(1, false, false, "read8",       m_impstate.read8);
-		static_generate_memory_accessor(1, true,  false, "write8",      m_impstate.write8);
-		static_generate_memory_accessor(2, false, false, "read16",      m_impstate.read16);
-		static_generate_memory_accessor(2, true,  false, "write16",     m_impstate.write16);
-		static_generate_memory_accessor(4, false, false, "read32",      m_impstate.read32);
-		static_generate_memory_accessor(4, true,  false, "write32",     m_impstate.write32);
+		static_generate_interpret();
+		static_generate_tlb_mismatch();
 	}
 	catch (drcuml_block::abort_compilation &)
 	{
@@ -327,16 +489,14 @@ void arm7_cpu_device::code_compile_block(uint8_t mode, offs_t pc)
 {
 	drcuml_state &drcuml = *m_impstate.drcuml;
 	compiler_state compiler = { 0 };
-	const opcode_desc *seqlast;
+	const opcode_desc *seqhead, *seqlast;
+	const opcode_desc *desclist;
 	bool override = false;
 
 	auto profile = g_profiler.start(PROFILER_DRC_COMPILE);
 
 	/* get a description of this sequence */
-	// TODO FIXME
-	const opcode_desc *desclist = nullptr; //m_impstate.drcfe->describe_code(pc); // TODO
-//  if (drcuml.logging() || drcuml.logging_native())
-//      log_opcode_desc(drcuml, desclist, 0);
+	desclist = m_impstate.drcfe->describe_code(pc);
 
 	/* if we get an error back, flush the cache and try again */
 	bool succeeded = false;
@@ -347,15 +507,19 @@ void arm7_cpu_device::code_compile_block(uint8_t mode, offs_t pc)
 			/* start the block */
 			drcuml_block &block(drcuml.begin_block(4096));
 
+			/* local labels never collide with anything else in the block */
+			compiler.mode = mode;
+			compiler.labelnum = 1;
+
 			/* loop until we get through all instruction sequences */
-			for (const opcode_desc *seqhead = desclist; seqhead != nullptr; seqhead = seqlast->next())
+			for (seqhead = desclist; seqhead != nullptr; seqhead = seqlast->next())
 			{
 				const opcode_desc *curdesc;
 				uint32_t nextpc;
 
 				/* add a code log entry */
 				if (drcuml.logging())
-					block.append_comment("-------------------------");                     // comment
+					block.append_comment("-------------------------");                 // comment
 
 				/* determine the last instruction in this sequence */
 				for (seqlast = seqhead; seqlast != nullptr; seqlast = seqlast->next())
@@ -365,55 +529,36 @@ void arm7_cpu_device::code_compile_block(uint8_t mode, offs_t pc)
 
 				/* if we don't have a hash for this mode/pc, or if we are overriding all, add one */
 				if (override || !drcuml.hash_exists(mode, seqhead->pc))
-					UML_HASH(block, mode, seqhead->pc);                                     // hash    mode,pc
+					UML_HASH(block, mode, seqhead->pc);                                 // hash    mode,pc
 
 				/* if we already have a hash, and this is the first sequence, assume that we */
 				/* are recompiling due to being out of sync and allow future overrides */
 				else if (seqhead == desclist)
 				{
 					override = true;
-					UML_HASH(block, mode, seqhead->pc);                                     // hash    mode,pc
+					UML_HASH(block, mode, seqhead->pc);                                 // hash    mode,pc
 				}
 
 				/* otherwise, redispatch to that fixed PC and skip the rest of the processing */
 				else
 				{
-					UML_LABEL(block, seqhead->pc | 0x80000000);                             // label   seqhead->pc | 0x80000000
-					UML_HASHJMP(block, 0, seqhead->pc, *m_impstate.nocode);
-																							// hashjmp <mode>,seqhead->pc,nocode
+					UML_HASHJMP(block, mode, seqhead->pc, *m_impstate.nocode);          // hashjmp <mode>,seqhead->pc,nocode
 					continue;
 				}
 
 				/* validate this code block if we're not pointing into ROM */
-				if (m_program->get_write_ptr(seqhead->physpc) != nullptr)
+				if (!(seqhead->flags & OPFLAG_COMPILER_PAGE_FAULT) && m_program->get_write_ptr(seqhead->physpc) != nullptr)
 					generate_checksum_block(block, compiler, seqhead, seqlast);
 
-				/* label this instruction, if it may be jumped to locally */
-				if (seqhead->flags & OPFLAG_IS_BRANCH_TARGET)
-					UML_LABEL(block, seqhead->pc | 0x80000000);                             // label   seqhead->pc | 0x80000000
-
 				/* iterate over instructions in the sequence and compile them */
 				for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
 					generate_sequence_instruction(block, compiler, curdesc);
 
-				/* if we need to return to the start, do it */
-				if (seqlast->flags & OPFLAG_RETURN_TO_START)
-					nextpc = pc;
-
-				/* otherwise we just go to the next instruction */
-				else
-					nextpc = seqlast->pc + (seqlast->skipslots + 1) * 4;
-
-				/* count off cycles and go there */
-				generate_update_cycles(block, compiler, nextpc);          // <subtract cycles>
-
-				/* if the last instruction can change modes, use a variable mode; otherwise, assume the same mode */
-				/*if (seqlast->flags & OPFLAG_CAN_CHANGE_MODES)
-				    UML_HASHJMP(block, uml::mem(&m_impstate.mode), nextpc, *m_impstate.nocode);
-				                                                                            // hashjmp <mode>,nextpc,nocode
-				else*/ if (seqlast->next() == nullptr || seqlast->next()->pc != nextpc)
-					UML_HASHJMP(block, m_impstate.mode, nextpc, *m_impstate.nocode);
-																							// hashjmp <mode>,nextpc,nocode
+				/* count off cycles and go to the next instruction */
+				nextpc = seqlast->pc + seqlast->length;
+				generate_update_cycles(block, compiler, nextpc);                        // <subtract cycles>
+				if (seqlast->next() == nullptr || seqlast->next()->pc != nextpc)
+					UML_HASHJMP(block, mode, nextpc, *m_impstate.nocode);               // hashjmp <mode>,nextpc,nocode
 			}
 
 			/* end the sequence */
@@ -428,32 +573,6 @@ void arm7_cpu_device::code_compile_block(uint8_t mode, offs_t pc)
 }
 
 
-/***************************************************************************
-    C FUNCTION CALLBACKS
-***************************************************************************/
-
-/*-------------------------------------------------
-    cfunc_get_cycles - compute the total number
-    of cycles executed so far
--------------------------------------------------*/
-
-void arm7_cpu_device::cfunc_get_cycles()
-{
-	m_impstate.numcycles = total_cycles();
-}
-
-
-/*-------------------------------------------------
-    cfunc_unimplemented - handler for
-    unimplemented opcdes
--------------------------------------------------*/
-
-void arm7_cpu_device::cfunc_unimplemented()
-{
-	uint32_t opcode = m_impstate.arg0;
-	fatalerror("PC=%08X: Unimplemented op %08X\n", m_r[eR15], opcode);
-}
-
 
 /***************************************************************************
     STATIC CODEGEN
@@ -468,196 +587,22 @@ void arm7_cpu_device::static_generate_entry_point()
 {
 	drcuml_state &drcuml = *m_impstate.drcuml;
 
-	drcuml_block &block(drcuml.begin_block(110));
+	/* begin generating */
+	drcuml_block &block(drcuml.begin_block(20));
 
 	/* forward references */
-	//alloc_handle(drcuml, &m_impstate.exception_norecover[EXCEPTION_INTERRUPT], "interrupt_norecover");
 	alloc_handle(drcuml, m_impstate.nocode, "nocode");
-	alloc_handle(drcuml, m_impstate.detect_fault, "detect_fault");
-	alloc_handle(drcuml, m_impstate.tlb_translate, "tlb_translate");
 
 	alloc_handle(drcuml, m_impstate.entry, "entry");
-	UML_HANDLE(block, *m_impstate.entry);                           // handle  entry
-
-	/* load fast integer registers */
-	load_fast_iregs(block);
-
-	UML_CALLH(block, *m_impstate.check_irq);
+	UML_HANDLE(block, *m_impstate.entry);                                               // handle  entry
 
 	/* generate a hash jump via the current mode and PC */
-	UML_HASHJMP(block, 0, uml::mem(&m_pc), *m_impstate.nocode);       // hashjmp 0,<pc>,nocode
-	block.end();
-}
-
-
-/*-------------------------------------------------
-    static_generate_check_irq - generate a handler
-    to check IRQs
--------------------------------------------------*/
-
-void arm7_cpu_device::static_generate_check_irq()
-{
-	drcuml_state &drcuml = *m_impstate.drcuml;
-	uml::code_label noirq;
-	int nodabt = 0;
-	int nopabt = 0;
-	int irqadjust = 0;
-	int nofiq = 0;
-	int irq32 = 0;
-	int swi32 = 0;
-	int done = 0;
-	int label = 1;
-
-	/* begin generating */
-	drcuml_block &block(drcuml.begin_block(120));
-
-	/* generate a hash jump via the current mode and PC */
-	alloc_handle(drcuml, m_impstate.check_irq, "check_irq");
-	UML_HANDLE(block, *m_impstate.check_irq);                       // handle  check_irq
-	/* Exception priorities:
-
-	    Reset
-	    Data abort
-	    FIRQ
-	    IRQ
-	    Prefetch abort
-	    Undefined instruction
-	    Software Interrupt
-	*/
-
-	UML_ADD(block, uml::I0, uml::mem(&R15), 4);                                   // add      i0, PC, 4  ;insn pc
-
-	// Data Abort
-	UML_TEST(block, uml::mem(&m_pendingAbtD), 1);                          // test     pendingAbtD, 1
-	UML_JMPc(block, uml::COND_Z, nodabt = label++);                          // jmpz     nodabt
-
-	UML_ROLINS(block, uml::mem(&GET_CPSR), eARM7_MODE_ABT, 0, MODE_FLAG);     // rolins   CPSR, eARM7_MODE_ABT, 0, MODE_FLAG
-	UML_MOV(block, uml::mem(&GetRegister(14)), uml::I0);                    // mov      LR, i0
-	UML_MOV(block, uml::mem(&GetRegister(SPSR)), uml::mem(&GET_CPSR));      // mov      SPSR, CPSR
-	UML_OR(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), I_MASK);              // or       CPSR, CPSR, I_MASK
-	UML_ROLAND(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), 0, ~T_MASK);      // roland   CPSR, CPSR, 0, ~T_MASK
-	UML_MOV(block, uml::mem(&R15), 0x00000010);                              // mov      PC, 0x10 (Data Abort vector address)
-	UML_MOV(block, uml::mem(&m_pendingAbtD), 0);                           // mov      pendingAbtD, 0
-	UML_JMP(block, irqadjust = label++);                                // jmp      irqadjust
-
-	UML_LABEL(block, nodabt);                                           // nodabt:
-
-	// FIQ
-	UML_TEST(block, uml::mem(&m_pendingFiq), 1);                           // test     pendingFiq, 1
-	UML_JMPc(block, uml::COND_Z, nofiq = label++);                           // jmpz     nofiq
-	UML_TEST(block, uml::mem(&GET_CPSR), F_MASK);                            // test     CPSR, F_MASK
-	UML_JMPc(block, uml::COND_Z, nofiq);                                     // jmpz     nofiq
-
-	UML_MOV(block, uml::mem(&GetRegister(14)), uml::I0);                    // mov      LR, i0
-	UML_MOV(block, uml::mem(&GetRegister(SPSR)), uml::mem(&GET_CPSR));      // mov      SPSR, CPSR
-	UML_OR(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), I_MASK | F_MASK);     // or       CPSR, CPSR, I_MASK | F_MASK
-	UML_ROLAND(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), 0, ~T_MASK);          // roland   CPSR, CPSR, 0, ~T_MASK
-	UML_MOV(block, uml::mem(&R15), 0x0000001c);                              // mov      PC, 0x1c (FIQ vector address)
-	UML_MOV(block, uml::mem(&m_pendingFiq), 0);                            // mov      pendingFiq, 0
-	UML_JMP(block, irqadjust);                                          // jmp      irqadjust
-
-	UML_LABEL(block, nofiq);                                            // nofiq:
-
-	// IRQ
-	UML_TEST(block, uml::mem(&m_pendingIrq), 1);                           // test     pendingIrq, 1
-	UML_JMPc(block, uml::COND_Z, noirq = label++);                           // jmpz     noirq
-	UML_TEST(block, uml::mem(&GET_CPSR), I_MASK);                            // test     CPSR, I_MASK
-	UML_JMPc(block, uml::COND_Z, noirq);                                     // jmpz     noirq
-
-	UML_MOV(block, uml::mem(&GetRegister(14)), uml::I0);                    // mov      LR, i0
-	UML_TEST(block, uml::mem(&GET_CPSR), SR_MODE32);                         // test     CPSR, MODE32
-	UML_JMPc(block, uml::COND_NZ, irq32 = label++);                          // jmpnz    irq32
-	UML_AND(block, uml::I1, uml::I0, 0xf4000000);                                 // and      i1, i0, 0xf4000000
-	UML_OR(block, uml::mem(&R15), uml::I1, 0x0800001a);                           // or       PC, i1, 0x0800001a
-	UML_AND(block, uml::I1, uml::mem(&GET_CPSR), 0x0fffff3f);                     // and      i1, CPSR, 0x0fffff3f
-	UML_ROLAND(block, uml::I0, uml::mem(&R15), 32-20, 0x0000000c);                // roland   i0, R15, 32-20, 0x0000000c
-	UML_ROLINS(block, uml::I0, uml::mem(&R15), 0, 0xf0000000);                    // rolins   i0, R15, 0, 0xf0000000
-	UML_OR(block, uml::mem(&GET_CPSR), uml::I0, uml::I1);                              // or       CPSR, i0, i1
-	UML_JMP(block, irqadjust);                                          // jmp      irqadjust
-
-	UML_LABEL(block, irq32);                                            // irq32:
-	UML_MOV(block, uml::mem(&GetRegister(SPSR)), uml::mem(&GET_CPSR));      // mov      SPSR, CPSR
-	UML_OR(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), I_MASK);              // or       CPSR, CPSR, I_MASK
-	UML_ROLAND(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), 0, ~T_MASK);          // roland   CPSR, CPSR, 0, ~T_MASK
-	UML_MOV(block, uml::mem(&R15), 0x00000018);                              // mov      PC, 0x18 (IRQ vector address)
-
-	UML_JMP(block, irqadjust);                                          // jmp      irqadjust
-
-	UML_LABEL(block, noirq);                                            // noirq:
-
-	// Prefetch Abort
-	UML_TEST(block, uml::mem(&m_pendingAbtP), 1);                          // test     pendingAbtP, 1
-	UML_JMPc(block, uml::COND_Z, nopabt = label++);                          // jmpz     nopabt
-
-	UML_ROLINS(block, uml::mem(&GET_CPSR), eARM7_MODE_ABT, 0, MODE_FLAG);     // rolins   CPSR, eARM7_MODE_ABT, 0, MODE_FLAG
-	UML_MOV(block, uml::mem(&GetRegister(14)), uml::I0);                    // mov      LR, i0
-	UML_MOV(block, uml::mem(&GetRegister(SPSR)), uml::mem(&GET_CPSR));      // mov      SPSR, CPSR
-	UML_OR(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), I_MASK);              // or       CPSR, CPSR, I_MASK
-	UML_ROLAND(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), 0, ~T_MASK);          // roland   CPSR, CPSR, 0, ~T_MASK
-	UML_MOV(block, uml::mem(&R15), 0x0000000c);                              // mov      PC, 0x0c (Prefetch Abort vector address)
-	UML_MOV(block, uml::mem(&m_pendingAbtP), 0);                           // mov      pendingAbtP, 0
-	UML_JMP(block, irqadjust);                                          // jmp      irqadjust
-
-	UML_LABEL(block, nopabt);                                           // nopabt:
-
-	// Undefined instruction
-	UML_TEST(block, uml::mem(&m_pendingUnd), 1);                           // test     pendingUnd, 1
-	UML_JMPc(block, uml::COND_Z, nopabt = label++);                          // jmpz     nound
-
-	UML_ROLINS(block, uml::mem(&GET_CPSR), eARM7_MODE_UND, 0, MODE_FLAG);     // rolins   CPSR, eARM7_MODE_UND, 0, MODE_FLAG
-	UML_MOV(block, uml::I1, (uint64_t)-4);                                             // mov      i1, -4
-	UML_TEST(block, uml::mem(&GET_CPSR), T_MASK);                            // test     CPSR, T_MASK
-	UML_MOVc(block, uml::COND_NZ, uml::I1, (uint64_t)-2);                                   // movnz    i1, -2
-	UML_ADD(block, uml::mem(&GetRegister(14)), uml::I0, uml::I1);                // add      LR, i0, i1
-	UML_MOV(block, uml::mem(&GetRegister(SPSR)), uml::mem(&GET_CPSR));      // mov      SPSR, CPSR
-	UML_OR(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), I_MASK);              // or       CPSR, CPSR, I_MASK
-	UML_ROLAND(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), 0, ~T_MASK);          // roland   CPSR, CPSR, 0, ~T_MASK
-	UML_MOV(block, uml::mem(&R15), 0x00000004);                              // mov      PC, 0x0c (Undefined Insn vector address)
-	UML_MOV(block, uml::mem(&m_pendingUnd), 0);                            // mov      pendingUnd, 0
-	UML_JMP(block, irqadjust);                                          // jmp      irqadjust
-
-	UML_LABEL(block, nopabt);                                           // nopabt:
-
-	// Software Interrupt
-	UML_TEST(block, uml::mem(&m_pendingSwi), 1);                           // test     pendingSwi, 1
-	UML_JMPc(block, uml::COND_Z, done = label++);                            // jmpz     done
-
-	UML_ROLINS(block, uml::mem(&GET_CPSR), eARM7_MODE_SVC, 0, MODE_FLAG);     // rolins   CPSR, eARM7_MODE_SVC, 0, MODE_FLAG
-	UML_MOV(block, uml::I1, (uint64_t)-4);                                             // mov      i1, -4
-	UML_TEST(block, uml::mem(&GET_CPSR), T_MASK);                            // test     CPSR, T_MASK
-	UML_MOVc(block, uml::COND_NZ, uml::I1, (uint64_t)-2);                                   // movnz    i1, -2
-	UML_ADD(block, uml::mem(&GetRegister(14)), uml::I0, uml::I1);                // add      LR, i0, i1
-
-	UML_TEST(block, uml::mem(&GET_CPSR), SR_MODE32);                         // test     CPSR, MODE32
-	UML_JMPc(block, uml::COND_NZ, swi32 = label++);                          // jmpnz    swi32
-	UML_AND(block, uml::I1, uml::I0, 0xf4000000);                                 // and      i1, i0, 0xf4000000
-	UML_OR(block, uml::mem(&R15), uml::I1, 0x0800001b);                           // or       PC, i1, 0x0800001b
-	UML_AND(block, uml::I1, uml::mem(&GET_CPSR), 0x0fffff3f);                     // and      i1, CPSR, 0x0fffff3f
-	UML_ROLAND(block, uml::I0, uml::mem(&R15), 32-20, 0x0000000c);                // roland   i0, R15, 32-20, 0x0000000c
-	UML_ROLINS(block, uml::I0, uml::mem(&R15), 0, 0xf0000000);                    // rolins   i0, R15, 0, 0xf0000000
-	UML_OR(block, uml::mem(&GET_CPSR), uml::I0, uml::I1);                              // or       CPSR, i0, i1
-	UML_MOV(block, uml::mem(&m_pendingSwi), 0);                            // mov      pendingSwi, 0
-	UML_JMP(block, irqadjust);                                          // jmp      irqadjust
-
-	UML_LABEL(block, swi32);                                            // irq32:
-	UML_MOV(block, uml::mem(&GetRegister(SPSR)), uml::mem(&GET_CPSR));      // mov      SPSR, CPSR
-	UML_OR(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), I_MASK);              // or       CPSR, CPSR, I_MASK
-	UML_ROLAND(block, uml::mem(&GET_CPSR), uml::mem(&GET_CPSR), 0, ~T_MASK);          // roland   CPSR, CPSR, 0, ~T_MASK
-	UML_MOV(block, uml::mem(&R15), 0x00000008);                              // mov      PC, 0x08 (SWI vector address)
-	UML_MOV(block, uml::mem(&m_pendingSwi), 0);                            // mov      pendingSwi, 0
-	UML_JMP(block, irqadjust);                                          // jmp      irqadjust
-
-	UML_LABEL(block, irqadjust);                                        // irqadjust:
-	UML_MOV(block, uml::I1, 0);                                              // mov      i1, 0
-	UML_TEST(block, uml::mem(&COPRO_CTRL), COPRO_CTRL_MMU_EN | COPRO_CTRL_INTVEC_ADJUST);    // test COPRO_CTRL, MMU_EN | INTVEC_ADJUST
-	UML_MOVc(block, uml::COND_NZ, uml::I1, 0xffff0000);                           // movnz    i1, 0xffff0000
-	UML_OR(block, uml::mem(&R15), uml::mem(&R15), uml::I1);                             // or       PC, i1
-
-	UML_LABEL(block, done);                                             // done:
+	UML_HASHJMP(block, DRC_MODE, DRC_REG(eR15), *m_impstate.nocode);                    // hashjmp [mode],[r15],nocode
 
 	block.end();
 }
 
+
 /*-------------------------------------------------
     static_generate_nocode_handler - generate an
     exception handler for "out of code"
@@ -672,11 +617,10 @@ void arm7_cpu_device::static_generate_nocode_handler()
 
 	/* generate a hash jump via the current mode and PC */
 	alloc_handle(drcuml, m_impstate.nocode, "nocode");
-	UML_HANDLE(block, *m_impstate.nocode);                                  // handle  nocode
-	UML_GETEXP(block, uml::I0);                                                      // getexp  i0
-	UML_MOV(block, uml::mem(&R15), uml::I0);                                              // mov     [pc],i0
-	save_fast_iregs(block);
-	UML_EXIT(block, EXECUTE_MISSING_CODE);                                      // exit    EXECUTE_MISSING_CODE
+	UML_HANDLE(block, *m_impstate.nocode);                                              // handle  nocode
+	UML_GETEXP(block, uml::I0);                                                         // getexp  i0
+	UML_MOV(block, DRC_REG(eR15), uml::I0);                                             // mov     [r15],i0
+	UML_EXIT(block, EXECUTE_MISSING_CODE);                                              // exit    EXECUTE_MISSING_CODE
 
 	block.end();
 }
@@ -696,442 +640,70 @@ void arm7_cpu_device::static_generate_out_of_cycles()
 
 	/* generate a hash jump via the current mode and PC */
 	alloc_handle(drcuml, m_impstate.out_of_cycles, "out_of_cycles");
-	UML_HANDLE(block, *m_impstate.out_of_cycles);                       // handle  out_of_cycles
-	UML_GETEXP(block, uml::I0);                                                  // getexp  i0
-	UML_MOV(block, uml::mem(&R15), uml::I0);                                          // mov     <pc>,i0
-	save_fast_iregs(block);
-	UML_EXIT(block, EXECUTE_OUT_OF_CYCLES);                                 // exit    EXECUTE_OUT_OF_CYCLES
+	UML_HANDLE(block, *m_impstate.out_of_cycles);                                       // handle  out_of_cycles
+	UML_GETEXP(block, uml::I0);                                                         // getexp  i0
+	UML_MOV(block, DRC_REG(eR15), uml::I0);                                             // mov     [r15],i0
+	UML_EXIT(block, EXECUTE_OUT_OF_CYCLES);                                             // exit    EXECUTE_OUT_OF_CYCLES
 
 	block.end();
 }
 
 
-/*------------------------------------------------------------------
-    static_generate_detect_fault
-------------------------------------------------------------------*/
-
-void arm7_cpu_device::static_generate_detect_fault(uml::code_handle **handleptr)
-{
-	/* on entry, flags are in I2, vaddr is in I3, desc_lvl1 is in I4, ap is in R5 */
-	/* on exit, fault result is in I6 */
-	drcuml_state &drcuml = *m_impstate.drcuml;
-	int donefault = 0;
-	int checkuser = 0;
-	int label = 1;
-
-	/* begin generating */
-	drcuml_block &block(drcuml.begin_block(1024));
-
-	/* add a global entry for this */
-	alloc_handle(drcuml, m_impstate.detect_fault, "detect_fault");
-	UML_HANDLE(block, *m_impstate.detect_fault);                // handle   detect_fault
-
-	UML_ROLAND(block, uml::I6, uml::I4, 32-4, 0x0f<<1);                       // roland   i6, i4, 32-4, 0xf<<1
-	UML_ROLAND(block, uml::I6, uml::mem(&COPRO_DOMAIN_ACCESS_CONTROL), uml::I6, 3);// roland   i6, COPRO_DOMAIN_ACCESS_CONTROL, i6, 3
-	// if permission == 3, FAULT_NONE
-	UML_CMP(block, uml::I6, 3);                                          // cmp      i6, 3
-	UML_MOVc(block, uml::COND_E, uml::I6, FAULT_NONE);                        // move     i6, FAULT_NONE
-	UML_JMPc(block, uml::COND_E, donefault = label++);                   // jmpe     donefault
-	// if permission == 0 || permission == 2, FAULT_DOMAIN
-	UML_CMP(block, uml::I6, 1);                                          // cmp      i6, 1
-	UML_MOVc(block, uml::COND_NE, uml::I6, FAULT_DOMAIN);                     // movne    i6, FAULT_DOMAIN
-	UML_JMPc(block, uml::COND_NE, donefault);                            // jmpne    donefault
-
-	// if permission == 1
-	UML_CMP(block, uml::I5, 3);                                          // cmp      i5, 3
-	UML_MOVc(block, uml::COND_E, uml::I6, FAULT_NONE);                        // move     i6, FAULT_NONE
-	UML_JMPc(block, uml::COND_E, donefault);                             // jmpe     donefault
-	UML_CMP(block, uml::I5, 0);                                          // cmp      i5, 1
-	UML_JMPc(block, uml::COND_NE, checkuser = label++);                  // jmpne    checkuser
-	UML_ROLAND(block, uml::I6, uml::mem(&COPRO_CTRL),                         // roland   i6, COPRO_CTRL, 32 - COPRO_CTRL_SYSTEM_SHIFT,
-				32 - COPRO_CTRL_SYSTEM_SHIFT,                       //          COPRO_CTRL_SYSTEM | COPRO_CTRL_ROM
-				COPRO_CTRL_SYSTEM | COPRO_CTRL_ROM);
-	// if s == 0 && r == 0, FAULT_PERMISSION
-	UML_CMP(block, uml::I6, 0);                                          // cmp      i6, 0
-	UML_MOVc(block, uml::COND_E, uml::I6, FAULT_PERMISSION);                  // move     i6, FAULT_PERMISSION
-	UML_JMPc(block, uml::COND_E, donefault);                             // jmpe     donefault
-	// if s == 1 && r == 1, FAULT_PERMISSION
-	UML_CMP(block, uml::I6, 3);                                          // cmp      i6, 3
-	UML_MOVc(block, uml::COND_E, uml::I6, FAULT_PERMISSION);                  // move     i6, FAULT_PERMISSION
-	UML_JMPc(block, uml::COND_E, donefault);                             // jmpe     donefault
-	// if flags & TLB_WRITE, FAULT_PERMISSION
-	UML_TEST(block, uml::I2, ARM7_TLB_WRITE);                            // test     i2, ARM7_TLB_WRITE
-	UML_MOVc(block, uml::COND_NZ, uml::I6, FAULT_PERMISSION);                 // move     i6, FAULT_PERMISSION
-	UML_JMPc(block, uml::COND_NZ, donefault);                            // jmpe     donefault
-	// if r == 1 && s == 0, FAULT_NONE
-	UML_CMP(block, uml::I6, 2);                                          // cmp      i6, 2
-	UML_MOVc(block, uml::COND_E, uml::I6, FAULT_NONE);                        // move     i6, FAULT_NONE
-	UML_JMPc(block, uml::COND_E, donefault);                             // jmpe     donefault
-	UML_AND(block, uml::I6, uml::mem(&GET_CPSR), MODE_FLAG);                  // and      i6, GET_CPSR, MODE_FLAG
-	UML_CMP(block, uml::I6, eARM7_MODE_USER);                            // cmp      i6, eARM7_MODE_USER
-	// if r == 0 && s == 1 && usermode, FAULT_PERMISSION
-	UML_MOVc(block, uml::COND_E, uml::I6, FAULT_PERMISSION);                  // move     i6, FAULT_PERMISSION
-	UML_MOVc(block, uml::COND_NE, uml::I6, FAULT_NONE);                       // movne    i6, FAULT_NONE
-	UML_JMP(block, donefault);                                      // jmp      donefault
-
-	UML_LABEL(block, checkuser);                                    // checkuser:
-	// if !write, FAULT_NONE
-	UML_TEST(block, uml::I2, ARM7_TLB_WRITE);                            // test     i2, ARM7_TLB_WRITE
-	UML_MOVc(block, uml::COND_Z, uml::I6, FAULT_NONE);                        // movz     i6, FAULT_NONE
-	UML_JMPc(block, uml::COND_Z, donefault);                             // jmp      donefault
-	UML_AND(block, uml::I6, uml::mem(&GET_CPSR), MODE_FLAG);                  // and      i6, GET_CPSR, MODE_FLAG
-	UML_CMP(block, uml::I6, eARM7_MODE_USER);                            // cmp      i6, eARM7_MODE_USER
-	UML_MOVc(block, uml::COND_E, uml::I6, FAULT_PERMISSION);                  // move     i6, FAULT_PERMISSION
-	UML_MOVc(block, uml::COND_NE, uml::I6, FAULT_NONE);                       // move     i6, FAULT_NONE
-
-	UML_LABEL(block, donefault);                                    // donefault:
-	UML_RET(block);                                                 // ret
-}
-
-/*------------------------------------------------------------------
-    static_generate_tlb_translate
-------------------------------------------------------------------*/
+/*-------------------------------------------------
+    static_generate_interpret - generate the
+    handler that hands an instruction back to the
+    interpreter
+-------------------------------------------------*/
 
-void arm7_cpu_device::static_generate_tlb_translate(uml::code_handle **handleptr)
+void arm7_cpu_device::static_generate_interpret()
 {
-	/* on entry, address is in I0 and flags are in I2 */
-	/* on exit, translated address is in I0 and success/failure is in I2 */
-	/* routine trashes I4-I7 */
 	drcuml_state &drcuml = *m_impstate.drcuml;
-	uml::code_label smallfault;
-	uml::code_label smallprefetch;
-	int nopid = 0;
-	int nounmapped = 0;
-	int nounmapped2 = 0;
-	int nocoarse = 0;
-	int nofine = 0;
-	int nosection = 0;
-	int nolargepage = 0;
-	int nosmallpage = 0;
-	int notinypage = 0;
-	int handlefault = 0;
-	int level2 = 0;
-	int prefetch = 0;
-	int prefetch2 = 0;
-	int label = 1;
 
 	/* begin generating */
-	drcuml_block &block(drcuml.begin_block(170));
-
-	alloc_handle(drcuml, m_impstate.tlb_translate, "tlb_translate");
-	UML_HANDLE(block, *m_impstate.tlb_translate);               // handle   tlb_translate
-
-	// I3: vaddr
-	UML_CMP(block, uml::I0, 32 * 1024 * 1024);                           // cmp      i0, 32*1024*1024
-	UML_JMPc(block, uml::COND_GE, nopid = label++);                      // jmpge    nopid
-	UML_AND(block, uml::I3, uml::mem(&COPRO_FCSE_PID), 0xfe000000);           // and      i3, COPRO_FCSE_PID, 0xfe000000
-	UML_ADD(block, uml::I3, uml::I3, uml::I0);                                     // add      i3, i3, i0
-
-	// I4: desc_lvl1
-	UML_AND(block, uml::I4, uml::mem(&COPRO_TLB_BASE), COPRO_TLB_BASE_MASK);  // and      i4, COPRO_TLB_BASE, COPRO_TLB_BASE_MASK
-	UML_ROLINS(block, uml::I4, uml::I3, 32 - COPRO_TLB_VADDR_FLTI_MASK_SHIFT, // rolins   i4, i3, 32-COPRO_TLB_VADDR_FLTI_MASK_SHIFT,
-				COPRO_TLB_VADDR_FLTI_MASK);                         //          COPRO_TLB_VADDR_FLTI_MASK
-	UML_READ(block, uml::I4, uml::I4, uml::SIZE_DWORD, uml::SPACE_PROGRAM);             // read32   i4, i4, PROGRAM
-
-	// I7: desc_lvl1 & 3
-	UML_AND(block, uml::I7, uml::I4, 3);                                      // and      i7, i4, 3
-
-	UML_CMP(block, uml::I7, COPRO_TLB_UNMAPPED);                         // cmp      i7, COPRO_TLB_UNMAPPED
-	UML_JMPc(block, uml::COND_NE, nounmapped = label++);                 // jmpne    nounmapped
-
-	// TLB Unmapped
-	UML_TEST(block, uml::I2, ARM7_TLB_ABORT_D);                          // test     i2, ARM7_TLB_ABORT_D
-	UML_MOVc(block, uml::COND_E, uml::mem(&COPRO_FAULT_STATUS_D), (5 << 0));  // move     COPRO_FAULT_STATUS_D, (5 << 0)
-	UML_MOVc(block, uml::COND_E, uml::mem(&COPRO_FAULT_ADDRESS), uml::I3);         // move     COPRO_FAULT_ADDRESS, i3
-	UML_MOVc(block, uml::COND_E, uml::mem(&m_pendingAbtD), 1);             // move     pendingAbtD, 1
-	UML_MOVc(block, uml::COND_E, uml::I2, 0);                                 // move     i2, 0
-	UML_RETc(block, uml::COND_E);                                        // rete
-
-	UML_TEST(block, uml::I2, ARM7_TLB_ABORT_P);                          // test     i2, ARM7_TLB_ABORT_P
-	UML_MOVc(block, uml::COND_E, uml::mem(&m_pendingAbtP), 1);             // move     pendingAbtP, 1
-	UML_MOV(block, uml::I2, 0);                                          // mov      i2, 0
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, nounmapped);                                   // nounmapped:
-	UML_CMP(block, uml::I7, COPRO_TLB_COARSE_TABLE);                     // cmp      i7, COPRO_TLB_COARSE_TABLE
-	UML_JMPc(block, uml::COND_NE, nocoarse = label++);                   // jmpne    nocoarse
-
-	UML_ROLAND(block, uml::I5, uml::I4, 32-4, 0x0f<<1);                       // roland   i5, i4, 32-4, 0xf<<1
-	UML_ROLAND(block, uml::I5, uml::mem(&COPRO_DOMAIN_ACCESS_CONTROL), uml::I5, 3);// roland   i5, COPRO_DOMAIN_ACCESS_CONTROL, i5, 3
-	UML_CMP(block, uml::I5, 1);                                          // cmp      i5, 1
-	UML_JMPc(block, uml::COND_E, level2 = label++);                      // jmpe     level2
-	UML_CMP(block, uml::I5, 3);                                          // cmp      i5, 3
-	UML_JMPc(block, uml::COND_NE, nofine = label++);                     // jmpne    nofine
-	UML_LABEL(block, level2);                                       // level2:
-
-	// I7: desc_level2
-	UML_AND(block, uml::I7, uml::I4, COPRO_TLB_CFLD_ADDR_MASK);               // and      i7, i4, COPRO_TLB_CFLD_ADDR_MASK
-	UML_ROLINS(block, uml::I7, uml::I3, 32 - COPRO_TLB_VADDR_CSLTI_MASK_SHIFT,// rolins   i7, i3, 32 - COPRO_TLB_VADDR_CSLTI_MASK_SHIFT
-				COPRO_TLB_VADDR_CSLTI_MASK);                        //          COPRO_TLB_VADDR_CSLTI_MASK
-	UML_READ(block, uml::I7, uml::I7, uml::SIZE_DWORD, uml::SPACE_PROGRAM);             // read32   i7, i7, PROGRAM
-	UML_JMP(block, nofine);                                         // jmp      nofine
-
-	UML_LABEL(block, nocoarse);                                     // nocoarse:
-	UML_CMP(block, uml::I7, COPRO_TLB_SECTION_TABLE);                    // cmp      i7, COPRO_TLB_SECTION_TABLE
-	UML_JMPc(block, uml::COND_NE, nosection = label++);                  // jmpne    nosection
-
-	UML_ROLAND(block, uml::I5, uml::I4, 32-10, 3);                            // roland   i7, i4, 32-10, 3
-	// result in I6
-	UML_CALLH(block, *m_impstate.detect_fault);                 // callh    detect_fault
-	UML_CMP(block, uml::I6, FAULT_NONE);                                 // cmp      i6, FAULT_NONE
-	UML_JMPc(block, uml::COND_NE, handlefault = label++);                // jmpne    handlefault
-
-	// no fault, return translated address
-	UML_AND(block, uml::I0, uml::I3, ~COPRO_TLB_SECTION_PAGE_MASK);           // and      i0, i3, ~COPRO_TLB_SECTION_PAGE_MASK
-	UML_ROLINS(block, uml::I0, uml::I4, 0, COPRO_TLB_SECTION_PAGE_MASK);      // rolins   i0, i4, COPRO_TLB_SECTION_PAGE_MASK
-	UML_MOV(block, uml::I2, 1);                                          // mov      i2, 1
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, handlefault);                                  // handlefault:
-	UML_TEST(block, uml::I2, ARM7_TLB_ABORT_D);                          // test     i2, ARM7_TLB_ABORT_D
-	UML_JMPc(block, uml::COND_Z, prefetch = label++);                    // jmpz     prefetch
-	UML_MOV(block, uml::mem(&COPRO_FAULT_ADDRESS), uml::I3);                  // mov      COPRO_FAULT_ADDRESS, i3
-	UML_MOV(block, uml::mem(&m_pendingAbtD), 1);                      // mov      m_pendingAbtD, 1
-	UML_ROLAND(block, uml::I5, uml::I4, 31, 0xf0);                            // roland   i5, i4, 31, 0xf0
-	UML_CMP(block, uml::I6, FAULT_DOMAIN);                               // cmp      i6, FAULT_DOMAIN
-	UML_MOVc(block, uml::COND_E, uml::I6, 9 << 0);                            // move     i6, 9 << 0
-	UML_MOVc(block, uml::COND_NE, uml::I6, 13 << 0);                          // movne    i6, 13 << 0
-	UML_OR(block, uml::mem(&COPRO_FAULT_STATUS_D), uml::I5, uml::I6);              // or       COPRO_FAULT_STATUS_D, i5, i6
-	UML_MOV(block, uml::I2, 0);                                          // mov      i2, 0
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, prefetch);                                     // prefetch:
-	UML_MOV(block, uml::mem(&m_pendingAbtP), 1);                      // mov      m_pendingAbtP, 1
-	UML_MOV(block, uml::I2, 0);                                          // mov      i2, 0
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, nosection);                                    // nosection:
-	UML_CMP(block, uml::I7, COPRO_TLB_FINE_TABLE);                       // cmp      i7, COPRO_TLB_FINE_TABLE
-	UML_JMPc(block, uml::COND_NE, nofine);                               // jmpne    nofine
-
-	// Not yet implemented
-	UML_MOV(block, uml::I2, 1);                                          // mov      i2, 1
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, nofine);                                       // nofine:
-
-	// I7: desc_lvl2
-	UML_AND(block, uml::I6, uml::I7, 3);                                      // and      i6, i7, 3
-	UML_CMP(block, uml::I6, COPRO_TLB_UNMAPPED);                         // cmp      i6, COPRO_TLB_UNMAPPED
-	UML_JMPc(block, uml::COND_NE, nounmapped2 = label++);                // jmpne    nounmapped2
-
-	UML_TEST(block, uml::I2, ARM7_TLB_ABORT_D);                          // test     i2, ARM7_TLB_ABORT_D
-	UML_JMPc(block, uml::COND_Z, prefetch2 = label++);                   // jmpz     prefetch2
-	UML_MOV(block, uml::mem(&COPRO_FAULT_ADDRESS), uml::I3);                  // mov      COPRO_FAULT_ADDRESS, i3
-	UML_MOV(block, uml::mem(&m_pendingAbtD), 1);                      // mov      m_pendingAbtD, 1
-	UML_ROLAND(block, uml::I5, uml::I4, 31, 0xf0);                            // roland   i5, i4, 31, 0xf0
-	UML_OR(block, uml::I5, uml::I5, 7 << 0);                                  // or       i5, i5, 7 << 0
-	UML_OR(block, uml::mem(&COPRO_FAULT_STATUS_D), uml::I5, uml::I6);              // or       COPRO_FAULT_STATUS_D, i5, i6
-	UML_MOV(block, uml::I2, 0);                                          // mov      i2, 0
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, prefetch2);                                    // prefetch2:
-	UML_MOV(block, uml::mem(&m_pendingAbtP), 1);                      // mov      m_pendingAbtP, 1
-	UML_MOV(block, uml::I2, 0);                                          // mov      i2, 0
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, nounmapped2);                                  // nounmapped2:
-	UML_CMP(block, uml::I6, COPRO_TLB_LARGE_PAGE);                       // cmp      i6, COPRO_TLB_LARGE_PAGE
-	UML_JMPc(block, uml::COND_NE, nolargepage = label++);                // jmpne    nolargepage
-
-	UML_AND(block, uml::I0, uml::I3, ~COPRO_TLB_LARGE_PAGE_MASK);             // and      i0, i3, ~COPRO_TLB_LARGE_PAGE_MASK
-	UML_ROLINS(block, uml::I0, uml::I7, 0, COPRO_TLB_LARGE_PAGE_MASK);        // rolins   i0, i7, 0, COPRO_TLB_LARGE_PAGE_MASK
-	UML_MOV(block, uml::I2, 1);                                          // mov      i2, 1
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, nolargepage);                                  // nolargepage:
-	UML_CMP(block, uml::I6, COPRO_TLB_SMALL_PAGE);                       // cmp      i6, COPRO_TLB_SMALL_PAGE
-	UML_JMPc(block, uml::COND_NE, nosmallpage = label++);                // jmpne    nosmallpage
-
-	UML_ROLAND(block, uml::I5, uml::I3, 32-9, 3<<1);                          // roland   i5, i3, 32-9, 3<<1
-	UML_ROLAND(block, uml::I6, uml::I7, 32-4, 0xff);                          // roland   i6, i7, 32-4, 0xff
-	UML_SHR(block, uml::I5, uml::I7, uml::I5);                                     // shr      i5, i7, i5
-	UML_AND(block, uml::I5, uml::I5, 3);                                      // and      i5, i5, 3
-	// result in I6
-	UML_CALLH(block, *m_impstate.detect_fault);                 // callh    detect_fault
-
-	UML_CMP(block, uml::I6, FAULT_NONE);                                 // cmp      i6, FAULT_NONE
-	UML_JMPc(block, uml::COND_NE, smallfault = label++);                 // jmpne    smallfault
-	UML_AND(block, uml::I0, uml::I7, COPRO_TLB_SMALL_PAGE_MASK);              // and      i0, i7, COPRO_TLB_SMALL_PAGE_MASK
-	UML_ROLINS(block, uml::I0, uml::I3, 0, ~COPRO_TLB_SMALL_PAGE_MASK);       // rolins   i0, i3, 0, ~COPRO_TLB_SMALL_PAGE_MASK
-	UML_MOV(block, uml::I2, 1);                                          // mov      i2, 1
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, smallfault);                                   // smallfault:
-	UML_TEST(block, uml::I2, ARM7_TLB_ABORT_D);                          // test     i2, ARM7_TLB_ABORT_D
-	UML_JMPc(block, uml::COND_NZ, smallprefetch = label++);              // jmpnz    smallprefetch
-	UML_MOV(block, uml::mem(&COPRO_FAULT_ADDRESS), uml::I3);                  // mov      COPRO_FAULT_ADDRESS, i3
-	UML_MOV(block, uml::mem(&m_pendingAbtD), 1);                      // mov      pendingAbtD, 1
-	UML_CMP(block, uml::I6, FAULT_DOMAIN);                               // cmp      i6, FAULT_DOMAIN
-	UML_MOVc(block, uml::COND_E, uml::I5, 11 << 0);                           // move     i5, 11 << 0
-	UML_MOVc(block, uml::COND_NE, uml::I5, 15 << 0);                          // movne    i5, 15 << 0
-	UML_ROLINS(block, uml::I5, uml::I4, 31, 0xf0);                            // rolins   i5, i4, 31, 0xf0
-	UML_MOV(block, uml::mem(&COPRO_FAULT_STATUS_D), uml::I5);                 // mov      COPRO_FAULT_STATUS_D, i5
-	UML_MOV(block, uml::I2, 0);                                          // mov      i2, 0
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, smallprefetch);                                // smallprefetch:
-	UML_MOV(block, uml::mem(&m_pendingAbtP), 1);                      // mov      pendingAbtP, 1
-	UML_MOV(block, uml::I2, 0);                                          // mov      i2, 0
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, nosmallpage);                                  // nosmallpage:
-	UML_CMP(block, uml::I6, COPRO_TLB_TINY_PAGE);                        // cmp      i6, COPRO_TLB_TINY_PAGE
-	UML_JMPc(block, uml::COND_NE, notinypage = label++);                 // jmpne    notinypage
-
-	UML_AND(block, uml::I0, uml::I3, ~COPRO_TLB_TINY_PAGE_MASK);              // and      i0, i3, ~COPRO_TLB_TINY_PAGE_MASK
-	UML_ROLINS(block, uml::I0, uml::I7, 0, COPRO_TLB_TINY_PAGE_MASK);         // rolins   i0, i7, 0, COPRO_TLB_TINY_PAGE_MASK
-	UML_MOV(block, uml::I2, 1);                                          // mov      i2, 1
-	UML_RET(block);                                                 // ret
-
-	UML_LABEL(block, notinypage);                                   // notinypage:
-	UML_MOV(block, uml::I0, uml::I3);                                         // mov      i0, i3
-	UML_RET(block);                                                 // ret
+	drcuml_block &block(drcuml.begin_block(20));
+
+	/* only the instructions before this one have run */
+	alloc_handle(drcuml, m_impstate.interpret, "interpret");
+	UML_HANDLE(block, *m_impstate.interpret);                                           // handle  interpret
+	UML_GETEXP(block, uml::I0);                                                         // getexp  i0
+	UML_MOV(block, DRC_REG(eR15), uml::I0);                                             // mov     [r15],i0
+	UML_RECOVER(block, uml::I1, MAPVAR_CYCLES);                                         // recover i1,CYCLES
+	UML_SUB(block, DRC_ICOUNT, DRC_ICOUNT, uml::I1);                                    // sub     [icount],[icount],i1
+	UML_RECOVER(block, uml::I1, MAPVAR_INSNS);                                          // recover i1,INSNS
+	UML_ADD(block, DRC_COMPILED, DRC_COMPILED, uml::I1);                                // add     [compiled],[compiled],i1
+	UML_EXIT(block, EXECUTE_INTERPRET);                                                 // exit    EXECUTE_INTERPRET
 
 	block.end();
 }
 
-/*------------------------------------------------------------------
-    static_generate_memory_accessor
-------------------------------------------------------------------*/
 
-void arm7_cpu_device::static_generate_memory_accessor(int size, bool istlb, bool iswrite, const char *name, uml::code_handle *&handleptr)
+/*-------------------------------------------------
+    static_generate_tlb_mismatch - generate the
+    handler for code that could not be fetched
+-------------------------------------------------*/
+
+void arm7_cpu_device::static_generate_tlb_mismatch()
 {
-	/* on entry, address is in I0; data for writes is in I1, fetch type in I2 */
-	/* on exit, read result is in I0 */
-	/* routine trashes I0-I3 */
 	drcuml_state &drcuml = *m_impstate.drcuml;
-	//int tlbmiss = 0;
-	int label = 1;
 
 	/* begin generating */
-	drcuml_block &block(drcuml.begin_block(1024));
-
-	/* add a global entry for this */
-	alloc_handle(drcuml, handleptr, name);
-	UML_HANDLE(block, *handleptr);                                         // handle  *handleptr
-
-	if (istlb)
-	{
-		UML_TEST(block, uml::mem(&COPRO_CTRL), COPRO_CTRL_MMU_EN);               // test     COPRO_CTRL, COPRO_CTRL_MMU_EN
-		if (iswrite)
-		{
-			UML_MOVc(block, uml::COND_NZ, uml::I3, ARM7_TLB_WRITE);                   // movnz    i3, ARM7_TLB_WRITE
-		}
-		else
-		{
-			UML_MOVc(block, uml::COND_NZ, uml::I3, ARM7_TLB_READ);                    // movnz    i3, ARM7_TLB_READ
-		}
-		UML_OR(block, uml::I2, uml::I2, uml::I3);                                          // or       i2, i2, i3
-		UML_CALLHc(block, uml::COND_NZ, *m_impstate.tlb_translate);          // callhnz  tlb_translate
-	}
-
-	/* general case: assume paging and perform a translation */
-	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) == 0)
-	{
-		for (int ramnum = 0; ramnum < ARM7_MAX_FASTRAM; ramnum++)
-		{
-			if (m_impstate.fastram[ramnum].base != nullptr && (!iswrite || !m_impstate.fastram[ramnum].readonly))
-			{
-				void *fastbase = (uint8_t *)m_impstate.fastram[ramnum].base - m_impstate.fastram[ramnum].start;
-				uint32_t skip = label++;
-				if (m_impstate.fastram[ramnum].end != 0xffffffff)
-				{
-					UML_CMP(block, uml::I0, m_impstate.fastram[ramnum].end);     // cmp     i0, end
-					UML_JMPc(block, uml::COND_A, skip);                              // ja      skip
-				}
-				if (m_impstate.fastram[ramnum].start != 0x00000000)
-				{
-					UML_CMP(block, uml::I0, m_impstate.fastram[ramnum].start);   // cmp     i0, fastram_start
-					UML_JMPc(block, uml::COND_B, skip);                              // jb      skip
-				}
-
-				if (!iswrite)
-				{
-					if (size == 1)
-					{
-						UML_XOR(block, uml::I0, uml::I0, (m_endian == ENDIANNESS_BIG) ? BYTE4_XOR_BE(0) : BYTE4_XOR_LE(0));
-																						// xor     i0, i0, bytexor
-						UML_LOAD(block, uml::I0, fastbase, uml::I0, uml::SIZE_BYTE, uml::SCALE_x1);         // load    i0, fastbase, i0, byte
-					}
-					else if (size == 2)
-					{
-						UML_XOR(block, uml::I0, uml::I0, (m_endian == ENDIANNESS_BIG) ? WORD_XOR_BE(0) : WORD_XOR_LE(0));
-																						// xor     i0, i0, wordxor
-						UML_LOAD(block, uml::I0, fastbase, uml::I0, uml::SIZE_WORD, uml::SCALE_x1);         // load    i0, fastbase, i0, word_x1
-					}
-					else if (size == 4)
-					{
-						UML_LOAD(block, uml::I0, fastbase, uml::I0, uml::SIZE_DWORD, uml::SCALE_x1);        // load    i0, fastbase, i0, dword_x1
-					}
-					UML_RET(block);                                                     // ret
-				}
-				else
-				{
-					if (size == 1)
-					{
-						UML_XOR(block, uml::I0, uml::I0, (m_endian == ENDIANNESS_BIG) ? BYTE4_XOR_BE(0) : BYTE4_XOR_LE(0));
-																						// xor     i0, i0, bytexor
-						UML_STORE(block, fastbase, uml::I0, uml::I1, uml::SIZE_BYTE, uml::SCALE_x1);        // store   fastbase, i0, i1, byte
-					}
-					else if (size == 2)
-					{
-						UML_XOR(block, uml::I0, uml::I0, (m_endian == ENDIANNESS_BIG) ? WORD_XOR_BE(0) : WORD_XOR_LE(0));
-																						// xor     i0, i0, wordxor
-						UML_STORE(block, fastbase, uml::I0, uml::I1, uml::SIZE_WORD, uml::SCALE_x1);        // store   fastbase, i0, i1, word_x1
-					}
-					else if (size == 4)
-					{
-						UML_STORE(block, fastbase, uml::I0, uml::I1, uml::SIZE_DWORD, uml::SCALE_x1);       // store   fastbase,i0,i1,dword_x1
-					}
-					UML_RET(block);                                                     // ret
-				}
-
-				UML_LABEL(block, skip);                                                 // skip:
-			}
-		}
-	}
-
-	switch (size)
-	{
-		case 1:
-			if (iswrite)
-			{
-				UML_WRITE(block, uml::I0, uml::I1, uml::SIZE_BYTE, uml::SPACE_PROGRAM);                 // write   i0, i1, program_byte
-			}
-			else
-			{
-				UML_READ(block, uml::I0, uml::I0, uml::SIZE_BYTE, uml::SPACE_PROGRAM);                  // read    i0, i0, program_byte
-			}
-			break;
-
-		case 2:
-			if (iswrite)
-			{
-				UML_WRITE(block, uml::I0, uml::I1, uml::SIZE_WORD, uml::SPACE_PROGRAM);                 // write   i0,i1,program_word
-			}
-			else
-			{
-				UML_READ(block, uml::I0, uml::I0, uml::SIZE_WORD, uml::SPACE_PROGRAM);                  // read    i0,i0,program_word
-			}
-			break;
-
-		case 4:
-			if (iswrite)
-			{
-				UML_WRITE(block, uml::I0, uml::I1, uml::SIZE_DWORD, uml::SPACE_PROGRAM);                // write   i0,i1,program_dword
-			}
-			else
-			{
-				UML_READ(block, uml::I0, uml::I0, uml::SIZE_DWORD, uml::SPACE_PROGRAM);                 // read    i0,i0,program_dword
-			}
-			break;
-	}
-	UML_RET(block);                                                                 // ret
+	drcuml_block &block(drcuml.begin_block(20));
+
+	alloc_handle(drcuml, m_impstate.tlb_mismatch, "tlb_mismatch");
+	UML_HANDLE(block, *m_impstate.tlb_mismatch);                                        // handle  tlb_mismatch
+	UML_GETEXP(block, uml::I0);                                                         // getexp  i0
+	UML_MOV(block, DRC_REG(eR15), uml::I0);                                             // mov     [r15],i0
+	UML_RECOVER(block, uml::I1, MAPVAR_CYCLES);                                         // recover i1,CYCLES
+	UML_SUB(block, DRC_ICOUNT, DRC_ICOUNT, uml::I1);                                    // sub     [icount],[icount],i1
+	UML_RECOVER(block, uml::I1, MAPVAR_INSNS);                                          // recover i1,INSNS
+	UML_ADD(block, DRC_COMPILED, DRC_COMPILED, uml::I1);                                // add     [compiled],[compiled],i1
+	UML_EXIT(block, EXECUTE_TLB_MISMATCH);                                              // exit    EXECUTE_TLB_MISMATCH
 
 	block.end();
 }
 
+
+
 /***************************************************************************
     CODE GENERATION
 ***************************************************************************/
@@ -1139,26 +711,27 @@ void arm7_cpu_device::static_generate_memory_accessor(int size, bool istlb, bool
 /*-------------------------------------------------
     generate_update_cycles - generate code to
     subtract cycles from the icount and generate
-    an exception if out
+    an exception if out; a memory callback that
+    raised an interrupt leaves the same way
 -------------------------------------------------*/
 
 void arm7_cpu_device::generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param)
 {
-	/* check full interrupts if pending */
-	if (compiler.checkints)
-	{
-		compiler.checkints = false;
-		UML_CALLH(block, *m_impstate.check_irq);
-	}
+	/* count the compiled instructions */
+	if (compiler.insns > 0)
+		UML_ADD(block, DRC_COMPILED, DRC_COMPILED, compiler.insns);                     // add     [compiled],[compiled],insns
+	compiler.insns = 0;
 
 	/* account for cycles */
 	if (compiler.cycles > 0)
 	{
-		UML_SUB(block, uml::mem(&m_icount), uml::mem(&m_icount), MAPVAR_CYCLES);    // sub     icount,icount,cycles
-		UML_MAPVAR(block, MAPVAR_CYCLES, 0);                                    // mapvar  cycles,0
-		UML_EXHc(block, uml::COND_S, *m_impstate.out_of_cycles, param);          // exh     out_of_cycles,nextpc
+		UML_SUB(block, DRC_ICOUNT, DRC_ICOUNT, compiler.cycles);                        // sub     [icount],[icount],cycles
+		UML_EXHc(block, uml::COND_S, *m_impstate.out_of_cycles, param);                 // exh     out_of_cycles,param,S
 	}
 	compiler.cycles = 0;
+
+	UML_TEST(block, DRC_IRQ_PENDING, 1);                                                // test    [irq_pending],1
+	UML_EXHc(block, uml::COND_NZ, *m_impstate.out_of_cycles, param);                    // exh     out_of_cycles,param,NZ
 }
 
 
@@ -1169,60 +742,36 @@ void arm7_cpu_device::generate_update_cycles(drcuml_block &block, compiler_state
 
 void arm7_cpu_device::generate_checksum_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *seqhead, const opcode_desc *seqlast)
 {
-	const opcode_desc *curdesc;
 	if (m_impstate.drcuml->logging())
-	{
-		block.append_comment("[Validation for %08X]", seqhead->pc);                // comment
-	}
+		block.append_comment("[Validation for %08X]", seqhead->pc);                    // comment
 
-	/* loose verify or single instruction: just compare and fail */
-	if (!(m_impstate.drcoptions & ARM7DRC_STRICT_VERIFY) || seqhead->next() == nullptr)
+	/* sum every word the compiled instructions were fetched from */
+	uint32_t sum = 0;
+	bool first = true;
+	offs_t lastaddr = ~0;
+	for (const opcode_desc *curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
 	{
-		if (!(seqhead->flags & OPFLAG_VIRTUAL_NOOP))
-		{
-			uint32_t sum = seqhead->opptr.l[0];
-			const void *base = m_prptr(seqhead->physpc);
-			UML_LOAD(block, uml::I0, base, 0, uml::SIZE_DWORD, uml::SCALE_x4);             // load    i0,base,0,dword
-
-			if (seqhead->delay.first() != nullptr && seqhead->physpc != seqhead->delay.first()->physpc)
-			{
-				base = m_prptr(seqhead->delay.first()->physpc);
-				UML_LOAD(block, uml::I1, base, 0, uml::SIZE_DWORD, uml::SCALE_x4);         // load    i1,base,dword
-				UML_ADD(block, uml::I0, uml::I0, uml::I1);                                 // add     i0,i0,i1
-
-				sum += seqhead->delay.first()->opptr.l[0];
-			}
-
-			UML_CMP(block, uml::I0, sum);                                        // cmp     i0,opptr[0]
-			UML_EXHc(block, uml::COND_NE, *m_impstate.nocode, epc(seqhead)); // exne    nocode,seqhead->pc
-		}
+		/* interpreted instructions are fetched again when they run */
+		if ((curdesc->flags & OPFLAG_VIRTUAL_NOOP) || (curdesc->userflags & ARM7_USERFLAG_INTERPRET))
+			continue;
+
+		const offs_t addr = curdesc->physpc & ~3;
+		const void *base = m_program->get_write_ptr(addr);
+		if (addr == lastaddr || base == nullptr)
+			continue;
+		lastaddr = addr;
+
+		UML_LOAD(block, first ? uml::I0 : uml::I1, base, 0, uml::SIZE_DWORD, uml::SCALE_x4);   // load    i0/i1,base,0,dword
+		if (!first)
+			UML_ADD(block, uml::I0, uml::I0, uml::I1);                                  // add     i0,i0,i1
+		sum += *(const uint32_t *)base;
+		first = false;
 	}
 
-	/* full verification; sum up everything */
-	else
+	if (!first)
 	{
-		uint32_t sum = 0;
-		const void *base = m_prptr(seqhead->physpc);
-		UML_LOAD(block, uml::I0, base, 0, uml::SIZE_DWORD, uml::SCALE_x4);                 // load    i0,base,0,dword
-		sum += seqhead->opptr.l[0];
-		for (curdesc = seqhead->next(); curdesc != seqlast->next(); curdesc = curdesc->next())
-			if (!(curdesc->flags & OPFLAG_VIRTUAL_NOOP))
-			{
-				base = m_prptr(curdesc->physpc);
-				UML_LOAD(block, uml::I1, base, 0, uml::SIZE_DWORD, uml::SCALE_x4);         // load    i1,base,dword
-				UML_ADD(block, uml::I0, uml::I0, uml::I1);                                 // add     i0,i0,i1
-				sum += curdesc->opptr.l[0];
-
-				if (curdesc->delay.first() != nullptr && (curdesc == seqlast || (curdesc->next() != nullptr && curdesc->next()->physpc != curdesc->delay.first()->physpc)))
-				{
-					base = m_prptr(curdesc->delay.first()->physpc);
-					UML_LOAD(block, uml::I1, base, 0, uml::SIZE_DWORD, uml::SCALE_x4);     // load    i1,base,dword
-					UML_ADD(block, uml::I0, uml::I0, uml::I1);                             // add     i0,i0,i1
-					sum += curdesc->delay.first()->opptr.l[0];
-				}
-			}
-		UML_CMP(block, uml::I0, sum);                                            // cmp     i0,sum
-		UML_EXHc(block, uml::COND_NE, *m_impstate.nocode, epc(seqhead));     // exne    nocode,seqhead->pc
+		UML_CMP(block, uml::I0, sum);                                                   // cmp     i0,sum
+		UML_EXHc(block, uml::COND_NE, *m_impstate.nocode, seqhead->pc);                 // exne    nocode,seqhead->pc
 	}
 }
 
@@ -1234,579 +783,1289 @@ void arm7_cpu_device::generate_checksum_block(drcuml_block &block, compiler_stat
 
 void arm7_cpu_device::generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
 {
-	//offs_t expc;
-	int hotnum;
-
 	/* add an entry for the log */
-	// TODO FIXME
-//  if (m_impstate.drcuml->logging() && !(desc->flags & OPFLAG_VIRTUAL_NOOP))
-//      log_add_disasm_comment(block, desc->pc, desc->opptr.l[0]);
+	if (m_impstate.drcuml->logging())
+	{
+		if (compiler.mode & ARM7_DRC_MODE_THUMB)
+			block.append_comment("%08X: %04X", desc->pc, desc->opptr.w[0]);            // comment
+		else
+			block.append_comment("%08X: %08X", desc->pc, desc->opptr.l[0]);            // comment
+	}
 
-	/* set the PC map variable */
-	//expc = (desc->flags & OPFLAG_IN_DELAY_SLOT) ? desc->pc - 3 : desc->pc;
-	UML_MAPVAR(block, MAPVAR_PC, desc->pc);                                 // mapvar  PC,pc
+	/* set the PC map variable, and the cycles and instructions before this one */
+	UML_MAPVAR(block, MAPVAR_PC, desc->pc);                                             // mapvar  PC,desc->pc
+	UML_MAPVAR(block, MAPVAR_CYCLES, compiler.cycles);                                  // mapvar  CYCLES,compiler.cycles
+	UML_MAPVAR(block, MAPVAR_INSNS, compiler.insns);                                    // mapvar  INSNS,compiler.insns
 
 	/* accumulate total cycles */
 	compiler.cycles += desc->cycles;
+	compiler.insns++;
 
-	/* update the icount map variable */
-	UML_MAPVAR(block, MAPVAR_CYCLES, compiler.cycles);                     // mapvar  CYCLES,compiler.cycles
-
-	/* is this a hotspot? */
-	for (hotnum = 0; hotnum < ARM7_MAX_HOTSPOTS; hotnum++)
+	/* if we hit an unmapped address, let the interpreter take the prefetch abort */
+	if (desc->flags & OPFLAG_COMPILER_PAGE_FAULT)
 	{
-		if (m_impstate.hotspot[hotnum].pc != 0 && desc->pc == m_impstate.hotspot[hotnum].pc && desc->opptr.l[0] == m_impstate.hotspot[hotnum].opcode)
-		{
-			compiler.cycles += m_impstate.hotspot[hotnum].cycles;
-			break;
-		}
+		UML_EXH(block, *m_impstate.tlb_mismatch, desc->pc);                             // exh     tlb_mismatch,pc
+		return;
 	}
 
-	/* update the icount map variable */
-	UML_MAPVAR(block, MAPVAR_CYCLES, compiler.cycles);                     // mapvar  CYCLES,compiler.cycles
+	/* hand anything we don't compile to the interpreter */
+	if ((desc->userflags & ARM7_USERFLAG_INTERPRET) || !generate_opcode(block, compiler, desc))
+		UML_EXH(block, *m_impstate.interpret, desc->pc);                                // exh     interpret,pc
+}
 
-	/* if we are debugging, call the debugger */
-	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) != 0)
-	{
-		UML_MOV(block, uml::mem(&R15), desc->pc);                                // mov     [pc],desc->pc
-		save_fast_iregs(block);
-		UML_DEBUG(block, desc->pc);                                         // debug   desc->pc
-	}
 
-	/* if we hit an unmapped address, fatal error */
-	if (desc->flags & OPFLAG_COMPILER_UNMAPPED)
+/*-------------------------------------------------
+    generate_branch - generate the code for a
+    taken branch to a fixed target in the current
+    mode
+-------------------------------------------------*/
+
+void arm7_cpu_device::generate_branch(drcuml_block &block, compiler_state &compiler, offs_t targetpc)
+{
+	compiler_state compiler_temp(compiler);
+
+	generate_update_cycles(block, compiler_temp, targetpc);                             // <subtract cycles>
+	UML_HASHJMP(block, compiler.mode, targetpc, *m_impstate.nocode);                    // hashjmp <mode>,targetpc,nocode
+
+	/* update the label */
+	compiler.labelnum = compiler_temp.labelnum;
+}
+
+
+/*-------------------------------------------------
+    generate_exchange - generate code to turn the
+    branch target in I0 into the new PC, leaving
+    the new Thumb bit in I1; targets the
+    interpreter would not run as plain ARM code
+    are handed back to it
+-------------------------------------------------*/
+
+void arm7_cpu_device::generate_exchange(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, bool exchange)
+{
+	if (compiler.mode & ARM7_DRC_MODE_THUMB)
 	{
-		UML_MOV(block, uml::mem(&R15), desc->pc);                                // mov     R15,desc->pc
-		save_fast_iregs(block);
-		UML_EXIT(block, EXECUTE_UNMAPPED_CODE);                             // exit    EXECUTE_UNMAPPED_CODE
+		if (exchange)
+		{
+			/* an even target switches to ARM and skips a misaligned halfword */
+			UML_AND(block, uml::I1, uml::I0, 1);                                        // and     i1,i0,1
+			UML_XOR(block, uml::I2, uml::I1, 1);                                        // xor     i2,i1,1
+			UML_SHL(block, uml::I2, uml::I2, 1);                                        // shl     i2,i2,1
+			UML_AND(block, uml::I2, uml::I2, uml::I0);                                  // and     i2,i2,i0
+			UML_ADD(block, uml::I0, uml::I0, uml::I2);                                  // add     i0,i0,i2
+			UML_AND(block, uml::I0, uml::I0, ~1);                                       // and     i0,i0,~1
+		}
+		else
+		{
+			UML_AND(block, uml::I0, uml::I0, ~1);                                       // and     i0,i0,~1
+			UML_MOV(block, uml::I1, 1);                                                 // mov     i1,1
+		}
 	}
-
-	/* otherwise, unless this is a virtual no-op, it's a regular instruction */
-	else if (!(desc->flags & OPFLAG_VIRTUAL_NOOP))
+	else
 	{
-		/* compile the instruction */
-		if (!generate_opcode(block, compiler, desc))
+		if (exchange)
 		{
-			UML_MOV(block, uml::mem(&R15), desc->pc);                            // mov     R15,desc->pc
-			UML_MOV(block, uml::mem(&m_impstate.arg0), desc->opptr.l[0]);    // mov     [arg0],desc->opptr.l
-			//UML_CALLC(block, cfunc_unimplemented, arm);                     // callc   cfunc_unimplemented // TODO FIXME
+			/* an ARM target must be word aligned */
+			UML_AND(block, uml::I1, uml::I0, 1);                                        // and     i1,i0,1
+			UML_AND(block, uml::I2, uml::I0, 3);                                        // and     i2,i0,3
+			UML_CMP(block, uml::I2, 2);                                                 // cmp     i2,2
+			UML_EXHc(block, uml::COND_E, *m_impstate.interpret, desc->pc);              // exh     interpret,pc,E
+			UML_AND(block, uml::I0, uml::I0, ~1);                                       // and     i0,i0,~1
+		}
+		else
+		{
+			UML_TEST(block, uml::I0, 3);                                                // test    i0,3
+			UML_EXHc(block, uml::COND_NZ, *m_impstate.interpret, desc->pc);             // exh     interpret,pc,NZ
+			UML_MOV(block, uml::I1, 0);                                                 // mov     i1,0
 		}
 	}
 }
 
 
-/*------------------------------------------------------------------
-    generate_delay_slot_and_branch
-------------------------------------------------------------------*/
+/*-------------------------------------------------
+    generate_indirect_branch - generate a branch
+    to the PC in I0, switching to the mode whose
+    Thumb bit is in I1 if exchanging
+-------------------------------------------------*/
 
-void arm7_cpu_device::generate_delay_slot_and_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint8_t linkreg)
+void arm7_cpu_device::generate_indirect_branch(drcuml_block &block, compiler_state &compiler, bool exchange)
 {
 	compiler_state compiler_temp(compiler);
 
-	/* update the cycles and jump through the hash table to the target */
-	if (desc->targetpc != BRANCH_TARGET_DYNAMIC)
+	if (exchange)
 	{
-		generate_update_cycles(block, compiler_temp, desc->targetpc);   // <subtract cycles>
-		UML_HASHJMP(block, 0, desc->targetpc, *m_impstate.nocode);
-																					// hashjmp 0,desc->targetpc,nocode
+		UML_ROLINS(block, DRC_CPSR, uml::I1, T_BIT, T_MASK);                            // rolins  [cpsr],i1,T_BIT,T_MASK
+		UML_ROLINS(block, DRC_MODE, uml::I1, 0, ARM7_DRC_MODE_THUMB);                   // rolins  [mode],i1,0,THUMB
 	}
+	UML_MOV(block, DRC_JMPDEST, uml::I0);                                               // mov     [jmpdest],i0
+
+	generate_update_cycles(block, compiler_temp, DRC_JMPDEST);                          // <subtract cycles>
+	if (exchange)
+		UML_HASHJMP(block, DRC_MODE, DRC_JMPDEST, *m_impstate.nocode);                  // hashjmp [mode],[jmpdest],nocode
 	else
-	{
-		generate_update_cycles(block, compiler_temp, uml::mem(&m_impstate.jmpdest));
-																					// <subtract cycles>
-		UML_HASHJMP(block, 0, uml::mem(&m_impstate.jmpdest), *m_impstate.nocode);// hashjmp 0,<rsreg>,nocode
-	}
+		UML_HASHJMP(block, compiler.mode, DRC_JMPDEST, *m_impstate.nocode);             // hashjmp <mode>,[jmpdest],nocode
 
 	/* update the label */
 	compiler.labelnum = compiler_temp.labelnum;
-
-	/* reset the mapvar to the current cycles and account for skipped slots */
-	compiler.cycles += desc->skipslots;
-	UML_MAPVAR(block, MAPVAR_CYCLES, compiler.cycles);                             // mapvar  CYCLES,compiler.cycles
 }
 
 
-const arm7_cpu_device::drcarm7ops_ophandler arm7_cpu_device::drcops_handler[0x10] =
-{
-	&arm7_cpu_device::drcarm7ops_0123, &arm7_cpu_device::drcarm7ops_0123, &arm7_cpu_device::drcarm7ops_0123, &arm7_cpu_device::drcarm7ops_0123,
-	&arm7_cpu_device::drcarm7ops_4567, &arm7_cpu_device::drcarm7ops_4567, &arm7_cpu_device::drcarm7ops_4567, &arm7_cpu_device::drcarm7ops_4567,
-	&arm7_cpu_device::drcarm7ops_89,   &arm7_cpu_device::drcarm7ops_89,   &arm7_cpu_device::drcarm7ops_ab,   &arm7_cpu_device::drcarm7ops_ab,
-	&arm7_cpu_device::drcarm7ops_cd,   &arm7_cpu_device::drcarm7ops_cd,   &arm7_cpu_device::drcarm7ops_e,    &arm7_cpu_device::drcarm7ops_f,
-};
+/*-------------------------------------------------
+    generate_condition - generate code leaving 1
+    in I5 if the condition passes and 0 if it
+    fails, refunding the given cycles on failure
+-------------------------------------------------*/
 
-void arm7_cpu_device::saturate_qbit_overflow(drcuml_block &block)
+void arm7_cpu_device::generate_condition(drcuml_block &block, uint32_t cond, uint32_t refund)
 {
-	UML_MOV(block, uml::I1, 0);
-	UML_DCMP(block, uml::I0, 0x000000007fffffffL);
-	UML_MOVc(block, uml::COND_G, uml::I1, Q_MASK);
-	UML_MOVc(block, uml::COND_G, uml::I0, 0x7fffffff);
-	UML_DCMP(block, uml::I0, 0xffffffff80000000ULL);
-	UML_MOVc(block, uml::COND_L, uml::I1, Q_MASK);
-	UML_MOVc(block, uml::COND_L, uml::I0, 0x80000000);
-	UML_OR(block, DRC_CPSR, DRC_CPSR, uml::I1);
+	/* look the NZCV nibble up in a mask of the values that pass */
+	UML_ROLAND(block, uml::I5, DRC_CPSR, 4, 0xf);                                       // roland  i5,[cpsr],4,0xf
+	UML_SHR(block, uml::I5, cond_pass_mask(cond), uml::I5);                             // shr     i5,mask,i5
+	UML_AND(block, uml::I5, uml::I5, 1);                                                // and     i5,i5,1
+
+	/* an instruction that is skipped only takes 1 cycle */
+	if (refund != 0)
+	{
+		UML_SUB(block, uml::I6, uml::I5, 1);                                            // sub     i6,i5,1
+		UML_AND(block, uml::I6, uml::I6, refund);                                       // and     i6,i6,refund
+		UML_ADD(block, DRC_ICOUNT, DRC_ICOUNT, uml::I6);                                // add     [icount],[icount],i6
+	}
 }
 
-bool arm7_cpu_device::drcarm7ops_0123(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t insn)
+
+/*-------------------------------------------------
+    generate_shift - generate code for a shift by
+    an immediate, leaving the result in I2 and,
+    if asked for, the shifter carry in I3 in the
+    position of the C flag
+-------------------------------------------------*/
+
+void arm7_cpu_device::generate_shift(drcuml_block &block, uml::parameter src, uint32_t type, uint32_t amount, bool carry)
 {
-	uml::code_label done;
-	/* Branch and Exchange (BX) */
-	if ((insn & 0x0ffffff0) == 0x012fff10)     // bits 27-4 == 000100101111111111110001
+	switch (type)
 	{
-		UML_MOV(block, DRC_PC, DRC_REG(insn & 0x0f));
-		UML_TEST(block, DRC_PC, 1);
-		UML_JMPc(block, uml::COND_Z, done = compiler.labelnum++);
-		UML_OR(block, DRC_CPSR, DRC_CPSR, T_MASK);
-		UML_AND(block, DRC_PC, DRC_PC, ~1);
+		case 0: /* LSL */
+			if (amount == 0)
+			{
+				UML_MOV(block, uml::I2, src);                                           // mov     i2,src
+				if (carry)
+					UML_AND(block, uml::I3, DRC_CPSR, C_MASK);                          // and     i3,[cpsr],C_MASK
+			}
+			else
+			{
+				UML_SHL(block, uml::I2, src, amount);                                   // shl     i2,src,amount
+				if (carry)
+					UML_ROLAND(block, uml::I3, src, (amount - 3) & 31, C_MASK);         // roland  i3,src,amount-3,C_MASK
+			}
+			break;
+
+		case 1: /* LSR; 0 means 32 */
+			if (amount == 0)
+			{
+				UML_MOV(block, uml::I2, 0);                                             // mov     i2,0
+				if (carry)
+					UML_ROLAND(block, uml::I3, src, 30, C_MASK);                        // roland  i3,src,30,C_MASK
+			}
+			else
+			{
+				UML_SHR(block, uml::I2, src, amount);                                   // shr     i2,src,amount
+				if (carry)
+					UML_ROLAND(block, uml::I3, src, (30 - amount) & 31, C_MASK);        // roland  i3,src,30-amount,C_MASK
+			}
+			break;
+
+		case 2: /* ASR; 0 means 32 */
+			if (amount == 0)
+			{
+				UML_SAR(block, uml::I2, src, 31);                                       // sar     i2,src,31
+				if (carry)
+					UML_ROLAND(block, uml::I3, src, 30, C_MASK);                        // roland  i3,src,30,C_MASK
+			}
+			else
+			{
+				UML_SAR(block, uml::I2, src, amount);                                   // sar     i2,src,amount
+				if (carry)
+					UML_ROLAND(block, uml::I3, src, (30 - amount) & 31, C_MASK);        // roland  i3,src,30-amount,C_MASK
+			}
+			break;
+
+		default: /* ROR; 0 means RRX */
+			if (amount == 0)
+			{
+				UML_SHR(block, uml::I2, src, 1);                                        // shr     i2,src,1
+				UML_ROLAND(block, uml::I6, DRC_CPSR, 2, 0x80000000);                    // roland  i6,[cpsr],2,0x80000000
+				UML_OR(block, uml::I2, uml::I2, uml::I6);                               // or      i2,i2,i6
+				if (carry)
+					UML_ROLAND(block, uml::I3, src, 29, C_MASK);                        // roland  i3,src,29,C_MASK
+			}
+			else
+			{
+				UML_ROR(block, uml::I2, src, amount);                                   // ror     i2,src,amount
+				if (carry)
+					UML_ROLAND(block, uml::I3, src, (30 - amount) & 31, C_MASK);        // roland  i3,src,30-amount,C_MASK
+			}
+			break;
 	}
-	else if ((insn & 0x0ff000f0) == 0x01600010) // CLZ - v5
+}
+
+
+/*-------------------------------------------------
+    generate_arith_flags - generate code building
+    the new CPSR in I4 from the flags of the
+    arithmetic operation just generated
+-------------------------------------------------*/
+
+void arm7_cpu_device::generate_arith_flags(drcuml_block &block, bool subtract)
+{
+	const uint32_t *table = subtract ? m_impstate.state->sub_flags : m_impstate.state->add_flags;
+
+	UML_GETFLGS(block, uml::I4, uml::FLAG_C | uml::FLAG_V | uml::FLAG_Z | uml::FLAG_S);    // getflgs i4,CVZS
+	UML_LOAD(block, uml::I4, table, uml::I4, uml::SIZE_DWORD, uml::SCALE_x4);           // load    i4,table,i4,dword
+	UML_AND(block, uml::I6, DRC_CPSR, ~(N_MASK | Z_MASK | C_MASK | V_MASK));            // and     i6,[cpsr],~NZCV
+	UML_OR(block, uml::I4, uml::I4, uml::I6);                                           // or      i4,i4,i6
+}
+
+
+/*-------------------------------------------------
+    generate_logical_flags - generate code building
+    the new CPSR in I4 from the flags of the
+    logical operation just generated, taking C
+    from I3 if asked for
+-------------------------------------------------*/
+
+void arm7_cpu_device::generate_logical_flags(drcuml_block &block, bool carry)
+{
+	UML_GETFLGS(block, uml::I4, uml::FLAG_Z | uml::FLAG_S);                             // getflgs i4,ZS
+	UML_LOAD(block, uml::I4, m_impstate.state->add_flags, uml::I4, uml::SIZE_DWORD, uml::SCALE_x4);    // load    i4,add_flags,i4,dword
+	UML_AND(block, uml::I6, DRC_CPSR, ~(N_MASK | Z_MASK | (carry ? C_MASK : 0)));       // and     i6,[cpsr],~NZ(C)
+	UML_OR(block, uml::I4, uml::I4, uml::I6);                                           // or      i4,i4,i6
+	if (carry)
+		UML_OR(block, uml::I4, uml::I4, uml::I3);                                       // or      i4,i4,i3
+}
+
+
+/*-------------------------------------------------
+    generate_read - generate a read of the given
+    size through the memory callbacks, leaving
+    the data in [arg1]
+-------------------------------------------------*/
+
+void arm7_cpu_device::generate_read(drcuml_block &block, const opcode_desc *desc, uml::parameter address, int size)
+{
+	UML_MOV(block, DRC_ARG0, address);                                                  // mov     [arg0],address
+	UML_CALLC(block, (size == 1) ? cfunc_read8 : (size == 2) ? cfunc_read16 : cfunc_read32, this);    // callc   read
+	UML_TEST(block, DRC_FAULT, 1);                                                      // test    [fault],1
+	UML_EXHc(block, uml::COND_NZ, *m_impstate.interpret, desc->pc);                     // exh     interpret,pc,NZ
+}
+
+
+/*-------------------------------------------------
+    generate_write - generate a write of the given
+    size through the memory callbacks
+-------------------------------------------------*/
+
+void arm7_cpu_device::generate_write(drcuml_block &block, const opcode_desc *desc, uml::parameter address, uml::parameter data, int size)
+{
+	UML_MOV(block, DRC_ARG0, address);                                                  // mov     [arg0],address
+	UML_MOV(block, DRC_ARG1, data);                                                     // mov     [arg1],data
+	UML_CALLC(block, (size == 1) ? cfunc_write8 : (size == 2) ? cfunc_write16 : cfunc_write32, this); // callc   write
+	UML_TEST(block, DRC_FAULT, 1);                                                      // test    [fault],1
+	UML_EXHc(block, uml::COND_NZ, *m_impstate.interpret, desc->pc);                     // exh     interpret,pc,NZ
+}
+
+
+/*-------------------------------------------------
+    generate_load_store - generate a transfer
+    between reg and the address in I1; type
+    follows the Thumb register offset encoding
+    (STR, STRH, STRB, LDRSB, LDR, LDRH, LDRB,
+    LDRSH)
+-------------------------------------------------*/
+
+void arm7_cpu_device::generate_load_store(drcuml_block &block, const opcode_desc *desc, uint32_t type, uml::parameter reg)
+{
+	switch (type)
 	{
-		uint32_t rm = insn&0xf;
-		uint32_t rd = (insn>>12)&0xf;
+		case 0: /* STR */
+			generate_write(block, desc, uml::I1, reg, 4);
+			break;
+
+		case 1: /* STRH */
+			generate_write(block, desc, uml::I1, reg, 2);
+			break;
+
+		case 2: /* STRB */
+			generate_write(block, desc, uml::I1, reg, 1);
+			break;
+
+		case 3: /* LDRSB */
+			generate_read(block, desc, uml::I1, 1);
+			UML_SEXT(block, reg, DRC_ARG1, uml::SIZE_BYTE);                             // sext    reg,[arg1],byte
+			break;
+
+		case 4: /* LDR */
+			generate_read(block, desc, uml::I1, 4);
+			UML_MOV(block, reg, DRC_ARG1);                                              // mov     reg,[arg1]
+			break;
+
+		case 5: /* LDRH */
+			generate_read(block, desc, uml::I1, 2);
+			UML_MOV(block, reg, DRC_ARG1);                                              // mov     reg,[arg1]
+			break;
 
-		UML_LZCNT(block, DRC_REG(rd), DRC_REG(rm));
-		UML_ADD(block, DRC_PC, DRC_PC, 4);
+		case 6: /* LDRB */
+			generate_read(block, desc, uml::I1, 1);
+			UML_MOV(block, reg, DRC_ARG1);                                              // mov     reg,[arg1]
+			break;
+
+		default: /* LDRSH; an odd address only yields the high byte before v5 */
+			UML_AND(block, uml::I0, uml::I1, ~1);                                       // and     i0,i1,~1
+			generate_read(block, desc, uml::I0, 2);
+			UML_SEXT(block, uml::I0, DRC_ARG1, uml::SIZE_WORD);                         // sext    i0,[arg1],word
+			if (m_archRev < 5)
+			{
+				UML_SAR(block, uml::I2, uml::I0, 8);                                    // sar     i2,i0,8
+				UML_TEST(block, uml::I1, 1);                                            // test    i1,1
+				UML_MOVc(block, uml::COND_NZ, uml::I0, uml::I2);                        // mov     i0,i2,NZ
+			}
+			UML_MOV(block, reg, uml::I0);                                               // mov     reg,i0
+			break;
 	}
-	else if ((insn & 0x0ff000f0) == 0x01000050) // QADD - v5
+}
+
+
+/*-------------------------------------------------
+    drc_reg - return the parameter for reading a
+    register, with the PC reading as pcvalue
+-------------------------------------------------*/
+
+uml::parameter arm7_cpu_device::drc_reg(uint32_t regnum, uint32_t pcvalue)
+{
+	if (regnum == eR15)
+		return uml::parameter(pcvalue);
+	return DRC_REG(regnum);
+}
+
+
+/*-------------------------------------------------
+    generate_opcode - generate code for a specific
+    opcode
+-------------------------------------------------*/
+
+bool arm7_cpu_device::generate_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	if (compiler.mode & ARM7_DRC_MODE_THUMB)
+		return generate_thumb(block, compiler, desc, desc->opptr.w[0]);
+	return generate_arm(block, compiler, desc, desc->opptr.l[0]);
+}
+
+
+/*-------------------------------------------------
+    generate_arm - generate code for an ARM
+    instruction
+-------------------------------------------------*/
+
+bool arm7_cpu_device::generate_arm(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op)
+{
+	const uint32_t cond = op >> INSN_COND_SHIFT;
+
+	/* NV never executes; the front-end only lets it through before v5 */
+	if (cond == COND_NV)
+		return true;
+
+	/* a skipped instruction pays 1 cycle instead of its full count */
+	const bool conditional = (cond != COND_AL);
+	if (conditional)
+		generate_condition(block, cond, desc->cycles - 1);
+
+	switch ((op >> 25) & 7)
 	{
-		uint32_t rm = insn&0xf;
-		uint32_t rn = (insn>>16)&0xf;
-		uint32_t rd = (insn>>12)&0xf;
-		UML_DSEXT(block, uml::I0, DRC_REG(rm), uml::SIZE_DWORD);
-		UML_DSEXT(block, uml::I1, DRC_REG(rn), uml::SIZE_DWORD);
-		UML_DADD(block, uml::I0, uml::I0, uml::I1);
-		saturate_qbit_overflow(block);
-		UML_MOV(block, DRC_REG(rd), uml::I0);
-		UML_ADD(block, DRC_PC, DRC_PC, 4);
+		case 0: case 1:
+			if ((op & 0x0ffffff0) == 0x012fff10 || (op & 0x0ff000f0) == 0x01200030)
+				return generate_arm_bx(block, compiler, desc, op, conditional);
+			if (!(op & INSN_I) && (op & 0x90) == 0x90)
+			{
+				if (op & 0x60)
+					return generate_arm_halfword(block, compiler, desc, op, conditional);
+				return generate_arm_mul(block, compiler, desc, op, conditional);
+			}
+			return generate_arm_alu(block, compiler, desc, op, conditional);
+
+		case 2: case 3:
+			return generate_arm_single(block, compiler, desc, op, conditional);
+
+		case 4:
+			return generate_arm_block(block, compiler, desc, op, conditional);
+
+		case 5:
+			return generate_arm_branch(block, compiler, desc, op, conditional);
+
+		default:
+			return false;
 	}
-	else if ((insn & 0x0ff000f0) == 0x01400050) // QDADD - v5
+}
+
+
+/*-------------------------------------------------
+    generate_arm_bx - generate code for BX and
+    BLX by register
+-------------------------------------------------*/
+
+bool arm7_cpu_device::generate_arm_bx(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op, bool conditional)
+{
+	const uml::code_label skip = compiler.labelnum++;
+
+	if (conditional)
 	{
-		uint32_t rm = insn&0xf;
-		uint32_t rn = (insn>>16)&0xf;
-		uint32_t rd = (insn>>12)&0xf;
-
-		UML_DSEXT(block, uml::I1, DRC_REG(rn), uml::SIZE_DWORD);
-		UML_DADD(block, uml::I0, uml::I1, uml::I1);
-		saturate_qbit_overflow(block);
-
-		UML_DSEXT(block, uml::I0, DRC_REG(rm), uml::SIZE_DWORD);
-		UML_DSEXT(block, uml::I1, DRC_REG(rn), uml::SIZE_DWORD);
-		UML_DADD(block, uml::I1, uml::I1, uml::I1);
-		UML_DADD(block, uml::I0, uml::I0, uml::I1);
-		saturate_qbit_overflow(block);
-		UML_MOV(block, DRC_REG(rd), uml::I0);
-
-		UML_ADD(block, DRC_PC, DRC_PC, 4);
+		UML_TEST(block, uml::I5, 1);                                                    // test    i5,1
+		UML_JMPc(block, uml::COND_Z, skip);                                             // jmp     skip,Z
 	}
-	else if ((insn & 0x0ff000f0) == 0x01200050) // QSUB - v5
+
+	UML_MOV(block, uml::I0, DRC_REG(op & INSN_OP2_RM));                                 // mov     i0,[rm]
+	generate_exchange(block, compiler, desc, true);
+	if (op & 0x20)
+		UML_MOV(block, DRC_REG(eR14), desc->pc + 4);                                    // mov     [r14],pc+4
+	generate_indirect_branch(block, compiler, true);
+
+	if (conditional)
+		UML_LABEL(block, skip);                                                         // skip:
+	return true;
+}
+
+
+/*-------------------------------------------------
+    generate_arm_alu - generate code for a data
+    processing instruction with an immediate or
+    an immediate-shifted register operand
+-------------------------------------------------*/
+
+bool arm7_cpu_device::generate_arm_alu(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op, bool conditional)
+{
+	const uint32_t opcode = (op & INSN_OPCODE) >> INSN_OPCODE_SHIFT;
+	const uint32_t rd = (op & INSN_RD) >> INSN_RD_SHIFT;
+	const uint32_t rn = (op & INSN_RN) >> INSN_RN_SHIFT;
+	const bool setflags = (op & INSN_S) && rd != eR15;
+	const bool logical = (opcode & 6) == 0 || opcode >= OPCODE_ORR;
+	const bool test = (opcode & 0xc) == 0x8;
+	const uml::parameter src1 = drc_reg(rn, desc->pc + 8);
+
+	/* the second operand goes in I2, and the shifter carry in I3 */
+	if (op & INSN_I)
 	{
-		uint32_t rm = insn&0xf;
-		uint32_t rn = (insn>>16)&0xf;
-		uint32_t rd = (insn>>12)&0xf;
-
-		UML_DSEXT(block, uml::I0, DRC_REG(rm), uml::SIZE_DWORD);
-		UML_DSEXT(block, uml::I1, DRC_REG(rn), uml::SIZE_DWORD);
-		UML_DSUB(block, uml::I0, uml::I0, uml::I1);
-		saturate_qbit_overflow(block);
-		UML_MOV(block, DRC_REG(rd), uml::I0);
-		UML_ADD(block, DRC_PC, DRC_PC, 4);
+		const uint32_t rotate = ((op & INSN_OP2_ROTATE) >> INSN_OP2_ROTATE_SHIFT) << 1;
+		const uint32_t imm = rotr_32(op & INSN_OP2_IMM, rotate);
+		UML_MOV(block, uml::I2, imm);                                                   // mov     i2,imm
+		if (setflags && logical)
+		{
+			if (rotate != 0)
+				UML_MOV(block, uml::I3, (imm & 0x80000000) ? C_MASK : 0);              // mov     i3,carry
+			else
+				UML_AND(block, uml::I3, DRC_CPSR, C_MASK);                              // and     i3,[cpsr],C_MASK
+		}
 	}
-	else if ((insn & 0x0ff000f0) == 0x01600050) // QDSUB - v5
+	else
 	{
-		uint32_t rm = insn&0xf;
-		uint32_t rn = (insn>>16)&0xf;
-		uint32_t rd = (insn>>12)&0xf;
-
-		UML_DSEXT(block, uml::I1, DRC_REG(rn), uml::SIZE_DWORD);
-		UML_DADD(block, uml::I0, uml::I1, uml::I1);
-		saturate_qbit_overflow(block);
-
-		UML_DSEXT(block, uml::I0, DRC_REG(rm), uml::SIZE_DWORD);
-		UML_DSEXT(block, uml::I1, DRC_REG(rn), uml::SIZE_DWORD);
-		UML_DADD(block, uml::I1, uml::I1, uml::I1);
-		UML_DSUB(block, uml::I0, uml::I0, uml::I1);
-		saturate_qbit_overflow(block);
-		UML_MOV(block, DRC_REG(rd), uml::I0);
-
-		UML_ADD(block, DRC_PC, DRC_PC, 4);
+		const uint32_t amount = (op & INSN_OP2_SHIFT) >> INSN_OP2_SHIFT_SHIFT;
+		const uint32_t type = (op & INSN_OP2_SHIFT_TYPE) >> (INSN_OP2_SHIFT_TYPE_SHIFT + 1);
+		generate_shift(block, drc_reg(op & INSN_OP2_RM, desc->pc + 8), type, amount, setflags && logical);
 	}
-	else if ((insn & 0x0ff00090) == 0x01000080) // SMLAxy - v5
+
+	switch (opcode)
 	{
-		uint32_t rm = insn&0xf;
-		uint32_t rn = (insn>>8)&0xf;
-		uint32_t rd = (insn>>16)&0xf;
-		uint32_t ra = (insn>>12)&0xf;
+		case OPCODE_AND:
+		case OPCODE_TST:
+			UML_AND(block, uml::I0, src1, uml::I2);                                     // and     i0,rn,i2
+			break;
 
-		UML_MOV(block, uml::I0, DRC_REG(rm));
-		UML_MOV(block, uml::I1, DRC_REG(rn));
+		case OPCODE_EOR:
+		case OPCODE_TEQ:
+			UML_XOR(block, uml::I0, src1, uml::I2);                                     // xor     i0,rn,i2
+			break;
 
-		// select top and bottom halves of src1/src2 and sign extend if necessary
-		if (insn & 0x20)
-		{
-			UML_SHR(block, uml::I0, uml::I0, 16);
-		}
-		UML_SEXT(block, uml::I0, uml::I0, uml::SIZE_WORD);
+		case OPCODE_SUB:
+		case OPCODE_CMP:
+			UML_SUB(block, uml::I0, src1, uml::I2);                                     // sub     i0,rn,i2
+			break;
+
+		case OPCODE_RSB:
+			UML_SUB(block, uml::I0, uml::I2, src1);                                     // sub     i0,i2,rn
+			break;
+
+		case OPCODE_ADD:
+		case OPCODE_CMN:
+			UML_ADD(block, uml::I0, src1, uml::I2);                                     // add     i0,rn,i2
+			break;
+
+		case OPCODE_ADC:
+			UML_CARRY(block, DRC_CPSR, C_BIT);                                          // carry   [cpsr],C_BIT
+			UML_ADDC(block, uml::I0, src1, uml::I2);                                    // addc    i0,rn,i2
+			break;
+
+		case OPCODE_SBC:
+			UML_XOR(block, uml::I6, DRC_CPSR, C_MASK);                                  // xor     i6,[cpsr],C_MASK
+			UML_CARRY(block, uml::I6, C_BIT);                                           // carry   i6,C_BIT
+			UML_SUBB(block, uml::I0, src1, uml::I2);                                    // subb    i0,rn,i2
+			break;
+
+		case OPCODE_RSC:
+			UML_XOR(block, uml::I6, DRC_CPSR, C_MASK);                                  // xor     i6,[cpsr],C_MASK
+			UML_CARRY(block, uml::I6, C_BIT);                                           // carry   i6,C_BIT
+			UML_SUBB(block, uml::I0, uml::I2, src1);                                    // subb    i0,i2,rn
+			break;
+
+		case OPCODE_ORR:
+			UML_OR(block, uml::I0, src1, uml::I2);                                      // or      i0,rn,i2
+			break;
 
-		if (insn & 0x40)
+		case OPCODE_MOV:
+			UML_MOV(block, uml::I0, uml::I2);                                           // mov     i0,i2
+			if (setflags)
+				UML_TEST(block, uml::I0, uml::I0);                                      // test    i0,i0
+			break;
+
+		case OPCODE_BIC:
+			UML_XOR(block, uml::I2, uml::I2, ~0);                                       // xor     i2,i2,~0
+			UML_AND(block, uml::I0, src1, uml::I2);                                     // and     i0,rn,i2
+			break;
+
+		case OPCODE_MVN:
+			UML_XOR(block, uml::I0, uml::I2, ~0);                                       // xor     i0,i2,~0
+			break;
+	}
+
+	/* a write to the PC is an indirect branch that stays in ARM state */
+	if (rd == eR15)
+	{
+		const uml::code_label skip = compiler.labelnum++;
+		if (conditional)
 		{
-			UML_SHR(block, uml::I1, uml::I1, 16);
+			UML_TEST(block, uml::I5, 1);                                                // test    i5,1
+			UML_JMPc(block, uml::COND_Z, skip);                                         // jmp     skip,Z
 		}
-		UML_SEXT(block, uml::I0, uml::I0, uml::SIZE_WORD);
-
-		// do the signed multiply
-		UML_MULS(block, uml::I0, uml::I1, uml::I0, uml::I1);
-		UML_DSHL(block, uml::I0, uml::I0, 32);
-		UML_DOR(block, uml::I0, uml::I0, uml::I1);
-		UML_MOV(block, uml::I1, DRC_REG(ra));
-		UML_DADD(block, uml::I0, uml::I0, uml::I1);
-		// and the accumulate.  NOTE: only the accumulate can cause an overflow, which is why we do it this way.
-		saturate_qbit_overflow(block);
-		UML_MOV(block, DRC_REG(rd), uml::I0);
-		UML_ADD(block, DRC_PC, DRC_PC, 4);
+		generate_exchange(block, compiler, desc, false);
+		generate_indirect_branch(block, compiler, false);
+		if (conditional)
+			UML_LABEL(block, skip);                                                     // skip:
+		return true;
 	}
-	else if ((insn & 0x0ff00090) == 0x01400080) // SMLALxy - v5
+
+	if (setflags)
 	{
-		uint32_t rm = insn&0xf;
-		uint32_t rn = (insn>>8)&0xf;
-		uint32_t rdh = (insn>>16)&0xf;
-		uint32_t rdl = (insn>>12)&0xf;
-
-		UML_DSEXT(block, uml::I0, DRC_REG(rm), uml::SIZE_DWORD);
-		UML_DSEXT(block, uml::I1, DRC_REG(rn), uml::SIZE_DWORD);
-		// do the signed multiply
-		UML_DMULS(block, uml::I2, uml::I3, uml::I0, uml::I1);
-
-		UML_MOV(block, uml::I0, DRC_REG(rdh));
-		UML_MOV(block, uml::I1, DRC_REG(rdl));
-		UML_DSHL(block, uml::I0, uml::I0, 32);
-		UML_DOR(block, uml::I0, uml::I0, uml::I1);
-		UML_DADD(block, uml::I0, uml::I0, uml::I2);
-		UML_MOV(block, DRC_REG(rdl), uml::I0);
-		UML_DSHR(block, uml::I0, uml::I0, 32);
-		UML_MOV(block, DRC_REG(rdh), uml::I0);
+		if (logical)
+			generate_logical_flags(block, true);
+		else
+			generate_arith_flags(block, opcode != OPCODE_ADD && opcode != OPCODE_ADC && opcode != OPCODE_CMN);
 	}
-	else if ((insn & 0x0ff00090) == 0x01600080) // SMULxy - v5
+
+	/* commit the results */
+	if (conditional)
 	{
-		int32_t src1 = GetRegister(insn&0xf);
-		int32_t src2 = GetRegister((insn>>8)&0xf);
-		int32_t res;
+		UML_TEST(block, uml::I5, 1);                                                    // test    i5,1
+		if (!test)
+			UML_MOVc(block, uml::COND_NZ, DRC_REG(rd), uml::I0);                        // mov     [rd],i0,NZ
+		if (setflags)
+			UML_MOVc(block, uml::COND_NZ, DRC_CPSR, uml::I4);                           // mov     [cpsr],i4,NZ
+	}
+	else
+	{
+		if (!test)
+			UML_MOV(block, DRC_REG(rd), uml::I0);                                       // mov     [rd],i0
+		if (setflags)
+			UML_MOV(block, DRC_CPSR, uml::I4);                                          // mov     [cpsr],i4
+	}
+	return true;
+}
 
-		// select top and bottom halves of src1/src2 and sign extend if necessary
-		if (insn & 0x20)
-		{
-			src1 >>= 16;
-		}
 
-		src1 &= 0xffff;
-		if (src1 & 0x8000)
-		{
-			src1 |= 0xffff0000;
-		}
+/*-------------------------------------------------
+    generate_arm_mul - generate code for MUL and
+    MLA
+-------------------------------------------------*/
 
-		if (insn & 0x40)
-		{
-			src2 >>= 16;
-		}
+bool arm7_cpu_device::generate_arm_mul(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op, bool conditional)
+{
+	const uint32_t rd = (op & INSN_MUL_RD) >> INSN_MUL_RD_SHIFT;
+	const uint32_t rn = (op & INSN_MUL_RN) >> INSN_MUL_RN_SHIFT;
+	const uint32_t rs = (op & INSN_MUL_RS) >> INSN_MUL_RS_SHIFT;
+	const uint32_t rm = op & INSN_MUL_RM;
+
+	UML_MULU(block, uml::I0, uml::I0, DRC_REG(rm), DRC_REG(rs));                        // mulu    i0,i0,[rm],[rs]
+	if (op & INSN_MUL_A)
+		UML_ADD(block, uml::I0, uml::I0, DRC_REG(rn));                                  // add     i0,i0,[rn]
+	if (op & INSN_S)
+	{
+		UML_TEST(block, uml::I0, uml::I0);                                              // test    i0,i0
+		generate_logical_flags(block, false);
+	}
 
-		src2 &= 0xffff;
-		if (src2 & 0x8000)
-		{
-			src2 |= 0xffff0000;
-		}
+	/* the multiplier array takes one cycle for each significant byte of |Rs| */
+	UML_MOV(block, uml::I1, DRC_REG(rs));                                               // mov     i1,[rs]
+	UML_SAR(block, uml::I2, uml::I1, 31);                                               // sar     i2,i1,31
+	UML_XOR(block, uml::I1, uml::I1, uml::I2);                                          // xor     i1,i1,i2
+	UML_SUB(block, uml::I1, uml::I1, uml::I2);                                          // sub     i1,i1,i2
+	UML_MOV(block, uml::I3, 1);                                                         // mov     i3,1
+	for (uint32_t limit : { 0x100U, 0x10000U, 0x1000000U })
+	{
+		UML_CMP(block, uml::I1, limit);                                                 // cmp     i1,limit
+		UML_SETc(block, uml::COND_AE, uml::I2);                                         // set     i2,AE
+		UML_ADD(block, uml::I3, uml::I3, uml::I2);                                      // add     i3,i3,i2
+	}
+	if (conditional)
+	{
+		UML_SUB(block, uml::I2, 0, uml::I5);                                            // sub     i2,0,i5
+		UML_AND(block, uml::I3, uml::I3, uml::I2);                                      // and     i3,i3,i2
+	}
+	UML_SUB(block, DRC_ICOUNT, DRC_ICOUNT, uml::I3);                                    // sub     [icount],[icount],i3
 
-		res = src1 * src2;
-		SetRegister((insn>>16)&0xf, res);
-		R15 += 4;
+	/* commit the results */
+	if (conditional)
+	{
+		UML_TEST(block, uml::I5, 1);                                                    // test    i5,1
+		UML_MOVc(block, uml::COND_NZ, DRC_REG(rd), uml::I0);                            // mov     [rd],i0,NZ
+		if (op & INSN_S)
+			UML_MOVc(block, uml::COND_NZ, DRC_CPSR, uml::I4);                           // mov     [cpsr],i4,NZ
 	}
-	else if ((insn & 0x0ff000b0) == 0x012000a0) // SMULWy - v5
+	else
 	{
-		int32_t src1 = GetRegister(insn&0xf);
-		int32_t src2 = GetRegister((insn>>8)&0xf);
-		int64_t res;
+		UML_MOV(block, DRC_REG(rd), uml::I0);                                           // mov     [rd],i0
+		if (op & INSN_S)
+			UML_MOV(block, DRC_CPSR, uml::I4);                                          // mov     [cpsr],i4
+	}
+	return true;
+}
 
-		if (insn & 0x40)
-		{
-			src2 >>= 16;
-		}
+
+/*-------------------------------------------------
+    generate_arm_address - generate code for the
+    address of a single transfer into I1, and the
+    written back base into I3
+-------------------------------------------------*/
+
+void arm7_cpu_device::generate_arm_address(drcuml_block &block, const opcode_desc *desc, uint32_t op, uml::parameter offset)
+{
+	const uml::parameter base = drc_reg((op & INSN_RN) >> INSN_RN_SHIFT, desc->pc + 8);
+
+	if (op & INSN_SDT_P)
+	{
+		if (op & INSN_SDT_U)
+			UML_ADD(block, uml::I1, base, offset);                                      // add     i1,rn,offset
 		else
-		{
-			src2 &= 0xffff;
-			if (src2 & 0x8000)
-			{
-				src2 |= 0xffff;
-			}
-		}
+			UML_SUB(block, uml::I1, base, offset);                                      // sub     i1,rn,offset
+		if (op & INSN_SDT_W)
+			UML_MOV(block, uml::I3, uml::I1);                                           // mov     i3,i1
+	}
+	else
+	{
+		UML_MOV(block, uml::I1, base);                                                  // mov     i1,rn
+		if (op & INSN_SDT_U)
+			UML_ADD(block, uml::I3, base, offset);                                      // add     i3,rn,offset
+		else
+			UML_SUB(block, uml::I3, base, offset);                                      // sub     i3,rn,offset
+	}
+}
+
 
-		res = (int64_t)src1 * (int64_t)src2;
-		res >>= 16;
-		SetRegister((insn>>16)&0xf, (uint32_t)res);
+/*-------------------------------------------------
+    generate_arm_single - generate code for LDR,
+    STR, LDRB and STRB
+-------------------------------------------------*/
+
+bool arm7_cpu_device::generate_arm_single(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op, bool conditional)
+{
+	const uint32_t rd = (op & INSN_RD) >> INSN_RD_SHIFT;
+	const uint32_t rn = (op & INSN_RN) >> INSN_RN_SHIFT;
+	const bool writeback = !(op & INSN_SDT_P) || (op & INSN_SDT_W);
+	const uml::code_label skip = compiler.labelnum++;
+
+	if (conditional)
+	{
+		UML_TEST(block, uml::I5, 1);                                                    // test    i5,1
+		UML_JMPc(block, uml::COND_Z, skip);                                             // jmp     skip,Z
 	}
-	else if ((insn & 0x0ff000b0) == 0x01200080) // SMLAWy - v5
+
+	/* the offset is an immediate, or a register shifted by an immediate */
+	if (op & INSN_I)
 	{
-		int32_t src1 = GetRegister(insn&0xf);
-		int32_t src2 = GetRegister((insn>>8)&0xf);
-		int32_t src3 = GetRegister((insn>>12)&0xf);
-		int64_t res;
+		const uint32_t amount = (op & INSN_OP2_SHIFT) >> INSN_OP2_SHIFT_SHIFT;
+		const uint32_t type = (op & INSN_OP2_SHIFT_TYPE) >> (INSN_OP2_SHIFT_TYPE_SHIFT + 1);
+		generate_shift(block, DRC_REG(op & INSN_OP2_RM), type, amount, false);
+		generate_arm_address(block, desc, op, uml::I2);
+	}
+	else
+		generate_arm_address(block, desc, op, op & INSN_SDT_IMM);
 
-		if (insn & 0x40)
-		{
-			src2 >>= 16;
-		}
-		else
-		{
-			src2 &= 0xffff;
-			if (src2 & 0x8000)
-			{
-				src2 |= 0xffff;
-			}
-		}
+	if (!(op & INSN_SDT_L))
+	{
+		/* a stored PC reads 12 bytes ahead */
+		generate_load_store(block, desc, (op & INSN_SDT_B) ? 2 : 0, drc_reg(rd, desc->pc + 12));
+		if (writeback)
+			UML_MOV(block, DRC_REG(rn), uml::I3);                                       // mov     [rn],i3
+	}
+	else if (rd != eR15)
+	{
+		generate_load_store(block, desc, (op & INSN_SDT_B) ? 6 : 4, DRC_REG(rd));
+		if (writeback)
+			UML_MOV(block, DRC_REG(rn), uml::I3);                                       // mov     [rn],i3
+	}
+	else
+	{
+		/* a load into the PC is a branch, which can switch to Thumb from v5 */
+		generate_read(block, desc, uml::I1, 4);
+		UML_MOV(block, uml::I0, DRC_ARG1);                                              // mov     i0,[arg1]
+		generate_exchange(block, compiler, desc, m_archRev >= 5);
+		if (writeback)
+			UML_MOV(block, DRC_REG(rn), uml::I3);                                       // mov     [rn],i3
+		generate_indirect_branch(block, compiler, m_archRev >= 5);
+	}
+
+	if (conditional)
+		UML_LABEL(block, skip);                                                         // skip:
+	return true;
+}
 
-		res = (int64_t)src1 * (int64_t)src2;
-		res >>= 16;
 
-		// check for overflow and set the Q bit
-		saturate_qbit_overflow((int64_t)src3 + res);
+/*-------------------------------------------------
+    generate_arm_halfword - generate code for the
+    halfword and signed byte transfers
+-------------------------------------------------*/
 
-		// do the real accumulate
-		src3 += (int32_t)res;
+bool arm7_cpu_device::generate_arm_halfword(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op, bool conditional)
+{
+	static const uint8_t load_types[4] = { 0, 5, 3, 7 };
+	const uint32_t rd = (op & INSN_RD) >> INSN_RD_SHIFT;
+	const uint32_t rn = (op & INSN_RN) >> INSN_RN_SHIFT;
+	const bool writeback = !(op & INSN_SDT_P) || (op & INSN_SDT_W);
+	const uml::code_label skip = compiler.labelnum++;
 
-		// write the result back
-		SetRegister((insn>>16)&0xf, (uint32_t)res);
+	if (conditional)
+	{
+		UML_TEST(block, uml::I5, 1);                                                    // test    i5,1
+		UML_JMPc(block, uml::COND_Z, skip);                                             // jmp     skip,Z
 	}
+
+	/* the offset is a split 8-bit immediate or a register */
+	if (op & 0x400000)
+		generate_arm_address(block, desc, op, ((op >> 4) & 0xf0) | (op & 0x0f));
 	else
-	/* Multiply OR Swap OR Half Word Data Transfer */
-	if ((insn & 0x0e000000) == 0 && (insn & 0x80) && (insn & 0x10))  // bits 27-25=000 bit 7=1 bit 4=1
+		generate_arm_address(block, desc, op, DRC_REG(op & 0x0f));
+
+	if (op & INSN_SDT_L)
+		generate_load_store(block, desc, load_types[(op >> 5) & 3], DRC_REG(rd));
+	else
+		generate_load_store(block, desc, 1, drc_reg(rd, desc->pc + 12));
+	if (writeback)
+		UML_MOV(block, DRC_REG(rn), uml::I3);                                           // mov     [rn],i3
+
+	if (conditional)
+		UML_LABEL(block, skip);                                                         // skip:
+	return true;
+}
+
+
+/*-------------------------------------------------
+    generate_arm_block - generate code for LDM
+    and STM without the user bank
+-------------------------------------------------*/
+
+bool arm7_cpu_device::generate_arm_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op, bool conditional)
+{
+	const uint32_t rb = (op & INSN_RN) >> INSN_RN_SHIFT;
+	const uint32_t list = op & INSN_BDT_REGS;
+	const uint32_t count = population_count_32(list);
+	const uml::code_label skip = compiler.labelnum++;
+
+	if (conditional)
 	{
-		/* Half Word Data Transfer */
-		if (insn & 0x60)         // bits = 6-5 != 00
+		UML_TEST(block, uml::I5, 1);                                                    // test    i5,1
+		UML_JMPc(block, uml::COND_Z, skip);                                             // jmp     skip,Z
+	}
+
+	/* registers are always transferred in ascending order from the lowest address */
+	uint32_t start;
+	if (op & INSN_BDT_U)
+		start = (op & INSN_BDT_P) ? 4 : 0;
+	else
+		start = -(count << 2) + ((op & INSN_BDT_P) ? 0 : 4);
+
+	if (op & INSN_BDT_L)
+	{
+		/* the base and the PC are only written once every word has been read */
+		UML_AND(block, uml::I1, DRC_REG(rb), ~3);                                       // and     i1,[rb],~3
+		if (start != 0)
+			UML_ADD(block, uml::I1, uml::I1, start);                                    // add     i1,i1,start
+		for (uint32_t regnum = 0, left = count; regnum < 16; regnum++)
 		{
-			HandleHalfWordDT(insn);
+			if (!BIT(list, regnum))
+				continue;
+			generate_read(block, desc, uml::I1, 4);
+			if (regnum == rb || regnum == eR15)
+				UML_MOV(block, DRC_TMP(regnum), DRC_ARG1);                              // mov     [tmp],[arg1]
+			else
+				UML_MOV(block, DRC_REG(regnum), DRC_ARG1);                              // mov     [reg],[arg1]
+			if (--left != 0)
+				UML_ADD(block, uml::I1, uml::I1, 4);                                    // add     i1,i1,4
 		}
-		else
-		/* Swap */
-		if (insn & 0x01000000)   // bit 24 = 1
+
+		if (BIT(list, eR15))
 		{
-			HandleSwap(insn);
+			UML_MOV(block, uml::I0, DRC_TMP(eR15));                                     // mov     i0,[tmp15]
+			generate_exchange(block, compiler, desc, m_archRev >= 5);
 		}
-		/* Multiply Or Multiply Long */
-		else
+		if (BIT(list, rb))
+			UML_MOV(block, DRC_REG(rb), DRC_TMP(rb));                                   // mov     [rb],[tmprb]
+		else if (op & INSN_BDT_W)
 		{
-			/* multiply long */
-			if (insn & 0x800000) // Bit 23 = 1 for Multiply Long
-			{
-				/* Signed? */
-				if (insn & 0x00400000)
-					HandleSMulLong(insn);
-				else
-					HandleUMulLong(insn);
-			}
-			/* multiply */
+			if (op & INSN_BDT_U)
+				UML_ADD(block, DRC_REG(rb), DRC_REG(rb), count << 2);                   // add     [rb],[rb],count*4
 			else
-			{
-				HandleMul(insn);
-			}
-			R15 += 4;
+				UML_SUB(block, DRC_REG(rb), DRC_REG(rb), count << 2);                   // sub     [rb],[rb],count*4
 		}
+		if (BIT(list, eR15))
+			generate_indirect_branch(block, compiler, m_archRev >= 5);
 	}
-	/* Data Processing OR PSR Transfer */
-	else if ((insn & 0x0c000000) == 0)   // bits 27-26 == 00 - This check can only exist properly after Multiplication check above
+	else
 	{
-		/* PSR Transfer (MRS & MSR) */
-		if (((insn & 0x00100000) == 0) && ((insn & 0x01800000) == 0x01000000)) // S bit must be clear, and bit 24,23 = 10
+		/* a stored PC reads 12 bytes ahead, and the base is stored unchanged */
+		if (start != 0)
+			UML_ADD(block, uml::I1, DRC_REG(rb), start);                                // add     i1,[rb],start
+		else
+			UML_MOV(block, uml::I1, DRC_REG(rb));                                       // mov     i1,[rb]
+		for (uint32_t regnum = 0, left = count; regnum < 16; regnum++)
 		{
-			HandlePSRTransfer(insn);
-			ARM7_ICOUNT += 2;       // PSR only takes 1 - S Cycle, so we add + 2, since at end, we -3..
-			R15 += 4;
+			if (!BIT(list, regnum))
+				continue;
+			generate_write(block, desc, uml::I1, drc_reg(regnum, desc->pc + 12), 4);
+			if (--left != 0)
+				UML_ADD(block, uml::I1, uml::I1, 4);                                    // add     i1,i1,4
 		}
-		/* Data Processing */
-		else
+		if (op & INSN_BDT_W)
 		{
-			HandleALU(insn);
+			if (op & INSN_BDT_U)
+				UML_ADD(block, DRC_REG(rb), DRC_REG(rb), count << 2);                   // add     [rb],[rb],count*4
+			else
+				UML_SUB(block, DRC_REG(rb), DRC_REG(rb), count << 2);                   // sub     [rb],[rb],count*4
 		}
 	}
 
-	UML_LABEL(block, done);
+	if (conditional)
+		UML_LABEL(block, skip);                                                         // skip:
 	return true;
 }
 
-bool arm7_cpu_device::drcarm7ops_4567(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op)
-{
-	return false;
-}
 
-bool arm7_cpu_device::drcarm7ops_89(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op)
-{
-	return false;
-}
+/*-------------------------------------------------
+    generate_arm_branch - generate code for B and
+    BL
+-------------------------------------------------*/
 
-bool arm7_cpu_device::drcarm7ops_ab(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op)
+bool arm7_cpu_device::generate_arm_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op, bool conditional)
 {
-	return false;
-}
+	const uml::code_label skip = compiler.labelnum++;
 
-bool arm7_cpu_device::drcarm7ops_cd(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op)
-{
-	return false;
-}
+	if (conditional)
+	{
+		UML_TEST(block, uml::I5, 1);                                                    // test    i5,1
+		UML_JMPc(block, uml::COND_Z, skip);                                             // jmp     skip,Z
+	}
 
-bool arm7_cpu_device::drcarm7ops_e(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op)
-{
-	return false;
-}
+	if (op & INSN_BL)
+		UML_MOV(block, DRC_REG(eR14), desc->pc + 4);                                    // mov     [r14],pc+4
+	generate_branch(block, compiler, desc->targetpc);
 
-bool arm7_cpu_device::drcarm7ops_f(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t op)
-{
-	return false;
+	if (conditional)
+		UML_LABEL(block, skip);                                                         // skip:
+	return true;
 }
 
+
 /*-------------------------------------------------
-    generate_opcode - generate code for a specific
-    opcode
+    generate_thumb - generate code for a Thumb
+    instruction
 -------------------------------------------------*/
 
-bool arm7_cpu_device::generate_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+bool arm7_cpu_device::generate_thumb(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t op)
 {
-	//int in_delay_slot = ((desc->flags & OPFLAG_IN_DELAY_SLOT) != 0);
-	uint32_t op = desc->opptr.l[0];
-	uint8_t opswitch = op >> 26;
-	uml::code_label skip;
-	uml::code_label contdecode;
-	uml::code_label unexecuted;
-
-	if (T_IS_SET(GET_CPSR))
-	{
-		// "In Thumb state, bit [0] is undefined and must be ignored. Bits [31:1] contain the PC."
-		UML_AND(block, uml::I0, DRC_PC, ~1);
-	}
-	else
+	const uint32_t pc = desc->pc;
+	const uint32_t rd = op & THUMB_ADDSUB_RD;
+	const uint32_t rs = (op & THUMB_ADDSUB_RS) >> THUMB_ADDSUB_RS_SHIFT;
+
+	switch ((op & THUMB_INSN_TYPE) >> THUMB_INSN_TYPE_SHIFT)
 	{
-		UML_AND(block, uml::I0, DRC_PC, ~3);
-	}
+		case 0x0: case 0x1:
+			if ((op & 0x1800) != 0x1800)
+			{
+				/* LSL/LSR/ASR Rd, Rs, #imm */
+				generate_shift(block, DRC_REG(rs), (op >> 11) & 3, (op & THUMB_SHIFT_AMT) >> THUMB_SHIFT_AMT_SHIFT, true);
+				UML_TEST(block, uml::I2, uml::I2);                                      // test    i2,i2
+				generate_logical_flags(block, true);
+				UML_MOV(block, DRC_REG(rd), uml::I2);                                   // mov     [rd],i2
+			}
+			else
+			{
+				/* ADD/SUB Rd, Rs, Rn or #imm */
+				const uint32_t rn = (op & THUMB_ADDSUB_RNIMM) >> THUMB_ADDSUB_RNIMM_SHIFT;
+				const uml::parameter src2 = (op & 0x0400) ? uml::parameter(rn) : DRC_REG(rn);
+				if (op & 0x0200)
+					UML_SUB(block, uml::I0, DRC_REG(rs), src2);                         // sub     i0,[rs],src2
+				else
+					UML_ADD(block, uml::I0, DRC_REG(rs), src2);                         // add     i0,[rs],src2
+				generate_arith_flags(block, op & 0x0200);
+				UML_MOV(block, DRC_REG(rd), uml::I0);                                   // mov     [rd],i0
+			}
+			UML_MOV(block, DRC_CPSR, uml::I4);                                          // mov     [cpsr],i4
+			return true;
 
-	UML_TEST(block, uml::mem(&COPRO_CTRL), COPRO_CTRL_MMU_EN);                       // test     COPRO_CTRL, COPRO_CTRL_MMU_EN
-	UML_MOVc(block, uml::COND_NZ, uml::I2, ARM7_TLB_ABORT_P | ARM7_TLB_READ);             // movnz    i0, ARM7_TLB_ABORT_P | ARM7_TLB_READ
-	UML_CALLHc(block, uml::COND_NZ, *m_impstate.tlb_translate);                  // callhnz  tlb_translate);
+		case 0x2: case 0x3:
+		{
+			/* MOV/CMP/ADD/SUB Rd, #imm */
+			const uint32_t ird = (op & THUMB_INSN_IMM_RD) >> THUMB_INSN_IMM_RD_SHIFT;
+			const uint32_t imm = op & THUMB_INSN_IMM;
+			switch ((op >> 11) & 3)
+			{
+				case 0:
+					UML_MOV(block, DRC_REG(ird), imm);                                  // mov     [rd],imm
+					UML_TEST(block, DRC_REG(ird), DRC_REG(ird));                        // test    [rd],[rd]
+					generate_logical_flags(block, false);
+					break;
+
+				case 1:
+					UML_CMP(block, DRC_REG(ird), imm);                                  // cmp     [rd],imm
+					generate_arith_flags(block, true);
+					break;
+
+				case 2:
+					UML_ADD(block, DRC_REG(ird), DRC_REG(ird), imm);                    // add     [rd],[rd],imm
+					generate_arith_flags(block, false);
+					break;
+
+				default:
+					UML_SUB(block, DRC_REG(ird), DRC_REG(ird), imm);                    // sub     [rd],[rd],imm
+					generate_arith_flags(block, true);
+					break;
+			}
+			UML_MOV(block, DRC_CPSR, uml::I4);                                          // mov     [cpsr],i4
+			return true;
+		}
 
-	if (T_IS_SET(GET_CPSR))
-	{
-		//UML_CALLH(block, *m_impstate.drcthumb[(op & 0xffc0) >> 6]);          // callh    drcthumb[op] // TODO FIXME
-		return true;
+		case 0x4:
+			if (op & 0x0800)
+			{
+				/* LDR Rd, [PC, #imm] */
+				const uint32_t ird = (op & THUMB_INSN_IMM_RD) >> THUMB_INSN_IMM_RD_SHIFT;
+				UML_MOV(block, uml::I1, (pc & ~2) + 4 + ((op & THUMB_INSN_IMM) << 2));  // mov     i1,address
+				generate_load_store(block, desc, 4, DRC_REG(ird));
+				return true;
+			}
+			if (!(op & 0x0400))
+				return generate_thumb_alu(block, desc, op);
+			return generate_thumb_hireg(block, compiler, desc, op);
+
+		case 0x5:
+			/* load/store with register offset */
+			UML_ADD(block, uml::I1, DRC_REG(rs), DRC_REG((op & THUMB_GROUP5_RM) >> THUMB_GROUP5_RM_SHIFT));   // add     i1,[rn],[rm]
+			generate_load_store(block, desc, (op & THUMB_GROUP5_TYPE) >> THUMB_GROUP5_TYPE_SHIFT, DRC_REG(rd));
+			return true;
+
+		case 0x6: case 0x7: case 0x8:
+		{
+			/* load/store word, byte and halfword with an immediate offset */
+			static const uint8_t types[3][2] = { { 0, 4 }, { 2, 6 }, { 1, 5 } };
+			static const uint8_t scales[3] = { 2, 0, 1 };
+			const int group = ((op & THUMB_INSN_TYPE) >> THUMB_INSN_TYPE_SHIFT) - 0x6;
+			const uint32_t offset = ((op & THUMB_LSOP_OFFS) >> THUMB_LSOP_OFFS_SHIFT) << scales[group];
+			UML_ADD(block, uml::I1, DRC_REG(rs), offset);                               // add     i1,[rn],offset
+			generate_load_store(block, desc, types[group][(op & THUMB_LSOP_L) ? 1 : 0], DRC_REG(rd));
+			return true;
+		}
+
+		case 0x9:
+		{
+			/* load/store SP-relative; only loads ignore the low address bits */
+			const uint32_t ird = (op & THUMB_INSN_IMM_RD) >> THUMB_INSN_IMM_RD_SHIFT;
+			UML_ADD(block, uml::I1, DRC_REG(eR13), (op & THUMB_INSN_IMM) << 2);         // add     i1,[r13],imm*4
+			if (op & THUMB_LSOP_L)
+				UML_AND(block, uml::I1, uml::I1, ~3);                                   // and     i1,i1,~3
+			generate_load_store(block, desc, (op & THUMB_LSOP_L) ? 4 : 0, DRC_REG(ird));
+			return true;
+		}
+
+		case 0xa:
+		{
+			/* ADD Rd, PC/SP, #imm */
+			const uint32_t ird = (op & THUMB_RELADDR_RD) >> THUMB_RELADDR_RD_SHIFT;
+			const uint32_t imm = (op & THUMB_INSN_IMM) << 2;
+			if (op & THUMB_RELADDR_SP)
+				UML_ADD(block, DRC_REG(ird), DRC_REG(eR13), imm);                       // add     [rd],[r13],imm
+			else
+				UML_MOV(block, DRC_REG(ird), ((pc + 4) & ~2) + imm);                    // mov     [rd],address
+			return true;
+		}
+
+		case 0xb:
+			return generate_thumb_stack(block, compiler, desc, op);
+
+		case 0xc:
+			return generate_thumb_block(block, desc, op);
+
+		case 0xd:
+		{
+			/* conditional branch */
+			const uml::code_label skip = compiler.labelnum++;
+			generate_condition(block, (op & THUMB_COND_TYPE) >> THUMB_COND_TYPE_SHIFT, 0);
+			UML_TEST(block, uml::I5, 1);                                                // test    i5,1
+			UML_JMPc(block, uml::COND_Z, skip);                                         // jmp     skip,Z
+			generate_branch(block, compiler, desc->targetpc);
+			UML_LABEL(block, skip);                                                     // skip:
+			return true;
+		}
+
+		case 0xe:
+			if (op & THUMB_BLOP_LO)
+			{
+				/* BLX (low half) always switches to ARM */
+				UML_ADD(block, uml::I0, DRC_REG(eR14), (op & THUMB_BLOP_OFFS) << 1);    // add     i0,[r14],offs
+				UML_AND(block, uml::I0, uml::I0, ~3);                                   // and     i0,i0,~3
+				UML_MOV(block, uml::I1, 0);                                             // mov     i1,0
+				UML_MOV(block, DRC_REG(eR14), (pc + 2) | 1);                            // mov     [r14],pc+2|1
+				generate_indirect_branch(block, compiler, true);
+				return true;
+			}
+			generate_branch(block, compiler, desc->targetpc);
+			return true;
+
+		default:
+			if (op & THUMB_BLOP_LO)
+			{
+				/* BL (low half) completes the target the high half left in LR */
+				UML_AND(block, uml::I0, DRC_REG(eR14), ~1);                             // and     i0,[r14],~1
+				UML_ADD(block, uml::I0, uml::I0, (op & THUMB_BLOP_OFFS) << 1);          // add     i0,i0,offs
+				UML_MOV(block, DRC_REG(eR14), (pc + 2) | 1);                            // mov     [r14],pc+2|1
+				generate_indirect_branch(block, compiler, false);
+				return true;
+			}
+
+			/* BL (high half) */
+			UML_MOV(block, DRC_REG(eR14), pc + 4 + util::sext((op & THUMB_BLOP_OFFS) << 12, 23));   // mov     [r14],target
+			return true;
 	}
+}
+
+
+/*-------------------------------------------------
+    generate_thumb_alu - generate code for the
+    Thumb ALU operations
+-------------------------------------------------*/
+
+bool arm7_cpu_device::generate_thumb_alu(drcuml_block &block, const opcode_desc *desc, uint16_t op)
+{
+	const uint32_t rd = op & THUMB_ADDSUB_RD;
+	const uint32_t rs = (op & THUMB_ADDSUB_RS) >> THUMB_ADDSUB_RS_SHIFT;
+	const uint32_t aluop = (op & THUMB_ALUOP_TYPE) >> THUMB_ALUOP_TYPE_SHIFT;
 
-	switch (op >> INSN_COND_SHIFT)
+	switch (aluop)
 	{
-		case COND_EQ:
-			UML_TEST(block, DRC_CPSR, Z_MASK);
-			UML_JMPc(block, uml::COND_Z, unexecuted = compiler.labelnum++);
-			break;
-		case COND_NE:
-			UML_TEST(block, DRC_CPSR, Z_MASK);
-			UML_JMPc(block, uml::COND_NZ, unexecuted = compiler.labelnum++);
-			break;
-		case COND_CS:
-			UML_TEST(block, DRC_CPSR, C_MASK);
-			UML_JMPc(block, uml::COND_Z, unexecuted = compiler.labelnum++);
-			break;
-		case COND_CC:
-			UML_TEST(block, DRC_CPSR, C_MASK);
-			UML_JMPc(block, uml::COND_NZ, unexecuted = compiler.labelnum++);
-			break;
-		case COND_MI:
-			UML_TEST(block, DRC_CPSR, N_MASK);
-			UML_JMPc(block, uml::COND_Z, unexecuted = compiler.labelnum++);
+		case 0x0: /* AND */
+			UML_AND(block, uml::I0, DRC_REG(rd), DRC_REG(rs));                          // and     i0,[rd],[rs]
+			generate_logical_flags(block, false);
 			break;
-		case COND_PL:
-			UML_TEST(block, DRC_CPSR, N_MASK);
-			UML_JMPc(block, uml::COND_NZ, unexecuted = compiler.labelnum++);
-			break;
-		case COND_VS:
-			UML_TEST(block, DRC_CPSR, V_MASK);
-			UML_JMPc(block, uml::COND_Z, unexecuted = compiler.labelnum++);
+
+		case 0x1: /* EOR */
+			UML_XOR(block, uml::I0, DRC_REG(rd), DRC_REG(rs));                          // xor     i0,[rd],[rs]
+			generate_logical_flags(block, false);
 			break;
-		case COND_VC:
-			UML_TEST(block, DRC_CPSR, V_MASK);
-			UML_JMPc(block, uml::COND_NZ, unexecuted = compiler.labelnum++);
+
+		case 0x8: /* TST */
+			UML_TEST(block, DRC_REG(rd), DRC_REG(rs));                                  // test    [rd],[rs]
+			generate_logical_flags(block, false);
 			break;
-		case COND_HI:
-			UML_TEST(block, DRC_CPSR, Z_MASK);
-			UML_JMPc(block, uml::COND_NZ, unexecuted = compiler.labelnum++);
-			UML_TEST(block, DRC_CPSR, C_MASK);
-			UML_JMPc(block, uml::COND_Z, unexecuted = compiler.labelnum++);
+
+		case 0x9: /* NEG */
+			UML_SUB(block, uml::I0, 0, DRC_REG(rs));                                    // sub     i0,0,[rs]
+			generate_arith_flags(block, true);
 			break;
-		case COND_LS:
-			UML_TEST(block, DRC_CPSR, Z_MASK);
-			UML_JMPc(block, uml::COND_NZ, contdecode = compiler.labelnum++);
-			UML_TEST(block, DRC_CPSR, C_MASK);
-			UML_JMPc(block, uml::COND_Z, contdecode);
-			UML_JMP(block, unexecuted);
+
+		case 0xa: /* CMP */
+			UML_CMP(block, DRC_REG(rd), DRC_REG(rs));                                   // cmp     [rd],[rs]
+			generate_arith_flags(block, true);
 			break;
-		case COND_GE:
-			UML_TEST(block, DRC_CPSR, N_MASK);
-			UML_MOVc(block, uml::COND_Z, uml::I0, 0);
-			UML_MOVc(block, uml::COND_NZ, uml::I0, 1);
-			UML_TEST(block, DRC_CPSR, V_MASK);
-			UML_MOVc(block, uml::COND_Z, uml::I1, 0);
-			UML_MOVc(block, uml::COND_NZ, uml::I1, 1);
-			UML_CMP(block, uml::I0, uml::I1);
-			UML_JMPc(block, uml::COND_NE, unexecuted);
+
+		case 0xb: /* CMN */
+			UML_ADD(block, uml::I0, DRC_REG(rd), DRC_REG(rs));                          // add     i0,[rd],[rs]
+			generate_arith_flags(block, false);
 			break;
-		case COND_LT:
-			UML_TEST(block, DRC_CPSR, N_MASK);
-			UML_MOVc(block, uml::COND_Z, uml::I0, 0);
-			UML_MOVc(block, uml::COND_NZ, uml::I0, 1);
-			UML_TEST(block, DRC_CPSR, V_MASK);
-			UML_MOVc(block, uml::COND_Z, uml::I1, 0);
-			UML_MOVc(block, uml::COND_NZ, uml::I1, 1);
-			UML_CMP(block, uml::I0, uml::I1);
-			UML_JMPc(block, uml::COND_E, unexecuted);
+
+		case 0xc: /* ORR */
+			UML_OR(block, uml::I0, DRC_REG(rd), DRC_REG(rs));                           // or      i0,[rd],[rs]
+			generate_logical_flags(block, false);
 			break;
-		case COND_GT:
-			UML_TEST(block, DRC_CPSR, Z_MASK);
-			UML_JMPc(block, uml::COND_NZ, unexecuted);
-			UML_TEST(block, DRC_CPSR, N_MASK);
-			UML_MOVc(block, uml::COND_Z, uml::I0, 0);
-			UML_MOVc(block, uml::COND_NZ, uml::I0, 1);
-			UML_TEST(block, DRC_CPSR, V_MASK);
-			UML_MOVc(block, uml::COND_Z, uml::I1, 0);
-			UML_MOVc(block, uml::COND_NZ, uml::I1, 1);
-			UML_CMP(block, uml::I0, uml::I1);
-			UML_JMPc(block, uml::COND_NE, unexecuted);
+
+		case 0xd: /* MUL */
+			UML_MULU(block, uml::I0, uml::I0, DRC_REG(rd), DRC_REG(rs));                // mulu    i0,i0,[rd],[rs]
+			UML_TEST(block, uml::I0, uml::I0);                                          // test    i0,i0
+			generate_logical_flags(block, false);
 			break;
-		case COND_LE:
-			UML_TEST(block, DRC_CPSR, N_MASK);
-			UML_MOVc(block, uml::COND_Z, uml::I0, 0);
-			UML_MOVc(block, uml::COND_NZ, uml::I0, 1);
-			UML_TEST(block, DRC_CPSR, V_MASK);
-			UML_MOVc(block, uml::COND_Z, uml::I1, 0);
-			UML_MOVc(block, uml::COND_NZ, uml::I1, 1);
-			UML_CMP(block, uml::I0, uml::I1);
-			UML_JMPc(block, uml::COND_NE, contdecode);
-			UML_TEST(block, DRC_CPSR, Z_MASK);
-			UML_JMPc(block, uml::COND_Z, unexecuted);
+
+		case 0xe: /* BIC */
+			UML_XOR(block, uml::I0, DRC_REG(rs), ~0);                                   // xor     i0,[rs],~0
+			UML_AND(block, uml::I0, DRC_REG(rd), uml::I0);                              // and     i0,[rd],i0
+			generate_logical_flags(block, false);
 			break;
-		case COND_NV:
-			UML_JMP(block, unexecuted);
+
+		case 0xf: /* MVN */
+			UML_XOR(block, uml::I0, DRC_REG(rs), ~0);                                   // xor     i0,[rs],~0
+			generate_logical_flags(block, false);
 			break;
+
+		default:
+			return false;
 	}
 
-	UML_LABEL(block, contdecode);
+	if (aluop != 0x8 && aluop != 0xa && aluop != 0xb)
+		UML_MOV(block, DRC_REG(rd), uml::I0);                                           // mov     [rd],i0
+	UML_MOV(block, DRC_CPSR, uml::I4);                                                  // mov     [cpsr],i4
+	return true;
+}
 
-	(this->*drcops_handler[(op & 0xF000000) >> 24])(block, compiler, desc, op);
 
-	UML_LABEL(block, unexecuted);
-	UML_ADD(block, DRC_PC, DRC_PC, 4);
-	UML_ADD(block, MAPVAR_CYCLES, MAPVAR_CYCLES, 2);                                // add      cycles, cycles, 2
+/*-------------------------------------------------
+    generate_thumb_hireg - generate code for the
+    high register operations, BX and BLX
+-------------------------------------------------*/
 
-	UML_LABEL(block, skip);
+bool arm7_cpu_device::generate_thumb_hireg(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t op)
+{
+	const uint32_t pc = desc->pc;
+	const uint32_t rs = ((op & THUMB_ADDSUB_RS) >> THUMB_ADDSUB_RS_SHIFT) + ((op & 0x40) ? 8 : 0);
+	const uint32_t rd = (op & THUMB_ADDSUB_RD) + ((op & 0x80) ? 8 : 0);
 
-	switch (opswitch)
+	switch ((op & THUMB_HIREG_OP) >> THUMB_HIREG_OP_SHIFT)
 	{
-		/* ----- sub-groups ----- */
+		case 0: /* ADD */
+			UML_ADD(block, DRC_REG(rd), DRC_REG(rd), drc_reg(rs, pc + 4));              // add     [rd],[rd],rs
+			return true;
 
-		case 0x00:  /* SPECIAL - MIPS I */
+		case 1: /* CMP; the PC reads as the address of this instruction */
+			UML_CMP(block, drc_reg(rd, pc), drc_reg(rs, pc));                           // cmp     rd,rs
+			generate_arith_flags(block, true);
+			UML_MOV(block, DRC_CPSR, uml::I4);                                          // mov     [cpsr],i4
+			return true;
+
+		case 2: /* MOV */
+			if (rd != eR15)
+			{
+				UML_MOV(block, DRC_REG(rd), drc_reg(rs, pc + 4));                       // mov     [rd],rs
+				return true;
+			}
+			UML_MOV(block, uml::I0, drc_reg(rs, pc + 4));                               // mov     i0,rs
+			generate_exchange(block, compiler, desc, false);
+			generate_indirect_branch(block, compiler, false);
 			return true;
 
-		// TODO: FINISH ME
+		default: /* BX, BLX */
+			UML_MOV(block, uml::I0, drc_reg(rs, pc + 2));                               // mov     i0,rs
+			generate_exchange(block, compiler, desc, true);
+			if (op & 0x80)
+				UML_MOV(block, DRC_REG(eR14), (pc + 2) | 1);                            // mov     [r14],pc+2|1
+			generate_indirect_branch(block, compiler, true);
+			return true;
 	}
+}
+
+
+/*-------------------------------------------------
+    generate_thumb_stack - generate code for the
+    SP adjustment, PUSH and POP
+-------------------------------------------------*/
 
-	return false;
+bool arm7_cpu_device::generate_thumb_stack(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t op)
+{
+	switch ((op & THUMB_STACKOP_TYPE) >> THUMB_STACKOP_TYPE_SHIFT)
+	{
+		case 0x0: /* ADD SP, #imm */
+			if (op & 0x80)
+				UML_SUB(block, DRC_REG(eR13), DRC_REG(eR13), (op & 0x7f) << 2);   // sub     [r13],[r13],imm
+			else
+				UML_ADD(block, DRC_REG(eR13), DRC_REG(eR13), (op & 0x7f) << 2);   // add     [r13],[r13],imm
+			return true;
+
+		case 0x4: case 0x5: /* PUSH; LR goes highest, then the list downwards */
+			UML_MOV(block, uml::I1, DRC_REG(eR13));                                     // mov     i1,[r13]
+			if (op & 0x100)
+			{
+				UML_SUB(block, uml::I1, uml::I1, 4);                                    // sub     i1,i1,4
+				generate_write(block, desc, uml::I1, DRC_REG(eR14), 4);
+			}
+			for (int regnum = 7; regnum >= 0; regnum--)
+			{
+				if (!BIT(op, regnum))
+					continue;
+				UML_SUB(block, uml::I1, uml::I1, 4);                                    // sub     i1,i1,4
+				generate_write(block, desc, uml::I1, DRC_REG(regnum), 4);
+			}
+			UML_MOV(block, DRC_REG(eR13), uml::I1);                                     // mov     [r13],i1
+			return true;
+
+		case 0xc: case 0xd: /* POP */
+		{
+			const uint32_t count = population_count_32(op & 0x1ff);
+			UML_AND(block, uml::I1, DRC_REG(eR13), ~3);                                 // and     i1,[r13],~3
+			for (int regnum = 0; regnum < 8; regnum++)
+			{
+				if (!BIT(op, regnum))
+					continue;
+				generate_read(block, desc, uml::I1, 4);
+				UML_MOV(block, DRC_REG(regnum), DRC_ARG1);                              // mov     [reg],[arg1]
+				UML_ADD(block, uml::I1, uml::I1, 4);                                    // add     i1,i1,4
+			}
+			if (!(op & 0x100))
+			{
+				UML_ADD(block, DRC_REG(eR13), DRC_REG(eR13), count << 2);               // add     [r13],[r13],count*4
+				return true;
+			}
+
+			/* popping the PC exchanges from v5 */
+			generate_read(block, desc, uml::I1, 4);
+			UML_MOV(block, uml::I0, DRC_ARG1);                                          // mov     i0,[arg1]
+			generate_exchange(block, compiler, desc, m_archRev >= 5);
+			UML_ADD(block, DRC_REG(eR13), DRC_REG(eR13), count << 2);                   // add     [r13],[r13],count*4
+			generate_indirect_branch(block, compiler, m_archRev >= 5);
+			return true;
+		}
+
+		default:
+			return false;
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_thumb_block - generate code for
+    STMIA and LDMIA
+-------------------------------------------------*/
+
+bool arm7_cpu_device::generate_thumb_block(drcuml_block &block, const opcode_desc *desc, uint16_t op)
+{
+	const uint32_t rb = (op & THUMB_MULTLS_BASE) >> THUMB_MULTLS_BASE_SHIFT;
+	const uint32_t count = population_count_32(op & 0xff);
+
+	/* the low address bits are ignored, and the base is written last */
+	UML_AND(block, uml::I1, DRC_REG(rb), ~3);                                           // and     i1,[rb],~3
+	for (int regnum = 0; regnum < 8; regnum++)
+	{
+		if (!BIT(op, regnum))
+			continue;
+		if (op & THUMB_MULTLS)
+		{
+			generate_read(block, desc, uml::I1, 4);
+			UML_MOV(block, (regnum == rb) ? DRC_TMP(rb) : DRC_REG(regnum), DRC_ARG1);   // mov     reg,[arg1]
+		}
+		else
+			generate_write(block, desc, uml::I1, DRC_REG(regnum), 4);
+		UML_ADD(block, uml::I1, uml::I1, 4);                                            // add     i1,i1,4
+	}
+
+	if ((op & THUMB_MULTLS) && BIT(op, rb))
+		UML_MOV(block, DRC_REG(rb), DRC_TMP(rb));                                       // mov     [rb],[tmprb]
+	else
+		UML_ADD(block, DRC_REG(rb), DRC_REG(rb), count << 2);                           // add     [rb],[rb],count*4
+	return true;
 }
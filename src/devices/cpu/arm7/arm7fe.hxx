@@ -2,22 +2,40 @@
 // copyright-holders:Ryan Holtz
 /***************************************************************************
 
-    arm7fe.c
+    arm7fe.hxx
 
     Front-end for ARM7 DRC
 
-***************************************************************************/
+    Only the ARM and Thumb instructions the recompiler generates code
+    for are described in detail; every other instruction ends its
+    sequence and is handed back to the interpreter.
 
-#include "emu.h"
-#include "arm7.h"
+***************************************************************************/
 
 
 //**************************************************************************
-//  ARM7 FRONTEND
+//  MACROS
 //**************************************************************************
 
 // register flags 0
-#define REGFLAG_R(n)                    (((n) == 0) ? 0 : (1 << (n)))
+#define REGFLAG_R(n)                    (1 << (n))
+
+// register flags 1
+#define REGFLAG_CPSR                    (1 << 0)
+
+// user flags
+#define ARM7_USERFLAG_INTERPRET         (1 << 0)    // instruction is handed back to the interpreter
+
+// modes the compiled code is keyed on
+#define ARM7_DRC_MODE_THUMB             (1 << 0)
+#define ARM7_DRC_MODE_MMU               (1 << 1)
+#define ARM7_DRC_MODE_USER              (1 << 2)    // user mode with the MMU on
+
+
+
+//**************************************************************************
+//  ARM7 FRONTEND
+//**************************************************************************
 
 //-------------------------------------------------
 //  arm7_frontend - constructor
@@ -31,428 +49,548 @@ arm7_frontend::arm7_frontend(arm7_cpu_device *arm7, uint32_t window_start, uint3
 
 
 //-------------------------------------------------
-//  describe_thumb - build a description of a
-//  thumb instruction
+//  describe - build a description of a single
+//  instruction
 //-------------------------------------------------
 
-bool arm7_frontend::describe_thumb(opcode_desc &desc, const opcode_desc *prev)
+bool arm7_frontend::describe(opcode_desc &desc, const opcode_desc *prev)
 {
-	return false;
-}
-
-//-------------------------------------------------
-//  describe_ops_* - build a description of
-//  an ARM7 instruction
-//-------------------------------------------------
+	const uint32_t mode = m_arm7->m_impstate.state->mode;
+	desc.length = (mode & ARM7_DRC_MODE_THUMB) ? 2 : 4;
 
-bool arm7_frontend::describe_ops_0123(opcode_desc &desc, const opcode_desc *prev, uint32_t op)
-{
-	/* Branch and Exchange (BX) */
-	if ((op & 0x0ffffff0) == 0x012fff10) // BX
-	{
-	}
-	else if ((op & 0x0ff000f0) == 0x01600010) // CLZ - v5
-	{
-	}
-	else if ((op & 0x0ff000f0) == 0x01000050) // QADD - v5
-	{
-	}
-	else if ((op & 0x0ff000f0) == 0x01400050) // QDADD - v5
-	{
-	}
-	else if ((op & 0x0ff000f0) == 0x01200050) // QSUB - v5
-	{
-	}
-	else if ((op & 0x0ff000f0) == 0x01600050) // QDSUB - v5
-	{
-	}
-	else if ((op & 0x0ff00090) == 0x01000080) // SMLAxy - v5
-	{
-	}
-	else if ((op & 0x0ff00090) == 0x01400080) // SMLALxy - v5
-	{
-	}
-	else if ((op & 0x0ff00090) == 0x01600080) // SMULxy - v5
-	{
-	}
-	else if ((op & 0x0ff000b0) == 0x012000a0) // SMULWy - v5
-	{
-	}
-	else if ((op & 0x0ff000b0) == 0x01200080) // SMLAWy - v5
-	{
-	}
-	else if ((op & 0x0e000000) == 0 && (op & 0x80) && (op & 0x10)) // Multiply OR Swap OR Half Word Data Transfer
+	// compute the physical PC
+	if ((mode & ARM7_DRC_MODE_MMU) && !m_arm7->translate_vaddr_to_paddr(desc.physpc, ARM7_TLB_ABORT_P | ARM7_TLB_READ))
 	{
-		if (op & 0x60) // Half Word Data Transfer
-		{
-			//HandleHalfWordDT(op);
-		}
-		else if (op & 0x01000000) // Swap
-		{
-			//HandleSwap(op);
-		}
-		else // Multiply Or Multiply Long
-		{
-			if (op & 0x800000) // Multiply long
-			{
-				if (op & 0x00400000) // Signed multiply
-				{
-					//HandleSMulLong(op);
-				}
-				else // Unsigned multiply
-				{
-					//HandleUMulLong(op);
-				}
-			}
-			else // Multiply
-			{
-				//HandleMul(op);//
-			}
-		}
+		// prefetch abort: leave the description empty and let the interpreter take the fault
+		desc.flags |= OPFLAG_CAN_CAUSE_EXCEPTION | OPFLAG_COMPILER_PAGE_FAULT | OPFLAG_VIRTUAL_NOOP | OPFLAG_END_SEQUENCE;
+		return true;
 	}
-	else if ((op & 0x0c000000) == 0) // Data Processing OR PSR Transfer
+
+	// fetch the word the instruction lives in, the same way the prefetch queue does
+	const uint32_t word = m_arm7->m_pr32(desc.physpc & ~3);
+	if (mode & ARM7_DRC_MODE_THUMB)
 	{
-		if (((op & 0x00100000) == 0) && ((op & 0x01800000) == 0x01000000)) // PSR Transfer
+		const uint16_t op = uint16_t(word >> ((desc.pc & 2) ? m_arm7->m_prefetch_word1_shift : m_arm7->m_prefetch_word0_shift));
+		desc.opptr.w[0] = op;
 
-		{
-			//HandlePSRTransfer(insn);
-			desc.cycles = 1;
-		}
-		else // Data processing
-		{
-			//HandleALU(insn);
-		}
+		// every Thumb instruction takes 3 cycles in the interpreter
+		desc.cycles = 3;
+		return describe_thumb(desc, op);
 	}
-	return true;
+
+	desc.opptr.l[0] = word;
+	return describe_arm(desc, word);
 }
 
-bool arm7_frontend::describe_ops_4567(opcode_desc &desc, const opcode_desc *prev, uint32_t op)
+
+//-------------------------------------------------
+//  describe_arm - build a description of an ARM
+//  instruction
+//-------------------------------------------------
+
+bool arm7_frontend::describe_arm(opcode_desc &desc, uint32_t op)
 {
-	if (op & INSN_I)
-	{
-		/* Register Shift */
-		//off = decodeShift(op, nullptr);
-	}
-	else
+	const uint32_t cond = op >> INSN_COND_SHIFT;
+	bool conditional = (cond != COND_AL);
+
+	// NV never executes before v5; from v5 it selects the unconditional instructions
+	if (cond == COND_NV)
 	{
-		/* Immediate Value */
-		//off = op & INSN_SDT_IMM;
+		if (m_arm7->m_archRev >= 5)
+			return describe_interpret(desc);
+		desc.cycles = 1;
+		return true;
 	}
+	if (conditional)
+		desc.regin[1] |= REGFLAG_CPSR;
 
-	uint32_t rn = (op & INSN_RN) >> INSN_RN_SHIFT;
+	const uint32_t rd = (op & INSN_RD) >> INSN_RD_SHIFT;
+	const uint32_t rn = (op & INSN_RN) >> INSN_RN_SHIFT;
+	const uint32_t rm = op & INSN_OP2_RM;
 
-	if (op & INSN_SDT_P)
+	switch ((op >> 25) & 7)
 	{
-		/* Pre-indexed addressing */
-		if ((get_mode32()) || (rn != eR15))
-		{
-			//rnv = (GetRegister(rn) + off);
-		}
-		else
-		{
-			//rnv = (GET_PC + off);
-		}
+		case 0: case 1:
+			// BX / BLX Rm
+			if ((op & 0x0ffffff0) == 0x012fff10 || (op & 0x0ff000f0) == 0x01200030)
+			{
+				if (rm == 15)
+					return describe_interpret(desc);
+				desc.regin[0] |= REGFLAG_R(rm);
+				if (op & 0x20)
+					desc.regout[0] |= REGFLAG_R(14);
+				desc.regout[1] |= REGFLAG_CPSR;
+				desc.flags |= OPFLAG_CAN_CHANGE_MODES;
+				desc.cycles = 3;
+				return describe_branch(desc, conditional, BRANCH_TARGET_DYNAMIC);
+			}
 
-		if (op & INSN_SDT_W)
-		{
-			//rnv_old = GetRegister(rn);
-			//SetRegister(rn, rnv);
-		}
-		else if (rn == eR15)
-		{
-			//rnv = rnv + 8;
-		}
-	}
-	else
-	{
-		/* Post-indexed addressing */
-		if (rn == eR15)
+			// MUL / MLA; the other multiplies, swaps and halfword transfers share the encoding
+			if (!(op & INSN_I) && (op & 0x90) == 0x90)
+			{
+				if (op & 0x60)
+					return describe_arm_halfword(desc, op, conditional);
+				if ((op & 0x0fc00000) != 0)
+					return describe_interpret(desc);
+				const uint32_t mrd = (op & INSN_MUL_RD) >> INSN_MUL_RD_SHIFT;
+				const uint32_t mrn = (op & INSN_MUL_RN) >> INSN_MUL_RN_SHIFT;
+				const uint32_t mrs = (op & INSN_MUL_RS) >> INSN_MUL_RS_SHIFT;
+				if (mrd == 15 || mrn == 15 || mrs == 15 || rm == 15)
+					return describe_interpret(desc);
+				desc.regin[0] |= REGFLAG_R(rm) | REGFLAG_R(mrs);
+				if (op & INSN_MUL_A)
+					desc.regin[0] |= REGFLAG_R(mrn);
+				desc.regout[0] |= REGFLAG_R(mrd);
+				if (op & INSN_S)
+					desc.regout[1] |= REGFLAG_CPSR;
+
+				// the multiplier array cycles depend on Rs and are counted at run time
+				desc.cycles = (op & INSN_MUL_A) ? 2 : 1;
+				return true;
+			}
+			return describe_arm_alu(desc, op, conditional);
+
+		case 2: case 3:
 		{
-			if (get_mode32())
+			// register shifted by register, and the v6 media instructions
+			if ((op & INSN_I) && (op & 0x10))
+				return describe_interpret(desc);
+			if ((op & INSN_I) && rm == 15)
+				return describe_interpret(desc);
+
+			// writeback into the transferred register or the PC is left to the interpreter
+			const bool writeback = !(op & INSN_SDT_P) || (op & INSN_SDT_W);
+			if (writeback && (rn == 15 || rn == rd))
+				return describe_interpret(desc);
+			if ((op & INSN_SDT_B) && rd == 15)
+				return describe_interpret(desc);
+
+			desc.regin[0] |= REGFLAG_R(rn);
+			if (op & INSN_I)
+				desc.regin[0] |= REGFLAG_R(rm);
+			if (writeback)
+				desc.regout[0] |= REGFLAG_R(rn);
+			desc.flags |= OPFLAG_CAN_CAUSE_EXCEPTION;
+			if (op & INSN_SDT_L)
 			{
-				//rnv = R15 + 8;
+				desc.flags |= OPFLAG_READS_MEMORY;
+				desc.cycles = 3;
+				if (rd == 15)
+				{
+					desc.cycles = 5;
+					desc.regout[1] |= REGFLAG_CPSR;
+					desc.flags |= OPFLAG_CAN_CHANGE_MODES;
+					return describe_branch(desc, conditional, BRANCH_TARGET_DYNAMIC);
+				}
+				desc.regout[0] |= REGFLAG_R(rd);
 			}
 			else
 			{
-				//rnv = GET_PC + 8;
+				desc.flags |= OPFLAG_WRITES_MEMORY;
+				desc.regin[0] |= REGFLAG_R(rd);
+				desc.cycles = 2;
 			}
+			return true;
 		}
-		else
-		{
-			//rnv = GetRegister(rn);
-		}
-	}
 
-	/* Do the transfer */
-	uint32_t rd = (op & INSN_RD) >> INSN_RD_SHIFT;
-	if (op & INSN_SDT_L)
-	{
-		/* Load */
-		if (op & INSN_SDT_B)
-		{
-			//uint32_t data = READ8(rnv);
-			//SetRegister(rd, data);
-		}
-		else
+		case 4:
 		{
-			//uint32_t data = READ32(rnv);
-			if (rd == eR15)
+			// user bank transfers, PC as the base and empty lists are left to the interpreter
+			const uint32_t list = op & INSN_BDT_REGS;
+			if ((op & INSN_BDT_S) || rn == 15 || list == 0)
+				return describe_interpret(desc);
+
+			const uint32_t count = population_count_32(list);
+			desc.regin[0] |= REGFLAG_R(rn);
+			if (op & INSN_BDT_W)
+				desc.regout[0] |= REGFLAG_R(rn);
+			desc.flags |= OPFLAG_CAN_CAUSE_EXCEPTION;
+			if (op & INSN_BDT_L)
 			{
-				//R15 = data - 4;
-				// LDR, PC takes 2S + 2N + 1I (5 total cycles)
-				desc.cycles = 5;
+				desc.regout[0] |= list;
+				desc.flags |= OPFLAG_READS_MEMORY;
+				desc.cycles = count + 2;
+				if (list & 0x8000)
+				{
+					desc.cycles += 2;
+					desc.regout[1] |= REGFLAG_CPSR;
+					desc.flags |= OPFLAG_CAN_CHANGE_MODES;
+					return describe_branch(desc, conditional, BRANCH_TARGET_DYNAMIC);
+				}
 			}
 			else
 			{
-				//SetRegister(rd, data);
+				desc.regin[0] |= list;
+				desc.flags |= OPFLAG_WRITES_MEMORY;
+				desc.cycles = count + 1;
 			}
+			return true;
 		}
-	}
-	else
-	{
-		/* Store */
-		if (op & INSN_SDT_B)
-		{
-			//WRITE8(rnv, (uint8_t) GetRegister(rd) & 0xffu);
-		}
-		else
+
+		case 5:
 		{
-			//WRITE32(rnv, rd == eR15 ? R15 + 8 + 4 : GetRegister(rd)); // manual says STR rd = PC, +12
+			// B / BL
+			const int32_t offset = util::sext((op & INSN_BRANCH) << 2, 26);
+			if (op & INSN_BL)
+				desc.regout[0] |= REGFLAG_R(14);
+			desc.cycles = 3;
+			return describe_branch(desc, conditional, desc.pc + 8 + offset);
 		}
-		// Store takes only 2 N Cycles, so add + 1
-		desc.cycles = 2;
-	}
 
-	/* Do post-indexing writeback */
-	if (!(op & INSN_SDT_P)/* && (insn & INSN_SDT_W)*/)
-	{
-		if (rd == rn) {
-			//SetRegister(rn, GetRegister(rd));
-		}
-		else {
-			//SetRegister(rn, (rnv +/- off));
-		}
+		default:
+			// coprocessor transfers and SWI
+			return describe_interpret(desc);
 	}
-	return true;
 }
 
-bool arm7_frontend::describe_ops_89(opcode_desc &desc, const opcode_desc *prev, uint32_t op)
-{
-	if ((op & 0x005f0f00) == 0x004d0500)
-	{
-		// unsupported (armv6 onwards only)
-		//arm9ops_undef(insn);
-		//R15 += 4;
-	}
-	else if ((op & 0x00500f00) == 0x00100a00) /* Return From Exception (RFE) */
-	{
-		// unsupported (armv6 onwards only)
-		//arm9ops_undef(insn);
-		//R15 += 4;
-	}
-	else
-	{
-		//arm9ops_undef(insn);
-		//R15 += 4;
-	}
-	return false;
-}
 
-bool arm7_frontend::describe_ops_ab(opcode_desc &desc, const opcode_desc *prev, uint32_t op)
-{
-	// BLX
-	//HandleBranch(insn, true);
-	//set_cpsr(GET_CPSR|T_MASK);
-	return true;
-}
+//-------------------------------------------------
+//  describe_arm_alu - build a description of an
+//  ARM data processing instruction
+//-------------------------------------------------
 
-bool arm7_frontend::describe_ops_cd(opcode_desc &desc, const opcode_desc *prev, uint32_t op)
+bool arm7_frontend::describe_arm_alu(opcode_desc &desc, uint32_t op, bool conditional)
 {
-	/* Additional coprocessor double register transfer */
-	if ((op & 0x00e00000) == 0x00400000)
-	{
-		// unsupported
-		//arm9ops_undef(insn);
-		//R15 += 4;
-	}
-	else
+	const uint32_t opcode = (op & INSN_OPCODE) >> INSN_OPCODE_SHIFT;
+	const uint32_t rd = (op & INSN_RD) >> INSN_RD_SHIFT;
+	const uint32_t rn = (op & INSN_RN) >> INSN_RN_SHIFT;
+	const bool test = (opcode & 0xc) == 0x8;
+
+	// test opcodes without S are PSR transfers and the v5 DSP instructions; shifts by
+	// register read the PC 12 bytes ahead; a flag-setting write to the PC restores the SPSR
+	if (test && !(op & INSN_S))
+		return describe_interpret(desc);
+	if (!(op & INSN_I) && (op & 0x10))
+		return describe_interpret(desc);
+	if (rd == 15 && ((op & INSN_S) || test))
+		return describe_interpret(desc);
+
+	if ((opcode & 0xd) != 0xd)
+		desc.regin[0] |= REGFLAG_R(rn);
+	if (!(op & INSN_I))
+		desc.regin[0] |= REGFLAG_R(op & INSN_OP2_RM);
+	if (opcode == OPCODE_ADC || opcode == OPCODE_SBC || opcode == OPCODE_RSC)
+		desc.regin[1] |= REGFLAG_CPSR;
+	if (op & INSN_S)
+		desc.regout[1] |= REGFLAG_CPSR;
+
+	// immediate operands take 1 cycle, shifted registers 2
+	desc.cycles = (op & INSN_I) ? 1 : 2;
+	if (test)
+		return true;
+	if (rd == 15)
 	{
-		//arm9ops_undef(insn);
-		//R15 += 4;
+		desc.cycles += 2;
+		return describe_branch(desc, conditional, BRANCH_TARGET_DYNAMIC);
 	}
-	return false;
-}
-
-bool arm7_frontend::describe_ops_e(opcode_desc &desc, const opcode_desc *prev, uint32_t op)
-{
-	/* Additional coprocessor register transfer */
-	// unsupported
-	//arm9ops_undef(insn);
-	//R15 += 4;
-	return false;
+	desc.regout[0] |= REGFLAG_R(rd);
+	return true;
 }
 
-bool arm7_frontend::describe_ops_f(opcode_desc &desc, const opcode_desc *prev, uint32_t op)
-{
-	return false;
-}
 
 //-------------------------------------------------
-//  describe_arm9_ops_* - build a description of
-//  an ARM9 instruction
+//  describe_arm_halfword - build a description of
+//  an ARM halfword or signed byte transfer
 //-------------------------------------------------
 
-bool describe_arm9_ops_1(opcode_desc &desc, const opcode_desc *prev, uint32_t op)
-{
-	/* Change processor state (CPS) */
-	if ((op & 0x00f10020) == 0x00000000)
-	{
-		// unsupported (armv6 onwards only)
-		//arm9ops_undef(insn);
-		//R15 += 4;
-	}
-	else if ((op & 0x00ff00f0) == 0x00010000) /* set endianness (SETEND) */
-	{
-		// unsupported (armv6 onwards only)
-		//arm9ops_undef(insn);
-		//R15 += 4;
-	}
-	else
-	{
-		//arm9ops_undef(insn);
-		//R15 += 4;
-	}
-	return false;
-}
-
-bool describe_arm9_ops_57(opcode_desc &desc, const opcode_desc *prev, uint32_t op)
+bool arm7_frontend::describe_arm_halfword(opcode_desc &desc, uint32_t op, bool conditional)
 {
-	/* Cache Preload (PLD) */
-	if ((op & 0x0070f000) == 0x0050f000)
+	const uint32_t rd = (op & INSN_RD) >> INSN_RD_SHIFT;
+	const uint32_t rn = (op & INSN_RN) >> INSN_RN_SHIFT;
+	const uint32_t rm = op & 0x0f;
+	const bool writeback = !(op & INSN_SDT_P) || (op & INSN_SDT_W);
+
+	// LDRD/STRD, loads into the PC, PC offsets and writeback into the
+	// transferred register or the PC are left to the interpreter
+	if (!(op & INSN_SDT_L) && (op & 0x40))
+		return describe_interpret(desc);
+	if (((op & INSN_SDT_L) && rd == 15) || (!(op & 0x400000) && rm == 15))
+		return describe_interpret(desc);
+	if (writeback && (rn == 15 || rn == rd))
+		return describe_interpret(desc);
+
+	desc.regin[0] |= REGFLAG_R(rn);
+	if (!(op & 0x400000))
+		desc.regin[0] |= REGFLAG_R(rm);
+	if (writeback)
+		desc.regout[0] |= REGFLAG_R(rn);
+	desc.flags |= OPFLAG_CAN_CAUSE_EXCEPTION;
+	if (op & INSN_SDT_L)
 	{
-		// unsupported (armv6 onwards only)
-		//arm9ops_undef(insn);
-		//R15 += 4;
+		desc.regout[0] |= REGFLAG_R(rd);
+		desc.flags |= OPFLAG_READS_MEMORY;
+		desc.cycles = 3;
 	}
 	else
 	{
-		//arm9ops_undef(insn);
-		//R15 += 4;
+		desc.regin[0] |= REGFLAG_R(rd);
+		desc.flags |= OPFLAG_WRITES_MEMORY;
+		desc.cycles = 2;
 	}
-	return false;
-}
-
-bool describe_arm9_ops_89(opcode_desc &desc, const opcode_desc *prev, uint32_t op)
-{
-	return false;
-}
-
-bool describe_arm9_ops_ab(opcode_desc &desc, const opcode_desc *prev, uint32_t op)
-{
-	return false;
-}
-
-bool describe_arm9_ops_c(opcode_desc &desc, const opcode_desc *prev, uint32_t op)
-{
-	return false;
-}
-
-bool describe_arm9_ops_e(opcode_desc &desc, const opcode_desc *prev, uint32_t op)
-{
-	return false;
-}
-
-
-uint32_t arm7_frontend::get_cpsr()
-{
-	return m_arm7->m_r[eCPSR];
+	return true;
 }
 
-bool arm7_frontend::get_mode32()
-{
-	return m_arm7->m_r[eCPSR] & SR_MODE32;
-}
 
 //-------------------------------------------------
-//  describe - build a description of a single
-//  instruction
+//  describe_thumb - build a description of a
+//  Thumb instruction
 //-------------------------------------------------
 
-bool arm7_frontend::describe(opcode_desc &desc, const opcode_desc *prev)
+bool arm7_frontend::describe_thumb(opcode_desc &desc, uint16_t op)
 {
-	// compute the physical PC
-	const uint32_t cpsr = get_cpsr();
-	assert((desc.physpc & (T_IS_SET(cpsr) ? 1 : 3)) == 0);
-	if (!m_arm7->arm7_tlb_translate(desc.physpc, ARM7_TLB_ABORT_P | ARM7_TLB_READ))
-	{
-		// uh-oh: a page fault; leave the description empty and just if this is the first instruction, leave it empty and
-		// mark as needing to validate; otherwise, just end the sequence here
-		desc.flags |= OPFLAG_VALIDATE_TLB | OPFLAG_CAN_CAUSE_EXCEPTION | OPFLAG_COMPILER_PAGE_FAULT | OPFLAG_VIRTUAL_NOOP | OPFLAG_END_SEQUENCE;
-		return true;
-	}
-
-	if (T_IS_SET(cpsr))
-	{
-		return describe_thumb(desc, prev);
-	}
-
-	// fetch the opcode
-	uint32_t op = desc.opptr.l[0] = m_arm7->m_direct->read_dword(desc.physpc);
-
-	// all non-THUMB instructions are 4 bytes and default to 3 cycles each
-	desc.length = 4;
-	desc.cycles = 3;
+	const uint32_t rd = op & THUMB_ADDSUB_RD;
+	const uint32_t rs = (op & THUMB_ADDSUB_RS) >> THUMB_ADDSUB_RS_SHIFT;
+
+	switch ((op & THUMB_INSN_TYPE) >> THUMB_INSN_TYPE_SHIFT)
+	{
+		case 0x0: case 0x1:
+			// shift by immediate, ADD/SUB register or 3-bit immediate
+			desc.regin[0] |= REGFLAG_R(rs);
+			if ((op & 0x1c00) == 0x1800)
+				desc.regin[0] |= REGFLAG_R((op & THUMB_ADDSUB_RNIMM) >> THUMB_ADDSUB_RNIMM_SHIFT);
+			else if ((op & 0x1800) != 0x1800)
+				desc.regin[1] |= REGFLAG_CPSR;
+			desc.regout[0] |= REGFLAG_R(rd);
+			desc.regout[1] |= REGFLAG_CPSR;
+			return true;
+
+		case 0x2: case 0x3:
+		{
+			// MOV/CMP/ADD/SUB 8-bit immediate
+			const uint32_t ird = (op & THUMB_INSN_IMM_RD) >> THUMB_INSN_IMM_RD_SHIFT;
+			if ((op & 0x1800) != 0x0000)
+				desc.regin[0] |= REGFLAG_R(ird);
+			if ((op & 0x1800) != 0x0800)
+				desc.regout[0] |= REGFLAG_R(ird);
+			desc.regin[1] |= REGFLAG_CPSR;
+			desc.regout[1] |= REGFLAG_CPSR;
+			return true;
+		}
 
-	// parse the instruction
+		case 0x4:
+			if (op & 0x0800)
+			{
+				// LDR Rd, [PC, #imm]
+				desc.regout[0] |= REGFLAG_R((op & THUMB_INSN_IMM_RD) >> THUMB_INSN_IMM_RD_SHIFT);
+				desc.flags |= OPFLAG_READS_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+				return true;
+			}
+			if (!(op & 0x0400))
+			{
+				// the ALU group; register shifts and ADC/SBC are left to the interpreter
+				const uint32_t aluop = (op & THUMB_ALUOP_TYPE) >> THUMB_ALUOP_TYPE_SHIFT;
+				if (aluop >= 0x2 && aluop <= 0x7)
+					return describe_interpret(desc);
+				desc.regin[0] |= REGFLAG_R(rs) | REGFLAG_R(rd);
+				desc.regin[1] |= REGFLAG_CPSR;
+				if (aluop != 0x8 && aluop != 0xa && aluop != 0xb)
+					desc.regout[0] |= REGFLAG_R(rd);
+				desc.regout[1] |= REGFLAG_CPSR;
+				return true;
+			}
+			else
+			{
+				// high register operations and BX/BLX
+				const uint32_t hirs = rs + ((op & 0x40) ? 8 : 0);
+				const uint32_t hird = rd + ((op & 0x80) ? 8 : 0);
+				switch ((op & THUMB_HIREG_OP) >> THUMB_HIREG_OP_SHIFT)
+				{
+					case 0:     // ADD
+						if ((op & THUMB_HIREG_H) == 0 || hird == 15)
+							return describe_interpret(desc);
+						desc.regin[0] |= REGFLAG_R(hird) | REGFLAG_R(hirs);
+						desc.regout[0] |= REGFLAG_R(hird);
+						return true;
+
+					case 1:     // CMP
+						desc.regin[0] |= REGFLAG_R(hird) | REGFLAG_R(hirs);
+						desc.regin[1] |= REGFLAG_CPSR;
+						desc.regout[1] |= REGFLAG_CPSR;
+						return true;
+
+					case 2:     // MOV
+						desc.regin[0] |= REGFLAG_R(hirs);
+						desc.regout[0] |= REGFLAG_R(hird);
+						if (hird == 15)
+							return describe_branch(desc, false, BRANCH_TARGET_DYNAMIC);
+						return true;
+
+					default:    // BX/BLX
+						if ((op & THUMB_HIREG_H) == 0xc0)
+							return describe_interpret(desc);
+						desc.regin[0] |= REGFLAG_R(hirs);
+						if (op & 0x80)
+							desc.regout[0] |= REGFLAG_R(14);
+						desc.regout[1] |= REGFLAG_CPSR;
+						desc.flags |= OPFLAG_CAN_CHANGE_MODES;
+						return describe_branch(desc, false, BRANCH_TARGET_DYNAMIC);
+				}
+			}
 
-	int op_offset = 0;
-	if ((op >> INSN_COND_SHIFT) == COND_NV && m_arm7->m_archRev >= 5)
-	{
-		op_offset = 0x10;
-	}
+		case 0x5:
+			// load/store with register offset; everything from LDRSB up is a load
+			desc.regin[0] |= REGFLAG_R(rs) | REGFLAG_R((op & THUMB_GROUP5_RM) >> THUMB_GROUP5_RM_SHIFT);
+			if (((op & THUMB_GROUP5_TYPE) >> THUMB_GROUP5_TYPE_SHIFT) >= 3)
+			{
+				desc.regout[0] |= REGFLAG_R(rd);
+				desc.flags |= OPFLAG_READS_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+			}
+			else
+			{
+				desc.regin[0] |= REGFLAG_R(rd);
+				desc.flags |= OPFLAG_WRITES_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+			}
+			return true;
 
-	switch (((op & 0xF000000) >> 24) + op_offset)
-	{
-		case 0x0: case 0x1: case 0x2: case 0x3:
-			return describe_ops_0123(desc, prev, op);
+		case 0x6: case 0x7: case 0x8: case 0x9:
+		{
+			// load/store word, byte, halfword with immediate offset and SP-relative
+			const bool sprel = ((op & THUMB_INSN_TYPE) >> THUMB_INSN_TYPE_SHIFT) == 0x9;
+			const uint32_t lsrd = sprel ? ((op & THUMB_INSN_IMM_RD) >> THUMB_INSN_IMM_RD_SHIFT) : rd;
+			desc.regin[0] |= REGFLAG_R(sprel ? 13 : rs);
+			if (op & THUMB_LSOP_L)
+			{
+				desc.regout[0] |= REGFLAG_R(lsrd);
+				desc.flags |= OPFLAG_READS_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+			}
+			else
+			{
+				desc.regin[0] |= REGFLAG_R(lsrd);
+				desc.flags |= OPFLAG_WRITES_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+			}
+			return true;
+		}
 
-		case 0x4: case 0x5: case 0x6: case 0x7:
-			return describe_ops_4567(desc, prev, op);
+		case 0xa:
+			// ADD Rd, PC/SP, #imm
+			if (op & THUMB_RELADDR_SP)
+				desc.regin[0] |= REGFLAG_R(13);
+			desc.regout[0] |= REGFLAG_R((op & THUMB_RELADDR_RD) >> THUMB_RELADDR_RD_SHIFT);
+			return true;
 
-		case 0x8: case 0x9:
-			return describe_ops_89(desc, prev, op);
+		case 0xb:
+			switch ((op & THUMB_STACKOP_TYPE) >> THUMB_STACKOP_TYPE_SHIFT)
+			{
+				case 0x0:   // ADD SP, #imm
+					desc.regin[0] |= REGFLAG_R(13);
+					desc.regout[0] |= REGFLAG_R(13);
+					return true;
+
+				case 0x4: case 0x5:     // PUSH
+					if ((op & 0x1ff) == 0)
+						return describe_interpret(desc);
+					desc.regin[0] |= REGFLAG_R(13) | (op & 0xff) | ((op & 0x100) ? REGFLAG_R(14) : 0);
+					desc.regout[0] |= REGFLAG_R(13);
+					desc.flags |= OPFLAG_WRITES_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+					return true;
+
+				case 0xc: case 0xd:     // POP
+					if ((op & 0x1ff) == 0)
+						return describe_interpret(desc);
+					desc.regin[0] |= REGFLAG_R(13);
+					desc.regout[0] |= REGFLAG_R(13) | (op & 0xff);
+					desc.flags |= OPFLAG_READS_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+					if (op & 0x100)
+					{
+						desc.regout[1] |= REGFLAG_CPSR;
+						desc.flags |= OPFLAG_CAN_CHANGE_MODES;
+						return describe_branch(desc, false, BRANCH_TARGET_DYNAMIC);
+					}
+					return true;
+
+				default:
+					return describe_interpret(desc);
+			}
 
-		case 0xa: case 0xb:
-			return describe_ops_ab(desc, prev, op);
+		case 0xc:
+		{
+			// STMIA/LDMIA
+			const uint32_t rb = (op & THUMB_MULTLS_BASE) >> THUMB_MULTLS_BASE_SHIFT;
+			if ((op & 0xff) == 0)
+				return describe_interpret(desc);
+			desc.regin[0] |= REGFLAG_R(rb);
+			desc.regout[0] |= REGFLAG_R(rb);
+			if (op & THUMB_MULTLS)
+			{
+				desc.regout[0] |= op & 0xff;
+				desc.flags |= OPFLAG_READS_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+			}
+			else
+			{
+				desc.regin[0] |= op & 0xff;
+				desc.flags |= OPFLAG_WRITES_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+			}
+			return true;
+		}
 
-		case 0xc: case 0xd:
-			return describe_ops_cd(desc, prev, op);
+		case 0xd:
+		{
+			// conditional branch; 0xe is undefined and 0xf is SWI
+			const uint32_t cond = (op & THUMB_COND_TYPE) >> THUMB_COND_TYPE_SHIFT;
+			if (cond >= COND_AL)
+				return describe_interpret(desc);
+			desc.regin[1] |= REGFLAG_CPSR;
+			return describe_branch(desc, true, desc.pc + 4 + (int8_t(op & 0xff) << 1));
+		}
 
 		case 0xe:
-			return describe_ops_e(desc, prev, op);
+			if (op & THUMB_BLOP_LO)
+			{
+				// BLX (low half) always switches to ARM
+				desc.regin[0] |= REGFLAG_R(14);
+				desc.regout[0] |= REGFLAG_R(14);
+				desc.regout[1] |= REGFLAG_CPSR;
+				desc.flags |= OPFLAG_CAN_CHANGE_MODES;
+				return describe_branch(desc, false, BRANCH_TARGET_DYNAMIC);
+			}
+			return describe_branch(desc, false, desc.pc + 4 + util::sext((op & THUMB_BRANCH_OFFS) << 1, 12));
 
 		case 0xf:
-			return describe_ops_f(desc, prev, op);
-
-		case 0x11: // ARM9
-			return describe_arm9_ops_1(desc, prev, op);
+			desc.regout[0] |= REGFLAG_R(14);
+			if (op & THUMB_BLOP_LO)
+			{
+				// BL (low half) uses the offset the high half left in LR
+				desc.regin[0] |= REGFLAG_R(14);
+				return describe_branch(desc, false, BRANCH_TARGET_DYNAMIC);
+			}
+			return true;
+	}
+	return describe_interpret(desc);
+}
 
-		case 0x15: case 0x17: // ARM9
-			return describe_arm9_ops_57(desc, prev, op);
 
-		case 0x18: case 0x19: // ARM9
-			return describe_arm9_ops_89(desc, prev, op);
+//-------------------------------------------------
+//  describe_branch - mark an instruction as a
+//  branch to the given target
+//-------------------------------------------------
 
-		case 0x1a: case 0x1b: // ARM9
-			return describe_arm9_ops_ab(desc, prev, op);
+bool arm7_frontend::describe_branch(opcode_desc &desc, bool conditional, offs_t targetpc)
+{
+	desc.targetpc = targetpc;
+	if (conditional)
+		desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+	else
+		desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+	return true;
+}
 
-		case 0x1c: // ARM9
-			return describe_arm9_ops_c(desc, prev, op);
 
-		case 0x1e: // ARM9
-			return describe_arm9_ops_e(desc, prev, op);
+//-------------------------------------------------
+//  describe_interpret - describe an instruction
+//  the recompiler leaves to the interpreter; it
+//  sees all registers and flags and ends the
+//  sequence
+//-------------------------------------------------
 
-		default:
-			return false;
-	}
+bool arm7_frontend::describe_interpret(opcode_desc &desc)
+{
+	desc.cycles = 0;
+	desc.userflags |= ARM7_USERFLAG_INTERPRET;
+	desc.regin[0] = 0xffff;
+	desc.regin[1] = REGFLAG_CPSR;
+	desc.regout[0] = desc.regout[1] = 0;
+	desc.flags &= ~(OPFLAG_IS_BRANCH | OPFLAG_READS_MEMORY | OPFLAG_WRITES_MEMORY | OPFLAG_CAN_CHANGE_MODES);
+	desc.flags |= OPFLAG_CAN_CAUSE_EXCEPTION | OPFLAG_END_SEQUENCE;
+	desc.targetpc = BRANCH_TARGET_DYNAMIC;
+	return true;
 }
@@ -0,0 +1,4229 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    drcbearm64.cpp
+
+    64-bit AArch64 back-end for the universal machine language.
+
+****************************************************************************
+
+    Future improvements/changes:
+
+    * Use CFINV/SETF8/SETF16 when ARMv8.4 flag manipulation is available
+
+    * Keep the UML flags in a register across memory accessor calls
+
+    * Optimize to avoid unnecessary reloads
+
+****************************************************************************
+
+    --------------------------
+    ABI/conventions (AAPCS64)
+    --------------------------
+
+    Registers:
+        x0-x3      - function parameters/results, scratch
+        x9-x12     - scratch (TEMP_REG1-TEMP_REG4)
+        x13-x14    - scratch (flags manipulation)
+        x16-x17    - scratch (SCRATCH_REG1-SCRATCH_REG2)
+        x18        - platform register, never touched
+        x19-x27    - UML registers I0-I8
+        x28        - pointer to the near cache (BASE_REG)
+        x29        - frame pointer
+        x30        - link register
+
+        d8-d15     - UML registers F0-F7
+        d16-d18    - scratch (TEMPF_REG1-TEMPF_REG3)
+
+    Flags:
+        The UML S, Z and V flags are held in the host N, Z and V flags.
+        The host C flag holds the inverse of the UML carry, which is the
+        natural AArch64 borrow convention for subtraction.  Additions
+        invert the host carry after the fact when the carry is needed.
+        FCMP leaves C and V set for unordered results, so the UML U flag
+        is tested through the host V flag.
+
+    Entry point:
+        x0         - near cache base pointer
+        x1         - pointer to the code to execute
+
+    Runtime stack:
+        [sp]       - saved x29
+        [sp+8]     - saved x30
+        [sp+16]    - saved x19-x28
+        [sp+96]    - saved d8-d15
+
+        Code entered through a HANDLE saves x29/x30 below the current
+        stack pointer, so [stacksave-8] is the return address of the
+        outermost subroutine call.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "drcbearm64.h"
+
+#include "debug/debugcpu.h"
+#include "emuopts.h"
+
+#include <cstddef>
+
+
+namespace drc {
+
+using namespace uml;
+
+using namespace asmjit;
+
+
+
+//**************************************************************************
+//  DEBUGGING
+//**************************************************************************
+
+#define LOG_HASHJMPS            (0)
+
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+const uint32_t PTYPE_M    = 1 << parameter::PTYPE_MEMORY;
+const uint32_t PTYPE_I    = 1 << parameter::PTYPE_IMMEDIATE;
+const uint32_t PTYPE_R    = 1 << parameter::PTYPE_INT_REGISTER;
+const uint32_t PTYPE_F    = 1 << parameter::PTYPE_FLOAT_REGISTER;
+//const uint32_t PTYPE_MI   = PTYPE_M | PTYPE_I;
+//const uint32_t PTYPE_RI   = PTYPE_R | PTYPE_I;
+const uint32_t PTYPE_MR   = PTYPE_M | PTYPE_R;
+const uint32_t PTYPE_MRI  = PTYPE_M | PTYPE_R | PTYPE_I;
+const uint32_t PTYPE_MF   = PTYPE_M | PTYPE_F;
+
+const a64::Gp REG_PARAM1   = a64::x0;
+const a64::Gp REG_PARAM2   = a64::x1;
+const a64::Gp REG_PARAM3   = a64::x2;
+const a64::Gp REG_PARAM4   = a64::x3;
+
+const a64::Gp TEMP_REG1    = a64::x9;
+const a64::Gp TEMP_REG2    = a64::x10;
+const a64::Gp TEMP_REG3    = a64::x11;
+const a64::Gp TEMP_REG4    = a64::x12;
+
+const a64::Gp FLAGS_REG    = a64::x13;
+const a64::Gp FLAGS_TEMP   = a64::x14;
+
+const a64::Gp SCRATCH_REG1 = a64::x16;
+const a64::Gp SCRATCH_REG2 = a64::x17;
+
+const a64::Gp BASE_REG     = a64::x28;
+
+const a64::Vec TEMPF_REG1  = a64::d16;
+const a64::Vec TEMPF_REG2  = a64::d17;
+const a64::Vec TEMPF_REG3  = a64::d18;
+
+// host NZCV bits
+const uint64_t NZCV_N      = uint64_t(1) << 31;
+const uint64_t NZCV_Z      = uint64_t(1) << 30;
+const uint64_t NZCV_C      = uint64_t(1) << 29;
+const uint64_t NZCV_V      = uint64_t(1) << 28;
+
+
+
+//**************************************************************************
+//  MACROS
+//**************************************************************************
+
+#define ARM_CONDITION(condition)        (condition_map[condition - uml::COND_Z])
+#define ARM_NOT_CONDITION(condition)    a64::negateCond(condition_map[condition - uml::COND_Z])
+
+#define assert_no_condition(inst)       assert((inst).condition() == uml::COND_ALWAYS)
+#define assert_any_condition(inst)      assert((inst).condition() == uml::COND_ALWAYS || ((inst).condition() >= uml::COND_Z && (inst).condition() < uml::COND_MAX))
+#define assert_no_flags(inst)           assert((inst).flags() == 0)
+#define assert_flags(inst, valid)       assert(((inst).flags() & ~(valid)) == 0)
+
+
+
+//**************************************************************************
+//  GLOBAL VARIABLES
+//**************************************************************************
+
+drcbe_arm64::opcode_generate_func drcbe_arm64::s_opcode_table[OP_MAX];
+
+// register mapping tables; zero means the register lives in memory
+static const uint32_t int_register_map[REG_I_COUNT] =
+{
+	19, 20, 21, 22, 23, 24, 25, 26, 27, 0
+};
+
+static const uint32_t float_register_map[REG_F_COUNT] =
+{
+	// only the low 64 bits of v8-v15 are callee-saved, which is all we need
+	8, 9, 10, 11, 12, 13, 14, 15, 0, 0
+};
+
+// condition mapping table
+static const a64::CondCode condition_map[uml::COND_MAX - uml::COND_Z] =
+{
+	a64::CondCode::kEQ,   // COND_Z = 0x80,    requires Z
+	a64::CondCode::kNE,   // COND_NZ,          requires Z
+	a64::CondCode::kMI,   // COND_S,           requires S
+	a64::CondCode::kPL,   // COND_NS,          requires S
+	a64::CondCode::kCC,   // COND_C,           requires C (host carry is inverted)
+	a64::CondCode::kCS,   // COND_NC,          requires C (host carry is inverted)
+	a64::CondCode::kVS,   // COND_V,           requires V
+	a64::CondCode::kVC,   // COND_NV,          requires V
+	a64::CondCode::kVS,   // COND_U,           requires U
+	a64::CondCode::kVC,   // COND_NU,          requires U
+	a64::CondCode::kHI,   // COND_A,           requires CZ
+	a64::CondCode::kLS,   // COND_BE,          requires CZ
+	a64::CondCode::kGT,   // COND_G,           requires SVZ
+	a64::CondCode::kLE,   // COND_LE,          requires SVZ
+	a64::CondCode::kLT,   // COND_L,           requires SV
+	a64::CondCode::kGE,   // COND_GE,          requires SV
+};
+
+// rounding mode mapping table
+static const uint8_t fprnd_map[4] =
+{
+	3,              // ROUND_TRUNC,   round towards zero (RZ)
+	0,              // ROUND_ROUND,   round to nearest (RN)
+	1,              // ROUND_CEIL,    round towards plus infinity (RP)
+	2               // ROUND_FLOOR    round towards minus infinity (RM)
+};
+
+
+
+//**************************************************************************
+//  TABLES
+//**************************************************************************
+
+const drcbe_arm64::opcode_table_entry drcbe_arm64::s_opcode_table_source[] =
+{
+	// Compile-time opcodes
+	{ uml::OP_HANDLE,  &drcbe_arm64::op_handle },   // HANDLE  handle
+	{ uml::OP_HASH,    &drcbe_arm64::op_hash },     // HASH    mode,pc
+	{ uml::OP_LABEL,   &drcbe_arm64::op_label },    // LABEL   imm
+	{ uml::OP_COMMENT, &drcbe_arm64::op_comment },  // COMMENT string
+	{ uml::OP_MAPVAR,  &drcbe_arm64::op_mapvar },   // MAPVAR  mapvar,value
+
+	// Control Flow Operations
+	{ uml::OP_NOP,     &drcbe_arm64::op_nop },      // NOP
+	{ uml::OP_DEBUG,   &drcbe_arm64::op_debug },    // DEBUG   pc
+	{ uml::OP_EXIT,    &drcbe_arm64::op_exit },     // EXIT    src1[,c]
+	{ uml::OP_HASHJMP, &drcbe_arm64::op_hashjmp },  // HASHJMP mode,pc,handle
+	{ uml::OP_JMP,     &drcbe_arm64::op_jmp },      // JMP     imm[,c]
+	{ uml::OP_EXH,     &drcbe_arm64::op_exh },      // EXH     handle,param[,c]
+	{ uml::OP_CALLH,   &drcbe_arm64::op_callh },    // CALLH   handle[,c]
+	{ uml::OP_RET,     &drcbe_arm64::op_ret },      // RET     [c]
+	{ uml::OP_CALLC,   &drcbe_arm64::op_callc },    // CALLC   func,ptr[,c]
+	{ uml::OP_RECOVER, &drcbe_arm64::op_recover },  // RECOVER dst,mapvar
+
+	// Internal Register Operations
+	{ uml::OP_SETFMOD, &drcbe_arm64::op_setfmod },  // SETFMOD src
+	{ uml::OP_GETFMOD, &drcbe_arm64::op_getfmod },  // GETFMOD dst
+	{ uml::OP_GETEXP,  &drcbe_arm64::op_getexp },   // GETEXP  dst
+	{ uml::OP_GETFLGS, &drcbe_arm64::op_getflgs },  // GETFLGS dst[,f]
+	{ uml::OP_SAVE,    &drcbe_arm64::op_save },     // SAVE    dst
+	{ uml::OP_RESTORE, &drcbe_arm64::op_restore },  // RESTORE dst
+
+	// Integer Operations
+	{ uml::OP_LOAD,    &drcbe_arm64::op_load },     // LOAD    dst,base,index,size
+	{ uml::OP_LOADS,   &drcbe_arm64::op_loads },    // LOADS   dst,base,index,size
+	{ uml::OP_STORE,   &drcbe_arm64::op_store },    // STORE   base,index,src,size
+	{ uml::OP_READ,    &drcbe_arm64::op_read },     // READ    dst,src1,spacesize
+	{ uml::OP_READM,   &drcbe_arm64::op_readm },    // READM   dst,src1,mask,spacesize
+	{ uml::OP_WRITE,   &drcbe_arm64::op_write },    // WRITE   dst,src1,spacesize
+	{ uml::OP_WRITEM,  &drcbe_arm64::op_writem },   // WRITEM  dst,src1,spacesize
+	{ uml::OP_CARRY,   &drcbe_arm64::op_carry },    // CARRY   src,bitnum
+	{ uml::OP_SET,     &drcbe_arm64::op_set },      // SET     dst,c
+	{ uml::OP_MOV,     &drcbe_arm64::op_mov },      // MOV     dst,src[,c]
+	{ uml::OP_SEXT,    &drcbe_arm64::op_sext },     // SEXT    dst,src
+	{ uml::OP_ROLAND,  &drcbe_arm64::op_roland },   // ROLAND  dst,src1,src2,src3
+	{ uml::OP_ROLINS,  &drcbe_arm64::op_rolins },   // ROLINS  dst,src1,src2,src3
+	{ uml::OP_ADD,     &drcbe_arm64::op_add<a64::Inst::kIdAdd> },       // ADD     dst,src1,src2[,f]
+	{ uml::OP_ADDC,    &drcbe_arm64::op_add<a64::Inst::kIdAdc> },       // ADDC    dst,src1,src2[,f]
+	{ uml::OP_SUB,     &drcbe_arm64::op_sub<a64::Inst::kIdSub> },       // SUB     dst,src1,src2[,f]
+	{ uml::OP_SUBB,    &drcbe_arm64::op_sub<a64::Inst::kIdSbc> },       // SUBB    dst,src1,src2[,f]
+	{ uml::OP_CMP,     &drcbe_arm64::op_cmp },      // CMP     src1,src2[,f]
+	{ uml::OP_MULU,    &drcbe_arm64::op_mulu },     // MULU    dst,edst,src1,src2[,f]
+	{ uml::OP_MULS,    &drcbe_arm64::op_muls },     // MULS    dst,edst,src1,src2[,f]
+	{ uml::OP_DIVU,    &drcbe_arm64::op_divu },     // DIVU    dst,edst,src1,src2[,f]
+	{ uml::OP_DIVS,    &drcbe_arm64::op_divs },     // DIVS    dst,edst,src1,src2[,f]
+	{ uml::OP_AND,     &drcbe_arm64::op_and },      // AND     dst,src1,src2[,f]
+	{ uml::OP_TEST,    &drcbe_arm64::op_test },     // TEST    src1,src2[,f]
+	{ uml::OP_OR,      &drcbe_arm64::op_logical<a64::Inst::kIdOrr> },   // OR      dst,src1,src2[,f]
+	{ uml::OP_XOR,     &drcbe_arm64::op_logical<a64::Inst::kIdEor> },   // XOR     dst,src1,src2[,f]
+	{ uml::OP_LZCNT,   &drcbe_arm64::op_lzcnt },    // LZCNT   dst,src[,f]
+	{ uml::OP_TZCNT,   &drcbe_arm64::op_tzcnt },    // TZCNT   dst,src[,f]
+	{ uml::OP_BSWAP,   &drcbe_arm64::op_bswap },    // BSWAP   dst,src
+	{ uml::OP_SHL,     &drcbe_arm64::op_shift<a64::Inst::kIdLsl> },     // SHL     dst,src,count[,f]
+	{ uml::OP_SHR,     &drcbe_arm64::op_shift<a64::Inst::kIdLsr> },     // SHR     dst,src,count[,f]
+	{ uml::OP_SAR,     &drcbe_arm64::op_shift<a64::Inst::kIdAsr> },     // SAR     dst,src,count[,f]
+	{ uml::OP_ROL,     &drcbe_arm64::op_rol },      // ROL     dst,src,count[,f]
+	{ uml::OP_ROLC,    &drcbe_arm64::op_rolc },     // ROLC    dst,src,count[,f]
+	{ uml::OP_ROR,     &drcbe_arm64::op_shift<a64::Inst::kIdRor> },     // ROR     dst,src,count[,f]
+	{ uml::OP_RORC,    &drcbe_arm64::op_rorc },     // RORC    dst,src,count[,f]
+
+	// Floating Point Operations
+	{ uml::OP_FLOAD,   &drcbe_arm64::op_fload },    // FLOAD   dst,base,index
+	{ uml::OP_FSTORE,  &drcbe_arm64::op_fstore },   // FSTORE  base,index,src
+	{ uml::OP_FREAD,   &drcbe_arm64::op_fread },    // FREAD   dst,space,src1
+	{ uml::OP_FWRITE,  &drcbe_arm64::op_fwrite },   // FWRITE  space,dst,src1
+	{ uml::OP_FMOV,    &drcbe_arm64::op_fmov },     // FMOV    dst,src1[,c]
+	{ uml::OP_FTOINT,  &drcbe_arm64::op_ftoint },   // FTOINT  dst,src1,size,round
+	{ uml::OP_FFRINT,  &drcbe_arm64::op_ffrint },   // FFRINT  dst,src1,size
+	{ uml::OP_FFRFLT,  &drcbe_arm64::op_ffrflt },   // FFRFLT  dst,src1,size
+	{ uml::OP_FRNDS,   &drcbe_arm64::op_frnds },    // FRNDS   dst,src1
+	{ uml::OP_FADD,    &drcbe_arm64::op_float_alu<a64::Inst::kIdFadd_v> },     // FADD    dst,src1,src2
+	{ uml::OP_FSUB,    &drcbe_arm64::op_float_alu<a64::Inst::kIdFsub_v> },     // FSUB    dst,src1,src2
+	{ uml::OP_FCMP,    &drcbe_arm64::op_fcmp },     // FCMP    src1,src2
+	{ uml::OP_FMUL,    &drcbe_arm64::op_float_alu<a64::Inst::kIdFmul_v> },     // FMUL    dst,src1,src2
+	{ uml::OP_FDIV,    &drcbe_arm64::op_float_alu<a64::Inst::kIdFdiv_v> },     // FDIV    dst,src1,src2
+	{ uml::OP_FNEG,    &drcbe_arm64::op_float_alu2<a64::Inst::kIdFneg_v> },    // FNEG    dst,src1
+	{ uml::OP_FABS,    &drcbe_arm64::op_float_alu2<a64::Inst::kIdFabs_v> },    // FABS    dst,src1
+	{ uml::OP_FSQRT,   &drcbe_arm64::op_float_alu2<a64::Inst::kIdFsqrt_v> },   // FSQRT   dst,src1
+	{ uml::OP_FRECIP,  &drcbe_arm64::op_frecip },   // FRECIP  dst,src1
+	{ uml::OP_FRSQRT,  &drcbe_arm64::op_frsqrt },   // FRSQRT  dst,src1
+	{ uml::OP_FCOPYI,  &drcbe_arm64::op_fcopyi },   // FCOPYI  dst,src
+	{ uml::OP_ICOPYF,  &drcbe_arm64::op_icopyf },   // ICOPYF  dst,src
+
+	// Vector Operations
+	{ uml::OP_VMOV,    &drcbe_arm64::op_vector },   // VMOV    dst,src
+	{ uml::OP_VADD,    &drcbe_arm64::op_vector },   // VADD    dst,src1,src2
+	{ uml::OP_VSUB,    &drcbe_arm64::op_vector },   // VSUB    dst,src1,src2
+	{ uml::OP_VADDS,   &drcbe_arm64::op_vector },   // VADDS   dst,src1,src2
+	{ uml::OP_VSUBS,   &drcbe_arm64::op_vector },   // VSUBS   dst,src1,src2
+	{ uml::OP_VMULL,   &drcbe_arm64::op_vector },   // VMULL   dst,src1,src2
+	{ uml::OP_VMULH,   &drcbe_arm64::op_vector },   // VMULH   dst,src1,src2
+	{ uml::OP_VMULHU,  &drcbe_arm64::op_vector },   // VMULHU  dst,src1,src2
+	{ uml::OP_VCMPEQ,  &drcbe_arm64::op_vector },   // VCMPEQ  dst,src1,src2
+	{ uml::OP_VCMPLT,  &drcbe_arm64::op_vector },   // VCMPLT  dst,src1,src2
+	{ uml::OP_VSEL,    &drcbe_arm64::op_vector }    // VSEL    dst,mask,src1,src2
+};
+
+class ThrowableErrorHandler : public ErrorHandler
+{
+public:
+	void handleError(Error err, const char *message, BaseEmitter *origin) override
+	{
+		throw emu_fatalerror("asmjit error %d: %s", err, message);
+	}
+};
+
+
+//**************************************************************************
+//  INLINE FUNCTIONS
+//**************************************************************************
+
+//-------------------------------------------------
+//  is_contiguous_mask - return true if the mask
+//  is a single run of set bits, along with the
+//  position and length of the run
+//-------------------------------------------------
+
+static inline bool is_contiguous_mask(uint64_t mask, int &lsb, int &width)
+{
+	if (mask == 0)
+		return false;
+
+	lsb = population_count_64((mask & -mask) - 1);
+	width = population_count_64(mask);
+
+	uint64_t const run = mask >> lsb;
+	return (run & (run + 1)) == 0;
+}
+
+
+//-------------------------------------------------
+//  select_size - return the W/X or S/D view of
+//  a register for the given operand size
+//-------------------------------------------------
+
+static inline a64::Gp select_size(a64::Gp const &reg, uint32_t regsize)
+{
+	return (regsize == 4) ? a64::Gp(reg.w()) : a64::Gp(reg.x());
+}
+
+static inline a64::Vec select_size(a64::Vec const &reg, uint32_t regsize)
+{
+	return (regsize == 4) ? a64::Vec(reg.s()) : a64::Vec(reg.d());
+}
+
+
+//-------------------------------------------------
+//  param_normalize - convert a full parameter
+//  into a reduced set
+//-------------------------------------------------
+
+drcbe_arm64::be_parameter::be_parameter(drcbe_arm64 &drcbe, const parameter &param, uint32_t allowed)
+{
+	int regnum;
+
+	switch (param.type())
+	{
+		// immediates pass through
+		case parameter::PTYPE_IMMEDIATE:
+			assert(allowed & PTYPE_I);
+			*this = param.immediate();
+			break;
+
+		// memory passes through
+		case parameter::PTYPE_MEMORY:
+			assert(allowed & PTYPE_M);
+			*this = make_memory(param.memory());
+			break;
+
+		// if a register maps to a register, keep it as a register; otherwise map it to memory
+		case parameter::PTYPE_INT_REGISTER:
+			assert(allowed & PTYPE_R);
+			assert(allowed & PTYPE_M);
+			regnum = int_register_map[param.ireg() - REG_I0];
+			if (regnum != 0)
+				*this = make_ireg(regnum);
+			else
+				*this = make_memory(&drcbe.m_state.r[param.ireg() - REG_I0]);
+			break;
+
+		// if a register maps to a register, keep it as a register; otherwise map it to memory
+		case parameter::PTYPE_FLOAT_REGISTER:
+			assert(allowed & PTYPE_F);
+			assert(allowed & PTYPE_M);
+			regnum = float_register_map[param.freg() - REG_F0];
+			if (regnum != 0)
+				*this = make_freg(regnum);
+			else
+				*this = make_memory(&drcbe.m_state.f[param.freg() - REG_F0]);
+			break;
+
+		// everything else is unexpected
+		default:
+			fatalerror("Unexpected parameter type\n");
+	}
+}
+
+
+//-------------------------------------------------
+//  get_register_int/get_register_float - return
+//  the native register sized for the operation
+//-------------------------------------------------
+
+inline a64::Gp drcbe_arm64::be_parameter::get_register_int(uint32_t regsize) const
+{
+	assert(m_type == PTYPE_INT_REGISTER);
+	return (regsize == 4) ? a64::Gp(a64::GpW(m_value)) : a64::Gp(a64::GpX(m_value));
+}
+
+inline a64::Vec drcbe_arm64::be_parameter::get_register_float(uint32_t regsize) const
+{
+	assert(m_type == PTYPE_FLOAT_REGISTER);
+	return (regsize == 4) ? a64::Vec(a64::VecS(m_value)) : a64::Vec(a64::VecD(m_value));
+}
+
+
+//-------------------------------------------------
+//  select_register - select a register to use,
+//  avoiding conflicts with the optional
+//  checkparam
+//-------------------------------------------------
+
+inline a64::Gp drcbe_arm64::be_parameter::select_register(a64::Gp const &defreg, uint32_t regsize) const
+{
+	if (m_type == PTYPE_INT_REGISTER)
+		return get_register_int(regsize);
+	return (regsize == 4) ? a64::Gp(defreg.w()) : a64::Gp(defreg.x());
+}
+
+inline a64::Vec drcbe_arm64::be_parameter::select_register(a64::Vec const &defreg, uint32_t regsize) const
+{
+	if (m_type == PTYPE_FLOAT_REGISTER)
+		return get_register_float(regsize);
+	return (regsize == 4) ? a64::Vec(defreg.s()) : a64::Vec(defreg.d());
+}
+
+
+//-------------------------------------------------
+//  normalize_commutative - reorder parameters of
+//  a commutative operation so that an immediate
+//  ends up in the second operand
+//-------------------------------------------------
+
+inline void drcbe_arm64::normalize_commutative(be_parameter &inner, be_parameter &outer)
+{
+	// if the inner value is immediate, swap them
+	if (inner.is_immediate() && !outer.is_immediate())
+	{
+		be_parameter temp = inner;
+		inner = outer;
+		outer = temp;
+	}
+}
+
+
+//-------------------------------------------------
+//  is_base_relative - return true if the pointer
+//  can be reached with an immediate offset from
+//  the base register for an access of the given
+//  size
+//-------------------------------------------------
+
+inline bool drcbe_arm64::is_base_relative(const void *ptr, int size) const
+{
+	int64_t const delta = reinterpret_cast<const uint8_t *>(ptr) - m_baseptr;
+
+	// unscaled signed 9-bit offset
+	if (is_valid_immediate_signed(delta, 9))
+		return true;
+
+	// scaled unsigned 12-bit offset
+	return (delta >= 0) && !(delta & (size - 1)) && is_valid_immediate(delta / size, 12);
+}
+
+
+//-------------------------------------------------
+//  get_imm_relative - load a pointer into a
+//  register using the shortest sequence
+//  available
+//-------------------------------------------------
+
+void drcbe_arm64::get_imm_relative(a64::Assembler &a, a64::Gp const &reg, uint64_t ptr) const
+{
+	uint64_t const codeoffs = a.code()->baseAddress() + a.offset();
+	int64_t const reldiff = int64_t(ptr) - int64_t(codeoffs);
+	int64_t const reldiffpage = int64_t(ptr >> 12) - int64_t(codeoffs >> 12);
+	int64_t const basediff = int64_t(ptr) - int64_t(uintptr_t(m_baseptr));
+
+	if (is_valid_immediate_signed(reldiff, 21))
+	{
+		a.adr(reg.x(), Imm(ptr));                                                       // adr   reg,ptr
+	}
+	else if ((basediff >= 0) && is_valid_immediate_addsub(basediff))
+	{
+		a.add(reg.x(), BASE_REG, basediff);                                             // add   reg,base,#basediff
+	}
+	else if ((basediff < 0) && is_valid_immediate_addsub(-basediff))
+	{
+		a.sub(reg.x(), BASE_REG, -basediff);                                            // sub   reg,base,#-basediff
+	}
+	else if (is_valid_immediate_signed(reldiffpage, 21))
+	{
+		a.adrp(reg.x(), Imm(ptr & ~uint64_t(0xfff)));                                   // adrp  reg,ptr
+		if (ptr & 0xfff)
+			a.add(reg.x(), reg.x(), ptr & 0xfff);                                       // add   reg,reg,#ptr & 0xfff
+	}
+	else
+	{
+		a.mov(reg.x(), ptr);                                                            // mov   reg,ptr
+	}
+}
+
+
+//-------------------------------------------------
+//  emit_ldr_str_base_mem - emit a load or store
+//  of an absolute address, using the base
+//  register or a page-relative address where
+//  possible
+//-------------------------------------------------
+
+void drcbe_arm64::emit_ldr_str_base_mem(a64::Assembler &a, a64::Inst::Id opcode, a64::Reg const &reg, const void *ptr) const
+{
+	// determine the access size from the opcode and register
+	int size;
+	switch (opcode)
+	{
+		case a64::Inst::kIdLdrb:
+		case a64::Inst::kIdLdrsb:
+		case a64::Inst::kIdStrb:
+			size = 1;
+			break;
+
+		case a64::Inst::kIdLdrh:
+		case a64::Inst::kIdLdrsh:
+		case a64::Inst::kIdStrh:
+			size = 2;
+			break;
+
+		case a64::Inst::kIdLdrsw:
+			size = 4;
+			break;
+
+		default:
+			size = reg.size();
+			break;
+	}
+
+	// near cache relative
+	if (is_base_relative(ptr, size))
+	{
+		a.emit(opcode, reg, arm::Mem(BASE_REG, int32_t(reinterpret_cast<const uint8_t *>(ptr) - m_baseptr)));
+		return;
+	}
+
+	// page relative with the low bits folded into the access
+	uint64_t const addr = uintptr_t(ptr);
+	uint64_t const codeoffs = a.code()->baseAddress() + a.offset();
+	int64_t const reldiffpage = int64_t(addr >> 12) - int64_t(codeoffs >> 12);
+	if (is_valid_immediate_signed(reldiffpage, 21) && !(addr & (size - 1)))
+	{
+		a.adrp(SCRATCH_REG2, Imm(addr & ~uint64_t(0xfff)));                             // adrp  scratch,ptr
+		a.emit(opcode, reg, arm::Mem(SCRATCH_REG2, int32_t(addr & 0xfff)));             // op    reg,[scratch,#ptr & 0xfff]
+		return;
+	}
+
+	// general case
+	get_imm_relative(a, SCRATCH_REG2, addr);
+	a.emit(opcode, reg, arm::Mem(SCRATCH_REG2));                                        // op    reg,[scratch]
+}
+
+void drcbe_arm64::emit_ldr_mem(a64::Assembler &a, a64::Gp const &reg, const void *ptr) const { emit_ldr_str_base_mem(a, a64::Inst::kIdLdr, reg, ptr); }
+void drcbe_arm64::emit_ldrb_mem(a64::Assembler &a, a64::Gp const &reg, const void *ptr) const { emit_ldr_str_base_mem(a, a64::Inst::kIdLdrb, reg, ptr); }
+void drcbe_arm64::emit_str_mem(a64::Assembler &a, a64::Gp const &reg, const void *ptr) const { emit_ldr_str_base_mem(a, a64::Inst::kIdStr, reg, ptr); }
+void drcbe_arm64::emit_strb_mem(a64::Assembler &a, a64::Gp const &reg, const void *ptr) const { emit_ldr_str_base_mem(a, a64::Inst::kIdStrb, reg, ptr); }
+void drcbe_arm64::emit_float_ldr_mem(a64::Assembler &a, a64::Vec const &reg, const void *ptr) const { emit_ldr_str_base_mem(a, a64::Inst::kIdLdr_v, reg, ptr); }
+void drcbe_arm64::emit_float_str_mem(a64::Assembler &a, a64::Vec const &reg, const void *ptr) const { emit_ldr_str_base_mem(a, a64::Inst::kIdStr_v, reg, ptr); }
+
+
+//-------------------------------------------------
+//  emit_ldr_str_indexed - emit a load or store
+//  of a base pointer plus a scaled, sign-extended
+//  32-bit index
+//-------------------------------------------------
+
+void drcbe_arm64::emit_ldr_str_indexed(a64::Assembler &a, a64::Inst::Id opcode, a64::Reg const &reg, be_parameter const &basep, be_parameter const &indp, int size, int scale) const
+{
+	// immediate index: the address is known at compile time
+	if (indp.is_immediate())
+	{
+		int64_t const offset = int64_t(int32_t(indp.immediate())) << scale;
+		emit_ldr_str_base_mem(a, opcode, reg, reinterpret_cast<const uint8_t *>(basep.memory()) + offset);
+		return;
+	}
+
+	get_imm_relative(a, SCRATCH_REG1, uintptr_t(basep.memory()));                       // mov   scratch1,basep
+	a64::Gp const indreg = get_src_reg(a, 4, indp, SCRATCH_REG2);
+
+	// the register offset form can only scale by the access size
+	if ((scale == 0) || (scale == size))
+	{
+		a.emit(opcode, reg, a64::ptr(SCRATCH_REG1, indreg, a64::sxtw(scale)));          // op    reg,[scratch1,indreg,sxtw #scale]
+	}
+	else
+	{
+		a.sxtw(SCRATCH_REG2, indreg);                                                   // sxtw  scratch2,indreg
+		a.add(SCRATCH_REG1, SCRATCH_REG1, SCRATCH_REG2, a64::lsl(scale));               // add   scratch1,scratch1,scratch2,lsl #scale
+		a.emit(opcode, reg, a64::ptr(SCRATCH_REG1));                                    // op    reg,[scratch1]
+	}
+}
+
+
+//-------------------------------------------------
+//  emit_skip - branch to the label if the
+//  condition is not satisfied
+//-------------------------------------------------
+
+void drcbe_arm64::emit_skip(a64::Assembler &a, uml::condition_t cond, Label &skip) const
+{
+	if (cond != uml::COND_ALWAYS)
+		a.b(ARM_NOT_CONDITION(cond), skip);                                             // b.!cc skip
+}
+
+
+//-------------------------------------------------
+//  emit_branch - jump or call to an absolute
+//  address, directly if it is within range
+//-------------------------------------------------
+
+void drcbe_arm64::emit_branch(a64::Assembler &a, const void *target, bool link) const
+{
+	uint64_t const codeoffs = a.code()->baseAddress() + a.offset();
+	int64_t const reldiff = int64_t(uintptr_t(target)) - int64_t(codeoffs);
+
+	if (is_valid_immediate_signed(reldiff, 28))
+	{
+		if (link)
+			a.bl(Imm(uintptr_t(target)));                                               // bl    target
+		else
+			a.b(Imm(uintptr_t(target)));                                                // b     target
+	}
+	else
+	{
+		get_imm_relative(a, SCRATCH_REG1, uintptr_t(target));
+		if (link)
+			a.blr(SCRATCH_REG1);                                                        // blr   scratch
+		else
+			a.br(SCRATCH_REG1);                                                         // br    scratch
+	}
+}
+
+
+//-------------------------------------------------
+//  emit_call_handle - call through a code handle,
+//  directly if it has already been resolved
+//-------------------------------------------------
+
+void drcbe_arm64::emit_call_handle(a64::Assembler &a, code_handle &handle) const
+{
+	drccodeptr *const targetptr = handle.codeptr_addr();
+	if (*targetptr != nullptr)
+	{
+		call_arm_addr(a, *targetptr);                                                   // bl    *targetptr
+	}
+	else
+	{
+		emit_ldr_mem(a, SCRATCH_REG1, targetptr);                                       // ldr   scratch,[targetptr]
+		a.blr(SCRATCH_REG1);                                                            // blr   scratch
+	}
+}
+
+
+//-------------------------------------------------
+//  flip_carry - invert the host carry flag
+//-------------------------------------------------
+
+void drcbe_arm64::flip_carry(a64::Assembler &a) const
+{
+	a.mrs(FLAGS_REG, Imm(a64::Predicate::SysReg::kNZCV));                               // mrs   flags,nzcv
+	a.eor(FLAGS_REG, FLAGS_REG, NZCV_C);                                                // eor   flags,flags,#C
+	a.msr(Imm(a64::Predicate::SysReg::kNZCV), FLAGS_REG);                               // msr   nzcv,flags
+}
+
+
+//-------------------------------------------------
+//  store_carry_reg - set the UML carry flag from
+//  bit 0 of a register
+//-------------------------------------------------
+
+void drcbe_arm64::store_carry_reg(a64::Assembler &a, a64::Gp const &reg) const
+{
+	assert(reg.id() != FLAGS_REG.id());
+
+	a.eor(FLAGS_TEMP, reg.x(), 1);                                                      // eor   temp,reg,#1
+	a.mrs(FLAGS_REG, Imm(a64::Predicate::SysReg::kNZCV));                               // mrs   flags,nzcv
+	a.bfi(FLAGS_REG, FLAGS_TEMP, 29, 1);                                                // bfi   flags,temp,#29,#1
+	a.msr(Imm(a64::Predicate::SysReg::kNZCV), FLAGS_REG);                               // msr   nzcv,flags
+}
+
+
+//-------------------------------------------------
+//  store_overflow_reg - set the UML overflow flag
+//  from bit 0 of a register
+//-------------------------------------------------
+
+void drcbe_arm64::store_overflow_reg(a64::Assembler &a, a64::Gp const &reg) const
+{
+	assert(reg.id() != FLAGS_REG.id());
+
+	a.mrs(FLAGS_REG, Imm(a64::Predicate::SysReg::kNZCV));                               // mrs   flags,nzcv
+	a.bfi(FLAGS_REG, reg.x(), 28, 1);                                                   // bfi   flags,reg,#28,#1
+	a.msr(Imm(a64::Predicate::SysReg::kNZCV), FLAGS_REG);                               // msr   nzcv,flags
+}
+
+
+//-------------------------------------------------
+//  set_rounding_mode - set the host rounding mode
+//  from a register holding a UML rounding mode
+//-------------------------------------------------
+
+void drcbe_arm64::set_rounding_mode(a64::Assembler &a, a64::Gp const &mode) const
+{
+	get_imm_relative(a, SCRATCH_REG2, uintptr_t(&m_near.fprmode[0]));
+	a.ldrb(FLAGS_TEMP.w(), arm::Mem(SCRATCH_REG2, mode.x()));                           // ldrb  temp,fprmode[mode]
+	a.mrs(FLAGS_REG, Imm(a64::Predicate::SysReg::kFPCR));                               // mrs   flags,fpcr
+	a.bfi(FLAGS_REG, FLAGS_TEMP, 22, 2);                                                // bfi   flags,temp,#22,#2
+	a.msr(Imm(a64::Predicate::SysReg::kFPCR), FLAGS_REG);                               // msr   fpcr,flags
+}
+
+
+//-------------------------------------------------
+//  is_valid_immediate_logical - return true if
+//  the value can be encoded as a logical
+//  immediate for the given register size
+//-------------------------------------------------
+
+bool drcbe_arm64::is_valid_immediate_logical(uint64_t val, uint32_t regsize)
+{
+	if (regsize == 4)
+		return a64::Utils::isLogicalImm(uint32_t(val), 32);
+	else
+		return a64::Utils::isLogicalImm(val, 64);
+}
+
+
+//-------------------------------------------------
+//  get_src_reg - return a register holding the
+//  parameter, loading it into the temporary if
+//  needed
+//-------------------------------------------------
+
+a64::Gp drcbe_arm64::get_src_reg(a64::Assembler &a, uint32_t regsize, be_parameter const &param, a64::Gp const &tmp) const
+{
+	if (param.is_int_register())
+		return param.get_register_int(regsize);
+
+	if (param.is_immediate_value(0))
+		return (regsize == 4) ? a64::Gp(a64::wzr) : a64::Gp(a64::xzr);
+
+	a64::Gp const reg = (regsize == 4) ? a64::Gp(tmp.w()) : a64::Gp(tmp.x());
+	mov_reg_param(a, regsize, reg, param);
+	return reg;
+}
+
+
+//-------------------------------------------------
+//  mov_reg_param - move a parameter into a
+//  register
+//-------------------------------------------------
+
+void drcbe_arm64::mov_reg_param(a64::Assembler &a, uint32_t regsize, a64::Gp const &dst, be_parameter const &src) const
+{
+	a64::Gp const dstreg = (regsize == 4) ? a64::Gp(dst.w()) : a64::Gp(dst.x());
+
+	if (src.is_immediate())
+	{
+		mov_r64_imm(a, dstreg, (regsize == 4) ? uint32_t(src.immediate()) : src.immediate());
+	}
+	else if (src.is_int_register())
+	{
+		if (dst.id() != src.ireg())
+			a.mov(dstreg, src.get_register_int(regsize));                               // mov   dst,src
+	}
+	else if (src.is_memory())
+	{
+		emit_ldr_mem(a, dstreg, src.memory());                                          // ldr   dst,[src]
+	}
+}
+
+
+//-------------------------------------------------
+//  mov_param_reg - move a register into a
+//  parameter
+//-------------------------------------------------
+
+void drcbe_arm64::mov_param_reg(a64::Assembler &a, uint32_t regsize, be_parameter const &dst, a64::Gp const &src) const
+{
+	assert(!dst.is_immediate());
+
+	a64::Gp const srcreg = (regsize == 4) ? a64::Gp(src.w()) : a64::Gp(src.x());
+
+	if (dst.is_int_register())
+	{
+		if (src.id() != dst.ireg())
+			a.mov(dst.get_register_int(regsize), srcreg);                               // mov   dst,src
+	}
+	else if (dst.is_memory())
+	{
+		emit_str_mem(a, srcreg, dst.memory());                                          // str   src,[dst]
+	}
+}
+
+
+//-------------------------------------------------
+//  mov_float_reg_param - move a float parameter
+//  into a register
+//-------------------------------------------------
+
+void drcbe_arm64::mov_float_reg_param(a64::Assembler &a, uint32_t regsize, a64::Vec const &dst, be_parameter const &src) const
+{
+	assert(!src.is_immediate());
+
+	a64::Vec const dstreg = (regsize == 4) ? a64::Vec(dst.s()) : a64::Vec(dst.d());
+
+	if (src.is_float_register())
+	{
+		if (dst.id() != src.freg())
+			a.fmov(dstreg, src.get_register_float(regsize));                            // fmov  dst,src
+	}
+	else if (src.is_memory())
+	{
+		emit_float_ldr_mem(a, dstreg, src.memory());                                    // ldr   dst,[src]
+	}
+}
+
+
+//-------------------------------------------------
+//  mov_float_param_reg - move a register into a
+//  float parameter
+//-------------------------------------------------
+
+void drcbe_arm64::mov_float_param_reg(a64::Assembler &a, uint32_t regsize, be_parameter const &dst, a64::Vec const &src) const
+{
+	assert(!dst.is_immediate());
+
+	a64::Vec const srcreg = (regsize == 4) ? a64::Vec(src.s()) : a64::Vec(src.d());
+
+	if (dst.is_float_register())
+	{
+		if (src.id() != dst.freg())
+			a.fmov(dst.get_register_float(regsize), srcreg);                            // fmov  dst,src
+	}
+	else if (dst.is_memory())
+	{
+		emit_float_str_mem(a, srcreg, dst.memory());                                    // str   src,[dst]
+	}
+}
+
+
+//-------------------------------------------------
+//  mov_r64_imm - move an immediate into a
+//  register using the shortest sequence
+//-------------------------------------------------
+
+void drcbe_arm64::mov_r64_imm(a64::Assembler &a, a64::Gp const &dst, uint64_t imm) const
+{
+	if (dst.isGpW())
+		a.mov(dst, uint32_t(imm));                                                      // mov   dst,imm
+	else if (uint32_t(imm) == imm)
+		a.mov(dst.w(), uint32_t(imm));                                                  // mov   dst,imm
+	else
+		a.mov(dst, imm);                                                                // mov   dst,imm
+}
+
+
+
+//-------------------------------------------------
+//  debug_log_hashjmp - callback to handle
+//  logging of hashjmps
+//-------------------------------------------------
+
+void drcbe_arm64::debug_log_hashjmp(offs_t pc, int mode)
+{
+	printf("mode=%d PC=%08X\n", mode, pc);
+}
+
+
+//-------------------------------------------------
+//  debug_log_hashjmp_fail - callback to handle
+//  logging of hashjmp failures
+//-------------------------------------------------
+
+void drcbe_arm64::debug_log_hashjmp_fail()
+{
+	printf("  (FAIL)\n");
+}
+
+
+
+//**************************************************************************
+//  BACKEND CALLBACKS
+//**************************************************************************
+
+//-------------------------------------------------
+//  drcbe_arm64 - constructor
+//-------------------------------------------------
+
+drcbe_arm64::drcbe_arm64(drcuml_state &drcuml, device_t &device, drc_cache &cache, uint32_t flags, int modes, int addrbits, int ignorebits)
+	: drcbe_interface(drcuml, cache, device)
+	, m_hash(cache, modes, addrbits, ignorebits)
+	, m_map(cache, 0xaaaaaaaa5555)
+	, m_log_asmjit(nullptr)
+	, m_baseptr(cache.near())
+	, m_entry(nullptr)
+	, m_exit(nullptr)
+	, m_nocode(nullptr)
+	, m_near(*(near_state *)cache.alloc_near(sizeof(m_near)))
+{
+	// build up necessary arrays
+	memcpy(m_near.fprmode, fprnd_map, sizeof(m_near.fprmode));
+
+	// get pointers to C functions we need to call
+	using debugger_hook_func = void (*)(device_debug *, offs_t);
+	static const debugger_hook_func debugger_inst_hook = [] (device_debug *dbg, offs_t pc) { dbg->instruction_hook(pc); }; // TODO: kill trampoline if possible
+	m_near.debug_cpu_instruction_hook = (void *)debugger_inst_hook;
+	if (LOG_HASHJMPS)
+	{
+		m_near.debug_log_hashjmp = (void *)debug_log_hashjmp;
+		m_near.debug_log_hashjmp_fail = (void *)debug_log_hashjmp_fail;
+	}
+	m_near.drcmap_get_value = (void *)&drc_map_variables::static_get_value;
+
+	// build the flags map; index is the host NZCV value shifted right by 28
+	for (int entry = 0; entry < std::size(m_near.flagsmap); entry++)
+	{
+		uint8_t flags = 0;
+		if (!(entry & 0x2)) flags |= FLAG_C;
+		if (entry & 0x1) flags |= FLAG_V | FLAG_U;
+		if (entry & 0x4) flags |= FLAG_Z;
+		if (entry & 0x8) flags |= FLAG_S;
+		m_near.flagsmap[entry] = flags;
+	}
+	for (int entry = 0; entry < std::size(m_near.flagsunmap); entry++)
+	{
+		uint64_t flags = 0;
+		if (!(entry & FLAG_C)) flags |= NZCV_C;
+		if (entry & (FLAG_V | FLAG_U)) flags |= NZCV_V;
+		if (entry & FLAG_Z) flags |= NZCV_Z;
+		if (entry & FLAG_S) flags |= NZCV_N;
+		m_near.flagsunmap[entry] = flags;
+	}
+
+	// resolve the actual addresses of the address space handlers
+	auto const resolve_accessor =
+			[] (resolved_handler &handler, address_space &space, auto accessor)
+			{
+				if (MAME_DELEGATE_USE_TYPE == MAME_DELEGATE_TYPE_ITANIUM)
+				{
+					// the ARM variant keeps the virtual flag in the low bit of the adjustment
+					struct { uintptr_t ptr; ptrdiff_t adj; } equiv;
+					assert(sizeof(accessor) == sizeof(equiv));
+					*reinterpret_cast<decltype(accessor) *>(&equiv) = accessor;
+					handler.obj = uintptr_t(reinterpret_cast<u8 *>(&space) + (equiv.adj >> 1));
+					if (BIT(equiv.adj, 0))
+					{
+						auto const vptr = *reinterpret_cast<u8 const *const *>(handler.obj) + equiv.ptr;
+						handler.func = *reinterpret_cast<drccodeptr const *>(vptr);
+					}
+					else
+					{
+						handler.func = reinterpret_cast<drccodeptr>(equiv.ptr);
+					}
+				}
+				else if (MAME_DELEGATE_USE_TYPE == MAME_DELEGATE_TYPE_MSVC)
+				{
+					// interpret the pointer to member function ignoring the virtual inheritance variant
+					struct single { uintptr_t ptr; };
+					struct multi { uintptr_t ptr; int adj; };
+					struct { uintptr_t ptr; int adj; int vadj; int vindex; } unknown;
+					assert(sizeof(accessor) <= sizeof(unknown));
+					*reinterpret_cast<decltype(accessor) *>(&unknown) = accessor;
+					handler.func = reinterpret_cast<drccodeptr>(unknown.ptr);
+					handler.obj = uintptr_t(&space);
+					if ((sizeof(unknown) == sizeof(accessor)) && unknown.vindex)
+					{
+						handler.obj += unknown.vadj;
+						auto const vptr = *reinterpret_cast<std::uint8_t const *const *>(handler.obj);
+						handler.obj += *reinterpret_cast<int const *>(vptr + unknown.vindex);
+					}
+					if (sizeof(single) < sizeof(accessor))
+						handler.obj += unknown.adj;
+
+					// virtual call thunks are left in place; they dispatch correctly given the object
+				}
+			};
+	m_resolved_accessors.resize(m_space.size());
+	for (int space = 0; m_space.size() > space; ++space)
+	{
+		if (m_space[space])
+		{
+			resolve_accessor(m_resolved_accessors[space].read_byte,         *m_space[space], static_cast<u8  (address_space::*)(offs_t)     >(&address_space::read_byte));
+			resolve_accessor(m_resolved_accessors[space].read_word,         *m_space[space], static_cast<u16 (address_space::*)(offs_t)     >(&address_space::read_word));
+			resolve_accessor(m_resolved_accessors[space].read_word_masked,  *m_space[space], static_cast<u16 (address_space::*)(offs_t, u16)>(&address_space::read_word));
+			resolve_accessor(m_resolved_accessors[space].read_dword,        *m_space[space], static_cast<u32 (address_space::*)(offs_t)     >(&address_space::read_dword));
+			resolve_accessor(m_resolved_accessors[space].read_dword_masked, *m_space[space], static_cast<u32 (address_space::*)(offs_t, u32)>(&address_space::read_dword));
+			resolve_accessor(m_resolved_accessors[space].read_qword,        *m_space[space], static_cast<u64 (address_space::*)(offs_t)     >(&address_space::read_qword));
+			resolve_accessor(m_resolved_accessors[space].read_qword_masked, *m_space[space], static_cast<u64 (address_space::*)(offs_t, u64)>(&address_space::read_qword));
+
+			resolve_accessor(m_resolved_accessors[space].write_byte,         *m_space[space], static_cast<void (address_space::*)(offs_t, u8)      >(&address_space::write_byte));
+			resolve_accessor(m_resolved_accessors[space].write_word,         *m_space[space], static_cast<void (address_space::*)(offs_t, u16)     >(&address_space::write_word));
+			resolve_accessor(m_resolved_accessors[space].write_word_masked,  *m_space[space], static_cast<void (address_space::*)(offs_t, u16, u16)>(&address_space::write_word));
+			resolve_accessor(m_resolved_accessors[space].write_dword,        *m_space[space], static_cast<void (address_space::*)(offs_t, u32)     >(&address_space::write_dword));
+			resolve_accessor(m_resolved_accessors[space].write_dword_masked, *m_space[space], static_cast<void (address_space::*)(offs_t, u32, u32)>(&address_space::write_dword));
+			resolve_accessor(m_resolved_accessors[space].write_qword,        *m_space[space], static_cast<void (address_space::*)(offs_t, u64)     >(&address_space::write_qword));
+			resolve_accessor(m_resolved_accessors[space].write_qword_masked, *m_space[space], static_cast<void (address_space::*)(offs_t, u64, u64)>(&address_space::write_qword));
+		}
+	}
+
+	// build the opcode table (static but it doesn't hurt to regenerate it)
+	for (auto & elem : s_opcode_table_source)
+		s_opcode_table[elem.opcode] = elem.func;
+
+	// create the log
+	if (device.machine().options().drc_log_native())
+		m_log_asmjit = fopen(std::string("drcbearm64_asmjit_").append(device.shortname()).append(".asm").c_str(), "w");
+}
+
+
+//-------------------------------------------------
+//  ~drcbe_arm64 - destructor
+//-------------------------------------------------
+
+drcbe_arm64::~drcbe_arm64()
+{
+	if (m_log_asmjit)
+		fclose(m_log_asmjit);
+}
+
+size_t drcbe_arm64::emit(CodeHolder &ch)
+{
+	Error err;
+
+	size_t const alignment = ch.baseAddress() - uint64_t(m_cache.executable(m_cache.top()));
+	size_t const code_size = ch.codeSize();
+
+	// test if enough room remains in drc cache
+	drccodeptr *cachetop = m_cache.begin_codegen(alignment + code_size);
+	if (cachetop == nullptr)
+		return 0;
+
+	err = ch.copyFlattenedData(m_cache.writable(drccodeptr(ch.baseAddress())), code_size, CopySectionFlags::kPadTargetBuffer);
+	if (err)
+		throw emu_fatalerror("asmjit::CodeHolder::copyFlattenedData() error %d", err);
+
+	// update the drc cache and end codegen (which also invalidates the instruction cache)
+	*cachetop += alignment + code_size;
+	m_cache.end_codegen();
+
+	return code_size;
+}
+
+//-------------------------------------------------
+//  reset - reset back-end specific state
+//-------------------------------------------------
+
+void drcbe_arm64::reset()
+{
+	// output a note to the log
+	if (m_log_asmjit)
+		fprintf(m_log_asmjit, "%s", "\n\n===========\nCACHE RESET\n===========\n\n");
+
+	// generate a little bit of glue code to set up the environment
+	drccodeptr dst = m_cache.executable(m_cache.top());
+
+	CodeHolder ch;
+	ch.init(Environment::host(), uint64_t(dst));
+	ThrowableErrorHandler e;
+	ch.setErrorHandler(&e);
+
+	FileLogger logger(m_log_asmjit);
+	if (logger.file())
+	{
+		logger.setFlags(FormatFlags::kHexOffsets | FormatFlags::kHexImms | FormatFlags::kMachineCode);
+		logger.setIndentation(FormatIndentationGroup::kCode, 4);
+		ch.setLogger(&logger);
+	}
+
+	a64::Assembler a(&ch);
+	if (logger.file())
+		a.addDiagnosticOptions(DiagnosticOptions::kValidateIntermediate);
+
+	// generate an entry point
+	m_entry = (arm64_entry_point_func)dst;
+	a.bind(a.newNamedLabel("entry_point"));
+
+	// save the frame and the callee-saved registers
+	a.stp(a64::x29, a64::x30, a64::ptr_pre(a64::sp, -160));                             // stp   x29,x30,[sp,#-160]!
+	a.mov(a64::x29, a64::sp);                                                           // mov   x29,sp
+	a.stp(a64::x19, a64::x20, a64::ptr(a64::sp, 16));                                   // stp   x19,x20,[sp,#16]
+	a.stp(a64::x21, a64::x22, a64::ptr(a64::sp, 32));                                   // stp   x21,x22,[sp,#32]
+	a.stp(a64::x23, a64::x24, a64::ptr(a64::sp, 48));                                   // stp   x23,x24,[sp,#48]
+	a.stp(a64::x25, a64::x26, a64::ptr(a64::sp, 64));                                   // stp   x25,x26,[sp,#64]
+	a.stp(a64::x27, a64::x28, a64::ptr(a64::sp, 80));                                   // stp   x27,x28,[sp,#80]
+	a.stp(a64::d8, a64::d9, a64::ptr(a64::sp, 96));                                     // stp   d8,d9,[sp,#96]
+	a.stp(a64::d10, a64::d11, a64::ptr(a64::sp, 112));                                  // stp   d10,d11,[sp,#112]
+	a.stp(a64::d12, a64::d13, a64::ptr(a64::sp, 128));                                  // stp   d12,d13,[sp,#128]
+	a.stp(a64::d14, a64::d15, a64::ptr(a64::sp, 144));                                  // stp   d14,d15,[sp,#144]
+
+	// set up the base register and remember the stack pointer and host FPCR
+	a.mov(BASE_REG, REG_PARAM1);                                                        // mov   base,param1
+	a.mov(TEMP_REG1, a64::sp);                                                          // mov   temp1,sp
+	emit_str_mem(a, TEMP_REG1, &m_near.hashstacksave);                                  // str   temp1,[hashstacksave]
+	emit_str_mem(a, TEMP_REG1, &m_near.stacksave);                                      // str   temp1,[stacksave]
+	a.mrs(TEMP_REG1, Imm(a64::Predicate::SysReg::kFPCR));                               // mrs   temp1,fpcr
+	emit_str_mem(a, TEMP_REG1, &m_near.fpcrsave);                                       // str   temp1,[fpcrsave]
+	a.br(REG_PARAM2);                                                                   // br    param2
+
+	// generate an exit point
+	m_exit = dst + a.offset();
+	a.bind(a.newNamedLabel("exit_point"));
+	emit_ldr_mem(a, TEMP_REG1, &m_near.fpcrsave);                                       // ldr   temp1,[fpcrsave]
+	a.msr(Imm(a64::Predicate::SysReg::kFPCR), TEMP_REG1);                               // msr   fpcr,temp1
+	emit_ldr_mem(a, TEMP_REG1, &m_near.hashstacksave);                                  // ldr   temp1,[hashstacksave]
+	a.mov(a64::sp, TEMP_REG1);                                                          // mov   sp,temp1
+	a.ldp(a64::d14, a64::d15, a64::ptr(a64::sp, 144));                                  // ldp   d14,d15,[sp,#144]
+	a.ldp(a64::d12, a64::d13, a64::ptr(a64::sp, 128));                                  // ldp   d12,d13,[sp,#128]
+	a.ldp(a64::d10, a64::d11, a64::ptr(a64::sp, 112));                                  // ldp   d10,d11,[sp,#112]
+	a.ldp(a64::d8, a64::d9, a64::ptr(a64::sp, 96));                                     // ldp   d8,d9,[sp,#96]
+	a.ldp(a64::x27, a64::x28, a64::ptr(a64::sp, 80));                                   // ldp   x27,x28,[sp,#80]
+	a.ldp(a64::x25, a64::x26, a64::ptr(a64::sp, 64));                                   // ldp   x25,x26,[sp,#64]
+	a.ldp(a64::x23, a64::x24, a64::ptr(a64::sp, 48));                                   // ldp   x23,x24,[sp,#48]
+	a.ldp(a64::x21, a64::x22, a64::ptr(a64::sp, 32));                                   // ldp   x21,x22,[sp,#32]
+	a.ldp(a64::x19, a64::x20, a64::ptr(a64::sp, 16));                                   // ldp   x19,x20,[sp,#16]
+	a.ldp(a64::x29, a64::x30, a64::ptr_post(a64::sp, 160));                             // ldp   x29,x30,[sp],#160
+	a.ret(a64::x30);                                                                    // ret
+
+	// generate a no code point
+	m_nocode = dst + a.offset();
+	a.bind(a.newNamedLabel("nocode_point"));
+	a.ret(a64::x30);                                                                    // ret
+
+	// emit the generated code
+	emit(ch);
+
+	// reset our hash tables
+	m_hash.reset();
+	m_hash.set_default_codeptr(m_nocode);
+}
+
+
+//-------------------------------------------------
+//  execute - execute a block of code referenced
+//  by the given handle
+//-------------------------------------------------
+
+int drcbe_arm64::execute(code_handle &entry)
+{
+	// call our entry point which will jump to the destination
+	m_cache.codegen_complete();
+	return (*m_entry)(m_baseptr, entry.codeptr());
+}
+
+
+//-------------------------------------------------
+//  generate - generate code
+//-------------------------------------------------
+
+void drcbe_arm64::generate(drcuml_block &block, const instruction *instlist, uint32_t numinst)
+{
+	// tell all of our utility objects that a block is beginning
+	m_hash.block_begin(block, instlist, numinst);
+	m_map.block_begin(block);
+
+	// compute the base by aligning the cache top to a cache line (assumed to be 64 bytes)
+	drccodeptr dst = (drccodeptr)(uint64_t(m_cache.executable(m_cache.top()) + 63) & ~63);
+
+	CodeHolder ch;
+	ch.init(Environment::host(), uint64_t(dst));
+	ThrowableErrorHandler e;
+	ch.setErrorHandler(&e);
+
+	FileLogger logger(m_log_asmjit);
+	if (logger.file())
+	{
+		logger.setFlags(FormatFlags::kHexOffsets | FormatFlags::kHexImms | FormatFlags::kMachineCode);
+		logger.setIndentation(FormatIndentationGroup::kCode, 4);
+		ch.setLogger(&logger);
+	}
+
+	a64::Assembler a(&ch);
+	if (logger.file())
+		a.addDiagnosticOptions(DiagnosticOptions::kValidateIntermediate);
+
+	// generate code
+	for (int inum = 0; inum < numinst; inum++)
+	{
+		const instruction &inst = instlist[inum];
+		assert(inst.opcode() < std::size(s_opcode_table));
+
+		// must remain in scope until output
+		std::string dasm;
+
+		// add a comment
+		if (logger.file())
+		{
+			dasm = inst.disasm(&m_drcuml);
+			a.setInlineComment(dasm.c_str());
+		}
+
+		// generate code
+		(this->*s_opcode_table[inst.opcode()])(a, inst);
+	}
+
+	// emit the generated code
+	if (!emit(ch))
+		block.abort();
+
+	// tell all of our utility objects that the block is finished
+	m_hash.block_end(block);
+	m_map.block_end(block);
+}
+
+
+//-------------------------------------------------
+//  hash_exists - return true if the given mode/pc
+//  exists in the hash table
+//-------------------------------------------------
+
+bool drcbe_arm64::hash_exists(uint32_t mode, uint32_t pc)
+{
+	return m_hash.code_exists(mode, pc);
+}
+
+
+//-------------------------------------------------
+//  get_info - return information about the
+//  back-end implementation
+//-------------------------------------------------
+
+void drcbe_arm64::get_info(drcbe_info &info)
+{
+	for (info.direct_iregs = 0; info.direct_iregs < REG_I_COUNT; info.direct_iregs++)
+		if (int_register_map[info.direct_iregs] == 0)
+			break;
+	for (info.direct_fregs = 0; info.direct_fregs < REG_F_COUNT; info.direct_fregs++)
+		if (float_register_map[info.direct_fregs] == 0)
+			break;
+}
+
+
+
+/***************************************************************************
+    COMPILE-TIME OPCODES
+***************************************************************************/
+
+//-------------------------------------------------
+//  op_handle - process a HANDLE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_handle(a64::Assembler &a, const instruction &inst)
+{
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 1);
+	assert(inst.param(0).is_code_handle());
+
+	// make a label for documentation
+	Label handle = a.newNamedLabel(inst.param(0).handle().string());
+	a.bind(handle);
+
+	// emit a jump around the stack adjust in case code falls through here
+	Label skip = a.newLabel();
+	a.b(skip);                                                                          // b     skip
+
+	// register the current pointer for the handle
+	inst.param(0).handle().set_codeptr(drccodeptr(a.code()->baseAddress() + a.offset()));
+
+	// by default, the handle points to prolog code that saves the frame and return address
+	a.stp(a64::x29, a64::x30, a64::ptr_pre(a64::sp, -16));                              // stp   x29,x30,[sp,#-16]!
+	a.bind(skip);                                                                   // skip:
+}
+
+
+//-------------------------------------------------
+//  op_hash - process a HASH opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_hash(a64::Assembler &a, const instruction &inst)
+{
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 2);
+	assert(inst.param(0).is_immediate());
+	assert(inst.param(1).is_immediate());
+
+	// register the current pointer for the mode/PC
+	m_hash.set_codeptr(inst.param(0).immediate(), inst.param(1).immediate(), drccodeptr(a.code()->baseAddress() + a.offset()));
+}
+
+
+//-------------------------------------------------
+//  op_label - process a LABEL opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_label(a64::Assembler &a, const instruction &inst)
+{
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 1);
+	assert(inst.param(0).is_code_label());
+
+	std::string labelName = util::string_format("PC$%x", inst.param(0).label());
+	Label label = a.labelByName(labelName.c_str());
+	if (!label.isValid())
+		label = a.newNamedLabel(labelName.c_str());
+
+	// register the current pointer for the label
+	a.bind(label);
+}
+
+
+//-------------------------------------------------
+//  op_comment - process a COMMENT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_comment(a64::Assembler &a, const instruction &inst)
+{
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 1);
+	assert(inst.param(0).is_string());
+
+	// do nothing
+}
+
+
+//-------------------------------------------------
+//  op_mapvar - process a MAPVAR opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_mapvar(a64::Assembler &a, const instruction &inst)
+{
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 2);
+	assert(inst.param(0).is_mapvar());
+	assert(inst.param(1).is_immediate());
+
+	// set the value of the specified mapvar
+	m_map.set_value(drccodeptr(a.code()->baseAddress() + a.offset()), inst.param(0).mapvar(), inst.param(1).immediate());
+}
+
+
+
+/***************************************************************************
+    CONTROL FLOW OPCODES
+***************************************************************************/
+
+//-------------------------------------------------
+//  op_nop - process a NOP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_nop(a64::Assembler &a, const instruction &inst)
+{
+	// nothing
+}
+
+
+//-------------------------------------------------
+//  op_debug - process a DEBUG opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_debug(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	if ((m_device.machine().debug_flags & DEBUG_FLAG_ENABLED) != 0)
+	{
+		// normalize parameters
+		be_parameter pcp(*this, inst.param(0), PTYPE_MRI);
+
+		// test and branch
+		emit_ldr_mem(a, TEMP_REG1.w(), &m_device.machine().debug_flags);                 // ldr   temp1,[debug_flags]
+		a.tst(TEMP_REG1.w(), DEBUG_FLAG_CALL_HOOK);                                     // tst   temp1,DEBUG_FLAG_CALL_HOOK
+		Label skip = a.newLabel();
+		a.b(a64::CondCode::kEQ, skip);                                                       // b.eq  skip
+
+		// push the parameter
+		mov_r64_imm(a, REG_PARAM1, (uintptr_t)m_device.debug());                        // mov   param1,device.debug
+		mov_reg_param(a, 4, REG_PARAM2, pcp);                                           // mov   param2,pcp
+		emit_ldr_mem(a, SCRATCH_REG1, &m_near.debug_cpu_instruction_hook);              // ldr   scratch1,[debug_cpu_instruction_hook]
+		a.blr(SCRATCH_REG1);                                                            // blr   scratch1
+
+		a.bind(skip);
+	}
+}
+
+
+//-------------------------------------------------
+//  op_exit - process an EXIT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_exit(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter retp(*this, inst.param(0), PTYPE_MRI);
+
+	// skip if conditional; the exit point may be out of range of a conditional branch
+	Label skip = a.newLabel();
+	emit_skip(a, inst.condition(), skip);                                               // b.!cc skip
+
+	// load the parameter into W0
+	mov_reg_param(a, 4, REG_PARAM1, retp);                                              // mov   w0,retp
+	emit_branch(a, m_exit, false);                                                      // b     exit
+
+	a.bind(skip);                                                                   // skip:
+}
+
+
+//-------------------------------------------------
+//  op_hashjmp - process a HASHJMP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_hashjmp(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter modep(*this, inst.param(0), PTYPE_MRI);
+	be_parameter pcp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &exp = inst.param(2);
+	assert(exp.is_code_handle());
+
+	if (LOG_HASHJMPS)
+	{
+		mov_reg_param(a, 4, REG_PARAM1, pcp);
+		mov_reg_param(a, 4, REG_PARAM2, modep);
+		emit_ldr_mem(a, SCRATCH_REG1, &m_near.debug_log_hashjmp);
+		a.blr(SCRATCH_REG1);
+	}
+
+	// load the stack base so we end up at the right spot after our call below
+	emit_ldr_mem(a, TEMP_REG1, &m_near.hashstacksave);                                  // ldr   temp1,[hashstacksave]
+	a.mov(a64::sp, TEMP_REG1);                                                          // mov   sp,temp1
+
+	// load an entry from an L1 or L2 hash table, using a register index if the offset is out of range
+	auto const load_entry =
+			[&a] (a64::Gp const &dst, a64::Gp const &table, uint32_t index)
+			{
+				if (is_valid_immediate(index, 12))
+				{
+					a.ldr(dst, a64::ptr(table, index * 8));                             // ldr   dst,[table,#index*8]
+				}
+				else
+				{
+					a.mov(TEMP_REG3.w(), index);                                        // mov   temp3,index
+					a.ldr(dst, a64::ptr(table, TEMP_REG3, a64::lsl(3)));                // ldr   dst,[table,temp3,lsl #3]
+				}
+			};
+
+	// fixed mode cases
+	if (modep.is_immediate() && m_hash.is_mode_populated(modep.immediate()))
+	{
+		// a straight immediate jump is direct, though we need the PC in exp in case of failure
+		if (pcp.is_immediate())
+		{
+			uint32_t l1val = (pcp.immediate() >> m_hash.l1shift()) & m_hash.l1mask();
+			uint32_t l2val = (pcp.immediate() >> m_hash.l2shift()) & m_hash.l2mask();
+			emit_ldr_mem(a, SCRATCH_REG1, &m_hash.base()[modep.immediate()][l1val][l2val]); // ldr   scratch1,hash[modep][l1val][l2val]
+		}
+
+		// a fixed mode but variable PC
+		else
+		{
+			mov_reg_param(a, 4, TEMP_REG2, pcp);                                        // mov   temp2,pcp
+			get_imm_relative(a, TEMP_REG4, uintptr_t(m_hash.base()[modep.immediate()]));
+			a.ubfx(TEMP_REG3.w(), TEMP_REG2.w(), m_hash.l1shift(), m_hash.l1bits());    // ubfx  temp3,temp2,l1shift,l1bits
+			a.ldr(TEMP_REG4, a64::ptr(TEMP_REG4, TEMP_REG3, a64::lsl(3)));              // ldr   temp4,[temp4,temp3,lsl #3]
+			a.ubfx(TEMP_REG3.w(), TEMP_REG2.w(), m_hash.l2shift(), m_hash.l2bits());    // ubfx  temp3,temp2,l2shift,l2bits
+			a.ldr(SCRATCH_REG1, a64::ptr(TEMP_REG4, TEMP_REG3, a64::lsl(3)));           // ldr   scratch1,[temp4,temp3,lsl #3]
+		}
+	}
+	else
+	{
+		// variable mode
+		mov_reg_param(a, 4, TEMP_REG1, modep);                                          // mov   temp1,modep
+		get_imm_relative(a, TEMP_REG4, uintptr_t(m_hash.base()));
+		a.ldr(TEMP_REG4, a64::ptr(TEMP_REG4, TEMP_REG1, a64::lsl(3)));                  // ldr   temp4,hash[temp1]
+
+		// fixed PC
+		if (pcp.is_immediate())
+		{
+			uint32_t l1val = (pcp.immediate() >> m_hash.l1shift()) & m_hash.l1mask();
+			uint32_t l2val = (pcp.immediate() >> m_hash.l2shift()) & m_hash.l2mask();
+			load_entry(TEMP_REG4, TEMP_REG4, l1val);                                    // ldr   temp4,[temp4,#l1val*8]
+			load_entry(SCRATCH_REG1, TEMP_REG4, l2val);                                 // ldr   scratch1,[temp4,#l2val*8]
+		}
+
+		// variable PC
+		else
+		{
+			mov_reg_param(a, 4, TEMP_REG2, pcp);                                        // mov   temp2,pcp
+			a.ubfx(TEMP_REG3.w(), TEMP_REG2.w(), m_hash.l1shift(), m_hash.l1bits());    // ubfx  temp3,temp2,l1shift,l1bits
+			a.ldr(TEMP_REG4, a64::ptr(TEMP_REG4, TEMP_REG3, a64::lsl(3)));              // ldr   temp4,[temp4,temp3,lsl #3]
+			a.ubfx(TEMP_REG3.w(), TEMP_REG2.w(), m_hash.l2shift(), m_hash.l2bits());    // ubfx  temp3,temp2,l2shift,l2bits
+			a.ldr(SCRATCH_REG1, a64::ptr(TEMP_REG4, TEMP_REG3, a64::lsl(3)));           // ldr   scratch1,[temp4,temp3,lsl #3]
+		}
+	}
+	a.blr(SCRATCH_REG1);                                                                // blr   scratch1
+
+	// in all cases, if there is no code, we return here to generate the exception
+	if (LOG_HASHJMPS)
+	{
+		emit_ldr_mem(a, SCRATCH_REG1, &m_near.debug_log_hashjmp_fail);
+		a.blr(SCRATCH_REG1);
+	}
+
+	mov_reg_param(a, 4, TEMP_REG1, pcp);                                                // mov   temp1,pcp
+	emit_str_mem(a, TEMP_REG1.w(), &m_state.exp);                                       // str   temp1,[exp]
+	emit_call_handle(a, exp.handle());                                                  // bl    [exp]
+}
+
+
+//-------------------------------------------------
+//  op_jmp - process a JMP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_jmp(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	const parameter &labelp = inst.param(0);
+	assert(labelp.is_code_label());
+
+	std::string labelName = util::string_format("PC$%x", labelp.label());
+	Label jmptarget = a.labelByName(labelName.c_str());
+	if (!jmptarget.isValid())
+		jmptarget = a.newNamedLabel(labelName.c_str());
+
+	if (inst.condition() == uml::COND_ALWAYS)
+		a.b(jmptarget);                                                                 // b     target
+	else
+		a.b(ARM_CONDITION(inst.condition()), jmptarget);                                // b.cc  target
+}
+
+
+//-------------------------------------------------
+//  op_exh - process an EXH opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_exh(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	const parameter &handp = inst.param(0);
+	assert(handp.is_code_handle());
+	be_parameter exp(*this, inst.param(1), PTYPE_MRI);
+
+	// perform the exception processing
+	Label no_exception = a.newLabel();
+	emit_skip(a, inst.condition(), no_exception);                                       // b.!cc no_exception
+	mov_reg_param(a, 4, TEMP_REG1, exp);                                                // mov   temp1,exp
+	emit_str_mem(a, TEMP_REG1.w(), &m_state.exp);                                       // str   temp1,[exp]
+	emit_call_handle(a, handp.handle());                                                // bl    handp
+	a.bind(no_exception);
+}
+
+
+//-------------------------------------------------
+//  op_callh - process a CALLH opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_callh(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	const parameter &handp = inst.param(0);
+	assert(handp.is_code_handle());
+
+	// skip if conditional
+	Label skip = a.newLabel();
+	emit_skip(a, inst.condition(), skip);                                               // b.!cc skip
+
+	// jump through the handle; directly if a normal jump
+	emit_call_handle(a, handp.handle());                                                // bl    handp
+
+	// resolve the conditional link
+	a.bind(skip);                                                                   // skip:
+}
+
+
+//-------------------------------------------------
+//  op_ret - process a RET opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_ret(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 0);
+
+	// skip if conditional
+	Label skip = a.newLabel();
+	emit_skip(a, inst.condition(), skip);                                               // b.!cc skip
+
+	// return
+	a.ldp(a64::x29, a64::x30, a64::ptr_post(a64::sp, 16));                              // ldp   x29,x30,[sp],#16
+	a.ret(a64::x30);                                                                    // ret
+
+	// resolve the conditional link
+	a.bind(skip);                                                                   // skip:
+}
+
+
+//-------------------------------------------------
+//  op_callc - process a CALLC opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_callc(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	const parameter &funcp = inst.param(0);
+	assert(funcp.is_c_function());
+	be_parameter paramp(*this, inst.param(1), PTYPE_M);
+
+	// skip if conditional
+	Label skip = a.newLabel();
+	emit_skip(a, inst.condition(), skip);                                               // b.!cc skip
+
+	// perform the call
+	get_imm_relative(a, REG_PARAM1, uintptr_t(paramp.memory()));                        // mov   param1,paramp
+	call_arm_addr(a, (const void *)(uintptr_t)funcp.cfunc());                           // bl    funcp
+
+	// resolve the conditional link
+	a.bind(skip);                                                                   // skip:
+}
+
+
+//-------------------------------------------------
+//  op_recover - process a RECOVER opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_recover(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+
+	// call the recovery code
+	emit_ldr_mem(a, TEMP_REG1, &m_near.stacksave);                                      // ldr   temp1,[stacksave]
+	a.ldr(REG_PARAM2, a64::ptr(TEMP_REG1, -8));                                         // ldr   param2,[temp1,#-8]
+	a.sub(REG_PARAM2, REG_PARAM2, 4);                                                   // sub   param2,param2,#4
+	get_imm_relative(a, REG_PARAM1, uintptr_t(&m_map));                                 // mov   param1,m_map
+	a.mov(REG_PARAM3.w(), inst.param(1).mapvar());                                      // mov   param3,param[1].value
+	emit_ldr_mem(a, SCRATCH_REG1, &m_near.drcmap_get_value);                            // ldr   scratch1,[drcmap_get_value]
+	a.blr(SCRATCH_REG1);                                                                // blr   scratch1
+	mov_param_reg(a, 4, dstp, REG_PARAM1);                                              // mov   dstp,w0
+}
+
+
+
+/***************************************************************************
+    INTERNAL REGISTER OPCODES
+***************************************************************************/
+
+//-------------------------------------------------
+//  op_setfmod - process a SETFMOD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_setfmod(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter srcp(*this, inst.param(0), PTYPE_MRI);
+
+	// immediate case
+	if (srcp.is_immediate())
+	{
+		int value = srcp.immediate() & 3;
+		a.mov(TEMP_REG1.w(), value);                                                    // mov   temp1,srcp
+		emit_strb_mem(a, TEMP_REG1.w(), &m_state.fmod);                                 // strb  temp1,[fmod]
+		a.mov(FLAGS_TEMP.w(), fprnd_map[value]);                                        // mov   temp,fprnd_map[srcp]
+		a.mrs(FLAGS_REG, Imm(a64::Predicate::SysReg::kFPCR));                           // mrs   flags,fpcr
+		a.bfi(FLAGS_REG, FLAGS_TEMP, 22, 2);                                            // bfi   flags,temp,#22,#2
+		a.msr(Imm(a64::Predicate::SysReg::kFPCR), FLAGS_REG);                           // msr   fpcr,flags
+	}
+
+	// register/memory case
+	else
+	{
+		mov_reg_param(a, 4, TEMP_REG1, srcp);                                           // mov   temp1,srcp
+		a.and_(TEMP_REG1.w(), TEMP_REG1.w(), 3);                                        // and   temp1,temp1,#3
+		emit_strb_mem(a, TEMP_REG1.w(), &m_state.fmod);                                 // strb  temp1,[fmod]
+		set_rounding_mode(a, TEMP_REG1);
+	}
+}
+
+
+//-------------------------------------------------
+//  op_getfmod - process a GETFMOD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_getfmod(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+
+	// fetch the current mode and store to the destination
+	a64::Gp const dstreg = dstp.select_register(TEMP_REG1, 4);
+	emit_ldrb_mem(a, dstreg, &m_state.fmod);                                            // ldrb  dstreg,[fmod]
+	mov_param_reg(a, 4, dstp, dstreg);                                                  // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_getexp - process a GETEXP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_getexp(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+
+	// fetch the exception parameter and store to the destination
+	a64::Gp const dstreg = dstp.select_register(TEMP_REG1, 4);
+	emit_ldr_mem(a, dstreg, &m_state.exp);                                              // ldr   dstreg,[exp]
+	mov_param_reg(a, 4, dstp, dstreg);                                                  // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_getflgs - process a GETFLGS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_getflgs(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter maskp(*this, inst.param(1), PTYPE_I);
+
+	// pick a target register for the general case
+	a64::Gp const dstreg = dstp.select_register(TEMP_REG1, 4);
+
+	switch (maskp.immediate())
+	{
+		// single flags only
+		case FLAG_C:
+			a.cset(dstreg, a64::CondCode::kCC);                                              // cset  dstreg,cc
+			break;
+
+		case FLAG_V:
+			a.cset(dstreg, a64::CondCode::kVS);                                              // cset  dstreg,vs
+			a.lsl(dstreg, dstreg, 1);                                                   // lsl   dstreg,dstreg,#1
+			break;
+
+		case FLAG_Z:
+			a.cset(dstreg, a64::CondCode::kEQ);                                              // cset  dstreg,eq
+			a.lsl(dstreg, dstreg, 2);                                                   // lsl   dstreg,dstreg,#2
+			break;
+
+		case FLAG_S:
+			a.cset(dstreg, a64::CondCode::kMI);                                              // cset  dstreg,mi
+			a.lsl(dstreg, dstreg, 3);                                                   // lsl   dstreg,dstreg,#3
+			break;
+
+		case FLAG_U:
+			a.cset(dstreg, a64::CondCode::kVS);                                              // cset  dstreg,vs
+			a.lsl(dstreg, dstreg, 4);                                                   // lsl   dstreg,dstreg,#4
+			break;
+
+		// default cases
+		default:
+			a.mrs(TEMP_REG2, Imm(a64::Predicate::SysReg::kNZCV));                       // mrs   temp2,nzcv
+			a.lsr(TEMP_REG2, TEMP_REG2, 28);                                            // lsr   temp2,temp2,#28
+			get_imm_relative(a, TEMP_REG3, uintptr_t(&m_near.flagsmap[0]));
+			a.ldrb(dstreg, a64::ptr(TEMP_REG3, TEMP_REG2));                             // ldrb  dstreg,flagsmap[temp2]
+			if (is_valid_immediate_logical(maskp.immediate(), 4))
+			{
+				a.and_(dstreg, dstreg, maskp.immediate());                              // and   dstreg,dstreg,maskp
+			}
+			else
+			{
+				a.mov(TEMP_REG2.w(), maskp.immediate());                                // mov   temp2,maskp
+				a.and_(dstreg, dstreg, TEMP_REG2.w());                                  // and   dstreg,dstreg,temp2
+			}
+			break;
+	}
+
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_save - process a SAVE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_save(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_M);
+
+	// copy live state to the destination
+	get_imm_relative(a, TEMP_REG2, uintptr_t(dstp.memory()));                           // mov   temp2,dstp
+
+	// copy flags
+	a.mrs(TEMP_REG1, Imm(a64::Predicate::SysReg::kNZCV));                               // mrs   temp1,nzcv
+	a.lsr(TEMP_REG1, TEMP_REG1, 28);                                                    // lsr   temp1,temp1,#28
+	get_imm_relative(a, TEMP_REG3, uintptr_t(&m_near.flagsmap[0]));
+	a.ldrb(TEMP_REG1.w(), a64::ptr(TEMP_REG3, TEMP_REG1));                              // ldrb  temp1,flagsmap[temp1]
+	a.strb(TEMP_REG1.w(), a64::ptr(TEMP_REG2, offsetof(drcuml_machine_state, flags)));  // strb  temp1,state->flags
+
+	// copy fmod and exp
+	emit_ldrb_mem(a, TEMP_REG1.w(), &m_state.fmod);                                     // ldrb  temp1,[fmod]
+	a.strb(TEMP_REG1.w(), a64::ptr(TEMP_REG2, offsetof(drcuml_machine_state, fmod)));   // strb  temp1,state->fmod
+	emit_ldr_mem(a, TEMP_REG1.w(), &m_state.exp);                                       // ldr   temp1,[exp]
+	a.str(TEMP_REG1.w(), a64::ptr(TEMP_REG2, offsetof(drcuml_machine_state, exp)));     // str   temp1,state->exp
+
+	// copy integer registers
+	int regoffs = offsetof(drcuml_machine_state, r);
+	for (int regnum = 0; regnum < std::size(m_state.r); regnum++)
+	{
+		if (int_register_map[regnum] != 0)
+			a.str(a64::GpX(int_register_map[regnum]), a64::ptr(TEMP_REG2, regoffs + 8 * regnum));
+		else
+		{
+			emit_ldr_mem(a, TEMP_REG1, &m_state.r[regnum].d);
+			a.str(TEMP_REG1, a64::ptr(TEMP_REG2, regoffs + 8 * regnum));
+		}
+	}
+
+	// copy FP registers
+	regoffs = offsetof(drcuml_machine_state, f);
+	for (int regnum = 0; regnum < std::size(m_state.f); regnum++)
+	{
+		if (float_register_map[regnum] != 0)
+			a.str(a64::VecD(float_register_map[regnum]), a64::ptr(TEMP_REG2, regoffs + 8 * regnum));
+		else
+		{
+			emit_ldr_mem(a, TEMP_REG1, &m_state.f[regnum].d);
+			a.str(TEMP_REG1, a64::ptr(TEMP_REG2, regoffs + 8 * regnum));
+		}
+	}
+
+	// copy vector registers
+	regoffs = offsetof(drcuml_machine_state, v);
+	for (int regnum = 0; regnum < std::size(m_state.v); regnum++)
+	{
+		emit_float_ldr_mem(a, TEMPF_REG1.q(), &m_state.v[regnum]);
+		a.str(TEMPF_REG1.q(), a64::ptr(TEMP_REG2, regoffs + 16 * regnum));
+	}
+}
+
+
+//-------------------------------------------------
+//  op_restore - process a RESTORE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_restore(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+
+	// normalize parameters
+	be_parameter srcp(*this, inst.param(0), PTYPE_M);
+
+	// copy live state from the destination
+	get_imm_relative(a, TEMP_REG2, uintptr_t(srcp.memory()));                           // mov   temp2,srcp
+
+	// copy integer registers
+	int regoffs = offsetof(drcuml_machine_state, r);
+	for (int regnum = 0; regnum < std::size(m_state.r); regnum++)
+	{
+		if (int_register_map[regnum] != 0)
+			a.ldr(a64::GpX(int_register_map[regnum]), a64::ptr(TEMP_REG2, regoffs + 8 * regnum));
+		else
+		{
+			a.ldr(TEMP_REG1, a64::ptr(TEMP_REG2, regoffs + 8 * regnum));
+			emit_str_mem(a, TEMP_REG1, &m_state.r[regnum].d);
+		}
+	}
+
+	// copy FP registers
+	regoffs = offsetof(drcuml_machine_state, f);
+	for (int regnum = 0; regnum < std::size(m_state.f); regnum++)
+	{
+		if (float_register_map[regnum] != 0)
+			a.ldr(a64::VecD(float_register_map[regnum]), a64::ptr(TEMP_REG2, regoffs + 8 * regnum));
+		else
+		{
+			a.ldr(TEMP_REG1, a64::ptr(TEMP_REG2, regoffs + 8 * regnum));
+			emit_str_mem(a, TEMP_REG1, &m_state.f[regnum].d);
+		}
+	}
+
+	// copy vector registers
+	regoffs = offsetof(drcuml_machine_state, v);
+	for (int regnum = 0; regnum < std::size(m_state.v); regnum++)
+	{
+		a.ldr(TEMPF_REG1.q(), a64::ptr(TEMP_REG2, regoffs + 16 * regnum));
+		emit_float_str_mem(a, TEMPF_REG1.q(), &m_state.v[regnum]);
+	}
+
+	// copy fmod and exp
+	a.ldrb(TEMP_REG1.w(), a64::ptr(TEMP_REG2, offsetof(drcuml_machine_state, fmod)));   // ldrb  temp1,state->fmod
+	a.and_(TEMP_REG1.w(), TEMP_REG1.w(), 3);                                            // and   temp1,temp1,#3
+	emit_strb_mem(a, TEMP_REG1.w(), &m_state.fmod);                                     // strb  temp1,[fmod]
+	set_rounding_mode(a, TEMP_REG1);
+	a.ldr(TEMP_REG1.w(), a64::ptr(TEMP_REG2, offsetof(drcuml_machine_state, exp)));     // ldr   temp1,state->exp
+	emit_str_mem(a, TEMP_REG1.w(), &m_state.exp);                                       // str   temp1,[exp]
+
+	// copy flags
+	a.ldrb(TEMP_REG1.w(), a64::ptr(TEMP_REG2, offsetof(drcuml_machine_state, flags)));  // ldrb  temp1,state->flags
+	get_imm_relative(a, TEMP_REG3, uintptr_t(&m_near.flagsunmap[0]));
+	a.ldr(TEMP_REG1, a64::ptr(TEMP_REG3, TEMP_REG1, a64::lsl(3)));                      // ldr   temp1,flagsunmap[temp1]
+	a.msr(Imm(a64::Predicate::SysReg::kNZCV), TEMP_REG1);                               // msr   nzcv,temp1
+}
+
+
+
+/***************************************************************************
+    INTEGER OPERATIONS
+***************************************************************************/
+
+//-------------------------------------------------
+//  op_load - process a LOAD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_load(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter basep(*this, inst.param(1), PTYPE_M);
+	be_parameter indp(*this, inst.param(2), PTYPE_MRI);
+	const parameter &scalesizep = inst.param(3);
+	assert(scalesizep.is_size_scale());
+	int size = scalesizep.size();
+
+	// pick a target register for the general case
+	a64::Gp const dstreg = dstp.select_register(TEMP_REG1, inst.size());
+
+	if (size == SIZE_BYTE)
+		emit_ldr_str_indexed(a, a64::Inst::kIdLdrb, dstreg.w(), basep, indp, size, scalesizep.scale());     // ldrb  dstreg,[basep + scale*indp]
+	else if (size == SIZE_WORD)
+		emit_ldr_str_indexed(a, a64::Inst::kIdLdrh, dstreg.w(), basep, indp, size, scalesizep.scale());     // ldrh  dstreg,[basep + scale*indp]
+	else if (size == SIZE_DWORD)
+		emit_ldr_str_indexed(a, a64::Inst::kIdLdr, dstreg.w(), basep, indp, size, scalesizep.scale());      // ldr   dstreg,[basep + scale*indp]
+	else if (size == SIZE_QWORD)
+		emit_ldr_str_indexed(a, a64::Inst::kIdLdr, dstreg.x(), basep, indp, size, scalesizep.scale());      // ldr   dstreg,[basep + scale*indp]
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_loads - process a LOADS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_loads(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter basep(*this, inst.param(1), PTYPE_M);
+	be_parameter indp(*this, inst.param(2), PTYPE_MRI);
+	const parameter &scalesizep = inst.param(3);
+	assert(scalesizep.is_size_scale());
+	int size = scalesizep.size();
+
+	// pick a target register for the general case
+	a64::Gp const dstreg = dstp.select_register(TEMP_REG1, inst.size());
+
+	// asmjit doesn't reliably encode the X forms of LDRSB/LDRSH, so widen separately
+	if (size == SIZE_BYTE)
+		emit_ldr_str_indexed(a, a64::Inst::kIdLdrsb, dstreg.w(), basep, indp, size, scalesizep.scale());    // ldrsb dstreg,[basep + scale*indp]
+	else if (size == SIZE_WORD)
+		emit_ldr_str_indexed(a, a64::Inst::kIdLdrsh, dstreg.w(), basep, indp, size, scalesizep.scale());    // ldrsh dstreg,[basep + scale*indp]
+	else if (size == SIZE_DWORD && inst.size() == 8)
+		emit_ldr_str_indexed(a, a64::Inst::kIdLdrsw, dstreg, basep, indp, size, scalesizep.scale());        // ldrsw dstreg,[basep + scale*indp]
+	else if (size == SIZE_DWORD)
+		emit_ldr_str_indexed(a, a64::Inst::kIdLdr, dstreg, basep, indp, size, scalesizep.scale());          // ldr   dstreg,[basep + scale*indp]
+	else if (size == SIZE_QWORD)
+		emit_ldr_str_indexed(a, a64::Inst::kIdLdr, dstreg.x(), basep, indp, size, scalesizep.scale());      // ldr   dstreg,[basep + scale*indp]
+
+	if ((size < SIZE_DWORD) && (inst.size() == 8))
+		a.sxtw(dstreg, dstreg.w());                                                     // sxtw  dstreg,dstreg
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_store - process a STORE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_store(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter basep(*this, inst.param(0), PTYPE_M);
+	be_parameter indp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter srcp(*this, inst.param(2), PTYPE_MRI);
+	const parameter &scalesizep = inst.param(3);
+	assert(scalesizep.is_size_scale());
+	int size = scalesizep.size();
+
+	// pick a source register for the general case
+	a64::Gp const srcreg = get_src_reg(a, (size == SIZE_QWORD) ? 8 : 4, srcp, TEMP_REG1);
+
+	if (size == SIZE_BYTE)
+		emit_ldr_str_indexed(a, a64::Inst::kIdStrb, srcreg, basep, indp, size, scalesizep.scale());         // strb  srcreg,[basep + scale*indp]
+	else if (size == SIZE_WORD)
+		emit_ldr_str_indexed(a, a64::Inst::kIdStrh, srcreg, basep, indp, size, scalesizep.scale());         // strh  srcreg,[basep + scale*indp]
+	else if (size == SIZE_DWORD)
+		emit_ldr_str_indexed(a, a64::Inst::kIdStr, srcreg, basep, indp, size, scalesizep.scale());          // str   srcreg,[basep + scale*indp]
+	else if (size == SIZE_QWORD)
+		emit_ldr_str_indexed(a, a64::Inst::kIdStr, srcreg, basep, indp, size, scalesizep.scale());          // str   srcreg,[basep + scale*indp]
+}
+
+
+//-------------------------------------------------
+//  call_read_handler - call the resolved read
+//  accessor, or the trampoline if it could not
+//  be resolved; address must be in param2
+//-------------------------------------------------
+
+void drcbe_arm64::call_read_handler(a64::Assembler &a, int space, int size, bool masked)
+{
+	auto &trampolines = m_accessors[space];
+	auto &resolved = m_resolved_accessors[space];
+
+	resolved_handler const *handler;
+	const void *trampoline;
+	if (size == SIZE_BYTE)
+	{
+		assert(!masked);
+		handler = &resolved.read_byte;
+		trampoline = &trampolines.read_byte;
+	}
+	else if (size == SIZE_WORD)
+	{
+		handler = masked ? &resolved.read_word_masked : &resolved.read_word;
+		trampoline = masked ? (const void *)&trampolines.read_word_masked : (const void *)&trampolines.read_word;
+	}
+	else if (size == SIZE_DWORD)
+	{
+		handler = masked ? &resolved.read_dword_masked : &resolved.read_dword;
+		trampoline = masked ? (const void *)&trampolines.read_dword_masked : (const void *)&trampolines.read_dword;
+	}
+	else
+	{
+		handler = masked ? &resolved.read_qword_masked : &resolved.read_qword;
+		trampoline = masked ? (const void *)&trampolines.read_qword_masked : (const void *)&trampolines.read_qword;
+	}
+
+	if (handler->func)
+	{
+		mov_r64_imm(a, REG_PARAM1, handler->obj);                                       // mov   param1,space
+		call_arm_addr(a, handler->func);                                                // bl    handler
+	}
+	else
+	{
+		mov_r64_imm(a, REG_PARAM1, (uintptr_t)m_space[space]);                          // mov   param1,space
+		emit_ldr_mem(a, SCRATCH_REG1, trampoline);                                      // ldr   scratch1,[trampoline]
+		a.blr(SCRATCH_REG1);                                                            // blr   scratch1
+	}
+}
+
+
+//-------------------------------------------------
+//  call_write_handler - call the resolved write
+//  accessor, or the trampoline if it could not
+//  be resolved; address, data and mask must be
+//  in param2-param4
+//-------------------------------------------------
+
+void drcbe_arm64::call_write_handler(a64::Assembler &a, int space, int size, bool masked)
+{
+	auto &trampolines = m_accessors[space];
+	auto &resolved = m_resolved_accessors[space];
+
+	resolved_handler const *handler;
+	const void *trampoline;
+	if (size == SIZE_BYTE)
+	{
+		assert(!masked);
+		handler = &resolved.write_byte;
+		trampoline = &trampolines.write_byte;
+	}
+	else if (size == SIZE_WORD)
+	{
+		handler = masked ? &resolved.write_word_masked : &resolved.write_word;
+		trampoline = masked ? (const void *)&trampolines.write_word_masked : (const void *)&trampolines.write_word;
+	}
+	else if (size == SIZE_DWORD)
+	{
+		handler = masked ? &resolved.write_dword_masked : &resolved.write_dword;
+		trampoline = masked ? (const void *)&trampolines.write_dword_masked : (const void *)&trampolines.write_dword;
+	}
+	else
+	{
+		handler = masked ? &resolved.write_qword_masked : &resolved.write_qword;
+		trampoline = masked ? (const void *)&trampolines.write_qword_masked : (const void *)&trampolines.write_qword;
+	}
+
+	if (handler->func)
+	{
+		mov_r64_imm(a, REG_PARAM1, handler->obj);                                       // mov   param1,space
+		call_arm_addr(a, handler->func);                                                // bl    handler
+	}
+	else
+	{
+		mov_r64_imm(a, REG_PARAM1, (uintptr_t)m_space[space]);                          // mov   param1,space
+		emit_ldr_mem(a, SCRATCH_REG1, trampoline);                                      // ldr   scratch1,[trampoline]
+		a.blr(SCRATCH_REG1);                                                            // blr   scratch1
+	}
+}
+
+
+//-------------------------------------------------
+//  op_read - process a READ opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_read(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter addrp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &spacesizep = inst.param(2);
+	assert(spacesizep.is_size_space());
+
+	// set up a call to the read handler
+	mov_reg_param(a, 4, REG_PARAM2, addrp);                                             // mov   param2,addrp
+	call_read_handler(a, spacesizep.space(), spacesizep.size(), false);
+
+	// zero-extend the result
+	if (spacesizep.size() == SIZE_BYTE)
+		a.and_(REG_PARAM1.w(), REG_PARAM1.w(), 0xff);                                   // and   w0,w0,#0xff
+	else if (spacesizep.size() == SIZE_WORD)
+		a.and_(REG_PARAM1.w(), REG_PARAM1.w(), 0xffff);                                 // and   w0,w0,#0xffff
+	else if (spacesizep.size() == SIZE_DWORD && inst.size() == 8)
+		a.mov(REG_PARAM1.w(), REG_PARAM1.w());                                          // mov   w0,w0
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, REG_PARAM1);                                    // mov   dstp,x0
+}
+
+
+//-------------------------------------------------
+//  op_readm - process a READM opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_readm(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter addrp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter maskp(*this, inst.param(2), PTYPE_MRI);
+	const parameter &spacesizep = inst.param(3);
+	assert(spacesizep.is_size_space());
+	assert(spacesizep.size() != SIZE_BYTE);
+
+	// set up a call to the read handler
+	mov_reg_param(a, 4, REG_PARAM2, addrp);                                             // mov   param2,addrp
+	mov_reg_param(a, (spacesizep.size() == SIZE_QWORD) ? 8 : 4, REG_PARAM3, maskp);     // mov   param3,maskp
+	call_read_handler(a, spacesizep.space(), spacesizep.size(), true);
+
+	// zero-extend the result
+	if (spacesizep.size() == SIZE_WORD)
+		a.and_(REG_PARAM1.w(), REG_PARAM1.w(), 0xffff);                                 // and   w0,w0,#0xffff
+	else if (spacesizep.size() == SIZE_DWORD && inst.size() == 8)
+		a.mov(REG_PARAM1.w(), REG_PARAM1.w());                                          // mov   w0,w0
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, REG_PARAM1);                                    // mov   dstp,x0
+}
+
+
+//-------------------------------------------------
+//  op_write - process a WRITE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_write(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter addrp(*this, inst.param(0), PTYPE_MRI);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &spacesizep = inst.param(2);
+	assert(spacesizep.is_size_space());
+
+	// set up a call to the write handler
+	mov_reg_param(a, 4, REG_PARAM2, addrp);                                             // mov   param2,addrp
+	mov_reg_param(a, (spacesizep.size() == SIZE_QWORD) ? 8 : 4, REG_PARAM3, srcp);      // mov   param3,srcp
+	call_write_handler(a, spacesizep.space(), spacesizep.size(), false);
+}
+
+
+//-------------------------------------------------
+//  op_writem - process a WRITEM opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_writem(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter addrp(*this, inst.param(0), PTYPE_MRI);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter maskp(*this, inst.param(2), PTYPE_MRI);
+	const parameter &spacesizep = inst.param(3);
+	assert(spacesizep.is_size_space());
+	assert(spacesizep.size() != SIZE_BYTE);
+
+	// set up a call to the write handler
+	int const regsize = (spacesizep.size() == SIZE_QWORD) ? 8 : 4;
+	mov_reg_param(a, 4, REG_PARAM2, addrp);                                             // mov   param2,addrp
+	mov_reg_param(a, regsize, REG_PARAM3, srcp);                                        // mov   param3,srcp
+	mov_reg_param(a, regsize, REG_PARAM4, maskp);                                       // mov   param4,maskp
+	call_write_handler(a, spacesizep.space(), spacesizep.size(), true);
+}
+
+
+//-------------------------------------------------
+//  op_carry - process a CARRY opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_carry(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C);
+
+	// normalize parameters
+	be_parameter srcp(*this, inst.param(0), PTYPE_MRI);
+	be_parameter bitp(*this, inst.param(1), PTYPE_MRI);
+
+	// degenerate case: source is immediate
+	if (srcp.is_immediate() && bitp.is_immediate())
+	{
+		a.mov(TEMP_REG1.w(), BIT(srcp.immediate(), bitp.immediate() & (inst.size() * 8 - 1)));    // mov   temp1,bit
+	}
+
+	// immediate bit number
+	else if (bitp.is_immediate())
+	{
+		a64::Gp const src = get_src_reg(a, inst.size(), srcp, TEMP_REG1);
+		a.lsr(TEMP_REG1.x(), src.x(), bitp.immediate() & (inst.size() * 8 - 1));        // lsr   temp1,srcp,bitp
+	}
+
+	// variable bit number; the shift count is implicitly masked
+	else
+	{
+		a64::Gp const src = get_src_reg(a, inst.size(), srcp, TEMP_REG1);
+		a64::Gp const bit = get_src_reg(a, inst.size(), bitp, TEMP_REG2);
+		a.lsr(select_size(TEMP_REG1, inst.size()), src, bit);                           // lsr   temp1,srcp,bitp
+	}
+
+	store_carry_reg(a, TEMP_REG1);
+}
+
+
+//-------------------------------------------------
+//  op_set - process a SET opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_set(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+
+	// pick a target register for the general case
+	a64::Gp const dstreg = dstp.select_register(TEMP_REG1, inst.size());
+
+	if (inst.condition() == uml::COND_ALWAYS)
+		a.mov(dstreg, 1);                                                               // mov   dstreg,#1
+	else
+		a.cset(dstreg, ARM_CONDITION(inst.condition()));                                // cset  dstreg,cc
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_mov - process a MOV opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_mov(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+
+	// conditional move to a register; loading the source doesn't affect the flags
+	if (inst.condition() != uml::COND_ALWAYS && dstp.is_int_register())
+	{
+		a64::Gp const dst = dstp.get_register_int(inst.size());
+		a64::Gp const src = get_src_reg(a, inst.size(), srcp, TEMP_REG1);
+		a.csel(dst, src, dst, ARM_CONDITION(inst.condition()));                         // csel  dstp,srcp,dstp,cc
+		return;
+	}
+
+	// add a conditional branch for the remaining cases
+	Label skip = a.newLabel();
+	emit_skip(a, inst.condition(), skip);                                               // b.!cc skip
+
+	// load directly into the destination register where possible
+	a64::Gp const src = get_src_reg(a, inst.size(), srcp, dstp.select_register(TEMP_REG1, inst.size()));
+	mov_param_reg(a, inst.size(), dstp, src);                                           // mov   dstp,srcp
+
+	// resolve the jump
+	a.bind(skip);
+}
+
+
+//-------------------------------------------------
+//  op_sext - process a SEXT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_sext(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_S | FLAG_Z);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &sizep = inst.param(2);
+	assert(sizep.is_size());
+
+	a64::Gp const dstreg = dstp.select_register(TEMP_REG1, inst.size());
+
+	// constant folding
+	if (srcp.is_immediate())
+	{
+		uint64_t value = srcp.immediate();
+		if (sizep.size() == SIZE_BYTE)
+			value = int64_t(int8_t(value));
+		else if (sizep.size() == SIZE_WORD)
+			value = int64_t(int16_t(value));
+		else if (sizep.size() == SIZE_DWORD)
+			value = int64_t(int32_t(value));
+		mov_r64_imm(a, dstreg, (inst.size() == 4) ? uint32_t(value) : value);           // mov   dstreg,value
+	}
+
+	// sign-extending load
+	else if (srcp.is_memory())
+	{
+		// asmjit doesn't reliably encode the X forms of LDRSB/LDRSH, so widen separately
+		if (sizep.size() == SIZE_BYTE)
+			emit_ldr_str_base_mem(a, a64::Inst::kIdLdrsb, dstreg.w(), srcp.memory());  // ldrsb dstreg,[srcp]
+		else if (sizep.size() == SIZE_WORD)
+			emit_ldr_str_base_mem(a, a64::Inst::kIdLdrsh, dstreg.w(), srcp.memory());  // ldrsh dstreg,[srcp]
+		else if (sizep.size() == SIZE_DWORD && inst.size() == 8)
+			emit_ldr_str_base_mem(a, a64::Inst::kIdLdrsw, dstreg, srcp.memory());      // ldrsw dstreg,[srcp]
+		else
+			emit_ldr_mem(a, dstreg, srcp.memory());                                     // ldr   dstreg,[srcp]
+
+		if ((sizep.size() < SIZE_DWORD) && (inst.size() == 8))
+			a.sxtw(dstreg, dstreg.w());                                                 // sxtw  dstreg,dstreg
+	}
+
+	// register
+	else if (srcp.is_int_register())
+	{
+		a64::Gp const src = srcp.get_register_int(inst.size());
+		if (sizep.size() == SIZE_BYTE)
+			a.sxtb(dstreg, src.w());                                                    // sxtb  dstreg,srcp
+		else if (sizep.size() == SIZE_WORD)
+			a.sxth(dstreg, src.w());                                                    // sxth  dstreg,srcp
+		else if (sizep.size() == SIZE_DWORD && inst.size() == 8)
+			a.sxtw(dstreg, src.w());                                                    // sxtw  dstreg,srcp
+		else if (dstreg.id() != src.id())
+			a.mov(dstreg, src);                                                         // mov   dstreg,srcp
+	}
+
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+
+	if (inst.flags() != 0)
+		a.tst(dstreg, dstreg);                                                          // tst   dstreg,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_roland - process an ROLAND opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_roland(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_S | FLAG_Z);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter shiftp(*this, inst.param(2), PTYPE_MRI);
+	be_parameter maskp(*this, inst.param(3), PTYPE_MRI);
+
+	int const bits = inst.size() * 8;
+	uint64_t const sizemask = (inst.size() == 4) ? 0xffffffffU : ~uint64_t(0);
+
+	// the output must not clobber the mask or shift before they are used
+	a64::Gp output = dstp.select_register(TEMP_REG1, inst.size());
+	if ((maskp.is_int_register() && (maskp.ireg() == output.id())) || (shiftp.is_int_register() && (shiftp.ireg() == output.id())))
+		output = select_size(TEMP_REG1, inst.size());
+
+	a64::Gp const src = get_src_reg(a, inst.size(), srcp, TEMP_REG2);
+
+	// constant shift and contiguous mask that doesn't wrap: use a bitfield extract or insert
+	int lsb, width;
+	if (shiftp.is_immediate() && maskp.is_immediate() && is_contiguous_mask(maskp.immediate() & sizemask, lsb, width))
+	{
+		int const shift = shiftp.immediate() & (bits - 1);
+		int const srcbit = (lsb - shift + bits) & (bits - 1);
+		if ((srcbit + width) <= bits && (lsb == 0 || srcbit == 0))
+		{
+			if (lsb == 0)
+				a.ubfx(output, src, srcbit, width);                                     // ubfx  output,src,#srcbit,#width
+			else
+				a.ubfiz(output, src, lsb, width);                                       // ubfiz output,src,#lsb,#width
+
+			mov_param_reg(a, inst.size(), dstp, output);                                // mov   dstp,output
+			if (inst.flags())
+				a.tst(output, output);                                                  // tst   output,output
+			return;
+		}
+	}
+
+	// rotate the source left by rotating right by the complementary amount
+	if (shiftp.is_immediate())
+	{
+		int const shift = shiftp.immediate() & (bits - 1);
+		if (shift != 0)
+			a.ror(output, src, bits - shift);                                           // ror   output,src,#(bits-shift)
+		else if (output.id() != src.id())
+			a.mov(output, src);                                                         // mov   output,src
+	}
+	else
+	{
+		a64::Gp const shift = get_src_reg(a, inst.size(), shiftp, TEMP_REG3);
+		a.neg(select_size(TEMP_REG3, inst.size()), shift);                              // neg   temp3,shift
+		a.ror(output, src, select_size(TEMP_REG3, inst.size()));                        // ror   output,src,temp3
+	}
+
+	// apply the mask
+	if (maskp.is_immediate() && is_valid_immediate_logical(maskp.immediate(), inst.size()))
+	{
+		if (inst.flags())
+			a.ands(output, output, maskp.immediate() & sizemask);                       // ands  output,output,mask
+		else
+			a.and_(output, output, maskp.immediate() & sizemask);                       // and   output,output,mask
+	}
+	else
+	{
+		a64::Gp const mask = get_src_reg(a, inst.size(), maskp, TEMP_REG2);
+		if (inst.flags())
+			a.ands(output, output, mask);                                               // ands  output,output,mask
+		else
+			a.and_(output, output, mask);                                               // and   output,output,mask
+	}
+
+	mov_param_reg(a, inst.size(), dstp, output);                                        // mov   dstp,output
+}
+
+
+//-------------------------------------------------
+//  op_rolins - process an ROLINS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_rolins(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_S | FLAG_Z);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter shiftp(*this, inst.param(2), PTYPE_MRI);
+	be_parameter maskp(*this, inst.param(3), PTYPE_MRI);
+
+	int const bits = inst.size() * 8;
+	uint64_t const sizemask = (inst.size() == 4) ? 0xffffffffU : ~uint64_t(0);
+	a64::Gp const dstreg = dstp.select_register(TEMP_REG1, inst.size());
+
+	// constant shift and contiguous mask that doesn't wrap: use a bitfield insert
+	int lsb, width;
+	if (shiftp.is_immediate() && maskp.is_immediate() && is_contiguous_mask(maskp.immediate() & sizemask, lsb, width))
+	{
+		int const shift = shiftp.immediate() & (bits - 1);
+		int const srcbit = (lsb - shift + bits) & (bits - 1);
+		if ((srcbit + width) <= bits)
+		{
+			a64::Gp src = get_src_reg(a, inst.size(), srcp, TEMP_REG2);
+			mov_reg_param(a, inst.size(), dstreg, dstp);                                // mov   dstreg,dstp
+
+			if (srcbit == 0)
+			{
+				a.bfi(dstreg, src, lsb, width);                                         // bfi   dstreg,src,#lsb,#width
+			}
+			else if (lsb == 0)
+			{
+				a.bfxil(dstreg, src, srcbit, width);                                    // bfxil dstreg,src,#srcbit,#width
+			}
+			else
+			{
+				a.ubfx(select_size(TEMP_REG2, inst.size()), src, srcbit, width);        // ubfx  temp2,src,#srcbit,#width
+				a.bfi(dstreg, select_size(TEMP_REG2, inst.size()), lsb, width);         // bfi   dstreg,temp2,#lsb,#width
+			}
+
+			mov_param_reg(a, inst.size(), dstp, dstreg);                                // mov   dstp,dstreg
+			if (inst.flags())
+				a.tst(dstreg, dstreg);                                                  // tst   dstreg,dstreg
+			return;
+		}
+	}
+
+	// rotate the source into temp2
+	a64::Gp const rotated = select_size(TEMP_REG2, inst.size());
+	a64::Gp const src = get_src_reg(a, inst.size(), srcp, TEMP_REG2);
+	if (shiftp.is_immediate())
+	{
+		int const shift = shiftp.immediate() & (bits - 1);
+		if (shift != 0)
+			a.ror(rotated, src, bits - shift);                                          // ror   temp2,src,#(bits-shift)
+		else if (rotated.id() != src.id())
+			a.mov(rotated, src);                                                        // mov   temp2,src
+	}
+	else
+	{
+		a64::Gp const shift = get_src_reg(a, inst.size(), shiftp, TEMP_REG3);
+		a.neg(select_size(TEMP_REG3, inst.size()), shift);                              // neg   temp3,shift
+		a.ror(rotated, src, select_size(TEMP_REG3, inst.size()));                       // ror   temp2,src,temp3
+	}
+
+	// merge under the mask
+	if (maskp.is_immediate() && is_valid_immediate_logical(maskp.immediate(), inst.size()) && is_valid_immediate_logical(~maskp.immediate(), inst.size()))
+	{
+		uint64_t const mask = maskp.immediate() & sizemask;
+		a.and_(rotated, rotated, mask);                                                 // and   temp2,temp2,mask
+		mov_reg_param(a, inst.size(), dstreg, dstp);                                    // mov   dstreg,dstp
+		a.and_(dstreg, dstreg, ~mask & sizemask);                                       // and   dstreg,dstreg,~mask
+	}
+	else
+	{
+		a64::Gp const mask = get_src_reg(a, inst.size(), maskp, TEMP_REG3);
+		a.and_(rotated, rotated, mask);                                                 // and   temp2,temp2,mask
+		mov_reg_param(a, inst.size(), dstreg, dstp);                                    // mov   dstreg,dstp
+		a.bic(dstreg, dstreg, mask);                                                    // bic   dstreg,dstreg,mask
+	}
+
+	a.orr(dstreg, dstreg, rotated);                                                     // orr   dstreg,dstreg,temp2
+
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+	if (inst.flags())
+		a.tst(dstreg, dstreg);                                                          // tst   dstreg,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_add - process an ADD or ADDC opcode; the
+//  host carry flag is the inverse of the UML
+//  carry flag, so it is flipped around additions
+//-------------------------------------------------
+
+template <a64::Inst::Id Opcode> void drcbe_arm64::op_add(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_V | FLAG_Z | FLAG_S);
+
+	a64::Inst::Id const opcode = (inst.flags() != 0)
+			? ((Opcode == a64::Inst::kIdAdc) ? a64::Inst::kIdAdcs : a64::Inst::kIdAdds)
+			: Opcode;
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+	normalize_commutative(src1p, src2p);
+
+	// convert the UML carry to a host carry
+	if (Opcode == a64::Inst::kIdAdc)
+		flip_carry(a);
+
+	a64::Gp const output = dstp.select_register(TEMP_REG3, inst.size());
+	a64::Gp const src1 = get_src_reg(a, inst.size(), src1p, TEMP_REG1);
+
+	if (Opcode == a64::Inst::kIdAdd && src2p.is_immediate() && is_valid_immediate_addsub(src2p.immediate()))
+	{
+		a.emit(opcode, output, src1, src2p.immediate());                                // adds  output,src1,src2p
+	}
+	else
+	{
+		a64::Gp const src2 = get_src_reg(a, inst.size(), src2p, TEMP_REG2);
+		a.emit(opcode, output, src1, src2);                                             // adds  output,src1,src2
+	}
+
+	mov_param_reg(a, inst.size(), dstp, output);                                        // mov   dstp,output
+
+	// convert the host carry back to a UML carry
+	if (inst.flags() & FLAG_C)
+		flip_carry(a);
+}
+
+
+//-------------------------------------------------
+//  op_sub - process a SUB or SUBB opcode; the host
+//  carry flag is already an inverted borrow
+//-------------------------------------------------
+
+template <a64::Inst::Id Opcode> void drcbe_arm64::op_sub(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_V | FLAG_Z | FLAG_S);
+
+	a64::Inst::Id const opcode = (inst.flags() != 0)
+			? ((Opcode == a64::Inst::kIdSbc) ? a64::Inst::kIdSbcs : a64::Inst::kIdSubs)
+			: Opcode;
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+
+	a64::Gp const output = dstp.select_register(TEMP_REG3, inst.size());
+	a64::Gp const src1 = get_src_reg(a, inst.size(), src1p, TEMP_REG1);
+
+	if (Opcode == a64::Inst::kIdSub && src2p.is_immediate() && is_valid_immediate_addsub(src2p.immediate()))
+	{
+		a.emit(opcode, output, src1, src2p.immediate());                                // subs  output,src1,src2p
+	}
+	else
+	{
+		a64::Gp const src2 = get_src_reg(a, inst.size(), src2p, TEMP_REG2);
+		a.emit(opcode, output, src1, src2);                                             // subs  output,src1,src2
+	}
+
+	mov_param_reg(a, inst.size(), dstp, output);                                        // mov   dstp,output
+}
+
+
+//-------------------------------------------------
+//  op_cmp - process a CMP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_cmp(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter src1p(*this, inst.param(0), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(1), PTYPE_MRI);
+
+	// skip if pointless
+	if (inst.flags() == 0)
+		return;
+
+	a64::Gp const src1 = get_src_reg(a, inst.size(), src1p, TEMP_REG1);
+
+	if (src2p.is_immediate() && is_valid_immediate_addsub(src2p.immediate()))
+	{
+		a.cmp(src1, src2p.immediate());                                                 // cmp   src1,src2p
+	}
+	else
+	{
+		a64::Gp const src2 = get_src_reg(a, inst.size(), src2p, TEMP_REG2);
+		a.cmp(src1, src2);                                                              // cmp   src1,src2
+	}
+}
+
+
+//-------------------------------------------------
+//  op_mulu - process a MULU opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_mulu(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter edstp(*this, inst.param(1), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(2), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(3), PTYPE_MRI);
+	normalize_commutative(src1p, src2p);
+	bool const compute_hi = (dstp != edstp);
+
+	a64::Gp const src1 = get_src_reg(a, inst.size(), src1p, TEMP_REG1);
+	a64::Gp const src2 = get_src_reg(a, inst.size(), src2p, TEMP_REG2);
+	a64::Gp const lo = TEMP_REG3;
+	a64::Gp const hi = TEMP_REG4;
+
+	// 32-bit form: the full product fits in one register
+	if (inst.size() == 4)
+	{
+		a.umull(lo, src1, src2);                                                        // umull lo,src1,src2
+		mov_param_reg(a, 4, dstp, lo);                                                  // mov   dstp,lo
+		if (compute_hi || (inst.flags() & FLAG_V))
+			a.lsr(hi, lo, 32);                                                          // lsr   hi,lo,#32
+		if (compute_hi)
+			mov_param_reg(a, 4, edstp, hi);                                             // mov   edstp,hi
+
+		if (inst.flags() != 0)
+		{
+			if (inst.flags() & FLAG_V)
+			{
+				a.cmp(hi, 0);                                                           // cmp   hi,#0
+				a.cset(TEMP_REG1, a64::CondCode::kNE);                                  // cset  temp1,ne
+			}
+			if (compute_hi)
+				a.tst(lo, lo);                                                          // tst   lo,lo
+			else
+				a.tst(lo.w(), lo.w());                                                  // tst   lo,lo
+			if (inst.flags() & FLAG_V)
+				store_overflow_reg(a, TEMP_REG1);
+		}
+	}
+
+	// 64-bit form
+	else
+	{
+		if (compute_hi || (inst.flags() != 0))
+			a.umulh(hi, src1, src2);                                                    // umulh hi,src1,src2
+		a.mul(lo, src1, src2);                                                          // mul   lo,src1,src2
+		mov_param_reg(a, 8, dstp, lo);                                                  // mov   dstp,lo
+		if (compute_hi)
+			mov_param_reg(a, 8, edstp, hi);                                             // mov   edstp,hi
+
+		if (inst.flags() != 0)
+		{
+			if (inst.flags() & FLAG_V)
+			{
+				a.cmp(hi, 0);                                                           // cmp   hi,#0
+				a.cset(TEMP_REG2, a64::CondCode::kNE);                                  // cset  temp2,ne
+			}
+			if (compute_hi)
+			{
+				// sign from the high half, zero from both halves
+				a.cmp(lo, 0);                                                           // cmp   lo,#0
+				a.cset(TEMP_REG1, a64::CondCode::kNE);                                  // cset  temp1,ne
+				a.orr(TEMP_REG1, TEMP_REG1, hi);                                        // orr   temp1,temp1,hi
+				a.tst(TEMP_REG1, TEMP_REG1);                                            // tst   temp1,temp1
+			}
+			else
+			{
+				a.tst(lo, lo);                                                          // tst   lo,lo
+			}
+			if (inst.flags() & FLAG_V)
+				store_overflow_reg(a, TEMP_REG2);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  op_muls - process a MULS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_muls(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter edstp(*this, inst.param(1), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(2), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(3), PTYPE_MRI);
+	normalize_commutative(src1p, src2p);
+	bool const compute_hi = (dstp != edstp);
+
+	a64::Gp const src1 = get_src_reg(a, inst.size(), src1p, TEMP_REG1);
+	a64::Gp const src2 = get_src_reg(a, inst.size(), src2p, TEMP_REG2);
+	a64::Gp const lo = TEMP_REG3;
+	a64::Gp const hi = TEMP_REG4;
+
+	// 32-bit form: the full product fits in one register
+	if (inst.size() == 4)
+	{
+		a.smull(lo, src1, src2);                                                        // smull lo,src1,src2
+		mov_param_reg(a, 4, dstp, lo);                                                  // mov   dstp,lo
+		if (compute_hi)
+		{
+			a.lsr(hi, lo, 32);                                                          // lsr   hi,lo,#32
+			mov_param_reg(a, 4, edstp, hi);                                             // mov   edstp,hi
+		}
+
+		if (inst.flags() != 0)
+		{
+			if (inst.flags() & FLAG_V)
+			{
+				a.sxtw(TEMP_REG1, lo.w());                                              // sxtw  temp1,lo
+				a.cmp(TEMP_REG1, lo);                                                   // cmp   temp1,lo
+				a.cset(TEMP_REG1, a64::CondCode::kNE);                                  // cset  temp1,ne
+			}
+			if (compute_hi)
+				a.tst(lo, lo);                                                          // tst   lo,lo
+			else
+				a.tst(lo.w(), lo.w());                                                  // tst   lo,lo
+			if (inst.flags() & FLAG_V)
+				store_overflow_reg(a, TEMP_REG1);
+		}
+	}
+
+	// 64-bit form
+	else
+	{
+		if (compute_hi || (inst.flags() != 0))
+			a.smulh(hi, src1, src2);                                                    // smulh hi,src1,src2
+		a.mul(lo, src1, src2);                                                          // mul   lo,src1,src2
+		mov_param_reg(a, 8, dstp, lo);                                                  // mov   dstp,lo
+		if (compute_hi)
+			mov_param_reg(a, 8, edstp, hi);                                             // mov   edstp,hi
+
+		if (inst.flags() != 0)
+		{
+			if (inst.flags() & FLAG_V)
+			{
+				a.cmp(hi, lo, a64::asr(63));                                            // cmp   hi,lo,asr #63
+				a.cset(TEMP_REG2, a64::CondCode::kNE);                                  // cset  temp2,ne
+			}
+			if (compute_hi)
+			{
+				// sign from the high half, zero from both halves
+				a.cmp(lo, 0);                                                           // cmp   lo,#0
+				a.cset(TEMP_REG1, a64::CondCode::kNE);                                  // cset  temp1,ne
+				a.orr(TEMP_REG1, TEMP_REG1, hi);                                        // orr   temp1,temp1,hi
+				a.tst(TEMP_REG1, TEMP_REG1);                                            // tst   temp1,temp1
+			}
+			else
+			{
+				a.tst(lo, lo);                                                          // tst   lo,lo
+			}
+			if (inst.flags() & FLAG_V)
+				store_overflow_reg(a, TEMP_REG2);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  op_divu - process a DIVU opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_divu(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter edstp(*this, inst.param(1), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(2), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(3), PTYPE_MRI);
+	bool const compute_rem = (dstp != edstp);
+
+	Label skip = a.newLabel();
+
+	a64::Gp const src2 = get_src_reg(a, inst.size(), src2p, TEMP_REG2);
+
+	// division by zero leaves the destinations alone and sets V
+	if (inst.flags() != 0)
+	{
+		a.mov(FLAGS_REG, NZCV_C | NZCV_V);                                              // mov   flags,#(C|V)
+		a.msr(Imm(a64::Predicate::SysReg::kNZCV), FLAGS_REG);                           // msr   nzcv,flags
+	}
+	a.cbz(src2, skip);                                                                  // cbz   src2,skip
+
+	a64::Gp const src1 = get_src_reg(a, inst.size(), src1p, TEMP_REG1);
+	a64::Gp const quotient = select_size(TEMP_REG3, inst.size());
+	a.udiv(quotient, src1, src2);                                                       // udiv  quotient,src1,src2
+	if (compute_rem)
+	{
+		a64::Gp const remainder = select_size(TEMP_REG4, inst.size());
+		a.msub(remainder, quotient, src2, src1);                                        // msub  remainder,quotient,src2,src1
+		mov_param_reg(a, inst.size(), edstp, remainder);                                // mov   edstp,remainder
+	}
+	mov_param_reg(a, inst.size(), dstp, quotient);                                      // mov   dstp,quotient
+	if (inst.flags() != 0)
+		a.tst(quotient, quotient);                                                      // tst   quotient,quotient
+
+	a.bind(skip);                                                                       // skip:
+}
+
+
+//-------------------------------------------------
+//  op_divs - process a DIVS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_divs(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter edstp(*this, inst.param(1), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(2), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(3), PTYPE_MRI);
+	bool const compute_rem = (dstp != edstp);
+
+	Label skip = a.newLabel();
+
+	a64::Gp const src2 = get_src_reg(a, inst.size(), src2p, TEMP_REG2);
+
+	// division by zero leaves the destinations alone and sets V
+	if (inst.flags() != 0)
+	{
+		a.mov(FLAGS_REG, NZCV_C | NZCV_V);                                              // mov   flags,#(C|V)
+		a.msr(Imm(a64::Predicate::SysReg::kNZCV), FLAGS_REG);                           // msr   nzcv,flags
+	}
+	a.cbz(src2, skip);                                                                  // cbz   src2,skip
+
+	a64::Gp const src1 = get_src_reg(a, inst.size(), src1p, TEMP_REG1);
+	a64::Gp const quotient = select_size(TEMP_REG3, inst.size());
+	a.sdiv(quotient, src1, src2);                                                       // sdiv  quotient,src1,src2
+	if (compute_rem)
+	{
+		a64::Gp const remainder = select_size(TEMP_REG4, inst.size());
+		a.msub(remainder, quotient, src2, src1);                                        // msub  remainder,quotient,src2,src1
+		mov_param_reg(a, inst.size(), edstp, remainder);                                // mov   edstp,remainder
+	}
+	mov_param_reg(a, inst.size(), dstp, quotient);                                      // mov   dstp,quotient
+	if (inst.flags() != 0)
+		a.tst(quotient, quotient);                                                      // tst   quotient,quotient
+
+	a.bind(skip);                                                                       // skip:
+}
+
+
+//-------------------------------------------------
+//  op_and - process an AND opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_and(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+	normalize_commutative(src1p, src2p);
+
+	a64::Gp const output = dstp.select_register(TEMP_REG3, inst.size());
+	a64::Gp const src1 = get_src_reg(a, inst.size(), src1p, TEMP_REG1);
+
+	if (src2p.is_immediate() && is_valid_immediate_logical(src2p.immediate(), inst.size()))
+	{
+		uint64_t const imm = (inst.size() == 4) ? uint32_t(src2p.immediate()) : src2p.immediate();
+		if (inst.flags() != 0)
+			a.ands(output, src1, imm);                                                  // ands  output,src1,src2p
+		else
+			a.and_(output, src1, imm);                                                  // and   output,src1,src2p
+	}
+	else
+	{
+		a64::Gp const src2 = get_src_reg(a, inst.size(), src2p, TEMP_REG2);
+		if (inst.flags() != 0)
+			a.ands(output, src1, src2);                                                 // ands  output,src1,src2
+		else
+			a.and_(output, src1, src2);                                                 // and   output,src1,src2
+	}
+
+	mov_param_reg(a, inst.size(), dstp, output);                                        // mov   dstp,output
+}
+
+
+//-------------------------------------------------
+//  op_test - process a TEST opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_test(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter src1p(*this, inst.param(0), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(1), PTYPE_MRI);
+	normalize_commutative(src1p, src2p);
+
+	a64::Gp const src1 = get_src_reg(a, inst.size(), src1p, TEMP_REG1);
+
+	if (src2p.is_immediate() && is_valid_immediate_logical(src2p.immediate(), inst.size()))
+	{
+		uint64_t const imm = (inst.size() == 4) ? uint32_t(src2p.immediate()) : src2p.immediate();
+		a.tst(src1, imm);                                                               // tst   src1,src2p
+	}
+	else
+	{
+		a64::Gp const src2 = get_src_reg(a, inst.size(), src2p, TEMP_REG2);
+		a.tst(src1, src2);                                                              // tst   src1,src2
+	}
+}
+
+
+//-------------------------------------------------
+//  op_logical - common code for OR and XOR; these
+//  have no flag-setting form on the host so the
+//  flags come from a test of the result
+//-------------------------------------------------
+
+template <a64::Inst::Id Opcode> void drcbe_arm64::op_logical(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+	normalize_commutative(src1p, src2p);
+
+	a64::Gp const output = dstp.select_register(TEMP_REG3, inst.size());
+	a64::Gp const src1 = get_src_reg(a, inst.size(), src1p, TEMP_REG1);
+
+	if (src2p.is_immediate() && is_valid_immediate_logical(src2p.immediate(), inst.size()))
+	{
+		uint64_t const imm = (inst.size() == 4) ? uint32_t(src2p.immediate()) : src2p.immediate();
+		a.emit(Opcode, output, src1, imm);                                              // orr   output,src1,src2p
+	}
+	else
+	{
+		a64::Gp const src2 = get_src_reg(a, inst.size(), src2p, TEMP_REG2);
+		a.emit(Opcode, output, src1, src2);                                             // orr   output,src1,src2
+	}
+
+	mov_param_reg(a, inst.size(), dstp, output);                                        // mov   dstp,output
+	if (inst.flags() != 0)
+		a.tst(output, output);                                                          // tst   output,output
+}
+
+
+//-------------------------------------------------
+//  op_lzcnt - process a LZCNT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_lzcnt(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+
+	a64::Gp const output = dstp.select_register(TEMP_REG2, inst.size());
+	a64::Gp const src = get_src_reg(a, inst.size(), srcp, TEMP_REG1);
+
+	a.clz(output, src);                                                                 // clz   output,src
+	mov_param_reg(a, inst.size(), dstp, output);                                        // mov   dstp,output
+	if (inst.flags() != 0)
+		a.tst(output, output);                                                          // tst   output,output
+}
+
+
+//-------------------------------------------------
+//  op_tzcnt - process a TZCNT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_tzcnt(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+
+	a64::Gp const output = dstp.select_register(TEMP_REG2, inst.size());
+	a64::Gp const src = get_src_reg(a, inst.size(), srcp, TEMP_REG1);
+
+	a.rbit(output, src);                                                                // rbit  output,src
+	a.clz(output, output);                                                              // clz   output,output
+	mov_param_reg(a, inst.size(), dstp, output);                                        // mov   dstp,output
+
+	// only the zero flag is defined, and only for an all-zero source
+	if (inst.flags() != 0)
+	{
+		a.mvn(FLAGS_TEMP.w(), output.w());                                              // mvn   temp,output
+		a.tst(FLAGS_TEMP.w(), inst.size() * 8);                                         // tst   temp,#bits
+	}
+}
+
+
+//-------------------------------------------------
+//  op_bswap - process a BSWAP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_bswap(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+
+	a64::Gp const output = dstp.select_register(TEMP_REG2, inst.size());
+	a64::Gp const src = get_src_reg(a, inst.size(), srcp, TEMP_REG1);
+
+	a.rev(output, src);                                                                 // rev   output,src
+	mov_param_reg(a, inst.size(), dstp, output);                                        // mov   dstp,output
+	if (inst.flags() != 0)
+		a.tst(output, output);                                                          // tst   output,output
+}
+
+
+//-------------------------------------------------
+//  op_shift - process a SHL, SHR, SAR or ROR
+//  opcode; the carry is computed from the source
+//  before it can be overwritten, and a shift by
+//  zero leaves the flags alone except for ROR
+//-------------------------------------------------
+
+template <a64::Inst::Id Opcode> void drcbe_arm64::op_shift(a64::Assembler &a, const uml::instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter shiftp(*this, inst.param(2), PTYPE_MRI);
+
+	int const bits = inst.size() * 8;
+	bool const carry = (inst.flags() & FLAG_C) != 0;
+	a64::Gp const carryreg = select_size(FLAGS_TEMP, inst.size());
+	a64::Gp const zero = select_size(a64::xzr, inst.size());
+
+	a64::Gp const output = dstp.select_register(TEMP_REG3, inst.size());
+	a64::Gp const src = get_src_reg(a, inst.size(), srcp, TEMP_REG1);
+
+	if (shiftp.is_immediate())
+	{
+		int const shift = shiftp.immediate() & (bits - 1);
+
+		// shift by zero is a move
+		if (shift == 0)
+		{
+			if (output.id() != src.id())
+				a.mov(output, src);                                                     // mov   output,src
+			mov_param_reg(a, inst.size(), dstp, output);                                // mov   dstp,output
+			if ((Opcode == a64::Inst::kIdRor) && (inst.flags() != 0))
+			{
+				a.tst(output, output);                                                  // tst   output,output
+				if (carry)
+					store_carry_reg(a, zero);
+			}
+			return;
+		}
+
+		if (carry && (Opcode == a64::Inst::kIdLsl))
+			a.lsr(carryreg, src, bits - shift);                                         // lsr   carry,src,#(bits-shift)
+		else if (carry && (Opcode != a64::Inst::kIdRor))
+			a.lsr(carryreg, src, shift - 1);                                            // lsr   carry,src,#(shift-1)
+
+		a.emit(Opcode, output, src, shift);                                             // op    output,src,#shift
+
+		if (carry && (Opcode == a64::Inst::kIdRor))
+			a.lsr(carryreg, output, bits - 1);                                          // lsr   carry,output,#(bits-1)
+
+		mov_param_reg(a, inst.size(), dstp, output);                                    // mov   dstp,output
+		if (inst.flags() != 0)
+		{
+			a.tst(output, output);                                                      // tst   output,output
+			if (carry)
+				store_carry_reg(a, carryreg);
+		}
+	}
+	else
+	{
+		a64::Gp const shift = get_src_reg(a, inst.size(), shiftp, TEMP_REG2);
+
+		// no flags: the host masks the count for us
+		if (inst.flags() == 0)
+		{
+			a.emit(Opcode, output, src, shift);                                         // op    output,src,shift
+			mov_param_reg(a, inst.size(), dstp, output);                                // mov   dstp,output
+			return;
+		}
+
+		a64::Gp const count = select_size(TEMP_REG4, inst.size());
+		a64::Gp const temp = select_size(TEMP_REG2, inst.size());
+		a.and_(count, shift, bits - 1);                                                 // and   count,shift,#(bits-1)
+
+		if (carry && (Opcode == a64::Inst::kIdLsl))
+		{
+			a.neg(temp, count);                                                         // neg   temp,count
+			a.lsr(carryreg, src, temp);                                                 // lsr   carry,src,temp
+		}
+		else if (carry && (Opcode != a64::Inst::kIdRor))
+		{
+			a.sub(temp, count, 1);                                                      // sub   temp,count,#1
+			a.lsr(carryreg, src, temp);                                                 // lsr   carry,src,temp
+		}
+
+		a.emit(Opcode, output, src, count);                                             // op    output,src,count
+
+		if (carry && (Opcode == a64::Inst::kIdRor))
+			a.lsr(carryreg, output, bits - 1);                                          // lsr   carry,output,#(bits-1)
+
+		mov_param_reg(a, inst.size(), dstp, output);                                    // mov   dstp,output
+
+		if (Opcode == a64::Inst::kIdRor)
+		{
+			// ROR always sets the flags, but only produces a carry for a non-zero count
+			if (carry)
+			{
+				a.cmp(count, 0);                                                        // cmp   count,#0
+				a.csel(carryreg, carryreg, zero, a64::CondCode::kNE);                   // csel  carry,carry,zero,ne
+			}
+			a.tst(output, output);                                                      // tst   output,output
+			if (carry)
+				store_carry_reg(a, carryreg);
+		}
+		else
+		{
+			Label skip = a.newLabel();
+			a.cbz(count, skip);                                                         // cbz   count,skip
+			a.tst(output, output);                                                      // tst   output,output
+			if (carry)
+				store_carry_reg(a, carryreg);
+			a.bind(skip);                                                               // skip:
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  op_rol - process a ROL opcode; the host only
+//  rotates right, so the count is negated
+//-------------------------------------------------
+
+void drcbe_arm64::op_rol(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter shiftp(*this, inst.param(2), PTYPE_MRI);
+
+	int const bits = inst.size() * 8;
+
+	a64::Gp const output = dstp.select_register(TEMP_REG3, inst.size());
+	a64::Gp const src = get_src_reg(a, inst.size(), srcp, TEMP_REG1);
+
+	if (shiftp.is_immediate())
+	{
+		int const shift = shiftp.immediate() & (bits - 1);
+
+		if (shift != 0)
+			a.ror(output, src, bits - shift);                                           // ror   output,src,#(bits-shift)
+		else if (output.id() != src.id())
+			a.mov(output, src);                                                         // mov   output,src
+		mov_param_reg(a, inst.size(), dstp, output);                                    // mov   dstp,output
+
+		// the carry is the bit rotated into the bottom of the result
+		if ((shift != 0) && (inst.flags() != 0))
+		{
+			a.tst(output, output);                                                      // tst   output,output
+			if (inst.flags() & FLAG_C)
+				store_carry_reg(a, output);
+		}
+	}
+	else
+	{
+		a64::Gp const shift = get_src_reg(a, inst.size(), shiftp, TEMP_REG2);
+		a64::Gp const count = select_size(TEMP_REG4, inst.size());
+		a64::Gp const temp = select_size(TEMP_REG2, inst.size());
+
+		if (inst.flags() != 0)
+		{
+			a.and_(count, shift, bits - 1);                                             // and   count,shift,#(bits-1)
+			a.neg(temp, count);                                                         // neg   temp,count
+		}
+		else
+		{
+			a.neg(temp, shift);                                                         // neg   temp,shift
+		}
+		a.ror(output, src, temp);                                                       // ror   output,src,temp
+		mov_param_reg(a, inst.size(), dstp, output);                                    // mov   dstp,output
+
+		if (inst.flags() != 0)
+		{
+			Label skip = a.newLabel();
+			a.cbz(count, skip);                                                         // cbz   count,skip
+			a.tst(output, output);                                                      // tst   output,output
+			if (inst.flags() & FLAG_C)
+				store_carry_reg(a, output);
+			a.bind(skip);                                                               // skip:
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  op_rolc - process a ROLC opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_rolc(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter shiftp(*this, inst.param(2), PTYPE_MRI);
+
+	int const bits = inst.size() * 8;
+	bool const carry = (inst.flags() & FLAG_C) != 0;
+	a64::Gp const carryreg = select_size(FLAGS_TEMP, inst.size());
+	a64::Gp const zero = select_size(a64::xzr, inst.size());
+	a64::Gp const carryin = select_size(TEMP_REG3, inst.size());
+	a64::Gp const output = select_size(TEMP_REG4, inst.size());
+
+	a64::Gp const src = get_src_reg(a, inst.size(), srcp, TEMP_REG1);
+
+	// capture the incoming UML carry before anything touches the flags
+	a.cset(carryin, a64::CondCode::kCC);                                                // cset  carryin,cc
+
+	if (shiftp.is_immediate())
+	{
+		int const shift = shiftp.immediate() & (bits - 1);
+
+		if (shift == 0)
+		{
+			mov_param_reg(a, inst.size(), dstp, src);                                   // mov   dstp,src
+			if (inst.flags() != 0)
+			{
+				a.tst(src, src);                                                        // tst   src,src
+				if (carry)
+					store_carry_reg(a, zero);
+			}
+			return;
+		}
+
+		if (carry)
+			a.lsr(carryreg, src, bits - shift);                                         // lsr   carry,src,#(bits-shift)
+		a.lsl(output, src, shift);                                                      // lsl   output,src,#shift
+		a.orr(output, output, carryin, a64::lsl(shift - 1));                            // orr   output,output,carryin,lsl #(shift-1)
+		if (shift > 1)
+			a.orr(output, output, src, a64::lsr(bits + 1 - shift));                     // orr   output,output,src,lsr #(bits+1-shift)
+
+		mov_param_reg(a, inst.size(), dstp, output);                                    // mov   dstp,output
+		if (inst.flags() != 0)
+		{
+			a.tst(output, output);                                                      // tst   output,output
+			if (carry)
+				store_carry_reg(a, carryreg);
+		}
+	}
+	else
+	{
+		a64::Gp const shift = get_src_reg(a, inst.size(), shiftp, TEMP_REG2);
+		a64::Gp const count = select_size(TEMP_REG2, inst.size());
+
+		Label zerocount = a.newLabel();
+		Label done = a.newLabel();
+
+		a.and_(count, shift, bits - 1);                                                 // and   count,shift,#(bits-1)
+		a.cbz(count, zerocount);                                                        // cbz   count,zerocount
+
+		a.lsl(output, src, count);                                                      // lsl   output,src,count
+		a.lsl(carryin, carryin, count);                                                 // lsl   carryin,carryin,count
+		a.orr(output, output, carryin, a64::lsr(1));                                    // orr   output,output,carryin,lsr #1
+		a.neg(carryreg, count);                                                         // neg   temp,count
+		a.lsr(carryin, src, 1);                                                         // lsr   carryin,src,#1
+		a.lsr(carryin, carryin, carryreg);                                              // lsr   carryin,carryin,temp
+		a.orr(output, output, carryin);                                                 // orr   output,output,carryin
+		if (carry)
+			a.lsr(carryreg, src, carryreg);                                             // lsr   carry,src,temp
+
+		mov_param_reg(a, inst.size(), dstp, output);                                    // mov   dstp,output
+		if (inst.flags() != 0)
+		{
+			a.tst(output, output);                                                      // tst   output,output
+			if (carry)
+				store_carry_reg(a, carryreg);
+		}
+		a.b(done);                                                                      // b     done
+
+		a.bind(zerocount);                                                              // zerocount:
+		mov_param_reg(a, inst.size(), dstp, src);                                       // mov   dstp,src
+		if (inst.flags() != 0)
+		{
+			a.tst(src, src);                                                            // tst   src,src
+			if (carry)
+				store_carry_reg(a, zero);
+		}
+
+		a.bind(done);                                                                   // done:
+	}
+}
+
+
+//-------------------------------------------------
+//  op_rorc - process a RORC opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_rorc(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter shiftp(*this, inst.param(2), PTYPE_MRI);
+
+	int const bits = inst.size() * 8;
+	bool const carry = (inst.flags() & FLAG_C) != 0;
+	a64::Gp const carryreg = select_size(FLAGS_TEMP, inst.size());
+	a64::Gp const zero = select_size(a64::xzr, inst.size());
+	a64::Gp const carryin = select_size(TEMP_REG3, inst.size());
+	a64::Gp const output = select_size(TEMP_REG4, inst.size());
+
+	a64::Gp const src = get_src_reg(a, inst.size(), srcp, TEMP_REG1);
+
+	// capture the incoming UML carry before anything touches the flags
+	a.cset(carryin, a64::CondCode::kCC);                                                // cset  carryin,cc
+
+	if (shiftp.is_immediate())
+	{
+		int const shift = shiftp.immediate() & (bits - 1);
+
+		if (shift == 0)
+		{
+			mov_param_reg(a, inst.size(), dstp, src);                                   // mov   dstp,src
+			if (inst.flags() != 0)
+			{
+				a.tst(src, src);                                                        // tst   src,src
+				if (carry)
+					store_carry_reg(a, zero);
+			}
+			return;
+		}
+
+		if (carry)
+			a.lsr(carryreg, src, shift - 1);                                            // lsr   carry,src,#(shift-1)
+		a.lsr(output, src, shift);                                                      // lsr   output,src,#shift
+		a.orr(output, output, carryin, a64::lsl(bits - shift));                         // orr   output,output,carryin,lsl #(bits-shift)
+		if (shift > 1)
+			a.orr(output, output, src, a64::lsl(bits + 1 - shift));                     // orr   output,output,src,lsl #(bits+1-shift)
+
+		mov_param_reg(a, inst.size(), dstp, output);                                    // mov   dstp,output
+		if (inst.flags() != 0)
+		{
+			a.tst(output, output);                                                      // tst   output,output
+			if (carry)
+				store_carry_reg(a, carryreg);
+		}
+	}
+	else
+	{
+		a64::Gp const shift = get_src_reg(a, inst.size(), shiftp, TEMP_REG2);
+		a64::Gp const count = select_size(TEMP_REG2, inst.size());
+
+		Label zerocount = a.newLabel();
+		Label done = a.newLabel();
+
+		a.and_(count, shift, bits - 1);                                                 // and   count,shift,#(bits-1)
+		a.cbz(count, zerocount);                                                        // cbz   count,zerocount
+
+		a.lsr(output, src, count);                                                      // lsr   output,src,count
+		a.neg(carryreg, count);                                                         // neg   temp,count
+		a.lsl(carryin, carryin, carryreg);                                              // lsl   carryin,carryin,temp
+		a.orr(output, output, carryin);                                                 // orr   output,output,carryin
+		a.lsl(carryin, src, 1);                                                         // lsl   carryin,src,#1
+		a.lsl(carryin, carryin, carryreg);                                              // lsl   carryin,carryin,temp
+		a.orr(output, output, carryin);                                                 // orr   output,output,carryin
+		if (carry)
+		{
+			a.sub(carryreg, count, 1);                                                  // sub   temp,count,#1
+			a.lsr(carryreg, src, carryreg);                                             // lsr   carry,src,temp
+		}
+
+		mov_param_reg(a, inst.size(), dstp, output);                                    // mov   dstp,output
+		if (inst.flags() != 0)
+		{
+			a.tst(output, output);                                                      // tst   output,output
+			if (carry)
+				store_carry_reg(a, carryreg);
+		}
+		a.b(done);                                                                      // b     done
+
+		a.bind(zerocount);                                                              // zerocount:
+		mov_param_reg(a, inst.size(), dstp, src);                                       // mov   dstp,src
+		if (inst.flags() != 0)
+		{
+			a.tst(src, src);                                                            // tst   src,src
+			if (carry)
+				store_carry_reg(a, zero);
+		}
+
+		a.bind(done);                                                                   // done:
+	}
+}
+
+
+
+/***************************************************************************
+    FLOATING POINT OPERATIONS
+***************************************************************************/
+
+//-------------------------------------------------
+//  op_fload - process a FLOAD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fload(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter basep(*this, inst.param(1), PTYPE_M);
+	be_parameter indp(*this, inst.param(2), PTYPE_MRI);
+
+	// pick a target register for the general case
+	a64::Vec const dstreg = dstp.select_register(TEMPF_REG1, inst.size());
+	int const size = (inst.size() == 4) ? SIZE_DWORD : SIZE_QWORD;
+
+	emit_ldr_str_indexed(a, a64::Inst::kIdLdr_v, dstreg, basep, indp, size, size);     // ldr   dstreg,[basep + size*indp]
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_fstore - process a FSTORE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fstore(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter basep(*this, inst.param(0), PTYPE_M);
+	be_parameter indp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter srcp(*this, inst.param(2), PTYPE_MF);
+
+	// pick a source register for the general case
+	a64::Vec const srcreg = srcp.select_register(TEMPF_REG1, inst.size());
+	int const size = (inst.size() == 4) ? SIZE_DWORD : SIZE_QWORD;
+
+	mov_float_reg_param(a, inst.size(), srcreg, srcp);                                  // fmov  srcreg,srcp
+	emit_ldr_str_indexed(a, a64::Inst::kIdStr_v, srcreg, basep, indp, size, size);      // str   srcreg,[basep + size*indp]
+}
+
+
+//-------------------------------------------------
+//  op_fread - process a FREAD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fread(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter addrp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &spacep = inst.param(2);
+	assert(spacep.is_size_space());
+	assert((1 << spacep.size()) == inst.size());
+
+	// set up a call to the read dword/qword handler
+	mov_reg_param(a, 4, REG_PARAM2, addrp);                                             // mov   param2,addrp
+	call_read_handler(a, spacep.space(), spacep.size(), false);
+
+	// store result
+	if (dstp.is_memory())
+	{
+		emit_str_mem(a, select_size(REG_PARAM1, inst.size()), dstp.memory());          // str   x0,[dstp]
+	}
+	else
+	{
+		a64::Vec const dstreg = dstp.get_register_float(inst.size());
+		a.fmov(dstreg, select_size(REG_PARAM1, inst.size()));                           // fmov  dstp,x0
+	}
+}
+
+
+//-------------------------------------------------
+//  op_fwrite - process a FWRITE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fwrite(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter addrp(*this, inst.param(0), PTYPE_MRI);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+	const parameter &spacep = inst.param(2);
+	assert(spacep.is_size_space());
+	assert((1 << spacep.size()) == inst.size());
+
+	// set up a call to the write dword/qword handler
+	mov_reg_param(a, 4, REG_PARAM2, addrp);                                             // mov   param2,addrp
+	if (srcp.is_memory())
+		emit_ldr_mem(a, select_size(REG_PARAM3, inst.size()), srcp.memory());           // ldr   param3,[srcp]
+	else
+		a.fmov(select_size(REG_PARAM3, inst.size()), srcp.get_register_float(inst.size()));    // fmov  param3,srcp
+	call_write_handler(a, spacep.space(), spacep.size(), false);
+}
+
+
+//-------------------------------------------------
+//  op_fmov - process a FMOV opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fmov(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+
+	// conditional move to a register; loading the source doesn't affect the flags
+	if (inst.condition() != uml::COND_ALWAYS && dstp.is_float_register())
+	{
+		a64::Vec const dstreg = dstp.get_register_float(inst.size());
+		a64::Vec const srcreg = srcp.select_register(TEMPF_REG1, inst.size());
+		mov_float_reg_param(a, inst.size(), srcreg, srcp);                              // fmov  srcreg,srcp
+		a.fcsel(dstreg, srcreg, dstreg, ARM_CONDITION(inst.condition()));               // fcsel dstp,srcreg,dstp,cc
+		return;
+	}
+
+	// add a conditional branch for the remaining cases
+	Label skip = a.newLabel();
+	emit_skip(a, inst.condition(), skip);                                               // b.!cc skip
+
+	// load directly into the destination register where possible
+	a64::Vec const dstreg = dstp.select_register(TEMPF_REG1, inst.size());
+	mov_float_reg_param(a, inst.size(), dstreg, srcp);                                  // fmov  dstreg,srcp
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+
+	// resolve the jump
+	a.bind(skip);                                                                       // skip:
+}
+
+
+//-------------------------------------------------
+//  op_ftoint - process a FTOINT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_ftoint(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+	const parameter &sizep = inst.param(2);
+	assert(sizep.is_size());
+	const parameter &roundp = inst.param(3);
+	assert(roundp.is_rounding());
+
+	uint32_t const dstsize = (sizep.size() == SIZE_DWORD) ? 4 : 8;
+
+	// pick target and source registers for the general case
+	a64::Gp const dstreg = dstp.select_register(TEMP_REG1, dstsize);
+	a64::Vec const srcreg = srcp.select_register(TEMPF_REG1, inst.size());
+	mov_float_reg_param(a, inst.size(), srcreg, srcp);                                  // fmov   srcreg,srcp
+
+	// the host has a conversion for each explicit rounding mode
+	switch (roundp.rounding())
+	{
+		case ROUND_ROUND:
+			a.fcvtns(dstreg, srcreg);                                                   // fcvtns dstreg,srcreg
+			break;
+
+		case ROUND_CEIL:
+			a.fcvtps(dstreg, srcreg);                                                   // fcvtps dstreg,srcreg
+			break;
+
+		case ROUND_FLOOR:
+			a.fcvtms(dstreg, srcreg);                                                   // fcvtms dstreg,srcreg
+			break;
+
+		case ROUND_DEFAULT:
+			a.frintx(select_size(TEMPF_REG2, inst.size()), srcreg);            // frintx temp,srcreg
+			a.fcvtzs(dstreg, select_size(TEMPF_REG2, inst.size()));            // fcvtzs dstreg,temp
+			break;
+
+		case ROUND_TRUNC:
+		default:
+			a.fcvtzs(dstreg, srcreg);                                                   // fcvtzs dstreg,srcreg
+			break;
+	}
+
+	mov_param_reg(a, dstsize, dstp, dstreg);                                            // mov    dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_ffrint - process a FFRINT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_ffrint(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &sizep = inst.param(2);
+	assert(sizep.is_size());
+
+	uint32_t const srcsize = (sizep.size() == SIZE_DWORD) ? 4 : 8;
+
+	// pick a target register for the general case
+	a64::Vec const dstreg = dstp.select_register(TEMPF_REG1, inst.size());
+	a64::Gp const src = get_src_reg(a, srcsize, srcp, TEMP_REG1);
+
+	a.scvtf(dstreg, src);                                                               // scvtf dstreg,src
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_ffrflt - process a FFRFLT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_ffrflt(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+	const parameter &sizep = inst.param(2);
+	assert(sizep.is_size());
+
+	uint32_t const srcsize = (sizep.size() == SIZE_DWORD) ? 4 : 8;
+
+	// nothing to convert between identical formats
+	if (srcsize == inst.size())
+		return;
+
+	// pick target and source registers for the general case
+	a64::Vec const dstreg = dstp.select_register(TEMPF_REG1, inst.size());
+	a64::Vec const srcreg = srcp.select_register(TEMPF_REG2, srcsize);
+	mov_float_reg_param(a, srcsize, srcreg, srcp);                                      // fmov  srcreg,srcp
+
+	a.fcvt(dstreg, srcreg);                                                             // fcvt  dstreg,srcreg
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_frnds - process a FRNDS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_frnds(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+
+	// pick target and source registers for the general case
+	a64::Vec const dstreg = dstp.select_register(TEMPF_REG1, inst.size());
+	a64::Vec const srcreg = srcp.select_register(TEMPF_REG2, inst.size());
+	mov_float_reg_param(a, inst.size(), srcreg, srcp);                                  // fmov  srcreg,srcp
+
+	a.fcvt(TEMPF_REG3.s(), srcreg);                                                     // fcvt  temp,srcreg
+	a.fcvt(dstreg, TEMPF_REG3.s());                                                     // fcvt  dstreg,temp
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_float_alu - process a three-operand float
+//  opcode (FADD, FSUB, FMUL, FDIV)
+//-------------------------------------------------
+
+template <a64::Inst::Id Opcode> void drcbe_arm64::op_float_alu(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MF);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MF);
+
+	// pick target and source registers for the general case
+	a64::Vec const dstreg = dstp.select_register(TEMPF_REG3, inst.size());
+	a64::Vec const src1 = src1p.select_register(TEMPF_REG1, inst.size());
+	a64::Vec const src2 = src2p.select_register(TEMPF_REG2, inst.size());
+	mov_float_reg_param(a, inst.size(), src1, src1p);                                   // fmov  src1,src1p
+	mov_float_reg_param(a, inst.size(), src2, src2p);                                   // fmov  src2,src2p
+
+	a.emit(Opcode, dstreg, src1, src2);                                                 // op    dstreg,src1,src2
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_float_alu2 - process a two-operand float
+//  opcode (FNEG, FABS, FSQRT)
+//-------------------------------------------------
+
+template <a64::Inst::Id Opcode> void drcbe_arm64::op_float_alu2(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+
+	// pick target and source registers for the general case
+	a64::Vec const dstreg = dstp.select_register(TEMPF_REG2, inst.size());
+	a64::Vec const srcreg = srcp.select_register(TEMPF_REG1, inst.size());
+	mov_float_reg_param(a, inst.size(), srcreg, srcp);                                  // fmov  srcreg,srcp
+
+	a.emit(Opcode, dstreg, srcreg);                                                     // op    dstreg,srcreg
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_fcmp - process a FCMP opcode; the host
+//  flags already match once the carry is
+//  inverted, and unordered sets V
+//-------------------------------------------------
+
+void drcbe_arm64::op_fcmp(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_Z | FLAG_U);
+
+	// normalize parameters
+	be_parameter src1p(*this, inst.param(0), PTYPE_MF);
+	be_parameter src2p(*this, inst.param(1), PTYPE_MF);
+
+	// pick source registers for the general case
+	a64::Vec const src1 = src1p.select_register(TEMPF_REG1, inst.size());
+	a64::Vec const src2 = src2p.select_register(TEMPF_REG2, inst.size());
+	mov_float_reg_param(a, inst.size(), src1, src1p);                                   // fmov  src1,src1p
+	mov_float_reg_param(a, inst.size(), src2, src2p);                                   // fmov  src2,src2p
+
+	a.fcmp(src1, src2);                                                                 // fcmp  src1,src2
+}
+
+
+//-------------------------------------------------
+//  op_frecip - process a FRECIP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_frecip(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+
+	// pick target and source registers for the general case
+	a64::Vec const dstreg = dstp.select_register(TEMPF_REG3, inst.size());
+	a64::Vec const srcreg = srcp.select_register(TEMPF_REG1, inst.size());
+	a64::Vec const one = select_size(TEMPF_REG2, inst.size());
+	mov_float_reg_param(a, inst.size(), srcreg, srcp);                                  // fmov  srcreg,srcp
+
+	a.fmov(one, 1.0);                                                                   // fmov  one,#1.0
+	a.fdiv(dstreg, one, srcreg);                                                        // fdiv  dstreg,one,srcreg
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_frsqrt - process a FRSQRT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_frsqrt(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+
+	// pick target and source registers for the general case
+	a64::Vec const dstreg = dstp.select_register(TEMPF_REG3, inst.size());
+	a64::Vec const srcreg = srcp.select_register(TEMPF_REG1, inst.size());
+	a64::Vec const one = select_size(TEMPF_REG2, inst.size());
+	a64::Vec const root = select_size(TEMPF_REG1, inst.size());
+	mov_float_reg_param(a, inst.size(), srcreg, srcp);                                  // fmov  srcreg,srcp
+
+	a.fsqrt(root, srcreg);                                                              // fsqrt root,srcreg
+	a.fmov(one, 1.0);                                                                   // fmov  one,#1.0
+	a.fdiv(dstreg, one, root);                                                          // fdiv  dstreg,one,root
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_fcopyi - process a FCOPYI opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fcopyi(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MR);
+
+	// pick a target register for the general case
+	a64::Vec const dstreg = dstp.select_register(TEMPF_REG1, inst.size());
+
+	if (srcp.is_memory())
+	{
+		emit_float_ldr_mem(a, dstreg, srcp.memory());                                   // ldr   dstreg,[srcp]
+		mov_float_param_reg(a, inst.size(), dstp, dstreg);                              // fmov  dstp,dstreg
+	}
+	else if (dstp.is_memory())
+	{
+		emit_str_mem(a, srcp.get_register_int(inst.size()), dstp.memory());            // str   srcp,[dstp]
+	}
+	else
+	{
+		a.fmov(dstreg, srcp.get_register_int(inst.size()));                             // fmov  dstreg,srcp
+	}
+}
+
+
+//-------------------------------------------------
+//  op_icopyf - process a ICOPYF opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_icopyf(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+
+	// pick a target register for the general case
+	a64::Gp const dstreg = dstp.select_register(TEMP_REG1, inst.size());
+
+	if (srcp.is_memory())
+	{
+		emit_ldr_mem(a, dstreg, srcp.memory());                                         // ldr   dstreg,[srcp]
+		mov_param_reg(a, inst.size(), dstp, dstreg);                                    // mov   dstp,dstreg
+	}
+	else if (dstp.is_memory())
+	{
+		emit_float_str_mem(a, srcp.get_register_float(inst.size()), dstp.memory());    // str   srcp,[dstp]
+	}
+	else
+	{
+		a.fmov(dstreg, srcp.get_register_float(inst.size()));                           // fmov  dstreg,srcp
+	}
+}
+
+
+//**************************************************************************
+//  VECTOR OPERATIONS
+//**************************************************************************
+
+//-------------------------------------------------
+//  op_vector - process a vector opcode; all
+//  operands live in memory and are loaded into
+//  scratch NEON registers
+//-------------------------------------------------
+
+void drcbe_arm64::op_vector(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 16);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	a64::Vec const vec1 = TEMPF_REG1.q();
+	a64::Vec const vec2 = TEMPF_REG2.q();
+	a64::Vec const vec3 = TEMPF_REG3.q();
+
+	emit_float_ldr_mem(a, vec1, vector_pointer(inst.param(1)));                         // ldr   vec1,[src1]
+	if (inst.opcode() != OP_VMOV)
+		emit_float_ldr_mem(a, vec2, vector_pointer(inst.param(2)));                     // ldr   vec2,[src2]
+
+	switch (inst.opcode())
+	{
+	case OP_VMOV:
+		break;
+	case OP_VADD:
+		a.add(vec1.h8(), vec1.h8(), vec2.h8());                                         // add   vec1.8h,vec1.8h,vec2.8h
+		break;
+	case OP_VSUB:
+		a.sub(vec1.h8(), vec1.h8(), vec2.h8());                                         // sub   vec1.8h,vec1.8h,vec2.8h
+		break;
+	case OP_VADDS:
+		a.sqadd(vec1.h8(), vec1.h8(), vec2.h8());                                       // sqadd vec1.8h,vec1.8h,vec2.8h
+		break;
+	case OP_VSUBS:
+		a.sqsub(vec1.h8(), vec1.h8(), vec2.h8());                                       // sqsub vec1.8h,vec1.8h,vec2.8h
+		break;
+	case OP_VMULL:
+		a.mul(vec1.h8(), vec1.h8(), vec2.h8());                                         // mul   vec1.8h,vec1.8h,vec2.8h
+		break;
+	case OP_VMULH:
+		a.smull(vec3.s4(), vec1.h4(), vec2.h4());                                       // smull  vec3.4s,vec1.4h,vec2.4h
+		a.smull2(vec1.s4(), vec1.h8(), vec2.h8());                                      // smull2 vec1.4s,vec1.8h,vec2.8h
+		a.uzp2(vec1.h8(), vec3.h8(), vec1.h8());                                        // uzp2   vec1.8h,vec3.8h,vec1.8h
+		break;
+	case OP_VMULHU:
+		a.umull(vec3.s4(), vec1.h4(), vec2.h4());                                       // umull  vec3.4s,vec1.4h,vec2.4h
+		a.umull2(vec1.s4(), vec1.h8(), vec2.h8());                                      // umull2 vec1.4s,vec1.8h,vec2.8h
+		a.uzp2(vec1.h8(), vec3.h8(), vec1.h8());                                        // uzp2   vec1.8h,vec3.8h,vec1.8h
+		break;
+	case OP_VCMPEQ:
+		a.cmeq(vec1.h8(), vec1.h8(), vec2.h8());                                        // cmeq  vec1.8h,vec1.8h,vec2.8h
+		break;
+	case OP_VCMPLT:
+		a.cmgt(vec1.h8(), vec2.h8(), vec1.h8());                                        // cmgt  vec1.8h,vec2.8h,vec1.8h
+		break;
+	case OP_VSEL:
+		emit_float_ldr_mem(a, vec3, vector_pointer(inst.param(3)));                     // ldr   vec3,[src3]
+		a.bsl(vec1.b16(), vec2.b16(), vec3.b16());                                      // bsl   vec1.16b,vec2.16b,vec3.16b
+		break;
+	default:
+		throw emu_fatalerror("drcbe_arm64::op_vector: unexpected opcode %u", inst.opcode());
+	}
+
+	emit_float_str_mem(a, vec1, vector_pointer(inst.param(0)));                         // str   vec1,[dst]
+}
+
+} // namespace drc
@@ -0,0 +1,302 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    drcbearm64.h
+
+    64-bit AArch64 back-end for the universal machine language.
+
+***************************************************************************/
+#ifndef MAME_CPU_DRCBEARM64_H
+#define MAME_CPU_DRCBEARM64_H
+
+#pragma once
+
+#include "drcuml.h"
+#include "drcbeut.h"
+
+#include "asmjit/src/asmjit/core.h"
+#include "asmjit/src/asmjit/a64.h"
+
+#include <vector>
+
+
+namespace drc {
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+class drcbe_arm64 : public drcbe_interface
+{
+	using arm64_entry_point_func = uint32_t (*)(uint8_t *baseptr, drccodeptr entry);
+
+public:
+	// construction/destruction
+	drcbe_arm64(drcuml_state &drcuml, device_t &device, drc_cache &cache, uint32_t flags, int modes, int addrbits, int ignorebits);
+	virtual ~drcbe_arm64();
+
+	// required overrides
+	virtual void reset() override;
+	virtual int execute(uml::code_handle &entry) override;
+	virtual void generate(drcuml_block &block, const uml::instruction *instlist, uint32_t numinst) override;
+	virtual bool hash_exists(uint32_t mode, uint32_t pc) override;
+	virtual void get_info(drcbe_info &info) override;
+	virtual bool logging() const override { return m_log_asmjit != nullptr; }
+
+private:
+	// a be_parameter is similar to a uml::parameter but maps to native registers/memory
+	class be_parameter
+	{
+	public:
+		// parameter types
+		enum be_parameter_type
+		{
+			PTYPE_NONE = 0,                     // invalid
+			PTYPE_IMMEDIATE,                    // immediate; value = sign-extended to 64 bits
+			PTYPE_INT_REGISTER,                 // integer register; value = 0-31
+			PTYPE_FLOAT_REGISTER,               // floating point register; value = 0-31
+			PTYPE_MEMORY,                       // memory; value = pointer to memory
+			PTYPE_MAX
+		};
+
+		// represents the value of a parameter
+		typedef uint64_t be_parameter_value;
+
+		// construction
+		be_parameter() : m_type(PTYPE_NONE), m_value(0) { }
+		be_parameter(be_parameter const &param) : m_type(param.m_type), m_value(param.m_value) { }
+		be_parameter(uint64_t val) : m_type(PTYPE_IMMEDIATE), m_value(val) { }
+		be_parameter(drcbe_arm64 &drcbe, const uml::parameter &param, uint32_t allowed);
+
+		// creators for types that don't safely default
+		static inline be_parameter make_ireg(int regnum) { assert(regnum >= 0 && regnum < 32); return be_parameter(PTYPE_INT_REGISTER, regnum); }
+		static inline be_parameter make_freg(int regnum) { assert(regnum >= 0 && regnum < 32); return be_parameter(PTYPE_FLOAT_REGISTER, regnum); }
+		static inline be_parameter make_memory(void *base) { return be_parameter(PTYPE_MEMORY, reinterpret_cast<be_parameter_value>(base)); }
+		static inline be_parameter make_memory(const void *base) { return be_parameter(PTYPE_MEMORY, reinterpret_cast<be_parameter_value>(const_cast<void *>(base))); }
+
+		// operators
+		be_parameter &operator=(be_parameter const &rhs) = default;
+		bool operator==(be_parameter const &rhs) const { return (m_type == rhs.m_type && m_value == rhs.m_value); }
+		bool operator!=(be_parameter const &rhs) const { return (m_type != rhs.m_type || m_value != rhs.m_value); }
+
+		// getters
+		be_parameter_type type() const { return m_type; }
+		uint64_t immediate() const { assert(m_type == PTYPE_IMMEDIATE); return m_value; }
+		uint32_t ireg() const { assert(m_type == PTYPE_INT_REGISTER); assert(m_value < 32); return m_value; }
+		uint32_t freg() const { assert(m_type == PTYPE_FLOAT_REGISTER); assert(m_value < 32); return m_value; }
+		void *memory() const { assert(m_type == PTYPE_MEMORY); return reinterpret_cast<void *>(m_value); }
+
+		// type queries
+		bool is_immediate() const { return (m_type == PTYPE_IMMEDIATE); }
+		bool is_int_register() const { return (m_type == PTYPE_INT_REGISTER); }
+		bool is_float_register() const { return (m_type == PTYPE_FLOAT_REGISTER); }
+		bool is_memory() const { return (m_type == PTYPE_MEMORY); }
+
+		// other queries
+		bool is_immediate_value(uint64_t value) const { return (m_type == PTYPE_IMMEDIATE && m_value == value); }
+
+		// helpers
+		asmjit::a64::Gp get_register_int(uint32_t regsize) const;
+		asmjit::a64::Vec get_register_float(uint32_t regsize) const;
+		asmjit::a64::Gp select_register(asmjit::a64::Gp const &defreg, uint32_t regsize) const;
+		asmjit::a64::Vec select_register(asmjit::a64::Vec const &defreg, uint32_t regsize) const;
+
+	private:
+		// private constructor
+		be_parameter(be_parameter_type type, be_parameter_value value) : m_type(type), m_value(value) { }
+
+		// internals
+		be_parameter_type   m_type;             // parameter type
+		be_parameter_value  m_value;            // parameter value
+	};
+
+	// helpers
+	void normalize_commutative(be_parameter &inner, be_parameter &outer);
+	bool is_base_relative(const void *ptr, int size = 1) const;
+	void get_imm_relative(asmjit::a64::Assembler &a, asmjit::a64::Gp const &reg, uint64_t ptr) const;
+	void emit_ldr_str_base_mem(asmjit::a64::Assembler &a, asmjit::a64::Inst::Id opcode, asmjit::a64::Reg const &reg, const void *ptr) const;
+	void emit_ldr_mem(asmjit::a64::Assembler &a, asmjit::a64::Gp const &reg, const void *ptr) const;
+	void emit_ldrb_mem(asmjit::a64::Assembler &a, asmjit::a64::Gp const &reg, const void *ptr) const;
+	void emit_str_mem(asmjit::a64::Assembler &a, asmjit::a64::Gp const &reg, const void *ptr) const;
+	void emit_strb_mem(asmjit::a64::Assembler &a, asmjit::a64::Gp const &reg, const void *ptr) const;
+	void emit_float_ldr_mem(asmjit::a64::Assembler &a, asmjit::a64::Vec const &reg, const void *ptr) const;
+	void emit_float_str_mem(asmjit::a64::Assembler &a, asmjit::a64::Vec const &reg, const void *ptr) const;
+	void emit_ldr_str_indexed(asmjit::a64::Assembler &a, asmjit::a64::Inst::Id opcode, asmjit::a64::Reg const &reg, be_parameter const &basep, be_parameter const &indp, int size, int scale) const;
+	void emit_skip(asmjit::a64::Assembler &a, uml::condition_t cond, asmjit::Label &skip) const;
+	void emit_branch(asmjit::a64::Assembler &a, const void *target, bool link) const;
+	void emit_call_handle(asmjit::a64::Assembler &a, uml::code_handle &handle) const;
+	void call_arm_addr(asmjit::a64::Assembler &a, const void *func) const { emit_branch(a, func, true); }
+
+	// flags helpers
+	void flip_carry(asmjit::a64::Assembler &a) const;
+	void store_carry_reg(asmjit::a64::Assembler &a, asmjit::a64::Gp const &reg) const;
+	void store_overflow_reg(asmjit::a64::Assembler &a, asmjit::a64::Gp const &reg) const;
+	void set_rounding_mode(asmjit::a64::Assembler &a, asmjit::a64::Gp const &mode) const;
+
+	static void debug_log_hashjmp(offs_t pc, int mode);
+	static void debug_log_hashjmp_fail();
+
+	// code generators
+	void op_handle(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_hash(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_label(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_comment(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_mapvar(asmjit::a64::Assembler &a, const uml::instruction &inst);
+
+	void op_nop(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_debug(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_exit(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_hashjmp(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_jmp(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_exh(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_callh(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_ret(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_callc(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_recover(asmjit::a64::Assembler &a, const uml::instruction &inst);
+
+	void op_setfmod(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_getfmod(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_getexp(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_getflgs(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_save(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_restore(asmjit::a64::Assembler &a, const uml::instruction &inst);
+
+	void op_load(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_loads(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_store(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_read(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_readm(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_write(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_writem(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_carry(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_set(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_mov(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_sext(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_roland(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_rolins(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	template <asmjit::a64::Inst::Id Opcode> void op_add(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	template <asmjit::a64::Inst::Id Opcode> void op_sub(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_cmp(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_mulu(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_muls(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_divu(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_divs(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_and(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_test(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	template <asmjit::a64::Inst::Id Opcode> void op_logical(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_lzcnt(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_tzcnt(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_bswap(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	template <asmjit::a64::Inst::Id Opcode> void op_shift(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_rol(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_rolc(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_rorc(asmjit::a64::Assembler &a, const uml::instruction &inst);
+
+	void op_fload(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_fstore(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_fread(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_fwrite(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_fmov(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_ftoint(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_ffrint(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_ffrflt(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_frnds(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	template <asmjit::a64::Inst::Id Opcode> void op_float_alu(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	template <asmjit::a64::Inst::Id Opcode> void op_float_alu2(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_fcmp(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_frecip(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_frsqrt(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_fcopyi(asmjit::a64::Assembler &a, const uml::instruction &inst);
+	void op_icopyf(asmjit::a64::Assembler &a, const uml::instruction &inst);
+
+	void op_vector(asmjit::a64::Assembler &a, const uml::instruction &inst);
+
+	// alu and shift operation helpers
+	static bool is_valid_immediate(uint64_t val, int bits) { return val < (uint64_t(1) << bits); }
+	static bool is_valid_immediate_signed(int64_t val, int bits) { return (val >= -(int64_t(1) << (bits - 1))) && (val < (int64_t(1) << (bits - 1))); }
+	static bool is_valid_immediate_addsub(uint64_t val) { return is_valid_immediate(val, 12) || (!(val & 0xfff) && is_valid_immediate(val, 24)); }
+	static bool is_valid_immediate_logical(uint64_t val, uint32_t regsize);
+	asmjit::a64::Gp get_src_reg(asmjit::a64::Assembler &a, uint32_t regsize, be_parameter const &param, asmjit::a64::Gp const &tmp) const;
+
+	// parameter helpers
+	void mov_reg_param(asmjit::a64::Assembler &a, uint32_t regsize, asmjit::a64::Gp const &dst, be_parameter const &src) const;
+	void mov_param_reg(asmjit::a64::Assembler &a, uint32_t regsize, be_parameter const &dst, asmjit::a64::Gp const &src) const;
+	void mov_float_reg_param(asmjit::a64::Assembler &a, uint32_t regsize, asmjit::a64::Vec const &dst, be_parameter const &src) const;
+	void mov_float_param_reg(asmjit::a64::Assembler &a, uint32_t regsize, be_parameter const &dst, asmjit::a64::Vec const &src) const;
+	void mov_r64_imm(asmjit::a64::Assembler &a, asmjit::a64::Gp const &dst, uint64_t imm) const;
+
+	// memory accessor helpers
+	void call_read_handler(asmjit::a64::Assembler &a, int space, int size, bool masked);
+	void call_write_handler(asmjit::a64::Assembler &a, int space, int size, bool masked);
+
+	size_t emit(asmjit::CodeHolder &ch);
+
+	// internal state
+	drc_hash_table          m_hash;                 // hash table state
+	drc_map_variables       m_map;                  // code map
+	FILE *                  m_log_asmjit;           // logging
+
+	uint8_t *               m_baseptr;              // value of the base register
+
+	arm64_entry_point_func  m_entry;                // entry point
+	drccodeptr              m_exit;                 // exit point
+	drccodeptr              m_nocode;               // nocode handler
+
+	// state to live in the near cache
+	struct near_state
+	{
+		void *              debug_cpu_instruction_hook;// debugger callback
+		void *              debug_log_hashjmp;      // hashjmp debugging
+		void *              debug_log_hashjmp_fail; // hashjmp debugging
+		void *              drcmap_get_value;       // map lookup helper
+
+		uint64_t            fpcrsave;               // saved host FPCR
+		void *              stacksave;              // saved stack pointer
+		void *              hashstacksave;          // saved stack pointer for hashjmp
+
+		uint8_t             fprmode[4];             // UML rounding mode to FPCR RMode
+		uint8_t             flagsmap[0x10];         // flags map
+		uint64_t            flagsunmap[0x20];       // flags unmapper
+	};
+	near_state &            m_near;
+
+	// resolved memory handler functions
+	struct resolved_handler { uintptr_t obj = 0; drccodeptr func = nullptr; };
+	struct resolved_accessors
+	{
+		resolved_handler    read_byte;
+		resolved_handler    read_word;
+		resolved_handler    read_word_masked;
+		resolved_handler    read_dword;
+		resolved_handler    read_dword_masked;
+		resolved_handler    read_qword;
+		resolved_handler    read_qword_masked;
+
+		resolved_handler    write_byte;
+		resolved_handler    write_word;
+		resolved_handler    write_word_masked;
+		resolved_handler    write_dword;
+		resolved_handler    write_dword_masked;
+		resolved_handler    write_qword;
+		resolved_handler    write_qword_masked;
+	};
+	using resolved_accessors_vector = std::vector<resolved_accessors>;
+	resolved_accessors_vector m_resolved_accessors;
+
+	// globals
+	using opcode_generate_func = void (drcbe_arm64::*)(asmjit::a64::Assembler &, const uml::instruction &);
+	struct opcode_table_entry
+	{
+		uml::opcode_t           opcode;             // opcode in question
+		opcode_generate_func    func;               // function pointer to the work
+	};
+	static const opcode_table_entry s_opcode_table_source[];
+	static opcode_generate_func s_opcode_table[uml::OP_MAX];
+};
+
+} // namespace drc
+
+using drc::drcbe_arm64;
+
+#endif // MAME_CPU_DRCBEARM64_H
@@ -2087,6 +2087,29 @@ int drcbe_c::execute(code_handle &entry)
 				*inst[0].pint64 = d2u(FDPARAM1);
 				break;
 
+
+			// ----------------------- Vector Operations -----------------------
+
+			case MAKE_OPCODE_SHORT(OP_VMOV, 16, 0):     // VMOV    dst,src
+				*(drcuml_vreg *)inst[0].v = *(drcuml_vreg const *)inst[1].v;
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VADD, 16, 0):     // VADD    dst,src1,src2
+			case MAKE_OPCODE_SHORT(OP_VSUB, 16, 0):     // VSUB    dst,src1,src2
+			case MAKE_OPCODE_SHORT(OP_VADDS, 16, 0):    // VADDS   dst,src1,src2
+			case MAKE_OPCODE_SHORT(OP_VSUBS, 16, 0):    // VSUBS   dst,src1,src2
+			case MAKE_OPCODE_SHORT(OP_VMULL, 16, 0):    // VMULL   dst,src1,src2
+			case MAKE_OPCODE_SHORT(OP_VMULH, 16, 0):    // VMULH   dst,src1,src2
+			case MAKE_OPCODE_SHORT(OP_VMULHU, 16, 0):   // VMULHU  dst,src1,src2
+			case MAKE_OPCODE_SHORT(OP_VCMPEQ, 16, 0):   // VCMPEQ  dst,src1,src2
+			case MAKE_OPCODE_SHORT(OP_VCMPLT, 16, 0):   // VCMPLT  dst,src1,src2
+				vector_operation(OPCODE_GET_SHORT(opcode) >> 2, (drcuml_vreg *)inst[0].v, (drcuml_vreg const *)inst[1].v, (drcuml_vreg const *)inst[2].v, nullptr);
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_VSEL, 16, 0):     // VSEL    dst,mask,src1,src2
+				vector_operation(OP_VSEL, (drcuml_vreg *)inst[0].v, (drcuml_vreg const *)inst[1].v, (drcuml_vreg const *)inst[2].v, (drcuml_vreg const *)inst[3].v);
+				break;
+
 			default:
 				fatalerror("Unexpected opcode!\n");
 		}
@@ -2143,6 +2166,11 @@ void drcbe_c::output_parameter(drcbec_instruction **dstptr, void **immedptr, int
 				(dst++)->pdouble = &m_state.f[param.freg() - REG_F0].d;
 			break;
 
+		// vector registers point to the vector register state
+		case parameter::PTYPE_VECTOR_REGISTER:
+			(dst++)->v = vector_pointer(param);
+			break;
+
 		// convert mapvars to immediates
 		case parameter::PTYPE_MAPVAR:
 			temp_param = m_map.get_last_value(param.mapvar());
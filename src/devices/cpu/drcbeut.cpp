@@ -254,8 +254,9 @@ void drc_map_variables::block_end(drcuml_block &block)
 	dest += 2;
 
 	// get the pointer to the first item and store an initial backwards offset
+	// (measured in the writable view, as the code may execute from another)
 	drccodeptr lastptr = m_entry_list.first()->m_codeptr;
-	*dest = (drccodeptr)dest - lastptr;
+	*dest = (drccodeptr)dest - m_cache.writable(lastptr);
 	dest++;
 
 	// now iterate over entries and store them
@@ -355,6 +356,7 @@ uint32_t drc_map_variables::get_value(drccodeptr codebase, uint32_t mapvar) cons
 	mapvar -= MAPVAR_M0;
 
 	// get an aligned pointer to start scanning
+	codebase = m_cache.writable(codebase);
 	uint64_t *curscan = (uint64_t *)(((uintptr_t)codebase | 7) + 1);
 	uint64_t *endscan = (uint64_t *)m_cache.top();
 
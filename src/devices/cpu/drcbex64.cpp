@@ -173,6 +173,7 @@
 #include "emuopts.h"
 
 #include <cstddef>
+#include <cstring>
 
 
 // This is a trick to make it build on Android where the ARM SDK declares ::REG_Rn
@@ -401,7 +402,20 @@ const drcbe_x64::opcode_table_entry drcbe_x64::s_opcode_table_source[] =
 	{ uml::OP_FRECIP,  &drcbe_x64::op_frecip },     // FRECIP  dst,src1
 	{ uml::OP_FRSQRT,  &drcbe_x64::op_frsqrt },     // FRSQRT  dst,src1
 	{ uml::OP_FCOPYI,  &drcbe_x64::op_fcopyi },     // FCOPYI  dst,src
-	{ uml::OP_ICOPYF,  &drcbe_x64::op_icopyf }      // ICOPYF  dst,src
+	{ uml::OP_ICOPYF,  &drcbe_x64::op_icopyf },     // ICOPYF  dst,src
+
+	// Vector Operations
+	{ uml::OP_VMOV,    &drcbe_x64::op_vector },     // VMOV    dst,src
+	{ uml::OP_VADD,    &drcbe_x64::op_vector },     // VADD    dst,src1,src2
+	{ uml::OP_VSUB,    &drcbe_x64::op_vector },     // VSUB    dst,src1,src2
+	{ uml::OP_VADDS,   &drcbe_x64::op_vector },     // VADDS   dst,src1,src2
+	{ uml::OP_VSUBS,   &drcbe_x64::op_vector },     // VSUBS   dst,src1,src2
+	{ uml::OP_VMULL,   &drcbe_x64::op_vector },     // VMULL   dst,src1,src2
+	{ uml::OP_VMULH,   &drcbe_x64::op_vector },     // VMULH   dst,src1,src2
+	{ uml::OP_VMULHU,  &drcbe_x64::op_vector },     // VMULHU  dst,src1,src2
+	{ uml::OP_VCMPEQ,  &drcbe_x64::op_vector },     // VCMPEQ  dst,src1,src2
+	{ uml::OP_VCMPLT,  &drcbe_x64::op_vector },     // VCMPLT  dst,src1,src2
+	{ uml::OP_VSEL,    &drcbe_x64::op_vector }      // VSEL    dst,mask,src1,src2
 };
 
 class ThrowableErrorHandler : public ErrorHandler
@@ -608,6 +622,38 @@ inline void drcbe_x64::smart_call_m64(Assembler &a, x86code **target)
 
 
 
+//-------------------------------------------------
+//  fastmem_address - generate a check that the
+//  address in REG_PARAM2 lies within the flat
+//  memory window for the space, leaving the host
+//  pointer in RAX or branching to the slow path
+//-------------------------------------------------
+
+bool drcbe_x64::fastmem_address(Assembler &a, int spacenum, int size, bool write, Label const &slow)
+{
+	// only worth it if there's a window now and accesses don't straddle native units
+	if (!m_fastmem)
+		return false;
+	drc_fastmem &fastmem(m_fastmem[spacenum]);
+	drc_fastmem_window &window(write ? fastmem.write : fastmem.read);
+	if (!window.length || (size > fastmem.unit))
+		return false;
+
+	// the window is read at run time in case the memory map changes
+	a.mov(eax, Gpd(REG_PARAM2));                                                        // mov   eax,param2
+	a.sub(eax, MABS(&window.start));                                                    // sub   eax,[window.start]
+	a.cmp(eax, MABS(&window.length));                                                   // cmp   eax,[window.length]
+	a.jae(slow);                                                                        // jae   slow
+	if (size > 1)
+		a.and_(eax, ~uint32_t(size - 1));                                               // and   eax,~(size-1)
+	if (fastmem_xor(fastmem, size))
+		a.xor_(eax, fastmem_xor(fastmem, size));                                        // xor   eax,xor
+	a.add(rax, MABS(&window.base));                                                     // add   rax,[window.base]
+	return true;
+}
+
+
+
 //**************************************************************************
 //  BACKEND CALLBACKS
 //**************************************************************************
@@ -817,7 +863,7 @@ size_t drcbe_x64::emit(CodeHolder &ch)
 			throw emu_fatalerror("asmjit::CodeHolder::relocateToBase() error %d", err);
 	}
 
-	size_t const alignment = ch.baseAddress() - uint64_t(m_cache.top());
+	size_t const alignment = ch.baseAddress() - uint64_t(m_cache.executable(m_cache.top()));
 	size_t const code_size = ch.codeSize();
 
 	// test if enough room remains in drc cache
@@ -825,10 +871,13 @@ size_t drcbe_x64::emit(CodeHolder &ch)
 	if (cachetop == nullptr)
 		return 0;
 
-	err = ch.copyFlattenedData(drccodeptr(ch.baseAddress()), code_size, CopySectionFlags::kPadTargetBuffer);
+	err = ch.copyFlattenedData(m_cache.writable(drccodeptr(ch.baseAddress())), code_size, CopySectionFlags::kPadTargetBuffer);
 	if (err)
 		throw emu_fatalerror("asmjit::CodeHolder::copyFlattenedData() error %d", err);
 
+	// chain direct calls to and from the new code while the cache is writable
+	link_block((x86code *)ch.baseAddress());
+
 	// update the drc cache and end codegen
 	*cachetop += alignment + code_size;
 	m_cache.end_codegen();
@@ -836,6 +885,40 @@ size_t drcbe_x64::emit(CodeHolder &ch)
 	return code_size;
 }
 
+
+//-------------------------------------------------
+//  link_block - record the direct call sites
+//  emitted by the block just copied into the
+//  cache, and point every call site for the
+//  mode/PC entries it registered at the new code
+//-------------------------------------------------
+
+void drcbe_x64::link_block(x86code *base)
+{
+	// remember the call sites so they can be retargeted if the code is replaced
+	for (pending_link const &link : m_pending_links)
+		m_links[link.key].push_back(base + link.offset);
+	m_pending_links.clear();
+
+	// patch the rel32 of each call site targeting a new entry point
+	for (uint64_t const key : m_pending_hashes)
+	{
+		auto const found = m_links.find(key);
+		if (found == m_links.end())
+			continue;
+
+		x86code *const target = m_hash.get_codeptr(uint32_t(key >> 32), uint32_t(key));
+		for (x86code *const site : found->second)
+		{
+			int32_t const delta = int32_t(target - (site + 5));
+			std::memcpy(m_cache.writable(site + 1), &delta, sizeof(delta));
+			osd::invalidate_instruction_cache(site, 5);
+		}
+	}
+	m_pending_hashes.clear();
+}
+
+
 //-------------------------------------------------
 //  reset - reset back-end specific state
 //-------------------------------------------------
@@ -847,7 +930,7 @@ void drcbe_x64::reset()
 		x86log_printf(m_log, "%s", "\n\n===========\nCACHE RESET\n===========\n\n");
 
 	// generate a little bit of glue code to set up the environment
-	x86code *dst = (x86code *)m_cache.top();
+	x86code *dst = (x86code *)m_cache.executable(m_cache.top());
 
 	CodeHolder ch;
 	ch.init(Environment::host(), uint64_t(dst));
@@ -915,6 +998,11 @@ void drcbe_x64::reset()
 	// reset our hash tables
 	m_hash.reset();
 	m_hash.set_default_codeptr(m_nocode);
+
+	// the cache has been flushed, so every chained call site is gone
+	m_links.clear();
+	m_pending_links.clear();
+	m_pending_hashes.clear();
 }
 
 
@@ -940,9 +1028,11 @@ void drcbe_x64::generate(drcuml_block &block, const instruction *instlist, uint3
 	// tell all of our utility objects that a block is beginning
 	m_hash.block_begin(block, instlist, numinst);
 	m_map.block_begin(block);
+	m_pending_links.clear();
+	m_pending_hashes.clear();
 
 	// compute the base by aligning the cache top to a cache line (assumed to be 64 bytes)
-	x86code *dst = (x86code *)(uint64_t(m_cache.top() + 63) & ~63);
+	x86code *dst = (x86code *)(uint64_t(m_cache.executable(m_cache.top()) + 63) & ~63);
 
 	CodeHolder ch;
 	ch.init(Environment::host(), uint64_t(dst));
@@ -1326,6 +1416,9 @@ void drcbe_x64::op_hash(Assembler &a, const instruction &inst)
 
 	// register the current pointer for the mode/PC
 	m_hash.set_codeptr(inst.param(0).immediate(), inst.param(1).immediate(), drccodeptr(a.code()->baseAddress() + a.offset()));
+
+	// existing direct calls to this mode/PC are retargeted once the block is emitted
+	m_pending_hashes.push_back(link_key(inst.param(0).immediate(), inst.param(1).immediate()));
 }
 
 
@@ -1482,12 +1575,24 @@ void drcbe_x64::op_hashjmp(Assembler &a, const instruction &inst)
 	// fixed mode cases
 	if (modep.is_immediate() && m_hash.is_mode_populated(modep.immediate()))
 	{
-		// a straight immediate jump is direct, though we need the PC in EAX in case of failure
+		// a straight immediate jump is chained directly to the target code; the call
+		// goes to the nocode handler until the target is compiled, and is patched
+		// whenever code for the mode/PC is registered
 		if (pcp.is_immediate())
 		{
-			uint32_t l1val = (pcp.immediate() >> m_hash.l1shift()) & m_hash.l1mask();
-			uint32_t l2val = (pcp.immediate() >> m_hash.l2shift()) & m_hash.l2mask();
-			a.call(MABS(&m_hash.base()[modep.immediate()][l1val][l2val]));              // call  hash[modep][l1val][l2val]
+			x86code *const target = m_hash.get_codeptr(modep.immediate(), pcp.immediate());
+			const int64_t delta = target - (x86code *)(a.code()->baseAddress() + a.offset() + 5);
+			if (short_immediate(delta))
+			{
+				m_pending_links.push_back(pending_link{ link_key(modep.immediate(), pcp.immediate()), a.offset() });
+				a.call(imm(target));                                                    // call  target
+			}
+			else
+			{
+				uint32_t l1val = (pcp.immediate() >> m_hash.l1shift()) & m_hash.l1mask();
+				uint32_t l2val = (pcp.immediate() >> m_hash.l2shift()) & m_hash.l2mask();
+				a.call(MABS(&m_hash.base()[modep.immediate()][l1val][l2val]));          // call  hash[modep][l1val][l2val]
+			}
 		}
 
 		// a fixed mode but variable PC
@@ -1995,6 +2100,14 @@ void drcbe_x64::op_save(Assembler &a, const instruction &inst)
 			a.mov(ptr(rcx, regoffs + 8 * regnum), rax);
 		}
 	}
+
+	// copy vector registers
+	regoffs = offsetof(drcuml_machine_state, v);
+	for (int regnum = 0; regnum < std::size(m_state.v); regnum++)
+	{
+		a.movdqu(xmm0, MABS(&m_state.v[regnum], 16));
+		a.movdqu(ptr(rcx, regoffs + 16 * regnum), xmm0);
+	}
 }
 
 
@@ -2040,6 +2153,14 @@ void drcbe_x64::op_restore(Assembler &a, const instruction &inst)
 		}
 	}
 
+	// copy vector registers
+	regoffs = offsetof(drcuml_machine_state, v);
+	for (int regnum = 0; regnum < std::size(m_state.v); regnum++)
+	{
+		a.movdqu(xmm0, ptr(rcx, regoffs + 16 * regnum));
+		a.movdqu(MABS(&m_state.v[regnum], 16), xmm0);
+	}
+
 	Mem fmod = MABS(&m_state.fmod);
 	fmod.setSize(1);
 
@@ -2324,6 +2445,25 @@ void drcbe_x64::op_read(Assembler &a, const instruction &inst)
 	auto &trampolines = m_accessors[spacesizep.space()];
 	auto &resolved = m_resolved_accessors[spacesizep.space()];
 	mov_reg_param(a, Gpd(REG_PARAM2), addrp);                                           // mov    param2,addrp
+
+	// read flat memory directly when the address falls inside it
+	Label const slow = a.newLabel();
+	Label const done = a.newLabel();
+	bool const fast = fastmem_address(a, spacesizep.space(), 1 << spacesizep.size(), false, slow);
+	if (fast)
+	{
+		if (spacesizep.size() == SIZE_BYTE)
+			a.movzx(dstreg, byte_ptr(rax));                                             // movzx  dstreg,[rax]
+		else if (spacesizep.size() == SIZE_WORD)
+			a.movzx(dstreg, word_ptr(rax));                                             // movzx  dstreg,[rax]
+		else if (spacesizep.size() == SIZE_DWORD)
+			a.mov(dstreg, dword_ptr(rax));                                              // mov    dstreg,[rax]
+		else if (spacesizep.size() == SIZE_QWORD)
+			a.mov(dstreg.r64(), qword_ptr(rax));                                        // mov    dstreg,[rax]
+		a.jmp(done);                                                                    // jmp    done
+		a.bind(slow);                                                                   // slow:
+	}
+
 	if (spacesizep.size() == SIZE_BYTE)
 	{
 		if (resolved.read_byte.func)
@@ -2382,6 +2522,8 @@ void drcbe_x64::op_read(Assembler &a, const instruction &inst)
 		if (dstreg != eax)
 			a.mov(dstreg.r64(), rax);                                                   // mov    dstreg,rax
 	}
+	if (fast)
+		a.bind(done);                                                                   // done:
 
 	// store result
 	if (inst.size() == 4)
@@ -2498,6 +2640,25 @@ void drcbe_x64::op_write(Assembler &a, const instruction &inst)
 		mov_reg_param(a, Gpd(REG_PARAM3), srcp);                                        // mov    param3,srcp
 	else
 		mov_reg_param(a, Gpq(REG_PARAM3), srcp);                                        // mov    param3,srcp
+
+	// write flat memory directly when the address falls inside it
+	Label const slow = a.newLabel();
+	Label const done = a.newLabel();
+	bool const fast = fastmem_address(a, spacesizep.space(), 1 << spacesizep.size(), true, slow);
+	if (fast)
+	{
+		if (spacesizep.size() == SIZE_BYTE)
+			a.mov(byte_ptr(rax), Gpd(REG_PARAM3).r8());                                 // mov    [rax],param3
+		else if (spacesizep.size() == SIZE_WORD)
+			a.mov(word_ptr(rax), Gpd(REG_PARAM3).r16());                                // mov    [rax],param3
+		else if (spacesizep.size() == SIZE_DWORD)
+			a.mov(dword_ptr(rax), Gpd(REG_PARAM3));                                     // mov    [rax],param3
+		else if (spacesizep.size() == SIZE_QWORD)
+			a.mov(qword_ptr(rax), Gpq(REG_PARAM3));                                     // mov    [rax],param3
+		a.jmp(done);                                                                    // jmp    done
+		a.bind(slow);                                                                   // slow:
+	}
+
 	if (spacesizep.size() == SIZE_BYTE)
 	{
 		if (resolved.write_byte.func)
@@ -2550,6 +2711,8 @@ void drcbe_x64::op_write(Assembler &a, const instruction &inst)
 			smart_call_m64(a, (x86code **)&trampolines.write_qword);                    // call   write_qword
 		}
 	}
+	if (fast)
+		a.bind(done);                                                                   // done:
 }
 
 
@@ -5161,4 +5324,85 @@ void drcbe_x64::op_icopyf(Assembler &a, const instruction &inst)
 	}
 }
 
+
+
+//**************************************************************************
+//  VECTOR OPERATIONS
+//**************************************************************************
+
+//-------------------------------------------------
+//  op_vector - process a vector opcode; all
+//  operands live in memory, and SSE2 has a
+//  direct equivalent for each lane operation
+//-------------------------------------------------
+
+void drcbe_x64::op_vector(Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 16);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// use temporaries that aren't holding UML floating point registers
+#ifdef X64_WINDOWS_ABI
+	Xmm const vec1 = xmm0, vec2 = xmm1, vec3 = xmm2;
+#else
+	Xmm const vec1 = xmm0, vec2 = xmm8, vec3 = xmm9;
+#endif
+
+	Mem const dst = MABS(vector_pointer(inst.param(0)), 16);
+	Mem const src1 = MABS(vector_pointer(inst.param(1)), 16);
+
+	a.movdqu(vec1, src1);                                                               // movdqu vec1,[src1]
+	if (inst.opcode() != OP_VMOV)
+	{
+		Mem const src2 = MABS(vector_pointer(inst.param(2)), 16);
+		a.movdqu(vec2, src2);                                                           // movdqu vec2,[src2]
+	}
+
+	switch (inst.opcode())
+	{
+	case OP_VMOV:
+		break;
+	case OP_VADD:
+		a.paddw(vec1, vec2);                                                            // paddw   vec1,vec2
+		break;
+	case OP_VSUB:
+		a.psubw(vec1, vec2);                                                            // psubw   vec1,vec2
+		break;
+	case OP_VADDS:
+		a.paddsw(vec1, vec2);                                                           // paddsw  vec1,vec2
+		break;
+	case OP_VSUBS:
+		a.psubsw(vec1, vec2);                                                           // psubsw  vec1,vec2
+		break;
+	case OP_VMULL:
+		a.pmullw(vec1, vec2);                                                           // pmullw  vec1,vec2
+		break;
+	case OP_VMULH:
+		a.pmulhw(vec1, vec2);                                                           // pmulhw  vec1,vec2
+		break;
+	case OP_VMULHU:
+		a.pmulhuw(vec1, vec2);                                                          // pmulhuw vec1,vec2
+		break;
+	case OP_VCMPEQ:
+		a.pcmpeqw(vec1, vec2);                                                          // pcmpeqw vec1,vec2
+		break;
+	case OP_VCMPLT:
+		a.pcmpgtw(vec2, vec1);                                                          // pcmpgtw vec2,vec1
+		a.movdqa(vec1, vec2);                                                           // movdqa  vec1,vec2
+		break;
+	case OP_VSEL:
+		a.movdqu(vec3, MABS(vector_pointer(inst.param(3)), 16));                        // movdqu  vec3,[src3]
+		a.pand(vec2, vec1);                                                             // pand    vec2,vec1
+		a.pandn(vec1, vec3);                                                            // pandn   vec1,vec3
+		a.por(vec1, vec2);                                                              // por     vec1,vec2
+		break;
+	default:
+		throw emu_fatalerror("drcbe_x64::op_vector: unexpected opcode %u", inst.opcode());
+	}
+
+	a.movdqu(dst, vec1);                                                                // movdqu [dst],vec1
+}
+
 } // namespace drc
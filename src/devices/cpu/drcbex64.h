@@ -18,6 +18,7 @@
 
 #include "asmjit/src/asmjit/asmjit.h"
 
+#include <unordered_map>
 #include <vector>
 
 
@@ -124,6 +125,9 @@ private:
 	void smart_call_r64(asmjit::x86::Assembler &a, x86code *target, asmjit::x86::Gp const &reg);
 	void smart_call_m64(asmjit::x86::Assembler &a, x86code **target);
 
+	// fast memory helpers
+	bool fastmem_address(asmjit::x86::Assembler &a, int spacenum, int size, bool write, asmjit::Label const &slow);
+
 	static void debug_log_hashjmp(offs_t pc, int mode);
 	static void debug_log_hashjmp_fail();
 
@@ -205,6 +209,8 @@ private:
 	void op_fcopyi(asmjit::x86::Assembler &a, const uml::instruction &inst);
 	void op_icopyf(asmjit::x86::Assembler &a, const uml::instruction &inst);
 
+	void op_vector(asmjit::x86::Assembler &a, const uml::instruction &inst);
+
 	// alu and shift operation helpers
 	static bool ones(u64 const value, unsigned const size) noexcept { return (size == 4) ? u32(value) == 0xffffffffU : value == 0xffffffff'ffffffffULL; }
 	void alu_op_param(asmjit::x86::Assembler &a, asmjit::x86::Inst::Id const opcode, asmjit::Operand const &dst, be_parameter const &param, std::function<bool(asmjit::x86::Assembler &a, asmjit::Operand const &dst, be_parameter const &src)> optimize = [](asmjit::x86::Assembler &a, asmjit::Operand dst, be_parameter const &src) { return false; });
@@ -227,6 +233,10 @@ private:
 
 	size_t emit(asmjit::CodeHolder &ch);
 
+	// direct block chaining
+	static uint64_t link_key(uint32_t mode, uint32_t pc) { return (uint64_t(mode) << 32) | pc; }
+	void link_block(x86code *base);
+
 	// internal state
 	drc_hash_table          m_hash;                 // hash table state
 	drc_map_variables       m_map;                  // code map
@@ -241,6 +251,12 @@ private:
 	x86code *               m_exit;                 // exit point
 	x86code *               m_nocode;               // nocode handler
 
+	// direct block chaining state
+	struct pending_link { uint64_t key; size_t offset; };
+	std::unordered_map<uint64_t, std::vector<x86code *> > m_links; // direct call sites for each mode/PC
+	std::vector<pending_link> m_pending_links;      // call sites emitted by the current block
+	std::vector<uint64_t>   m_pending_hashes;       // mode/PC entry points registered by the current block
+
 	// state to live in the near cache
 	struct near_state
 	{
@@ -283,6 +283,19 @@ const drcbe_x86::opcode_table_entry drcbe_x86::s_opcode_table_source[] =
 	{ uml::OP_FRSQRT,  &drcbe_x86::op_frsqrt },     // FRSQRT  dst,src1
 	{ uml::OP_FCOPYI,  &drcbe_x86::op_fcopyi },     // FCOPYI  dst,src
 	{ uml::OP_ICOPYF,  &drcbe_x86::op_icopyf },     // ICOPYF  dst,src
+
+	// Vector Operations
+	{ uml::OP_VMOV,    &drcbe_x86::op_vector },     // VMOV    dst,src
+	{ uml::OP_VADD,    &drcbe_x86::op_vector },     // VADD    dst,src1,src2
+	{ uml::OP_VSUB,    &drcbe_x86::op_vector },     // VSUB    dst,src1,src2
+	{ uml::OP_VADDS,   &drcbe_x86::op_vector },     // VADDS   dst,src1,src2
+	{ uml::OP_VSUBS,   &drcbe_x86::op_vector },     // VSUBS   dst,src1,src2
+	{ uml::OP_VMULL,   &drcbe_x86::op_vector },     // VMULL   dst,src1,src2
+	{ uml::OP_VMULH,   &drcbe_x86::op_vector },     // VMULH   dst,src1,src2
+	{ uml::OP_VMULHU,  &drcbe_x86::op_vector },     // VMULHU  dst,src1,src2
+	{ uml::OP_VCMPEQ,  &drcbe_x86::op_vector },     // VCMPEQ  dst,src1,src2
+	{ uml::OP_VCMPLT,  &drcbe_x86::op_vector },     // VCMPLT  dst,src1,src2
+	{ uml::OP_VSEL,    &drcbe_x86::op_vector },     // VSEL    dst,mask,src1,src2
 };
 
 class ThrowableErrorHandler : public ErrorHandler
@@ -616,7 +629,7 @@ size_t drcbe_x86::emit(CodeHolder &ch)
 			throw emu_fatalerror("asmjit::CodeHolder::relocateToBase() error %d", err);
 	}
 
-	size_t const alignment = ch.baseAddress() - uint64_t(m_cache.top());
+	size_t const alignment = ch.baseAddress() - uint64_t(m_cache.executable(m_cache.top()));
 	size_t const code_size = ch.codeSize();
 
 	// test if enough room remains in drc cache
@@ -624,7 +637,7 @@ size_t drcbe_x86::emit(CodeHolder &ch)
 	if (cachetop == nullptr)
 		return 0;
 
-	err = ch.copyFlattenedData(drccodeptr(ch.baseAddress()), code_size, CopySectionFlags::kPadTargetBuffer);
+	err = ch.copyFlattenedData(m_cache.writable(drccodeptr(ch.baseAddress())), code_size, CopySectionFlags::kPadTargetBuffer);
 	if (err)
 		throw emu_fatalerror("asmjit::CodeHolder::copyFlattenedData() error %d", err);
 
@@ -646,7 +659,7 @@ void drcbe_x86::reset()
 		x86log_printf(m_log, "%s", "\n\n===========\nCACHE RESET\n===========\n\n");
 
 	// generate a little bit of glue code to set up the environment
-	x86code *dst = (x86code *)m_cache.top();
+	x86code *dst = (x86code *)m_cache.executable(m_cache.top());
 
 	CodeHolder ch;
 	ch.init(Environment::host(), uint64_t(dst));
@@ -735,6 +748,15 @@ void drcbe_x86::reset()
 		a.mov(eax, MABS(&m_state.f[regnum].s.h));
 		a.mov(ptr(ecx, regoffsh), eax);
 	}
+	for (int regnum = 0; regnum < std::size(m_state.v); regnum++)
+	{
+		uintptr_t regoffs = (uintptr_t)&((drcuml_machine_state *)nullptr)->v[regnum];
+		for (int word = 0; word < 4; word++)
+		{
+			a.mov(eax, MABS(&m_state.v[regnum].h[word * 2]));
+			a.mov(ptr(ecx, regoffs + 4 * word), eax);
+		}
+	}
 	a.ret();                                                                            // ret
 
 	// generate a restore subroutine
@@ -763,6 +785,15 @@ void drcbe_x86::reset()
 		a.mov(eax, ptr(ecx, regoffsh));
 		a.mov(MABS(&m_state.f[regnum].s.h), eax);
 	}
+	for (int regnum = 0; regnum < std::size(m_state.v); regnum++)
+	{
+		uintptr_t regoffs = (uintptr_t)&((drcuml_machine_state *)nullptr)->v[regnum];
+		for (int word = 0; word < 4; word++)
+		{
+			a.mov(eax, ptr(ecx, regoffs + 4 * word));
+			a.mov(MABS(&m_state.v[regnum].h[word * 2]), eax);
+		}
+	}
 	a.movzx(eax, byte_ptr(ecx, offsetof(drcuml_machine_state, fmod)));                  // movzx eax,state->fmod
 	a.and_(eax, 3);                                                                     // and    eax,3
 	a.mov(MABS(&m_state.fmod), al);                                                     // mov    [fmod],al
@@ -819,7 +850,7 @@ void drcbe_x86::generate(drcuml_block &block, const instruction *instlist, uint3
 	m_map.block_begin(block);
 
 	// compute the base by aligning the cache top to a cache line (assumed to be 64 bytes)
-	x86code *dst = (x86code *)(uint64_t(m_cache.top() + 63) & ~63);
+	x86code *dst = (x86code *)(uint64_t(m_cache.executable(m_cache.top()) + 63) & ~63);
 
 	CodeHolder ch;
 	ch.init(Environment::host(), uint64_t(dst));
@@ -6028,6 +6059,36 @@ void drcbe_x86::op_icopyf(Assembler &a, const instruction &inst)
 
 
 
+//**************************************************************************
+//  VECTOR OPERATIONS
+//**************************************************************************
+
+//-------------------------------------------------
+//  op_vector - process a vector opcode by calling
+//  the portable implementation, since this
+//  back-end doesn't assume SSE2
+//-------------------------------------------------
+
+void drcbe_x86::op_vector(Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 16);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// all operands are in memory, so they can be passed as pointers
+	a.mov(dword_ptr(esp, 0), imm(inst.opcode()));                                       // mov    [esp],opcode
+	for (int pnum = 0; pnum < 4; pnum++)
+	{
+		void *const ptr = (pnum < inst.numparams()) ? vector_pointer(inst.param(pnum)) : nullptr;
+		a.mov(dword_ptr(esp, 4 + 4 * pnum), imm(ptr));                                  // mov    [esp+4+4*pnum],param
+	}
+	a.call(imm(&drcbe_interface::vector_operation));                                    // call   vector_operation
+	reset_last_upper_lower_reg();
+}
+
+
+
 //**************************************************************************
 //  MISCELLAENOUS FUNCTIONS
 //**************************************************************************
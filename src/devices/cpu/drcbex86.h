@@ -210,6 +210,8 @@ private:
 	void op_fcopyi(asmjit::x86::Assembler &a, const uml::instruction &inst);
 	void op_icopyf(asmjit::x86::Assembler &a, const uml::instruction &inst);
 
+	void op_vector(asmjit::x86::Assembler &a, const uml::instruction &inst);
+
 	// 32-bit code emission helpers
 	void emit_mov_r32_p32(asmjit::x86::Assembler &a, asmjit::x86::Gp const &reg, be_parameter const &param);
 	void emit_mov_r32_p32_keepflags(asmjit::x86::Assembler &a, asmjit::x86::Gp const &reg, be_parameter const &param);
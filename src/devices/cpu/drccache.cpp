@@ -11,6 +11,12 @@
 #include "emu.h"
 #include "drccache.h"
 
+#include "drcuml.h"
+
+#include "emuopts.h"
+#include "fileio.h"
+#include "main.h"
+
 #include <algorithm>
 
 
@@ -26,6 +32,66 @@ template <typename T, typename U> constexpr T *ALIGN_PTR_DOWN(T *p, U align)
 	return reinterpret_cast<T *>(uintptr_t(p) & ~uintptr_t(align - 1));
 }
 
+
+// persistent cache file signature
+constexpr char PERSIST_MAGIC[8] = { 'M', 'A', 'M', 'E', 'D', 'R', 'C', 0 };
+
+// how a serialized parameter is relocated
+enum : u8
+{
+	RELOC_PLAIN,        // value stored verbatim
+	RELOC_NEAR,         // offset into the near cache
+	RELOC_SYMBOL,       // offset into a named UML symbol
+	RELOC_SHARE,        // offset into a named memory share
+	RELOC_REGION,       // offset into a named memory region
+	RELOC_HANDLE,       // named code handle
+	RELOC_CFUNC         // C function relative to the anchor below
+};
+
+// reference point for relocating C function pointers within one build
+void persist_anchor(void *)
+{
+}
+
+inline s64 cfunc_offset(uml::c_function func)
+{
+	return s64(reinterpret_cast<uintptr_t>(func) - reinterpret_cast<uintptr_t>(&persist_anchor));
+}
+
+// little-endian serialization helpers
+template <typename T> void put(std::vector<u8> &data, T value)
+{
+	for (int byte = 0; byte < sizeof(T); byte++)
+		data.push_back(u8(u64(value) >> (byte * 8)));
+}
+
+void put_string(std::vector<u8> &data, std::string_view string)
+{
+	put<u16>(data, string.length());
+	data.insert(data.end(), string.begin(), string.end());
+}
+
+template <typename T> bool get(u8 const *&src, u8 const *end, T &value)
+{
+	if ((end - src) < sizeof(T))
+		return false;
+	u64 result = 0;
+	for (int byte = 0; byte < sizeof(T); byte++)
+		result |= u64(*src++) << (byte * 8);
+	value = T(result);
+	return true;
+}
+
+bool get_string(u8 const *&src, u8 const *end, std::string_view &string)
+{
+	u16 length;
+	if (!get(src, end, length) || ((end - src) < length))
+		return false;
+	string = std::string_view(reinterpret_cast<char const *>(src), length);
+	src += length;
+	return true;
+}
+
 } // anonymous namespace
 
 
@@ -48,8 +114,11 @@ drc_cache::drc_cache(size_t bytes) :
 	m_end(m_limit),
 	m_codegen(nullptr),
 	m_size(m_cache.size()),
+	m_execdelta(0),
 	m_executable(false),
-	m_rwx(false)
+	m_rwx(false),
+	m_peak(0),
+	m_flushes(0)
 {
 	// alignment and page size must be powers of two, cache must be page-aligned
 	assert(!(CACHE_ALIGNMENT & (CACHE_ALIGNMENT - 1)));
@@ -73,6 +142,13 @@ drc_cache::drc_cache(size_t bytes) :
 		osd_printf_verbose("drc_cache: RWX pages supported\n");
 		m_rwx = true;
 	}
+	else if (m_cache.create_alias(osd::virtual_memory_allocation::READ_EXECUTE))
+	{
+		// code is written through the primary view and executed from the alias
+		osd_printf_verbose("drc_cache: Using dual-mapped W^X mode\n");
+		m_execdelta = uintptr_t(m_cache.alias()) - uintptr_t(m_near);
+		m_rwx = false;
+	}
 	else
 	{
 		osd_printf_verbose("drc_cache: Using W^X mode\n");
@@ -101,11 +177,31 @@ void drc_cache::flush()
 	assert(!m_codegen);
 
 	// just reset the top back to the base and re-seed
+	m_peak = std::max<size_t>(m_peak, m_top - m_base);
 	m_top = m_base;
+	m_flushes++;
 	codegen_init();
 }
 
 
+//-------------------------------------------------
+//  advise_huge_pages - ask the host to back the
+//  cache with large pages to reduce TLB misses
+//-------------------------------------------------
+
+bool drc_cache::advise_huge_pages()
+{
+	if (!m_cache.advise_huge_pages(0, m_size))
+	{
+		osd_printf_verbose("drc_cache: Huge pages not available\n");
+		return false;
+	}
+
+	osd_printf_verbose("drc_cache: Requested huge page backing\n");
+	return true;
+}
+
+
 //-------------------------------------------------
 //  alloc - allocate permanent memory from the
 //  cache
@@ -219,7 +315,7 @@ void drc_cache::codegen_init()
 {
 	if (m_executable)
 	{
-		if (!m_rwx)
+		if (!m_rwx && !dual_mapped())
 			m_cache.set_access(0, m_size, osd::virtual_memory_allocation::READ_WRITE);
 		m_executable = false;
 	}
@@ -230,7 +326,7 @@ void drc_cache::codegen_complete()
 {
 	if (!m_executable)
 	{
-		if (!m_rwx)
+		if (!m_rwx && !dual_mapped())
 			m_cache.set_access(m_base - m_near, ALIGN_PTR_UP(m_top, m_cache.page_size()) - m_base, osd::virtual_memory_allocation::READ_EXECUTE);
 		m_executable = true;
 	}
@@ -278,8 +374,9 @@ drccodeptr drc_cache::end_codegen()
 	}
 
 	// update the cache top
-	osd::invalidate_instruction_cache(m_codegen, m_top - m_codegen);
+	osd::invalidate_instruction_cache(executable(m_codegen), m_top - m_codegen);
 	m_top = ALIGN_PTR_UP(m_top, CACHE_ALIGNMENT);
+	m_peak = std::max<size_t>(m_peak, m_top - m_base);
 	m_codegen = nullptr;
 
 	return result;
@@ -312,3 +409,472 @@ void drc_cache::request_oob_codegen(drc_oob_delegate &&callback, void *param1, v
 	oob->m_param1 = param1;
 	oob->m_param2 = param2;
 }
+
+
+
+//**************************************************************************
+//  PERSISTENT CACHE
+//**************************************************************************
+
+//-------------------------------------------------
+//  drc_persistent_cache - constructor
+//-------------------------------------------------
+
+drc_persistent_cache::drc_persistent_cache(drcuml_state &drcuml, std::string &&directory, std::string &&filename) :
+	m_drcuml(drcuml),
+	m_directory(std::move(directory)),
+	m_filename(std::move(filename)),
+	m_loaded(false),
+	m_dirty(false),
+	m_hits(0),
+	m_misses(0),
+	m_stores(0),
+	m_rejects(0)
+{
+}
+
+
+//-------------------------------------------------
+//  ~drc_persistent_cache - destructor
+//-------------------------------------------------
+
+drc_persistent_cache::~drc_persistent_cache()
+{
+}
+
+
+//-------------------------------------------------
+//  find - look for a block translated from the
+//  same guest code and expand its instructions
+//-------------------------------------------------
+
+bool drc_persistent_cache::find(u32 mode, offs_t pc, u64 config, std::vector<uml::instruction> &instructions)
+{
+	if (!m_loaded)
+		load();
+
+	auto const range(m_entries.equal_range(key(mode, pc)));
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		entry const &cur(it->second);
+		util::sha1_t hash;
+		if ((cur.config != config) || !hash_code(cur.ranges, hash) || (hash != cur.hash))
+			continue;
+
+		// expand the instructions, giving up on anything that no longer resolves
+		u8 const *src(cur.data.data());
+		u8 const *const end(src + cur.data.size());
+		u32 count;
+		if (!get(src, end, count))
+			continue;
+		instructions.resize(count);
+		bool valid(true);
+		for (u32 instnum = 0; valid && (instnum < count); instnum++)
+		{
+			uml::instruction &inst(instructions[instnum]);
+			u8 opcode, condition, size, numparams;
+			valid = get(src, end, opcode) && get(src, end, condition) && get(src, end, size) && get(src, end, numparams);
+			valid = valid && (opcode < uml::OP_MAX) && (numparams <= uml::instruction::MAX_PARAMS);
+			for (int pnum = 0; valid && (pnum < numparams); pnum++)
+				valid = decode_parameter(src, end, inst.m_param[pnum]);
+			if (valid)
+			{
+				inst.m_opcode = uml::opcode_t(opcode);
+				inst.m_condition = uml::condition_t(condition);
+				inst.m_flags = 0;
+				inst.m_size = size;
+				inst.m_numparams = numparams;
+				inst.validate();
+			}
+		}
+		if (valid)
+		{
+			m_hits++;
+			return true;
+		}
+	}
+
+	m_misses++;
+	return false;
+}
+
+
+//-------------------------------------------------
+//  add - serialize a freshly translated block
+//-------------------------------------------------
+
+void drc_persistent_cache::add(u32 mode, offs_t pc, u64 config, std::vector<code_range> const &ranges, uml::instruction const *instructions, u32 count)
+{
+	if (!m_loaded)
+		load();
+
+	entry newentry{ mode, pc, config, ranges, util::sha1_t(), std::vector<u8>() };
+	if (!hash_code(ranges, newentry.hash))
+	{
+		m_rejects++;
+		return;
+	}
+
+	// comments are dropped; everything else must relocate cleanly
+	u32 kept(0);
+	put<u32>(newentry.data, 0);
+	for (u32 instnum = 0; instnum < count; instnum++)
+	{
+		uml::instruction const &inst(instructions[instnum]);
+		if (inst.opcode() == uml::OP_COMMENT)
+			continue;
+
+		put<u8>(newentry.data, inst.opcode());
+		put<u8>(newentry.data, inst.condition());
+		put<u8>(newentry.data, inst.size());
+		put<u8>(newentry.data, inst.numparams());
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+		{
+			if (!encode_parameter(inst.param(pnum), newentry.data))
+			{
+				m_rejects++;
+				return;
+			}
+		}
+		kept++;
+	}
+	for (int byte = 0; byte < 4; byte++)
+		newentry.data[byte] = u8(kept >> (byte * 8));
+
+	// replace any stale copy of the same translation
+	auto const range(m_entries.equal_range(key(mode, pc)));
+	for (auto it = range.first; it != range.second; )
+	{
+		if ((it->second.config == config) && (it->second.hash == newentry.hash))
+			it = m_entries.erase(it);
+		else
+			++it;
+	}
+	m_entries.emplace(key(mode, pc), std::move(newentry));
+	m_dirty = true;
+	m_stores++;
+}
+
+
+//-------------------------------------------------
+//  save - write the cache file if anything was
+//  added since it was loaded
+//-------------------------------------------------
+
+void drc_persistent_cache::save()
+{
+	if (!m_dirty)
+		return;
+
+	std::vector<u8> data(std::begin(PERSIST_MAGIC), std::end(PERSIST_MAGIC));
+	put<u32>(data, FILE_VERSION);
+	put_string(data, build_id());
+	put<u32>(data, m_entries.size());
+	for (auto const &it : m_entries)
+	{
+		entry const &cur(it.second);
+		put<u32>(data, cur.mode);
+		put<u32>(data, cur.pc);
+		put<u64>(data, cur.config);
+		put<u32>(data, cur.ranges.size());
+		for (code_range const &range : cur.ranges)
+		{
+			put<u32>(data, range.start);
+			put<u32>(data, range.length);
+		}
+		data.insert(data.end(), std::begin(cur.hash.m_raw), std::end(cur.hash.m_raw));
+		put<u32>(data, cur.data.size());
+		data.insert(data.end(), cur.data.begin(), cur.data.end());
+	}
+
+	emu_file file(m_directory, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(m_filename))
+	{
+		osd_printf_warning("Unable to write DRC cache file %s\n", m_filename);
+		return;
+	}
+	if (file.write(data.data(), data.size()) != data.size())
+		osd_printf_warning("Error writing DRC cache file %s\n", m_filename);
+	m_dirty = false;
+}
+
+
+//-------------------------------------------------
+//  load - read entries from the cache file,
+//  discarding it if it came from another build
+//-------------------------------------------------
+
+void drc_persistent_cache::load()
+{
+	m_loaded = true;
+
+	emu_file file(m_directory, OPEN_FLAG_READ);
+	if (file.open(m_filename))
+		return;
+
+	std::vector<u8> data(file.size());
+	if (file.read(data.data(), data.size()) != data.size())
+		return;
+
+	u8 const *src(data.data());
+	u8 const *const end(src + data.size());
+	u32 version, count;
+	std::string_view build;
+	if ((data.size() < sizeof(PERSIST_MAGIC)) || memcmp(src, PERSIST_MAGIC, sizeof(PERSIST_MAGIC)))
+		return;
+	src += sizeof(PERSIST_MAGIC);
+	if (!get(src, end, version) || (version != FILE_VERSION) || !get_string(src, end, build) || (build != build_id()) || !get(src, end, count))
+	{
+		osd_printf_verbose("Ignoring DRC cache file %s from a different build\n", m_filename);
+		return;
+	}
+
+	for (u32 entrynum = 0; entrynum < count; entrynum++)
+	{
+		entry cur;
+		u32 numranges, length;
+		if (!get(src, end, cur.mode) || !get(src, end, cur.pc) || !get(src, end, cur.config) || !get(src, end, numranges))
+			break;
+		cur.ranges.resize(numranges);
+		bool valid(true);
+		for (code_range &range : cur.ranges)
+			valid = valid && get(src, end, range.start) && get(src, end, range.length);
+		if (!valid || ((end - src) < sizeof(cur.hash.m_raw)))
+			break;
+		memcpy(cur.hash.m_raw, src, sizeof(cur.hash.m_raw));
+		src += sizeof(cur.hash.m_raw);
+		if (!get(src, end, length) || ((end - src) < length))
+			break;
+		cur.data.assign(src, src + length);
+		src += length;
+		m_entries.emplace(key(cur.mode, cur.pc), std::move(cur));
+	}
+}
+
+
+//-------------------------------------------------
+//  hash_code - compute a digest of the guest code
+//  bytes covered by a block
+//-------------------------------------------------
+
+bool drc_persistent_cache::hash_code(std::vector<code_range> const &ranges, util::sha1_t &result) const
+{
+	device_memory_interface *memory;
+	if (!m_drcuml.device().interface(memory) || !memory->has_space(AS_PROGRAM))
+		return false;
+	address_space &space(memory->space(AS_PROGRAM));
+	if (space.addr_shift() != 0)
+		return false;
+
+	// hash whole bus words so byte order within them is irrelevant
+	util::sha1_creator creator;
+	for (code_range const &range : ranges)
+	{
+		offs_t const start(range.start & ~offs_t(7));
+		offs_t const last(((range.start + range.length + 7) & ~offs_t(7)) - 1);
+		u8 const *const first(reinterpret_cast<u8 const *>(space.get_read_ptr(start)));
+		if (!first || (reinterpret_cast<u8 const *>(space.get_read_ptr(last)) != (first + (last - start))))
+			return false;
+		creator.append(first, last - start + 1);
+	}
+	result = creator.finish();
+	return true;
+}
+
+
+//-------------------------------------------------
+//  encode_parameter - serialize a parameter,
+//  expressing pointers relative to something that
+//  will be at a known place next run
+//-------------------------------------------------
+
+bool drc_persistent_cache::encode_parameter(uml::parameter const &param, std::vector<u8> &data) const
+{
+	switch (param.type())
+	{
+	case uml::parameter::PTYPE_MEMORY:
+		{
+			drc_cache const &cache(m_drcuml.cache());
+			u8 const *const ptr(reinterpret_cast<u8 const *>(param.memory()));
+			u32 offset;
+			if (cache.contains_near_pointer(ptr))
+			{
+				put<u8>(data, RELOC_NEAR);
+				put<u64>(data, ptr - cache.near());
+				return true;
+			}
+			char const *const symbol(m_drcuml.symbol_find(param.memory(), &offset));
+			if (symbol && std::string_view(symbol).length() <= 0xffff)
+			{
+				put<u8>(data, RELOC_SYMBOL);
+				put_string(data, symbol);
+				put<u64>(data, offset);
+				return true;
+			}
+			memory_manager &memory(m_drcuml.device().machine().memory());
+			for (auto const &share : memory.shares())
+			{
+				u8 const *const base(reinterpret_cast<u8 const *>(share.second->ptr()));
+				if ((ptr >= base) && (ptr < (base + share.second->bytes())))
+				{
+					put<u8>(data, RELOC_SHARE);
+					put_string(data, share.first);
+					put<u64>(data, ptr - base);
+					return true;
+				}
+			}
+			for (auto const &region : memory.regions())
+			{
+				u8 const *const base(region.second->base());
+				if ((ptr >= base) && (ptr < (base + region.second->bytes())))
+				{
+					put<u8>(data, RELOC_REGION);
+					put_string(data, region.first);
+					put<u64>(data, ptr - base);
+					return true;
+				}
+			}
+		}
+		return false;
+
+	case uml::parameter::PTYPE_CODE_HANDLE:
+		if (m_drcuml.handle_find(param.handle().string()) != &param.handle())
+			return false;
+		put<u8>(data, RELOC_HANDLE);
+		put_string(data, param.handle().string());
+		return true;
+
+	case uml::parameter::PTYPE_C_FUNCTION:
+		put<u8>(data, RELOC_CFUNC);
+		put<u64>(data, cfunc_offset(param.cfunc()));
+		return true;
+
+	case uml::parameter::PTYPE_STRING:
+		return false;
+
+	default:
+		put<u8>(data, RELOC_PLAIN);
+		put<u8>(data, param.m_type);
+		put<u64>(data, param.m_value);
+		return true;
+	}
+}
+
+
+//-------------------------------------------------
+//  decode_parameter - rebuild a parameter that was
+//  serialized by encode_parameter
+//-------------------------------------------------
+
+bool drc_persistent_cache::decode_parameter(u8 const *&src, u8 const *end, uml::parameter &param) const
+{
+	u8 reloc;
+	u64 offset;
+	std::string_view name;
+	if (!get(src, end, reloc))
+		return false;
+
+	switch (reloc)
+	{
+	case RELOC_PLAIN:
+		{
+			u8 type;
+			u64 value;
+			if (!get(src, end, type) || !get(src, end, value) || (type >= uml::parameter::PTYPE_MAX) || (type == uml::parameter::PTYPE_MEMORY) || (type == uml::parameter::PTYPE_STRING))
+				return false;
+			if ((type == uml::parameter::PTYPE_CODE_HANDLE) || (type == uml::parameter::PTYPE_C_FUNCTION))
+				return false;
+			param = uml::parameter(uml::parameter::parameter_type(type), value);
+			return true;
+		}
+
+	case RELOC_NEAR:
+		{
+			drc_cache const &cache(m_drcuml.cache());
+			if (!get(src, end, offset) || !cache.contains_near_pointer(cache.near() + offset))
+				return false;
+			param = uml::parameter::make_memory(cache.near() + offset);
+			return true;
+		}
+
+	case RELOC_SYMBOL:
+		{
+			u32 length;
+			if (!get_string(src, end, name) || !get(src, end, offset))
+				return false;
+			u8 *const base(reinterpret_cast<u8 *>(m_drcuml.symbol_lookup(name, &length)));
+			if (!base || (offset >= length))
+				return false;
+			param = uml::parameter::make_memory(base + offset);
+			return true;
+		}
+
+	case RELOC_SHARE:
+	case RELOC_REGION:
+		{
+			if (!get_string(src, end, name) || !get(src, end, offset))
+				return false;
+			memory_manager &memory(m_drcuml.device().machine().memory());
+			u8 *base(nullptr);
+			size_t bytes(0);
+			if (reloc == RELOC_SHARE)
+			{
+				auto const found(memory.shares().find(std::string(name)));
+				if (found != memory.shares().end())
+				{
+					base = reinterpret_cast<u8 *>(found->second->ptr());
+					bytes = found->second->bytes();
+				}
+			}
+			else
+			{
+				auto const found(memory.regions().find(std::string(name)));
+				if (found != memory.regions().end())
+				{
+					base = found->second->base();
+					bytes = found->second->bytes();
+				}
+			}
+			if (!base || (offset >= bytes))
+				return false;
+			param = uml::parameter::make_memory(base + offset);
+			return true;
+		}
+
+	case RELOC_HANDLE:
+		{
+			if (!get_string(src, end, name))
+				return false;
+			uml::code_handle *const handle(m_drcuml.handle_find(name));
+			if (!handle)
+				return false;
+			param = uml::parameter(*handle);
+			return true;
+		}
+
+	case RELOC_CFUNC:
+		if (!get(src, end, offset))
+			return false;
+		param = uml::parameter::make_cfunc(reinterpret_cast<uml::c_function>(reinterpret_cast<uintptr_t>(&persist_anchor) + offset));
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+
+//-------------------------------------------------
+//  build_id - identify the build, since function
+//  and near cache offsets are only stable within
+//  one binary
+//-------------------------------------------------
+
+std::string drc_persistent_cache::build_id()
+{
+	return util::string_format("%s %s %s %X",
+			emulator_info::get_build_version(),
+			__DATE__,
+			__TIME__,
+			cfunc_offset(reinterpret_cast<uml::c_function>(&emulator_info::get_build_version)));
+}
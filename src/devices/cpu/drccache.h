@@ -14,6 +14,12 @@
 
 #include "modules/lib/osdlib.h"
 
+#include "hashing.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
 
 //**************************************************************************
 //  MACROS
@@ -29,6 +35,11 @@
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+// forward references
+class drcuml_state;
+namespace uml { class instruction; class parameter; }
+
+
 // generic code pointer
 typedef uint8_t *drccodeptr;
 
@@ -49,14 +60,29 @@ public:
 	drccodeptr near() const { return m_near; }
 	drccodeptr base() const { return m_base; }
 	drccodeptr top() const { return m_top; }
+	bool dual_mapped() const { return m_execdelta != 0; }
+
+	// statistics
+	size_t size() const { return m_size; }
+	size_t code_bytes() const { return m_top - m_base; }
+	size_t code_capacity() const { return (m_near + m_size) - m_base; }
+	size_t near_bytes() const { return m_neartop - m_near; }
+	size_t permanent_bytes() const { return (m_near + m_size) - m_end; }
+	size_t peak_code_bytes() const { return m_peak; }
+	uint32_t flushes() const { return m_flushes; }
 
 	// pointer checking
-	bool contains_pointer(const void *ptr) const { return ((const drccodeptr)ptr >= m_near && (const drccodeptr)ptr < m_near + m_size); }
+	bool contains_pointer(const void *ptr) const { return contains_writable(ptr) || (dual_mapped() && contains_writable(writable((const drccodeptr)ptr))); }
 	bool contains_near_pointer(const void *ptr) const { return ((const drccodeptr)ptr >= m_near && (const drccodeptr)ptr < m_neartop); }
 	bool generating_code() const { return (m_codegen != nullptr); }
 
+	// translation between the writable view and the view code executes from
+	drccodeptr executable(drccodeptr ptr) const { return (ptr >= m_base && ptr < m_near + m_size) ? drccodeptr(uintptr_t(ptr) + m_execdelta) : ptr; }
+	drccodeptr writable(drccodeptr ptr) const { return (uintptr_t(ptr) - uintptr_t(m_base) - m_execdelta < uintptr_t(m_near + m_size - m_base)) ? drccodeptr(uintptr_t(ptr) - m_execdelta) : ptr; }
+
 	// memory management
 	void flush();
+	bool advise_huge_pages();
 	void *alloc(size_t bytes);
 	void *alloc_near(size_t bytes);
 	void *alloc_temporary(size_t bytes);
@@ -82,6 +108,9 @@ private:
 	// size of "near" area at the base of the cache
 	static constexpr size_t NEAR_CACHE_SIZE = 131072;
 
+	// internal helpers
+	bool contains_writable(const void *ptr) const { return ((const drccodeptr)ptr >= m_near && (const drccodeptr)ptr < m_near + m_size); }
+
 	osd::virtual_memory_allocation m_cache;
 
 	// core parameters
@@ -93,9 +122,14 @@ private:
 	drccodeptr          m_end;              // first allocated byte in cache
 	drccodeptr          m_codegen;          // start of current generated code block
 	size_t const        m_size;             // size of the cache in bytes
+	uintptr_t           m_execdelta;        // offset from the writable view to the executable view, or 0 if not dual-mapped
 	bool                m_executable;       // whether cached code is currently executable
 	bool                m_rwx;              // whether pages can be simultaneously writable and executable
 
+	// statistics
+	size_t              m_peak;             // largest amount of code generated between flushes
+	uint32_t            m_flushes;          // number of times the cache has been flushed
+
 	// oob management
 	struct oob_handler
 	{
@@ -115,4 +149,67 @@ private:
 	free_link *         m_nearfree[MAX_PERMANENT_ALLOC / CACHE_ALIGNMENT];
 };
 
+
+// drc_persistent_cache
+class drc_persistent_cache
+{
+public:
+	// a range of guest code that a block was translated from
+	struct code_range
+	{
+		offs_t          start;              // physical address in the program space
+		u32             length;             // length in bytes
+	};
+
+	// construction/destruction
+	drc_persistent_cache(drcuml_state &drcuml, std::string &&directory, std::string &&filename);
+	~drc_persistent_cache();
+
+	// getters
+	u32 hits() const { return m_hits; }
+	u32 misses() const { return m_misses; }
+	u32 stores() const { return m_stores; }
+	u32 rejects() const { return m_rejects; }
+
+	// lookup and storage
+	bool find(u32 mode, offs_t pc, u64 config, std::vector<uml::instruction> &instructions);
+	void add(u32 mode, offs_t pc, u64 config, std::vector<code_range> const &ranges, uml::instruction const *instructions, u32 count);
+	void save();
+
+private:
+	// file format version
+	static constexpr u32 FILE_VERSION = 1;
+
+	// a single translated block
+	struct entry
+	{
+		u32                     mode;       // CPU mode the block was compiled for
+		offs_t                  pc;         // entry PC
+		u64                     config;     // CPU configuration the block was compiled with
+		std::vector<code_range> ranges;     // guest code covered
+		util::sha1_t            hash;       // hash of the guest code bytes
+		std::vector<u8>         data;       // serialized instructions
+	};
+
+	// internal helpers
+	void load();
+	bool hash_code(std::vector<code_range> const &ranges, util::sha1_t &result) const;
+	bool encode_parameter(uml::parameter const &param, std::vector<u8> &data) const;
+	bool decode_parameter(u8 const *&src, u8 const *end, uml::parameter &param) const;
+	static std::string build_id();
+	static u64 key(u32 mode, offs_t pc) { return (u64(mode) << 32) | pc; }
+
+	// internal state
+	drcuml_state &                  m_drcuml;       // owning UML state
+	std::string const               m_directory;    // directory holding cache files
+	std::string const               m_filename;     // name of this CPU's cache file
+	std::multimap<u64, entry>       m_entries;      // translated blocks keyed by mode and PC
+	bool                            m_loaded;       // file has been read
+	bool                            m_dirty;        // entries have been added since loading
+	u32                             m_hits;         // blocks restored
+	u32                             m_misses;       // lookups with no valid entry
+	u32                             m_stores;       // blocks added
+	u32                             m_rejects;      // blocks that could not be serialized
+};
+
 #endif // MAME_CPU_DRCCACHE_H
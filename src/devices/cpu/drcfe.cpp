@@ -56,6 +56,9 @@ drc_frontend::drc_frontend(device_t &cpu, u32 window_start, u32 window_end, u32
 	: m_window_start(window_start)
 	, m_window_end(window_end)
 	, m_max_sequence(max_sequence)
+	, m_trace_window_start(0)
+	, m_trace_window_end(0)
+	, m_trace_max_sequence(0)
 	, m_cpudevice(downcast<cpu_device &>(cpu))
 	, m_program(m_cpudevice.space(AS_PROGRAM))
 	, m_pageshift(m_cpudevice.space_config(AS_PROGRAM)->page_shift())
@@ -82,6 +85,53 @@ drc_frontend::~drc_frontend()
 //-------------------------------------------------
 
 const opcode_desc *drc_frontend::describe_code(offs_t startpc)
+{
+	return describe_window(startpc, m_window_start, m_window_end, m_max_sequence);
+}
+
+
+//-------------------------------------------------
+//  describe_trace - describe hot code starting at
+//  the specified startpc using the wider trace
+//  window, so loops and short subroutines that
+//  would otherwise be reached through a hash
+//  lookup become intrablock branches
+//-------------------------------------------------
+
+const opcode_desc *drc_frontend::describe_trace(offs_t startpc)
+{
+	assert(traces_enabled());
+	return describe_window(startpc, m_trace_window_start, m_trace_window_end, m_trace_max_sequence);
+}
+
+
+//-------------------------------------------------
+//  set_trace_window - enable hot code counting and
+//  configure the window used for traces
+//-------------------------------------------------
+
+void drc_frontend::set_trace_window(u32 window_start, u32 window_end, u32 max_sequence)
+{
+	m_trace_window_start = window_start;
+	m_trace_window_end = window_end;
+	m_trace_max_sequence = max_sequence;
+
+	// the description array must cover the larger of the two windows
+	if (m_desc_array.size() < (window_end + window_start + 2))
+		m_desc_array.resize(window_end + window_start + 2, nullptr);
+
+	if (!m_trace_counters)
+		m_trace_counters = std::make_unique<u32[]>(TRACE_COUNTERS);
+	std::fill_n(&m_trace_counters[0], TRACE_COUNTERS, TRACE_THRESHOLD);
+}
+
+
+//-------------------------------------------------
+//  describe_window - describe a sequence of code
+//  that falls within the given window
+//-------------------------------------------------
+
+const opcode_desc *drc_frontend::describe_window(offs_t startpc, u32 window_start, u32 window_end, u32 max_sequence)
 {
 	// release any descriptions we've accumulated
 	release_descriptions();
@@ -94,8 +144,8 @@ const opcode_desc *drc_frontend::describe_code(offs_t startpc)
 	pcstackptr++;
 
 	// loop while we still have a stack
-	offs_t const minpc = startpc - (std::min)(m_window_start, startpc);
-	offs_t const maxpc = startpc + (std::min)(m_window_end, 0xffffffff - startpc);
+	offs_t const minpc = startpc - (std::min)(window_start, startpc);
+	offs_t const maxpc = startpc + (std::min)(window_end, 0xffffffff - startpc);
 	while (pcstackptr != &pcstack[0])
 	{
 		// if we've already hit this PC, just mark it a branch target and continue
@@ -148,8 +198,8 @@ const opcode_desc *drc_frontend::describe_code(offs_t startpc)
 
 	// now build the list of descriptions in order
 	// first from startpc -> maxpc, then from minpc -> startpc
-	build_sequence(startpc - minpc, maxpc - minpc, OPFLAG_REDISPATCH);
-	build_sequence(minpc - minpc, startpc - minpc, OPFLAG_RETURN_TO_START);
+	build_sequence(startpc - minpc, maxpc - minpc, OPFLAG_REDISPATCH, max_sequence);
+	build_sequence(minpc - minpc, startpc - minpc, OPFLAG_RETURN_TO_START, max_sequence);
 	return m_desc_live_list.first();
 }
 
@@ -241,7 +291,7 @@ opcode_desc *drc_frontend::describe_one(offs_t curpc, opcode_desc const *prevdes
 //  of instructions
 //-------------------------------------------------
 
-void drc_frontend::build_sequence(int start, int end, u32 endflag)
+void drc_frontend::build_sequence(int start, int end, u32 endflag, u32 max_sequence)
 {
 	// iterate in order from start to end, picking up all non-NULL instructions
 	int consecutive = 0;
@@ -297,7 +347,7 @@ void drc_frontend::build_sequence(int start, int end, u32 endflag)
 			}
 
 			// if we exceed the maximum consecutive count, cut off the sequence
-			if (++consecutive >= m_max_sequence)
+			if (++consecutive >= max_sequence)
 				curdesc->flags |= OPFLAG_END_SEQUENCE;
 			if (curdesc->flags & OPFLAG_END_SEQUENCE)
 				consecutive = 0;
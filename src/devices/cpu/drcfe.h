@@ -133,17 +133,31 @@ public:
 
 	// describe a block
 	opcode_desc const *describe_code(offs_t startpc);
+	opcode_desc const *describe_trace(offs_t startpc);
 	// get last opcode of block
 	opcode_desc const *get_last() { return m_desc_live_list.last(); }
 
+	// hot code detection for trace formation
+	void set_trace_window(u32 window_start, u32 window_end, u32 max_sequence);
+	bool traces_enabled() const { return m_trace_max_sequence != 0; }
+	u32 *trace_counter(offs_t pc) { return &m_trace_counters[(pc >> 1) & (TRACE_COUNTERS - 1)]; }
+	void reset_trace_counter(offs_t pc) { *trace_counter(pc) = TRACE_THRESHOLD; }
+
+	// number of block entries before code is considered hot
+	static constexpr u32 TRACE_THRESHOLD = 1024;
+
 protected:
 	// required overrides
 	virtual bool describe(opcode_desc &desc, opcode_desc const *prev) = 0;
 
 private:
+	// size of the hot code counter table
+	static constexpr u32 TRACE_COUNTERS = 4096;
+
 	// internal helpers
+	opcode_desc const *describe_window(offs_t startpc, u32 window_start, u32 window_end, u32 max_sequence);
 	opcode_desc *describe_one(offs_t curpc, opcode_desc const *prevdesc, bool in_delay_slot = false);
-	void build_sequence(int start, int end, u32 endflag);
+	void build_sequence(int start, int end, u32 endflag, u32 max_sequence);
 	void accumulate_required_backwards(opcode_desc &desc, u32 *reqmask);
 	void release_descriptions();
 
@@ -151,6 +165,10 @@ private:
 	u32                 m_window_start;             // code window start offset = startpc - window_start
 	u32                 m_window_end;               // code window end offset = startpc + window_end
 	u32                 m_max_sequence;             // maximum instructions to include in a sequence
+	u32                 m_trace_window_start;       // code window start offset for hot traces
+	u32                 m_trace_window_end;         // code window end offset for hot traces
+	u32                 m_trace_max_sequence;       // maximum sequence length for hot traces, or 0 if disabled
+	std::unique_ptr<u32[]> m_trace_counters;        // countdown of block entries, hashed by PC
 
 	// CPU parameters
 	cpu_device &        m_cpudevice;                // CPU device object
@@ -11,7 +11,8 @@
     Future improvements/changes:
 
     * UML optimizer:
-        - constant folding
+        - floating-point register propagation
+        - cross-block value tracking
 
     * Write a back-end validator:
         - checks all combinations of memory/register/immediate on all params
@@ -35,13 +36,19 @@
 #include "drcuml.h"
 
 #include "emuopts.h"
+#include "memreport.h"
 #include "drcbec.h"
 #ifdef NATIVE_DRC
 #include "drcbex86.h"
 #include "drcbex64.h"
+#include "drcbearm64.h"
 #endif
 
+#include "corestr.h"
+
+#include <algorithm>
 #include <fstream>
+#include <memory>
 
 
 
@@ -77,6 +84,34 @@ struct bevalidate_test
 };
 
 
+// what the block optimizer knows about an integer register
+struct ireg_value
+{
+	enum kind_t : u8 { UNKNOWN, IMMEDIATE, COPY };
+
+	kind_t          kind = UNKNOWN; // what sort of value is known
+	u8              size = 0;       // size of the write that established the value
+	u8              memsize = 0;    // size of the memory location mirrored, or 0
+	u64             value = 0;      // immediate value or source register index
+	void *          mem = nullptr;  // memory location known to hold the same value
+};
+
+
+// a memory operand's live range considered by the register allocator
+struct mem_interval
+{
+	void *          mem = nullptr;  // memory location
+	u8              size = 0;       // access size
+	int             first = 0;      // first instruction accessing it
+	int             last = 0;       // last instruction accessing it
+	int             uses = 0;       // number of instructions accessing it
+	bool            fill = false;   // first access needs the current contents
+	bool            spill = false;  // location is written within the range
+	bool            valid = true;   // every access can be replaced by a register
+	int             reg = -1;       // allocated register index, or -1
+};
+
+
 
 //**************************************************************************
 //  DRC BACKEND INTERFACE
@@ -93,6 +128,7 @@ drcbe_interface::drcbe_interface(drcuml_state &drcuml, drc_cache &cache, device_
 	, m_space()
 	, m_state(*reinterpret_cast<drcuml_machine_state *>(cache.alloc_near(sizeof(m_state))))
 	, m_accessors(nullptr)
+	, m_fastmem(nullptr)
 {
 	// reset the machine state
 	memset(&m_state, 0, sizeof(m_state));
@@ -104,7 +140,10 @@ drcbe_interface::drcbe_interface(drcuml_state &drcuml, drc_cache &cache, device_
 		int const count = memory->max_space_count();
 		m_accessors = reinterpret_cast<data_accessors *>(cache.alloc_near(sizeof(*m_accessors) * count));
 		memset(m_accessors, 0, sizeof(*m_accessors) * count);
+		m_fastmem = reinterpret_cast<drc_fastmem *>(cache.alloc_near(sizeof(*m_fastmem) * count));
+		std::uninitialized_fill_n(m_fastmem, count, drc_fastmem());
 		m_space.resize(count, nullptr);
+		m_fastmem_notifiers.resize(count);
 
 		for (int spacenum = 0; spacenum < count; ++spacenum)
 		{
@@ -112,6 +151,12 @@ drcbe_interface::drcbe_interface(drcuml_state &drcuml, drc_cache &cache, device_
 			{
 				m_space[spacenum] = &memory->space(spacenum);
 				m_space[spacenum]->accessors(m_accessors[spacenum]);
+
+				// track flat memory windows as the map changes; they're never
+				// inside views, so view switches can't move them
+				update_fastmem(spacenum);
+				m_fastmem_notifiers[spacenum] = m_space[spacenum]->add_change_notifier(
+						[this, spacenum] (read_or_write mode) { if (!m_space[spacenum]->switching_view()) update_fastmem(spacenum); });
 			}
 		}
 	}
@@ -127,6 +172,96 @@ drcbe_interface::~drcbe_interface()
 }
 
 
+//-------------------------------------------------
+//  vector_operation - portable implementation of
+//  the vector opcodes, for back-ends without a
+//  native lowering
+//-------------------------------------------------
+
+void drcbe_interface::vector_operation(u32 opcode, drcuml_vreg *dst, drcuml_vreg const *src1, drcuml_vreg const *src2, drcuml_vreg const *src3)
+{
+	// compute into a temporary since the destination may overlap the sources
+	drcuml_vreg result;
+	for (int lane = 0; lane < 8; lane++)
+	{
+		u16 const a(src1->h[lane]);
+		u16 const b(src2 ? src2->h[lane] : 0);
+		switch (opcode)
+		{
+		case uml::OP_VMOV:      result.h[lane] = a;                                                         break;
+		case uml::OP_VADD:      result.h[lane] = a + b;                                                     break;
+		case uml::OP_VSUB:      result.h[lane] = a - b;                                                     break;
+		case uml::OP_VADDS:     result.h[lane] = std::clamp<s32>(s16(a) + s16(b), -0x8000, 0x7fff);         break;
+		case uml::OP_VSUBS:     result.h[lane] = std::clamp<s32>(s16(a) - s16(b), -0x8000, 0x7fff);         break;
+		case uml::OP_VMULL:     result.h[lane] = u32(a) * u32(b);                                           break;
+		case uml::OP_VMULH:     result.h[lane] = u32(s32(s16(a)) * s32(s16(b))) >> 16;                      break;
+		case uml::OP_VMULHU:    result.h[lane] = (u32(a) * u32(b)) >> 16;                                   break;
+		case uml::OP_VCMPEQ:    result.h[lane] = (a == b) ? 0xffff : 0;                                     break;
+		case uml::OP_VCMPLT:    result.h[lane] = (s16(a) < s16(b)) ? 0xffff : 0;                            break;
+		case uml::OP_VSEL:      result.h[lane] = (a & b) | (~a & src3->h[lane]);                            break;
+		default:                throw emu_fatalerror("drcbe_interface::vector_operation: unexpected opcode %u", opcode);
+		}
+	}
+	*dst = result;
+}
+
+
+//-------------------------------------------------
+//  update_fastmem - find the largest flat memory
+//  windows in an address space that back-ends can
+//  access directly; generated code reads them
+//  at run time, so they can change at any point
+//-------------------------------------------------
+
+void drcbe_interface::update_fastmem(int spacenum)
+{
+	address_space &space(*m_space[spacenum]);
+	drc_fastmem &fastmem(m_fastmem[spacenum]);
+	fastmem = drc_fastmem();
+
+	// only byte-addressed spaces map addresses straight onto host memory
+	if (space.addr_shift() != 0)
+		return;
+	u8 const unit(space.data_width() / 8);
+
+	std::vector<memory_entry> readmap, writemap;
+	space.dump_maps(readmap, writemap);
+
+	auto const find = [&space, unit] (std::vector<memory_entry> const &map, bool write)
+	{
+		drc_fastmem_window result;
+		for (memory_entry const &entry : map)
+		{
+			// views can switch without notification and taps need to see every access
+			if (!entry.entry || !entry.context.empty() || entry.entry->is_passthrough() || entry.entry->name().compare(0, 7, "memory@"))
+				continue;
+
+			// memory banks are named after the bank; plain memory covers whole native units
+			u64 const length(u64(entry.end) - entry.start + 1);
+			if ((entry.start % unit) || (length % unit) || (length > ~u32(0)) || (length <= result.length))
+				continue;
+
+			// make sure the whole range is a single contiguous block of host memory
+			offs_t const last(entry.end - (unit - 1));
+			u8 *const base(reinterpret_cast<u8 *>(write ? space.get_write_ptr(entry.start) : space.get_read_ptr(entry.start)));
+			u8 *const end(reinterpret_cast<u8 *>(write ? space.get_write_ptr(last) : space.get_read_ptr(last)));
+			if (!base || (end != (base + (last - entry.start))))
+				continue;
+
+			result.base = base;
+			result.start = entry.start;
+			result.length = u32(length);
+		}
+		return result;
+	};
+
+	fastmem.read = find(readmap, false);
+	fastmem.write = find(writemap, true);
+	fastmem.unit = unit;
+	fastmem.swap = space.endianness() != ENDIANNESS_NATIVE;
+}
+
+
 
 //**************************************************************************
 //  DRCUML STATE
@@ -148,7 +283,38 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 	, m_blocklist()
 	, m_handlelist()
 	, m_symlist()
+	, m_optimizations(device.machine().options().drc_optimize_uml() ? DRCUML_OPTIMIZE_ALL : DRCUML_OPTIMIZE_NONE)
+	, m_stats()
+	, m_persist()
+{
+	// the code cache shows up in the memory report under its device
+	device.machine().memreport().add_source(memory_report::source_delegate(&drcuml_state::report_memory, this));
+
+	// reduce TLB pressure from generated code if requested
+	if (device.machine().options().drc_huge_pages())
+		m_cache.advise_huge_pages();
+
+	// keep translations between runs if requested; blocks built for the debugger differ
+	if (device.machine().options().drc_persist() && !(device.machine().debug_flags & DEBUG_FLAG_ENABLED))
+	{
+		std::string tag(device.tag() + 1);
+		strreplacechr(tag, ':', '_');
+		m_persist = std::make_unique<drc_persistent_cache>(
+				*this,
+				device.machine().options().drc_cache_directory(),
+				util::string_format("%s" PATH_SEPARATOR "%s.drc", device.machine().system().name, tag));
+	}
+}
+
+
+//-------------------------------------------------
+//  report_memory - add the code cache to the
+//  memory report
+//-------------------------------------------------
+
+void drcuml_state::report_memory(memory_report &report)
 {
+	report.add("drc", m_device.tag(), util::string_format("code cache (%u KB used)", u32(m_cache.code_bytes() / 1024)), m_cache.size());
 }
 
 
@@ -158,6 +324,33 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 
 drcuml_state::~drcuml_state()
 {
+	// report what the block optimizer accomplished
+	if (m_stats.blocks != 0)
+	{
+		std::string const summary(util::string_format(
+				"%s: UML optimizer: %u blocks, %u instructions, %u constants, %u copies, %u loads forwarded, %u stores removed, %u dead moves, %u ranges allocated (%u fills, %u spills)\n",
+				m_device.tag(),
+				m_stats.blocks, m_stats.instructions, m_stats.constants, m_stats.copies, m_stats.loads, m_stats.stores, m_stats.dead_moves,
+				m_stats.promoted, m_stats.fills, m_stats.spills));
+		osd_printf_verbose("%s", summary);
+		if (logging())
+			log_printf("%s", summary);
+	}
+
+	// report how much of the code cache was used
+	osd_printf_verbose("%s: DRC cache: %u KB of %u KB used (peak %u KB), %u KB near, %u KB permanent, %u flushes%s\n",
+			m_device.tag(),
+			u32(m_cache.code_bytes() / 1024), u32(m_cache.code_capacity() / 1024), u32(m_cache.peak_code_bytes() / 1024),
+			u32(m_cache.near_bytes() / 1024), u32(m_cache.permanent_bytes() / 1024), m_cache.flushes(),
+			m_cache.dual_mapped() ? ", dual-mapped" : "");
+
+	// write out anything new in the persistent cache
+	if (m_persist)
+	{
+		osd_printf_verbose("%s: DRC persistent cache: %u hits, %u misses, %u blocks stored, %u blocks not storable\n",
+				m_device.tag(), m_persist->hits(), m_persist->misses(), m_persist->stores(), m_persist->rejects());
+		m_persist->save();
+	}
 }
 
 
@@ -225,6 +418,30 @@ drcuml_block &drcuml_state::begin_block(uint32_t maxinst)
 }
 
 
+//-------------------------------------------------
+//  restore_block - generate a block from the
+//  persistent cache if the guest code it was
+//  translated from is unchanged
+//-------------------------------------------------
+
+bool drcuml_state::restore_block(u32 mode, offs_t pc, u64 config)
+{
+	if (!m_persist)
+		return false;
+
+	std::vector<uml::instruction> instructions;
+	if (!m_persist->find(mode, pc, config, instructions))
+		return false;
+
+	// replay the instructions through the normal optimizer and back-end
+	drcuml_block &block(begin_block(instructions.size()));
+	for (uml::instruction const &inst : instructions)
+		block.append() = inst;
+	block.end();
+	return true;
+}
+
+
 //-------------------------------------------------
 //  handle_alloc - allocate a new handle
 //-------------------------------------------------
@@ -236,6 +453,20 @@ uml::code_handle *drcuml_state::handle_alloc(char const *name)
 }
 
 
+//-------------------------------------------------
+//  handle_find - look up a handle by name or
+//  return nullptr if not found
+//-------------------------------------------------
+
+uml::code_handle *drcuml_state::handle_find(std::string_view name)
+{
+	for (uml::code_handle &handle : m_handlelist)
+		if (name == handle.string())
+			return &handle;
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  symbol_add - add a symbol to the internal
 //  symbol table
@@ -275,6 +506,26 @@ const char *drcuml_state::symbol_find(void *base, u32 *offset)
 }
 
 
+//-------------------------------------------------
+//  symbol_lookup - return the base of the named
+//  symbol or nullptr if not found
+//-------------------------------------------------
+
+void *drcuml_state::symbol_lookup(std::string_view name, u32 *length)
+{
+	for (symbol const &cursym : m_symlist)
+	{
+		if (cursym.name() == name)
+		{
+			if (length)
+				*length = cursym.length();
+			return cursym.base();
+		}
+	}
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  log_vprintf - directly printf to the UML log
 //  if generated
@@ -306,6 +557,10 @@ drcuml_block::drcuml_block(drcuml_state &drcuml, u32 maxinst)
 	, m_maxinst(maxinst * 3/2)
 	, m_inst(m_maxinst)
 	, m_inuse(false)
+	, m_persist(false)
+	, m_persist_mode(0)
+	, m_persist_pc(0)
+	, m_persist_config(0)
 {
 }
 
@@ -328,6 +583,7 @@ void drcuml_block::begin()
 	// set up the block information and return it
 	m_inuse = true;
 	m_nextinst = 0;
+	m_persist = false;
 }
 
 
@@ -340,8 +596,16 @@ void drcuml_block::end()
 {
 	assert(m_inuse);
 
+	// hand the unoptimized instructions to the persistent cache if requested
+	if (m_persist && m_drcuml.persistent_cache())
+		m_drcuml.persistent_cache()->add(m_persist_mode, m_persist_pc, m_persist_config, m_persist_ranges, &m_inst[0], m_nextinst);
+	m_persist = false;
+
 	// optimize the resulting code first
-	optimize();
+	{
+		auto profile = g_profiler.start(PROFILER_DRC_OPTIMIZE);
+		optimize();
+	}
 
 	// if we have a logfile, generate a disassembly of the block
 	if (m_drcuml.logging())
@@ -356,6 +620,41 @@ void drcuml_block::end()
 }
 
 
+//-------------------------------------------------
+//  persist - ask for this block to be kept in the
+//  persistent cache, keyed by mode, PC and CPU
+//  configuration and validated against the guest
+//  code it was translated from
+//-------------------------------------------------
+
+void drcuml_block::persist(u32 mode, offs_t pc, u64 config, std::vector<drc_persistent_cache::code_range> &&ranges)
+{
+	assert(m_inuse);
+
+	m_persist = true;
+	m_persist_mode = mode;
+	m_persist_pc = pc;
+	m_persist_config = config;
+	m_persist_ranges = std::move(ranges);
+}
+
+
+//-------------------------------------------------
+//  persist_depends - add guest memory that was
+//  read while generating the block, such as a
+//  literal folded into an immediate, so the block
+//  is only restored while it is unchanged
+//-------------------------------------------------
+
+void drcuml_block::persist_depends(offs_t start, u32 length)
+{
+	assert(m_inuse);
+
+	if (m_persist)
+		m_persist_ranges.push_back({ start, length });
+}
+
+
 //-------------------------------------------------
 //  abort - abort a code block in progress
 //-------------------------------------------------
@@ -431,6 +730,511 @@ void drcuml_block::optimize()
 		// now that flags are correct, simplify the instruction
 		inst.simplify();
 	}
+
+	// run the optional passes selected for this CPU
+	drcuml_state::optimize_stats &stats(m_drcuml.stats());
+	stats.blocks++;
+	stats.instructions += m_nextinst;
+	if (m_drcuml.optimizations() & (DRCUML_OPTIMIZE_PROPAGATE | DRCUML_OPTIMIZE_MEMORY))
+		propagate_values();
+	if (m_drcuml.optimizations() & DRCUML_OPTIMIZE_DEAD_MOV)
+		eliminate_dead_moves();
+	if (m_drcuml.optimizations() & DRCUML_OPTIMIZE_REGALLOC)
+		allocate_registers();
+}
+
+
+//-------------------------------------------------
+//  propagate_values - forward known constants,
+//  register copies and memory contents into the
+//  source operands of later instructions
+//-------------------------------------------------
+
+void drcuml_block::propagate_values()
+{
+	using uml::parameter;
+
+	bool const propagate(m_drcuml.optimizations() & DRCUML_OPTIMIZE_PROPAGATE);
+	bool const memory(m_drcuml.optimizations() & DRCUML_OPTIMIZE_MEMORY);
+	drcuml_state::optimize_stats &stats(m_drcuml.stats());
+	ireg_value known[uml::REG_I_COUNT];
+
+	auto const forget_all = [&known] ()
+	{
+		for (ireg_value &reg : known)
+			reg = ireg_value();
+	};
+	auto const forget_memory = [&known] (u8 const *base, u8 size)
+	{
+		for (ireg_value &reg : known)
+		{
+			u8 const *const mem(reinterpret_cast<u8 const *>(reg.mem));
+			if (reg.memsize && (!base || ((mem < (base + size)) && ((mem + reg.memsize) > base))))
+				reg.memsize = 0;
+		}
+	};
+	auto const forget_register = [&known] (int regnum)
+	{
+		known[regnum] = ireg_value();
+		for (ireg_value &reg : known)
+			if ((reg.kind == ireg_value::COPY) && (reg.value == regnum))
+				reg.kind = ireg_value::UNKNOWN;
+	};
+
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		uml::instruction &inst(m_inst[instnum]);
+		uml::opcode_t const opcode(inst.opcode());
+
+		// anything that can be reached from elsewhere, or that leaves the block, loses all knowledge
+		switch (opcode)
+		{
+		case uml::OP_HANDLE:
+		case uml::OP_HASH:
+		case uml::OP_LABEL:
+		case uml::OP_DEBUG:
+		case uml::OP_HASHJMP:
+		case uml::OP_EXH:
+		case uml::OP_CALLH:
+		case uml::OP_CALLC:
+		case uml::OP_RECOVER:
+		case uml::OP_RESTORE:
+			forget_all();
+			continue;
+		default:
+			break;
+		}
+
+		// a store of a register back to the location it already mirrors is redundant
+		if (memory && (opcode == uml::OP_MOV) && (inst.condition() == uml::COND_ALWAYS) && inst.param(0).is_memory() && inst.param(1).is_int_register())
+		{
+			ireg_value const &src(known[inst.param(1).ireg() - uml::REG_I0]);
+			if ((src.memsize == inst.size()) && (src.mem == inst.param(0).memory()))
+			{
+				inst.nop();
+				stats.stores++;
+				continue;
+			}
+		}
+
+		// substitute into pure inputs
+		bool changed(false);
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+		{
+			if (!inst.param_is_input(pnum) || inst.param_is_output(pnum))
+				continue;
+			parameter const param(inst.param(pnum));
+			u8 const size(inst.param_size(pnum));
+
+			if (param.is_int_register())
+			{
+				ireg_value const &reg(known[param.ireg() - uml::REG_I0]);
+				if (!propagate || (size > reg.size))
+					continue;
+				if ((reg.kind == ireg_value::IMMEDIATE) && inst.param_allows(pnum, parameter::PTYPE_IMMEDIATE))
+				{
+					inst.set_param(pnum, (size == 8) ? reg.value : (reg.value & util::make_bitmask<u64>(size * 8)));
+					stats.constants++;
+					changed = true;
+				}
+				else if ((reg.kind == ireg_value::COPY) && inst.param_allows(pnum, parameter::PTYPE_INT_REGISTER))
+				{
+					inst.set_param(pnum, parameter::make_ireg(uml::REG_I0 + reg.value));
+					stats.copies++;
+					changed = true;
+				}
+			}
+			else if (param.is_memory() && memory && inst.param_allows(pnum, parameter::PTYPE_INT_REGISTER))
+			{
+				for (int regnum = 0; regnum < uml::REG_I_COUNT; regnum++)
+				{
+					if ((known[regnum].memsize == size) && (known[regnum].mem == param.memory()))
+					{
+						inst.set_param(pnum, parameter::make_ireg(uml::REG_I0 + regnum));
+						stats.loads++;
+						changed = true;
+						break;
+					}
+				}
+			}
+		}
+		if (changed)
+			inst.simplify();
+
+		// now account for everything the instruction writes
+		switch (inst.opcode())
+		{
+		case uml::OP_STORE:
+		case uml::OP_FSTORE:
+		case uml::OP_READ:
+		case uml::OP_READM:
+		case uml::OP_WRITE:
+		case uml::OP_WRITEM:
+		case uml::OP_FREAD:
+		case uml::OP_FWRITE:
+		case uml::OP_SAVE:
+			forget_memory(nullptr, 0);
+			break;
+		default:
+			break;
+		}
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+		{
+			if (!inst.param_is_output(pnum))
+				continue;
+			parameter const &param(inst.param(pnum));
+			if (param.is_int_register())
+				forget_register(param.ireg() - uml::REG_I0);
+			else if (param.is_memory())
+				forget_memory(reinterpret_cast<u8 const *>(param.memory()), inst.param_size(pnum));
+		}
+
+		// unconditional moves establish new knowledge
+		if ((inst.opcode() == uml::OP_MOV) && (inst.condition() == uml::COND_ALWAYS))
+		{
+			parameter const &dst(inst.param(0));
+			parameter const &src(inst.param(1));
+			if (dst.is_int_register())
+			{
+				ireg_value &reg(known[dst.ireg() - uml::REG_I0]);
+				if (src.is_immediate())
+				{
+					reg.kind = ireg_value::IMMEDIATE;
+					reg.size = inst.size();
+					reg.value = src.immediate();
+				}
+				else if (src.is_int_register() && (src.ireg() != dst.ireg()))
+				{
+					reg.kind = ireg_value::COPY;
+					reg.size = inst.size();
+					reg.value = src.ireg() - uml::REG_I0;
+				}
+				else if (src.is_memory())
+				{
+					reg.mem = src.memory();
+					reg.memsize = inst.size();
+				}
+			}
+			else if (dst.is_memory() && src.is_int_register())
+			{
+				ireg_value &reg(known[src.ireg() - uml::REG_I0]);
+				reg.mem = dst.memory();
+				reg.memsize = inst.size();
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  eliminate_dead_moves - remove register moves
+//  whose result is overwritten before it is read
+//-------------------------------------------------
+
+void drcuml_block::eliminate_dead_moves()
+{
+	drcuml_state::optimize_stats &stats(m_drcuml.stats());
+
+	// only data operations that cannot leave the block or call out are scanned across
+	auto const transparent = [] (uml::opcode_t opcode)
+	{
+		switch (opcode)
+		{
+		case uml::OP_NOP:
+		case uml::OP_COMMENT:
+		case uml::OP_MAPVAR:
+			return true;
+		case uml::OP_READ:
+		case uml::OP_READM:
+		case uml::OP_WRITE:
+		case uml::OP_WRITEM:
+		case uml::OP_FREAD:
+		case uml::OP_FWRITE:
+			return false;
+		default:
+			return (opcode >= uml::OP_LOAD) && (opcode <= uml::OP_ICOPYF);
+		}
+	};
+
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		uml::instruction &inst(m_inst[instnum]);
+		if ((inst.opcode() != uml::OP_MOV) || (inst.condition() != uml::COND_ALWAYS) || !inst.param(0).is_int_register())
+			continue;
+		int const regnum(inst.param(0).ireg());
+
+		// scan ahead for a read or a complete overwrite
+		bool dead(false);
+		for (int scannum = instnum + 1; scannum < m_nextinst; scannum++)
+		{
+			uml::instruction const &scan(m_inst[scannum]);
+			if (!transparent(scan.opcode()))
+				break;
+
+			bool read(false), overwritten(false);
+			for (int pnum = 0; pnum < scan.numparams(); pnum++)
+			{
+				uml::parameter const &param(scan.param(pnum));
+				if (!param.is_int_register() || (param.ireg() != regnum))
+					continue;
+				if (scan.param_is_input(pnum))
+					read = true;
+				else if ((scan.condition() == uml::COND_ALWAYS) && (scan.param_size(pnum) >= inst.size()))
+					overwritten = true;
+			}
+			if (read)
+				break;
+			if (overwritten)
+			{
+				dead = true;
+				break;
+			}
+		}
+
+		if (dead)
+		{
+			inst.nop();
+			stats.dead_moves++;
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  allocate_registers - linear scan allocation of
+//  host-mapped integer registers that are dead
+//  over a range to the memory operands accessed
+//  within it, with a fill before and a spill
+//  after the range
+//-------------------------------------------------
+
+void drcuml_block::allocate_registers()
+{
+	using uml::parameter;
+
+	drcuml_state::optimize_stats &stats(m_drcuml.stats());
+
+	// only registers the back-end keeps in host registers are worth allocating
+	drcbe_info info;
+	m_drcuml.get_backend_info(info);
+	if (info.direct_iregs == 0)
+		return;
+
+	// ranges only span data operations that can neither leave the block nor touch memory indirectly
+	auto const allocatable = [] (uml::opcode_t opcode)
+	{
+		switch (opcode)
+		{
+		case uml::OP_NOP:
+		case uml::OP_COMMENT:
+		case uml::OP_MAPVAR:
+			return true;
+		default:
+			return ((opcode >= uml::OP_CARRY) && (opcode <= uml::OP_RORC)) || ((opcode >= uml::OP_FMOV) && (opcode <= uml::OP_ICOPYF));
+		}
+	};
+
+	// returns 1 if the instruction reads the register, 2 if it completely overwrites it, 0 otherwise
+	auto const reference = [] (uml::instruction const &inst, int regnum, u8 size)
+	{
+		bool read(false), overwritten(false), written(false);
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+		{
+			parameter const &param(inst.param(pnum));
+			if (!param.is_int_register() || (param.ireg() != (uml::REG_I0 + regnum)))
+				continue;
+			if (inst.param_is_input(pnum))
+				read = true;
+			else if ((inst.condition() == uml::COND_ALWAYS) && (inst.param_size(pnum) >= size))
+				overwritten = true;
+			else
+				written = true;
+		}
+		return (read || written) ? 1 : overwritten ? 2 : 0;
+	};
+
+	std::vector<uml::instruction> output;
+	std::vector<mem_interval> intervals;
+	output.reserve(m_maxinst);
+	int fills(0), spills(0), promoted(0);
+
+	int start(0);
+	while (start < m_nextinst)
+	{
+		// copy anything that can't be part of a range straight through
+		if (!allocatable(m_inst[start].opcode()))
+		{
+			output.push_back(m_inst[start++]);
+			continue;
+		}
+
+		// find the end of the run of allocatable instructions
+		int end(start);
+		while ((end < m_nextinst) && allocatable(m_inst[end].opcode()))
+			end++;
+
+		// build an interval for each distinct memory operand
+		intervals.clear();
+		for (int instnum = start; instnum < end; instnum++)
+		{
+			uml::instruction const &inst(m_inst[instnum]);
+			for (int pnum = 0; pnum < inst.numparams(); pnum++)
+			{
+				parameter const &param(inst.param(pnum));
+				if (!param.is_memory())
+					continue;
+				u8 const *const base(reinterpret_cast<u8 const *>(param.memory()));
+				u8 const size(inst.param_size(pnum));
+				bool const replaceable((inst.opcode() <= uml::OP_RORC) && ((size == 4) || (size == 8)) && inst.param_allows(pnum, parameter::PTYPE_INT_REGISTER));
+
+				// any overlapping access that isn't an exact match disqualifies both
+				mem_interval *found(nullptr);
+				for (mem_interval &interval : intervals)
+				{
+					u8 const *const mem(reinterpret_cast<u8 const *>(interval.mem));
+					if ((interval.mem == param.memory()) && (interval.size == size))
+						found = &interval;
+					else if ((mem < (base + size)) && ((mem + interval.size) > base))
+						interval.valid = false;
+				}
+				if (!found)
+				{
+					found = &intervals.emplace_back();
+					found->mem = param.memory();
+					found->size = size;
+					found->first = instnum;
+					found->fill = true;
+				}
+				if (!replaceable)
+					found->valid = false;
+
+				// the first instruction only avoids a fill if it unconditionally overwrites the location without reading it
+				if (found->last != instnum || found->uses == 0)
+				{
+					found->uses++;
+					found->last = instnum;
+				}
+				if (found->first == instnum)
+				{
+					bool reads(inst.condition() != uml::COND_ALWAYS);
+					for (int scan = 0; scan < inst.numparams(); scan++)
+						if (inst.param(scan).is_memory() && (inst.param(scan).memory() == param.memory()) && inst.param_is_input(scan))
+							reads = true;
+					found->fill = reads;
+				}
+				if (inst.param_is_output(pnum))
+					found->spill = true;
+			}
+		}
+
+		// linear scan over the intervals in order of their first access
+		for (mem_interval &interval : intervals)
+		{
+			// only allocate where the register accesses saved outweigh the fill and spill
+			if (!interval.valid || (interval.uses <= (int(interval.fill) + int(interval.spill) + 1)))
+				continue;
+
+			for (int regnum = 0; (regnum < info.direct_iregs) && (interval.reg < 0); regnum++)
+			{
+				// can't share a register with an overlapping interval
+				bool free(true);
+				for (mem_interval const &other : intervals)
+					if ((&other != &interval) && (other.reg == regnum) && (other.first <= interval.last) && (interval.first <= other.last))
+						free = false;
+
+				// the register must be untouched across the interval
+				for (int instnum = interval.first; free && (instnum <= interval.last); instnum++)
+					if (reference(m_inst[instnum], regnum, interval.size))
+						free = false;
+
+				// and its current value must be dead: overwritten before being read again within the run
+				if (free)
+				{
+					free = false;
+					for (int instnum = interval.last + 1; instnum < end; instnum++)
+					{
+						int const ref(reference(m_inst[instnum], regnum, interval.size));
+						if (ref)
+						{
+							free = (ref == 2);
+							break;
+						}
+					}
+				}
+
+				if (free)
+					interval.reg = regnum;
+			}
+		}
+
+		// emit the run with fills, register operands and spills
+		for (int instnum = start; instnum < end; instnum++)
+		{
+			uml::instruction inst(m_inst[instnum]);
+			for (mem_interval const &interval : intervals)
+			{
+				if ((interval.reg < 0) || (interval.first != instnum) || !interval.fill)
+					continue;
+				uml::instruction &fill(output.emplace_back());
+				if (interval.size == 8)
+					fill.dmov(parameter::make_ireg(uml::REG_I0 + interval.reg), parameter::make_memory(interval.mem));
+				else
+					fill.mov(parameter::make_ireg(uml::REG_I0 + interval.reg), parameter::make_memory(interval.mem));
+				fills++;
+			}
+
+			bool changed(false);
+			for (int pnum = 0; pnum < inst.numparams(); pnum++)
+			{
+				parameter const &param(inst.param(pnum));
+				if (!param.is_memory())
+					continue;
+				for (mem_interval const &interval : intervals)
+				{
+					if ((interval.reg >= 0) && (interval.first <= instnum) && (interval.last >= instnum) && (interval.mem == param.memory()))
+					{
+						inst.set_param(pnum, parameter::make_ireg(uml::REG_I0 + interval.reg));
+						changed = true;
+						break;
+					}
+				}
+			}
+			if (changed)
+				inst.simplify();
+			output.push_back(inst);
+
+			for (mem_interval const &interval : intervals)
+			{
+				if ((interval.reg < 0) || (interval.last != instnum) || !interval.spill)
+					continue;
+				uml::instruction &spill(output.emplace_back());
+				if (interval.size == 8)
+					spill.dmov(parameter::make_memory(interval.mem), parameter::make_ireg(uml::REG_I0 + interval.reg));
+				else
+					spill.mov(parameter::make_memory(interval.mem), parameter::make_ireg(uml::REG_I0 + interval.reg));
+				spills++;
+			}
+		}
+		for (mem_interval const &interval : intervals)
+			if (interval.reg >= 0)
+				promoted++;
+
+		// if the block would overflow, leave it as it was
+		if ((output.size() + (m_nextinst - end)) > m_maxinst)
+			return;
+		start = end;
+	}
+
+	// commit the rewritten block
+	std::copy(output.begin(), output.end(), m_inst.begin());
+	m_nextinst = output.size();
+	stats.promoted += promoted;
+	stats.fills += fills;
+	stats.spills += spills;
+
+	// note the per-block cost in the log
+	if (m_drcuml.logging() && promoted)
+		m_drcuml.log_printf("; register allocation: %d ranges, %d fills, %d spills\n", promoted, fills, spills);
 }
 
 
@@ -18,6 +18,7 @@
 #include <iostream>
 #include <list>
 #include <memory>
+#include <string_view>
 #include <vector>
 
 
@@ -28,6 +29,17 @@
 // these options are passed into drcuml_alloc() and control global behaviors
 
 
+// these options select which UML optimization passes run before generation
+enum
+{
+	DRCUML_OPTIMIZE_NONE        = 0x00,     // only flag/mapvar resolution and simplification
+	DRCUML_OPTIMIZE_PROPAGATE   = 0x01,     // constant and copy propagation into source operands
+	DRCUML_OPTIMIZE_MEMORY      = 0x02,     // forward memory loads and drop redundant stores
+	DRCUML_OPTIMIZE_DEAD_MOV    = 0x04,     // eliminate register moves overwritten before use
+	DRCUML_OPTIMIZE_REGALLOC    = 0x08,     // allocate free host-mapped registers to memory operands
+	DRCUML_OPTIMIZE_ALL         = 0x0f
+};
+
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -61,11 +73,20 @@ union drcuml_freg
 };
 
 
+// a vector register, as eight 16-bit lanes in host order
+union drcuml_vreg
+{
+	u16                     h[8];                   // 16-bit lanes
+	u64                     d[2];                   // 64-bit halves
+};
+
+
 // the collected machine state of a system
 struct drcuml_machine_state
 {
 	drcuml_ireg             r[uml::REG_I_COUNT];    // integer registers
 	drcuml_freg             f[uml::REG_F_COUNT];    // floating-point registers
+	drcuml_vreg             v[uml::REG_V_COUNT];    // vector registers
 	u32                     exp;                    // exception parameter register
 	u8                      fmod;                   // fmod (floating-point mode) register
 	u8                      flags;                  // flags state
@@ -80,6 +101,25 @@ struct drcbe_info
 };
 
 
+// a flat window of host memory backing a range of an address space
+struct drc_fastmem_window
+{
+	u8 *                    base = nullptr;         // host pointer for the first address
+	u32                     start = 0;              // first address covered
+	u32                     length = 0;             // bytes covered, or 0 if none
+};
+
+
+// fast memory access information for an address space
+struct drc_fastmem
+{
+	drc_fastmem_window      read;                   // largest flat readable window
+	drc_fastmem_window      write;                  // largest flat writable window
+	u8                      unit = 0;               // bytes per native unit, or 0 if unsupported
+	bool                    swap = false;           // native units are stored in non-host order
+};
+
+
 // a drcuml_block describes a basic block of instructions
 class drcuml_block
 {
@@ -103,6 +143,11 @@ public:
 	uml::instruction &append();
 	template <typename Format, typename... Params> void append_comment(Format &&fmt, Params &&... args);
 
+	// persistent cache
+	void persist(u32 mode, offs_t pc, u64 config, std::vector<drc_persistent_cache::code_range> &&ranges);
+	void persist_depends(offs_t start, u32 length);
+	void persist_cancel() { m_persist = false; }
+
 	// this class is thrown if abort() is called
 	class abort_compilation : public emu_exception
 	{
@@ -113,6 +158,9 @@ public:
 private:
 	// internal helpers
 	void optimize();
+	void propagate_values();
+	void eliminate_dead_moves();
+	void allocate_registers();
 	void disassemble();
 	char const *get_comment_text(uml::instruction const &inst, std::string &comment);
 
@@ -122,6 +170,13 @@ private:
 	u32                             m_maxinst;  // maximum number of instructions
 	std::vector<uml::instruction>   m_inst;     // pointer to the instruction list
 	bool                            m_inuse;    // this block is in use
+
+	// persistent cache key, if the front-end asked for this block to be kept
+	bool                            m_persist;
+	u32                             m_persist_mode;
+	offs_t                          m_persist_pc;
+	u64                             m_persist_config;
+	std::vector<drc_persistent_cache::code_range> m_persist_ranges;
 };
 
 
@@ -144,6 +199,14 @@ protected:
 	// base constructor
 	drcbe_interface(drcuml_state &drcuml, drc_cache &cache, device_t &device);
 
+	// vector operations; operands are always in memory
+	void *vector_pointer(uml::parameter const &param) const { return param.is_vector_register() ? &m_state.v[param.vreg() - uml::REG_V0] : param.memory(); }
+	static void vector_operation(u32 opcode, drcuml_vreg *dst, drcuml_vreg const *src1, drcuml_vreg const *src2, drcuml_vreg const *src3);
+
+	// fast memory access
+	void update_fastmem(int spacenum);
+	static u32 fastmem_xor(drc_fastmem const &fastmem, u8 size) { return fastmem.swap ? (fastmem.unit - size) : 0; }
+
 	// internal state
 	drcuml_state &                  m_drcuml;      // pointer back to our owner
 	drc_cache &                     m_cache;       // pointer to the cache
@@ -151,6 +214,8 @@ protected:
 	std::vector<address_space *>    m_space;       // pointers to CPU's address space
 	drcuml_machine_state &          m_state;       // state of the machine (in near cache)
 	data_accessors *                m_accessors;   // memory accessors (in near cache)
+	drc_fastmem *                   m_fastmem;     // flat memory windows (in near cache)
+	std::vector<util::notifier_subscription> m_fastmem_notifiers; // memory map change subscriptions
 };
 
 
@@ -162,9 +227,29 @@ public:
 	drcuml_state(device_t &device, drc_cache &cache, u32 flags, int modes, int addrbits, int ignorebits);
 	~drcuml_state();
 
+	// statistics gathered by the block optimizer
+	struct optimize_stats
+	{
+		u64 blocks = 0;             // blocks optimized
+		u64 instructions = 0;       // instructions examined
+		u64 constants = 0;          // register operands replaced with immediates
+		u64 copies = 0;             // register operands replaced with other registers
+		u64 loads = 0;              // memory operands replaced with registers
+		u64 stores = 0;             // redundant stores removed
+		u64 dead_moves = 0;         // dead register moves removed
+		u64 promoted = 0;           // memory operand ranges allocated to registers
+		u64 fills = 0;              // register fills inserted for allocated ranges
+		u64 spills = 0;             // register spills inserted for allocated ranges
+	};
+
 	// getters
 	device_t &device() const { return m_device; }
 	drc_cache &cache() const { return m_cache; }
+	u32 optimizations() const { return m_optimizations; }
+	optimize_stats &stats() { return m_stats; }
+
+	// configuration
+	void set_optimizations(u32 optimizations) { m_optimizations = optimizations & DRCUML_OPTIMIZE_ALL; }
 
 	// reset the state
 	void reset();
@@ -172,6 +257,8 @@ public:
 
 	// code generation
 	drcuml_block &begin_block(u32 maxinst);
+	bool restore_block(u32 mode, offs_t pc, u64 config);
+	drc_persistent_cache *persistent_cache() const { return m_persist.get(); }
 
 	// back-end interface
 	void get_backend_info(drcbe_info &info) { m_beintf->get_info(info); }
@@ -180,10 +267,12 @@ public:
 
 	// handle management
 	uml::code_handle *handle_alloc(char const *name);
+	uml::code_handle *handle_find(std::string_view name);
 
 	// symbol management
 	void symbol_add(void *base, u32 length, char const *name);
 	char const *symbol_find(void *base, u32 *offset = nullptr);
+	void *symbol_lookup(std::string_view name, u32 *length = nullptr);
 
 	// logging
 	bool logging() const { return bool(m_umllog); }
@@ -197,6 +286,8 @@ public:
 	bool logging_native() const { return m_beintf->logging(); }
 
 private:
+	void report_memory(memory_report &report);
+
 	// symbol class
 	class symbol
 	{
@@ -211,6 +302,7 @@ private:
 		// getters
 		bool includes(drccodeptr search) const { return (m_base <= search) && ((m_base + m_length) > search); }
 		drccodeptr base() const { return m_base; }
+		u32 length() const { return m_length; }
 		std::string const &name() const { return m_name; }
 
 	private:
@@ -228,6 +320,9 @@ private:
 	std::list<drcuml_block>                 m_blocklist;        // list of active blocks
 	std::list<uml::code_handle>             m_handlelist;       // list of active handles
 	std::list<symbol>                       m_symlist;          // list of symbols
+	u32                                     m_optimizations;    // DRCUML_OPTIMIZE_* passes to run
+	optimize_stats                          m_stats;            // block optimizer statistics
+	std::unique_ptr<drc_persistent_cache>   m_persist;          // translations kept between runs
 };
 
 
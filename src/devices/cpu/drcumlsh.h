@@ -185,5 +185,18 @@
 #define UML_FDCOPYI(block, dst, src)                        do { using namespace uml; block.append().fdcopyi(dst, src); } while (0)
 #define UML_ICOPYFD(block, dst, src)                        do { using namespace uml; block.append().icopyfd(dst, src); } while (0)
 
+/* ----- 128-bit Vector Operations ----- */
+#define UML_VMOV(block, dst, src)                           do { using namespace uml; block.append().vmov(dst, src); } while (0)
+#define UML_VADD(block, dst, src1, src2)                    do { using namespace uml; block.append().vadd(dst, src1, src2); } while (0)
+#define UML_VSUB(block, dst, src1, src2)                    do { using namespace uml; block.append().vsub(dst, src1, src2); } while (0)
+#define UML_VADDS(block, dst, src1, src2)                   do { using namespace uml; block.append().vadds(dst, src1, src2); } while (0)
+#define UML_VSUBS(block, dst, src1, src2)                   do { using namespace uml; block.append().vsubs(dst, src1, src2); } while (0)
+#define UML_VMULL(block, dst, src1, src2)                   do { using namespace uml; block.append().vmull(dst, src1, src2); } while (0)
+#define UML_VMULH(block, dst, src1, src2)                   do { using namespace uml; block.append().vmulh(dst, src1, src2); } while (0)
+#define UML_VMULHU(block, dst, src1, src2)                  do { using namespace uml; block.append().vmulhu(dst, src1, src2); } while (0)
+#define UML_VCMPEQ(block, dst, src1, src2)                  do { using namespace uml; block.append().vcmpeq(dst, src1, src2); } while (0)
+#define UML_VCMPLT(block, dst, src1, src2)                  do { using namespace uml; block.append().vcmplt(dst, src1, src2); } while (0)
+#define UML_VSEL(block, dst, mask, src1, src2)              do { using namespace uml; block.append().vsel(dst, mask, src1, src2); } while (0)
+
 
 #endif // MAME_CPU_DRCUMLSH_H
@@ -119,7 +119,11 @@ void dsp16_device_base::exm_w(int state)
 	{
 		m_exm_in = state ? 1U : 0U;
 		if (started())
+		{
 			external_memory_enable(*m_spaces[AS_PROGRAM], !m_exm_in);
+			if (m_recompiler)
+				m_recompiler->flush();
+		}
 	}
 }
 
@@ -184,7 +188,7 @@ dsp16_device_base::dsp16_device_base(
 			{ "exm", ENDIANNESS_BIG, 16, 16, -1 } }
 	, m_yaau_bits(yaau_bits)
 	, m_workram(*this, "workram"), m_spaces{ nullptr, nullptr, nullptr }, m_workram_mask(0U)
-	, m_drc_cache(CACHE_SIZE), m_core(nullptr, [] (core_state *core) { core->~core_state(); }), m_recompiler()
+	, m_drc_cache(CACHE_SIZE), m_core(nullptr, [] (core_state *core) { core->~core_state(); }), m_recompiler(), m_drc_interrupt(0U)
 	, m_cache_mode(cache::NONE), m_phase(phase::PURGE), m_int_enable{ 0U, 0U }, m_flags(FLAGS_NONE), m_cache_ptr(0U), m_cache_limit(0U), m_cache_iterations(0U)
 	, m_exm_in(1U), m_int_in(CLEAR_LINE), m_iack_out(1U)
 	, m_ick_in(1U), m_ild_in(CLEAR_LINE), m_do_out(1U), m_ock_in(1U), m_old_in(CLEAR_LINE), m_ose_out(1U)
@@ -212,7 +216,8 @@ void dsp16_device_base::device_start()
 	m_spaces[AS_PROGRAM]->cache(m_pcache);
 	m_workram_mask = u16((m_workram.bytes() >> 1) - 1);
 
-	if (allow_drc())
+	// the recompiler is opt-in until it has been checked against the interpreter
+	if (allow_unverified_drc())
 		m_recompiler.reset(new recompiler(*this, 0)); // TODO: what are UML flags for?
 
 	state_add(STATE_GENPC, "PC", m_core->xaau_pc);
@@ -378,6 +383,25 @@ void dsp16_device_base::execute_run()
 			}
 		}
 	}
+	else if (m_recompiler)
+	{
+		while (m_core->icount_remaining())
+		{
+			if (drc_eligible())
+			{
+				// run recompiled code, dropping back to the interpreter for anything it can't handle
+				m_drc_interrupt = 0U;
+				bool const interpret(m_recompiler->execute());
+				drc_exit();
+				if (interpret && m_core->icount_remaining())
+					interpret_cycle();
+			}
+			else
+			{
+				interpret_cycle();
+			}
+		}
+	}
 	else
 	{
 		while (m_core->icount_remaining())
@@ -1799,6 +1823,97 @@ inline bool dsp16_device_base::op_dau_con(u16 op, bool inc)
 	return BIT(con, 0) ? !result : result;
 }
 
+/***********************************************************************
+    recompiler support
+***********************************************************************/
+
+inline bool dsp16_device_base::drc_eligible() const
+{
+	// recompiled code only starts at a clean instruction boundary in ROM
+	return
+			(cache::NONE == m_cache_mode) &&
+			(phase::OP1 == m_phase) &&
+			(FLAGS_NONE == m_flags) &&
+			(m_int_enable[0] == m_int_enable[1]) &&
+			!interrupt_pending();
+}
+
+inline bool dsp16_device_base::interrupt_pending() const
+{
+	return m_iack_out && ((m_pio_pioc & m_int_enable[0] & 0x001eU) || (BIT(m_int_enable[0], 0) && (CLEAR_LINE != m_int_in)));
+}
+
+inline void dsp16_device_base::interpret_cycle()
+{
+	// step the interpreter a single machine cycle, keeping the remaining cycle count
+	int const remaining(m_core->icount);
+	m_core->icount = 1;
+	switch (m_cache_mode)
+	{
+	case cache::NONE:
+		execute_some_rom<false, false>();
+		break;
+	case cache::LOAD:
+		execute_some_rom<false, true>();
+		break;
+	case cache::EXECUTE:
+		execute_some_cache<false>();
+		break;
+	}
+	m_core->icount += remaining - 1;
+}
+
+void dsp16_device_base::drc_tick(u32 cycles)
+{
+	while (cycles--)
+	{
+		sio_step();
+		pio_step();
+	}
+	m_drc_interrupt = interrupt_pending() ? 1U : 0U;
+}
+
+s16 dsp16_device_base::drc_get_r(u16 op)
+{
+	s16 const result(get_r(op));
+	m_drc_interrupt = interrupt_pending() ? 1U : 0U;
+	return result;
+}
+
+void dsp16_device_base::drc_set_r(u16 op, s16 value)
+{
+	set_r(op, value);
+	m_drc_interrupt = interrupt_pending() ? 1U : 0U;
+}
+
+void dsp16_device_base::drc_suspend_loop(u16 pc, u8 remaining)
+{
+	// put the interpreter at the top of the next pass of a do K loop
+	m_cache_mode = cache::EXECUTE;
+	m_phase = phase::OP1;
+	m_cache_ptr = 1U;
+	m_cache_iterations = remaining;
+	m_cache_pcbase = pc;
+	m_core->xaau_pc = (pc & XAAU_I_EXT) | ((pc + m_cache_limit + 1) & XAAU_I_MASK);
+	if (m_iack_out)
+		m_core->xaau_pi = m_core->xaau_pc;
+	overlap_rom_data_read();
+	m_st_pcbase = (m_cache_pcbase & 0xf000U) | ((m_cache_pcbase + m_cache_ptr) & 0x0fffU);
+}
+
+void dsp16_device_base::drc_exit()
+{
+	// recompiled code leaves PC pointing at the next instruction to fetch from ROM
+	if (cache::NONE == m_cache_mode)
+	{
+		if (m_iack_out)
+			m_core->xaau_pi = m_core->xaau_pc;
+		m_phase = phase::OP1;
+		m_cache[m_cache_ptr = 0] = m_pcache.read_word(m_core->xaau_pc);
+		m_st_pcbase = m_core->xaau_pc;
+	}
+}
+
 /***********************************************************************
     serial I/O
 ***********************************************************************/
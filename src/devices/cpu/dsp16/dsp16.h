@@ -195,6 +195,16 @@ private:
 	void sio_step();
 	void pio_step();
 
+	// recompiler support
+	bool drc_eligible() const;
+	bool interrupt_pending() const;
+	void interpret_cycle();
+	void drc_tick(u32 cycles);
+	s16 drc_get_r(u16 op);
+	void drc_set_r(u16 op, s16 value);
+	void drc_suspend_loop(u16 pc, u8 remaining);
+	void drc_exit();
+
 	// inline helpers
 	static bool op_interruptible(u16 op);
 	bool check_predicate();
@@ -281,6 +291,7 @@ private:
 	drc_cache                   m_drc_cache;
 	core_state_ptr              m_core;
 	recompiler_ptr              m_recompiler;
+	u8                          m_drc_interrupt;
 
 	// execution state
 	cache       m_cache_mode;
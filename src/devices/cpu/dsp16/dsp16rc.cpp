@@ -4,6 +4,25 @@
 
     WE|AT&T DSP16 series recompiler
 
+    Blocks are compiled for a given AUC value and IACK state, so
+    alignment, saturation and Y/A clearing modes are fixed at
+    translation time, and PI reads are constants while PI follows PC.
+    Writing AUC ends the block and redispatches on the new mode.
+
+    Generated code only runs at an instruction boundary outside cache
+    execution with no predicate, IACK change or interrupt pending.  The
+    serial and parallel I/O are stepped inline while the serial clock
+    divider has cycles left and no parallel strobe is active, and
+    through a callout otherwise.  When a callout makes an interrupt
+    pending, control returns to the interpreter at the next
+    instruction.  Interrupt returns, software interrupts, redo K,
+    reserved encodings and PIOC writes are left to the interpreter.
+
+    A do K loop becomes a native loop: the first pass and the last
+    instruction of the final pass have ROM timings, and the passes in
+    between have cache timings.  If cycles run out between passes, the
+    interpreter's cache state is set up so it can finish the loop.
+
     There are a number of easy optimisations:
     * The RAM space is entirely internal, so the memory system can be
       bypassed if debugging is not enabled.
@@ -28,6 +47,7 @@
 
 ***************************************************************************/
 
+
 #include "emu.h"
 #include "dsp16rc.h"
 #include "dsp16core.h"
@@ -35,6 +55,19 @@
 #include "cpu/drcumlsh.h"
 
 
+using namespace uml;
+
+
+namespace {
+
+inline u16 offset_pc(u16 pc, u16 offset)
+{
+	return (pc & 0xf000U) | ((pc + offset) & 0x0fffU);
+}
+
+} // anonymous namespace
+
+
 /***********************************************************************
     construction/destruction
 ***********************************************************************/
@@ -43,8 +76,10 @@ dsp16_device_base::recompiler::recompiler(dsp16_device_base &host, u32 flags)
 	: m_host(host)
 	, m_core(*host.m_core)
 	, m_frontend(host, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, COMPILE_MAX_SEQUENCE)
-	, m_uml(host, host.m_drc_cache, flags, 2, 16, 0)
+	, m_uml(host, host.m_drc_cache, flags, MODE_COUNT, 16, 0)
 {
+	m_uml.symbol_add(&m_core.icount, sizeof(m_core.icount), "icount");
+
 	m_uml.symbol_add(&m_core.xaau_pc, sizeof(m_core.xaau_pc), "pc");
 	m_uml.symbol_add(&m_core.xaau_pt, sizeof(m_core.xaau_pt), "pt");
 	m_uml.symbol_add(&m_core.xaau_pr, sizeof(m_core.xaau_pr), "pr");
@@ -71,10 +106,1375 @@ dsp16_device_base::recompiler::recompiler(dsp16_device_base &host, u32 flags)
 	m_uml.symbol_add(&m_core.dau_auc, sizeof(m_core.dau_auc), "auc");
 	m_uml.symbol_add(&m_core.dau_psw, sizeof(m_core.dau_psw), "psw");
 	m_uml.symbol_add(&m_core.dau_temp, sizeof(m_core.dau_temp), "temp");
-
-	(void)m_host;
 }
 
 dsp16_device_base::recompiler::~recompiler()
 {
 }
+
+/***********************************************************************
+    execution
+***********************************************************************/
+
+bool dsp16_device_base::recompiler::execute()
+{
+	if (m_cache_dirty)
+		flush_cache();
+
+	while (true)
+	{
+		switch (m_uml.execute(*m_entry))
+		{
+		case EXEC_OUT_OF_CYCLES:
+			return false;
+		case EXEC_INTERPRET:
+			return true;
+		case EXEC_MISSING_CODE:
+			compile_block(u32(m_core.dau_auc & MODE_AUC_MASK) | (m_host.m_iack_out ? MODE_PI_TRACKS_PC : 0U), m_core.xaau_pc);
+			break;
+		case EXEC_RESET_CACHE:
+			flush_cache();
+			break;
+		default:
+			throw emu_fatalerror("DSP16: unexpected recompiler exit (PC = %04X)\n", m_core.xaau_pc);
+		}
+	}
+}
+
+/***********************************************************************
+    static code generation
+***********************************************************************/
+
+void dsp16_device_base::recompiler::flush_cache()
+{
+	m_uml.reset();
+	try
+	{
+		generate_entry_point();
+		generate_nocode_handler();
+		generate_out_of_cycles();
+		generate_interpret_handler();
+		generate_dispatch_handler();
+	}
+	catch (drcuml_block::abort_compilation &)
+	{
+		throw emu_fatalerror("DSP16: error generating recompiler static code\n");
+	}
+	m_cache_dirty = false;
+}
+
+void dsp16_device_base::recompiler::generate_entry_point()
+{
+	drcuml_block &block(m_uml.begin_block(20));
+
+	if (!m_nocode)
+		m_nocode = m_uml.handle_alloc("nocode");
+	if (!m_entry)
+		m_entry = m_uml.handle_alloc("entry");
+	UML_HANDLE(block, *m_entry);
+	UML_LOAD(block, I0, &m_core.xaau_pc, 0, SIZE_WORD, SCALE_x2);
+	generate_mode(block, I1);
+	UML_HASHJMP(block, I1, I0, *m_nocode);
+
+	block.end();
+}
+
+void dsp16_device_base::recompiler::generate_nocode_handler()
+{
+	drcuml_block &block(m_uml.begin_block(10));
+
+	UML_HANDLE(block, *m_nocode);
+	UML_GETEXP(block, I0);
+	UML_STORE(block, &m_core.xaau_pc, 0, I0, SIZE_WORD, SCALE_x2);
+	UML_EXIT(block, EXEC_MISSING_CODE);
+
+	block.end();
+}
+
+void dsp16_device_base::recompiler::generate_out_of_cycles()
+{
+	drcuml_block &block(m_uml.begin_block(10));
+
+	if (!m_out_of_cycles)
+		m_out_of_cycles = m_uml.handle_alloc("out_of_cycles");
+	UML_HANDLE(block, *m_out_of_cycles);
+	UML_GETEXP(block, I0);
+	UML_STORE(block, &m_core.xaau_pc, 0, I0, SIZE_WORD, SCALE_x2);
+	UML_EXIT(block, EXEC_OUT_OF_CYCLES);
+
+	block.end();
+}
+
+void dsp16_device_base::recompiler::generate_interpret_handler()
+{
+	drcuml_block &block(m_uml.begin_block(10));
+
+	if (!m_interpret)
+		m_interpret = m_uml.handle_alloc("interpret");
+	UML_HANDLE(block, *m_interpret);
+	UML_GETEXP(block, I0);
+	UML_STORE(block, &m_core.xaau_pc, 0, I0, SIZE_WORD, SCALE_x2);
+	UML_EXIT(block, EXEC_INTERPRET);
+
+	block.end();
+}
+
+void dsp16_device_base::recompiler::generate_dispatch_handler()
+{
+	drcuml_block &block(m_uml.begin_block(10));
+
+	if (!m_dispatch)
+		m_dispatch = m_uml.handle_alloc("dispatch");
+	UML_HANDLE(block, *m_dispatch);
+	UML_GETEXP(block, I0);
+	generate_mode(block, I1);
+	UML_HASHJMP(block, I1, I0, *m_nocode);
+
+	block.end();
+}
+
+void dsp16_device_base::recompiler::generate_mode(drcuml_block &block, uml::parameter dst)
+{
+	// mode is the AUC value plus whether IACK is clear - clobbers I2
+	UML_LOAD(block, dst, &m_core.dau_auc, 0, SIZE_BYTE, SCALE_x1);
+	UML_AND(block, dst, dst, MODE_AUC_MASK);
+	UML_LOAD(block, I2, &m_host.m_iack_out, 0, SIZE_BYTE, SCALE_x1);
+	UML_SHL(block, I2, I2, 7);
+	UML_OR(block, dst, dst, I2);
+}
+
+/***********************************************************************
+    compilation
+***********************************************************************/
+
+void dsp16_device_base::recompiler::compile_block(u32 mode, u16 pc)
+{
+	auto profile = g_profiler.start(PROFILER_DRC_COMPILE);
+
+	opcode_desc const *const desclist(m_frontend.describe_code(pc));
+	bool override(false);
+	for (bool succeeded = false; !succeeded; )
+	{
+		try
+		{
+			drcuml_block &block(m_uml.begin_block(32768));
+			compiler_state compiler;
+			compiler.mode = mode;
+
+			for (opcode_desc const *seqhead = desclist, *seqlast = nullptr; seqhead; seqhead = seqlast->next())
+			{
+				for (seqlast = seqhead; !(seqlast->flags & OPFLAG_END_SEQUENCE); seqlast = seqlast->next()) { }
+
+				if (m_uml.logging())
+					block.append_comment("-------------------------");
+
+				// add a hash entry unless we'd be replacing one for code that isn't being recompiled
+				if (override || !m_uml.hash_exists(mode, seqhead->pc))
+				{
+					UML_HASH(block, mode, seqhead->pc);
+				}
+				else if (seqhead == desclist)
+				{
+					override = true;
+					UML_HASH(block, mode, seqhead->pc);
+				}
+				else
+				{
+					UML_HASHJMP(block, mode, seqhead->pc, *m_nocode);
+					continue;
+				}
+
+				for (opcode_desc const *curdesc = seqhead; seqlast->next() != curdesc; curdesc = curdesc->next())
+					generate_sequence_instruction(block, compiler, *curdesc);
+
+				// carry on to the next instruction (unreachable after an unconditional branch)
+				generate_jump(block, compiler, offset_pc(seqlast->pc, seqlast->length));
+			}
+
+			block.end();
+			succeeded = true;
+		}
+		catch (drcuml_block::abort_compilation &)
+		{
+			flush_cache();
+		}
+	}
+}
+
+void dsp16_device_base::recompiler::generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, opcode_desc const &desc)
+{
+	if (m_uml.logging())
+		block.append_comment("%04X: %04X", desc.pc, m_host.m_pcache.read_word(desc.physpc));
+
+	compiler.pc = desc.pc;
+	compiler.nextpc = offset_pc(desc.pc, desc.length);
+	compiler.check_int = false;
+	compiler.mode_changed = false;
+	compiler.exit_after = false;
+	if ((desc.flags & OPFLAG_INVALID_OPCODE) || !generate_opcode(block, compiler, desc))
+	{
+		UML_EXH(block, *m_interpret, desc.pc);
+	}
+	else if (compiler.exit_after)
+	{
+		UML_EXH(block, *m_interpret, compiler.nextpc);
+	}
+	else if (compiler.mode_changed)
+	{
+		UML_CMP(block, mem(&m_core.icount), 0);
+		UML_EXHc(block, COND_LE, *m_out_of_cycles, compiler.nextpc);
+		UML_EXH(block, *m_dispatch, compiler.nextpc);
+	}
+}
+
+bool dsp16_device_base::recompiler::generate_opcode(drcuml_block &block, compiler_state &compiler, opcode_desc const &desc)
+{
+	u16 const op(m_host.m_pcache.read_word(desc.physpc));
+	switch (op >> 11)
+	{
+	case 0x00: // goto JA
+	case 0x01:
+	case 0x10: // call JA
+	case 0x11:
+	case 0x18: // goto B
+	case 0x1a: // if CON # icall
+		return generate_branch(block, compiler, desc, op);
+
+	case 0x0a: // R = N
+		if ((op & 0x000fU) || !r_supported(op, false, true, false))
+			return false;
+		UML_MOV(block, I5, m_host.m_pcache.read_word(offset_pc(desc.pc, 1)));
+		if (r_peripheral(op))
+		{
+			generate_tick(block, compiler, 1, false);
+			generate_set_r(block, compiler, op);
+			generate_tick(block, compiler, 1, true);
+		}
+		else
+		{
+			generate_set_r(block, compiler, op);
+			generate_tick(block, compiler, 2, true);
+		}
+		return true;
+
+	case 0x0e: // do K { instre1...instrNI } # redo K
+		return op_ni(op) && generate_do(block, compiler, desc, op);
+
+	default:
+		return op_supported(compiler.mode, op, false) && generate_op(block, compiler, op, offset_pc(desc.pc, 1), loop_pass::NONE);
+	}
+}
+
+bool dsp16_device_base::recompiler::generate_op(drcuml_block &block, compiler_state &compiler, u16 op, u16 pcval, loop_pass pass)
+{
+	u32 const mode(compiler.mode);
+	u32 const cycles(op_cycles(op, loop_pass::EXECUTE == pass));
+	switch (op >> 11)
+	{
+	case 0x02: // R = M
+	case 0x03:
+		generate_short_immediate(block, op);
+		break;
+
+	case 0x04: // F1 ; Y = a1[l]
+	case 0x1c: // F1 ; Y = a0[l]
+		generate_saturate(block, mode, BIT(~op, 14), I5);
+		if (op_x(op))
+			UML_DSHR(block, I5, I5, 16);
+		generate_yaau_write(block, compiler, op, I5);
+		generate_f1(block, mode, op, true);
+		break;
+
+	case 0x05: // F1 ; Z : aT[l]
+		generate_saturate(block, mode, op_d(~op), I5);
+		if (op_x(op))
+			UML_DSHR(block, I5, I5, 16);
+		UML_STORE(block, &m_core.dau_temp, 0, I5, SIZE_WORD, SCALE_x2);
+		generate_f1(block, mode, op, true);
+		generate_yaau_read(block, compiler, op, I5);
+		generate_set_at(block, op, op_x(op), I5);
+		generate_yaau_write_z(block, compiler, op);
+		break;
+
+	case 0x06: // F1 ; Y
+		generate_f1(block, mode, op, true);
+		generate_yaau_read(block, compiler, op, I5);
+		break;
+
+	case 0x07: // F1 ; aT[l] = Y
+		generate_f1(block, mode, op, true);
+		generate_yaau_read(block, compiler, op, I5);
+		generate_set_at(block, op, op_x(op), I5);
+		break;
+
+	case 0x08: // aT = R
+		generate_get_r(block, compiler, op, pcval);
+		generate_set_at(block, op, true, I5);
+		break;
+
+	case 0x09: // R = a0
+	case 0x0b: // R = a1
+		generate_saturate(block, mode, BIT(op, 12), I5);
+		UML_DSHR(block, I5, I5, 16);
+		generate_set_r(block, compiler, op);
+		break;
+
+	case 0x0c: // Y = R
+		// register is read in the second cycle
+		if (r_peripheral(op))
+		{
+			generate_tick(block, compiler, 1, false);
+			generate_get_r(block, compiler, op, pcval);
+			generate_yaau_write(block, compiler, op, I5);
+			generate_tick(block, compiler, cycles - 1, true);
+			return true;
+		}
+		generate_get_r(block, compiler, op, pcval);
+		generate_yaau_write(block, compiler, op, I5);
+		break;
+
+	case 0x0d: // Z : R
+		generate_get_r(block, compiler, op, pcval);
+		UML_STORE(block, &m_core.dau_temp, 0, I5, SIZE_WORD, SCALE_x2);
+		generate_yaau_read(block, compiler, op, I5);
+		generate_set_r(block, compiler, op);
+		generate_yaau_write_z(block, compiler, op);
+		break;
+
+	case 0x0f: // R = Y
+		generate_yaau_read(block, compiler, op, I5);
+		generate_set_r(block, compiler, op);
+		break;
+
+	case 0x12: // ifc CON F2
+		{
+			code_label const skip(compiler.labelnum++), done(compiler.labelnum++);
+			generate_con(block, op, false, skip);
+			UML_LOADS(block, I5, &m_core.dau_c[1], 0, SIZE_BYTE, SCALE_x1);
+			UML_ADD(block, I5, I5, 1);
+			UML_STORE(block, &m_core.dau_c[1], 0, I5, SIZE_BYTE, SCALE_x1);
+			generate_f2(block, mode, op);
+			UML_STORE(block, &m_core.dau_c[2], 0, I5, SIZE_BYTE, SCALE_x1);
+			UML_JMP(block, done);
+			UML_LABEL(block, skip);
+			UML_LOADS(block, I5, &m_core.dau_c[1], 0, SIZE_BYTE, SCALE_x1);
+			UML_ADD(block, I5, I5, 1);
+			UML_STORE(block, &m_core.dau_c[1], 0, I5, SIZE_BYTE, SCALE_x1);
+			UML_LABEL(block, done);
+		}
+		break;
+
+	case 0x13: // if CON F2
+		{
+			code_label const skip(compiler.labelnum++);
+			generate_con(block, op, true, skip);
+			generate_f2(block, mode, op);
+			UML_LABEL(block, skip);
+		}
+		break;
+
+	case 0x14: // F1 ; Y = y[l]
+		generate_f1(block, mode, op, true);
+		UML_MOV(block, I5, mem(&m_core.dau_y));
+		if (op_x(op))
+			UML_SHR(block, I5, I5, 16);
+		generate_yaau_write(block, compiler, op, I5);
+		break;
+
+	case 0x15: // F1 ; Z : y[l]
+		generate_f1(block, mode, op, true);
+		UML_MOV(block, I5, mem(&m_core.dau_y));
+		if (op_x(op))
+			UML_SHR(block, I5, I5, 16);
+		UML_STORE(block, &m_core.dau_temp, 0, I5, SIZE_WORD, SCALE_x2);
+		generate_yaau_read(block, compiler, op, I5);
+		generate_set_y(block, mode, op_x(op), I5);
+		generate_yaau_write_z(block, compiler, op);
+		break;
+
+	case 0x16: // F1 ; x = Y
+		generate_f1(block, mode, op, true);
+		generate_yaau_read(block, compiler, op, I5);
+		UML_STORE(block, &m_core.dau_x, 0, I5, SIZE_WORD, SCALE_x2);
+		break;
+
+	case 0x17: // F1 ; y[l] = Y
+		generate_f1(block, mode, op, true);
+		generate_yaau_read(block, compiler, op, I5);
+		generate_set_y(block, mode, op_x(op), I5);
+		break;
+
+	case 0x19: // F1 ; y = a0 ; x = *pt++[i]
+	case 0x1b: // F1 ; y = a1 ; x = *pt++[i]
+		// F1 sees the old y, and y gets the accumulator before F1 writes it
+		UML_DLOAD(block, I5, &m_core.dau_a[BIT(op, 12)], 0, SIZE_QWORD, SCALE_x8);
+		generate_f1(block, mode, op, true);
+		UML_MOV(block, mem(&m_core.dau_y), I5);
+		generate_rom_read(block, op);
+		break;
+
+	case 0x1d: // F1 ; Z : y ; x = *pt++[i]
+		generate_f1(block, mode, op, true);
+		UML_MOV(block, I5, mem(&m_core.dau_y));
+		UML_SHR(block, I5, I5, 16);
+		UML_STORE(block, &m_core.dau_temp, 0, I5, SIZE_WORD, SCALE_x2);
+		generate_yaau_read(block, compiler, op, I5);
+		generate_set_y(block, mode, true, I5);
+		generate_rom_read(block, op);
+		generate_yaau_write_z(block, compiler, op);
+		break;
+
+	case 0x1f: // F1 ; y = Y ; x = *pt++[i]
+		generate_f1(block, mode, op, true);
+		generate_yaau_read(block, compiler, op, I5);
+		generate_set_y(block, mode, true, I5);
+		generate_rom_read(block, op);
+		break;
+
+	default:
+		return false;
+	}
+	generate_tick(block, compiler, cycles, true);
+	return true;
+}
+
+bool dsp16_device_base::recompiler::generate_branch(drcuml_block &block, compiler_state &compiler, opcode_desc const &desc, u16 op)
+{
+	// find the branch and check it's something we can do
+	bool const predicated(0x1aU == (op >> 11));
+	u16 const branch(predicated ? m_host.m_pcache.read_word(offset_pc(desc.pc, 1)) : op);
+	if (predicated && (BIT(op, 10) || (op & 0x03e0U) || !con_supported(op))) // icall or reserved fields
+		return false;
+	switch (branch >> 11)
+	{
+	case 0x00: // goto JA
+	case 0x01:
+	case 0x10: // call JA
+	case 0x11:
+		break;
+	case 0x18: // goto B
+		if ((branch & 0x00ffU) || ((0x0U != op_b(branch)) && (0x2U != op_b(branch)) && (0x3U != op_b(branch))))
+			return false;
+		break;
+	default:
+		return false;
+	}
+
+	// the pipeline is flushed whether or not the branch is taken
+	u16 const pcval(offset_pc(desc.pc, predicated ? 2 : 1));
+	code_label const skip(compiler.labelnum++);
+	generate_tick(block, compiler, predicated ? 3 : 2, false);
+	if (predicated)
+		generate_con(block, op, true, skip);
+	switch (branch >> 11)
+	{
+	case 0x00: // goto JA
+	case 0x01:
+	case 0x10: // call JA
+	case 0x11:
+		if (BIT(branch, 15))
+			UML_STORE(block, &m_core.xaau_pr, 0, pcval, SIZE_WORD, SCALE_x2);
+		UML_MOV(block, I0, (desc.pc & 0xf000U) | op_ja(branch));
+		break;
+	case 0x18: // goto B
+		switch (op_b(branch))
+		{
+		case 0x0: // return
+			UML_LOAD(block, I0, &m_core.xaau_pr, 0, SIZE_WORD, SCALE_x2);
+			break;
+		case 0x2: // goto pt
+			UML_LOAD(block, I0, &m_core.xaau_pt, 0, SIZE_WORD, SCALE_x2);
+			break;
+		case 0x3: // call pt
+			UML_LOAD(block, I0, &m_core.xaau_pt, 0, SIZE_WORD, SCALE_x2);
+			UML_STORE(block, &m_core.xaau_pr, 0, pcval, SIZE_WORD, SCALE_x2);
+			break;
+		}
+		break;
+	}
+	generate_interrupt_check(block, compiler, I0);
+	generate_jump(block, compiler, I0);
+	UML_LABEL(block, skip);
+	generate_interrupt_check(block, compiler, pcval);
+	return true;
+}
+
+bool dsp16_device_base::recompiler::generate_do(drcuml_block &block, compiler_state &compiler, opcode_desc const &desc, u16 op)
+{
+	// only loops the interpreter could cache
+	u16 const ni(op_ni(op)), k(op_k(op));
+	if (2U > k)
+		return false;
+	u16 body[15];
+	for (u16 i = 0U; ni > i; ++i)
+	{
+		body[i] = m_host.m_pcache.read_word(offset_pc(desc.pc, i + 1));
+		if (!op_supported(compiler.mode, body[i], true))
+			return false;
+	}
+	u16 const endpc(offset_pc(desc.pc, ni + 1));
+
+	// fill the interpreter's cache so redo K works and a suspended loop can be resumed
+	for (u16 i = 0U; ni > i; ++i)
+		UML_STORE(block, &m_host.m_cache[i + 1], 0, body[i], SIZE_WORD, SCALE_x2);
+	UML_STORE(block, &m_host.m_cache_limit, 0, ni, SIZE_BYTE, SCALE_x1);
+	UML_STORE(block, &m_host.m_cache_pcbase, 0, desc.pc, SIZE_WORD, SCALE_x2);
+
+	// the do instruction itself and the first pass run from ROM
+	compiler.in_loop = true;
+	generate_tick(block, compiler, 1, true);
+	for (u16 i = 0U; ni > i; ++i)
+		generate_op(block, compiler, body[i], offset_pc(desc.pc, i + 2), loop_pass::LOAD);
+	if (1U == op_cycles(body[ni - 1], false))
+		generate_tick(block, compiler, 1, true); // extra cycle to fetch from cache
+
+	// middle passes run from cache, checking for cycles between passes
+	code_label const top(compiler.labelnum++), last(compiler.labelnum++), suspend(compiler.labelnum++);
+	UML_MOV(block, mem(&m_loop_remaining), k - 1);
+	UML_LABEL(block, top);
+	UML_CMP(block, mem(&m_core.icount), 0);
+	UML_JMPc(block, COND_LE, suspend);
+	UML_CMP(block, mem(&m_loop_remaining), 1);
+	UML_JMPc(block, COND_E, last);
+	for (u16 i = 0U; ni > i; ++i)
+		generate_op(block, compiler, body[i], endpc, loop_pass::EXECUTE);
+	UML_SUB(block, mem(&m_loop_remaining), mem(&m_loop_remaining), 1);
+	UML_JMP(block, top);
+
+	// let the interpreter finish the loop next time
+	UML_LABEL(block, suspend);
+	UML_MOV(block, mem(&m_loop_pc), desc.pc);
+	UML_CALLC(block, &recompiler::cfunc_suspend_loop, this);
+	UML_EXIT(block, EXEC_OUT_OF_CYCLES);
+
+	// the last instruction of the final pass fetches from ROM again
+	UML_LABEL(block, last);
+	for (u16 i = 0U; ni > i; ++i)
+		generate_op(block, compiler, body[i], endpc, ((ni - 1) == i) ? loop_pass::LAST : loop_pass::EXECUTE);
+	compiler.in_loop = false;
+	generate_interrupt_check(block, compiler, endpc);
+	return true;
+}
+
+void dsp16_device_base::recompiler::generate_jump(drcuml_block &block, compiler_state &compiler, uml::parameter target)
+{
+	UML_CMP(block, mem(&m_core.icount), 0);
+	UML_EXHc(block, COND_LE, *m_out_of_cycles, target);
+	UML_HASHJMP(block, compiler.mode, target, *m_nocode);
+}
+
+void dsp16_device_base::recompiler::generate_tick(drcuml_block &block, compiler_state &compiler, u32 cycles, bool last)
+{
+	// the serial clock divider usually has cycles to spare and the parallel strobes are usually idle
+	code_label const slow(compiler.labelnum++), done(compiler.labelnum++);
+	UML_SUB(block, mem(&m_core.icount), mem(&m_core.icount), cycles);
+	UML_LOAD(block, I6, &m_host.m_sio_clk_div, 0, SIZE_BYTE, SCALE_x1);
+	UML_CMP(block, I6, cycles);
+	UML_JMPc(block, COND_B, slow);
+	UML_LOAD(block, I7, &m_host.m_pio_pids_cnt, 0, SIZE_BYTE, SCALE_x1);
+	UML_LOAD(block, I8, &m_host.m_pio_pods_cnt, 0, SIZE_BYTE, SCALE_x1);
+	UML_OR(block, I7, I7, I8);
+	UML_CMP(block, I7, 0);
+	UML_JMPc(block, COND_NE, slow);
+	UML_SUB(block, I6, I6, cycles);
+	UML_STORE(block, &m_host.m_sio_clk_div, 0, I6, SIZE_BYTE, SCALE_x1);
+	UML_JMP(block, done);
+
+	UML_LABEL(block, slow);
+	UML_STORE(block, &m_host.m_st_pcbase, 0, compiler.pc, SIZE_WORD, SCALE_x2);
+	UML_MOV(block, mem(&m_arg), cycles);
+	UML_CALLC(block, &recompiler::cfunc_tick, this);
+	if (last && !compiler.check_int)
+		generate_interrupt_check(block, compiler, compiler.nextpc);
+
+	UML_LABEL(block, done);
+	if (last && compiler.check_int)
+		generate_interrupt_check(block, compiler, compiler.nextpc);
+}
+
+void dsp16_device_base::recompiler::generate_interrupt_check(drcuml_block &block, compiler_state &compiler, uml::parameter nextpc)
+{
+	// interrupts aren't taken while executing from cache
+	if (!compiler.in_loop)
+	{
+		UML_LOAD(block, I6, &m_host.m_drc_interrupt, 0, SIZE_BYTE, SCALE_x1);
+		UML_CMP(block, I6, 0);
+		UML_EXHc(block, COND_NE, *m_interpret, nextpc);
+	}
+}
+
+/***********************************************************************
+    opcode support checks
+***********************************************************************/
+
+bool dsp16_device_base::recompiler::op_supported(u32 mode, u16 op, bool in_loop)
+{
+	switch (op >> 11)
+	{
+	case 0x02: // R = M
+	case 0x03:
+		return true;
+
+	case 0x04: // F1 ; Y = a1[l]
+	case 0x05: // F1 ; Z : aT[l]
+	case 0x06: // F1 ; Y
+	case 0x07: // F1 ; aT[l] = Y
+	case 0x14: // F1 ; Y = y[l]
+	case 0x15: // F1 ; Z : y[l]
+	case 0x16: // F1 ; x = Y
+	case 0x17: // F1 ; y[l] = Y
+	case 0x1c: // F1 ; Y = a0[l]
+	case 0x1d: // F1 ; Z : y ; x = *pt++[i]
+	case 0x1f: // F1 ; y = Y ; x = *pt++[i]
+		return f1_supported(mode, op);
+
+	case 0x19: // F1 ; y = a0 ; x = *pt++[i]
+	case 0x1b: // F1 ; y = a1 ; x = *pt++[i]
+		return !(op & 0x000fU) && f1_supported(mode, op);
+
+	case 0x08: // aT = R
+		return !(op & 0x000fU) && r_supported(op, true, false, in_loop);
+
+	case 0x09: // R = a0
+	case 0x0b: // R = a1
+		return !(op & 0x040fU) && r_supported(op, false, true, in_loop);
+
+	case 0x0c: // Y = R
+		return !(op & 0x0400U) && r_supported(op, true, false, in_loop);
+
+	case 0x0d: // Z : R
+		return r_supported(op, true, true, in_loop);
+
+	case 0x0f: // R = Y
+		return !(op & 0x0400U) && r_supported(op, false, true, in_loop);
+
+	case 0x12: // ifc CON F2
+	case 0x13: // if CON F2
+		switch (op_f2(op))
+		{
+		case 0x8: // aD = p
+			return (0x3U != (mode & 0x3U)) && con_supported(op);
+		case 0xa: // Reserved
+			return false;
+		default:
+			return con_supported(op);
+		}
+
+	default:
+		return false;
+	}
+}
+
+bool dsp16_device_base::recompiler::con_supported(u16 op)
+{
+	switch (op_con(op) >> 1)
+	{
+	case 0x0: // mi/pl
+	case 0x1: // eq/ne
+	case 0x2: // lvs/lvc
+	case 0x3: // mvs/mvc
+	case 0x5: // c0ge/c0lt
+	case 0x6: // c1ge/c1lt
+	case 0x7: // true/false
+	case 0x8: // gt/le
+		return true;
+	default: // heads/tails, Reserved
+		return false;
+	}
+}
+
+bool dsp16_device_base::recompiler::f1_supported(u32 mode, u16 op)
+{
+	// the interpreter reports reserved ALIGN values when P is used
+	switch (op_f1(op))
+	{
+	case 0x0: // aD = p ; p = x*y
+	case 0x1: // aD = aS + p ; p = x*y
+	case 0x3: // aD = aS - p ; p = x*y
+	case 0x4: // aD = p
+	case 0x5: // aD = aS + p
+	case 0x7: // aD = aS - p
+		return 0x3U != (mode & 0x3U);
+	default:
+		return true;
+	}
+}
+
+bool dsp16_device_base::recompiler::r_supported(u16 op, bool read, bool write, bool in_loop)
+{
+	switch (op_r(op))
+	{
+	case 0x00: // r0 (u)
+	case 0x01: // r1 (u)
+	case 0x02: // r2 (u)
+	case 0x03: // r3 (u)
+	case 0x04: // j (s)
+	case 0x05: // k (s)
+	case 0x06: // rb (u)
+	case 0x07: // re (u)
+	case 0x08: // pt
+	case 0x09: // pr
+	case 0x0a: // pi
+	case 0x0b: // i (s)
+	case 0x10: // x
+	case 0x11: // y
+	case 0x12: // yl
+	case 0x14: // psw
+	case 0x15: // c0 (s)
+	case 0x16: // c1 (s)
+	case 0x17: // c2 (s)
+	case 0x18: // sioc
+	case 0x19: // srta
+	case 0x1a: // sdx
+	case 0x1b: // tdms
+	case 0x1d: // pdx0
+	case 0x1e: // pdx1
+		return true;
+	case 0x13: // auc (u)
+	case 0x1c: // pioc
+		return !write || !in_loop; // can't change mode or interrupt enables part way through a loop
+	default:
+		return false;
+	}
+}
+
+u32 dsp16_device_base::recompiler::op_cycles(u16 op, bool cached)
+{
+	switch (op >> 11)
+	{
+	case 0x02: // R = M
+	case 0x03:
+	case 0x06: // F1 ; Y
+	case 0x07: // F1 ; aT[l] = Y
+	case 0x12: // ifc CON F2
+	case 0x13: // if CON F2
+	case 0x16: // F1 ; x = Y
+	case 0x17: // F1 ; y[l] = Y
+		return 1U;
+	case 0x19: // F1 ; y = a0 ; x = *pt++[i]
+	case 0x1b: // F1 ; y = a1 ; x = *pt++[i]
+	case 0x1f: // F1 ; y = Y ; x = *pt++[i]
+		return cached ? 1U : 2U;
+	default:
+		return 2U;
+	}
+}
+
+/***********************************************************************
+    sub-operations
+***********************************************************************/
+
+void dsp16_device_base::recompiler::generate_get_r(drcuml_block &block, compiler_state &compiler, u16 op, u16 pcval)
+{
+	// result in low 16 bits of I5 - clobbers I1-I2
+	u16 const r(op_r(op));
+	switch (r)
+	{
+	case 0x00: // r0 (u)
+	case 0x01: // r1 (u)
+	case 0x02: // r2 (u)
+	case 0x03: // r3 (u)
+		UML_LOAD(block, I5, &m_core.yaau_r[r], 0, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x04: // j (s)
+		UML_LOAD(block, I5, &m_core.yaau_j, 0, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x05: // k (s)
+		UML_LOAD(block, I5, &m_core.yaau_k, 0, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x06: // rb (u)
+		UML_LOAD(block, I5, &m_core.yaau_rb, 0, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x07: // re (u)
+		UML_LOAD(block, I5, &m_core.yaau_re, 0, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x08: // pt
+		UML_LOAD(block, I5, &m_core.xaau_pt, 0, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x09: // pr
+		UML_LOAD(block, I5, &m_core.xaau_pr, 0, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x0a: // pi
+		if (compiler.mode & MODE_PI_TRACKS_PC)
+			UML_MOV(block, I5, pcval);
+		else
+			UML_LOAD(block, I5, &m_core.xaau_pi, 0, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x0b: // i (s)
+		UML_LOAD(block, I5, &m_core.xaau_i, 0, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x10: // x
+		UML_LOAD(block, I5, &m_core.dau_x, 0, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x11: // y
+		UML_MOV(block, I5, mem(&m_core.dau_y));
+		UML_SHR(block, I5, I5, 16);
+		break;
+	case 0x12: // yl
+		UML_MOV(block, I5, mem(&m_core.dau_y));
+		break;
+	case 0x13: // auc (u)
+		UML_MOV(block, I5, compiler.mode & MODE_AUC_MASK);
+		break;
+	case 0x14: // psw
+		// bring the accumulator guard bits up to date
+		UML_LOAD(block, I5, &m_core.dau_psw, 0, SIZE_WORD, SCALE_x2);
+		UML_AND(block, I5, I5, 0xfe10U);
+		UML_DLOAD(block, I1, &m_core.dau_a[0], 0, SIZE_QWORD, SCALE_x8);
+		UML_DSHR(block, I1, I1, 32);
+		UML_AND(block, I1, I1, 0x000fU);
+		UML_OR(block, I5, I5, I1);
+		UML_DLOAD(block, I1, &m_core.dau_a[1], 0, SIZE_QWORD, SCALE_x8);
+		UML_DSHR(block, I1, I1, 27);
+		UML_AND(block, I1, I1, 0x01e0U);
+		UML_OR(block, I5, I5, I1);
+		UML_STORE(block, &m_core.dau_psw, 0, I5, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x15: // c0 (s)
+	case 0x16: // c1 (s)
+	case 0x17: // c2 (s)
+		UML_LOADS(block, I5, &m_core.dau_c[r - 0x15], 0, SIZE_BYTE, SCALE_x1);
+		break;
+	default: // peripheral registers
+		UML_STORE(block, &m_host.m_st_pcbase, 0, compiler.pc, SIZE_WORD, SCALE_x2);
+		UML_MOV(block, mem(&m_arg), op);
+		UML_CALLC(block, &recompiler::cfunc_get_r, this);
+		UML_MOV(block, I5, mem(&m_value));
+		compiler.check_int = true;
+		break;
+	}
+}
+
+void dsp16_device_base::recompiler::generate_set_r(drcuml_block &block, compiler_state &compiler, u16 op)
+{
+	// value in low 16 bits of I5 - clobbers I1-I2
+	u16 const r(op_r(op));
+	u32 const yaau_shift(32 - m_host.m_yaau_bits);
+	switch (r)
+	{
+	case 0x00: // r0 (u)
+	case 0x01: // r1 (u)
+	case 0x02: // r2 (u)
+	case 0x03: // r3 (u)
+		UML_AND(block, I1, I5, m_core.yaau_mask);
+		UML_STORE(block, &m_core.yaau_r[r], 0, I1, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x04: // j (s)
+	case 0x05: // k (s)
+		UML_SHL(block, I1, I5, yaau_shift);
+		UML_SAR(block, I1, I1, yaau_shift);
+		UML_STORE(block, (0x04U == r) ? &m_core.yaau_j : &m_core.yaau_k, 0, I1, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x06: // rb (u)
+	case 0x07: // re (u)
+		UML_AND(block, I1, I5, m_core.yaau_mask);
+		UML_STORE(block, (0x06U == r) ? &m_core.yaau_rb : &m_core.yaau_re, 0, I1, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x08: // pt
+		UML_STORE(block, &m_core.xaau_pt, 0, I5, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x09: // pr
+		UML_STORE(block, &m_core.xaau_pr, 0, I5, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x0a: // pi
+		// FIXME: reset PRNG
+		if (!(compiler.mode & MODE_PI_TRACKS_PC))
+			UML_STORE(block, &m_core.xaau_pi, 0, I5, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x0b: // i (s)
+		UML_SHL(block, I1, I5, 20);
+		UML_SAR(block, I1, I1, 20);
+		UML_STORE(block, &m_core.xaau_i, 0, I1, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x10: // x
+		UML_STORE(block, &m_core.dau_x, 0, I5, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x11: // y
+		generate_set_y(block, compiler.mode, true, I5);
+		break;
+	case 0x12: // yl
+		generate_set_y(block, compiler.mode, false, I5);
+		break;
+	case 0x13: // auc (u)
+		UML_AND(block, I1, I5, 0x007fU);
+		UML_STORE(block, &m_core.dau_auc, 0, I1, SIZE_BYTE, SCALE_x1);
+		compiler.mode_changed = true;
+		break;
+	case 0x14: // psw
+		// guard bits go to the accumulators
+		UML_STORE(block, &m_core.dau_psw, 0, I5, SIZE_WORD, SCALE_x2);
+		UML_DLOAD(block, I1, &m_core.dau_a[0], 0, SIZE_QWORD, SCALE_x8);
+		UML_DAND(block, I1, I1, 0xffffffffU);
+		UML_DAND(block, I2, I5, 0x000fU);
+		UML_DSHL(block, I2, I2, 32);
+		UML_DOR(block, I1, I1, I2);
+		UML_DSHL(block, I1, I1, 28);
+		UML_DSAR(block, I1, I1, 28);
+		UML_DSTORE(block, &m_core.dau_a[0], 0, I1, SIZE_QWORD, SCALE_x8);
+		UML_DLOAD(block, I1, &m_core.dau_a[1], 0, SIZE_QWORD, SCALE_x8);
+		UML_DAND(block, I1, I1, 0xffffffffU);
+		UML_DAND(block, I2, I5, 0x01e0U);
+		UML_DSHL(block, I2, I2, 27);
+		UML_DOR(block, I1, I1, I2);
+		UML_DSHL(block, I1, I1, 28);
+		UML_DSAR(block, I1, I1, 28);
+		UML_DSTORE(block, &m_core.dau_a[1], 0, I1, SIZE_QWORD, SCALE_x8);
+		break;
+	case 0x15: // c0 (s)
+	case 0x16: // c1 (s)
+	case 0x17: // c2 (s)
+		UML_STORE(block, &m_core.dau_c[r - 0x15], 0, I5, SIZE_BYTE, SCALE_x1);
+		break;
+	default: // peripheral registers
+		UML_STORE(block, &m_host.m_st_pcbase, 0, compiler.pc, SIZE_WORD, SCALE_x2);
+		UML_MOV(block, mem(&m_arg), op);
+		UML_MOV(block, mem(&m_value), I5);
+		UML_CALLC(block, &recompiler::cfunc_set_r, this);
+		compiler.check_int = true;
+		if (0x1cU == r) // pioc - interpreter handles the delayed interrupt enable
+			compiler.exit_after = true;
+		break;
+	}
+}
+
+void dsp16_device_base::recompiler::generate_short_immediate(drcuml_block &block, u16 op)
+{
+	u16 const r((op >> 9) & 0x0007U);
+	u16 const m(op & 0x01ffU);
+	u16 const extended(m | ((m & m_core.yaau_sign) ? ~m_core.yaau_mask : 0));
+	switch (r)
+	{
+	case 0x0: // j
+		UML_STORE(block, &m_core.yaau_j, 0, extended, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x1: // k
+		UML_STORE(block, &m_core.yaau_k, 0, extended, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x2: // rb
+		UML_STORE(block, &m_core.yaau_rb, 0, m, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x3: // re
+		UML_STORE(block, &m_core.yaau_re, 0, m, SIZE_WORD, SCALE_x2);
+		break;
+	case 0x4: // r0
+	case 0x5: // r1
+	case 0x6: // r2
+	case 0x7: // r3
+		UML_STORE(block, &m_core.yaau_r[r & 0x0003U], 0, m, SIZE_WORD, SCALE_x2);
+		break;
+	}
+}
+
+void dsp16_device_base::recompiler::generate_con(drcuml_block &block, u16 op, bool inc, code_label skip)
+{
+	// jumps to skip if condition is false - clobbers I0-I1
+	u16 const con(op_con(op));
+	bool const invert(BIT(con, 0));
+	switch (con >> 1)
+	{
+	case 0x0: // mi/pl
+	case 0x1: // eq/ne
+	case 0x2: // lvs/lvc
+	case 0x3: // mvs/mvc
+		UML_LOAD(block, I0, &m_core.dau_psw, 0, SIZE_WORD, SCALE_x2);
+		UML_TEST(block, I0, u32(1) << (15 - (con >> 1)));
+		UML_JMPc(block, invert ? COND_NZ : COND_Z, skip);
+		break;
+	case 0x5: // c0ge/c0lt
+	case 0x6: // c1ge/c1lt
+		{
+			s8 &c(m_core.dau_c[(con >> 1) - 0x05]);
+			UML_LOADS(block, I0, &c, 0, SIZE_BYTE, SCALE_x1);
+			if (inc)
+			{
+				UML_ADD(block, I1, I0, 1);
+				UML_STORE(block, &c, 0, I1, SIZE_BYTE, SCALE_x1);
+			}
+			UML_CMP(block, I0, 0);
+			UML_JMPc(block, invert ? COND_GE : COND_L, skip);
+		}
+		break;
+	case 0x7: // true/false
+		if (invert)
+			UML_JMP(block, skip);
+		break;
+	case 0x8: // gt/le
+		UML_LOAD(block, I0, &m_core.dau_psw, 0, SIZE_WORD, SCALE_x2);
+		UML_TEST(block, I0, 0xc000U);
+		UML_JMPc(block, invert ? COND_Z : COND_NZ, skip);
+		break;
+	default:
+		throw emu_fatalerror("DSP16: recompiler given unsupported CON value %02X\n", con);
+	}
+}
+
+bool dsp16_device_base::recompiler::generate_f1(drcuml_block &block, u32 mode, u16 op, bool store)
+{
+	// result in I0 if not stored - clobbers I0-I4
+	s64 &s(m_core.dau_a[op_s(op)]);
+	bool const product(op_f1(op) < 0x4U);
+	bool flags(true), result(true);
+	switch (op_f1(op))
+	{
+	case 0x0: // aD = p ; p = x*y
+	case 0x4: // aD = p
+		generate_p_aligned(block, mode, I0);
+		break;
+	case 0x1: // aD = aS + p ; p = x*y
+	case 0x5: // aD = aS + p
+		generate_p_aligned(block, mode, I1);
+		UML_DLOAD(block, I0, &s, 0, SIZE_QWORD, SCALE_x8);
+		UML_DADD(block, I0, I0, I1);
+		break;
+	case 0x3: // aD = aS - p ; p = x*y
+	case 0x7: // aD = aS - p
+		generate_p_aligned(block, mode, I1);
+		UML_DLOAD(block, I0, &s, 0, SIZE_QWORD, SCALE_x8);
+		UML_DSUB(block, I0, I0, I1);
+		break;
+	case 0x2: // p = x*y
+	case 0x6: // NOP
+		flags = result = false;
+		break;
+	case 0xc: // aD = y
+		UML_DSEXT(block, I0, mem(&m_core.dau_y), SIZE_DWORD);
+		break;
+	default: // operations on aS and y
+		UML_DLOAD(block, I0, &s, 0, SIZE_QWORD, SCALE_x8);
+		UML_DSEXT(block, I1, mem(&m_core.dau_y), SIZE_DWORD);
+		switch (op_f1(op))
+		{
+		case 0x8: // aD = aS | y
+			UML_DOR(block, I0, I0, I1);
+			break;
+		case 0x9: // aD = aS ^ y
+			UML_DXOR(block, I0, I0, I1);
+			break;
+		case 0xa: // aS & y
+			result = false;
+			[[fallthrough]];
+		case 0xe: // aD = aS & y
+			UML_DAND(block, I0, I0, I1);
+			break;
+		case 0xb: // aS - y
+			result = false;
+			[[fallthrough]];
+		case 0xf: // aD = aS - y
+			UML_DSUB(block, I0, I0, I1);
+			break;
+		case 0xd: // aD = aS + y
+			UML_DADD(block, I0, I0, I1);
+			break;
+		}
+		break;
+	}
+	if (flags)
+		generate_dau_flags(block);
+	if (result && store)
+		UML_DSTORE(block, &m_core.dau_a[op_d(op)], 0, I0, SIZE_QWORD, SCALE_x8);
+
+	// p = x*y happens after the old p is used
+	if (product)
+	{
+		UML_LOADS(block, I1, &m_core.dau_x, 0, SIZE_WORD, SCALE_x2);
+		UML_MOV(block, I2, mem(&m_core.dau_y));
+		UML_SAR(block, I2, I2, 16);
+		UML_MULS(block, I1, I1, I1, I2);
+		UML_MOV(block, mem(&m_core.dau_p), I1);
+	}
+	return result;
+}
+
+void dsp16_device_base::recompiler::generate_f2(drcuml_block &block, u32 mode, u16 op)
+{
+	// clobbers I0-I4
+	u16 const s(op_s(op)), d(op_d(op));
+	switch (op_f2(op))
+	{
+	case 0x8: // aD = p
+		generate_p_aligned(block, mode, I0);
+		break;
+	case 0xc: // aD = y
+		UML_DSEXT(block, I0, mem(&m_core.dau_y), SIZE_DWORD);
+		break;
+	default:
+		UML_DLOAD(block, I1, &m_core.dau_a[s], 0, SIZE_QWORD, SCALE_x8);
+		switch (op_f2(op))
+		{
+		case 0x0: // aD = aS >> 1
+		case 0x2: // aD = aS >> 4
+		case 0x4: // aD = aS >> 8
+		case 0x6: // aD = aS >> 16
+			UML_DSAR(block, I0, I1, (0x0U == op_f2(op)) ? 1 : (2 << (op_f2(op) >> 1)));
+			break;
+		case 0x1: // aD = aS << 1
+		case 0x3: // aD = aS << 4
+		case 0x5: // aD = aS << 8
+		case 0x7: // aD = aS << 16
+			UML_SHL(block, I0, I1, (0x1U == op_f2(op)) ? 1 : (2 << (op_f2(op) >> 1)));
+			UML_DSEXT(block, I0, I0, SIZE_DWORD);
+			break;
+		case 0x9: // aDh = aSh + 1
+			UML_AND(block, I0, I1, 0xffff0000U);
+			UML_DSEXT(block, I0, I0, SIZE_DWORD);
+			UML_DADD(block, I0, I0, 0x00010000U);
+			if (BIT(mode, s + 4))
+			{
+				UML_DLOAD(block, I2, &m_core.dau_a[d], 0, SIZE_QWORD, SCALE_x8);
+				UML_DAND(block, I2, I2, 0xffffU);
+				UML_DOR(block, I0, I0, I2);
+			}
+			break;
+		case 0xb: // aD = rnd(aS)
+			// FIXME: behaviour is not clear (see interpreter)
+			UML_DSHR(block, I2, I1, 63);
+			UML_DADD(block, I0, I1, 0x8000U);
+			UML_DSUB(block, I0, I0, I2);
+			UML_DAND(block, I0, I0, ~u64(0xffffU));
+			break;
+		case 0xd: // aD = aS + 1
+			UML_DADD(block, I0, I1, 1);
+			break;
+		case 0xe: // aD = aS
+			UML_DMOV(block, I0, I1);
+			break;
+		case 0xf: // aD = -aS
+			UML_DSUB(block, I0, 0, I1);
+			break;
+		}
+		break;
+	}
+	generate_dau_flags(block);
+	UML_DSTORE(block, &m_core.dau_a[d], 0, I0, SIZE_QWORD, SCALE_x8);
+}
+
+void dsp16_device_base::recompiler::generate_dau_flags(drcuml_block &block)
+{
+	// I0 in, sign-extended from bit 35 to I0 out - clobbers I1-I3
+	UML_DSHL(block, I1, I0, 28);
+	UML_DSAR(block, I1, I1, 28);
+	UML_LOAD(block, I2, &m_core.dau_psw, 0, SIZE_WORD, SCALE_x2);
+	UML_AND(block, I2, I2, 0x0fffU);
+
+	// LMI - bit 35 set
+	UML_DSHR(block, I3, I1, 63);
+	UML_SHL(block, I3, I3, 15);
+	UML_OR(block, I2, I2, I3);
+
+	// LEQ - bits 35-0 clear
+	UML_DCMP(block, I1, 0);
+	UML_SETc(block, COND_E, I3);
+	UML_SHL(block, I3, I3, 14);
+	UML_OR(block, I2, I2, I3);
+
+	// LLV - bits above 35 don't match bit 35
+	UML_DSAR(block, I3, I0, 35);
+	UML_DADD(block, I3, I3, 1);
+	UML_DCMP(block, I3, 1);
+	UML_SETc(block, COND_A, I3);
+	UML_SHL(block, I3, I3, 13);
+	UML_OR(block, I2, I2, I3);
+
+	// LMV - bits 35-32 don't match bit 31
+	UML_DSHL(block, I3, I0, 28);
+	UML_DSAR(block, I3, I3, 59);
+	UML_DADD(block, I3, I3, 1);
+	UML_DCMP(block, I3, 1);
+	UML_SETc(block, COND_A, I3);
+	UML_SHL(block, I3, I3, 12);
+	UML_OR(block, I2, I2, I3);
+
+	UML_STORE(block, &m_core.dau_psw, 0, I2, SIZE_WORD, SCALE_x2);
+	UML_DMOV(block, I0, I1);
+}
+
+void dsp16_device_base::recompiler::generate_p_aligned(drcuml_block &block, u32 mode, uml::parameter dst)
+{
+	UML_DSEXT(block, dst, mem(&m_core.dau_p), SIZE_DWORD);
+	switch (mode & 0x3U)
+	{
+	case 0x0:
+		break;
+	case 0x1:
+		UML_DSAR(block, dst, dst, 2);
+		break;
+	case 0x2:
+		UML_DSHL(block, dst, dst, 2);
+		break;
+	default:
+		throw emu_fatalerror("DSP16: recompiler given reserved ALIGN value\n");
+	}
+}
+
+void dsp16_device_base::recompiler::generate_saturate(drcuml_block &block, u32 mode, unsigned a, uml::parameter dst)
+{
+	UML_DLOAD(block, dst, &m_core.dau_a[a], 0, SIZE_QWORD, SCALE_x8);
+	if (!BIT(mode, 2 + a))
+	{
+		UML_DCMP(block, dst, 0x7fffffffU);
+		UML_DMOVc(block, COND_G, dst, 0x7fffffffU);
+		UML_DCMP(block, dst, ~u64(0x7fffffffU));
+		UML_DMOVc(block, COND_L, dst, ~u64(0x7fffffffU));
+	}
+}
+
+void dsp16_device_base::recompiler::generate_set_y(drcuml_block &block, u32 mode, bool high, uml::parameter src)
+{
+	// clobbers I1-I2
+	if (high)
+	{
+		UML_SHL(block, I1, src, 16);
+		if (BIT(mode, 6))
+		{
+			UML_MOV(block, I2, mem(&m_core.dau_y));
+			UML_AND(block, I2, I2, 0x0000ffffU);
+			UML_OR(block, I1, I1, I2);
+		}
+	}
+	else
+	{
+		UML_MOV(block, I1, mem(&m_core.dau_y));
+		UML_AND(block, I1, I1, 0xffff0000U);
+		UML_AND(block, I2, src, 0x0000ffffU);
+		UML_OR(block, I1, I1, I2);
+	}
+	UML_MOV(block, mem(&m_core.dau_y), I1);
+}
+
+void dsp16_device_base::recompiler::generate_set_at(drcuml_block &block, u16 op, bool high, uml::parameter src)
+{
+	// clobbers I1-I3
+	unsigned const t(op_d(~op));
+	if (high)
+	{
+		UML_SHL(block, I1, src, 16);
+		UML_LOAD(block, I2, &m_core.dau_psw, 0, SIZE_WORD, SCALE_x2);
+		UML_DLOAD(block, I3, &m_core.dau_a[t], 0, SIZE_QWORD, SCALE_x8);
+		UML_AND(block, I3, I3, 0x0000ffffU);
+		UML_TEST(block, I2, u32(1) << (4 + t));
+		UML_MOVc(block, COND_Z, I3, 0);
+		UML_OR(block, I1, I1, I3);
+		UML_DSEXT(block, I1, I1, SIZE_DWORD);
+	}
+	else
+	{
+		UML_DLOAD(block, I1, &m_core.dau_a[t], 0, SIZE_QWORD, SCALE_x8);
+		UML_DAND(block, I1, I1, ~u64(0xffffU));
+		UML_DAND(block, I2, src, 0xffffU);
+		UML_DOR(block, I1, I1, I2);
+	}
+	UML_DSTORE(block, &m_core.dau_a[t], 0, I1, SIZE_QWORD, SCALE_x8);
+}
+
+void dsp16_device_base::recompiler::generate_rom_read(drcuml_block &block, u16 op)
+{
+	// x = *pt++[i] - clobbers I6-I8
+	UML_LOAD(block, I6, &m_core.xaau_pt, 0, SIZE_WORD, SCALE_x2);
+	UML_READ(block, I7, I6, SIZE_WORD, SPACE_PROGRAM);
+	UML_STORE(block, &m_core.dau_x, 0, I7, SIZE_WORD, SCALE_x2);
+	if (op_x(op))
+	{
+		UML_LOADS(block, I8, &m_core.xaau_i, 0, SIZE_WORD, SCALE_x2);
+		UML_ADD(block, I7, I6, I8);
+	}
+	else
+	{
+		UML_ADD(block, I7, I6, 1);
+	}
+	UML_ROLINS(block, I6, I7, 0, 0x0fffU);
+	UML_STORE(block, &m_core.xaau_pt, 0, I6, SIZE_WORD, SCALE_x2);
+}
+
+void dsp16_device_base::recompiler::generate_yaau_read(drcuml_block &block, compiler_state &compiler, u16 op, uml::parameter dst)
+{
+	// internal RAM is accessed directly when the debugger is disabled - clobbers I6-I8
+	UML_LOAD(block, I6, &m_core.yaau_r[(op >> 2) & 0x0003U], 0, SIZE_WORD, SCALE_x2);
+	UML_AND(block, I7, I6, m_host.m_workram_mask);
+	UML_LOAD(block, dst, m_host.m_workram.target(), I7, SIZE_WORD, SCALE_x2);
+	generate_postmodify_r(block, compiler, op, false);
+}
+
+void dsp16_device_base::recompiler::generate_yaau_write(drcuml_block &block, compiler_state &compiler, u16 op, uml::parameter src)
+{
+	// clobbers I6-I8
+	UML_LOAD(block, I6, &m_core.yaau_r[(op >> 2) & 0x0003U], 0, SIZE_WORD, SCALE_x2);
+	UML_AND(block, I7, I6, m_host.m_workram_mask);
+	UML_STORE(block, m_host.m_workram.target(), I7, src, SIZE_WORD, SCALE_x2);
+	generate_postmodify_r(block, compiler, op, false);
+}
+
+void dsp16_device_base::recompiler::generate_yaau_write_z(drcuml_block &block, compiler_state &compiler, u16 op)
+{
+	// clobbers I6-I8
+	UML_LOAD(block, I6, &m_core.yaau_r[(op >> 2) & 0x0003U], 0, SIZE_WORD, SCALE_x2);
+	UML_AND(block, I7, I6, m_host.m_workram_mask);
+	UML_LOAD(block, I8, &m_core.dau_temp, 0, SIZE_WORD, SCALE_x2);
+	UML_STORE(block, m_host.m_workram.target(), I7, I8, SIZE_WORD, SCALE_x2);
+	generate_postmodify_r(block, compiler, op, true);
+}
+
+void dsp16_device_base::recompiler::generate_postmodify_r(drcuml_block &block, compiler_state &compiler, u16 op, bool z)
+{
+	// expects rN in I6 - clobbers I6-I8
+	u16 &r(m_core.yaau_r[(op >> 2) & 0x0003U]);
+	switch ((op & 0x0003U) ^ (z ? 0x0001U : 0x0000U))
+	{
+	case 0x0: // *rN, *rNpz
+		return;
+	case 0x1: // *rN++, *rNzp
+		{
+			code_label const nowrap(compiler.labelnum++);
+			UML_LOAD(block, I7, &m_core.yaau_re, 0, SIZE_WORD, SCALE_x2);
+			UML_ADD(block, I8, I6, 1);
+			UML_CMP(block, I6, I7);
+			UML_JMPc(block, COND_NE, nowrap);
+			UML_CMP(block, I7, 0);
+			UML_JMPc(block, COND_E, nowrap);
+			UML_LOAD(block, I8, &m_core.yaau_rb, 0, SIZE_WORD, SCALE_x2);
+			UML_LABEL(block, nowrap);
+			UML_AND(block, I6, I8, m_core.yaau_mask);
+		}
+		break;
+	case 0x2: // *rN--, *rNm2
+		if (z)
+			UML_ADD(block, I6, I6, 2);
+		else
+			UML_SUB(block, I6, I6, 1);
+		UML_AND(block, I6, I6, m_core.yaau_mask);
+		break;
+	case 0x3: // *rN++j, *rNjk
+		UML_LOAD(block, I7, z ? &m_core.yaau_k : &m_core.yaau_j, 0, SIZE_WORD, SCALE_x2);
+		UML_ADD(block, I6, I6, I7);
+		UML_AND(block, I6, I6, m_core.yaau_mask);
+		break;
+	}
+	UML_STORE(block, &r, 0, I6, SIZE_WORD, SCALE_x2);
+}
+
+/***********************************************************************
+    C callbacks
+***********************************************************************/
+
+void dsp16_device_base::recompiler::cfunc_tick(void *param)
+{
+	recompiler &rc(*reinterpret_cast<recompiler *>(param));
+	rc.m_host.drc_tick(rc.m_arg);
+}
+
+void dsp16_device_base::recompiler::cfunc_get_r(void *param)
+{
+	recompiler &rc(*reinterpret_cast<recompiler *>(param));
+	rc.m_value = u16(rc.m_host.drc_get_r(u16(rc.m_arg)));
+}
+
+void dsp16_device_base::recompiler::cfunc_set_r(void *param)
+{
+	recompiler &rc(*reinterpret_cast<recompiler *>(param));
+	rc.m_host.drc_set_r(u16(rc.m_arg), s16(u16(rc.m_value)));
+}
+
+void dsp16_device_base::recompiler::cfunc_suspend_loop(void *param)
+{
+	recompiler &rc(*reinterpret_cast<recompiler *>(param));
+	rc.m_host.drc_suspend_loop(u16(rc.m_loop_pc), u8(rc.m_loop_remaining));
+}
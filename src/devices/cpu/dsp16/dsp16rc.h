@@ -23,6 +23,10 @@ public:
 	recompiler(dsp16_device_base &host, u32 flags);
 	~recompiler();
 
+	// execution
+	void flush() { m_cache_dirty = true; }
+	bool execute();
+
 private:
 	// compilation boundaries
 	enum : u32
@@ -39,14 +43,106 @@ private:
 		EXEC_OUT_OF_CYCLES,
 		EXEC_MISSING_CODE,
 		EXEC_UNMAPPED_CODE,
-		EXEC_RESET_CACHE
+		EXEC_RESET_CACHE,
+		EXEC_INTERPRET
+	};
+
+	// mode bits - AUC plus whether PI follows PC
+	enum : u32
+	{
+		MODE_AUC_MASK = 0x7fU,
+		MODE_PI_TRACKS_PC = 0x80U,
+		MODE_COUNT = 0x100U
 	};
 
+	// per-block compilation state
+	struct compiler_state
+	{
+		u32             mode = 0U;              // AUC and IACK assumed by the block
+		uml::code_label labelnum = 1;           // next label to allocate
+		u16             pc = 0U;                // address of the current instruction
+		u16             nextpc = 0U;            // address of the following instruction
+		bool            in_loop = false;        // no interrupt checks in a do K loop
+		bool            check_int = false;      // a callout may have raised an interrupt
+		bool            mode_changed = false;   // AUC was written
+		bool            exit_after = false;     // PIOC was written
+	};
+
+	// ROM or cache timing for an instruction in a do K loop
+	enum class loop_pass { NONE, LOAD, EXECUTE, LAST };
+
+	// static code generation
+	void flush_cache();
+	void generate_entry_point();
+	void generate_nocode_handler();
+	void generate_out_of_cycles();
+	void generate_interpret_handler();
+	void generate_dispatch_handler();
+	void generate_mode(drcuml_block &block, uml::parameter dst);
+
+	// compilation
+	void compile_block(u32 mode, u16 pc);
+	void generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, opcode_desc const &desc);
+	bool generate_opcode(drcuml_block &block, compiler_state &compiler, opcode_desc const &desc);
+	bool generate_op(drcuml_block &block, compiler_state &compiler, u16 op, u16 pcval, loop_pass pass);
+	bool generate_branch(drcuml_block &block, compiler_state &compiler, opcode_desc const &desc, u16 op);
+	bool generate_do(drcuml_block &block, compiler_state &compiler, opcode_desc const &desc, u16 op);
+	void generate_jump(drcuml_block &block, compiler_state &compiler, uml::parameter target);
+	void generate_tick(drcuml_block &block, compiler_state &compiler, u32 cycles, bool last);
+	void generate_interrupt_check(drcuml_block &block, compiler_state &compiler, uml::parameter nextpc);
+
+	// opcode support checks
+	static bool op_supported(u32 mode, u16 op, bool in_loop);
+	static bool con_supported(u16 op);
+	static bool f1_supported(u32 mode, u16 op);
+	static bool r_supported(u16 op, bool read, bool write, bool in_loop);
+	static bool r_peripheral(u16 op) { return 0x18U <= op_r(op); }
+	static u32 op_cycles(u16 op, bool cached);
+
+	// sub-operations
+	void generate_get_r(drcuml_block &block, compiler_state &compiler, u16 op, u16 pcval);
+	void generate_set_r(drcuml_block &block, compiler_state &compiler, u16 op);
+	void generate_short_immediate(drcuml_block &block, u16 op);
+	void generate_con(drcuml_block &block, u16 op, bool inc, uml::code_label skip);
+	bool generate_f1(drcuml_block &block, u32 mode, u16 op, bool store);
+	void generate_f2(drcuml_block &block, u32 mode, u16 op);
+	void generate_dau_flags(drcuml_block &block);
+	void generate_p_aligned(drcuml_block &block, u32 mode, uml::parameter dst);
+	void generate_saturate(drcuml_block &block, u32 mode, unsigned a, uml::parameter dst);
+	void generate_set_y(drcuml_block &block, u32 mode, bool high, uml::parameter src);
+	void generate_set_at(drcuml_block &block, u16 op, bool high, uml::parameter src);
+	void generate_rom_read(drcuml_block &block, u16 op);
+	void generate_yaau_read(drcuml_block &block, compiler_state &compiler, u16 op, uml::parameter dst);
+	void generate_yaau_write(drcuml_block &block, compiler_state &compiler, u16 op, uml::parameter src);
+	void generate_yaau_write_z(drcuml_block &block, compiler_state &compiler, u16 op);
+	void generate_postmodify_r(drcuml_block &block, compiler_state &compiler, u16 op, bool z);
+
+	// C callbacks
+	static void cfunc_tick(void *param);
+	static void cfunc_get_r(void *param);
+	static void cfunc_set_r(void *param);
+	static void cfunc_suspend_loop(void *param);
+
 	// host CPU device, frontend to describe instructions, and UML engine
 	dsp16_device_base   &m_host;
 	core_state          &m_core;
 	frontend            m_frontend;
 	drcuml_state        m_uml;
+
+	// static code handles
+	uml::code_handle    *m_entry = nullptr;
+	uml::code_handle    *m_nocode = nullptr;
+	uml::code_handle    *m_out_of_cycles = nullptr;
+	uml::code_handle    *m_interpret = nullptr;
+	uml::code_handle    *m_dispatch = nullptr;
+
+	// callout arguments and do K loop state
+	u32                 m_arg = 0U;
+	u32                 m_value = 0U;
+	u32                 m_loop_pc = 0U;
+	u32                 m_loop_remaining = 0U;
+
+	bool                m_cache_dirty = true;
 };
 
 #endif // MAME_CPU_DSP16_DSP16RC_H
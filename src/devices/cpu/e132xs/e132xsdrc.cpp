@@ -9,6 +9,10 @@
 #define DRC_PC uml::mem(m_core->global_regs)
 #define DRC_SR uml::mem(&m_core->global_regs[1])
 
+// the frame pointer is cached for the whole sequence and must be reloaded
+// by anything that rewrites the FP field of SR without leaving the block
+#define DRC_FP uml::I8
+
 void hyperstone_device::execute_run_drc()
 {
 	int execute_result;
@@ -274,6 +278,7 @@ void hyperstone_device::code_compile_block(offs_t pc)
 
 				UML_MOV(block, I7, 0);
 				UML_CALLH(block, *m_interrupt_checks);
+				UML_ROLAND(block, DRC_FP, DRC_SR, 7, 0x7f);
 
 				/* iterate over instructions in the sequence and compile them */
 				for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
@@ -910,6 +915,7 @@ void hyperstone_device::generate_sequence_instruction(drcuml_block &block, compi
 	{
 		//save_fast_iregs(block);
 		UML_DEBUG(block, desc->pc);
+		UML_ROLAND(block, DRC_FP, DRC_SR, 7, 0x7f);
 	}
 
 	if (!(desc->flags & OPFLAG_VIRTUAL_NOOP))
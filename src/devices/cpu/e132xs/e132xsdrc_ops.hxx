@@ -295,7 +295,7 @@ void hyperstone_device::generate_software(drcuml_block &block, compiler_state &c
 
 	generate_check_delay_pc(block, compiler, desc);
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f); // I3 = FP
+	UML_MOV(block, I3, DRC_FP); // I3 = FP
 
 	UML_ADD(block, I2, I3, src_code);
 	UML_AND(block, I4, I2, 0x3f);
@@ -373,7 +373,7 @@ void hyperstone_device::generate_chk(drcuml_block &block, compiler_state &compil
 	generate_check_delay_pc(block, compiler, desc);
 
 	if (!DST_GLOBAL || !SRC_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	const uint32_t src_code = op & 0xf;
 	const uint32_t dst_code = (op & 0xf0) >> 4;
@@ -448,7 +448,7 @@ void hyperstone_device::generate_movd(drcuml_block &block, compiler_state &compi
 		}
 		else
 		{
-			UML_ROLAND(block, I5, DRC_SR, 7, 0x7f);
+			UML_MOV(block, I5, DRC_FP);
 			UML_ADD(block, I3, I5, src_code);
 			UML_AND(block, I4, I3, 0x3f);
 			UML_LOAD(block, I2, (void *)m_core->local_regs, I4, SIZE_DWORD, SCALE_x4);
@@ -462,6 +462,7 @@ void hyperstone_device::generate_movd(drcuml_block &block, compiler_state &compi
 
 		UML_AND(block, DRC_SR, I3, 0xffe3ffff);
 		UML_ROLINS(block, DRC_SR, I2, S_SHIFT, S_MASK);
+		UML_ROLAND(block, DRC_FP, DRC_SR, 7, 0x7f);
 
 		UML_TEST(block, mem(&m_core->intblock), ~0);
 		UML_MOVc(block, uml::COND_Z, mem(&m_core->intblock), 1);
@@ -488,7 +489,7 @@ void hyperstone_device::generate_movd(drcuml_block &block, compiler_state &compi
 		UML_LABEL(block, no_exception);
 		UML_MOV(block, I0, mem(&SP));
 		UML_ROLAND(block, I1, I0, 30, 0x7f);
-		UML_ROLAND(block, I2, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I2, DRC_FP);
 		UML_SUB(block, I3, I2, I1);
 		UML_CMP(block, I3, -64);
 		UML_JMPc(block, uml::COND_L, done_ret = compiler.m_labelnum++);
@@ -532,7 +533,7 @@ void hyperstone_device::generate_movd(drcuml_block &block, compiler_state &compi
 		}
 		else
 		{
-			UML_ROLAND(block, I0, DRC_SR, 7, 0x7f);
+			UML_MOV(block, I0, DRC_FP);
 			UML_ADD(block, I0, I0, dst_code);
 			UML_AND(block, I0, I0, 0x3f);
 			UML_STORE(block, (void *)m_core->local_regs, I0, 0, SIZE_DWORD, SCALE_x4);
@@ -545,7 +546,7 @@ void hyperstone_device::generate_movd(drcuml_block &block, compiler_state &compi
 	{
 		if (!SRC_GLOBAL || !DST_GLOBAL)
 		{
-			UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+			UML_MOV(block, I3, DRC_FP);
 		}
 
 		if (SRC_GLOBAL)
@@ -616,7 +617,7 @@ void hyperstone_device::generate_divsu(drcuml_block &block, compiler_state &comp
 	}
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 		UML_LOAD(block, I0, (void *)m_core->global_regs, src_code, SIZE_DWORD, SCALE_x4);
@@ -724,7 +725,7 @@ void hyperstone_device::generate_xm(drcuml_block &block, compiler_state &compile
 	generate_check_delay_pc(block, compiler, desc);
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -798,7 +799,7 @@ void hyperstone_device::generate_mask(drcuml_block &block, compiler_state &compi
 	generate_check_delay_pc(block, compiler, desc);
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -858,7 +859,7 @@ void hyperstone_device::generate_sum(drcuml_block &block, compiler_state &compil
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
 	{
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 	}
 
 	if (SRC_GLOBAL)
@@ -940,7 +941,7 @@ void hyperstone_device::generate_cmp(drcuml_block &block, compiler_state &compil
 	generate_check_delay_pc(block, compiler, desc);
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I2, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I2, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -1052,11 +1053,11 @@ void hyperstone_device::generate_mov(drcuml_block &block, compiler_state &compil
 	{
 		generate_get_global_register(block, compiler, desc);
 		if (!DST_GLOBAL)
-			UML_ROLAND(block, I1, DRC_SR, 7, 0x7f);
+			UML_MOV(block, I1, DRC_FP);
 	}
 	else
 	{
-		UML_ROLAND(block, I1, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I1, DRC_FP);
 		UML_ADD(block, I2, I1, src_code);
 		UML_AND(block, I2, I2, 0x3f);
 		UML_LOAD(block, I5, (void *)m_core->local_regs, I2, SIZE_DWORD, SCALE_x4);
@@ -1105,7 +1106,7 @@ void hyperstone_device::generate_add(drcuml_block &block, compiler_state &compil
 	generate_check_delay_pc(block, compiler, desc);
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -1194,7 +1195,7 @@ void hyperstone_device::generate_cmpb(drcuml_block &block, compiler_state &compi
 	generate_check_delay_pc(block, compiler, desc);
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I2, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I2, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -1236,7 +1237,7 @@ void hyperstone_device::generate_subc(drcuml_block &block, compiler_state &compi
 	generate_check_delay_pc(block, compiler, desc);
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	UML_AND(block, I0, DRC_SR, C_MASK);
 #ifndef PTR64
@@ -1334,7 +1335,7 @@ void hyperstone_device::generate_sub(drcuml_block &block, compiler_state &compil
 	generate_check_delay_pc(block, compiler, desc);
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -1426,7 +1427,7 @@ void hyperstone_device::generate_subs(drcuml_block &block, compiler_state &compi
 	generate_check_delay_pc(block, compiler, desc);
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -1515,7 +1516,7 @@ void hyperstone_device::generate_addc(drcuml_block &block, compiler_state &compi
 	generate_check_delay_pc(block, compiler, desc);
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -1615,7 +1616,7 @@ void hyperstone_device::generate_neg(drcuml_block &block, compiler_state &compil
 	const uint32_t src_code = op & 0xf;
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -1690,7 +1691,7 @@ void hyperstone_device::generate_and(drcuml_block &block, compiler_state &compil
 	const uint32_t src_code = op & 0xf;
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -1753,7 +1754,7 @@ void hyperstone_device::generate_andn(drcuml_block &block, compiler_state &compi
 	const uint32_t src_code = op & 0xf;
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -1817,7 +1818,7 @@ void hyperstone_device::generate_or(drcuml_block &block, compiler_state &compile
 	const uint32_t src_code = op & 0xf;
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -1880,7 +1881,7 @@ void hyperstone_device::generate_xor(drcuml_block &block, compiler_state &compil
 	const uint32_t src_code = op & 0xf;
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -1943,7 +1944,7 @@ void hyperstone_device::generate_not(drcuml_block &block, compiler_state &compil
 	const uint32_t src_code = op & 0xf;
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 		UML_LOAD(block, I0, (void *)m_core->global_regs, src_code, SIZE_DWORD, SCALE_x4);
@@ -2007,7 +2008,7 @@ void hyperstone_device::generate_cmpi(drcuml_block &block, compiler_state &compi
 	}
 	else
 	{
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 		UML_ADD(block, I2, I3, dst_code);
 		UML_AND(block, I4, I2, 0x3f);
 		UML_LOAD(block, I2, (void *)m_core->local_regs, I4, SIZE_DWORD, SCALE_x4);
@@ -2109,7 +2110,7 @@ void hyperstone_device::generate_movi(drcuml_block &block, compiler_state &compi
 	else
 	{
 		UML_AND(block, DRC_SR, DRC_SR, ~H_MASK);
-		UML_ROLAND(block, I2, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I2, DRC_FP);
 		UML_ADD(block, I0, I2, dst_code);
 		UML_AND(block, I0, I0, 0x3f);
 		UML_STORE(block, (void *)m_core->local_regs, I0, I1, SIZE_DWORD, SCALE_x4);
@@ -2143,7 +2144,7 @@ void hyperstone_device::generate_addi(drcuml_block &block, compiler_state &compi
 	}
 	else
 	{
-		UML_ROLAND(block, I2, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I2, DRC_FP);
 		UML_ADD(block, I2, I2, dst_code);
 		UML_AND(block, I2, I2, 0x3f);
 		UML_LOAD(block, I0, (void *)m_core->local_regs, I2, SIZE_DWORD, SCALE_x4);
@@ -2230,7 +2231,7 @@ void hyperstone_device::generate_cmpbi(drcuml_block &block, compiler_state &comp
 	}
 	else
 	{
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 		UML_ADD(block, I4, I3, dst_code);
 		UML_AND(block, I5, I4, 0x3f);
 		UML_LOAD(block, I2, (void *)m_core->local_regs, I5, SIZE_DWORD, SCALE_x4);
@@ -2317,7 +2318,7 @@ void hyperstone_device::generate_andni(drcuml_block &block, compiler_state &comp
 	}
 	else
 	{
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 		UML_ADD(block, I2, I3, dst_code);
 		UML_AND(block, I4, I2, 0x3f);
 		UML_LOAD(block, I2, (void *)m_core->local_regs, I4, SIZE_DWORD, SCALE_x4);
@@ -2381,7 +2382,7 @@ void hyperstone_device::generate_ori(drcuml_block &block, compiler_state &compil
 	}
 	else
 	{
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 		UML_ADD(block, I2, I3, dst_code);
 		UML_AND(block, I4, I2, 0x3f);
 		UML_LOAD(block, I2, (void *)m_core->local_regs, I4, SIZE_DWORD, SCALE_x4);
@@ -2444,7 +2445,7 @@ void hyperstone_device::generate_xori(drcuml_block &block, compiler_state &compi
 	}
 	else
 	{
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 		UML_ADD(block, I2, I3, dst_code);
 		UML_AND(block, I4, I2, 0x3f);
 		UML_LOAD(block, I2, (void *)m_core->local_regs, I4, SIZE_DWORD, SCALE_x4);
@@ -2493,7 +2494,7 @@ void hyperstone_device::generate_shrdi(drcuml_block &block, compiler_state &comp
 
 	generate_check_delay_pc(block, compiler, desc);
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 
 	UML_ADD(block, I2, I3, dst_code);
 	UML_AND(block, I1, I2, 0x3f);
@@ -2553,7 +2554,7 @@ void hyperstone_device::generate_shrd(drcuml_block &block, compiler_state &compi
 		return;
 	}
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 
 	UML_ADD(block, I2, I3, dst_code);
 	UML_AND(block, I4, I2, 0x3f);
@@ -2609,7 +2610,7 @@ void hyperstone_device::generate_shr(drcuml_block &block, compiler_state &compil
 
 	generate_check_delay_pc(block, compiler, desc);
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 
 	UML_ADD(block, I2, I3, dst_code);
 	UML_AND(block, I4, I2, 0x3f);
@@ -2663,7 +2664,7 @@ void hyperstone_device::generate_shri(drcuml_block &block, compiler_state &compi
 	}
 	else
 	{
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 		UML_ADD(block, I2, I3, dst_code);
 		UML_AND(block, I6, I2, 0x3f);
 		UML_LOAD(block, I4, (void *)m_core->local_regs, I6, SIZE_DWORD, SCALE_x4);
@@ -2713,7 +2714,7 @@ void hyperstone_device::generate_sardi(drcuml_block &block, compiler_state &comp
 
 	generate_check_delay_pc(block, compiler, desc);
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 
 	UML_ADD(block, I2, I3, dst_code);
 	UML_AND(block, I4, I2, 0x3f);
@@ -2773,7 +2774,7 @@ void hyperstone_device::generate_sard(drcuml_block &block, compiler_state &compi
 		return;
 	}
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 
 	UML_ADD(block, I2, I3, dst_code);
 	UML_AND(block, I4, I2, 0x3f);
@@ -2829,7 +2830,7 @@ void hyperstone_device::generate_sar(drcuml_block &block, compiler_state &compil
 
 	generate_check_delay_pc(block, compiler, desc);
 
-	UML_ROLAND(block, I1, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I1, DRC_FP);
 	UML_ADD(block, I2, I1, dst_code);
 	UML_AND(block, I2, I2, 0x3f);
 	UML_LOAD(block, I0, (void *)m_core->local_regs, I2, SIZE_DWORD, SCALE_x4);
@@ -2876,7 +2877,7 @@ void hyperstone_device::generate_sari(drcuml_block &block, compiler_state &compi
 	}
 	else
 	{
-		UML_ROLAND(block, I1, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I1, DRC_FP);
 		UML_ADD(block, I1, I1, dst_code);
 		UML_AND(block, I1, I1, 0x3f);
 		UML_LOAD(block, I0, (void *)m_core->local_regs, I1, SIZE_DWORD, SCALE_x4);
@@ -2931,7 +2932,7 @@ void hyperstone_device::generate_shldi(drcuml_block &block, compiler_state &comp
 
 	generate_check_delay_pc(block, compiler, desc);
 
-	UML_ROLAND(block, I4, DRC_SR, 7, 0x7f); // I4: FP
+	UML_MOV(block, I4, DRC_FP); // I4: FP
 
 	UML_ADD(block, I2, I4, dst_code);
 	UML_AND(block, I2, I2, 0x3f); // I2: dst_code
@@ -3005,7 +3006,7 @@ void hyperstone_device::generate_shld(drcuml_block &block, compiler_state &compi
 		return;
 	}
 
-	UML_ROLAND(block, I4, DRC_SR, 7, 0x7f); // I4: FP
+	UML_MOV(block, I4, DRC_FP); // I4: FP
 
 	UML_ADD(block, I2, I4, dst_code);
 	UML_AND(block, I2, I2, 0x3f); // I2: dst_code
@@ -3076,7 +3077,7 @@ void hyperstone_device::generate_shl(drcuml_block &block, compiler_state &compil
 
 	generate_check_delay_pc(block, compiler, desc);
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 
 	UML_ADD(block, I2, I3, dst_code);
 	UML_AND(block, I4, I2, 0x3f);
@@ -3144,7 +3145,7 @@ void hyperstone_device::generate_shli(drcuml_block &block, compiler_state &compi
 	}
 	else
 	{
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 		UML_ADD(block, I2, I3, dst_code);
 		UML_AND(block, I6, I2, 0x3f);
 		UML_LOAD(block, I4, (void *)m_core->local_regs, I6, SIZE_DWORD, SCALE_x4);
@@ -3220,7 +3221,7 @@ void hyperstone_device::generate_testlz(drcuml_block &block, compiler_state &com
 
 	generate_check_delay_pc(block, compiler, desc);
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 	UML_ADD(block, I2, I3, src_code);
 	UML_AND(block, I1, I2, 0x3f);
 	UML_LOAD(block, I0, (void *)m_core->local_regs, I1, SIZE_DWORD, SCALE_x4);
@@ -3244,7 +3245,7 @@ void hyperstone_device::generate_rol(drcuml_block &block, compiler_state &compil
 
 	generate_check_delay_pc(block, compiler, desc);
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 
 	UML_ADD(block, I2, I3, dst_code);
 	UML_AND(block, I4, I2, 0x3f);
@@ -3327,7 +3328,7 @@ void hyperstone_device::generate_ldxx1(drcuml_block &block, compiler_state &comp
 	const uint32_t dst_code = (op & 0xf0) >> 4;
 
 	if (!DST_GLOBAL || !SRC_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (DST_GLOBAL)
 	{
@@ -3591,7 +3592,7 @@ void hyperstone_device::generate_ldxx2(drcuml_block &block, compiler_state &comp
 	}
 
 	if (!DST_GLOBAL || !SRC_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (DST_GLOBAL)
 	{
@@ -3850,7 +3851,7 @@ void hyperstone_device::generate_stxx1(drcuml_block &block, compiler_state &comp
 	const uint32_t src_code = op & 0xf;
 	const uint32_t dst_code = (op & 0xf0) >> 4;
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 
 	if (DST_GLOBAL)
 	{
@@ -4013,7 +4014,7 @@ void hyperstone_device::generate_stxx2(drcuml_block &block, compiler_state &comp
 	}
 
 	if (!DST_GLOBAL || !SRC_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (DST_GLOBAL)
 	{
@@ -4162,7 +4163,7 @@ void hyperstone_device::generate_mulsu(drcuml_block &block, compiler_state &comp
 	}
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 		UML_LOAD(block, I0, (void *)m_core->global_regs, src_code, SIZE_DWORD, SCALE_x4);
@@ -4252,7 +4253,7 @@ void hyperstone_device::generate_mul(drcuml_block &block, compiler_state &compil
 	}
 
 	if (!SRC_GLOBAL || !DST_GLOBAL)
-		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 		UML_LOAD(block, I0, (void *)m_core->global_regs, src_code, SIZE_DWORD, SCALE_x4);
@@ -4382,7 +4383,7 @@ void hyperstone_device::generate_set(drcuml_block &block, compiler_state &compil
 	}
 	else
 	{
-		UML_ROLAND(block, I1, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I1, DRC_FP);
 		UML_ADD(block, I2, I1, dst_code);
 		UML_AND(block, I3, I2, 0x3f);
 		UML_STORE(block, (void *)m_core->local_regs, I3, I0, SIZE_DWORD, SCALE_x4);
@@ -4402,7 +4403,7 @@ void hyperstone_device::generate_ldwr(drcuml_block &block, compiler_state &compi
 	const uint32_t src_code = op & 0xf;
 	const uint32_t dst_code = (op & 0xf0) >> 4;
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 	UML_ADD(block, I2, I3, dst_code);
 	UML_AND(block, I4, I2, 0x3f);
 	UML_LOAD(block, I0, (void *)m_core->local_regs, I4, SIZE_DWORD, SCALE_x4);
@@ -4447,7 +4448,7 @@ void hyperstone_device::generate_lddr(drcuml_block &block, compiler_state &compi
 	const uint32_t src_code = op & 0xf;
 	const uint32_t dst_code = (op & 0xf0) >> 4;
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 	UML_ADD(block, I2, I3, dst_code);
 	UML_AND(block, I1, I2, 0x3f);
 	UML_LOAD(block, I0, (void *)m_core->local_regs, I1, SIZE_DWORD, SCALE_x4);
@@ -4495,7 +4496,7 @@ void hyperstone_device::generate_ldwp(drcuml_block &block, compiler_state &compi
 	const uint32_t src_code = op & 0xf;
 	const uint32_t dst_code = (op & 0xf0) >> 4;
 
-	UML_ROLAND(block, I0, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I0, DRC_FP);
 	UML_ADD(block, I1, I0, dst_code);
 	UML_AND(block, I2, I1, 0x3f);
 	UML_LOAD(block, I0, (void *)m_core->local_regs, I2, SIZE_DWORD, SCALE_x4);
@@ -4510,7 +4511,7 @@ void hyperstone_device::generate_ldwp(drcuml_block &block, compiler_state &compi
 		UML_MOV(block, I5, I1);
 		generate_set_global_register(block, compiler, desc);
 
-		UML_ROLAND(block, I0, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I0, DRC_FP);
 		UML_ADD(block, I1, I0, dst_code);
 		UML_AND(block, I2, I1, 0x3f);
 		UML_STORE(block, (void *)m_core->local_regs, I2, I3, SIZE_DWORD, SCALE_x4);
@@ -4520,7 +4521,7 @@ void hyperstone_device::generate_ldwp(drcuml_block &block, compiler_state &compi
 	}
 	else
 	{
-		UML_ROLAND(block, I0, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I0, DRC_FP);
 		UML_ADD(block, I4, I0, src_code);
 		UML_AND(block, I5, I4, 0x3f);
 		UML_STORE(block, (void *)m_core->local_regs, I5, I1, SIZE_DWORD, SCALE_x4);
@@ -4547,7 +4548,7 @@ void hyperstone_device::generate_lddp(drcuml_block &block, compiler_state &compi
 	const uint32_t src_code = op & 0xf;
 	const uint32_t dst_code = (op & 0xf0) >> 4;
 
-	UML_ROLAND(block, I0, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I0, DRC_FP);
 	UML_ADD(block, I1, I0, dst_code);
 	UML_AND(block, I2, I1, 0x3f);
 	UML_LOAD(block, I0, (void *)m_core->local_regs, I2, SIZE_DWORD, SCALE_x4);
@@ -4568,7 +4569,7 @@ void hyperstone_device::generate_lddp(drcuml_block &block, compiler_state &compi
 		UML_MOV(block, I5, I1);
 		generate_set_global_register(block, compiler, desc);
 
-		UML_ROLAND(block, I0, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I0, DRC_FP);
 		UML_ADD(block, I1, I0, dst_code);
 		UML_AND(block, I2, I1, 0x3f);
 		UML_STORE(block, (void *)m_core->local_regs, I2, I3, SIZE_DWORD, SCALE_x4);
@@ -4578,7 +4579,7 @@ void hyperstone_device::generate_lddp(drcuml_block &block, compiler_state &compi
 	}
 	else
 	{
-		UML_ROLAND(block, I0, DRC_SR, 7, 0x7f);
+		UML_MOV(block, I0, DRC_FP);
 		UML_ADD(block, I4, I0, src_code);
 		UML_AND(block, I5, I4, 0x3f);
 		UML_STORE(block, (void *)m_core->local_regs, I5, I2, SIZE_DWORD, SCALE_x4);
@@ -4608,7 +4609,7 @@ void hyperstone_device::generate_stwr(drcuml_block &block, compiler_state &compi
 	const uint32_t src_code = op & 0xf;
 	const uint32_t dst_code = (op & 0xf0) >> 4;
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -4644,7 +4645,7 @@ void hyperstone_device::generate_stdr(drcuml_block &block, compiler_state &compi
 	const uint32_t src_code = op & 0xf;
 	const uint32_t dst_code = (op & 0xf0) >> 4;
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -4692,7 +4693,7 @@ void hyperstone_device::generate_stwp(drcuml_block &block, compiler_state &compi
 	const uint32_t src_code = op & 0xf;
 	const uint32_t dst_code = (op & 0xf0) >> 4;
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -4730,7 +4731,7 @@ void hyperstone_device::generate_stdp(drcuml_block &block, compiler_state &compi
 	const uint32_t src_code = op & 0xf;
 	const uint32_t dst_code = (op & 0xf0) >> 4;
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 	UML_ADD(block, I2, I3, dst_code);
 	UML_AND(block, I4, I2, 0x3f); // I4 = dst_code
 	UML_LOAD(block, I0, (void *)m_core->local_regs, I4, SIZE_DWORD, SCALE_x4); // I0 = dreg
@@ -4872,9 +4873,11 @@ void hyperstone_device::generate_frame(drcuml_block &block, compiler_state &comp
 
 	generate_check_delay_pc(block, compiler, desc);
 
-	UML_ROLAND(block, I1, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I1, DRC_FP);
 	UML_SUB(block, I1, I1, op & 0xf);
 	UML_ROLINS(block, DRC_SR, I1, 25, 0xfe000000);  // SET_FP(GET_FP - SRC_CODE)
+	UML_MOV(block, DRC_FP, I1);
+	UML_AND(block, DRC_FP, DRC_FP, 0x7f);
 	UML_ROLINS(block, DRC_SR, op, 17, 0x01e00000);  // SET_FL(DST_CODE)
 	UML_AND(block, DRC_SR, DRC_SR, ~M_MASK);        // SET_M(0)
 
@@ -4964,7 +4967,7 @@ void hyperstone_device::generate_call(drcuml_block &block, compiler_state &compi
 	if (!dst_code)
 		dst_code = 16;
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 
 	if (SRC_GLOBAL)
 	{
@@ -4994,6 +4997,7 @@ void hyperstone_device::generate_call(drcuml_block &block, compiler_state &compi
 	UML_ROLINS(block, DRC_SR, I1, 25, 0xfe000000);
 	UML_ROLINS(block, DRC_SR, 6, 21, 0x01e00000);
 	UML_AND(block, DRC_SR, DRC_SR, ~M_MASK);
+	UML_ROLAND(block, DRC_FP, DRC_SR, 7, 0x7f);
 
 	UML_ADD(block, DRC_PC, I2, extra_s & ~1);
 
@@ -5052,7 +5056,7 @@ void hyperstone_device::generate_extend(drcuml_block &block, compiler_state &com
 	const uint32_t src_code = op & 0xf;
 	const uint32_t dst_code = (op & 0xf0) >> 4;
 
-	UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	UML_MOV(block, I3, DRC_FP);
 
 	UML_ADD(block, I2, I3, src_code);
 	UML_AND(block, I2, I2, 0x3f);
@@ -39,7 +39,8 @@ h8_device::h8_device(const machine_config &mconfig, device_type type, const char
 	m_PPC(0), m_NPC(0), m_PC(0), m_PIR(0), m_EXR(0), m_CCR(0), m_MAC(0), m_MACF(0),
 	m_TMP1(0), m_TMP2(0), m_TMPR(0), m_inst_state(0), m_inst_substate(0), m_icount(0), m_bcount(0),
 	m_irq_vector(0), m_taken_irq_vector(0), m_irq_level(0), m_taken_irq_level(0), m_irq_required(false), m_irq_nmi(false),
-	m_standby_pending(false), m_nvram_defval(0), m_nvram_battery(true)
+	m_standby_pending(false), m_nvram_defval(0), m_nvram_battery(true),
+	m_direct_fetch(true), m_fetch_ptr(nullptr), m_fetch_start(0), m_fetch_size(0), m_fetch_miss(~0)
 {
 	m_supports_advanced = false;
 	m_mode_advanced = false;
@@ -91,6 +92,13 @@ void h8_device::device_start()
 	space(AS_PROGRAM).cache(m_cache);
 	space(AS_PROGRAM).specific(m_program);
 
+	// a remap can take the fetch window's page away
+	m_fetch_notifier = space(AS_PROGRAM).add_change_notifier(
+			[this] (read_or_write mode) {
+				if(u32(mode) & u32(read_or_write::READ))
+					fetch_invalidate();
+			});
+
 	u32 pcmask = m_mode_advanced ? 0xffffff : 0xffff;
 	state_add<u32>(H8_PC, "PC",
 		[this]() { return m_NPC; },
@@ -477,7 +485,26 @@ void h8_device::state_string_export(const device_state_entry &entry, std::string
 u16 h8_device::read16i(u32 adr)
 {
 	m_icount -= 2;
-	return m_cache.read_word(adr & ~1);
+	return fetch16(adr);
+}
+
+u16 h8_device::fetch16_page(u32 adr)
+{
+	// the PC left the window: find out whether its new page is flat memory
+	// that the next fetches can read straight from
+	u32 page = adr & ~0xfff;
+	if(m_direct_fetch && page != m_fetch_miss && !(machine().debug_flags & DEBUG_FLAG_ENABLED)) {
+		auto *first = static_cast<const u16 *>(space(AS_PROGRAM).get_read_ptr(page));
+		auto *last = static_cast<const u16 *>(space(AS_PROGRAM).get_read_ptr(page + 0xffe));
+		if(first && last == first + 0x7ff) {
+			m_fetch_ptr = first;
+			m_fetch_start = page;
+			m_fetch_size = 0x1000;
+			return first[(adr - page) >> 1];
+		}
+		m_fetch_miss = page;
+	}
+	return m_cache.read_word(adr);
 }
 
 u8 h8_device::read8(u32 adr)
@@ -47,6 +47,7 @@ public:
 
 	void nvram_set_battery(int state) { m_nvram_battery = bool(state); } // default is 1 (nvram_enable_backup needs to be true)
 	void nvram_set_default_value(u16 val) { m_nvram_defval = val; } // default is 0
+	void set_direct_fetch(bool enable) { m_direct_fetch = enable; } // default is true, false fetches every word through the cache
 	auto standby_cb() { return m_standby_cb.bind(); } // notifier (not an output pin)
 	int standby() { return suspended(SUSPEND_REASON_CLOCK) ? 1 : 0; }
 
@@ -140,6 +141,7 @@ protected:
 	address_space_config m_program_config;
 	memory_access<32, 1, 0, ENDIANNESS_BIG>::cache m_cache;
 	memory_access<32, 1, 0, ENDIANNESS_BIG>::specific m_program;
+	util::notifier_subscription m_fetch_notifier;
 	optional_shared_ptr<u16> m_internal_ram; // for nvram
 	devcb_read16::array<8> m_read_adc;
 	devcb_read8::array<PORT_COUNT> m_read_port;
@@ -179,6 +181,11 @@ protected:
 	u16 m_nvram_defval;
 	bool m_nvram_battery;
 
+	// direct fetch window: the flat page of ROM or RAM the PC is in
+	bool m_direct_fetch;
+	const u16 *m_fetch_ptr;
+	u32 m_fetch_start, m_fetch_size, m_fetch_miss;
+
 	virtual void do_exec_full();
 	virtual void do_exec_partial();
 	static void add_event(u64 &event_time, u64 new_event);
@@ -192,6 +199,9 @@ protected:
 	virtual void irq_setup() = 0;
 
 	virtual u16 read16i(u32 adr);
+	u16 fetch16(u32 adr) { adr &= ~1; return (adr - m_fetch_start < m_fetch_size) ? m_fetch_ptr[(adr - m_fetch_start) >> 1] : fetch16_page(adr); }
+	u16 fetch16_page(u32 adr);
+	void fetch_invalidate() { m_fetch_size = 0; m_fetch_miss = ~0; }
 	virtual u8 read8(u32 adr);
 	virtual void write8(u32 adr, u8 data);
 	virtual u16 read16(u32 adr);
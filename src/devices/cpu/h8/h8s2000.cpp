@@ -21,7 +21,7 @@ std::unique_ptr<util::disasm_interface> h8s2000_device::create_disassembler()
 u16 h8s2000_device::read16i(u32 adr)
 {
 	m_icount--;
-	return m_cache.read_word(adr & ~1);
+	return fetch16(adr);
 }
 
 u8 h8s2000_device::read8(u32 adr)
@@ -0,0 +1,208 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    hostfp.h
+
+    Host double-precision arithmetic for SoftFloat 2 FPU cores.
+
+    When an FPU rounds to nearest at double precision, an operation whose
+    operands and result are all normal doubles gives the same answer on
+    the host as in SoftFloat, and the only flag it can raise is inexact.
+    The helpers here take that case on the host and rebuild the inexact
+    flag from the exact rounding error; anything else (extended or single
+    precision, other rounding modes, denormals, infinities, NaNs, overflow
+    or underflow) is left for SoftFloat.
+
+    SoftFloat's headers must be included before this one.
+
+***************************************************************************/
+#ifndef MAME_CPU_HOSTFP_H
+#define MAME_CPU_HOSTFP_H
+
+#pragma once
+
+#include "emuopts.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+
+namespace host_fp {
+
+// how an FPU core uses the host
+enum class mode : u8
+{
+	OFF,    // SoftFloat only
+	ON,     // host where it is exact
+	CHECK   // both, reporting any difference
+};
+
+// operations only round once if the host evaluates doubles as doubles
+constexpr bool SUPPORTED = (FLT_EVAL_METHOD == 0) && std::numeric_limits<double>::is_iec559;
+
+// smallest operand or result taken, so that every rounding error is a
+// normal double even when the host flushes denormals to zero
+constexpr double MIN_MAGNITUDE = 0x1p-916;
+
+inline mode configured(emu_options const &options)
+{
+	if (!SUPPORTED || !options.fpu_native())
+		return mode::OFF;
+	return options.fpu_native_check() ? mode::CHECK : mode::ON;
+}
+
+
+// extended value to double, if it is zero or a double in range without rounding
+inline bool to_double(floatx80 a, double &d)
+{
+	int const exp = a.high & 0x7fff;
+	if (!exp && !a.low)
+	{
+		d = (a.high & 0x8000) ? -0.0 : 0.0;
+		return true;
+	}
+	if ((exp < 0x3fff - 1022) || (exp > 0x3fff + 1023) || !BIT(a.low, 63) || (a.low & 0x7ff))
+		return false;
+
+	u64 const bits = (u64(a.high & 0x8000) << 48) | (u64(exp - 0x3fff + 1023) << 52) | ((a.low >> 11) & 0x000fffffffffffffU);
+	std::memcpy(&d, &bits, sizeof(d));
+	return std::fabs(d) >= MIN_MAGNITUDE;
+}
+
+// zero or normal double to extended
+inline floatx80 from_double(double d)
+{
+	u64 bits;
+	std::memcpy(&bits, &d, sizeof(bits));
+
+	floatx80 result;
+	result.high = u16(bits >> 48) & 0x8000;
+	result.low = 0;
+	if (bits & 0x7fffffffffffffffU)
+	{
+		result.high |= u16(((bits >> 52) & 0x7ff) - 1023 + 0x3fff);
+		result.low = 0x8000000000000000U | (bits << 11);
+	}
+	return result;
+}
+
+inline bool in_range(double r)
+{
+	return (std::fabs(r) >= MIN_MAGNITUDE) && (std::fabs(r) <= DBL_MAX);
+}
+
+
+// each operation returns false if SoftFloat has to do it, otherwise the
+// rounded result and the exception flags it raises
+inline bool add(floatx80 a, floatx80 b, floatx80 &result, int8 &flags)
+{
+	double x, y;
+	if (!to_double(a, x) || !to_double(b, y))
+		return false;
+
+	double const r = x + y;
+	if (r == 0.0)
+	{
+		// zero operands or exact cancellation
+		result = from_double(r);
+		flags = 0;
+		return true;
+	}
+	if (!in_range(r))
+		return false;
+
+	// TwoSum: the exact error of the rounded sum
+	double const yr = r - x;
+	double const err = (x - (r - yr)) + (y - yr);
+	result = from_double(r);
+	flags = (err != 0.0) ? float_flag_inexact : 0;
+	return true;
+}
+
+inline bool sub(floatx80 a, floatx80 b, floatx80 &result, int8 &flags)
+{
+	b.high ^= 0x8000;
+	return add(a, b, result, flags);
+}
+
+inline bool mul(floatx80 a, floatx80 b, floatx80 &result, int8 &flags)
+{
+	double x, y;
+	if (!to_double(a, x) || !to_double(b, y))
+		return false;
+
+	double const r = x * y;
+	if ((x == 0.0) || (y == 0.0))
+	{
+		result = from_double(r);
+		flags = 0;
+		return true;
+	}
+	if (!in_range(r))
+		return false;
+
+	result = from_double(r);
+	flags = (std::fma(x, y, -r) != 0.0) ? float_flag_inexact : 0;
+	return true;
+}
+
+inline bool div(floatx80 a, floatx80 b, floatx80 &result, int8 &flags)
+{
+	double x, y;
+	if (!to_double(a, x) || !to_double(b, y) || (y == 0.0))
+		return false;
+
+	double const r = x / y;
+	if (x == 0.0)
+	{
+		result = from_double(r);
+		flags = 0;
+		return true;
+	}
+	if (!in_range(r))
+		return false;
+
+	// the remainder of a correctly rounded quotient is exact
+	result = from_double(r);
+	flags = (std::fma(-r, y, x) != 0.0) ? float_flag_inexact : 0;
+	return true;
+}
+
+using function = bool (*)(floatx80 a, floatx80 b, floatx80 &result, int8 &flags);
+
+
+// run an operation on the host if the mode and operands allow, otherwise
+// through soft; in CHECK mode both run, report is called on any difference
+// in result or flags, and SoftFloat's answer is the one used
+template <typename Soft, typename Report>
+inline floatx80 dispatch(mode m, function host, floatx80 a, floatx80 b, Soft &&soft, Report &&report)
+{
+	floatx80 result;
+	int8 flags;
+	if ((m == mode::OFF) || !host(a, b, result, flags))
+		return soft();
+
+	if (m == mode::CHECK)
+	{
+		int8 const saved = float_exception_flags;
+		float_exception_flags = 0;
+		floatx80 const expected = soft();
+		int8 const expected_flags = float_exception_flags;
+		float_exception_flags = saved;
+
+		if ((result.high != expected.high) || (result.low != expected.low) || (flags != expected_flags))
+			report(result, flags, expected, expected_flags);
+		result = expected;
+		flags = expected_flags;
+	}
+
+	float_exception_flags |= flags;
+	return result;
+}
+
+} // namespace host_fp
+
+#endif // MAME_CPU_HOSTFP_H
@@ -72,6 +72,14 @@ i386_device::i386_device(const machine_config &mconfig, device_type type, const
 	, m_io_config("io", ENDIANNESS_LITTLE, io_data_width, 16, 0)
 	, m_smiact(*this)
 	, m_ferr_handler(*this)
+	, m_drc(nullptr)
+	, m_drc_cache_dirty(false)
+	, m_drc_tlb_retry(~0U)
+	, m_entry(nullptr)
+	, m_nocode(nullptr)
+	, m_out_of_cycles(nullptr)
+	, m_interpret(nullptr)
+	, m_tlb_mismatch(nullptr)
 {
 	// 32 unified
 	set_vtlb_dynamic_entries(32);
@@ -337,15 +345,28 @@ void i386_device::NEAR_BRANCH(int32_t offs)
 	m_pc += offs;
 }
 
-uint8_t i386_device::FETCH()
+uint32_t i386_device::fetch_translate(uint32_t linear)
 {
-	uint8_t value;
-	uint32_t address = m_pc, error;
+	// most fetches come from the same page as the one before
+	if (fetch_key(linear) == m_fetch_key)
+		return m_fetch_phys | (linear & 0xfff);
 
+	uint32_t address = linear, error;
 	if(!translate_address(m_CPL,TR_FETCH,&address,&error))
 		PF_THROW(error);
 
-	value = mem_pr8(address & m_a20_mask);
+	address &= m_a20_mask;
+	m_fetch_key = fetch_key(linear);
+	m_fetch_phys = address & ~0xfff;
+	return address;
+}
+
+uint8_t i386_device::FETCH()
+{
+	uint8_t value;
+	uint32_t address = fetch_translate(m_pc);
+
+	value = mem_pr8(address);
 #ifdef DEBUG_MISSING_OPCODE
 	m_opcode_bytes[m_opcode_bytes_length] = value;
 	m_opcode_bytes_length = (m_opcode_bytes_length + 1) & 15;
@@ -357,15 +378,12 @@ uint8_t i386_device::FETCH()
 uint16_t i386_device::FETCH16()
 {
 	uint16_t value;
-	uint32_t address = m_pc, error;
 
-	if( !WORD_ALIGNED(address) ) {       /* Unaligned read */
+	if( !WORD_ALIGNED(m_pc) ) {       /* Unaligned read */
 		value = (FETCH() << 0);
 		value |= (FETCH() << 8);
 	} else {
-		if(!translate_address(m_CPL,TR_FETCH,&address,&error))
-			PF_THROW(error);
-		address &= m_a20_mask;
+		uint32_t address = fetch_translate(m_pc);
 		value = mem_pr16(address);
 		m_eip += 2;
 		m_pc += 2;
@@ -375,7 +393,6 @@ uint16_t i386_device::FETCH16()
 uint32_t i386_device::FETCH32()
 {
 	uint32_t value;
-	uint32_t address = m_pc, error;
 
 	if( !DWORD_ALIGNED(m_pc) ) {      /* Unaligned read */
 		value = (FETCH() << 0);
@@ -383,10 +400,7 @@ uint32_t i386_device::FETCH32()
 		value |= (FETCH() << 16);
 		value |= (FETCH() << 24);
 	} else {
-		if(!translate_address(m_CPL,TR_FETCH,&address,&error))
-			PF_THROW(error);
-
-		address &= m_a20_mask;
+		uint32_t address = fetch_translate(m_pc);
 		value = mem_pr32(address);
 		m_eip += 4;
 		m_pc += 4;
@@ -1919,6 +1933,7 @@ void i386_device::i386_postload()
 	int i;
 	for (i = 0; i < 6; i++)
 		i386_load_segment_descriptor(i);
+	fetch_flush();
 	CHANGE_PC(m_eip);
 }
 
@@ -1966,6 +1981,7 @@ void i386_device::i386_common_init()
 	m_lock = false;
 
 	zero_state();
+	m_x87_host_fp = host_fp::configured(machine().options());
 
 	save_item(NAME(m_reg.d));
 	save_item(STRUCT_MEMBER(m_sreg, selector));
@@ -2047,6 +2063,10 @@ void i386_device::i386_common_init()
 
 	set_icountptr(m_cycles);
 	m_notifier = m_program->add_change_notifier([this] (read_or_write mode) { dri_changed(); });
+
+	// the recompiler is opt-in until it has been checked against the interpreter
+	if (allow_unverified_drc())
+		drc_init();
 }
 
 void i386_device::device_start()
@@ -2413,6 +2433,9 @@ void i386_device::build_opcode_table(uint32_t features)
 
 void i386_device::zero_state()
 {
+	m_drc_cache_dirty = true;
+	m_fetch_key = ~0;
+	m_fetch_phys = 0;
 	memset( &m_reg, 0, sizeof(m_reg) );
 	memset( m_sreg, 0, sizeof(m_sreg) );
 	m_eip = 0;
@@ -2682,6 +2705,7 @@ void i386_device::leave_smm()
 	m_eflags = READ32(smram_state + SMRAM_EFLAGS);
 	m_cr[3] = READ32(smram_state + SMRAM_CR3);
 	m_cr[0] = READ32(smram_state + SMRAM_CR0);
+	fetch_flush();
 
 	m_CPL = (m_sreg[SS].flags >> 13) & 3; // cpl == dpl of ss
 
@@ -2768,6 +2792,7 @@ void i386_device::i386_set_a20_line(int state)
 	}
 	// TODO: how does A20M and the tlb interact
 	vtlb_flush_dynamic();
+	fetch_flush();
 }
 
 void i386_device::execute_run()
@@ -2787,6 +2812,11 @@ void i386_device::execute_run()
 	{
 		i386_check_irq_line();
 
+		// run compiled code while the state allows it; it returns when the
+		// cycles run out or when an instruction has to be interpreted
+		if (m_drcuml && drc_can_execute() && !drc_execute())
+			continue;
+
 		// The LE and GE bits of DR7 aren't currently implemented because they could potentially require cycle-accurate emulation.
 		if((m_dr[7] & 0xff) != 0) // If all of the breakpoints are disabled, skip checking for instruction breakpoint hitting entirely.
 		for(int i = 0; i < 4; i++)
@@ -13,6 +13,9 @@
 #endif
 
 #include "divtlb.h"
+#include "cpu/drcfe.h"
+#include "cpu/drcuml.h"
+#include "cpu/hostfp.h"
 
 #include "i386dasm.h"
 
@@ -25,8 +28,12 @@
 
 #define X86_NUM_CPUS        4
 
+class i386_frontend;
+
 class i386_device : public cpu_device, public device_vtlb_interface, public i386_disassembler::config
 {
+	friend class i386_frontend;
+
 public:
 	// construction/destruction
 	i386_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock);
@@ -41,6 +48,12 @@ public:
 	uint64_t debug_virttophys(int params, const uint64_t *param);
 	uint64_t debug_cacheflush(int params, const uint64_t *param);
 
+	// memory accesses made by the recompiled code
+	void func_read8();
+	void func_read16();
+	void func_read32();
+	void func_write32();
+
 protected:
 	i386_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock, int program_data_width, int program_addr_width, int io_data_width);
 
@@ -369,6 +382,7 @@ protected:
 	uint16_t m_x87_cs;
 	uint32_t m_x87_inst_ptr;
 	uint16_t m_x87_opcode;
+	host_fp::mode m_x87_host_fp;
 
 	i386_modrm_func m_opcode_table_x87_d8[256];
 	i386_modrm_func m_opcode_table_x87_d9[256];
@@ -430,6 +444,11 @@ protected:
 	offs_t m_opcode_addrs[16];
 	uint32_t m_opcode_addrs_index;
 
+	// translation of the code page last fetched from; the key packs the
+	// linear page with CPL and CR0.PG so it can't match across either
+	uint32_t m_fetch_key;
+	uint32_t m_fetch_phys;
+
 	uint64_t m_debugger_temp;
 
 	void register_state_i386();
@@ -439,6 +458,9 @@ protected:
 	inline vtlb_entry get_permissions(uint32_t pte, int wp);
 	bool i386_translate_address(int intention, bool debug, offs_t *address, vtlb_entry *entry);
 	bool translate_address(int pl, int type, uint32_t *address, uint32_t *error);
+	inline uint32_t fetch_key(uint32_t linear) const { return (linear & ~0xfff) | m_CPL | ((m_cr[0] & 0x80000000) ? 4 : 0); }
+	inline void fetch_flush() { m_fetch_key = ~0; }
+	inline uint32_t fetch_translate(uint32_t linear);
 	void CHANGE_PC(uint32_t pc);
 	inline void NEAR_BRANCH(int32_t offs);
 	inline uint8_t FETCH();
@@ -1408,6 +1430,7 @@ protected:
 	floatx80 x87_sub(floatx80 a, floatx80 b);
 	floatx80 x87_mul(floatx80 a, floatx80 b);
 	floatx80 x87_div(floatx80 a, floatx80 b);
+	floatx80 x87_double_op(const char *name, host_fp::function host, float64 (*soft)(float64, float64), floatx80 a, floatx80 b);
 	void x87_fadd_m32real(uint8_t modrm);
 	void x87_fadd_m64real(uint8_t modrm);
 	void x87_fadd_st_sti(uint8_t modrm);
@@ -1562,6 +1585,108 @@ protected:
 	void zero_state();
 	void i386_set_a20_line(int state);
 
+	// dynamic recompiler
+	enum : size_t
+	{
+		DRC_CACHE_SIZE              = 32 * 1024 * 1024
+	};
+
+	// exit codes
+	enum : int
+	{
+		EXECUTE_OUT_OF_CYCLES       = 0,
+		EXECUTE_MISSING_CODE        = 1,
+		EXECUTE_UNMAPPED_CODE       = 2,
+		EXECUTE_RESET_CACHE         = 3,
+		EXECUTE_INTERPRET           = 4,
+		EXECUTE_TLB_MISMATCH        = 5
+	};
+
+	// state accessed by the generated code, kept in the near cache
+	struct internal_i386_state
+	{
+		uint32_t r[8];              // general purpose registers
+		uint32_t eip;               // instruction pointer
+		uint32_t cf;                // arithmetic flags, one 0/1 word each
+		uint32_t pf;
+		uint32_t af;
+		uint32_t zf;
+		uint32_t sf;
+		uint32_t of;
+		int32_t icount;             // cycle counter
+		uint32_t mode;              // mode the code was compiled for
+		uint32_t arg0;              // memory callback address
+		uint32_t arg1;              // memory callback data
+		uint32_t jmpdest;           // destination of indirect branches
+		uint32_t fault;             // set when a memory callback faulted
+		uint32_t irq_pending;       // set when a memory callback raised an interrupt
+		uint8_t parity[256];        // PF value for each low byte
+	};
+
+	// 32-bit ModRM operand, as decoded by the front-end
+	struct drc_modrm
+	{
+		uint8_t mod;
+		uint8_t reg;
+		uint8_t rm;
+		int8_t base;                // base register, or -1
+		int8_t index;               // index register, or -1
+		uint8_t scale;              // shift applied to the index
+		int32_t disp;               // displacement
+		uint8_t length;             // bytes of ModRM, SIB and displacement
+	};
+
+	// internal compiler state
+	struct compiler_state
+	{
+		compiler_state &operator=(compiler_state &) = delete;
+
+		uint32_t cycles;            // accumulated cycles
+		uml::code_label labelnum;   // index for local labels
+	};
+
+	std::unique_ptr<drc_cache> m_drc_cache;
+	std::unique_ptr<drcuml_state> m_drcuml;
+	std::unique_ptr<i386_frontend> m_drcfe;
+	internal_i386_state *m_drc;
+	bool m_drc_cache_dirty;
+	uint32_t m_drc_tlb_retry;
+
+	uml::code_handle *m_entry;
+	uml::code_handle *m_nocode;
+	uml::code_handle *m_out_of_cycles;
+	uml::code_handle *m_interpret;
+	uml::code_handle *m_tlb_mismatch;
+
+	static bool drc_decode_modrm(const uint8_t *bytes, int avail, drc_modrm &modrm);
+
+	void drc_init();
+	bool drc_can_execute() const;
+	bool drc_execute();
+	void drc_load_state();
+	void drc_save_state();
+	uint8_t code_mode() const;
+	void code_flush_cache();
+	void code_compile_block(uint8_t mode, offs_t pc);
+
+	void static_generate_entry_point();
+	void static_generate_nocode_handler();
+	void static_generate_out_of_cycles();
+	void static_generate_interpret();
+	void static_generate_tlb_mismatch();
+
+	void generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param);
+	void generate_checksum_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *seqhead, const opcode_desc *seqlast);
+	void generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t extra_cycles);
+	void generate_ea(drcuml_block &block, uml::parameter dst, const drc_modrm &modrm);
+	void generate_read(drcuml_block &block, const opcode_desc *desc, uml::parameter dst, uml::parameter address, int size);
+	void generate_write(drcuml_block &block, const opcode_desc *desc, uml::parameter address, uml::parameter src);
+	void generate_push(drcuml_block &block, const opcode_desc *desc, uml::parameter src);
+	void generate_alu(drcuml_block &block, int aluop, bool setflags);
+	void generate_alu_rm(drcuml_block &block, const opcode_desc *desc, const drc_modrm &modrm, int aluop);
+	uml::condition_t generate_condition(drcuml_block &block, int cc);
+	bool generate_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
 };
 
 
@@ -1710,6 +1835,26 @@ protected:
 };
 
 
+class i386_frontend : public drc_frontend
+{
+public:
+	// construction/destruction
+	i386_frontend(i386_device *i386, uint32_t window_start, uint32_t window_end, uint32_t max_sequence);
+
+protected:
+	// required overrides
+	virtual bool describe(opcode_desc &desc, const opcode_desc *prev) override;
+
+private:
+	// internal helpers
+	bool describe_interpret(opcode_desc &desc);
+	void describe_modrm(opcode_desc &desc, const i386_device::drc_modrm &modrm, bool read, bool write);
+
+	// internal state
+	i386_device *m_i386;
+};
+
+
 DECLARE_DEVICE_TYPE(I386,        i386_device)
 DECLARE_DEVICE_TYPE(I386SX,      i386sx_device)
 DECLARE_DEVICE_TYPE(I486,        i486_device)
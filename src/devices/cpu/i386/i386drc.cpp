@@ -0,0 +1,1264 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    i386drc.cpp
+
+    Universal machine language-based i386 emulator.
+
+    The recompiler covers 32-bit code running in flat protected mode:
+    CS, DS, ES and SS must have a zero base and a 4GB limit, and
+    virtual 8086 mode, single stepping and hardware breakpoints all
+    stay with the interpreter.  Only the common integer instructions
+    are compiled; everything else ends its sequence and is handed back
+    to the interpreter one instruction at a time.
+
+    Memory is accessed through C callbacks so that faults are raised
+    exactly as the interpreter raises them.  An access that faults
+    abandons the instruction, which the interpreter then re-executes
+    from the start; the compiled code never commits a register or flag
+    before the last access of an instruction.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "i386.h"
+#include "i386priv.h"
+#include "i386fe.h"
+
+#include "cpu/drcfe.h"
+#include "cpu/drcuml.h"
+#include "cpu/drcumlsh.h"
+
+using namespace uml;
+
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+// map variables
+#define MAPVAR_PC                       M0
+#define MAPVAR_CYCLES                   M1
+
+// compilation boundaries -- how far back/forward does the analysis extend?
+#define COMPILE_BACKWARDS_BYTES         128
+#define COMPILE_FORWARDS_BYTES          512
+#define COMPILE_MAX_SEQUENCE            64
+
+// ALU operations; 0-7 follow the x86 encoding
+enum
+{
+	ALU_ADD = 0,
+	ALU_OR,
+	ALU_ADC,
+	ALU_SBB,
+	ALU_AND,
+	ALU_SUB,
+	ALU_XOR,
+	ALU_CMP,
+	ALU_INC,
+	ALU_DEC,
+	ALU_TEST
+};
+
+
+
+/***************************************************************************
+    MACROS
+***************************************************************************/
+
+#define R32(reg)                        mem(&m_drc->r[reg])
+#define FLAG(name)                      mem(&m_drc->name)
+
+
+
+/***************************************************************************
+    INLINE FUNCTIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    alloc_handle - allocate a handle if not
+    already allocated
+-------------------------------------------------*/
+
+static inline void alloc_handle(drcuml_state &drcuml, code_handle *&handleptr, const char *name)
+{
+	if (!handleptr)
+		handleptr = drcuml.handle_alloc(name);
+}
+
+
+/*-------------------------------------------------
+    is_logic_op - return true for the operations
+    that clear CF and OF
+-------------------------------------------------*/
+
+static inline bool is_logic_op(int aluop)
+{
+	return aluop == ALU_OR || aluop == ALU_AND || aluop == ALU_XOR || aluop == ALU_TEST;
+}
+
+
+/*-------------------------------------------------
+    cfunc wrappers for the memory callbacks
+-------------------------------------------------*/
+
+static void cfunc_read8(void *param)
+{
+	((i386_device *)param)->func_read8();
+}
+
+static void cfunc_read16(void *param)
+{
+	((i386_device *)param)->func_read16();
+}
+
+static void cfunc_read32(void *param)
+{
+	((i386_device *)param)->func_read32();
+}
+
+static void cfunc_write32(void *param)
+{
+	((i386_device *)param)->func_write32();
+}
+
+
+
+/***************************************************************************
+    CORE CALLBACKS
+***************************************************************************/
+
+/*-------------------------------------------------
+    drc_init - allocate the recompiler state
+-------------------------------------------------*/
+
+void i386_device::drc_init()
+{
+	static const char *const regnames[8] = { "eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi" };
+
+	m_drc_cache = std::make_unique<drc_cache>(DRC_CACHE_SIZE + sizeof(internal_i386_state));
+
+	// allocate the state shared with the generated code in the near cache
+	m_drc = (internal_i386_state *)m_drc_cache->alloc_near(sizeof(internal_i386_state));
+	memset(m_drc, 0, sizeof(*m_drc));
+	for (int i = 0; i < 256; i++)
+		m_drc->parity[i] = i386_parity_table[i];
+
+	// initialize the UML generator; x86 code can start on any byte
+	m_drcuml = std::make_unique<drcuml_state>(*this, *m_drc_cache, 0, 4, 32, 0);
+
+	// add symbols for our stuff
+	m_drcuml->symbol_add(&m_drc->eip, sizeof(m_drc->eip), "eip");
+	m_drcuml->symbol_add(&m_drc->icount, sizeof(m_drc->icount), "icount");
+	for (int regnum = 0; regnum < 8; regnum++)
+		m_drcuml->symbol_add(&m_drc->r[regnum], sizeof(m_drc->r[regnum]), regnames[regnum]);
+	m_drcuml->symbol_add(&m_drc->cf, sizeof(m_drc->cf), "cf");
+	m_drcuml->symbol_add(&m_drc->pf, sizeof(m_drc->pf), "pf");
+	m_drcuml->symbol_add(&m_drc->af, sizeof(m_drc->af), "af");
+	m_drcuml->symbol_add(&m_drc->zf, sizeof(m_drc->zf), "zf");
+	m_drcuml->symbol_add(&m_drc->sf, sizeof(m_drc->sf), "sf");
+	m_drcuml->symbol_add(&m_drc->of, sizeof(m_drc->of), "of");
+	m_drcuml->symbol_add(&m_drc->mode, sizeof(m_drc->mode), "mode");
+	m_drcuml->symbol_add(&m_drc->arg0, sizeof(m_drc->arg0), "arg0");
+	m_drcuml->symbol_add(&m_drc->arg1, sizeof(m_drc->arg1), "arg1");
+	m_drcuml->symbol_add(&m_drc->jmpdest, sizeof(m_drc->jmpdest), "jmpdest");
+
+	// initialize the front-end helper
+	m_drcfe = std::make_unique<i386_frontend>(this, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, COMPILE_MAX_SEQUENCE);
+
+	// mark the cache dirty so it is updated on next execute
+	m_drc_cache_dirty = true;
+	m_drc_tlb_retry = ~0;
+}
+
+
+/*-------------------------------------------------
+    drc_can_execute - return true if the current
+    state is one the compiled code handles
+-------------------------------------------------*/
+
+bool i386_device::drc_can_execute() const
+{
+	if (!PROTECTED_MODE || V8086_MODE || m_TF || m_RF || m_lock || m_delayed_interrupt_enable)
+		return false;
+	if (m_a20_mask != ~0U || (m_dr[7] & 0xff) != 0)
+		return false;
+	if (machine().debug_flags & DEBUG_FLAG_ENABLED)
+		return false;
+	if (!m_sreg[CS].d || !m_sreg[SS].d)
+		return false;
+
+	// code and data segments must be flat
+	for (int seg : { CS, DS, ES, SS })
+		if (!m_sreg[seg].valid || m_sreg[seg].base != 0 || m_sreg[seg].limit != 0xffffffff)
+			return false;
+
+	// CS executable, DS/ES/SS writable expand-up data
+	if ((m_sreg[CS].flags & 0x18) != 0x18)
+		return false;
+	for (int seg : { DS, ES, SS })
+		if ((m_sreg[seg].flags & 0x1e) != 0x12)
+			return false;
+	return true;
+}
+
+
+/*-------------------------------------------------
+    code_mode - return the mode the compiled code
+    is keyed on
+-------------------------------------------------*/
+
+uint8_t i386_device::code_mode() const
+{
+	return ((m_cr[0] & CR0_PG) ? 1 : 0) | ((m_CPL == 3) ? 2 : 0);
+}
+
+
+/*-------------------------------------------------
+    drc_load_state - copy the interpreter state
+    into the recompiler state
+-------------------------------------------------*/
+
+void i386_device::drc_load_state()
+{
+	for (int regnum = 0; regnum < 8; regnum++)
+		m_drc->r[regnum] = REG32(regnum);
+	m_drc->eip = m_eip;
+	m_drc->cf = m_CF;
+	m_drc->pf = m_PF;
+	m_drc->af = m_AF;
+	m_drc->zf = m_ZF;
+	m_drc->sf = m_SF;
+	m_drc->of = m_OF;
+	m_drc->icount = m_cycles;
+	m_drc->mode = code_mode();
+	m_drc->fault = 0;
+	m_drc->irq_pending = 0;
+}
+
+
+/*-------------------------------------------------
+    drc_save_state - copy the recompiler state
+    back to the interpreter
+-------------------------------------------------*/
+
+void i386_device::drc_save_state()
+{
+	for (int regnum = 0; regnum < 8; regnum++)
+		REG32(regnum) = m_drc->r[regnum];
+	m_eip = m_drc->eip;
+	m_CF = m_drc->cf;
+	m_PF = m_drc->pf;
+	m_AF = m_drc->af;
+	m_ZF = m_drc->zf;
+	m_SF = m_drc->sf;
+	m_OF = m_drc->of;
+	m_cycles = m_drc->icount;
+	CHANGE_PC(m_eip);
+}
+
+
+/*-------------------------------------------------
+    drc_execute - run compiled code until the
+    cycles run out; returns true if the current
+    instruction must be interpreted
+-------------------------------------------------*/
+
+bool i386_device::drc_execute()
+{
+	// reset the cache if dirty
+	if (m_drc_cache_dirty)
+		code_flush_cache();
+	m_drc_cache_dirty = false;
+
+	drc_load_state();
+
+	// execute
+	bool interpret = false;
+	int execute_result;
+	do
+	{
+		execute_result = m_drcuml->execute(*m_entry);
+
+		// if we need to recompile, do it
+		if (execute_result == EXECUTE_MISSING_CODE)
+			code_compile_block(m_drc->mode, m_drc->eip);
+		else if (execute_result == EXECUTE_UNMAPPED_CODE)
+			fatalerror("Attempted to execute unmapped code at PC=%08X\n", m_drc->eip);
+		else if (execute_result == EXECUTE_RESET_CACHE)
+			code_flush_cache();
+		else if (execute_result == EXECUTE_TLB_MISMATCH)
+		{
+			// reload the entry; a fault has to be taken by the interpreter
+			uint32_t address = m_drc->eip, error;
+			if (!translate_address(m_CPL, TR_FETCH, &address, &error))
+				interpret = true;
+
+			// a second mismatch at the same address means the mapping changed
+			else if (m_drc_tlb_retry == m_drc->eip)
+				code_compile_block(m_drc->mode, m_drc->eip);
+			m_drc_tlb_retry = m_drc->eip;
+			continue;
+		}
+		else if (execute_result == EXECUTE_INTERPRET)
+			interpret = true;
+		m_drc_tlb_retry = ~0;
+	}
+	while (execute_result != EXECUTE_OUT_OF_CYCLES && !interpret);
+
+	drc_save_state();
+	return interpret;
+}
+
+
+/*-------------------------------------------------
+    func_read8/16/32, func_write32 - memory
+    accesses made on behalf of the compiled code;
+    a fault sets the fault flag instead of being
+    raised
+-------------------------------------------------*/
+
+void i386_device::func_read8()
+{
+	m_cycles = m_drc->icount;
+	try
+	{
+		m_drc->arg1 = READ8(m_drc->arg0);
+	}
+	catch (uint64_t)
+	{
+		m_drc->fault = 1;
+	}
+	m_drc->icount = m_cycles;
+	m_drc->irq_pending = (m_irq_state && m_IF) ? 1 : 0;
+}
+
+void i386_device::func_read16()
+{
+	m_cycles = m_drc->icount;
+	try
+	{
+		m_drc->arg1 = READ16(m_drc->arg0);
+	}
+	catch (uint64_t)
+	{
+		m_drc->fault = 1;
+	}
+	m_drc->icount = m_cycles;
+	m_drc->irq_pending = (m_irq_state && m_IF) ? 1 : 0;
+}
+
+void i386_device::func_read32()
+{
+	m_cycles = m_drc->icount;
+	try
+	{
+		m_drc->arg1 = READ32(m_drc->arg0);
+	}
+	catch (uint64_t)
+	{
+		m_drc->fault = 1;
+	}
+	m_drc->icount = m_cycles;
+	m_drc->irq_pending = (m_irq_state && m_IF) ? 1 : 0;
+}
+
+void i386_device::func_write32()
+{
+	m_cycles = m_drc->icount;
+	try
+	{
+		WRITE32(m_drc->arg0, m_drc->arg1);
+	}
+	catch (uint64_t)
+	{
+		m_drc->fault = 1;
+	}
+	m_drc->icount = m_cycles;
+	m_drc->irq_pending = (m_irq_state && m_IF) ? 1 : 0;
+}
+
+
+
+/***************************************************************************
+    CACHE MANAGEMENT
+***************************************************************************/
+
+/*-------------------------------------------------
+    code_flush_cache - flush the cache and
+    regenerate static code
+-------------------------------------------------*/
+
+void i386_device::code_flush_cache()
+{
+	// empty the transient cache contents
+	m_drcuml->reset();
+
+	try
+	{
+		// generate the entry point and out-of-cycles handlers
+		static_generate_entry_point();
+		static_generate_nocode_handler();
+		static_generate_out_of_cycles();
+		static_generate_interpret();
+		static_generate_tlb_mismatch();
+	}
+	catch (drcuml_block::abort_compilation &)
+	{
+		fatalerror("Unrecoverable error generating static code\n");
+	}
+}
+
+
+/*-------------------------------------------------
+    code_compile_block - compile a block of the
+    given mode at the specified pc
+-------------------------------------------------*/
+
+void i386_device::code_compile_block(uint8_t mode, offs_t pc)
+{
+	compiler_state compiler = { 0 };
+	const opcode_desc *seqhead, *seqlast;
+	const opcode_desc *desclist;
+	bool override = false;
+
+	auto profile = g_profiler.start(PROFILER_DRC_COMPILE);
+
+	// get a description of this sequence
+	desclist = m_drcfe->describe_code(pc);
+
+	// if we get an error back, flush the cache and try again
+	bool succeeded = false;
+	while (!succeeded)
+	{
+		try
+		{
+			// start the block
+			drcuml_block &block(m_drcuml->begin_block(4096));
+
+			// local labels never collide with anything else in the block
+			compiler.labelnum = 1;
+
+			// loop until we get through all instruction sequences
+			for (seqhead = desclist; seqhead != nullptr; seqhead = seqlast->next())
+			{
+				const opcode_desc *curdesc;
+				uint32_t nextpc;
+
+				// add a code log entry
+				if (m_drcuml->logging())
+					block.append_comment("-------------------------");                     // comment
+
+				// determine the last instruction in this sequence
+				for (seqlast = seqhead; seqlast != nullptr; seqlast = seqlast->next())
+					if (seqlast->flags & OPFLAG_END_SEQUENCE)
+						break;
+				assert(seqlast != nullptr);
+
+				// if we don't have a hash for this mode/pc, or if we are overriding all, add one
+				if (override || !m_drcuml->hash_exists(mode, seqhead->pc))
+					UML_HASH(block, mode, seqhead->pc);                                     // hash    mode,pc
+
+				// if we already have a hash, and this is the first sequence, assume that we
+				// are recompiling due to being out of sync and allow future overrides
+				else if (seqhead == desclist)
+				{
+					override = true;
+					UML_HASH(block, mode, seqhead->pc);                                     // hash    mode,pc
+				}
+
+				// otherwise, redispatch to that fixed PC and skip the rest of the processing
+				else
+				{
+					UML_HASHJMP(block, mode, seqhead->pc, *m_nocode);                       // hashjmp <mode>,seqhead->pc,nocode
+					continue;
+				}
+
+				// validate this code block if we're not pointing into ROM
+				if (!(seqhead->flags & OPFLAG_COMPILER_PAGE_FAULT) && m_program->get_write_ptr(seqhead->physpc) != nullptr)
+					generate_checksum_block(block, compiler, seqhead, seqlast);
+
+				// iterate over instructions in the sequence and compile them
+				for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+					generate_sequence_instruction(block, compiler, curdesc);
+
+				// count off cycles and go to the next instruction
+				nextpc = seqlast->pc + seqlast->length;
+				generate_update_cycles(block, compiler, nextpc);                            // <subtract cycles>
+				if (seqlast->next() == nullptr || seqlast->next()->pc != nextpc)
+					UML_HASHJMP(block, mode, nextpc, *m_nocode);                            // hashjmp <mode>,nextpc,nocode
+			}
+
+			// end the sequence
+			block.end();
+			succeeded = true;
+		}
+		catch (drcuml_block::abort_compilation &)
+		{
+			code_flush_cache();
+		}
+	}
+}
+
+
+
+/***************************************************************************
+    STATIC CODEGEN
+***************************************************************************/
+
+/*-------------------------------------------------
+    static_generate_entry_point - generate a
+    static entry point
+-------------------------------------------------*/
+
+void i386_device::static_generate_entry_point()
+{
+	// begin generating
+	drcuml_block &block(m_drcuml->begin_block(20));
+
+	// forward references
+	alloc_handle(*m_drcuml, m_nocode, "nocode");
+
+	alloc_handle(*m_drcuml, m_entry, "entry");
+	UML_HANDLE(block, *m_entry);                                                    // handle  entry
+
+	// generate a hash jump via the current mode and PC
+	UML_HASHJMP(block, mem(&m_drc->mode), mem(&m_drc->eip), *m_nocode);            // hashjmp [mode],[eip],nocode
+
+	block.end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_nocode_handler - generate an
+    exception handler for "out of code"
+-------------------------------------------------*/
+
+void i386_device::static_generate_nocode_handler()
+{
+	// begin generating
+	drcuml_block &block(m_drcuml->begin_block(10));
+
+	// generate a hash jump via the current mode and PC
+	alloc_handle(*m_drcuml, m_nocode, "nocode");
+	UML_HANDLE(block, *m_nocode);                                                   // handle  nocode
+	UML_GETEXP(block, I0);                                                          // getexp  i0
+	UML_MOV(block, mem(&m_drc->eip), I0);                                           // mov     [eip],i0
+	UML_EXIT(block, EXECUTE_MISSING_CODE);                                          // exit    EXECUTE_MISSING_CODE
+
+	block.end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_out_of_cycles - generate an
+    out of cycles exception handler
+-------------------------------------------------*/
+
+void i386_device::static_generate_out_of_cycles()
+{
+	// begin generating
+	drcuml_block &block(m_drcuml->begin_block(10));
+
+	// generate a hash jump via the current mode and PC
+	alloc_handle(*m_drcuml, m_out_of_cycles, "out_of_cycles");
+	UML_HANDLE(block, *m_out_of_cycles);                                            // handle  out_of_cycles
+	UML_GETEXP(block, I0);                                                          // getexp  i0
+	UML_MOV(block, mem(&m_drc->eip), I0);                                           // mov     [eip],i0
+	UML_EXIT(block, EXECUTE_OUT_OF_CYCLES);                                         // exit    EXECUTE_OUT_OF_CYCLES
+
+	block.end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_interpret - generate the
+    handler that hands an instruction back to the
+    interpreter
+-------------------------------------------------*/
+
+void i386_device::static_generate_interpret()
+{
+	// begin generating
+	drcuml_block &block(m_drcuml->begin_block(20));
+
+	// only the cycles of the instructions before this one have been used up
+	alloc_handle(*m_drcuml, m_interpret, "interpret");
+	UML_HANDLE(block, *m_interpret);                                                // handle  interpret
+	UML_GETEXP(block, I0);                                                          // getexp  i0
+	UML_MOV(block, mem(&m_drc->eip), I0);                                           // mov     [eip],i0
+	UML_RECOVER(block, I1, MAPVAR_CYCLES);                                          // recover i1,CYCLES
+	UML_SUB(block, mem(&m_drc->icount), mem(&m_drc->icount), I1);                   // sub     [icount],[icount],i1
+	UML_EXIT(block, EXECUTE_INTERPRET);                                             // exit    EXECUTE_INTERPRET
+
+	block.end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_tlb_mismatch - generate the
+    handler for a stale or missing fetch TLB entry
+-------------------------------------------------*/
+
+void i386_device::static_generate_tlb_mismatch()
+{
+	// begin generating
+	drcuml_block &block(m_drcuml->begin_block(20));
+
+	alloc_handle(*m_drcuml, m_tlb_mismatch, "tlb_mismatch");
+	UML_HANDLE(block, *m_tlb_mismatch);                                             // handle  tlb_mismatch
+	UML_GETEXP(block, I0);                                                          // getexp  i0
+	UML_MOV(block, mem(&m_drc->eip), I0);                                           // mov     [eip],i0
+	UML_RECOVER(block, I1, MAPVAR_CYCLES);                                          // recover i1,CYCLES
+	UML_SUB(block, mem(&m_drc->icount), mem(&m_drc->icount), I1);                   // sub     [icount],[icount],i1
+	UML_EXIT(block, EXECUTE_TLB_MISMATCH);                                          // exit    EXECUTE_TLB_MISMATCH
+
+	block.end();
+}
+
+
+
+/***************************************************************************
+    CODE GENERATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    generate_update_cycles - generate code to
+    subtract cycles from the icount and generate
+    an exception if out; a memory callback that
+    raised an interrupt leaves the same way
+-------------------------------------------------*/
+
+void i386_device::generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param)
+{
+	if (compiler.cycles > 0)
+	{
+		UML_SUB(block, mem(&m_drc->icount), mem(&m_drc->icount), compiler.cycles); // sub     [icount],[icount],cycles
+		UML_EXHc(block, COND_S, *m_out_of_cycles, param);                           // exh     out_of_cycles,param,S
+	}
+	compiler.cycles = 0;
+
+	UML_TEST(block, mem(&m_drc->irq_pending), 1);                                   // test    [irq_pending],1
+	UML_EXHc(block, COND_NZ, *m_out_of_cycles, param);                              // exh     out_of_cycles,param,NZ
+}
+
+
+/*-------------------------------------------------
+    generate_checksum_block - generate code to
+    validate a sequence of opcodes
+-------------------------------------------------*/
+
+void i386_device::generate_checksum_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *seqhead, const opcode_desc *seqlast)
+{
+	if (m_drcuml->logging())
+		block.append_comment("[Validation for %08X]", seqhead->pc);                // comment
+
+	// sum every aligned dword the compiled instructions were decoded from
+	uint32_t sum = 0;
+	bool first = true;
+	offs_t lastaddr = ~0;
+	for (const opcode_desc *curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+	{
+		// interpreted instructions are fetched again when they run
+		if ((curdesc->flags & OPFLAG_VIRTUAL_NOOP) || (curdesc->userflags & I386_USERFLAG_INTERPRET))
+			continue;
+
+		const offs_t start = curdesc->physpc & ~3;
+		const offs_t count = (((curdesc->physpc & 3) + curdesc->length + 3) >> 2);
+		for (offs_t index = 0; index < count; index++)
+		{
+			const offs_t addr = start + (index << 2);
+			const void *base = m_program->get_write_ptr(addr);
+			if (addr == lastaddr || base == nullptr)
+				continue;
+			lastaddr = addr;
+
+			UML_LOAD(block, first ? I0 : I1, base, 0, SIZE_DWORD, SCALE_x1);         // load    i0/i1,base,0,dword
+			if (!first)
+				UML_ADD(block, I0, I0, I1);                                         // add     i0,i0,i1
+			sum += *(const uint32_t *)base;
+			first = false;
+		}
+	}
+
+	if (!first)
+	{
+		UML_CMP(block, I0, sum);                                                    // cmp     i0,sum
+		UML_EXHc(block, COND_NE, *m_nocode, seqhead->pc);                           // exne    nocode,seqhead->pc
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_sequence_instruction - generate code
+    for a single instruction in a sequence
+-------------------------------------------------*/
+
+void i386_device::generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	// add an entry for the log
+	if (m_drcuml->logging())
+		block.append_comment("%08X: %02X", desc->pc, desc->opptr.b[desc->userdata0]);   // comment
+
+	// set the PC map variable, and the cycles used by the instructions before this one
+	UML_MAPVAR(block, MAPVAR_PC, desc->pc);                                         // mapvar  PC,desc->pc
+	UML_MAPVAR(block, MAPVAR_CYCLES, compiler.cycles);                              // mapvar  CYCLES,compiler.cycles
+
+	// accumulate total cycles
+	compiler.cycles += desc->cycles;
+
+	// if we hit an unmapped address, let the interpreter take the fault
+	if (desc->flags & OPFLAG_COMPILER_PAGE_FAULT)
+	{
+		UML_EXH(block, *m_tlb_mismatch, desc->pc);                                  // exh     tlb_mismatch,pc
+		return;
+	}
+
+	// validate our TLB entry at this PC; if we fail, we need to handle it
+	if ((desc->flags & OPFLAG_VALIDATE_TLB) && (m_drc->mode & 1))
+	{
+		const vtlb_entry *tlbtable = vtlb_table();
+		const vtlb_entry entry = tlbtable[desc->pc >> 12];
+
+		// if we currently have a valid TLB entry, we just verify; a page becoming dirty doesn't matter
+		if (entry & FLAG_VALID)
+		{
+			UML_LOAD(block, I0, &tlbtable[desc->pc >> 12], 0, SIZE_DWORD, SCALE_x4);    // load    i0,tlbtable[desc->pc >> 12],0,dword
+			UML_AND(block, I0, I0, ~uint32_t(FLAG_DIRTY));                              // and     i0,i0,~FLAG_DIRTY
+			UML_CMP(block, I0, entry & ~uint32_t(FLAG_DIRTY));                          // cmp     i0,*tlbentry
+			UML_EXHc(block, COND_NE, *m_tlb_mismatch, desc->pc);                        // exh     tlb_mismatch,pc,NE
+		}
+
+		// otherwise, we generate an unconditional exception
+		else
+		{
+			UML_EXH(block, *m_tlb_mismatch, desc->pc);                              // exh     tlb_mismatch,pc
+			return;
+		}
+	}
+
+	// hand anything we don't compile to the interpreter
+	if ((desc->userflags & I386_USERFLAG_INTERPRET) || !generate_opcode(block, compiler, desc))
+		UML_EXH(block, *m_interpret, desc->pc);                                     // exh     interpret,pc
+}
+
+
+/*-------------------------------------------------
+    generate_branch - generate the code for a
+    taken branch to desc->targetpc, or to
+    [jmpdest] if the target is dynamic
+-------------------------------------------------*/
+
+void i386_device::generate_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t extra_cycles)
+{
+	compiler_state compiler_temp(compiler);
+
+	// the taken path pays the difference to the not-taken timing
+	compiler_temp.cycles += extra_cycles;
+
+	if (desc->targetpc != BRANCH_TARGET_DYNAMIC)
+	{
+		generate_update_cycles(block, compiler_temp, desc->targetpc);               // <subtract cycles>
+		UML_HASHJMP(block, m_drc->mode, desc->targetpc, *m_nocode);                 // hashjmp <mode>,targetpc,nocode
+	}
+	else
+	{
+		generate_update_cycles(block, compiler_temp, mem(&m_drc->jmpdest));         // <subtract cycles>
+		UML_HASHJMP(block, m_drc->mode, mem(&m_drc->jmpdest), *m_nocode);           // hashjmp <mode>,[jmpdest],nocode
+	}
+
+	// update the label
+	compiler.labelnum = compiler_temp.labelnum;
+}
+
+
+/*-------------------------------------------------
+    generate_ea - compute the effective address of
+    a memory operand; only dst is used as a
+    temporary
+-------------------------------------------------*/
+
+void i386_device::generate_ea(drcuml_block &block, uml::parameter dst, const drc_modrm &modrm)
+{
+	if (modrm.index >= 0)
+	{
+		if (modrm.scale != 0)
+		{
+			UML_SHL(block, dst, R32(modrm.index), modrm.scale);                     // shl     dst,index,scale
+			if (modrm.base >= 0)
+				UML_ADD(block, dst, dst, R32(modrm.base));                          // add     dst,dst,base
+		}
+		else if (modrm.base >= 0)
+			UML_ADD(block, dst, R32(modrm.base), R32(modrm.index));                 // add     dst,base,index
+		else
+			UML_MOV(block, dst, R32(modrm.index));                                  // mov     dst,index
+		if (modrm.disp != 0)
+			UML_ADD(block, dst, dst, modrm.disp);                                   // add     dst,dst,disp
+	}
+	else if (modrm.base >= 0)
+	{
+		if (modrm.disp != 0)
+			UML_ADD(block, dst, R32(modrm.base), modrm.disp);                       // add     dst,base,disp
+		else
+			UML_MOV(block, dst, R32(modrm.base));                                   // mov     dst,base
+	}
+	else
+		UML_MOV(block, dst, uint32_t(modrm.disp));                                  // mov     dst,disp
+}
+
+
+/*-------------------------------------------------
+    generate_read - read from memory; dst is only
+    written once the access has succeeded
+-------------------------------------------------*/
+
+void i386_device::generate_read(drcuml_block &block, const opcode_desc *desc, uml::parameter dst, uml::parameter address, int size)
+{
+	UML_MOV(block, mem(&m_drc->arg0), address);                                     // mov     [arg0],address
+	UML_CALLC(block, (size == 1) ? cfunc_read8 : (size == 2) ? cfunc_read16 : cfunc_read32, this);  // callc   read
+	UML_TEST(block, mem(&m_drc->fault), 1);                                         // test    [fault],1
+	UML_EXHc(block, COND_NZ, *m_interpret, desc->pc);                               // exh     interpret,pc,NZ
+	UML_MOV(block, dst, mem(&m_drc->arg1));                                         // mov     dst,[arg1]
+}
+
+
+/*-------------------------------------------------
+    generate_write - write a dword to memory
+-------------------------------------------------*/
+
+void i386_device::generate_write(drcuml_block &block, const opcode_desc *desc, uml::parameter address, uml::parameter src)
+{
+	UML_MOV(block, mem(&m_drc->arg0), address);                                     // mov     [arg0],address
+	UML_MOV(block, mem(&m_drc->arg1), src);                                         // mov     [arg1],src
+	UML_CALLC(block, cfunc_write32, this);                                          // callc   write32
+	UML_TEST(block, mem(&m_drc->fault), 1);                                         // test    [fault],1
+	UML_EXHc(block, COND_NZ, *m_interpret, desc->pc);                               // exh     interpret,pc,NZ
+}
+
+
+/*-------------------------------------------------
+    generate_push - push a dword; ESP is updated
+    after the write so a fault leaves it intact
+-------------------------------------------------*/
+
+void i386_device::generate_push(drcuml_block &block, const opcode_desc *desc, uml::parameter src)
+{
+	UML_SUB(block, I3, R32(ESP), 4);                                                // sub     i3,esp,4
+	generate_write(block, desc, I3, src);                                           // <write i3,src>
+	UML_MOV(block, R32(ESP), I3);                                                   // mov     esp,i3
+}
+
+
+/*-------------------------------------------------
+    generate_alu - compute i2 = i0 <op> i1, along
+    with the flags unless setflags is false
+-------------------------------------------------*/
+
+void i386_device::generate_alu(drcuml_block &block, int aluop, bool setflags)
+{
+	switch (aluop)
+	{
+		case ALU_ADD:
+		case ALU_INC:
+			UML_ADD(block, I2, I0, I1);                                             // add     i2,i0,i1
+			break;
+
+		case ALU_OR:
+			UML_OR(block, I2, I0, I1);                                              // or      i2,i0,i1
+			break;
+
+		case ALU_ADC:
+			UML_CARRY(block, FLAG(cf), 0);                                          // carry   [cf],0
+			UML_ADDC(block, I2, I0, I1);                                            // addc    i2,i0,i1
+			break;
+
+		case ALU_SBB:
+			UML_CARRY(block, FLAG(cf), 0);                                          // carry   [cf],0
+			UML_SUBB(block, I2, I0, I1);                                            // subb    i2,i0,i1
+			break;
+
+		case ALU_AND:
+		case ALU_TEST:
+			UML_AND(block, I2, I0, I1);                                             // and     i2,i0,i1
+			break;
+
+		case ALU_SUB:
+		case ALU_CMP:
+		case ALU_DEC:
+			UML_SUB(block, I2, I0, I1);                                             // sub     i2,i0,i1
+			break;
+
+		case ALU_XOR:
+			UML_XOR(block, I2, I0, I1);                                             // xor     i2,i0,i1
+			break;
+	}
+	if (!setflags)
+		return;
+
+	// capture the host flags first; SET leaves them intact
+	if (is_logic_op(aluop))
+	{
+		UML_SETc(block, COND_Z, FLAG(zf));                                          // setz    [zf]
+		UML_SETc(block, COND_S, FLAG(sf));                                          // sets    [sf]
+		UML_MOV(block, FLAG(cf), 0);                                                // mov     [cf],0
+		UML_MOV(block, FLAG(of), 0);                                                // mov     [of],0
+	}
+	else
+	{
+		if (aluop != ALU_INC && aluop != ALU_DEC)
+			UML_SETc(block, COND_C, FLAG(cf));                                      // setc    [cf]
+		UML_SETc(block, COND_V, FLAG(of));                                          // setv    [of]
+		UML_SETc(block, COND_Z, FLAG(zf));                                          // setz    [zf]
+		UML_SETc(block, COND_S, FLAG(sf));                                          // sets    [sf]
+
+		// AF is the carry out of bit 3
+		UML_XOR(block, I3, I0, I1);                                                 // xor     i3,i0,i1
+		UML_XOR(block, I3, I3, I2);                                                 // xor     i3,i3,i2
+		UML_SHR(block, I3, I3, 4);                                                  // shr     i3,i3,4
+		UML_AND(block, FLAG(af), I3, 1);                                            // and     [af],i3,1
+	}
+
+	// PF comes from the low byte of the result
+	UML_AND(block, I3, I2, 0xff);                                                   // and     i3,i2,0xff
+	UML_LOAD(block, FLAG(pf), m_drc->parity, I3, SIZE_BYTE, SCALE_x1);              // load    [pf],parity,i3,byte
+}
+
+
+/*-------------------------------------------------
+    generate_alu_rm - apply an ALU operation to a
+    register or memory destination with i1 as the
+    source operand
+-------------------------------------------------*/
+
+void i386_device::generate_alu_rm(drcuml_block &block, const opcode_desc *desc, const drc_modrm &modrm, int aluop)
+{
+	const bool store = (aluop != ALU_CMP && aluop != ALU_TEST);
+
+	if (modrm.mod == 3)
+	{
+		UML_MOV(block, I0, R32(modrm.rm));                                          // mov     i0,rm
+		generate_alu(block, aluop, true);                                           // <alu>
+		if (store)
+			UML_MOV(block, R32(modrm.rm), I2);                                      // mov     rm,i2
+		return;
+	}
+
+	generate_ea(block, I4, modrm);                                                  // <ea i4>
+	generate_read(block, desc, I0, I4, 4);                                          // <read i0,[i4]>
+	if (!store)
+	{
+		generate_alu(block, aluop, true);                                           // <alu>
+		return;
+	}
+
+	// the flags are only computed once the write can no longer fault, so
+	// that the interpreter sees the original carry if it re-executes
+	generate_alu(block, aluop, false);                                              // <alu>
+	generate_write(block, desc, I4, I2);                                            // <write [i4],i2>
+	generate_alu(block, aluop, true);                                               // <alu with flags>
+}
+
+
+/*-------------------------------------------------
+    generate_condition - test the flags for a
+    condition code; returns the UML condition
+    that is true when the branch is taken
+-------------------------------------------------*/
+
+uml::condition_t i386_device::generate_condition(drcuml_block &block, int cc)
+{
+	switch ((cc >> 1) & 7)
+	{
+		case 0:         // O
+			UML_TEST(block, FLAG(of), 1);                                           // test    [of],1
+			break;
+
+		case 1:         // B
+			UML_TEST(block, FLAG(cf), 1);                                           // test    [cf],1
+			break;
+
+		case 2:         // Z
+			UML_TEST(block, FLAG(zf), 1);                                           // test    [zf],1
+			break;
+
+		case 3:         // BE
+			UML_OR(block, I0, FLAG(cf), FLAG(zf));                                  // or      i0,[cf],[zf]
+			break;
+
+		case 4:         // S
+			UML_TEST(block, FLAG(sf), 1);                                           // test    [sf],1
+			break;
+
+		case 5:         // P
+			UML_TEST(block, FLAG(pf), 1);                                           // test    [pf],1
+			break;
+
+		case 6:         // L
+			UML_XOR(block, I0, FLAG(sf), FLAG(of));                                 // xor     i0,[sf],[of]
+			break;
+
+		case 7:         // LE
+			UML_XOR(block, I0, FLAG(sf), FLAG(of));                                 // xor     i0,[sf],[of]
+			UML_OR(block, I0, I0, FLAG(zf));                                        // or      i0,i0,[zf]
+			break;
+	}
+
+	// odd condition codes are the negated form
+	return (cc & 1) ? COND_Z : COND_NZ;
+}
+
+
+/*-------------------------------------------------
+    generate_opcode - generate code for a specific
+    opcode; returns false before emitting anything
+    if the instruction can't be compiled
+-------------------------------------------------*/
+
+bool i386_device::generate_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	const uint8_t *const bytes = desc->opptr.b;
+	const uint32_t nextpc = desc->pc + desc->length;
+	int pos = desc->userdata0;
+	drc_modrm modrm;
+
+	const uint8_t op = bytes[pos++];
+	switch (op)
+	{
+		case 0x01: case 0x09: case 0x11: case 0x19: case 0x21: case 0x29: case 0x31: case 0x39:     // ALU Ev,Gv
+			if (!drc_decode_modrm(&bytes[pos], desc->length - pos, modrm))
+				return false;
+			UML_MOV(block, I1, R32(modrm.reg));                                     // mov     i1,reg
+			generate_alu_rm(block, desc, modrm, (op >> 3) & 7);                     // <alu rm,i1>
+			return true;
+
+		case 0x03: case 0x0b: case 0x13: case 0x1b: case 0x23: case 0x2b: case 0x33: case 0x3b:     // ALU Gv,Ev
+		{
+			const int aluop = (op >> 3) & 7;
+			if (!drc_decode_modrm(&bytes[pos], desc->length - pos, modrm))
+				return false;
+			if (modrm.mod == 3)
+				UML_MOV(block, I1, R32(modrm.rm));                                  // mov     i1,rm
+			else
+			{
+				generate_ea(block, I4, modrm);                                      // <ea i4>
+				generate_read(block, desc, I1, I4, 4);                              // <read i1,[i4]>
+			}
+			UML_MOV(block, I0, R32(modrm.reg));                                     // mov     i0,reg
+			generate_alu(block, aluop, true);                                       // <alu>
+			if (aluop != ALU_CMP)
+				UML_MOV(block, R32(modrm.reg), I2);                                 // mov     reg,i2
+			return true;
+		}
+
+		case 0x05: case 0x0d: case 0x15: case 0x1d: case 0x25: case 0x2d: case 0x35: case 0x3d:     // ALU eAX,Iz
+		case 0xa9:                                                                                  // TEST eAX,Iz
+		{
+			const drc_modrm acc = { 3, 0, EAX, -1, -1, 0, 0, 1 };
+			UML_MOV(block, I1, i386_fetch_le(&bytes[pos], 4));                           // mov     i1,imm
+			generate_alu_rm(block, desc, acc, (op == 0xa9) ? ALU_TEST : ((op >> 3) & 7));  // <alu eax,i1>
+			return true;
+		}
+
+		case 0x0f:
+		{
+			const uint8_t op2 = bytes[pos++];
+			if (op2 >= 0x80 && op2 <= 0x8f)                                         // Jcc rel32
+			{
+				const uml::code_label skip = compiler.labelnum++;
+				const uml::condition_t cond = generate_condition(block, op2 & 0x0f);
+				UML_JMPc(block, (cond == COND_Z) ? COND_NZ : COND_Z, skip);         // jmp     skip,!cond
+				generate_branch(block, compiler, desc, m_cycle_table_pm[CYCLES_JCC_FULL_DISP] - m_cycle_table_pm[CYCLES_JCC_FULL_DISP_NOBRANCH]);
+				UML_LABEL(block, skip);                                             // skip:
+				return true;
+			}
+
+			// MOVZX/MOVSX Gv,Eb/Ew
+			const bool word = (op2 & 1) != 0;
+			const bool sign = (op2 & 0x08) != 0;
+			if (!drc_decode_modrm(&bytes[pos], desc->length - pos, modrm))
+				return false;
+			if (modrm.mod != 3)
+			{
+				generate_ea(block, I4, modrm);                                      // <ea i4>
+				generate_read(block, desc, I0, I4, word ? 2 : 1);                   // <read i0,[i4]>
+			}
+			else if (word)
+				UML_AND(block, I0, R32(modrm.rm), 0xffff);                          // and     i0,rm,0xffff
+			else if (modrm.rm < 4)
+				UML_AND(block, I0, R32(modrm.rm), 0xff);                            // and     i0,rm,0xff
+			else
+			{
+				UML_SHR(block, I0, R32(modrm.rm & 3), 8);                           // shr     i0,rm,8
+				UML_AND(block, I0, I0, 0xff);                                       // and     i0,i0,0xff
+			}
+			if (sign)
+				UML_SEXT(block, I0, I0, word ? SIZE_WORD : SIZE_BYTE);              // sext    i0,i0,size
+			UML_MOV(block, R32(modrm.reg), I0);                                     // mov     reg,i0
+			return true;
+		}
+
+		case 0x40: case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47:     // INC r32
+		case 0x48: case 0x49: case 0x4a: case 0x4b: case 0x4c: case 0x4d: case 0x4e: case 0x4f:     // DEC r32
+		{
+			const drc_modrm reg = { 3, 0, uint8_t(op & 7), -1, -1, 0, 0, 1 };
+			UML_MOV(block, I1, 1);                                                  // mov     i1,1
+			generate_alu_rm(block, desc, reg, (op & 8) ? ALU_DEC : ALU_INC);        // <inc/dec reg>
+			return true;
+		}
+
+		case 0x50: case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57:     // PUSH r32
+			generate_push(block, desc, R32(op & 7));                                // <push reg>
+			return true;
+
+		case 0x58: case 0x59: case 0x5a: case 0x5b: case 0x5c: case 0x5d: case 0x5e: case 0x5f:     // POP r32
+			generate_read(block, desc, I0, R32(ESP), 4);                            // <read i0,[esp]>
+			UML_ADD(block, R32(ESP), R32(ESP), 4);                                  // add     esp,esp,4
+			UML_MOV(block, R32(op & 7), I0);                                        // mov     reg,i0
+			return true;
+
+		case 0x68:      // PUSH Iz
+			generate_push(block, desc, i386_fetch_le(&bytes[pos], 4));                   // <push imm>
+			return true;
+
+		case 0x6a:      // PUSH Ib
+			generate_push(block, desc, uint32_t(int8_t(bytes[pos])));               // <push imm>
+			return true;
+
+		case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77:     // Jcc rel8
+		case 0x78: case 0x79: case 0x7a: case 0x7b: case 0x7c: case 0x7d: case 0x7e: case 0x7f:
+		{
+			const uml::code_label skip = compiler.labelnum++;
+			const uml::condition_t cond = generate_condition(block, op & 0x0f);
+			UML_JMPc(block, (cond == COND_Z) ? COND_NZ : COND_Z, skip);             // jmp     skip,!cond
+			generate_branch(block, compiler, desc, m_cycle_table_pm[CYCLES_JCC_DISP8] - m_cycle_table_pm[CYCLES_JCC_DISP8_NOBRANCH]);
+			UML_LABEL(block, skip);                                                 // skip:
+			return true;
+		}
+
+		case 0x81:      // ALU Ev,Iz
+		case 0x83:      // ALU Ev,Ib
+			if (!drc_decode_modrm(&bytes[pos], desc->length - pos, modrm))
+				return false;
+			pos += modrm.length;
+			UML_MOV(block, I1, (op == 0x81) ? i386_fetch_le(&bytes[pos], 4) : uint32_t(int8_t(bytes[pos])));   // mov     i1,imm
+			generate_alu_rm(block, desc, modrm, modrm.reg);                         // <alu rm,i1>
+			return true;
+
+		case 0x85:      // TEST Ev,Gv
+			if (!drc_decode_modrm(&bytes[pos], desc->length - pos, modrm))
+				return false;
+			UML_MOV(block, I1, R32(modrm.reg));                                     // mov     i1,reg
+			generate_alu_rm(block, desc, modrm, ALU_TEST);                          // <test rm,i1>
+			return true;
+
+		case 0x89:      // MOV Ev,Gv
+			if (!drc_decode_modrm(&bytes[pos], desc->length - pos, modrm))
+				return false;
+			if (modrm.mod == 3)
+				UML_MOV(block, R32(modrm.rm), R32(modrm.reg));                      // mov     rm,reg
+			else
+			{
+				generate_ea(block, I4, modrm);                                      // <ea i4>
+				generate_write(block, desc, I4, R32(modrm.reg));                    // <write [i4],reg>
+			}
+			return true;
+
+		case 0x8b:      // MOV Gv,Ev
+			if (!drc_decode_modrm(&bytes[pos], desc->length - pos, modrm))
+				return false;
+			if (modrm.mod == 3)
+				UML_MOV(block, R32(modrm.reg), R32(modrm.rm));                      // mov     reg,rm
+			else
+			{
+				generate_ea(block, I4, modrm);                                      // <ea i4>
+				generate_read(block, desc, R32(modrm.reg), I4, 4);                  // <read reg,[i4]>
+			}
+			return true;
+
+		case 0x8d:      // LEA Gv,M
+			if (!drc_decode_modrm(&bytes[pos], desc->length - pos, modrm))
+				return false;
+			generate_ea(block, I0, modrm);                                          // <ea i0>
+			UML_MOV(block, R32(modrm.reg), I0);                                     // mov     reg,i0
+			return true;
+
+		case 0x90:      // NOP
+			return true;
+
+		case 0xb8: case 0xb9: case 0xba: case 0xbb: case 0xbc: case 0xbd: case 0xbe: case 0xbf:     // MOV r32,Iz
+			UML_MOV(block, R32(op & 7), i386_fetch_le(&bytes[pos], 4));                  // mov     reg,imm
+			return true;
+
+		case 0xc3:      // RET
+			generate_read(block, desc, I0, R32(ESP), 4);                            // <read i0,[esp]>
+			UML_ADD(block, R32(ESP), R32(ESP), 4);                                  // add     esp,esp,4
+			UML_MOV(block, mem(&m_drc->jmpdest), I0);                               // mov     [jmpdest],i0
+			generate_branch(block, compiler, desc, 0);                              // <branch [jmpdest]>
+			return true;
+
+		case 0xc7:      // MOV Ev,Iz
+			if (!drc_decode_modrm(&bytes[pos], desc->length - pos, modrm))
+				return false;
+			pos += modrm.length;
+			if (modrm.mod == 3)
+				UML_MOV(block, R32(modrm.rm), i386_fetch_le(&bytes[pos], 4));            // mov     rm,imm
+			else
+			{
+				generate_ea(block, I4, modrm);                                      // <ea i4>
+				generate_write(block, desc, I4, i386_fetch_le(&bytes[pos], 4));          // <write [i4],imm>
+			}
+			return true;
+
+		case 0xe8:      // CALL rel32
+			generate_push(block, desc, nextpc);                                     // <push nextpc>
+			generate_branch(block, compiler, desc, 0);                              // <branch targetpc>
+			return true;
+
+		case 0xe9:      // JMP rel32
+		case 0xeb:      // JMP rel8
+			generate_branch(block, compiler, desc, 0);                              // <branch targetpc>
+			return true;
+
+		case 0xff:
+			if (!drc_decode_modrm(&bytes[pos], desc->length - pos, modrm))
+				return false;
+			switch (modrm.reg)
+			{
+				case 0:     // INC Ev
+				case 1:     // DEC Ev
+					UML_MOV(block, I1, 1);                                          // mov     i1,1
+					generate_alu_rm(block, desc, modrm, modrm.reg ? ALU_DEC : ALU_INC); // <inc/dec rm>
+					return true;
+
+				case 2:     // CALL Ev
+				case 4:     // JMP Ev
+					if (modrm.mod == 3)
+						UML_MOV(block, I0, R32(modrm.rm));                          // mov     i0,rm
+					else
+					{
+						generate_ea(block, I4, modrm);                              // <ea i4>
+						generate_read(block, desc, I0, I4, 4);                      // <read i0,[i4]>
+					}
+					if (modrm.reg == 2)
+						generate_push(block, desc, nextpc);                         // <push nextpc>
+					UML_MOV(block, mem(&m_drc->jmpdest), I0);                       // mov     [jmpdest],i0
+					generate_branch(block, compiler, desc, 0);                      // <branch [jmpdest]>
+					return true;
+
+				case 6:     // PUSH Ev
+					if (modrm.mod == 3)
+						UML_MOV(block, I0, R32(modrm.rm));                          // mov     i0,rm
+					else
+					{
+						generate_ea(block, I4, modrm);                              // <ea i4>
+						generate_read(block, desc, I0, I4, 4);                      // <read i0,[i4]>
+					}
+					generate_push(block, desc, I0);                                 // <push i0>
+					return true;
+			}
+			return false;
+	}
+	return false;
+}
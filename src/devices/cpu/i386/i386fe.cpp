@@ -0,0 +1,542 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    i386fe.cpp
+
+    Front-end for i386 recompiler
+
+    Only the 32-bit flat protected mode subset that the recompiler
+    generates code for is described in detail; every other instruction
+    ends its sequence and is handed back to the interpreter.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "i386.h"
+#include "i386priv.h"
+#include "i386fe.h"
+
+
+//**************************************************************************
+//  INLINE FUNCTIONS
+//**************************************************************************
+
+//-------------------------------------------------
+//  jcc_flags - return the flags read by each
+//  condition code
+//-------------------------------------------------
+
+static inline uint32_t jcc_flags(int cc)
+{
+	static const uint32_t flags[8] =
+	{
+		REGFLAG_OF,
+		REGFLAG_CF,
+		REGFLAG_ZF,
+		REGFLAG_CF | REGFLAG_ZF,
+		REGFLAG_SF,
+		REGFLAG_PF,
+		REGFLAG_SF | REGFLAG_OF,
+		REGFLAG_ZF | REGFLAG_SF | REGFLAG_OF
+	};
+	return flags[(cc >> 1) & 7];
+}
+
+
+
+//**************************************************************************
+//  OPERAND DECODING
+//**************************************************************************
+
+//-------------------------------------------------
+//  drc_decode_modrm - decode a 32-bit ModRM
+//  operand; shared by the front-end and the
+//  code generator, returns false if the operand
+//  runs past the available bytes
+//-------------------------------------------------
+
+bool i386_device::drc_decode_modrm(const uint8_t *bytes, int avail, drc_modrm &modrm)
+{
+	if (avail < 1)
+		return false;
+
+	modrm.mod = bytes[0] >> 6;
+	modrm.reg = (bytes[0] >> 3) & 7;
+	modrm.rm = bytes[0] & 7;
+	modrm.base = -1;
+	modrm.index = -1;
+	modrm.scale = 0;
+	modrm.disp = 0;
+	modrm.length = 1;
+	if (modrm.mod == 3)
+		return true;
+
+	// pick up the SIB byte if present
+	int base = modrm.rm;
+	if (modrm.rm == 4)
+	{
+		if (avail < 2)
+			return false;
+		modrm.scale = bytes[1] >> 6;
+		modrm.index = ((bytes[1] >> 3) & 7) != ESP ? ((bytes[1] >> 3) & 7) : -1;
+		base = bytes[1] & 7;
+		modrm.length = 2;
+	}
+
+	// mod 0 with EBP as the base means a bare 32-bit displacement
+	int dispsize = (modrm.mod == 1) ? 1 : (modrm.mod == 2) ? 4 : 0;
+	if (modrm.mod == 0 && base == EBP)
+		dispsize = 4;
+	else
+		modrm.base = base;
+
+	if (modrm.length + dispsize > avail)
+		return false;
+	if (dispsize == 1)
+		modrm.disp = int8_t(bytes[modrm.length]);
+	else if (dispsize == 4)
+		modrm.disp = int32_t(i386_fetch_le(&bytes[modrm.length], 4));
+	modrm.length += dispsize;
+	return true;
+}
+
+
+
+//**************************************************************************
+//  I386 FRONTEND
+//**************************************************************************
+
+//-------------------------------------------------
+//  i386_frontend - constructor
+//-------------------------------------------------
+
+i386_frontend::i386_frontend(i386_device *i386, uint32_t window_start, uint32_t window_end, uint32_t max_sequence)
+	: drc_frontend(*i386, window_start, window_end, max_sequence),
+		m_i386(i386)
+{
+}
+
+
+//-------------------------------------------------
+//  describe - build a description of a single
+//  instruction
+//-------------------------------------------------
+
+bool i386_frontend::describe(opcode_desc &desc, const opcode_desc *prev)
+{
+	const uint8_t *cycles = m_i386->m_cycle_table_pm;
+	i386_device::drc_modrm modrm;
+
+	// compute the physical PC
+	uint32_t error;
+	if (!m_i386->translate_address(m_i386->m_CPL, device_memory_interface::TR_FETCH, &desc.physpc, &error))
+	{
+		// page fault: leave the description empty and let the interpreter take the fault
+		desc.flags |= OPFLAG_VALIDATE_TLB | OPFLAG_CAN_CAUSE_EXCEPTION | OPFLAG_COMPILER_PAGE_FAULT | OPFLAG_VIRTUAL_NOOP | OPFLAG_END_SEQUENCE;
+		return true;
+	}
+
+	// fetch as many bytes as the longest instruction without leaving the page;
+	// anything that would cross into the next page is interpreted
+	const int avail = std::min<int>(15, 0x1000 - (desc.physpc & 0xfff));
+	const uint8_t *const bytes = desc.opptr.b;
+	for (int i = 0; i < avail; i++)
+		desc.opptr.b[i] = m_i386->mem_pr8(desc.physpc + i);
+
+	// segment overrides are no-ops while the data segments are flat
+	int pos = 0;
+	while (pos < avail && (bytes[pos] == 0x26 || bytes[pos] == 0x2e || bytes[pos] == 0x36 || bytes[pos] == 0x3e))
+		pos++;
+	if (pos >= avail)
+		return describe_interpret(desc);
+	desc.userdata0 = pos;
+
+	// parse the instruction
+	const uint8_t op = bytes[pos++];
+	switch (op)
+	{
+		case 0x01: case 0x09: case 0x11: case 0x19: case 0x21: case 0x29: case 0x31: case 0x39:     // ALU Ev,Gv
+		case 0x03: case 0x0b: case 0x13: case 0x1b: case 0x23: case 0x2b: case 0x33: case 0x3b:     // ALU Gv,Ev
+		{
+			const int aluop = (op >> 3) & 7;
+			if (!i386_device::drc_decode_modrm(&bytes[pos], avail - pos, modrm))
+				return describe_interpret(desc);
+			pos += modrm.length;
+			desc.regin[0] |= REGFLAG_R(modrm.reg);
+			desc.regout[1] |= (aluop == 1 || aluop == 4 || aluop == 6) ? REGFLAG_LOGIC : REGFLAG_ARITH;
+			if (aluop == 2 || aluop == 3)
+				desc.regin[1] |= REGFLAG_CF;
+			if (modrm.mod == 3)
+			{
+				// xor/sub of a register with itself doesn't depend on its value
+				if (modrm.reg == modrm.rm && (aluop == 5 || aluop == 6))
+					desc.regin[0] = 0;
+				else
+					desc.regin[0] |= REGFLAG_R(modrm.rm);
+				if (aluop != 7)
+					desc.regout[0] |= REGFLAG_R((op & 2) ? modrm.reg : modrm.rm);
+				desc.cycles = cycles[(aluop == 7) ? CYCLES_CMP_REG_REG : CYCLES_ALU_REG_REG];
+			}
+			else
+			{
+				describe_modrm(desc, modrm, true, !(op & 2) && aluop != 7);
+				if (op & 2)
+				{
+					if (aluop != 7)
+						desc.regout[0] |= REGFLAG_R(modrm.reg);
+					desc.cycles = cycles[(aluop == 7) ? CYCLES_CMP_MEM_REG : CYCLES_ALU_MEM_REG];
+				}
+				else
+					desc.cycles = cycles[(aluop == 7) ? CYCLES_CMP_REG_MEM : CYCLES_ALU_REG_MEM];
+			}
+			break;
+		}
+
+		case 0x05: case 0x0d: case 0x15: case 0x1d: case 0x25: case 0x2d: case 0x35: case 0x3d:     // ALU eAX,Iz
+		{
+			const int aluop = (op >> 3) & 7;
+			pos += 4;
+			desc.regin[0] |= REGFLAG_R(EAX);
+			if (aluop != 7)
+				desc.regout[0] |= REGFLAG_R(EAX);
+			desc.regout[1] |= (aluop == 1 || aluop == 4 || aluop == 6) ? REGFLAG_LOGIC : REGFLAG_ARITH;
+			if (aluop == 2 || aluop == 3)
+				desc.regin[1] |= REGFLAG_CF;
+			desc.cycles = cycles[(aluop == 7) ? CYCLES_CMP_IMM_ACC : CYCLES_ALU_IMM_ACC];
+			break;
+		}
+
+		case 0x0f:
+		{
+			if (pos >= avail)
+				return describe_interpret(desc);
+			const uint8_t op2 = bytes[pos++];
+			switch (op2)
+			{
+				case 0x80: case 0x81: case 0x82: case 0x83: case 0x84: case 0x85: case 0x86: case 0x87:     // Jcc rel32
+				case 0x88: case 0x89: case 0x8a: case 0x8b: case 0x8c: case 0x8d: case 0x8e: case 0x8f:
+					if (pos + 4 > avail)
+						return describe_interpret(desc);
+					desc.regin[1] |= jcc_flags(op2 & 0x0f);
+					desc.targetpc = desc.pc + pos + 4 + int32_t(i386_fetch_le(&bytes[pos], 4));
+					desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+					desc.cycles = cycles[CYCLES_JCC_FULL_DISP_NOBRANCH];
+					pos += 4;
+					break;
+
+				case 0xb6: case 0xb7: case 0xbe: case 0xbf:     // MOVZX/MOVSX Gv,Eb/Ew
+				{
+					const bool sign = (op2 & 0x08) != 0;
+					if (!i386_device::drc_decode_modrm(&bytes[pos], avail - pos, modrm))
+						return describe_interpret(desc);
+					pos += modrm.length;
+					desc.regout[0] |= REGFLAG_R(modrm.reg);
+					if (modrm.mod == 3)
+					{
+						desc.regin[0] |= REGFLAG_R((op2 & 1) ? modrm.rm : (modrm.rm & 3));
+						desc.cycles = cycles[sign ? CYCLES_MOVSX_REG_REG : CYCLES_MOVZX_REG_REG];
+					}
+					else
+					{
+						describe_modrm(desc, modrm, true, false);
+						desc.cycles = cycles[sign ? CYCLES_MOVSX_MEM_REG : CYCLES_MOVZX_MEM_REG];
+					}
+					break;
+				}
+
+				default:
+					return describe_interpret(desc);
+			}
+			break;
+		}
+
+		case 0x40: case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47:     // INC r32
+		case 0x48: case 0x49: case 0x4a: case 0x4b: case 0x4c: case 0x4d: case 0x4e: case 0x4f:     // DEC r32
+			desc.regin[0] |= REGFLAG_R(op & 7);
+			desc.regout[0] |= REGFLAG_R(op & 7);
+			desc.regout[1] |= REGFLAG_INCDEC;
+			desc.cycles = cycles[(op & 8) ? CYCLES_DEC_REG : CYCLES_INC_REG];
+			break;
+
+		case 0x50: case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57:     // PUSH r32
+			desc.regin[0] |= REGFLAG_R(op & 7) | REGFLAG_R(ESP);
+			desc.regout[0] |= REGFLAG_R(ESP);
+			desc.flags |= OPFLAG_WRITES_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+			desc.cycles = cycles[CYCLES_PUSH_REG_SHORT];
+			break;
+
+		case 0x58: case 0x59: case 0x5a: case 0x5b: case 0x5c: case 0x5d: case 0x5e: case 0x5f:     // POP r32
+			desc.regin[0] |= REGFLAG_R(ESP);
+			desc.regout[0] |= REGFLAG_R(op & 7) | REGFLAG_R(ESP);
+			desc.flags |= OPFLAG_READS_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+			desc.cycles = cycles[CYCLES_POP_REG_SHORT];
+			break;
+
+		case 0x68:      // PUSH Iz
+		case 0x6a:      // PUSH Ib
+			pos += (op == 0x68) ? 4 : 1;
+			desc.regin[0] |= REGFLAG_R(ESP);
+			desc.regout[0] |= REGFLAG_R(ESP);
+			desc.flags |= OPFLAG_WRITES_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+			desc.cycles = cycles[CYCLES_PUSH_IMM];
+			break;
+
+		case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77:     // Jcc rel8
+		case 0x78: case 0x79: case 0x7a: case 0x7b: case 0x7c: case 0x7d: case 0x7e: case 0x7f:
+			if (pos + 1 > avail)
+				return describe_interpret(desc);
+			desc.regin[1] |= jcc_flags(op & 0x0f);
+			desc.targetpc = desc.pc + pos + 1 + int8_t(bytes[pos]);
+			desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+			desc.cycles = cycles[CYCLES_JCC_DISP8_NOBRANCH];
+			pos += 1;
+			break;
+
+		case 0x81:      // ALU Ev,Iz
+		case 0x83:      // ALU Ev,Ib
+		{
+			if (!i386_device::drc_decode_modrm(&bytes[pos], avail - pos, modrm))
+				return describe_interpret(desc);
+			const int aluop = modrm.reg;
+			pos += modrm.length + ((op == 0x81) ? 4 : 1);
+			desc.regout[1] |= (aluop == 1 || aluop == 4 || aluop == 6) ? REGFLAG_LOGIC : REGFLAG_ARITH;
+			if (aluop == 2 || aluop == 3)
+				desc.regin[1] |= REGFLAG_CF;
+			if (modrm.mod == 3)
+			{
+				desc.regin[0] |= REGFLAG_R(modrm.rm);
+				if (aluop != 7)
+					desc.regout[0] |= REGFLAG_R(modrm.rm);
+				desc.cycles = cycles[(aluop == 7) ? CYCLES_CMP_REG_REG : CYCLES_ALU_REG_REG];
+			}
+			else
+			{
+				describe_modrm(desc, modrm, true, aluop != 7);
+				desc.cycles = cycles[(aluop == 7) ? CYCLES_CMP_REG_MEM : CYCLES_ALU_REG_MEM];
+			}
+			break;
+		}
+
+		case 0x85:      // TEST Ev,Gv
+			if (!i386_device::drc_decode_modrm(&bytes[pos], avail - pos, modrm))
+				return describe_interpret(desc);
+			pos += modrm.length;
+			desc.regin[0] |= REGFLAG_R(modrm.reg);
+			desc.regout[1] |= REGFLAG_LOGIC;
+			if (modrm.mod == 3)
+			{
+				desc.regin[0] |= REGFLAG_R(modrm.rm);
+				desc.cycles = cycles[CYCLES_TEST_REG_REG];
+			}
+			else
+			{
+				describe_modrm(desc, modrm, true, false);
+				desc.cycles = cycles[CYCLES_TEST_REG_MEM];
+			}
+			break;
+
+		case 0x89:      // MOV Ev,Gv
+		case 0x8b:      // MOV Gv,Ev
+			if (!i386_device::drc_decode_modrm(&bytes[pos], avail - pos, modrm))
+				return describe_interpret(desc);
+			pos += modrm.length;
+			if (modrm.mod == 3)
+			{
+				desc.regin[0] |= REGFLAG_R((op == 0x89) ? modrm.reg : modrm.rm);
+				desc.regout[0] |= REGFLAG_R((op == 0x89) ? modrm.rm : modrm.reg);
+				desc.cycles = cycles[CYCLES_MOV_REG_REG];
+			}
+			else if (op == 0x89)
+			{
+				desc.regin[0] |= REGFLAG_R(modrm.reg);
+				describe_modrm(desc, modrm, false, true);
+				desc.cycles = cycles[CYCLES_MOV_REG_MEM];
+			}
+			else
+			{
+				desc.regout[0] |= REGFLAG_R(modrm.reg);
+				describe_modrm(desc, modrm, true, false);
+				desc.cycles = cycles[CYCLES_MOV_MEM_REG];
+			}
+			break;
+
+		case 0x8d:      // LEA Gv,M
+			if (!i386_device::drc_decode_modrm(&bytes[pos], avail - pos, modrm) || modrm.mod == 3)
+				return describe_interpret(desc);
+			pos += modrm.length;
+			describe_modrm(desc, modrm, false, false);
+			desc.regout[0] |= REGFLAG_R(modrm.reg);
+			desc.cycles = cycles[CYCLES_LEA];
+			break;
+
+		case 0x90:      // NOP
+			desc.cycles = cycles[CYCLES_NOP];
+			break;
+
+		case 0xa9:      // TEST eAX,Iz
+			pos += 4;
+			desc.regin[0] |= REGFLAG_R(EAX);
+			desc.regout[1] |= REGFLAG_LOGIC;
+			desc.cycles = cycles[CYCLES_TEST_IMM_ACC];
+			break;
+
+		case 0xb8: case 0xb9: case 0xba: case 0xbb: case 0xbc: case 0xbd: case 0xbe: case 0xbf:     // MOV r32,Iz
+			pos += 4;
+			desc.regout[0] |= REGFLAG_R(op & 7);
+			desc.cycles = cycles[CYCLES_MOV_IMM_REG];
+			break;
+
+		case 0xc3:      // RET
+			desc.regin[0] |= REGFLAG_R(ESP);
+			desc.regout[0] |= REGFLAG_R(ESP);
+			desc.flags |= OPFLAG_READS_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION | OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+			desc.cycles = cycles[CYCLES_RET];
+			break;
+
+		case 0xc7:      // MOV Ev,Iz
+			if (!i386_device::drc_decode_modrm(&bytes[pos], avail - pos, modrm) || modrm.reg != 0)
+				return describe_interpret(desc);
+			pos += modrm.length + 4;
+			if (modrm.mod == 3)
+			{
+				desc.regout[0] |= REGFLAG_R(modrm.rm);
+				desc.cycles = cycles[CYCLES_MOV_IMM_REG];
+			}
+			else
+			{
+				describe_modrm(desc, modrm, false, true);
+				desc.cycles = cycles[CYCLES_MOV_IMM_MEM];
+			}
+			break;
+
+		case 0xe8:      // CALL rel32
+		case 0xe9:      // JMP rel32
+		case 0xeb:      // JMP rel8
+		{
+			const int dispsize = (op == 0xeb) ? 1 : 4;
+			if (pos + dispsize > avail)
+				return describe_interpret(desc);
+			const int32_t disp = (op == 0xeb) ? int8_t(bytes[pos]) : int32_t(i386_fetch_le(&bytes[pos], 4));
+			pos += dispsize;
+			desc.targetpc = desc.pc + pos + disp;
+			desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+			if (op == 0xe8)
+			{
+				desc.regin[0] |= REGFLAG_R(ESP);
+				desc.regout[0] |= REGFLAG_R(ESP);
+				desc.flags |= OPFLAG_WRITES_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+			}
+			desc.cycles = cycles[(op == 0xe8) ? CYCLES_CALL : (op == 0xe9) ? CYCLES_JMP : CYCLES_JMP_SHORT];
+			break;
+		}
+
+		case 0xff:
+			if (!i386_device::drc_decode_modrm(&bytes[pos], avail - pos, modrm))
+				return describe_interpret(desc);
+			pos += modrm.length;
+			switch (modrm.reg)
+			{
+				case 0:     // INC Ev
+				case 1:     // DEC Ev
+					desc.regout[1] |= REGFLAG_INCDEC;
+					if (modrm.mod == 3)
+					{
+						desc.regin[0] |= REGFLAG_R(modrm.rm);
+						desc.regout[0] |= REGFLAG_R(modrm.rm);
+						desc.cycles = cycles[modrm.reg ? CYCLES_DEC_REG : CYCLES_INC_REG];
+					}
+					else
+					{
+						describe_modrm(desc, modrm, true, true);
+						desc.cycles = cycles[modrm.reg ? CYCLES_DEC_MEM : CYCLES_INC_MEM];
+					}
+					break;
+
+				case 2:     // CALL Ev
+				case 4:     // JMP Ev
+					if (modrm.mod == 3)
+					{
+						desc.regin[0] |= REGFLAG_R(modrm.rm);
+						desc.cycles = cycles[(modrm.reg == 2) ? CYCLES_CALL_REG : CYCLES_JMP_REG];
+					}
+					else
+					{
+						describe_modrm(desc, modrm, true, false);
+						desc.cycles = cycles[(modrm.reg == 2) ? CYCLES_CALL_MEM : CYCLES_JMP_MEM];
+					}
+					if (modrm.reg == 2)
+					{
+						desc.regin[0] |= REGFLAG_R(ESP);
+						desc.regout[0] |= REGFLAG_R(ESP);
+						desc.flags |= OPFLAG_WRITES_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+					}
+					desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+					break;
+
+				case 6:     // PUSH Ev
+					if (modrm.mod == 3)
+						desc.regin[0] |= REGFLAG_R(modrm.rm);
+					else
+						describe_modrm(desc, modrm, true, false);
+					desc.regin[0] |= REGFLAG_R(ESP);
+					desc.regout[0] |= REGFLAG_R(ESP);
+					desc.flags |= OPFLAG_WRITES_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+					desc.cycles = cycles[CYCLES_PUSH_RM];
+					break;
+
+				default:
+					return describe_interpret(desc);
+			}
+			break;
+
+		default:
+			return describe_interpret(desc);
+	}
+
+	// anything longer than the bytes we could fetch runs into the next page
+	if (pos > avail)
+		return describe_interpret(desc);
+	desc.length = pos;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  describe_modrm - add the registers and memory
+//  flags of a memory operand
+//-------------------------------------------------
+
+void i386_frontend::describe_modrm(opcode_desc &desc, const i386_device::drc_modrm &modrm, bool read, bool write)
+{
+	if (modrm.base >= 0)
+		desc.regin[0] |= REGFLAG_R(modrm.base);
+	if (modrm.index >= 0)
+		desc.regin[0] |= REGFLAG_R(modrm.index);
+	if (read)
+		desc.flags |= OPFLAG_READS_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+	if (write)
+		desc.flags |= OPFLAG_WRITES_MEMORY | OPFLAG_CAN_CAUSE_EXCEPTION;
+}
+
+
+//-------------------------------------------------
+//  describe_interpret - describe an instruction
+//  the recompiler leaves to the interpreter; it
+//  sees all registers and flags and ends the
+//  sequence
+//-------------------------------------------------
+
+bool i386_frontend::describe_interpret(opcode_desc &desc)
+{
+	desc.length = 1;
+	desc.cycles = 0;
+	desc.userflags |= I386_USERFLAG_INTERPRET;
+	desc.regin[0] = REGFLAG_R(8) - 1;
+	desc.regin[1] = REGFLAG_ARITH;
+	desc.regout[0] = desc.regout[1] = 0;
+	desc.flags &= ~(OPFLAG_IS_BRANCH | OPFLAG_READS_MEMORY | OPFLAG_WRITES_MEMORY);
+	desc.flags |= OPFLAG_CAN_CAUSE_EXCEPTION | OPFLAG_END_SEQUENCE;
+	desc.targetpc = BRANCH_TARGET_DYNAMIC;
+	return true;
+}
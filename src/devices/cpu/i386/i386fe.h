@@ -0,0 +1,59 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    i386fe.h
+
+    Front-end for i386 recompiler
+
+***************************************************************************/
+#ifndef MAME_CPU_I386_I386FE_H
+#define MAME_CPU_I386_I386FE_H
+
+#pragma once
+
+
+//**************************************************************************
+//  MACROS
+//**************************************************************************
+
+// register flags 0
+#define REGFLAG_R(n)                    (1 << (n))
+
+// register flags 1
+#define REGFLAG_CF                      (1 << 0)
+#define REGFLAG_PF                      (1 << 1)
+#define REGFLAG_AF                      (1 << 2)
+#define REGFLAG_ZF                      (1 << 3)
+#define REGFLAG_SF                      (1 << 4)
+#define REGFLAG_OF                      (1 << 5)
+
+// flags written by the common instruction groups
+#define REGFLAG_ARITH                   (REGFLAG_CF | REGFLAG_PF | REGFLAG_AF | REGFLAG_ZF | REGFLAG_SF | REGFLAG_OF)
+#define REGFLAG_LOGIC                   (REGFLAG_CF | REGFLAG_PF | REGFLAG_ZF | REGFLAG_SF | REGFLAG_OF)
+#define REGFLAG_INCDEC                  (REGFLAG_PF | REGFLAG_AF | REGFLAG_ZF | REGFLAG_SF | REGFLAG_OF)
+
+// user flags
+#define I386_USERFLAG_INTERPRET         (1 << 0)    // instruction is handed back to the interpreter
+
+
+
+//**************************************************************************
+//  INLINE FUNCTIONS
+//**************************************************************************
+
+//-------------------------------------------------
+//  i386_fetch_le - assemble a little-endian
+//  immediate from the fetched opcode bytes
+//-------------------------------------------------
+
+inline uint32_t i386_fetch_le(const uint8_t *bytes, int size)
+{
+	uint32_t result = 0;
+	for (int i = size - 1; i >= 0; i--)
+		result = (result << 8) | bytes[i];
+	return result;
+}
+
+
+#endif // MAME_CPU_I386_I386FE_H
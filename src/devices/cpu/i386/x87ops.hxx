@@ -261,9 +261,7 @@ floatx80 i386_device::x87_add(floatx80 a, floatx80 b)
 		}
 		case X87_CW_PC_DOUBLE:
 		{
-			float64 a64 = floatx80_to_float64(a);
-			float64 b64 = floatx80_to_float64(b);
-			result = float64_to_floatx80(float64_add(a64, b64));
+			result = x87_double_op("add", host_fp::add, float64_add, a, b);
 			break;
 		}
 		case X87_CW_PC_EXTEND:
@@ -291,9 +289,7 @@ floatx80 i386_device::x87_sub(floatx80 a, floatx80 b)
 		}
 		case X87_CW_PC_DOUBLE:
 		{
-			float64 a64 = floatx80_to_float64(a);
-			float64 b64 = floatx80_to_float64(b);
-			result = float64_to_floatx80(float64_sub(a64, b64));
+			result = x87_double_op("sub", host_fp::sub, float64_sub, a, b);
 			break;
 		}
 		case X87_CW_PC_EXTEND:
@@ -321,9 +317,7 @@ floatx80 i386_device::x87_mul(floatx80 a, floatx80 b)
 		}
 		case X87_CW_PC_DOUBLE:
 		{
-			float64 a64 = floatx80_to_float64(a);
-			float64 b64 = floatx80_to_float64(b);
-			val = float64_to_floatx80(float64_mul(a64, b64));
+			val = x87_double_op("mul", host_fp::mul, float64_mul, a, b);
 			break;
 		}
 		case X87_CW_PC_EXTEND:
@@ -352,9 +346,7 @@ floatx80 i386_device::x87_div(floatx80 a, floatx80 b)
 		}
 		case X87_CW_PC_DOUBLE:
 		{
-			float64 a64 = floatx80_to_float64(a);
-			float64 b64 = floatx80_to_float64(b);
-			val = float64_to_floatx80(float64_div(a64, b64));
+			val = x87_double_op("div", host_fp::div, float64_div, a, b);
 			break;
 		}
 		case X87_CW_PC_EXTEND:
@@ -366,6 +358,29 @@ floatx80 i386_device::x87_div(floatx80 a, floatx80 b)
 	return val;
 }
 
+// double precision, on the host when it rounds to nearest and the
+// operands and result are normal doubles
+floatx80 i386_device::x87_double_op(const char *name, host_fp::function host, float64 (*soft)(float64, float64), floatx80 a, floatx80 b)
+{
+	auto const softfloat =
+			[soft, a, b] ()
+			{
+				return float64_to_floatx80(soft(floatx80_to_float64(a), floatx80_to_float64(b)));
+			};
+
+	if (X87_RC != X87_CW_RC_NEAREST)
+		return softfloat();
+
+	return host_fp::dispatch(
+			m_x87_host_fp, host, a, b, softfloat,
+			[this, name, a, b] (floatx80 result, int8 flags, floatx80 expected, int8 expected_flags)
+			{
+				logerror("x87 %s %04x:%016x, %04x:%016x: host %04x:%016x flags %02x, SoftFloat %04x:%016x flags %02x (PC:%x)\n",
+						name, a.high, a.low, b.high, b.low,
+						result.high, result.low, flags, expected.high, expected.low, expected_flags, m_pc);
+			});
+}
+
 
 /*************************************
  *
@@ -111,15 +111,25 @@ void m68000_device::execute_run()
 		if(m_icount > 0 && m_inst_substate)
 			(this->*(m_handlers_p[m_inst_state]))();
 
-		while(m_icount > 0) {
-			if(m_inst_state >= S_first_instruction) {
-				m_ipc = m_pc - 2;
-				m_irdi = m_ird;
-
-				if(machine().debug_flags & DEBUG_FLAG_ENABLED)
+		if(m_debugger_hook) {
+			while(m_icount > 0) {
+				if(m_inst_state >= S_first_instruction) {
+					m_ipc = m_pc - 2;
+					m_irdi = m_ird;
 					debugger_instruction_hook(m_ipc);
+				}
+				(this->*(m_handlers_f[m_inst_state]))();
+			}
+		} else {
+			// Fast path, no debugger: one table dispatch per instruction
+			const handler *const handlers = m_handlers_f;
+			while(m_icount > 0) {
+				if(m_inst_state >= S_first_instruction) {
+					m_ipc = m_pc - 2;
+					m_irdi = m_ird;
+				}
+				(this->*(handlers[m_inst_state]))();
 			}
-			(this->*(m_handlers_f[m_inst_state]))();
 		}
 
 		if(m_post_run)
@@ -195,6 +205,8 @@ void m68000_device::device_start()
 		m_handlers_p = s_handlers_dp;
 	}
 
+	m_debugger_hook = machine().debug_flags & DEBUG_FLAG_ENABLED;
+
 	save_item(NAME(m_da));
 	save_item(NAME(m_ipc));
 	save_item(NAME(m_pc));
@@ -123,6 +123,7 @@ protected:
 
 	const handler *m_handlers_f;
 	const handler *m_handlers_p;
+	bool m_debugger_hook;
 
 	// Callbacks to host
 	write32sm_delegate m_cmpild_instr_callback;           /* Called when a CMPI.L #v, Dn instruction is encountered */
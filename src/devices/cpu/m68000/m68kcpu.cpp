@@ -1040,6 +1040,8 @@ void m68000_musashi_device::init_cpu_common(void)
 	m_emmu_enabled     = false;
 	m_instruction_restart = false;
 
+	m_fpu_host_fp = host_fp::configured(machine().options());
+
 	/* The first call to this function initializes the opcode handler jump table */
 	if(!emulation_initialized)
 	{
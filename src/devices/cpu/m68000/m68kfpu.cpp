@@ -1234,6 +1234,24 @@ void m68000_musashi_device::WRITE_EA_PACK(int ea, int k, floatx80 fpr)
 	}
 }
 
+// with FPCR set to round to nearest at double precision, operations on
+// normal doubles can be done on the host
+floatx80 m68000_musashi_device::fpu_host_op(const char *name, host_fp::function host, floatx80 (*soft)(floatx80, floatx80), floatx80 a, floatx80 b)
+{
+	if ((floatx80_rounding_precision != 64) || (float_rounding_mode != float_round_nearest_even))
+		return soft(a, b);
+
+	return host_fp::dispatch(
+			m_fpu_host_fp, host, a, b,
+			[soft, a, b] () { return soft(a, b); },
+			[this, name, a, b] (floatx80 result, int8 flags, floatx80 expected, int8 expected_flags)
+			{
+				logerror("%s %04x:%016x, %04x:%016x: host %04x:%016x flags %02x, SoftFloat %04x:%016x flags %02x (PC:%x)\n",
+						name, a.high, a.low, b.high, b.low,
+						result.high, result.low, flags, expected.high, expected.low, expected_flags, m_ppc);
+			});
+}
+
 void m68000_musashi_device::fpgen_rm_reg(u16 w2)
 {
 	const int ea = m_ir & 0x3f;
@@ -1550,7 +1568,7 @@ void m68000_musashi_device::fpgen_rm_reg(u16 w2)
 		case 0x60:      // FSDIVS
 		case 0x20:      // FDIV
 		{
-			m_fpr[dst] = floatx80_div(m_fpr[dst], source);
+			m_fpr[dst] = fpu_host_op("fdiv", host_fp::div, floatx80_div, m_fpr[dst], source);
 			SET_CONDITION_CODES(m_fpr[dst]);
 			m_icount -= 43;
 			break;
@@ -1567,7 +1585,7 @@ void m68000_musashi_device::fpgen_rm_reg(u16 w2)
 		}
 		case 0x22:      // FADD
 		{
-			m_fpr[dst] = floatx80_add(m_fpr[dst], source);
+			m_fpr[dst] = fpu_host_op("fadd", host_fp::add, floatx80_add, m_fpr[dst], source);
 			SET_CONDITION_CODES(m_fpr[dst]);
 			m_icount -= 9;
 			break;
@@ -1575,7 +1593,7 @@ void m68000_musashi_device::fpgen_rm_reg(u16 w2)
 		case 0x63:      // FSMULS (JFF)
 		case 0x23:      // FMUL
 		{
-			m_fpr[dst] = floatx80_mul(m_fpr[dst], source);
+			m_fpr[dst] = fpu_host_op("fmul", host_fp::mul, floatx80_mul, m_fpr[dst], source);
 			SET_CONDITION_CODES(m_fpr[dst]);
 			m_icount -= 11;
 			break;
@@ -1616,7 +1634,7 @@ void m68000_musashi_device::fpgen_rm_reg(u16 w2)
 		}
 		case 0x28:      // FSUB
 		{
-			m_fpr[dst] = floatx80_sub(m_fpr[dst], source);
+			m_fpr[dst] = fpu_host_op("fsub", host_fp::sub, floatx80_sub, m_fpr[dst], source);
 			SET_CONDITION_CODES(m_fpr[dst]);
 			m_icount -= 9;
 			break;
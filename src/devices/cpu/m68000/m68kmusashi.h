@@ -14,6 +14,8 @@
 #include "softfloat/softfloat.h"
 #endif
 
+#include "cpu/hostfp.h"
+
 extern flag floatx80_is_nan(floatx80 a);
 
 
@@ -156,6 +158,7 @@ protected:
 	u32 m_fpiar;        /* FPU Instruction Address Register (m68040) */
 	u32 m_fpsr;         /* FPU Status Register (m68040) */
 	u32 m_fpcr;         /* FPU Control Register (m68040) */
+	host_fp::mode m_fpu_host_fp; /* Host floating point use */
 	u32 m_t1_flag;      /* Trace 1 */
 	u32 m_t0_flag;      /* Trace 0 */
 	u32 m_s_flag;       /* Supervisor */
@@ -371,6 +374,7 @@ protected:
 	void WRITE_EA_64(int ea, u64 data);
 	void WRITE_EA_FPE(int mode, int reg, floatx80 fpr, uint32 di_mode_ea);
 	void WRITE_EA_PACK(int ea, int k, floatx80 fpr);
+	floatx80 fpu_host_op(const char *name, host_fp::function host, floatx80 (*soft)(floatx80, floatx80), floatx80 a, floatx80 b);
 	void fpgen_rm_reg(u16 w2);
 	void fmove_reg_mem(u16 w2);
 	void fmove_fpcr(u16 w2);
@@ -4,6 +4,7 @@
 #include "emu.h"
 #include "mb86233.h"
 #include "mb86233d.h"
+#include "mb86233rc.h"
 
 /*
   Driver based on the initial reverse-engineering of Elsemi, extended,
@@ -54,6 +55,7 @@ mb86233_device::mb86233_device(const machine_config &mconfig, device_type type,
 	, m_data_config("data", ENDIANNESS_LITTLE, 32, 16, -2)
 	, m_io_config("io", ENDIANNESS_LITTLE, 32, 16, -2)
 	, m_rf_config("rf", ENDIANNESS_LITTLE, 32, 4, -2)
+	, m_drc_cache(CACHE_SIZE)
 {
 }
 
@@ -158,6 +160,15 @@ void mb86233_device::device_start()
 	m_gpio0 = m_gpio1 = m_gpio2 = m_gpio3 = false;
 
 	set_icountptr(m_icount);
+
+	// the recompiler is opt-in until it has been checked against the interpreter
+	if(allow_unverified_drc())
+		m_recompiler = std::make_unique<recompiler>(*this, 0);
+}
+
+void mb86233_device::device_stop()
+{
+	m_recompiler.reset();
 }
 
 
@@ -220,6 +231,10 @@ void mb86233_device::device_reset()
 	std::fill(std::begin(m_pcs), std::end(m_pcs), 0);
 
 	m_stall = false;
+
+	// the Model 2 uploads the program before releasing reset
+	if(m_recompiler)
+		m_recompiler->flush();
 }
 
 u32 mb86233_device::set_exp(u32 val, u32 exp)
@@ -709,493 +724,507 @@ void mb86233_device::write_mem_io_1(u32 r, u32 v)
 	ea_post_1(r);
 }
 
-void mb86233_device::execute_run()
+void mb86233_device::execute_one()
 {
-	while(m_icount > 0) {
-		m_ppc = m_pc;
-		debugger_instruction_hook(m_ppc);
-		u32 opcode = m_cache.read_dword(m_pc++);
+	m_ppc = m_pc;
+	debugger_instruction_hook(m_ppc);
+	u32 opcode = m_cache.read_dword(m_pc++);
 
-		switch((opcode >> 26) & 0x3f) {
-		case 0x00: {
-			// lab
-			u32 r1 = opcode & 0x1ff;
-			u32 r2 = (opcode >> 9) & 0x1ff;
-			u32 alu = (opcode >> 21) & 0x1f;
-			u32 op = (opcode >> 18) & 0x7;
+	switch((opcode >> 26) & 0x3f) {
+	case 0x00: {
+		// lab
+		u32 r1 = opcode & 0x1ff;
+		u32 r2 = (opcode >> 9) & 0x1ff;
+		u32 alu = (opcode >> 21) & 0x1f;
+		u32 op = (opcode >> 18) & 0x7;
 
-			alu_pre(alu);
+		alu_pre(alu);
 
-			switch(op) {
-			case 0: case 1: {
-				// lab mem, mem (e)
+		switch(op) {
+		case 0: case 1: {
+			// lab mem, mem (e)
 
-				u32 ea1 = ea_pre_0(r1);
-				u32 v1 = m_data.read_dword(ea1);
-				if(m_stall) goto do_stall;
+			u32 ea1 = ea_pre_0(r1);
+			u32 v1 = m_data.read_dword(ea1);
+			if(m_stall) goto do_stall;
 
-				u32 ea2 = ea_pre_1(r2);
-				u32 v2 = m_io.read_dword(ea2);
-				if(m_stall) goto do_stall;
+			u32 ea2 = ea_pre_1(r2);
+			u32 v2 = m_io.read_dword(ea2);
+			if(m_stall) goto do_stall;
 
-				ea_post_0(r1);
-				ea_post_1(r2);
+			ea_post_0(r1);
+			ea_post_1(r2);
 
-				m_a = v1;
-				m_b = v2;
-				break;
-			}
+			m_a = v1;
+			m_b = v2;
+			break;
+		}
 
-			case 3: {
-				// lab mem, mem + 0x200
+		case 3: {
+			// lab mem, mem + 0x200
 
-				u32 ea1 = ea_pre_0(r1);
-				u32 v1 = m_data.read_dword(ea1);
-				if(m_stall) goto do_stall;
+			u32 ea1 = ea_pre_0(r1);
+			u32 v1 = m_data.read_dword(ea1);
+			if(m_stall) goto do_stall;
 
-				u32 ea2 = ea_pre_1(r2) + 0x200;
-				u32 v2 = m_data.read_dword(ea2);
-				if(m_stall) goto do_stall;
+			u32 ea2 = ea_pre_1(r2) + 0x200;
+			u32 v2 = m_data.read_dword(ea2);
+			if(m_stall) goto do_stall;
 
-				ea_post_0(r1);
-				ea_post_1(r2);
+			ea_post_0(r1);
+			ea_post_1(r2);
 
-				m_a = v1;
-				m_b = v2;
-				break;
-			}
+			m_a = v1;
+			m_b = v2;
+			break;
+		}
 
-			case 4: {
-				// lab mem + 0x200, mem
+		case 4: {
+			// lab mem + 0x200, mem
 
-				u32 ea1 = ea_pre_0(r1) + 0x200;
-				u32 v1 = m_data.read_dword(ea1);
-				if(m_stall) goto do_stall;
+			u32 ea1 = ea_pre_0(r1) + 0x200;
+			u32 v1 = m_data.read_dword(ea1);
+			if(m_stall) goto do_stall;
 
-				u32 ea2 = ea_pre_1(r2);
-				u32 v2 = m_data.read_dword(ea2);
-				if(m_stall) goto do_stall;
+			u32 ea2 = ea_pre_1(r2);
+			u32 v2 = m_data.read_dword(ea2);
+			if(m_stall) goto do_stall;
 
-				ea_post_0(r1);
-				ea_post_1(r2);
+			ea_post_0(r1);
+			ea_post_1(r2);
 
-				m_a = v1;
-				m_b = v2;
-				break;
-			}
+			m_a = v1;
+			m_b = v2;
+			break;
+		}
 
-			default:
-				logerror("unhandled lab subop %x\n", op);
-				logerror("%x\n", m_ppc);
-				break;
+		default:
+			logerror("unhandled lab subop %x\n", op);
+			logerror("%x\n", m_ppc);
+			break;
+
+		}
+
+		alu_post(alu);
+		break;
+	}
 
-			}
 
-			alu_post(alu);
+	case 0x07: {
+		// ld / mov
+		u32 r1 = opcode & 0x1ff;
+		u32 r2 = (opcode >> 9) & 0x1ff;
+		u32 alu = (opcode >> 21) & 0x1f;
+		u32 op = (opcode >> 18) & 0x7;
+
+		alu_pre(alu);
+
+		switch(op) {
+		case 0: {
+			// mov mem, mem (e)
+			u32 ea = ea_pre_0(r1);
+			u32 v = m_data.read_dword(ea);
+			if(m_stall) goto do_stall;
+			ea_post_0(r1);
+			write_mem_io_1(r2, v);
 			break;
 		}
 
+		case 1: {
+			// mov mem, mem (e)
+			u32 ea = ea_pre_0(r1);
+			u32 v = m_data.read_dword(ea);
+			if(m_stall) goto do_stall;
+			ea_post_0(r1);
+			write_mem_io_1(r2, v);
+			break;
+		}
 
-		case 0x07: {
-			// ld / mov
-			u32 r1 = opcode & 0x1ff;
-			u32 r2 = (opcode >> 9) & 0x1ff;
-			u32 alu = (opcode >> 21) & 0x1f;
-			u32 op = (opcode >> 18) & 0x7;
+		case 2: {
+			// mov mem (e), mem
+			u32 ea = ea_pre_0(r1);
+			u32 v = m_io.read_dword(ea);
+			if(m_stall) goto do_stall;
+			ea_post_0(r1);
+			write_mem_internal_1(r2, v, false);
+			break;
+		}
 
-			alu_pre(alu);
+		case 3: {
+			// mov mem, mem + 0x200
+			u32 ea = ea_pre_0(r1);
+			u32 v = m_data.read_dword(ea);
+			if(m_stall) goto do_stall;
+			ea_post_0(r1);
+			write_mem_internal_1(r2, v, true);
+			break;
+		}
+
+		case 4: {
+			// mov mem + 0x200, mem
+			u32 ea = ea_pre_0(r1) + 0x200;
+			u32 v = m_data.read_dword(ea);
+			if(m_stall) goto do_stall;
+			ea_post_0(r1);
+			write_mem_internal_1(r2, v, false);
+			break;
+		}
+
+		case 5: {
+			// mov mem (o), mem
+			u32 ea = ea_pre_0(r1);
+			u32 v = m_program.read_dword(ea);
+			if(m_stall) goto do_stall;
+			ea_post_0(r1);
+			write_mem_internal_1(r2, v, false);
+			break;
+		}
 
-			switch(op) {
+		case 7: {
+			switch(r2 >> 6) {
 			case 0: {
-				// mov mem, mem (e)
-				u32 ea = ea_pre_0(r1);
-				u32 v = m_data.read_dword(ea);
+				// mov reg, mem
+				u32 v = read_reg(r2);
 				if(m_stall) goto do_stall;
-				ea_post_0(r1);
-				write_mem_io_1(r2, v);
+				write_mem_internal_1(r1, v, false);
 				break;
 			}
 
 			case 1: {
-				// mov mem, mem (e)
-				u32 ea = ea_pre_0(r1);
-				u32 v = m_data.read_dword(ea);
+				// mov reg, mem (e)
+				u32 v = read_reg(r2);
 				if(m_stall) goto do_stall;
-				ea_post_0(r1);
-				write_mem_io_1(r2, v);
+				write_mem_io_1(r1, v);
 				break;
 			}
 
 			case 2: {
-				// mov mem (e), mem
-				u32 ea = ea_pre_0(r1);
-				u32 v = m_io.read_dword(ea);
+				// mov mem + 0x200, reg
+				u32 ea = ea_pre_1(r1) + 0x200;
+				u32 v = m_data.read_dword(ea);
 				if(m_stall) goto do_stall;
-				ea_post_0(r1);
-				write_mem_internal_1(r2, v, false);
+				ea_post_1(r1);
+				write_reg(r2, v);
 				break;
 			}
 
 			case 3: {
-				// mov mem, mem + 0x200
-				u32 ea = ea_pre_0(r1);
+				// mov mem, reg
+				u32 ea = ea_pre_1(r1);
 				u32 v = m_data.read_dword(ea);
 				if(m_stall) goto do_stall;
-				ea_post_0(r1);
-				write_mem_internal_1(r2, v, true);
+				ea_post_1(r1);
+				write_reg(r2, v);
 				break;
 			}
 
 			case 4: {
-				// mov mem + 0x200, mem
-				u32 ea = ea_pre_0(r1) + 0x200;
-				u32 v = m_data.read_dword(ea);
+				// mov mem (e), reg
+				u32 ea = ea_pre_1(r1);
+				u32 v = m_io.read_dword(ea);
 				if(m_stall) goto do_stall;
-				ea_post_0(r1);
-				write_mem_internal_1(r2, v, false);
+				ea_post_1(r1);
+				write_reg(r2, v);
 				break;
 			}
 
 			case 5: {
-				// mov mem (o), mem
+				// mov mem (o), reg
 				u32 ea = ea_pre_0(r1);
 				u32 v = m_program.read_dword(ea);
 				if(m_stall) goto do_stall;
 				ea_post_0(r1);
-				write_mem_internal_1(r2, v, false);
+				write_reg(r2, v);
 				break;
 			}
 
-			case 7: {
-				switch(r2 >> 6) {
-				case 0: {
-					// mov reg, mem
-					u32 v = read_reg(r2);
-					if(m_stall) goto do_stall;
-					write_mem_internal_1(r1, v, false);
-					break;
-				}
-
-				case 1: {
-					// mov reg, mem (e)
-					u32 v = read_reg(r2);
-					if(m_stall) goto do_stall;
-					write_mem_io_1(r1, v);
-					break;
-				}
-
-				case 2: {
-					// mov mem + 0x200, reg
-					u32 ea = ea_pre_1(r1) + 0x200;
-					u32 v = m_data.read_dword(ea);
-					if(m_stall) goto do_stall;
-					ea_post_1(r1);
-					write_reg(r2, v);
-					break;
-				}
-
-				case 3: {
-					// mov mem, reg
-					u32 ea = ea_pre_1(r1);
-					u32 v = m_data.read_dword(ea);
-					if(m_stall) goto do_stall;
-					ea_post_1(r1);
-					write_reg(r2, v);
-					break;
-				}
-
-				case 4: {
-					// mov mem (e), reg
-					u32 ea = ea_pre_1(r1);
-					u32 v = m_io.read_dword(ea);
-					if(m_stall) goto do_stall;
-					ea_post_1(r1);
-					write_reg(r2, v);
-					break;
-				}
-
-				case 5: {
-					// mov mem (o), reg
-					u32 ea = ea_pre_0(r1);
-					u32 v = m_program.read_dword(ea);
-					if(m_stall) goto do_stall;
-					ea_post_0(r1);
-					write_reg(r2, v);
-					break;
-				}
-
-				case 6: {
-					// mov reg, reg
-					u32 v = read_reg(r1);
-					if(m_stall) goto do_stall;
-					write_reg(r2, v);
-					break;
-				}
-
-				default:
-					logerror("unhandled ld/mov subop 7/%x (%x)\n", r2 >> 6, m_ppc);
-					break;
-				}
+			case 6: {
+				// mov reg, reg
+				u32 v = read_reg(r1);
+				if(m_stall) goto do_stall;
+				write_reg(r2, v);
 				break;
 			}
 
 			default:
-				logerror("unhandled ld/mov subop %x (%x)\n", op, m_ppc);
+				logerror("unhandled ld/mov subop 7/%x (%x)\n", r2 >> 6, m_ppc);
 				break;
 			}
+			break;
+		}
 
-			alu_post(alu);
+		default:
+			logerror("unhandled ld/mov subop %x (%x)\n", op, m_ppc);
 			break;
 		}
 
-		case 0x0d: {
-			// stm/clm
-			u32 sub2 = (opcode >> 17) & 7;
+		alu_post(alu);
+		break;
+	}
 
-			// Theorically has restricted alu too
+	case 0x0d: {
+		// stm/clm
+		u32 sub2 = (opcode >> 17) & 7;
 
-			switch(sub2) {
-			case 5:
-				// stmh
-				// bit 0 = floating point
-				// bit 1-2 = rounding mode
-				m_m = opcode;
-				break;
+		// Theorically has restricted alu too
 
-			default:
-				logerror("unimplemented opcode 0d/%x (%x)\n", sub2, m_ppc);
-				break;
-			}
+		switch(sub2) {
+		case 5:
+			// stmh
+			// bit 0 = floating point
+			// bit 1-2 = rounding mode
+			m_m = opcode;
+			break;
+
+		default:
+			logerror("unimplemented opcode 0d/%x (%x)\n", sub2, m_ppc);
 			break;
 		}
+		break;
+	}
 
-		case 0x0e: {
-			// lipl / lia / lib / lid
-			switch((opcode >> 24) & 0x3) {
-			case 0:
-				m_p = (m_p & 0xffffff000000) | (opcode & 0xffffff);
-				break;
-			case 1:
-				m_a = util::sext(opcode, 24);
-				break;
-			case 2:
-				m_b = util::sext(opcode, 24);
-				break;
-			case 3:
-				m_d = util::sext(opcode, 24);
-				testdz();
-				break;
-			}
+	case 0x0e: {
+		// lipl / lia / lib / lid
+		switch((opcode >> 24) & 0x3) {
+		case 0:
+			m_p = (m_p & 0xffffff000000) | (opcode & 0xffffff);
+			break;
+		case 1:
+			m_a = util::sext(opcode, 24);
+			break;
+		case 2:
+			m_b = util::sext(opcode, 24);
+			break;
+		case 3:
+			m_d = util::sext(opcode, 24);
+			testdz();
 			break;
 		}
+		break;
+	}
 
-		case 0x0f: {
-			// rep/clr0/clr1/set
-			u32 alu = (opcode >> 20) & 0x1f;
-			u32 sub2 = (opcode >> 17) & 7;
+	case 0x0f: {
+		// rep/clr0/clr1/set
+		u32 alu = (opcode >> 20) & 0x1f;
+		u32 sub2 = (opcode >> 17) & 7;
+
+		alu_pre(alu);
+
+		switch(sub2) {
+		case 0:
+			// clr0
+			if(opcode & 0x0004) m_a = 0;
+			if(opcode & 0x0008) m_b = 0;
+			if(opcode & 0x0010) m_d = 0;
+			break;
 
-			alu_pre(alu);
+		case 1:
+			// clr1 - flags mapping unknown
+			break;
 
-			switch(sub2) {
-			case 0:
-				// clr0
-				if(opcode & 0x0004) m_a = 0;
-				if(opcode & 0x0008) m_b = 0;
-				if(opcode & 0x0010) m_d = 0;
-				break;
+		case 2: {
+			// rep
+			u8 r = opcode & 0x8000 ? read_reg(opcode) : opcode;
+			if(m_stall) goto do_stall;
+			m_r = r;
+			goto rep_start;
+		}
 
-			case 1:
-				// clr1 - flags mapping unknown
-				break;
+		case 3:
+			// set - flags mapping unknown
+			// 0800 = enable interrupt flag
+			break;
 
-			case 2: {
-				// rep
-				u8 r = opcode & 0x8000 ? read_reg(opcode) : opcode;
-				if(m_stall) goto do_stall;
-				m_r = r;
-				goto rep_start;
-			}
+		default:
+			logerror("unimplemented opcode 0f/%x (%x)\n", sub2, m_ppc);
+			break;
+		}
 
-			case 3:
-				// set - flags mapping unknown
-				// 0800 = enable interrupt flag
-				break;
+		alu_post(alu);
+		break;
+	}
 
-			default:
-				logerror("unimplemented opcode 0f/%x (%x)\n", sub2, m_ppc);
-				break;
-			}
+	case 0x10: case 0x11: case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17:
+	case 0x18: case 0x19: case 0x1a: case 0x1b: case 0x1c: case 0x1d: case 0x1e: case 0x1f: {
+		// ldi
+		write_reg(opcode >> 24, util::sext(opcode, 24));
+		break;
+	}
+
+	case 0x2f: case 0x3f: {
+		// Conditional branch of every kind
+		u32 cond = ( opcode >> 20 ) & 0x1f;
+		u32 subtype = ( opcode >> 17 ) & 7;
+		u32 data = opcode & 0xffff;
+		bool invert = opcode & 0x40000000;
 
-			alu_post(alu);
+		bool cond_passed = false;
+
+		switch(cond) {
+		case 0x00: // zrd - d zero
+			cond_passed = m_st & F_ZRD;
 			break;
-		}
 
-		case 0x10: case 0x11: case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17:
-		case 0x18: case 0x19: case 0x1a: case 0x1b: case 0x1c: case 0x1d: case 0x1e: case 0x1f: {
-			// ldi
-			write_reg(opcode >> 24, util::sext(opcode, 24));
+		case 0x01: // ged - d >= 0
+			cond_passed = !(m_st & F_SGD);
 			break;
-		}
 
-		case 0x2f: case 0x3f: {
-			// Conditional branch of every kind
-			u32 cond = ( opcode >> 20 ) & 0x1f;
-			u32 subtype = ( opcode >> 17 ) & 7;
-			u32 data = opcode & 0xffff;
-			bool invert = opcode & 0x40000000;
+		case 0x02: // led - d <= 0
+			cond_passed = m_st & (F_ZRD | F_SGD);
+			break;
 
-			bool cond_passed = false;
+		case 0x0a: // gpio0
+			cond_passed = m_gpio0;
+			break;
 
-			switch(cond) {
-			case 0x00: // zrd - d zero
-				cond_passed = m_st & F_ZRD;
-				break;
+		case 0x0b: // gpio1
+			cond_passed = m_gpio1;
+			break;
 
-			case 0x01: // ged - d >= 0
-				cond_passed = !(m_st & F_SGD);
-				break;
+		case 0x0c: // gpio2
+			cond_passed = m_gpio2;
+			break;
 
-			case 0x02: // led - d <= 0
-				cond_passed = m_st & (F_ZRD | F_SGD);
-				break;
+		case 0x10: // zc0 - c0 == 1
+			cond_passed = !(m_st & F_ZC0);
+			break;
 
-			case 0x0a: // gpio0
-				cond_passed = m_gpio0;
-				break;
+		case 0x11: // zc1 - c1 == 1
+			cond_passed = !(m_st & F_ZC1);
+			break;
 
-			case 0x0b: // gpio1
-				cond_passed = m_gpio1;
-				break;
+		case 0x12: // gpio3
+			cond_passed = m_gpio3;
+			break;
 
-			case 0x0c: // gpio2
-				cond_passed = m_gpio2;
-				break;
+		case 0x16: // alw - always
+			cond_passed = true;
+			break;
 
-			case 0x10: // zc0 - c0 == 1
-				cond_passed = !(m_st & F_ZC0);
-				break;
+		default:
+			logerror("unimplemented condition %x (%x)\n", cond, m_ppc);
+			break;
+		}
+		if(invert)
+			cond_passed = !cond_passed;
 
-			case 0x11: // zc1 - c1 == 1
-				cond_passed = !(m_st & F_ZC1);
+		if(cond_passed) {
+			switch(subtype) {
+			case 0: // brif #adr
+				m_pc = data;
 				break;
 
-			case 0x12: // gpio3
-				cond_passed = m_gpio3;
+			case 1: // brul
+				if(opcode & 0x4000) {
+					// brul reg
+					u32 v = read_reg(opcode);
+					if(m_stall) goto do_stall;
+					m_pc = v;
+				} else {
+					// brul adr
+					u32 ea = ea_pre_0(opcode);
+					u32 v = m_data.read_dword(ea);
+					if(m_stall) goto do_stall;
+					ea_post_0(opcode);
+					m_pc = v;
+				}
 				break;
 
-			case 0x16: // alw - always
-				cond_passed = true;
+			case 2: // bsif #adr
+				pcs_push();
+				m_pc = data;
 				break;
 
-			default:
-				logerror("unimplemented condition %x (%x)\n", cond, m_ppc);
-				break;
-			}
-			if(invert)
-				cond_passed = !cond_passed;
-
-			if(cond_passed) {
-				switch(subtype) {
-				case 0: // brif #adr
-					m_pc = data;
-					break;
-
-				case 1: // brul
-					if(opcode & 0x4000) {
-						// brul reg
-						u32 v = read_reg(opcode);
-						if(m_stall) goto do_stall;
-						m_pc = v;
-					} else {
-						// brul adr
-						u32 ea = ea_pre_0(opcode);
-						u32 v = m_data.read_dword(ea);
-						if(m_stall) goto do_stall;
-						ea_post_0(opcode);
-						m_pc = v;
-					}
-					break;
-
-				case 2: // bsif #adr
+			case 3: // bsul
+				if(opcode & 0x4000) {
+					// bsul reg
+					u32 v = read_reg(opcode);
+					if(m_stall) goto do_stall;
 					pcs_push();
-					m_pc = data;
-					break;
-
-				case 3: // bsul
-					if(opcode & 0x4000) {
-						// bsul reg
-						u32 v = read_reg(opcode);
-						if(m_stall) goto do_stall;
-						pcs_push();
-						m_pc = v;
-					} else {
-						// bsul adr
-						u32 ea = ea_pre_0(opcode);
-						u32 v = m_data.read_dword(ea);
-						if(m_stall) goto do_stall;
-						ea_post_0(opcode);
-						pcs_push();
-						m_pc = v;
-					}
-					break;
-
-				case 5: // rtif #adr
-					pcs_pop();
-					break;
-
-				case 6: { // ldif adr, rn
+					m_pc = v;
+				} else {
+					// bsul adr
 					u32 ea = ea_pre_0(opcode);
 					u32 v = m_data.read_dword(ea);
 					if(m_stall) goto do_stall;
 					ea_post_0(opcode);
-					write_reg(opcode >> 9, v);
-					break;
+					pcs_push();
+					m_pc = v;
 				}
+				break;
 
-				default:
-					logerror("unimplemented branch subtype %x (%x)\n", subtype, m_ppc);
-					break;
-				}
+			case 5: // rtif #adr
+				pcs_pop();
+				break;
+
+			case 6: { // ldif adr, rn
+				u32 ea = ea_pre_0(opcode);
+				u32 v = m_data.read_dword(ea);
+				if(m_stall) goto do_stall;
+				ea_post_0(opcode);
+				write_reg(opcode >> 9, v);
+				break;
 			}
 
-			if(subtype < 2)
-				switch(cond) {
-				case 0x10:
-					if(m_c0 != 1) {
-						m_c0 --;
-						if(m_c0 == 1)
-							m_st |= F_ZC0;
-					}
-					break;
-
-				case 0x11:
-					if(m_c1 != 1) {
-						m_c1 --;
-						if(m_c1 == 1)
-							m_st |= F_ZC1;
-					}
+			default:
+				logerror("unimplemented branch subtype %x (%x)\n", subtype, m_ppc);
 				break;
+			}
+		}
+
+		if(subtype < 2)
+			switch(cond) {
+			case 0x10:
+				if(m_c0 != 1) {
+					m_c0 --;
+					if(m_c0 == 1)
+						m_st |= F_ZC0;
 				}
+				break;
 
+			case 0x11:
+				if(m_c1 != 1) {
+					m_c1 --;
+					if(m_c1 == 1)
+						m_st |= F_ZC1;
+				}
 			break;
-		}
+			}
 
-		default:
-			logerror("unimplemented opcode type %02x (%x)\n", (opcode >> 26) & 0x3f, m_ppc);
-			break;
-		}
+		break;
+	}
 
-		if(m_r != 1) {
-			m_pc = m_ppc;
-			m_r --;
-		}
+	default:
+		logerror("unimplemented opcode type %02x (%x)\n", (opcode >> 26) & 0x3f, m_ppc);
+		break;
+	}
 
-	rep_start:
-		if(0) {
-		do_stall:
-			m_pc = m_ppc;
-			m_stall = false;
+	if(m_r != 1) {
+		m_pc = m_ppc;
+		m_r --;
+	}
+
+rep_start:
+	if(0) {
+	do_stall:
+		m_pc = m_ppc;
+		m_stall = false;
+	}
+	m_icount--;
+}
+
+void mb86233_device::execute_run()
+{
+	if(m_recompiler && !(machine().debug_flags & DEBUG_FLAG_ENABLED)) {
+		while(m_icount > 0) {
+			// recompiled code doesn't start in the middle of a repeat
+			if(m_r != 1 || (m_recompiler->execute() && m_icount > 0))
+				execute_one();
 		}
-		m_icount--;
+		m_ppc = m_pc;
+		return;
 	}
+
+	while(m_icount > 0)
+		execute_one();
 }
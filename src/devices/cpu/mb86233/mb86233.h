@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include "cpu/drccache.h"
+
 class mb86233_device : public cpu_device
 {
 public:
@@ -71,6 +73,7 @@ protected:
 	mb86233_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
 
 	virtual void device_start() override;
+	virtual void device_stop() override;
 	virtual void device_reset() override;
 
 	virtual uint32_t execute_min_cycles() const noexcept override { return 1; }
@@ -84,6 +87,11 @@ protected:
 	virtual std::unique_ptr<util::disasm_interface> create_disassembler() override;
 
 private:
+	class frontend;
+	class recompiler;
+
+	enum : size_t { CACHE_SIZE = 1024 * 1024 };
+
 	address_space_config m_program_config;
 	address_space_config m_data_config;
 	address_space_config m_io_config;
@@ -105,6 +113,9 @@ private:
 
 	bool m_stall;
 
+	drc_cache m_drc_cache;
+	std::unique_ptr<recompiler> m_recompiler;
+
 	static u32 set_exp(u32 val, u32 exp);
 	static u32 set_mant(u32 val, u32 mant);
 	static u32 get_exp(u32 val);
@@ -122,6 +133,7 @@ private:
 	void pcs_pop();
 	inline void stset_set_sz_int(u32 val);
 	inline void stset_set_sz_fp(u32 val);
+	void execute_one();
 
 	u32 read_reg(u32 r);
 	void write_reg(u32 r, u32 v);
@@ -0,0 +1,91 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    Fujitsu MB86233 (TGP) instruction analyser
+
+    Every instruction is one word long and takes one cycle.  A rep is
+    described together with the instruction it repeats, so that the
+    recompiler can turn the pair into a native loop.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "mb86233fe.h"
+
+
+mb86233_device::frontend::frontend(mb86233_device &host, u32 window_start, u32 window_end, u32 max_sequence)
+	: drc_frontend(host, window_start, window_end, max_sequence)
+	, m_host(host)
+{
+}
+
+bool mb86233_device::frontend::describe(opcode_desc &desc, opcode_desc const *prev)
+{
+	desc.length = 1;
+	desc.cycles = 1;
+
+	u32 opcode = m_host.m_cache.read_dword(desc.physpc);
+
+	if(is_branch(opcode)) {
+		describe_branch(desc, opcode);
+		return true;
+	}
+
+	switch((opcode >> 26) & 0x3f) {
+	case 0x00: // lab
+	case 0x07: // ld / mov
+		desc.flags |= OPFLAG_READS_MEMORY | OPFLAG_WRITES_MEMORY;
+		break;
+
+	case 0x0f:
+		if(is_rep(opcode)) {
+			// take the repeated instruction along unless it changes the flow
+			u32 next = m_host.m_cache.read_dword((desc.physpc + 1) & 0xffff);
+			if(!is_branch(next) && !is_rep(next)) {
+				desc.length = 2;
+				desc.flags |= OPFLAG_READS_MEMORY | OPFLAG_WRITES_MEMORY;
+			}
+		}
+		break;
+	}
+
+	return true;
+}
+
+void mb86233_device::frontend::describe_branch(opcode_desc &desc, u32 opcode)
+{
+	u32 cond = (opcode >> 20) & 0x1f;
+	u32 subtype = (opcode >> 17) & 7;
+	bool always = cond == 0x16 && !(opcode & 0x40000000);
+
+	switch(subtype) {
+	case 0: // brif #adr
+	case 2: // bsif #adr
+		desc.targetpc = opcode & 0xffff;
+		break;
+
+	case 1: // brul
+	case 3: // bsul
+		desc.targetpc = BRANCH_TARGET_DYNAMIC;
+		if(!(opcode & 0x4000))
+			desc.flags |= OPFLAG_READS_MEMORY;
+		break;
+
+	case 5: // rtif
+		desc.targetpc = BRANCH_TARGET_DYNAMIC;
+		break;
+
+	case 6: // ldif adr, rn
+		desc.flags |= OPFLAG_READS_MEMORY;
+		return;
+
+	default:
+		return;
+	}
+
+	if(always)
+		desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+	else
+		desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+}
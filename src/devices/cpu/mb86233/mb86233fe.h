@@ -0,0 +1,35 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    Fujitsu MB86233 (TGP) instruction analyser
+
+***************************************************************************/
+#ifndef MAME_CPU_MB86233_MB86233FE_H
+#define MAME_CPU_MB86233_MB86233FE_H
+
+#pragma once
+
+#include "mb86233.h"
+
+#include "cpu/drcfe.h"
+
+
+class mb86233_device::frontend : public drc_frontend
+{
+public:
+	frontend(mb86233_device &host, u32 window_start, u32 window_end, u32 max_sequence);
+
+	static bool is_branch(u32 opcode) { return ((opcode >> 26) & 0x2f) == 0x2f; }
+	static bool is_rep(u32 opcode) { return ((opcode >> 26) & 0x3f) == 0x0f && ((opcode >> 17) & 7) == 2; }
+
+protected:
+	virtual bool describe(opcode_desc &desc, opcode_desc const *prev) override;
+
+private:
+	void describe_branch(opcode_desc &desc, u32 opcode);
+
+	mb86233_device &m_host;
+};
+
+#endif // MAME_CPU_MB86233_MB86233FE_H
@@ -0,0 +1,1128 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    Fujitsu MB86233 (TGP) recompiler
+
+    Follows the interpreter instruction for instruction: the ALU field
+    is computed into the same temporaries before the move field runs
+    and committed after it, so flags and register write order match.
+    Floating point ALU operations become UML single precision ops, and
+    so run on the host FPU with the host's default rounding like the
+    interpreter.  cfxd goes through the interpreter's ALU code for its
+    rounding modes.
+
+    Recompiled code only starts with no repeat pending.  A rep and the
+    instruction it repeats become a native loop that checks for cycles
+    between passes; if they run out, the interpreter finishes the loop.
+
+    A read that stalls (an empty FIFO, say) restarts the instruction,
+    like the interpreter does, and anything that goes through a memory
+    handler or the register file ends the timeslice if the handler
+    aborted it, since that's how the FIFOs halt the TGP.
+
+    The program is assumed not to change other than across a reset,
+    which is when the Model 2 uploads it.
+
+    Instructions the interpreter doesn't implement, unknown registers
+    and conditions, and branches in repeat loops are left to the
+    interpreter.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "mb86233rc.h"
+
+#include "cpu/drcumlsh.h"
+
+
+using namespace uml;
+
+
+namespace {
+
+enum : u32 {
+	ALU_D_FLAGS = mb86233_device::F_ZRD | mb86233_device::F_SGD | mb86233_device::F_CPD | mb86233_device::F_OVD | mb86233_device::F_DVZD
+};
+
+} // anonymous namespace
+
+
+/***********************************************************************
+    construction/destruction
+***********************************************************************/
+
+mb86233_device::recompiler::recompiler(mb86233_device &host, u32 flags)
+	: m_host(host)
+	, m_frontend(host, COMPILE_BACKWARDS, COMPILE_FORWARDS, COMPILE_MAX_SEQUENCE)
+	, m_uml(host, host.m_drc_cache, flags, 1, 16, 0)
+{
+	m_uml.symbol_add(&m_host.m_icount, sizeof(m_host.m_icount), "icount");
+	m_uml.symbol_add(&m_host.m_pc, sizeof(m_host.m_pc), "pc");
+	m_uml.symbol_add(&m_host.m_st, sizeof(m_host.m_st), "st");
+	m_uml.symbol_add(&m_host.m_a, sizeof(m_host.m_a), "a");
+	m_uml.symbol_add(&m_host.m_b, sizeof(m_host.m_b), "b");
+	m_uml.symbol_add(&m_host.m_d, sizeof(m_host.m_d), "d");
+	m_uml.symbol_add(&m_host.m_p, sizeof(m_host.m_p), "p");
+	m_uml.symbol_add(&m_host.m_r, sizeof(m_host.m_r), "r");
+	m_uml.symbol_add(&m_host.m_b0, sizeof(m_host.m_b0), "b0");
+	m_uml.symbol_add(&m_host.m_b1, sizeof(m_host.m_b1), "b1");
+	m_uml.symbol_add(&m_host.m_x0, sizeof(m_host.m_x0), "x0");
+	m_uml.symbol_add(&m_host.m_x1, sizeof(m_host.m_x1), "x1");
+	m_uml.symbol_add(&m_host.m_i0, sizeof(m_host.m_i0), "i0");
+	m_uml.symbol_add(&m_host.m_i1, sizeof(m_host.m_i1), "i1");
+	m_uml.symbol_add(&m_host.m_alu_r1, sizeof(m_host.m_alu_r1), "alu_r1");
+	m_uml.symbol_add(&m_host.m_alu_r2, sizeof(m_host.m_alu_r2), "alu_r2");
+	m_uml.symbol_add(&m_host.m_alu_stset, sizeof(m_host.m_alu_stset), "alu_stset");
+}
+
+mb86233_device::recompiler::~recompiler()
+{
+}
+
+
+/***********************************************************************
+    execution
+***********************************************************************/
+
+bool mb86233_device::recompiler::execute()
+{
+	if(m_cache_dirty)
+		flush_cache();
+
+	while(true) {
+		switch(m_uml.execute(*m_entry)) {
+		case EXEC_OUT_OF_CYCLES:
+			return false;
+		case EXEC_INTERPRET:
+			return true;
+		case EXEC_MISSING_CODE:
+			compile_block(m_host.m_pc);
+			break;
+		case EXEC_RESET_CACHE:
+			flush_cache();
+			break;
+		default:
+			throw emu_fatalerror("MB86233: unexpected recompiler exit (PC = %04X)\n", m_host.m_pc);
+		}
+	}
+}
+
+
+/***********************************************************************
+    static code generation
+***********************************************************************/
+
+void mb86233_device::recompiler::flush_cache()
+{
+	m_uml.reset();
+	try {
+		generate_entry_point();
+		generate_nocode_handler();
+		generate_out_of_cycles();
+		generate_interpret_handler();
+	} catch(drcuml_block::abort_compilation &) {
+		throw emu_fatalerror("MB86233: error generating recompiler static code\n");
+	}
+	m_cache_dirty = false;
+}
+
+void mb86233_device::recompiler::generate_entry_point()
+{
+	drcuml_block &block(m_uml.begin_block(10));
+
+	if(!m_nocode)
+		m_nocode = m_uml.handle_alloc("nocode");
+	if(!m_entry)
+		m_entry = m_uml.handle_alloc("entry");
+	UML_HANDLE(block, *m_entry);
+	UML_LOAD(block, I0, &m_host.m_pc, 0, SIZE_WORD, SCALE_x1);
+	UML_HASHJMP(block, 0, I0, *m_nocode);
+
+	block.end();
+}
+
+void mb86233_device::recompiler::generate_nocode_handler()
+{
+	drcuml_block &block(m_uml.begin_block(10));
+
+	UML_HANDLE(block, *m_nocode);
+	UML_GETEXP(block, I0);
+	UML_STORE(block, &m_host.m_pc, 0, I0, SIZE_WORD, SCALE_x1);
+	UML_EXIT(block, EXEC_MISSING_CODE);
+
+	block.end();
+}
+
+void mb86233_device::recompiler::generate_out_of_cycles()
+{
+	// also used to hand back to the scheduler after a stall or a halt
+	drcuml_block &block(m_uml.begin_block(10));
+
+	if(!m_out_of_cycles)
+		m_out_of_cycles = m_uml.handle_alloc("out_of_cycles");
+	UML_HANDLE(block, *m_out_of_cycles);
+	UML_GETEXP(block, I0);
+	UML_STORE(block, &m_host.m_pc, 0, I0, SIZE_WORD, SCALE_x1);
+	UML_EXIT(block, EXEC_OUT_OF_CYCLES);
+
+	block.end();
+}
+
+void mb86233_device::recompiler::generate_interpret_handler()
+{
+	drcuml_block &block(m_uml.begin_block(10));
+
+	if(!m_interpret)
+		m_interpret = m_uml.handle_alloc("interpret");
+	UML_HANDLE(block, *m_interpret);
+	UML_GETEXP(block, I0);
+	UML_STORE(block, &m_host.m_pc, 0, I0, SIZE_WORD, SCALE_x1);
+	UML_EXIT(block, EXEC_INTERPRET);
+
+	block.end();
+}
+
+
+/***********************************************************************
+    compilation
+***********************************************************************/
+
+void mb86233_device::recompiler::compile_block(u16 pc)
+{
+	auto profile = g_profiler.start(PROFILER_DRC_COMPILE);
+
+	opcode_desc const *const desclist(m_frontend.describe_code(pc));
+	bool override(false);
+	for(bool succeeded = false; !succeeded; ) {
+		try {
+			drcuml_block &block(m_uml.begin_block(16384));
+			compiler_state compiler;
+
+			for(opcode_desc const *seqhead = desclist, *seqlast = nullptr; seqhead; seqhead = seqlast->next()) {
+				for(seqlast = seqhead; !(seqlast->flags & OPFLAG_END_SEQUENCE); seqlast = seqlast->next()) { }
+
+				if(m_uml.logging())
+					block.append_comment("-------------------------");
+
+				// add a hash entry unless we'd be replacing one for code that isn't being recompiled
+				if(override || !m_uml.hash_exists(0, seqhead->pc))
+					UML_HASH(block, 0, seqhead->pc);
+				else if(seqhead == desclist) {
+					override = true;
+					UML_HASH(block, 0, seqhead->pc);
+				} else {
+					UML_HASHJMP(block, 0, seqhead->pc, *m_nocode);
+					continue;
+				}
+
+				for(opcode_desc const *curdesc = seqhead; seqlast->next() != curdesc; curdesc = curdesc->next())
+					generate_sequence_instruction(block, compiler, *curdesc);
+
+				// carry on to the next instruction (unreachable after an unconditional branch)
+				generate_jump(block, (seqlast->pc + seqlast->length) & 0xffff);
+			}
+
+			block.end();
+			succeeded = true;
+		} catch(drcuml_block::abort_compilation &) {
+			flush_cache();
+		}
+	}
+}
+
+void mb86233_device::recompiler::generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, opcode_desc const &desc)
+{
+	u32 opcode = m_host.m_cache.read_dword(desc.physpc);
+	if(m_uml.logging())
+		block.append_comment("%04X: %08X", desc.pc, opcode);
+
+	compiler.pc = desc.pc;
+	compiler.nextpc = (desc.pc + desc.length) & 0xffff;
+	compiler.stall = 0;
+	compiler.external = false;
+
+	if(desc.length == 2) {
+		if(!generate_rep(block, compiler, desc, opcode)) {
+			UML_EXH(block, *m_interpret, desc.pc);
+			return;
+		}
+	} else if(!op_supported(opcode)) {
+		UML_EXH(block, *m_interpret, desc.pc);
+		return;
+	} else if(frontend::is_branch(opcode)) {
+		generate_branch(block, compiler, opcode);
+	} else {
+		generate_opcode(block, compiler, opcode);
+		UML_SUB(block, mem(&m_host.m_icount), mem(&m_host.m_icount), 1);
+		generate_stall_handler(block, compiler);
+	}
+
+	// a memory handler may have halted us
+	if(compiler.external) {
+		UML_CMP(block, mem(&m_host.m_icount), 0);
+		UML_EXHc(block, COND_LE, *m_out_of_cycles, compiler.nextpc);
+	}
+}
+
+void mb86233_device::recompiler::generate_opcode(drcuml_block &block, compiler_state &compiler, u32 opcode)
+{
+	switch((opcode >> 26) & 0x3f) {
+	case 0x00: {
+		// lab
+		u32 r1 = opcode & 0x1ff;
+		u32 r2 = (opcode >> 9) & 0x1ff;
+		u32 alu = (opcode >> 21) & 0x1f;
+		u32 op = (opcode >> 18) & 0x7;
+
+		generate_alu_pre(block, alu);
+
+		generate_ea(block, false, r1, I0);
+		if(op == 4)
+			UML_ADD(block, I0, I0, 0x200);
+		generate_read(block, compiler, SPACE_DATA, I3, I0);
+
+		generate_ea(block, true, r2, I0);
+		if(op == 3)
+			UML_ADD(block, I0, I0, 0x200);
+		generate_read(block, compiler, op < 2 ? SPACE_IO : SPACE_DATA, I0, I0);
+
+		generate_ea_post(block, false, r1);
+		generate_ea_post(block, true, r2);
+
+		UML_MOV(block, mem(&m_host.m_a), I3);
+		UML_MOV(block, mem(&m_host.m_b), I0);
+
+		generate_alu_post(block, alu);
+		break;
+	}
+
+	case 0x07: {
+		// ld / mov
+		u32 r1 = opcode & 0x1ff;
+		u32 r2 = (opcode >> 9) & 0x1ff;
+		u32 alu = (opcode >> 21) & 0x1f;
+		u32 op = (opcode >> 18) & 0x7;
+
+		generate_alu_pre(block, alu);
+
+		if(op != 7) {
+			// memory to memory, source through unit 0 and destination through unit 1
+			generate_ea(block, false, r1, I0);
+			if(op == 4)
+				UML_ADD(block, I0, I0, 0x200);
+			generate_read(block, compiler, op == 2 ? SPACE_IO : op == 5 ? SPACE_PROGRAM : SPACE_DATA, I0, I0);
+			generate_ea_post(block, false, r1);
+
+			generate_ea(block, true, r2, I3);
+			if(op == 3)
+				UML_ADD(block, I3, I3, 0x200);
+			generate_write(block, compiler, op < 2 ? SPACE_IO : SPACE_DATA, I3, I0);
+			generate_ea_post(block, true, r2);
+
+		} else {
+			switch(r2 >> 6) {
+			case 0: case 1:
+				// mov reg, mem / mov reg, mem (e)
+				generate_read_reg(block, compiler, r2, I0);
+				generate_ea(block, true, r1, I3);
+				generate_write(block, compiler, (r2 >> 6) ? SPACE_IO : SPACE_DATA, I3, I0);
+				generate_ea_post(block, true, r1);
+				break;
+
+			case 2: case 3: case 4:
+				// mov mem + 0x200, reg / mov mem, reg / mov mem (e), reg
+				generate_ea(block, true, r1, I0);
+				if((r2 >> 6) == 2)
+					UML_ADD(block, I0, I0, 0x200);
+				generate_read(block, compiler, (r2 >> 6) == 4 ? SPACE_IO : SPACE_DATA, I0, I0);
+				generate_ea_post(block, true, r1);
+				generate_write_reg(block, compiler, r2, I0);
+				break;
+
+			case 5:
+				// mov mem (o), reg
+				generate_ea(block, false, r1, I0);
+				generate_read(block, compiler, SPACE_PROGRAM, I0, I0);
+				generate_ea_post(block, false, r1);
+				generate_write_reg(block, compiler, r2, I0);
+				break;
+
+			case 6:
+				// mov reg, reg
+				generate_read_reg(block, compiler, r1, I0);
+				generate_write_reg(block, compiler, r2, I0);
+				break;
+			}
+		}
+
+		generate_alu_post(block, alu);
+		break;
+	}
+
+	case 0x0d:
+		// stmh
+		UML_STORE(block, &m_host.m_m, 0, opcode & 0xffff, SIZE_WORD, SCALE_x1);
+		break;
+
+	case 0x0e:
+		// lipl / lia / lib / lid
+		switch((opcode >> 24) & 0x3) {
+		case 0:
+			UML_AND(block, I0, mem(&m_host.m_p), 0xff000000);
+			UML_OR(block, mem(&m_host.m_p), I0, opcode & 0xffffff);
+			break;
+		case 1:
+			UML_MOV(block, mem(&m_host.m_a), u32(util::sext(opcode, 24)));
+			break;
+		case 2:
+			UML_MOV(block, mem(&m_host.m_b), u32(util::sext(opcode, 24)));
+			break;
+		case 3:
+			UML_MOV(block, mem(&m_host.m_d), u32(util::sext(opcode, 24)));
+			generate_testdz(block);
+			break;
+		}
+		break;
+
+	case 0x0f: {
+		// clr0/clr1/set
+		u32 alu = (opcode >> 20) & 0x1f;
+
+		generate_alu_pre(block, alu);
+		if(((opcode >> 17) & 7) == 0) {
+			if(opcode & 0x0004) UML_MOV(block, mem(&m_host.m_a), 0);
+			if(opcode & 0x0008) UML_MOV(block, mem(&m_host.m_b), 0);
+			if(opcode & 0x0010) UML_MOV(block, mem(&m_host.m_d), 0);
+		}
+		generate_alu_post(block, alu);
+		break;
+	}
+
+	case 0x10: case 0x11: case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17:
+	case 0x18: case 0x19: case 0x1a: case 0x1b: case 0x1c: case 0x1d: case 0x1e: case 0x1f:
+		// ldi
+		generate_write_reg(block, compiler, opcode >> 24, u32(util::sext(opcode, 24)));
+		break;
+
+	default:
+		break;
+	}
+}
+
+bool mb86233_device::recompiler::generate_rep(drcuml_block &block, compiler_state &compiler, opcode_desc const &desc, u32 opcode)
+{
+	// the rep's own ALU field is computed but never committed
+	u16 bodypc = (desc.pc + 1) & 0xffff;
+	u32 body = m_host.m_cache.read_dword(bodypc);
+	if(!alu_supported((opcode >> 20) & 0x1f) || ((opcode & 0x8000) && !read_reg_supported(opcode)) || !op_supported(body))
+		return false;
+
+	if(opcode & 0x8000) {
+		generate_read_reg(block, compiler, opcode, I0);
+		UML_STORE(block, &m_host.m_r, 0, I0, SIZE_BYTE, SCALE_x1);
+	} else
+		UML_STORE(block, &m_host.m_r, 0, opcode & 0xff, SIZE_BYTE, SCALE_x1);
+	UML_SUB(block, mem(&m_host.m_icount), mem(&m_host.m_icount), 1);
+	UML_CMP(block, mem(&m_host.m_icount), 0);
+	UML_EXHc(block, COND_LE, *m_out_of_cycles, bodypc);
+	generate_stall_handler(block, compiler);
+
+	// a stall or running out of cycles leaves the interpreter to finish the loop
+	compiler.pc = bodypc;
+	compiler.stall = 0;
+
+	code_label top = compiler.labelnum++;
+	code_label done = compiler.labelnum++;
+	UML_LABEL(block, top);
+	generate_opcode(block, compiler, body);
+	UML_SUB(block, mem(&m_host.m_icount), mem(&m_host.m_icount), 1);
+	UML_LOAD(block, I0, &m_host.m_r, 0, SIZE_BYTE, SCALE_x1);
+	UML_CMP(block, I0, 1);
+	UML_JMPc(block, COND_E, done);
+	UML_SUB(block, I0, I0, 1);
+	UML_STORE(block, &m_host.m_r, 0, I0, SIZE_BYTE, SCALE_x1);
+	UML_CMP(block, mem(&m_host.m_icount), 0);
+	UML_EXHc(block, COND_LE, *m_out_of_cycles, bodypc);
+	UML_JMP(block, top);
+	UML_LABEL(block, done);
+	generate_stall_handler(block, compiler);
+	return true;
+}
+
+void mb86233_device::recompiler::generate_branch(drcuml_block &block, compiler_state &compiler, u32 opcode)
+{
+	u32 cond = (opcode >> 20) & 0x1f;
+	u32 subtype = (opcode >> 17) & 7;
+	u32 data = opcode & 0xffff;
+	bool invert = opcode & 0x40000000;
+	bool always = cond == 0x16 && !invert;
+	bool branch = subtype != 6;
+
+	// I4 holds whether the condition passed
+	if(!always) {
+		bool zero = false;
+		switch(cond) {
+		case 0x00: // zrd - d zero
+			UML_TEST(block, mem(&m_host.m_st), F_ZRD);
+			break;
+		case 0x01: // ged - d >= 0
+			UML_TEST(block, mem(&m_host.m_st), F_SGD);
+			zero = true;
+			break;
+		case 0x02: // led - d <= 0
+			UML_TEST(block, mem(&m_host.m_st), F_ZRD | F_SGD);
+			break;
+		case 0x0a: case 0x0b: case 0x0c: case 0x12: { // gpio0-3
+			bool &gpio = cond == 0x0a ? m_host.m_gpio0 : cond == 0x0b ? m_host.m_gpio1 : cond == 0x0c ? m_host.m_gpio2 : m_host.m_gpio3;
+			UML_LOAD(block, I4, &gpio, 0, SIZE_BYTE, SCALE_x1);
+			UML_TEST(block, I4, 0xff);
+			break;
+		}
+		case 0x10: // zc0 - c0 == 1
+			UML_TEST(block, mem(&m_host.m_st), F_ZC0);
+			zero = true;
+			break;
+		case 0x11: // zc1 - c1 == 1
+			UML_TEST(block, mem(&m_host.m_st), F_ZC1);
+			zero = true;
+			break;
+		case 0x16: // never
+			UML_TEST(block, I4, 0);
+			zero = true;
+			break;
+		}
+		UML_SETc(block, (zero != invert) ? COND_Z : COND_NZ, I4);
+	}
+
+	if(subtype != 0) {
+		code_label skip = compiler.labelnum++;
+		if(!always) {
+			UML_TEST(block, I4, 1);
+			UML_JMPc(block, COND_Z, skip);
+		}
+
+		switch(subtype) {
+		case 1: case 3: // brul / bsul
+			if(opcode & 0x4000)
+				generate_read_reg(block, compiler, opcode, I3);
+			else {
+				generate_ea(block, false, opcode & 0x1ff, I0);
+				generate_read(block, compiler, SPACE_DATA, I3, I0);
+				generate_ea_post(block, false, opcode & 0x1ff);
+			}
+			UML_AND(block, I3, I3, 0xffff);
+			if(subtype == 1)
+				break;
+			[[fallthrough]];
+		case 2: // bsif
+			for(unsigned int i=3; i; i--) {
+				UML_LOAD(block, I0, &m_host.m_pcs[i-1], 0, SIZE_WORD, SCALE_x1);
+				UML_STORE(block, &m_host.m_pcs[i], 0, I0, SIZE_WORD, SCALE_x1);
+			}
+			UML_STORE(block, &m_host.m_pcs[0], 0, compiler.nextpc, SIZE_WORD, SCALE_x1);
+			break;
+
+		case 5: // rtif
+			UML_LOAD(block, I3, &m_host.m_pcs[0], 0, SIZE_WORD, SCALE_x1);
+			for(unsigned int i=0; i != 3; i++) {
+				UML_LOAD(block, I0, &m_host.m_pcs[i+1], 0, SIZE_WORD, SCALE_x1);
+				UML_STORE(block, &m_host.m_pcs[i], 0, I0, SIZE_WORD, SCALE_x1);
+			}
+			break;
+
+		case 6: // ldif adr, rn
+			generate_ea(block, false, opcode & 0x1ff, I0);
+			generate_read(block, compiler, SPACE_DATA, I0, I0);
+			generate_ea_post(block, false, opcode & 0x1ff);
+			generate_write_reg(block, compiler, opcode >> 9, I0);
+			break;
+		}
+
+		UML_LABEL(block, skip);
+	}
+
+	// the loop counters count down whether or not the branch is taken
+	if(subtype < 2 && (cond == 0x10 || cond == 0x11)) {
+		u8 &c = cond == 0x10 ? m_host.m_c0 : m_host.m_c1;
+		code_label nodec = compiler.labelnum++;
+		UML_LOAD(block, I0, &c, 0, SIZE_BYTE, SCALE_x1);
+		UML_CMP(block, I0, 1);
+		UML_JMPc(block, COND_E, nodec);
+		UML_SUB(block, I0, I0, 1);
+		UML_STORE(block, &c, 0, I0, SIZE_BYTE, SCALE_x1);
+		UML_AND(block, I0, I0, 0xff);
+		UML_CMP(block, I0, 1);
+		UML_JMPc(block, COND_NE, nodec);
+		UML_OR(block, mem(&m_host.m_st), mem(&m_host.m_st), cond == 0x10 ? F_ZC0 : F_ZC1);
+		UML_LABEL(block, nodec);
+	}
+
+	UML_SUB(block, mem(&m_host.m_icount), mem(&m_host.m_icount), 1);
+
+	if(branch) {
+		uml::parameter target = (subtype == 0 || subtype == 2) ? uml::parameter(data) : uml::parameter(I3);
+		if(always)
+			generate_jump(block, target);
+		else {
+			code_label skip = compiler.labelnum++;
+			UML_TEST(block, I4, 1);
+			UML_JMPc(block, COND_Z, skip);
+			generate_jump(block, target);
+			UML_LABEL(block, skip);
+		}
+	}
+
+	generate_stall_handler(block, compiler);
+}
+
+void mb86233_device::recompiler::generate_jump(drcuml_block &block, uml::parameter target)
+{
+	UML_CMP(block, mem(&m_host.m_icount), 0);
+	UML_EXHc(block, COND_LE, *m_out_of_cycles, target);
+	UML_HASHJMP(block, 0, target, *m_nocode);
+}
+
+void mb86233_device::recompiler::generate_stall_handler(drcuml_block &block, compiler_state &compiler)
+{
+	// a stalled read restarts the instruction a cycle later
+	if(compiler.stall) {
+		code_label skip = compiler.labelnum++;
+		UML_JMP(block, skip);
+		UML_LABEL(block, compiler.stall);
+		UML_STORE(block, &m_host.m_stall, 0, 0, SIZE_BYTE, SCALE_x1);
+		UML_SUB(block, mem(&m_host.m_icount), mem(&m_host.m_icount), 1);
+		UML_EXH(block, *m_out_of_cycles, compiler.pc);
+		UML_LABEL(block, skip);
+		compiler.stall = 0;
+	}
+}
+
+
+/***********************************************************************
+    opcode support checks
+***********************************************************************/
+
+bool mb86233_device::recompiler::op_supported(u32 opcode)
+{
+	if(frontend::is_branch(opcode)) {
+		switch((opcode >> 17) & 7) {
+		case 0: case 2: case 5:
+			break;
+		case 1: case 3:
+			if((opcode & 0x4000) && !read_reg_supported(opcode))
+				return false;
+			break;
+		case 6:
+			if(!write_reg_supported(opcode >> 9))
+				return false;
+			break;
+		default:
+			return false;
+		}
+		return cond_supported((opcode >> 20) & 0x1f);
+	}
+
+	switch((opcode >> 26) & 0x3f) {
+	case 0x00: {
+		u32 op = (opcode >> 18) & 0x7;
+		return alu_supported((opcode >> 21) & 0x1f) && (op < 2 || op == 3 || op == 4);
+	}
+
+	case 0x07: {
+		u32 r1 = opcode & 0x1ff;
+		u32 r2 = (opcode >> 9) & 0x1ff;
+		u32 op = (opcode >> 18) & 0x7;
+		if(!alu_supported((opcode >> 21) & 0x1f) || op == 6)
+			return false;
+		if(op != 7)
+			return true;
+		switch(r2 >> 6) {
+		case 0: case 1: return read_reg_supported(r2);
+		case 2: case 3: case 4: case 5: return write_reg_supported(r2);
+		case 6: return read_reg_supported(r1) && write_reg_supported(r2);
+		default: return false;
+		}
+	}
+
+	case 0x0d:
+		return ((opcode >> 17) & 7) == 5;
+
+	case 0x0e:
+		return true;
+
+	case 0x0f: {
+		u32 sub2 = (opcode >> 17) & 7;
+		return alu_supported((opcode >> 20) & 0x1f) && (sub2 == 0 || sub2 == 1 || sub2 == 3);
+	}
+
+	case 0x10: case 0x11: case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17:
+	case 0x18: case 0x19: case 0x1a: case 0x1b: case 0x1c: case 0x1d: case 0x1e: case 0x1f:
+		return write_reg_supported(opcode >> 24);
+
+	default:
+		return false;
+	}
+}
+
+bool mb86233_device::recompiler::alu_supported(u32 alu)
+{
+	return alu <= 0x11 || alu == 0x13 || alu == 0x14 || (alu >= 0x16 && alu <= 0x1b);
+}
+
+bool mb86233_device::recompiler::cond_supported(u32 cond)
+{
+	switch(cond) {
+	case 0x00: case 0x01: case 0x02:
+	case 0x0a: case 0x0b: case 0x0c:
+	case 0x10: case 0x11: case 0x12:
+	case 0x16:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool mb86233_device::recompiler::read_reg_supported(u32 r)
+{
+	r &= 0x3f;
+	if(r >= 0x20 && r < 0x30)
+		return true;
+	switch(r) {
+	case 0x00: case 0x01: case 0x02: case 0x03:
+	case 0x0c: case 0x0d:
+	case 0x10: case 0x11: case 0x12: case 0x13: case 0x14: case 0x15:
+	case 0x19: case 0x1a: case 0x1b: case 0x1c: case 0x1d: case 0x1e: case 0x1f:
+	case 0x34:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool mb86233_device::recompiler::write_reg_supported(u32 r)
+{
+	r &= 0x3f;
+	if(r >= 0x20 && r < 0x30)
+		return true;
+	switch(r) {
+	case 0x00: case 0x01: case 0x02: case 0x03:
+	case 0x05: case 0x06: case 0x08: case 0x0a:
+	case 0x0c: case 0x0d: case 0x0f:
+	case 0x10: case 0x11: case 0x12: case 0x13: case 0x14: case 0x15:
+	case 0x19: case 0x1a: case 0x1b: case 0x1c: case 0x1d: case 0x1e: case 0x1f:
+	case 0x34: case 0x3c:
+		return true;
+	default:
+		return false;
+	}
+}
+
+
+/***********************************************************************
+    sub-operations
+***********************************************************************/
+
+void mb86233_device::recompiler::generate_alu_pre(drcuml_block &block, u32 alu)
+{
+	// result in I0, flags computed as integer or floating point
+	bool fp = false;
+	switch(alu) {
+	case 0x00: // no alu
+		return;
+
+	case 0x01: // andd
+		UML_AND(block, I0, mem(&m_host.m_d), mem(&m_host.m_a));
+		break;
+
+	case 0x02: // orad
+		UML_OR(block, I0, mem(&m_host.m_d), mem(&m_host.m_a));
+		break;
+
+	case 0x03: // eord
+		UML_XOR(block, I0, mem(&m_host.m_d), mem(&m_host.m_a));
+		break;
+
+	case 0x04: // notd
+		UML_XOR(block, I0, mem(&m_host.m_d), 0xffffffff);
+		break;
+
+	case 0x05: // fcpd - flags only
+		UML_FSSUB(block, F0, mem(&m_host.m_d), mem(&m_host.m_a));
+		UML_ICOPYFS(block, I0, F0);
+		generate_sz(block, I1, I0, true);
+		UML_MOV(block, mem(&m_host.m_alu_stset), I1);
+		return;
+
+	case 0x06: // fmad
+		UML_FSADD(block, F0, mem(&m_host.m_d), mem(&m_host.m_a));
+		UML_ICOPYFS(block, I0, F0);
+		fp = true;
+		break;
+
+	case 0x07: // fsbd
+		UML_FSSUB(block, F0, mem(&m_host.m_d), mem(&m_host.m_a));
+		UML_ICOPYFS(block, I0, F0);
+		fp = true;
+		break;
+
+	case 0x08: // fml - no flags
+		UML_FSMUL(block, F0, mem(&m_host.m_a), mem(&m_host.m_b));
+		UML_FSMOV(block, mem(&m_host.m_alu_r1), F0);
+		UML_MOV(block, mem(&m_host.m_alu_stset), 0);
+		return;
+
+	case 0x09: // fmsd
+	case 0x0c: // fsmd
+		UML_FSADD(block, F0, mem(&m_host.m_d), mem(&m_host.m_p));
+		UML_ICOPYFS(block, I0, F0);
+		fp = true;
+		break;
+
+	case 0x0a: // fmrd
+		UML_FSSUB(block, F0, mem(&m_host.m_d), mem(&m_host.m_p));
+		UML_ICOPYFS(block, I0, F0);
+		fp = true;
+		break;
+
+	case 0x0b: // fabd
+		UML_AND(block, I0, mem(&m_host.m_d), 0x7fffffff);
+		fp = true;
+		break;
+
+	case 0x0d: // fspd
+		UML_MOV(block, I0, mem(&m_host.m_p));
+		fp = true;
+		break;
+
+	case 0x0e: // cxfd
+		UML_FSFRINT(block, F0, mem(&m_host.m_d), SIZE_DWORD);
+		UML_ICOPYFS(block, I0, F0);
+		break;
+
+	case 0x0f: // cfxd - rounding mode from m
+		UML_MOV(block, mem(&m_arg), alu);
+		UML_CALLC(block, &recompiler::cfunc_alu_pre, this);
+		return;
+
+	case 0x10: // fdvd
+		UML_FSDIV(block, F0, mem(&m_host.m_d), mem(&m_host.m_a));
+		UML_ICOPYFS(block, I0, F0);
+		fp = true;
+		break;
+
+	case 0x11: // fned
+		UML_MOV(block, I1, mem(&m_host.m_d));
+		UML_XOR(block, I0, I1, 0x80000000);
+		UML_TEST(block, I1, 0xffffffff);
+		UML_MOVc(block, COND_Z, I0, 0);
+		fp = true;
+		break;
+
+	case 0x13: // d = b + a
+		UML_FSADD(block, F0, mem(&m_host.m_b), mem(&m_host.m_a));
+		UML_ICOPYFS(block, I0, F0);
+		fp = true;
+		break;
+
+	case 0x14: // d = b - a
+		UML_FSSUB(block, F0, mem(&m_host.m_b), mem(&m_host.m_a));
+		UML_ICOPYFS(block, I0, F0);
+		fp = true;
+		break;
+
+	case 0x16: // lsrd
+	case 0x17: // lsld
+	case 0x18: // asrd
+	case 0x19: // asld
+		UML_LOAD(block, I1, &m_host.m_sft, 0, SIZE_BYTE, SCALE_x1);
+		if(alu == 0x16)
+			UML_SHR(block, I0, mem(&m_host.m_d), I1);
+		else if(alu == 0x18)
+			UML_SAR(block, I0, mem(&m_host.m_d), I1);
+		else
+			UML_SHL(block, I0, mem(&m_host.m_d), I1);
+		break;
+
+	case 0x1a: // addd
+		UML_ADD(block, I0, mem(&m_host.m_d), mem(&m_host.m_a));
+		break;
+
+	case 0x1b: // subd
+		UML_SUB(block, I0, mem(&m_host.m_d), mem(&m_host.m_a));
+		break;
+	}
+
+	UML_MOV(block, mem(&m_host.m_alu_r1), I0);
+	generate_sz(block, I1, I0, fp);
+	UML_MOV(block, mem(&m_host.m_alu_stset), I1);
+
+	// the multiplier runs alongside
+	if(alu == 0x09 || alu == 0x0a || alu == 0x0d) {
+		UML_FSMUL(block, F1, mem(&m_host.m_a), mem(&m_host.m_b));
+		UML_FSMOV(block, mem(&m_host.m_alu_r2), F1);
+	}
+}
+
+void mb86233_device::recompiler::generate_alu_post(drcuml_block &block, u32 alu)
+{
+	switch(alu) {
+	case 0x00: // no alu
+		return;
+
+	case 0x05: // flags only
+		break;
+
+	case 0x08: // p update
+		UML_MOV(block, mem(&m_host.m_p), mem(&m_host.m_alu_r1));
+		return;
+
+	case 0x09: case 0x0a: case 0x0d: // d, p update
+		UML_MOV(block, mem(&m_host.m_d), mem(&m_host.m_alu_r1));
+		UML_MOV(block, mem(&m_host.m_p), mem(&m_host.m_alu_r2));
+		break;
+
+	default: // d update
+		UML_MOV(block, mem(&m_host.m_d), mem(&m_host.m_alu_r1));
+		break;
+	}
+
+	UML_AND(block, I0, mem(&m_host.m_st), ~u32(ALU_D_FLAGS));
+	UML_OR(block, mem(&m_host.m_st), I0, mem(&m_host.m_alu_stset));
+}
+
+void mb86233_device::recompiler::generate_sz(drcuml_block &block, uml::parameter dst, uml::parameter src, bool fp)
+{
+	// sign unless the value (or its magnitude, for floating point) is zero
+	UML_ROLAND(block, dst, src, 4, F_SGD);
+	UML_TEST(block, src, fp ? 0x7fffffff : 0xffffffff);
+	UML_MOVc(block, COND_Z, dst, F_ZRD);
+}
+
+void mb86233_device::recompiler::generate_testdz(drcuml_block &block)
+{
+	UML_MOV(block, I1, mem(&m_host.m_d));
+	generate_sz(block, I2, I1, false);
+	UML_AND(block, I1, mem(&m_host.m_st), ~u32(F_ZRD | F_SGD));
+	UML_OR(block, mem(&m_host.m_st), I1, I2);
+}
+
+void mb86233_device::recompiler::generate_ea(drcuml_block &block, bool unit1, u32 r, uml::parameter dst)
+{
+	// clobbers I2
+	u16 &b = unit1 ? m_host.m_b1 : m_host.m_b0;
+	u16 &x = unit1 ? m_host.m_x1 : m_host.m_x0;
+
+	switch(r & 0x180) {
+	case 0x000:
+		UML_MOV(block, dst, r & 0x7f);
+		return;
+
+	case 0x080: case 0x100:
+		UML_LOAD(block, dst, &x, 0, SIZE_WORD, SCALE_x1);
+		UML_LOAD(block, I2, &b, 0, SIZE_WORD, SCALE_x1);
+		UML_ADD(block, dst, dst, I2);
+		UML_ADD(block, dst, dst, r & 0x7f);
+		break;
+
+	case 0x180:
+		UML_LOAD(block, dst, &x, 0, SIZE_WORD, SCALE_x1);
+		if(r & 0x40) {
+			UML_LOAD(block, I2, &m_host.m_vsmr, 0, SIZE_WORD, SCALE_x1);
+			UML_AND(block, dst, dst, I2);
+		}
+		if(r & 0x20)
+			return;
+		UML_LOAD(block, I2, &b, 0, SIZE_WORD, SCALE_x1);
+		UML_ADD(block, dst, dst, I2);
+		break;
+	}
+	UML_AND(block, dst, dst, 0xffff);
+}
+
+void mb86233_device::recompiler::generate_ea_post(drcuml_block &block, bool unit1, u32 r)
+{
+	// clobbers I1 and I2
+	if(!(r & 0x100))
+		return;
+
+	u16 &x = unit1 ? m_host.m_x1 : m_host.m_x0;
+	UML_LOAD(block, I1, &x, 0, SIZE_WORD, SCALE_x1);
+	if(!(r & 0x080)) {
+		UML_LOAD(block, I2, unit1 ? &m_host.m_i1 : &m_host.m_i0, 0, SIZE_WORD, SCALE_x1);
+		UML_ADD(block, I1, I1, I2);
+	} else
+		UML_ADD(block, I1, I1, u32(util::sext(r, 5)));
+	UML_STORE(block, &x, 0, I1, SIZE_WORD, SCALE_x1);
+}
+
+void mb86233_device::recompiler::generate_read(drcuml_block &block, compiler_state &compiler, uml::memory_space space, uml::parameter dst, uml::parameter addr)
+{
+	UML_READ(block, dst, addr, SIZE_DWORD, space);
+	generate_stall_check(block, compiler);
+	compiler.external = true;
+}
+
+void mb86233_device::recompiler::generate_write(drcuml_block &block, compiler_state &compiler, uml::memory_space space, uml::parameter addr, uml::parameter src)
+{
+	UML_WRITE(block, addr, src, SIZE_DWORD, space);
+	compiler.external = true;
+}
+
+void mb86233_device::recompiler::generate_read_reg(drcuml_block &block, compiler_state &compiler, u32 r, uml::parameter dst)
+{
+	// clobbers I1 and I2
+	r &= 0x3f;
+	switch(r) {
+	case 0x00: UML_LOAD(block, dst, &m_host.m_b0, 0, SIZE_WORD, SCALE_x1); break;
+	case 0x01: UML_LOAD(block, dst, &m_host.m_b1, 0, SIZE_WORD, SCALE_x1); break;
+	case 0x02: UML_LOAD(block, dst, &m_host.m_x0, 0, SIZE_WORD, SCALE_x1); break;
+	case 0x03: UML_LOAD(block, dst, &m_host.m_x1, 0, SIZE_WORD, SCALE_x1); break;
+
+	case 0x0c: UML_LOAD(block, dst, &m_host.m_c0, 0, SIZE_BYTE, SCALE_x1); break;
+	case 0x0d: UML_LOAD(block, dst, &m_host.m_c1, 0, SIZE_BYTE, SCALE_x1); break;
+
+	case 0x10: case 0x13: case 0x19: case 0x1c:
+		UML_MOV(block, dst, mem(&float_reg(r)));
+		break;
+
+	case 0x11: case 0x14: case 0x1a: case 0x1d:
+		// exponent
+		UML_ROLAND(block, dst, mem(&float_reg(r)), 9, 0xff);
+		break;
+
+	case 0x12: case 0x15: case 0x1b: case 0x1e:
+		// mantissa, with the sign extended over the exponent
+		UML_MOV(block, I1, mem(&float_reg(r)));
+		UML_SAR(block, I2, I1, 31);
+		UML_AND(block, I2, I2, 0x7f800000);
+		UML_AND(block, I1, I1, 0x807fffff);
+		UML_OR(block, dst, I1, I2);
+		break;
+
+	case 0x1f: UML_LOAD(block, dst, &m_host.m_sft, 0, SIZE_BYTE, SCALE_x1); break;
+	case 0x34: UML_LOAD(block, dst, &m_host.m_rpc, 0, SIZE_BYTE, SCALE_x1); break;
+
+	default:
+		// register file
+		UML_MOV(block, mem(&m_arg), r & 0x1f);
+		UML_CALLC(block, &recompiler::cfunc_read_reg, this);
+		UML_MOV(block, dst, mem(&m_value));
+		generate_stall_check(block, compiler);
+		compiler.external = true;
+		break;
+	}
+}
+
+void mb86233_device::recompiler::generate_write_reg(drcuml_block &block, compiler_state &compiler, u32 r, uml::parameter src)
+{
+	// clobbers I1 and I2
+	r &= 0x3f;
+	switch(r) {
+	case 0x00: UML_STORE(block, &m_host.m_b0, 0, src, SIZE_WORD, SCALE_x1); break;
+	case 0x01: UML_STORE(block, &m_host.m_b1, 0, src, SIZE_WORD, SCALE_x1); break;
+	case 0x02: UML_STORE(block, &m_host.m_x0, 0, src, SIZE_WORD, SCALE_x1); break;
+	case 0x03: UML_STORE(block, &m_host.m_x1, 0, src, SIZE_WORD, SCALE_x1); break;
+
+	case 0x05: UML_STORE(block, &m_host.m_i0, 0, src, SIZE_WORD, SCALE_x1); break;
+	case 0x06: UML_STORE(block, &m_host.m_i1, 0, src, SIZE_WORD, SCALE_x1); break;
+
+	case 0x08: UML_STORE(block, &m_host.m_sp, 0, src, SIZE_WORD, SCALE_x1); break;
+
+	case 0x0a:
+		UML_AND(block, I1, src, 7);
+		UML_STORE(block, &m_host.m_vsm, 0, I1, SIZE_BYTE, SCALE_x1);
+		UML_MOV(block, I2, 8);
+		UML_SHL(block, I2, I2, I1);
+		UML_SUB(block, I2, I2, 1);
+		UML_STORE(block, &m_host.m_vsmr, 0, I2, SIZE_WORD, SCALE_x1);
+		break;
+
+	case 0x0c: case 0x0d:
+		UML_AND(block, I1, src, 0xff);
+		UML_STORE(block, r == 0x0c ? &m_host.m_c0 : &m_host.m_c1, 0, I1, SIZE_BYTE, SCALE_x1);
+		UML_CMP(block, I1, 1);
+		UML_SETc(block, COND_E, I1);
+		UML_ROLINS(block, mem(&m_host.m_st), I1, r == 0x0c ? 30 : 31, r == 0x0c ? F_ZC0 : F_ZC1);
+		break;
+
+	case 0x0f: break;
+
+	case 0x10: case 0x13: case 0x19: case 0x1c:
+		UML_MOV(block, mem(&float_reg(r)), src);
+		break;
+
+	case 0x11: case 0x14: case 0x1a: case 0x1d:
+		// exponent
+		UML_MOV(block, I1, mem(&float_reg(r)));
+		UML_ROLINS(block, I1, src, 23, 0x7f800000);
+		UML_MOV(block, mem(&float_reg(r)), I1);
+		break;
+
+	case 0x12: case 0x15: case 0x1b: case 0x1e:
+		// mantissa, with bit 23 as the sign
+		UML_AND(block, I1, mem(&float_reg(r)), 0x7f800000);
+		UML_ROLINS(block, I1, src, 8, 0x80000000);
+		UML_ROLINS(block, I1, src, 0, 0x007fffff);
+		UML_MOV(block, mem(&float_reg(r)), I1);
+		break;
+
+	case 0x1f: UML_STORE(block, &m_host.m_sft, 0, src, SIZE_BYTE, SCALE_x1); break;
+	case 0x34: UML_STORE(block, &m_host.m_rpc, 0, src, SIZE_BYTE, SCALE_x1); break;
+	case 0x3c: UML_STORE(block, &m_host.m_mask, 0, src, SIZE_WORD, SCALE_x1); break;
+
+	default:
+		// register file
+		UML_MOV(block, mem(&m_arg), r & 0x1f);
+		UML_MOV(block, mem(&m_value), src);
+		UML_CALLC(block, &recompiler::cfunc_write_reg, this);
+		compiler.external = true;
+		break;
+	}
+
+	if(r >= 0x19 && r <= 0x1b)
+		generate_testdz(block);
+}
+
+void mb86233_device::recompiler::generate_stall_check(drcuml_block &block, compiler_state &compiler)
+{
+	// clobbers I1
+	if(!compiler.stall)
+		compiler.stall = compiler.labelnum++;
+	UML_LOAD(block, I1, &m_host.m_stall, 0, SIZE_BYTE, SCALE_x1);
+	UML_TEST(block, I1, 0xff);
+	UML_JMPc(block, COND_NZ, compiler.stall);
+}
+
+u32 &mb86233_device::recompiler::float_reg(u32 r)
+{
+	switch(r) {
+	case 0x10: case 0x11: case 0x12: return m_host.m_a;
+	case 0x13: case 0x14: case 0x15: return m_host.m_b;
+	case 0x19: case 0x1a: case 0x1b: return m_host.m_d;
+	default: return m_host.m_p;
+	}
+}
+
+
+/***********************************************************************
+    C callbacks
+***********************************************************************/
+
+void mb86233_device::recompiler::cfunc_alu_pre(void *param)
+{
+	recompiler &rc(*reinterpret_cast<recompiler *>(param));
+	rc.m_host.alu_pre(rc.m_arg);
+}
+
+void mb86233_device::recompiler::cfunc_read_reg(void *param)
+{
+	recompiler &rc(*reinterpret_cast<recompiler *>(param));
+	rc.m_value = rc.m_host.m_rf.read_dword(rc.m_arg);
+}
+
+void mb86233_device::recompiler::cfunc_write_reg(void *param)
+{
+	recompiler &rc(*reinterpret_cast<recompiler *>(param));
+	rc.m_host.m_rf.write_dword(rc.m_arg, rc.m_value);
+}
@@ -0,0 +1,113 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    Fujitsu MB86233 (TGP) recompiler
+
+***************************************************************************/
+#ifndef MAME_CPU_MB86233_MB86233RC_H
+#define MAME_CPU_MB86233_MB86233RC_H
+
+#pragma once
+
+#include "mb86233.h"
+#include "mb86233fe.h"
+
+#include "cpu/drcuml.h"
+
+
+class mb86233_device::recompiler
+{
+public:
+	recompiler(mb86233_device &host, u32 flags);
+	~recompiler();
+
+	void flush() { m_cache_dirty = true; }
+	bool execute();
+
+private:
+	// compilation boundaries, in instructions
+	enum : u32 {
+		COMPILE_BACKWARDS = 64,
+		COMPILE_FORWARDS = 256,
+		COMPILE_MAX_SEQUENCE = 64
+	};
+
+	// exit codes for recompiled blocks
+	enum : int {
+		EXEC_OUT_OF_CYCLES,
+		EXEC_MISSING_CODE,
+		EXEC_RESET_CACHE,
+		EXEC_INTERPRET
+	};
+
+	// per-instruction compilation state
+	struct compiler_state {
+		uml::code_label labelnum = 1;           // next label to allocate
+		u16             pc = 0;                 // address of the current instruction
+		u16             nextpc = 0;             // address of the following instruction
+		uml::code_label stall = 0;              // where a stalled read goes, if any
+		bool            external = false;       // went through a memory handler or callout
+	};
+
+	// static code generation
+	void flush_cache();
+	void generate_entry_point();
+	void generate_nocode_handler();
+	void generate_out_of_cycles();
+	void generate_interpret_handler();
+
+	// compilation
+	void compile_block(u16 pc);
+	void generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, opcode_desc const &desc);
+	void generate_opcode(drcuml_block &block, compiler_state &compiler, u32 opcode);
+	bool generate_rep(drcuml_block &block, compiler_state &compiler, opcode_desc const &desc, u32 opcode);
+	void generate_branch(drcuml_block &block, compiler_state &compiler, u32 opcode);
+	void generate_jump(drcuml_block &block, uml::parameter target);
+	void generate_stall_handler(drcuml_block &block, compiler_state &compiler);
+
+	// opcode support checks
+	static bool op_supported(u32 opcode);
+	static bool alu_supported(u32 alu);
+	static bool cond_supported(u32 cond);
+	static bool read_reg_supported(u32 r);
+	static bool write_reg_supported(u32 r);
+
+	// sub-operations
+	void generate_alu_pre(drcuml_block &block, u32 alu);
+	void generate_alu_post(drcuml_block &block, u32 alu);
+	void generate_sz(drcuml_block &block, uml::parameter dst, uml::parameter src, bool fp);
+	void generate_testdz(drcuml_block &block);
+	void generate_ea(drcuml_block &block, bool unit1, u32 r, uml::parameter dst);
+	void generate_ea_post(drcuml_block &block, bool unit1, u32 r);
+	void generate_read(drcuml_block &block, compiler_state &compiler, uml::memory_space space, uml::parameter dst, uml::parameter addr);
+	void generate_write(drcuml_block &block, compiler_state &compiler, uml::memory_space space, uml::parameter addr, uml::parameter src);
+	void generate_read_reg(drcuml_block &block, compiler_state &compiler, u32 r, uml::parameter dst);
+	void generate_write_reg(drcuml_block &block, compiler_state &compiler, u32 r, uml::parameter src);
+	void generate_stall_check(drcuml_block &block, compiler_state &compiler);
+	u32 &float_reg(u32 r);
+
+	// C callbacks
+	static void cfunc_alu_pre(void *param);
+	static void cfunc_read_reg(void *param);
+	static void cfunc_write_reg(void *param);
+
+	// host CPU device, frontend to describe instructions, and UML engine
+	mb86233_device      &m_host;
+	frontend            m_frontend;
+	drcuml_state        m_uml;
+
+	// static code handles
+	uml::code_handle    *m_entry = nullptr;
+	uml::code_handle    *m_nocode = nullptr;
+	uml::code_handle    *m_out_of_cycles = nullptr;
+	uml::code_handle    *m_interpret = nullptr;
+
+	// callout arguments
+	u32                 m_arg = 0;
+	u32                 m_value = 0;
+
+	bool                m_cache_dirty = true;
+};
+
+#endif // MAME_CPU_MB86233_MB86233RC_H
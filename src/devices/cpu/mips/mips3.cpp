@@ -176,8 +176,11 @@ mips3_device::mips3_device(const machine_config &mconfig, device_type type, cons
 	, m_drcfe(nullptr)
 	, m_drcoptions(0)
 	, m_drc_cache_dirty(0)
+	, m_compile_allowance(0)
+	, m_compile_last(0)
 	, m_entry(nullptr)
 	, m_nocode(nullptr)
+	, m_hot_code(nullptr)
 	, m_out_of_cycles(nullptr)
 	, m_tlb_mismatch(nullptr)
 	, m_hotspot_select(0)
@@ -5320,16 +5323,29 @@ void mips3_device::execute_run()
 			code_flush_cache();
 		m_drc_cache_dirty = false;
 
+		/* catch up on blocks whose compilation was put off */
+		if (m_drcoptions & MIPS3DRC_DEFERRED_COMPILE)
+			code_compile_pending();
+
 		/* execute */
 		do
 		{
 			/* run as much as we can */
 			execute_result = m_drcuml->execute(*m_entry);
 
-			/* if we need to recompile, do it */
+			/* if we need to recompile, do it now or interpret until later */
 			if (execute_result == EXECUTE_MISSING_CODE)
 			{
-				code_compile_block(m_core->mode, m_core->pc);
+				if (m_drcoptions & MIPS3DRC_DEFERRED_COMPILE)
+				{
+					code_compile_deferred(m_core->mode, m_core->pc);
+					if (m_core->icount <= 0)
+						break;
+				}
+				else
+				{
+					code_compile_block(m_core->mode, m_core->pc);
+				}
 			}
 			else if (execute_result == EXECUTE_UNMAPPED_CODE)
 			{
@@ -5339,6 +5355,11 @@ void mips3_device::execute_run()
 			{
 				code_flush_cache();
 			}
+			else if (execute_result == EXECUTE_HOT_CODE)
+			{
+				code_compile_block(m_core->mode, m_core->pc, true);
+				m_drcfe->reset_trace_counter(m_core->pc);
+			}
 
 		} while (execute_result != EXECUTE_OUT_OF_CYCLES);
 
@@ -5356,6 +5377,21 @@ void mips3_device::execute_run()
 	check_irqs();
 
 	/* core execution loop */
+	execute_interpreted(false);
+
+	m_core->icount -= m_interrupt_cycles;
+	m_interrupt_cycles = 0;
+}
+
+
+/*-------------------------------------------------
+    execute_interpreted - run the interpreter until
+    out of cycles or, when standing in for the
+    DRC, until reaching code that is compiled
+-------------------------------------------------*/
+
+void mips3_device::execute_interpreted(bool drc_fallback)
+{
 	do
 	{
 		uint32_t op;
@@ -5573,10 +5609,7 @@ void mips3_device::execute_run()
 			elf_loaded = true;
 		}
 #endif
-	} while (m_core->icount > 0 || m_nextpc != ~0);
-
-	m_core->icount -= m_interrupt_cycles;
-	m_interrupt_cycles = 0;
+	} while ((m_core->icount > 0 || m_nextpc != ~0) && !(drc_fallback && m_nextpc == ~0 && code_exists_for_pc()));
 }
 
 
@@ -306,6 +306,7 @@ public:
 	TIMER_CALLBACK_MEMBER(compare_int_callback);
 
 	void add_fastram(offs_t start, offs_t end, uint8_t readonly, void *base);
+	void add_fastram_from_map();
 	void clear_fastram(uint32_t select_start);
 	void mips3drc_set_options(uint32_t options);
 	uint32_t mips3drc_get_options();
@@ -482,6 +483,11 @@ protected:
 												/* internal stuff */
 	uint8_t         m_drc_cache_dirty;          /* true if we need to flush the cache */
 
+												/* deferred compilation */
+	int64_t         m_compile_allowance;        /* host ticks of compilation we may still spend */
+	osd_ticks_t     m_compile_last;             /* host time the allowance was last topped up */
+	std::vector<std::pair<uint8_t, offs_t>> m_compile_pending; /* mode/PC pairs waiting to be compiled */
+
 												/* tables */
 	uint8_t         m_fpmode[4];                /* FPU mode table */
 
@@ -492,6 +498,7 @@ protected:
 												/* subroutines */
 	uml::code_handle *   m_entry;                      /* entry point */
 	uml::code_handle *   m_nocode;                     /* nocode exception handler */
+	uml::code_handle *   m_hot_code;                   /* hot code exception handler */
 	uml::code_handle *   m_out_of_cycles;              /* out of cycles exception handler */
 	uml::code_handle *   m_tlb_mismatch;               /* tlb mismatch handler */
 	uml::code_handle *   m_read8[3];                   /* read byte */
@@ -602,7 +609,12 @@ private:
 	void load_fast_iregs(drcuml_block &block);
 	void save_fast_iregs(drcuml_block &block);
 	void code_flush_cache();
-	void code_compile_block(uint8_t mode, offs_t pc);
+	void code_compile_block(uint8_t mode, offs_t pc, bool trace = false);
+	void code_compile_deferred(uint8_t mode, offs_t pc);
+	void code_compile_pending();
+	bool code_exists_for_pc();
+	uint8_t code_mode_from_sr() const;
+	void execute_interpreted(bool drc_fallback);
 public:
 	void func_get_cycles();
 	void func_printf_exception();
@@ -624,6 +636,7 @@ private:
 
 	void static_generate_entry_point();
 	void static_generate_nocode_handler();
+	void static_generate_hot_code_handler();
 	void static_generate_out_of_cycles();
 	void static_generate_tlb_mismatch();
 	void static_generate_exception(uint8_t exception, int recover, const char *name);
@@ -1043,6 +1056,8 @@ COMPILER-SPECIFIC OPTIONS
 #define MIPS3DRC_CHECK_OVERFLOWS    0x0020          /* actually check overflows on add/sub instructions */
 #define MIPS3DRC_ACCURATE_DIVZERO   0x0040          /* load correct values into HI/LO on integer divide-by-zero */
 #define MIPS3DRC_EXTRA_INSTR_CHECK  0x0080          /* adds the last instruction value to all validation entry locations, used with STRICT_VERIFY */
+#define MIPS3DRC_DEFERRED_COMPILE   0x0100          /* spread compilation over time, interpreting code that is not yet compiled */
+#define MIPS3DRC_HOT_TRACES         0x0200          /* recompile frequently entered blocks with a wider window */
 
 #define MIPS3DRC_COMPATIBLE_OPTIONS (MIPS3DRC_STRICT_VERIFY | MIPS3DRC_STRICT_COP1 | MIPS3DRC_STRICT_COP0 | MIPS3DRC_STRICT_COP2)
 #define MIPS3DRC_FASTEST_OPTIONS    (0)
@@ -94,12 +94,20 @@ void mips3_device::mips3com_update_cycle_counting()
 
 void mips3_device::mips3com_asid_changed()
 {
+	int current_asid = m_core->cpr[0][COP0_EntryHi] & 0xff;
 	int tlbindex;
 
-	/* iterate over all non-global TLB entries and remap them */
+	/* iterate over all non-global TLB entries and remap them; entries tagged with */
+	/* another process's ASID that are already unmapped can be left alone */
 	for (tlbindex = 0; tlbindex < m_tlbentries; tlbindex++)
-		if (!tlb_entry_is_global(&m_tlb[tlbindex]))
-			tlb_map_entry(tlbindex);
+	{
+		mips3_tlb_entry *entry = &m_tlb[tlbindex];
+		if (tlb_entry_is_global(entry))
+			continue;
+		if (!tlb_entry_matches_asid(entry, current_asid) && !vtlb_fixed_pages(2 * tlbindex + 0) && !vtlb_fixed_pages(2 * tlbindex + 1))
+			continue;
+		tlb_map_entry(tlbindex);
+	}
 }
 
 
@@ -158,6 +158,10 @@ void mips3_device::mips3drc_set_options(uint32_t options)
 {
 	if (!allow_drc()) return;
 	m_drcoptions = options;
+
+	/* hot traces widen the window fourfold */
+	if (options & MIPS3DRC_HOT_TRACES)
+		m_drcfe->set_trace_window(COMPILE_BACKWARDS_BYTES * 4, COMPILE_FORWARDS_BYTES * 4, COMPILE_MAX_SEQUENCE * 4);
 }
 
 /*-------------------------------------------------
@@ -203,6 +207,72 @@ void mips3_device::add_fastram(offs_t start, offs_t end, uint8_t readonly, void
 }
 
 
+/*-------------------------------------------------
+    add_fastram_from_map - add fastram regions for
+    the RAM and ROM entries of the program space's
+    address map, largest first, as long as free
+    regions remain; an entry is only taken if a
+    single live memory handler still covers it,
+    so call this after any handlers are installed
+    over RAM
+-------------------------------------------------*/
+
+void mips3_device::add_fastram_from_map()
+{
+	address_space &program = space(AS_PROGRAM);
+	address_map const *const map = program.map();
+	if (!map)
+		return;
+
+	std::vector<memory_entry> read_map, write_map;
+	program.dump_maps(read_map, write_map);
+
+	// true if one handler covers the whole range, and it maps straight to base
+	offs_t const unitmask = (program.data_width() / 8) - 1;
+	auto const direct =
+			[&program, unitmask] (std::vector<memory_entry> const &entries, offs_t start, offs_t end, void *base, bool iswrite)
+			{
+				handler_entry const *handler = nullptr;
+				for (memory_entry const &entry : entries)
+				{
+					if ((entry.end < start) || (entry.start > end))
+						continue;
+					if (handler && (entry.entry != handler))
+						return false;
+					handler = entry.entry;
+				}
+				if (!handler)
+					return false;
+
+				offs_t const last = end & ~unitmask;
+				void *const startptr = iswrite ? program.get_write_ptr(start) : program.get_read_ptr(start);
+				void *const lastptr = iswrite ? program.get_write_ptr(last) : program.get_read_ptr(last);
+				return (startptr == base) && (lastptr == static_cast<uint8_t *>(base) + (last - start));
+			};
+
+	struct candidate { offs_t start, end; bool readonly; void *base; };
+	std::vector<candidate> found;
+	for (address_map_entry const &entry : map->m_entrylist)
+	{
+		if (((entry.m_read.m_type != AMH_RAM) && (entry.m_read.m_type != AMH_ROM)) || !entry.m_memory)
+			continue;
+		if (!direct(read_map, entry.m_addrstart, entry.m_addrend, entry.m_memory, false))
+			continue;
+
+		// writes go through handlers unless the same memory is writable
+		bool const readonly = (entry.m_write.m_type != AMH_RAM) || !direct(write_map, entry.m_addrstart, entry.m_addrend, entry.m_memory, true);
+		found.push_back(candidate{ entry.m_addrstart, entry.m_addrend, readonly, entry.m_memory });
+	}
+
+	std::stable_sort(
+			found.begin(),
+			found.end(),
+			[] (candidate const &a, candidate const &b) { return (a.end - a.start) > (b.end - b.start); });
+	for (candidate const &region : found)
+		add_fastram(region.start, region.end, region.readonly, region.base);
+}
+
+
 /*-------------------------------------------------
     mips3drc_add_hotspot - add a new hotspot
 -------------------------------------------------*/
@@ -242,6 +312,7 @@ void mips3_device::code_flush_cache()
 		/* generate the entry point and out-of-cycles handlers */
 		static_generate_entry_point();
 		static_generate_nocode_handler();
+		static_generate_hot_code_handler();
 		static_generate_out_of_cycles();
 		static_generate_tlb_mismatch();
 
@@ -292,7 +363,7 @@ void mips3_device::code_flush_cache()
     given mode at the specified pc
 -------------------------------------------------*/
 
-void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
+void mips3_device::code_compile_block(uint8_t mode, offs_t pc, bool trace)
 {
 	compiler_state compiler = { 0 };
 	const opcode_desc *seqhead, *seqlast;
@@ -302,8 +373,9 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 
 	auto profile = g_profiler.start(PROFILER_DRC_COMPILE);
 
-	/* get a description of this sequence */
-	desclist = m_drcfe->describe_code(pc);
+	/* get a description of this sequence, or of the wider trace if it is hot */
+	const bool count_entries = !trace && (m_drcoptions & MIPS3DRC_HOT_TRACES) && m_drcfe->traces_enabled();
+	desclist = trace ? m_drcfe->describe_trace(pc) : m_drcfe->describe_code(pc);
 	/* get last instruction of the code (potentially used in generate_checksum) */
 	codelast = m_drcfe->get_last();
 	if (m_drcuml->logging() || m_drcuml->logging_native())
@@ -316,7 +388,7 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 		try
 		{
 			/* start the block */
-			drcuml_block &block(m_drcuml->begin_block(4096));
+			drcuml_block &block(m_drcuml->begin_block(trace ? 16384 : 4096));
 
 			/* loop until we get through all instruction sequences */
 			for (seqhead = desclist; seqhead != nullptr; seqhead = seqlast->next())
@@ -355,6 +427,13 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 					continue;
 				}
 
+				/* count entries through the hash table so hot code can be retraced */
+				if (count_entries && seqhead == desclist)
+				{
+					UML_SUB(block, mem(m_drcfe->trace_counter(pc)), mem(m_drcfe->trace_counter(pc)), 1);   // sub     [counter],[counter],1
+					UML_EXHc(block, COND_Z, *m_hot_code, pc);                                               // exh     hot_code,pc,z
+				}
+
 				/* validate this code block if we're not pointing into ROM */
 				if (m_program->get_write_ptr(seqhead->physpc) != nullptr)
 					generate_checksum_block(block, compiler, seqhead, seqlast, codelast);
@@ -405,6 +484,84 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 }
 
 
+/*-------------------------------------------------
+    code_compile_deferred - compile a missing
+    block if the compile allowance permits,
+    otherwise queue it and interpret until we
+    reach code that is already compiled
+-------------------------------------------------*/
+
+void mips3_device::code_compile_deferred(uint8_t mode, offs_t pc)
+{
+	/* compilation may use a quarter of host time, banked up to 4ms */
+	const osd_ticks_t now = osd_ticks();
+	if (m_compile_last != 0)
+		m_compile_allowance = std::min<int64_t>(m_compile_allowance + int64_t(now - m_compile_last) / 4, osd_ticks_per_second() / 250);
+	m_compile_last = now;
+
+	if (m_compile_allowance > 0)
+	{
+		code_compile_block(mode, pc);
+		m_compile_allowance -= int64_t(osd_ticks() - now);
+		return;
+	}
+
+	/* remember the block for later and keep going in the interpreter */
+	const std::pair<uint8_t, offs_t> key(mode, pc);
+	if (m_compile_pending.size() < 256 && std::find(m_compile_pending.begin(), m_compile_pending.end(), key) == m_compile_pending.end())
+		m_compile_pending.push_back(key);
+
+	check_irqs();
+	execute_interpreted(true);
+	m_core->mode = code_mode_from_sr();
+}
+
+
+/*-------------------------------------------------
+    code_compile_pending - compile queued blocks
+    oldest first while the allowance lasts
+-------------------------------------------------*/
+
+void mips3_device::code_compile_pending()
+{
+	auto it = m_compile_pending.begin();
+	while (it != m_compile_pending.end() && m_compile_allowance > 0)
+	{
+		const osd_ticks_t start = osd_ticks();
+		if (!m_drcuml->hash_exists(it->first, it->second))
+			code_compile_block(it->first, it->second);
+		m_compile_allowance -= int64_t(osd_ticks() - start);
+		++it;
+	}
+	m_compile_pending.erase(m_compile_pending.begin(), it);
+}
+
+
+/*-------------------------------------------------
+    code_exists_for_pc - return true if the
+    interpreter can hand the current PC back to
+    compiled code
+-------------------------------------------------*/
+
+bool mips3_device::code_exists_for_pc()
+{
+	return m_drcuml->hash_exists(code_mode_from_sr(), m_core->pc);
+}
+
+
+/*-------------------------------------------------
+    code_mode_from_sr - compute the DRC mode for
+    the current SR, matching generate_update_mode
+-------------------------------------------------*/
+
+uint8_t mips3_device::code_mode_from_sr() const
+{
+	const uint32_t sr = m_core->cpr[0][COP0_Status];
+	uint8_t mode = (sr & (SR_EXL | SR_ERL)) ? 0 : ((sr >> 2) & 0x06);
+	return mode | ((sr >> 26) & 0x01);
+}
+
+
 
 /***************************************************************************
     C FUNCTION CALLBACKS
@@ -648,6 +805,29 @@ void mips3_device::static_generate_nocode_handler()
 }
 
 
+/*-------------------------------------------------
+    static_generate_hot_code_handler - generate an
+    exception handler that hands a frequently
+    entered PC back for trace compilation
+-------------------------------------------------*/
+
+void mips3_device::static_generate_hot_code_handler()
+{
+	/* begin generating */
+	drcuml_block &block(m_drcuml->begin_block(10));
+
+	/* exit with the PC to retrace */
+	alloc_handle(*m_drcuml, m_hot_code, "hot_code");
+	UML_HANDLE(block, *m_hot_code);                                             // handle  hot_code
+	UML_GETEXP(block, I0);                                                      // getexp  i0
+	UML_MOV(block, mem(&m_core->pc), I0);                                       // mov     [pc],i0
+	save_fast_iregs(block);
+	UML_EXIT(block, EXECUTE_HOT_CODE);                                          // exit    EXECUTE_HOT_CODE
+
+	block.end();
+}
+
+
 /*-------------------------------------------------
     static_generate_out_of_cycles - generate an
     out of cycles exception handler
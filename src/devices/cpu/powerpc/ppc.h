@@ -244,6 +244,7 @@ public:
 	void ppccom_execute_mftb();
 	void ppccom_execute_mtspr();
 	void ppccom_tlb_flush();
+	void ppccom_load_bats();
 	void ppccom_execute_mfdcr();
 	void ppccom_execute_mtdcr();
 	void ppccom_get_dsisr();
@@ -253,6 +254,7 @@ protected:
 	virtual void device_start() override;
 	virtual void device_reset() override;
 	virtual void device_stop() override;
+	virtual void device_post_load() override;
 
 	// device_execute_interface overrides
 	virtual uint32_t execute_min_cycles() const noexcept override { return 1; }
@@ -473,6 +475,10 @@ protected:
 	uint8_t           m_cache_line_size;
 	uint32_t          m_tb_divisor;
 
+	/* data BATs preloaded into fixed TLB entries */
+	int               m_bat_fixed_base;         /* first fixed entry used for the BATs, or -1 */
+	bool              m_bats_loaded;            /* true if any BAT is preloaded */
+
 	/* PowerPC 4xx-specific state */
 	/* PowerPC 4XX-specific serial port state */
 	struct ppc4xx_spu_state
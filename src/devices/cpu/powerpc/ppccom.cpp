@@ -235,10 +235,18 @@ ppc_device::ppc_device(const machine_config &mconfig, device_type type, const ch
 	m_program_config.m_logaddr_width = 32;
 	m_program_config.m_page_shift = POWERPC_MIN_PAGE_SHIFT;
 
-	// configure the virtual TLB
+	// configure the virtual TLB; the data BATs follow the 603's software TLB
 	set_vtlb_dynamic_entries(POWERPC_TLB_ENTRIES);
-	if (m_cap & PPCCAP_603_MMU)
-		set_vtlb_fixed_entries(PPC603_FIXED_TLB_ENTRIES);
+	int fixed = (m_cap & PPCCAP_603_MMU) ? PPC603_FIXED_TLB_ENTRIES : 0;
+	m_bat_fixed_base = -1;
+	m_bats_loaded = false;
+	if ((m_cap & PPCCAP_OEA) && !(m_cap & PPCCAP_601BAT))
+	{
+		m_bat_fixed_base = fixed;
+		fixed += 4;
+	}
+	if (fixed != 0)
+		set_vtlb_fixed_entries(fixed);
 }
 
 ppc_device::~ppc_device()
@@ -1151,6 +1159,18 @@ void ppc_device::device_stop()
 }
 
 
+/*-------------------------------------------------
+    device_post_load - rebuild translation state
+    after loading a saved state
+-------------------------------------------------*/
+
+void ppc_device::device_post_load()
+{
+	ppccom_tlb_flush();
+	ppccom_load_bats();
+}
+
+
 /*-------------------------------------------------
     ppccom_reset - reset the state of all the
     registers
@@ -1206,6 +1226,7 @@ void ppc_device::device_reset()
 			vtlb_load(tlbindex, 0, 0, 0);
 		}
 	}
+	ppccom_load_bats();
 
 	/* Mark the cache dirty */
 	m_core->mode = 0;
@@ -1475,10 +1496,92 @@ void ppc_device::ppccom_tlb_fill()
 	offs_t address = m_core->param0;
 	if(ppccom_translate_address_internal(m_core->param1, false, address) > 1)
 		return;
+
+	// a preloaded BAT page only misses for an access its BAT doesn't grant,
+	// which has been translated some other way; go back to filling pages
+	// one at a time until the BATs are next written
+	if (m_bats_loaded && (vtlb_table()[m_core->param0 >> 12] & FLAG_VALID))
+	{
+		for (int batnum = 0; batnum < 4; batnum++)
+			vtlb_load(m_bat_fixed_base + batnum, 0, 0, 0);
+		m_bats_loaded = false;
+	}
 	vtlb_fill(m_core->param0, address, m_core->param1);
 }
 
 
+/*-------------------------------------------------
+    ppccom_load_bats - load each data BAT into a
+    fixed TLB entry covering its whole block, so
+    that accesses through it never call out to
+    fill the TLB; fetches are allowed too if an
+    instruction BAT maps the block the same way
+-------------------------------------------------*/
+
+void ppc_device::ppccom_load_bats()
+{
+	if (m_bat_fixed_base < 0)
+		return;
+
+	auto const overlaps =
+			[this] (int batbase, int batnum, uint32_t upper, uint32_t mask)
+			{
+				for (int prev = 0; prev < batnum; prev++)
+				{
+					uint32_t const prevupper = m_core->spr[batbase + 2*prev + 0];
+					uint32_t const prevmask = (~prevupper << 15) & 0xfffe0000;
+					if ((prevupper & 3) && !((upper ^ prevupper) & mask & prevmask))
+						return true;
+				}
+				return false;
+			};
+
+	m_bats_loaded = false;
+	for (int batnum = 0; batnum < 4; batnum++)
+	{
+		uint32_t const upper = m_core->spr[SPROEA_DBAT0U + 2*batnum + 0];
+		uint32_t const lower = m_core->spr[SPROEA_DBAT0U + 2*batnum + 1];
+		uint32_t const mask = (~upper << 15) & 0xfffe0000;
+
+		// an earlier BAT takes priority wherever they overlap, so leave those to the fill
+		if (!(upper & 3) || overlaps(SPROEA_DBAT0U, batnum, upper, mask))
+		{
+			vtlb_load(m_bat_fixed_base + batnum, 0, 0, 0);
+			continue;
+		}
+
+		// bit 1 of the upper word is valid for supervisor, bit 0 for user
+		vtlb_entry flags = FLAG_VALID;
+		if ((upper & 2) && page_access_allowed(TR_READ, 1, lower & 3))
+			flags |= READ_ALLOWED;
+		if ((upper & 2) && page_access_allowed(TR_WRITE, 1, lower & 3))
+			flags |= WRITE_ALLOWED;
+		if ((upper & 1) && page_access_allowed(TR_READ, 1, lower & 3))
+			flags |= USER_READ_ALLOWED;
+		if ((upper & 1) && page_access_allowed(TR_WRITE, 1, lower & 3))
+			flags |= USER_WRITE_ALLOWED;
+
+		for (int ibatnum = 0; ibatnum < 4; ibatnum++)
+		{
+			if ((m_core->spr[SPROEA_IBAT0U + 2*ibatnum + 0] == upper) && (m_core->spr[SPROEA_IBAT0U + 2*ibatnum + 1] == lower))
+			{
+				if (!overlaps(SPROEA_IBAT0U, ibatnum, upper, mask))
+				{
+					if ((upper & 2) && page_access_allowed(TR_FETCH, 1, lower & 3))
+						flags |= FETCH_ALLOWED;
+					if ((upper & 1) && page_access_allowed(TR_FETCH, 1, lower & 3))
+						flags |= USER_FETCH_ALLOWED;
+				}
+				break;
+			}
+		}
+
+		vtlb_load(m_bat_fixed_base + batnum, ((~mask) >> 12) + 1, upper & mask, (lower & mask) | flags);
+		m_bats_loaded = true;
+	}
+}
+
+
 /*-------------------------------------------------
     ppccom_tlb_flush - flush the entire TLB,
     including fixed entries
@@ -1768,6 +1871,8 @@ void ppc_device::ppccom_execute_mtspr()
 			case SPROEA_DBAT3U:
 				m_core->spr[m_core->param0] = m_core->param1;
 				ppccom_tlb_flush();
+				if (m_core->param0 != SPROEA_SDR1)
+					ppccom_load_bats();
 				return;
 
 			/* decrementer */
@@ -383,19 +383,43 @@ void ppc_device::code_compile_block(uint8_t mode, offs_t pc)
 
 	auto profile = g_profiler.start(PROFILER_DRC_COMPILE);
 
-	/* get a description of this sequence */
-	desclist = m_drcfe->describe_code(pc);
-	if (m_drcuml->logging() || m_drcuml->logging_native())
-		log_opcode_desc(desclist, 0);
+	/* the translation depends on DRC options and fast RAM layout as well as the code */
+	const uint64_t config = (uint64_t(m_fastram_select) << 32) | m_drcoptions;
 
 	bool succeeded = false;
+	desclist = nullptr;
 	while (!succeeded)
 	{
 		try
 		{
+			/* reuse a translation from a previous run if the code is unchanged */
+			if (m_drcuml->restore_block(mode, pc, config))
+				return;
+
+			/* get a description of this sequence */
+			if (desclist == nullptr)
+			{
+				desclist = m_drcfe->describe_code(pc);
+				if (m_drcuml->logging() || m_drcuml->logging_native())
+					log_opcode_desc(desclist, 0);
+			}
+
 			/* start the block */
 			drcuml_block &block(m_drcuml->begin_block(4096));
 
+			/* remember which guest code this block is built from */
+			if (m_drcuml->persistent_cache())
+			{
+				std::vector<drc_persistent_cache::code_range> ranges;
+				for (const opcode_desc *curdesc = desclist; curdesc != nullptr; curdesc = curdesc->next())
+				{
+					ranges.push_back({ curdesc->physpc, curdesc->length });
+					for (const opcode_desc *slot = curdesc->delay.first(); slot != nullptr; slot = slot->next())
+						ranges.push_back({ slot->physpc, slot->length });
+				}
+				block.persist(mode, pc, config, std::move(ranges));
+			}
+
 			/* loop until we get through all instruction sequences */
 			for (seqhead = desclist; seqhead != nullptr; seqhead = seqlast->next())
 			{
@@ -1710,6 +1734,7 @@ void ppc_device::generate_sequence_instruction(drcuml_block &block, compiler_sta
 	{
 		UML_MOV(block, mem(&m_core->pc), desc->pc);                                        // mov     [pc],desc->pc
 		UML_CALLC(block, cfunc_printf_probe, (void *)(uintptr_t)desc->pc);                                       // callc   cfunc_printf_probe,desc->pc
+		block.persist_cancel();
 	}
 
 	/* if we are debugging, call the debugger */
@@ -1736,6 +1761,7 @@ void ppc_device::generate_sequence_instruction(drcuml_block &block, compiler_sta
 		if (PRINTF_MMU)
 		{
 			const char *text = "Compiler page fault @ %08X\n";
+			block.persist_cancel();                                                       // host pointer in an immediate
 			if (sizeof(uintptr_t) == 8)
 				UML_DMOV(block, mem(&m_core->format), (uintptr_t)text);                   // mov     [format],text
 			else
@@ -1757,6 +1783,7 @@ void ppc_device::generate_sequence_instruction(drcuml_block &block, compiler_sta
 			if (PRINTF_MMU)
 			{
 				const char *text = "Checking TLB at @ %08X\n";
+				block.persist_cancel();                                                       // host pointer in an immediate
 				if (sizeof(uintptr_t) == 8)
 					UML_DMOV(block, mem(&m_core->format), (uintptr_t)text);                   // mov     [format],text
 				else
@@ -1764,6 +1791,7 @@ void ppc_device::generate_sequence_instruction(drcuml_block &block, compiler_sta
 				UML_MOV(block, mem(&m_core->arg0), desc->pc);                    // mov     [arg0],desc->pc
 				UML_CALLC(block, cfunc_printf_debug, this);                                  // callc   printf_debug
 			}
+			block.persist_cancel();                                                      // the entry is only valid in this run
 			UML_LOAD(block, I0, &tlbtable[desc->pc >> 12], 0, SIZE_DWORD, SCALE_x4);// load    i0,tlbtable[desc->pc >> 12],dword
 			UML_CMP(block, I0, tlbtable[desc->pc >> 12]);                           // cmp     i0,*tlbentry
 			UML_EXHc(block, COND_NE, *m_tlb_mismatch, 0);                  // exh     tlb_mismatch,0,NE
@@ -1775,6 +1803,7 @@ void ppc_device::generate_sequence_instruction(drcuml_block &block, compiler_sta
 			if (PRINTF_MMU)
 			{
 				const char *text = "No valid TLB @ %08X\n";
+				block.persist_cancel();                                                       // host pointer in an immediate
 				if (sizeof(uintptr_t) == 8)
 					UML_DMOV(block, mem(&m_core->format), (uintptr_t)text);                   // mov     [format],text
 				else
@@ -94,6 +94,10 @@ void sh_common_execution::drc_start()
 	m_fastram_select = 0;
 	memset(m_fastram, 0, sizeof(m_fastram));
 
+	m_syncrange_select = 0;
+	memset(m_syncrange, 0, sizeof(m_syncrange));
+	m_sync_i0 = m_sync_i1 = 0;
+
 	/* reset per-driver pcflushes */
 	m_pcfsel = 0;
 
@@ -2279,20 +2283,43 @@ void sh_common_execution::code_compile_block(uint8_t mode, offs_t pc)
 
 	auto profile = g_profiler.start(PROFILER_DRC_COMPILE);
 
-	/* get a description of this sequence */
-	desclist = get_desclist(pc);
-
-	if (m_drcuml->logging() || m_drcuml->logging_native())
-		log_opcode_desc(desclist, 0);
+	/* the translation depends on DRC options and fast RAM layout as well as the code */
+	const uint64_t config = (uint64_t(m_fastram_select) << 32) | m_drcoptions;
 
 	bool succeeded = false;
+	desclist = nullptr;
 	while (!succeeded)
 	{
 		try
 		{
+			/* reuse a translation from a previous run if the code is unchanged */
+			if (m_drcuml->restore_block(mode, pc, config))
+				return;
+
+			/* get a description of this sequence */
+			if (desclist == nullptr)
+			{
+				desclist = get_desclist(pc);
+				if (m_drcuml->logging() || m_drcuml->logging_native())
+					log_opcode_desc(desclist, 0);
+			}
+
 			/* start the block */
 			drcuml_block &block(m_drcuml->begin_block(4096));
 
+			/* remember which guest code this block is built from */
+			if (m_drcuml->persistent_cache())
+			{
+				std::vector<drc_persistent_cache::code_range> ranges;
+				for (const opcode_desc *curdesc = desclist; curdesc != nullptr; curdesc = curdesc->next())
+				{
+					ranges.push_back({ curdesc->physpc, curdesc->length });
+					for (const opcode_desc *slot = curdesc->delay.first(); slot != nullptr; slot = slot->next())
+						ranges.push_back({ slot->physpc, slot->length });
+				}
+				block.persist(mode, pc, config, std::move(ranges));
+			}
+
 			/* loop until we get through all instruction sequences */
 			for (seqhead = desclist; seqhead != nullptr; seqhead = seqlast->next())
 			{
@@ -2682,6 +2709,12 @@ void sh_common_execution::func_printf_probe()
 		(uint32_t)m_sh2_state->irqsr, (uint32_t)m_sh2_state->pc);
 }
 
+void sh_common_execution::func_sync()
+{
+	// let the other CPUs run up to this access before we go on
+	abort_timeslice();
+}
+
 /*-------------------------------------------------
     generate_opcode - generate code for a specific
     opcode
@@ -2760,6 +2793,7 @@ bool sh_common_execution::generate_opcode(drcuml_block &block, compiler_state &c
 			{
 				scratch2 = (uint32_t)util::sext(read_word(scratch), 16);
 				UML_MOV(block, R32(REG_N), scratch2);          // mov Rn, scratch2
+				block.persist_depends(scratch, 2);
 			}
 
 			if (!in_delay_slot)
@@ -2813,6 +2847,7 @@ bool sh_common_execution::generate_opcode(drcuml_block &block, compiler_state &c
 			{
 				scratch2 = read_long(scratch);
 				UML_MOV(block, R32(REG_N), scratch2);          // mov Rn, scratch2
+				block.persist_depends(scratch, 4);
 			}
 
 			if (!in_delay_slot)
@@ -39,6 +39,7 @@
 #define SH2DRC_FASTEST_OPTIONS  (0)
 
 #define SH2_MAX_FASTRAM       4
+#define SH2_MAX_SYNCRANGE     4
 
 /* map variables */
 #define MAPVAR_PC                   M0
@@ -377,11 +378,22 @@ public:
 	int m_pcfsel;                 // last pcflush entry set
 	uint32_t m_pcflushes[16];           // pcflush entries
 
+	/* sync ranges: accesses here end the timeslice so other CPUs catch up */
+	uint32_t              m_syncrange_select;
+	struct
+	{
+		offs_t              start;                      /* start of the range */
+		offs_t              end;                        /* end of the range */
+	} m_syncrange[SH2_MAX_SYNCRANGE];
+	uint32_t              m_sync_i0;                    /* address saved across the sync callout */
+	uint32_t              m_sync_i1;                    /* data saved across the sync callout */
+
 	virtual void init_drc_frontend() = 0;
 
 	void drc_start();
 
 	void sh2drc_add_fastram(offs_t start, offs_t end, uint8_t readonly, void *base);
+	void sh2drc_add_syncrange(offs_t start, offs_t end);
 
 	std::function<u16 (offs_t)> m_pr16;
 	std::function<const void * (offs_t)> m_prptr;
@@ -442,6 +454,7 @@ public:
 	virtual bool generate_group_15(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc);
 
 	void func_printf_probe();
+	void func_sync();
 	void func_unimplemented();
 	void func_MAC_W();
 	void func_MAC_L();
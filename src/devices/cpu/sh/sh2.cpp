@@ -501,6 +501,7 @@ void sh2_device::func_fastirq()
 	sh2_exception("fastirq", m_sh2_state->irqline);
 }
 static void cfunc_fastirq(void *param) { ((sh2_device *)param)->func_fastirq(); };
+static void cfunc_sync(void *param) { ((sh2_device *)param)->func_sync(); };
 
 /*-------------------------------------------------
     static_generate_entry_point - generate a
@@ -690,6 +691,28 @@ void sh2_device::static_generate_memory_accessor(int size, int iswrite, const ch
 
 	UML_LABEL(block, label++);              // label:
 
+	// accesses to a range shared with another CPU end the timeslice first
+	if (m_syncrange_select != 0)
+	{
+		uint32_t const synced = label++;
+		for (uint32_t i = 0; i < m_syncrange_select; i++)
+		{
+			uint32_t const skip = label++;
+			UML_CMP(block, I0, m_syncrange[i].end);                 // cmp     i0,end
+			UML_JMPc(block, COND_A, skip);                          // ja      skip
+			UML_CMP(block, I0, m_syncrange[i].start);               // cmp     i0,start
+			UML_JMPc(block, COND_B, skip);                          // jb      skip
+			UML_MOV(block, mem(&m_sync_i0), I0);                    // mov     [sync_i0],i0
+			UML_MOV(block, mem(&m_sync_i1), I1);                    // mov     [sync_i1],i1
+			UML_CALLC(block, cfunc_sync, this);                     // callc   cfunc_sync
+			UML_MOV(block, I0, mem(&m_sync_i0));                    // mov     i0,[sync_i0]
+			UML_MOV(block, I1, mem(&m_sync_i1));                    // mov     i1,[sync_i1]
+			UML_JMP(block, synced);                                 // jmp     synced
+			UML_LABEL(block, skip);                                 // skip:
+		}
+		UML_LABEL(block, synced);                                   // synced:
+	}
+
 	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) == 0)
 	{
 		for (auto & elem : m_fastram)
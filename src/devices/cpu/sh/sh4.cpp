@@ -33,6 +33,17 @@
 #include "sh_dasm.h"
 #include "cpu/drcumlsh.h"
 
+// use SSE for the packed vector instructions where it can be assumed
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define SH4_PACKED_SSE 1
+#include <emmintrin.h>
+#else
+#define SH4_PACKED_SSE 0
+#endif
+
+// set to 1 to check every packed FIPR/FTRV result against the interpreter
+#define SH4_VERIFY_PACKED (0)
+
 
 DEFINE_DEVICE_TYPE(SH3LE, sh3_device,   "sh3le", "Hitachi SH-3 (little)")
 DEFINE_DEVICE_TYPE(SH3BE, sh3be_device, "sh3be", "Hitachi SH-3 (big)")
@@ -1528,6 +1539,62 @@ void sh34_base_device::FTRV(const uint16_t opcode)
 		FP_RFS(n + i) = sum[i];
 }
 
+/* packed FIPR and FTRV for the recompiler; every lane performs the
+   interpreter's operations in the interpreter's order, so the results are
+   bit-exact with the scalar forms above */
+void sh34_base_device::FIPR_packed(const uint16_t opcode)
+{
+#if SH4_PACKED_SSE
+	uint32_t n = REG_N;
+	uint32_t m = (n & 3) << 2;
+	n = n & 12;
+
+	float *const fr = reinterpret_cast<float *>(m_sh2_state->m_fr);
+	float ml[4];
+	_mm_storeu_ps(ml, _mm_mul_ps(_mm_loadu_ps(fr + n), _mm_loadu_ps(fr + m)));
+	fr[n + 3] = ml[0] + ml[1] + ml[2] + ml[3];
+#else
+	FIPR(opcode);
+#endif
+}
+
+void sh34_base_device::FTRV_packed(const uint16_t opcode)
+{
+#if SH4_PACKED_SSE
+	uint32_t n = REG_N;
+	n = n & 12;
+
+	float *const fr = reinterpret_cast<float *>(m_sh2_state->m_fr) + n;
+	const float *const xf = reinterpret_cast<const float *>(m_sh2_state->m_xf);
+	__m128 sum = _mm_setzero_ps();
+	for (int j = 0; j < 4; j++)
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(xf + (j << 2)), _mm_set1_ps(fr[j])));
+	_mm_storeu_ps(fr, sum);
+#else
+	FTRV(opcode);
+#endif
+}
+
+/* run a packed instruction and its scalar form on the same registers and
+   log any difference; the scalar result is kept */
+void sh34_base_device::verify_packed(void (sh34_base_device::*scalar)(const uint16_t), void (sh34_base_device::*packed)(const uint16_t), const char *name)
+{
+	const uint16_t opcode = m_sh2_state->arg0;
+	uint32_t before[16], expected[16];
+
+	memcpy(before, m_sh2_state->m_fr, sizeof(before));
+	(this->*scalar)(opcode);
+	memcpy(expected, m_sh2_state->m_fr, sizeof(expected));
+	memcpy(m_sh2_state->m_fr, before, sizeof(before));
+	(this->*packed)(opcode);
+
+	if (memcmp(expected, m_sh2_state->m_fr, sizeof(expected)) != 0)
+	{
+		logerror("%s %04x: packed result differs from the interpreter\n", name, opcode);
+		memcpy(m_sh2_state->m_fr, expected, sizeof(expected));
+	}
+}
+
 inline void sh34_base_device::op1111_0xf13(const uint16_t opcode)
 {
 	if (opcode & 0x100)
@@ -3721,15 +3788,35 @@ bool sh34_base_device::generate_group_15_FMOVFRMDR(drcuml_block &block, compiler
 	return true;
 }
 
-void sh34_base_device::func_FMOVFR() { FMOVFR(m_sh2_state->arg0); }
-static void cfunc_FMOVFR(void *param) { ((sh34_base_device *)param)->func_FMOVFR(); };
 
 bool sh34_base_device::generate_group_15_FMOVFR(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
 {
-	save_fast_iregs(block);
-	UML_MOV(block, mem(&m_sh2_state->arg0), desc->opptr.w[0]);
-	UML_CALLC(block, cfunc_FMOVFR, this);
-	load_fast_iregs(block);
+	const uint32_t m = (opcode >> 4) & 15;
+	const uint32_t n = (opcode >> 8) & 15;
+	uml::code_label pair = compiler.labelnum++;
+	uml::code_label done = compiler.labelnum++;
+
+	UML_CMP(block, uml::mem(&m_sh2_state->m_fpu_sz), 0);
+	UML_JMPc(block, COND_NZ, pair);
+
+	/* SZ = 0: single register */
+#ifdef LSB_FIRST
+	UML_XOR(block, I1, uml::mem(&m_sh2_state->m_fpu_pr), m);
+	UML_LOAD(block, I0, m_sh2_state->m_fr, I1, SIZE_DWORD, SCALE_x4);
+	UML_XOR(block, I1, uml::mem(&m_sh2_state->m_fpu_pr), n);
+	UML_STORE(block, m_sh2_state->m_fr, I1, I0, SIZE_DWORD, SCALE_x4);
+#else
+	UML_MOV(block, uml::mem(&m_sh2_state->m_fr[n]), uml::mem(&m_sh2_state->m_fr[m]));
+#endif
+	UML_JMP(block, done);
+
+	/* SZ = 1: the pair moves as one 64-bit value, from XD if m is odd and to XD if n is odd */
+	UML_LABEL(block, pair);
+	uint32_t *const src = (m & 1) ? &m_sh2_state->m_xf[m & 14] : &m_sh2_state->m_fr[m];
+	uint32_t *const dst = (n & 1) ? &m_sh2_state->m_xf[n & 14] : &m_sh2_state->m_fr[n];
+	UML_DMOV(block, uml::mem(dst), uml::mem(src));
+
+	UML_LABEL(block, done);
 	return true;
 }
 
@@ -3939,7 +4026,15 @@ bool sh34_base_device::generate_group_15_op1111_0x13_FCNVDS(drcuml_block &block,
 	return true;
 }
 
-void sh34_base_device::func_FIPR() { FIPR(m_sh2_state->arg0); }
+void sh34_base_device::func_FIPR()
+{
+#if SH4_VERIFY_PACKED
+	verify_packed(&sh34_base_device::FIPR, &sh34_base_device::FIPR_packed, "FIPR");
+#else
+	FIPR_packed(m_sh2_state->arg0);
+#endif
+}
+
 static void cfunc_FIPR(void *param) { ((sh34_base_device *)param)->func_FIPR(); };
 
 bool sh34_base_device::generate_group_15_op1111_0x13_FIPR(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
@@ -4010,7 +4105,15 @@ bool sh34_base_device::generate_group_15_op1111_0x13_op1111_0xf13_FRCHG(drcuml_b
 	return true;
 }
 
-void sh34_base_device::func_FTRV() { FTRV(m_sh2_state->arg0); }
+void sh34_base_device::func_FTRV()
+{
+#if SH4_VERIFY_PACKED
+	verify_packed(&sh34_base_device::FTRV, &sh34_base_device::FTRV_packed, "FTRV");
+#else
+	FTRV_packed(m_sh2_state->arg0);
+#endif
+}
+
 static void cfunc_FTRV(void *param) { ((sh34_base_device *)param)->func_FTRV(); };
 
 bool sh34_base_device::generate_group_15_op1111_0x13_op1111_0xf13_FTRV(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint16_t opcode, int in_delay_slot, uint32_t ovrpc)
@@ -216,7 +216,6 @@ public:
 	void func_STSFPSCR();
 	void func_FLDI0();
 	void func_FLDI1();
-	void func_FMOVFR();
 	void func_FMOVFRS0();
 	void func_FTRC();
 	void func_FMOVMRFR();
@@ -454,6 +453,7 @@ protected:
 	void sh4_handle_tcpr2_addr_w(uint32_t data, uint32_t mem_mask);
 	int sh4_dma_transfer(int channel, int timermode, uint32_t chcr, uint32_t *sar, uint32_t *dar, uint32_t *dmatcr);
 	int sh4_dma_transfer_device(int channel, uint32_t chcr, uint32_t *sar, uint32_t *dar, uint32_t *dmatcr);
+	bool sh4_dma_block_copy(uint32_t src, uint32_t dst, uint32_t qwords);
 	void sh4_dmac_check(int channel);
 	void sh4_handle_sar0_addr_w(uint32_t data, uint32_t mem_mask);
 	void sh4_handle_sar1_addr_w(uint32_t data, uint32_t mem_mask);
@@ -572,6 +572,9 @@ protected:
 	void FSSCA(const uint16_t opcode);
 	void FIPR(const uint16_t opcode);
 	void FTRV(const uint16_t opcode);
+	void FIPR_packed(const uint16_t opcode);
+	void FTRV_packed(const uint16_t opcode);
+	void verify_packed(void (sh34_base_device::*scalar)(const uint16_t), void (sh34_base_device::*packed)(const uint16_t), const char *name);
 
 	void op1111_0xf13(const uint16_t opcode);
 	void dbreak(const uint16_t opcode);
@@ -125,6 +125,13 @@ int sh34_base_device::sh4_dma_transfer(int channel, int timermode, uint32_t chcr
 	case 8: // 64 bit
 		src &= ~7;
 		dst &= ~7;
+		if (incs == 1 && incd == 1 && sh4_dma_block_copy(src, dst, count))
+		{
+			src += count * 8;
+			dst += count * 8;
+			count = 0;
+			break;
+		}
 		for (;count > 0; count --)
 		{
 			if (incs == 2)
@@ -159,6 +166,13 @@ int sh34_base_device::sh4_dma_transfer(int channel, int timermode, uint32_t chcr
 	case 32:
 		src &= ~31;
 		dst &= ~31;
+		if (incs == 1 && incd == 1 && sh4_dma_block_copy(src, dst, count * 4))
+		{
+			src += count * 32;
+			dst += count * 32;
+			count = 0;
+			break;
+		}
 		for (;count > 0; count --)
 		{
 			if (incs == 2)
@@ -182,6 +196,30 @@ int sh34_base_device::sh4_dma_transfer(int channel, int timermode, uint32_t chcr
 	return 1;
 }
 
+// copy an incrementing transfer a chunk at a time through the block
+// accessors, so runs of RAM become memcpy; overlapping transfers
+// depend on the unit-by-unit order and are left to the caller
+bool sh34_base_device::sh4_dma_block_copy(uint32_t src, uint32_t dst, uint32_t qwords)
+{
+	const uint64_t bytes = uint64_t(qwords) * 8;
+	if (src + bytes > SH34_AM + 1 || dst + bytes > SH34_AM + 1)
+		return false;
+	if (src < dst + bytes && dst < src + bytes)
+		return false;
+
+	uint64_t buffer[256];
+	while (qwords)
+	{
+		const uint32_t chunk = std::min<uint32_t>(qwords, std::size(buffer));
+		m_program->read_block(src, buffer, chunk);
+		m_program->write_block(dst, buffer, chunk);
+		src += chunk * 8;
+		dst += chunk * 8;
+		qwords -= chunk;
+	}
+	return true;
+}
+
 int sh34_base_device::sh4_dma_transfer_device(int channel, uint32_t chcr, uint32_t *sar, uint32_t *dar, uint32_t *dmatcr)
 {
 	int incd = (chcr & CHCR_DM) >> 14;
@@ -632,6 +632,7 @@ private:
 	bool generate_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
 	void generate_unimplemented_compute(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
 	void generate_compute(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_dual_fadd_fsub(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, int rx, int ry);
 	void generate_if_condition(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, int condition, int skip_label);
 	void generate_do_condition(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, int condition, int skip_label, ASTAT_DRC &astat);
 	void generate_shift_imm(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, int data, int shiftop, int rn, int rx);
@@ -3364,6 +3364,73 @@ void adsp21062_device::generate_unimplemented_compute(drcuml_block &block, compi
 	UML_CALLC(block, cfunc_unimplemented_compute, this);
 }
 
+// Fa = Fx + Fy,   Fs = Fx - Fy, leaving the results in F4 and F5 for the caller to store
+// Both results are computed back to back and the flags are then derived from their bit
+// patterns, matching compute_dual_fadd_fsub: zero and denormal results set AZ, -0 and NaN
+// never set AN, and a NaN input sets AI.
+void adsp21062_device::generate_dual_fadd_fsub(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, int rx, int ry)
+{
+	UML_FSCOPYI(block, F2, REG(rx));
+	UML_FSCOPYI(block, F3, REG(ry));
+	UML_FSADD(block, F4, F2, F3);
+	UML_FSSUB(block, F5, F2, F3);
+
+	if (AZ_CALC_REQUIRED || AN_CALC_REQUIRED)
+	{
+		UML_ICOPYFS(block, I0, F4);
+		UML_ICOPYFS(block, I1, F5);
+	}
+	if (AZ_CALC_REQUIRED)
+	{
+		UML_TEST(block, I0, 0x7f800000);
+		UML_SETc(block, COND_Z, ASTAT_AZ);
+		UML_TEST(block, I1, 0x7f800000);
+		UML_SETc(block, COND_Z, I2);
+		UML_OR(block, ASTAT_AZ, ASTAT_AZ, I2);
+	}
+	if (AN_CALC_REQUIRED)
+	{
+		// negative, non-zero and not a NaN: 0x80000001 - 0xff800000
+		UML_SUB(block, I2, I0, 0x80000001);
+		UML_CMP(block, I2, 0x7f800000);
+		UML_SETc(block, COND_B, ASTAT_AN);
+		UML_SUB(block, I2, I1, 0x80000001);
+		UML_CMP(block, I2, 0x7f800000);
+		UML_SETc(block, COND_B, I2);
+		UML_OR(block, ASTAT_AN, ASTAT_AN, I2);
+	}
+	if (AV_CALC_REQUIRED) UML_MOV(block, ASTAT_AV, 0);  // TODO
+	if (AC_CALC_REQUIRED) UML_MOV(block, ASTAT_AC, 0);
+	if (AS_CALC_REQUIRED) UML_MOV(block, ASTAT_AS, 0);
+	if (AF_CALC_REQUIRED) UML_MOV(block, ASTAT_AF, 1);
+
+	// AI and its sticky bit
+	UML_AND(block, I2, REG(rx), 0x7fffffff);
+	UML_CMP(block, I2, 0x7f800000);
+	UML_SETc(block, COND_A, I2);
+	UML_AND(block, I3, REG(ry), 0x7fffffff);
+	UML_CMP(block, I3, 0x7f800000);
+	UML_SETc(block, COND_A, I3);
+	UML_OR(block, I2, I2, I3);
+	if (AI_CALC_REQUIRED) UML_MOV(block, ASTAT_AI, I2);
+	UML_SHL(block, I2, I2, 5);
+	UML_OR(block, STKY, STKY, I2);
+
+	// AUS for a denormal result
+	UML_ICOPYFS(block, I0, F4);
+	UML_ICOPYFS(block, I1, F5);
+	UML_AND(block, I0, I0, 0x7fffffff);
+	UML_SUB(block, I0, I0, 1);
+	UML_CMP(block, I0, 0x7fffff);
+	UML_SETc(block, COND_B, I0);
+	UML_AND(block, I1, I1, 0x7fffffff);
+	UML_SUB(block, I1, I1, 1);
+	UML_CMP(block, I1, 0x7fffff);
+	UML_SETc(block, COND_B, I1);
+	UML_OR(block, I0, I0, I1);
+	UML_OR(block, STKY, STKY, I0);
+}
+
 void adsp21062_device::generate_compute(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
 {
 	uint64_t opcode = desc->opptr.q[0];
@@ -3460,31 +3527,10 @@ void adsp21062_device::generate_compute(drcuml_block &block, compiler_state &com
 			case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
 			case 0x38: case 0x39: case 0x3a: case 0x3b: case 0x3c: case 0x3d: case 0x3e: case 0x3f:
 				// Fm = F3-0 * F7-4,   Fa = F11-8 + F15-12,   Fs = F11-8 - F15-12
-				// TODO: denormals
 				UML_FSCOPYI(block, F0, REG(fxm));
 				UML_FSCOPYI(block, F1, REG(fym));
-				UML_FSCOPYI(block, F2, REG(fxa));
-				UML_FSCOPYI(block, F3, REG(fya));
 				UML_FSMUL(block, F0, F0, F1);
-				UML_FSADD(block, F4, F2, F3);
-				UML_FSSUB(block, F5, F2, F3);
-
-				if (AZ_CALC_REQUIRED || AN_CALC_REQUIRED)
-					UML_FSCMP(block, F4, mem(&m_core->fp0));
-				if (AZ_CALC_REQUIRED) UML_SETc(block, COND_Z, ASTAT_AZ);
-				if (AN_CALC_REQUIRED) UML_SETc(block, COND_C, ASTAT_AN);
-
-				if (AZ_CALC_REQUIRED || AN_CALC_REQUIRED)
-					UML_FSCMP(block, F5, mem(&m_core->fp0));
-				if (AZ_CALC_REQUIRED) UML_SETc(block, COND_Z, I0);
-				if (AN_CALC_REQUIRED) UML_SETc(block, COND_C, I1);
-				if (AZ_CALC_REQUIRED) UML_OR(block, ASTAT_AZ, ASTAT_AZ, I0);
-				if (AN_CALC_REQUIRED) UML_OR(block, ASTAT_AN, ASTAT_AN, I1);
-
-				if (AV_CALC_REQUIRED) UML_MOV(block, ASTAT_AV, 0);  // TODO
-				if (AC_CALC_REQUIRED) UML_MOV(block, ASTAT_AC, 0);
-				if (AS_CALC_REQUIRED) UML_MOV(block, ASTAT_AS, 0);
-				if (AI_CALC_REQUIRED) UML_MOV(block, ASTAT_AI, 0);  // TODO
+				generate_dual_fadd_fsub(block, compiler, desc, fxa, fya);
 
 				if (MN_CALC_REQUIRED)
 					UML_FSCMP(block, F0, mem(&m_core->fp0));
@@ -4363,26 +4409,9 @@ void adsp21062_device::generate_compute(drcuml_block &block, compiler_state &com
 					case 0xf8: case 0xf9: case 0xfa: case 0xfb: case 0xfc: case 0xfd: case 0xfe: case 0xff:
 					{
 						/* Floating-point Dual Add/Subtract */
-						UML_FSCOPYI(block, F0, REG(rx));
-						UML_FSCOPYI(block, F1, REG(ry));
-						UML_FSADD(block, F2, F0, F1);
-						if (AZ_CALC_REQUIRED || AN_CALC_REQUIRED)
-							UML_FSCMP(block, F2, mem(&m_core->fp0));
-						if (AZ_CALC_REQUIRED) UML_SETc(block, COND_Z, ASTAT_AZ);
-						if (AN_CALC_REQUIRED) UML_SETc(block, COND_C, ASTAT_AN);
-						UML_FSSUB(block, F3, F0, F1);
-						if (AZ_CALC_REQUIRED || AN_CALC_REQUIRED)
-							UML_FSCMP(block, F2, mem(&m_core->fp0));
-						if (AZ_CALC_REQUIRED) UML_SETc(block, COND_Z, I0);
-						if (AN_CALC_REQUIRED) UML_SETc(block, COND_C, I1);
-						if (AZ_CALC_REQUIRED) UML_OR(block, ASTAT_AZ, ASTAT_AZ, I0);
-						if (AN_CALC_REQUIRED) UML_OR(block, ASTAT_AN, ASTAT_AN, I1);
-						if (AV_CALC_REQUIRED) UML_MOV(block, ASTAT_AV, 0);  // TODO
-						if (AC_CALC_REQUIRED) UML_MOV(block, ASTAT_AC, 0);
-						if (AS_CALC_REQUIRED) UML_MOV(block, ASTAT_AS, 0);
-						if (AI_CALC_REQUIRED) UML_MOV(block, ASTAT_AI, 0);  // TODO
-						UML_ICOPYFS(block, REG(ra), F2);
-						UML_ICOPYFS(block, REG(rs), F3);
+						generate_dual_fadd_fsub(block, compiler, desc, rx, ry);
+						UML_ICOPYFS(block, REG(ra), F4);
+						UML_ICOPYFS(block, REG(rs), F5);
 						return;
 					}
 
@@ -0,0 +1,1837 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    32031drc.hxx
+
+    Universal machine language-based TMS320C3x recompiler
+
+****************************************************************************
+
+    Notes:
+
+    ** The generated code works on the interpreter's own state: the
+       register file, PC, cycle counter and delay flags are loaded and
+       stored in place, so a call back into an interpreter handler
+       needs nothing copied in either direction.
+
+    ** Integer ALU operations, loads and stores, short shifts, pushes
+       and pops, the block and single repeats, branches, calls and the
+       three-slot delayed branches are generated inline, as are the
+       parallel load/store forms and the integer operations paired with
+       a store.  The floating point format is not IEEE, so ADDF, SUBF,
+       MPYF and CMPF (and their three-operand and parallel forms) fetch
+       and convert their operands inline and call the core's helpers
+       for the arithmetic itself.  Everything else runs its interpreter
+       handler.
+
+    ** The PC is written back at sequence boundaries and before every
+       callout; memory handlers invoked from a compiled read or write
+       see the PC of the last callout or sequence start.
+
+    ** The block repeat check the interpreter makes before every
+       instruction is compiled in front of every instruction outside a
+       delay slot.
+
+***************************************************************************/
+
+
+/***************************************************************************
+    DEBUGGING
+***************************************************************************/
+
+#define SINGLE_INSTRUCTION_MODE         (0)
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+#include "32031fe.hxx"
+
+// map variables
+#define MAPVAR_PC                       uml::M0
+
+// size of the execution code cache
+#define CACHE_SIZE                      (16 * 1024 * 1024)
+
+// compilation boundaries -- how far back/forward does the analysis extend?
+#define COMPILE_BACKWARDS_WORDS         128
+#define COMPILE_FORWARDS_WORDS          512
+#define COMPILE_MAX_SEQUENCE            64
+
+// exit codes
+#define EXECUTE_OUT_OF_CYCLES           0
+#define EXECUTE_MISSING_CODE            1
+#define EXECUTE_STATE_CHANGED           2
+
+// ALU operations shared by the integer forms
+enum
+{
+	TMS_ALU_ADD,
+	TMS_ALU_SUB,
+	TMS_ALU_NEG,
+	TMS_ALU_AND,
+	TMS_ALU_ANDN,
+	TMS_ALU_OR,
+	TMS_ALU_XOR,
+	TMS_ALU_NOT,
+	TMS_ALU_LD
+};
+
+// floating point helpers
+enum
+{
+	TMS_FPU_ADD,
+	TMS_FPU_SUB,
+	TMS_FPU_MPY
+};
+
+
+/***************************************************************************
+    MACROS
+***************************************************************************/
+
+// the register file is an array of mantissa/exponent word pairs
+#define DRC_LOADREG(block, dst, reg)    UML_LOAD(block, dst, &m_r[0].i32[0], (reg) * 2, uml::SIZE_DWORD, uml::SCALE_x4)
+#define DRC_STOREREG(block, reg, src)   UML_STORE(block, &m_r[0].i32[0], (reg) * 2, src, uml::SIZE_DWORD, uml::SCALE_x4)
+#define DRC_LOADEXP(block, dst, reg)    UML_LOAD(block, dst, &m_r[0].i32[0], (reg) * 2 + 1, uml::SIZE_DWORD, uml::SCALE_x4)
+#define DRC_STOREEXP(block, reg, src)   UML_STORE(block, &m_r[0].i32[0], (reg) * 2 + 1, src, uml::SIZE_DWORD, uml::SCALE_x4)
+
+// other state the generated code touches
+#define DRC_LOADVAR(block, dst, var)    UML_LOAD(block, dst, &(var), 0, uml::SIZE_DWORD, uml::SCALE_x1)
+#define DRC_STOREVAR(block, var, src)   UML_STORE(block, &(var), 0, src, uml::SIZE_DWORD, uml::SCALE_x1)
+#define DRC_LOADBOOL(block, dst, var)   UML_LOAD(block, dst, &(var), 0, uml::SIZE_BYTE, uml::SCALE_x1)
+#define DRC_STOREBOOL(block, var, src)  UML_STORE(block, &(var), 0, src, uml::SIZE_BYTE, uml::SCALE_x1)
+
+
+
+/***************************************************************************
+    INLINE FUNCTIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    alloc_handle - allocate a handle if not
+    already allocated
+-------------------------------------------------*/
+
+static inline void alloc_handle(drcuml_state &drcuml, uml::code_handle *&handleptr, const char *name)
+{
+	if (handleptr == nullptr)
+		handleptr = drcuml.handle_alloc(name);
+}
+
+
+/*-------------------------------------------------
+    indirect_supported - return true if an
+    indirect addressing field is generated inline
+-------------------------------------------------*/
+
+static inline bool indirect_supported(uint32_t field)
+{
+	// bit-reversed and illegal modes are left to the interpreter
+	return ((field >> 3) & 31) < 0x19;
+}
+
+
+/*-------------------------------------------------
+    fpu_args - pack the register numbers for a
+    floating point helper
+-------------------------------------------------*/
+
+static inline uint32_t fpu_args(int dst, int src1, int src2)
+{
+	return dst | (src1 << 8) | (src2 << 16);
+}
+
+
+/*-------------------------------------------------
+    cfunc_* - C callbacks from the generated code
+-------------------------------------------------*/
+
+static void cfunc_execute_op(void *param)
+{
+	((tms3203x_device *)param)->func_execute_op();
+}
+
+static void cfunc_update_special(void *param)
+{
+	((tms3203x_device *)param)->func_update_special();
+}
+
+static void cfunc_repeat_end(void *param)
+{
+	((tms3203x_device *)param)->func_repeat_end();
+}
+
+static void cfunc_delayed_irq(void *param)
+{
+	((tms3203x_device *)param)->func_delayed_irq();
+}
+
+static void cfunc_addf(void *param)
+{
+	((tms3203x_device *)param)->func_addf();
+}
+
+static void cfunc_subf(void *param)
+{
+	((tms3203x_device *)param)->func_subf();
+}
+
+static void cfunc_mpyf(void *param)
+{
+	((tms3203x_device *)param)->func_mpyf();
+}
+
+
+
+/***************************************************************************
+    CORE CALLBACKS
+***************************************************************************/
+
+/*-------------------------------------------------
+    drc_init - initialize the recompiler
+-------------------------------------------------*/
+
+void tms3203x_device::drc_init()
+{
+	// allocate the cache
+	try { m_drc_cache = std::make_unique<drc_cache>(CACHE_SIZE); }
+	catch (std::bad_alloc const &) { throw emu_fatalerror("Unable to allocate cache of size %d\n", (uint32_t)CACHE_SIZE); }
+
+	// initialize the UML generator; every instruction is a single word
+	m_drcuml = std::make_unique<drcuml_state>(*this, *m_drc_cache, 0, 1, 24, 0);
+
+	// add symbols for our stuff
+	m_drcuml->symbol_add(&m_pc, sizeof(m_pc), "pc");
+	m_drcuml->symbol_add(&m_r[0], sizeof(m_r), "regs");
+	m_drcuml->symbol_add(&m_icount, sizeof(m_icount), "icount");
+	m_drcuml->symbol_add(&m_delayed, sizeof(m_delayed), "delayed");
+	m_drcuml->symbol_add(&m_irq_pending, sizeof(m_irq_pending), "irq_pending");
+
+	// initialize the front-end helper
+	m_drcfe = std::make_unique<tms3203x_frontend>(this, COMPILE_BACKWARDS_WORDS, COMPILE_FORWARDS_WORDS, SINGLE_INSTRUCTION_MODE ? 1 : COMPILE_MAX_SEQUENCE);
+
+	// mark the cache dirty so it is updated on next execute
+	m_drc_cache_dirty = true;
+}
+
+
+/*-------------------------------------------------
+    drc_execute - run compiled code until the
+    cycles run out or the core's state needs the
+    interpreter
+-------------------------------------------------*/
+
+void tms3203x_device::drc_execute()
+{
+	// reset the cache if dirty
+	if (m_drc_cache_dirty)
+		code_flush_cache();
+	m_drc_cache_dirty = false;
+
+	// execute
+	int execute_result;
+	do
+	{
+		execute_result = m_drcuml->execute(*m_drc_entry);
+
+		// if we need to recompile, do it
+		if (execute_result == EXECUTE_MISSING_CODE)
+			code_compile_block(m_pc);
+	}
+	while (execute_result != EXECUTE_OUT_OF_CYCLES && execute_result != EXECUTE_STATE_CHANGED);
+}
+
+
+/*-------------------------------------------------
+    func_execute_op - run one instruction through
+    its interpreter handler
+-------------------------------------------------*/
+
+void tms3203x_device::func_execute_op()
+{
+	(this->*s_tms32031ops[m_drc_op >> 21])(m_drc_op);
+}
+
+
+/*-------------------------------------------------
+    func_update_special - apply the side effects
+    of a write to BK, ST, IE, IF or IOF
+-------------------------------------------------*/
+
+void tms3203x_device::func_update_special()
+{
+	update_special(m_drc_arg);
+}
+
+
+/*-------------------------------------------------
+    func_repeat_end - leave repeat mode once the
+    count is exhausted
+-------------------------------------------------*/
+
+void tms3203x_device::func_repeat_end()
+{
+	IREG(TMR_ST) &= ~RMFLAG;
+	if (m_delayed)
+	{
+		m_delayed = false;
+		if (m_irq_pending)
+		{
+			m_irq_pending = false;
+			check_irqs();
+		}
+	}
+}
+
+
+/*-------------------------------------------------
+    func_delayed_irq - take an interrupt that
+    arrived while the delay slots were running
+-------------------------------------------------*/
+
+void tms3203x_device::func_delayed_irq()
+{
+	m_irq_pending = false;
+	check_irqs();
+}
+
+
+/*-------------------------------------------------
+    func_addf/func_subf/func_mpyf - floating point
+    arithmetic on the registers packed into the
+    argument
+-------------------------------------------------*/
+
+void tms3203x_device::func_addf()
+{
+	addf(m_r[m_drc_arg & 0xff], m_r[(m_drc_arg >> 8) & 0xff], m_r[(m_drc_arg >> 16) & 0xff]);
+}
+
+void tms3203x_device::func_subf()
+{
+	subf(m_r[m_drc_arg & 0xff], m_r[(m_drc_arg >> 8) & 0xff], m_r[(m_drc_arg >> 16) & 0xff]);
+}
+
+void tms3203x_device::func_mpyf()
+{
+	mpyf(m_r[m_drc_arg & 0xff], m_r[(m_drc_arg >> 8) & 0xff], m_r[(m_drc_arg >> 16) & 0xff]);
+}
+
+
+
+/***************************************************************************
+    CACHE MANAGEMENT
+***************************************************************************/
+
+/*-------------------------------------------------
+    code_flush_cache - flush the cache and
+    regenerate static code
+-------------------------------------------------*/
+
+void tms3203x_device::code_flush_cache()
+{
+	// empty the transient cache contents
+	m_drcuml->reset();
+
+	try
+	{
+		// generate the entry point and out-of-cycles handlers
+		static_generate_entry_point();
+		static_generate_nocode_handler();
+		static_generate_out_of_cycles();
+	}
+	catch (drcuml_block::abort_compilation &)
+	{
+		fatalerror("Unrecoverable error generating static code\n");
+	}
+}
+
+
+/*-------------------------------------------------
+    code_compile_block - compile a block at the
+    specified pc
+-------------------------------------------------*/
+
+void tms3203x_device::code_compile_block(offs_t pc)
+{
+	drcuml_state &drcuml = *m_drcuml;
+	const opcode_desc *seqhead, *seqlast;
+	bool override = false;
+
+	auto profile = g_profiler.start(PROFILER_DRC_COMPILE);
+
+	// get a description of this sequence
+	const opcode_desc *desclist = m_drcfe->describe_code(pc);
+
+	// if we get an error back, flush the cache and try again
+	bool succeeded = false;
+	while (!succeeded)
+	{
+		try
+		{
+			// start the block
+			drcuml_block &block(drcuml.begin_block(8192));
+			compiler_state compiler;
+			compiler.labelnum = 1;
+
+			// loop until we get through all instruction sequences
+			for (seqhead = desclist; seqhead != nullptr; seqhead = seqlast->next())
+			{
+				// add a code log entry
+				if (drcuml.logging())
+					block.append_comment("-------------------------");                 // comment
+
+				// determine the last instruction in this sequence
+				for (seqlast = seqhead; seqlast != nullptr; seqlast = seqlast->next())
+					if (seqlast->flags & OPFLAG_END_SEQUENCE)
+						break;
+				assert(seqlast != nullptr);
+
+				// if we don't have a hash for this pc, or if we are overriding all, add one
+				if (override || !drcuml.hash_exists(0, seqhead->pc))
+					UML_HASH(block, 0, seqhead->pc);                                    // hash    0,pc
+
+				// if we already have a hash, and this is the first sequence, assume that we
+				// are recompiling due to being out of sync and allow future overrides
+				else if (seqhead == desclist)
+				{
+					override = true;
+					UML_HASH(block, 0, seqhead->pc);                                    // hash    0,pc
+				}
+
+				// otherwise, redispatch to that fixed PC and skip the rest of the processing
+				else
+				{
+					UML_HASHJMP(block, 0, seqhead->pc, *m_drc_nocode);                  // hashjmp 0,seqhead->pc,nocode
+					continue;
+				}
+
+				// validate any of this code that lives in RAM
+				generate_checksum_block(block, compiler, seqhead, seqlast);
+
+				// iterate over instructions in the sequence and compile them
+				for (const opcode_desc *curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+					generate_sequence_instruction(block, compiler, curdesc);
+
+				// count off cycles and go to the next instruction
+				const offs_t nextpc = seqlast->pc + seqlast->length;
+				generate_update_cycles(block, compiler, nextpc);                        // <subtract cycles>
+				if (seqlast->next() == nullptr || seqlast->next()->pc != nextpc)
+					UML_HASHJMP(block, 0, nextpc, *m_drc_nocode);                       // hashjmp 0,nextpc,nocode
+			}
+
+			// end the sequence
+			block.end();
+			succeeded = true;
+		}
+		catch (drcuml_block::abort_compilation &)
+		{
+			code_flush_cache();
+		}
+	}
+}
+
+
+
+/***************************************************************************
+    STATIC CODEGEN
+***************************************************************************/
+
+/*-------------------------------------------------
+    static_generate_entry_point - generate a
+    static entry point
+-------------------------------------------------*/
+
+void tms3203x_device::static_generate_entry_point()
+{
+	drcuml_state &drcuml = *m_drcuml;
+
+	// begin generating
+	drcuml_block &block(drcuml.begin_block(20));
+
+	// forward references
+	alloc_handle(drcuml, m_drc_nocode, "nocode");
+
+	alloc_handle(drcuml, m_drc_entry, "entry");
+	UML_HANDLE(block, *m_drc_entry);                                                    // handle  entry
+
+	// generate a hash jump via the current PC
+	DRC_LOADVAR(block, uml::I0, m_pc);                                                  // load    i0,[pc]
+	UML_HASHJMP(block, 0, uml::I0, *m_drc_nocode);                                      // hashjmp 0,i0,nocode
+
+	block.end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_nocode_handler - generate an
+    exception handler for "out of code"
+-------------------------------------------------*/
+
+void tms3203x_device::static_generate_nocode_handler()
+{
+	drcuml_state &drcuml = *m_drcuml;
+
+	// begin generating
+	drcuml_block &block(drcuml.begin_block(10));
+
+	// store the PC and ask for a compile
+	alloc_handle(drcuml, m_drc_nocode, "nocode");
+	UML_HANDLE(block, *m_drc_nocode);                                                   // handle  nocode
+	UML_GETEXP(block, uml::I0);                                                         // getexp  i0
+	DRC_STOREVAR(block, m_pc, uml::I0);                                                 // store   [pc],i0
+	UML_EXIT(block, EXECUTE_MISSING_CODE);                                              // exit    EXECUTE_MISSING_CODE
+
+	block.end();
+}
+
+
+/*-------------------------------------------------
+    static_generate_out_of_cycles - generate an
+    out of cycles exception handler
+-------------------------------------------------*/
+
+void tms3203x_device::static_generate_out_of_cycles()
+{
+	drcuml_state &drcuml = *m_drcuml;
+
+	// begin generating
+	drcuml_block &block(drcuml.begin_block(10));
+
+	// store the PC and return to the core
+	alloc_handle(drcuml, m_drc_out_of_cycles, "out_of_cycles");
+	UML_HANDLE(block, *m_drc_out_of_cycles);                                            // handle  out_of_cycles
+	UML_GETEXP(block, uml::I0);                                                         // getexp  i0
+	DRC_STOREVAR(block, m_pc, uml::I0);                                                 // store   [pc],i0
+	UML_EXIT(block, EXECUTE_OUT_OF_CYCLES);                                             // exit    EXECUTE_OUT_OF_CYCLES
+
+	block.end();
+}
+
+
+
+/***************************************************************************
+    CODE GENERATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    generate_update_cycles - generate code to
+    subtract cycles from the icount and generate
+    an exception if out; the PC parameter must not
+    be I5
+-------------------------------------------------*/
+
+void tms3203x_device::generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param)
+{
+	if (compiler.cycles > 0)
+	{
+		DRC_LOADVAR(block, uml::I5, m_icount);                                          // load    i5,[icount]
+		UML_SUB(block, uml::I5, uml::I5, compiler.cycles);                              // sub     i5,i5,cycles
+		DRC_STOREVAR(block, m_icount, uml::I5);                                         // store   [icount],i5
+		UML_CMP(block, uml::I5, 0);                                                     // cmp     i5,0
+		UML_EXHc(block, uml::COND_LE, *m_drc_out_of_cycles, param);                     // exh     out_of_cycles,param,LE
+	}
+	compiler.cycles = 0;
+}
+
+
+/*-------------------------------------------------
+    generate_checksum_block - generate code to
+    validate a sequence of opcodes
+-------------------------------------------------*/
+
+void tms3203x_device::generate_checksum_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *seqhead, const opcode_desc *seqlast)
+{
+	uint32_t sum = 0;
+	bool first = true;
+
+	// sum every word in RAM the sequence was compiled from, delay slots included
+	auto add_word = [&] (const opcode_desc &desc)
+	{
+		const void *base = m_program.space().get_write_ptr(desc.physpc);
+		if (base == nullptr)
+			return;
+		if (first && m_drcuml->logging())
+			block.append_comment("[Validation for %06X]", seqhead->pc);                // comment
+		UML_LOAD(block, first ? uml::I0 : uml::I1, base, 0, uml::SIZE_DWORD, uml::SCALE_x4);   // load    i0/i1,base,0,dword
+		if (!first)
+			UML_ADD(block, uml::I0, uml::I0, uml::I1);                                  // add     i0,i0,i1
+		sum += desc.opptr.l[0];
+		first = false;
+	};
+
+	for (const opcode_desc *curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+	{
+		add_word(*curdesc);
+		for (const opcode_desc *slot = curdesc->delay.first(); slot != nullptr; slot = slot->next())
+			add_word(*slot);
+	}
+
+	if (!first)
+	{
+		UML_CMP(block, uml::I0, sum);                                                   // cmp     i0,sum
+		UML_EXHc(block, uml::COND_NE, *m_drc_nocode, seqhead->pc);                      // exne    nocode,seqhead->pc
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_sequence_instruction - generate code
+    for a single instruction in a sequence
+-------------------------------------------------*/
+
+void tms3203x_device::generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	// add an entry for the log
+	if (m_drcuml->logging())
+		block.append_comment("%06X: %08X", desc->pc, desc->opptr.l[0]);                // comment
+
+	// set the PC map variable
+	UML_MAPVAR(block, MAPVAR_PC, desc->pc);                                             // mapvar  PC,desc->pc
+
+	// the end of a block repeat is checked before every instruction outside the delay slots
+	if (!(desc->flags & OPFLAG_IN_DELAY_SLOT))
+		generate_repeat_check(block, compiler, desc);
+
+	// accumulate total cycles
+	compiler.cycles += desc->cycles;
+
+	// compile it, or hand it to the interpreter
+	if (!generate_opcode(block, compiler, desc))
+		generate_interpret(block, compiler, desc);
+}
+
+
+/*-------------------------------------------------
+    generate_repeat_check - generate the check for
+    reaching the end of a block repeat at this
+    instruction
+-------------------------------------------------*/
+
+void tms3203x_device::generate_repeat_check(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	uml::code_label skip = compiler.labelnum++;
+	uml::code_label done = compiler.labelnum++;
+
+	DRC_LOADREG(block, uml::I0, TMR_ST);                                                // load    i0,[st]
+	UML_TEST(block, uml::I0, RMFLAG);                                                   // test    i0,RMFLAG
+	UML_JMPc(block, uml::COND_Z, skip);                                                 // jmp     skip,Z
+	DRC_LOADREG(block, uml::I0, TMR_RE);                                                // load    i0,[re]
+	UML_CMP(block, uml::I0, desc->pc - 1);                                              // cmp     i0,pc-1
+	UML_JMPc(block, uml::COND_NE, skip);                                                // jmp     skip,NE
+
+	// count down and loop back while the count stays positive
+	DRC_LOADREG(block, uml::I0, TMR_RC);                                                // load    i0,[rc]
+	UML_SUB(block, uml::I0, uml::I0, 1);                                                // sub     i0,i0,1
+	DRC_STOREREG(block, TMR_RC, uml::I0);                                               // store   [rc],i0
+	UML_TEST(block, uml::I0, 0x80000000);                                               // test    i0,0x80000000
+	UML_JMPc(block, uml::COND_NZ, done);                                                // jmp     done,NZ
+	DRC_LOADREG(block, uml::I0, TMR_RS);                                                // load    i0,[rs]
+	generate_branch(block, compiler, uml::I0);                                          // <branch to rs>
+
+	// leave repeat mode, which may release a deferred interrupt
+	UML_LABEL(block, done);                                                             // done:
+	DRC_STOREVAR(block, m_pc, desc->pc);                                                // store   [pc],pc
+	UML_CALLC(block, cfunc_repeat_end, this);                                           // callc   cfunc_repeat_end
+	generate_redirect(block, compiler, desc->pc);                                       // <redirect if the pc moved>
+
+	UML_LABEL(block, skip);                                                             // skip:
+}
+
+
+/*-------------------------------------------------
+    generate_interpret - generate a call to the
+    interpreter handler for an instruction
+-------------------------------------------------*/
+
+void tms3203x_device::generate_interpret(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	DRC_STOREVAR(block, m_drc_op, desc->opptr.l[0]);                                    // store   [drc_op],op
+	DRC_STOREVAR(block, m_pc, desc->pc + 1);                                            // store   [pc],pc+1
+	UML_CALLC(block, cfunc_execute_op, this);                                           // callc   cfunc_execute_op
+
+	// IDLE and LOPOWER go back to the core, which decides how to count time
+	if (desc->userflags & TMS_USERFLAG_EXIT)
+	{
+		compiler_state compiler_temp(compiler);
+		DRC_LOADVAR(block, uml::I0, m_pc);                                              // load    i0,[pc]
+		generate_update_cycles(block, compiler_temp, uml::I0);                          // <subtract cycles>
+		UML_EXIT(block, EXECUTE_STATE_CHANGED);                                         // exit    EXECUTE_STATE_CHANGED
+		compiler.labelnum = compiler_temp.labelnum;
+	}
+
+	// nothing in a delay slot can move the PC
+	else if (!(desc->flags & OPFLAG_IN_DELAY_SLOT))
+		generate_redirect(block, compiler, desc->pc + 1);                               // <redirect if the pc moved>
+}
+
+
+/*-------------------------------------------------
+    generate_branch - generate the code for a
+    taken branch, adding any branch penalty
+-------------------------------------------------*/
+
+void tms3203x_device::generate_branch(drcuml_block &block, compiler_state &compiler, uml::parameter targetpc, uint32_t penalty)
+{
+	compiler_state compiler_temp(compiler);
+	compiler_temp.cycles += penalty;
+
+	generate_update_cycles(block, compiler_temp, targetpc);                             // <subtract cycles>
+	UML_HASHJMP(block, 0, targetpc, *m_drc_nocode);                                     // hashjmp 0,targetpc,nocode
+
+	// update the label
+	compiler.labelnum = compiler_temp.labelnum;
+}
+
+
+/*-------------------------------------------------
+    generate_redirect - generate code to follow
+    the PC if a callout moved it away from the
+    expected address
+-------------------------------------------------*/
+
+void tms3203x_device::generate_redirect(drcuml_block &block, compiler_state &compiler, offs_t expected)
+{
+	uml::code_label skip = compiler.labelnum++;
+
+	DRC_LOADVAR(block, uml::I0, m_pc);                                                  // load    i0,[pc]
+	UML_CMP(block, uml::I0, expected);                                                  // cmp     i0,expected
+	UML_JMPc(block, uml::COND_E, skip);                                                 // jmp     skip,E
+	generate_branch(block, compiler, uml::I0);                                          // <branch to i0>
+	UML_LABEL(block, skip);                                                             // skip:
+}
+
+
+/*-------------------------------------------------
+    generate_condition - generate code to test a
+    condition code; NZ means it holds
+-------------------------------------------------*/
+
+void tms3203x_device::generate_condition(drcuml_block &block, uint32_t cond)
+{
+	DRC_LOADREG(block, uml::I3, TMR_ST);                                                // load    i3,[st]
+	UML_AND(block, uml::I3, uml::I3, LUFFLAG | LVFLAG | UFFLAG | NFLAG | ZFLAG | VFLAG | CFLAG);   // and     i3,i3,flags
+	UML_LOAD(block, uml::I3, condition_table, uml::I3, uml::SIZE_DWORD, uml::SCALE_x4);          // load    i3,condition_table,i3
+	UML_TEST(block, uml::I3, 1 << (cond & 31));                                        // test    i3,1 << cond
+}
+
+
+/*-------------------------------------------------
+    generate_direct - generate the address of a
+    direct operand
+-------------------------------------------------*/
+
+void tms3203x_device::generate_direct(drcuml_block &block, uml::parameter dst, uint32_t op)
+{
+	DRC_LOADREG(block, uml::I5, TMR_DP);                                                // load    i5,[dp]
+	UML_AND(block, uml::I5, uml::I5, 0xff);                                             // and     i5,i5,0xff
+	UML_SHL(block, uml::I5, uml::I5, 16);                                               // shl     i5,i5,16
+	UML_OR(block, dst, uml::I5, uint16_t(op));                                          // or      dst,i5,op
+}
+
+
+/*-------------------------------------------------
+    generate_indirect - generate the address of an
+    indirect operand, updating the auxiliary
+    register; a deferred update is left in I4
+    until generate_update_def
+-------------------------------------------------*/
+
+void tms3203x_device::generate_indirect(drcuml_block &block, compiler_state &compiler, uml::parameter dst, uint32_t field, uint32_t disp, bool deferred)
+{
+	const uint32_t mode = (field >> 3) & 31;
+	const int reg = TMR_AR0 + (field & 7);
+	assert(indirect_supported(field));
+
+	DRC_LOADREG(block, uml::I5, reg);                                                   // load    i5,[ar]
+	if (mode == 0x18)
+	{
+		UML_MOV(block, dst, uml::I5);                                                   // mov     dst,i5
+		return;
+	}
+
+	// modes 0x08-0x17 take the displacement from IR0 or IR1
+	if (mode >= 0x08)
+		DRC_LOADREG(block, uml::I6, (mode >= 0x10) ? TMR_IR1 : TMR_IR0);                // load    i6,[ir]
+	const uml::parameter d = (mode >= 0x08) ? uml::parameter(uml::I6) : uml::parameter(disp);
+
+	switch (mode & 7)
+	{
+		case 0:     // *+ARn(d)
+			UML_ADD(block, dst, uml::I5, d);                                            // add     dst,i5,d
+			return;
+
+		case 1:     // *-ARn(d)
+			UML_SUB(block, dst, uml::I5, d);                                            // sub     dst,i5,d
+			return;
+
+		case 2:     // *++ARn(d)
+			UML_ADD(block, uml::I5, uml::I5, d);                                        // add     i5,i5,d
+			UML_MOV(block, dst, uml::I5);                                               // mov     dst,i5
+			break;
+
+		case 3:     // *--ARn(d)
+			UML_SUB(block, uml::I5, uml::I5, d);                                        // sub     i5,i5,d
+			UML_MOV(block, dst, uml::I5);                                               // mov     dst,i5
+			break;
+
+		case 4:     // *ARn++(d)
+			UML_MOV(block, dst, uml::I5);                                               // mov     dst,i5
+			UML_ADD(block, uml::I5, uml::I5, d);                                        // add     i5,i5,d
+			break;
+
+		case 5:     // *ARn--(d)
+			UML_MOV(block, dst, uml::I5);                                               // mov     dst,i5
+			UML_SUB(block, uml::I5, uml::I5, d);                                        // sub     i5,i5,d
+			break;
+
+		case 6:     // *ARn++(d)%
+		{
+			uml::code_label skip = compiler.labelnum++;
+			UML_MOV(block, dst, uml::I5);                                               // mov     dst,i5
+			DRC_LOADVAR(block, uml::I8, m_bkmask);                                      // load    i8,[bkmask]
+			UML_AND(block, uml::I7, uml::I5, uml::I8);                                  // and     i7,i5,i8
+			UML_ADD(block, uml::I7, uml::I7, d);                                        // add     i7,i7,d
+			DRC_LOADREG(block, uml::I8, TMR_BK);                                        // load    i8,[bk]
+			UML_CMP(block, uml::I7, uml::I8);                                           // cmp     i7,i8
+			UML_JMPc(block, uml::COND_B, skip);                                         // jmp     skip,B
+			UML_SUB(block, uml::I7, uml::I7, uml::I8);                                  // sub     i7,i7,i8
+			UML_LABEL(block, skip);                                                     // skip:
+			generate_circular(block);
+			break;
+		}
+
+		case 7:     // *ARn--(d)%
+		{
+			uml::code_label skip = compiler.labelnum++;
+			UML_MOV(block, dst, uml::I5);                                               // mov     dst,i5
+			DRC_LOADVAR(block, uml::I8, m_bkmask);                                      // load    i8,[bkmask]
+			UML_AND(block, uml::I7, uml::I5, uml::I8);                                  // and     i7,i5,i8
+			UML_SUB(block, uml::I7, uml::I7, d);                                        // sub     i7,i7,d
+			UML_JMPc(block, uml::COND_NS, skip);                                        // jmp     skip,NS
+			DRC_LOADREG(block, uml::I8, TMR_BK);                                        // load    i8,[bk]
+			UML_ADD(block, uml::I7, uml::I7, uml::I8);                                  // add     i7,i7,i8
+			UML_LABEL(block, skip);                                                     // skip:
+			generate_circular(block);
+			break;
+		}
+	}
+
+	// write the new value back now, or leave it for after the second operand
+	if (deferred)
+	{
+		UML_MOV(block, uml::I4, uml::I5);                                               // mov     i4,i5
+		compiler.defer_reg = reg;
+	}
+	else
+		DRC_STOREREG(block, reg, uml::I5);                                              // store   [ar],i5
+}
+
+
+/*-------------------------------------------------
+    generate_circular - merge the circular buffer
+    index in I7 into the register in I5
+-------------------------------------------------*/
+
+void tms3203x_device::generate_circular(drcuml_block &block)
+{
+	DRC_LOADVAR(block, uml::I8, m_bkmask);                                              // load    i8,[bkmask]
+	UML_AND(block, uml::I7, uml::I7, uml::I8);                                          // and     i7,i7,i8
+	UML_XOR(block, uml::I8, uml::I8, ~uint32_t(0));                                     // xor     i8,i8,~0
+	UML_AND(block, uml::I5, uml::I5, uml::I8);                                          // and     i5,i5,i8
+	UML_OR(block, uml::I5, uml::I5, uml::I7);                                           // or      i5,i5,i7
+}
+
+
+/*-------------------------------------------------
+    generate_update_def - write back a deferred
+    auxiliary register update
+-------------------------------------------------*/
+
+void tms3203x_device::generate_update_def(drcuml_block &block, compiler_state &compiler)
+{
+	if (compiler.defer_reg >= 0)
+		DRC_STOREREG(block, compiler.defer_reg, uml::I4);                               // store   [ar],i4
+	compiler.defer_reg = -1;
+}
+
+
+/*-------------------------------------------------
+    generate_int_source - generate code to fetch
+    the source of a single-operand instruction
+-------------------------------------------------*/
+
+void tms3203x_device::generate_int_source(drcuml_block &block, compiler_state &compiler, uml::parameter dst, uint32_t op, bool signed_imm)
+{
+	switch ((op >> 21) & 3)
+	{
+		case 0:     // register
+			DRC_LOADREG(block, dst, op & 31);                                           // load    dst,[src]
+			break;
+
+		case 1:     // direct
+			generate_direct(block, dst, op);
+			UML_READ(block, dst, dst, uml::SIZE_DWORD, uml::SPACE_PROGRAM);             // read    dst,dst
+			break;
+
+		case 2:     // indirect
+			generate_indirect(block, compiler, dst, op >> 8, op & 0xff, false);
+			UML_READ(block, dst, dst, uml::SIZE_DWORD, uml::SPACE_PROGRAM);             // read    dst,dst
+			break;
+
+		case 3:     // immediate
+			UML_MOV(block, dst, signed_imm ? uint32_t(int16_t(op)) : uint32_t(uint16_t(op)));   // mov     dst,imm
+			break;
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_3op_sources - generate code to fetch
+    both sources of a three-operand instruction
+    into I1 and I2
+-------------------------------------------------*/
+
+void tms3203x_device::generate_3op_sources(drcuml_block &block, compiler_state &compiler, uint32_t op)
+{
+	switch ((op >> 21) & 3)
+	{
+		case 0:     // reg, reg
+			DRC_LOADREG(block, uml::I1, (op >> 8) & 31);                                // load    i1,[src1]
+			DRC_LOADREG(block, uml::I2, op & 31);                                       // load    i2,[src2]
+			break;
+
+		case 1:     // ind, reg
+			generate_indirect(block, compiler, uml::I1, op >> 8, 1, false);
+			UML_READ(block, uml::I1, uml::I1, uml::SIZE_DWORD, uml::SPACE_PROGRAM);     // read    i1,i1
+			DRC_LOADREG(block, uml::I2, op & 31);                                       // load    i2,[src2]
+			break;
+
+		case 2:     // reg, ind
+			generate_indirect(block, compiler, uml::I2, op, 1, false);
+			UML_READ(block, uml::I2, uml::I2, uml::SIZE_DWORD, uml::SPACE_PROGRAM);     // read    i2,i2
+			DRC_LOADREG(block, uml::I1, (op >> 8) & 31);                                // load    i1,[src1]
+			break;
+
+		case 3:     // ind, ind
+			generate_indirect(block, compiler, uml::I1, op >> 8, 1, true);
+			UML_READ(block, uml::I1, uml::I1, uml::SIZE_DWORD, uml::SPACE_PROGRAM);     // read    i1,i1
+			generate_indirect(block, compiler, uml::I2, op, 1, false);
+			UML_READ(block, uml::I2, uml::I2, uml::SIZE_DWORD, uml::SPACE_PROGRAM);     // read    i2,i2
+			generate_update_def(block, compiler);
+			break;
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_3op_supported - return true if both
+    operand fields of a three-operand instruction
+    are generated inline
+-------------------------------------------------*/
+
+bool tms3203x_device::generate_3op_supported(uint32_t op)
+{
+	const uint32_t mode = (op >> 21) & 3;
+	return (!(mode & 1) || indirect_supported(op >> 8)) && (!(mode & 2) || indirect_supported(op));
+}
+
+
+/*-------------------------------------------------
+    generate_set_flags - generate code to merge
+    the flags in I3 into ST
+-------------------------------------------------*/
+
+void tms3203x_device::generate_set_flags(drcuml_block &block, uint32_t clear, bool latch_overflow)
+{
+	DRC_LOADREG(block, uml::I8, TMR_ST);                                                // load    i8,[st]
+	UML_AND(block, uml::I8, uml::I8, ~clear);                                           // and     i8,i8,~clear
+	UML_OR(block, uml::I8, uml::I8, uml::I3);                                           // or      i8,i8,i3
+	if (latch_overflow)
+	{
+		UML_AND(block, uml::I3, uml::I3, VFLAG);                                        // and     i3,i3,VFLAG
+		UML_SHL(block, uml::I3, uml::I3, 4);                                            // shl     i3,i3,4
+		UML_OR(block, uml::I8, uml::I8, uml::I3);                                       // or      i8,i8,i3
+	}
+	DRC_STOREREG(block, TMR_ST, uml::I8);                                               // store   [st],i8
+}
+
+
+/*-------------------------------------------------
+    generate_update_special - generate the side
+    effects of writing a register at or above BK
+-------------------------------------------------*/
+
+void tms3203x_device::generate_update_special(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, int dreg)
+{
+	if (dreg != TMR_BK && dreg != TMR_ST && dreg != TMR_IE && dreg != TMR_IF && dreg != TMR_IOF)
+		return;
+
+	DRC_STOREVAR(block, m_drc_arg, dreg);                                               // store   [drc_arg],dreg
+	DRC_STOREVAR(block, m_pc, desc->pc + 1);                                            // store   [pc],pc+1
+	UML_CALLC(block, cfunc_update_special, this);                                       // callc   cfunc_update_special
+
+	// ST, IE and IF can let an interrupt in
+	if (dreg != TMR_BK && dreg != TMR_IOF && !(desc->flags & OPFLAG_IN_DELAY_SLOT))
+		generate_redirect(block, compiler, desc->pc + 1);                               // <redirect if the pc moved>
+}
+
+
+/*-------------------------------------------------
+    generate_int_alu - generate an integer
+    operation on I1 and I2 into I0, writing it to
+    dreg unless it is negative
+-------------------------------------------------*/
+
+void tms3203x_device::generate_int_alu(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, int alu, int dreg)
+{
+	const bool arith = (alu == TMS_ALU_ADD || alu == TMS_ALU_SUB || alu == TMS_ALU_NEG);
+	const bool setflags = (dreg < 8);
+
+	switch (alu)
+	{
+		case TMS_ALU_ADD:   UML_ADD(block, uml::I0, uml::I1, uml::I2);              break;  // add     i0,i1,i2
+		case TMS_ALU_SUB:   UML_SUB(block, uml::I0, uml::I1, uml::I2);              break;  // sub     i0,i1,i2
+		case TMS_ALU_NEG:   UML_SUB(block, uml::I0, 0, uml::I2);                    break;  // sub     i0,0,i2
+		case TMS_ALU_AND:   UML_AND(block, uml::I0, uml::I1, uml::I2);              break;  // and     i0,i1,i2
+		case TMS_ALU_OR:    UML_OR(block, uml::I0, uml::I1, uml::I2);               break;  // or      i0,i1,i2
+		case TMS_ALU_XOR:   UML_XOR(block, uml::I0, uml::I1, uml::I2);              break;  // xor     i0,i1,i2
+		case TMS_ALU_NOT:   UML_XOR(block, uml::I0, uml::I2, ~uint32_t(0));         break;  // xor     i0,i2,~0
+
+		case TMS_ALU_ANDN:
+			UML_XOR(block, uml::I3, uml::I2, ~uint32_t(0));                             // xor     i3,i2,~0
+			UML_AND(block, uml::I0, uml::I1, uml::I3);                                  // and     i0,i1,i3
+			break;
+
+		case TMS_ALU_LD:
+			UML_MOV(block, uml::I0, uml::I2);                                           // mov     i0,i2
+			if (setflags)
+				UML_TEST(block, uml::I0, uml::I0);                                      // test    i0,i0
+			break;
+	}
+
+	// UML C/V/Z/S line up with the ST bits
+	if (arith)
+		UML_GETFLGS(block, uml::I3, uml::FLAG_C | uml::FLAG_V | uml::FLAG_Z | uml::FLAG_S);    // getflgs i3,CVZS
+	else if (setflags)
+		UML_GETFLGS(block, uml::I3, uml::FLAG_Z | uml::FLAG_S);                         // getflgs i3,ZS
+
+	if (dreg >= 0)
+	{
+		// saturate on overflow in overflow mode
+		if (arith)
+		{
+			uml::code_label skip = compiler.labelnum++;
+			UML_TEST(block, uml::I3, VFLAG);                                            // test    i3,VFLAG
+			UML_JMPc(block, uml::COND_Z, skip);                                         // jmp     skip,Z
+			DRC_LOADREG(block, uml::I8, TMR_ST);                                        // load    i8,[st]
+			UML_TEST(block, uml::I8, OVMFLAG);                                          // test    i8,OVMFLAG
+			UML_JMPc(block, uml::COND_Z, skip);                                         // jmp     skip,Z
+			UML_MOV(block, uml::I0, 0x7fffffff);                                        // mov     i0,0x7fffffff
+			UML_TEST(block, (alu == TMS_ALU_NEG) ? uml::I2 : uml::I1, 0x80000000);      // test    src1,0x80000000
+			UML_MOVc(block, uml::COND_NZ, uml::I0, 0x80000000);                         // mov     i0,0x80000000,NZ
+			UML_LABEL(block, skip);                                                     // skip:
+		}
+		DRC_STOREREG(block, dreg, uml::I0);                                             // store   [dreg],i0
+	}
+
+	if (setflags)
+		generate_set_flags(block, arith ? (NFLAG | ZFLAG | VFLAG | CFLAG | UFFLAG) : (NFLAG | ZFLAG | VFLAG | UFFLAG), arith);
+	else if (dreg >= TMR_BK)
+		generate_update_special(block, compiler, desc, dreg);
+}
+
+
+/*-------------------------------------------------
+    generate_int_single - generate a single-
+    operand integer instruction
+-------------------------------------------------*/
+
+bool tms3203x_device::generate_int_single(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, int alu, bool signed_imm, bool reverse, bool compare)
+{
+	const uint32_t op = desc->opptr.l[0];
+	const int dreg = (op >> 16) & 31;
+	const bool unary = (alu == TMS_ALU_NEG || alu == TMS_ALU_NOT || alu == TMS_ALU_LD);
+
+	if (((op >> 21) & 3) == 2 && !indirect_supported(op >> 8))
+		return false;
+
+	// the source goes in I2 and the destination in I1, or the other way round for the reversed forms
+	generate_int_source(block, compiler, reverse ? uml::I1 : uml::I2, op, signed_imm);
+	if (!unary)
+		DRC_LOADREG(block, reverse ? uml::I2 : uml::I1, dreg);                          // load    dst,[dreg]
+
+	generate_int_alu(block, compiler, desc, alu, compare ? -1 : dreg);
+	return true;
+}
+
+
+/*-------------------------------------------------
+    generate_shift - generate an immediate LSH or
+    ASH of up to 31 bits
+-------------------------------------------------*/
+
+bool tms3203x_device::generate_shift(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, bool arithmetic)
+{
+	const uint32_t op = desc->opptr.l[0];
+	const int dreg = (op >> 16) & 31;
+	const int32_t count = util::sext(op, 7);
+
+	// the long shifts have their own carry rules
+	if (count < -31 || count > 31)
+		return false;
+
+	DRC_LOADREG(block, uml::I2, dreg);                                                  // load    i2,[dreg]
+	if (count > 0)
+		UML_SHL(block, uml::I0, uml::I2, count);                                        // shl     i0,i2,count
+	else if (count < 0 && !arithmetic)
+		UML_SHR(block, uml::I0, uml::I2, -count);                                       // shr     i0,i2,-count
+	else if (count < 0)
+		UML_SAR(block, uml::I0, uml::I2, -count);                                       // sar     i0,i2,-count
+	else
+	{
+		UML_MOV(block, uml::I0, uml::I2);                                               // mov     i0,i2
+		UML_TEST(block, uml::I0, uml::I0);                                              // test    i0,i0
+	}
+
+	// the carry is the last bit shifted out, or clear for a zero count
+	if (dreg < 8)
+		UML_GETFLGS(block, uml::I3, (count != 0) ? (uml::FLAG_C | uml::FLAG_Z | uml::FLAG_S) : (uml::FLAG_Z | uml::FLAG_S));   // getflgs i3,CZS
+	DRC_STOREREG(block, dreg, uml::I0);                                                 // store   [dreg],i0
+	if (dreg < 8)
+		generate_set_flags(block, NFLAG | ZFLAG | VFLAG | CFLAG | UFFLAG, false);
+	else if (dreg >= TMR_BK)
+		generate_update_special(block, compiler, desc, dreg);
+	return true;
+}
+
+
+/*-------------------------------------------------
+    generate_long_to_float/generate_float_to_long
+    - convert between the memory and register
+    floating point formats
+-------------------------------------------------*/
+
+void tms3203x_device::generate_long_to_float(drcuml_block &block, int reg, uml::parameter src)
+{
+	UML_SHL(block, uml::I3, src, 8);                                                    // shl     i3,src,8
+	DRC_STOREREG(block, reg, uml::I3);                                                  // store   [reg].man,i3
+	UML_SAR(block, uml::I3, src, 24);                                                   // sar     i3,src,24
+	DRC_STOREEXP(block, reg, uml::I3);                                                  // store   [reg].exp,i3
+}
+
+void tms3203x_device::generate_float_to_long(drcuml_block &block, uml::parameter dst, int reg)
+{
+	DRC_LOADEXP(block, dst, reg);                                                       // load    dst,[reg].exp
+	UML_SHL(block, dst, dst, 24);                                                       // shl     dst,dst,24
+	DRC_LOADREG(block, uml::I3, reg);                                                   // load    i3,[reg].man
+	UML_SHR(block, uml::I3, uml::I3, 8);                                                // shr     i3,i3,8
+	UML_OR(block, dst, dst, uml::I3);                                                   // or      dst,dst,i3
+}
+
+
+/*-------------------------------------------------
+    generate_short_float - generate the load of a
+    16-bit immediate floating point value
+-------------------------------------------------*/
+
+void tms3203x_device::generate_short_float(drcuml_block &block, int reg, uint32_t op)
+{
+	const bool zero = (uint16_t)op == 0x8000;
+	DRC_STOREREG(block, reg, zero ? 0 : (op << 20));                                    // store   [reg].man,man
+	DRC_STOREEXP(block, reg, zero ? uint32_t(-128) : uint32_t(int16_t(op) >> 12));      // store   [reg].exp,exp
+}
+
+
+/*-------------------------------------------------
+    generate_float_flags - generate the N and Z
+    flags of a floating point load
+-------------------------------------------------*/
+
+void tms3203x_device::generate_float_flags(drcuml_block &block, int reg)
+{
+	DRC_LOADEXP(block, uml::I8, reg);                                                   // load    i8,[reg].exp
+	UML_CMP(block, uml::I8, uint32_t(-128));                                            // cmp     i8,-128
+	UML_SETc(block, uml::COND_E, uml::I8);                                              // set     i8,E
+	UML_SHL(block, uml::I8, uml::I8, 2);                                                // shl     i8,i8,2
+	DRC_LOADREG(block, uml::I3, reg);                                                   // load    i3,[reg].man
+	UML_SHR(block, uml::I3, uml::I3, 28);                                               // shr     i3,i3,28
+	UML_AND(block, uml::I3, uml::I3, NFLAG);                                            // and     i3,i3,NFLAG
+	UML_OR(block, uml::I3, uml::I3, uml::I8);                                           // or      i3,i3,i8
+	generate_set_flags(block, NFLAG | ZFLAG | VFLAG | UFFLAG, false);
+}
+
+
+/*-------------------------------------------------
+    generate_float_copy - generate a register to
+    register floating point copy
+-------------------------------------------------*/
+
+void tms3203x_device::generate_float_copy(drcuml_block &block, int dreg, int sreg)
+{
+	DRC_LOADREG(block, uml::I0, sreg);                                                  // load    i0,[sreg].man
+	DRC_LOADEXP(block, uml::I1, sreg);                                                  // load    i1,[sreg].exp
+	DRC_STOREREG(block, dreg, uml::I0);                                                 // store   [dreg].man,i0
+	DRC_STOREEXP(block, dreg, uml::I1);                                                 // store   [dreg].exp,i1
+}
+
+
+/*-------------------------------------------------
+    generate_fpu_call - generate a call to one of
+    the floating point helpers
+-------------------------------------------------*/
+
+void tms3203x_device::generate_fpu_call(drcuml_block &block, int fpu, uint32_t args)
+{
+	DRC_STOREVAR(block, m_drc_arg, args);                                               // store   [drc_arg],args
+	switch (fpu)
+	{
+		case TMS_FPU_ADD:   UML_CALLC(block, cfunc_addf, this);     break;              // callc   cfunc_addf
+		case TMS_FPU_SUB:   UML_CALLC(block, cfunc_subf, this);     break;              // callc   cfunc_subf
+		case TMS_FPU_MPY:   UML_CALLC(block, cfunc_mpyf, this);     break;              // callc   cfunc_mpyf
+	}
+}
+
+
+/*-------------------------------------------------
+    generate_float_single - generate ADDF, SUBF,
+    SUBRF, MPYF or CMPF
+-------------------------------------------------*/
+
+bool tms3203x_device::generate_float_single(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, int fpu, bool reverse, bool compare)
+{
+	const uint32_t op = desc->opptr.l[0];
+	const uint32_t regmask = (fpu == TMS_FPU_MPY) ? 31 : 7;
+	const int dreg = (op >> 16) & regmask;
+	int sreg = TMR_TEMP1;
+
+	switch ((op >> 21) & 3)
+	{
+		case 0:     // register
+			sreg = op & regmask;
+			break;
+
+		case 1:     // direct
+			generate_direct(block, uml::I2, op);
+			UML_READ(block, uml::I2, uml::I2, uml::SIZE_DWORD, uml::SPACE_PROGRAM);     // read    i2,i2
+			generate_long_to_float(block, TMR_TEMP1, uml::I2);
+			break;
+
+		case 2:     // indirect
+			if (!indirect_supported(op >> 8))
+				return false;
+			generate_indirect(block, compiler, uml::I2, op >> 8, op & 0xff, false);
+			UML_READ(block, uml::I2, uml::I2, uml::SIZE_DWORD, uml::SPACE_PROGRAM);     // read    i2,i2
+			generate_long_to_float(block, TMR_TEMP1, uml::I2);
+			break;
+
+		case 3:     // immediate
+			generate_short_float(block, TMR_TEMP1, op);
+			break;
+	}
+
+	generate_fpu_call(block, fpu, fpu_args(compare ? TMR_TEMP2 : dreg, reverse ? sreg : dreg, reverse ? dreg : sreg));
+	return true;
+}
+
+
+/*-------------------------------------------------
+    generate_float_3op - generate ADDF3, SUBF3,
+    MPYF3 or CMPF3
+-------------------------------------------------*/
+
+bool tms3203x_device::generate_float_3op(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, int fpu, bool compare)
+{
+	const uint32_t op = desc->opptr.l[0];
+	const uint32_t mode = (op >> 21) & 3;
+
+	if (!generate_3op_supported(op))
+		return false;
+
+	// memory operands are converted into TEMP1 and TEMP2
+	if (mode != 0)
+	{
+		generate_3op_sources(block, compiler, op);
+		if (mode & 1)
+			generate_long_to_float(block, TMR_TEMP1, uml::I1);
+		if (mode & 2)
+			generate_long_to_float(block, TMR_TEMP2, uml::I2);
+	}
+
+	const int src1 = (mode & 1) ? TMR_TEMP1 : ((op >> 8) & 7);
+	const int src2 = (mode & 2) ? TMR_TEMP2 : (op & 7);
+	generate_fpu_call(block, fpu, fpu_args(compare ? TMR_TEMP1 : ((op >> 16) & 7), src1, src2));
+	return true;
+}
+
+
+/*-------------------------------------------------
+    generate_parallel - generate one of the
+    parallel instructions
+-------------------------------------------------*/
+
+bool tms3203x_device::generate_parallel(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	const uint32_t op = desc->opptr.l[0];
+	const uint32_t group = (op >> 21) & ~15;
+	const int dreg1 = (op >> 22) & 7;
+	const int sreg1 = (op >> 19) & 7;
+	const int sreg3 = (op >> 16) & 7;
+	int alu = -1, fpu = -1;
+	bool reverse = false;
+
+	if (!indirect_supported(op) || !indirect_supported(op >> 8))
+		return false;
+
+	switch (group)
+	{
+		case 0x600:     // STF || STF
+		case 0x610:     // STI || STI
+			generate_indirect(block, compiler, uml::I1, op >> 8, 1, true);
+			if (group == 0x600)
+				generate_float_to_long(block, uml::I0, sreg3);
+			else
+				DRC_LOADREG(block, uml::I0, sreg3);                                     // load    i0,[sreg3]
+			UML_WRITE(block, uml::I1, uml::I0, uml::SIZE_DWORD, uml::SPACE_PROGRAM);    // write   i1,i0
+			generate_indirect(block, compiler, uml::I1, op, 1, false);
+			if (group == 0x600)
+				generate_float_to_long(block, uml::I0, dreg1);
+			else
+				DRC_LOADREG(block, uml::I0, dreg1);                                     // load    i0,[dreg1]
+			UML_WRITE(block, uml::I1, uml::I0, uml::SIZE_DWORD, uml::SPACE_PROGRAM);    // write   i1,i0
+			generate_update_def(block, compiler);
+			return true;
+
+		case 0x620:     // LDF || LDF
+		case 0x630:     // LDI || LDI
+			generate_indirect(block, compiler, uml::I0, op >> 8, 1, true);
+			UML_READ(block, uml::I0, uml::I0, uml::SIZE_DWORD, uml::SPACE_PROGRAM);     // read    i0,i0
+			if (group == 0x620)
+				generate_long_to_float(block, sreg1, uml::I0);
+			else
+				DRC_STOREREG(block, sreg1, uml::I0);                                    // store   [sreg1],i0
+			generate_indirect(block, compiler, uml::I0, op, 1, false);
+			UML_READ(block, uml::I0, uml::I0, uml::SIZE_DWORD, uml::SPACE_PROGRAM);     // read    i0,i0
+			if (group == 0x620)
+				generate_long_to_float(block, dreg1, uml::I0);
+			else
+				DRC_STOREREG(block, dreg1, uml::I0);                                    // store   [dreg1],i0
+			generate_update_def(block, compiler);
+			return true;
+
+		case 0x660: fpu = TMS_FPU_ADD;                      break;  // ADDF3 || STF
+		case 0x6f0: fpu = TMS_FPU_MPY;                      break;  // MPYF3 || STF
+		case 0x750: fpu = TMS_FPU_SUB;                      break;  // SUBF3 || STF
+		case 0x6c0: fpu = -2;                               break;  // LDF || STF
+		case 0x670: alu = TMS_ALU_ADD;                      break;  // ADDI3 || STI
+		case 0x680: alu = TMS_ALU_AND;                      break;  // AND3 || STI
+		case 0x6d0: alu = TMS_ALU_LD;                       break;  // LDI || STI
+		case 0x740: alu = TMS_ALU_OR;                       break;  // OR3 || STI
+		case 0x760: alu = TMS_ALU_SUB;  reverse = true;     break;  // SUBI3 || STI
+		case 0x770: alu = TMS_ALU_XOR;                      break;  // XOR3 || STI
+
+		default:
+			return false;
+	}
+
+	// the stored register is read before the operation can change it
+	if (fpu != -1)
+		generate_float_to_long(block, uml::I9, sreg3);
+	else
+		DRC_LOADREG(block, uml::I9, sreg3);                                             // load    i9,[sreg3]
+
+	// the memory operand's register update waits for the store
+	generate_indirect(block, compiler, reverse ? uml::I1 : uml::I2, op, 1, true);
+	UML_READ(block, reverse ? uml::I1 : uml::I2, reverse ? uml::I1 : uml::I2, uml::SIZE_DWORD, uml::SPACE_PROGRAM);  // read    src2,src2
+
+	if (fpu == -2)
+		generate_long_to_float(block, dreg1, uml::I2);
+	else if (fpu != -1)
+	{
+		generate_long_to_float(block, TMR_TEMP1, uml::I2);
+		if (fpu == TMS_FPU_SUB)
+			generate_fpu_call(block, fpu, fpu_args(dreg1, TMR_TEMP1, sreg1));
+		else
+			generate_fpu_call(block, fpu, fpu_args(dreg1, sreg1, TMR_TEMP1));
+	}
+	else if (alu == TMS_ALU_LD)
+		DRC_STOREREG(block, dreg1, uml::I2);                                            // store   [dreg1],i2
+	else
+	{
+		DRC_LOADREG(block, reverse ? uml::I2 : uml::I1, sreg1);                         // load    src1,[sreg1]
+		generate_int_alu(block, compiler, desc, alu, dreg1);
+	}
+
+	generate_indirect(block, compiler, uml::I0, op >> 8, 1, false);
+	UML_WRITE(block, uml::I0, uml::I9, uml::SIZE_DWORD, uml::SPACE_PROGRAM);            // write   i0,i9
+	generate_update_def(block, compiler);
+	return true;
+}
+
+
+/*-------------------------------------------------
+    generate_load_cond - generate the integer and
+    floating point loads, conditional or not
+-------------------------------------------------*/
+
+bool tms3203x_device::generate_load_cond(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, bool isfloat, bool conditional)
+{
+	const uint32_t op = desc->opptr.l[0];
+	const uint32_t mode = (op >> 21) & 3;
+	const uint32_t cond = conditional ? ((op >> 23) & 31) : 0;
+	const int dreg = (op >> 16) & (isfloat ? 7 : 31);
+	uml::code_label skip = compiler.labelnum++;
+
+	// conditions 11 and 21-31 are illegal here
+	if (cond == 11 || cond > 20 || (mode == 2 && !indirect_supported(op >> 8)))
+		return false;
+
+	// integer memory operands are always read; floating point ones only if the condition holds
+	if (mode == 2 || (mode == 1 && !isfloat))
+	{
+		if (mode == 1)
+			generate_direct(block, uml::I2, op);
+		else
+			generate_indirect(block, compiler, uml::I2, op >> 8, op & 0xff, false);
+		if (!isfloat)
+			UML_READ(block, uml::I2, uml::I2, uml::SIZE_DWORD, uml::SPACE_PROGRAM);     // read    i2,i2
+	}
+
+	if (cond != 0)
+	{
+		generate_condition(block, cond);
+		UML_JMPc(block, uml::COND_Z, skip);                                             // jmp     skip,Z
+	}
+
+	if (isfloat)
+	{
+		if (mode == 0)
+			generate_float_copy(block, dreg, op & 7);
+		else if (mode == 3)
+			generate_short_float(block, dreg, op);
+		else
+		{
+			if (mode == 1)
+				generate_direct(block, uml::I2, op);
+			UML_READ(block, uml::I2, uml::I2, uml::SIZE_DWORD, uml::SPACE_PROGRAM);     // read    i2,i2
+			generate_long_to_float(block, dreg, uml::I2);
+		}
+	}
+	else
+	{
+		if (mode == 0)
+			DRC_LOADREG(block, uml::I2, op & 31);                                       // load    i2,[src]
+		else if (mode == 3)
+			UML_MOV(block, uml::I2, uint32_t(int16_t(op)));                             // mov     i2,imm
+		DRC_STOREREG(block, dreg, uml::I2);                                             // store   [dreg],i2
+		if (dreg >= TMR_BK)
+			generate_update_special(block, compiler, desc, dreg);
+	}
+
+	UML_LABEL(block, skip);                                                             // skip:
+	return true;
+}
+
+
+/*-------------------------------------------------
+    generate_delayed_branch - generate a branch
+    with three delay slots
+-------------------------------------------------*/
+
+bool tms3203x_device::generate_delayed_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	const uint32_t op = desc->opptr.l[0];
+	const uint32_t index = op >> 21;
+	const uint32_t cond = (index < 0x340) ? 0 : ((op >> 16) & 31);
+	const bool decrement = (index >= 0x360 && index < 0x380);
+	const bool immediate = (index < 0x340) || (index & 0x10);
+	const offs_t fallpc = desc->pc + 4;
+	uml::code_label nottaken = compiler.labelnum++;
+	uml::code_label irq = compiler.labelnum++;
+
+	// all three slots must compile without moving the PC
+	int slots = 0;
+	for (const opcode_desc *slot = desc->delay.first(); slot != nullptr; slot = slot->next(), slots++)
+		if ((slot->userflags & TMS_USERFLAG_NOSLOT) || (slot->flags & OPFLAG_COMPILER_PAGE_FAULT))
+			return false;
+	if (slots != 3)
+		return false;
+
+	// DBcD counts down first
+	if (decrement)
+	{
+		const int reg = TMR_AR0 + ((op >> 22) & 7);
+		DRC_LOADREG(block, uml::I1, reg);                                               // load    i1,[ar]
+		UML_SUB(block, uml::I2, uml::I1, 1);                                            // sub     i2,i1,1
+		UML_AND(block, uml::I2, uml::I2, 0xffffff);                                     // and     i2,i2,0xffffff
+		UML_AND(block, uml::I1, uml::I1, 0xff000000);                                   // and     i1,i1,0xff000000
+		UML_OR(block, uml::I1, uml::I1, uml::I2);                                       // or      i1,i1,i2
+		DRC_STOREREG(block, reg, uml::I1);                                              // store   [ar],i1
+	}
+
+	// decide where we are going before the slots run
+	if (!immediate)
+		DRC_LOADREG(block, uml::I1, op & 31);                                           // load    i1,[src]
+	if (decrement || cond != 0)
+	{
+		uml::code_label skip = compiler.labelnum++;
+		UML_MOV(block, uml::I0, fallpc);                                                // mov     i0,pc+4
+		if (decrement)
+		{
+			UML_TEST(block, uml::I2, 0x800000);                                         // test    i2,0x800000
+			UML_JMPc(block, uml::COND_NZ, skip);                                        // jmp     skip,NZ
+		}
+		if (cond != 0)
+		{
+			generate_condition(block, cond);
+			UML_JMPc(block, uml::COND_Z, skip);                                         // jmp     skip,Z
+		}
+		if (immediate)
+			UML_MOV(block, uml::I0, desc->targetpc);                                    // mov     i0,target
+		else
+			UML_MOV(block, uml::I0, uml::I1);                                           // mov     i0,i1
+		UML_LABEL(block, skip);                                                         // skip:
+		DRC_STOREVAR(block, m_drc_target, uml::I0);                                     // store   [drc_target],i0
+	}
+	else if (!immediate)
+		DRC_STOREVAR(block, m_drc_target, uml::I1);                                     // store   [drc_target],i1
+
+	// run the slots with interrupts held off
+	DRC_STOREBOOL(block, m_delayed, 1);                                                 // store   [delayed],1
+	for (const opcode_desc *slot = desc->delay.first(); slot != nullptr; slot = slot->next())
+		generate_sequence_instruction(block, compiler, slot);
+	DRC_STOREBOOL(block, m_delayed, 0);                                                 // store   [delayed],0
+
+	// fetch the destination
+	if (immediate && !decrement && cond == 0)
+		UML_MOV(block, uml::I0, desc->targetpc);                                        // mov     i0,target
+	else
+		DRC_LOADVAR(block, uml::I0, m_drc_target);                                      // load    i0,[drc_target]
+
+	// an interrupt held off by the slots is taken at the destination
+	DRC_LOADBOOL(block, uml::I1, m_irq_pending);                                        // load    i1,[irq_pending]
+	UML_TEST(block, uml::I1, 1);                                                        // test    i1,1
+	UML_JMPc(block, uml::COND_NZ, irq);                                                 // jmp     irq,NZ
+
+	if (!immediate)
+		generate_branch(block, compiler, uml::I0);                                      // <branch to i0>
+	else
+	{
+		if (decrement || cond != 0)
+		{
+			UML_CMP(block, uml::I0, fallpc);                                            // cmp     i0,pc+4
+			UML_JMPc(block, uml::COND_E, nottaken);                                     // jmp     nottaken,E
+		}
+		generate_branch(block, compiler, desc->targetpc);                               // <branch to target>
+	}
+	UML_LABEL(block, nottaken);                                                         // nottaken:
+	if (immediate && (decrement || cond != 0))
+		generate_branch(block, compiler, fallpc);                                       // <branch to pc+4>
+
+	UML_LABEL(block, irq);                                                              // irq:
+	DRC_STOREVAR(block, m_pc, uml::I0);                                                 // store   [pc],i0
+	UML_CALLC(block, cfunc_delayed_irq, this);                                          // callc   cfunc_delayed_irq
+	DRC_LOADVAR(block, uml::I0, m_pc);                                                  // load    i0,[pc]
+	generate_branch(block, compiler, uml::I0);                                          // <branch to i0>
+
+	// every path has left, so nothing is owed by what follows
+	compiler.cycles = 0;
+	return true;
+}
+
+
+/*-------------------------------------------------
+    generate_branch_op - generate one of the
+    branches, calls or returns without delay slots
+-------------------------------------------------*/
+
+bool tms3203x_device::generate_branch_op(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	const uint32_t op = desc->opptr.l[0];
+	const uint32_t index = op >> 21;
+	const uint32_t cond = (op >> 16) & 31;
+	const bool call = (index & ~7) == 0x310 || index == 0x380 || index == 0x390;
+	const bool decrement = (index >= 0x360 && index < 0x380);
+	uml::code_label skip = compiler.labelnum++;
+
+	// DBc counts down first
+	if (decrement)
+	{
+		const int reg = TMR_AR0 + ((op >> 22) & 7);
+		DRC_LOADREG(block, uml::I1, reg);                                               // load    i1,[ar]
+		UML_SUB(block, uml::I2, uml::I1, 1);                                            // sub     i2,i1,1
+		UML_AND(block, uml::I2, uml::I2, 0xffffff);                                     // and     i2,i2,0xffffff
+		UML_AND(block, uml::I1, uml::I1, 0xff000000);                                   // and     i1,i1,0xff000000
+		UML_OR(block, uml::I1, uml::I1, uml::I2);                                       // or      i1,i1,i2
+		DRC_STOREREG(block, reg, uml::I1);                                              // store   [ar],i1
+		UML_TEST(block, uml::I2, 0x800000);                                             // test    i2,0x800000
+		UML_JMPc(block, uml::COND_NZ, skip);                                            // jmp     skip,NZ
+	}
+
+	// BR and CALL are unconditional, the rest test cond
+	if (index >= 0x340 && cond != 0)
+	{
+		generate_condition(block, cond);
+		UML_JMPc(block, uml::COND_Z, skip);                                             // jmp     skip,Z
+	}
+
+	// push the return address
+	if (call)
+	{
+		DRC_LOADREG(block, uml::I0, TMR_SP);                                            // load    i0,[sp]
+		UML_ADD(block, uml::I0, uml::I0, 1);                                            // add     i0,i0,1
+		DRC_STOREREG(block, TMR_SP, uml::I0);                                           // store   [sp],i0
+		UML_WRITE(block, uml::I0, desc->pc + 1, uml::SIZE_DWORD, uml::SPACE_PROGRAM);   // write   i0,pc+1
+	}
+
+	// RETSc pops the destination
+	if (index == 0x3c4)
+	{
+		DRC_LOADREG(block, uml::I1, TMR_SP);                                            // load    i1,[sp]
+		UML_READ(block, uml::I0, uml::I1, uml::SIZE_DWORD, uml::SPACE_PROGRAM);         // read    i0,i1
+		UML_SUB(block, uml::I1, uml::I1, 1);                                            // sub     i1,i1,1
+		DRC_STOREREG(block, TMR_SP, uml::I1);                                           // store   [sp],i1
+		generate_branch(block, compiler, uml::I0, 3);                                   // <branch to i0>
+	}
+	else if (desc->targetpc == BRANCH_TARGET_DYNAMIC)
+	{
+		DRC_LOADREG(block, uml::I0, op & 31);                                           // load    i0,[src]
+		generate_branch(block, compiler, uml::I0, 3);                                   // <branch to i0>
+	}
+	else
+		generate_branch(block, compiler, desc->targetpc, 3);                            // <branch to target>
+
+	UML_LABEL(block, skip);                                                             // skip:
+	return true;
+}
+
+
+/*-------------------------------------------------
+    generate_opcode - generate code for a specific
+    opcode; returns false to hand it to the
+    interpreter
+-------------------------------------------------*/
+
+bool tms3203x_device::generate_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
+{
+	const uint32_t op = desc->opptr.l[0];
+	const uint32_t index = op >> 21;
+
+	if (desc->userflags & TMS_USERFLAG_EXIT)
+		return false;
+
+	// delayed branches, with or without a counter
+	if (desc->delayslots != 0)
+		return generate_delayed_branch(block, compiler, desc);
+
+	// parallel instructions
+	if (index >= 0x600 && index < 0x780)
+		return generate_parallel(block, compiler, desc);
+
+	// conditional loads
+	if (index >= 0x200 && index < 0x300)
+		return generate_load_cond(block, compiler, desc, index < 0x280, true);
+
+	switch (index)
+	{
+		case 0x00c: case 0x00d: case 0x00e: case 0x00f:     // ADDF
+			return generate_float_single(block, compiler, desc, TMS_FPU_ADD, false, false);
+
+		case 0x010: case 0x011: case 0x012: case 0x013:     // ADDI
+			return generate_int_single(block, compiler, desc, TMS_ALU_ADD, true, false, false);
+
+		case 0x014: case 0x015: case 0x016: case 0x017:     // AND
+			return generate_int_single(block, compiler, desc, TMS_ALU_AND, false, false, false);
+
+		case 0x018: case 0x019: case 0x01a: case 0x01b:     // ANDN
+			return generate_int_single(block, compiler, desc, TMS_ALU_ANDN, false, false, false);
+
+		case 0x01f:                                         // ASH imm
+			return generate_shift(block, compiler, desc, true);
+
+		case 0x020: case 0x021: case 0x022: case 0x023:     // CMPF
+			return generate_float_single(block, compiler, desc, TMS_FPU_SUB, false, true);
+
+		case 0x024: case 0x025: case 0x026: case 0x027:     // CMPI
+			return generate_int_single(block, compiler, desc, TMS_ALU_SUB, true, false, true);
+
+		case 0x038: case 0x039: case 0x03a: case 0x03b:     // LDF
+		{
+			const int dreg = (op >> 16) & 7;
+			if (!generate_load_cond(block, compiler, desc, true, false))
+				return false;
+			generate_float_flags(block, dreg);
+			return true;
+		}
+
+		case 0x040: case 0x041: case 0x042: case 0x043:     // LDI
+			return generate_int_single(block, compiler, desc, TMS_ALU_LD, true, false, false);
+
+		case 0x04f:                                         // LSH imm
+			return generate_shift(block, compiler, desc, false);
+
+		case 0x050: case 0x051: case 0x052: case 0x053:     // MPYF
+			return generate_float_single(block, compiler, desc, TMS_FPU_MPY, false, false);
+
+		case 0x060: case 0x061: case 0x062: case 0x063:     // NEGI
+			return generate_int_single(block, compiler, desc, TMS_ALU_NEG, true, false, false);
+
+		case 0x064:                                         // NOP
+			return true;
+
+		case 0x066:                                         // NOP ind
+			if (!indirect_supported(op >> 8))
+				return false;
+			generate_indirect(block, compiler, uml::I0, op >> 8, op & 0xff, false);
+			UML_READ(block, uml::I0, uml::I0, uml::SIZE_DWORD, uml::SPACE_PROGRAM);     // read    i0,i0
+			return true;
+
+		case 0x06c: case 0x06d: case 0x06e: case 0x06f:     // NOT
+			return generate_int_single(block, compiler, desc, TMS_ALU_NOT, false, false, false);
+
+		case 0x071:                                         // POP
+		case 0x075:                                         // POPF
+			DRC_LOADREG(block, uml::I1, TMR_SP);                                        // load    i1,[sp]
+			UML_READ(block, uml::I2, uml::I1, uml::SIZE_DWORD, uml::SPACE_PROGRAM);     // read    i2,i1
+			UML_SUB(block, uml::I1, uml::I1, 1);                                        // sub     i1,i1,1
+			DRC_STOREREG(block, TMR_SP, uml::I1);                                       // store   [sp],i1
+			if (index == 0x071)
+				generate_int_alu(block, compiler, desc, TMS_ALU_LD, (op >> 16) & 31);
+			else
+			{
+				generate_long_to_float(block, (op >> 16) & 7, uml::I2);
+				generate_float_flags(block, (op >> 16) & 7);
+			}
+			return true;
+
+		case 0x079:                                         // PUSH
+		case 0x07d:                                         // PUSHF
+			DRC_LOADREG(block, uml::I0, TMR_SP);                                        // load    i0,[sp]
+			UML_ADD(block, uml::I0, uml::I0, 1);                                        // add     i0,i0,1
+			DRC_STOREREG(block, TMR_SP, uml::I0);                                       // store   [sp],i0
+			if (index == 0x079)
+				DRC_LOADREG(block, uml::I1, (op >> 16) & 31);                           // load    i1,[src]
+			else
+				generate_float_to_long(block, uml::I1, (op >> 16) & 7);
+			UML_WRITE(block, uml::I0, uml::I1, uml::SIZE_DWORD, uml::SPACE_PROGRAM);    // write   i0,i1
+			return true;
+
+		case 0x080: case 0x081: case 0x082: case 0x083:     // OR
+			return generate_int_single(block, compiler, desc, TMS_ALU_OR, false, false, false);
+
+		case 0x084: case 0x085: case 0x086: case 0x087:     // MAXSPEED
+			DRC_STOREBOOL(block, m_is_lopower, 0);                                      // store   [is_lopower],0
+			return true;
+
+		case 0x09c: case 0x09d: case 0x09e: case 0x09f:     // RPTS
+			if (index == 0x09e && !indirect_supported(op >> 8))
+				return false;
+			generate_int_source(block, compiler, uml::I2, op, false);
+			DRC_STOREREG(block, TMR_RC, uml::I2);                                       // store   [rc],i2
+			DRC_STOREREG(block, TMR_RS, desc->pc + 1);                                  // store   [rs],pc+1
+			DRC_STOREREG(block, TMR_RE, desc->pc + 1);                                  // store   [re],pc+1
+			DRC_LOADREG(block, uml::I0, TMR_ST);                                        // load    i0,[st]
+			UML_OR(block, uml::I0, uml::I0, RMFLAG);                                    // or      i0,i0,RMFLAG
+			DRC_STOREREG(block, TMR_ST, uml::I0);                                       // store   [st],i0
+			DRC_STOREBOOL(block, m_delayed, 1);                                         // store   [delayed],1
+			compiler.cycles += 3;
+			return true;
+
+		case 0x0a1:                                         // STF dir
+		case 0x0a2:                                         // STF ind
+		case 0x0a9:                                         // STI dir
+		case 0x0aa:                                         // STI ind
+			if (index & 1)
+				generate_direct(block, uml::I1, op);
+			else if (indirect_supported(op >> 8))
+				generate_indirect(block, compiler, uml::I1, op >> 8, op & 0xff, false);
+			else
+				return false;
+			if (index & 8)
+				DRC_LOADREG(block, uml::I0, (op >> 16) & 31);                           // load    i0,[src]
+			else
+				generate_float_to_long(block, uml::I0, (op >> 16) & 7);
+			UML_WRITE(block, uml::I1, uml::I0, uml::SIZE_DWORD, uml::SPACE_PROGRAM);    // write   i1,i0
+			return true;
+
+		case 0x0bc: case 0x0bd: case 0x0be: case 0x0bf:     // SUBF
+			return generate_float_single(block, compiler, desc, TMS_FPU_SUB, false, false);
+
+		case 0x0c0: case 0x0c1: case 0x0c2: case 0x0c3:     // SUBI
+			return generate_int_single(block, compiler, desc, TMS_ALU_SUB, true, false, false);
+
+		case 0x0c8: case 0x0c9: case 0x0ca: case 0x0cb:     // SUBRF
+			return generate_float_single(block, compiler, desc, TMS_FPU_SUB, true, false);
+
+		case 0x0cc: case 0x0cd: case 0x0ce: case 0x0cf:     // SUBRI
+			return generate_int_single(block, compiler, desc, TMS_ALU_SUB, true, true, false);
+
+		case 0x0d0: case 0x0d1: case 0x0d2: case 0x0d3:     // TSTB
+			return generate_int_single(block, compiler, desc, TMS_ALU_AND, false, false, true);
+
+		case 0x0d4: case 0x0d5: case 0x0d6: case 0x0d7:     // XOR
+			return generate_int_single(block, compiler, desc, TMS_ALU_XOR, false, false, false);
+
+		case 0x104: case 0x105: case 0x106: case 0x107:     // ADDF3
+			return generate_float_3op(block, compiler, desc, TMS_FPU_ADD, false);
+
+		case 0x118: case 0x119: case 0x11a: case 0x11b:     // CMPF3
+			return generate_float_3op(block, compiler, desc, TMS_FPU_SUB, true);
+
+		case 0x124: case 0x125: case 0x126: case 0x127:     // MPYF3
+			return generate_float_3op(block, compiler, desc, TMS_FPU_MPY, false);
+
+		case 0x134: case 0x135: case 0x136: case 0x137:     // SUBF3
+			return generate_float_3op(block, compiler, desc, TMS_FPU_SUB, false);
+
+		case 0x108: case 0x109: case 0x10a: case 0x10b:     // ADDI3
+		case 0x10c: case 0x10d: case 0x10e: case 0x10f:     // AND3
+		case 0x110: case 0x111: case 0x112: case 0x113:     // ANDN3
+		case 0x11c: case 0x11d: case 0x11e: case 0x11f:     // CMPI3
+		case 0x12c: case 0x12d: case 0x12e: case 0x12f:     // OR3
+		case 0x138: case 0x139: case 0x13a: case 0x13b:     // SUBI3
+		case 0x13c: case 0x13d: case 0x13e: case 0x13f:     // TSTB3
+		case 0x140: case 0x141: case 0x142: case 0x143:     // XOR3
+		{
+			static const int s_alu3[] =
+			{
+				TMS_ALU_ADD, TMS_ALU_AND, TMS_ALU_ANDN, -1, -1, TMS_ALU_SUB, -1, -1,
+				-1, TMS_ALU_OR, -1, -1, TMS_ALU_SUB, TMS_ALU_AND, TMS_ALU_XOR
+			};
+			const bool compare = (index & ~3) == 0x11c || (index & ~3) == 0x13c;
+			if (!generate_3op_supported(op))
+				return false;
+			generate_3op_sources(block, compiler, op);
+			generate_int_alu(block, compiler, desc, s_alu3[((index - 0x108) >> 2)], compare ? -1 : ((op >> 16) & 31));
+			return true;
+		}
+
+		case 0x300: case 0x301: case 0x302: case 0x303:     // BR
+		case 0x304: case 0x305: case 0x306: case 0x307:
+		case 0x310: case 0x311: case 0x312: case 0x313:     // CALL
+		case 0x314: case 0x315: case 0x316: case 0x317:
+		case 0x340:                                         // BRc reg
+		case 0x350:                                         // BRc imm
+		case 0x360: case 0x362: case 0x364: case 0x366:     // DBc reg
+		case 0x368: case 0x36a: case 0x36c: case 0x36e:
+		case 0x370: case 0x372: case 0x374: case 0x376:     // DBc imm
+		case 0x378: case 0x37a: case 0x37c: case 0x37e:
+		case 0x380:                                         // CALLc reg
+		case 0x390:                                         // CALLc imm
+		case 0x3c4:                                         // RETSc
+			return generate_branch_op(block, compiler, desc);
+
+		case 0x320: case 0x321: case 0x322: case 0x323:     // RPTB
+		case 0x324: case 0x325: case 0x326: case 0x327:
+			DRC_STOREREG(block, TMR_RS, desc->pc + 1);                                  // store   [rs],pc+1
+			DRC_STOREREG(block, TMR_RE, op & 0xffffff);                                 // store   [re],target
+			DRC_LOADREG(block, uml::I0, TMR_ST);                                        // load    i0,[st]
+			UML_OR(block, uml::I0, uml::I0, RMFLAG);                                    // or      i0,i0,RMFLAG
+			DRC_STOREREG(block, TMR_ST, uml::I0);                                       // store   [st],i0
+			compiler.cycles += 3;
+			return true;
+	}
+	return false;
+}
@@ -0,0 +1,147 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    32031fe.hxx
+
+    Front-end for the TMS320C3x recompiler
+
+    Every instruction is one word long and takes one cycle before any
+    branch penalty.  Branches are described with their targets so
+    short loops stay inside a block; the three delay slots of the
+    delayed forms are described as well, and anything in a slot that
+    could redirect the PC sends the whole delayed branch back to the
+    interpreter.
+
+***************************************************************************/
+
+
+//**************************************************************************
+//  MACROS
+//**************************************************************************
+
+// user flags
+#define TMS_USERFLAG_NOSLOT             (1 << 0)    // instruction cannot be compiled into a delay slot
+#define TMS_USERFLAG_EXIT               (1 << 1)    // compiled code must return to the core afterwards
+
+
+
+//**************************************************************************
+//  TMS3203X FRONTEND
+//**************************************************************************
+
+//-------------------------------------------------
+//  tms3203x_frontend - constructor
+//-------------------------------------------------
+
+tms3203x_frontend::tms3203x_frontend(tms3203x_device *tms, uint32_t window_start, uint32_t window_end, uint32_t max_sequence)
+	: drc_frontend(*tms, window_start, window_end, max_sequence),
+		m_tms(tms)
+{
+}
+
+
+//-------------------------------------------------
+//  describe - build a description of a single
+//  instruction
+//-------------------------------------------------
+
+bool tms3203x_frontend::describe(opcode_desc &desc, const opcode_desc *prev)
+{
+	const uint32_t op = m_tms->m_cache.read_dword(desc.physpc);
+	const uint32_t index = op >> 21;
+	const uint32_t cond = (op >> 16) & 31;
+
+	desc.opptr.l[0] = op;
+	desc.length = 1;
+	desc.cycles = 1;
+
+	// IDLE and LOPOWER change how the core counts time
+	if ((index & ~3) == 0x030 || ((index & ~3) == 0x084 && (op & 1)))
+	{
+		desc.userflags |= TMS_USERFLAG_NOSLOT | TMS_USERFLAG_EXIT;
+		desc.flags |= OPFLAG_END_SEQUENCE;
+		return true;
+	}
+
+	// RPTS, RPTB and SWI must not run from a delay slot
+	if ((index & ~3) == 0x09c || (index & ~7) == 0x320 || index == 0x330)
+	{
+		desc.userflags |= TMS_USERFLAG_NOSLOT;
+		return true;
+	}
+
+	// everything else up to here is straight-line code
+	if (index < 0x300 || index >= 0x3e0)
+		return true;
+
+	// a branch in a delay slot is left to the interpreter
+	const bool in_slot = (desc.flags & OPFLAG_IN_DELAY_SLOT) != 0;
+	if (in_slot)
+	{
+		desc.userflags |= TMS_USERFLAG_NOSLOT;
+		return true;
+	}
+
+	switch (index)
+	{
+		case 0x300: case 0x301: case 0x302: case 0x303:                 // BR
+		case 0x304: case 0x305: case 0x306: case 0x307:
+		case 0x310: case 0x311: case 0x312: case 0x313:                 // CALL
+		case 0x314: case 0x315: case 0x316: case 0x317:
+			desc.targetpc = op & 0xffffff;
+			desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+			return true;
+
+		case 0x308: case 0x309: case 0x30a: case 0x30b:                 // BRD
+		case 0x30c: case 0x30d: case 0x30e: case 0x30f:
+			desc.targetpc = op & 0xffffff;
+			desc.delayslots = 3;
+			desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+			return true;
+
+		case 0x340:                                                     // BRc reg
+		case 0x350:                                                     // BRc imm
+		case 0x380:                                                     // CALLc reg
+		case 0x390:                                                     // CALLc imm
+			if (index & 0x10)
+				desc.targetpc = desc.pc + 1 + (int16_t)op;
+			if (cond == 0)
+				desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+			else
+				desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+			return true;
+
+		case 0x341:                                                     // BRcD reg
+		case 0x351:                                                     // BRcD imm
+			if (index & 0x10)
+				desc.targetpc = desc.pc + 3 + (int16_t)op;
+			desc.delayslots = 3;
+			if (cond == 0)
+				desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+			else
+				desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+			return true;
+
+		case 0x3a0:                                                     // TRAPc
+		case 0x3c0:                                                     // RETIc
+		case 0x3c4:                                                     // RETSc
+			desc.userflags |= TMS_USERFLAG_NOSLOT;
+			if (cond == 0)
+				desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+			else
+				desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+			return true;
+	}
+
+	// DBc and DBcD always depend on the counter
+	if (index >= 0x360 && index < 0x380)
+	{
+		if (index & 0x10)
+			desc.targetpc = desc.pc + ((index & 1) ? 3 : 1) + (int16_t)op;
+		if (index & 1)
+			desc.delayslots = 3;
+		desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+	}
+	return true;
+}
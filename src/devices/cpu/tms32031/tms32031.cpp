@@ -74,6 +74,8 @@
 #include "tms32031.h"
 #include "dis32031.h"
 
+#include "cpu/drcumlsh.h"
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -425,7 +427,14 @@ tms3203x_device::tms3203x_device(const machine_config &mconfig, device_type type
 		m_xf0_cb(*this),
 		m_xf1_cb(*this),
 		m_iack_cb(*this),
-		m_holda_cb(*this)
+		m_holda_cb(*this),
+		m_drc_cache_dirty(false),
+		m_drc_op(0),
+		m_drc_arg(0),
+		m_drc_target(0),
+		m_drc_entry(nullptr),
+		m_drc_nocode(nullptr),
+		m_drc_out_of_cycles(nullptr)
 {
 	// initialize remaining state
 	memset(&m_r, 0, sizeof(m_r));
@@ -592,6 +601,10 @@ void tms3203x_device::device_start()
 	state_add(TMS3203X_RS,      "RS",        m_r[TMR_RS].i32[0]);
 	state_add(TMS3203X_RE,      "RE",        m_r[TMR_RE].i32[0]);
 	state_add(TMS3203X_RC,      "RC",        m_r[TMR_RC].i32[0]);
+
+	// set up the recompiler; it is opt-in until it has been checked against the interpreter
+	if (allow_unverified_drc())
+		drc_init();
 }
 
 
@@ -617,6 +630,7 @@ void tms3203x_device::device_reset()
 
 	// reset internal stuff
 	m_delayed = m_irq_pending = m_is_idling = m_is_lopower = false;
+	m_drc_cache_dirty = true;
 }
 
 
@@ -904,6 +918,7 @@ void tms3203x_device::execute_set_input(int inputnum, int state)
 				m_program.space().install_rom(0x000000, 0x000fff, m_internal_rom->base());
 			else
 				m_program.space().unmap_read(0x000000, 0x000fff);
+			m_drc_cache_dirty = true;
 		}
 		return;
 	}
@@ -972,6 +987,11 @@ void tms3203x_device::execute_run()
 	// non-debug case
 	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) == 0)
 	{
+		// compiled code runs until the core has to count time itself
+		if (m_drcuml)
+			while (m_icount > 0 && !m_is_idling && !m_is_lopower)
+				drc_execute();
+
 		while (m_icount > 0)
 		{
 			if ((IREG(TMR_ST) & RMFLAG) && m_pc == IREG(TMR_RE) + 1)
@@ -1062,3 +1082,4 @@ void tms3203x_device::primary_bus_control_w(offs_t offset, uint32_t data, uint32
 //**************************************************************************
 
 #include "32031ops.hxx"
+#include "32031drc.hxx"
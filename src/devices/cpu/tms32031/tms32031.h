@@ -13,6 +13,9 @@
 
 #pragma once
 
+#include "cpu/drcfe.h"
+#include "cpu/drcuml.h"
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -92,8 +95,12 @@ enum
 
 // ======================> tms3203x_device
 
+class tms3203x_frontend;
+
 class tms3203x_device : public cpu_device
 {
+	friend class tms3203x_frontend;
+
 	struct tmsreg
 	{
 		// constructors
@@ -134,6 +141,15 @@ public:
 	static uint32_t float_to_fp(float fval);
 	static uint32_t double_to_fp(double dval);
 
+	// recompiler callbacks
+	void func_execute_op();
+	void func_update_special();
+	void func_repeat_end();
+	void func_delayed_irq();
+	void func_addf();
+	void func_subf();
+	void func_mpyf();
+
 protected:
 	enum
 	{
@@ -732,6 +748,58 @@ protected:
 	void subi3sti(uint32_t op);
 	void xor3sti(uint32_t op);
 
+	// internal compiler state
+	struct compiler_state
+	{
+		compiler_state &operator=(compiler_state const &) = delete;
+
+		uint32_t            cycles = 0;         // accumulated cycles
+		int                 defer_reg = -1;     // register holding a deferred update in I4
+		uml::code_label     labelnum;           // index for local labels
+	};
+
+	// recompiler
+	void drc_init();
+	void drc_execute();
+	void code_flush_cache();
+	void code_compile_block(offs_t pc);
+	void static_generate_entry_point();
+	void static_generate_nocode_handler();
+	void static_generate_out_of_cycles();
+	void generate_update_cycles(drcuml_block &block, compiler_state &compiler, uml::parameter param);
+	void generate_checksum_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *seqhead, const opcode_desc *seqlast);
+	void generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_repeat_check(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_interpret(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	void generate_branch(drcuml_block &block, compiler_state &compiler, uml::parameter targetpc, uint32_t penalty = 0);
+	void generate_redirect(drcuml_block &block, compiler_state &compiler, offs_t expected);
+	void generate_condition(drcuml_block &block, uint32_t cond);
+	void generate_direct(drcuml_block &block, uml::parameter dst, uint32_t op);
+	void generate_indirect(drcuml_block &block, compiler_state &compiler, uml::parameter dst, uint32_t field, uint32_t disp, bool deferred);
+	void generate_circular(drcuml_block &block);
+	void generate_update_def(drcuml_block &block, compiler_state &compiler);
+	void generate_int_source(drcuml_block &block, compiler_state &compiler, uml::parameter dst, uint32_t op, bool signed_imm);
+	void generate_3op_sources(drcuml_block &block, compiler_state &compiler, uint32_t op);
+	bool generate_3op_supported(uint32_t op);
+	void generate_set_flags(drcuml_block &block, uint32_t clear, bool latch_overflow);
+	void generate_update_special(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, int dreg);
+	void generate_int_alu(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, int alu, int dreg);
+	bool generate_int_single(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, int alu, bool signed_imm, bool reverse, bool compare);
+	bool generate_shift(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, bool arithmetic);
+	void generate_long_to_float(drcuml_block &block, int reg, uml::parameter src);
+	void generate_float_to_long(drcuml_block &block, uml::parameter dst, int reg);
+	void generate_short_float(drcuml_block &block, int reg, uint32_t op);
+	void generate_float_flags(drcuml_block &block, int reg);
+	void generate_float_copy(drcuml_block &block, int dreg, int sreg);
+	void generate_fpu_call(drcuml_block &block, int fpu, uint32_t args);
+	bool generate_float_single(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, int fpu, bool reverse, bool compare);
+	bool generate_float_3op(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, int fpu, bool compare);
+	bool generate_parallel(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	bool generate_load_cond(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, bool isfloat, bool conditional);
+	bool generate_delayed_branch(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	bool generate_branch_op(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+	bool generate_opcode(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc);
+
 	// configuration
 	const address_space_config      m_program_config;
 	uint32_t                        m_chip_type;
@@ -785,6 +853,18 @@ protected:
 	devcb_write8        m_iack_cb;
 	devcb_write_line    m_holda_cb;
 
+	// recompiler state
+	std::unique_ptr<drc_cache>          m_drc_cache;            // code cache
+	std::unique_ptr<drcuml_state>       m_drcuml;               // UML generator state
+	std::unique_ptr<tms3203x_frontend>  m_drcfe;                // front-end state
+	bool                m_drc_cache_dirty;  // true if the cache must be flushed before running
+	uint32_t            m_drc_op;           // opcode handed to the interpreter
+	uint32_t            m_drc_arg;          // argument to a recompiler callback
+	uint32_t            m_drc_target;       // destination of a delayed branch
+	uml::code_handle *  m_drc_entry;        // entry point
+	uml::code_handle *  m_drc_nocode;       // nocode exception handler
+	uml::code_handle *  m_drc_out_of_cycles; // out of cycles exception handler
+
 	// tables
 	static void (tms3203x_device::*const s_tms32031ops[])(uint32_t op);
 	static uint32_t (tms3203x_device::*const s_indirect_d[0x20])(uint32_t, uint8_t);
@@ -841,6 +921,23 @@ public:
 };
 
 
+// ======================> tms3203x_frontend
+
+class tms3203x_frontend : public drc_frontend
+{
+public:
+	// construction/destruction
+	tms3203x_frontend(tms3203x_device *tms, uint32_t window_start, uint32_t window_end, uint32_t max_sequence);
+
+protected:
+	// required overrides
+	virtual bool describe(opcode_desc &desc, const opcode_desc *prev) override;
+
+private:
+	tms3203x_device *m_tms;
+};
+
+
 // device type definition
 DECLARE_DEVICE_TYPE(TMS32030, tms32030_device)
 DECLARE_DEVICE_TYPE(TMS32031, tms32031_device)
@@ -244,6 +244,31 @@ uint16_t tms340x0_device::dummy_shiftreg_r(offs_t offset)
 }
 
 
+/* Direct access for the graphics fast paths: returns the host pointer to
+   a byte-aligned run of flat RAM, or nullptr if the run is not in one
+   block, the host isn't little-endian like the bus, or the debugger
+   needs to see every access */
+uint8_t *tms340x0_device::direct_ptr(offs_t bitaddr, uint32_t bytes, bool write)
+{
+	if (ENDIANNESS_NATIVE != ENDIANNESS_LITTLE || (machine().debug_flags & DEBUG_FLAG_ENABLED) || bytes == 0)
+		return nullptr;
+
+	address_space &program = space(AS_PROGRAM);
+	offs_t const unit = (program.data_width() / 8) - 1;
+	offs_t const last = bitaddr + ((bytes - 1) << 3);
+	auto *const first = static_cast<uint8_t *>(write ? program.get_write_ptr(bitaddr) : program.get_read_ptr(bitaddr));
+	auto *const end = static_cast<uint8_t *>(write ? program.get_write_ptr(last) : program.get_read_ptr(last));
+	if (first == nullptr || end == nullptr)
+		return nullptr;
+
+	/* the pointers are to the bus word holding each address */
+	uint8_t *const start = first + ((bitaddr >> 3) & unit);
+	if (end + ((last >> 3) & unit) != start + bytes - 1)
+		return nullptr;
+	return start;
+}
+
+
 
 /* Pixel operations */
 uint32_t tms340x0_device::pixel_op00(uint32_t dstpix, uint32_t mask, uint32_t srcpix) { return srcpix; }
@@ -1027,6 +1052,49 @@ void FUNCTION_NAME(tms340x0_device::pixblt)(int src_is_linear, int dst_is_linear
 		/* loop over rows */
 		for (y = 0; y < dy; y++)
 		{
+#if (BITS_PER_PIXEL >= 8)
+			/* whole-byte pixels between rows of flat RAM go straight through */
+			if (word_write == &tms340x0_device::memory_w && (saddr & (BITS_PER_PIXEL - 1)) == 0)
+			{
+				typedef std::conditional_t<BITS_PER_PIXEL == 8, uint8_t, uint16_t> pixel_t;
+				uint32_t const bytes = dx * (BITS_PER_PIXEL / 8);
+				auto *const src = reinterpret_cast<const pixel_t *>(direct_ptr(saddr, bytes, false));
+				auto *const dst = reinterpret_cast<pixel_t *>(src ? direct_ptr(daddr, bytes, true) : nullptr);
+				if (src != nullptr && dst != nullptr)
+				{
+					if (!PIXEL_OP_REQUIRES_SOURCE && !TRANSPARENCY && (dst + dx <= src || src + dx <= dst))
+						memcpy(dst, src, bytes);
+					else
+					{
+						for (x = 0; x < dx; x++)
+						{
+							uint32_t dstpix = PIXEL_OP_REQUIRES_SOURCE ? dst[x] : 0;
+							uint32_t pixel = src[x];
+							PIXEL_OP(dstpix, PIXEL_MASK, pixel);
+							if (!TRANSPARENCY || pixel != 0)
+								dst[x] = pixel;
+						}
+					}
+
+					/* count the accesses the word-by-word loop below would make */
+					uint32_t const srcwords = ((saddr & 15) + dx * BITS_PER_PIXEL + 15) >> 4;
+					uint32_t const dstwords = ((daddr & 15) + dx * BITS_PER_PIXEL + 15) >> 4;
+					readwrites += srcwords + dstwords;
+					if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
+						readwrites += dstwords;
+					else if ((daddr & 0x0f) != 0)
+						readwrites++;
+					if (((daddr + dx * BITS_PER_PIXEL) & 15) != 0)
+						readwrites++;
+
+					/* update for next row */
+					saddr += yreverse ? -SPTCH() : SPTCH();
+					daddr += yreverse ? -DPTCH() : DPTCH();
+					continue;
+				}
+			}
+#endif
+
 			uint32_t srcwordaddr = saddr >> 4;
 			uint32_t dstwordaddr = daddr >> 4;
 			uint8_t srcbit = saddr & 15;
@@ -1868,6 +1936,7 @@ void FUNCTION_NAME(tms340x0_device::fill)(int dst_is_linear)
 		{
 			uint16_t dstword, dstmask, pixel;
 			uint32_t dwordaddr;
+			uint16_t *direct = nullptr;
 
 			/* use byte addresses each row */
 			dwordaddr = daddr >> 4;
@@ -1875,11 +1944,15 @@ void FUNCTION_NAME(tms340x0_device::fill)(int dst_is_linear)
 			/* compute cycles */
 			m_gfxcycles += compute_fill_cycles(left_partials, right_partials, full_words, PIXEL_OP_TIMING);
 
+			/* rows of flat RAM are read and written in place */
+			if (word_write == &tms340x0_device::memory_w)
+				direct = reinterpret_cast<uint16_t *>(direct_ptr(dwordaddr << 4, ((left_partials != 0) + full_words + (right_partials != 0)) * 2, true));
+
 			/* handle the left partial word */
 			if (left_partials != 0)
 			{
 				/* fetch the destination word */
-				dstword = (this->*word_read)(dwordaddr << 4);
+				dstword = direct ? *direct : (this->*word_read)(dwordaddr << 4);
 				dstmask = PIXEL_MASK << (daddr & 15);
 
 				/* loop over partials */
@@ -1896,15 +1969,25 @@ void FUNCTION_NAME(tms340x0_device::fill)(int dst_is_linear)
 				}
 
 				/* write the result */
-				(this->*word_write)(dwordaddr++ << 4, dstword);
+				if (direct != nullptr)
+					*direct++ = dstword;
+				else
+					(this->*word_write)(dwordaddr++ << 4, dstword);
+			}
+
+			/* an opaque replace in flat RAM is just a run of the color */
+			if (!PIXEL_OP_REQUIRES_SOURCE && !TRANSPARENCY && direct != nullptr)
+			{
+				std::fill_n(direct, full_words, uint16_t(COLOR1()));
+				direct += full_words;
 			}
 
 			/* loop over full words */
-			for (words = 0; words < full_words; words++)
+			else for (words = 0; words < full_words; words++)
 			{
 				/* fetch the destination word (if necessary) */
 				if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
-					dstword = (this->*word_read)(dwordaddr << 4);
+					dstword = direct ? *direct : (this->*word_read)(dwordaddr << 4);
 				else
 					dstword = 0;
 				dstmask = PIXEL_MASK;
@@ -1923,14 +2006,17 @@ void FUNCTION_NAME(tms340x0_device::fill)(int dst_is_linear)
 				}
 
 				/* write the result */
-				(this->*word_write)(dwordaddr++ << 4, dstword);
+				if (direct != nullptr)
+					*direct++ = dstword;
+				else
+					(this->*word_write)(dwordaddr++ << 4, dstword);
 			}
 
 			/* handle the right partial word */
 			if (right_partials != 0)
 			{
 				/* fetch the destination word */
-				dstword = (this->*word_read)(dwordaddr << 4);
+				dstword = direct ? *direct : (this->*word_read)(dwordaddr << 4);
 				dstmask = PIXEL_MASK;
 
 				/* loop over partials */
@@ -1947,7 +2033,10 @@ void FUNCTION_NAME(tms340x0_device::fill)(int dst_is_linear)
 				}
 
 				/* write the result */
-				(this->*word_write)(dwordaddr++ << 4, dstword);
+				if (direct != nullptr)
+					*direct++ = dstword;
+				else
+					(this->*word_write)(dwordaddr++ << 4, dstword);
 			}
 
 			/* update for next row */
@@ -846,6 +846,7 @@ protected:
 	void shiftreg_w(offs_t offset, uint16_t data);
 	uint16_t shiftreg_r(offs_t offset);
 	uint16_t dummy_shiftreg_r(offs_t offset);
+	uint8_t *direct_ptr(offs_t bitaddr, uint32_t bytes, bool write);
 	uint32_t pixel_op00(uint32_t dstpix, uint32_t mask, uint32_t srcpix);
 	uint32_t pixel_op01(uint32_t dstpix, uint32_t mask, uint32_t srcpix);
 	uint32_t pixel_op02(uint32_t dstpix, uint32_t mask, uint32_t srcpix);
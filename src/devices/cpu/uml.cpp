@@ -108,6 +108,7 @@ using namespace uml;
 #define PTYPES_IMV      (PTYPES_IMM | PTYPES_MVAR)
 #define PTYPES_IANY     (PTYPES_IRM | PTYPES_IMV)
 #define PTYPES_FANY     (PTYPES_FRM)
+#define PTYPES_VRM      (PTYPES_VREG | PTYPES_MEM)
 
 
 
@@ -215,6 +216,19 @@ opcode_info const instruction::s_opcode_info_table[OP_MAX] =
 	OPINFO2(FRSQRT,  "f#rsqrt",  4|8, false, NONE, NONE, ALL,  PINFO(OUT, OP, FRM), PINFO(IN, OP, FANY))
 	OPINFO2(FCOPYI,  "f#copyi",  4|8, false, NONE, NONE, NONE, PINFO(OUT, OP, FRM), PINFO(IN, OP, IRM))
 	OPINFO2(ICOPYF,  "icopyf#",  4|8, false, NONE, NONE, NONE, PINFO(OUT, OP, IRM), PINFO(IN, OP, FRM))
+
+	// Vector Operations
+	OPINFO2(VMOV,    "vmov",     16,  false, NONE, NONE, ALL,  PINFO(OUT, OP, VRM), PINFO(IN, OP, VRM))
+	OPINFO3(VADD,    "vadd",     16,  false, NONE, NONE, ALL,  PINFO(OUT, OP, VRM), PINFO(IN, OP, VRM), PINFO(IN, OP, VRM))
+	OPINFO3(VSUB,    "vsub",     16,  false, NONE, NONE, ALL,  PINFO(OUT, OP, VRM), PINFO(IN, OP, VRM), PINFO(IN, OP, VRM))
+	OPINFO3(VADDS,   "vadds",    16,  false, NONE, NONE, ALL,  PINFO(OUT, OP, VRM), PINFO(IN, OP, VRM), PINFO(IN, OP, VRM))
+	OPINFO3(VSUBS,   "vsubs",    16,  false, NONE, NONE, ALL,  PINFO(OUT, OP, VRM), PINFO(IN, OP, VRM), PINFO(IN, OP, VRM))
+	OPINFO3(VMULL,   "vmull",    16,  false, NONE, NONE, ALL,  PINFO(OUT, OP, VRM), PINFO(IN, OP, VRM), PINFO(IN, OP, VRM))
+	OPINFO3(VMULH,   "vmulh",    16,  false, NONE, NONE, ALL,  PINFO(OUT, OP, VRM), PINFO(IN, OP, VRM), PINFO(IN, OP, VRM))
+	OPINFO3(VMULHU,  "vmulhu",   16,  false, NONE, NONE, ALL,  PINFO(OUT, OP, VRM), PINFO(IN, OP, VRM), PINFO(IN, OP, VRM))
+	OPINFO3(VCMPEQ,  "vcmpeq",   16,  false, NONE, NONE, ALL,  PINFO(OUT, OP, VRM), PINFO(IN, OP, VRM), PINFO(IN, OP, VRM))
+	OPINFO3(VCMPLT,  "vcmplt",   16,  false, NONE, NONE, ALL,  PINFO(OUT, OP, VRM), PINFO(IN, OP, VRM), PINFO(IN, OP, VRM))
+	OPINFO4(VSEL,    "vsel",     16,  false, NONE, NONE, ALL,  PINFO(OUT, OP, VRM), PINFO(IN, OP, VRM), PINFO(IN, OP, VRM), PINFO(IN, OP, VRM))
 };
 
 
@@ -718,7 +732,7 @@ void uml::instruction::validate()
 
 	// validate raw information
 	assert(m_opcode != OP_INVALID && m_opcode < OP_MAX);
-	assert(m_size == 1 || m_size == 2 || m_size == 4 || m_size == 8);
+	assert(m_size == 1 || m_size == 2 || m_size == 4 || m_size == 8 || m_size == 16);
 
 	// validate against opcode limits
 	assert((opinfo.sizes & m_size) != 0);
@@ -804,6 +818,69 @@ u8 uml::instruction::modified_flags() const
 }
 
 
+//-------------------------------------------------
+//  param_is_input - return true if the given
+//  parameter is read by the instruction
+//-------------------------------------------------
+
+bool uml::instruction::param_is_input(int paramnum) const
+{
+	assert(paramnum < m_numparams);
+	return (s_opcode_info_table[m_opcode].param[paramnum].output & PIO_IN) != 0;
+}
+
+
+//-------------------------------------------------
+//  param_is_output - return true if the given
+//  parameter is written by the instruction
+//-------------------------------------------------
+
+bool uml::instruction::param_is_output(int paramnum) const
+{
+	assert(paramnum < m_numparams);
+	return (s_opcode_info_table[m_opcode].param[paramnum].output & PIO_OUT) != 0;
+}
+
+
+//-------------------------------------------------
+//  param_allows - return true if the given
+//  parameter may legally be of the given type
+//-------------------------------------------------
+
+bool uml::instruction::param_allows(int paramnum, parameter::parameter_type type) const
+{
+	assert(paramnum < m_numparams);
+	u16 const typemask = s_opcode_info_table[m_opcode].param[paramnum].typemask;
+
+	// pointers and machine state blocks are memory, but not arbitrary memory
+	if (typemask & (PTYPES_PTR | PTYPES_STATE) & ~PTYPES_MEM)
+		return false;
+	return (typemask & (1 << type)) != 0;
+}
+
+
+//-------------------------------------------------
+//  param_size - return the size in bytes of the
+//  given parameter
+//-------------------------------------------------
+
+u8 uml::instruction::param_size(int paramnum) const
+{
+	assert(paramnum < m_numparams);
+	switch (s_opcode_info_table[m_opcode].param[paramnum].size)
+	{
+		case PSIZE_4:   return 4;
+		case PSIZE_8:   return 8;
+		case PSIZE_P1:  return 1 << m_param[0].size();
+		case PSIZE_P2:  return 1 << m_param[1].size();
+		case PSIZE_P3:  return 1 << m_param[2].size();
+		case PSIZE_P4:  return 1 << m_param[3].size();
+		default:
+		case PSIZE_OP:  return m_size;
+	}
+}
+
+
 //-------------------------------------------------
 //  disasm - disassemble an instruction to the
 //  given buffer
@@ -911,6 +988,11 @@ std::string uml::instruction::disasm(drcuml_state *drcuml) const
 			util::stream_format(buffer, "f%d", param.freg() - REG_F0);
 			break;
 
+		// vector registers
+		case parameter::PTYPE_VECTOR_REGISTER:
+			util::stream_format(buffer, "v%d", param.vreg() - REG_V0);
+			break;
+
 		// map variables
 		case parameter::PTYPE_MAPVAR:
 			util::stream_format(buffer, "m%d", param.mapvar() - MAPVAR_M0);
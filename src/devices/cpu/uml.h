@@ -22,6 +22,9 @@
 // opaque structure describing UML generation state
 class drcuml_state;
 
+// on-disk store of translated blocks
+class drc_persistent_cache;
+
 struct drcuml_machine_state;
 
 
@@ -221,6 +224,19 @@ namespace uml
 		OP_FCOPYI,                  // FCOPYI  dst,src
 		OP_ICOPYF,                  // ICOPYF  dst,src
 
+		// vector operations on eight 16-bit lanes
+		OP_VMOV,                    // VMOV    dst,src
+		OP_VADD,                    // VADD    dst,src1,src2
+		OP_VSUB,                    // VSUB    dst,src1,src2
+		OP_VADDS,                   // VADDS   dst,src1,src2
+		OP_VSUBS,                   // VSUBS   dst,src1,src2
+		OP_VMULL,                   // VMULL   dst,src1,src2
+		OP_VMULH,                   // VMULH   dst,src1,src2
+		OP_VMULHU,                  // VMULHU  dst,src1,src2
+		OP_VCMPEQ,                  // VCMPEQ  dst,src1,src2
+		OP_VCMPLT,                  // VCMPLT  dst,src1,src2
+		OP_VSEL,                    // VSEL    dst,mask,src1,src2
+
 		OP_MAX
 	};
 
@@ -359,6 +375,9 @@ namespace uml
 		constexpr bool is_immediate_value(u64 value) const { return (m_type == PTYPE_IMMEDIATE) && (m_value == value); }
 
 	private:
+		// the persistent cache serializes raw parameter values
+		friend class ::drc_persistent_cache;
+
 		// private constructor
 		constexpr parameter(parameter_type type, parameter_value value) : m_type(type), m_value(value) { }
 
@@ -405,12 +424,17 @@ namespace uml
 		// setters
 		void set_flags(u8 flags) { m_flags = flags; }
 		void set_mapvar(int paramnum, u32 value) { assert(paramnum < m_numparams); assert(m_param[paramnum].is_mapvar()); m_param[paramnum] = value; }
+		void set_param(int paramnum, parameter const &param) { assert(paramnum < m_numparams); m_param[paramnum] = param; }
 
 		// misc
 		std::string disasm(drcuml_state *drcuml = nullptr) const;
 		u8 input_flags() const;
 		u8 output_flags() const;
 		u8 modified_flags() const;
+		bool param_is_input(int paramnum) const;
+		bool param_is_output(int paramnum) const;
+		bool param_allows(int paramnum, parameter::parameter_type type) const;
+		u8 param_size(int paramnum) const;
 		void simplify();
 
 		// compile-time opcodes
@@ -571,10 +595,26 @@ namespace uml
 		void fdcopyi(parameter dst, parameter src) { configure(OP_FCOPYI, 8, dst, src); }
 		void icopyfd(parameter dst, parameter src) { configure(OP_ICOPYF, 8, dst, src); }
 
+		// 128-bit vector operations on eight 16-bit lanes
+		void vmov(parameter dst, parameter src) { configure(OP_VMOV, 16, dst, src); }
+		void vadd(parameter dst, parameter src1, parameter src2) { configure(OP_VADD, 16, dst, src1, src2); }
+		void vsub(parameter dst, parameter src1, parameter src2) { configure(OP_VSUB, 16, dst, src1, src2); }
+		void vadds(parameter dst, parameter src1, parameter src2) { configure(OP_VADDS, 16, dst, src1, src2); }
+		void vsubs(parameter dst, parameter src1, parameter src2) { configure(OP_VSUBS, 16, dst, src1, src2); }
+		void vmull(parameter dst, parameter src1, parameter src2) { configure(OP_VMULL, 16, dst, src1, src2); }
+		void vmulh(parameter dst, parameter src1, parameter src2) { configure(OP_VMULH, 16, dst, src1, src2); }
+		void vmulhu(parameter dst, parameter src1, parameter src2) { configure(OP_VMULHU, 16, dst, src1, src2); }
+		void vcmpeq(parameter dst, parameter src1, parameter src2) { configure(OP_VCMPEQ, 16, dst, src1, src2); }
+		void vcmplt(parameter dst, parameter src1, parameter src2) { configure(OP_VCMPLT, 16, dst, src1, src2); }
+		void vsel(parameter dst, parameter mask, parameter src1, parameter src2) { configure(OP_VSEL, 16, dst, mask, src1, src2); }
+
 		// constants
 		static constexpr int MAX_PARAMS = 4;
 
 	private:
+		// the persistent cache rebuilds instructions directly
+		friend class ::drc_persistent_cache;
+
 		// internal configuration
 		void configure(opcode_t op, u8 size, condition_t cond = COND_ALWAYS);
 		void configure(opcode_t op, u8 size, parameter p0, condition_t cond = COND_ALWAYS);
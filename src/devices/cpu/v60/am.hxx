@@ -13,6 +13,75 @@
 #include "am2.hxx" // ReadAMAddress
 #include "am3.hxx" // WriteAM
 
+/*
+  Decode cache
+
+  Walking the group tables and fetching the specifier bytes costs several
+  indirect calls per operand.  Specifiers that live in ROM are kept with
+  their bytes and the final addressing mode function, so a hit sets
+  m_modval/m_modval2 and calls that function directly; the AmRead macros
+  then take the displacements from the entry.  Nothing executed from RAM
+  is kept, so writes cannot leave an entry stale; remapping the space
+  flushes everything, and banked code must call flush_decode_cache().
+*/
+
+void v60_device::flush_decode_cache()
+{
+	for (unsigned i = 0; i < (1 << AM_CACHE_BITS); i++)
+		m_am_cache[i].key = 0;
+}
+
+v60_device::am_func v60_device::ResolveAM(const am_func (&table)[2][8], const am_func (&g6)[8], const am_func (&g7)[32], const am_func (&g7a)[16]) const
+{
+	// same walk as the GroupN functions; malformed group 7a is left to them
+	if (!m_modm)
+		return ((m_modval >> 5) == 7) ? g7[m_modval & 0x1F] : table[0][m_modval >> 5];
+	if ((m_modval >> 5) != 6)
+		return table[1][m_modval >> 5];
+	if ((m_modval2 >> 5) != 7)
+		return g6[m_modval2 >> 5];
+	return (m_modval2 & 0x10) ? g7a[m_modval2 & 0xF] : g6[7];
+}
+
+uint32_t v60_device::DecodeAM(unsigned decoder, const am_func (&table)[2][8], const am_func (&g6)[8], const am_func (&g7)[32], const am_func (&g7a)[16])
+{
+	m_modm = m_modm?1:0;
+
+	const uint16_t key = 0x8000 | (decoder << 8) | (m_modm << 7) | m_moddim;
+	am_cache_entry &entry = m_am_cache[(m_modadd ^ (m_modadd >> AM_CACHE_BITS)) & ((1 << AM_CACHE_BITS) - 1)];
+	const bool match = (entry.addr == m_modadd) && (entry.key == key);
+	if (match && entry.length)
+	{
+		m_modval = entry.data[0];
+		m_modval2 = entry.data[1];
+		m_am_bytes = entry.data;
+		const uint32_t length = (this->*entry.handler)();
+		m_am_bytes = nullptr;
+		return length;
+	}
+
+	m_modval = OpRead8(m_modadd);
+	const uint32_t length = (this->*table[m_modm][m_modval >> 5])();
+	if (match)
+		return length;
+
+	// only specifiers wholly in ROM are worth keeping
+	const offs_t last = m_modadd + length - 1;
+	entry.addr = m_modadd;
+	entry.key = key;
+	entry.length = 0;
+	if (length <= sizeof(entry.data) &&
+		m_program->get_read_ptr(m_modadd) && !m_program->get_write_ptr(m_modadd) &&
+		m_program->get_read_ptr(last) && !m_program->get_write_ptr(last))
+	{
+		for (uint32_t i = 0; i < length; i++)
+			entry.data[i] = OpRead8(m_modadd + i);
+		entry.length = length;
+		entry.handler = ResolveAM(table, g6, g7, g7a);
+	}
+	return length;
+}
+
 /*
   Input:
   m_modadd
@@ -25,16 +94,12 @@
 
 uint32_t v60_device::ReadAM()
 {
-	m_modm = m_modm?1:0;
-	m_modval = OpRead8(m_modadd);
-	return (this->*s_AMTable1[m_modm][m_modval >> 5])();
+	return DecodeAM(0, s_AMTable1, s_AMTable1_G6, s_AMTable1_G7, s_AMTable1_G7a);
 }
 
 uint32_t v60_device::BitReadAM()
 {
-	m_modm = m_modm?1:0;
-	m_modval = OpRead8(m_modadd);
-	return (this->*s_BAMTable1[m_modm][m_modval >> 5])();
+	return DecodeAM(1, s_BAMTable1, s_BAMTable1_G6, s_BAMTable1_G7, s_BAMTable1_G7a);
 }
 
 
@@ -52,16 +117,12 @@ uint32_t v60_device::BitReadAM()
 
 uint32_t v60_device::ReadAMAddress()
 {
-	m_modm = m_modm?1:0;
-	m_modval = OpRead8(m_modadd);
-	return (this->*s_AMTable2[m_modm][m_modval >> 5])();
+	return DecodeAM(2, s_AMTable2, s_AMTable2_G6, s_AMTable2_G7, s_AMTable2_G7a);
 }
 
 uint32_t v60_device::BitReadAMAddress()
 {
-	m_modm = m_modm?1:0;
-	m_modval = OpRead8(m_modadd);
-	return (this->*s_BAMTable2[m_modm][m_modval >> 5])();
+	return DecodeAM(3, s_BAMTable2, s_BAMTable2_G6, s_BAMTable2_G7, s_BAMTable2_G7a);
 }
 
 /*
@@ -77,7 +138,5 @@ uint32_t v60_device::BitReadAMAddress()
 
 uint32_t v60_device::WriteAM()
 {
-	m_modm = m_modm?1:0;
-	m_modval = OpRead8(m_modadd);
-	return (this->*s_AMTable3[m_modm][m_modval >> 5])();
+	return DecodeAM(4, s_AMTable3, s_AMTable3_G6, s_AMTable3_G7, s_AMTable3_G7a);
 }
@@ -157,13 +157,13 @@ uint32_t v60_device::am1Displacement8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1));
+		m_amout = m_program->read_byte(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1));
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1));
+		m_amout = m_program->read_word_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1));
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1));
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1));
 		break;
 	}
 
@@ -184,13 +184,13 @@ uint32_t v60_device::am1Displacement16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1));
+		m_amout = m_program->read_byte(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1));
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1));
+		m_amout = m_program->read_word_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1));
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1));
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1));
 		break;
 	}
 
@@ -199,7 +199,7 @@ uint32_t v60_device::am1Displacement16()
 
 uint32_t v60_device::bam1Displacement16()
 {
-	m_bamoffset = OpRead16(m_modadd + 1);
+	m_bamoffset = AmRead16(1);
 	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 3;
@@ -210,13 +210,13 @@ uint32_t v60_device::am1Displacement32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1));
+		m_amout = m_program->read_byte(m_reg[m_modval & 0x1F] + AmRead32(1));
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1));
+		m_amout = m_program->read_word_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1));
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1));
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1));
 		break;
 	}
 
@@ -225,7 +225,7 @@ uint32_t v60_device::am1Displacement32()
 
 uint32_t v60_device::bam1Displacement32()
 {
-	m_bamoffset = OpRead32(m_modadd + 1);
+	m_bamoffset = AmRead32(1);
 	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 5;
@@ -236,13 +236,13 @@ uint32_t v60_device::am1DisplacementIndexed8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F]);
+		m_amout = m_program->read_byte(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F]);
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2);
+		m_amout = m_program->read_word_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F] * 2);
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4);
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F] * 4);
 		break;
 	}
 
@@ -252,7 +252,7 @@ uint32_t v60_device::am1DisplacementIndexed8()
 uint32_t v60_device::bam1DisplacementIndexed8()
 {
 	m_bamoffset = m_reg[m_modval & 0x1F];
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2) + m_bamoffset / 8);
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 3;
 }
@@ -262,13 +262,13 @@ uint32_t v60_device::am1DisplacementIndexed16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F]);
+		m_amout = m_program->read_byte(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F]);
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2);
+		m_amout = m_program->read_word_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F] * 2);
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4);
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F] * 4);
 		break;
 	}
 
@@ -278,7 +278,7 @@ uint32_t v60_device::am1DisplacementIndexed16()
 uint32_t v60_device::bam1DisplacementIndexed16()
 {
 	m_bamoffset = m_reg[m_modval & 0x1F];
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2) + m_bamoffset / 8);
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 4;
 }
@@ -288,13 +288,13 @@ uint32_t v60_device::am1DisplacementIndexed32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F]);
+		m_amout = m_program->read_byte(m_reg[m_modval2 & 0x1F] + AmRead32(2) + m_reg[m_modval & 0x1F]);
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2);
+		m_amout = m_program->read_word_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2) + m_reg[m_modval & 0x1F] * 2);
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4);
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2) + m_reg[m_modval & 0x1F] * 4);
 		break;
 	}
 
@@ -304,7 +304,7 @@ uint32_t v60_device::am1DisplacementIndexed32()
 uint32_t v60_device::bam1DisplacementIndexed32()
 {
 	m_bamoffset = m_reg[m_modval & 0x1F];
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2) + m_bamoffset / 8);
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 6;
 }
@@ -315,13 +315,13 @@ uint32_t v60_device::am1PCDisplacement8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(PC + (int8_t)OpRead8(m_modadd + 1));
+		m_amout = m_program->read_byte(PC + (int8_t)AmRead8(1));
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(PC + (int8_t)OpRead8(m_modadd + 1));
+		m_amout = m_program->read_word_unaligned(PC + (int8_t)AmRead8(1));
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1));
+		m_amout = m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1));
 		break;
 	}
 
@@ -330,7 +330,7 @@ uint32_t v60_device::am1PCDisplacement8()
 
 uint32_t v60_device::bam1PCDisplacement8()
 {
-	m_bamoffset = OpRead8(m_modadd + 1);
+	m_bamoffset = AmRead8(1);
 	m_amout = m_program->read_dword_unaligned(PC + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 2;
@@ -341,13 +341,13 @@ uint32_t v60_device::am1PCDisplacement16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(PC + (int16_t)OpRead16(m_modadd + 1));
+		m_amout = m_program->read_byte(PC + (int16_t)AmRead16(1));
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(PC + (int16_t)OpRead16(m_modadd + 1));
+		m_amout = m_program->read_word_unaligned(PC + (int16_t)AmRead16(1));
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1));
+		m_amout = m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1));
 		break;
 	}
 
@@ -356,7 +356,7 @@ uint32_t v60_device::am1PCDisplacement16()
 
 uint32_t v60_device::bam1PCDisplacement16()
 {
-	m_bamoffset = OpRead16(m_modadd + 1);
+	m_bamoffset = AmRead16(1);
 	m_amout = m_program->read_dword_unaligned(PC + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 3;
@@ -367,13 +367,13 @@ uint32_t v60_device::am1PCDisplacement32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(PC + OpRead32(m_modadd + 1));
+		m_amout = m_program->read_byte(PC + AmRead32(1));
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(PC + OpRead32(m_modadd + 1));
+		m_amout = m_program->read_word_unaligned(PC + AmRead32(1));
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1));
+		m_amout = m_program->read_dword_unaligned(PC + AmRead32(1));
 		break;
 	}
 
@@ -382,7 +382,7 @@ uint32_t v60_device::am1PCDisplacement32()
 
 uint32_t v60_device::bam1PCDisplacement32()
 {
-	m_bamoffset = OpRead32(m_modadd + 1);
+	m_bamoffset = AmRead32(1);
 	m_amout = m_program->read_dword_unaligned(PC + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 5;
@@ -393,13 +393,13 @@ uint32_t v60_device::am1PCDisplacementIndexed8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(PC + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F]);
+		m_amout = m_program->read_byte(PC + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F]);
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(PC + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2);
+		m_amout = m_program->read_word_unaligned(PC + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F] * 2);
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4);
+		m_amout = m_program->read_dword_unaligned(PC + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F] * 4);
 		break;
 	}
 
@@ -409,7 +409,7 @@ uint32_t v60_device::am1PCDisplacementIndexed8()
 uint32_t v60_device::bam1PCDisplacementIndexed8()
 {
 	m_bamoffset = m_reg[m_modval & 0x1F];
-	m_amout = m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 2) + m_bamoffset / 8);
+	m_amout = m_program->read_dword_unaligned(PC + (int8_t)AmRead8(2) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 3;
 }
@@ -420,13 +420,13 @@ uint32_t v60_device::am1PCDisplacementIndexed16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(PC + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F]);
+		m_amout = m_program->read_byte(PC + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F]);
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(PC + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2);
+		m_amout = m_program->read_word_unaligned(PC + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F] * 2);
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4);
+		m_amout = m_program->read_dword_unaligned(PC + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F] * 4);
 		break;
 	}
 
@@ -436,7 +436,7 @@ uint32_t v60_device::am1PCDisplacementIndexed16()
 uint32_t v60_device::bam1PCDisplacementIndexed16()
 {
 	m_bamoffset = m_reg[m_modval & 0x1F];
-	m_amout = m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 2) + m_bamoffset / 8);
+	m_amout = m_program->read_dword_unaligned(PC + (int16_t)AmRead16(2) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 4;
 }
@@ -446,13 +446,13 @@ uint32_t v60_device::am1PCDisplacementIndexed32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(PC + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F]);
+		m_amout = m_program->read_byte(PC + AmRead32(2) + m_reg[m_modval & 0x1F]);
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(PC + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2);
+		m_amout = m_program->read_word_unaligned(PC + AmRead32(2) + m_reg[m_modval & 0x1F] * 2);
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4);
+		m_amout = m_program->read_dword_unaligned(PC + AmRead32(2) + m_reg[m_modval & 0x1F] * 4);
 		break;
 	}
 
@@ -462,7 +462,7 @@ uint32_t v60_device::am1PCDisplacementIndexed32()
 uint32_t v60_device::bam1PCDisplacementIndexed32()
 {
 	m_bamoffset = m_reg[m_modval & 0x1F];
-	m_amout = m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 2) + m_bamoffset / 8);
+	m_amout = m_program->read_dword_unaligned(PC + AmRead32(2) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 6;
 }
@@ -472,13 +472,13 @@ uint32_t v60_device::am1DisplacementIndirect8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1)));
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1)));
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1)));
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1)));
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1)));
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1)));
 		break;
 	}
 
@@ -488,7 +488,7 @@ uint32_t v60_device::am1DisplacementIndirect8()
 uint32_t v60_device::bam1DisplacementIndirect8()
 {
 	m_bamoffset = 0;
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1)));
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1)));
 	return 2;
 }
 
@@ -497,13 +497,13 @@ uint32_t v60_device::am1DisplacementIndirect16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1)));
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1)));
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1)));
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1)));
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1)));
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1)));
 		break;
 	}
 
@@ -513,7 +513,7 @@ uint32_t v60_device::am1DisplacementIndirect16()
 uint32_t v60_device::bam1DisplacementIndirect16()
 {
 	m_bamoffset = 0;
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1)));
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1)));
 	return 3;
 }
 
@@ -522,13 +522,13 @@ uint32_t v60_device::am1DisplacementIndirect32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1)));
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1)));
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1)));
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1)));
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1)));
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1)));
 		break;
 	}
 
@@ -538,7 +538,7 @@ uint32_t v60_device::am1DisplacementIndirect32()
 uint32_t v60_device::bam1DisplacementIndirect32()
 {
 	m_bamoffset = 0;
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1)));
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1)));
 	return 5;
 }
 
@@ -547,13 +547,13 @@ uint32_t v60_device::am1DisplacementIndirectIndexed8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F]);
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F]);
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2);
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F] * 2);
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4);
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F] * 4);
 		break;
 	}
 
@@ -563,7 +563,7 @@ uint32_t v60_device::am1DisplacementIndirectIndexed8()
 uint32_t v60_device::bam1DisplacementIndirectIndexed8()
 {
 	m_bamoffset = m_reg[m_modval & 0x1F];
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2)) + m_bamoffset / 8);
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2)) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 3;
 }
@@ -573,13 +573,13 @@ uint32_t v60_device::am1DisplacementIndirectIndexed16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F]);
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F]);
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2);
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F] * 2);
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4);
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F] * 4);
 		break;
 	}
 
@@ -589,7 +589,7 @@ uint32_t v60_device::am1DisplacementIndirectIndexed16()
 uint32_t v60_device::bam1DisplacementIndirectIndexed16()
 {
 	m_bamoffset = m_reg[m_modval & 0x1F];
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2)) + m_bamoffset / 8);
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2)) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 4;
 }
@@ -599,13 +599,13 @@ uint32_t v60_device::am1DisplacementIndirectIndexed32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F]);
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2)) + m_reg[m_modval & 0x1F]);
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2);
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2)) + m_reg[m_modval & 0x1F] * 2);
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4);
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2)) + m_reg[m_modval & 0x1F] * 4);
 		break;
 	}
 
@@ -615,7 +615,7 @@ uint32_t v60_device::am1DisplacementIndirectIndexed32()
 uint32_t v60_device::bam1DisplacementIndirectIndexed32()
 {
 	m_bamoffset = m_reg[m_modval & 0x1F];
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2)) + m_bamoffset / 8);
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2)) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 6;
 }
@@ -625,13 +625,13 @@ uint32_t v60_device::am1PCDisplacementIndirect8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1)));
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1)));
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1)));
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1)));
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1)));
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1)));
 		break;
 	}
 
@@ -641,7 +641,7 @@ uint32_t v60_device::am1PCDisplacementIndirect8()
 uint32_t v60_device::bam1PCDisplacementIndirect8()
 {
 	m_bamoffset = 0;
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1)));
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1)));
 	return 2;
 }
 
@@ -650,13 +650,13 @@ uint32_t v60_device::am1PCDisplacementIndirect16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1)));
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1)));
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1)));
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1)));
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1)));
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1)));
 		break;
 	}
 
@@ -666,7 +666,7 @@ uint32_t v60_device::am1PCDisplacementIndirect16()
 uint32_t v60_device::bam1PCDisplacementIndirect16()
 {
 	m_bamoffset = 0;
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1)));
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1)));
 	return 3;
 }
 
@@ -675,13 +675,13 @@ uint32_t v60_device::am1PCDisplacementIndirect32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1)));
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + AmRead32(1)));
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1)));
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + AmRead32(1)));
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1)));
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + AmRead32(1)));
 		break;
 	}
 
@@ -691,7 +691,7 @@ uint32_t v60_device::am1PCDisplacementIndirect32()
 uint32_t v60_device::bam1PCDisplacementIndirect32()
 {
 	m_bamoffset = 0;
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1)));
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + AmRead32(1)));
 	return 5;
 }
 
@@ -700,13 +700,13 @@ uint32_t v60_device::am1PCDisplacementIndirectIndexed8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F]);
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F]);
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2);
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F] * 2);
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4);
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F] * 4);
 		break;
 	}
 
@@ -716,7 +716,7 @@ uint32_t v60_device::am1PCDisplacementIndirectIndexed8()
 uint32_t v60_device::bam1PCDisplacementIndirectIndexed8()
 {
 	m_bamoffset = m_reg[m_modval & 0x1F];
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 2)) + m_bamoffset / 8);
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(2)) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 3;
 }
@@ -726,13 +726,13 @@ uint32_t v60_device::am1PCDisplacementIndirectIndexed16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F]);
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F]);
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2);
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F] * 2);
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4);
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F] * 4);
 		break;
 	}
 
@@ -742,7 +742,7 @@ uint32_t v60_device::am1PCDisplacementIndirectIndexed16()
 uint32_t v60_device::bam1PCDisplacementIndirectIndexed16()
 {
 	m_bamoffset = m_reg[m_modval & 0x1F];
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 2)) + m_bamoffset / 8);
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(2)) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 4;
 }
@@ -752,13 +752,13 @@ uint32_t v60_device::am1PCDisplacementIndirectIndexed32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F]);
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + AmRead32(2)) + m_reg[m_modval & 0x1F]);
 		break;
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2);
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + AmRead32(2)) + m_reg[m_modval & 0x1F] * 2);
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4);
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + AmRead32(2)) + m_reg[m_modval & 0x1F] * 4);
 		break;
 	}
 
@@ -768,7 +768,7 @@ uint32_t v60_device::am1PCDisplacementIndirectIndexed32()
 uint32_t v60_device::bam1PCDisplacementIndirectIndexed32()
 {
 	m_bamoffset = m_reg[m_modval & 0x1F];
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 2)) + m_bamoffset / 8);
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + AmRead32(2)) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 6;
 }
@@ -778,15 +778,15 @@ uint32_t v60_device::am1DoubleDisplacement8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1)) + (int8_t)OpRead8(m_modadd + 2));
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1)) + (int8_t)AmRead8(2));
 		break;
 
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1)) + (int8_t)OpRead8(m_modadd + 2));
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1)) + (int8_t)AmRead8(2));
 		break;
 
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1)) + (int8_t)OpRead8(m_modadd + 2));
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1)) + (int8_t)AmRead8(2));
 		break;
 	}
 
@@ -795,8 +795,8 @@ uint32_t v60_device::am1DoubleDisplacement8()
 
 uint32_t v60_device::bam1DoubleDisplacement8()
 {
-	m_bamoffset = OpRead8(m_modadd + 2);
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1)) + m_bamoffset / 8);
+	m_bamoffset = AmRead8(2);
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1)) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 3;
 }
@@ -806,15 +806,15 @@ uint32_t v60_device::am1DoubleDisplacement16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1)) + (int16_t)OpRead16(m_modadd + 3));
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1)) + (int16_t)AmRead16(3));
 		break;
 
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1)) + (int16_t)OpRead16(m_modadd + 3));
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1)) + (int16_t)AmRead16(3));
 		break;
 
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1)) + (int16_t)OpRead16(m_modadd + 3));
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1)) + (int16_t)AmRead16(3));
 		break;
 	}
 
@@ -823,8 +823,8 @@ uint32_t v60_device::am1DoubleDisplacement16()
 
 uint32_t v60_device::bam1DoubleDisplacement16()
 {
-	m_bamoffset = OpRead16(m_modadd + 3);
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1)) + m_bamoffset / 8);
+	m_bamoffset = AmRead16(3);
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1)) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 5;
 }
@@ -834,15 +834,15 @@ uint32_t v60_device::am1DoubleDisplacement32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1)) + OpRead32(m_modadd + 5));
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1)) + AmRead32(5));
 		break;
 
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1)) + OpRead32(m_modadd + 5));
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1)) + AmRead32(5));
 		break;
 
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1)) + OpRead32(m_modadd + 5));
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1)) + AmRead32(5));
 		break;
 	}
 
@@ -851,8 +851,8 @@ uint32_t v60_device::am1DoubleDisplacement32()
 
 uint32_t v60_device::bam1DoubleDisplacement32()
 {
-	m_bamoffset = OpRead32(m_modadd + 5);
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1)) + m_bamoffset / 8);
+	m_bamoffset = AmRead32(5);
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1)) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 9;
 }
@@ -862,15 +862,15 @@ uint32_t v60_device::am1PCDoubleDisplacement8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1)) + (int8_t)OpRead8(m_modadd + 2));
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1)) + (int8_t)AmRead8(2));
 		break;
 
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1)) + (int8_t)OpRead8(m_modadd + 2));
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1)) + (int8_t)AmRead8(2));
 		break;
 
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1)) + (int8_t)OpRead8(m_modadd + 2));
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1)) + (int8_t)AmRead8(2));
 		break;
 	}
 
@@ -879,8 +879,8 @@ uint32_t v60_device::am1PCDoubleDisplacement8()
 
 uint32_t v60_device::bam1PCDoubleDisplacement8()
 {
-	m_bamoffset = OpRead8(m_modadd + 2);
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1)) + m_bamoffset / 8);
+	m_bamoffset = AmRead8(2);
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1)) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 3;
 }
@@ -890,15 +890,15 @@ uint32_t v60_device::am1PCDoubleDisplacement16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1)) + (int16_t)OpRead16(m_modadd + 3));
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1)) + (int16_t)AmRead16(3));
 		break;
 
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1)) + (int16_t)OpRead16(m_modadd + 3));
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1)) + (int16_t)AmRead16(3));
 		break;
 
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1)) + (int16_t)OpRead16(m_modadd + 3));
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1)) + (int16_t)AmRead16(3));
 		break;
 	}
 
@@ -907,8 +907,8 @@ uint32_t v60_device::am1PCDoubleDisplacement16()
 
 uint32_t v60_device::bam1PCDoubleDisplacement16()
 {
-	m_bamoffset = OpRead16(m_modadd + 3);
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1)) + m_bamoffset / 8);
+	m_bamoffset = AmRead16(3);
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1)) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 5;
 }
@@ -919,15 +919,15 @@ uint32_t v60_device::am1PCDoubleDisplacement32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1)) + OpRead32(m_modadd + 5));
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(PC + AmRead32(1)) + AmRead32(5));
 		break;
 
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1)) + OpRead32(m_modadd + 5));
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(PC + AmRead32(1)) + AmRead32(5));
 		break;
 
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1)) + OpRead32(m_modadd + 5));
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + AmRead32(1)) + AmRead32(5));
 		break;
 	}
 
@@ -936,8 +936,8 @@ uint32_t v60_device::am1PCDoubleDisplacement32()
 
 uint32_t v60_device::bam1PCDoubleDisplacement32()
 {
-	m_bamoffset = OpRead32(m_modadd + 5);
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1)) + m_bamoffset / 8);
+	m_bamoffset = AmRead32(5);
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(PC + AmRead32(1)) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 9;
 }
@@ -947,15 +947,15 @@ uint32_t v60_device::am1DirectAddress()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(OpRead32(m_modadd + 1));
+		m_amout = m_program->read_byte(AmRead32(1));
 		break;
 
 	case 1:
-		m_amout = m_program->read_word_unaligned(OpRead32(m_modadd + 1));
+		m_amout = m_program->read_word_unaligned(AmRead32(1));
 		break;
 
 	case 2:
-		m_amout = m_program->read_dword_unaligned(OpRead32(m_modadd + 1));
+		m_amout = m_program->read_dword_unaligned(AmRead32(1));
 		break;
 	}
 
@@ -965,7 +965,7 @@ uint32_t v60_device::am1DirectAddress()
 uint32_t v60_device::bam1DirectAddress()
 {
 	m_bamoffset = 0;
-	m_amout = m_program->read_dword_unaligned(OpRead32(m_modadd + 1));
+	m_amout = m_program->read_dword_unaligned(AmRead32(1));
 	return 5;
 }
 
@@ -974,15 +974,15 @@ uint32_t v60_device::am1DirectAddressIndexed()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F]);
+		m_amout = m_program->read_byte(AmRead32(2) + m_reg[m_modval & 0x1F]);
 		break;
 
 	case 1:
-		m_amout = m_program->read_word_unaligned(OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2);
+		m_amout = m_program->read_word_unaligned(AmRead32(2) + m_reg[m_modval & 0x1F] * 2);
 		break;
 
 	case 2:
-		m_amout = m_program->read_dword_unaligned(OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4);
+		m_amout = m_program->read_dword_unaligned(AmRead32(2) + m_reg[m_modval & 0x1F] * 4);
 		break;
 	}
 
@@ -992,7 +992,7 @@ uint32_t v60_device::am1DirectAddressIndexed()
 uint32_t v60_device::bam1DirectAddressIndexed()
 {
 	m_bamoffset = m_reg[m_modval & 0x1F];
-	m_amout = m_program->read_dword_unaligned(OpRead32(m_modadd + 2) + m_bamoffset / 8);
+	m_amout = m_program->read_dword_unaligned(AmRead32(2) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 6;
 }
@@ -1002,15 +1002,15 @@ uint32_t v60_device::am1DirectAddressDeferred()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(OpRead32(m_modadd + 1)));
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(AmRead32(1)));
 		break;
 
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(OpRead32(m_modadd + 1)));
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(AmRead32(1)));
 		break;
 
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(OpRead32(m_modadd + 1)));
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(AmRead32(1)));
 		break;
 	}
 
@@ -1020,7 +1020,7 @@ uint32_t v60_device::am1DirectAddressDeferred()
 uint32_t v60_device::bam1DirectAddressDeferred()
 {
 	m_bamoffset = 0;
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(OpRead32(m_modadd + 1)));
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(AmRead32(1)));
 	return 5;
 }
 
@@ -1029,15 +1029,15 @@ uint32_t v60_device::am1DirectAddressDeferredIndexed()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_byte(m_program->read_dword_unaligned(OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F]);
+		m_amout = m_program->read_byte(m_program->read_dword_unaligned(AmRead32(2)) + m_reg[m_modval & 0x1F]);
 		break;
 
 	case 1:
-		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2);
+		m_amout = m_program->read_word_unaligned(m_program->read_dword_unaligned(AmRead32(2)) + m_reg[m_modval & 0x1F] * 2);
 		break;
 
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4);
+		m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(AmRead32(2)) + m_reg[m_modval & 0x1F] * 4);
 		break;
 	}
 
@@ -1047,7 +1047,7 @@ uint32_t v60_device::am1DirectAddressDeferredIndexed()
 uint32_t v60_device::bam1DirectAddressDeferredIndexed()
 {
 	m_bamoffset = m_reg[m_modval & 0x1F];
-	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(OpRead32(m_modadd + 2)) + m_bamoffset / 8);
+	m_amout = m_program->read_dword_unaligned(m_program->read_dword_unaligned(AmRead32(2)) + m_bamoffset / 8);
 	m_bamoffset&=7;
 	return 6;
 }
@@ -1057,15 +1057,15 @@ uint32_t v60_device::am1Immediate()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = OpRead8(m_modadd + 1);
+		m_amout = AmRead8(1);
 		return 2;
 
 	case 1:
-		m_amout = OpRead16(m_modadd + 1);
+		m_amout = AmRead16(1);
 		return 3;
 
 	case 2:
-		m_amout = OpRead32(m_modadd + 1);
+		m_amout = AmRead32(1);
 		return 5;
 	}
 
@@ -1299,13 +1299,13 @@ const v60_device::am_func v60_device::s_BAMTable1_G6[8] =
 
 uint32_t v60_device::am1Group6()
 {
-	m_modval2 = OpRead8(m_modadd + 1);
+	m_modval2 = AmRead8(1);
 	return (this->*s_AMTable1_G6[m_modval2 >> 5])();
 }
 
 uint32_t v60_device::bam1Group6()
 {
-	m_modval2 = OpRead8(m_modadd + 1);
+	m_modval2 = AmRead8(1);
 	return (this->*s_BAMTable1_G6[m_modval2 >> 5])();
 }
 
@@ -152,7 +152,7 @@ uint32_t v60_device::bam2Autodecrement()
 uint32_t v60_device::am2Displacement8()
 {
 	m_amflag = 0;
-	m_amout = m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1);
+	m_amout = m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1);
 
 	return 2;
 }
@@ -161,7 +161,7 @@ uint32_t v60_device::bam2Displacement8()
 {
 	m_amflag = 0;
 	m_amout = m_reg[m_modval & 0x1F];
-	m_bamoffset = (int8_t)OpRead8(m_modadd + 1);
+	m_bamoffset = (int8_t)AmRead8(1);
 
 	return 2;
 }
@@ -169,7 +169,7 @@ uint32_t v60_device::bam2Displacement8()
 uint32_t v60_device::am2Displacement16()
 {
 	m_amflag = 0;
-	m_amout = m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1);
+	m_amout = m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1);
 
 	return 3;
 }
@@ -178,7 +178,7 @@ uint32_t v60_device::bam2Displacement16()
 {
 	m_amflag = 0;
 	m_amout = m_reg[m_modval & 0x1F];
-	m_bamoffset = (int16_t)OpRead16(m_modadd + 1);
+	m_bamoffset = (int16_t)AmRead16(1);
 
 	return 3;
 }
@@ -186,7 +186,7 @@ uint32_t v60_device::bam2Displacement16()
 uint32_t v60_device::am2Displacement32()
 {
 	m_amflag = 0;
-	m_amout = m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1);
+	m_amout = m_reg[m_modval & 0x1F] + AmRead32(1);
 
 	return 5;
 }
@@ -195,7 +195,7 @@ uint32_t v60_device::bam2Displacement32()
 {
 	m_amflag = 0;
 	m_amout = m_reg[m_modval & 0x1F];
-	m_bamoffset = OpRead32(m_modadd + 1);
+	m_bamoffset = AmRead32(1);
 
 	return 5;
 }
@@ -207,16 +207,16 @@ uint32_t v60_device::am2DisplacementIndexed8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F];
+		m_amout = m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F];
 		break;
 	case 1:
-		m_amout = m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2;
+		m_amout = m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F] * 2;
 		break;
 	case 2:
-		m_amout = m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4;
+		m_amout = m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F] * 4;
 		break;
 	case 3:
-		m_amout = m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F] * 8;
+		m_amout = m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F] * 8;
 		break;
 	}
 
@@ -226,7 +226,7 @@ uint32_t v60_device::am2DisplacementIndexed8()
 uint32_t v60_device::bam2DisplacementIndexed8()
 {
 	m_amflag = 0;
-	m_amout = m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2);
+	m_amout = m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2);
 	m_bamoffset = m_reg[m_modval & 0x1F];
 
 	return 3;
@@ -239,16 +239,16 @@ uint32_t v60_device::am2DisplacementIndexed16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F];
+		m_amout = m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F];
 		break;
 	case 1:
-		m_amout = m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2;
+		m_amout = m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F] * 2;
 		break;
 	case 2:
-		m_amout = m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4;
+		m_amout = m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F] * 4;
 		break;
 	case 3:
-		m_amout = m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F] * 8;
+		m_amout = m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F] * 8;
 		break;
 	}
 
@@ -258,7 +258,7 @@ uint32_t v60_device::am2DisplacementIndexed16()
 uint32_t v60_device::bam2DisplacementIndexed16()
 {
 	m_amflag = 0;
-	m_amout = m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2);
+	m_amout = m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2);
 	m_bamoffset = m_reg[m_modval & 0x1F];
 
 	return 4;
@@ -271,16 +271,16 @@ uint32_t v60_device::am2DisplacementIndexed32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F];
+		m_amout = m_reg[m_modval2 & 0x1F] + AmRead32(2) + m_reg[m_modval & 0x1F];
 		break;
 	case 1:
-		m_amout = m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2;
+		m_amout = m_reg[m_modval2 & 0x1F] + AmRead32(2) + m_reg[m_modval & 0x1F] * 2;
 		break;
 	case 2:
-		m_amout = m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4;
+		m_amout = m_reg[m_modval2 & 0x1F] + AmRead32(2) + m_reg[m_modval & 0x1F] * 4;
 		break;
 	case 3:
-		m_amout = m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 8;
+		m_amout = m_reg[m_modval2 & 0x1F] + AmRead32(2) + m_reg[m_modval & 0x1F] * 8;
 		break;
 	}
 
@@ -290,7 +290,7 @@ uint32_t v60_device::am2DisplacementIndexed32()
 uint32_t v60_device::bam2DisplacementIndexed32()
 {
 	m_amflag = 0;
-	m_amout = m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2);
+	m_amout = m_reg[m_modval2 & 0x1F] + AmRead32(2);
 	m_bamoffset = m_reg[m_modval & 0x1F];
 
 	return 6;
@@ -299,7 +299,7 @@ uint32_t v60_device::bam2DisplacementIndexed32()
 uint32_t v60_device::am2PCDisplacement8()
 {
 	m_amflag = 0;
-	m_amout = PC + (int8_t)OpRead8(m_modadd + 1);
+	m_amout = PC + (int8_t)AmRead8(1);
 
 	return 2;
 }
@@ -308,7 +308,7 @@ uint32_t v60_device::bam2PCDisplacement8()
 {
 	m_amflag = 0;
 	m_amout = PC;
-	m_bamoffset = (int8_t)OpRead8(m_modadd + 1);
+	m_bamoffset = (int8_t)AmRead8(1);
 
 	return 2;
 }
@@ -316,7 +316,7 @@ uint32_t v60_device::bam2PCDisplacement8()
 uint32_t v60_device::am2PCDisplacement16()
 {
 	m_amflag = 0;
-	m_amout = PC + (int16_t)OpRead16(m_modadd + 1);
+	m_amout = PC + (int16_t)AmRead16(1);
 
 	return 3;
 }
@@ -325,7 +325,7 @@ uint32_t v60_device::bam2PCDisplacement16()
 {
 	m_amflag = 0;
 	m_amout = PC;
-	m_bamoffset = (int16_t)OpRead16(m_modadd + 1);
+	m_bamoffset = (int16_t)AmRead16(1);
 
 	return 3;
 }
@@ -333,7 +333,7 @@ uint32_t v60_device::bam2PCDisplacement16()
 uint32_t v60_device::am2PCDisplacement32()
 {
 	m_amflag = 0;
-	m_amout = PC + OpRead32(m_modadd + 1);
+	m_amout = PC + AmRead32(1);
 
 	return 5;
 }
@@ -342,7 +342,7 @@ uint32_t v60_device::bam2PCDisplacement32()
 {
 	m_amflag = 0;
 	m_amout = PC;
-	m_bamoffset = OpRead32(m_modadd + 1);
+	m_bamoffset = AmRead32(1);
 
 	return 5;
 }
@@ -355,16 +355,16 @@ uint32_t v60_device::am2PCDisplacementIndexed8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = PC + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F];
+		m_amout = PC + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F];
 		break;
 	case 1:
-		m_amout = PC + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2;
+		m_amout = PC + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F] * 2;
 		break;
 	case 2:
-		m_amout = PC + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4;
+		m_amout = PC + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F] * 4;
 		break;
 	case 3:
-		m_amout = PC + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F] * 8;
+		m_amout = PC + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F] * 8;
 		break;
 	}
 
@@ -374,7 +374,7 @@ uint32_t v60_device::am2PCDisplacementIndexed8()
 uint32_t v60_device::bam2PCDisplacementIndexed8()
 {
 	m_amflag = 0;
-	m_amout = PC + (int8_t)OpRead8(m_modadd + 2);
+	m_amout = PC + (int8_t)AmRead8(2);
 	m_bamoffset = m_reg[m_modval & 0x1F];
 
 	return 3;
@@ -387,16 +387,16 @@ uint32_t v60_device::am2PCDisplacementIndexed16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = PC + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F];
+		m_amout = PC + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F];
 		break;
 	case 1:
-		m_amout = PC + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2;
+		m_amout = PC + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F] * 2;
 		break;
 	case 2:
-		m_amout = PC + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4;
+		m_amout = PC + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F] * 4;
 		break;
 	case 3:
-		m_amout = PC + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F] * 8;
+		m_amout = PC + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F] * 8;
 		break;
 	}
 
@@ -406,7 +406,7 @@ uint32_t v60_device::am2PCDisplacementIndexed16()
 uint32_t v60_device::bam2PCDisplacementIndexed16()
 {
 	m_amflag = 0;
-	m_amout = PC + (int16_t)OpRead16(m_modadd + 2);
+	m_amout = PC + (int16_t)AmRead16(2);
 	m_bamoffset = m_reg[m_modval & 0x1F];
 
 	return 4;
@@ -419,16 +419,16 @@ uint32_t v60_device::am2PCDisplacementIndexed32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = PC + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F];
+		m_amout = PC + AmRead32(2) + m_reg[m_modval & 0x1F];
 		break;
 	case 1:
-		m_amout = PC + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2;
+		m_amout = PC + AmRead32(2) + m_reg[m_modval & 0x1F] * 2;
 		break;
 	case 2:
-		m_amout = PC + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4;
+		m_amout = PC + AmRead32(2) + m_reg[m_modval & 0x1F] * 4;
 		break;
 	case 3:
-		m_amout = PC + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 8;
+		m_amout = PC + AmRead32(2) + m_reg[m_modval & 0x1F] * 8;
 		break;
 	}
 
@@ -438,7 +438,7 @@ uint32_t v60_device::am2PCDisplacementIndexed32()
 uint32_t v60_device::bam2PCDisplacementIndexed32()
 {
 	m_amflag = 0;
-	m_amout = PC + OpRead32(m_modadd + 2);
+	m_amout = PC + AmRead32(2);
 	m_bamoffset = m_reg[m_modval & 0x1F];
 
 	return 6;
@@ -447,7 +447,7 @@ uint32_t v60_device::bam2PCDisplacementIndexed32()
 uint32_t v60_device::am2DisplacementIndirect8()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1));
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1));
 
 	return 2;
 }
@@ -455,7 +455,7 @@ uint32_t v60_device::am2DisplacementIndirect8()
 uint32_t v60_device::bam2DisplacementIndirect8()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1));
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1));
 	m_bamoffset = 0;
 	return 2;
 }
@@ -463,7 +463,7 @@ uint32_t v60_device::bam2DisplacementIndirect8()
 uint32_t v60_device::am2DisplacementIndirect16()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1));
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1));
 
 	return 3;
 }
@@ -471,7 +471,7 @@ uint32_t v60_device::am2DisplacementIndirect16()
 uint32_t v60_device::bam2DisplacementIndirect16()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1));
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1));
 	m_bamoffset = 0;
 	return 3;
 }
@@ -479,7 +479,7 @@ uint32_t v60_device::bam2DisplacementIndirect16()
 uint32_t v60_device::am2DisplacementIndirect32()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1));
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1));
 
 	return 5;
 }
@@ -487,7 +487,7 @@ uint32_t v60_device::am2DisplacementIndirect32()
 uint32_t v60_device::bam2DisplacementIndirect32()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1));
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1));
 	m_bamoffset = 0;
 
 	return 5;
@@ -500,16 +500,16 @@ uint32_t v60_device::am2DisplacementIndirectIndexed8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F];
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F];
 		break;
 	case 1:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2;
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F] * 2;
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4;
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F] * 4;
 		break;
 	case 3:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 8;
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F] * 8;
 		break;
 	}
 
@@ -519,7 +519,7 @@ uint32_t v60_device::am2DisplacementIndirectIndexed8()
 uint32_t v60_device::bam2DisplacementIndirectIndexed8()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2));
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2));
 	m_bamoffset = m_reg[m_modval & 0x1F];
 
 	return 3;
@@ -532,16 +532,16 @@ uint32_t v60_device::am2DisplacementIndirectIndexed16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F];
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F];
 		break;
 	case 1:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2;
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F] * 2;
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4;
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F] * 4;
 		break;
 	case 3:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 8;
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F] * 8;
 		break;
 	}
 
@@ -551,7 +551,7 @@ uint32_t v60_device::am2DisplacementIndirectIndexed16()
 uint32_t v60_device::bam2DisplacementIndirectIndexed16()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2));
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2));
 	m_bamoffset = m_reg[m_modval & 0x1F];
 
 	return 4;
@@ -564,16 +564,16 @@ uint32_t v60_device::am2DisplacementIndirectIndexed32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F];
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2)) + m_reg[m_modval & 0x1F];
 		break;
 	case 1:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2;
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2)) + m_reg[m_modval & 0x1F] * 2;
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4;
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2)) + m_reg[m_modval & 0x1F] * 4;
 		break;
 	case 3:
-		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 8;
+		m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2)) + m_reg[m_modval & 0x1F] * 8;
 		break;
 	}
 
@@ -583,7 +583,7 @@ uint32_t v60_device::am2DisplacementIndirectIndexed32()
 uint32_t v60_device::bam2DisplacementIndirectIndexed32()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2));
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2));
 	m_bamoffset = m_reg[m_modval & 0x1F];
 
 	return 6;
@@ -592,7 +592,7 @@ uint32_t v60_device::bam2DisplacementIndirectIndexed32()
 uint32_t v60_device::am2PCDisplacementIndirect8()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1));
+	m_amout = m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1));
 
 	return 2;
 }
@@ -600,7 +600,7 @@ uint32_t v60_device::am2PCDisplacementIndirect8()
 uint32_t v60_device::bam2PCDisplacementIndirect8()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1));
+	m_amout = m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1));
 	m_bamoffset = 0;
 
 	return 2;
@@ -609,7 +609,7 @@ uint32_t v60_device::bam2PCDisplacementIndirect8()
 uint32_t v60_device::am2PCDisplacementIndirect16()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1));
+	m_amout = m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1));
 
 	return 3;
 }
@@ -617,7 +617,7 @@ uint32_t v60_device::am2PCDisplacementIndirect16()
 uint32_t v60_device::bam2PCDisplacementIndirect16()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1));
+	m_amout = m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1));
 	m_bamoffset = 0;
 
 	return 3;
@@ -626,7 +626,7 @@ uint32_t v60_device::bam2PCDisplacementIndirect16()
 uint32_t v60_device::am2PCDisplacementIndirect32()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1));
+	m_amout = m_program->read_dword_unaligned(PC + AmRead32(1));
 
 	return 5;
 }
@@ -634,7 +634,7 @@ uint32_t v60_device::am2PCDisplacementIndirect32()
 uint32_t v60_device::bam2PCDisplacementIndirect32()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1));
+	m_amout = m_program->read_dword_unaligned(PC + AmRead32(1));
 	m_bamoffset = 0;
 
 	return 5;
@@ -647,16 +647,16 @@ uint32_t v60_device::am2PCDisplacementIndirectIndexed8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F];
+		m_amout = m_program->read_dword_unaligned(PC + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F];
 		break;
 	case 1:
-		m_amout = m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2;
+		m_amout = m_program->read_dword_unaligned(PC + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F] * 2;
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4;
+		m_amout = m_program->read_dword_unaligned(PC + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F] * 4;
 		break;
 	case 3:
-		m_amout = m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 8;
+		m_amout = m_program->read_dword_unaligned(PC + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F] * 8;
 		break;
 	}
 
@@ -666,7 +666,7 @@ uint32_t v60_device::am2PCDisplacementIndirectIndexed8()
 uint32_t v60_device::bam2PCDisplacementIndirectIndexed8()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 2));
+	m_amout = m_program->read_dword_unaligned(PC + (int8_t)AmRead8(2));
 	m_bamoffset = m_reg[m_modval & 0x1F];
 
 	return 3;
@@ -679,16 +679,16 @@ uint32_t v60_device::am2PCDisplacementIndirectIndexed16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F];
+		m_amout = m_program->read_dword_unaligned(PC + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F];
 		break;
 	case 1:
-		m_amout = m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2;
+		m_amout = m_program->read_dword_unaligned(PC + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F] * 2;
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4;
+		m_amout = m_program->read_dword_unaligned(PC + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F] * 4;
 		break;
 	case 3:
-		m_amout = m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 8;
+		m_amout = m_program->read_dword_unaligned(PC + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F] * 8;
 		break;
 	}
 
@@ -699,7 +699,7 @@ uint32_t v60_device::am2PCDisplacementIndirectIndexed16()
 uint32_t v60_device::bam2PCDisplacementIndirectIndexed16()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 2));
+	m_amout = m_program->read_dword_unaligned(PC + (int16_t)AmRead16(2));
 	m_bamoffset = m_reg[m_modval & 0x1F];
 
 	return 4;
@@ -713,16 +713,16 @@ uint32_t v60_device::am2PCDisplacementIndirectIndexed32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F];
+		m_amout = m_program->read_dword_unaligned(PC + AmRead32(2)) + m_reg[m_modval & 0x1F];
 		break;
 	case 1:
-		m_amout = m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2;
+		m_amout = m_program->read_dword_unaligned(PC + AmRead32(2)) + m_reg[m_modval & 0x1F] * 2;
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4;
+		m_amout = m_program->read_dword_unaligned(PC + AmRead32(2)) + m_reg[m_modval & 0x1F] * 4;
 		break;
 	case 3:
-		m_amout = m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 8;
+		m_amout = m_program->read_dword_unaligned(PC + AmRead32(2)) + m_reg[m_modval & 0x1F] * 8;
 		break;
 	}
 
@@ -732,7 +732,7 @@ uint32_t v60_device::am2PCDisplacementIndirectIndexed32()
 uint32_t v60_device::bam2PCDisplacementIndirectIndexed32()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 2));
+	m_amout = m_program->read_dword_unaligned(PC + AmRead32(2));
 	m_bamoffset = m_reg[m_modval & 0x1F];
 
 	return 6;
@@ -741,7 +741,7 @@ uint32_t v60_device::bam2PCDisplacementIndirectIndexed32()
 uint32_t v60_device::am2DoubleDisplacement8()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1)) + (int8_t)OpRead8(m_modadd + 2);
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1)) + (int8_t)AmRead8(2);
 
 	return 3;
 }
@@ -749,8 +749,8 @@ uint32_t v60_device::am2DoubleDisplacement8()
 uint32_t v60_device::bam2DoubleDisplacement8()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1));
-	m_bamoffset = (int8_t)OpRead8(m_modadd + 2);
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1));
+	m_bamoffset = (int8_t)AmRead8(2);
 
 	return 3;
 }
@@ -758,7 +758,7 @@ uint32_t v60_device::bam2DoubleDisplacement8()
 uint32_t v60_device::am2DoubleDisplacement16()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1)) + (int16_t)OpRead16(m_modadd + 3);
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1)) + (int16_t)AmRead16(3);
 
 	return 5;
 }
@@ -766,8 +766,8 @@ uint32_t v60_device::am2DoubleDisplacement16()
 uint32_t v60_device::bam2DoubleDisplacement16()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1));
-	m_bamoffset = (int8_t)OpRead8(m_modadd + 3);
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1));
+	m_bamoffset = (int8_t)AmRead8(3);
 
 	return 5;
 }
@@ -775,7 +775,7 @@ uint32_t v60_device::bam2DoubleDisplacement16()
 uint32_t v60_device::am2DoubleDisplacement32()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1)) + OpRead32(m_modadd + 5);
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1)) + AmRead32(5);
 
 	return 9;
 }
@@ -783,8 +783,8 @@ uint32_t v60_device::am2DoubleDisplacement32()
 uint32_t v60_device::bam2DoubleDisplacement32()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1));
-	m_bamoffset = OpRead32(m_modadd + 5);
+	m_amout = m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1));
+	m_bamoffset = AmRead32(5);
 
 	return 9;
 }
@@ -793,7 +793,7 @@ uint32_t v60_device::bam2DoubleDisplacement32()
 uint32_t v60_device::am2PCDoubleDisplacement8()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1)) + (int8_t)OpRead8(m_modadd + 2);
+	m_amout = m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1)) + (int8_t)AmRead8(2);
 
 	return 3;
 }
@@ -801,8 +801,8 @@ uint32_t v60_device::am2PCDoubleDisplacement8()
 uint32_t v60_device::bam2PCDoubleDisplacement8()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1));
-	m_bamoffset = (int8_t)OpRead8(m_modadd + 2);
+	m_amout = m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1));
+	m_bamoffset = (int8_t)AmRead8(2);
 
 	return 3;
 }
@@ -810,7 +810,7 @@ uint32_t v60_device::bam2PCDoubleDisplacement8()
 uint32_t v60_device::am2PCDoubleDisplacement16()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1)) + (int16_t)OpRead16(m_modadd + 3);
+	m_amout = m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1)) + (int16_t)AmRead16(3);
 
 	return 5;
 }
@@ -818,8 +818,8 @@ uint32_t v60_device::am2PCDoubleDisplacement16()
 uint32_t v60_device::bam2PCDoubleDisplacement16()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1));
-	m_bamoffset = (int8_t)OpRead8(m_modadd + 3);
+	m_amout = m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1));
+	m_bamoffset = (int8_t)AmRead8(3);
 
 	return 5;
 }
@@ -827,7 +827,7 @@ uint32_t v60_device::bam2PCDoubleDisplacement16()
 uint32_t v60_device::am2PCDoubleDisplacement32()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1)) + OpRead32(m_modadd + 5);
+	m_amout = m_program->read_dword_unaligned(PC + AmRead32(1)) + AmRead32(5);
 
 	return 9;
 }
@@ -835,8 +835,8 @@ uint32_t v60_device::am2PCDoubleDisplacement32()
 uint32_t v60_device::bam2PCDoubleDisplacement32()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1));
-	m_bamoffset = OpRead32(m_modadd + 5);
+	m_amout = m_program->read_dword_unaligned(PC + AmRead32(1));
+	m_bamoffset = AmRead32(5);
 
 	return 9;
 }
@@ -844,7 +844,7 @@ uint32_t v60_device::bam2PCDoubleDisplacement32()
 uint32_t v60_device::am2DirectAddress()
 {
 	m_amflag = 0;
-	m_amout = OpRead32(m_modadd + 1);
+	m_amout = AmRead32(1);
 
 	return 5;
 }
@@ -852,7 +852,7 @@ uint32_t v60_device::am2DirectAddress()
 uint32_t v60_device::bam2DirectAddress()
 {
 	m_amflag = 0;
-	m_amout = OpRead32(m_modadd + 1);
+	m_amout = AmRead32(1);
 	m_bamoffset = 0;
 
 	return 5;
@@ -865,16 +865,16 @@ uint32_t v60_device::am2DirectAddressIndexed()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F];
+		m_amout = AmRead32(2) + m_reg[m_modval & 0x1F];
 		break;
 	case 1:
-		m_amout = OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2;
+		m_amout = AmRead32(2) + m_reg[m_modval & 0x1F] * 2;
 		break;
 	case 2:
-		m_amout = OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4;
+		m_amout = AmRead32(2) + m_reg[m_modval & 0x1F] * 4;
 		break;
 	case 3:
-		m_amout = OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 8;
+		m_amout = AmRead32(2) + m_reg[m_modval & 0x1F] * 8;
 		break;
 	}
 
@@ -884,7 +884,7 @@ uint32_t v60_device::am2DirectAddressIndexed()
 uint32_t v60_device::bam2DirectAddressIndexed()
 {
 	m_amflag = 0;
-	m_amout = OpRead32(m_modadd + 2);
+	m_amout = AmRead32(2);
 	m_bamoffset = m_reg[m_modval & 0x1F];
 
 	return 6;
@@ -893,7 +893,7 @@ uint32_t v60_device::bam2DirectAddressIndexed()
 uint32_t v60_device::am2DirectAddressDeferred()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(OpRead32(m_modadd + 1));
+	m_amout = m_program->read_dword_unaligned(AmRead32(1));
 
 	return 5;
 }
@@ -901,7 +901,7 @@ uint32_t v60_device::am2DirectAddressDeferred()
 uint32_t v60_device::bam2DirectAddressDeferred()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(OpRead32(m_modadd + 1));
+	m_amout = m_program->read_dword_unaligned(AmRead32(1));
 	m_bamoffset = 0;
 
 	return 5;
@@ -914,16 +914,16 @@ uint32_t v60_device::am2DirectAddressDeferredIndexed()
 	switch (m_moddim)
 	{
 	case 0:
-		m_amout = m_program->read_dword_unaligned(OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F];
+		m_amout = m_program->read_dword_unaligned(AmRead32(2)) + m_reg[m_modval & 0x1F];
 		break;
 	case 1:
-		m_amout = m_program->read_dword_unaligned(OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2;
+		m_amout = m_program->read_dword_unaligned(AmRead32(2)) + m_reg[m_modval & 0x1F] * 2;
 		break;
 	case 2:
-		m_amout = m_program->read_dword_unaligned(OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4;
+		m_amout = m_program->read_dword_unaligned(AmRead32(2)) + m_reg[m_modval & 0x1F] * 4;
 		break;
 	case 3:
-		m_amout = m_program->read_dword_unaligned(OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 8;
+		m_amout = m_program->read_dword_unaligned(AmRead32(2)) + m_reg[m_modval & 0x1F] * 8;
 		break;
 	}
 
@@ -933,7 +933,7 @@ uint32_t v60_device::am2DirectAddressDeferredIndexed()
 uint32_t v60_device::bam2DirectAddressDeferredIndexed()
 {
 	m_amflag = 0;
-	m_amout = m_program->read_dword_unaligned(OpRead32(m_modadd + 2));
+	m_amout = m_program->read_dword_unaligned(AmRead32(2));
 	m_bamoffset = m_reg[m_modval & 0x1F];
 
 	return 6;
@@ -1170,12 +1170,12 @@ const v60_device::am_func v60_device::s_BAMTable2_G6[8] =
 
 uint32_t v60_device::am2Group6()
 {
-	m_modval2 = OpRead8(m_modadd + 1);
+	m_modval2 = AmRead8(1);
 	return (this->*s_AMTable2_G6[m_modval2 >> 5])();
 }
 uint32_t v60_device::bam2Group6()
 {
-	m_modval2 = OpRead8(m_modadd + 1);
+	m_modval2 = AmRead8(1);
 	return (this->*s_BAMTable2_G6[m_modval2 >> 5])();
 }
 
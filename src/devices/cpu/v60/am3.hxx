@@ -104,13 +104,13 @@ uint32_t v60_device::am3Displacement8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1), m_modwritevalb);
+		m_program->write_byte(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1), m_modwritevalh);
+		m_program->write_word_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1), m_modwritevalw);
+		m_program->write_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1), m_modwritevalw);
 		break;
 	}
 
@@ -122,13 +122,13 @@ uint32_t v60_device::am3Displacement16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1), m_modwritevalb);
+		m_program->write_byte(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1), m_modwritevalh);
+		m_program->write_word_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1), m_modwritevalw);
+		m_program->write_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1), m_modwritevalw);
 		break;
 	}
 
@@ -140,13 +140,13 @@ uint32_t v60_device::am3Displacement32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1), m_modwritevalb);
+		m_program->write_byte(m_reg[m_modval & 0x1F] + AmRead32(1), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1), m_modwritevalh);
+		m_program->write_word_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1), m_modwritevalw);
+		m_program->write_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1), m_modwritevalw);
 		break;
 	}
 
@@ -159,13 +159,13 @@ uint32_t v60_device::am3DisplacementIndexed8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F], m_modwritevalb);
+		m_program->write_byte(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F], m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
+		m_program->write_word_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
+		m_program->write_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
 		break;
 	}
 
@@ -177,13 +177,13 @@ uint32_t v60_device::am3DisplacementIndexed16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F], m_modwritevalb);
+		m_program->write_byte(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F], m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
+		m_program->write_word_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
+		m_program->write_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
 		break;
 	}
 
@@ -195,13 +195,13 @@ uint32_t v60_device::am3DisplacementIndexed32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F], m_modwritevalb);
+		m_program->write_byte(m_reg[m_modval2 & 0x1F] + AmRead32(2) + m_reg[m_modval & 0x1F], m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
+		m_program->write_word_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
+		m_program->write_dword_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
 		break;
 	}
 
@@ -214,13 +214,13 @@ uint32_t v60_device::am3PCDisplacement8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(PC + (int8_t)OpRead8(m_modadd + 1), m_modwritevalb);
+		m_program->write_byte(PC + (int8_t)AmRead8(1), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(PC + (int8_t)OpRead8(m_modadd + 1), m_modwritevalh);
+		m_program->write_word_unaligned(PC + (int8_t)AmRead8(1), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1), m_modwritevalw);
+		m_program->write_dword_unaligned(PC + (int8_t)AmRead8(1), m_modwritevalw);
 		break;
 	}
 
@@ -232,13 +232,13 @@ uint32_t v60_device::am3PCDisplacement16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(PC + (int16_t)OpRead16(m_modadd + 1), m_modwritevalb);
+		m_program->write_byte(PC + (int16_t)AmRead16(1), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(PC + (int16_t)OpRead16(m_modadd + 1), m_modwritevalh);
+		m_program->write_word_unaligned(PC + (int16_t)AmRead16(1), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1), m_modwritevalw);
+		m_program->write_dword_unaligned(PC + (int16_t)AmRead16(1), m_modwritevalw);
 		break;
 	}
 
@@ -250,13 +250,13 @@ uint32_t v60_device::am3PCDisplacement32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(PC + OpRead32(m_modadd + 1), m_modwritevalb);
+		m_program->write_byte(PC + AmRead32(1), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(PC + OpRead32(m_modadd + 1), m_modwritevalh);
+		m_program->write_word_unaligned(PC + AmRead32(1), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(PC + OpRead32(m_modadd + 1), m_modwritevalw);
+		m_program->write_dword_unaligned(PC + AmRead32(1), m_modwritevalw);
 		break;
 	}
 
@@ -268,13 +268,13 @@ uint32_t v60_device::am3PCDisplacementIndexed8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(PC + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F], m_modwritevalb);
+		m_program->write_byte(PC + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F], m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(PC + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
+		m_program->write_word_unaligned(PC + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
+		m_program->write_dword_unaligned(PC + (int8_t)AmRead8(2) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
 		break;
 	}
 
@@ -286,13 +286,13 @@ uint32_t v60_device::am3PCDisplacementIndexed16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(PC + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F], m_modwritevalb);
+		m_program->write_byte(PC + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F], m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(PC + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
+		m_program->write_word_unaligned(PC + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
+		m_program->write_dword_unaligned(PC + (int16_t)AmRead16(2) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
 		break;
 	}
 
@@ -304,13 +304,13 @@ uint32_t v60_device::am3PCDisplacementIndexed32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(PC + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F], m_modwritevalb);
+		m_program->write_byte(PC + AmRead32(2) + m_reg[m_modval & 0x1F], m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(PC + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
+		m_program->write_word_unaligned(PC + AmRead32(2) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(PC + OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
+		m_program->write_dword_unaligned(PC + AmRead32(2) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
 		break;
 	}
 
@@ -322,13 +322,13 @@ uint32_t v60_device::am3DisplacementIndirect8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1)), m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1)), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1)), m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1)), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1)), m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1)), m_modwritevalw);
 		break;
 	}
 
@@ -340,13 +340,13 @@ uint32_t v60_device::am3DisplacementIndirect16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1)), m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1)), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1)), m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1)), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1)), m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1)), m_modwritevalw);
 		break;
 	}
 
@@ -358,13 +358,13 @@ uint32_t v60_device::am3DisplacementIndirect32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1)), m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1)), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1)), m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1)), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1)), m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1)), m_modwritevalw);
 		break;
 	}
 
@@ -377,13 +377,13 @@ uint32_t v60_device::am3DisplacementIndirectIndexed8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F], m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F], m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
 		break;
 	}
 
@@ -395,13 +395,13 @@ uint32_t v60_device::am3DisplacementIndirectIndexed16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F], m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F], m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
 		break;
 	}
 
@@ -413,13 +413,13 @@ uint32_t v60_device::am3DisplacementIndirectIndexed32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F], m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2)) + m_reg[m_modval & 0x1F], m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2)) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval2 & 0x1F] + AmRead32(2)) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
 		break;
 	}
 
@@ -431,13 +431,13 @@ uint32_t v60_device::am3PCDisplacementIndirect8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1)), m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1)), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1)), m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1)), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1)), m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1)), m_modwritevalw);
 		break;
 	}
 
@@ -449,13 +449,13 @@ uint32_t v60_device::am3PCDisplacementIndirect16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1)), m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1)), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1)), m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1)), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1)), m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1)), m_modwritevalw);
 		break;
 	}
 
@@ -467,13 +467,13 @@ uint32_t v60_device::am3PCDisplacementIndirect32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1)), m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(PC + AmRead32(1)), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1)), m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + AmRead32(1)), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1)), m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + AmRead32(1)), m_modwritevalw);
 		break;
 	}
 
@@ -486,13 +486,13 @@ uint32_t v60_device::am3PCDisplacementIndirectIndexed8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F], m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F], m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(2)) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
 		break;
 	}
 
@@ -504,13 +504,13 @@ uint32_t v60_device::am3PCDisplacementIndirectIndexed16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F], m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F], m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(2)) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
 		break;
 	}
 
@@ -522,13 +522,13 @@ uint32_t v60_device::am3PCDisplacementIndirectIndexed32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F], m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(PC + AmRead32(2)) + m_reg[m_modval & 0x1F], m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + AmRead32(2)) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + AmRead32(2)) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
 		break;
 	}
 
@@ -541,13 +541,13 @@ uint32_t v60_device::am3DoubleDisplacement8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1)) + (int8_t)OpRead8(m_modadd + 2), m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1)) + (int8_t)AmRead8(2), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1)) + (int8_t)OpRead8(m_modadd + 2), m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1)) + (int8_t)AmRead8(2), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)OpRead8(m_modadd + 1)) + (int8_t)OpRead8(m_modadd + 2), m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int8_t)AmRead8(1)) + (int8_t)AmRead8(2), m_modwritevalw);
 		break;
 	}
 
@@ -559,13 +559,13 @@ uint32_t v60_device::am3DoubleDisplacement16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1)) + (int16_t)OpRead16(m_modadd + 3), m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1)) + (int16_t)AmRead16(3), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1)) + (int16_t)OpRead16(m_modadd + 3), m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1)) + (int16_t)AmRead16(3), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)OpRead16(m_modadd + 1)) + (int16_t)OpRead16(m_modadd + 3), m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + (int16_t)AmRead16(1)) + (int16_t)AmRead16(3), m_modwritevalw);
 		break;
 	}
 
@@ -577,13 +577,13 @@ uint32_t v60_device::am3DoubleDisplacement32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1)) + OpRead32(m_modadd + 5), m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1)) + AmRead32(5), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1)) + OpRead32(m_modadd + 5), m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1)) + AmRead32(5), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + OpRead32(m_modadd + 1)) + OpRead32(m_modadd + 5), m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(m_reg[m_modval & 0x1F] + AmRead32(1)) + AmRead32(5), m_modwritevalw);
 		break;
 	}
 
@@ -596,13 +596,13 @@ uint32_t v60_device::am3PCDoubleDisplacement8()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1)) + (int8_t)OpRead8(m_modadd + 2), m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1)) + (int8_t)AmRead8(2), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1)) + (int8_t)OpRead8(m_modadd + 2), m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1)) + (int8_t)AmRead8(2), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)OpRead8(m_modadd + 1)) + (int8_t)OpRead8(m_modadd + 2), m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + (int8_t)AmRead8(1)) + (int8_t)AmRead8(2), m_modwritevalw);
 		break;
 	}
 
@@ -614,13 +614,13 @@ uint32_t v60_device::am3PCDoubleDisplacement16()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1)) + (int16_t)OpRead16(m_modadd + 3), m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1)) + (int16_t)AmRead16(3), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1)) + (int16_t)OpRead16(m_modadd + 3), m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1)) + (int16_t)AmRead16(3), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)OpRead16(m_modadd + 1)) + (int16_t)OpRead16(m_modadd + 3), m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + (int16_t)AmRead16(1)) + (int16_t)AmRead16(3), m_modwritevalw);
 		break;
 	}
 
@@ -632,13 +632,13 @@ uint32_t v60_device::am3PCDoubleDisplacement32()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1)) + OpRead32(m_modadd + 5), m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(PC + AmRead32(1)) + AmRead32(5), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1)) + OpRead32(m_modadd + 5), m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(PC + AmRead32(1)) + AmRead32(5), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + OpRead32(m_modadd + 1)) + OpRead32(m_modadd + 5), m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(PC + AmRead32(1)) + AmRead32(5), m_modwritevalw);
 		break;
 	}
 
@@ -650,13 +650,13 @@ uint32_t v60_device::am3DirectAddress()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(OpRead32(m_modadd + 1), m_modwritevalb);
+		m_program->write_byte(AmRead32(1), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(OpRead32(m_modadd + 1), m_modwritevalh);
+		m_program->write_word_unaligned(AmRead32(1), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(OpRead32(m_modadd + 1), m_modwritevalw);
+		m_program->write_dword_unaligned(AmRead32(1), m_modwritevalw);
 		break;
 	}
 
@@ -668,13 +668,13 @@ uint32_t v60_device::am3DirectAddressIndexed()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F], m_modwritevalb);
+		m_program->write_byte(AmRead32(2) + m_reg[m_modval & 0x1F], m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
+		m_program->write_word_unaligned(AmRead32(2) + m_reg[m_modval & 0x1F] * 2, m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(OpRead32(m_modadd + 2) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
+		m_program->write_dword_unaligned(AmRead32(2) + m_reg[m_modval & 0x1F] * 4, m_modwritevalw);
 		break;
 	}
 
@@ -686,13 +686,13 @@ uint32_t v60_device::am3DirectAddressDeferred()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(OpRead32(m_modadd + 1)), m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(AmRead32(1)), m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(OpRead32(m_modadd + 1)), m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(AmRead32(1)), m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(OpRead32(m_modadd + 1)), m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(AmRead32(1)), m_modwritevalw);
 		break;
 	}
 
@@ -704,13 +704,13 @@ uint32_t v60_device::am3DirectAddressDeferredIndexed()
 	switch (m_moddim)
 	{
 	case 0:
-		m_program->write_byte(m_program->read_dword_unaligned(OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F], m_modwritevalb);
+		m_program->write_byte(m_program->read_dword_unaligned(AmRead32(2)) + m_reg[m_modval & 0x1F], m_modwritevalb);
 		break;
 	case 1:
-		m_program->write_word_unaligned(m_program->read_dword_unaligned(OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F], m_modwritevalh);
+		m_program->write_word_unaligned(m_program->read_dword_unaligned(AmRead32(2)) + m_reg[m_modval & 0x1F], m_modwritevalh);
 		break;
 	case 2:
-		m_program->write_dword_unaligned(m_program->read_dword_unaligned(OpRead32(m_modadd + 2)) + m_reg[m_modval & 0x1F], m_modwritevalw);
+		m_program->write_dword_unaligned(m_program->read_dword_unaligned(AmRead32(2)) + m_reg[m_modval & 0x1F], m_modwritevalw);
 		break;
 	}
 
@@ -838,7 +838,7 @@ const v60_device::am_func v60_device::s_AMTable3_G6[8] =
 
 uint32_t v60_device::am3Group6()
 {
-	m_modval2 = OpRead8(m_modadd + 1);
+	m_modval2 = AmRead8(1);
 	return (this->*s_AMTable3_G6[m_modval2 >> 5])();
 }
 
@@ -77,6 +77,8 @@ Package: 132-pin PGA, 200-pin QFP
 #include "v60.h"
 #include "v60d.h"
 
+#include "multibyte.h"
+
 DEFINE_DEVICE_TYPE(V60, v60_device, "v60", "NEC V60")
 DEFINE_DEVICE_TYPE(V70, v70_device, "v70", "NEC V70")
 
@@ -125,6 +127,11 @@ std::unique_ptr<util::disasm_interface> v60_device::create_disassembler()
 #define OpRead16(a)  m_pr16(a)
 #define OpRead32(a)  m_pr32(a)
 
+// operand specifier bytes, from the decode cache on a hit
+#define AmRead8(o)   (m_am_bytes ? m_am_bytes[o] : OpRead8(m_modadd + (o)))
+#define AmRead16(o)  (m_am_bytes ? get_u16le(m_am_bytes + (o)) : OpRead16(m_modadd + (o)))
+#define AmRead32(o)  (m_am_bytes ? get_u32le(m_am_bytes + (o)) : OpRead32(m_modadd + (o)))
+
 
 // macros stolen from MAME for flags calc
 // note that these types are in x86 naming:
@@ -425,6 +432,12 @@ void v60_device::device_start()
 
 	m_io = &space(AS_IO);
 
+	m_am_cache = std::make_unique<am_cache_entry[]>(1 << AM_CACHE_BITS);
+	m_am_bytes = nullptr;
+	flush_decode_cache();
+	m_am_notifier = m_program->add_change_notifier([this] (read_or_write mode) { flush_decode_cache(); });
+	machine().save().register_postload(save_prepost_delegate(FUNC(v60_device::flush_decode_cache), this));
+
 	save_item(NAME(m_reg));
 	save_item(NAME(m_irq_line));
 	save_item(NAME(m_nmi_line));
@@ -548,6 +561,8 @@ void v60_device::device_reset()
 	_OV   = 0;
 	_S    = 0;
 	_Z    = 0;
+
+	flush_decode_cache();
 }
 
 
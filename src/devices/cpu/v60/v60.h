@@ -88,6 +88,9 @@ public:
 
 	void stall();
 
+	// drop decoded operand specifiers, e.g. after switching a bank of code
+	void flush_decode_cache();
+
 protected:
 	v60_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock, int databits, int addrbits, uint32_t pir);
 
@@ -199,6 +202,20 @@ private:
 	uint32_t              m_modwritevalw;
 	uint8_t               m_moddim;
 
+	// Decoded operand specifiers, kept for code in ROM
+	static constexpr unsigned AM_CACHE_BITS = 12;
+	struct am_cache_entry
+	{
+		uint32_t addr;      // address of the specifier
+		uint16_t key;       // decoder, m_modm and m_moddim; 0 while free
+		uint8_t  length;    // bytes in data[]; 0 if it is always read from memory
+		uint8_t  data[11];  // the specifier itself
+		am_func  handler;   // addressing mode function after the group tables
+	};
+	std::unique_ptr<am_cache_entry[]> m_am_cache;
+	const uint8_t *m_am_bytes;
+	util::notifier_subscription m_am_notifier;
+
 	uint32_t m_debugger_temp;
 
 
@@ -449,6 +466,8 @@ private:
 	uint32_t am3Group7a();
 	uint32_t am3Group6();
 	uint32_t am3Group7();
+	am_func ResolveAM(const am_func (&table)[2][8], const am_func (&g6)[8], const am_func (&g7)[32], const am_func (&g7a)[16]) const;
+	uint32_t DecodeAM(unsigned decoder, const am_func (&table)[2][8], const am_func (&g6)[8], const am_func (&g7)[32], const am_func (&g7a)[16]);
 	uint32_t ReadAM();
 	uint32_t BitReadAM();
 	uint32_t ReadAMAddress();
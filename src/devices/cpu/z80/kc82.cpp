@@ -26,6 +26,9 @@ kc82_device::kc82_device(const machine_config &mconfig, device_type type, const
 	std::fill_n(&m_mmu_a[0], 4, 0);
 	std::fill_n(&m_mmu_b[0], 5, 0);
 	std::fill_n(&m_mmu_base[0], 0x40, 0);
+
+	// opcodes are fetched through the MMU
+	m_direct_fetch = false;
 }
 
 
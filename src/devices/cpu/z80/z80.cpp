@@ -419,6 +419,22 @@ u8 z80_device::rop()
 	return res;
 }
 
+/***************************************************************
+ * rop_direct() is rop() for the fast run loop: the opcode comes
+ * straight from the cache and no refresh cycle is signalled
+ ***************************************************************/
+inline u8 z80_device::rop_direct()
+{
+	u8 res = m_opcodes.read_byte(PCD);
+	T(m_m1_cycles);
+	PC++;
+	m_r++;
+	Q = m_qtemp;
+	m_qtemp = YF | XF;
+
+	return res;
+}
+
 /****************************************************************
  * arg() is identical to rop() except it is used
  * for reading opcode arguments. This difference can be used to
@@ -3449,6 +3465,8 @@ void z80_device::device_start()
 	save_item(NAME(m_busrq_state));
 	save_item(NAME(m_after_ei));
 	save_item(NAME(m_after_ldair));
+	save_item(NAME(m_halt_sleeping));
+	save_item(NAME(m_halt_sleep_start));
 
 	// Reset registers to their initial values
 	PRVPC = 0;
@@ -3479,6 +3497,8 @@ void z80_device::device_start()
 	m_busrq_state = 0;
 	m_after_ei = 0;
 	m_after_ldair = 0;
+	m_halt_sleeping = false;
+	m_halt_sleep_start = 0;
 	m_ea = 0;
 
 	space(AS_PROGRAM).cache(m_args);
@@ -3486,6 +3506,10 @@ void z80_device::device_start()
 	space(AS_PROGRAM).specific(m_data);
 	space(AS_IO).specific(m_io);
 
+	// the fast run loop skips the refresh callback and the debugger
+	// hook, so it is only used when neither can be observed
+	m_fast_run = m_direct_fetch && m_refresh_cb.isunset() && !(machine().debug_flags & DEBUG_FLAG_ENABLED);
+
 	IX = IY = 0xffff; // IX and IY are FFFF after a reset!
 	set_f(ZF);        // Zero flag is set
 
@@ -3546,6 +3570,7 @@ void z80_device::device_reset()
 	m_after_ldair = false;
 	m_iff1 = 0;
 	m_iff2 = 0;
+	m_halt_sleeping = false;
 
 	WZ = PCD;
 }
@@ -3566,6 +3591,12 @@ inline void z80_device::execute_cycles(u8 icount)
  ****************************************************************************/
 void z80_device::execute_run()
 {
+	if (m_fast_run)
+	{
+		execute_run_direct();
+		return;
+	}
+
 	do
 	{
 		if (m_wait_state)
@@ -3596,6 +3627,60 @@ void z80_device::execute_run()
 	} while (m_icount > 0);
 }
 
+/****************************************************************************
+ * Same as execute_run(), for configurations with nothing attached to the
+ * refresh cycle and no debugger: opcodes are fetched directly from the
+ * cache.
+ ****************************************************************************/
+void z80_device::execute_run_direct()
+{
+	do
+	{
+		if (m_wait_state)
+		{
+			// stalled
+			m_icount = 0;
+			return;
+		}
+
+		// a sleeping HALT would have fetched a NOP every 4 T-states
+		if (m_halt_sleeping)
+		{
+			m_r += u8((total_cycles() - m_halt_sleep_start) / 4);
+			m_halt_sleeping = false;
+		}
+
+		// check for interrupts before each instruction
+		check_interrupts();
+
+		// nothing can leave HALT before an input line is asserted, so
+		// sleep until then and let the scheduler take the cycles
+		if (m_halt && !m_nmi_pending && ((m_irq_state == CLEAR_LINE) || !m_iff1))
+		{
+			m_halt_sleeping = true;
+			m_halt_sleep_start = total_cycles();
+			spin_until_interrupt();
+			m_icount = 0;
+			return;
+		}
+
+		m_after_ei = false;
+		m_after_ldair = false;
+
+		PRVPC = PCD;
+
+		u8 opcode = rop_direct();
+
+		// when in HALT state, the fetched opcode is not dispatched (aka a NOP)
+		if (m_halt)
+		{
+			PC--;
+			opcode = 0;
+		}
+		EXEC(op, opcode);
+	} while (m_icount > 0);
+}
+
 void z80_device::check_interrupts()
 {
 	if (m_nmi_pending)
@@ -3747,6 +3832,7 @@ z80_device::z80_device(const machine_config &mconfig, device_type type, const ch
 	m_refresh_cb(*this),
 	m_nomreq_cb(*this),
 	m_halt_cb(*this),
+	m_direct_fetch(true),
 	m_m1_cycles(4),
 	m_memrq_cycles(3),
 	m_iorq_cycles(4)
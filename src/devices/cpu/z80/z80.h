@@ -161,6 +161,7 @@ protected:
 	void wm16(u16 addr, PAIR &r);
 	void wm16_sp(PAIR &r);
 	u8 rop();
+	u8 rop_direct();
 	u8 arg();
 	u16 arg16();
 	void eax();
@@ -249,6 +250,8 @@ protected:
 	virtual u8 opcode_read();
 	virtual u8 arg_read();
 
+	void execute_run_direct();
+
 	// address spaces
 	const address_space_config m_program_config;
 	const address_space_config m_opcodes_config;
@@ -298,6 +301,11 @@ protected:
 	int          m_icount;
 	u8           m_rtemp;
 
+	bool m_direct_fetch;    // opcode_read() is a plain cache read, no translation
+	bool m_fast_run;        // nothing needs the refresh cycle or the debugger hook
+	bool m_halt_sleeping;   // halted and suspended until an interrupt
+	u64 m_halt_sleep_start; // total cycles when the sleep began
+
 	u8 m_m1_cycles;
 	u8 m_memrq_cycles;
 	u8 m_iorq_cycles;
@@ -23,6 +23,8 @@ z84c015_device::z84c015_device(const machine_config &mconfig, const char *tag, d
 	, m_program_space_config("program", ENDIANNESS_LITTLE, 8, 18, 0, 16, 0)
 	, m_opcodes_space_config("opcodes", ENDIANNESS_LITTLE, 8, 18, 0, 16, 0)
 {
+	// opcode addresses go through translate_memory_address()
+	m_direct_fetch = false;
 }
 
 device_memory_interface::space_config_vector z84c015_device::memory_space_config() const
@@ -30,6 +30,7 @@ cdrom_image_device::cdrom_image_device(const machine_config &mconfig, device_typ
 	  device_image_interface(mconfig, *this),
 	  m_gd_compat(gd_compat),
 	  m_dvd_compat(dvd_compat),
+	  m_chd(nullptr),
 	  m_cdrom_handle(nullptr),
 	  m_dvdrom_handle(nullptr),
 	  m_extension_list(nullptr),
@@ -68,6 +69,7 @@ void cdrom_image_device::device_start()
 		setup_current_preset_image();
 	else
 	{
+		m_chd = nullptr;
 		m_cdrom_handle.reset();
 		m_dvdrom_handle.reset();
 	}
@@ -79,6 +81,7 @@ void cdrom_image_device::setup_current_preset_image()
 	m_dvdrom_handle.reset();
 
 	chd_file *chd = current_preset_image_chd();
+	m_chd = chd;
 	if (chd->is_cd() || (m_gd_compat && chd->is_gd()))
 		m_cdrom_handle = std::make_unique<cdrom_file>(chd);
 	else if(m_dvd_compat && chd->is_dvd())
@@ -89,6 +92,7 @@ void cdrom_image_device::setup_current_preset_image()
 
 void cdrom_image_device::device_stop()
 {
+	m_chd = nullptr;
 	m_cdrom_handle.reset();
 	m_dvdrom_handle.reset();
 	if (m_self_chd.opened())
@@ -97,6 +101,7 @@ void cdrom_image_device::device_stop()
 
 std::pair<std::error_condition, std::string> cdrom_image_device::call_load()
 {
+	std::lock_guard<std::mutex> lock(m_mutex);
 	if (has_preset_images())
 	{
 		setup_current_preset_image();
@@ -106,6 +111,7 @@ std::pair<std::error_condition, std::string> cdrom_image_device::call_load()
 	std::error_condition err;
 	chd_file *chd = nullptr;
 
+	m_chd = nullptr;
 	m_cdrom_handle.reset();
 	m_dvdrom_handle.reset();
 
@@ -160,6 +166,7 @@ std::pair<std::error_condition, std::string> cdrom_image_device::call_load()
 		}
 	}
 
+	m_chd = chd;
 	return std::make_pair(std::error_condition(), std::string());
 
 error:
@@ -171,6 +178,8 @@ error:
 void cdrom_image_device::call_unload()
 {
 	assert(m_cdrom_handle || m_dvdrom_handle);
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_chd = nullptr;
 	m_cdrom_handle.reset();
 	m_dvdrom_handle.reset();
 	if (m_self_chd.opened())
@@ -200,6 +209,7 @@ uint32_t cdrom_image_device::get_track_start(uint32_t track) const
 
 bool cdrom_image_device::read_data(uint32_t lbasector, void *buffer, uint32_t datatype, bool phys)
 {
+	std::lock_guard<std::mutex> lock(m_mutex);
 	if (m_cdrom_handle)
 		return m_cdrom_handle->read_data(lbasector, buffer, datatype, phys);
 	if (m_dvdrom_handle)
@@ -209,6 +219,7 @@ bool cdrom_image_device::read_data(uint32_t lbasector, void *buffer, uint32_t da
 
 bool cdrom_image_device::read_subcode(uint32_t lbasector, void *buffer, bool phys)
 {
+	std::lock_guard<std::mutex> lock(m_mutex);
 	if (m_cdrom_handle)
 		return m_cdrom_handle->read_subcode(lbasector, buffer, phys);
 	return 0;
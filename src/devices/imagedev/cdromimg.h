@@ -19,6 +19,7 @@
 #include "dvdrom.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <system_error>
 #include <utility>
@@ -57,6 +58,7 @@ public:
 	virtual const char *file_extensions() const noexcept override { return m_extension_list; }
 	virtual const char *image_type_name() const noexcept override { return "cdrom"; }
 	virtual const char *image_brief_type_name() const noexcept override { return "cdrm"; }
+	virtual chd_file *image_chd() const noexcept override { return m_chd; }
 
 	int get_last_track() const;
 	uint32_t get_track(uint32_t frame) const;
@@ -87,8 +89,10 @@ protected:
 	bool        m_gd_compat;
 	bool        m_dvd_compat;
 	chd_file    m_self_chd;
+	chd_file    *m_chd;             // CHD the handles read from, if any
 	std::unique_ptr<cdrom_file> m_cdrom_handle;
 	std::unique_ptr<dvdrom_file> m_dvdrom_handle;
+	std::mutex  m_mutex;            // reads may come from a prefetch thread
 	const char  *m_extension_list;
 	const char  *m_interface;
 };
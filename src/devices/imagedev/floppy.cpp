@@ -546,17 +546,66 @@ std::pair<std::error_condition, const floppy_image_format_t *> floppy_image_devi
 	if(!io)
 		return{ std::errc::not_enough_memory, nullptr };
 
+	return{ std::error_condition(), identify_format(*io, nullptr) };
+}
+
+const floppy_image_format_t *floppy_image_device::identify_format(util::random_read &io, const char *filename)
+{
+	// The same image is often identified again, when swapping disks or
+	// browsing a software list, so remember the answer for its contents
+	std::string key;
+	uint64_t size;
+	if(!io.length(size) && size <= 0x4000000) {
+		util::crc32_creator crc;
+		uint8_t buffer[0x4000];
+		for(uint64_t offset = 0; offset < size; offset += sizeof(buffer)) {
+			size_t actual;
+			io.read_at(offset, buffer, std::min<uint64_t>(sizeof(buffer), size - offset), actual);
+			crc.append(buffer, actual);
+		}
+		const char *ext = filename ? strrchr(filename, '.') : nullptr;
+		key = util::string_format("%s:%x:%s", crc.finish().as_string(), size, ext ? ext : "");
+		auto const found = m_identify_cache.find(key);
+		if(found != m_identify_cache.end())
+			return found->second;
+	}
+
+	// Formats claiming the extension go first: one of them scoring every
+	// flag can't be beaten, since the others can't get FIFID_EXT, and list
+	// order still breaks ties as before
+	static constexpr int PERFECT = floppy_image_format_t::FIFID_HINT | floppy_image_format_t::FIFID_EXT | floppy_image_format_t::FIFID_SIZE | floppy_image_format_t::FIFID_SIGN | floppy_image_format_t::FIFID_STRUCT;
+	std::vector<const floppy_image_format_t *> order;
+	order.reserve(m_fif_list.size());
+	if(filename)
+		for(const floppy_image_format_t *format : m_fif_list)
+			if(format->extension_matches(filename))
+				order.push_back(format);
+	size_t const claimed = order.size();
+	for(const floppy_image_format_t *format : m_fif_list)
+		if(!filename || !format->extension_matches(filename))
+			order.push_back(format);
+
 	int best = 0;
+	size_t best_index = 0;
 	const floppy_image_format_t *best_format = nullptr;
-	for(const floppy_image_format_t *format : m_fif_list) {
-		int score = format->identify(*io, m_form_factor, m_variants);
-		if(score > best) {
+	for(size_t i = 0; i < order.size(); i++) {
+		const floppy_image_format_t *format = order[i];
+		int score = format->identify(io, m_form_factor, m_variants);
+		if(score && i < claimed)
+			score |= floppy_image_format_t::FIFID_EXT;
+		size_t const index = std::find(m_fif_list.begin(), m_fif_list.end(), format) - m_fif_list.begin();
+		if(score > best || (score && score == best && index < best_index)) {
 			best = score;
+			best_index = index;
 			best_format = format;
+			if(best == PERFECT)
+				break;
 		}
 	}
 
-	return{ std::error_condition(), best_format };
+	if(!key.empty())
+		m_identify_cache.emplace(std::move(key), best_format);
+	return best_format;
 }
 
 void floppy_image_device::init_floppy_load(bool write_supported)
@@ -592,18 +641,7 @@ std::pair<std::error_condition, std::string> floppy_image_device::call_load()
 	if(!io)
 		return std::make_pair(std::errc::not_enough_memory, std::string());
 
-	int best = 0;
-	const floppy_image_format_t *best_format = nullptr;
-	for (const floppy_image_format_t *format : m_fif_list) {
-		int score = format->identify(*io, m_form_factor, m_variants);
-		if(score && format->extension_matches(filename()))
-			score |= floppy_image_format_t::FIFID_EXT;
-		if(score > best) {
-			best = score;
-			best_format = format;
-		}
-	}
-
+	const floppy_image_format_t *best_format = identify_format(*io, filename());
 	if (!best_format)
 		return std::make_pair(image_error::INVALIDIMAGE, "Unable to identify image file format");
 
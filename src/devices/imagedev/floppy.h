@@ -177,6 +177,7 @@ protected:
 	virtual void setup_characteristics() = 0;
 
 	void init_floppy_load(bool write_supported);
+	const floppy_image_format_t *identify_format(util::random_read &io, const char *filename);
 
 	std::function<void (format_registration &fr)> m_format_registration_cb;
 	const floppy_image_format_t *m_input_format;
@@ -185,6 +186,7 @@ protected:
 	std::unique_ptr<floppy_image> m_image;
 	char                  m_extension_list[256];
 	std::vector<const floppy_image_format_t *> m_fif_list;
+	std::unordered_map<std::string, const floppy_image_format_t *> m_identify_cache; // formats found before, by contents and extension
 	std::vector<fs_info>  m_fs;
 	std::vector<const fs::manager_t *> m_fs_managers;
 	emu_timer             *m_index_timer;
@@ -24,6 +24,8 @@
 #include "multibyte.h"
 #include "opresolv.h"
 
+#include <algorithm>
+
 
 OPTION_GUIDE_START(hd_option_guide)
 	OPTION_INT('C', "cylinders",        "Cylinders")
@@ -70,6 +72,11 @@ harddisk_image_device::harddisk_image_device(const machine_config &mconfig, devi
 	, m_device_image_load(*this)
 	, m_device_image_unload(*this)
 	, m_interface(nullptr)
+	, m_work_queue(nullptr)
+	, m_prefetch_lba(0)
+	, m_prefetch_count(0)
+	, m_prefetch_valid(0)
+	, m_prefetch_pending(false)
 {
 }
 
@@ -107,6 +114,7 @@ void harddisk_image_device::device_start()
 	m_device_image_unload.resolve();
 
 	m_chd = nullptr;
+	m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
 
 	if (has_preset_images())
 		setup_current_preset_image();
@@ -116,6 +124,10 @@ void harddisk_image_device::device_start()
 
 void harddisk_image_device::device_stop()
 {
+	cancel_prefetch();
+	if (m_work_queue)
+		osd_work_queue_free(m_work_queue);
+	m_work_queue = nullptr;
 	m_hard_disk_handle.reset();
 }
 
@@ -177,6 +189,7 @@ void harddisk_image_device::call_unload()
 	if (!m_device_image_unload.isnull())
 		m_device_image_unload(*this);
 
+	cancel_prefetch();
 	m_hard_disk_handle.reset();
 
 	if (m_chd)
@@ -355,32 +368,117 @@ const hard_disk_file::info &harddisk_image_device::get_info() const
 
 bool harddisk_image_device::read(uint32_t lbasector, void *buffer)
 {
+	finish_prefetch();
+	if ((lbasector >= m_prefetch_lba) && ((lbasector - m_prefetch_lba) < m_prefetch_valid))
+	{
+		uint32_t const bytes = m_hard_disk_handle->get_info().sectorbytes;
+		std::copy_n(&m_prefetch_buffer[(lbasector - m_prefetch_lba) * bytes], bytes, reinterpret_cast<uint8_t *>(buffer));
+		return true;
+	}
 	return m_hard_disk_handle->read(lbasector, buffer);
 }
 
 bool harddisk_image_device::write(uint32_t lbasector, const void *buffer)
 {
+	// anything read ahead may be out of date now
+	cancel_prefetch();
 	return m_hard_disk_handle->write(lbasector, buffer);
 }
 
 
+/*-------------------------------------------------
+    prefetch - start reading sectors on the work
+    queue; if there's no queue, or read() wants a
+    sector that wasn't read ahead, it reads it
+    directly instead
+-------------------------------------------------*/
+
+void harddisk_image_device::prefetch(uint32_t lbasector, uint32_t count)
+{
+	cancel_prefetch();
+	if (!m_work_queue || !m_hard_disk_handle || !count)
+		return;
+
+	// enough for a full ATA transfer; larger SCSI transfers read the rest directly
+	const hard_disk_file::info &info = m_hard_disk_handle->get_info();
+	uint32_t const total = info.cylinders * info.heads * info.sectors;
+	if (lbasector >= total)
+		return;
+	count = std::min({ count, total - lbasector, uint32_t(256) });
+
+	m_prefetch_buffer.resize(size_t(count) * info.sectorbytes);
+	m_prefetch_lba = lbasector;
+	m_prefetch_count = count;
+	m_prefetch_pending = true;
+	osd_work_item_queue(m_work_queue, prefetch_async, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
+
+/*-------------------------------------------------
+    prefetch_async - work item callback that
+    reads the sectors
+-------------------------------------------------*/
+
+void *harddisk_image_device::prefetch_async(void *param, int threadid)
+{
+	harddisk_image_device &hd = *reinterpret_cast<harddisk_image_device *>(param);
+	uint32_t const bytes = hd.m_hard_disk_handle->get_info().sectorbytes;
+	uint32_t valid = 0;
+	while ((valid < hd.m_prefetch_count) && hd.m_hard_disk_handle->read(hd.m_prefetch_lba + valid, &hd.m_prefetch_buffer[valid * bytes]))
+		valid++;
+	hd.m_prefetch_valid = valid;
+	return nullptr;
+}
+
+
+/*-------------------------------------------------
+    finish_prefetch - wait for any outstanding
+    read-ahead, keeping what it read
+-------------------------------------------------*/
+
+void harddisk_image_device::finish_prefetch() const
+{
+	if (m_prefetch_pending)
+	{
+		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
+		m_prefetch_pending = false;
+	}
+}
+
+
+/*-------------------------------------------------
+    cancel_prefetch - wait for any outstanding
+    read-ahead and discard it
+-------------------------------------------------*/
+
+void harddisk_image_device::cancel_prefetch()
+{
+	finish_prefetch();
+	m_prefetch_valid = 0;
+}
+
+
 bool harddisk_image_device::set_block_size(uint32_t blocksize)
 {
+	cancel_prefetch();
 	return m_hard_disk_handle->set_block_size(blocksize);
 }
 
 std::error_condition harddisk_image_device::get_inquiry_data(std::vector<uint8_t> &data) const
 {
+	finish_prefetch();
 	return m_hard_disk_handle->get_inquiry_data(data);
 }
 
 std::error_condition harddisk_image_device::get_cis_data(std::vector<uint8_t> &data) const
 {
+	finish_prefetch();
 	return m_hard_disk_handle->get_cis_data(data);
 }
 
 std::error_condition harddisk_image_device::get_disk_key_data(std::vector<uint8_t> &data) const
 {
+	finish_prefetch();
 	return m_hard_disk_handle->get_disk_key_data(data);
 }
 
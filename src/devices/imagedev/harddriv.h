@@ -20,6 +20,7 @@
 #include <string>
 #include <system_error>
 #include <utility>
+#include <vector>
 
 
 /***************************************************************************
@@ -70,6 +71,7 @@ public:
 	virtual void call_unload() override;
 
 	virtual bool image_is_chd_type() const noexcept override { return true; }
+	virtual chd_file *image_chd() const noexcept override { return m_chd; }
 	virtual const char *image_interface() const noexcept override { return m_interface; }
 	virtual const char *file_extensions() const noexcept override { return "chd,hd,hdv,2mg,hdi"; }
 	virtual const util::option_guide &create_option_guide() const override;
@@ -78,6 +80,11 @@ public:
 	bool read(uint32_t lbasector, void *buffer);
 	bool write(uint32_t lbasector, const void *buffer);
 
+	// start reading sectors on a work queue, typically when a command
+	// starts; read() takes them from there once it gets to them
+	void prefetch(uint32_t lbasector, uint32_t count);
+	void cancel_prefetch();
+
 	bool set_block_size(uint32_t blocksize);
 
 	std::error_condition get_inquiry_data(std::vector<uint8_t> &data) const;
@@ -98,6 +105,9 @@ protected:
 	void setup_current_preset_image();
 	std::error_condition internal_load_hd();
 
+	static void *prefetch_async(void *param, int threadid);
+	void finish_prefetch() const;
+
 	chd_file        *m_chd;
 	chd_file        m_origchd;              // handle to the original CHD
 	chd_file        m_diffchd;              // handle to the diff CHD
@@ -106,6 +116,15 @@ protected:
 	load_delegate   m_device_image_load;
 	unload_delegate m_device_image_unload;
 	const char *    m_interface;
+
+	// sectors read ahead on a work queue; nothing else may touch the disk
+	// while a read is pending
+	osd_work_queue *m_work_queue;
+	std::vector<uint8_t> m_prefetch_buffer;
+	uint32_t        m_prefetch_lba;
+	uint32_t        m_prefetch_count;       // sectors requested
+	uint32_t        m_prefetch_valid;       // sectors read successfully
+	mutable bool    m_prefetch_pending;
 };
 
 // device type definition
@@ -517,6 +517,10 @@ void ata_mass_storage_device_base::read_first_sector()
 		}
 		else
 		{
+			// read in the background while the drive seeks
+			if (m_command != IDE_COMMAND_VERIFY_SECTORS && m_command != IDE_COMMAND_VERIFY_SECTORS_NORETRY)
+				prefetch_sectors(lba_address(), std::max<uint32_t>(m_sector_count, 1));
+
 			start_busy(seek_time(), PARAM_COMMAND);
 		}
 	}
@@ -46,6 +46,7 @@ protected:
 
 	virtual int read_sector(uint32_t lba, void *buffer) = 0;
 	virtual int write_sector(uint32_t lba, const void *buffer) = 0;
+	virtual void prefetch_sectors(uint32_t lba, uint32_t count) { }
 	virtual attotime seek_time();
 
 	virtual void ide_build_identify_device();
@@ -103,6 +104,7 @@ protected:
 
 	virtual int read_sector(uint32_t lba, void *buffer) override { return !m_image->exists() ? 0 : m_image->read(lba, buffer); }
 	virtual int write_sector(uint32_t lba, const void *buffer) override { return !m_image->exists() ? 0 : m_image->write(lba, buffer); }
+	virtual void prefetch_sectors(uint32_t lba, uint32_t count) override { if (m_image->exists()) m_image->prefetch(lba, count); }
 	virtual uint8_t calculate_status() override;
 
 	required_device<harddisk_image_device> m_image;
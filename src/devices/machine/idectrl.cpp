@@ -231,7 +231,8 @@ bus_master_ide_controller_device::bus_master_ide_controller_device(const machine
 	m_bus_master_status(0),
 	m_bus_master_descriptor(0),
 	m_irq(0),
-	m_dmarq(0)
+	m_dmarq(0),
+	m_dma_active(false)
 {
 }
 
@@ -378,6 +379,12 @@ void bus_master_ide_controller_device::bmdma_w(offs_t offset, uint32_t data, uin
 
 void bus_master_ide_controller_device::execute_dma()
 {
+	// DMARQ changes made by the device from inside read_dma/write_dma are
+	// picked up by the loop below rather than by a nested transfer
+	if (m_dma_active)
+		return;
+	m_dma_active = true;
+
 	write_dmack(ASSERT_LINE);
 
 	while (m_dmarq && (m_bus_master_status & IDE_BUSMASTER_STATUS_ACTIVE))
@@ -404,7 +411,11 @@ void bus_master_ide_controller_device::execute_dma()
 			LOG("New DMA descriptor: address = %08X  bytes = %04X  last = %d time: %s\n", m_dma_address, m_dma_bytes_left, m_dma_last_buffer, machine().time().as_string());
 		}
 
-		if (m_bus_master_command & 8)
+		if (m_dma_address_xor == 0)
+		{
+			execute_dma_block();
+		}
+		else if (m_bus_master_command & 8)
 		{
 			// read from ata bus
 			uint16_t data = read_dma();
@@ -412,6 +423,7 @@ void bus_master_ide_controller_device::execute_dma()
 			// write to memory
 			m_dma_space->write_byte(m_dma_address++, data & 0xff);
 			m_dma_space->write_byte(m_dma_address++, data >> 8);
+			m_dma_bytes_left -= 2;
 		}
 		else
 		{
@@ -421,10 +433,9 @@ void bus_master_ide_controller_device::execute_dma()
 
 			// write to ata bus
 			write_dma(data);
+			m_dma_bytes_left -= 2;
 		}
 
-		m_dma_bytes_left -= 2;
-
 		if (m_dma_bytes_left == 0 && m_dma_last_buffer)
 		{
 			m_bus_master_status &= ~IDE_BUSMASTER_STATUS_ACTIVE;
@@ -437,4 +448,81 @@ void bus_master_ide_controller_device::execute_dma()
 	}
 
 	write_dmack(CLEAR_LINE);
+	m_dma_active = false;
+}
+
+void bus_master_ide_controller_device::execute_dma_block()
+{
+	// move up to a sector of the current region while the device keeps
+	// DMARQ asserted, going to memory a block at a time
+	uint16_t words[256];
+	const uint32_t limit = std::min<uint32_t>(m_dma_bytes_left / 2, std::size(words));
+	uint32_t count = 0;
+
+	if (m_bus_master_command & 8)
+	{
+		while (count < limit && m_dmarq)
+			words[count++] = read_dma();
+		store_dma_words(m_dma_address, words, count);
+	}
+	else
+	{
+		load_dma_words(m_dma_address, words, limit);
+		while (count < limit && m_dmarq)
+			write_dma(words[count++]);
+	}
+
+	m_dma_address += count * 2;
+	m_dma_bytes_left -= count * 2;
+}
+
+void bus_master_ide_controller_device::load_dma_words(offs_t address, uint16_t *words, uint32_t count)
+{
+	if ((address & 2) && count)
+	{
+		*words++ = m_dma_space->read_word(address);
+		address += 2;
+		count--;
+	}
+
+	uint32_t dwords[128];
+	while (count >= 2)
+	{
+		const uint32_t chunk = std::min<uint32_t>(count / 2, std::size(dwords));
+		m_dma_space->read_block(address, dwords, chunk);
+		for (uint32_t i = 0; i < chunk; i++)
+		{
+			*words++ = dwords[i];
+			*words++ = dwords[i] >> 16;
+		}
+		address += chunk * 4;
+		count -= chunk * 2;
+	}
+
+	if (count)
+		*words = m_dma_space->read_word(address);
+}
+
+void bus_master_ide_controller_device::store_dma_words(offs_t address, const uint16_t *words, uint32_t count)
+{
+	if ((address & 2) && count)
+	{
+		m_dma_space->write_word(address, *words++);
+		address += 2;
+		count--;
+	}
+
+	uint32_t dwords[128];
+	while (count >= 2)
+	{
+		const uint32_t chunk = std::min<uint32_t>(count / 2, std::size(dwords));
+		for (uint32_t i = 0; i < chunk; i++, words += 2)
+			dwords[i] = words[0] | (uint32_t(words[1]) << 16);
+		m_dma_space->write_block(address, dwords, chunk);
+		address += chunk * 4;
+		count -= chunk * 2;
+	}
+
+	if (count)
+		m_dma_space->write_word(address, *words);
 }
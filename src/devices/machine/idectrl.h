@@ -140,6 +140,9 @@ protected:
 
 private:
 	void execute_dma();
+	void execute_dma_block();
+	void load_dma_words(offs_t address, uint16_t *words, uint32_t count);
+	void store_dma_words(offs_t address, const uint16_t *words, uint32_t count);
 
 	required_address_space m_dma_space;
 	uint8_t m_dma_address_xor;
@@ -153,6 +156,7 @@ private:
 	uint32_t m_bus_master_descriptor;
 	int m_irq;
 	int m_dmarq;
+	bool m_dma_active;
 };
 
 DECLARE_DEVICE_TYPE(BUS_MASTER_IDE_CONTROLLER, bus_master_ide_controller_device)
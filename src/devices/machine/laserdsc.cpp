@@ -88,6 +88,9 @@ laserdisc_device::laserdisc_device(const machine_config &mconfig, device_type ty
 	, m_readresult()
 	, m_chdtracks(0)
 	, m_work_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO))
+	, m_prefetch_current(nullptr)
+	, m_prefetch_history{ 0, 0, 0 }
+	, m_prefetch_running(false)
 	, m_audiosquelch(0)
 	, m_videosquelch(0)
 	, m_fieldnum(0)
@@ -320,7 +323,13 @@ void laserdisc_device::device_start()
 
 void laserdisc_device::device_stop()
 {
-	// make sure all async operations have completed
+	// drop anything still queued and let the decode in progress finish
+	{
+		std::lock_guard<std::mutex> lock(m_prefetch_mutex);
+		for (prefetch_field &field : m_prefetch)
+			if (field.m_state == prefetch_state::QUEUED)
+				field.m_state = prefetch_state::FREE;
+	}
 	if (m_disc != nullptr)
 		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
 
@@ -820,6 +829,16 @@ void laserdisc_device::init_video()
 		frame.m_visbitmap.set_palette(m_videopalette);
 	}
 
+	// fields are decoded ahead into bitmaps the size of one field
+	for (prefetch_field &field : m_prefetch)
+	{
+		field.m_state = prefetch_state::FREE;
+		field.m_hunknum = 0;
+		field.m_priority = 0;
+		field.m_bitmap.allocate(m_width, m_height);
+		field.m_samples = 0;
+	}
+
 	// allocate an empty frame of the same size
 	m_emptyframe.allocate(m_width, m_height * 2);
 	m_emptyframe.set_palette(m_videopalette);
@@ -870,6 +889,11 @@ void laserdisc_device::init_audio()
 	m_audiobufsize = m_audiomaxsamples * 4;
 	m_audiobuffer[0].resize(m_audiobufsize);
 	m_audiobuffer[1].resize(m_audiobufsize);
+	for (prefetch_field &field : m_prefetch)
+	{
+		field.m_audio[0].resize(m_audiomaxsamples);
+		field.m_audio[1].resize(m_audiomaxsamples);
+	}
 }
 
 
@@ -1020,26 +1044,6 @@ void laserdisc_device::read_track_data()
 
 	// set the video target information
 	m_avhuff_video.wrap(&frame->m_bitmap.pix(m_fieldnum), frame->m_bitmap.width(), frame->m_bitmap.height() / 2, frame->m_bitmap.rowpixels() * 2);
-	m_avhuff_config.video = &m_avhuff_video;
-
-	// set the audio target information
-	if (m_audiobufin + m_audiomaxsamples <= m_audiobufsize)
-	{
-		// if we can fit without wrapping, just read the data directly
-		m_avhuff_config.audio[0] = &m_audiobuffer[0][m_audiobufin];
-		m_avhuff_config.audio[1] = &m_audiobuffer[1][m_audiobufin];
-	}
-	else
-	{
-		// otherwise, read to the beginning of the buffer
-		m_avhuff_config.audio[0] = &m_audiobuffer[0][0];
-		m_avhuff_config.audio[1] = &m_audiobuffer[1][0];
-	}
-
-	// override if we're not decoding
-	m_avhuff_config.maxsamples = m_audiomaxsamples;
-	m_avhuff_config.actsamples = &m_audiocursamples;
-	m_audiocursamples = 0;
 
 	// set the VBI data for the new field from our precomputed data
 	if (!m_vbidata.empty())
@@ -1055,17 +1059,91 @@ void laserdisc_device::read_track_data()
 		m_metadata[m_fieldnum].line17 = m_metadata[m_fieldnum].line18 = m_metadata[m_fieldnum].line1718 = VBI_CODE_LEADIN;
 	}
 
-	// configure the codec and then read
-	m_readresult = std::errc::no_such_file_or_directory;
+	// ask for the field, and the ones likely to follow it
+	m_prefetch_current = nullptr;
 	if (m_disc && !m_videosquelch)
+		prefetch_fields(readhunk);
+}
+
+
+//-------------------------------------------------
+//  prefetch_fields - make sure the requested
+//  field is being decoded, and queue the fields
+//  after it in the current play direction
+//-------------------------------------------------
+
+void laserdisc_device::prefetch_fields(uint32_t hunknum)
+{
+	// predict from the step between frames, which also covers stills
+	// (the two fields alternate) and reverse play
+	uint32_t const *const history = m_prefetch_history;
+	int32_t const step = int32_t(hunknum - history[1]);
+	uint32_t wanted[1 + PREFETCH_AHEAD];
+	uint32_t count = 0;
+	wanted[count++] = hunknum;
+	uint32_t prev[2] = { history[0], hunknum };
+	for (int ahead = 0; ahead < PREFETCH_AHEAD; ahead++)
 	{
-		m_readresult = m_disc->codec_configure(CHD_CODEC_AVHUFF, AVHUFF_CODEC_DECOMPRESS_CONFIG, &m_avhuff_config);
-		if (!m_readresult)
+		int64_t const next = int64_t(prev[ahead & 1]) + step;
+		prev[ahead & 1] = uint32_t(next);
+		if (next < 0 || next >= int64_t(m_chdtracks) * 2)
+			break;
+		if (std::find(&wanted[0], &wanted[count], uint32_t(next)) == &wanted[count])
+			wanted[count++] = uint32_t(next);
+	}
+	m_prefetch_history[2] = m_prefetch_history[1];
+	m_prefetch_history[1] = m_prefetch_history[0];
+	m_prefetch_history[0] = hunknum;
+
+	std::lock_guard<std::mutex> lock(m_prefetch_mutex);
+
+	// anything queued but no longer wanted is dropped, as after a seek
+	for (prefetch_field &field : m_prefetch)
+		if (field.m_state == prefetch_state::QUEUED && std::find(&wanted[0], &wanted[count], field.m_hunknum) == &wanted[count])
+			field.m_state = prefetch_state::FREE;
+
+	for (uint32_t index = 0; index < count; index++)
+	{
+		// already decoded or on its way?
+		prefetch_field *field = nullptr;
+		for (prefetch_field &candidate : m_prefetch)
+			if (candidate.m_state != prefetch_state::FREE && candidate.m_hunknum == wanted[index])
+				field = &candidate;
+
+		// otherwise take a free entry, or the oldest decoded one nobody wants
+		if (field == nullptr)
 		{
-			m_queued_hunknum = readhunk;
-			m_readresult = chd_file::error::OPERATION_PENDING;
-			osd_work_item_queue(m_work_queue, read_async_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+			for (prefetch_field &candidate : m_prefetch)
+			{
+				if (candidate.m_state == prefetch_state::FREE)
+				{
+					field = &candidate;
+					break;
+				}
+				if (candidate.m_state == prefetch_state::READY && std::find(&wanted[0], &wanted[count], candidate.m_hunknum) == &wanted[count] &&
+						(field == nullptr || candidate.m_priority > field->m_priority))
+					field = &candidate;
+			}
+			if (field == nullptr)
+				continue;
+			field->m_state = prefetch_state::QUEUED;
+			field->m_hunknum = wanted[index];
 		}
+
+		// ready fields age, so the ones wanted least recently are reused first
+		field->m_priority = index;
+		if (index == 0)
+			m_prefetch_current = field;
+	}
+	for (prefetch_field &field : m_prefetch)
+		if (field.m_state == prefetch_state::READY && std::find(&wanted[0], &wanted[count], field.m_hunknum) == &wanted[count])
+			field.m_priority++;
+
+	// start decoding if nothing is
+	if (!m_prefetch_running)
+	{
+		m_prefetch_running = true;
+		osd_work_item_queue(m_work_queue, read_async_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
 	}
 }
 
@@ -1077,12 +1155,54 @@ void laserdisc_device::read_track_data()
 
 void *laserdisc_device::read_async_static(void *param, int threadid)
 {
-	laserdisc_device &ld = *reinterpret_cast<laserdisc_device *>(param);
-	ld.m_readresult = ld.m_disc->read_hunk(ld.m_queued_hunknum, nullptr);
+	reinterpret_cast<laserdisc_device *>(param)->prefetch_decode();
 	return nullptr;
 }
 
 
+//-------------------------------------------------
+//  prefetch_decode - decode queued fields, most
+//  urgent first, until none are left
+//-------------------------------------------------
+
+void laserdisc_device::prefetch_decode()
+{
+	std::unique_lock<std::mutex> lock(m_prefetch_mutex);
+	while (true)
+	{
+		prefetch_field *field = nullptr;
+		for (prefetch_field &candidate : m_prefetch)
+			if (candidate.m_state == prefetch_state::QUEUED && (field == nullptr || candidate.m_priority < field->m_priority))
+				field = &candidate;
+		if (field == nullptr)
+		{
+			m_prefetch_running = false;
+			return;
+		}
+		field->m_state = prefetch_state::DECODING;
+		uint32_t const hunknum = field->m_hunknum;
+		lock.unlock();
+
+		// only this thread touches the CHD, so the codec can be set up per field
+		avhuff_decoder::config config;
+		config.video = &field->m_bitmap;
+		config.audio[0] = &field->m_audio[0][0];
+		config.audio[1] = &field->m_audio[1][0];
+		config.maxsamples = m_audiomaxsamples;
+		config.actsamples = &field->m_samples;
+		field->m_samples = 0;
+		std::error_condition result = m_disc->codec_configure(CHD_CODEC_AVHUFF, AVHUFF_CODEC_DECOMPRESS_CONFIG, &config);
+		if (!result)
+			result = m_disc->read_hunk(hunknum, nullptr);
+
+		lock.lock();
+		field->m_result = result;
+		field->m_state = prefetch_state::READY;
+		m_prefetch_cond.notify_all();
+	}
+}
+
+
 //-------------------------------------------------
 //  process_track_data - process data from a
 //  track after it has been read
@@ -1090,14 +1210,24 @@ void *laserdisc_device::read_async_static(void *param, int threadid)
 
 void laserdisc_device::process_track_data()
 {
-	// wait for the async operation to complete
-	if (m_readresult == chd_file::error::OPERATION_PENDING)
-		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
-	assert(m_readresult != chd_file::error::OPERATION_PENDING);
+	// wait for the field to be decoded, if it isn't already
+	m_readresult = std::errc::no_such_file_or_directory;
+	m_audiocursamples = 0;
+	prefetch_field *const field = m_prefetch_current;
+	if (field != nullptr)
+	{
+		std::unique_lock<std::mutex> lock(m_prefetch_mutex);
+		m_prefetch_cond.wait(lock, [field] () { return field->m_state == prefetch_state::READY; });
+		m_readresult = field->m_result;
+		m_prefetch_current = nullptr;
+	}
 
-	// remove the video if we had an error
+	// copy the video into the frame, or remove it if we had an error
 	if (m_readresult)
 		m_avhuff_video.reset();
+	else
+		for (int y = 0; y < m_avhuff_video.height(); y++)
+			std::copy_n(&field->m_bitmap.pix(y), m_avhuff_video.width(), &m_avhuff_video.pix(y));
 
 	// count the field as read if we are successful
 	if (m_avhuff_video.valid())
@@ -1107,23 +1237,24 @@ void laserdisc_device::process_track_data()
 	}
 
 	// pass the audio to the callback
+	int16_t *audio[2] = { nullptr, nullptr };
+	if (!m_readresult)
+	{
+		m_audiocursamples = field->m_samples;
+		audio[0] = &field->m_audio[0][0];
+		audio[1] = &field->m_audio[1][0];
+	}
 	if (!m_audio_callback.isnull())
-		m_audio_callback(m_samplerate, m_audiocursamples, m_avhuff_config.audio[0], m_avhuff_config.audio[1]);
+		m_audio_callback(m_samplerate, m_audiocursamples, audio[0], audio[1]);
 
-	// shift audio data if we read it into the beginning of the buffer
-	if (m_audiocursamples != 0 && m_audiobufin != 0)
+	// append the audio to the ring buffer
+	if (m_audiocursamples != 0)
 		for (int chnum = 0; chnum < 2; chnum++)
-			if (m_avhuff_config.audio[chnum] == &m_audiobuffer[chnum][0])
-			{
-				// move data to the end
-				uint32_t samplesleft = m_audiobufsize - m_audiobufin;
-				samplesleft = std::min(samplesleft, m_audiocursamples);
-				memmove(&m_audiobuffer[chnum][m_audiobufin], &m_audiobuffer[chnum][0], samplesleft * 2);
-
-				// shift data at the beginning
-				if (samplesleft < m_audiocursamples)
-					memmove(&m_audiobuffer[chnum][0], &m_audiobuffer[chnum][samplesleft], (m_audiocursamples - samplesleft) * 2);
-			}
+		{
+			uint32_t const samplesleft = std::min(m_audiobufsize - m_audiobufin, m_audiocursamples);
+			std::copy_n(audio[chnum], samplesleft, &m_audiobuffer[chnum][m_audiobufin]);
+			std::copy_n(audio[chnum] + samplesleft, m_audiocursamples - samplesleft, &m_audiobuffer[chnum][0]);
+		}
 
 	// update the input buffer pointer
 	m_audiobufin = (m_audiobufin + m_audiocursamples) % m_audiobufsize;
@@ -19,6 +19,8 @@
 #include "avhuff.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <mutex>
 #include <system_error>
 #include <utility>
 #include <vector>
@@ -247,6 +249,21 @@ private:
 		int32_t             m_lastfield;            // last absolute field number
 	};
 
+	// a field decoded, or waiting to be decoded, ahead of playback
+	static constexpr int PREFETCH_FIELDS = 8;       // fields held decoded
+	static constexpr int PREFETCH_AHEAD = 5;        // fields predicted past the one playing
+	enum class prefetch_state : uint8_t { FREE, QUEUED, DECODING, READY };
+	struct prefetch_field
+	{
+		prefetch_state      m_state;                // where the field is in the pipeline
+		uint32_t            m_hunknum;              // CHD hunk holding the field
+		int                 m_priority;             // decode order for queued fields
+		std::error_condition m_result;              // result of the read
+		bitmap_yuy16        m_bitmap;               // decoded video
+		std::vector<int16_t> m_audio[2];            // decoded audio
+		uint32_t            m_samples;              // decoded samples per channel
+	};
+
 	// internal helpers
 	void init_disc();
 	void init_video();
@@ -258,6 +275,8 @@ private:
 	frame_data &current_frame();
 	void read_track_data();
 	static void *read_async_static(void *param, int threadid);
+	void prefetch_fields(uint32_t hunknum);
+	void prefetch_decode();
 	void process_track_data();
 	void config_load(config_type cfg_type, config_level cfg_level, util::xml::data_node const *parentnode);
 	void config_save(config_type cfg_type, util::xml::data_node *parentnode);
@@ -281,12 +300,16 @@ private:
 	int                 m_samplerate;           // audio samplerate
 	std::error_condition m_readresult;          // result of the most recent read
 	uint32_t            m_chdtracks;            // number of tracks in the CHD
-	bitmap_yuy16        m_avhuff_video;         // decompresed frame buffer
-	avhuff_decoder::config m_avhuff_config;     // decompression configuration
+	bitmap_yuy16        m_avhuff_video;         // field of the frame being filled
 
 	// async operations
 	osd_work_queue *    m_work_queue;           // work queue
-	uint32_t            m_queued_hunknum;       // queued hunk
+	prefetch_field      m_prefetch[PREFETCH_FIELDS]; // pool of decoded fields
+	prefetch_field *    m_prefetch_current;     // field to show next, or nullptr
+	uint32_t            m_prefetch_history[3];  // hunks requested last, newest first
+	bool                m_prefetch_running;     // is a work item decoding the queue?
+	std::mutex          m_prefetch_mutex;       // guards the pool states
+	std::condition_variable m_prefetch_cond;    // signalled when a field is ready
 
 	// core states
 	uint8_t             m_audiosquelch;         // audio squelch state: bit 0 = audio 1, bit 1 = audio 2
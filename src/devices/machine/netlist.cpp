@@ -23,6 +23,7 @@
 #include "romload.h"
 #include "emuopts.h"
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <string>
@@ -342,10 +343,18 @@ void netlist_mame_analog_input_device::write(const double val)
 	m_value_to_sync = val * m_mult + m_offset;
 	if (m_value_to_sync != (*m_param)())
 	{
-		machine().scheduler().synchronize(timer_expired_delegate(FUNC(netlist_mame_analog_input_device::sync_callback), this));
+		if (queue_input(m_value_to_sync))
+			nl_owner().log_csv().log_add(m_param_name, m_value_to_sync, true);
+		else
+			machine().scheduler().synchronize(timer_expired_delegate(FUNC(netlist_mame_analog_input_device::sync_callback), this));
 	}
 }
 
+void netlist_mame_analog_input_device::apply_queued_input(double value)
+{
+	m_param->set(value);
+}
+
 TIMER_CALLBACK_MEMBER(netlist_mame_analog_input_device::sync_callback)
 {
 	update_to_current_time();
@@ -359,8 +368,11 @@ void netlist_mame_int_input_device::write(const uint32_t val)
 	if (v != (*m_param)())
 	{
 		LOGDEBUG("write %s\n", this->tag());
-		machine().scheduler().synchronize(timer_expired_delegate(FUNC(netlist_mame_int_input_device::sync_callback), this), v);
-}
+		if (queue_input(v))
+			nl_owner().log_csv().log_add(m_param_name, v, false);
+		else
+			machine().scheduler().synchronize(timer_expired_delegate(FUNC(netlist_mame_int_input_device::sync_callback), this), v);
+	}
 }
 
 void netlist_mame_logic_input_device::write(const uint32_t val)
@@ -369,7 +381,10 @@ void netlist_mame_logic_input_device::write(const uint32_t val)
 	if (v != (*m_param)())
 	{
 		LOGDEBUG("write %s\n", this->tag());
-		machine().scheduler().synchronize(timer_expired_delegate(FUNC(netlist_mame_logic_input_device::sync_callback), this), v);
+		if (queue_input(v))
+			nl_owner().log_csv().log_add(m_param_name, v, false);
+		else
+			machine().scheduler().synchronize(timer_expired_delegate(FUNC(netlist_mame_logic_input_device::sync_callback), this), v);
 	}
 }
 
@@ -387,6 +402,16 @@ TIMER_CALLBACK_MEMBER(netlist_mame_logic_input_device::sync_callback)
 	m_param->set(param);
 }
 
+void netlist_mame_int_input_device::apply_queued_input(double value)
+{
+	m_param->set(int(value));
+}
+
+void netlist_mame_logic_input_device::apply_queued_input(double value)
+{
+	m_param->set(value != 0.0);
+}
+
 TIMER_CALLBACK_MEMBER(netlist_mame_ram_pointer_device::sync_callback)
 {
 	m_data = (*m_param)();
@@ -1320,6 +1345,7 @@ netlist_mame_sound_device::netlist_mame_sound_device(const machine_config &mconf
 	, m_sound_clock(clock)
 	, m_attotime_per_clock(attotime::zero)
 	, m_last_update_to_current_time(attotime::zero)
+	, m_buffered_inputs(false)
 {
 }
 
@@ -1394,6 +1420,7 @@ void netlist_mame_sound_device::device_start()
 			fatalerror("illegal input channel number %d", e.first);
 	}
 	m_inbuffer.resize(m_in.size());
+	m_queued_inputs.reserve(64);
 
 	/* initialize the stream(s) */
 	m_stream = stream_alloc(m_in.size(), m_out.size(), m_sound_clock, STREAM_DISABLE_INPUT_RESAMPLING);
@@ -1402,6 +1429,27 @@ void netlist_mame_sound_device::device_start()
 }
 
 
+void netlist_mame_sound_device::device_post_load()
+{
+	// anything queued was applied before the state was saved
+	m_queued_inputs.clear();
+
+	netlist_mame_device::device_post_load();
+}
+
+void netlist_mame_sound_device::device_pre_save()
+{
+	// bring the stream up to date, then apply what's left so the saved
+	// netlist state includes every write made so far
+	if (!m_queued_inputs.empty())
+	{
+		get_stream()->update();
+		apply_queued_inputs(nltime_from_attotime(machine().time()));
+	}
+
+	netlist_mame_device::device_pre_save();
+}
+
 void netlist_mame_sound_device::nl_register_devices(netlist::nlparse_t &parser) const
 {
 	//parser.factory().add<nld_sound_out>("NETDEV_SOUND_OUT",
@@ -1439,6 +1487,39 @@ void netlist_mame_sound_device::update_to_current_time()
 		LOGTIMING("%s : %f us before machine time\n", this->name(), (cur - mtime).as_double() * 1000000.0);
 }
 
+void netlist_mame_sound_device::queue_input(netlist_mame_sub_interface &input, double value)
+{
+	m_queued_inputs.push_back(queued_input{ machine().time(), &input, value });
+}
+
+void netlist_mame_sound_device::apply_queued_inputs(netlist::netlist_time_ext target)
+{
+	// writes from devices running at different local times can arrive
+	// out of order, so sort them first; a stable sort keeps the order
+	// of writes made at the same time
+	auto const before = [] (queued_input const &a, queued_input const &b) { return a.time < b.time; };
+	if (!std::is_sorted(m_queued_inputs.begin(), m_queued_inputs.end(), before))
+		std::stable_sort(m_queued_inputs.begin(), m_queued_inputs.end(), before);
+
+	// run the netlist up to each write that falls in this update and
+	// apply it there; later ones wait for the next update
+	auto entry = m_queued_inputs.begin();
+	for ( ; entry != m_queued_inputs.end(); ++entry)
+	{
+		const auto time = nltime_from_attotime(entry->time);
+		if (time > target)
+			break;
+
+		const auto cur(netlist().exec().time());
+		if (time > cur)
+			netlist().exec().process_queue(time - cur);
+		else if (time < cur)
+			LOGTIMING("%s : queued input %f us late\n", this->name(), (cur - time).as_double() * 1000000.0);
+		entry->input->apply_queued_input(entry->value);
+	}
+	m_queued_inputs.erase(m_queued_inputs.begin(), entry);
+}
+
 void netlist_mame_sound_device::sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
 {
 	for (auto &e : m_in)
@@ -1457,6 +1538,9 @@ void netlist_mame_sound_device::sound_stream_update(sound_stream &stream, std::v
 	// so subtract one sample period so that we only process up to the minimum
 	auto nl_target_time = nltime_from_attotime(outputs[0].end_time() - outputs[0].sample_period());
 
+	if (!m_queued_inputs.empty())
+		apply_queued_inputs(nl_target_time);
+
 	auto nltime(netlist().exec().time());
 	if (nltime < nl_target_time)
 	{
@@ -21,6 +21,7 @@
 #endif
 
 class netlist_mame_stream_output_device;
+class netlist_mame_sub_interface;
 class nld_sound_in;
 
 namespace netlist {
@@ -289,8 +290,15 @@ public:
 	}
 
 
+	// queue writes from input devices with their times and apply them in
+	// step with the stream, instead of synchronizing on each write; only
+	// suitable when nothing outside the netlist reads its outputs directly
+	netlist_mame_sound_device &set_buffered_inputs(bool buffered) { m_buffered_inputs = buffered; return *this; }
+	bool buffered_inputs() const { return m_buffered_inputs; }
+
 	inline sound_stream *get_stream() { return m_stream; }
 	void update_to_current_time();
+	void queue_input(netlist_mame_sub_interface &input, double value);
 
 	void register_stream_output(int channel, netlist_mame_stream_output_device *so);
 
@@ -301,12 +309,23 @@ protected:
 
 	// device_t overrides
 	virtual void device_start() override;
+	virtual void device_post_load() override;
+	virtual void device_pre_save() override;
 	// device_sound_interface overrides
 	virtual void sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs) override;
 	virtual void device_validity_check(validity_checker &valid) const override;
 	//virtual void device_reset() override;
 
 private:
+	struct queued_input
+	{
+		attotime time;
+		netlist_mame_sub_interface *input;
+		double value;
+	};
+
+	void apply_queued_inputs(netlist::netlist_time_ext target);
+
 	std::map<int, netlist_mame_stream_output_device *> m_out;
 	std::map<std::size_t, nld_sound_in *> m_in;
 	std::vector<netlist_mame_sound_input_buffer> m_inbuffer;
@@ -315,6 +334,8 @@ private:
 	uint32_t m_sound_clock;
 	attotime m_attotime_per_clock;
 	attotime m_last_update_to_current_time;
+	bool m_buffered_inputs;
+	std::vector<queued_input> m_queued_inputs;
 };
 
 // ----------------------------------------------------------------------------------------
@@ -344,6 +365,17 @@ public:
 
 	inline netlist_mame_device &nl_owner() const { return *m_owner; }
 
+	// called by a buffered sound device when a queued write comes due
+	virtual void apply_queued_input(double value) { }
+
+	inline bool queue_input(double value)
+	{
+		if (m_sound == nullptr || !m_sound->buffered_inputs())
+			return false;
+		m_sound->queue_input(*this, value);
+		return true;
+	}
+
 	inline void update_to_current_time()
 	{
 		if (m_sound != nullptr)
@@ -399,6 +431,7 @@ public:
 
 	virtual void validity_helper(validity_checker &valid,
 		netlist::netlist_state_t &nlstate) const override;
+	virtual void apply_queued_input(double value) override;
 protected:
 	// device-level overrides
 	virtual void device_start() override;
@@ -499,6 +532,7 @@ public:
 	void write64(uint64_t data)             { write(data);   }
 
 	virtual void validity_helper(validity_checker &valid, netlist::netlist_state_t &nlstate) const override;
+	virtual void apply_queued_input(double value) override;
 
 protected:
 	// device-level overrides
@@ -541,6 +575,7 @@ public:
 	void write64(uint64_t data)             { write(data);   }
 
 	virtual void validity_helper(validity_checker &valid, netlist::netlist_state_t &nlstate) const override;
+	virtual void apply_queued_input(double value) override;
 
 protected:
 	// device-level overrides
@@ -185,7 +185,11 @@ void pci_device::address_base_w(offs_t offset, uint32_t data)
 	else {
 		bank_infos[bid].adr = (bank_infos[bid].adr & 0xffffffff00000000U) | data;
 	}
-	remap_cb();
+
+	// while decoding is off the bank is not mapped anyway, so sizing it
+	// during enumeration does not need a remap
+	if(command & (bank_infos[bid].flags & M_IO ? 1 : 2))
+		remap_cb();
 }
 
 uint16_t pci_device::vendor_r()
@@ -901,7 +905,8 @@ device_t *pci_host_device::bus_root()
 
 void pci_host_device::device_start()
 {
-	remap_cb = mapper_cb(&pci_host_device::regenerate_mapping, this);
+	remap_cb = mapper_cb(&pci_host_device::remap_request, this);
+	m_remap_timer = timer_alloc(FUNC(pci_host_device::remap_deferred), this);
 
 	pci_bridge_device::device_start();
 
@@ -911,7 +916,15 @@ void pci_host_device::device_start()
 	reset_all_mappings();
 
 	save_item(NAME(config_address));
+	save_item(NAME(m_remap_pending));
 
+	m_remap_pending = false;
+	m_remap_requests = m_remap_count = 0;
+}
+
+void pci_host_device::device_stop()
+{
+	logerror("%u remap requests, %u remaps\n", m_remap_requests, m_remap_count);
 }
 
 void pci_host_device::device_reset()
@@ -928,8 +941,29 @@ void pci_host_device::interface_post_reset()
 	regenerate_mapping();
 }
 
+// Register writes only note that the mapping changed; the remap itself
+// runs once the current instruction completes, so a burst of BAR,
+// command and chipset writes rebuilds the handlers a single time.
+void pci_host_device::remap_request()
+{
+	m_remap_requests++;
+	if(!m_remap_pending) {
+		m_remap_pending = true;
+		m_remap_timer->adjust(attotime::zero);
+	}
+}
+
+TIMER_CALLBACK_MEMBER(pci_host_device::remap_deferred)
+{
+	if(m_remap_pending)
+		regenerate_mapping();
+}
+
 void pci_host_device::regenerate_mapping()
 {
+	m_remap_pending = false;
+	m_remap_count++;
+
 	logerror("Regenerating mapping\n");
 	memory_space->unmap_readwrite(memory_window_start, memory_window_end);
 	io_space->unmap_readwrite(io_window_start, io_window_end);
@@ -256,12 +256,15 @@ protected:
 	virtual void device_start() override;
 	virtual void device_reset() override;
 	virtual void interface_post_reset() override;
+	virtual void device_stop() override;
 
 	virtual device_t *bus_root() override;
 
 	uint32_t root_config_read(uint8_t bus, uint8_t device, uint16_t reg, uint32_t mem_mask);
 	void root_config_write(uint8_t bus, uint8_t device, uint16_t reg, uint32_t data, uint32_t mem_mask);
 
+	void remap_request();
+	TIMER_CALLBACK_MEMBER(remap_deferred);
 	void regenerate_mapping();
 
 	address_space *memory_space, *io_space;
@@ -270,6 +273,10 @@ protected:
 	uint64_t io_window_start, io_window_end, io_offset;
 
 	uint32_t config_address;
+
+	emu_timer *m_remap_timer;
+	bool m_remap_pending;
+	uint32_t m_remap_requests, m_remap_count;
 };
 
 using pci_pin_mapper = device_delegate<int (int)>;
@@ -310,6 +310,14 @@ void pit_counter_device::set_output(int output)
 }
 
 
+/* With nothing connected to OUT, edges needn't be timed; the count and
+   output are brought up to date whenever they are read. */
+bool pit_counter_device::output_observed() const
+{
+	return !downcast<pit8253_device *>(owner())->m_out_handler[m_index].isunset();
+}
+
+
 /* This emulates timer "timer" for "elapsed_cycles" cycles and assumes no
    callbacks occur during that time. */
 void pit_counter_device::simulate(int64_t elapsed_cycles)
@@ -514,6 +522,10 @@ void pit_counter_device::simulate(int64_t elapsed_cycles)
 					load_counter_value();
 					adjusted_value = adjusted_count();
 					set_output(1);
+
+					/* Unseen whole periods leave this state unchanged */
+					if (elapsed_cycles >= adjusted_value && !output_observed())
+						elapsed_cycles %= adjusted_value;
 				}
 			}
 			while (elapsed_cycles >= adjusted_value);
@@ -576,6 +588,7 @@ void pit_counter_device::simulate(int64_t elapsed_cycles)
 
 			if (elapsed_cycles > 0)
 			{
+				int64_t period_start = -1;
 				adjusted_value = adjusted_count();
 
 				do
@@ -598,6 +611,15 @@ void pit_counter_device::simulate(int64_t elapsed_cycles)
 						load_counter_value();
 						adjusted_value = adjusted_count();
 						set_output(1);
+
+						/* Unseen whole periods leave this state unchanged */
+						if (period_start > elapsed_cycles)
+						{
+							elapsed_cycles %= period_start - elapsed_cycles;
+							period_start = -1;
+						}
+						else if (period_start == -1 && !output_observed())
+							period_start = elapsed_cycles;
 					}
 				}
 				while ((m_phase == 2 && elapsed_cycles >= ((adjusted_value + 1) >> 1)) ||
@@ -692,7 +714,7 @@ void pit_counter_device::simulate(int64_t elapsed_cycles)
 		break;
 	}
 
-	if (cycles_to_output == CYCLES_NEVER || m_clockin == 0)
+	if (cycles_to_output == CYCLES_NEVER || m_clockin == 0 || !output_observed())
 		adjust_timer(attotime::never);
 	else
 		adjust_timer(m_last_updated + cycles_to_output * m_clock_period);
@@ -764,7 +786,7 @@ void pit_counter_device::update()
 	   sections punctuated by callbacks. */
 	if (elapsed_cycles > 0)
 		simulate(elapsed_cycles);
-	else if (m_clockin != 0)
+	else if (m_clockin != 0 && output_observed())
 		adjust_timer(m_last_updated + m_clock_period);
 }
 
@@ -57,6 +57,7 @@ private:
 	void decrease_counter_value(int64_t cycles);
 	void load_counter_value();
 	void set_output(int output);
+	bool output_observed() const;
 	void simulate(int64_t elapsed_cycles);
 	TIMER_CALLBACK_MEMBER(update_tick);
 	void update();
@@ -187,7 +187,28 @@ void ps2_dmac_device::transfer_gif()
 
 	channel_t &channel = m_channels[GIF];
 	const uint32_t count = channel.quadword_count();
-	if (count)
+	const uint32_t image_count = std::min({ count, m_gs->interface()->path3_image_qwords(), GIF_IMAGE_BURST });
+	if (image_count > 1)
+	{
+		// IMAGE data goes straight to GS local memory, so move a full slice at once
+		uint32_t addr = channel.addr();
+		if (BIT(addr, 31))
+			addr -= 0x10000000;
+		address_space &space = m_ee->space(AS_PROGRAM);
+		uint64_t dwords[GIF_IMAGE_BURST * 2];
+		for (uint32_t i = 0; i < image_count * 2; i++)
+		{
+			const uint32_t lo = space.read_dword(addr);
+			const uint32_t hi = space.read_dword(addr + 4);
+			dwords[i] = ((uint64_t)hi << 32) | lo;
+			addr += 8;
+		}
+		m_gs->interface()->write_path3_image(dwords, image_count);
+		channel.set_addr(channel.addr() + (image_count << 4));
+		channel.set_quadword_count(count - image_count);
+		m_icount -= image_count - 1;
+	}
+	else if (count)
 	{
 		//logerror("%s: DMAC GIF quadword count: %08x\n", machine().describe_context(), count);
 		uint32_t addr = channel.addr();
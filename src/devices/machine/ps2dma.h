@@ -118,6 +118,8 @@ protected:
 		uint32_t m_tag_addr;
 	};
 
+	static constexpr uint32_t GIF_IMAGE_BURST = 8; // quadwords per GIF IMAGE slice
+
 	void transfer_vif1();
 	void transfer_gif();
 	void transfer_sif0();
@@ -123,6 +123,7 @@ DEFINE_DEVICE_TYPE(RAM, ram_device, "ram", "RAM")
 ram_device::ram_device(const machine_config &mconfig, const char *tag, device_t *owner, u32 clock)
 	: device_t(mconfig, RAM, tag, owner, clock)
 	, m_size(0)
+	, m_pointer(nullptr)
 	, m_default_size(0)
 	, m_default_value(0xff)
 	, m_extra_options_string(nullptr)
@@ -170,9 +171,9 @@ void ram_device::device_start()
 	if (m_size == 0)
 		m_size = defsize;
 
-	// allocate space for the ram
-	m_pointer = std::make_unique<u8 []>(m_size);
-	std::fill_n(m_pointer.get(), m_size, m_default_value);
+	// allocate space for the ram; the memory manager puts it on huge pages if it's large enough
+	m_pointer = reinterpret_cast<u8 *>(machine().memory().block_alloc(*this, "ram", m_size));
+	std::fill_n(m_pointer, m_size, m_default_value);
 
 	// register for state saving
 	save_item(NAME(m_size));
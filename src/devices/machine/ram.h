@@ -69,7 +69,7 @@ private:
 
 	// device state
 	u32                         m_size;
-	std::unique_ptr<u8 []>      m_pointer;
+	u8 *                        m_pointer;      // owned by the memory manager
 
 	// device config
 	char const *                m_default_size;
@@ -58,6 +58,8 @@ void t10sbc::ExecCommand()
 		m_blocks = SCSILengthFromUINT8( &command[4] );
 
 		m_device->logerror("T10SBC: READ at LBA %x for %x blocks\n", m_lba, m_blocks);
+		if (m_image)
+			m_image->prefetch(m_lba, m_blocks);
 
 		m_phase = SCSI_PHASE_DATAIN;
 		m_status_code = SCSI_STATUS_CODE_GOOD;
@@ -105,6 +107,8 @@ void t10sbc::ExecCommand()
 		m_blocks = SCSILengthFromUINT16( &command[7] );
 
 		m_device->logerror("T10SBC: READ at LBA %x for %x blocks\n", m_lba, m_blocks);
+		if (m_image)
+			m_image->prefetch(m_lba, m_blocks);
 
 		m_phase = SCSI_PHASE_DATAIN;
 		m_status_code = SCSI_STATUS_CODE_GOOD;
@@ -127,6 +131,8 @@ void t10sbc::ExecCommand()
 		m_blocks = get_u32be(&command[6]);
 
 		m_device->logerror("T10SBC: READ at LBA %x for %x blocks\n", m_lba, m_blocks);
+		if (m_image)
+			m_image->prefetch(m_lba, m_blocks);
 
 		m_phase = SCSI_PHASE_DATAIN;
 		m_status_code = SCSI_STATUS_CODE_GOOD;
@@ -281,6 +281,7 @@ z80ctc_channel_device::z80ctc_channel_device(const machine_config &mconfig, cons
 		m_down(0),
 		m_extclk(0),
 		m_timer(nullptr),
+		m_lazy(false),
 		m_int_state(0),
 		m_zc_to_timer(nullptr)
 {
@@ -302,6 +303,8 @@ void z80ctc_channel_device::device_start()
 	save_item(NAME(m_tconst));
 	save_item(NAME(m_down));
 	save_item(NAME(m_extclk));
+	save_item(NAME(m_lazy));
+	save_item(NAME(m_lazy_start));
 	save_item(NAME(m_int_state));
 }
 
@@ -315,6 +318,7 @@ void z80ctc_channel_device::device_reset()
 	m_mode = RESET_ACTIVE;
 	m_tconst = 0x100;
 	m_timer->adjust(attotime::never);
+	m_lazy = false;
 	m_int_state = 0;
 }
 
@@ -334,8 +338,66 @@ attotime z80ctc_channel_device::period() const
 		return clocks_to_attotime(m_tconst);
 
 	// compute the period
-	attotime period = m_device->clocks_to_attotime((m_mode & PRESCALER) == PRESCALER_16 ? 16 : 256);
-	return period * m_tconst;
+	return prescaled_clock() * m_tconst;
+}
+
+
+//-------------------------------------------------
+//  prescaled_clock - return the period of one
+//  count in timer mode
+//-------------------------------------------------
+
+attotime z80ctc_channel_device::prescaled_clock() const
+{
+	return m_device->clocks_to_attotime((m_mode & PRESCALER) == PRESCALER_16 ? 16 : 256);
+}
+
+
+//-------------------------------------------------
+//  zero_observed - return whether anything sees
+//  the count reach zero
+//-------------------------------------------------
+
+bool z80ctc_channel_device::zero_observed() const
+{
+	return (m_mode & INTERRUPT) == INTERRUPT_ON || !m_device->m_zc_cb[m_index].isunset();
+}
+
+
+//-------------------------------------------------
+//  start_timer - start counting in timer mode;
+//  if neither an interrupt nor ZC/TO would see
+//  the count reach zero, just note the time and
+//  work the count out when it's read
+//-------------------------------------------------
+
+void z80ctc_channel_device::start_timer(const attotime &curperiod)
+{
+	if ((m_mode & MODE) == MODE_TIMER && !zero_observed())
+	{
+		m_timer->adjust(attotime::never);
+		m_lazy = true;
+		m_lazy_start = machine().time();
+	}
+	else
+	{
+		m_timer->adjust(curperiod, 0, curperiod);
+		m_lazy = false;
+	}
+}
+
+
+//-------------------------------------------------
+//  lazy_next_zero - return how long a lazy count
+//  has until it next reaches zero
+//-------------------------------------------------
+
+attotime z80ctc_channel_device::lazy_next_zero() const
+{
+	attotime const curperiod = period();
+	attotime const elapsed = machine().time() - m_lazy_start;
+	u32 const periods = u32(elapsed.as_double() / curperiod.as_double()) + 1;
+	return m_lazy_start + curperiod * periods - machine().time();
 }
 
 
@@ -345,6 +407,14 @@ attotime z80ctc_channel_device::period() const
 
 u8 z80ctc_channel_device::read()
 {
+	// if nothing is watching the count, work it out from when it started
+	if (m_lazy)
+	{
+		attotime const elapsed = machine().time() - m_lazy_start;
+		u64 const counts = u64(elapsed.as_double() / prescaled_clock().as_double());
+		return u8(m_tconst - (counts % m_tconst));
+	}
+
 	// if we're in counter mode, just return the count
 	if (!m_timer->enabled() || (m_mode & WAITING_FOR_TRIG))
 		return m_down;
@@ -356,7 +426,7 @@ u8 z80ctc_channel_device::read()
 		if ((m_mode & MODE) == MODE_COUNTER)
 			period = clocks_to_attotime(1);
 		else
-			period = m_device->clocks_to_attotime((m_mode & PRESCALER) == PRESCALER_16 ? 16 : 256);
+			period = prescaled_clock();
 
 		LOG("CTC clock %f\n", period.as_hz());
 
@@ -391,8 +461,7 @@ void z80ctc_channel_device::write(u8 data)
 		// if we're triggering on the time constant, reset the down counter now
 		if ((m_mode & MODE) == MODE_COUNTER || (m_mode & TRIGGER) == TRIGGER_AUTO)
 		{
-			attotime curperiod = period();
-			m_timer->adjust(curperiod, 0, curperiod);
+			start_timer(period());
 		}
 
 		// else set the bit indicating that we're waiting for the appropriate trigger
@@ -400,6 +469,7 @@ void z80ctc_channel_device::write(u8 data)
 		{
 			m_mode |= WAITING_FOR_TRIG;
 			m_timer->adjust(clocks_to_attotime(1));
+			m_lazy = false;
 		}
 
 		// also set the down counter in case we're clocking externally
@@ -426,6 +496,7 @@ void z80ctc_channel_device::write(u8 data)
 		if ((m_mode & MODE) == MODE_TIMER && (data & MODE) == MODE_COUNTER && (data & RESET) == 0)
 		{
 			m_timer->adjust(attotime::never);
+			m_lazy = false;
 		}
 
 		// if we're being reset, clear out any pending timers for this channel
@@ -434,13 +505,24 @@ void z80ctc_channel_device::write(u8 data)
 			// remember the present count
 			m_down = read();
 			m_timer->adjust(attotime::never);
+			m_lazy = false;
 			// note that we don't clear the interrupt state here!
 		}
 
+		// a lazy count that's now being watched needs its timer, in phase with the count so far
+		attotime const curperiod = m_lazy ? period() : attotime::never;
+		attotime const next = m_lazy ? lazy_next_zero() : attotime::never;
+
 		// set the new mode
 		m_mode = data;
 		LOG("Channel mode = %02x\n", data);
 
+		if (m_lazy && zero_observed())
+		{
+			m_timer->adjust(next, 0, curperiod);
+			m_lazy = false;
+		}
+
 		// clearing this bit resets the interrupt state regardless of M1 activity (or lack thereof)
 		if ((data & INTERRUPT) == INTERRUPT_OFF && (m_int_state & Z80_DAISY_INT))
 		{
@@ -472,7 +554,7 @@ void z80ctc_channel_device::trigger(bool state)
 			{
 				attotime curperiod = period();
 				LOG("Period = %s\n", curperiod.as_string());
-				m_timer->adjust(curperiod, 0, curperiod);
+				start_timer(curperiod);
 			}
 
 			// we're no longer waiting
@@ -501,7 +583,7 @@ TIMER_CALLBACK_MEMBER(z80ctc_channel_device::timer_callback)
 	{
 		attotime curperiod = period();
 		LOG("Period = %s\n", curperiod.as_string());
-		m_timer->adjust(curperiod, 0, curperiod);
+		start_timer(curperiod);
 
 		// we're no longer waiting
 		m_mode &= ~WAITING_FOR_TRIG;
@@ -58,6 +58,10 @@ protected:
 	void write(u8 data);
 
 	attotime period() const;
+	attotime prescaled_clock() const;
+	bool zero_observed() const;
+	void start_timer(const attotime &curperiod);
+	attotime lazy_next_zero() const;
 	void trigger(bool state);
 	TIMER_CALLBACK_MEMBER(timer_callback);
 	TIMER_CALLBACK_MEMBER(zc_to_callback);
@@ -69,6 +73,8 @@ protected:
 	u16             m_down;                 // down counter (clock mode only)
 	bool            m_extclk;               // current signal from the external clock
 	emu_timer *     m_timer;                // array of active timers
+	bool            m_lazy;                 // timer counting with nothing to see it reach zero
+	attotime        m_lazy_start;           // when the lazy count began
 	u8              m_int_state;            // interrupt status (for daisy chain)
 	emu_timer *     m_zc_to_timer;          // zc to pulse timer
 };
@@ -6,6 +6,12 @@
 
 #include <algorithm>
 
+
+// run the original interpreter alongside the decoded program and report
+// any difference in the registers it leaves behind
+#define VERIFY_COMPILED 0
+
+
 static u16 PACK(s32 val)
 {
 	const int sign = (val >> 23) & 0x1;
@@ -56,9 +62,203 @@ void AICADSP::init()
 	memset(this,0,sizeof(*this));
 	RBL = (8 * 1024); // Initial RBL is 0
 	Stopped = true;
+	dirty = true;
 }
 
 void AICADSP::step()
+{
+	if (Stopped)
+		return;
+
+#if VERIFY_COMPILED
+	// the memory accessors can't be copied, so run the interpreter on the
+	// live registers and put the inputs back; memory is shared and only the
+	// registers are compared
+	std::vector<s32> const temp(std::begin(TEMP), std::end(TEMP));
+	std::vector<s32> const mems(std::begin(MEMS), std::end(MEMS));
+	std::vector<s32> const mixs(std::begin(MIXS), std::end(MIXS));
+	u32 const dec = DEC;
+	interpret();
+	std::vector<s32> const reftemp(std::begin(TEMP), std::end(TEMP));
+	std::vector<s32> const refmems(std::begin(MEMS), std::end(MEMS));
+	std::vector<s16> const refefreg(std::begin(EFREG), std::end(EFREG));
+	u32 const refdec = DEC;
+	std::copy(temp.begin(), temp.end(), std::begin(TEMP));
+	std::copy(mems.begin(), mems.end(), std::begin(MEMS));
+	std::copy(mixs.begin(), mixs.end(), std::begin(MIXS));
+	DEC = dec;
+	execute();
+	if (!std::equal(std::begin(EFREG), std::end(EFREG), refefreg.begin()) ||
+			!std::equal(std::begin(TEMP), std::end(TEMP), reftemp.begin()) ||
+			!std::equal(std::begin(MEMS), std::end(MEMS), refmems.begin()) ||
+			(DEC != refdec))
+		osd_printf_error("AICADSP: decoded program differs from interpreter\n");
+#else
+	execute();
+#endif
+}
+
+void AICADSP::compile()
+{
+	for (int step = 0; step < LastStep; ++step)
+	{
+		u16 const *const IPtr = MPRO + step * 8;
+		instruction &op = program[step];
+
+		op.step  = step;
+		op.TRA   = (IPtr[0] >>  9) & 0x7F;
+		op.TWT   = BIT(IPtr[0], 8);
+		op.TWA   = (IPtr[0] >>  1) & 0x7F;
+
+		op.XSEL  = BIT(IPtr[2], 15);
+		op.YSEL  = (IPtr[2] >> 13) & 0x03;
+		op.IRA   = (IPtr[2] >>  7) & 0x3F;
+		op.IWT   = BIT(IPtr[2], 6);
+		op.IWA   = (IPtr[2] >>  1) & 0x1F;
+
+		op.TABLE = BIT(IPtr[4], 15);
+		op.MWT   = BIT(IPtr[4], 14) && (step & 1); // memory is only accessed on odd steps
+		op.MRD   = BIT(IPtr[4], 13) && (step & 1);
+		op.EWT   = BIT(IPtr[4], 12);
+		op.EWA   = (IPtr[4] >>  8) & 0x0F;
+		op.ADRL  = BIT(IPtr[4], 7);
+		op.FRCL  = BIT(IPtr[4], 6);
+		op.SHIFT = (IPtr[4] >>  4) & 0x03;
+		op.YRL   = BIT(IPtr[4], 3);
+		op.NEGB  = BIT(IPtr[4], 2);
+		op.ZERO  = BIT(IPtr[4], 1);
+		op.BSEL  = BIT(IPtr[4], 0);
+
+		op.NOFL  = BIT(IPtr[6], 15);
+		op.MASA  = (IPtr[6] >>  9) & 0x1f;
+		op.ADREB = BIT(IPtr[6], 8);
+		op.NXADR = BIT(IPtr[6], 7);
+	}
+
+	// walk backwards dropping steps that only compute an ACC nothing reads
+	bool keep[128];
+	bool acclive = false;
+	for (int i = LastStep - 1; i >= 0; --i)
+	{
+		instruction const &op = program[i];
+		bool const shifted = op.TWT || op.FRCL || op.MWT || (op.ADRL && (op.SHIFT == 3)) || op.EWT;
+		keep[i] = acclive || op.TWT || op.IWT || op.YRL || op.FRCL || op.MRD || op.MWT || op.ADRL || op.EWT;
+		if (keep[i])
+			acclive = shifted || (!op.ZERO && op.BSEL);
+	}
+
+	program_steps = 0;
+	for (int i = 0; i < LastStep; ++i)
+	{
+		if (keep[i])
+			program[program_steps++] = program[i];
+	}
+	dirty = false;
+}
+
+void AICADSP::execute()
+{
+	if (dirty)
+		compile();
+
+	std::fill(std::begin(EFREG), std::end(EFREG), 0);
+
+	s32 ACC = 0;    //26 bit
+	s32 MEMVAL = 0;
+	s32 FRC_REG = 0;    //13 bit
+	s32 Y_REG = 0;      //24 bit
+	u32 ADRS_REG = 0;  //13 bit
+
+	for (int i = 0; i < program_steps; ++i)
+	{
+		instruction const &op = program[i];
+
+		assert(op.IRA < 0x32);
+		s32 INPUTS = 0; //24 bit
+		if (op.IRA <= 0x1f)
+			INPUTS = MEMS[op.IRA];
+		else if (op.IRA <= 0x2F)
+			INPUTS = MIXS[op.IRA - 0x20] << 4;  //MIXS is 20 bit
+		else if (op.IRA <= 0x31)
+			INPUTS = EXTS[op.IRA - 0x30] << 8;  //EXTS is 16 bit
+		INPUTS = util::sext(INPUTS, 24);
+
+		if (op.IWT)
+		{
+			MEMS[op.IWA] = MEMVAL;  //MEMVAL was selected in previous MRD
+			if (op.IRA == op.IWA)
+				INPUTS = MEMVAL;
+		}
+
+		s32 const TEMPVAL = util::sext(TEMP[(op.TRA + DEC) & 0x7F], 24);
+
+		s32 B = 0;  //26 bit
+		if (!op.ZERO)
+		{
+			B = op.BSEL ? ACC : TEMPVAL;
+			if (op.NEGB)
+				B = 0 - B;
+		}
+
+		s32 const X = op.XSEL ? INPUTS : TEMPVAL;  //24 bit
+
+		s32 Y;  //13 bit
+		switch (op.YSEL)
+		{
+		case 0:  Y = FRC_REG; break;
+		case 1:  Y = COEF[op.step << 1] >> 3; break;
+		case 2:  Y = (Y_REG >> 11) & 0x1FFF; break;
+		default: Y = (Y_REG >> 4) & 0x0FFF; break;
+		}
+
+		if (op.YRL)
+			Y_REG = INPUTS;
+
+		s32 SHIFTED;    //24 bit
+		switch (op.SHIFT)
+		{
+		case 0:  SHIFTED = std::clamp<s32>(ACC, -0x00800000, 0x007FFFFF); break;
+		case 1:  SHIFTED = std::clamp<s32>(ACC * 2, -0x00800000, 0x007FFFFF); break;
+		case 2:  SHIFTED = util::sext(ACC * 2, 24); break;
+		default: SHIFTED = util::sext(ACC, 24); break;
+		}
+
+		ACC = (int)(((s64)X * (s64)util::sext(Y, 13)) >> 12) + B;
+
+		if (op.TWT)
+			TEMP[(op.TWA + DEC) & 0x7F] = SHIFTED;
+
+		if (op.FRCL)
+			FRC_REG = (op.SHIFT == 3) ? (SHIFTED & 0x0FFF) : ((SHIFTED >> 11) & 0x1FFF);
+
+		if (op.MRD || op.MWT)
+		{
+			u32 ADDR = MADRS[op.MASA << 1];
+			if (!op.TABLE)
+				ADDR += DEC;
+			if (op.ADREB)
+				ADDR += ADRS_REG & 0x0FFF;
+			if (op.NXADR)
+				ADDR++;
+			ADDR &= op.TABLE ? 0xFFFF : (RBL - 1);
+			ADDR += RBP << 10;
+			if (op.MRD)
+				MEMVAL = op.NOFL ? (cache.read_word(ADDR) << 8) : UNPACK(cache.read_word(ADDR));
+			if (op.MWT)
+				space.write_word(ADDR, op.NOFL ? u16(SHIFTED >> 8) : PACK(SHIFTED));
+		}
+
+		if (op.ADRL)
+			ADRS_REG = (op.SHIFT == 3) ? ((SHIFTED >> 12) & 0xFFF) : (INPUTS >> 16);
+
+		if (op.EWT)
+			EFREG[op.EWA] += SHIFTED >> 8;
+	}
+	--DEC;
+	std::fill(std::begin(MIXS), std::end(MIXS), 0);
+}
+
+void AICADSP::interpret()
 {
 	s32 ACC=0;    //26 bit
 	s32 MEMVAL=0;
@@ -66,9 +266,6 @@ void AICADSP::step()
 	s32 Y_REG=0;      //24 bit
 	u32 ADRS_REG=0;  //13 bit
 
-	if (Stopped)
-		return;
-
 	std::fill(std::begin(EFREG), std::end(EFREG), 0);
 #if 0
 	int dump=0;
@@ -329,4 +526,5 @@ void AICADSP::start()
 			break;
 	}
 	LastStep = i + 1;
+	dirty = true;
 }
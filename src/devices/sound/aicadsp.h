@@ -8,6 +8,14 @@
 //the DSP Context
 struct AICADSP
 {
+	// one microprogram step with its fields extracted
+	struct instruction
+	{
+		u8 step;
+		u8 TRA, TWA, IRA, IWA, EWA, MASA, SHIFT, YSEL;
+		bool TWT, XSEL, IWT, TABLE, MWT, MRD, EWT, ADRL, FRCL, YRL, NEGB, ZERO, BSEL, NOFL, ADREB, NXADR;
+	};
+
 	void init();
 	void setsample(s32 sample, u8 SEL, s32 MXL);
 	void step();
@@ -37,6 +45,16 @@ struct AICADSP
 
 	bool Stopped;
 	int LastStep;
+
+//decoded program, rebuilt from MPRO when dirty is set
+	instruction program[128];
+	int program_steps;
+	bool dirty;
+
+private:
+	void compile();
+	void execute();
+	void interpret();
 };
 
 #endif // MAME_SOUND_AICADSP_H
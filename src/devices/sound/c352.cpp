@@ -123,62 +123,138 @@ void c352_device::ramp_volume(c352_voice_t &v, int ch, u8 val)
 		v.curr_vol[ch] += (vol_delta > 0) ? -1 : 1;
 }
 
-void c352_device::sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
+sound_voice_mask<32> c352_device::busy_voices() const
+{
+	sound_voice_mask<32> busy;
+	for (int j = 0; j < 32; j++)
+		busy.set(j, m_c352_v[j].flags & C352_FLG_BUSY);
+	return busy;
+}
+
+s16 c352_device::step_voice(c352_voice_t &v)
 {
-	auto &buffer_fl = outputs[0];
-	auto &buffer_fr = outputs[1];
-	auto &buffer_rl = outputs[2];
-	auto &buffer_rr = outputs[3];
+	s16 s = 0;
 
-	for (int i = 0; i < buffer_fl.samples(); i++)
+	if (v.flags & C352_FLG_BUSY)
 	{
-		int out[4] = { 0, 0, 0, 0 };
+		s32 next_counter = v.counter + v.freq;
 
-		for (int j = 0; j < 32; j++)
+		if (next_counter & 0x10000)
 		{
-			c352_voice_t &v = m_c352_v[j];
-			s16 s = 0;
+			fetch_sample(v);
+		}
 
-			if (v.flags & C352_FLG_BUSY)
-			{
-				s32 next_counter = v.counter + v.freq;
+		if ((next_counter ^ v.counter) & 0x18000)
+		{
+			ramp_volume(v, 0, v.vol_f >> 8);
+			ramp_volume(v, 1, v.vol_f & 0xff);
+			ramp_volume(v, 2, v.vol_r >> 8);
+			ramp_volume(v, 3, v.vol_r & 0xff);
+		}
 
-				if (next_counter & 0x10000)
-				{
-					fetch_sample(v);
-				}
+		v.counter = next_counter & 0xffff;
 
-				if ((next_counter ^ v.counter) & 0x18000)
-				{
-					ramp_volume(v, 0, v.vol_f >> 8);
-					ramp_volume(v, 1, v.vol_f & 0xff);
-					ramp_volume(v, 2, v.vol_r >> 8);
-					ramp_volume(v, 3, v.vol_r & 0xff);
-				}
+		s = v.sample;
 
-				v.counter = next_counter & 0xffff;
+		// Interpolate samples
+		if ((v.flags & C352_FLG_FILTER) == 0)
+			s = v.last_sample + (v.counter * (v.sample - v.last_sample) >> 16);
+	}
 
-				s = v.sample;
+	return s;
+}
 
-				// Interpolate samples
-				if ((v.flags & C352_FLG_FILTER) == 0)
-					s = v.last_sample + (v.counter * (v.sample - v.last_sample) >> 16);
-			}
+void c352_device::mix_voice(c352_voice_t const &v, s16 s, int index)
+{
+	// Left
+	m_mix[0][index] += (((v.flags & C352_FLG_PHASEFL) ? -s : s) * v.curr_vol[0]) >> 8;
+	m_mix[2][index] += (((v.flags & C352_FLG_PHASERL) ? -s : s) * v.curr_vol[2]) >> 8;
+
+	// Right
+	m_mix[1][index] += (((v.flags & C352_FLG_PHASEFR) ? -s : s) * v.curr_vol[1]) >> 8;
+	m_mix[3][index] += (((v.flags & C352_FLG_PHASEFR) ? -s : s) * v.curr_vol[3]) >> 8;
+}
+
+int c352_device::render_run(c352_voice_t &v, int index, int count)
+{
+	// a voice that isn't busy contributes nothing and doesn't change
+	if (!(v.flags & C352_FLG_BUSY))
+		return count;
+
+	// samples are fetched and volumes ramped when the counter crosses a
+	// multiple of 0x8000, so until then only the counter moves
+	int const run = std::min<s32>(count, sound_steps_before<s32>(0x8000 - (v.counter & 0x7fff), v.freq));
+	int const vol[4] = {
+			(v.flags & C352_FLG_PHASEFL) ? -v.curr_vol[0] : v.curr_vol[0],
+			(v.flags & C352_FLG_PHASEFR) ? -v.curr_vol[1] : v.curr_vol[1],
+			(v.flags & C352_FLG_PHASERL) ? -v.curr_vol[2] : v.curr_vol[2],
+			(v.flags & C352_FLG_PHASEFR) ? -v.curr_vol[3] : v.curr_vol[3] };
+	bool const interpolate = (v.flags & C352_FLG_FILTER) == 0;
+
+	u32 counter = v.counter;
+	for (int i = index; i < index + run; i++)
+	{
+		counter += v.freq;
+		s16 const s = interpolate ? s16(v.last_sample + (counter * (v.sample - v.last_sample) >> 16)) : v.sample;
+		m_mix[0][i] += (s * vol[0]) >> 8;
+		m_mix[1][i] += (s * vol[1]) >> 8;
+		m_mix[2][i] += (s * vol[2]) >> 8;
+		m_mix[3][i] += (s * vol[3]) >> 8;
+	}
+	v.counter = counter;
 
-			// Left
-			out[0] += (((v.flags & C352_FLG_PHASEFL) ? -s : s) * v.curr_vol[0]) >> 8;
-			out[2] += (((v.flags & C352_FLG_PHASERL) ? -s : s) * v.curr_vol[2]) >> 8;
+	return run;
+}
 
-			// Right
-			out[1] += (((v.flags & C352_FLG_PHASEFR) ? -s : s) * v.curr_vol[1]) >> 8;
-			out[3] += (((v.flags & C352_FLG_PHASEFR) ? -s : s) * v.curr_vol[3]) >> 8;
+void c352_device::sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
+{
+	int const samples = outputs[0].samples();
+	for (auto &mix : m_mix)
+		mix.assign(samples, 0);
+
+	// idle voices contribute nothing, so only visit the busy ones; a voice
+	// that ends during the update contributes nothing from then on
+	sound_voice_mask<32> const busy = busy_voices();
+
+	// noise voices share the generator, so with more than one of them the
+	// samples have to be fetched in order; otherwise each voice is rendered
+	// across the whole update in runs between the points where it fetches
+	// a sample or ramps its volume
+	int noise_voices = 0;
+	busy.for_each([this, &noise_voices] (unsigned j) { noise_voices += (m_c352_v[j].flags & C352_FLG_NOISE) ? 1 : 0; });
+
+	if (noise_voices > 1)
+	{
+		for (int i = 0; i < samples; i++)
+		{
+			busy.for_each([this, i] (unsigned j)
+			{
+				c352_voice_t &v = m_c352_v[j];
+				mix_voice(v, step_voice(v), i);
+			});
 		}
+	}
+	else
+	{
+		busy.for_each([this, samples] (unsigned j)
+		{
+			c352_voice_t &v = m_c352_v[j];
+			sound_render_runs(samples,
+					[this, &v] (int index, int count) { return render_run(v, index, count); },
+					[this, &v] (int index) { mix_voice(v, step_voice(v), index); });
+		});
+	}
 
-		buffer_fl.put_int(i, s16(out[0] >> 3), 32768);
-		buffer_fr.put_int(i, s16(out[1] >> 3), 32768);
-		buffer_rl.put_int(i, s16(out[2] >> 3), 32768);
-		buffer_rr.put_int(i, s16(out[3] >> 3), 32768);
+	for (int i = 0; i < samples; i++)
+	{
+		outputs[0].put_int(i, s16(m_mix[0][i] >> 3), 32768);
+		outputs[1].put_int(i, s16(m_mix[1][i] >> 3), 32768);
+		outputs[2].put_int(i, s16(m_mix[2][i] >> 3), 32768);
+		outputs[3].put_int(i, s16(m_mix[3][i] >> 3), 32768);
 	}
+
+	// with nothing busy, the stream can skip updates until the next keyon
+	busy_voices().apply(stream);
 }
 
 u16 c352_device::read(offs_t offset)
@@ -351,6 +427,9 @@ void c352_device::write(offs_t offset, u16 data, u16 mem_mask)
 			}
 		}
 	}
+
+	// keyons, keyoffs and flag writes can all change what's sounding
+	busy_voices().apply(*m_stream);
 }
 
 void c352_device::device_clock_changed()
@@ -414,4 +493,11 @@ void c352_device::device_reset()
 	// init noise generator
 	m_random = 0x1234;
 	m_control = 0;
+
+	busy_voices().apply(*m_stream);
+}
+
+void c352_device::device_post_load()
+{
+	busy_voices().apply(*m_stream);
 }
@@ -36,6 +36,7 @@ protected:
 	// device-level overrides
 	virtual void device_start() override;
 	virtual void device_reset() override;
+	virtual void device_post_load() override;
 	virtual void device_clock_changed() override;
 
 	// device_sound_interface overrides
@@ -90,6 +91,10 @@ private:
 
 	void fetch_sample(c352_voice_t &v);
 	void ramp_volume(c352_voice_t &v, int ch, u8 val);
+	s16 step_voice(c352_voice_t &v);
+	void mix_voice(c352_voice_t const &v, s16 s, int index);
+	int render_run(c352_voice_t &v, int index, int count);
+	sound_voice_mask<32> busy_voices() const;
 
 	sound_stream *m_stream;
 
@@ -97,6 +102,7 @@ private:
 	int m_divider;
 
 	c352_voice_t m_c352_v[32];
+	std::vector<int> m_mix[4];
 
 	s16 m_mulawtab[256];
 
@@ -3,6 +3,10 @@
 /*
     CD-DA "Red Book" audio sound hardware handler
     Relies on the actual CD logic and reading in cdrom.c.
+
+    While a track plays, the next few sectors are read (and, for CHDs,
+    decompressed) on a work queue, so reaching new data doesn't stall
+    the stream update.  Seeks and disc changes discard the read-ahead.
 */
 
 #include "emu.h"
@@ -28,6 +32,8 @@ void cdda_device::device_start()
 {
 	/* allocate an audio cache */
 	m_audio_cache = std::make_unique<uint8_t[]>(cdrom_file::MAX_SECTOR_DATA * MAX_SECTORS );
+	m_prefetch_cache = std::make_unique<uint8_t[]>(cdrom_file::MAX_SECTOR_DATA * MAX_SECTORS );
+	m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
 
 	m_stream = stream_alloc(0, 2, clock());
 
@@ -53,6 +59,100 @@ void cdda_device::device_start()
 }
 
 
+//-------------------------------------------------
+//  device_stop - device-specific shutdown
+//-------------------------------------------------
+
+void cdda_device::device_stop()
+{
+	cancel_prefetch();
+	osd_work_queue_free(m_work_queue);
+	m_work_queue = nullptr;
+}
+
+
+//-------------------------------------------------
+//  device_post_load - device-specific post-load
+//-------------------------------------------------
+
+void cdda_device::device_post_load()
+{
+	// the read-ahead belongs to the state we left
+	cancel_prefetch();
+	if (m_audio_playing)
+		prefetch(m_audio_lba, std::min<uint32_t>(m_audio_length, MAX_SECTORS));
+}
+
+
+/*-------------------------------------------------
+    prefetch - start reading sectors ahead of
+    playback on the work queue
+-------------------------------------------------*/
+
+void cdda_device::prefetch(uint32_t lba, uint32_t sectors)
+{
+	cancel_prefetch();
+	if (sectors == 0 || !m_disc->exists())
+		return;
+
+	m_prefetch_lba = lba;
+	m_prefetch_sectors = sectors;
+	m_prefetch_sequence = m_disc->sequence_counter();
+	m_prefetch_pending = true;
+	osd_work_item_queue(m_work_queue, prefetch_async, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
+
+/*-------------------------------------------------
+    prefetch_async - work item callback that
+    reads the sectors
+-------------------------------------------------*/
+
+void *cdda_device::prefetch_async(void *param, int threadid)
+{
+	cdda_device &cdda = *reinterpret_cast<cdda_device *>(param);
+	for (uint32_t i = 0; i < cdda.m_prefetch_sectors; i++)
+		cdda.m_disc->read_data(cdda.m_prefetch_lba + i, &cdda.m_prefetch_cache[cdrom_file::MAX_SECTOR_DATA*i], cdrom_file::CD_TRACK_AUDIO);
+	return nullptr;
+}
+
+
+/*-------------------------------------------------
+    take_prefetch - wait for the read-ahead and
+    move it into the audio cache if it holds the
+    requested sectors of the current disc
+-------------------------------------------------*/
+
+bool cdda_device::take_prefetch(uint32_t lba, uint32_t sectors)
+{
+	if (!m_prefetch_pending)
+		return false;
+
+	cancel_prefetch();
+	if (m_prefetch_lba != lba || m_prefetch_sectors != sectors || m_prefetch_sequence != m_disc->sequence_counter())
+		return false;
+
+	// copied rather than swapped, since the audio cache is registered for saving
+	std::copy_n(&m_prefetch_cache[0], cdrom_file::MAX_SECTOR_DATA * sectors, &m_audio_cache[0]);
+	return true;
+}
+
+
+/*-------------------------------------------------
+    cancel_prefetch - wait for any outstanding
+    read-ahead and discard it
+-------------------------------------------------*/
+
+void cdda_device::cancel_prefetch()
+{
+	if (m_prefetch_pending)
+	{
+		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
+		m_prefetch_pending = false;
+	}
+}
+
+
 /*-------------------------------------------------
     cdda_start_audio - begin playback of a Red
     Book audio track
@@ -67,6 +167,9 @@ void cdda_device::start_audio(uint32_t startlba, uint32_t numblocks)
 	m_audio_lba = startlba;
 	m_audio_length = numblocks;
 	m_audio_samples = 0;
+
+	// start on the first sectors while the drive finishes seeking
+	prefetch(startlba, std::min<uint32_t>(numblocks, MAX_SECTORS));
 }
 
 
@@ -80,6 +183,7 @@ void cdda_device::stop_audio()
 	m_stream->update();
 	m_audio_playing = false;
 	m_audio_ended_normally = true;
+	cancel_prefetch();
 }
 
 
@@ -201,18 +305,22 @@ void cdda_device::get_audio_data(write_stream_view &bufL, write_stream_view &buf
 				sectors = MAX_SECTORS;
 			}
 
-			for (i = 0; i < sectors; i++)
+			/* read the sectors here only if the read-ahead doesn't have them */
+			if (!take_prefetch(m_audio_lba, sectors))
 			{
-				m_disc->read_data(m_audio_lba, &m_audio_cache[cdrom_file::MAX_SECTOR_DATA*i], cdrom_file::CD_TRACK_AUDIO);
-
-				m_audio_lba++;
+				for (i = 0; i < sectors; i++)
+					m_disc->read_data(m_audio_lba + i, &m_audio_cache[cdrom_file::MAX_SECTOR_DATA*i], cdrom_file::CD_TRACK_AUDIO);
 			}
 
+			m_audio_lba += sectors;
 			m_audio_samples = (cdrom_file::MAX_SECTOR_DATA*sectors)/4;
 			m_audio_length -= sectors;
 
 			/* reset feedout ptr */
 			m_audio_bptr = 0;
+
+			/* and start on the sectors after these */
+			prefetch(m_audio_lba, std::min<uint32_t>(m_audio_length, MAX_SECTORS));
 		}
 	}
 }
@@ -237,6 +345,11 @@ cdda_device::cdda_device(const machine_config &mconfig, const char *tag, device_
 	, device_sound_interface(mconfig, *this)
 	, m_disc(*this, finder_base::DUMMY_TAG)
 	, m_stream(nullptr)
+	, m_work_queue(nullptr)
+	, m_prefetch_lba(0)
+	, m_prefetch_sectors(0)
+	, m_prefetch_sequence(0)
+	, m_prefetch_pending(false)
 	, m_audio_end_cb(*this)
 {
 }
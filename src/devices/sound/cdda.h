@@ -30,6 +30,8 @@ public:
 protected:
 	// device-level overrides
 	virtual void device_start() override;
+	virtual void device_stop() override;
+	virtual void device_post_load() override;
 
 	// sound stream update overrides
 	virtual void sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs) override;
@@ -37,6 +39,11 @@ protected:
 private:
 	void get_audio_data(write_stream_view &bufL, write_stream_view &bufR);
 
+	static void *prefetch_async(void *param, int threadid);
+	void prefetch(uint32_t lba, uint32_t sectors);
+	bool take_prefetch(uint32_t lba, uint32_t sectors);
+	void cancel_prefetch();
+
 	required_device<cdrom_image_device> m_disc;
 
 	// internal state
@@ -52,6 +59,13 @@ private:
 
 	uint32_t              m_sequence_counter;
 
+	// the sectors after the cache, read ahead of playback on a work queue
+	osd_work_queue *      m_work_queue;
+	std::unique_ptr<uint8_t[]>   m_prefetch_cache;
+	uint32_t              m_prefetch_lba, m_prefetch_sectors;
+	uint32_t              m_prefetch_sequence;
+	bool                  m_prefetch_pending;
+
 	devcb_write_line m_audio_end_cb;
 };
 
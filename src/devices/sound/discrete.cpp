@@ -40,6 +40,7 @@
 
 #include "wavwrite.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdarg>
 #include <iostream>
@@ -55,18 +56,13 @@ DEFINE_DEVICE_TYPE(DISCRETE, discrete_sound_device, "discrete", "Discrete Sound"
  *************************************/
 
 /*
- * Normally, the discrete core processes 960 samples per update.
- * With the various buffers involved, this on a Core2 is not as
- * performant as processing 240 samples 4 times.
- * The setting most probably depends on CPU and which modules are
- * run and how many tasks are defined.
- *
- * Values < 32 exhibit poor performance (too much overhead) while
- * Values > 500 have a slightly worse performace (too much cache misses?).
+ * Tasks are scheduled by their dependencies: each one runs the whole
+ * update's samples once every task it reads from has finished, so no
+ * worker ever waits on another.  Tasks are grouped into waves at start,
+ * wave 0 reading no other task, wave n reading at most wave n - 1 and
+ * below; the profiling report lists them by wave.
  */
 
-static constexpr int MAX_SAMPLES_PER_TASK_SLICE = 960 / 4;
-
 /*************************************
  *
  *  Debugging
@@ -91,19 +87,10 @@ static constexpr int MAX_SAMPLES_PER_TASK_SLICE = 960 / 4;
 
 struct output_buffer
 {
-	output_buffer() : source(nullptr), ptr(nullptr)
-	{
-	}
-
-	// required for use in vector (std::atomic<T> has deleted copy constructor)
-	output_buffer(output_buffer &&that) : node_buf(std::move(that.node_buf)), source(that.source), ptr(that.ptr.load(std::memory_order_relaxed)), node_num(that.node_num)
-	{
-	}
-
 	std::unique_ptr<double []>  node_buf;
-	const double *              source;
-	std::atomic<double *>       ptr;
-	int                         node_num;
+	const double *              source = nullptr;
+	double *                    ptr = nullptr;
+	int                         node_num = 0;
 };
 
 struct input_buffer
@@ -116,7 +103,7 @@ struct input_buffer
 class discrete_task
 {
 public:
-	discrete_task(discrete_device &pdev) : m_device(pdev), m_threadid(-1), m_samples(0)
+	discrete_task(discrete_device &pdev) : m_device(pdev), m_samples(0), m_dependencies(0), m_pending(0), m_wave(0), m_run_time(0)
 	{
 		// FIXME: the code expects to be able to take pointers to members of elements of this vector before it's filled
 		source_list.reserve(16);
@@ -124,9 +111,15 @@ public:
 
 	void check(discrete_task &dest_task);
 	void prepare_for_queue(int samples);
+	void propagate_wave();
 
 	static void *task_callback(void *param, int threadid);
 
+	// tasks reading no other task's outputs can be queued straight away
+	bool ready() const { return m_dependencies == 0; }
+	int wave() const { return m_wave; }
+	osd_ticks_t run_time() const { return m_run_time; }
+
 	//const linked_list_entry *list;
 	discrete_device::node_step_list_t        step_list;
 
@@ -134,18 +127,7 @@ public:
 
 private:
 	void step_nodes();
-	bool process();
-
-	bool lock_threadid(int32_t threadid)
-	{
-		int expected = -1;
-		return m_threadid.compare_exchange_strong(expected, threadid, std::memory_order_acquire, std::memory_order_relaxed);
-	}
-
-	void unlock()
-	{
-		m_threadid.store(-1, std::memory_order_release);
-	}
+	void process();
 
 	/* list of source nodes */
 	std::vector<input_buffer> source_list;      /* discrete_source_node */
@@ -153,8 +135,14 @@ private:
 	std::vector<output_buffer>  m_buffers;
 	discrete_device &           m_device;
 
-	std::atomic<int32_t>        m_threadid;
 	int                         m_samples;
+
+	/* scheduling */
+	std::vector<discrete_task *> m_dependents;  /* tasks reading our outputs */
+	int                         m_dependencies; /* tasks we read outputs from */
+	std::atomic<int>            m_pending;      /* of those, not yet finished this update */
+	int                         m_wave;         /* position in the wave schedule */
+	osd_ticks_t                 m_run_time;     /* wall time spent running, when profiling */
 };
 
 
@@ -211,78 +199,56 @@ inline void discrete_task::step_nodes()
 
 	// buffer the outputs
 	for (output_buffer &outbuf : m_buffers)
-		*outbuf.ptr.load(std::memory_order_relaxed) = *outbuf.source;
-	std::atomic_thread_fence(std::memory_order_release);
-	for (output_buffer &outbuf : m_buffers)
-		outbuf.ptr.store(outbuf.ptr.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		*outbuf.ptr++ = *outbuf.source;
 }
 
 void *discrete_task::task_callback(void *param, int threadid)
 {
-	const auto &list = *reinterpret_cast<const discrete_sound_device::task_list_t *>(param);
-	while (true)
-	{
-		for (const auto &task : list)
-		{
-			// try to lock
-			if (task->lock_threadid(threadid))
-			{
-				if (!task->process())
-					return nullptr;
-				task->unlock();
-			}
-		}
-	}
+	discrete_task &task = *reinterpret_cast<discrete_task *>(param);
+	task.process();
+
+	// queue the dependents that were only waiting for us; this happens
+	// before our item completes, so the device's wait can't end early
+	for (discrete_task *dest : task.m_dependents)
+		if (dest->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			osd_work_item_queue(task.m_device.m_queue, discrete_task::task_callback, dest, WORK_ITEM_FLAG_AUTO_RELEASE);
 
 	return nullptr;
 }
 
-inline bool discrete_task::process()
+inline void discrete_task::process()
 {
-	int samples = std::min(m_samples, MAX_SAMPLES_PER_TASK_SLICE);
+	osd_ticks_t const start = m_device.profiling() ? get_profile_ticks() : 0;
 
-	// check dependencies
-	for (input_buffer &sn : source_list)
-	{
-		const int avail = sn.linked_outbuf->ptr.load(std::memory_order_relaxed) - sn.ptr;
-		if (avail < 0)
-			throw emu_fatalerror("discrete_task::process: available samples are negative");
-		if (avail < samples)
-			samples = avail;
-	}
-	std::atomic_thread_fence(std::memory_order_acquire);
-
-	m_samples -= samples;
-	if (m_samples < 0)
-		throw emu_fatalerror("discrete_task::process: m_samples got negative");
-	while (samples > 0)
-	{
-		// step
+	// every task we read from has finished, so all our input samples are there
+	for (int samples = m_samples; samples > 0; samples--)
 		step_nodes();
-		samples--;
-	}
-	if (m_samples == 0)
-	{
-		// return and keep the task locked so it is not picked up by other worker threads
-		return false;
-	}
-	return true;
+
+	if (m_device.profiling())
+		m_run_time += get_profile_ticks() - start;
 }
 
 void discrete_task::prepare_for_queue(int samples)
 {
-	m_threadid.store(-1, std::memory_order_relaxed); // unlock the thread
 	m_samples = samples;
+	m_pending.store(m_dependencies, std::memory_order_relaxed);
 
 	// set up task buffers
 	for (output_buffer &ob : m_buffers)
-		ob.ptr.store(ob.node_buf.get(), std::memory_order_relaxed);
+		ob.ptr = ob.node_buf.get();
 
 	// initialize sources
 	for (input_buffer &sn : source_list)
 		sn.ptr = sn.linked_outbuf->node_buf.get();
 }
 
+void discrete_task::propagate_wave()
+{
+	// called in task group order, which puts every source before its dependents
+	for (discrete_task *dest : m_dependents)
+		dest->m_wave = std::max(dest->m_wave, m_wave + 1);
+}
+
 void discrete_task::check(discrete_task &dest_task)
 {
 	// FIXME: this function takes addresses of elements of a vector that has items added later
@@ -326,7 +292,7 @@ void discrete_task::check(discrete_task &dest_task)
 							output_buffer buf;
 
 							buf.node_buf = std::make_unique<double []>((task_node->sample_rate() + sound_manager::STREAMS_UPDATE_FREQUENCY) / sound_manager::STREAMS_UPDATE_FREQUENCY);
-							buf.ptr.store(buf.node_buf.get(), std::memory_order_relaxed);
+							buf.ptr = buf.node_buf.get();
 							buf.source = dest_node->m_input[inputnum];
 							buf.node_num = inputnode_num;
 							//buf.node = device->discrete_find_node(inputnode);
@@ -335,6 +301,13 @@ void discrete_task::check(discrete_task &dest_task)
 						}
 						m_device.discrete_log("dso_task_start - buffering %d(%d) in task %p group %d referenced by %d group %d", NODE_INDEX(inputnode_num), NODE_CHILD_NODE_NUM(inputnode_num), this, task_group, dest_node->index(), dest_task.task_group);
 
+						/* note the dependency once per task pair */
+						if (std::find(m_dependents.begin(), m_dependents.end(), &dest_task) == m_dependents.end())
+						{
+							m_dependents.push_back(&dest_task);
+							dest_task.m_dependencies++;
+						}
+
 						/* register into source list */
 						dest_task.source_list.push_back(input_buffer{ nullptr, pbuf, 0.0 });
 						// FIXME: taking address of element of vector before it's filled
@@ -655,13 +628,19 @@ void discrete_device::display_profiling()
 				osd_printf_info("%3d: %20s %8.2f %10.2f\n", node->index(), node->module_name(), double(step->run_time) / double(total) * 100.0, double(step->run_time) / double(m_total_samples));
 	}
 
-	/* Task information */
+	/* Task information: share of node time, node time per sample, and wall
+	   time per update including the buffering around the nodes */
+	int waves = 0;
 	for (const auto &task : task_list)
-	{
-		double tt = step_list_run_time(task->step_list);
+		waves = std::max(waves, task->wave() + 1);
+	for (int wave = 0; wave < waves; wave++)
+		for (const auto &task : task_list)
+			if (task->wave() == wave)
+			{
+				double tt = step_list_run_time(task->step_list);
 
-		osd_printf_info("Task(%d): %8.2f %15.2f\n", task->task_group, tt / double(total) * 100.0, tt / double(m_total_samples));
-	}
+				osd_printf_info("Task(%d) wave %d: %8.2f %15.2f %15.2f\n", task->task_group, wave, tt / double(total) * 100.0, tt / double(m_total_samples), double(task->run_time()) / double(m_total_stream_updates));
+			}
 
 	osd_printf_info("Average samples/double->update: %8.2f\n", double(m_total_samples) / double(m_total_stream_updates));
 }
@@ -915,6 +894,14 @@ void discrete_device::device_start()
 				dest_task->check(*task);
 		}
 	}
+
+	/* and compute the wave schedule; a task only reads from lower groups */
+	std::vector<discrete_task *> by_group;
+	for (const auto &task : task_list)
+		by_group.push_back(task.get());
+	std::stable_sort(by_group.begin(), by_group.end(), [] (discrete_task const *a, discrete_task const *b) { return a->task_group < b->task_group; });
+	for (discrete_task *task : by_group)
+		task->propagate_wave();
 }
 
 void discrete_device::device_stop()
@@ -1028,15 +1015,21 @@ void discrete_device::process(int samples)
 	// Set up tasks
 	for (const auto &task : task_list)
 		task->prepare_for_queue(samples);
-	std::atomic_thread_fence(std::memory_order_release);
 
-	for (const auto &task : task_list)
+	if (task_list.size() == 1)
+	{
+		// nothing to run in parallel
+		discrete_task::task_callback(task_list.front().get(), 0);
+	}
+	else
 	{
-		// Fire a work item for each task
-		(void)task;
-		osd_work_item_queue(m_queue, discrete_task::task_callback, (void *)&task_list, WORK_ITEM_FLAG_AUTO_RELEASE);
+		// fire a work item for each task that doesn't wait on another; the
+		// rest are queued as their sources finish
+		for (const auto &task : task_list)
+			if (task->ready())
+				osd_work_item_queue(m_queue, discrete_task::task_callback, task.get(), WORK_ITEM_FLAG_AUTO_RELEASE);
+		osd_work_queue_wait(m_queue, osd_ticks_per_second() * 10);
 	}
-	osd_work_queue_wait(m_queue, osd_ticks_per_second() * 10);
 
 	if (m_profiling)
 	{
@@ -4178,6 +4178,8 @@ class discrete_sound_output_interface;
 
 class discrete_device : public device_t
 {
+	friend class discrete_task;
+
 protected:
 	// construction/destruction
 	discrete_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
@@ -1005,80 +1005,170 @@ inline void es550x_device::generate_irq(es550x_voice *voice, int v)
 
 /**********************************************************************************************
 
-     generate_samples -- tell each voice to generate samples
+     generate_run -- generate as many samples as possible without loop end checks
 
 ***********************************************************************************************/
 
-void es5506_device::generate_samples(std::vector<write_stream_view> &outputs)
+int es550x_device::generate_run(es550x_voice *voice, s32 *dest, int count, bool ulaw)
 {
-	// loop while we still have samples to generate
-	for (int sampindex = 0; sampindex < outputs[0].samples(); sampindex++)
+	// a stopped voice only has its envelope left to run, and then does nothing
+	if (voice->control & CONTROL_STOPMASK)
 	{
-		// loop over voices
-		s32 cursample[12] = { 0 };
-		for (int v = 0; v <= m_active_voices; v++)
+		for (int i = 0; (i < count) && (voice->ecount != 0); i++)
+			update_envelopes(voice);
+		voice->accum &= m_address_acc_mask;
+		return count;
+	}
+
+	// run up to the sample that takes the accumulator past the loop end
+	const u32 freqcount = voice->freqcount;
+	const bool reverse = voice->control & CONTROL_DIR;
+	u64 accum = voice->accum & m_address_acc_mask;
+	const s64 distance = reverse ? (s64(accum) - s64(voice->start) + 1) : (s64(voice->end) - s64(accum) + 1);
+	const int samples = std::min<s64>(count, sound_steps_before<s64>(distance, freqcount));
+
+	for (int i = 0; i < samples; i++, dest += MAX_OUTPUTS)
+	{
+		// fetch two samples
+		s32 val1 = read_sample(voice, get_integer_addr(accum));
+		s32 val2 = read_sample(voice, get_integer_addr(accum, 1));
+
+		// decompress u-law or sign-extend PCM
+		if (ulaw)
 		{
-			es550x_voice *voice = &m_voice[v];
+			val1 = m_ulaw_lookup[val1 >> (16 - ULAW_MAXBITS)];
+			val2 = m_ulaw_lookup[val2 >> (16 - ULAW_MAXBITS)];
+		}
+		else
+		{
+			val1 = s16(val1);
+			val2 = s16(val2);
+		}
 
-			// special case: if end == start, stop the voice
-			if (voice->start == voice->end)
-				voice->control |= CONTROL_STOP0;
+		// interpolate
+		val1 = interpolate(val1, val2, accum);
+		accum = (reverse ? (accum - freqcount) : (accum + freqcount)) & m_address_acc_mask;
+
+		// apply filters
+		apply_filters(voice, val1);
+
+		// update filters/volumes
+		if (voice->ecount != 0)
+			update_envelopes(voice);
+
+		// apply volumes and add
+		dest[0] += get_sample(val1, voice->lvol);
+		dest[1] += get_sample(val1, voice->rvol);
+	}
+
+	voice->accum = accum;
+	return samples;
+}
+
+
+/**********************************************************************************************
+
+     render_voices -- generate samples for all the active voices
+
+***********************************************************************************************/
+
+void es550x_device::render_voices(std::vector<write_stream_view> &outputs, bool ulaw)
+{
+	const int samples = outputs[0].samples();
+	m_mix.assign(samples * MAX_OUTPUTS, 0);
+
+	// the first voice to raise an interrupt latches its number into IRQV, so
+	// voices that can do that are run in step with each other; the others
+	// only affect their own output, so each of them is rendered in runs
+	// between the points where it reaches a loop end
+	u32 irq_voices = 0;
+	for (int v = 0; v <= m_active_voices; v++)
+	{
+		es550x_voice *voice = &m_voice[v];
+		const bool compressed = ulaw && (voice->control & CONTROL_CMPD);
+		s32 *const dest = &m_mix[get_ca(voice->control) % m_channels << 1];
+
+		if (voice->control & (CONTROL_IRQE | CONTROL_IRQ))
+		{
+			irq_voices |= 1U << v;
+			continue;
+		}
 
-			const int voice_channel = get_ca(voice->control);
-			const int channel = voice_channel % m_channels;
-			const int l = channel << 1;
+		sound_render_runs(samples,
+				[this, voice, dest, compressed] (int index, int count) { return generate_run(voice, &dest[index * MAX_OUTPUTS], count, compressed); },
+				[this, voice, dest, compressed] (int index)
+				{
+					if (compressed)
+						generate_ulaw(voice, &dest[index * MAX_OUTPUTS]);
+					else
+						generate_pcm(voice, &dest[index * MAX_OUTPUTS]);
+				});
+	}
+
+	for (int sampindex = 0; (sampindex < samples) && irq_voices; sampindex++)
+	{
+		for (int v = 0; v <= m_active_voices; v++)
+		{
+			if (!BIT(irq_voices, v))
+				continue;
+
+			es550x_voice *voice = &m_voice[v];
+			s32 *const dest = &m_mix[(sampindex * MAX_OUTPUTS) + (get_ca(voice->control) % m_channels << 1)];
 
 			// generate from the appropriate source
-			if (voice->control & CONTROL_CMPD)
-				generate_ulaw(voice, &cursample[l]);
+			if (ulaw && (voice->control & CONTROL_CMPD))
+				generate_ulaw(voice, dest);
 			else
-				generate_pcm(voice, &cursample[l]);
+				generate_pcm(voice, dest);
 
 			// does this voice have it's IRQ bit raised?
 			generate_irq(voice, v);
 		}
+	}
 
+	for (int sampindex = 0; sampindex < samples; sampindex++)
 		for (int c = 0; c < outputs.size(); c++)
-			outputs[c].put_int(sampindex, cursample[c], 32768);
-	}
+			outputs[c].put_int(sampindex, m_mix[(sampindex * MAX_OUTPUTS) + c], 32768);
 }
 
-void es5505_device::generate_samples(std::vector<write_stream_view> &outputs)
+
+/**********************************************************************************************
+
+     generate_samples -- tell each voice to generate samples
+
+***********************************************************************************************/
+
+void es5506_device::generate_samples(std::vector<write_stream_view> &outputs)
 {
-	// loop while we still have samples to generate
-	for (int sampindex = 0; sampindex < outputs[0].samples(); sampindex++)
+	// special case: if end == start, stop the voice
+	for (int v = 0; v <= m_active_voices; v++)
 	{
-		// loop over voices
-		s32 cursample[12] = { 0 };
-		for (int v = 0; v <= m_active_voices; v++)
-		{
-			es550x_voice *voice = &m_voice[v];
+		es550x_voice *voice = &m_voice[v];
+		if (voice->start == voice->end)
+			voice->control |= CONTROL_STOP0;
+	}
+
+	render_voices(outputs, true);
+}
 
+void es5505_device::generate_samples(std::vector<write_stream_view> &outputs)
+{
 // This special case does not appear to match the behaviour observed in the es5505 in
 // actual Ensoniq synthesizers: those, it turns out, do set loop start and end to the
 // same value, and expect the voice to keep running. Examples can be found among the
 // transwaves on the VFX / SD-1 series of synthesizers.
 #if 0
-			// special case: if end == start, stop the voice
-			if (voice->start == voice->end)
-				voice->control |= CONTROL_STOP0;
+	// special case: if end == start, stop the voice
+	for (int v = 0; v <= m_active_voices; v++)
+	{
+		es550x_voice *voice = &m_voice[v];
+		if (voice->start == voice->end)
+			voice->control |= CONTROL_STOP0;
+	}
 #endif
 
-			const int voice_channel = get_ca(voice->control);
-			const int channel = voice_channel % m_channels;
-			const int l = channel << 1;
-
-			// generate from the appropriate source
-			// no compressed sample support
-			generate_pcm(voice, &cursample[l]);
-
-			// does this voice have it's IRQ bit raised?
-			generate_irq(voice, v);
-		}
-
-		for (int c = 0; c < outputs.size(); c++)
-			outputs[c].put_int(sampindex, cursample[c], 32768);
-	}
+	// no compressed sample support
+	render_voices(outputs, false);
 }
 
 
@@ -42,6 +42,9 @@ protected:
 	// constants for address
 	const s8 ADDRESS_FRAC_BIT = 11;
 
+	// most outputs of any chip in the family (six stereo pairs)
+	static constexpr int MAX_OUTPUTS = 12;
+
 	// struct describing a single playing voice
 	struct es550x_voice
 	{
@@ -114,6 +117,8 @@ protected:
 	void generate_ulaw(es550x_voice *voice, s32 *dest);
 	void generate_pcm(es550x_voice *voice, s32 *dest);
 	inline void generate_irq(es550x_voice *voice, int v);
+	int generate_run(es550x_voice *voice, s32 *dest, int count, bool ulaw);
+	void render_voices(std::vector<write_stream_view> &outputs, bool ulaw);
 	virtual void generate_samples(std::vector<write_stream_view> &outputs) {}
 
 	inline void update_index(es550x_voice *voice) { m_voice_index = voice->index; }
@@ -139,6 +144,7 @@ protected:
 
 	std::vector<s16> m_ulaw_lookup;
 	std::vector<u32> m_volume_lookup;
+	std::vector<s32> m_mix;                 // mixed samples, MAX_OUTPUTS per output sample
 
 #if ES5506_MAKE_WAVS
 	std::vector<s32> m_scratch;
@@ -484,6 +484,12 @@ void gew_pcm_device::device_reset()
 	{
 		m_slots[slot].m_playing = false;
 	}
+	update_silent();
+}
+
+void gew_pcm_device::device_post_load()
+{
+	update_silent();
 }
 
 //-------------------------------------------------
@@ -543,13 +549,24 @@ void gew_pcm_device::dump_sample(slot_t &slot)
 //  sound_stream_update - handle a stream update
 //-------------------------------------------------
 
+sound_voice_mask<64> gew_pcm_device::playing_voices() const
+{
+	sound_voice_mask<64> playing;
+	for (int32_t slot = 0; slot < m_voices; ++slot)
+		playing.set(slot, m_slots[slot].m_playing);
+	return playing;
+}
+
 void gew_pcm_device::sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
 {
+	// voices that aren't playing don't advance, so only visit the ones that are
+	sound_voice_mask<64> const playing = playing_voices();
+
 	for (int32_t i = 0; i < outputs[0].samples(); ++i)
 	{
 		int32_t smpl = 0;
 		int32_t smpr = 0;
-		for (int32_t sl = 0; sl < m_voices; ++sl)
+		playing.for_each([this, &smpl, &smpr] (unsigned sl)
 		{
 			slot_t& slot = m_slots[sl];
 			if (slot.m_playing)
@@ -622,11 +639,14 @@ void gew_pcm_device::sound_stream_update(sound_stream &stream, std::vector<read_
 				smpl += (m_left_pan_table[vol] * sample) >> TL_SHIFT;
 				smpr += (m_right_pan_table[vol] * sample) >> TL_SHIFT;
 			}
-		}
+		});
 
 		outputs[0].put_int_clamp(i, smpl, 32768);
 		outputs[1].put_int_clamp(i, smpr, 32768);
 	}
+
+	// voices whose release ended leave us silent until the next key on
+	update_silent();
 }
 
 
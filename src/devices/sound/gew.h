@@ -26,6 +26,7 @@ protected:
 
 	virtual void device_start() override;
 	virtual void device_reset() override;
+	virtual void device_post_load() override;
 	virtual void device_clock_changed() override;
 
 	// sound stream update overrides
@@ -34,6 +35,12 @@ protected:
 	// device_rom_interface overrides
 	virtual void rom_bank_pre_change() override;
 
+	// voices that are currently playing
+	sound_voice_mask<64> playing_voices() const;
+
+	// mark the stream silent when no voice is playing; call after keying on
+	void update_silent() { playing_voices().apply(*m_stream); }
+
 	struct sample_t
 	{
 		uint32_t m_start = 0;
@@ -131,6 +131,7 @@ void gew7_pcm_device::write(offs_t offset, uint8_t data)
 		{
 			slot.m_playing = true;
 			retrigger_sample(slot);
+			update_silent();
 		}
 		else if (slot.m_playing)
 		{
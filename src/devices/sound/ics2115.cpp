@@ -428,9 +428,54 @@ int ics2115_device::fill_output(ics2115_voice& voice, std::vector<write_stream_v
 	const u16 fine = 1 << (3*(voice.vol.incr >> 6));
 	voice.vol.add = (voice.vol.incr & 0x3f)<< (10 - fine);
 
-	for (int i = 0; i < outputs[0].samples(); i++)
+	constexpr int RAMP_SHIFT = 6;
+
+	// render a run of samples that need no envelope or loop handling
+	auto const render_run = [this, &voice, &outputs] (int index, int count) -> int
+	{
+		// a stopped voice that has ramped down to nothing adds silence and
+		// doesn't change any more
+		if (!voice.playing())
+			return voice.state.ramp ? 0 : count;
+
+		// otherwise the ramp has to be at full level, the volume envelope
+		// has to be idle, and the oscillator can't reach its boundary
+		if ((voice.state.ramp != 0x40) || !(voice.vol_ctrl.bitflags.done || voice.vol_ctrl.bitflags.stop))
+			return 0;
+
+		const s32 step = voice.osc.fc << 2;
+		const s32 distance = voice.osc_conf.bitflags.invert ? s32(voice.osc.acc - voice.osc.start) : s32(voice.osc.end - voice.osc.acc);
+		const int samples = std::min<s32>(count, sound_steps_before(distance, step));
+
+		const u32 volacc = (voice.vol.acc >> 14) & 0xfff;
+		const s16 vlefti = volacc - m_panlaw[255 - voice.vol.pan];
+		const s16 vrighti = volacc - m_panlaw[voice.vol.pan];
+		const u16 vleft = vlefti > 0 ? (m_volume[vlefti] * voice.state.ramp >> RAMP_SHIFT) : 0;
+		const u16 vright = vrighti > 0 ? (m_volume[vrighti] * voice.state.ramp >> RAMP_SHIFT) : 0;
+
+		for (int i = index; i < index + samples; i++)
+		{
+			const s32 sample = get_sample(voice);
+			outputs[0].add_int(i, (sample * vleft) >> (5 + volume_bits), 32768);
+			outputs[1].add_int(i, (sample * vright) >> (5 + volume_bits), 32768);
+
+			if (voice.osc_conf.bitflags.invert)
+			{
+				voice.osc.acc -= step;
+				voice.osc.left = voice.osc.acc - voice.osc.start;
+			}
+			else
+			{
+				voice.osc.acc += step;
+				voice.osc.left = voice.osc.end - voice.osc.acc;
+			}
+		}
+		return samples;
+	};
+
+	// render one sample with all the checks
+	auto const render_step = [this, &voice, &outputs, &irq_invalid] (int i)
 	{
-		constexpr int RAMP_SHIFT = 6;
 		const u32 volacc = (voice.vol.acc >> 14) & 0xfff;
 		const s16 vlefti = volacc - m_panlaw[255 - voice.vol.pan]; // left index from acc - pan law
 		const s16 vrighti = volacc - m_panlaw[voice.vol.pan]; // right index from acc - pan law
@@ -461,7 +506,9 @@ int ics2115_device::fill_output(ics2115_voice& voice, std::vector<write_stream_v
 			if (voice.update_volume_envelope())
 				irq_invalid = true;
 		}
-	}
+	};
+
+	sound_render_runs(outputs[0].samples(), render_run, render_step);
 	return irq_invalid;
 }
 
@@ -122,6 +122,63 @@ void k054539_device::sound_stream_update(sound_stream &stream, std::vector<read_
 		return;
 	}
 
+	// register writes don't bring the stream up to date, so the pitch and
+	// volume registers hold for the whole update; decode them once per
+	// channel rather than once per sample
+	struct channel_params {
+		int delta, fdelta, pdelta, rdelta;
+		double lvol, rvol, rbvol;
+	} params[8];
+
+	for(int ch=0; ch<8; ch++) {
+		unsigned char *base1 = regs + 0x20*ch;
+		unsigned char *base2 = regs + 0x200 + 0x2*ch;
+		channel_params &p = params[ch];
+
+		int delta = base1[0x00] | (base1[0x01] << 8) | (base1[0x02] << 16);
+
+		int vol = base1[0x03];
+
+		int bval = vol + base1[0x04];
+		if (bval > 255)
+			bval = 255;
+
+		int pan = base1[0x05];
+		// DJ Main: 81-87 right, 88 middle, 89-8f left
+		if (pan >= 0x81 && pan <= 0x8f)
+			pan -= 0x81;
+		else if (pan >= 0x11 && pan <= 0x1f)
+			pan -= 0x11;
+		else
+			pan = 0x18 - 0x11;
+
+		double cur_gain = gain[ch];
+
+		p.lvol = voltab[vol] * pantab[pan] * cur_gain;
+		if (p.lvol > VOL_CAP)
+			p.lvol = VOL_CAP;
+
+		p.rvol = voltab[vol] * pantab[0xe - pan] * cur_gain;
+		if (p.rvol > VOL_CAP)
+			p.rvol = VOL_CAP;
+
+		p.rbvol= voltab[bval] * cur_gain / 2;
+		if (p.rbvol > VOL_CAP)
+			p.rbvol = VOL_CAP;
+
+		p.rdelta = (base1[6] | (base1[7] << 8)) >> 3;
+
+		if(base2[0] & 0x20) {
+			p.delta = -delta;
+			p.fdelta = +0x10000;
+			p.pdelta = -1;
+		} else {
+			p.delta = delta;
+			p.fdelta = -0x10000;
+			p.pdelta = +1;
+		}
+	}
+
 	for(int sample = 0; sample != outputs[0].samples(); sample++) {
 		double lval, rval;
 		if(!(flags & DISABLE_REVERB))
@@ -135,53 +192,18 @@ void k054539_device::sound_stream_update(sound_stream &stream, std::vector<read_
 				unsigned char *base1 = regs + 0x20*ch;
 				unsigned char *base2 = regs + 0x200 + 0x2*ch;
 				channel *chan = channels + ch;
+				channel_params const &p = params[ch];
 
-				int delta = base1[0x00] | (base1[0x01] << 8) | (base1[0x02] << 16);
-
-				int vol = base1[0x03];
-
-				int bval = vol + base1[0x04];
-				if (bval > 255)
-					bval = 255;
-
-				int pan = base1[0x05];
-				// DJ Main: 81-87 right, 88 middle, 89-8f left
-				if (pan >= 0x81 && pan <= 0x8f)
-					pan -= 0x81;
-				else if (pan >= 0x11 && pan <= 0x1f)
-					pan -= 0x11;
-				else
-					pan = 0x18 - 0x11;
-
-				double cur_gain = gain[ch];
-
-				double lvol = voltab[vol] * pantab[pan] * cur_gain;
-				if (lvol > VOL_CAP)
-					lvol = VOL_CAP;
-
-				double rvol = voltab[vol] * pantab[0xe - pan] * cur_gain;
-				if (rvol > VOL_CAP)
-					rvol = VOL_CAP;
-
-				double rbvol= voltab[bval] * cur_gain / 2;
-				if (rbvol > VOL_CAP)
-					rbvol = VOL_CAP;
-
-				int rdelta = (base1[6] | (base1[7] << 8)) >> 3;
-				rdelta = (rdelta + reverb_pos) & 0x3fff;
+				int const delta = p.delta;
+				int fdelta = p.fdelta;
+				int pdelta = p.pdelta;
+				double const lvol = p.lvol;
+				double const rvol = p.rvol;
+				double const rbvol = p.rbvol;
+				int const rdelta = (p.rdelta + reverb_pos) & 0x3fff;
 
 				int cur_pos = (base1[0x0c] | (base1[0x0d] << 8) | (base1[0x0e] << 16));
 
-				int fdelta, pdelta;
-				if(base2[0] & 0x20) {
-					delta = -delta;
-					fdelta = +0x10000;
-					pdelta = -1;
-				} else {
-					fdelta = -0x10000;
-					pdelta = +1;
-				}
-
 				int cur_pfrac, cur_val, cur_pval;
 				if(cur_pos != chan->pos) {
 					chan->pos = cur_pos;
@@ -324,7 +346,7 @@ void k054539_device::init_chip()
 	cur_ptr = 0;
 	memset(&ram[0], 0, 0x4000);
 
-	stream = stream_alloc(0, 2, clock() / 384);
+	stream = stream_alloc(0, 2, clock() / 384, STREAM_PARALLEL_SAFE);
 
 	save_item(NAME(voltab));
 	save_item(NAME(pantab));
@@ -473,11 +495,17 @@ void k054539_device::write(offs_t offset, u8 data)
 	}
 
 	regs[offset] = data;
+
+	// the update produces nothing while the chip is disabled; registers take
+	// effect at the next update either way, so no update is forced here
+	if (offset == 0x22f)
+		stream->set_silent(!(data & 1));
 }
 
 void k054539_device::device_post_load()
 {
 	cur_limit = rom_addr == 0x80 ? 0x4000 : 0x20000;
+	stream->set_silent(!(regs[0x22f] & 1));
 }
 
 u8 k054539_device::read(offs_t offset)
@@ -552,6 +580,7 @@ void k054539_device::device_reset()
 	regs[0x22f] = 0;
 	memset(&ram[0], 0, 0x4000);
 	m_timer->enable(false);
+	stream->set_silent(true);
 }
 
 
@@ -102,6 +102,7 @@ void multipcm_device::write_slot(slot_t &slot, int32_t reg, uint8_t data)
 			{
 				slot.m_playing = true;
 				retrigger_sample(slot);
+				update_silent();
 			}
 			else
 			{
@@ -145,6 +145,7 @@ void okim6295_device::device_reset()
 	m_stream->update();
 	for (auto & elem : m_voice)
 		elem.m_playing = false;
+	update_silent();
 }
 
 
@@ -155,6 +156,7 @@ void okim6295_device::device_reset()
 void okim6295_device::device_post_load()
 {
 	device_clock_changed();
+	update_silent();
 }
 
 
@@ -186,6 +188,25 @@ void okim6295_device::sound_stream_update(sound_stream &stream, std::vector<read
 
 	for (int i = 0; i < outputs[0].samples(); i++)
 		outputs[0].put(i, std::clamp(outputs[0].getraw(i), -1.0f, 1.0f));
+
+	// voices that finished leave us silent until the next command
+	update_silent();
+}
+
+
+//-------------------------------------------------
+//  update_silent - let the stream skip updates
+//  while no voice is playing; a stopped voice
+//  outputs nothing, so this doesn't change the
+//  sound
+//-------------------------------------------------
+
+void okim6295_device::update_silent()
+{
+	sound_voice_mask<OKIM6295_VOICES> playing;
+	for (int voicenum = 0; voicenum < OKIM6295_VOICES; voicenum++)
+		playing.set(voicenum, m_voice[voicenum].m_playing);
+	playing.apply(*m_stream);
 }
 
 
@@ -296,6 +317,7 @@ void okim6295_device::write(uint8_t command)
 
 		// reset the command
 		m_command = -1;
+		update_silent();
 	}
 
 	// if this is the start of a command, remember the sample number for next time
@@ -313,6 +335,7 @@ void okim6295_device::write(uint8_t command)
 		for (int voicenum = 0; voicenum < OKIM6295_VOICES; voicenum++, voicemask >>= 1)
 			if (voicemask & 1)
 				m_voice[voicenum].m_playing = false;
+		update_silent();
 	}
 }
 
@@ -80,6 +80,9 @@ protected:
 		stream_buffer::sample_t m_volume; // output volume
 	};
 
+	// mark the stream silent when no voice is playing
+	void update_silent();
+
 	// configuration state
 	optional_memory_region  m_region;
 
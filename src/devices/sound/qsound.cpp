@@ -206,7 +206,7 @@ void qsound_device::device_add_mconfig(machine_config &config)
 void qsound_device::device_start()
 {
 	// hope we get good synchronisation between the DSP and the sound system
-	m_stream = stream_alloc(0, 2, clock() / 2 / 1248);
+	m_stream = stream_alloc(0, 2, clock() / 2 / 1248, STREAM_PARALLEL_SAFE);
 
 	// save DSP communication state
 	save_item(NAME(m_rom_bank));
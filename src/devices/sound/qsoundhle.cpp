@@ -65,7 +65,7 @@ void qsound_hle_device::rom_bank_pre_change()
 
 void qsound_hle_device::device_start()
 {
-	m_stream = stream_alloc(0, 2, clock() / 2 / 1248); // DSP program uses 1248 machine cycles per iteration
+	m_stream = stream_alloc(0, 2, clock() / 2 / 1248, STREAM_PARALLEL_SAFE); // DSP program uses 1248 machine cycles per iteration
 
 	init_register_map();
 
@@ -6,6 +6,11 @@
 #include <cstring>
 
 
+// run the original interpreter alongside the decoded program and report
+// any difference in the registers it leaves behind
+#define VERIFY_COMPILED 0
+
+
 namespace {
 
 u16 PACK(s32 val)
@@ -63,6 +68,7 @@ void SCSPDSP::Init()
 	std::memset(this, 0, sizeof(*this));
 	RBL = (8*1024); // Initial RBL is 0
 	Stopped = true;
+	Dirty = true;
 }
 
 void SCSPDSP::Step()
@@ -70,6 +76,198 @@ void SCSPDSP::Step()
 	if (Stopped)
 		return;
 
+#if VERIFY_COMPILED
+	// memory is shared, so only the registers are compared
+	SCSPDSP reference(*this);
+	reference.Interpret();
+	Execute();
+	if (!std::equal(std::begin(EFREG), std::end(EFREG), std::begin(reference.EFREG)) ||
+			!std::equal(std::begin(TEMP), std::end(TEMP), std::begin(reference.TEMP)) ||
+			!std::equal(std::begin(MEMS), std::end(MEMS), std::begin(reference.MEMS)) ||
+			(DEC != reference.DEC))
+		osd_printf_error("SCSPDSP: decoded program differs from interpreter\n");
+#else
+	Execute();
+#endif
+}
+
+void SCSPDSP::Compile()
+{
+	// decode up to the end of the program, or up to the first step with an
+	// invalid input since that step abandons the rest of the sample
+	int count = 0;
+	Aborts = false;
+	for (int step = 0; step < LastStep; ++step)
+	{
+		u16 const *const IPtr = MPRO + (step * 4);
+		Instruction &op = Program[count++];
+
+		op.Step  = step;
+		op.TRA   = (IPtr[0] >>  8) & 0x7F;
+		op.TWT   = BIT(IPtr[0], 7);
+		op.TWA   = (IPtr[0] >>  0) & 0x7F;
+
+		op.XSEL  = BIT(IPtr[1], 15);
+		op.YSEL  = (IPtr[1] >> 13) & 0x03;
+		op.IRA   = (IPtr[1] >>  6) & 0x3F;
+		op.IWT   = BIT(IPtr[1], 5);
+		op.IWA   = (IPtr[1] >>  0) & 0x1F;
+
+		op.TABLE = BIT(IPtr[2], 15);
+		op.MWT   = BIT(IPtr[2], 14) && (step & 1); // memory is only accessed on odd steps
+		op.MRD   = BIT(IPtr[2], 13) && (step & 1);
+		op.EWT   = BIT(IPtr[2], 12);
+		op.EWA   = (IPtr[2] >>  8) & 0x0F;
+		op.ADRL  = BIT(IPtr[2], 7);
+		op.FRCL  = BIT(IPtr[2], 6);
+		op.SHIFT = (IPtr[2] >>  4) & 0x03;
+		op.YRL   = BIT(IPtr[2], 3);
+		op.NEGB  = BIT(IPtr[2], 2);
+		op.ZERO  = BIT(IPtr[2], 1);
+		op.BSEL  = BIT(IPtr[2], 0);
+
+		op.NOFL  = BIT(IPtr[3], 15);
+		op.COEF  = (IPtr[3] >>  9) & 0x3f;
+		op.MASA  = (IPtr[3] >>  2) & 0x1f;
+		op.ADREB = BIT(IPtr[3], 1);
+		op.NXADR = BIT(IPtr[3], 0);
+
+		if (op.IRA > 0x31)
+		{
+			Aborts = true;
+			--count;
+			break;
+		}
+	}
+
+	// walk backwards dropping steps that only compute an ACC nothing reads
+	bool keep[128];
+	bool acclive = false;
+	for (int i = count - 1; i >= 0; --i)
+	{
+		Instruction const &op = Program[i];
+		bool const shifted = op.TWT || op.FRCL || op.MWT || (op.ADRL && (op.SHIFT == 3)) || op.EWT;
+		keep[i] = acclive || op.TWT || op.IWT || op.YRL || op.FRCL || op.MRD || op.MWT || op.ADRL || op.EWT;
+		if (keep[i])
+			acclive = shifted || (!op.ZERO && op.BSEL);
+	}
+
+	ProgramSteps = 0;
+	for (int i = 0; i < count; ++i)
+	{
+		if (keep[i])
+			Program[ProgramSteps++] = Program[i];
+	}
+	Dirty = false;
+}
+
+void SCSPDSP::Execute()
+{
+	if (Dirty)
+		Compile();
+
+	std::fill(std::begin(EFREG), std::end(EFREG), 0);
+
+	s32 ACC = 0;    //26 bit
+	s32 MEMVAL = 0;
+	s32 FRC_REG = 0;    //13 bit
+	s32 Y_REG = 0;      //24 bit
+	u32 ADRS_REG = 0;  //13 bit
+
+	for (int i = 0; i < ProgramSteps; ++i)
+	{
+		Instruction const &op = Program[i];
+
+		s32 INPUTS; // 24-bit
+		if (op.IRA <= 0x1f)
+			INPUTS = MEMS[op.IRA];
+		else if (op.IRA <= 0x2F)
+			INPUTS = MIXS[op.IRA - 0x20] << 4;  //MIXS is 20 bit
+		else
+			INPUTS = EXTS[op.IRA - 0x30] << 8;  //EXTS is 16 bit
+		INPUTS = util::sext(INPUTS, 24);
+
+		if (op.IWT)
+		{
+			MEMS[op.IWA] = MEMVAL;  // MEMVAL was selected in previous MRD
+			if (op.IRA == op.IWA)
+				INPUTS = MEMVAL;
+		}
+
+		s32 const TEMPVAL = util::sext(TEMP[(op.TRA + DEC) & 0x7F], 24);
+
+		s32 B = 0; // 26-bit
+		if (!op.ZERO)
+		{
+			B = op.BSEL ? ACC : TEMPVAL;
+			if (op.NEGB)
+				B = 0 - B;
+		}
+
+		s32 const X = op.XSEL ? INPUTS : TEMPVAL; // 24-bit
+
+		s32 Y; //13 bit
+		switch (op.YSEL)
+		{
+		case 0:  Y = FRC_REG; break;
+		case 1:  Y = COEF[op.COEF] >> 3; break;
+		case 2:  Y = (Y_REG >> 11) & 0x1FFF; break;
+		default: Y = (Y_REG >> 4) & 0x0FFF; break;
+		}
+
+		if (op.YRL)
+			Y_REG = INPUTS;
+
+		s32 SHIFTED;    //24 bit
+		switch (op.SHIFT)
+		{
+		case 0:  SHIFTED = std::clamp<s32>(ACC, -0x00800000, 0x007FFFFF); break;
+		case 1:  SHIFTED = std::clamp<s32>(ACC * 2, -0x00800000, 0x007FFFFF); break;
+		case 2:  SHIFTED = util::sext(ACC * 2, 24); break;
+		default: SHIFTED = util::sext(ACC, 24); break;
+		}
+
+		ACC = int(((int64_t(X) * int64_t(util::sext(Y, 13))) >> 12) + B);
+
+		if (op.TWT)
+			TEMP[(op.TWA + DEC) & 0x7F] = SHIFTED;
+
+		if (op.FRCL)
+			FRC_REG = (op.SHIFT == 3) ? (SHIFTED & 0x0FFF) : ((SHIFTED >> 11) & 0x1FFF);
+
+		if (op.MRD || op.MWT)
+		{
+			u32 ADDR = MADRS[op.MASA];
+			if (!op.TABLE)
+				ADDR += DEC;
+			if (op.ADREB)
+				ADDR += ADRS_REG & 0x0FFF;
+			if (op.NXADR)
+				ADDR++;
+			ADDR &= op.TABLE ? 0xFFFF : (RBL - 1);
+			ADDR = (ADDR + (RBP << 12)) << 1;
+			if (op.MRD)
+				MEMVAL = op.NOFL ? (space->read_word(ADDR) << 8) : UNPACK(space->read_word(ADDR));
+			if (op.MWT)
+				space->write_word(ADDR, op.NOFL ? u16(SHIFTED >> 8) : PACK(SHIFTED));
+		}
+
+		if (op.ADRL)
+			ADRS_REG = (op.SHIFT == 3) ? ((SHIFTED >> 12) & 0xFFF) : (INPUTS >> 16);
+
+		if (op.EWT)
+			EFREG[op.EWA] += SHIFTED >> 8;
+	}
+
+	if (Aborts)
+		return;
+	--DEC;
+	std::fill(std::begin(MIXS), std::end(MIXS), 0);
+}
+
+void SCSPDSP::Interpret()
+{
+
 	std::fill(std::begin(EFREG), std::end(EFREG), 0);
 
 #if 0
@@ -334,4 +532,5 @@ void SCSPDSP::Start()
 			break;
 	}
 	LastStep = i + 1;
+	Dirty = true;
 }
@@ -8,6 +8,14 @@
 //the DSP Context
 struct SCSPDSP
 {
+	// one microprogram step with its fields extracted
+	struct Instruction
+	{
+		u8 Step;
+		u8 TRA, TWA, IRA, IWA, EWA, COEF, MASA, SHIFT, YSEL;
+		bool TWT, XSEL, IWT, TABLE, MWT, MRD, EWT, ADRL, FRCL, YRL, NEGB, ZERO, BSEL, NOFL, ADREB, NXADR;
+	};
+
 //Config
 	address_space *space;
 	u32 RBP; //Ring buf pointer
@@ -32,10 +40,21 @@ struct SCSPDSP
 	bool Stopped;
 	int LastStep;
 
+//decoded program, rebuilt from MPRO when Dirty is set
+	Instruction Program[128];
+	int ProgramSteps;
+	bool Aborts;  // last step reads a nonexistent input and abandons the sample
+	bool Dirty;
+
 	void Init();
 	void SetSample(s32 sample, s32 SEL, s32 MXL);
 	void Step();
 	void Start();
+
+private:
+	void Compile();
+	void Execute();
+	void Interpret();
 };
 
 #endif // MAME_SOUND_SCSPDSP_H
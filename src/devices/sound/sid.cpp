@@ -65,16 +65,21 @@ void SID6581_t::fill_buffer(write_stream_view &buffer)
 {
 //void* SID6581_t::fill16bitMono(void* buffer, uint32_t numberOfSamples)
 
+	// register writes bring the stream up to date first, so the volume and
+	// voice 3 mask hold for the whole buffer
+	/* hack for digi sounds
+	   does n't seam to come from a tone operator
+	   ghostbusters and goldrunner everything except volume zeroed */
+	uint16_t const digi = masterVolume << 2;
+	int const mask3 = optr3_outputmask;
+
 	for (int sampindex = 0; sampindex < buffer.samples(); sampindex++)
 	{
 		buffer.put(sampindex, mix_mono(
 								 (*optr[0].outProc)(&optr[0])
 								+(*optr[1].outProc)(&optr[1])
-								+((*optr[2].outProc)(&optr[2])&optr3_outputmask)
-/* hack for digi sounds
-   does n't seam to come from a tone operator
-   ghostbusters and goldrunner everything except volume zeroed */
-							+(masterVolume<<2)
+								+((*optr[2].outProc)(&optr[2])&mask3)
+								+digi
 //                        +(*sampleEmuRout)()
 		));
 		syncEm();
@@ -290,73 +290,78 @@ static void sidMode74(sidOperator* pVoice)
 /* */
 /* */
 
-static inline void waveCalcFilter(sidOperator* pVoice)
+/* Filter procedures, selected by set() from the filter type whenever the */
+/* filter registers or the voice routing change. */
+
+static void waveCalcFilterBypass(sidOperator* pVoice)
+{
+}
+
+static void waveCalcFilterOff(sidOperator* pVoice)
+{
+	pVoice->filtIO = 0;
+}
+
+static void waveCalcFilterBandPass(sidOperator* pVoice)
+{
+	float tmp;
+	pVoice->filtLow += (pVoice->filtRef * pVoice->sid->filter.Dy);
+	tmp = (float)pVoice->filtIO - pVoice->filtLow;
+	tmp -= pVoice->filtRef * pVoice->sid->filter.ResDy;
+	pVoice->filtRef += (tmp * (pVoice->sid->filter.Dy));
+	pVoice->filtIO = (int8_t)(pVoice->filtRef-pVoice->filtLow/4);
+}
+
+static void waveCalcFilterHighPass(sidOperator* pVoice)
+{
+	float tmp, tmp2;
+	pVoice->filtLow += (pVoice->filtRef * pVoice->sid->filter.Dy * 0.1f);
+	tmp = (float)pVoice->filtIO - pVoice->filtLow;
+	tmp -= pVoice->filtRef * pVoice->sid->filter.ResDy;
+	pVoice->filtRef += (tmp * (pVoice->sid->filter.Dy));
+	tmp2 = pVoice->filtRef - pVoice->filtIO/8;
+	if (tmp2 < -128)
+		tmp2 = -128;
+	if (tmp2 > 127)
+		tmp2 = 127;
+	pVoice->filtIO = (int8_t)tmp2;
+}
+
+template <uint8_t Type>
+static void waveCalcFilterMixed(sidOperator* pVoice)
 {
-	if (pVoice->filtEnabled)
+	float sample, sample2;
+	int tmp;
+	pVoice->filtLow += (pVoice->filtRef * pVoice->sid->filter.Dy);
+	sample = pVoice->filtIO;
+	sample2 = sample - pVoice->filtLow;
+	tmp = (int)sample2;
+	sample2 -= pVoice->filtRef * pVoice->sid->filter.ResDy;
+	pVoice->filtRef += (sample2 * pVoice->sid->filter.Dy);
+
+	if ((Type == 0x10) || (Type == 0x30))
 	{
-		if (pVoice->sid->filter.Type != 0)
-		{
-			if (pVoice->sid->filter.Type == 0x20)
-			{
-				float tmp;
-				pVoice->filtLow += (pVoice->filtRef * pVoice->sid->filter.Dy);
-				tmp = (float)pVoice->filtIO - pVoice->filtLow;
-				tmp -= pVoice->filtRef * pVoice->sid->filter.ResDy;
-				pVoice->filtRef += (tmp * (pVoice->sid->filter.Dy));
-				pVoice->filtIO = (int8_t)(pVoice->filtRef-pVoice->filtLow/4);
-			}
-			else if (pVoice->sid->filter.Type == 0x40)
-			{
-				float tmp, tmp2;
-				pVoice->filtLow += (pVoice->filtRef * pVoice->sid->filter.Dy * 0.1f);
-				tmp = (float)pVoice->filtIO - pVoice->filtLow;
-				tmp -= pVoice->filtRef * pVoice->sid->filter.ResDy;
-				pVoice->filtRef += (tmp * (pVoice->sid->filter.Dy));
-				tmp2 = pVoice->filtRef - pVoice->filtIO/8;
-				if (tmp2 < -128)
-					tmp2 = -128;
-				if (tmp2 > 127)
-					tmp2 = 127;
-				pVoice->filtIO = (int8_t)tmp2;
-			}
-			else
-			{
-				float sample, sample2;
-				int tmp;
-				pVoice->filtLow += (pVoice->filtRef * pVoice->sid->filter.Dy);
-				sample = pVoice->filtIO;
-				sample2 = sample - pVoice->filtLow;
-				tmp = (int)sample2;
-				sample2 -= pVoice->filtRef * pVoice->sid->filter.ResDy;
-				pVoice->filtRef += (sample2 * pVoice->sid->filter.Dy);
-
-				if (pVoice->sid->filter.Type == 0x10)
-				{
-					pVoice->filtIO = (int8_t)pVoice->filtLow;
-				}
-				else if (pVoice->sid->filter.Type == 0x30)
-				{
-					pVoice->filtIO = (int8_t)pVoice->filtLow;
-				}
-				else if (pVoice->sid->filter.Type == 0x50)
-				{
-					pVoice->filtIO = (int8_t)(sample - (tmp >> 1));
-				}
-				else if (pVoice->sid->filter.Type == 0x60)
-				{
-					pVoice->filtIO = (int8_t)tmp;
-				}
-				else if (pVoice->sid->filter.Type == 0x70)
-				{
-					pVoice->filtIO = (int8_t)(sample - (tmp >> 1));
-				}
-			}
-		}
-		else /* pVoice->sid->filter.Type == 0x00 */
-		{
-			pVoice->filtIO = 0;
-		}
+		pVoice->filtIO = (int8_t)pVoice->filtLow;
+	}
+	else if (Type == 0x60)
+	{
+		pVoice->filtIO = (int8_t)tmp;
 	}
+	else /* 0x50, 0x70 */
+	{
+		pVoice->filtIO = (int8_t)(sample - (tmp >> 1));
+	}
+}
+
+static const ptr2sidVoidFunc filterModeTable[8] =
+{
+	waveCalcFilterOff, waveCalcFilterMixed<0x10>, waveCalcFilterBandPass, waveCalcFilterMixed<0x30>,
+	waveCalcFilterHighPass, waveCalcFilterMixed<0x50>, waveCalcFilterMixed<0x60>, waveCalcFilterMixed<0x70>
+};
+
+static inline void waveCalcFilter(sidOperator* pVoice)
+{
+	(*pVoice->filtProc)(pVoice);
 }
 
 static int8_t waveCalcMute(sidOperator* pVoice)
@@ -424,6 +429,7 @@ void sidOperator::clear()
 
 	filtEnabled = false;
 	filtLow = filtRef = 0;
+	filtProc = waveCalcFilterBypass;
 
 	cycleLenCount = 0;
 #if defined(DIRECT_FIXPOINT)
@@ -530,6 +536,7 @@ void sidOperator::set()
 	ADSRctrl = enveTemp & (255 - ENVE_ALTER - 1);
 
 	filtEnabled = sid->filter.Enabled && (sid->reg[0x17] & filtVoiceMask);
+	filtProc = filtEnabled ? filterModeTable[(sid->filter.Type >> 4) & 7] : waveCalcFilterBypass;
 }
 
 
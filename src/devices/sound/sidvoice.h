@@ -46,6 +46,7 @@ struct sidOperator
 	int filtEnabled = 0;
 	float filtLow = 0, filtRef = 0;
 	int8_t filtIO = 0;
+	void (*filtProc)(sidOperator *) = nullptr;
 
 	int32_t cycleLenCount = 0;
 #if defined(DIRECT_FIXPOINT)
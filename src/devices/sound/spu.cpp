@@ -11,6 +11,7 @@
 #include "emu.h"
 #include "spu.h"
 #include "spureverb.h"
+#include "spukernel.h"
 #include "cpu/psx/psx.h"
 #include "corestr.h"
 
@@ -1970,55 +1971,49 @@ void spu_device::generate_voice(const unsigned int v,
 
 			// Generate samples
 
-			if (outxp)
-			{
-				while (n--)
-				{
-					int v=sp[0];
+			// Interpolate a block at a time, then apply the envelope and mix
 
-					v+=((sp[1]-v)*(int)dptr)>>12;
-
-					int l=(v*env_l)>>15,
-							r=(v*env_r)>>15;
-					env_l+=envdelta_l;
-					env_r+=envdelta_r;
+			while (n)
+			{
+				int iv[64];
+				unsigned int const bn=(std::min)(n,64U);
+				sp=spu_interpolate(iv,bn,sp,dptr,vi->pitch);
+				n-=bn;
 
-					outxp[0]=l;
-					outxp[1]=r;
-					outxp+=2;
+				if (outxp)
+				{
+					for (unsigned int i=0; i<bn; i++)
+					{
+						int l=(iv[i]*env_l)>>15,
+								r=(iv[i]*env_r)>>15;
+						env_l+=envdelta_l;
+						env_r+=envdelta_r;
 
-					l=(l*vi->vol[0])>>15;
-					r=(r*vi->vol[1])>>15;
+						outxp[0]=l;
+						outxp[1]=r;
+						outxp+=2;
 
-					dp[0]=clamp(l+dp[0]);
-					dp[1]=clamp(r+dp[1]);
-					dp+=2;
+						l=(l*vi->vol[0])>>15;
+						r=(r*vi->vol[1])>>15;
 
-					dptr+=vi->pitch;
-					sp+=(dptr>>12);
-					dptr&=0xfff;
+						dp[0]=clamp(l+dp[0]);
+						dp[1]=clamp(r+dp[1]);
+						dp+=2;
+					}
 				}
-			}
-			else
-			{
-				while (n--)
+				else
 				{
-					int v=sp[0];
-
-					v+=((sp[1]-v)*(int)dptr)>>12;
-
-					int l=(v*env_l)>>15,
-							r=(v*env_r)>>15;
-					env_l+=envdelta_l;
-					env_r+=envdelta_r;
-
-					dp[0]=clamp(l+dp[0]);
-					dp[1]=clamp(r+dp[1]);
-					dp+=2;
+					for (unsigned int i=0; i<bn; i++)
+					{
+						int l=(iv[i]*env_l)>>15,
+								r=(iv[i]*env_r)>>15;
+						env_l+=envdelta_l;
+						env_r+=envdelta_r;
 
-					dptr+=vi->pitch;
-					sp+=(dptr>>12);
-					dptr&=0xfff;
+						dp[0]=clamp(l+dp[0]);
+						dp[1]=clamp(r+dp[1]);
+						dp+=2;
+					}
 				}
 			}
 
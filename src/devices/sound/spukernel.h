@@ -0,0 +1,286 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    spukernel.h
+
+    Block kernels for the PlayStation SPU voice and reverb paths.  Voice
+    interpolation computes each output's source position directly rather
+    than stepping to it, and the reverb comb/allpass network runs four
+    samples at a time where the delay line position allows it (all of
+    its delays are multiples of four).  Both have SSE2 forms where it's
+    available and scalar forms doing the same integer arithmetic, so the
+    output is bit-exact whichever is used.
+
+***************************************************************************/
+
+#ifndef MAME_SOUND_SPUKERNEL_H
+#define MAME_SOUND_SPUKERNEL_H
+
+#pragma once
+
+// use SSE on 64-bit implementations, where it can be assumed
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define MAME_SPU_SSE2
+#include <emmintrin.h>
+#endif
+
+#include <cstring>
+
+
+/***************************************************************************
+    HELPERS
+***************************************************************************/
+
+/*-------------------------------------------------
+    spu_clamp - saturate to a 16-bit sample
+-------------------------------------------------*/
+
+constexpr int spu_clamp(int v)
+{
+	return (v < -32768) ? -32768 : (v > 32767) ? 32767 : v;
+}
+
+
+
+/***************************************************************************
+    VOICE INTERPOLATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    spu_interpolate - linearly interpolate 'count'
+    samples from 'src' at 12-bit fractional
+    position 'frac' stepping by 'pitch'; returns
+    the advanced source pointer and leaves the
+    new fraction in 'frac'
+-------------------------------------------------*/
+
+inline signed short *spu_interpolate(int *dest, unsigned int count, signed short *src, unsigned int &frac, unsigned int pitch)
+{
+	unsigned int pos = frac;
+	unsigned int x = 0;
+
+#if defined(MAME_SPU_SSE2)
+	// s + ((n - s) * f >> 12) is (s * (4096 - f) + n * f) >> 12, which is
+	// one multiply-add of the adjacent sample pair against the weights
+	__m128i const lanes = _mm_set_epi32(3 * pitch, 2 * pitch, pitch, 0);
+	__m128i const fracmask = _mm_set1_epi32(0xfff);
+	__m128i const one = _mm_set1_epi32(0x1000);
+	for ( ; x + 4 <= count; x += 4, pos += 4 * pitch)
+	{
+		__m128i const p = _mm_add_epi32(_mm_set1_epi32(pos), lanes);
+		__m128i const f = _mm_and_si128(p, fracmask);
+		__m128i const weights = _mm_or_si128(_mm_sub_epi32(one, f), _mm_slli_epi32(f, 16));
+
+		alignas(16) unsigned int index[4];
+		_mm_store_si128(reinterpret_cast<__m128i *>(index), _mm_srli_epi32(p, 12));
+		int pairs[4];
+		for (int i = 0; i < 4; i++)
+			std::memcpy(&pairs[i], &src[index[i]], sizeof(pairs[i]));
+
+		__m128i const samples = _mm_set_epi32(pairs[3], pairs[2], pairs[1], pairs[0]);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x]), _mm_srai_epi32(_mm_madd_epi16(samples, weights), 12));
+	}
+#endif
+
+	for ( ; x < count; x++, pos += pitch)
+	{
+		signed short const *const s = &src[pos >> 12];
+		int const v = s[0];
+		dest[x] = v + (((s[1] - v) * int(pos & 0xfff)) >> 12);
+	}
+
+	frac = pos & 0xfff;
+	return src + (pos >> 12);
+}
+
+
+
+/***************************************************************************
+    REVERB
+***************************************************************************/
+
+/*-------------------------------------------------
+    spu_comb_allpass_sample - run one channel of
+    the comb/allpass network for one sample
+-------------------------------------------------*/
+
+inline void spu_comb_allpass_sample(
+		signed short *const y[4],
+		signed short const *x,
+		signed short *ax,
+		signed short *ay,
+		int mask,
+		int yp,
+		int const comb_delay[4],
+		int comb_gain,
+		int allpass_delay,
+		int allpass_gain,
+		int rvol,
+		signed short src,
+		signed short &dst)
+{
+	// Comb
+
+	int v = 0;
+	for (int f = 0; f < 4; f++)
+	{
+		int const yck = (yp - comb_delay[f]) & mask;
+		y[f][yp] = spu_clamp(x[yck] + ((comb_gain * y[f][yck]) >> 15));
+		v += y[f][yp];
+	}
+	v >>= 2;
+
+	// Allpass
+
+	if (allpass_delay)
+	{
+		ax[yp] = v;
+		int const ypa = (yp - allpass_delay) & mask;
+		v = spu_clamp(((allpass_gain * (ay[ypa] - x[yp])) >> 15) + ax[ypa]);
+		ay[yp] = v;
+	}
+
+	// Output
+
+	dst = spu_clamp(((v * rvol) >> 15) + dst + src);
+}
+
+
+/*-------------------------------------------------
+    spu_comb_allpass - run one channel of the comb/
+    allpass network over 'count' samples starting
+    at delay line position 'yp'; 'src' and 'dst'
+    step by 'stride'
+-------------------------------------------------*/
+
+inline void spu_comb_allpass(
+		signed short *const y[4],
+		signed short const *x,
+		signed short *ax,
+		signed short *ay,
+		int max_delay,
+		int yp,
+		int const comb_delay[4],
+		int comb_gain,
+		int allpass_delay,
+		int allpass_gain,
+		int rvol,
+		signed short const *src,
+		signed short *dst,
+		unsigned int stride,
+		unsigned int count)
+{
+	int const mask = max_delay - 1;
+
+	// get the delay line position aligned to four samples
+	for ( ; count && (yp & 3); count--, yp = (yp + 1) & mask, src += stride, dst += stride)
+		spu_comb_allpass_sample(y, x, ax, ay, mask, yp, comb_delay, comb_gain, allpass_delay, allpass_gain, rvol, *src, *dst);
+
+	// every delay is a multiple of four and the delay line length is a
+	// power of two, so no sample in an aligned group of four reads a
+	// value written by another one, and neither the group nor the taps
+	// it reads wrap around
+#if defined(MAME_SPU_SSE2)
+	__m128i const cg = _mm_set1_epi32(comb_gain);
+	__m128i const ag = _mm_set1_epi32(allpass_gain);
+	__m128i const rv = _mm_set1_epi32(rvol);
+	for ( ; count >= 4; count -= 4, yp = (yp + 4) & mask, src += 4 * stride, dst += 4 * stride)
+	{
+		// the products fit in 16 x 16 bits, so they're built from the
+		// low and high halves of 16-bit multiplies
+		auto const mul = [] (__m128i a, __m128i b)
+		{
+			__m128i const a16 = _mm_packs_epi32(a, a);
+			__m128i const b16 = _mm_packs_epi32(b, b);
+			return _mm_unpacklo_epi16(_mm_mullo_epi16(a16, b16), _mm_mulhi_epi16(a16, b16));
+		};
+		auto const load = [] (signed short const *p)
+		{
+			__m128i const v = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(p));
+			return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+		};
+		auto const store = [] (signed short *p, __m128i v)
+		{
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(p), _mm_packs_epi32(v, v));
+		};
+
+		// Comb
+
+		__m128i v = _mm_setzero_si128();
+		for (int f = 0; f < 4; f++)
+		{
+			int const yck = (yp - comb_delay[f]) & mask;
+			__m128i const sum = _mm_add_epi32(load(&x[yck]), _mm_srai_epi32(mul(cg, load(&y[f][yck])), 15));
+			store(&y[f][yp], sum);
+			v = _mm_add_epi32(v, load(&y[f][yp]));
+		}
+		v = _mm_srai_epi32(v, 2);
+
+		// Allpass
+
+		if (allpass_delay)
+		{
+			store(&ax[yp], v);
+			int const ypa = (yp - allpass_delay) & mask;
+			__m128i const diff = _mm_sub_epi32(load(&ay[ypa]), load(&x[yp]));
+
+			// the difference can need 17 bits, so split it for the multiply
+			__m128i const lo = _mm_and_si128(diff, _mm_set1_epi32(0x7fff));
+			__m128i const hi = _mm_srai_epi32(diff, 15);
+			__m128i const prod = _mm_add_epi32(_mm_slli_epi32(mul(ag, hi), 15), mul(ag, lo));
+			store(&ay[yp], _mm_add_epi32(_mm_srai_epi32(prod, 15), load(&ax[ypa])));
+			v = load(&ay[yp]);
+		}
+
+		// Output
+
+		alignas(16) int out[4];
+		_mm_store_si128(reinterpret_cast<__m128i *>(out), _mm_srai_epi32(mul(rv, v), 15));
+		for (int i = 0; i < 4; i++)
+			dst[i * stride] = spu_clamp(out[i] + dst[i * stride] + src[i * stride]);
+	}
+#else
+	for ( ; count >= 4; count -= 4, yp = (yp + 4) & mask, src += 4 * stride, dst += 4 * stride)
+	{
+		int v[4] = { 0, 0, 0, 0 };
+
+		// Comb
+
+		for (int f = 0; f < 4; f++)
+		{
+			int const yck = (yp - comb_delay[f]) & mask;
+			for (int i = 0; i < 4; i++)
+			{
+				y[f][yp + i] = spu_clamp(x[yck + i] + ((comb_gain * y[f][yck + i]) >> 15));
+				v[i] += y[f][yp + i];
+			}
+		}
+
+		// Allpass
+
+		int const ypa = (yp - allpass_delay) & mask;
+		for (int i = 0; i < 4; i++)
+		{
+			v[i] >>= 2;
+			if (allpass_delay)
+			{
+				ax[yp + i] = v[i];
+				v[i] = spu_clamp(((allpass_gain * (ay[ypa + i] - x[yp + i])) >> 15) + ax[ypa + i]);
+				ay[yp + i] = v[i];
+			}
+		}
+
+		// Output
+
+		for (int i = 0; i < 4; i++)
+			dst[i * stride] = spu_clamp(((v[i] * rvol) >> 15) + dst[i * stride] + src[i * stride]);
+	}
+#endif
+
+	// finish whatever's left one sample at a time
+	for ( ; count; count--, yp = (yp + 1) & mask, src += stride, dst += stride)
+		spu_comb_allpass_sample(y, x, ax, ay, mask, yp, comb_delay, comb_gain, allpass_delay, allpass_gain, rvol, *src, *dst);
+}
+
+#endif // MAME_SOUND_SPUKERNEL_H
@@ -46,24 +46,6 @@ class spu_device::reverb
 			const reverb_params *rp,
 			const int wetvol_l,
 			const int wetvol_r,
-			const unsigned int _sz);
-	void comb_allpass4(
-			signed short *sp,
-			signed short *dp,
-			const comb_param &comb_delay,
-			const int comb_gain,
-			const int allpass_delay,
-			const int allpass_gain,
-			const int *rvol,
-			const unsigned int sz);
-	void comb_allpass1(
-			signed short *sp,
-			signed short *dp,
-			const comb_param &comb_delay,
-			const int comb_gain,
-			const int allpass_delay,
-			const int allpass_gain,
-			const int *rvol,
 			const unsigned int sz);
 	void bandpass(signed short *sp,
 			const reverb_params *rp,
@@ -193,7 +193,7 @@ protected:
 		ym_generic_device::device_start();
 
 		// allocate our stream
-		m_stream = device_sound_interface::stream_alloc(0, OUTPUTS, m_chip.sample_rate(device_t::clock()));
+		m_stream = device_sound_interface::stream_alloc(0, OUTPUTS, m_chip.sample_rate(device_t::clock()), STREAM_PARALLEL_SAFE);
 
 		// compute the size of the save buffer by doing an initial save
 		ymfm::ymfm_saved_state state(m_save_blob, true);
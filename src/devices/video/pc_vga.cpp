@@ -102,6 +102,28 @@
 #define TGA_START_ADDRESS (vga.crtc.start_addr<<2)
 #define TGA_LINE_LENGTH (vga.crtc.offset<<3)
 
+namespace {
+
+// spreads the 8 bits of a plane byte across the bytes of a u64, leftmost
+// pixel (bit 7) in the low byte; OR-ing four planes shifted by their index
+// yields eight 4-bit pixels at once
+struct planar_expand_table
+{
+	constexpr planar_expand_table() : bits()
+	{
+		for (int value = 0; value < 256; value++)
+			for (int pixel = 0; pixel < 8; pixel++)
+				if (BIT(value, 7 - pixel))
+					bits[value] |= u64(1) << (pixel * 8);
+	}
+
+	u64 bits[256];
+};
+
+constexpr planar_expand_table s_planar_expand;
+
+} // anonymous namespace
+
 
 /***************************************************************************
 
@@ -1218,6 +1240,7 @@ uint8_t vga_device::vga_latch_write(int offs, uint8_t data)
 void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
 	int width=VGA_CH_WIDTH, height = (vga.crtc.maximum_scan_line) * (vga.crtc.scan_doubling + 1);
+	const rectangle &visarea = screen().visible_area();
 
 	if(vga.crtc.cursor_enable)
 		vga.cursor.visible = screen().frame_number() & 0x10;
@@ -1239,37 +1262,29 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 			uint8_t back_col = (attr & 0x70) >> 4;
 			back_col |= (vga.attribute.data[0x10]&8) ? 0 : ((attr & 0x80) >> 4);
 
+			pen_t const fore_pen = vga.pens[blink_en ? back_col : fore_col];
+			pen_t const back_pen = vga.pens[back_col];
+			int const x0 = column*width;
+
 			for (int h = std::max(-line, 0); (h < height) && (line+h < std::min(TEXT_LINES, bitmap.height())); h++)
 			{
+				if (line+h < visarea.top() || line+h > visarea.bottom())
+					continue;
+
 				uint32_t *const bitmapline = &bitmap.pix(line+h);
 				uint8_t bits = vga.memory[font_base+(h>>(vga.crtc.scan_doubling))];
 
 				int mask, w;
 				for (mask=0x80, w=0; (w<width)&&(w<8); w++, mask>>=1)
 				{
-					pen_t pen;
-					if (bits&mask)
-						pen = vga.pens[blink_en ? back_col : fore_col];
-					else
-						pen = vga.pens[back_col];
-
-					if(!screen().visible_area().contains(column*width+w, line+h))
-						continue;
-					bitmapline[column*width+w] = pen;
-
+					if (x0+w >= visarea.left() && x0+w <= visarea.right())
+						bitmapline[x0+w] = (bits&mask) ? fore_pen : back_pen;
 				}
 				if (w<width)
 				{
 					/* 9 column */
-					pen_t pen;
-					if (TEXT_COPY_9COLUMN(ch)&&(bits&1))
-						pen = vga.pens[blink_en ? back_col : fore_col];
-					else
-						pen = vga.pens[back_col];
-
-					if(!screen().visible_area().contains(column*width+w, line+h))
-						continue;
-					bitmapline[column*width+w] = pen;
+					if (x0+w >= visarea.left() && x0+w <= visarea.right())
+						bitmapline[x0+w] = (TEXT_COPY_9COLUMN(ch)&&(bits&1)) ? fore_pen : back_pen;
 				}
 			}
 			if (vga.cursor.visible&&(pos==vga.crtc.cursor_addr))
@@ -1291,12 +1306,12 @@ void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 {
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
 	int pel_shift = (vga.attribute.pel_shift & 7);
+	const rectangle &visarea = screen().visible_area();
 
 	for (int addr=EGA_START_ADDRESS, line=0; line<LINES; line += height, addr += offset())
 	{
 		for (int yi=0;yi<height;yi++)
 		{
-			uint32_t *const bitmapline = &bitmap.pix(line + yi);
 			// ibm_5150:batmanmv uses this on gameplay for both EGA and "VGA" modes
 			// NB: EGA mode in that game sets 663, should be 303 like the other mode
 			// causing no status bar to appear. This is a known btanb in how VGA
@@ -1304,26 +1319,25 @@ void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 			if((line + yi) == (vga.crtc.line_compare & 0x3ff))
 				addr = 0;
 
+			if((line + yi) < visarea.top() || (line + yi) > visarea.bottom())
+				continue;
+			if(line_unchanged(line + yi, addr, EGA_COLUMNS+1, 4, 0xffff, pel_shift))
+				continue;
+
+			uint32_t *const bitmapline = &bitmap.pix(line + yi);
 			for (int pos=addr, c=0, column=0; column<EGA_COLUMNS+1; column++, c+=8, pos=(pos+1)&0xffff)
 			{
-				int data[4] = {
-						vga.memory[(pos & 0xffff)],
-						vga.memory[(pos & 0xffff)+0x10000]<<1,
-						vga.memory[(pos & 0xffff)+0x20000]<<2,
-						vga.memory[(pos & 0xffff)+0x30000]<<3 };
+				u64 const pixels =
+						s_planar_expand.bits[vga.memory[(pos & 0xffff)]] |
+						(s_planar_expand.bits[vga.memory[(pos & 0xffff)+0x10000]] << 1) |
+						(s_planar_expand.bits[vga.memory[(pos & 0xffff)+0x20000]] << 2) |
+						(s_planar_expand.bits[vga.memory[(pos & 0xffff)+0x30000]] << 3);
 
-				for (int i = 7; i >= 0; i--)
+				for (int i = 0; i < 8; i++)
 				{
-					pen_t pen = vga.pens[(data[0]&1) | (data[1]&2) | (data[2]&4) | (data[3]&8)];
-
-					data[0]>>=1;
-					data[1]>>=1;
-					data[2]>>=1;
-					data[3]>>=1;
-
-					if(!screen().visible_area().contains(c+i-pel_shift, line + yi))
-						continue;
-					bitmapline[c+i-pel_shift] = pen;
+					int const x = c+i-pel_shift;
+					if(x >= visarea.left() && x <= visarea.right())
+						bitmapline[x] = vga.pens[(pixels >> (i * 8)) & 0x0f];
 				}
 			}
 		}
@@ -1343,6 +1357,10 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 //  popmessage("%02x %02x",vga.attribute.pel_shift,vga.sequencer.data[4] & 0x08);
 
+	const rectangle &visarea = screen().visible_area();
+	pen_t const *const pens = this->pens();
+	uint32_t const wrap = vga.crtc.no_wrap ? 0 : 0xffff;
+
 	int curr_addr = 0;
 	if(!(vga.sequencer.data[4] & 0x08))
 	{
@@ -1357,6 +1375,13 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 					curr_addr = 0;
 					pel_shift = 0;
 				}
+				if((line + yi) < visarea.top() || (line + yi) > visarea.bottom())
+					continue;
+				// lines running off the end of the planes are drawn partially and never cached
+				bool const complete = curr_addr + VGA_COLUMNS <= 0x80000/4;
+				if(line_unchanged(line + yi, curr_addr, complete ? VGA_COLUMNS+1 : 0, 4, wrap, pel_shift))
+					continue;
+
 				uint32_t *const bitmapline = &bitmap.pix(line + yi);
 				for (int pos=curr_addr, c=0, column=0; column<VGA_COLUMNS+1; column++, c+=8, pos++)
 				{
@@ -1365,9 +1390,9 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 					for(int xi=0;xi<8;xi++)
 					{
-						if (!screen().visible_area().contains(c+xi-(pel_shift), line + yi))
-							continue;
-						bitmapline[c+xi-(pel_shift)] = pen(vga.memory[(pos & addrmask)+((xi >> 1)*0x10000)]);
+						int const x = c+xi-pel_shift;
+						if(x >= visarea.left() && x <= visarea.right())
+							bitmapline[x] = pens[vga.memory[(pos & addrmask)+((xi >> 1)*0x10000)]];
 					}
 				}
 			}
@@ -1383,6 +1408,12 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 					curr_addr = addr;
 				if((line + yi) == (vga.crtc.line_compare & mask_comp))
 					curr_addr = 0;
+				if((line + yi) < visarea.top() || (line + yi) > visarea.bottom())
+					continue;
+				bool const complete = curr_addr + (VGA_COLUMNS+1)*8 <= 0x80000;
+				if(line_unchanged(line + yi, curr_addr, complete ? (VGA_COLUMNS+1)*8 : 0, 1, wrap, pel_shift))
+					continue;
+
 				uint32_t *const bitmapline = &bitmap.pix(line + yi);
 				//addr %= 0x80000;
 				for (int pos=curr_addr, c=0, column=0; column<VGA_COLUMNS+1; column++, c+=0x10, pos+=0x8)
@@ -1392,9 +1423,9 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 					for (int xi=0;xi<0x10;xi++)
 					{
-						if(!screen().visible_area().contains(c+xi-(pel_shift), line + yi))
-							continue;
-						bitmapline[c+xi-pel_shift] = pen(vga.memory[(pos+(xi >> 1)) & addrmask]);
+						int const x = c+xi-pel_shift;
+						if(x >= visarea.left() && x <= visarea.right())
+							bitmapline[x] = pens[vga.memory[(pos+(xi >> 1)) & addrmask]];
 					}
 				}
 			}
@@ -1528,20 +1559,104 @@ uint8_t vga_device::pc_vga_choosevideomode()
 	return SCREEN_OFF;
 }
 
+/**************************************
+ *
+ * Scanline cache
+ *
+ *************************************/
+
+bitmap_rgb32 &vga_device::line_cache_begin(uint8_t mode, bitmap_rgb32 &bitmap)
+{
+	bool flush = false;
+	if (m_line_cache.width() != bitmap.width() || m_line_cache.height() != bitmap.height())
+	{
+		m_line_cache.allocate(bitmap.width(), bitmap.height());
+		m_line_cache_lines.clear();
+		m_line_cache_lines.resize(bitmap.height());
+		flush = true;
+	}
+
+	// anything that changes how every line is drawn starts the cache afresh
+	pen_t const *const pens = this->pens();
+	m_line_cache_pens.resize(0x100 + std::size(vga.pens));
+	if (mode != m_line_cache_mode || screen().visible_area() != m_line_cache_visarea ||
+			!std::equal(pens, pens + 0x100, m_line_cache_pens.begin()) ||
+			!std::equal(std::begin(vga.pens), std::end(vga.pens), m_line_cache_pens.begin() + 0x100))
+	{
+		m_line_cache_mode = mode;
+		m_line_cache_visarea = screen().visible_area();
+		std::copy(pens, pens + 0x100, m_line_cache_pens.begin());
+		std::copy(std::begin(vga.pens), std::end(vga.pens), m_line_cache_pens.begin() + 0x100);
+		flush = true;
+	}
+
+	if (flush)
+	{
+		for (line_cache_entry &entry : m_line_cache_lines)
+			entry.valid = false;
+	}
+
+	m_line_cache_active = true;
+	return m_line_cache;
+}
+
+void vga_device::line_cache_end(bitmap_rgb32 &bitmap, const rectangle &cliprect)
+{
+	m_line_cache_active = false;
+	copybitmap(bitmap, m_line_cache, 0, 0, 0, 0, cliprect);
+}
+
+// returns true if line y of the cache was drawn from the same planes*length
+// VRAM bytes at addr (masked by wrap, if non-zero) with the same state, so it
+// can be kept; otherwise records them and returns false for it to be drawn.
+// A length of 0 marks a line that can't be cached.
+bool vga_device::line_unchanged(int y, uint32_t addr, uint32_t length, int planes, uint32_t wrap, uint32_t state)
+{
+	if (!m_line_cache_active || y < 0 || y >= m_line_cache_lines.size())
+		return false;
+
+	line_cache_entry &entry = m_line_cache_lines[y];
+	if (wrap)
+		addr &= wrap;
+	if (!length || (wrap && (addr + length > wrap + 1)) || (addr + (planes - 1) * 0x10000 + length > vga.svga_intf.vram_size))
+	{
+		entry.valid = false;
+		return false;
+	}
+
+	bool same = entry.valid && entry.addr == addr && entry.length == length && entry.planes == planes && entry.state == state;
+	for (int plane = 0; same && (plane < planes); plane++)
+		same = !memcmp(&entry.data[plane * length], &vga.memory[addr + plane * 0x10000], length);
+	if (same)
+		return true;
+
+	entry.valid = true;
+	entry.addr = addr;
+	entry.length = length;
+	entry.planes = planes;
+	entry.state = state;
+	entry.data.resize(planes * length);
+	for (int plane = 0; plane < planes; plane++)
+		memcpy(&entry.data[plane * length], &vga.memory[addr + plane * 0x10000], length);
+	return false;
+}
+
 uint32_t vga_device::screen_update(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
 	uint8_t cur_mode = pc_vga_choosevideomode();
+	bitmap_rgb32 &dest = line_cache_begin(cur_mode, bitmap);
 
 	switch(cur_mode)
 	{
-		case SCREEN_OFF:   bitmap.fill  (black_pen(), cliprect);break;
-		case TEXT_MODE:    vga_vh_text  (bitmap, cliprect); break;
-		case VGA_MODE:     vga_vh_vga   (bitmap, cliprect); break;
-		case EGA_MODE:     vga_vh_ega   (bitmap, cliprect); break;
-		case CGA_MODE:     vga_vh_cga   (bitmap, cliprect); break;
-		case MONO_MODE:    vga_vh_mono  (bitmap, cliprect); break;
+		case SCREEN_OFF:   dest.fill    (black_pen(), cliprect);break;
+		case TEXT_MODE:    vga_vh_text  (dest, cliprect); break;
+		case VGA_MODE:     vga_vh_vga   (dest, cliprect); break;
+		case EGA_MODE:     vga_vh_ega   (dest, cliprect); break;
+		case CGA_MODE:     vga_vh_cga   (dest, cliprect); break;
+		case MONO_MODE:    vga_vh_mono  (dest, cliprect); break;
 	}
 
+	line_cache_end(bitmap, cliprect);
 	return 0;
 }
 
@@ -1831,6 +1946,9 @@ void svga_device::svga_vh_rgb8(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 //      line_length = vga.crtc.offset << 4;
 //  }
 
+	const rectangle &visarea = screen().visible_area();
+	pen_t const *const pens = this->pens();
+
 	uint8_t start_shift = (!(vga.sequencer.data[4] & 0x08) || svga.ignore_chain4) ? 2 : 0;
 	for (int addr = VGA_START_ADDRESS << start_shift, line=0; line<LINES; line+=height, addr+=offset(), curr_addr+=offset())
 	{
@@ -1840,8 +1958,14 @@ void svga_device::svga_vh_rgb8(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				curr_addr = addr;
 			if((line + yi) == (vga.crtc.line_compare & mask_comp))
 				curr_addr = 0;
-			uint32_t *const bitmapline = &bitmap.pix(line + yi);
 			addr %= vga.svga_intf.vram_size;
+			if((line + yi) < visarea.top() || (line + yi) > visarea.bottom())
+				continue;
+			bool const complete = curr_addr + VGA_COLUMNS*8 < vga.svga_intf.vram_size;
+			if(line_unchanged(line + yi, curr_addr, complete ? VGA_COLUMNS*8 : 0, 1, 0, 0))
+				continue;
+
+			uint32_t *const bitmapline = &bitmap.pix(line + yi);
 			for (int pos=curr_addr, c=0, column=0; column<VGA_COLUMNS; column++, c+=8, pos+=0x8)
 			{
 				if(pos + 0x08 >= vga.svga_intf.vram_size)
@@ -1849,9 +1973,8 @@ void svga_device::svga_vh_rgb8(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 				for (int xi=0;xi<8;xi++)
 				{
-					if(!screen().visible_area().contains(c+xi, line + yi))
-						continue;
-					bitmapline[c+xi] = pen(vga.memory[(pos+(xi))]);
+					if(c+xi >= visarea.left() && c+xi <= visarea.right())
+						bitmapline[c+xi] = pens[vga.memory[(pos+(xi))]];
 				}
 			}
 		}
@@ -1868,22 +1991,30 @@ void svga_device::svga_vh_rgb15(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 //  uint16_t mask_comp = 0xff | (TLINES & 0x300);
 	int curr_addr = 0;
 	int yi=0;
+	const rectangle &visarea = screen().visible_area();
 	for (int addr = TGA_START_ADDRESS, line=0; line<TLINES; line+=height, addr+=offset(), curr_addr+=offset())
 	{
-		uint32_t *const bitmapline = &bitmap.pix(line);
 		addr %= vga.svga_intf.vram_size;
+		if((line + yi) < visarea.top() || (line + yi) > visarea.bottom())
+			continue;
+		bool const complete = addr + TGA_COLUMNS*0x10 < vga.svga_intf.vram_size;
+		if(line_unchanged(line + yi, addr, complete ? TGA_COLUMNS*0x10 : 0, 1, 0, 0))
+			continue;
+
+		uint32_t *const bitmapline = &bitmap.pix(line);
 		for (int pos=addr, c=0, column=0; column<TGA_COLUMNS; column++, c+=8, pos+=0x10)
 		{
 			if(pos + 0x10 >= vga.svga_intf.vram_size)
 				return;
 			for(int xi=0,xm=0;xi<8;xi++,xm+=2)
 			{
-				if(!screen().visible_area().contains(c+xi, line + yi))
+				if(c+xi < visarea.left() || c+xi > visarea.right())
 					continue;
 
-				int r = (MV(pos+xm)&0x7c00)>>10;
-				int g = (MV(pos+xm)&0x03e0)>>5;
-				int b = (MV(pos+xm)&0x001f)>>0;
+				int const data = MV(pos+xm);
+				int r = (data&0x7c00)>>10;
+				int g = (data&0x03e0)>>5;
+				int b = (data&0x001f)>>0;
 				r = (r << 3) | (r & 0x7);
 				g = (g << 3) | (g & 0x7);
 				b = (b << 3) | (b & 0x7);
@@ -1903,22 +2034,30 @@ void svga_device::svga_vh_rgb16(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 //  uint16_t mask_comp = 0xff | (TLINES & 0x300);
 	int curr_addr = 0;
 	int yi=0;
+	const rectangle &visarea = screen().visible_area();
 	for (int addr = TGA_START_ADDRESS, line=0; line<TLINES; line+=height, addr+=offset(), curr_addr+=offset())
 	{
-		uint32_t *const bitmapline = &bitmap.pix(line);
 		addr %= vga.svga_intf.vram_size;
+		if((line + yi) < visarea.top() || (line + yi) > visarea.bottom())
+			continue;
+		bool const complete = addr + TGA_COLUMNS*0x10 < vga.svga_intf.vram_size;
+		if(line_unchanged(line + yi, addr, complete ? TGA_COLUMNS*0x10 : 0, 1, 0, 0))
+			continue;
+
+		uint32_t *const bitmapline = &bitmap.pix(line);
 		for (int pos=addr, c=0, column=0; column<TGA_COLUMNS; column++, c+=8, pos+=0x10)
 		{
 			if(pos + 0x10 >= vga.svga_intf.vram_size)
 				return;
 			for (int xi=0,xm=0;xi<8;xi++,xm+=2)
 			{
-				if(!screen().visible_area().contains(c+xi, line + yi))
+				if(c+xi < visarea.left() || c+xi > visarea.right())
 					continue;
 
-				int r = (MV(pos+xm)&0xf800)>>11;
-				int g = (MV(pos+xm)&0x07e0)>>5;
-				int b = (MV(pos+xm)&0x001f)>>0;
+				int const data = MV(pos+xm);
+				int r = (data&0xf800)>>11;
+				int g = (data&0x07e0)>>5;
+				int b = (data&0x001f)>>0;
 				r = (r << 3) | (r & 0x7);
 				g = (g << 2) | (g & 0x3);
 				b = (b << 3) | (b & 0x7);
@@ -1938,22 +2077,30 @@ void svga_device::svga_vh_rgb24(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 //  uint16_t mask_comp = 0xff | (TLINES & 0x300);
 	int curr_addr = 0;
 	int yi=0;
+	const rectangle &visarea = screen().visible_area();
 	for (int addr = TGA_START_ADDRESS<<1, line=0; line<TLINES; line+=height, addr+=offset(), curr_addr+=offset())
 	{
-		uint32_t *const bitmapline = &bitmap.pix(line);
 		addr %= vga.svga_intf.vram_size;
+		if((line + yi) < visarea.top() || (line + yi) > visarea.bottom())
+			continue;
+		bool const complete = addr + TGA_COLUMNS*24 < vga.svga_intf.vram_size;
+		if(line_unchanged(line + yi, addr, complete ? TGA_COLUMNS*24 : 0, 1, 0, 0))
+			continue;
+
+		uint32_t *const bitmapline = &bitmap.pix(line);
 		for (int pos=addr, c=0, column=0; column<TGA_COLUMNS; column++, c+=8, pos+=24)
 		{
 			if(pos + 24 >= vga.svga_intf.vram_size)
 				return;
 			for (int xi=0,xm=0;xi<8;xi++,xm+=3)
 			{
-				if(!screen().visible_area().contains(c+xi, line + yi))
+				if(c+xi < visarea.left() || c+xi > visarea.right())
 					continue;
 
-				int r = (MD(pos+xm)&0xff0000)>>16;
-				int g = (MD(pos+xm)&0x00ff00)>>8;
-				int b = (MD(pos+xm)&0x0000ff)>>0;
+				int const data = MD(pos+xm);
+				int r = (data&0xff0000)>>16;
+				int g = (data&0x00ff00)>>8;
+				int b = (data&0x0000ff)>>0;
 				bitmapline[c+xi] = ID|(r<<16)|(g<<8)|(b<<0);
 			}
 		}
@@ -1972,22 +2119,30 @@ void svga_device::svga_vh_rgb32(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 //  mask_comp = 0xff | (TLINES & 0x300);
 	int curr_addr = 0;
 	int yi=0;
+	const rectangle &visarea = screen().visible_area();
 	for (int addr = TGA_START_ADDRESS, line=0; line<TLINES; line+=height, addr+=(offset()), curr_addr+=(offset()))
 	{
-		uint32_t *const bitmapline = &bitmap.pix(line);
 		addr %= vga.svga_intf.vram_size;
+		if((line + yi) < visarea.top() || (line + yi) > visarea.bottom())
+			continue;
+		bool const complete = addr + TGA_COLUMNS*0x20 < vga.svga_intf.vram_size;
+		if(line_unchanged(line + yi, addr, complete ? TGA_COLUMNS*0x20 : 0, 1, 0, 0))
+			continue;
+
+		uint32_t *const bitmapline = &bitmap.pix(line);
 		for (int pos=addr, c=0, column=0; column<TGA_COLUMNS; column++, c+=8, pos+=0x20)
 		{
 			if(pos + 0x20 >= vga.svga_intf.vram_size)
 				return;
 			for (int xi=0,xm=0;xi<8;xi++,xm+=4)
 			{
-				if(!screen().visible_area().contains(c+xi, line + yi))
+				if(c+xi < visarea.left() || c+xi > visarea.right())
 					continue;
 
-				int r = (MD(pos+xm)&0xff0000)>>16;
-				int g = (MD(pos+xm)&0x00ff00)>>8;
-				int b = (MD(pos+xm)&0x0000ff)>>0;
+				int const data = MD(pos+xm);
+				int r = (data&0xff0000)>>16;
+				int g = (data&0x00ff00)>>8;
+				int b = (data&0x0000ff)>>0;
 				bitmapline[c+xi] = ID|(r<<16)|(g<<8)|(b<<0);
 			}
 		}
@@ -2088,21 +2243,23 @@ uint8_t svga_device::get_video_depth()
 uint32_t svga_device::screen_update(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
 	uint8_t cur_mode = pc_vga_choosevideomode();
+	bitmap_rgb32 &dest = line_cache_begin(cur_mode, bitmap);
 
 	switch(cur_mode)
 	{
-		case SCREEN_OFF:   bitmap.fill  (black_pen(), cliprect);break;
-		case TEXT_MODE:    vga_vh_text  (bitmap, cliprect); break;
-		case VGA_MODE:     vga_vh_vga   (bitmap, cliprect); break;
-		case EGA_MODE:     vga_vh_ega   (bitmap, cliprect); break;
-		case CGA_MODE:     vga_vh_cga   (bitmap, cliprect); break;
-		case MONO_MODE:    vga_vh_mono  (bitmap, cliprect); break;
-		case RGB8_MODE:    svga_vh_rgb8 (bitmap, cliprect); break;
-		case RGB15_MODE:   svga_vh_rgb15(bitmap, cliprect); break;
-		case RGB16_MODE:   svga_vh_rgb16(bitmap, cliprect); break;
-		case RGB24_MODE:   svga_vh_rgb24(bitmap, cliprect); break;
-		case RGB32_MODE:   svga_vh_rgb32(bitmap, cliprect); break;
+		case SCREEN_OFF:   dest.fill    (black_pen(), cliprect);break;
+		case TEXT_MODE:    vga_vh_text  (dest, cliprect); break;
+		case VGA_MODE:     vga_vh_vga   (dest, cliprect); break;
+		case EGA_MODE:     vga_vh_ega   (dest, cliprect); break;
+		case CGA_MODE:     vga_vh_cga   (dest, cliprect); break;
+		case MONO_MODE:    vga_vh_mono  (dest, cliprect); break;
+		case RGB8_MODE:    svga_vh_rgb8 (dest, cliprect); break;
+		case RGB15_MODE:   svga_vh_rgb15(dest, cliprect); break;
+		case RGB16_MODE:   svga_vh_rgb16(dest, cliprect); break;
+		case RGB24_MODE:   svga_vh_rgb24(dest, cliprect); break;
+		case RGB32_MODE:   svga_vh_rgb32(dest, cliprect); break;
 	}
 
+	line_cache_end(bitmap, cliprect);
 	return 0;
 }
@@ -154,6 +154,12 @@ protected:
 	virtual bool get_interlace_mode() { return false; }
 	virtual void palette_update();
 
+	// scanline cache: the renderers draw into a private bitmap and skip
+	// any line whose VRAM bytes and render state match the last frame's
+	bitmap_rgb32 &line_cache_begin(uint8_t mode, bitmap_rgb32 &bitmap);
+	void line_cache_end(bitmap_rgb32 &bitmap, const rectangle &cliprect);
+	bool line_unchanged(int y, uint32_t addr, uint32_t length, int planes, uint32_t wrap, uint32_t state);
+
 	struct vga_t
 	{
 		vga_t(device_t &owner) { }
@@ -296,6 +302,23 @@ protected:
 	address_space_config m_atc_space_config;
 
 	bool m_ioas = false;
+
+	struct line_cache_entry
+	{
+		bool valid = false;
+		uint32_t addr = 0;
+		uint32_t length = 0;
+		int planes = 0;
+		uint32_t state = 0;
+		std::vector<uint8_t> data;      // VRAM bytes the line was drawn from, plane by plane
+	};
+
+	bitmap_rgb32 m_line_cache;
+	std::vector<line_cache_entry> m_line_cache_lines;
+	std::vector<pen_t> m_line_cache_pens;   // palette and attribute pens the cache was drawn with
+	rectangle m_line_cache_visarea;
+	uint8_t m_line_cache_mode = SCREEN_OFF;
+	bool m_line_cache_active = false;
 };
 
 
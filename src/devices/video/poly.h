@@ -39,6 +39,7 @@
 
 #include <climits>
 #include <atomic>
+#include <deque>
 
 
 #define KEEP_POLY_STATISTICS 0
@@ -335,6 +336,9 @@ private:
 	static constexpr int SCANLINES_PER_BUCKET = 32;
 	static constexpr int TOTAL_BUCKETS        = (512 / SCANLINES_PER_BUCKET);
 
+	// units are queued in batches of at least this many, outside of waits
+	static constexpr u32 UNITS_PER_BATCH      = 64;
+
 	// primitive_info describes a single primitive
 	struct primitive_info
 	{
@@ -359,6 +363,18 @@ private:
 		extent_t              extent[SCANLINES_PER_BUCKET]; // array of scanline extents
 	};
 
+	// units queued together; each work item queued for a batch claims
+	// units from it until there are none left, so a thread that finishes
+	// early takes over work that would otherwise wait behind a slow one
+	struct work_batch
+	{
+		work_batch(poly_manager &owner, u32 start, u32 end) : m_owner(owner), m_next(start), m_end(end) { }
+
+		poly_manager &        m_owner;                // pointer back to the poly manager
+		std::atomic<uint32_t> m_next;                 // index of the next unit to claim
+		uint32_t              m_end;                  // index after the last unit
+	};
+
 	// internal array types
 	using primitive_array = poly_array<primitive_info, 0>;
 	using unit_array = poly_array<work_unit, 0>;
@@ -383,28 +399,36 @@ private:
 		return primitive;
 	}
 
-	// enqueue work items in contiguous chunks
-	void queue_items(u32 start)
+	// enqueue the units allocated since the last batch
+	void queue_items(bool flush)
 	{
 		// do nothing if no queue; items will be processed on the next wait
 		if (m_queue == nullptr)
 			return;
 
-		// enqueue the items in contiguous chunks
-		while (start < m_unit.count())
-		{
-			u32 chunk;
-			work_unit *base = m_unit.contiguous(start, m_unit.count() - start, chunk);
-			osd_work_item_queue_multiple(m_queue, work_item_callback, chunk, base, m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
-			start += chunk;
-		}
+		// queueing costs a lock per work item and a wakeup per thread, so
+		// let small primitives build up into batches
+		u32 const count = m_unit.count() - m_unit_queued;
+		if ((count == 0) || (!flush && (count < UNITS_PER_BATCH)))
+			return;
+
+#if KEEP_POLY_STATISTICS
+		if (m_unit_queued == 0)
+			m_active_start = get_profile_ticks();
+#endif
+		work_batch &batch = m_batch.emplace_back(*this, m_unit_queued, m_unit.count());
+		osd_work_item_queue_multiple(m_queue, batch_callback, std::min<u32>(count, WORK_MAX_THREADS), &batch, 0, WORK_ITEM_FLAG_AUTO_RELEASE);
+		m_unit_queued = m_unit.count();
 	}
 
 	static void *work_item_callback(void *param, int threadid);
+	static void *batch_callback(void *param, int threadid);
 	void presave() { wait("pre-save"); }
 
 	// queue management
 	osd_work_queue *m_queue;               // work queue
+	std::deque<work_batch> m_batch;        // batches queued since the last wait
+	u32 m_unit_queued;                     // number of units queued so far
 
 	// arrays
 	primitive_array m_primitive;           // array of primitives
@@ -423,6 +447,10 @@ private:
 #if KEEP_POLY_STATISTICS
 	uint32_t m_conflicts[WORK_MAX_THREADS] = { 0 }; // number of conflicts found, per thread
 	uint32_t m_resolved[WORK_MAX_THREADS] = { 0 };  // number of conflicts resolved, per thread
+	uint32_t m_units_run[WORK_MAX_THREADS] = { 0 }; // number of units run, per thread
+	osd_ticks_t m_busy_ticks[WORK_MAX_THREADS] = { 0 }; // time spent running units, per thread
+	osd_ticks_t m_active_start = 0;                // time the first batch since the last wait was queued
+	osd_ticks_t m_active_ticks = 0;                // total time from the first batch to the end of each wait
 #endif
 #if TRACK_POLY_WAITS
 	static std::string friendly_number(u64 number);
@@ -464,6 +492,7 @@ private:
 template<typename BaseType, class ObjectType, int MaxParams, u8 Flags>
 poly_manager<BaseType, ObjectType, MaxParams, Flags>::poly_manager(running_machine &machine) :
 	m_queue(nullptr),
+	m_unit_queued(0),
 	m_tiles(0),
 	m_triangles(0),
 	m_polygons(0),
@@ -535,6 +564,9 @@ poly_manager<BaseType, ObjectType, MaxParams, Flags>::~poly_manager()
 		osd_printf_info("Total pixels   = %d\n", uint32_t(m_pixels));
 
 	osd_printf_info("Conflicts:   %d resolved, %d total\n", resolved, conflicts);
+	for (int i = 0; i < std::size(m_units_run); i++)
+		if (m_units_run[i] != 0)
+			osd_printf_info("Thread %2d:   %9d units, %3d%% idle\n", i, m_units_run[i], (m_active_ticks == 0) ? 0 : int(100 - std::min<osd_ticks_t>(100, m_busy_ticks[i] * 100 / m_active_ticks)));
 	osd_printf_info("Units:       %5d used, %5d allocated, %4d bytes each, %7d total\n", m_unit.max(), m_unit.allocated(), int(m_unit.itemsize()), int(m_unit.allocated() * m_unit.itemsize()));
 	osd_printf_info("Primitives:  %5d used, %5d allocated, %4d bytes each, %7d total\n", m_primitive.max(), m_primitive.allocated(), int(m_primitive.itemsize()), int(m_primitive.allocated() * m_primitive.itemsize()));
 	osd_printf_info("Object data: %5d used, %5d allocated, %4d bytes each, %7d total\n", m_object.max(), m_object.allocated(), int(m_object.itemsize()), int(m_object.allocated() * m_object.itemsize()));
@@ -640,6 +672,32 @@ void *poly_manager<BaseType, ObjectType, MaxParams, Flags>::work_item_callback(v
 }
 
 
+//-------------------------------------------------
+//  batch_callback - process units from a batch
+//  until they have all been claimed
+//-------------------------------------------------
+
+template<typename BaseType, class ObjectType, int MaxParams, u8 Flags>
+void *poly_manager<BaseType, ObjectType, MaxParams, Flags>::batch_callback(void *param, int threadid)
+{
+	work_batch &batch = *(work_batch *)param;
+#if KEEP_POLY_STATISTICS
+	osd_ticks_t const start = get_profile_ticks();
+#endif
+	for (uint32_t unitnum = batch.m_next++; unitnum < batch.m_end; unitnum = batch.m_next++)
+	{
+		work_item_callback(&batch.m_owner.m_unit.byindex(unitnum), threadid);
+#if KEEP_POLY_STATISTICS
+		batch.m_owner.m_units_run[threadid]++;
+#endif
+	}
+#if KEEP_POLY_STATISTICS
+	batch.m_owner.m_busy_ticks[threadid] += get_profile_ticks() - start;
+#endif
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  wait - stall until all work is complete
 //-------------------------------------------------
@@ -651,6 +709,9 @@ void poly_manager<BaseType, ObjectType, MaxParams, Flags>::wait(char const *debu
 	if (m_unit.count() == 0)
 		return;
 
+	// queue anything still waiting for its batch to fill
+	queue_items(true);
+
 #if TRACK_POLY_WAITS
 	int items = osd_work_queue_items(m_queue);
 	osd_ticks_t time = get_profile_ticks();
@@ -658,7 +719,14 @@ void poly_manager<BaseType, ObjectType, MaxParams, Flags>::wait(char const *debu
 
 	// wait for all pending work items to complete
 	if (m_queue != nullptr)
+	{
 		osd_work_queue_wait(m_queue, osd_ticks_per_second() * 100);
+		m_batch.clear();
+		m_unit_queued = 0;
+#if KEEP_POLY_STATISTICS
+		m_active_ticks += get_profile_ticks() - m_active_start;
+#endif
+	}
 
 	// if we don't have a queue, just run the whole list now
 	else
@@ -750,7 +818,6 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_tile(recta
 
 	// compute the X extents for each scanline
 	int32_t pixels = 0;
-	uint32_t startunit = m_unit.count();
 	int32_t scaninc = 1;
 	for (int32_t curscan = v1yclip; curscan < v2yclip; curscan += scaninc)
 	{
@@ -792,7 +859,7 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_tile(recta
 	}
 
 	// enqueue the work items
-	queue_items(startunit);
+	queue_items(false);
 
 	// return the total number of pixels in the triangle
 	m_tiles++;
@@ -891,7 +958,6 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_triangle(c
 
 	// compute the X extents for each scanline
 	int32_t pixels = 0;
-	uint32_t startunit = m_unit.count();
 	int32_t scaninc = 1;
 	for (int32_t curscan = v1yclip; curscan < v3yclip; curscan += scaninc)
 	{
@@ -955,7 +1021,7 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_triangle(c
 	}
 
 	// enqueue the work items
-	queue_items(startunit);
+	queue_items(false);
 
 	// return the total number of pixels in the triangle
 	m_triangles++;
@@ -1023,7 +1089,6 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_extents(re
 
 	// compute the X extents for each scanline
 	int32_t pixels = 0;
-	uint32_t startunit = m_unit.count();
 	int32_t scaninc = 1;
 	for (int32_t curscan = v1yclip; curscan < v3yclip; curscan += scaninc)
 	{
@@ -1077,7 +1142,7 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_extents(re
 	}
 
 	// enqueue the work items
-	queue_items(startunit);
+	queue_items(false);
 
 	// return the total number of pixels in the object
 	m_triangles++;
@@ -1197,7 +1262,6 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_polygon(re
 
 	// compute the X extents for each scanline
 	int32_t pixels = 0;
-	uint32_t startunit = m_unit.count();
 	int32_t scaninc = 1;
 	for (int32_t curscan = minyclip; curscan < maxyclip; curscan += scaninc)
 	{
@@ -1274,7 +1338,7 @@ uint32_t poly_manager<BaseType, ObjectType, MaxParams, Flags>::render_polygon(re
 	}
 
 	// enqueue the work items
-	queue_items(startunit);
+	queue_items(false);
 
 	// return the total number of pixels in the polygon
 	m_polygons++;
@@ -63,9 +63,6 @@ void ps2_gif_device::device_start()
 	save_item(NAME(m_p3cnt));
 	save_item(NAME(m_p3tag));
 	save_item(NAME(m_p3mask));
-	save_item(NAME(m_next_path3_hi));
-	save_item(NAME(m_next_path3_lo));
-	save_item(NAME(m_path3_available));
 	save_item(NAME(m_vu_mem_address));
 
 	// TODO: Save current tag
@@ -88,9 +85,6 @@ void ps2_gif_device::gif_reset()
 	m_current_path1_tag = tag_t();
 	m_current_path3_tag = tag_t();
 	m_last_tag = tag_t();
-	m_path3_available = true;
-	m_next_path3_hi = 0;
-	m_next_path3_lo = 0;
 	m_vu_mem_address = 0;
 }
 
@@ -263,9 +257,27 @@ void ps2_gif_device::write_path3(uint64_t hi, uint64_t lo)
 		return;
 	}
 
-	m_next_path3_hi = hi;
-	m_next_path3_lo = lo;
-	m_path3_available = false;
+	process_tag(m_current_path3_tag, hi, lo);
+}
+
+uint32_t ps2_gif_device::path3_image_qwords() const
+{
+	if (m_p3mask || !m_current_path3_tag.valid())
+		return 0;
+
+	const tag_t::format_t format = m_current_path3_tag.format();
+	if (format != tag_t::format_t::FMT_IMAGE && format != tag_t::format_t::FMT_DISABLE)
+		return 0;
+
+	return m_current_path3_tag.nloop();
+}
+
+void ps2_gif_device::write_path3_image(const uint64_t *data, uint32_t qwords)
+{
+	// Caller guarantees qwords <= path3_image_qwords(), so the whole run belongs to the current tag
+	m_last_tag = m_current_path3_tag;
+	m_gs->write_image(data, qwords << 1);
+	m_current_path3_tag.loop(qwords);
 }
 
 void ps2_gif_device::process_tag(tag_t &tag, uint64_t hi, uint64_t lo)
@@ -291,10 +303,12 @@ void ps2_gif_device::process_tag(tag_t &tag, uint64_t hi, uint64_t lo)
 			tag.loop();
 			break;
 		default:
-			m_gs->regs_w(0x54, lo);
-			m_gs->regs_w(0x54, hi);
+		{
+			const uint64_t data[2] = { lo, hi };
+			m_gs->write_image(data, 2);
 			tag.loop();
 			break;
+		}
 	}
 }
 
@@ -323,11 +337,6 @@ void ps2_gif_device::execute_run()
 			fetch_path1(hi, lo);
 			write_path1(hi, lo);
 		}
-		else if (!m_path3_available)
-		{
-			write_path3(m_next_path3_hi, m_next_path3_lo);
-			m_path3_available = false;
-		}
 		else
 		{
 			m_icount = 0;
@@ -39,9 +39,10 @@ public:
 	void kick_path1(uint32_t address);
 	void write_path1(uint64_t hi, uint64_t lo);
 	void write_path3(uint64_t hi, uint64_t lo);
+	uint32_t path3_image_qwords() const;
+	void write_path3_image(const uint64_t *data, uint32_t qwords);
 	void set_path3_mask(bool masked);
 	bool path1_available() const { return !m_current_path1_tag.valid(); }
-	bool path3_available() const { return m_path3_available; }
 
 protected:
 	virtual void device_start() override;
@@ -82,6 +83,7 @@ protected:
 		uint32_t reg() const { return m_regs[m_curr_reg]; }
 
 		void loop() { m_nloop--; }
+		void loop(uint16_t count) { m_nloop -= count; }
 		void next_reg();
 
 	protected:
@@ -119,9 +121,6 @@ protected:
 	uint32_t m_cnt;
 	uint32_t m_p3cnt;
 	uint32_t m_p3tag;
-	uint64_t m_next_path3_hi;
-	uint64_t m_next_path3_lo;
-	bool m_path3_available;
 	bool m_p3mask;
 	uint32_t m_vu_mem_address;
 };
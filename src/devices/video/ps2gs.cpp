@@ -79,6 +79,8 @@ void ps2_gs_device::device_start()
 	save_item(NAME(m_trx_height));
 
 	save_item(NAME(m_trx_dir));
+	save_item(NAME(m_trx_x));
+	save_item(NAME(m_trx_y));
 
 	save_item(NAME(m_base_regs));
 
@@ -186,6 +188,63 @@ void ps2_gs_device::device_start()
 
 	m_ram = std::make_unique<uint32_t[]>(0x400000/4);
 	m_vertices = std::make_unique<vertex_t[]>(0x10000); // Arbitrary count
+
+	build_swizzle_tables();
+}
+
+void ps2_gs_device::build_swizzle_tables()
+{
+	// Local memory is split into 8KB pages of 32 blocks, each block holding 4 columns.
+	// 32- and 16-bit columns share the same word order; 8- and 4-bit columns interleave
+	// two (or four) rows per word and swap their halves on alternate column pairs.
+	// The Z formats use these layouts with the block number XORed by 0x18.
+	for (uint32_t y = 0; y < 32; y++)
+	{
+		for (uint32_t x = 0; x < 64; x++)
+		{
+			const uint32_t bx = x >> 3, by = y >> 3;
+			const uint32_t block = BIT(bx, 0) | (BIT(by, 0) << 1) | (BIT(bx, 1) << 2) | (BIT(by, 1) << 3) | (BIT(bx, 2) << 4);
+			const uint32_t column = BIT(x, 0) | (BIT(y, 0) << 1) | (BIT(x, 1, 2) << 2) | (BIT(y, 1, 2) << 4);
+			m_swizzle32[(y << 6) | x] = (block << 6) | column;
+		}
+	}
+
+	for (uint32_t y = 0; y < 64; y++)
+	{
+		for (uint32_t x = 0; x < 64; x++)
+		{
+			const uint32_t bx = x >> 4, by = y >> 3;
+			const uint32_t block = BIT(by, 0) | (BIT(bx, 0) << 1) | (BIT(by, 1) << 2) | (BIT(bx, 1) << 3) | (BIT(by, 2) << 4);
+			const uint32_t block_s = BIT(by, 0) | (BIT(bx, 0) << 1) | (BIT(by, 2) << 2) | (BIT(by, 1) << 3) | (BIT(bx, 1) << 4);
+			const uint32_t column = BIT(x, 3) | (BIT(x, 0) << 1) | (BIT(y, 0) << 2) | (BIT(x, 1, 2) << 3) | (BIT(y, 1, 2) << 5);
+			m_swizzle16[(y << 6) | x] = (block << 7) | column;
+			m_swizzle16s[(y << 6) | x] = (block_s << 7) | column;
+		}
+	}
+
+	for (uint32_t y = 0; y < 64; y++)
+	{
+		for (uint32_t x = 0; x < 128; x++)
+		{
+			const uint32_t bx = x >> 4, by = y >> 4;
+			const uint32_t block = BIT(bx, 0) | (BIT(by, 0) << 1) | (BIT(bx, 1) << 2) | (BIT(by, 1) << 3) | (BIT(bx, 2) << 4);
+			const uint32_t cx = (x + ((BIT(y, 1) ^ BIT(y, 2)) << 2)) & 7;
+			const uint32_t word = BIT(cx, 0) | (BIT(y, 0) << 1) | (BIT(cx, 1, 2) << 2) | (BIT(y, 2, 2) << 4);
+			m_swizzle8[(y << 7) | x] = (block << 8) | (word << 2) | BIT(y, 1) | (BIT(x, 3) << 1);
+		}
+	}
+
+	for (uint32_t y = 0; y < 128; y++)
+	{
+		for (uint32_t x = 0; x < 128; x++)
+		{
+			const uint32_t bx = x >> 5, by = y >> 4;
+			const uint32_t block = BIT(by, 0) | (BIT(bx, 0) << 1) | (BIT(by, 1) << 2) | (BIT(bx, 1) << 3) | (BIT(by, 2) << 4);
+			const uint32_t cx = (x + ((BIT(y, 1) ^ BIT(y, 2)) << 2)) & 7;
+			const uint32_t word = BIT(cx, 0) | (BIT(y, 0) << 1) | (BIT(cx, 1, 2) << 2) | (BIT(y, 2, 2) << 4);
+			m_swizzle4[(y << 7) | x] = (block << 9) | (word << 3) | BIT(y, 1) | (BIT(x, 3, 2) << 1);
+		}
+	}
 }
 
 void ps2_gs_device::device_reset()
@@ -210,6 +269,8 @@ void ps2_gs_device::device_reset()
 	m_trx_height = 0;
 
 	m_trx_dir = 0;
+	m_trx_x = 0;
+	m_trx_y = 0;
 
 	memset(m_base_regs, 0, sizeof(uint64_t) * 15);
 
@@ -647,11 +708,12 @@ void ps2_gs_device::regs_w(offs_t offset, uint64_t data)
 			break;
 		case 0x53: // TRXDIR
 			m_trx_dir = data & 3;
+			m_trx_x = 0;
+			m_trx_y = 0;
 			logerror("%s: regs_w: TRXDIR = %08x%08x, %s\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data, dir_strs[m_trx_dir]);
 			break;
 		case 0x54: // HWREG
-			logerror("%s: regs_w: HWREG = %08x%08x\n", machine().describe_context(), (uint32_t)(data >> 32), (uint32_t)data);
-			copy_dword_from_host(data);
+			write_image(&data, 1);
 			break;
 		default:
 			logerror("%s: regs_w: Unknown register %02x = %08x%08x\n", machine().describe_context(), offset, (uint32_t)(data >> 32), (uint32_t)data);
@@ -659,75 +721,127 @@ void ps2_gs_device::regs_w(offs_t offset, uint64_t data)
 	}
 }
 
-void ps2_gs_device::copy_dword_from_host(uint64_t data)
+void ps2_gs_device::write_image(const uint64_t *data, uint32_t count)
 {
-	if (m_src_buf_fmt == PSMCT24 || m_src_buf_fmt == PSMZ24)
+	if (m_trx_dir != HOST_TO_LOCAL || !m_trx_width || m_trx_y >= m_trx_height)
 	{
-		// Special-case for unevenly-sized data.
-		// TODO: What do we do with leftover data, if any, when an IMAGE transfer finishes?
-		logerror("%s: Unsupported src format: PSMCT24/PSMZ24\n", machine().describe_context());
+		logerror("%s: write_image: No HOST_TO_LOCAL transfer in progress, dropping %d dwords\n", machine().describe_context(), count);
 		return;
 	}
-	const size_t bpp = FORMAT_PIXEL_WIDTHS[m_src_buf_fmt];
-	offs_t dst_offset = (m_dst_buf_base + m_dst_ul_y * m_dst_buf_width + m_dst_ul_x) >> 2;
-	for (size_t shift = 0, index = 0; shift < 64; shift += bpp, index++)
+
+	switch (m_dst_buf_fmt)
 	{
-		uint64_t src = (data >> shift) & ((1ULL << bpp) - 1ULL);
-		switch (m_dst_buf_fmt)
+		case PSMCT32:
+			write_image_pixels<32, 32>(data, count, m_swizzle32, 6, 5, 0, 0);
+			break;
+		case PSMZ32:
+			write_image_pixels<32, 32>(data, count, m_swizzle32, 6, 5, 0x18 << 6, 0);
+			break;
+		case PSMCT16:
+			write_image_pixels<16, 16>(data, count, m_swizzle16, 6, 6, 0, 0);
+			break;
+		case PSMCT16S:
+			write_image_pixels<16, 16>(data, count, m_swizzle16s, 6, 6, 0, 0);
+			break;
+		case PSMZ16:
+			write_image_pixels<16, 16>(data, count, m_swizzle16, 6, 6, 0x18 << 7, 0);
+			break;
+		case PSMZ16S:
+			write_image_pixels<16, 16>(data, count, m_swizzle16s, 6, 6, 0x18 << 7, 0);
+			break;
+		case PSMT8:
+			write_image_pixels<8, 8>(data, count, m_swizzle8, 7, 6, 0, 0);
+			break;
+		case PSMT4:
+			write_image_pixels<4, 4>(data, count, m_swizzle4, 7, 7, 0, 0);
+			break;
+		case PSMT8H:
+			write_image_pixels<8, 32>(data, count, m_swizzle32, 6, 5, 0, 24);
+			break;
+		case PSMT4HL:
+			write_image_pixels<4, 32>(data, count, m_swizzle32, 6, 5, 0, 24);
+			break;
+		case PSMT4HH:
+			write_image_pixels<4, 32>(data, count, m_swizzle32, 6, 5, 0, 28);
+			break;
+		case PSMCT24:
+		case PSMZ24:
+			// TODO: Pixels straddle dwords, so leftover bytes would need to be carried between calls.
+			logerror("%s: write_image: Unsupported dst format: PSMCT24/PSMZ24\n", machine().describe_context());
+			break;
+		default:
+			logerror("%s: write_image: Unknown format %02x\n", machine().describe_context(), m_dst_buf_fmt);
+			break;
+	}
+}
+
+template <int SrcBits, int DstBits>
+void ps2_gs_device::write_image_pixels(const uint64_t *data, uint32_t count, const uint16_t *table, int page_w_bits, int page_h_bits, uint32_t offset_xor, int dst_shift)
+{
+	constexpr int PIXELS_SHIFT = (SrcBits == 32) ? 1 : (SrcBits == 16) ? 2 : (SrcBits == 8) ? 3 : 4;
+	constexpr int UNIT_SHIFT = (DstBits == 32) ? 0 : (DstBits == 16) ? 1 : (DstBits == 8) ? 2 : 3;
+	constexpr uint32_t PIXEL_MASK = make_bitmask<uint32_t>(SrcBits);
+
+	auto fetch = [data] (uint32_t index) -> uint32_t
+	{
+		return uint32_t(data[index >> PIXELS_SHIFT] >> ((index & make_bitmask<uint32_t>(PIXELS_SHIFT)) * SrcBits)) & PIXEL_MASK;
+	};
+	auto store = [this, dst_shift] (uint32_t addr, uint32_t pixel)
+	{
+		if constexpr (SrcBits == 32)
 		{
-			case PSMCT32:
-			case PSMZ32:
-			{
-				m_ram[dst_offset + index] = (uint32_t)src;
-				break;
-			}
-			case PSMCT24:
-			case PSMZ24:
-				logerror("%s: Unsupported dst format: PSMCT24/PSMZ24\n", machine().describe_context());
-				break;
-			case PSMCT16:
-			case PSMCT16S:
-			case PSMZ16:
-			case PSMZ16S:
-			{
-				const offs_t dst_shift = ((index & 1) << 4);
-				m_ram[dst_offset + (index >> 1)] &= ~(0x0000ffff << dst_shift);
-				m_ram[dst_offset + (index >> 1)] |= (uint32_t)src << dst_shift;
-				break;
-			}
-			case PSMT8:
-			{
-				const offs_t dst_shift = ((index & 3) << 3);
-				m_ram[dst_offset + (index >> 2)] &= ~(0x000000ff << dst_shift);
-				m_ram[dst_offset + (index >> 2)] |= (uint32_t)src << dst_shift;
-				break;
-			}
-			case PSMT8H:
-			{
-				m_ram[dst_offset + index] &= 0x00ffffff;
-				m_ram[dst_offset + index] |= (uint32_t)src << 24;
-				break;
-			}
-			case PSMT4:
-			{
-				const offs_t dst_shift = ((index & 7) << 2);
-				m_ram[dst_offset + (index >> 3)] &= ~(0x0000000f << dst_shift);
-				m_ram[dst_offset + (index >> 3)] |= (uint32_t)src << dst_shift;
-				break;
-			}
-			case PSMT4HL:
-				m_ram[dst_offset + index] &= 0xf0ffffff;
-				m_ram[dst_offset + index] |= (uint32_t)src << 24;
-				break;
-			case PSMT4HH:
-				m_ram[dst_offset + index] &= 0x0fffffff;
-				m_ram[dst_offset + index] |= (uint32_t)src << 28;
-				break;
-			default:
-				logerror("%s: copy_dword_from_host: Unknown format %02x\n", machine().describe_context(), m_dst_buf_fmt);
-				return;
+			m_ram[addr & 0xfffff] = pixel;
+		}
+		else
+		{
+			const int shift = (DstBits == 32) ? dst_shift : ((addr & make_bitmask<uint32_t>(UNIT_SHIFT)) * DstBits);
+			uint32_t &word = m_ram[(addr >> UNIT_SHIFT) & 0xfffff];
+			word = (word & ~(PIXEL_MASK << shift)) | (pixel << shift);
+		}
+	};
+
+	const uint32_t page_w = 1 << page_w_bits;
+	const uint32_t page_h = 1 << page_h_bits;
+	const uint32_t page_pixels = page_w << page_h_bits;
+	const uint32_t page_stride = m_dst_buf_width >> page_w_bits;
+	const uint32_t base = m_dst_buf_base << UNIT_SHIFT;
+	const uint32_t total = count << PIXELS_SHIFT;
+
+	uint32_t index = 0;
+	while (index < total && m_trx_y < m_trx_height)
+	{
+		const uint32_t x = m_dst_ul_x + m_trx_x;
+		const uint32_t y = m_dst_ul_y + m_trx_y;
+		const uint32_t page_base = base + (((y >> page_h_bits) * page_stride + (x >> page_w_bits)) << (page_w_bits + page_h_bits));
+		const uint32_t col = x & (page_w - 1);
+		const uint32_t row = y & (page_h - 1);
+
+		if (m_trx_width == page_w && !m_trx_x && !col && !row && (m_trx_height - m_trx_y) >= page_h && (total - index) >= page_pixels)
+		{
+			// A whole page arrives in order, so the table can be walked linearly
+			for (uint32_t i = 0; i < page_pixels; i++)
+				store(page_base + (table[i] ^ offset_xor), fetch(index + i));
+			index += page_pixels;
+			m_trx_y += page_h;
+			continue;
+		}
+
+		// Otherwise, write the part of the current row that falls within this page
+		const uint32_t run = std::min({ m_trx_width - m_trx_x, page_w - col, total - index });
+		const uint16_t *row_offsets = &table[(row << page_w_bits) | col];
+		for (uint32_t i = 0; i < run; i++)
+			store(page_base + (row_offsets[i] ^ offset_xor), fetch(index + i));
+		index += run;
+		m_trx_x += run;
+		if (m_trx_x == m_trx_width)
+		{
+			m_trx_x = 0;
+			m_trx_y++;
 		}
 	}
+
+	if (index < total)
+		logerror("%s: write_image: Transfer complete, dropping %d leftover pixels\n", machine().describe_context(), total - index);
 }
 
 void ps2_gs_device::vblank_start()
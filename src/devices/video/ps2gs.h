@@ -49,6 +49,7 @@ public:
 
 	void reg_write(const uint8_t reg, const uint64_t value);
 	void write_packed(const uint8_t reg, const uint64_t hi, const uint64_t lo);
+	void write_image(const uint64_t *data, uint32_t count);
 
 	void vblank_start();
 	void vblank_end();
@@ -58,7 +59,10 @@ protected:
 	virtual void device_reset() override;
 	virtual void device_add_mconfig(machine_config &config) override;
 
-	void copy_dword_from_host(uint64_t data);
+	void build_swizzle_tables();
+
+	template <int SrcBits, int DstBits>
+	void write_image_pixels(const uint64_t *data, uint32_t count, const uint16_t *table, int page_w_bits, int page_h_bits, uint32_t offset_xor, int dst_shift);
 
 	enum : uint64_t
 	{
@@ -261,6 +265,16 @@ protected:
 	uint32_t m_trx_height;
 
 	uint64_t m_trx_dir; // 0x53
+	uint32_t m_trx_x; // Current HOST_TO_LOCAL position within TRXREG
+	uint32_t m_trx_y;
+
+	// Page-relative pixel offsets, indexed by (y << page_w_bits) | x,
+	// in units of the format's pixel size
+	uint16_t m_swizzle32[32 * 64];
+	uint16_t m_swizzle16[64 * 64];
+	uint16_t m_swizzle16s[64 * 64];
+	uint16_t m_swizzle8[64 * 128];
+	uint16_t m_swizzle4[128 * 128];
 
 	// Privileged regs
 	uint64_t m_base_regs[15];
@@ -15,6 +15,7 @@
 
 
 #define STOP_ON_ERROR ( 0 )
+#define DEFERRED_RENDER ( !PSXGPU_DEBUG_VIEWER )
 
 #define LOG_WRITE        (1U << 1)
 #define LOG_READ         (1U << 2)
@@ -45,6 +46,10 @@ psxgpu_device::psxgpu_device(const machine_config &mconfig, device_type type, co
 	: device_t(mconfig, type, tag, owner, clock)
 	, device_video_interface(mconfig, *this)
 	, device_palette_interface(mconfig, *this)
+	, m_render_queue(nullptr)
+	, m_commands_written(0)
+	, m_commands_queued(0)
+	, m_render_busy(false)
 	, m_vblank_handler(*this)
 {
 }
@@ -66,6 +71,22 @@ void psxgpu_device::device_start()
 	{
 		psx_gpu_init( 2 );
 	}
+
+	if( DEFERRED_RENDER )
+	{
+		m_commands = std::make_unique<render_command[]>( COMMAND_BUFFER_SIZE );
+		m_render_queue = osd_work_queue_alloc( WORK_QUEUE_FLAG_HIGH_FREQ );
+	}
+}
+
+void psxgpu_device::device_stop()
+{
+	if( m_render_queue != nullptr )
+	{
+		sync_render();
+		osd_work_queue_free( m_render_queue );
+		m_render_queue = nullptr;
+	}
 }
 
 void psxgpu_device::device_reset()
@@ -73,6 +94,11 @@ void psxgpu_device::device_reset()
 	gpu_reset();
 }
 
+void psxgpu_device::device_pre_save()
+{
+	sync_render();
+}
+
 cxd8514q_device::cxd8514q_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock, uint32_t vram_size, psxcpu_device *cpu)
 	: psxgpu_device(mconfig, CXD8514Q, tag, owner, clock, vram_size, cpu)
 {
@@ -638,6 +664,7 @@ void psxgpu_device::psx_gpu_init( int n_gputype )
 
 void psxgpu_device::device_post_load()
 {
+	sync_render();
 	updatevisiblearea();
 }
 
@@ -655,6 +682,8 @@ uint32_t psxgpu_device::update_screen(screen_device &screen, bitmap_rgb32 &bitma
 	int n_overscantop;
 	int n_overscanleft;
 
+	sync_render();
+
 #if PSXGPU_DEBUG_VIEWER
 	if( DebugMeshDisplay( bitmap, cliprect ) )
 	{
@@ -820,24 +849,19 @@ f  e| d  c| b| a  9| 8  7| 6  5| 4| 3  2  1  0
     |iy|ix|ty|     |   tp|  abr|ty|         tx
 */
 
-void psxgpu_device::decode_tpage( uint32_t tpage )
+// the status bits and the warnings are the CPU side's; decode_tpage()
+// sets up the drawing state and runs along with the drawing
+void psxgpu_device::update_tpage_status( uint32_t tpage )
 {
 	if( m_n_gputype == 2 )
 	{
 		n_gpustatus = ( n_gpustatus & 0xffff7800 ) | ( tpage & 0x7ff ) | ( ( tpage & 0x800 ) << 4 );
 
-		m_n_tx = ( tpage & 0x0f ) << 6;
-		m_n_ty = ( ( tpage & 0x10 ) << 4 ) | ( ( tpage & 0x800 ) >> 2 );
-		n_abr = ( tpage & 0x60 ) >> 5;
-		n_tp = ( tpage & 0x180 ) >> 7;
-		n_ix = ( tpage & 0x1000 ) >> 12;
-		n_iy = ( tpage & 0x2000 ) >> 13;
-		n_ti = 0;
 		if( ( tpage & ~0x39ff ) != 0 )
 		{
 			LOG("not handled: draw mode %08x\n", tpage & ~0x39ff);
 		}
-		if( n_tp == 3 )
+		if( ( ( tpage & 0x180 ) >> 7 ) == 3 )
 		{
 			logerror("not handled: tp == 3\n");
 		}
@@ -847,28 +871,46 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 		// TODO: confirm status bits on real type 1 gpu
 		n_gpustatus = ( n_gpustatus & 0xffffe000 ) | ( tpage & 0x1fff );
 
-		m_n_tx = ( tpage & 0x0f ) << 6;
-		m_n_ty = ( ( tpage & 0x60 ) << 3 );
-		n_abr = ( tpage & 0x180 ) >> 7;
-		n_tp = ( tpage & 0x600 ) >> 9;
-		n_ti = ( tpage & 0x2000 ) >> 13;
-		n_ix = 0;
-		n_iy = 0;
+		int32_t const tp = ( tpage & 0x600 ) >> 9;
 		if( ( tpage & ~0x27ef ) != 0 )
 		{
 			LOG("not handled: draw mode %08x\n", tpage & ~0x27ef);
 		}
-		if( n_tp == 3 )
+		if( tp == 3 )
 		{
 			logerror("not handled: tp == 3\n");
 		}
-		else if( n_tp == 2 && n_ti != 0 )
+		else if( tp == 2 && ( tpage & 0x2000 ) != 0 )
 		{
 			logerror("not handled: interleaved 15 bit texture\n");
 		}
 	}
 }
 
+void psxgpu_device::decode_tpage( uint32_t tpage )
+{
+	if( m_n_gputype == 2 )
+	{
+		m_n_tx = ( tpage & 0x0f ) << 6;
+		m_n_ty = ( ( tpage & 0x10 ) << 4 ) | ( ( tpage & 0x800 ) >> 2 );
+		n_abr = ( tpage & 0x60 ) >> 5;
+		n_tp = ( tpage & 0x180 ) >> 7;
+		n_ix = ( tpage & 0x1000 ) >> 12;
+		n_iy = ( tpage & 0x2000 ) >> 13;
+		n_ti = 0;
+	}
+	else
+	{
+		m_n_tx = ( tpage & 0x0f ) << 6;
+		m_n_ty = ( ( tpage & 0x60 ) << 3 );
+		n_abr = ( tpage & 0x180 ) >> 7;
+		n_tp = ( tpage & 0x600 ) >> 9;
+		n_ti = ( tpage & 0x2000 ) >> 13;
+		n_ix = 0;
+		n_iy = 0;
+	}
+}
+
 #define SPRITESETUP \
 	int n_dv; \
 	if( n_iy != 0 ) \
@@ -1345,8 +1387,8 @@ static inline int CullVertex( int a, int b )
 
 #define CULLPOINT( PacketType, p1, p2 ) \
 ( \
-	CullVertex( COORD_Y( m_packet.PacketType.vertex[ p1 ].n_coord ), COORD_Y( m_packet.PacketType.vertex[ p2 ].n_coord ) ) || \
-	CullVertex( COORD_X( m_packet.PacketType.vertex[ p1 ].n_coord ), COORD_X( m_packet.PacketType.vertex[ p2 ].n_coord ) ) \
+	CullVertex( COORD_Y( m_draw_packet.PacketType.vertex[ p1 ].n_coord ), COORD_Y( m_draw_packet.PacketType.vertex[ p2 ].n_coord ) ) || \
+	CullVertex( COORD_X( m_draw_packet.PacketType.vertex[ p1 ].n_coord ), COORD_X( m_draw_packet.PacketType.vertex[ p2 ].n_coord ) ) \
 )
 
 #define CULLTRIANGLE( PacketType, start ) \
@@ -1357,7 +1399,7 @@ static inline int CullVertex( int a, int b )
 #define FINDTOPLEFT( PacketType ) \
 	for( int n_point = 0; n_point < n_points; n_point++ ) \
 	{ \
-		GET_COORD( m_packet.PacketType.vertex[ n_point ].n_coord ); \
+		GET_COORD( m_draw_packet.PacketType.vertex[ n_point ].n_coord ); \
 	} \
 	\
 	const int *p_n_rightpointlist; \
@@ -1400,9 +1442,9 @@ static inline int CullVertex( int a, int b )
 	\
 	for( int n_point = n_leftpoint + 1; n_point < n_points; n_point++ ) \
 	{ \
-		if( COORD_Y( m_packet.PacketType.vertex[ n_point ].n_coord ) < COORD_Y( m_packet.PacketType.vertex[ n_leftpoint ].n_coord ) || \
-			( COORD_Y( m_packet.PacketType.vertex[ n_point ].n_coord ) == COORD_Y( m_packet.PacketType.vertex[ n_leftpoint ].n_coord ) && \
-			COORD_X( m_packet.PacketType.vertex[ n_point ].n_coord ) < COORD_X( m_packet.PacketType.vertex[ n_leftpoint ].n_coord ) ) ) \
+		if( COORD_Y( m_draw_packet.PacketType.vertex[ n_point ].n_coord ) < COORD_Y( m_draw_packet.PacketType.vertex[ n_leftpoint ].n_coord ) || \
+			( COORD_Y( m_draw_packet.PacketType.vertex[ n_point ].n_coord ) == COORD_Y( m_draw_packet.PacketType.vertex[ n_leftpoint ].n_coord ) && \
+			COORD_X( m_draw_packet.PacketType.vertex[ n_point ].n_coord ) < COORD_X( m_draw_packet.PacketType.vertex[ n_leftpoint ].n_coord ) ) ) \
 		{ \
 			n_leftpoint = n_point; \
 		} \
@@ -1418,34 +1460,34 @@ void psxgpu_device::FlatPolygon( int n_points )
 	}
 	for( int n_point = 0; n_point < n_points; n_point++ )
 	{
-		DebugMesh( S11_COORD_X( m_packet.FlatPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
+		DebugMesh( S11_COORD_X( m_draw_packet.FlatPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.FlatPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
 	}
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatPolygon.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.FlatPolygon.n_bgr );
 
 	PAIR n_cx1; n_cx1.d = 0;
 	PAIR n_cx2; n_cx2.d = 0;
 
 	SOLIDSETUP
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatPolygon.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatPolygon.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatPolygon.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( m_draw_packet.FlatPolygon.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( m_draw_packet.FlatPolygon.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( m_draw_packet.FlatPolygon.n_bgr ); n_b.w.l = 0;
 
 	FINDTOPLEFT( FlatPolygon )
 
 	int32_t n_dx1 = 0;
 	int32_t n_dx2 = 0;
 
-	int16_t n_y = COORD_Y( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord );
+	int16_t n_y = COORD_Y( m_draw_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord );
 
 	for( ;; )
 	{
-		if( n_y == COORD_Y( m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) )
+		if( n_y == COORD_Y( m_draw_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.FlatPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( m_draw_packet.FlatPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
 			{
 				n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 				if( n_leftpoint == n_rightpoint )
@@ -1454,21 +1496,21 @@ void psxgpu_device::FlatPolygon( int n_points )
 				}
 			}
 
-			n_cx1.sw.h = COORD_X( m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
+			n_cx1.sw.h = COORD_X( m_draw_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
 			n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( m_draw_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx1 = (int32_t)( ( COORD_X( m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
+			n_dx1 = (int32_t)( ( COORD_X( m_draw_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
 		}
 
-		if( n_y == COORD_Y( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) )
+		if( n_y == COORD_Y( m_draw_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.FlatPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( m_draw_packet.FlatPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
 			{
 				n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 				if( n_rightpoint == n_leftpoint )
@@ -1477,16 +1519,16 @@ void psxgpu_device::FlatPolygon( int n_points )
 				}
 			}
 
-			n_cx2.sw.h = COORD_X( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
+			n_cx2.sw.h = COORD_X( m_draw_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
 			n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( m_draw_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx2 = (int32_t)( ( COORD_X( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
+			n_dx2 = (int32_t)( ( COORD_X( m_draw_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
 		}
 
 		int drawy = n_y + n_drawoffset_y;
@@ -1533,15 +1575,15 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 	}
 	for( int n_point = 0; n_point < n_points; n_point++ )
 	{
-		DebugMesh( S11_COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
+		DebugMesh( S11_COORD_X( m_draw_packet.FlatTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.FlatTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
 	}
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatTexturedPolygon.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.FlatTexturedPolygon.n_bgr );
 
-	uint32_t n_clutx = ( m_packet.FlatTexturedPolygon.vertex[ 0 ].n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.FlatTexturedPolygon.vertex[ 0 ].n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( m_draw_packet.FlatTexturedPolygon.vertex[ 0 ].n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( m_draw_packet.FlatTexturedPolygon.vertex[ 0 ].n_texture.w.h >> 6 ) & 0x3ff;
 
 	PAIR n_cx1; n_cx1.d = 0;
 	PAIR n_cu1; n_cu1.d = 0;
@@ -1550,12 +1592,12 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 	PAIR n_cu2; n_cu2.d = 0;
 	PAIR n_cv2; n_cv2.d = 0;
 
-	decode_tpage( m_packet.FlatTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+	decode_tpage( m_draw_packet.FlatTexturedPolygon.vertex[ 1 ].n_texture.w.h );
 	TEXTURESETUP
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.FlatTexturedPolygon.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.FlatTexturedPolygon.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.FlatTexturedPolygon.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_draw_packet.FlatTexturedPolygon.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_draw_packet.FlatTexturedPolygon.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_draw_packet.FlatTexturedPolygon.n_bgr ); n_b.w.l = 0;
 
 	FINDTOPLEFT( FlatTexturedPolygon )
 
@@ -1566,13 +1608,13 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 	int32_t n_dv1 = 0;
 	int32_t n_dv2 = 0;
 
-	int16_t n_y = COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord );
+	int16_t n_y = COORD_Y( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord );
 
 	for( ;; )
 	{
-		if( n_y == COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) )
+		if( n_y == COORD_Y( m_draw_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.FlatTexturedPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( m_draw_packet.FlatTexturedPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
 			{
 				n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 				if( n_leftpoint == n_rightpoint )
@@ -1581,25 +1623,25 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 				}
 			}
 
-			n_cx1.sw.h = COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
-			n_cu1.w.h = TEXTURE_U( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cu1.w.l = 0;
-			n_cv1.w.h = TEXTURE_V( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cv1.w.l = 0;
+			n_cx1.sw.h = COORD_X( m_draw_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
+			n_cu1.w.h = TEXTURE_U( m_draw_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cu1.w.l = 0;
+			n_cv1.w.h = TEXTURE_V( m_draw_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cv1.w.l = 0;
 			n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( m_draw_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx1 = (int32_t)( ( COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
-			n_du1 = (int32_t)( ( TEXTURE_U( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cu1.d ) / n_distance;
-			n_dv1 = (int32_t)( ( TEXTURE_V( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cv1.d ) / n_distance;
+			n_dx1 = (int32_t)( ( COORD_X( m_draw_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
+			n_du1 = (int32_t)( ( TEXTURE_U( m_draw_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cu1.d ) / n_distance;
+			n_dv1 = (int32_t)( ( TEXTURE_V( m_draw_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cv1.d ) / n_distance;
 		}
 
-		if( n_y == COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) )
+		if( n_y == COORD_Y( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.FlatTexturedPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( m_draw_packet.FlatTexturedPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
 			{
 				n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 				if( n_rightpoint == n_leftpoint )
@@ -1608,20 +1650,20 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 				}
 			}
 
-			n_cx2.sw.h = COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
-			n_cu2.w.h = TEXTURE_U( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cu2.w.l = 0;
-			n_cv2.w.h = TEXTURE_V( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cv2.w.l = 0;
+			n_cx2.sw.h = COORD_X( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
+			n_cu2.w.h = TEXTURE_U( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cu2.w.l = 0;
+			n_cv2.w.h = TEXTURE_V( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cv2.w.l = 0;
 			n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx2 = (int32_t)( ( COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
-			n_du2 = (int32_t)( ( TEXTURE_U( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cu2.d ) / n_distance;
-			n_dv2 = (int32_t)( ( TEXTURE_V( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cv2.d ) / n_distance;
+			n_dx2 = (int32_t)( ( COORD_X( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
+			n_du2 = (int32_t)( ( TEXTURE_U( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cu2.d ) / n_distance;
+			n_dv2 = (int32_t)( ( TEXTURE_V( m_draw_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cv2.d ) / n_distance;
 		}
 
 		int drawy = n_y + n_drawoffset_y;
@@ -1688,12 +1730,12 @@ void psxgpu_device::GouraudPolygon( int n_points )
 	}
 	for( int n_point = 0; n_point < n_points; n_point++ )
 	{
-		DebugMesh( S11_COORD_X( m_packet.GouraudPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.GouraudPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
+		DebugMesh( S11_COORD_X( m_draw_packet.GouraudPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.GouraudPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
 	}
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.GouraudPolygon.vertex[ 0 ].n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.GouraudPolygon.vertex[ 0 ].n_bgr );
 
 	PAIR n_cx1; n_cx1.d = 0;
 	PAIR n_cr1; n_cr1.d = 0;
@@ -1717,13 +1759,13 @@ void psxgpu_device::GouraudPolygon( int n_points )
 	int32_t n_db1 = 0;
 	int32_t n_db2 = 0;
 
-	int16_t n_y = COORD_Y( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord );
+	int16_t n_y = COORD_Y( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord );
 
 	for( ;; )
 	{
-		if( n_y == COORD_Y( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) )
+		if( n_y == COORD_Y( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.GouraudPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( m_draw_packet.GouraudPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
 			{
 				n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 				if( n_leftpoint == n_rightpoint )
@@ -1732,27 +1774,27 @@ void psxgpu_device::GouraudPolygon( int n_points )
 				}
 			}
 
-			n_cx1.sw.h = COORD_X( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
-			n_cr1.w.h = BGR_R( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cr1.w.l = 0;
-			n_cg1.w.h = BGR_G( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cg1.w.l = 0;
-			n_cb1.w.h = BGR_B( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cb1.w.l = 0;
+			n_cx1.sw.h = COORD_X( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
+			n_cr1.w.h = BGR_R( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cr1.w.l = 0;
+			n_cg1.w.h = BGR_G( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cg1.w.l = 0;
+			n_cb1.w.h = BGR_B( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cb1.w.l = 0;
 			n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx1 = (int32_t)( ( COORD_X( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
-			n_dr1 = (int32_t)( ( BGR_R( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cr1.d ) / n_distance;
-			n_dg1 = (int32_t)( ( BGR_G( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cg1.d ) / n_distance;
-			n_db1 = (int32_t)( ( BGR_B( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cb1.d ) / n_distance;
+			n_dx1 = (int32_t)( ( COORD_X( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
+			n_dr1 = (int32_t)( ( BGR_R( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cr1.d ) / n_distance;
+			n_dg1 = (int32_t)( ( BGR_G( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cg1.d ) / n_distance;
+			n_db1 = (int32_t)( ( BGR_B( m_draw_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cb1.d ) / n_distance;
 		}
 
-		if( n_y == COORD_Y( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) )
+		if( n_y == COORD_Y( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.GouraudPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( m_draw_packet.GouraudPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
 			{
 				n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 				if( n_rightpoint == n_leftpoint )
@@ -1761,22 +1803,22 @@ void psxgpu_device::GouraudPolygon( int n_points )
 				}
 			}
 
-			n_cx2.sw.h = COORD_X( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
-			n_cr2.w.h = BGR_R( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cr2.w.l = 0;
-			n_cg2.w.h = BGR_G( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cg2.w.l = 0;
-			n_cb2.w.h = BGR_B( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cb2.w.l = 0;
+			n_cx2.sw.h = COORD_X( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
+			n_cr2.w.h = BGR_R( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cr2.w.l = 0;
+			n_cg2.w.h = BGR_G( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cg2.w.l = 0;
+			n_cb2.w.h = BGR_B( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cb2.w.l = 0;
 			n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx2 = (int32_t)( ( COORD_X( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
-			n_dr2 = (int32_t)( ( BGR_R( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cr2.d ) / n_distance;
-			n_dg2 = (int32_t)( ( BGR_G( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cg2.d ) / n_distance;
-			n_db2 = (int32_t)( ( BGR_B( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cb2.d ) / n_distance;
+			n_dx2 = (int32_t)( ( COORD_X( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
+			n_dr2 = (int32_t)( ( BGR_R( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cr2.d ) / n_distance;
+			n_dg2 = (int32_t)( ( BGR_G( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cg2.d ) / n_distance;
+			n_db2 = (int32_t)( ( BGR_B( m_draw_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cb2.d ) / n_distance;
 		}
 
 		int drawy = n_y + n_drawoffset_y;
@@ -1852,15 +1894,15 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 	}
 	for( int n_point = 0; n_point < n_points; n_point++ )
 	{
-		DebugMesh( S11_COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
+		DebugMesh( S11_COORD_X( m_draw_packet.GouraudTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.GouraudTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
 	}
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.GouraudTexturedPolygon.vertex[ 0 ].n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.GouraudTexturedPolygon.vertex[ 0 ].n_bgr );
 
-	uint32_t n_clutx = ( m_packet.GouraudTexturedPolygon.vertex[ 0 ].n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.GouraudTexturedPolygon.vertex[ 0 ].n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( m_draw_packet.GouraudTexturedPolygon.vertex[ 0 ].n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( m_draw_packet.GouraudTexturedPolygon.vertex[ 0 ].n_texture.w.h >> 6 ) & 0x3ff;
 
 	PAIR n_cx1; n_cx1.d = 0;
 	PAIR n_cr1; n_cr1.d = 0;
@@ -1875,7 +1917,7 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 	PAIR n_cu2; n_cu2.d = 0;
 	PAIR n_cv2; n_cv2.d = 0;
 
-	decode_tpage( m_packet.GouraudTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+	decode_tpage( m_draw_packet.GouraudTexturedPolygon.vertex[ 1 ].n_texture.w.h );
 	TEXTURESETUP
 
 	FINDTOPLEFT( GouraudTexturedPolygon )
@@ -1893,13 +1935,13 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 	int32_t n_dv1 = 0;
 	int32_t n_dv2 = 0;
 
-	int16_t n_y = COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord );
+	int16_t n_y = COORD_Y( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord );
 
 	for( ;; )
 	{
-		if( n_y == COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) )
+		if( n_y == COORD_Y( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( m_draw_packet.GouraudTexturedPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
 			{
 				n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 				if( n_leftpoint == n_rightpoint )
@@ -1908,31 +1950,31 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 				}
 			}
 
-			n_cx1.sw.h = COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
-			n_cr1.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cr1.w.l = 0;
-			n_cg1.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cg1.w.l = 0;
-			n_cb1.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cb1.w.l = 0;
-			n_cu1.w.h = TEXTURE_U( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cu1.w.l = 0;
-			n_cv1.w.h = TEXTURE_V( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cv1.w.l = 0;
+			n_cx1.sw.h = COORD_X( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
+			n_cr1.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cr1.w.l = 0;
+			n_cg1.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cg1.w.l = 0;
+			n_cb1.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cb1.w.l = 0;
+			n_cu1.w.h = TEXTURE_U( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cu1.w.l = 0;
+			n_cv1.w.h = TEXTURE_V( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cv1.w.l = 0;
 			n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx1 = (int32_t)( ( COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
-			n_dr1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_R( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cr1.d ) / n_distance;
-			n_dg1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_G( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cg1.d ) / n_distance;
-			n_db1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_B( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cb1.d ) / n_distance;
-			n_du1 = (int32_t)( ( TEXTURE_U( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cu1.d ) / n_distance;
-			n_dv1 = (int32_t)( ( TEXTURE_V( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cv1.d ) / n_distance;
+			n_dx1 = (int32_t)( ( COORD_X( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
+			n_dr1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_R( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cr1.d ) / n_distance;
+			n_dg1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_G( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cg1.d ) / n_distance;
+			n_db1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_B( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cb1.d ) / n_distance;
+			n_du1 = (int32_t)( ( TEXTURE_U( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cu1.d ) / n_distance;
+			n_dv1 = (int32_t)( ( TEXTURE_V( m_draw_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cv1.d ) / n_distance;
 		}
 
-		if( n_y == COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) )
+		if( n_y == COORD_Y( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( m_draw_packet.GouraudTexturedPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
 			{
 				n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 				if( n_rightpoint == n_leftpoint )
@@ -1941,26 +1983,26 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 				}
 			}
 
-			n_cx2.sw.h = COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
-			n_cr2.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cr2.w.l = 0;
-			n_cg2.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cg2.w.l = 0;
-			n_cb2.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cb2.w.l = 0;
-			n_cu2.w.h = TEXTURE_U( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cu2.w.l = 0;
-			n_cv2.w.h = TEXTURE_V( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cv2.w.l = 0;
+			n_cx2.sw.h = COORD_X( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
+			n_cr2.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cr2.w.l = 0;
+			n_cg2.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cg2.w.l = 0;
+			n_cb2.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cb2.w.l = 0;
+			n_cu2.w.h = TEXTURE_U( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cu2.w.l = 0;
+			n_cv2.w.h = TEXTURE_V( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cv2.w.l = 0;
 			n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx2 = (int32_t)( ( COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
-			n_dr2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_R( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cr2.d ) / n_distance;
-			n_dg2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_G( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cg2.d ) / n_distance;
-			n_db2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_B( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cb2.d ) / n_distance;
-			n_du2 = (int32_t)( ( TEXTURE_U( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cu2.d ) / n_distance;
-			n_dv2 = (int32_t)( ( TEXTURE_V( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cv2.d ) / n_distance;
+			n_dx2 = (int32_t)( ( COORD_X( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
+			n_dr2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_R( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cr2.d ) / n_distance;
+			n_dg2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_G( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cg2.d ) / n_distance;
+			n_db2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_B( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cb2.d ) / n_distance;
+			n_du2 = (int32_t)( ( TEXTURE_U( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cu2.d ) / n_distance;
+			n_dv2 = (int32_t)( ( TEXTURE_V( m_draw_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cv2.d ) / n_distance;
 		}
 
 		int drawy = n_y + n_drawoffset_y;
@@ -2052,20 +2094,20 @@ void psxgpu_device::MonochromeLine()
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.MonochromeLine.vertex[ 0 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.MonochromeLine.vertex[ 0 ].n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.MonochromeLine.vertex[ 1 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.MonochromeLine.vertex[ 1 ].n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.MonochromeLine.vertex[ 0 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.MonochromeLine.vertex[ 0 ].n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.MonochromeLine.vertex[ 1 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.MonochromeLine.vertex[ 1 ].n_coord ) + n_drawoffset_y );
 	DebugMeshEnd();
 #endif
 
-	int32_t n_xstart = S11_COORD_X( m_packet.MonochromeLine.vertex[ 0 ].n_coord );
-	int32_t n_xend = S11_COORD_X( m_packet.MonochromeLine.vertex[ 1 ].n_coord );
-	int32_t n_ystart = S11_COORD_Y( m_packet.MonochromeLine.vertex[ 0 ].n_coord );
-	int32_t n_yend = S11_COORD_Y( m_packet.MonochromeLine.vertex[ 1 ].n_coord );
+	int32_t n_xstart = S11_COORD_X( m_draw_packet.MonochromeLine.vertex[ 0 ].n_coord );
+	int32_t n_xend = S11_COORD_X( m_draw_packet.MonochromeLine.vertex[ 1 ].n_coord );
+	int32_t n_ystart = S11_COORD_Y( m_draw_packet.MonochromeLine.vertex[ 0 ].n_coord );
+	int32_t n_yend = S11_COORD_Y( m_draw_packet.MonochromeLine.vertex[ 1 ].n_coord );
 
-	uint8_t n_cmd = BGR_C( m_packet.MonochromeLine.n_bgr );
-	uint8_t n_r = BGR_R( m_packet.MonochromeLine.n_bgr );
-	uint8_t n_g = BGR_G( m_packet.MonochromeLine.n_bgr );
-	uint8_t n_b = BGR_B( m_packet.MonochromeLine.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.MonochromeLine.n_bgr );
+	uint8_t n_r = BGR_R( m_draw_packet.MonochromeLine.n_bgr );
+	uint8_t n_g = BGR_G( m_draw_packet.MonochromeLine.n_bgr );
+	uint8_t n_b = BGR_B( m_draw_packet.MonochromeLine.n_bgr );
 
 	TRANSPARENCYSETUP
 
@@ -2152,26 +2194,26 @@ void psxgpu_device::GouraudLine()
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.GouraudLine.vertex[ 0 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.GouraudLine.vertex[ 0 ].n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.GouraudLine.vertex[ 1 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.GouraudLine.vertex[ 1 ].n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.GouraudLine.vertex[ 0 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.GouraudLine.vertex[ 0 ].n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.GouraudLine.vertex[ 1 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.GouraudLine.vertex[ 1 ].n_coord ) + n_drawoffset_y );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.GouraudLine.vertex[ 0 ].n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.GouraudLine.vertex[ 0 ].n_bgr );
 
 	TRANSPARENCYSETUP
 
-	int32_t n_xstart = S11_COORD_X( m_packet.GouraudLine.vertex[ 0 ].n_coord );
-	int32_t n_ystart = S11_COORD_Y( m_packet.GouraudLine.vertex[ 0 ].n_coord );
-	PAIR n_cr1; n_cr1.w.h = BGR_R( m_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cr1.w.l = 0;
-	PAIR n_cg1; n_cg1.w.h = BGR_G( m_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cg1.w.l = 0;
-	PAIR n_cb1; n_cb1.w.h = BGR_B( m_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cb1.w.l = 0;
+	int32_t n_xstart = S11_COORD_X( m_draw_packet.GouraudLine.vertex[ 0 ].n_coord );
+	int32_t n_ystart = S11_COORD_Y( m_draw_packet.GouraudLine.vertex[ 0 ].n_coord );
+	PAIR n_cr1; n_cr1.w.h = BGR_R( m_draw_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cr1.w.l = 0;
+	PAIR n_cg1; n_cg1.w.h = BGR_G( m_draw_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cg1.w.l = 0;
+	PAIR n_cb1; n_cb1.w.h = BGR_B( m_draw_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cb1.w.l = 0;
 
-	int32_t n_xend = S11_COORD_X( m_packet.GouraudLine.vertex[ 1 ].n_coord );
-	int32_t n_yend = S11_COORD_Y( m_packet.GouraudLine.vertex[ 1 ].n_coord );
-	PAIR n_cr2; n_cr2.w.h = BGR_R( m_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cr2.w.l = 0;
-	PAIR n_cg2; n_cg2.w.h = BGR_G( m_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cg2.w.l = 0;
-	PAIR n_cb2; n_cb2.w.h = BGR_B( m_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cb2.w.l = 0;
+	int32_t n_xend = S11_COORD_X( m_draw_packet.GouraudLine.vertex[ 1 ].n_coord );
+	int32_t n_yend = S11_COORD_Y( m_draw_packet.GouraudLine.vertex[ 1 ].n_coord );
+	PAIR n_cr2; n_cr2.w.h = BGR_R( m_draw_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cr2.w.l = 0;
+	PAIR n_cg2; n_cg2.w.h = BGR_G( m_draw_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cg2.w.l = 0;
+	PAIR n_cb2; n_cb2.w.h = BGR_B( m_draw_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cb2.w.l = 0;
 
 
 	PAIR n_x; n_x.sw.h = n_xstart; n_x.sw.l = 0;
@@ -2266,24 +2308,24 @@ void psxgpu_device::FrameBufferRectangleDraw()
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + SIZE_W( m_packet.FlatRectangle.n_size ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + SIZE_H( m_packet.FlatRectangle.n_size ) );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + SIZE_W( m_packet.FlatRectangle.n_size ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + SIZE_H( m_packet.FlatRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatRectangle.n_coord ), S11_COORD_Y( m_draw_packet.FlatRectangle.n_coord ) );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatRectangle.n_coord ) + SIZE_W( m_draw_packet.FlatRectangle.n_size ), S11_COORD_Y( m_draw_packet.FlatRectangle.n_coord ) );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatRectangle.n_coord ), S11_COORD_Y( m_draw_packet.FlatRectangle.n_coord ) + SIZE_H( m_draw_packet.FlatRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatRectangle.n_coord ) + SIZE_W( m_draw_packet.FlatRectangle.n_size ), S11_COORD_Y( m_draw_packet.FlatRectangle.n_coord ) + SIZE_H( m_draw_packet.FlatRectangle.n_size ) );
 	DebugMeshEnd();
 #endif
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatRectangle.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( m_draw_packet.FlatRectangle.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( m_draw_packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( m_draw_packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_y = COORD_Y( m_packet.FlatRectangle.n_coord );
-	int32_t n_h = SIZE_H( m_packet.FlatRectangle.n_size );
+	int16_t n_y = COORD_Y( m_draw_packet.FlatRectangle.n_coord );
+	int32_t n_h = SIZE_H( m_draw_packet.FlatRectangle.n_size );
 
 	while( n_h > 0 )
 	{
-		int16_t n_x = COORD_X( m_packet.FlatRectangle.n_coord );
-		int32_t n_distance = SIZE_W( m_packet.FlatRectangle.n_size );
+		int16_t n_x = COORD_X( m_draw_packet.FlatRectangle.n_coord );
+		int32_t n_distance = SIZE_W( m_draw_packet.FlatRectangle.n_size );
 
 		while( n_distance > 0 )
 		{
@@ -2307,28 +2349,28 @@ void psxgpu_device::FlatRectangle()
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + n_drawoffset_x + SIZE_W( m_packet.FlatRectangle.n_size ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + n_drawoffset_y + SIZE_H( m_packet.FlatRectangle.n_size ) );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + n_drawoffset_x + SIZE_W( m_packet.FlatRectangle.n_size ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + n_drawoffset_y + SIZE_H( m_packet.FlatRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.FlatRectangle.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatRectangle.n_coord ) + n_drawoffset_x + SIZE_W( m_draw_packet.FlatRectangle.n_size ), S11_COORD_Y( m_draw_packet.FlatRectangle.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.FlatRectangle.n_coord ) + n_drawoffset_y + SIZE_H( m_draw_packet.FlatRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatRectangle.n_coord ) + n_drawoffset_x + SIZE_W( m_draw_packet.FlatRectangle.n_size ), S11_COORD_Y( m_draw_packet.FlatRectangle.n_coord ) + n_drawoffset_y + SIZE_H( m_draw_packet.FlatRectangle.n_size ) );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatRectangle.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.FlatRectangle.n_bgr );
 
 	SOLIDSETUP
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatRectangle.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( m_draw_packet.FlatRectangle.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( m_draw_packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( m_draw_packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.FlatRectangle.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.FlatRectangle.n_coord );
-	int32_t n_h = SIZE_H( m_packet.FlatRectangle.n_size );
+	int16_t n_x = S11_COORD_X( m_draw_packet.FlatRectangle.n_coord );
+	int16_t n_y = S11_COORD_Y( m_draw_packet.FlatRectangle.n_coord );
+	int32_t n_h = SIZE_H( m_draw_packet.FlatRectangle.n_size );
 
 	while( n_h > 0 )
 	{
-		int32_t n_distance = SIZE_W( m_packet.FlatRectangle.n_size );
+		int32_t n_distance = SIZE_W( m_draw_packet.FlatRectangle.n_size );
 		int drawy = n_y + n_drawoffset_y;
 
 		if( n_distance > 0 && drawy >= (int32_t)n_drawarea_y1 && drawy <= (int32_t)n_drawarea_y2 )
@@ -2356,23 +2398,23 @@ void psxgpu_device::FlatRectangle8x8()
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x + 8, S11_COORD_Y( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y + 8 );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x + 8, S11_COORD_Y( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y + 8 );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x + 8, S11_COORD_Y( m_draw_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y + 8 );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x + 8, S11_COORD_Y( m_draw_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y + 8 );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatRectangle8x8.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.FlatRectangle8x8.n_bgr );
 
 	SOLIDSETUP
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatRectangle8x8.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatRectangle8x8.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatRectangle8x8.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( m_draw_packet.FlatRectangle8x8.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( m_draw_packet.FlatRectangle8x8.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( m_draw_packet.FlatRectangle8x8.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.FlatRectangle8x8.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.FlatRectangle8x8.n_coord );
+	int16_t n_x = S11_COORD_X( m_draw_packet.FlatRectangle8x8.n_coord );
+	int16_t n_y = S11_COORD_Y( m_draw_packet.FlatRectangle8x8.n_coord );
 	int32_t n_h = 8;
 
 	while( n_h > 0 )
@@ -2405,23 +2447,23 @@ void psxgpu_device::FlatRectangle16x16()
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x + 16, S11_COORD_Y( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y + 16 );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x + 16, S11_COORD_Y( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y + 16 );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x + 16, S11_COORD_Y( m_draw_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y + 16 );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x + 16, S11_COORD_Y( m_draw_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y + 16 );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatRectangle16x16.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.FlatRectangle16x16.n_bgr );
 
 	SOLIDSETUP
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatRectangle16x16.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatRectangle16x16.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatRectangle16x16.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( m_draw_packet.FlatRectangle16x16.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( m_draw_packet.FlatRectangle16x16.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( m_draw_packet.FlatRectangle16x16.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.FlatRectangle16x16.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.FlatRectangle16x16.n_coord );
+	int16_t n_x = S11_COORD_X( m_draw_packet.FlatRectangle16x16.n_coord );
+	int16_t n_y = S11_COORD_Y( m_draw_packet.FlatRectangle16x16.n_coord );
 	int32_t n_h = 16;
 
 	while( n_h > 0 )
@@ -2454,34 +2496,34 @@ void psxgpu_device::FlatTexturedRectangle()
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x + SIZE_W( m_packet.FlatTexturedRectangle.n_size ), S11_COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y + SIZE_H( m_packet.FlatTexturedRectangle.n_size ) );
-	DebugMesh( S11_COORD_X( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x + SIZE_W( m_packet.FlatTexturedRectangle.n_size ), S11_COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y + SIZE_H( m_packet.FlatTexturedRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x + SIZE_W( m_draw_packet.FlatTexturedRectangle.n_size ), S11_COORD_Y( m_draw_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y + SIZE_H( m_draw_packet.FlatTexturedRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( m_draw_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x + SIZE_W( m_draw_packet.FlatTexturedRectangle.n_size ), S11_COORD_Y( m_draw_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y + SIZE_H( m_draw_packet.FlatTexturedRectangle.n_size ) );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatTexturedRectangle.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.FlatTexturedRectangle.n_bgr );
 
-	uint32_t n_clutx = ( m_packet.FlatTexturedRectangle.n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.FlatTexturedRectangle.n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( m_draw_packet.FlatTexturedRectangle.n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( m_draw_packet.FlatTexturedRectangle.n_texture.w.h >> 6 ) & 0x3ff;
 
 	TEXTURESETUP
 	SPRITESETUP
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.FlatTexturedRectangle.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.FlatTexturedRectangle.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.FlatTexturedRectangle.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_draw_packet.FlatTexturedRectangle.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_draw_packet.FlatTexturedRectangle.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_draw_packet.FlatTexturedRectangle.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.FlatTexturedRectangle.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.FlatTexturedRectangle.n_coord );
-	uint8_t n_v = TEXTURE_V( m_packet.FlatTexturedRectangle.n_texture );
-	uint32_t n_h = SIZE_H( m_packet.FlatTexturedRectangle.n_size );
+	int16_t n_x = S11_COORD_X( m_draw_packet.FlatTexturedRectangle.n_coord );
+	int16_t n_y = S11_COORD_Y( m_draw_packet.FlatTexturedRectangle.n_coord );
+	uint8_t n_v = TEXTURE_V( m_draw_packet.FlatTexturedRectangle.n_texture );
+	uint32_t n_h = SIZE_H( m_draw_packet.FlatTexturedRectangle.n_size );
 
 	while( n_h > 0 )
 	{
-		uint8_t n_u = TEXTURE_U( m_packet.FlatTexturedRectangle.n_texture );
-		int16_t n_distance = SIZE_W( m_packet.FlatTexturedRectangle.n_size );
+		uint8_t n_u = TEXTURE_U( m_draw_packet.FlatTexturedRectangle.n_texture );
+		int16_t n_distance = SIZE_W( m_draw_packet.FlatTexturedRectangle.n_size );
 		int drawy = n_y + n_drawoffset_y;
 
 		if( n_distance > 0 && drawy >= (int32_t)n_drawarea_y1 && drawy <= (int32_t)n_drawarea_y2 )
@@ -2511,33 +2553,33 @@ void psxgpu_device::Sprite8x8()
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.Sprite8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.Sprite8x8.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.Sprite8x8.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( m_packet.Sprite8x8.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.Sprite8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.Sprite8x8.n_coord ) + n_drawoffset_y + 7 );
-	DebugMesh( S11_COORD_X( m_packet.Sprite8x8.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( m_packet.Sprite8x8.n_coord ) + n_drawoffset_y + 7 );
+	DebugMesh( S11_COORD_X( m_draw_packet.Sprite8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.Sprite8x8.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.Sprite8x8.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( m_draw_packet.Sprite8x8.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.Sprite8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.Sprite8x8.n_coord ) + n_drawoffset_y + 7 );
+	DebugMesh( S11_COORD_X( m_draw_packet.Sprite8x8.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( m_draw_packet.Sprite8x8.n_coord ) + n_drawoffset_y + 7 );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.Sprite8x8.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.Sprite8x8.n_bgr );
 
-	uint32_t n_clutx = ( m_packet.Sprite8x8.n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.Sprite8x8.n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( m_draw_packet.Sprite8x8.n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( m_draw_packet.Sprite8x8.n_texture.w.h >> 6 ) & 0x3ff;
 
 	TEXTURESETUP
 	SPRITESETUP
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.Sprite8x8.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.Sprite8x8.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.Sprite8x8.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_draw_packet.Sprite8x8.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_draw_packet.Sprite8x8.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_draw_packet.Sprite8x8.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.Sprite8x8.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.Sprite8x8.n_coord );
-	uint8_t n_v = TEXTURE_V( m_packet.Sprite8x8.n_texture );
+	int16_t n_x = S11_COORD_X( m_draw_packet.Sprite8x8.n_coord );
+	int16_t n_y = S11_COORD_Y( m_draw_packet.Sprite8x8.n_coord );
+	uint8_t n_v = TEXTURE_V( m_draw_packet.Sprite8x8.n_texture );
 	uint32_t n_h = 8;
 
 	while( n_h > 0 )
 	{
-		uint8_t n_u = TEXTURE_U( m_packet.Sprite8x8.n_texture );
+		uint8_t n_u = TEXTURE_U( m_draw_packet.Sprite8x8.n_texture );
 		int16_t n_distance = 8;
 
 		int drawy = n_y + n_drawoffset_y;
@@ -2569,33 +2611,33 @@ void psxgpu_device::Sprite16x16()
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.Sprite16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.Sprite16x16.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.Sprite16x16.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( m_packet.Sprite16x16.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.Sprite16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.Sprite16x16.n_coord ) + n_drawoffset_y + 7 );
-	DebugMesh( S11_COORD_X( m_packet.Sprite16x16.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( m_packet.Sprite16x16.n_coord ) + n_drawoffset_y + 7 );
+	DebugMesh( S11_COORD_X( m_draw_packet.Sprite16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.Sprite16x16.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.Sprite16x16.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( m_draw_packet.Sprite16x16.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.Sprite16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.Sprite16x16.n_coord ) + n_drawoffset_y + 7 );
+	DebugMesh( S11_COORD_X( m_draw_packet.Sprite16x16.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( m_draw_packet.Sprite16x16.n_coord ) + n_drawoffset_y + 7 );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.Sprite16x16.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.Sprite16x16.n_bgr );
 
-	uint32_t n_clutx = ( m_packet.Sprite16x16.n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.Sprite16x16.n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( m_draw_packet.Sprite16x16.n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( m_draw_packet.Sprite16x16.n_texture.w.h >> 6 ) & 0x3ff;
 
 	TEXTURESETUP
 	SPRITESETUP
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.Sprite16x16.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.Sprite16x16.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.Sprite16x16.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_draw_packet.Sprite16x16.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_draw_packet.Sprite16x16.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_draw_packet.Sprite16x16.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.Sprite16x16.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.Sprite16x16.n_coord );
-	uint8_t n_v = TEXTURE_V( m_packet.Sprite16x16.n_texture );
+	int16_t n_x = S11_COORD_X( m_draw_packet.Sprite16x16.n_coord );
+	int16_t n_y = S11_COORD_Y( m_draw_packet.Sprite16x16.n_coord );
+	uint8_t n_v = TEXTURE_V( m_draw_packet.Sprite16x16.n_texture );
 	uint32_t n_h = 16;
 
 	while( n_h > 0 )
 	{
-		uint8_t n_u = TEXTURE_U( m_packet.Sprite16x16.n_texture );
+		uint8_t n_u = TEXTURE_U( m_draw_packet.Sprite16x16.n_texture );
 		int16_t n_distance = 16;
 
 		int drawy = n_y + n_drawoffset_y;
@@ -2627,16 +2669,16 @@ void psxgpu_device::Dot()
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.Dot.vertex.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.Dot.vertex.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.Dot.vertex.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.Dot.vertex.n_coord ) + n_drawoffset_y );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.Dot.n_bgr );
-	uint8_t n_r = BGR_R( m_packet.Dot.n_bgr );
-	uint8_t n_g = BGR_G( m_packet.Dot.n_bgr );
-	uint8_t n_b = BGR_B( m_packet.Dot.n_bgr );
-	int32_t n_x = S11_COORD_X( m_packet.Dot.vertex.n_coord );
-	int32_t n_y = S11_COORD_Y( m_packet.Dot.vertex.n_coord );
+	uint8_t n_cmd = BGR_C( m_draw_packet.Dot.n_bgr );
+	uint8_t n_r = BGR_R( m_draw_packet.Dot.n_bgr );
+	uint8_t n_g = BGR_G( m_draw_packet.Dot.n_bgr );
+	uint8_t n_b = BGR_B( m_draw_packet.Dot.n_bgr );
+	int32_t n_x = S11_COORD_X( m_draw_packet.Dot.vertex.n_coord );
+	int32_t n_y = S11_COORD_Y( m_draw_packet.Dot.vertex.n_coord );
 
 	TRANSPARENCYSETUP
 
@@ -2675,22 +2717,22 @@ void psxgpu_device::TexturedDot()
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.TexturedDot.vertex.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.TexturedDot.vertex.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( m_draw_packet.TexturedDot.vertex.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_draw_packet.TexturedDot.vertex.n_coord ) + n_drawoffset_y );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.TexturedDot.n_bgr );
+	uint8_t n_cmd = BGR_C( m_draw_packet.TexturedDot.n_bgr );
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.TexturedDot.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.TexturedDot.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.TexturedDot.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_draw_packet.TexturedDot.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_draw_packet.TexturedDot.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_draw_packet.TexturedDot.n_bgr ); n_b.w.l = 0;
 
-	int32_t n_x = S11_COORD_X( m_packet.TexturedDot.vertex.n_coord );
-	int32_t n_y = S11_COORD_Y( m_packet.TexturedDot.vertex.n_coord );
-	uint8_t n_u = TEXTURE_U(m_packet.TexturedDot.vertex.n_texture );
-	uint8_t n_v = TEXTURE_V(m_packet.TexturedDot.vertex.n_texture );
-	uint32_t n_clutx = ( m_packet.TexturedDot.vertex.n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.TexturedDot.vertex.n_texture.w.h >> 6 ) & 0x3ff;
+	int32_t n_x = S11_COORD_X( m_draw_packet.TexturedDot.vertex.n_coord );
+	int32_t n_y = S11_COORD_Y( m_draw_packet.TexturedDot.vertex.n_coord );
+	uint8_t n_u = TEXTURE_U(m_draw_packet.TexturedDot.vertex.n_texture );
+	uint8_t n_v = TEXTURE_V(m_draw_packet.TexturedDot.vertex.n_texture );
+	uint32_t n_clutx = ( m_draw_packet.TexturedDot.vertex.n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( m_draw_packet.TexturedDot.vertex.n_texture.w.h >> 6 ) & 0x3ff;
 
 	TEXTURESETUP
 
@@ -2713,22 +2755,22 @@ void psxgpu_device::MoveImage()
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ), S11_COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ) );
-	DebugMesh( S11_COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_W( m_packet.MoveImage.n_size ), S11_COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ) );
-	DebugMesh( S11_COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ), S11_COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ) ) + SIZE_H( m_packet.MoveImage.n_size ) );
-	DebugMesh( S11_COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_W( m_packet.MoveImage.n_size ), S11_COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_H( m_packet.MoveImage.n_size ) );
+	DebugMesh( S11_COORD_X( m_draw_packet.MoveImage.vertex[ 1 ].n_coord ), S11_COORD_Y( m_draw_packet.MoveImage.vertex[ 1 ].n_coord ) );
+	DebugMesh( S11_COORD_X( m_draw_packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_W( m_draw_packet.MoveImage.n_size ), S11_COORD_Y( m_draw_packet.MoveImage.vertex[ 1 ].n_coord ) );
+	DebugMesh( S11_COORD_X( m_draw_packet.MoveImage.vertex[ 1 ].n_coord ), S11_COORD_Y( m_draw_packet.MoveImage.vertex[ 1 ].n_coord ) ) + SIZE_H( m_draw_packet.MoveImage.n_size ) );
+	DebugMesh( S11_COORD_X( m_draw_packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_W( m_draw_packet.MoveImage.n_size ), S11_COORD_Y( m_draw_packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_H( m_draw_packet.MoveImage.n_size ) );
 	DebugMeshEnd();
 #endif
 
-	int16_t n_srcy = COORD_Y( m_packet.MoveImage.vertex[ 0 ].n_coord );
-	int16_t n_dsty = COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord );
-	int16_t n_h = SIZE_H( m_packet.MoveImage.n_size );
+	int16_t n_srcy = COORD_Y( m_draw_packet.MoveImage.vertex[ 0 ].n_coord );
+	int16_t n_dsty = COORD_Y( m_draw_packet.MoveImage.vertex[ 1 ].n_coord );
+	int16_t n_h = SIZE_H( m_draw_packet.MoveImage.n_size );
 
 	while( n_h > 0 )
 	{
-		int16_t n_srcx = COORD_X( m_packet.MoveImage.vertex[ 0 ].n_coord );
-		int16_t n_dstx = COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord );
-		int16_t n_w = SIZE_W( m_packet.MoveImage.n_size );
+		int16_t n_srcx = COORD_X( m_draw_packet.MoveImage.vertex[ 0 ].n_coord );
+		int16_t n_dstx = COORD_X( m_draw_packet.MoveImage.vertex[ 1 ].n_coord );
+		int16_t n_w = SIZE_W( m_draw_packet.MoveImage.n_size );
 
 		while( n_w > 0 )
 		{
@@ -2745,6 +2787,185 @@ void psxgpu_device::MoveImage()
 	}
 }
 
+void psxgpu_device::execute_command( const PACKET &packet )
+{
+	m_draw_packet = packet;
+	switch( packet.n_entry[ 0 ] >> 24 )
+	{
+	case 0x02:
+		FrameBufferRectangleDraw();
+		break;
+	case 0x20: case 0x21: case 0x22: case 0x23:
+		FlatPolygon( 3 );
+		break;
+	case 0x24: case 0x25: case 0x26: case 0x27:
+		FlatTexturedPolygon( 3 );
+		break;
+	case 0x28: case 0x29: case 0x2a: case 0x2b:
+		FlatPolygon( 4 );
+		break;
+	case 0x2c: case 0x2d: case 0x2e: case 0x2f:
+		FlatTexturedPolygon( 4 );
+		break;
+	case 0x30: case 0x31: case 0x32: case 0x33:
+		GouraudPolygon( 3 );
+		break;
+	case 0x34: case 0x35: case 0x36: case 0x37:
+		GouraudTexturedPolygon( 3 );
+		break;
+	case 0x38: case 0x39: case 0x3a: case 0x3b:
+		GouraudPolygon( 4 );
+		break;
+	case 0x3c: case 0x3d: case 0x3e: case 0x3f:
+		GouraudTexturedPolygon( 4 );
+		break;
+	case 0x40: case 0x41: case 0x42: case 0x43:
+	case 0x48: case 0x4a: case 0x4c: case 0x4e:
+		MonochromeLine();
+		break;
+	case 0x50: case 0x51: case 0x52: case 0x53:
+	case 0x58: case 0x5a: case 0x5c: case 0x5e:
+		GouraudLine();
+		break;
+	case 0x60: case 0x61: case 0x62: case 0x63:
+		FlatRectangle();
+		break;
+	case 0x64: case 0x65: case 0x66: case 0x67:
+		FlatTexturedRectangle();
+		break;
+	case 0x68: case 0x69: case 0x6a: case 0x6b:
+		Dot();
+		break;
+	case 0x6c: case 0x6d: case 0x6e: case 0x6f:
+		TexturedDot();
+		break;
+	case 0x70: case 0x71: case 0x72: case 0x73:
+		FlatRectangle8x8();
+		break;
+	case 0x74: case 0x75: case 0x76: case 0x77:
+		Sprite8x8();
+		break;
+	case 0x78: case 0x79: case 0x7a: case 0x7b:
+		FlatRectangle16x16();
+		break;
+	case 0x7c: case 0x7d: case 0x7e: case 0x7f:
+		Sprite16x16();
+		break;
+	case 0x80:
+		MoveImage();
+		break;
+	case 0xe1:
+		decode_tpage( packet.n_entry[ 0 ] & 0xffffff );
+		break;
+	case 0xe2:
+		n_twy = ( ( ( packet.n_entry[ 0 ] >> 15 ) & 0x1f ) << 3 );
+		n_twx = ( ( ( packet.n_entry[ 0 ] >> 10 ) & 0x1f ) << 3 );
+		n_twh = 255 - ( ( ( packet.n_entry[ 0 ] >> 5 ) & 0x1f ) << 3 );
+		n_tww = 255 - ( ( packet.n_entry[ 0 ] & 0x1f ) << 3 );
+		break;
+	case 0xe3:
+		n_drawarea_x1 = packet.n_entry[ 0 ] & 1023;
+		if( m_n_gputype == 2 )
+		{
+			n_drawarea_y1 = ( packet.n_entry[ 0 ] >> 10 ) & 1023;
+		}
+		else
+		{
+			n_drawarea_y1 = ( packet.n_entry[ 0 ] >> 12 ) & 1023;
+		}
+		break;
+	case 0xe4:
+		n_drawarea_x2 = packet.n_entry[ 0 ] & 1023;
+		if( m_n_gputype == 2 )
+		{
+			n_drawarea_y2 = ( packet.n_entry[ 0 ] >> 10 ) & 1023;
+		}
+		else
+		{
+			n_drawarea_y2 = ( packet.n_entry[ 0 ] >> 12 ) & 1023;
+		}
+		break;
+	case 0xe5:
+		n_drawoffset_x = util::sext( packet.n_entry[ 0 ] & 2047, 11 );
+		if( m_n_gputype == 2 )
+		{
+			n_drawoffset_y = util::sext( ( packet.n_entry[ 0 ] >> 11 ) & 2047, 11 );
+		}
+		else
+		{
+			n_drawoffset_y = util::sext( ( packet.n_entry[ 0 ] >> 12 ) & 2047, 11 );
+		}
+		break;
+	case 0xe6:
+		m_draw_stp = BIT( packet.n_entry[ 0 ], 0 );
+		m_check_stp = BIT( packet.n_entry[ 0 ], 1 );
+		break;
+	}
+}
+
+/*
+ * Completed GP0 commands that only touch VRAM and the drawing state are
+ * handed to the render thread in order; anything on the CPU side that
+ * reads VRAM or the drawing state calls sync_render() first.
+ */
+
+void psxgpu_device::submit_command()
+{
+	if( m_render_queue == nullptr )
+	{
+		execute_command( m_packet );
+		return;
+	}
+
+	render_command &command = m_commands[ m_commands_written++ ];
+	command.m_gpu = this;
+	command.m_packet = m_packet;
+
+	if( m_commands_written == COMMAND_BUFFER_SIZE )
+	{
+		sync_render();
+	}
+	else if( m_commands_written - m_commands_queued >= COMMAND_BATCH )
+	{
+		flush_commands();
+	}
+}
+
+void psxgpu_device::flush_commands()
+{
+	uint32_t count = m_commands_written - m_commands_queued;
+	if( count != 0 )
+	{
+		osd_work_item_queue_multiple( m_render_queue, render_callback, count, &m_commands[ m_commands_queued ], sizeof( render_command ), WORK_ITEM_FLAG_AUTO_RELEASE );
+		m_commands_queued = m_commands_written;
+		m_render_busy = true;
+	}
+}
+
+void psxgpu_device::sync_render()
+{
+	if( m_render_queue == nullptr )
+	{
+		return;
+	}
+
+	flush_commands();
+	if( m_render_busy )
+	{
+		while( !osd_work_queue_wait( m_render_queue, osd_ticks_per_second() ) ) { }
+		m_render_busy = false;
+	}
+	m_commands_written = 0;
+	m_commands_queued = 0;
+}
+
+void *psxgpu_device::render_callback( void *param, int threadid )
+{
+	render_command &command = *reinterpret_cast<render_command *>( param );
+	command.m_gpu->execute_command( command.m_packet );
+	return nullptr;
+}
+
 void psxgpu_device::dma_write( uint32_t *p_n_psxram, uint32_t n_address, int32_t n_size )
 {
 	gpu_write( &p_n_psxram[ n_address / 4 ], n_size );
@@ -2775,7 +2996,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: frame buffer rectangle %u,%u %u,%u\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 1 ] & 0xffff, m_packet.n_entry[ 1 ] >> 16, m_packet.n_entry[ 2 ] & 0xffff, m_packet.n_entry[ 2 ] >> 16 );
-				FrameBufferRectangleDraw();
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2790,7 +3011,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, machine().describe_context(), "%s: %02x: monochrome 3 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				FlatPolygon( 3 );
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2805,7 +3026,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: textured 3 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				FlatTexturedPolygon( 3 );
+				update_tpage_status( m_packet.FlatTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2820,7 +3042,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: monochrome 4 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				FlatPolygon( 4 );
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2835,7 +3057,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: textured 4 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				FlatTexturedPolygon( 4 );
+				update_tpage_status( m_packet.FlatTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2850,7 +3073,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud 3 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24 );
-				GouraudPolygon( 3 );
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2865,7 +3088,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud textured 3 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				GouraudTexturedPolygon( 3 );
+				update_tpage_status( m_packet.GouraudTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2880,7 +3104,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud 4 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				GouraudPolygon( 4 );
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2895,7 +3119,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud textured 4 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				GouraudTexturedPolygon( 4 );
+				update_tpage_status( m_packet.GouraudTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2910,7 +3135,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: monochrome line\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				MonochromeLine();
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2925,7 +3150,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: monochrome polyline\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				MonochromeLine();
+				submit_command();
 				if( ( m_packet.n_entry[ 3 ] & 0xf000f000 ) != 0x50005000 )
 				{
 					m_packet.n_entry[ 1 ] = m_packet.n_entry[ 2 ];
@@ -2949,7 +3174,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud line\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				GouraudLine();
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2965,7 +3190,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud polyline\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				GouraudLine();
+				submit_command();
 				if( ( m_packet.n_entry[ 4 ] & 0xf000f000 ) != 0x50005000 )
 				{
 					m_packet.n_entry[ 0 ] = ( m_packet.n_entry[ 0 ] & 0xff000000 ) | ( m_packet.n_entry[ 2 ] & 0x00ffffff );
@@ -2994,7 +3219,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 					m_packet.n_entry[ 0 ] >> 24,
 					(int16_t)( m_packet.n_entry[ 1 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 1 ] >> 16 ),
 					(int16_t)( m_packet.n_entry[ 2 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 2 ] >> 16 ) );
-				FlatRectangle();
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3013,7 +3238,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 					(int16_t)( m_packet.n_entry[ 1 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 1 ] >> 16 ),
 					m_packet.n_entry[ 3 ] & 0xffff, m_packet.n_entry[ 3 ] >> 16,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 2 ] );
-				FlatTexturedRectangle();
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3031,7 +3256,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 					m_packet.n_entry[ 0 ] >> 24,
 					(int16_t)( m_packet.n_entry[ 1 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 1 ] >> 16 ),
 					m_packet.n_entry[ 0 ] & 0xffffff );
-				Dot();
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3049,7 +3274,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 					m_packet.n_entry[ 0 ] >> 24,
 					(int16_t)( m_packet.n_entry[ 1 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 1 ] >> 16 ),
 					m_packet.n_entry[ 0 ] & 0xffffff );
-				TexturedDot();
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3066,7 +3291,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s; %02x: 16x16 rectangle %08x %08x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ] );
-				FlatRectangle8x8();
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3082,7 +3307,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: 8x8 sprite %08x %08x %08x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ], m_packet.n_entry[ 2 ] );
-				Sprite8x8();
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3099,7 +3324,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: 16x16 rectangle %08x %08x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ] );
-				FlatRectangle16x16();
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3115,7 +3340,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: 16x16 sprite %08x %08x %08x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ], m_packet.n_entry[ 2 ] );
-				Sprite16x16();
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3128,7 +3353,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s: move image in frame buffer %08x %08x %08x %08x\n", machine().describe_context(),
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ], m_packet.n_entry[ 2 ], m_packet.n_entry[ 3 ]);
-				MoveImage();
+				submit_command();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3139,6 +3364,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			}
 			else
 			{
+				// the image goes straight into VRAM, after anything queued
+				sync_render();
 				for( int n_pixel = 0; n_pixel < 2; n_pixel++ )
 				{
 					LOGMASKED(LOG_WRITE, "%s: send image to framebuffer ( pixel %u,%u = %u )\n",
@@ -3177,68 +3404,42 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: copy image from frame buffer\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
+				sync_render();
 				n_gpustatus |= ( 1L << 0x1b );
 			}
 			break;
 		case 0xe1:
 			LOGMASKED(LOG_WRITE, "%s: %02x: draw mode %06x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 				m_packet.n_entry[ 0 ] & 0xffffff );
-			decode_tpage( m_packet.n_entry[ 0 ] & 0xffffff );
+			update_tpage_status( m_packet.n_entry[ 0 ] & 0xffffff );
+			submit_command();
 			break;
 		case 0xe2:
-			n_twy = ( ( ( m_packet.n_entry[ 0 ] >> 15 ) & 0x1f ) << 3 );
-			n_twx = ( ( ( m_packet.n_entry[ 0 ] >> 10 ) & 0x1f ) << 3 );
-			n_twh = 255 - ( ( ( m_packet.n_entry[ 0 ] >> 5 ) & 0x1f ) << 3 );
-			n_tww = 255 - ( ( m_packet.n_entry[ 0 ] & 0x1f ) << 3 );
-			LOGMASKED(LOG_WRITE, "%s: %02x: texture window %u,%u %u,%u\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
-				n_twx, n_twy, n_tww, n_twh );
+			LOGMASKED(LOG_WRITE, "%s: %02x: texture window %06x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
+				m_packet.n_entry[ 0 ] & 0xffffff );
+			submit_command();
 			break;
 		case 0xe3:
-			n_drawarea_x1 = m_packet.n_entry[ 0 ] & 1023;
-			if( m_n_gputype == 2 )
-			{
-				n_drawarea_y1 = ( m_packet.n_entry[ 0 ] >> 10 ) & 1023;
-			}
-			else
-			{
-				n_drawarea_y1 = ( m_packet.n_entry[ 0 ] >> 12 ) & 1023;
-			}
-			LOGMASKED(LOG_WRITE, "%s: %02x: drawing area top left %d,%d\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
-				n_drawarea_x1, n_drawarea_y1 );
+			LOGMASKED(LOG_WRITE, "%s: %02x: drawing area top left %06x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
+				m_packet.n_entry[ 0 ] & 0xffffff );
+			submit_command();
 			break;
 		case 0xe4:
-			n_drawarea_x2 = m_packet.n_entry[ 0 ] & 1023;
-			if( m_n_gputype == 2 )
-			{
-				n_drawarea_y2 = ( m_packet.n_entry[ 0 ] >> 10 ) & 1023;
-			}
-			else
-			{
-				n_drawarea_y2 = ( m_packet.n_entry[ 0 ] >> 12 ) & 1023;
-			}
-			LOGMASKED(LOG_WRITE, "%s: %02x: drawing area bottom right %d,%d\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
-				n_drawarea_x2, n_drawarea_y2 );
+			LOGMASKED(LOG_WRITE, "%s: %02x: drawing area bottom right %06x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
+				m_packet.n_entry[ 0 ] & 0xffffff );
+			submit_command();
 			break;
 		case 0xe5:
-			n_drawoffset_x = util::sext( m_packet.n_entry[ 0 ] & 2047, 11 );
-			if( m_n_gputype == 2 )
-			{
-				n_drawoffset_y = util::sext( ( m_packet.n_entry[ 0 ] >> 11 ) & 2047, 11 );
-			}
-			else
-			{
-				n_drawoffset_y = util::sext( ( m_packet.n_entry[ 0 ] >> 12 ) & 2047, 11 );
-			}
-			LOGMASKED(LOG_WRITE, "%s: %02x: drawing offset %d,%d\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
-				n_drawoffset_x, n_drawoffset_y );
+			LOGMASKED(LOG_WRITE, "%s: %02x: drawing offset %06x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
+				m_packet.n_entry[ 0 ] & 0xffffff );
+			submit_command();
 			break;
 		case 0xe6:
-			m_draw_stp = BIT( data, 0 );
-			m_check_stp = BIT( data, 1 );
 			// TODO: confirm status bits on real type 1 gpu
 			n_gpustatus &= ~( 3L << 0xb );
 			n_gpustatus |= ( data & 0x03 ) << 0xb;
 			LOGMASKED(LOG_WRITE, "%s: mask setting %d\n", machine().describe_context(), m_packet.n_entry[ 0 ] & 3);
+			submit_command();
 			break;
 		default:
 #if defined( MAME_DEBUG )
@@ -3332,6 +3533,7 @@ void psxgpu_device::write(offs_t offset, uint32_t data, uint32_t mem_mask)
 			n_lightgun_y = 0;
 			break;
 		case 0x10:
+			sync_render();
 			switch( data & 0xff )
 			{
 			case 0x03:
@@ -3406,6 +3608,7 @@ void psxgpu_device::dma_read( uint32_t *p_n_psxram, uint32_t n_address, int32_t
 
 void psxgpu_device::gpu_read( uint32_t *p_ram, int32_t n_size )
 {
+	sync_render();
 	while( n_size > 0 )
 	{
 		if( ( n_gpustatus & ( 1L << 0x1b ) ) != 0 )
@@ -3487,6 +3690,7 @@ void psxgpu_device::vblank(screen_device &screen, bool vblank_state)
 
 void psxgpu_device::gpu_reset()
 {
+	sync_render();
 	n_gpu_buffer_offset = 0;
 	n_gpustatus = 0x14802000;
 	n_drawarea_x1 = 0;
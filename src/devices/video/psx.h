@@ -49,6 +49,8 @@ protected:
 	psxgpu_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
 
 	virtual void device_start() override;
+	virtual void device_stop() override;
+	virtual void device_pre_save() override;
 	virtual void device_post_load() override;
 	virtual void device_reset() override;
 	virtual void device_config_complete() override;
@@ -196,7 +198,18 @@ private:
 		} TexturedDot;
 	};
 
+	// a completed GP0 command, queued for the render thread
+	struct render_command
+	{
+		psxgpu_device *m_gpu;
+		PACKET m_packet;
+	};
+
+	static constexpr unsigned COMMAND_BUFFER_SIZE = 4096;
+	static constexpr unsigned COMMAND_BATCH = 32;
+
 	void updatevisiblearea();
+	void update_tpage_status( uint32_t tpage );
 	void decode_tpage( uint32_t tpage );
 	void FlatPolygon( int n_points );
 	void FlatTexturedPolygon( int n_points );
@@ -218,6 +231,11 @@ private:
 	void gpu_reset();
 	void gpu_read( uint32_t *p_ram, int32_t n_size );
 	void gpu_write( uint32_t *p_ram, int32_t n_size );
+	void execute_command( const PACKET &packet );
+	void submit_command();
+	void flush_commands();
+	void sync_render();
+	static void *render_callback( void *param, int threadid );
 
 	int32_t m_n_tx;
 	int32_t m_n_ty;
@@ -259,6 +277,13 @@ private:
 	bool m_check_stp;
 
 	PACKET m_packet;
+	PACKET m_draw_packet;
+
+	osd_work_queue *m_render_queue;
+	std::unique_ptr<render_command[]> m_commands;
+	uint32_t m_commands_written;
+	uint32_t m_commands_queued;
+	bool m_render_busy;
 
 	uint16_t *p_p_vram[ 1024 ];
 
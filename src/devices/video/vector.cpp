@@ -77,7 +77,10 @@ vector_device::vector_device(const machine_config &mconfig, const char *tag, dev
 		device_video_interface(mconfig, *this),
 		m_vector_list(nullptr),
 		m_min_intensity(255),
-		m_max_intensity(0)
+		m_max_intensity(0),
+		m_width_min(-1.0f),
+		m_width_max(-1.0f),
+		m_width_weight(-1.0f)
 {
 }
 
@@ -148,6 +151,28 @@ void vector_device::clear_list(void)
 }
 
 
+/*
+ * Rebuilds the beam width for each intensity level when the beam sliders
+ * have moved since the last frame.
+ */
+void vector_device::update_beam_widths()
+{
+	if (m_width_min == vector_options::s_beam_width_min && m_width_max == vector_options::s_beam_width_max && m_width_weight == vector_options::s_beam_intensity_weight)
+		return;
+
+	m_width_min = vector_options::s_beam_width_min;
+	m_width_max = vector_options::s_beam_width_max;
+	m_width_weight = vector_options::s_beam_intensity_weight;
+
+	for (int i = 0; i < 256; i++)
+	{
+		float intensity = (float)i / 255.0f;
+		float intensity_weight = normalized_sigmoid(intensity, m_width_weight);
+		m_beam_width[i] = (m_width_min + intensity_weight * (m_width_max - m_width_min)) * (1.0f / (float)VECTOR_WIDTH_DENOM);
+	}
+}
+
+
 uint32_t vector_device::screen_update(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
 	uint32_t flags = PRIMFLAG_ANTIALIAS(1) | PRIMFLAG_BLENDMODE(BLENDMODE_ADD) | PRIMFLAG_VECTOR(1);
@@ -157,10 +182,36 @@ uint32_t vector_device::screen_update(screen_device &screen, bitmap_rgb32 &bitma
 	float xoffs = (float)visarea.min_x;
 	float yoffs = (float)visarea.min_y;
 
+	update_beam_widths();
+
+	// check for static intensity
+	bool const static_width = m_min_intensity == m_max_intensity;
+	float const min_width = vector_options::s_beam_width_min * (1.0f / (float)VECTOR_WIDTH_DENOM);
+
 	point *curpoint;
 	int lastx = 0;
 	int lasty = 0;
 
+	// the line waiting to be added; straight runs of the same colour are
+	// extended rather than added segment by segment
+	int startx = 0, starty = 0;
+	point const *pending = nullptr;
+	float pending_width = 0.0f;
+
+	auto flush = [&] ()
+	{
+		if (pending)
+		{
+			screen.container().add_line(
+				((float)startx - xoffs) * xscale, ((float)starty - yoffs) * yscale,
+				((float)lastx - xoffs) * xscale, ((float)lasty - yoffs) * yscale,
+				pending_width,
+				(pending->intensity << 24) | (pending->col & 0xffffff),
+				flags);
+			pending = nullptr;
+		}
+	};
+
 	curpoint = m_vector_list.get();
 
 	screen.container().empty();
@@ -168,35 +219,41 @@ uint32_t vector_device::screen_update(screen_device &screen, bitmap_rgb32 &bitma
 
 	for (int i = 0; i < m_vector_index; i++)
 	{
-		render_bounds coords;
-
-		float intensity = (float)curpoint->intensity / 255.0f;
-		float intensity_weight = normalized_sigmoid(intensity, vector_options::s_beam_intensity_weight);
-
-		// check for static intensity
-		float beam_width = m_min_intensity == m_max_intensity
-			? vector_options::s_beam_width_min
-			: vector_options::s_beam_width_min + intensity_weight * (vector_options::s_beam_width_max - vector_options::s_beam_width_min);
+		bool const dot = lastx == curpoint->x && lasty == curpoint->y;
 
-		// normalize width
-		beam_width *= 1.0f / (float)VECTOR_WIDTH_DENOM;
-
-		// apply point scale for points
-		if (lastx == curpoint->x && lasty == curpoint->y)
-			beam_width *= vector_options::s_beam_dot_size;
-
-		coords.x0 = ((float)lastx - xoffs) * xscale;
-		coords.y0 = ((float)lasty - yoffs) * yscale;
-		coords.x1 = ((float)curpoint->x - xoffs) * xscale;
-		coords.y1 = ((float)curpoint->y - yoffs) * yscale;
+		if (curpoint->intensity == 0 || dot)
+			flush();
+		else if (pending)
+		{
+			// continue the pending line if this segment carries on in the same direction
+			s64 const dx0 = lastx - startx, dy0 = lasty - starty;
+			s64 const dx1 = curpoint->x - lastx, dy1 = curpoint->y - lasty;
+			if (pending->intensity != curpoint->intensity || (pending->col & 0xffffff) != (curpoint->col & 0xffffff) || dx0 * dy1 != dy0 * dx1 || dx0 * dx1 + dy0 * dy1 <= 0)
+				flush();
+		}
 
 		if (curpoint->intensity != 0)
 		{
-			screen.container().add_line(
-				coords.x0, coords.y0, coords.x1, coords.y1,
-				beam_width,
-				(curpoint->intensity << 24) | (curpoint->col & 0xffffff),
-				flags);
+			float beam_width = static_width ? min_width : m_beam_width[curpoint->intensity];
+
+			if (dot)
+			{
+				// apply point scale for points
+				float const coordx = ((float)curpoint->x - xoffs) * xscale;
+				float const coordy = ((float)curpoint->y - yoffs) * yscale;
+				screen.container().add_line(
+					coordx, coordy, coordx, coordy,
+					beam_width * vector_options::s_beam_dot_size,
+					(curpoint->intensity << 24) | (curpoint->col & 0xffffff),
+					flags);
+			}
+			else if (!pending)
+			{
+				startx = lastx;
+				starty = lasty;
+				pending = curpoint;
+				pending_width = beam_width;
+			}
 		}
 
 		lastx = curpoint->x;
@@ -204,6 +261,7 @@ uint32_t vector_device::screen_update(screen_device &screen, bitmap_rgb32 &bitma
 
 		curpoint++;
 	}
+	flush();
 
 	return 0;
 }
@@ -57,7 +57,14 @@ private:
 	int m_min_intensity;
 	int m_max_intensity;
 
+	// beam width per intensity, and the slider settings it was built for
+	float m_beam_width[256];
+	float m_width_min;
+	float m_width_max;
+	float m_width_weight;
+
 	float normalized_sigmoid(float n, float k);
+	void update_beam_widths();
 };
 
 // device type definition
@@ -579,8 +579,26 @@ u32 command_fifo::packet_type_5(u32 command)
 				m_device.logerror("  PACKET TYPE 5: FB count=%d dest=%08X bd2=%X bdN=%X\n", count, target, BIT(command, 26, 4), BIT(command, 22, 4));
 
 			m_device.renderer().wait("packet_type_5(0)");
-			for (u32 word = 0; word < count; word++)
-				m_ram[target++ & m_mask] = little_endianize_int32(read_next());
+			while (count != 0)
+			{
+				// copy in runs that stop wherever the target or the FIFO wraps
+				// around RAM; on little-endian hosts a run is a straight copy
+				u32 const dst = target & m_mask;
+				u32 const src = m_read_index & m_mask;
+				u32 const chunk = std::min({ count, m_mask + 1 - dst, m_mask + 1 - src });
+				if (ENDIANNESS_NATIVE == ENDIANNESS_LITTLE && (dst + chunk <= src || src + chunk <= dst))
+				{
+					memcpy(&m_ram[dst], &m_ram[src], chunk * 4);
+					consume(chunk);
+				}
+				else
+				{
+					for (u32 word = 0; word < chunk; word++)
+						m_ram[dst + word] = little_endianize_int32(read_next());
+				}
+				target += chunk;
+				count -= chunk;
+			}
 			break;
 
 		// 3D LFB
@@ -1036,6 +1036,15 @@ s32 voodoo_banshee_device::internal_2d_w(offs_t offset, u32 data)
 			m_blt_dst_bpp    = s_format_bpp[BIT(m_2d_regs.read(banshee_2d_regs::dstFormat), 16, 3)];
 
 			m_blt_cmd = BIT(data, 0, 4);
+
+			// bit 8 starts screen-to-screen blits and fills without a launch write
+			if (BIT(data, 8))
+			{
+				if (m_blt_cmd == 1)
+					execute_blit(m_2d_regs.read(banshee_2d_regs::srcXY));
+				else if (m_blt_cmd == 5)
+					execute_blit(m_2d_regs.read(banshee_2d_regs::dstXY));
+			}
 			break;
 
 		default:
@@ -1565,9 +1574,9 @@ void voodoo_banshee_device::execute_blit(u32 data)
 			break;
 
 		case 1:         // Screen-to-screen blit
-			// TODO
 			if (LOG_BANSHEE_2D)
 				logerror("   blit_2d:screen_to_screen: src X %d, src Y %d\n", data & 0xfff, (data >> 16) & 0xfff);
+			blit_rectangle(BIT(data, 0, 12), BIT(data, 16, 12), true);
 			break;
 
 		case 2:         // Screen-to-screen stretch blit
@@ -1622,7 +1631,12 @@ void voodoo_banshee_device::execute_blit(u32 data)
 		}
 
 		case 5:         // Rectangle fill
-			fatalerror("%s: Unsupported 2D rectangle_fill: src X %d, src Y %d", tag(), BIT(data, 0, 12), BIT(data, 16, 12));
+			if (LOG_BANSHEE_2D)
+				logerror("   blit_2d:rectangle_fill: dst X %d, dst Y %d\n", BIT(data, 0, 12), BIT(data, 16, 12));
+			m_blt_dst_x = BIT(data, 0, 12);
+			m_blt_dst_y = BIT(data, 16, 12);
+			blit_rectangle(0, 0, false);
+			break;
 
 		case 6:         // Line
 			fatalerror("%s: Unsupported 2D line: end X %d, end Y %d", tag(), BIT(data, 0, 12), BIT(data, 16, 12));
@@ -1639,6 +1653,130 @@ void voodoo_banshee_device::execute_blit(u32 data)
 }
 
 
+//-------------------------------------------------
+//  rop3 - apply a ternary raster operation to a
+//  byte of pattern, source and destination
+//-------------------------------------------------
+
+static inline u8 rop3(u8 rop, u8 pat, u8 src, u8 dst)
+{
+	u8 result = 0;
+	for (int bit = 0; bit < 8; bit++)
+		if (BIT(rop, bit))
+			result |= (BIT(bit, 2) ? pat : ~pat) & (BIT(bit, 1) ? src : ~src) & (BIT(bit, 0) ? dst : ~dst);
+	return result;
+}
+
+
+//-------------------------------------------------
+//  blit_rectangle - run a screen-to-screen blit
+//  from (src_x,src_y), or a rectangle fill, over
+//  dstSize pixels at the latched destination;
+//  the pattern is the solid colorFore, which
+//  also stands in for the source on fills
+//-------------------------------------------------
+
+void voodoo_banshee_device::blit_rectangle(u32 src_x, u32 src_y, bool use_source)
+{
+	u32 const command = m_2d_regs.read(banshee_2d_regs::command);
+	u8 const rop = BIT(command, 24, 8);
+	u32 const bpp = m_blt_dst_bpp;
+	u32 const width = m_blt_dst_width;
+	u32 const height = m_blt_dst_height;
+	if (width == 0 || height == 0)
+		return;
+
+	if (use_source && m_blt_src_bpp != bpp && LOG_BANSHEE_2D)
+		logerror("   blit_2d: format conversion %d -> %d bpp not supported\n", m_blt_src_bpp, bpp);
+
+	// with the direction bits set, X/Y address the right/bottom edge
+	u32 dst_x = m_blt_dst_x, dst_y = m_blt_dst_y;
+	if (BIT(command, 14))
+	{
+		dst_x -= width - 1;
+		src_x -= width - 1;
+	}
+	if (BIT(command, 15))
+	{
+		dst_y -= height - 1;
+		src_y -= height - 1;
+	}
+
+	u32 const row_bytes = width * bpp;
+	u32 const dst = m_blt_dst_base + dst_y * m_blt_dst_stride + dst_x * bpp;
+	u32 const src = m_blt_src_base + src_y * m_blt_src_stride + src_x * bpp;
+
+	// pixels are stored most significant byte first, as for host blits
+	u32 const color = m_2d_regs.read(banshee_2d_regs::colorFore);
+	u8 pattern[4];
+	for (u32 byte = 0; byte < bpp; byte++)
+		pattern[byte] = BIT(color, 8 * (bpp - 1 - byte), 8);
+
+	// classify the ROP: a plain copy, something independent of the
+	// source and destination (fills, BLACKNESS, WHITENESS), or generic
+	bool const needs_dest = (((rop >> 1) ^ rop) & 0x55) != 0;
+	bool const needs_source = (((rop >> 2) ^ rop) & 0x33) != 0;
+	bool const copy = use_source && rop == 0xcc;
+	bool const fill = !needs_dest && (!needs_source || !use_source);
+
+	std::vector<u8> fill_row;
+	bool fill_memset = fill;
+	u8 fill_byte = 0;
+	if (fill)
+	{
+		u8 solid[4];
+		for (u32 byte = 0; byte < bpp; byte++)
+		{
+			solid[byte] = rop3(rop, pattern[byte], pattern[byte], 0);
+			fill_memset = fill_memset && solid[byte] == solid[0];
+		}
+		if (!fill_memset)
+		{
+			fill_row.resize(row_bytes);
+			for (u32 byte = 0; byte < row_bytes; byte++)
+				fill_row[byte] = solid[byte % bpp];
+		}
+		else
+			fill_byte = solid[0];
+	}
+
+	m_renderer->wait("blit_rectangle");
+
+	// copy bottom-up when the destination is below an overlapping source
+	u32 const fbsize = m_fbmask + 1;
+	bool const bottom_up = use_source && (src & m_fbmask) < (dst & m_fbmask);
+	for (u32 row = 0; row < height; row++)
+	{
+		u32 const y = bottom_up ? (height - 1 - row) : row;
+		u32 const d = (dst + y * m_blt_dst_stride) & m_fbmask;
+		u32 const s = (src + y * m_blt_src_stride) & m_fbmask;
+		bool const linear = d + row_bytes <= fbsize && (!use_source || s + row_bytes <= fbsize);
+
+		if (linear && copy)
+			memmove(&m_fbram[d], &m_fbram[s], row_bytes);
+		else if (linear && fill_memset)
+			memset(&m_fbram[d], fill_byte, row_bytes);
+		else if (linear && fill)
+			memcpy(&m_fbram[d], &fill_row[0], row_bytes);
+		else
+		{
+			// generic ROP, or a row that wraps around the end of RAM; walk
+			// right-to-left when the source overlaps from the left
+			bool const backwards = use_source && s < d;
+			for (u32 count = 0; count < row_bytes; count++)
+			{
+				u32 const byte = backwards ? (row_bytes - 1 - count) : count;
+				u8 const pat = pattern[byte % bpp];
+				u8 const source = use_source ? m_fbram[(s + byte) & m_fbmask] : pat;
+				u8 &dest = m_fbram[(d + byte) & m_fbmask];
+				dest = rop3(rop, pat, source, dest);
+			}
+		}
+	}
+	m_video_changed = true;
+}
+
+
 //**************************************************************************
 //  VOODOO 3 DEVICE
 //**************************************************************************
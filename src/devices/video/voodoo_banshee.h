@@ -133,6 +133,7 @@ protected:
 
 	// rendering
 	void execute_blit(u32 data);
+	void blit_rectangle(u32 src_x, u32 src_y, bool use_source);
 
 	// internal state
 	u32 m_lfb_base;                              // configured LFB base
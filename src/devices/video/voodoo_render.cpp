@@ -1245,6 +1245,8 @@ voodoo_renderer::voodoo_renderer(running_machine &machine, u16 tmu_config, const
 	m_tmu1_reg(tmu1_regs),
 	m_rgb565(rgb565),
 	m_fogdelta_mask(0xff),
+	m_lookups(0),
+	m_lookup_specialized(0),
 	m_thread_stats(WORK_MAX_THREADS)
 {
 	// empty the hash table
@@ -1333,6 +1335,7 @@ u32 voodoo_renderer::enqueue_triangle(poly_data &poly, vertex_t const *vert)
 	u32 hash = fullhash % RASTER_HASH_SIZE;
 
 	// find the appropriate hash entry
+	m_lookups++;
 	rasterizer_info *prev = nullptr;
 	rasterizer_info *info;
 	for (info = m_raster_hash[hash]; info != nullptr; prev = info, info = info->next)
@@ -1357,6 +1360,8 @@ u32 voodoo_renderer::enqueue_triangle(poly_data &poly, vertex_t const *vert)
 		else
 			info = m_generic_rasterizer[poly.raster.generic()];
 	}
+	else if (!info->is_generic)
+		m_lookup_specialized++;
 
 	// set the info and render the triangle
 	info->polys++;
@@ -2584,6 +2589,12 @@ void voodoo_renderer::dump_rasterizer_stats()
 	osd_printf_info("----\n");
 	display_index++;
 
+	// summarize how well the specialized rasterizers cover what's being drawn
+	if (m_lookups != 0)
+		osd_printf_info("// %d lookups, %d%% specialized\n",
+			m_lookups,
+			int(m_lookup_specialized * 100 / m_lookups));
+
 	// loop until we've displayed everything
 	while (1)
 	{
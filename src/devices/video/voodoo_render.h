@@ -608,6 +608,8 @@ private:
 	voodoo::rasterizer_info *m_raster_hash[RASTER_HASH_SIZE]; // hash table of rasterizers
 	voodoo::rasterizer_info *m_generic_rasterizer[16];
 	std::list<voodoo::rasterizer_info> m_rasterizer_list;
+	u64 m_lookups;              // rasterizer lookups
+	u64 m_lookup_specialized;   // lookups that found a specialized rasterizer
 	std::vector<thread_stats_block> m_thread_stats;
 };
 
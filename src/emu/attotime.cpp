@@ -38,6 +38,18 @@ attotime &attotime::operator*=(u32 factor)
 	if (factor == 0)
 		return *this = zero;
 
+#if defined(__SIZEOF_INT128__)
+	// scale the attoseconds in one step and carry whole seconds out
+	unsigned __int128 const attos = (unsigned __int128)u64(m_attoseconds) * factor;
+	u64 const temp = u64(attos / u64(ATTOSECONDS_PER_SECOND)) + mulu_32x32(m_seconds, factor);
+	if (temp >= ATTOTIME_MAX_SECONDS)
+		return *this = never;
+
+	// build the result
+	m_seconds = temp;
+	m_attoseconds = attoseconds_t(u64(attos % u64(ATTOSECONDS_PER_SECOND)));
+	return *this;
+#else
 	// split attoseconds into upper and lower halves which fit into 32 bits
 	u32 attolo;
 	u32 attohi = divu_64x32_rem(m_attoseconds, ATTOSECONDS_PER_SECOND_SQRT, attolo);
@@ -61,6 +73,7 @@ attotime &attotime::operator*=(u32 factor)
 	m_seconds = temp;
 	m_attoseconds = (attoseconds_t)reslo + mul_32x32(reshi, ATTOSECONDS_PER_SECOND_SQRT);
 	return *this;
+#endif
 }
 
 
@@ -78,6 +91,16 @@ attotime &attotime::operator/=(u32 factor)
 	if (factor == 0)
 		return *this;
 
+#if defined(__SIZEOF_INT128__)
+	// divide the seconds and get the remainder
+	u32 remainder;
+	m_seconds = divu_64x32_rem(m_seconds, factor, remainder);
+
+	// carry the remainder into the attoseconds and divide those in one step
+	unsigned __int128 const attos = (unsigned __int128)remainder * u64(ATTOSECONDS_PER_SECOND) + u64(m_attoseconds);
+	m_attoseconds = attoseconds_t(u64(attos / factor));
+	remainder = u32(attos % factor);
+#else
 	// split attoseconds into upper and lower halves which fit into 32 bits
 	u32 attolo;
 	u32 attohi = divu_64x32_rem(m_attoseconds, ATTOSECONDS_PER_SECOND_SQRT, attolo);
@@ -94,8 +117,10 @@ attotime &attotime::operator/=(u32 factor)
 	temp = attolo + mulu_32x32(remainder, ATTOSECONDS_PER_SECOND_SQRT);
 	u32 reslo = divu_64x32_rem(temp, factor, remainder);
 
-	// round based on the remainder
 	m_attoseconds = (attoseconds_t)reslo + mulu_32x32(reshi, ATTOSECONDS_PER_SECOND_SQRT);
+#endif
+
+	// round based on the remainder
 	if (remainder >= factor / 2)
 		if (++m_attoseconds >= ATTOSECONDS_PER_SECOND)
 		{
@@ -20,8 +20,12 @@
 #include "points.h"
 
 #include "debugger.h"
+#include "divtlb.h"
 #include "emuopts.h"
 #include "fileio.h"
+#include "memprof.h"
+#include "memreport.h"
+#include "pcprof.h"
 #include "natkeyboard.h"
 #include "render.h"
 #include "screen.h"
@@ -347,6 +351,16 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 	m_console.register_command("mapi",      CMDFLAG_NONE, 1, 1, std::bind(&debugger_commands::execute_map, this, AS_IO, _1));
 	m_console.register_command("mapo",      CMDFLAG_NONE, 1, 1, std::bind(&debugger_commands::execute_map, this, AS_OPCODES, _1));
 	m_console.register_command("memdump",   CMDFLAG_NONE, 0, 2, std::bind(&debugger_commands::execute_memdump, this, _1));
+	m_console.register_command("memreport", CMDFLAG_NONE, 0, 1, std::bind(&debugger_commands::execute_memreport, this, _1));
+	m_console.register_command("memprof",   CMDFLAG_NONE, 0, 4, std::bind(&debugger_commands::execute_memprof, this, _1));
+	m_console.register_command("memprofclear", CMDFLAG_NONE, 0, 1, std::bind(&debugger_commands::execute_memprofclear, this, _1));
+	m_console.register_command("memproflist", CMDFLAG_NONE, 0, 2, std::bind(&debugger_commands::execute_memproflist, this, _1));
+	m_console.register_command("pcprof",    CMDFLAG_NONE, 0, 2, std::bind(&debugger_commands::execute_pcprof, this, _1));
+	m_console.register_command("pcprofclear", CMDFLAG_NONE, 0, 0, std::bind(&debugger_commands::execute_pcprofclear, this, _1));
+	m_console.register_command("pcproflist", CMDFLAG_NONE, 0, 2, std::bind(&debugger_commands::execute_pcproflist, this, _1));
+	m_console.register_command("pcprofrange", CMDFLAG_NONE, 4, 4, std::bind(&debugger_commands::execute_pcprofrange, this, _1));
+	m_console.register_command("pcprofsave", CMDFLAG_NONE, 1, 1, std::bind(&debugger_commands::execute_pcprofsave, this, _1));
+	m_console.register_command("vtlbstats", CMDFLAG_NONE, 0, 2, std::bind(&debugger_commands::execute_vtlbstats, this, _1));
 
 	m_console.register_command("symlist",   CMDFLAG_NONE, 0, 1, std::bind(&debugger_commands::execute_symlist, this, _1));
 
@@ -3446,6 +3460,7 @@ void debugger_commands::execute_trace(const std::vector<std::string_view> &param
 	std::string_view action;
 	bool detect_loops = true;
 	bool logerror = false;
+	bool binary = false;
 	std::string filename(params[0]);
 
 	// replace macros
@@ -3468,6 +3483,8 @@ void debugger_commands::execute_trace(const std::vector<std::string_view> &param
 				detect_loops = false;
 			else if (util::streqlower(flag, "logerror"sv))
 				logerror = true;
+			else if (util::streqlower(flag, "binary"sv))
+				binary = true;
 			else
 			{
 				m_console.printf("Invalid flag '%s'\n", flag);
@@ -3484,6 +3501,8 @@ void debugger_commands::execute_trace(const std::vector<std::string_view> &param
 	if (!util::streqlower(filename, "off"sv))
 	{
 		std::ios_base::openmode mode = std::ios_base::out;
+		if (binary)
+			mode |= std::ios_base::binary;
 
 		// opening for append?
 		if ((filename[0] == '>') && (filename[1] == '>'))
@@ -3504,7 +3523,7 @@ void debugger_commands::execute_trace(const std::vector<std::string_view> &param
 
 	// do it
 	bool const on(f);
-	cpu->debug()->trace(std::move(f), trace_over, detect_loops, logerror, action);
+	cpu->debug()->trace(std::move(f), trace_over, detect_loops, logerror, binary, action);
 	if (on)
 		m_console.printf("Tracing CPU '%s' to file %s\n", cpu->tag(), filename);
 	else
@@ -3869,6 +3888,298 @@ void debugger_commands::execute_memdump(const std::vector<std::string_view> &par
 }
 
 
+/*-------------------------------------------------
+    execute_memreport - show the memory footprint
+    by category and the largest allocations
+-------------------------------------------------*/
+
+void debugger_commands::execute_memreport(const std::vector<std::string_view> &params)
+{
+	u64 count = 16;
+	if (!params.empty() && !m_console.validate_number_parameter(params[0], count))
+		return;
+
+	memory_report &report = m_machine.memreport();
+	report.collect();
+	m_console.printf("%s", report.text(u32(count)));
+}
+
+
+/*-------------------------------------------------
+    execute_memprof - start sampling accesses to
+    an address space
+-------------------------------------------------*/
+
+void debugger_commands::execute_memprof(const std::vector<std::string_view> &params)
+{
+	address_space *space;
+	if (!m_console.validate_device_space_parameter(params.empty() ? std::string_view() : params[0], -1, space))
+		return;
+
+	u64 period = 8, window = 1, pagebits = 4;
+	if (params.size() > 1 && !m_console.validate_number_parameter(params[1], period))
+		return;
+	if (params.size() > 2 && !m_console.validate_number_parameter(params[2], window))
+		return;
+	if (params.size() > 3 && !m_console.validate_number_parameter(params[3], pagebits))
+		return;
+
+	memory_profiler &profiler = m_machine.memory().profiler();
+	profiler.start(*space, u32(std::min<u64>(period, 1000)), u32(std::min<u64>(window, 1000)), u8(std::min<u64>(pagebits, 32)));
+	m_console.printf("Profiling '%s' space %s, %d of every %d frames, %d-bit pages\n",
+			space->device().tag(), space->name(), std::min<u64>(window, period ? period : 1), period ? period : 1, profiler.page_bits(*space));
+}
+
+
+/*-------------------------------------------------
+    execute_memprofclear - stop sampling one or
+    all address spaces
+-------------------------------------------------*/
+
+void debugger_commands::execute_memprofclear(const std::vector<std::string_view> &params)
+{
+	memory_profiler &profiler = m_machine.memory().profiler();
+	if (params.empty())
+	{
+		profiler.stop_all();
+		m_console.printf("Stopped all memory profiling\n");
+		return;
+	}
+
+	address_space *space;
+	if (!m_console.validate_device_space_parameter(params[0], -1, space))
+		return;
+	profiler.stop(*space);
+	m_console.printf("Stopped profiling '%s' space %s\n", space->device().tag(), space->name());
+}
+
+
+/*-------------------------------------------------
+    execute_memproflist - list the busiest
+    handlers of the profiled address spaces
+-------------------------------------------------*/
+
+void debugger_commands::execute_memproflist(const std::vector<std::string_view> &params)
+{
+	memory_profiler &profiler = m_machine.memory().profiler();
+	std::vector<address_space *> spaces;
+	if (!params.empty() && !params[0].empty())
+	{
+		address_space *space;
+		if (!m_console.validate_device_space_parameter(params[0], -1, space))
+			return;
+		if (!profiler.profiling(*space))
+		{
+			m_console.printf("'%s' space %s is not being profiled\n", space->device().tag(), space->name());
+			return;
+		}
+		spaces.emplace_back(space);
+	}
+	else
+	{
+		spaces = profiler.spaces();
+		if (spaces.empty())
+		{
+			m_console.printf("No address spaces are being profiled\n");
+			return;
+		}
+	}
+
+	u64 count = 16;
+	if (params.size() > 1 && !m_console.validate_number_parameter(params[1], count))
+		return;
+
+	for (address_space *space : spaces)
+	{
+		u64 const frames = profiler.sampled_frames(*space);
+		m_console.printf("'%s' space %s, %d sampled frames:\n", space->device().tag(), space->name(), frames);
+
+		std::vector<memory_profiler::handler_counts> const handlers = profiler.handlers(*space);
+		u64 total = 0;
+		for (auto const &handler : handlers)
+			total += handler.m_reads + handler.m_writes;
+
+		u64 shown = 0;
+		for (auto const &handler : handlers)
+		{
+			if (shown++ == count)
+				break;
+			u64 const accesses = handler.m_reads + handler.m_writes;
+			m_console.printf("  %5.1f%% %12d reads %12d writes  %0*X-%0*X  %s\n",
+					total ? 100.0 * double(accesses) / double(total) : 0.0,
+					handler.m_reads, handler.m_writes,
+					space->addrchars(), handler.m_start, space->addrchars(), handler.m_end,
+					handler.m_name);
+		}
+	}
+}
+
+
+/*-------------------------------------------------
+    execute_pcprof - start sampling the PCs of
+    all CPUs
+-------------------------------------------------*/
+
+void debugger_commands::execute_pcprof(const std::vector<std::string_view> &params)
+{
+	u64 period = 100, bucketbits = 0;
+	if (!params.empty() && !m_console.validate_number_parameter(params[0], period))
+		return;
+	if (params.size() > 1 && !m_console.validate_number_parameter(params[1], bucketbits))
+		return;
+
+	pc_profiler &profiler = m_machine.scheduler().profiler();
+	profiler.start(attotime::from_usec(std::clamp<u64>(period, 1, 1'000'000)), u8(std::min<u64>(bucketbits, 31)));
+	m_console.printf("Sampling CPU PCs every %d microseconds, %d-bit buckets\n", std::clamp<u64>(period, 1, 1'000'000), profiler.bucket_bits());
+}
+
+
+/*-------------------------------------------------
+    execute_pcprofclear - stop sampling PCs and
+    discard the counts
+-------------------------------------------------*/
+
+void debugger_commands::execute_pcprofclear(const std::vector<std::string_view> &params)
+{
+	pc_profiler &profiler = m_machine.scheduler().profiler();
+	profiler.stop();
+	profiler.reset();
+	m_console.printf("Stopped PC sampling\n");
+}
+
+
+/*-------------------------------------------------
+    execute_pcproflist - list the busiest
+    addresses seen while sampling PCs
+-------------------------------------------------*/
+
+void debugger_commands::execute_pcproflist(const std::vector<std::string_view> &params)
+{
+	pc_profiler &profiler = m_machine.scheduler().profiler();
+	std::vector<device_t *> cpus;
+	if (!params.empty() && !params[0].empty())
+	{
+		device_t *cpu;
+		if (!m_console.validate_cpu_parameter(params[0], cpu))
+			return;
+		cpus.emplace_back(cpu);
+	}
+	else
+	{
+		cpus = profiler.devices();
+	}
+
+	u64 count = 16;
+	if (params.size() > 1 && !m_console.validate_number_parameter(params[1], count))
+		return;
+
+	if (!profiler.ticks())
+	{
+		m_console.printf("No PC samples have been taken\n");
+		return;
+	}
+
+	for (device_t *cpu : cpus)
+	{
+		u64 const samples = profiler.samples(*cpu);
+		m_console.printf("'%s', %d samples running, %d suspended:\n", cpu->tag(), samples, profiler.suspended(*cpu));
+
+		int addrchars = 8;
+		device_memory_interface *memory;
+		if (cpu->interface(memory) && memory->has_space(AS_PROGRAM))
+			addrchars = memory->space(AS_PROGRAM).logaddrchars();
+
+		u64 shown = 0;
+		for (auto const &entry : profiler.counts(*cpu))
+		{
+			if (shown++ == count)
+				break;
+			m_console.printf("  %5.1f%% %12d  %0*X-%0*X  %s\n",
+					samples ? 100.0 * double(entry.m_count) / double(samples) : 0.0,
+					entry.m_count,
+					addrchars, entry.m_start, addrchars, entry.m_end,
+					entry.m_name);
+		}
+	}
+}
+
+
+/*-------------------------------------------------
+    execute_pcprofrange - name a range of
+    addresses for PC sampling
+-------------------------------------------------*/
+
+void debugger_commands::execute_pcprofrange(const std::vector<std::string_view> &params)
+{
+	device_t *cpu;
+	if (!m_console.validate_cpu_parameter(params[0], cpu))
+		return;
+
+	u64 start, end;
+	if (!m_console.validate_number_parameter(params[1], start) || !m_console.validate_number_parameter(params[2], end))
+		return;
+
+	if (!m_machine.scheduler().profiler().add_range(*cpu, offs_t(start), offs_t(end), std::string(params[3])))
+		m_console.printf("Cannot name range %X-%X on '%s'\n", start, end, cpu->tag());
+	else
+		m_console.printf("Named %X-%X on '%s' as %s\n", start, end, cpu->tag(), params[3]);
+}
+
+
+/*-------------------------------------------------
+    execute_pcprofsave - write PC samples as
+    folded stacks
+-------------------------------------------------*/
+
+void debugger_commands::execute_pcprofsave(const std::vector<std::string_view> &params)
+{
+	std::string const filename(params[0]);
+	std::ofstream f(filename);
+	if (!f.good())
+	{
+		m_console.printf("Error opening file '%s'\n", params[0]);
+		return;
+	}
+
+	m_machine.scheduler().profiler().write_folded(f);
+	m_console.printf("PC samples written to %s\n", filename);
+}
+
+
+/*-------------------------------------------------
+    execute_vtlbstats - show the virtual TLB
+    counters for a CPU
+-------------------------------------------------*/
+
+void debugger_commands::execute_vtlbstats(const std::vector<std::string_view> &params)
+{
+	device_t *cpu;
+	if (!m_console.validate_cpu_parameter(params.empty() ? std::string_view() : params[0], cpu))
+		return;
+
+	bool clear = false;
+	if (params.size() > 1 && !m_console.validate_boolean_parameter(params[1], clear))
+		return;
+
+	device_vtlb_interface *vtlb;
+	if (!cpu->interface(vtlb))
+	{
+		m_console.printf("Device '%s' has no virtual TLB\n", cpu->tag());
+		return;
+	}
+
+	device_vtlb_interface::vtlb_stats const &stats = vtlb->vtlb_statistics();
+	m_console.printf("'%s' virtual TLB, %d dynamic and %d fixed entries:\n", cpu->tag(), vtlb->vtlb_dynamic_entries(), vtlb->vtlb_fixed_entries());
+	m_console.printf("  %12d fills\n", stats.m_fills);
+	m_console.printf("  %12d evictions\n", stats.m_evictions);
+	m_console.printf("  %12d fixed entry loads\n", stats.m_loads);
+	m_console.printf("  %12d full flushes\n", stats.m_flushes);
+	m_console.printf("  %12d page flushes\n", stats.m_address_flushes);
+	if (clear)
+		vtlb->vtlb_reset_statistics();
+}
+
+
 /*-------------------------------------------------
     execute_symlist - execute the symlist command
 -------------------------------------------------*/
@@ -152,6 +152,16 @@ private:
 	void execute_source(const std::vector<std::string_view> &params);
 	void execute_map(int spacenum, const std::vector<std::string_view> &params);
 	void execute_memdump(const std::vector<std::string_view> &params);
+	void execute_memreport(const std::vector<std::string_view> &params);
+	void execute_memprof(const std::vector<std::string_view> &params);
+	void execute_memprofclear(const std::vector<std::string_view> &params);
+	void execute_memproflist(const std::vector<std::string_view> &params);
+	void execute_pcprof(const std::vector<std::string_view> &params);
+	void execute_pcprofclear(const std::vector<std::string_view> &params);
+	void execute_pcproflist(const std::vector<std::string_view> &params);
+	void execute_pcprofrange(const std::vector<std::string_view> &params);
+	void execute_pcprofsave(const std::vector<std::string_view> &params);
+	void execute_vtlbstats(const std::vector<std::string_view> &params);
 	void execute_symlist(const std::vector<std::string_view> &params);
 	void execute_softreset(const std::vector<std::string_view> &params);
 	void execute_hardreset(const std::vector<std::string_view> &params);
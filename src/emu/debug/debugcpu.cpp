@@ -439,6 +439,7 @@ device_debug::device_debug(device_t &device)
 	, m_pc_history_index(0)
 	, m_pc_history_valid(0)
 	, m_bplist()
+	, m_bpfilter()
 	, m_rplist()
 	, m_eplist()
 	, m_triggered_breakpoint(nullptr)
@@ -1735,14 +1736,14 @@ u32 device_debug::compute_opcode_crc32(offs_t pc) const
 //  trace - trace execution of a given device
 //-------------------------------------------------
 
-void device_debug::trace(std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action)
+void device_debug::trace(std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, bool binary, std::string_view action)
 {
 	// delete any existing tracers
 	m_trace = nullptr;
 
 	// if we have a new file, make a new tracer
 	if (file != nullptr)
-		m_trace = std::make_unique<tracer>(*this, std::move(file), trace_over, detect_loops, logerror, action);
+		m_trace = std::make_unique<tracer>(*this, std::move(file), trace_over, detect_loops, logerror, binary, action);
 }
 
 
@@ -1859,6 +1860,15 @@ void device_debug::prepare_for_step_overout(offs_t pc)
 
 void device_debug::breakpoint_update_flags()
 {
+	// rebuild the address filter; disabled breakpoints are included
+	// since they can be re-enabled without coming through here
+	m_bpfilter.fill(0);
+	for (auto &bpp : m_bplist)
+	{
+		u32 const bit = breakpoint_filter_bit(bpp.first);
+		m_bpfilter[bit / 64] |= u64(1) << (bit % 64);
+	}
+
 	// see if there are any enabled breakpoints
 	m_flags &= ~DEBUG_FLAG_LIVE_BP;
 	for (auto &bpp : m_bplist)
@@ -1896,8 +1906,9 @@ void device_debug::breakpoint_check(offs_t pc)
 {
 	debugger_cpu& debugcpu = m_device.machine().debugger().cpu();
 
-	// see if we match
-	auto bpitp = m_bplist.equal_range(pc);
+	// see if we match, skipping the search for most addresses
+	u32 const bit = breakpoint_filter_bit(pc);
+	auto bpitp = BIT(m_bpfilter[bit / 64], bit % 64) ? m_bplist.equal_range(pc) : std::make_pair(m_bplist.end(), m_bplist.end());
 	for (auto bpit = bpitp.first; bpit != bpitp.second; ++bpit)
 	{
 		debug_breakpoint &bp = *bpit->second;
@@ -1954,7 +1965,7 @@ void device_debug::breakpoint_check(offs_t pc)
 //  tracer - constructor
 //-------------------------------------------------
 
-device_debug::tracer::tracer(device_debug &debug, std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action)
+device_debug::tracer::tracer(device_debug &debug, std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, bool binary, std::string_view action)
 	: m_debug(debug)
 	, m_file(std::move(file))
 	, m_action(action)
@@ -1964,8 +1975,20 @@ device_debug::tracer::tracer(device_debug &debug, std::unique_ptr<std::ostream>
 	, m_nextdex(0)
 	, m_trace_over(trace_over)
 	, m_trace_over_target(~0)
+	, m_binary(binary)
+	, m_last_cycles(debug.m_total_cycles)
+	, m_exit(false)
 {
 	memset(m_history, 0, sizeof(m_history));
+
+	// binary traces are collected in memory and written out by a worker thread
+	if (m_binary)
+	{
+		m_buffer.reserve(BINARY_BUFFER_SIZE + 256);
+		m_writing.reserve(BINARY_BUFFER_SIZE + 256);
+		binary_header();
+		m_writer = std::thread([this] () { binary_writer(); });
+	}
 }
 
 
@@ -1975,6 +1998,23 @@ device_debug::tracer::tracer(device_debug &debug, std::unique_ptr<std::ostream>
 
 device_debug::tracer::~tracer()
 {
+	// drain any pending binary records and stop the writer
+	if (m_binary)
+	{
+		if (m_loops != 0)
+		{
+			m_buffer.push_back(RECORD_LOOPS);
+			binary_varint(m_loops);
+		}
+		binary_commit(true);
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_exit = true;
+		}
+		m_cv.notify_all();
+		m_writer.join();
+	}
+
 	// make sure we close the file if we can
 	m_file.reset();
 }
@@ -2012,7 +2052,17 @@ void device_debug::tracer::update(offs_t pc)
 
 		// if we just finished looping, indicate as much
 		if (m_loops != 0)
-			util::stream_format(*m_file, "\n   (loops for %d instructions)\n\n", m_loops);
+		{
+			if (m_binary)
+			{
+				m_buffer.push_back(RECORD_LOOPS);
+				binary_varint(m_loops);
+			}
+			else
+			{
+				util::stream_format(*m_file, "\n   (loops for %d instructions)\n\n", m_loops);
+			}
+		}
 		m_loops = 0;
 	}
 
@@ -2021,13 +2071,29 @@ void device_debug::tracer::update(offs_t pc)
 		m_debug.m_device.machine().debugger().console().execute_command(m_action, false);
 
 	debug_disasm_buffer buffer(m_debug.device());
-	std::string instruction;
-	offs_t next_pc, size;
 	u32 dasmresult;
-	buffer.disassemble(pc, instruction, next_pc, size, dasmresult);
+	if (m_binary)
+	{
+		// record the raw opcode bytes; disassembly is left to the reader
+		dasmresult = buffer.disassemble_info(pc);
+		buffer.data_get(pc, dasmresult & util::disasm_interface::LENGTHMASK, true, m_opcodes);
+
+		m_buffer.push_back(RECORD_INSTRUCTION);
+		binary_varint(pc);
+		binary_varint(m_debug.m_total_cycles - m_last_cycles);
+		binary_varint(m_opcodes.size());
+		m_buffer.insert(m_buffer.end(), m_opcodes.begin(), m_opcodes.end());
+		m_last_cycles = m_debug.m_total_cycles;
+	}
+	else
+	{
+		std::string instruction;
+		offs_t next_pc, size;
+		buffer.disassemble(pc, instruction, next_pc, size, dasmresult);
 
-	// output the result
-	util::stream_format(*m_file, "%s: %s\n", buffer.pc_to_string(pc), instruction);
+		// output the result
+		util::stream_format(*m_file, "%s: %s\n", buffer.pc_to_string(pc), instruction);
+	}
 
 	// do we need to step the trace over this instruction?
 	if (m_trace_over && (dasmresult & util::disasm_interface::SUPPORTED) != 0 && (dasmresult & util::disasm_interface::STEP_OVER) != 0)
@@ -2045,7 +2111,10 @@ void device_debug::tracer::update(offs_t pc)
 	// log this PC
 	m_nextdex = (m_nextdex + 1) % TRACE_LOOPS;
 	m_history[m_nextdex] = pc;
-	m_file->flush();
+	if (!m_binary)
+		m_file->flush();
+	else if (m_buffer.size() >= BINARY_BUFFER_SIZE)
+		binary_commit(false);
 }
 
 
@@ -2062,6 +2131,20 @@ void device_debug::tracer::interrupt_update(int irqline, offs_t pc)
 		m_trace_over_target = pc;
 	}
 
+	if (m_binary)
+	{
+		if (m_detect_loops && m_loops != 0)
+		{
+			m_buffer.push_back(RECORD_LOOPS);
+			binary_varint(m_loops);
+			m_loops = 0;
+		}
+		m_buffer.push_back(RECORD_INTERRUPT);
+		binary_varint(pc);
+		binary_varint(irqline);
+		return;
+	}
+
 	// if we just finished looping, indicate as much
 	*m_file << "\n";
 	if (m_detect_loops && m_loops != 0)
@@ -2081,6 +2164,16 @@ void device_debug::tracer::interrupt_update(int irqline, offs_t pc)
 
 void device_debug::tracer::vprintf(util::format_argument_pack<char> const &args)
 {
+	if (m_binary)
+	{
+		// store the formatted text as a record of its own
+		std::string const text(util::string_format(args));
+		m_buffer.push_back(RECORD_TEXT);
+		binary_varint(text.length());
+		m_buffer.insert(m_buffer.end(), text.begin(), text.end());
+		return;
+	}
+
 	// pass through to the file
 	util::stream_format(*m_file, args);
 	m_file->flush();
@@ -2094,7 +2187,104 @@ void device_debug::tracer::vprintf(util::format_argument_pack<char> const &args)
 
 void device_debug::tracer::flush()
 {
-	m_file->flush();
+	if (m_binary)
+		binary_commit(true);
+	else
+		m_file->flush();
+}
+
+
+//-------------------------------------------------
+//  binary_header - write the identifying header
+//  at the start of a binary trace
+//-------------------------------------------------
+
+void device_debug::tracer::binary_header()
+{
+	// the reader needs to know which disassembler to use and how PCs map to bytes
+	device_t &device = m_debug.device();
+	address_space_config const *config = nullptr;
+	device_memory_interface *memory;
+	if (device.interface(memory))
+	{
+		config = memory->space_config(AS_OPCODES);
+		if (!config)
+			config = memory->space_config(AS_PROGRAM);
+	}
+
+	static char const magic[8] = { 'M', 'A', 'M', 'E', 'T', 'R', 'C', '\x1a' };
+	m_buffer.insert(m_buffer.end(), std::begin(magic), std::end(magic));
+	m_buffer.push_back(1); // format version
+	m_buffer.push_back(config ? config->addr_width() : 0);
+	m_buffer.push_back(config ? config->data_width() : 0);
+	m_buffer.push_back(config ? u8(config->addr_shift()) : 0);
+	m_buffer.push_back((config && config->endianness() == ENDIANNESS_BIG) ? 1 : 0);
+	for (std::string_view str : { std::string_view(device.shortname()), std::string_view(device.tag()) })
+	{
+		binary_varint(str.length());
+		m_buffer.insert(m_buffer.end(), str.begin(), str.end());
+	}
+}
+
+
+//-------------------------------------------------
+//  binary_varint - append an unsigned LEB128
+//  value to the record buffer
+//-------------------------------------------------
+
+void device_debug::tracer::binary_varint(u64 value)
+{
+	while (value >= 0x80)
+	{
+		m_buffer.push_back(u8(value) | 0x80);
+		value >>= 7;
+	}
+	m_buffer.push_back(u8(value));
+}
+
+
+//-------------------------------------------------
+//  binary_commit - hand the collected records to
+//  the writer thread, optionally waiting until
+//  they reach the file
+//-------------------------------------------------
+
+void device_debug::tracer::binary_commit(bool wait)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_cv.wait(lock, [this] () { return m_writing.empty(); });
+	if (!m_buffer.empty())
+	{
+		m_writing.swap(m_buffer);
+		m_cv.notify_all();
+		if (wait)
+			m_cv.wait(lock, [this] () { return m_writing.empty(); });
+	}
+}
+
+
+//-------------------------------------------------
+//  binary_writer - writer thread body
+//-------------------------------------------------
+
+void device_debug::tracer::binary_writer()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true)
+	{
+		m_cv.wait(lock, [this] () { return m_exit || !m_writing.empty(); });
+		if (m_writing.empty())
+			break;
+
+		// the emulation thread only touches m_writing once it is empty again
+		lock.unlock();
+		m_file->write(reinterpret_cast<char const *>(m_writing.data()), m_writing.size());
+		m_file->flush();
+		lock.lock();
+
+		m_writing.clear();
+		m_cv.notify_all();
+	}
 }
 
 
@@ -13,8 +13,13 @@
 
 #pragma once
 
+#include <array>
+#include <condition_variable>
+#include <mutex>
 #include <set>
+#include <thread>
 #include <utility>
+#include <vector>
 
 
 //**************************************************************************
@@ -149,7 +154,7 @@ public:
 	void track_mem_data_clear() { m_track_mem_set.clear(); }
 
 	// tracing
-	void trace(std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action);
+	void trace(std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, bool binary, std::string_view action);
 	template <typename Format, typename... Params> void trace_printf(Format &&fmt, Params &&...args)
 	{
 		if (m_trace != nullptr)
@@ -174,6 +179,7 @@ private:
 	// breakpoint and watchpoint helpers
 	void breakpoint_update_flags();
 	void breakpoint_check(offs_t pc);
+	static constexpr u32 breakpoint_filter_bit(offs_t pc) { return (pc ^ (pc >> 16)) & (BREAKPOINT_FILTER_BITS - 1); }
 	void reinstall_all(read_or_write mode);
 	void reinstall(address_space &space, read_or_write mode);
 	void write_tracking(address_space &space, offs_t address, u64 data);
@@ -212,6 +218,8 @@ private:
 
 	// breakpoints and watchpoints
 	std::multimap<offs_t, std::unique_ptr<debug_breakpoint>> m_bplist;     // list of breakpoints
+	static constexpr u32 BREAKPOINT_FILTER_BITS = 0x10000;
+	std::array<u64, BREAKPOINT_FILTER_BITS / 64> m_bpfilter;               // hashed breakpoint addresses, for quickly rejecting PCs
 	std::vector<std::vector<std::unique_ptr<debug_watchpoint>>> m_wplist;  // watchpoint lists for each address space
 	std::forward_list<debug_registerpoint> m_rplist;                       // list of registerpoints
 	std::multimap<offs_t, std::unique_ptr<debug_exceptionpoint>> m_eplist; // list of exception points
@@ -223,7 +231,7 @@ private:
 	class tracer
 	{
 	public:
-		tracer(device_debug &debug, std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action);
+		tracer(device_debug &debug, std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, bool binary, std::string_view action);
 		~tracer();
 
 		void update(offs_t pc);
@@ -234,6 +242,21 @@ private:
 
 	private:
 		static const int TRACE_LOOPS = 64;
+		static constexpr size_t BINARY_BUFFER_SIZE = 0x10000;
+
+		// binary trace record types
+		enum : u8
+		{
+			RECORD_INSTRUCTION = 0,                     // PC, cycle delta, opcode bytes
+			RECORD_INTERRUPT,                           // PC, IRQ line
+			RECORD_LOOPS,                               // instruction count
+			RECORD_TEXT                                 // tracelog/logerror output
+		};
+
+		void binary_header();
+		void binary_varint(u64 value);
+		void binary_commit(bool wait);
+		void binary_writer();
 
 		device_debug &      m_debug;                    // reference to our owner
 		std::unique_ptr<std::ostream> m_file;           // tracing file for this CPU
@@ -247,6 +270,17 @@ private:
 		offs_t              m_trace_over_target;        // target for tracing over
 														//    (0 = not tracing over,
 														//    ~0 = not currently tracing over)
+
+		// binary tracing
+		bool                m_binary;                   // true if writing compact binary records
+		u64                 m_last_cycles;              // total cycles at the last instruction record
+		std::vector<u8>     m_opcodes;                  // scratch buffer for opcode bytes
+		std::vector<u8>     m_buffer;                   // records being collected
+		std::vector<u8>     m_writing;                  // records handed to the writer thread
+		std::mutex          m_mutex;                    // protects m_writing and m_exit
+		std::condition_variable m_cv;                   // signals the writer thread and its completion
+		bool                m_exit;                     // tells the writer thread to finish
+		std::thread         m_writer;                   // writes completed buffers to the file
 	};
 	std::unique_ptr<tracer>                m_trace;     // tracer state
 
@@ -123,6 +123,16 @@ const help_item f_static_help_list[] =
 		"  mapi <address>[:<space>] -- map logical I/O address to physical address and bank\n"
 		"  mapo <address>[:<space>] -- map logical opcode address to physical address and bank\n"
 		"  memdump [<filename>,[<root>]] -- dump current memory maps to <filename>\n"
+		"  memreport [<count>] -- show the memory footprint by subsystem and the <count> largest allocations\n"
+		"  memprof [<space>[,<period>[,<window>[,<pagebits>]]]] -- sample accesses to <space>\n"
+		"  memprofclear [<space>] -- stop sampling <space>, or all spaces\n"
+		"  memproflist [<space>[,<count>]] -- list the <count> busiest handlers seen while sampling\n"
+		"  pcprof [<period>[,<bucketbits>]] -- sample the PC of every CPU every <period> microseconds\n"
+		"  pcprofclear -- stop sampling PCs and discard the counts\n"
+		"  pcproflist [<CPU>[,<count>]] -- list the <count> busiest addresses seen while sampling PCs\n"
+		"  pcprofrange <CPU>,<start>,<end>,<name> -- name an address range for PC sampling\n"
+		"  pcprofsave <filename> -- write PC samples to <filename> as folded stacks\n"
+		"  vtlbstats [<CPU>[,<clear>]] -- show virtual TLB activity for <CPU>\n"
 	},
 	{
 		"execution",
@@ -1171,7 +1181,7 @@ const help_item f_static_help_list[] =
 	{
 		"trace",
 		"\n"
-		"  trace {<filename>|off}[,<CPU>[,[noloop|logerror][,<action>]]]\n"
+		"  trace {<filename>|off}[,<CPU>[,[noloop|logerror|binary][,<action>]]]\n"
 		"\n"
 		"Starts or stops tracing of the execution of the specified <CPU>, or the currently visible "
 		"CPU if no CPU is specified.  To enable tracing, specify the trace log file name in the "
@@ -1179,11 +1189,15 @@ const help_item f_static_help_list[] =
 		"parameter.  If the **<filename>** begins with two right angle brackets (>>), it is treated "
 		"as a directive to open the file for appending rather than overwriting.\n"
 		"\n"
-		"The optional third parameter is a flags field.  The supported flags are 'noloop' and "
-		"'logerror'.  Multiple flags must be separated by | (pipe) characters.  By default, loops "
-		"are detected and condensed to a single line.  If the 'noloop' flag is specified, loops "
-		"will not be detected and every instruction will be logged as executed.  If the 'logerror' "
-		"flag is specified, error log output will be included in the trace log.\n"
+		"The optional third parameter is a flags field.  The supported flags are 'noloop', "
+		"'logerror' and 'binary'.  Multiple flags must be separated by | (pipe) characters.  By "
+		"default, loops are detected and condensed to a single line.  If the 'noloop' flag is "
+		"specified, loops will not be detected and every instruction will be logged as executed.  "
+		"If the 'logerror' flag is specified, error log output will be included in the trace log.  "
+		"If the 'binary' flag is specified, the trace is written as compact binary records holding "
+		"the PC, elapsed cycles and raw opcode bytes of each instruction rather than as "
+		"disassembled text; records are buffered in memory and written to the file by a "
+		"background thread, so tracing has much less effect on emulation speed.\n"
 		"\n"
 		"The optional <action> parameter is a debugger command to execute before each trace message "
 		"is logged.  Generally, this will include a 'tracelog' or 'tracesym' command to include "
@@ -1211,6 +1225,10 @@ const help_item f_static_help_list[] =
 		"  Begin tracing the execution of CPU #0, logging output (along with logerror output) to "
 		"starswep.tr, with loop detection disabled.\n"
 		"\n"
+		"trace kungfum.trb,,binary|noloop\n"
+		"  Begin tracing the execution of the currently visible CPU, writing binary records for "
+		"every instruction executed to kungfum.trb.\n"
+		"\n"
 		"trace >>pigskin.tr\n"
 		"  Begin tracing execution of the currently visible CPU, appending log output to "
 		"pigskin.tr.\n"
@@ -1225,7 +1243,7 @@ const help_item f_static_help_list[] =
 	{
 		"traceover",
 		"\n"
-		"  traceover {<filename>|off}[,<CPU>[,[noloop|logerror][,<action>]]]\n"
+		"  traceover {<filename>|off}[,<CPU>[,[noloop|logerror|binary][,<action>]]]\n"
 		"\n"
 		"Starts or stops tracing for execution of the specified **<CPU>**, or the currently visible "
 		"CPU if no CPU is specified.  When a subroutine call is encountered, tracing will skip over "
@@ -1726,6 +1744,162 @@ const help_item f_static_help_list[] =
 		"memdump mylog.log,1\n"
 		"  Dumps memory maps for the CPU 1 and all its child devices to the file mylog.log.\n"
 	},
+	{
+		"memreport",
+		"\n"
+		"  memreport [<count>]\n"
+		"\n"
+		"Shows the memory held by each subsystem (regions, shares, decoded graphics, tilemaps, "
+		"sound streams, the rewind buffer, recompiler caches and the Lua heap), followed by the "
+		"<count> (16 if omitted) largest allocations and their owners.  Small objects aren't "
+		"counted, so the total is less than the size of the process.  The -memreport option "
+		"writes the same information to a file at exit.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"memreport\n"
+		"  Shows the totals for each subsystem and the 16 largest allocations.\n"
+		"\n"
+		"memreport 0\n"
+		"  Shows only the totals for each subsystem.\n"
+	},
+	{
+		"memprof",
+		"\n"
+		"  memprof [<space>[,<period>[,<window>[,<pagebits>]]]]\n"
+		"\n"
+		"Starts counting reads and writes to an address space, in pages of 2^<pagebits> addresses "
+		"(4 if omitted).  To keep the cost down, the counting tap is only present for the first "
+		"<window> frames of every <period> frames (1 of every 8 by default); use the same value for "
+		"both to count every frame.  Pages may be made larger so the space has at most 65536 of "
+		"them.  The space is given as a device and optional space name; if omitted, the first "
+		"address space of the currently visible CPU is used.  Starting an address space that is "
+		"already being profiled clears its counts.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"memprof\n"
+		"  Samples the first address space of the visible CPU one frame out of every eight.\n"
+		"\n"
+		"memprof maincpu:program,1,1,8\n"
+		"  Counts every access to the program space of ':maincpu' in 256-address pages.\n"
+	},
+	{
+		"memprofclear",
+		"\n"
+		"  memprofclear [<space>]\n"
+		"\n"
+		"Stops profiling the given address space and discards its counts, or stops profiling all "
+		"address spaces if none is given.\n"
+	},
+	{
+		"memproflist",
+		"\n"
+		"  memproflist [<space>[,<count>]]\n"
+		"\n"
+		"Lists the <count> (16 if omitted) handlers that received the most accesses while the "
+		"given address space, or every profiled address space, was sampled.  Each page's counts "
+		"are attributed to the handler at the start of the page, so use small pages where "
+		"handlers are packed closely together.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"memproflist\n"
+		"  Lists the 16 busiest handlers of every profiled address space.\n"
+		"\n"
+		"memproflist maincpu:program,40\n"
+		"  Lists the 40 busiest handlers of the program space of ':maincpu'.\n"
+	},
+	{
+		"pcprof",
+		"\n"
+		"  pcprof [<period>[,<bucketbits>]]\n"
+		"\n"
+		"Starts sampling the program counter of every CPU once every <period> microseconds of "
+		"emulated time (100 if omitted), counting samples in buckets of 2^<bucketbits> addresses "
+		"(0 if omitted, so every address is counted separately).  Sampling is driven by a timer, "
+		"so it adds no cost to each instruction, and it is also available from Lua scripts when "
+		"the debugger is not enabled.  CPUs that are suspended when a sample is taken are counted "
+		"separately.  Starting the profiler again discards the counts so far.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"pcprof\n"
+		"  Samples the PC of every CPU every 100 microseconds.\n"
+		"\n"
+		"pcprof 1000,4\n"
+		"  Samples the PC of every CPU every millisecond, in 16-address buckets.\n"
+	},
+	{
+		"pcprofclear",
+		"\n"
+		"  pcprofclear\n"
+		"\n"
+		"Stops sampling PCs and discards the counts.  Named ranges are kept.\n"
+	},
+	{
+		"pcproflist",
+		"\n"
+		"  pcproflist [<CPU>[,<count>]]\n"
+		"\n"
+		"Lists the <count> (16 if omitted) address buckets or named ranges where the given CPU, or "
+		"every CPU, was most often found while sampling PCs.  Buckets that fall inside a range "
+		"named with pcprofrange are summed into the range.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"pcproflist\n"
+		"  Lists the 16 busiest locations of every CPU.\n"
+		"\n"
+		"pcproflist audiocpu,40\n"
+		"  Lists the 40 busiest locations of ':audiocpu'.\n"
+	},
+	{
+		"pcprofrange",
+		"\n"
+		"  pcprofrange <CPU>,<start>,<end>,<name>\n"
+		"\n"
+		"Names the program addresses from <start> to <end> of <CPU> for PC sampling, so samples "
+		"that land in them are reported as <name> rather than by address.  Any named ranges the "
+		"new one overlaps are replaced.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"pcprofrange maincpu,1000,10ff,draw_sprites\n"
+		"  Reports samples of ':maincpu' from 1000 to 10ff as draw_sprites.\n"
+	},
+	{
+		"pcprofsave",
+		"\n"
+		"  pcprofsave <filename>\n"
+		"\n"
+		"Writes the PC samples to <filename> as folded stacks, with one line of the form "
+		"'<CPU>;<location> <count>' for each address bucket or named range.  The file can be "
+		"passed straight to flame graph tools.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"pcprofsave gradius.folded\n"
+		"  Writes the samples to gradius.folded.\n"
+	},
+	{
+		"vtlbstats",
+		"\n"
+		"  vtlbstats [<CPU>[,<clear>]]\n"
+		"\n"
+		"Shows how often the virtual TLB of a CPU had to be filled, how many filled entries were "
+		"pushed out to make room, and how often it was flushed.  Lookups that hit are not counted.  "
+		"If <CPU> is omitted, the currently visible CPU is used.  If <clear> is non-zero, the "
+		"counts are cleared after they are shown.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"vtlbstats\n"
+		"  Shows the virtual TLB activity of the visible CPU.\n"
+		"\n"
+		"vtlbstats maincpu,1\n"
+		"  Shows the virtual TLB activity of ':maincpu' and starts counting again.\n"
+	},
 	{
 		"comlist",
 		"\n"
@@ -101,6 +101,63 @@ enum
 	TVL_EXECUTEFUNC
 };
 
+// compiled_op.opcode values in addition to operators
+enum
+{
+	CVL_NUMBER = 0x80,
+	CVL_SYMBOL
+};
+
+
+//-------------------------------------------------
+//  unary_op - apply a unary operator to a value
+//-------------------------------------------------
+
+inline u64 unary_op(u8 optype, u64 value)
+{
+	switch (optype)
+	{
+	case TVL_COMPLEMENT:    return !value;
+	case TVL_NOT:           return ~value;
+	case TVL_UMINUS:        return -value;
+	default:                return value;
+	}
+}
+
+
+//-------------------------------------------------
+//  binary_op - apply a binary operator to two
+//  values; division by zero is checked by the
+//  caller
+//-------------------------------------------------
+
+inline u64 binary_op(u8 optype, u64 lhs, u64 rhs)
+{
+	switch (optype)
+	{
+	case TVL_MULTIPLY:          return lhs * rhs;
+	case TVL_DIVIDE:            return lhs / rhs;
+	case TVL_MODULO:            return lhs % rhs;
+	case TVL_ADD:               return lhs + rhs;
+	case TVL_SUBTRACT:          return lhs - rhs;
+	case TVL_LSHIFT:            return lhs << rhs;
+	case TVL_RSHIFT:            return lhs >> rhs;
+	case TVL_LESS:              return lhs < rhs;
+	case TVL_LESSOREQUAL:       return lhs <= rhs;
+	case TVL_GREATER:           return lhs > rhs;
+	case TVL_GREATEROREQUAL:    return lhs >= rhs;
+	case TVL_EQUAL:             return lhs == rhs;
+	case TVL_NOTEQUAL:          return lhs != rhs;
+	case TVL_BAND:              return lhs & rhs;
+	case TVL_BXOR:              return lhs ^ rhs;
+	case TVL_BOR:               return lhs | rhs;
+	case TVL_LAND:              return lhs && rhs;
+	case TVL_LOR:               return lhs || rhs;
+	case TVL_COMMA:             return rhs;
+	default:                    return 0;
+	}
+}
+
 
 
 //**************************************************************************
@@ -1017,12 +1074,14 @@ expression_error::error_code symbol_table::memory_valid(const char *name, expres
 parsed_expression::parsed_expression(symbol_table &symtable)
 	: m_symtable(symtable)
 	, m_default_base(16)
+	, m_compile_attempted(false)
 {
 }
 
 parsed_expression::parsed_expression(symbol_table &symtable, std::string_view expression, int default_base)
 	: m_symtable(symtable)
 	, m_default_base(default_base)
+	, m_compile_attempted(false)
 {
 	assert(default_base == 8 || default_base == 10 || default_base == 16);
 
@@ -1038,6 +1097,7 @@ parsed_expression::parsed_expression(const parsed_expression &src)
 	: m_symtable(src.m_symtable)
 	, m_default_base(src.m_default_base)
 	, m_original_string(src.m_original_string)
+	, m_compile_attempted(false)
 {
 	if (!m_original_string.empty())
 		parse_string_into_tokens();
@@ -1054,6 +1114,8 @@ void parsed_expression::parse(std::string_view expression)
 	m_original_string.assign(expression);
 	m_tokenlist.clear();
 	m_stringlist.clear();
+	m_compiled.clear();
+	m_compile_attempted = false;
 
 	// first parse the tokens into the token array in order
 	parse_string_into_tokens();
@@ -1072,6 +1134,8 @@ void parsed_expression::copy(const parsed_expression &src)
 	m_symtable = src.m_symtable;
 	m_default_base = src.m_default_base;
 	m_original_string.assign(src.m_original_string);
+	m_compiled.clear();
+	m_compile_attempted = false;
 	if (!m_original_string.empty())
 		parse_string_into_tokens();
 }
@@ -2146,6 +2210,199 @@ u64 parsed_expression::execute_tokens()
 
 
 
+//-------------------------------------------------
+//  compile - convert the postfix token list into
+//  a flat program over a value stack, resolving
+//  constant subexpressions; anything that needs
+//  lvals, strings or functions, or more than one
+//  memory read with side effects (which must
+//  happen in operand pop order) is left to the
+//  interpreter
+//-------------------------------------------------
+
+void parsed_expression::compile()
+{
+	m_compile_attempted = true;
+	m_compiled.clear();
+
+	std::vector<compiled_op> program;
+	std::vector<int> offsets;
+	std::size_t maxdepth = 0;
+	int side_effect_reads = 0;
+	auto const is_constant = [&program] (std::size_t count)
+			{
+				if (program.size() < count)
+					return false;
+				for (std::size_t i = program.size() - count; program.size() > i; ++i)
+					if (program[i].opcode != CVL_NUMBER)
+						return false;
+				return true;
+			};
+	auto const add = [&program] (u8 opcode, int offset)
+			{
+				compiled_op &op(program.emplace_back());
+				op.opcode = opcode;
+				op.offset = offset;
+				op.value = 0;
+				op.symbol = nullptr;
+				return std::ref(op);
+			};
+
+	for (parse_token &token : m_tokenlist)
+	{
+		if (token.is_number())
+		{
+			add(CVL_NUMBER, token.offset()).get().value = token.value();
+			offsets.push_back(token.offset());
+		}
+		else if (token.is_symbol())
+		{
+			if (token.symbol().is_function())
+				return;
+			add(CVL_SYMBOL, token.offset()).get().symbol = &token.symbol();
+			offsets.push_back(token.offset());
+		}
+		else if (!token.is_operator())
+		{
+			return;
+		}
+		else
+		{
+			u8 const optype = token.optype();
+			switch (optype)
+			{
+			case TVL_COMPLEMENT:
+			case TVL_NOT:
+			case TVL_UPLUS:
+			case TVL_UMINUS:
+				if (offsets.empty())
+					return;
+				if (is_constant(1))
+					program.back().value = unary_op(optype, program.back().value);
+				else
+					add(optype, offsets.back());
+				break;
+
+			case TVL_COMMA:
+				if (token.is_function_separator())
+					return;
+				[[fallthrough]];
+			case TVL_MULTIPLY:
+			case TVL_DIVIDE:
+			case TVL_MODULO:
+			case TVL_ADD:
+			case TVL_SUBTRACT:
+			case TVL_LSHIFT:
+			case TVL_RSHIFT:
+			case TVL_LESS:
+			case TVL_LESSOREQUAL:
+			case TVL_GREATER:
+			case TVL_GREATEROREQUAL:
+			case TVL_EQUAL:
+			case TVL_NOTEQUAL:
+			case TVL_BAND:
+			case TVL_BXOR:
+			case TVL_BOR:
+			case TVL_LAND:
+			case TVL_LOR:
+				{
+					if (offsets.size() < 2)
+						return;
+					int const rhsoffset = offsets.back();
+					offsets.pop_back();
+					int const offset = (TVL_COMMA == optype) ? rhsoffset : std::min(offsets.back(), rhsoffset);
+					bool const divide = (TVL_DIVIDE == optype) || (TVL_MODULO == optype);
+					if (is_constant(2) && (!divide || program.back().value))
+					{
+						u64 const rhs = program.back().value;
+						program.pop_back();
+						program.back().value = binary_op(optype, program.back().value, rhs);
+						program.back().offset = offset;
+					}
+					else
+					{
+						add(optype, divide ? rhsoffset : offset);
+					}
+					offsets.back() = offset;
+				}
+				break;
+
+			case TVL_MEMORYAT:
+				if (offsets.empty())
+					return;
+				if (!token.memory_side_effects() && (++side_effect_reads > 1))
+					return;
+				add(TVL_MEMORYAT, offsets.back()).get().memory = token;
+				break;
+
+			default:
+				// lvals, functions and anything unexpected
+				return;
+			}
+		}
+		maxdepth = std::max(maxdepth, offsets.size());
+	}
+
+	// the result must be a single value
+	if (offsets.size() != 1)
+		return;
+
+	m_compiled = std::move(program);
+	m_compiled_stack.resize(maxdepth);
+}
+
+
+//-------------------------------------------------
+//  execute_compiled - run the compiled form of
+//  the expression
+//-------------------------------------------------
+
+u64 parsed_expression::execute_compiled()
+{
+	u64 *sp = m_compiled_stack.data();
+	for (compiled_op &op : m_compiled)
+	{
+		switch (op.opcode)
+		{
+		case CVL_NUMBER:
+			*sp++ = op.value;
+			break;
+
+		case CVL_SYMBOL:
+			*sp++ = op.symbol->value();
+			break;
+
+		case TVL_MEMORYAT:
+			{
+				parse_token memory;
+				memory.configure_memory(sp[-1], op.memory);
+				sp[-1] = memory.get_lval_value(m_symtable);
+			}
+			break;
+
+		case TVL_COMPLEMENT:
+		case TVL_NOT:
+		case TVL_UPLUS:
+		case TVL_UMINUS:
+			sp[-1] = unary_op(op.opcode, sp[-1]);
+			break;
+
+		case TVL_DIVIDE:
+		case TVL_MODULO:
+			if (!sp[-1])
+				throw expression_error(expression_error::DIVIDE_BY_ZERO, op.offset);
+			[[fallthrough]];
+		default:
+			--sp;
+			sp[-1] = binary_op(op.opcode, sp[-1], sp[0]);
+			break;
+		}
+	}
+	return m_compiled_stack[0];
+}
+
+
+
 //**************************************************************************
 //  PARSE TOKEN
 //**************************************************************************
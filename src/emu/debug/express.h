@@ -247,7 +247,7 @@ public:
 
 	// execution
 	void parse(std::string_view string);
-	u64 execute() { return execute_tokens(); }
+	u64 execute() { if (!m_compile_attempted) compile(); return m_compiled.empty() ? execute_tokens() : execute_compiled(); }
 
 private:
 	// a single token
@@ -342,6 +342,16 @@ private:
 		symbol_entry *          m_symbol;           // symbol pointer
 	};
 
+	// a single step of a compiled expression
+	struct compiled_op
+	{
+		u8                      opcode;             // operator or load type
+		int                     offset;             // offset within the string, for errors
+		u64                     value;              // constant value
+		symbol_entry *          symbol;             // symbol to read
+		parse_token             memory;             // memory operator to read through
+	};
+
 	// internal helpers
 	void copy(const parsed_expression &src);
 	void print_tokens();
@@ -363,6 +373,8 @@ private:
 	void pop_token_rval(parse_token &token);
 	u64 execute_tokens();
 	void execute_function(parse_token &token);
+	void compile();
+	u64 execute_compiled();
 
 	// constants
 	static const int MAX_FUNCTION_PARAMS = 16;
@@ -374,6 +386,9 @@ private:
 	std::list<parse_token> m_tokenlist;                 // token list
 	std::list<std::string> m_stringlist;                // string list
 	std::deque<parse_token> m_token_stack;              // token stack (used during execution)
+	std::vector<compiled_op> m_compiled;                // compiled form (empty if it must be interpreted)
+	std::vector<u64>    m_compiled_stack;               // value stack for the compiled form
+	bool                m_compile_attempted;            // true once the token list has been compiled
 };
 
 #endif // MAME_EMU_DEBUG_EXPRESS_H
@@ -325,7 +325,7 @@ class devcb_read : public devcb_read_base
 private:
 	using func_t = std::function<Result (offs_t, std::make_unsigned_t<Result>)>;
 
-	class creator
+	class creator : public util::arena_object
 	{
 	public:
 		using ptr = std::unique_ptr<creator>;
@@ -392,7 +392,7 @@ private:
 				if (!m_append)
 					m_target.m_creators.clear();
 				consume();
-				m_target.m_creators.emplace_back(std::make_unique<creator_impl<T> >(std::move(static_cast<T &>(*this))));
+				m_target.m_creators.emplace_back(new (m_target.owner().mconfig().arena()) creator_impl<T>(std::move(static_cast<T &>(*this))));
 			}
 		}
 
@@ -865,6 +865,8 @@ template <typename Result, std::make_unsigned_t<Result> DefaultMask>
 Result devcb_read<Result, DefaultMask>::operator()(offs_t offset, std::make_unsigned_t<Result> mem_mask)
 {
 	assert(m_creators.empty() && !m_functions.empty());
+	if (m_unset)
+		return m_default;
 	typename std::vector<func_t>::const_iterator it(m_functions.begin());
 	std::make_unsigned_t<Result> result((*it)(offset, mem_mask));
 	while (m_functions.end() != ++it)
@@ -890,7 +892,7 @@ class devcb_write : public devcb_write_base
 private:
 	using func_t = std::function<void (offs_t, Input, std::make_unsigned_t<Input>)>;
 
-	class creator
+	class creator : public util::arena_object
 	{
 	public:
 		using ptr = std::unique_ptr<creator>;
@@ -898,6 +900,7 @@ private:
 		virtual ~creator() { }
 		virtual bool validity_check(validity_checker &valid) const = 0;
 		virtual func_t create() = 0;
+		virtual bool is_nop() const { return false; }
 	};
 
 	template <typename T>
@@ -922,6 +925,7 @@ private:
 	public:
 		virtual bool validity_check(validity_checker &valid) const override { return true; }
 		virtual func_t create() override { return [] (offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask) { }; }
+		virtual bool is_nop() const override { return true; }
 	};
 
 	template <typename Source, typename Func> class transform_builder; // workaround for MSVC
@@ -959,7 +963,7 @@ private:
 				if (!m_append)
 					m_target.m_creators.clear();
 				consume();
-				m_target.m_creators.emplace_back(std::make_unique<creator_impl<T> >(std::move(static_cast<T &>(*this))));
+				m_target.m_creators.emplace_back(new (m_target.owner().mconfig().arena()) creator_impl<T>(std::move(static_cast<T &>(*this))));
 			}
 		}
 
@@ -2149,7 +2153,7 @@ private:
 		{
 			set_used();
 			m_target.m_creators.clear();
-			m_target.m_creators.emplace_back(std::make_unique<nop_creator>());
+			m_target.m_creators.emplace_back(new (m_target.owner().mconfig().arena()) nop_creator());
 		}
 
 	private:
@@ -2163,6 +2167,7 @@ private:
 	std::vector<func_t> m_functions;
 	std::vector<typename creator::ptr> m_creators;
 	bool m_unset = false;
+	bool m_nop = false;
 
 protected:
 	virtual bool findit(validity_checker *valid) override;
@@ -2217,9 +2222,14 @@ bool devcb_write<Input, DefaultMask>::findit(validity_checker *valid)
 	if (!valid)
 	{
 		// FIXME: report errors by returning false rather than throwing fatal errors
+		// callbacks that are unset or only bound to nop skip the call entirely
+		m_nop = true;
 		m_functions.reserve(m_creators.size());
 		for (typename creator::ptr const &c : m_creators)
+		{
 			m_functions.emplace_back(c->create());
+			m_nop = m_nop && c->is_nop();
+		}
 		m_creators.clear();
 		if (m_functions.empty())
 		{
@@ -2249,6 +2259,8 @@ template <typename Input, std::make_unsigned_t<Input> DefaultMask>
 void devcb_write<Input, DefaultMask>::operator()(offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask)
 {
 	assert(m_creators.empty() && !m_functions.empty());
+	if (m_nop)
+		return;
 	typename std::vector<func_t>::const_iterator it(m_functions.begin());
 	(*it)(offset, data, mem_mask);
 	while (m_functions.end() != ++it)
@@ -53,6 +53,18 @@ bool cpu_device::allow_drc() const
 }
 
 
+//-------------------------------------------------
+//  allow_unverified_drc - return true if a DRC
+//  that hasn't been checked against its
+//  interpreter is allowed
+//-------------------------------------------------
+
+bool cpu_device::allow_unverified_drc() const
+{
+	return allow_drc() && mconfig().options().drc_unverified();
+}
+
+
 
 bool cpu_device::cpu_is_interruptible() const
 {
@@ -37,6 +37,7 @@ public:
 	// configuration helpers
 	void set_force_no_drc(bool value) { m_force_no_drc = value; }
 	bool allow_drc() const;
+	bool allow_unverified_drc() const;
 
 	virtual bool cpu_is_interruptible() const;
 
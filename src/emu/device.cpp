@@ -66,6 +66,12 @@ device_type_impl_base *device_registrar::register_device(device_type_impl_base &
 	return nullptr;
 }
 
+
+util::arena &device_type_impl_base::config_arena(machine_config const &mconfig)
+{
+	return mconfig.arena();
+}
+
 } // namespace emu::detail
 
 emu::detail::device_registrar const registered_device_types;
@@ -101,15 +107,15 @@ device_t::device_t(const machine_config &mconfig, device_type type, const char *
 
 	, m_machine(nullptr)
 	, m_save(nullptr)
-	, m_basetag(tag)
+	, m_basetag(mconfig.arena().copy(tag))
 	, m_config_complete(false)
 	, m_started(false)
 	, m_auto_finder_list(nullptr)
 {
 	if (owner != nullptr)
-		m_tag.assign((owner->owner() == nullptr) ? "" : owner->tag()).append(":").append(tag);
+		m_tag = mconfig.arena().copy({ (owner->owner() == nullptr) ? "" : owner->tag(), ":", tag });
 	else
-		m_tag.assign(":");
+		m_tag = ":";
 	set_clock(clock);
 }
 
@@ -572,7 +578,7 @@ void device_t::start()
 
 	// have the views register their state
 	if (!m_viewlist.empty())
-		osd_printf_verbose("%s: Registering %d views\n", m_tag, int(m_viewlist.size()));
+		osd_printf_verbose("%s: Registering %d views\n", tag(), int(m_viewlist.size()));
 	for (memory_view *view : m_viewlist)
 		view->register_state();
 
@@ -188,7 +188,7 @@ private:
 	template <typename DeviceClass>
 	static std::unique_ptr<device_t> create_device(device_type_impl_base const &type, machine_config const &mconfig, char const *tag, device_t *owner, u32 clock)
 	{
-		return std::make_unique<DeviceClass>(mconfig, tag, owner, clock);
+		return std::unique_ptr<device_t>(new (config_arena(mconfig)) DeviceClass(mconfig, tag, owner, clock));
 	}
 
 	template <typename DriverClass>
@@ -197,7 +197,7 @@ private:
 		assert(!owner);
 		assert(!clock);
 
-		return std::make_unique<DriverClass>(mconfig, type, tag);
+		return std::unique_ptr<device_t>(new (config_arena(mconfig)) DriverClass(mconfig, type, tag));
 	}
 
 	create_func const m_creator;
@@ -211,6 +211,9 @@ private:
 
 	device_type_impl_base *m_next;
 
+protected:
+	static util::arena &config_arena(machine_config const &mconfig);
+
 public:
 	using exposed_type = device_t;
 
@@ -286,7 +289,7 @@ public:
 	template <typename... Params>
 	std::unique_ptr<DeviceClass> create(machine_config &mconfig, char const *tag, device_t *owner, Params &&... args) const
 	{
-		return std::make_unique<DeviceClass>(mconfig, tag, owner, std::forward<Params>(args)...);
+		return std::unique_ptr<DeviceClass>(new (config_arena(mconfig)) DeviceClass(mconfig, tag, owner, std::forward<Params>(args)...));
 	}
 
 	template <typename... Params> DeviceClass &operator()(machine_config &mconfig, char const *tag, Params &&... args) const;
@@ -458,8 +461,9 @@ class device_missing_dependencies : public emu_exception { };
 /// \brief Base class for devices
 ///
 /// The base class for all device implementations in MAME's modular
-/// architecture.
-class device_t : public delegate_late_bind
+/// architecture.  Devices are placed in the arena of the machine
+/// configuration that creates them.
+class device_t : public delegate_late_bind, public util::arena_object
 {
 	DISABLE_COPYING(device_t);
 
@@ -611,8 +615,8 @@ public:
 	// getters
 	bool has_running_machine() const { return m_machine != nullptr; }
 	running_machine &machine() const { /*assert(m_machine != nullptr);*/ return *m_machine; }
-	const char *tag() const { return m_tag.c_str(); }
-	const char *basetag() const { return m_basetag.c_str(); }
+	const char *tag() const { return m_tag.data(); }
+	const char *basetag() const { return m_basetag.data(); }
 	device_type type() const { return m_type; }
 	const char *name() const { return m_type.fullname(); }
 	const char *shortname() const { return m_type.shortname(); }
@@ -1024,8 +1028,8 @@ private:
 	// private state; accessor use required
 	running_machine *       m_machine;
 	save_manager *          m_save;
-	std::string             m_tag;                  // full tag for this instance
-	std::string             m_basetag;              // base part of the tag
+	std::string_view        m_tag;                  // full tag for this instance (NUL-terminated, in the config arena)
+	std::string_view        m_basetag;              // base part of the tag (NUL-terminated, in the config arena)
 	bool                    m_config_complete;      // have we completed our configuration?
 	bool                    m_started;              // true if the start function has succeeded
 	device_resolver_base *  m_auto_finder_list;     // list of objects to auto-find
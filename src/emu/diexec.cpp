@@ -46,6 +46,8 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	: device_interface(device, "execute")
 	, m_scheduler(nullptr)
 	, m_disabled(false)
+	, m_idle_detection(true)
+	, m_sync_domain(0)
 	, m_vblank_interrupt(device)
 	, m_vblank_interrupt_screen(nullptr)
 	, m_timed_interrupt(device)
@@ -68,6 +70,9 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	, m_divshift(0)
 	, m_cycles_per_second(0)
 	, m_attoseconds_per_cycle(0)
+	, m_stats{ 0, 0, 0, 0, 0, 0 }
+	, m_stats_last{ 0, 0, 0, 0, 0, 0 }
+	, m_stats_total{ 0, 0, 0, 0, 0, 0 }
 	, m_spin_end_timer(nullptr)
 {
 	memset(&m_localtime, 0, sizeof(m_localtime));
@@ -99,6 +104,8 @@ void device_execute_interface::abort_timeslice() noexcept
 	if (!executing())
 		return;
 
+	m_stats.m_aborts++;
+
 	// swallow the remaining cycles
 	if (m_icountptr != nullptr)
 	{
@@ -110,6 +117,42 @@ void device_execute_interface::abort_timeslice() noexcept
 }
 
 
+//-------------------------------------------------
+//  idle_loop_skip - called by a core that has
+//  proven the loop from start to end can only
+//  wait: nothing it reads can change until the
+//  timeslice ends, since interrupts, timers and
+//  other devices' writes all land between slices,
+//  so the rest of this one is skipped
+//-------------------------------------------------
+
+void device_execute_interface::idle_loop_skip(offs_t start, offs_t end)
+{
+	if (m_icountptr == nullptr || *m_icountptr <= 0)
+		return;
+
+	u64 const cycles = *m_icountptr;
+	*m_icountptr = 0;
+	m_stats.m_idled += cycles;
+
+	// record the loop, noting it the first time round
+	auto const found = std::find_if(
+			m_idle_loops.begin(),
+			m_idle_loops.end(),
+			[start, end] (idle_loop const &loop) { return loop.m_start == start && loop.m_end == end; });
+	if (found != m_idle_loops.end())
+	{
+		found->m_hits++;
+		found->m_cycles += cycles;
+	}
+	else
+	{
+		device().logerror("Idle loop detected at %X-%X\n", start, end);
+		m_idle_loops.push_back(idle_loop{ start, end, 1, cycles });
+	}
+}
+
+
 //-------------------------------------------------
 //  suspend_resume_changed
 //-------------------------------------------------
@@ -478,6 +521,18 @@ void device_execute_interface::interface_post_reset()
 }
 
 
+//-------------------------------------------------
+//  interface_pre_stop - log the idle loops the
+//  core skipped
+//-------------------------------------------------
+
+void device_execute_interface::interface_pre_stop()
+{
+	for (idle_loop const &loop : m_idle_loops)
+		device().logerror("Idle loop %X-%X: skipped %u times, %u cycles\n", loop.m_start, loop.m_end, loop.m_hits, loop.m_cycles);
+}
+
+
 //-------------------------------------------------
 //  interface_clock_changed - recomputes clock
 //  information for this device
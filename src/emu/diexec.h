@@ -97,12 +97,34 @@ class device_execute_interface : public device_interface
 	friend class testcpu_state;
 
 public:
+	// execution activity, counted per frame and in total
+	struct execute_stats
+	{
+		u64                     m_executed;                 // cycles actually run
+		u64                     m_stolen;                   // cycles given back by abort_timeslice and friends
+		u64                     m_eaten;                    // cycles skipped while suspended with eatcycles
+		u32                     m_runs;                     // calls to execute_run
+		u32                     m_aborts;                   // abort_timeslice calls while executing
+		u64                     m_idled;                    // cycles skipped in detected idle loops
+	};
+
+	// a polling loop the core found and skipped
+	struct idle_loop
+	{
+		offs_t                  m_start;                    // first address of the loop
+		offs_t                  m_end;                      // address of the closing branch
+		u32                     m_hits;                     // times it was skipped
+		u64                     m_cycles;                   // cycles skipped in it
+	};
+
 	// construction/destruction
 	device_execute_interface(const machine_config &mconfig, device_t &device);
 	virtual ~device_execute_interface();
 
 	// configuration access
 	bool disabled() const { return m_disabled; }
+	bool idle_detection() const { return m_idle_detection; }
+	int sync_domain() const { return m_sync_domain; }
 	u64 clocks_to_cycles(u64 clocks) const { return execute_clocks_to_cycles(clocks); }
 	u64 cycles_to_clocks(u64 cycles) const { return execute_cycles_to_clocks(cycles); }
 	u32 min_cycles() const { return execute_min_cycles(); }
@@ -116,6 +138,14 @@ public:
 	// inline configuration helpers
 	void set_disable() { m_disabled = true; }
 
+	// cores that can prove a loop only waits skip the rest of the timeslice
+	// in it; turn this off to run such loops cycle by cycle
+	void set_idle_detection(bool enable) { m_idle_detection = enable; }
+
+	// devices in a non-zero sync domain may run on their own host thread;
+	// they must only reach other domains through synchronize() (latches, FIFOs)
+	void set_sync_domain(int domain) { m_sync_domain = domain; }
+
 	template <typename... T> void set_vblank_int(const char *tag, T &&... args)
 	{
 		m_vblank_interrupt.set(std::forward<T>(args)...);
@@ -160,6 +190,11 @@ public:
 	void adjust_icount(int delta) noexcept { if (executing()) *m_icountptr += delta; }
 	void abort_timeslice() noexcept;
 
+	// execution statistics
+	const execute_stats &last_frame_stats() const noexcept { return m_stats_last; }
+	const execute_stats &total_stats() const noexcept { return m_stats_total; }
+	const std::vector<idle_loop> &idle_loops() const noexcept { return m_idle_loops; }
+
 	// input and interrupt management
 	void set_input_line(int linenum, int state) { assert(device().started()); m_input[linenum].set_state_synced(state); }
 	void set_input_line_vector(int linenum, int vector) { assert(device().started()); m_input[linenum].set_vector(vector); }
@@ -216,8 +251,12 @@ protected:
 	virtual void interface_post_start() override;
 	virtual void interface_pre_reset() override;
 	virtual void interface_post_reset() override;
+	virtual void interface_pre_stop() override;
 	virtual void interface_clock_changed(bool sync_on_new_clock_domain) override;
 
+	// idle loop reporting for cores
+	void idle_loop_skip(offs_t start, offs_t end);
+
 	// for use by devcpu for now...
 	int current_input_state(unsigned i) const { return m_input[i].m_curstate; }
 	void set_icountptr(int &icount) { assert(!m_icountptr); m_icountptr = &icount; }
@@ -288,6 +327,8 @@ private:
 
 	// configuration
 	bool                    m_disabled;                 // disabled from executing?
+	bool                    m_idle_detection;           // may the core skip idle loops?
+	int                     m_sync_domain;              // group of devices scheduled together
 	device_interrupt_delegate m_vblank_interrupt;       // for interrupts tied to VBLANK
 	const char *            m_vblank_interrupt_screen;  // the screen that causes the VBLANK interrupt
 	device_interrupt_delegate m_timed_interrupt;        // for interrupts not tied to VBLANK
@@ -325,6 +366,12 @@ private:
 	u32                     m_cycles_per_second;        // cycles per second, adjusted for multipliers
 	attoseconds_t           m_attoseconds_per_cycle;    // attoseconds per adjusted clock cycle
 
+	// statistics
+	execute_stats           m_stats;                    // activity in the current frame
+	execute_stats           m_stats_last;               // activity in the last full frame
+	execute_stats           m_stats_total;              // activity since the machine started
+	std::vector<idle_loop>  m_idle_loops;               // idle loops found so far
+
 	emu_timer *             m_spin_end_timer;           // timer for triggering the end of spin_until_time
 	emu_timer *             m_pulse_end_timers[MAX_INPUT_LINES]; // timer for ending input-line pulses
 
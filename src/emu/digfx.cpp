@@ -270,6 +270,40 @@ void device_gfx_interface::decode_gfx(const gfx_decode_entry *gfxdecodeinfo)
 }
 
 
+//-------------------------------------------------
+//  predecode_gfx - decode all tiles of one gfx
+//  element now, spread across worker threads
+//-------------------------------------------------
+
+void device_gfx_interface::predecode_gfx(u8 index)
+{
+	assert(index < MAX_GFX_ELEMENTS);
+	if (!m_gfx[index])
+		return;
+
+	osd_work_queue *const queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	m_gfx[index]->decode_all(queue);
+	if (queue)
+		osd_work_queue_free(queue);
+}
+
+
+//-------------------------------------------------
+//  predecode_gfx - decode all tiles of every gfx
+//  element now, spread across worker threads
+//-------------------------------------------------
+
+void device_gfx_interface::predecode_gfx()
+{
+	osd_work_queue *const queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	for (auto &gfx : m_gfx)
+		if (gfx)
+			gfx->decode_all(queue);
+	if (queue)
+		osd_work_queue_free(queue);
+}
+
+
 //-------------------------------------------------
 //  interface_validity_check - validate graphics
 //  decoding configuration
@@ -180,6 +180,10 @@ public:
 
 	void set_gfx(u8 index, std::unique_ptr<gfx_element> &&element) { assert(index < MAX_GFX_ELEMENTS); m_gfx[index] = std::move(element); }
 
+	// decode all tiles of one or every gfx element now, on worker threads
+	void predecode_gfx(u8 index);
+	void predecode_gfx();
+
 protected:
 	// interface-level overrides
 	virtual void interface_validity_check(validity_checker &valid) const override;
@@ -91,6 +91,7 @@ public:
 	virtual u32 unhashed_header_length() const noexcept { return 0; }
 	virtual bool core_opens_image_file() const noexcept { return true; }
 	virtual bool image_is_chd_type() const noexcept { return false; }
+	virtual chd_file *image_chd() const noexcept { return nullptr; }
 	virtual bool is_readable()  const noexcept = 0;
 	virtual bool is_writeable() const noexcept = 0;
 	virtual bool is_creatable() const noexcept = 0;
@@ -31,7 +31,8 @@ device_palette_interface::device_palette_interface(const machine_config &mconfig
 		m_shadow_group(0),
 		m_hilight_group(0),
 		m_white_pen(0),
-		m_black_pen(0)
+		m_black_pen(0),
+		m_pending(false)
 {
 }
 
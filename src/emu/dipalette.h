@@ -38,6 +38,7 @@ typedef u16 indirect_pen_t;
 class device_palette_interface : public device_interface
 {
 	friend class screen_device;
+	friend class video_manager;
 
 	static constexpr int MAX_SHADOW_PRESETS = 4;
 
@@ -45,12 +46,12 @@ public:
 	// getters
 	u32 entries() const noexcept { return palette_entries(); }
 	u32 indirect_entries() const noexcept { return palette_indirect_entries(); }
-	palette_t *palette() const { return m_palette; }
-	const pen_t &pen(int index) const { return m_pens[index]; }
-	const pen_t *pens() const { return m_pens; }
-	pen_t *shadow_table() const { return m_shadow_table; }
-	rgb_t pen_color(pen_t pen) const { return m_palette->entry_color(pen); }
-	double pen_contrast(pen_t pen) const { return m_palette->entry_contrast(pen); }
+	palette_t *palette() const { update_pending(); return m_palette; }
+	const pen_t &pen(int index) const { update_pending(); return m_pens[index]; }
+	const pen_t *pens() const { update_pending(); return m_pens; }
+	pen_t *shadow_table() const { update_pending(); return m_shadow_table; }
+	rgb_t pen_color(pen_t pen) const { update_pending(); return m_palette->entry_color(pen); }
+	double pen_contrast(pen_t pen) const { update_pending(); return m_palette->entry_contrast(pen); }
 	pen_t black_pen() const { return m_black_pen; }
 	pen_t white_pen() const { return m_white_pen; }
 	bool shadows_enabled() const noexcept { return palette_shadows_enabled(); }
@@ -69,7 +70,7 @@ public:
 
 	// indirection (aka colortables)
 	indirect_pen_t pen_indirect(int index) const { return m_indirect_pens[index]; }
-	rgb_t indirect_color(int index) const { return m_indirect_colors[index]; }
+	rgb_t indirect_color(int index) const { update_pending(); return m_indirect_colors[index]; }
 	void set_indirect_color(int index, rgb_t rgb);
 	void set_pen_indirect(pen_t pen, indirect_pen_t index);
 	u32 transpen_mask(gfx_element &gfx, u32 color, indirect_pen_t transcolor) const;
@@ -97,6 +98,12 @@ protected:
 	virtual bool palette_shadows_enabled() const noexcept { return false; }
 	virtual bool palette_hilights_enabled() const noexcept { return false; }
 
+	// deferred updates: implementations that hold back color changes call
+	// set_pending(), and palette_update_pending() is called before the
+	// colors are next used
+	void set_pending() { m_pending = true; }
+	virtual void palette_update_pending() { }
+
 private:
 	// internal helpers
 	void allocate_palette(u32 numentries);
@@ -106,6 +113,8 @@ public: // needed by konamigx
 	void set_shadow_dRGB32(int mode, int dr, int dg, int db, bool noclip);
 private:
 	void configure_rgb_shadows(int mode, float factor);
+	void update_pending() const { if (m_pending) const_cast<device_palette_interface *>(this)->flush_pending(); }
+	void flush_pending() { m_pending = false; palette_update_pending(); }
 
 	// internal state
 	palette_t *         m_palette;              // the palette itself
@@ -116,6 +125,7 @@ private:
 	u32                 m_hilight_group;        // index of the hilight group, or 0 if none
 	pen_t               m_white_pen;            // precomputed white pen value
 	pen_t               m_black_pen;            // precomputed black pen value
+	bool                m_pending;              // are there held-back color changes?
 
 	// indirection state
 	std::vector<rgb_t> m_indirect_colors;          // actual colors set for indirection
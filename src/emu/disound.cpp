@@ -459,7 +459,7 @@ void device_mixer_interface::interface_pre_start()
 	m_output_clear.resize(m_outputs);
 
 	// allocate the mixer stream
-	m_mixer_stream = stream_alloc(m_auto_allocated_inputs, m_outputs, device().machine().sample_rate(), STREAM_DEFAULT_FLAGS);
+	m_mixer_stream = stream_alloc(m_auto_allocated_inputs, m_outputs, device().machine().sample_rate(), STREAM_PARALLEL_SAFE);
 }
 
 
@@ -500,9 +500,9 @@ void device_mixer_interface::sound_stream_update(sound_stream &stream, std::vect
 	// loop over inputs
 	for (int inputnum = 0; inputnum < m_auto_allocated_inputs; inputnum++)
 	{
-		// skip if the gain is 0
+		// skip if the gain is 0 or the input is known to be silent
 		auto &input = inputs[inputnum];
-		if (input.gain() == 0)
+		if (input.silent())
 			continue;
 
 		// either store or accumulate
@@ -37,7 +37,8 @@ device_vtlb_interface::device_vtlb_interface(const machine_config &mconfig, devi
 		m_dynindex(0),
 		m_pageshift(0),
 		m_addrwidth(0),
-		m_table_base(nullptr)
+		m_table_base(nullptr),
+		m_stats{ 0, 0, 0, 0, 0 }
 {
 }
 
@@ -169,10 +170,12 @@ bool device_vtlb_interface::vtlb_fill(offs_t address, offs_t taddress, int inten
 		int liveindex = m_dynindex;
 
 		m_dynindex = (m_dynindex + 1) % m_dynamic;
+		m_stats.m_fills++;
 
 		// if an entry already exists at this index, free it
 		if (m_live[liveindex] != 0)
 		{
+			m_stats.m_evictions++;
 			if (m_refcnt[m_live[liveindex] - 1] <= 1)
 				m_table[m_live[liveindex] - 1] = 0;
 			else
@@ -222,6 +225,7 @@ void device_vtlb_interface::vtlb_load(int entrynum, int numpages, offs_t address
 
 	// must be in range
 	assert(entrynum >= 0 && entrynum < m_fixed);
+	m_stats.m_loads++;
 
 #if PRINTF_TLB
 	osd_printf_debug("vtlb_load %d for %d pages at %08X == %08X\n", entrynum, numpages, address, value);
@@ -270,13 +274,17 @@ void device_vtlb_interface::vtlb_dynload(u32 index, offs_t address, vtlb_entry v
 	int liveindex = m_dynindex;
 
 	m_dynindex = (m_dynindex + 1) % m_dynamic;
+	m_stats.m_fills++;
 
 	// is entry already live?
 	if (!(entry & FLAG_VALID))
 	{
 		// if an entry already exists at this index, free it
 		if (m_live[liveindex] != 0)
+		{
+			m_stats.m_evictions++;
 			m_table[m_live[liveindex] - 1] = 0;
+		}
 
 		// claim this new entry
 		m_live[liveindex] = index + 1;
@@ -305,6 +313,7 @@ void device_vtlb_interface::vtlb_flush_dynamic()
 #if PRINTF_TLB
 	osd_printf_debug("vtlb_flush_dynamic\n");
 #endif
+	m_stats.m_flushes++;
 
 	// loop over live entries and release them from the table
 	for (int liveindex = 0; liveindex < m_dynamic; liveindex++)
@@ -329,6 +338,7 @@ void device_vtlb_interface::vtlb_flush_address(offs_t address)
 #if PRINTF_TLB
 	osd_printf_debug("vtlb_flush_address %08X\n", address);
 #endif
+	m_stats.m_address_flushes++;
 
 	// free the entry in the table; for speed, we leave the entry in the live array
 	m_table[tableindex] = 0;
@@ -42,6 +42,16 @@ public:
 		FLAG_FIXED           = 0x80
 	};
 
+	// slow-path activity; lookups go straight to the table and are not counted
+	struct vtlb_stats
+	{
+		u64                 m_fills;            // dynamic entries filled after a miss
+		u64                 m_evictions;        // live dynamic entries pushed out to make room
+		u64                 m_loads;            // fixed entries loaded or cleared
+		u64                 m_flushes;          // full flushes of the dynamic entries
+		u64                 m_address_flushes;  // single-page flushes
+	};
+
 	// construction/destruction
 	device_vtlb_interface(const machine_config &mconfig, device_t &device, int space);
 	virtual ~device_vtlb_interface();
@@ -61,6 +71,11 @@ public:
 
 	// accessors
 	const vtlb_entry *vtlb_table() const;
+	int vtlb_dynamic_entries() const { return m_dynamic; }
+	int vtlb_fixed_entries() const { return m_fixed; }
+	int vtlb_fixed_pages(int entrynum) const { return m_fixedpages[entrynum]; }
+	const vtlb_stats &vtlb_statistics() const { return m_stats; }
+	void vtlb_reset_statistics() { m_stats = vtlb_stats{ 0, 0, 0, 0, 0 }; }
 
 protected:
 	// interface-level overrides
@@ -82,6 +97,7 @@ private:
 	std::vector<vtlb_entry> m_table;        // table of entries by address
 	std::vector<offs_t> m_refcnt;           // table of entry reference counts by address
 	vtlb_entry          *m_table_base;      // pointer to m_table[0]
+	vtlb_stats          m_stats;            // slow-path counters
 };
 
 
@@ -340,6 +340,64 @@ void gfx_element::decode(u32 code)
 
 
 
+//-------------------------------------------------
+//  decode_range - decode the dirty elements in a
+//  range
+//-------------------------------------------------
+
+void gfx_element::decode_range(u32 start, u32 end)
+{
+	for (u32 code = start; code < end; code++)
+		if (m_dirty[code])
+			decode(code);
+}
+
+
+//-------------------------------------------------
+//  decode_chunk_work - decode a run of elements
+//  on a worker thread; each element only touches
+//  its own data, dirty flag and pen usage
+//-------------------------------------------------
+
+void *gfx_element::decode_chunk_work(void *param, int threadid)
+{
+	decode_chunk const &chunk = *reinterpret_cast<decode_chunk const *>(param);
+	chunk.m_element->decode_range(chunk.m_start, chunk.m_end);
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  decode_all - decode every dirty element now,
+//  in runs spread across the queue's workers
+//-------------------------------------------------
+
+void gfx_element::decode_all(osd_work_queue *queue)
+{
+	// elements in the smallest run worth handing to a worker, and the most runs
+	static constexpr u32 CHUNK_ELEMENTS = 1024;
+	static constexpr u32 MAX_CHUNKS = 64;
+
+	u32 const total = elements();
+	u32 const count = queue ? std::min(total / CHUNK_ELEMENTS, MAX_CHUNKS) : 0;
+	if (count <= 1)
+	{
+		decode_range(0, total);
+		return;
+	}
+
+	std::vector<decode_chunk> chunks(count);
+	for (u32 i = 0; i < count; i++)
+		chunks[i] = decode_chunk{ this, u32(u64(total) * i / count), u32(u64(total) * (i + 1) / count) };
+
+	// decode the first run on this thread and the others on the queue
+	osd_work_item_queue_multiple(queue, &gfx_element::decode_chunk_work, count - 1, &chunks[1], sizeof(decode_chunk), WORK_ITEM_FLAG_AUTO_RELEASE);
+	decode_range(chunks[0].m_start, chunks[0].m_end);
+	while (!osd_work_queue_wait(queue, osd_ticks_per_second()))
+		;
+}
+
+
 /***************************************************************************
     DRAWGFX IMPLEMENTATIONS
 ***************************************************************************/
@@ -354,7 +412,9 @@ void gfx_element::opaque(bitmap_ind16 &dest, const rectangle &cliprect,
 {
 	color = colorbase() + granularity() * (color % colors());
 	code %= elements();
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_OPAQUE(destp, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, make_drawgfx_span_op(
+			[color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_OPAQUE(destp, srcp); },
+			[color](u16 *destp, const u8 *srcp, u32 count) { drawgfx_span_rebase_opaque(destp, srcp, count, color); }));
 }
 
 void gfx_element::opaque(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -395,7 +455,9 @@ void gfx_element::transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, make_drawgfx_span_op(
+			[trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); },
+			[trans_pen, color](u16 *destp, const u8 *srcp, u32 count) { drawgfx_span_rebase_transpen(destp, srcp, count, color, trans_pen); }));
 }
 
 void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -422,7 +484,9 @@ void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN(destp, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, make_drawgfx_span_op(
+			[trans_pen, paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN(destp, srcp); },
+			[trans_pen, paldata](u32 *destp, const u8 *srcp, u32 count) { drawgfx_span_remap_transpen(destp, srcp, count, paldata, trans_pen); }));
 }
 
 
@@ -442,7 +506,9 @@ void gfx_element::transpen_raw(bitmap_ind16 &dest, const rectangle &cliprect,
 		return;
 
 	// render
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, make_drawgfx_span_op(
+			[trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); },
+			[trans_pen, color](u16 *destp, const u8 *srcp, u32 count) { drawgfx_span_rebase_transpen(destp, srcp, count, color, trans_pen); }));
 }
 
 void gfx_element::transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -455,7 +521,9 @@ void gfx_element::transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
 		return;
 
 	// render
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u32 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, make_drawgfx_span_op(
+			[trans_pen, color](u32 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); },
+			[trans_pen, color](u32 *destp, const u8 *srcp, u32 count) { drawgfx_span_rebase_transpen(destp, srcp, count, color, trans_pen); }));
 }
 
 
@@ -936,7 +1004,10 @@ void gfx_element::prio_transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, color](u16 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	auto const pixel_op = [pmask, trans_pen, color](u16 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); };
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, make_drawgfx_span_op(
+			pixel_op,
+			[trans_pen, pixel_op](auto *destp, u8 *pri, const u8 *srcp, u32 count) { drawgfx_span_transpen_priority(destp, pri, srcp, count, trans_pen, pixel_op); }));
 }
 
 void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -966,7 +1037,10 @@ void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, paldata](u32 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	auto const pixel_op = [pmask, trans_pen, paldata](u32 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN_PRIORITY(destp, pri, srcp); };
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, make_drawgfx_span_op(
+			pixel_op,
+			[trans_pen, pixel_op](auto *destp, u8 *pri, const u8 *srcp, u32 count) { drawgfx_span_transpen_priority(destp, pri, srcp, count, trans_pen, pixel_op); }));
 }
 
 
@@ -989,7 +1063,10 @@ void gfx_element::prio_transpen_raw(bitmap_ind16 &dest, const rectangle &cliprec
 	pmask |= 1 << 31;
 
 	// render
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, color](u16 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	auto const pixel_op = [pmask, trans_pen, color](u16 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); };
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, make_drawgfx_span_op(
+			pixel_op,
+			[trans_pen, pixel_op](auto *destp, u8 *pri, const u8 *srcp, u32 count) { drawgfx_span_transpen_priority(destp, pri, srcp, count, trans_pen, pixel_op); }));
 }
 
 void gfx_element::prio_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1005,7 +1082,10 @@ void gfx_element::prio_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprec
 	pmask |= 1 << 31;
 
 	// render
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, [pmask, trans_pen, color](u32 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); });
+	auto const pixel_op = [pmask, trans_pen, color](u32 &destp, u8 &pri, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN_PRIORITY(destp, pri, srcp); };
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, priority, make_drawgfx_span_op(
+			pixel_op,
+			[trans_pen, pixel_op](auto *destp, u8 *pri, const u8 *srcp, u32 count) { drawgfx_span_transpen_priority(destp, pri, srcp, count, trans_pen, pixel_op); }));
 }
 
 
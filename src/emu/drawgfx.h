@@ -165,6 +165,7 @@ public:
 	u16 granularity() const { return m_color_granularity; }
 	u32 colors() const { return m_total_colors; }
 	u32 rowbytes() const { return m_line_modulo; }
+	size_t allocated_bytes() const { return m_gfxdata_allocated.size() + m_dirty.size(); }
 	bool has_pen_usage() const { return !m_pen_usage.empty(); }
 	bool has_palette() const { return m_palette; }
 
@@ -201,6 +202,10 @@ public:
 		return m_pen_usage[code];
 	}
 
+	// decode every dirty element now, splitting them across the queue's
+	// workers if one is given
+	void decode_all(osd_work_queue *queue = nullptr);
+
 	// ----- core graphics drawing -----
 
 	// core drawgfx implementation
@@ -280,8 +285,18 @@ public:
 	void alphatable(bitmap_rgb32 &dest, const rectangle &cliprect, u32 code, u32 color, int flipx, int flipy, s32 destx, s32 desty, int fixedalpha, u8 *alphatable);
 
 private:
+	// a run of elements for a worker to decode
+	struct decode_chunk
+	{
+		gfx_element *   m_element;              // element set to decode
+		u32             m_start;                // first element in the run
+		u32             m_end;                  // element after the last
+	};
+
 	// internal helpers
 	void decode(u32 code);
+	void decode_range(u32 start, u32 end);
+	static void *decode_chunk_work(void *param, int threadid);
 
 	// internal state
 	device_palette_interface *m_palette;    // palette used for drawing (optional when used as a pure decoder)
@@ -15,6 +15,10 @@
 
 #pragma once
 
+#include "video/drawgfxspan.h"
+
+#include <type_traits>
+
 
 /***************************************************************************
     PIXEL OPERATIONS
@@ -399,6 +403,37 @@ do
 while (0)
 
 
+/***************************************************************************
+    SPAN OPERATIONS
+***************************************************************************/
+
+/*
+    A pixel operation can be paired with an operation on a whole row,
+    such as those in drawgfxspan.h; drawgfx_core passes unflipped rows
+    to the row operation and uses the pixel operation everywhere else.
+    The row operation is called as span(destptr, srcptr, count), or as
+    span(destptr, priptr, srcptr, count) when drawing with priority.
+*/
+
+template <typename PixelOp, typename SpanOp>
+struct drawgfx_span_op
+{
+	PixelOp pixel;
+	SpanOp span;
+
+	template <typename... Params> void operator()(Params &... args) const { pixel(args...); }
+};
+
+template <typename PixelOp, typename SpanOp>
+inline drawgfx_span_op<PixelOp, SpanOp> make_drawgfx_span_op(PixelOp pixel, SpanOp span)
+{
+	return drawgfx_span_op<PixelOp, SpanOp>{ pixel, span };
+}
+
+template <typename T> struct is_drawgfx_span_op : std::false_type { };
+template <typename PixelOp, typename SpanOp> struct is_drawgfx_span_op<drawgfx_span_op<PixelOp, SpanOp> > : std::true_type { };
+
+
 /***************************************************************************
     BASIC DRAWGFX CORE
 ***************************************************************************/
@@ -487,6 +522,20 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 		// adjust srcdata to point to the first source pixel of the row
 		srcdata += srcy * rowbytes() + srcx;
 
+		// non-flipped 8bpp case with a row operation
+		if constexpr (is_drawgfx_span_op<FunctionClass>::value)
+		{
+			if (!flipx)
+			{
+				for (s32 cury = desty; cury <= destendy; cury++)
+				{
+					pixel_op.span(&dest.pix(cury, destx), srcdata, destendx + 1 - destx);
+					srcdata += dy;
+				}
+				break;
+			}
+		}
+
 		// non-flipped 8bpp case
 		if (!flipx)
 		{
@@ -624,6 +673,20 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 		// adjust srcdata to point to the first source pixel of the row
 		srcdata += srcy * rowbytes() + srcx;
 
+		// non-flipped 8bpp case with a row operation
+		if constexpr (is_drawgfx_span_op<FunctionClass>::value)
+		{
+			if (!flipx)
+			{
+				for (s32 cury = desty; cury <= destendy; cury++)
+				{
+					pixel_op.span(&dest.pix(cury, destx), &priority.pix(cury, destx), srcdata, destendx + 1 - destx);
+					srcdata += dy;
+				}
+				break;
+			}
+		}
+
 		// non-flipped 8bpp case
 		if (!flipx)
 		{
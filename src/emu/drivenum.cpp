@@ -18,6 +18,129 @@
 #include <algorithm>
 
 #include <cctype>
+#include <cstdint>
+#include <memory>
+
+
+
+namespace {
+
+//**************************************************************************
+//  LOOKUP INDEXES
+//**************************************************************************
+
+// hash of a driver name, ignoring ASCII case like core_stricmp
+inline u32 driver_name_hash(char const *name)
+{
+	u32 result = 2166136261U;
+	for ( ; *name; ++name)
+		result = (result ^ u8(std::tolower(u8(*name)))) * 16777619U;
+	return result;
+}
+
+
+// mask of characters present in a string; no common bits means no common
+// characters, in which case edit_distance is always 1.0
+inline u64 char_mask(std::u32string_view str)
+{
+	u64 result = 0U;
+	for (char32_t ch : str)
+		result |= u64(1) << (ch & 0x3f);
+	return result;
+}
+
+
+// open-addressed hash table from driver name to sorted index, built on
+// first use since the driver list never changes once the program is linked
+class driver_name_index
+{
+public:
+	driver_name_index(game_driver const *const *drivers, std::size_t count)
+		: m_drivers(drivers)
+		, m_mask(1U)
+	{
+		while (m_mask < (count * 2U))
+			m_mask <<= 1;
+		m_slots = std::make_unique<s32 []>(m_mask);
+		std::fill_n(m_slots.get(), m_mask, -1);
+		--m_mask;
+		for (std::size_t index = 0; count > index; ++index)
+		{
+			u32 slot = driver_name_hash(drivers[index]->name) & m_mask;
+			while (0 <= m_slots[slot])
+				slot = (slot + 1) & m_mask;
+			m_slots[slot] = s32(index);
+		}
+	}
+
+	int find(char const *name) const
+	{
+		for (u32 slot = driver_name_hash(name) & m_mask; 0 <= m_slots[slot]; slot = (slot + 1) & m_mask)
+		{
+			if (!core_stricmp(m_drivers[m_slots[slot]]->name, name))
+				return m_slots[slot];
+		}
+		return -1;
+	}
+
+private:
+	game_driver const *const *m_drivers;
+	std::unique_ptr<s32 []> m_slots;
+	u32 m_mask;
+};
+
+
+// normalised description and "<manufacturer> <description>" strings for
+// every driver, so approximate matching doesn't have to normalise the
+// whole list again for every search
+class driver_search_index
+{
+public:
+	struct entry
+	{
+		std::size_t description, composed, end;
+		u64 name_mask, description_mask, composed_mask;
+	};
+
+	driver_search_index(game_driver const *const *drivers, std::size_t count)
+		: m_entries(std::make_unique<entry []>(count))
+	{
+		std::string composed;
+		for (std::size_t index = 0; count > index; ++index)
+		{
+			game_driver const &drv(*drivers[index]);
+			entry &e(m_entries[index]);
+
+			// shortnames are always lowercase ASCII
+			e.name_mask = 0U;
+			for (char const *ch = drv.name; *ch; ++ch)
+				e.name_mask |= u64(1) << (u8(*ch) & 0x3f);
+
+			e.description = m_pool.length();
+			m_pool.append(ustr_from_utf8(normalize_unicode(drv.type.fullname(), unicode_normalization_form::D, true)));
+			e.description_mask = char_mask(std::u32string_view(m_pool).substr(e.description));
+
+			composed.assign(drv.manufacturer);
+			composed.append(1, ' ');
+			composed.append(drv.type.fullname());
+			e.composed = m_pool.length();
+			m_pool.append(ustr_from_utf8(normalize_unicode(composed, unicode_normalization_form::D, true)));
+			e.end = m_pool.length();
+			e.composed_mask = char_mask(std::u32string_view(m_pool).substr(e.composed));
+		}
+		m_pool.shrink_to_fit();
+	}
+
+	entry const &operator[](std::size_t index) const { return m_entries[index]; }
+	std::u32string_view description(entry const &e) const { return std::u32string_view(m_pool).substr(e.description, e.composed - e.description); }
+	std::u32string_view composed(entry const &e) const { return std::u32string_view(m_pool).substr(e.composed, e.end - e.composed); }
+
+private:
+	std::unique_ptr<entry []> m_entries;
+	std::u32string m_pool;
+};
+
+} // anonymous namespace
 
 
 
@@ -44,12 +167,9 @@ int driver_list::find(const char *name)
 	if (!name)
 		return -1;
 
-	// binary search to find it
-	game_driver const *const *const begin = s_drivers_sorted;
-	game_driver const *const *const end = begin + s_driver_count;
-	auto const cmp = [] (game_driver const *driver, char const *name) { return core_stricmp(driver->name, name) < 0; };
-	game_driver const *const *const result = std::lower_bound(begin, end, name, cmp);
-	return ((result == end) || core_stricmp((*result)->name, name)) ? -1 : std::distance(begin, result);
+	// look it up in the hash index
+	static driver_name_index const index(s_drivers_sorted, s_driver_count);
+	return index.find(name);
 }
 
 
@@ -261,8 +381,9 @@ void driver_enumerator::find_approximate_matches(std::string const &string, std:
 		// allocate memory to track the penalty value
 		std::vector<std::pair<double, int> > penalty;
 		penalty.reserve(count);
+		static driver_search_index const strings(s_drivers_sorted, s_driver_count);
 		std::u32string const search(ustr_from_utf8(normalize_unicode(string, unicode_normalization_form::D, true)));
-		std::string composed;
+		u64 const search_mask(char_mask(search));
 		std::u32string candidate;
 
 		// scan the entire drivers array
@@ -272,29 +393,30 @@ void driver_enumerator::find_approximate_matches(std::string const &string, std:
 			if (m_included[index])
 			{
 				// cheat on the shortname as it's always lowercase ASCII
+				// strings with no characters in common are skipped without scoring
 				game_driver const &drv(*s_drivers_sorted[index]);
-				std::size_t const namelen(std::strlen(drv.name));
-				candidate.resize(namelen);
-				std::copy_n(drv.name, namelen, candidate.begin());
-				double curpenalty(util::edit_distance(search, candidate));
+				driver_search_index::entry const &e(strings[index]);
+				double curpenalty(1.0);
+				if (search_mask & e.name_mask)
+				{
+					std::size_t const namelen(std::strlen(drv.name));
+					candidate.resize(namelen);
+					std::copy_n(drv.name, namelen, candidate.begin());
+					curpenalty = util::edit_distance(search, candidate);
+				}
 
 				// if it's not a perfect match, try the description
-				if (curpenalty)
+				if (curpenalty && (search_mask & e.description_mask))
 				{
-					candidate = ustr_from_utf8(normalize_unicode(drv.type.fullname(), unicode_normalization_form::D, true));
-					double p(util::edit_distance(search, candidate));
+					double p(util::edit_distance(search, strings.description(e)));
 					if (p < curpenalty)
 						curpenalty = p;
 				}
 
 				// also check "<manufacturer> <description>"
-				if (curpenalty)
+				if (curpenalty && (search_mask & e.composed_mask))
 				{
-					composed.assign(drv.manufacturer);
-					composed.append(1, ' ');
-					composed.append(drv.type.fullname());
-					candidate = ustr_from_utf8(normalize_unicode(composed, unicode_normalization_form::D, true));
-					double p(util::edit_distance(search, candidate));
+					double p(util::edit_distance(search, strings.composed(e)));
 					if (p < curpenalty)
 						curpenalty = p;
 				}
@@ -25,6 +25,7 @@
 #include <forward_list>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <map>
 #include <unordered_map>
 #include <unordered_set>
@@ -38,6 +39,7 @@
 #include "profiler.h"
 
 // commonly-referenced utilities imported from lib/util
+#include "arena.h"
 #include "corefile.h"
 #include "delegate.h"
 #include "hash.h"
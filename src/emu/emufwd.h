@@ -32,10 +32,14 @@ struct XML_ParserStruct;
 // osd
 //----------------------------------
 
+// declared in modules/lib/osdlib.h
+namespace osd { class large_page_allocation; class mapped_file_view; class shared_memory_region; }
+
 // declared in modules/output/output_module.h
 class output_module;
 
 // declared in osdepend.h
+struct osd_audio_status;
 class osd_font;
 class osd_interface;
 class osd_midi_device;
@@ -139,6 +143,12 @@ class memory_region;
 class memory_share;
 class memory_view;
 
+// declared in memprof.h
+class memory_profiler;
+
+// declared in memreport.h
+class memory_report;
+
 // declared in emuopts.h
 class emu_options;
 
@@ -192,6 +202,9 @@ class network_manager;
 // declared in output.h
 class output_manager;
 
+// declared in pcprof.h
+class pc_profiler;
+
 // declared in render.h
 class render_container;
 class render_manager;
@@ -215,6 +228,7 @@ class rom_entry;
 
 // declared in romload.h
 class rom_load_manager;
+class rom_restart_cache;
 
 // declared in schedule.h
 class device_scheduler;
@@ -12,8 +12,11 @@
 #include <list>
 #include <map>
 #include "emuopts.h"
+#include "memprof.h"
 #include "debug/debugcpu.h"
 
+#include "modules/lib/osdlib.h"
+
 #include "emumem_mud.h"
 #include "emumem_hea.h"
 #include "emumem_hem.h"
@@ -142,6 +145,11 @@ template<int Width, int AddrShift> void handler_entry_read<Width, AddrShift>::lo
 	fatalerror("lookup called on non-dispatching class\n");
 }
 
+template<int Width, int AddrShift> const u32 *handler_entry_read<Width, AddrShift>::lookup_version(offs_t address) const
+{
+	return nullptr;
+}
+
 template<int Width, int AddrShift> void *handler_entry_read<Width, AddrShift>::get_ptr(offs_t offset) const
 {
 	return nullptr;
@@ -204,6 +212,11 @@ template<int Width, int AddrShift> void handler_entry_write<Width, AddrShift>::l
 	fatalerror("lookup called on non-dispatching class\n");
 }
 
+template<int Width, int AddrShift> const u32 *handler_entry_write<Width, AddrShift>::lookup_version(offs_t address) const
+{
+	return nullptr;
+}
+
 template<int Width, int AddrShift> void *handler_entry_write<Width, AddrShift>::get_ptr(offs_t offset) const
 {
 	return nullptr;
@@ -263,6 +276,7 @@ template class handler_entry_write<3, -3>;
 
 memory_manager::memory_manager(running_machine &machine)
 	: m_machine(machine)
+	, m_profiler(std::make_unique<memory_profiler>())
 {
 }
 
@@ -272,6 +286,8 @@ memory_manager::memory_manager(running_machine &machine)
 
 memory_manager::~memory_manager()
 {
+	// take the taps out while the spaces still exist
+	m_profiler.reset();
 }
 
 //-------------------------------------------------
@@ -309,9 +325,39 @@ void memory_manager::initialize()
 
 void *memory_manager::allocate_memory(device_t &dev, int spacenum, std::string name, u8 width, size_t bytes)
 {
+	void *const ptr = block_alloc(dev, name, bytes);
+	machine().save().save_memory(&dev, "memory", dev.tag(), spacenum, name.c_str(), ptr, width/8, u32(bytes) / (width/8));
+	return ptr;
+}
+
+
+//-------------------------------------------------
+//  block_alloc - allocate zero-filled memory
+//  that lives until exit
+//-------------------------------------------------
+
+void *memory_manager::block_alloc(device_t &dev, std::string_view name, size_t bytes)
+{
+	// large blocks of emulated RAM are accessed all over, so put them on huge pages to cut TLB misses if requested
+	u64 const threshold = u64(machine().options().ram_huge_pages()) << 20;
+	if (threshold && (bytes >= threshold))
+	{
+		auto block = std::make_unique<osd::large_page_allocation>(bytes);
+		if (*block)
+		{
+			// touch every page now, so the host has decided how to back them by the time they're counted
+			void *const ptr = block->get();
+			memset(ptr, 0, bytes);
+			osd_printf_verbose("%s %s: %u KB aligned to %u KB pages, %u KB on huge pages\n",
+					dev.tag(), name, bytes >> 10, block->page_size() >> 10, block->huge_page_bytes() >> 10);
+			m_largeblocks.emplace_back(std::move(block));
+			return ptr;
+		}
+		osd_printf_verbose("%s %s: Huge pages not available\n", dev.tag(), name);
+	}
+
 	void *const ptr = m_datablocks.emplace_back(malloc(bytes)).get();
 	memset(ptr, 0, bytes);
-	machine().save().save_memory(&dev, "memory", dev.tag(), spacenum, name.c_str(), ptr, width/8, u32(bytes) / (width/8));
 	return ptr;
 }
 
@@ -968,7 +1014,8 @@ memory_passthrough_handler address_space_installer::install_readwrite_tap(offs_t
 
 memory_bank::memory_bank(device_t &device, std::string tag)
 	: m_machine(device.machine()),
-	  m_curentry(0)
+	  m_curentry(0),
+	  m_switches(0)
 {
 	m_tag = std::move(tag);
 	m_name = string_format("Bank '%s'", m_tag);
@@ -982,6 +1029,8 @@ memory_bank::memory_bank(device_t &device, std::string tag)
 
 memory_bank::~memory_bank()
 {
+	if (m_switches)
+		osd_printf_verbose("%s: %u switches\n", m_name, m_switches);
 }
 
 
@@ -1020,6 +1069,9 @@ void memory_bank::set_entry(int entrynum)
 	if (m_entries[entrynum] == nullptr)
 		throw emu_fatalerror("memory_bank::set_entry called for bank '%s' with invalid bank entry %d", m_tag, entrynum);
 
+	// bank handlers read the base on every access, so nothing else needs to know
+	if (entrynum != m_curentry)
+		m_switches++;
 	m_curentry = entrynum;
 }
 
@@ -1070,6 +1122,8 @@ memory_region::memory_region(running_machine &machine, std::string name, u32 len
 	: m_machine(machine),
 		m_name(std::move(name)),
 		m_buffer(length),
+		m_base(length ? &m_buffer[0] : nullptr),
+		m_length(length),
 		m_endianness(endian),
 		m_bitwidth(width * 8),
 		m_bytewidth(width)
@@ -1077,6 +1131,20 @@ memory_region::memory_region(running_machine &machine, std::string name, u32 len
 	assert(width == 1 || width == 2 || width == 4 || width == 8);
 }
 
+memory_region::~memory_region()
+{
+}
+
+void memory_region::set_view(std::unique_ptr<osd::mapped_file_view> &&view)
+{
+	assert(view && (view->size() >= m_length));
+
+	// the view must already hold the contents; only pages later written become private
+	m_view = std::move(view);
+	m_base = reinterpret_cast<u8 *>(m_view->get());
+	std::vector<u8>().swap(m_buffer);
+}
+
 std::string memory_share::compare(u8 width, size_t bytes, endianness_t endianness) const
 {
 	if (width != m_bitwidth)
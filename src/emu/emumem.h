@@ -19,6 +19,7 @@
 
 #include "notifier.h"
 
+#include <algorithm>
 #include <optional>
 #include <set>
 #include <type_traits>
@@ -509,9 +510,13 @@ template<> struct handler_entry_size<3> { using type = u64; };
 
 // =====================-> Address segmentation for the search tree
 
+// Spaces of up to 16 address bits use a single flat table with one
+// entry per bus unit, so 8-bit CPUs reach their handler with one
+// lookup; wider spaces are split at bit 14 and above.
+
 constexpr int handler_entry_dispatch_level(int highbits)
 {
-	return (highbits > 48) ? 3 : (highbits > 32) ? 2 : (highbits > 14) ? 1 : 0;
+	return (highbits > 48) ? 3 : (highbits > 32) ? 2 : (highbits > 16) ? 1 : 0;
 }
 
 constexpr int handler_entry_dispatch_level_to_lowbits(int level, int width, int ashift)
@@ -523,7 +528,7 @@ constexpr int handler_entry_dispatch_lowbits(int highbits, int width, int ashift
 {
 	return (highbits > 48) ? 48 :
 		(highbits > 32) ? 32 :
-		(highbits > 14) ? 14 :
+		(highbits > 16) ? 14 :
 		width + ashift;
 }
 
@@ -689,6 +694,7 @@ public:
 	virtual u16 lookup_flags(offs_t offset, uX mem_mask) const = 0;
 	virtual void *get_ptr(offs_t offset) const;
 	virtual void lookup(offs_t address, offs_t &start, offs_t &end, handler_entry_read<Width, AddrShift> *&handler) const;
+	virtual const u32 *lookup_version(offs_t address) const;
 
 	inline void populate(offs_t start, offs_t end, offs_t mirror, handler_entry_read<Width, AddrShift> *handler) {
 		start &= ~NATIVE_MASK;
@@ -764,6 +770,7 @@ public:
 	virtual u16 lookup_flags(offs_t offset, uX mem_mask) const = 0;
 	virtual void *get_ptr(offs_t offset) const;
 	virtual void lookup(offs_t address, offs_t &start, offs_t &end, handler_entry_write<Width, AddrShift> *&handler) const;
+	virtual const u32 *lookup_version(offs_t address) const;
 
 	inline void populate(offs_t start, offs_t end, offs_t mirror, handler_entry_write<Width, AddrShift> *handler) {
 		start &= ~NATIVE_MASK;
@@ -845,6 +852,25 @@ constexpr offs_t memory_offset_to_byte(offs_t offset, int AddrShift) { return Ad
 
 // ======================> generic read/write decomposition routines
 
+// set to 1 to check that the aligned wide access fast paths only see
+// addresses aligned to the bus, falling back to the general code if not
+#define MEMORY_CHECK_WIDE_FASTPATH 0
+
+// true if an access that is aligned and wider than the bus starts on a bus
+// boundary, so the fast path splits it exactly as the general code would
+template<int Width, int AddrShift> inline bool memory_wide_fastpath_ok(offs_t address)
+{
+	if constexpr (MEMORY_CHECK_WIDE_FASTPATH)
+	{
+		if (memory_offset_to_byte(address, AddrShift) & ((1 << Width) - 1))
+		{
+			osd_printf_error("Aligned access wider than the bus at odd address %X\n", address);
+			return false;
+		}
+	}
+	return true;
+}
+
 // generic direct read
 template<int Width, int AddrShift, endianness_t Endian, int TargetWidth, bool Aligned, typename T> emu::detail::handler_entry_size_t<TargetWidth>  memory_read_generic(T rop, offs_t address, emu::detail::handler_entry_size_t<TargetWidth> mask)
 {
@@ -862,6 +888,24 @@ template<int Width, int AddrShift, endianness_t Endian, int TargetWidth, bool Al
 	if (NATIVE_BYTES == TARGET_BYTES && (Aligned || (address & NATIVE_MASK) == 0))
 		return rop(address & ~NATIVE_MASK, mask);
 
+	// wider than native and aligned; every piece lands on a native boundary so all the shifts are constants
+	if constexpr (Aligned && (NATIVE_BYTES < TARGET_BYTES))
+	{
+		if (memory_wide_fastpath_ok<Width, AddrShift>(address))
+		{
+			constexpr u32 SPLITS = TARGET_BYTES / NATIVE_BYTES;
+			TargetType result = 0;
+			address &= ~NATIVE_MASK;
+			for (u32 index = 0; index < SPLITS; index++)
+			{
+				u32 const shift = (Endian == ENDIANNESS_LITTLE) ? (index * NATIVE_BITS) : (TARGET_BITS - NATIVE_BITS - index * NATIVE_BITS);
+				NativeType const curmask = mask >> shift;
+				if (curmask != 0) result |= (TargetType)rop(address + index * NATIVE_STEP, curmask) << shift;
+			}
+			return result;
+		}
+	}
+
 	// if native size is larger, see if we can do a single masked read (guaranteed if we're aligned)
 	if (NATIVE_BYTES > TARGET_BYTES)
 	{
@@ -995,6 +1039,23 @@ template<int Width, int AddrShift, endianness_t Endian, int TargetWidth, bool Al
 	if (NATIVE_BYTES == TARGET_BYTES && (Aligned || (address & NATIVE_MASK) == 0))
 		return wop(address & ~NATIVE_MASK, data, mask);
 
+	// wider than native and aligned; every piece lands on a native boundary so all the shifts are constants
+	if constexpr (Aligned && (NATIVE_BYTES < TARGET_BYTES))
+	{
+		if (memory_wide_fastpath_ok<Width, AddrShift>(address))
+		{
+			constexpr u32 SPLITS = TARGET_BYTES / NATIVE_BYTES;
+			address &= ~NATIVE_MASK;
+			for (u32 index = 0; index < SPLITS; index++)
+			{
+				u32 const shift = (Endian == ENDIANNESS_LITTLE) ? (index * NATIVE_BITS) : (TARGET_BITS - NATIVE_BITS - index * NATIVE_BITS);
+				NativeType const curmask = mask >> shift;
+				if (curmask != 0) wop(address + index * NATIVE_STEP, data >> shift, curmask);
+			}
+			return;
+		}
+	}
+
 	// if native size is larger, see if we can do a single masked write (guaranteed if we're aligned)
 	if (NATIVE_BYTES > TARGET_BYTES)
 	{
@@ -1666,6 +1727,45 @@ template<int Level, int Width, int AddrShift> u16 dispatch_write_flags(offs_t ma
 	return dispatch[(offset & mask) >> LowBits]->write_flags(offset, data, mem_mask);
 }
 
+
+// ======================> Block transfers
+
+// Copy the part of a block that falls in [address, end] of a single
+// handler when that handler is plain memory or a bank.  Returns the
+// number of native units copied, or 0 when it must go through the
+// handler one unit at a time (devices, taps, or memory that is not
+// contiguous over the run).
+
+template<int Width, int AddrShift> u32 memory_read_block_run(const handler_entry_read<Width, AddrShift> *handler, offs_t address, offs_t end, emu::detail::handler_entry_size_t<Width> *data, u32 count)
+{
+	using NativeType = emu::detail::handler_entry_size_t<Width>;
+	static constexpr int StepShift = Width + AddrShift >= 0 ? Width + AddrShift : 0;
+
+	const NativeType *const src = static_cast<const NativeType *>(handler->get_ptr(address));
+	if(!src)
+		return 0;
+	const u32 run = u32(std::min<u64>(count, (u64(end - address) >> StepShift) + 1));
+	if(static_cast<const NativeType *>(handler->get_ptr(address + ((run - 1) << StepShift))) != src + run - 1)
+		return 0;
+	std::memcpy(data, src, run * sizeof(NativeType));
+	return run;
+}
+
+template<int Width, int AddrShift> u32 memory_write_block_run(const handler_entry_write<Width, AddrShift> *handler, offs_t address, offs_t end, const emu::detail::handler_entry_size_t<Width> *data, u32 count)
+{
+	using NativeType = emu::detail::handler_entry_size_t<Width>;
+	static constexpr int StepShift = Width + AddrShift >= 0 ? Width + AddrShift : 0;
+
+	NativeType *const dst = static_cast<NativeType *>(handler->get_ptr(address));
+	if(!dst)
+		return 0;
+	const u32 run = u32(std::min<u64>(count, (u64(end - address) >> StepShift) + 1));
+	if(static_cast<NativeType *>(handler->get_ptr(address + ((run - 1) << StepShift))) != dst + run - 1)
+		return 0;
+	std::memcpy(dst, data, run * sizeof(NativeType));
+	return run;
+}
+
 template<int Level, int Width, int AddrShift> u16 dispatch_lookup_read_flags(offs_t mask, offs_t offset, emu::detail::handler_entry_size_t<Width> mem_mask, const handler_entry_read<Width, AddrShift> *const *dispatch)
 {
 	static constexpr u32 LowBits  = emu::detail::handler_entry_dispatch_level_to_lowbits(Level, Width, AddrShift);
@@ -1870,6 +1970,7 @@ template<int Width, int AddrShift, endianness_t Endian> class memory_access_cach
 	using NativeType = emu::detail::handler_entry_size_t<Width>;
 	static constexpr u32 NATIVE_BYTES = 1 << Width;
 	static constexpr u32 NATIVE_MASK = Width + AddrShift >= 0 ? (1 << (Width + AddrShift)) - 1 : 0;
+	static constexpr int BLOCK_STEP_SHIFT = Width + AddrShift >= 0 ? Width + AddrShift : 0;
 
 public:
 	// construction/destruction
@@ -1882,6 +1983,10 @@ public:
 		  m_addrend_w(0),
 		  m_cache_r(nullptr),
 		  m_cache_w(nullptr),
+		  m_version_r(&UNVERSIONED),
+		  m_version_w(&UNVERSIONED),
+		  m_seen_r(0),
+		  m_seen_w(0),
 		  m_root_read(nullptr),
 		  m_root_write(nullptr)
 	{
@@ -1889,17 +1994,18 @@ public:
 
 	~memory_access_cache();
 
-	// see if an address is within bounds, update it if not
+	// see if an address is within bounds and the views it goes through
+	// haven't switched since, update it if not
 	void check_address_r(offs_t address) {
-		if(address >= m_addrstart_r && address <= m_addrend_r)
+		if(address >= m_addrstart_r && address <= m_addrend_r && *m_version_r == m_seen_r)
 			return;
-		m_root_read->lookup(address, m_addrstart_r, m_addrend_r, m_cache_r);
+		refill_r(address);
 	}
 
 	void check_address_w(offs_t address) {
-		if(address >= m_addrstart_w && address <= m_addrend_w)
+		if(address >= m_addrstart_w && address <= m_addrend_w && *m_version_w == m_seen_w)
 			return;
-		m_root_write->lookup(address, m_addrstart_w, m_addrend_w, m_cache_w);
+		refill_w(address);
 	}
 
 	// accessor methods
@@ -1914,6 +2020,39 @@ public:
 		return m_cache_r->get_ptr(address);
 	}
 
+	// block accessors, on count native units starting at an aligned address;
+	// runs over memory and banks are copied directly, anything else is
+	// accessed one unit at a time
+	void read_block(offs_t address, NativeType *data, u32 count) {
+		while(count) {
+			address &= m_addrmask;
+			check_address_r(address);
+			u32 run = memory_read_block_run<Width, AddrShift>(m_cache_r, address, m_addrend_r, data, count);
+			if(!run) {
+				*data = m_cache_r->read(address, ~NativeType(0));
+				run = 1;
+			}
+			data += run;
+			count -= run;
+			address += run << BLOCK_STEP_SHIFT;
+		}
+	}
+
+	void write_block(offs_t address, const NativeType *data, u32 count) {
+		while(count) {
+			address &= m_addrmask;
+			check_address_w(address);
+			u32 run = memory_write_block_run<Width, AddrShift>(m_cache_w, address, m_addrend_w, data, count);
+			if(!run) {
+				m_cache_w->write(address, *data, ~NativeType(0));
+				run = 1;
+			}
+			data += run;
+			count -= run;
+			address += run << BLOCK_STEP_SHIFT;
+		}
+	}
+
 	auto rop()   { return [this](offs_t offset, NativeType mask) -> NativeType { return read_native(offset, mask); }; }
 	auto ropf()  { return [this](offs_t offset, NativeType mask) -> std::pair<NativeType, u16> { return read_native_flags(offset, mask); }; }
 	auto lropf() { return [this](offs_t offset, NativeType mask) -> u16 { return lookup_read_native_flags(offset, mask); }; }
@@ -2017,12 +2156,22 @@ private:
 	offs_t                      m_addrend_w;               // maximum valid address for writing
 	handler_entry_read <Width, AddrShift> *m_cache_r;  // read cache
 	handler_entry_write<Width, AddrShift> *m_cache_w;  // write cache
+	const u32 *                 m_version_r;               // version of the view the read cache is in
+	const u32 *                 m_version_w;               // version of the view the write cache is in
+	u32                         m_seen_r;                  // view version when the read cache was filled
+	u32                         m_seen_w;                  // view version when the write cache was filled
 
 	handler_entry_read <Width, AddrShift> *m_root_read;  // decode tree roots
 	handler_entry_write<Width, AddrShift> *m_root_write;
 
 	util::notifier_subscription m_subscription;
 
+	// version followed by ranges outside any view, which never changes
+	static constexpr u32 UNVERSIONED = 0;
+
+	void refill_r(offs_t address);
+	void refill_w(offs_t address);
+
 	NativeType read_native(offs_t address, NativeType mask = ~NativeType(0));
 	void write_native(offs_t address, NativeType data, NativeType mask = ~NativeType(0));
 	std::pair<NativeType, u16> read_native_flags(offs_t address, NativeType mask = ~NativeType(0));
@@ -2389,6 +2538,18 @@ public:
 		}
 	}
 
+	// view switches reach the change notifiers like any other change, but
+	// subscribers that only depend on the handlers outside views (or that
+	// compare view versions) can tell them apart and skip them
+	void view_switched();
+	bool switching_view() const { return m_switching_view; }
+	const u32 &view_version() const { return m_view_version; }
+
+	// statistics
+	u64 view_switches() const { return m_view_switches; }
+	u64 cache_misses() const { return m_cache_misses; }
+	void cache_missed() { m_cache_misses++; }
+
 	virtual void validate_reference_counts() const = 0;
 
 	virtual void remove_passthrough(std::unordered_set<handler_entry *> &handlers) = 0;
@@ -2410,6 +2571,10 @@ public:
 	virtual void *get_read_ptr(offs_t address) const = 0;
 	virtual void *get_write_ptr(offs_t address) const = 0;
 
+	// block accessors, on count native-width units in host order starting at an aligned address
+	virtual void read_block(offs_t address, void *data, u32 count) = 0;
+	virtual void write_block(offs_t address, const void *data, u32 count) = 0;
+
 	// read accessors
 	virtual u8 read_byte(offs_t address) = 0;
 	virtual u16 read_word(offs_t address) = 0;
@@ -2478,6 +2643,10 @@ protected:
 
 	util::notifier<read_or_write> m_notifiers;  // notifier list for address map change
 	u32                     m_in_notification;  // notification(s) currently being done
+	bool                    m_switching_view;   // notifying a view switch?
+	u32                     m_view_version;     // bumped whenever any view in the space switches
+	u64                     m_view_switches;    // number of view switches
+	u64                     m_cache_misses;     // number of cache refills
 
 	// passthrough handler used for wait states
 	std::shared_ptr<emu::detail::memory_passthrough_handler_impl> m_default_mpl;
@@ -2498,6 +2667,7 @@ public:
 	running_machine &machine() const { return m_machine; }
 	int entry() const { return m_curentry; }
 	void *base() const { return m_entries.empty() ? nullptr : m_entries[m_curentry]; }
+	u64 switches() const { return m_switches; }
 	const std::string &tag() const { return m_tag; }
 	const std::string &name() const { return m_name; }
 
@@ -2514,6 +2684,7 @@ private:
 	running_machine &       m_machine;              // need the machine to free our memory
 	std::vector<u8 *>       m_entries;              // the entries
 	int                     m_curentry;             // current entry
+	u64                     m_switches;             // number of entry changes
 	std::string             m_name;                 // friendly name for this bank
 	std::string             m_tag;                  // tag for this bank
 };
@@ -2566,13 +2737,18 @@ class memory_region
 public:
 	// construction/destruction
 	memory_region(running_machine &machine, std::string name, u32 length, u8 width, endianness_t endian);
+	~memory_region();
 
 	// getters
 	running_machine &machine() const { return m_machine; }
-	u8 *base() { return (m_buffer.size() > 0) ? &m_buffer[0] : nullptr; }
-	u8 *end() { return base() + m_buffer.size(); }
-	u32 bytes() const { return m_buffer.size(); }
+	u8 *base() { return m_base; }
+	u8 *end() { return m_base + m_length; }
+	u32 bytes() const { return m_length; }
 	const std::string &name() const { return m_name; }
+	bool mapped() const { return bool(m_view); }
+
+	// switch to a copy-on-write view of a file holding the same contents
+	void set_view(std::unique_ptr<osd::mapped_file_view> &&view);
 
 	// flag expansion
 	endianness_t endianness() const { return m_endianness; }
@@ -2580,7 +2756,7 @@ public:
 	u8 bytewidth() const { return m_bytewidth; }
 
 	// data access
-	u8 &as_u8(offs_t offset = 0) { return m_buffer[offset]; }
+	u8 &as_u8(offs_t offset = 0) { return m_base[offset]; }
 	u16 &as_u16(offs_t offset = 0) { return reinterpret_cast<u16 *>(base())[offset]; }
 	u32 &as_u32(offs_t offset = 0) { return reinterpret_cast<u32 *>(base())[offset]; }
 	u64 &as_u64(offs_t offset = 0) { return reinterpret_cast<u64 *>(base())[offset]; }
@@ -2590,6 +2766,9 @@ private:
 	running_machine &       m_machine;
 	std::string             m_name;
 	std::vector<u8>         m_buffer;
+	std::unique_ptr<osd::mapped_file_view> m_view;
+	u8 *                    m_base;
+	u32                     m_length;
 	endianness_t            m_endianness;
 	u8                      m_bitwidth;
 	u8                      m_bytewidth;
@@ -2647,6 +2826,7 @@ public:
 	void disable();
 
 	std::optional<int> entry() const { return m_cur_id == -1 ? std::optional<int>() : m_cur_slot; }
+	const u32 &version() const { return m_version; }
 
 	const std::string &name() const { return m_name; }
 
@@ -2664,6 +2844,7 @@ private:
 	handler_entry *                                 m_handler_write;
 	int                                             m_cur_id;
 	int                                             m_cur_slot;
+	u32                                             m_version;
 	std::string                                     m_context;
 
 	void initialize_from_address_map(offs_t addrstart, offs_t addrend, const address_space_config &config);
@@ -2671,6 +2852,7 @@ private:
 	void make_subdispatch(std::string context);
 	int id_to_slot(int id) const;
 	void register_state();
+	void switched();
 };
 
 
@@ -2693,6 +2875,8 @@ public:
 	// getters
 	running_machine &machine() const { return m_machine; }
 
+	memory_profiler &profiler() const { return *m_profiler; }
+
 	// used for the debugger interface memory views
 	const std::unordered_map<std::string, std::unique_ptr<memory_bank>> &banks() const { return m_banklist; }
 	const std::unordered_map<std::string, std::unique_ptr<memory_region>> &regions() const { return m_regionlist; }
@@ -2701,6 +2885,9 @@ public:
 	// anonymous memory zones
 	void *anonymous_alloc(address_space &space, size_t bytes, u8 width, offs_t start, offs_t end, const std::string &key = "");
 
+	// zero-filled memory freed on exit, on huge pages if it's at least the size given by -ram_huge_pages
+	void *block_alloc(device_t &dev, std::string_view name, size_t bytes);
+
 	// shares
 	memory_share *share_alloc(device_t &dev, std::string name, u8 width, size_t bytes, endianness_t endianness);
 	memory_share *share_find(std::string name);
@@ -2721,9 +2908,11 @@ private:
 	running_machine &           m_machine;              // reference to the machine
 
 	std::vector<std::unique_ptr<void, stdlib_deleter>>               m_datablocks;           // list of memory blocks to free on exit
+	std::vector<std::unique_ptr<osd::large_page_allocation>>         m_largeblocks;          // list of blocks on huge pages to free on exit
 	std::unordered_map<std::string, std::unique_ptr<memory_bank>>    m_banklist;             // map of banks
 	std::unordered_map<std::string, std::unique_ptr<memory_share>>   m_sharelist;            // map of shares
 	std::unordered_map<std::string, std::unique_ptr<memory_region>>  m_regionlist;           // map of memory regions
+	std::unique_ptr<memory_profiler>                                  m_profiler;             // sampling access profiler
 
 	// Allocate the address spaces
 	void allocate(device_memory_interface &memory);
@@ -2785,6 +2974,28 @@ write_native(offs_t address, emu::detail::handler_entry_size_t<Width> data, emu:
 	m_cache_w->write(address, data, mask);
 }
 
+template<int Width, int AddrShift, endianness_t Endian>
+void emu::detail::memory_access_cache<Width, AddrShift, Endian>::
+refill_r(offs_t address)
+{
+	m_root_read->lookup(address, m_addrstart_r, m_addrend_r, m_cache_r);
+	const u32 *version = m_root_read->lookup_version(address);
+	m_version_r = version ? version : &UNVERSIONED;
+	m_seen_r = *m_version_r;
+	m_space->cache_missed();
+}
+
+template<int Width, int AddrShift, endianness_t Endian>
+void emu::detail::memory_access_cache<Width, AddrShift, Endian>::
+refill_w(offs_t address)
+{
+	m_root_write->lookup(address, m_addrstart_w, m_addrend_w, m_cache_w);
+	const u32 *version = m_root_write->lookup_version(address);
+	m_version_w = version ? version : &UNVERSIONED;
+	m_seen_w = *m_version_w;
+	m_space->cache_missed();
+}
+
 inline void emu::detail::memory_passthrough_handler_impl::remove()
 {
 	m_space.remove_passthrough(m_handlers);
@@ -2811,6 +3022,9 @@ set(address_space *space, std::pair<void *, void *> rw)
 
 	m_subscription = space->add_change_notifier(
 			[this] (read_or_write mode) {
+			   // view switches are caught by the version check
+			   if(m_space->switching_view())
+				   return;
 			   if(u32(mode) & u32(read_or_write::READ)) {
 				   m_addrend_r = 0;
 				   m_addrstart_r = 1;
@@ -2832,6 +3046,10 @@ set(address_space *space, std::pair<void *, void *> rw)
 	m_addrstart_w = 1;
 	m_addrend_w = 0;
 	m_cache_w = nullptr;
+	m_version_r = &UNVERSIONED;
+	m_version_w = &UNVERSIONED;
+	m_seen_r = 0;
+	m_seen_w = 0;
 }
 
 template<int Width, int AddrShift, endianness_t Endian>
@@ -341,6 +341,50 @@ public:
 		return m_root_write->get_ptr(address);
 	}
 
+	// block read, copying directly from memory and banks
+	virtual void read_block(offs_t address, void *data, u32 count) override
+	{
+		NativeType *dest = static_cast<NativeType *>(data);
+		while(count)
+		{
+			address &= m_addrmask;
+			offs_t start, end;
+			handler_entry_read<Width, AddrShift> *handler;
+			m_root_read->lookup(address, start, end, handler);
+			u32 run = memory_read_block_run<Width, AddrShift>(handler, address, end, dest, count);
+			if(!run)
+			{
+				*dest = handler->read(address, ~NativeType(0));
+				run = 1;
+			}
+			dest += run;
+			count -= run;
+			address += run * NATIVE_STEP;
+		}
+	}
+
+	// block write, copying directly to memory and banks
+	virtual void write_block(offs_t address, const void *data, u32 count) override
+	{
+		const NativeType *src = static_cast<const NativeType *>(data);
+		while(count)
+		{
+			address &= m_addrmask;
+			offs_t start, end;
+			handler_entry_write<Width, AddrShift> *handler;
+			m_root_write->lookup(address, start, end, handler);
+			u32 run = memory_write_block_run<Width, AddrShift>(handler, address, end, src, count);
+			if(!run)
+			{
+				handler->write(address, *src, ~NativeType(0));
+				run = 1;
+			}
+			src += run;
+			count -= run;
+			address += run * NATIVE_STEP;
+		}
+	}
+
 	// native read
 	NativeType read_native(offs_t offset, NativeType mask)
 	{
@@ -614,6 +658,10 @@ address_space::address_space(memory_manager &manager, device_memory_interface &m
 		m_log_unmap(true),
 		m_name(memory.space_config(spacenum)->name()),
 		m_in_notification(0),
+		m_switching_view(false),
+		m_view_version(0),
+		m_view_switches(0),
+		m_cache_misses(0),
 		m_default_mpl(make_mph(nullptr))
 {
 }
@@ -625,6 +673,9 @@ address_space::address_space(memory_manager &manager, device_memory_interface &m
 
 address_space::~address_space()
 {
+	if(m_view_switches)
+		osd_printf_verbose("%s '%s': %u view switches, %u cache refills\n", m_device.tag(), m_name, m_view_switches, m_cache_misses);
+
 	m_unmap_r->unref();
 	m_unmap_w->unref();
 	m_nop_r->unref();
@@ -1291,3 +1342,14 @@ util::notifier_subscription address_space::add_change_notifier(delegate<void (re
 {
 	return m_notifiers.subscribe(std::move(n));
 }
+
+void address_space::view_switched()
+{
+	m_view_version++;
+	m_view_switches++;
+
+	bool const old = m_switching_view;
+	m_switching_view = true;
+	invalidate_caches(read_or_write::READWRITE);
+	m_switching_view = old;
+}
@@ -27,6 +27,7 @@ public:
 	u16 lookup_flags(offs_t offset, uX mem_mask) const override;
 	void *get_ptr(offs_t offset) const override;
 	void lookup(offs_t address, offs_t &start, offs_t &end, handler_entry_read<Width, AddrShift> *&handler) const override;
+	const u32 *lookup_version(offs_t address) const override;
 
 	offs_t dispatch_entry(offs_t address) const override;
 	void dump_map(std::vector<memory_entry> &map) const override;
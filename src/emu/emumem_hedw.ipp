@@ -169,6 +169,18 @@ template<int HighBits, int Width, int AddrShift> void handler_entry_write_dispat
 	}
 }
 
+template<int HighBits, int Width, int AddrShift> const u32 *handler_entry_write_dispatch<HighBits, Width, AddrShift>::lookup_version(offs_t address) const
+{
+	offs_t slot = (address >> LowBits) & BITMASK;
+	auto h = m_a_dispatch[slot];
+	const u32 *inner = (h->is_dispatch() || h->is_view()) ? h->lookup_version(address) : nullptr;
+	if(!m_view)
+		return inner;
+
+	// a view inside another one is followed by the space-wide version
+	return inner ? &this->m_space->view_version() : &m_view->version();
+}
+
 template<int HighBits, int Width, int AddrShift> void handler_entry_write_dispatch<HighBits, Width, AddrShift>::range_cut_before(offs_t address, int start)
 {
 	while(--start >= 0 && m_u_dispatch[start]) {
@@ -488,7 +488,7 @@ std::string memory_view::memory_view_entry::key() const
 }
 
 
-memory_view::memory_view(device_t &device, std::string name) : m_device(device), m_name(name), m_config(nullptr), m_addrstart(0), m_addrend(0), m_space(nullptr), m_handler_read(nullptr), m_handler_write(nullptr), m_cur_id(-1), m_cur_slot(-1)
+memory_view::memory_view(device_t &device, std::string name) : m_device(device), m_name(name), m_config(nullptr), m_addrstart(0), m_addrend(0), m_space(nullptr), m_handler_read(nullptr), m_handler_write(nullptr), m_cur_id(-1), m_cur_slot(-1), m_version(0)
 {
 	device.view_register(this);
 }
@@ -505,7 +505,15 @@ void memory_view::register_state()
 {
 	m_device.machine().save().save_item(&m_device, "view", m_device.subtag(m_name).c_str(), 0, NAME(m_cur_slot));
 	m_device.machine().save().save_item(&m_device, "view", m_device.subtag(m_name).c_str(), 0, NAME(m_cur_id));
-	m_device.machine().save().register_postload(save_prepost_delegate(NAME([this]() { m_handler_read->select_a(m_cur_id); m_handler_write->select_a(m_cur_id); })));
+	m_device.machine().save().register_postload(save_prepost_delegate(NAME([this]() { m_handler_read->select_a(m_cur_id); m_handler_write->select_a(m_cur_id); switched(); })));
+}
+
+void memory_view::switched()
+{
+	// caches into the view see the version change on their next access
+	m_version++;
+	if(m_space)
+		m_space->view_switched();
 }
 
 void memory_view::disable()
@@ -514,9 +522,7 @@ void memory_view::disable()
 	m_cur_id = -1;
 	m_handler_read->select_a(-1);
 	m_handler_write->select_a(-1);
-
-	if(m_space)
-		m_space->invalidate_caches(read_or_write::READWRITE);
+	switched();
 }
 
 void memory_view::select(int slot)
@@ -529,9 +535,7 @@ void memory_view::select(int slot)
 	m_cur_id = i->second;
 	m_handler_read->select_a(m_cur_id);
 	m_handler_write->select_a(m_cur_id);
-
-	if(m_space)
-		m_space->invalidate_caches(read_or_write::READWRITE);
+	switched();
 }
 
 int memory_view::id_to_slot(int id) const
@@ -64,19 +64,33 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DIFF_DIRECTORY,                             "diff",      core_options::option_type::PATH,       "directory to save hard drive image difference files" },
 	{ OPTION_COMMENT_DIRECTORY,                          "comments",  core_options::option_type::PATH,       "directory to save debugger comments" },
 	{ OPTION_SHARE_DIRECTORY,                            "share",     core_options::option_type::PATH,       "directory to share with emulated machines" },
+	{ OPTION_DRC_CACHE_DIRECTORY,                        "drccache",  core_options::option_type::PATH,       "directory to save persistent DRC translation caches" },
+	{ OPTION_ROM_SHARE_DIRECTORY,                        "romshare",  core_options::option_type::PATH,       "directory to save ROM region images shared between instances" },
 
 	// state/playback options
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE STATE/PLAYBACK OPTIONS" },
 	{ OPTION_STATE,                                      nullptr,     core_options::option_type::STRING,     "saved state to load" },
 	{ OPTION_AUTOSAVE,                                   "0",         core_options::option_type::BOOLEAN,    "automatically restore state on start and save on exit for supported systems" },
+	{ OPTION_WARM_STATE,                                 nullptr,     core_options::option_type::STRING,     "state to start from, skipping verification of unchanged ROMs; saved on exit if it doesn't exist" },
+	{ OPTION_FORK_SERVER,                                nullptr,     core_options::option_type::STRING,     "local socket to serve copies of the started machine on" },
 	{ OPTION_REWIND,                                     "0",         core_options::option_type::BOOLEAN,    "enable rewind savestates" },
 	{ OPTION_REWIND_CAPACITY "(1-2048)",                 "100",       core_options::option_type::INTEGER,    "rewind buffer size in megabytes" },
+	{ OPTION_RUNAHEAD "(0-8)",                           "0",         core_options::option_type::INTEGER,    "number of frames to emulate ahead of the displayed one, to hide input lag" },
+	{ OPTION_DETERMINISTIC,                              "0",         core_options::option_type::BOOLEAN,    "run exactly the same way on every host: draw every frame, run devices on one thread and use a fixed date and time" },
+	{ OPTION_STATE_HASH_LOG,                             nullptr,     core_options::option_type::PATH,       "write a hash of the machine state for every frame to this file, for finding where two runs diverge" },
 	{ OPTION_PLAYBACK ";pb",                             nullptr,     core_options::option_type::STRING,     "playback an input file" },
 	{ OPTION_RECORD ";rec",                              nullptr,     core_options::option_type::STRING,     "record an input file" },
 	{ OPTION_EXIT_AFTER_PLAYBACK,                        "0",         core_options::option_type::BOOLEAN,    "close the program at the end of playback" },
+	{ OPTION_RECORD_KEYFRAME,                            "0",         core_options::option_type::INTEGER,    "record an indexed input file with a saved state keyframe every this many emulated seconds; 0 records the older format" },
+	{ OPTION_PLAYBACK_KEYFRAME,                          "0",         core_options::option_type::INTEGER,    "keyframe of an indexed input file to start playback from" },
+	{ OPTION_PLAYBACK_KEYFRAMES,                         "0",         core_options::option_type::INTEGER,    "stop playback after this many keyframes; 0 plays to the end" },
 
 	{ OPTION_MNGWRITE,                                   nullptr,     core_options::option_type::PATH,       "optional filename to write a MNG movie of the current session" },
 	{ OPTION_AVIWRITE,                                   nullptr,     core_options::option_type::PATH,       "optional filename to write an AVI movie of the current session" },
+	{ OPTION_MOVIE_QUEUE,                                "8",         core_options::option_type::INTEGER,    "number of movie frames that can wait to be encoded on a worker thread (0 = encode on the emulation thread)" },
+	{ OPTION_MOVIE_DROP,                                 "0",         core_options::option_type::BOOLEAN,    "repeat the previous movie frame instead of waiting when the encoder falls behind" },
+	{ OPTION_SHM_EXPORT,                                 nullptr,     core_options::option_type::STRING,     "name of a shared memory region to publish rendered frames and sound in, for other processes to read" },
+	{ OPTION_SHM_EXPORT_FRAMES,                          "4",         core_options::option_type::INTEGER,    "number of frames the shared memory export holds (minimum 2)" },
 	{ OPTION_WAVWRITE,                                   nullptr,     core_options::option_type::PATH,       "optional filename to write a WAV file of the current session" },
 	{ OPTION_SNAPNAME,                                   "%g/%i",     core_options::option_type::STRING,     "override of the default snapshot/movie naming; %g == gamename, %i == index" },
 	{ OPTION_SNAPSIZE,                                   "auto",      core_options::option_type::STRING,     "specify snapshot/movie resolution (<width>x<height>) or 'auto' to use minimal size " },
@@ -95,6 +109,10 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       core_options::option_type::FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         core_options::option_type::BOOLEAN,    "automatically adjust emulation speed to keep the emulated refresh rate slower than the host screen" },
 	{ OPTION_LOWLATENCY ";lolat",                        "0",         core_options::option_type::BOOLEAN,    "draws new frame before throttling to reduce input latency" },
+	{ OPTION_HEADLESS,                                   "0",         core_options::option_type::BOOLEAN,    "don't draw screens or the user interface unless a snapshot or frame is requested" },
+	{ OPTION_BENCH_REPORT,                               nullptr,     core_options::option_type::PATH,       "write emulation speed and the profiler breakdown to this file as JSON on exit" },
+	{ OPTION_BENCH_WARMUP,                               "0",         core_options::option_type::INTEGER,    "number of emulated seconds at the start to leave out of -benchreport" },
+	{ OPTION_BENCH_PROFILE,                              "0",         core_options::option_type::BOOLEAN,    "enable the profiler so -benchreport includes a breakdown by subsystem (slows emulation)" },
 
 	// render options
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE RENDER OPTIONS" },
@@ -166,6 +184,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_NATURAL_KEYBOARD ";nat",                    "0",         core_options::option_type::BOOLEAN,    "specifies whether to use a natural keyboard or not" },
 	{ OPTION_JOYSTICK_CONTRADICTORY ";joy_contradictory","0",         core_options::option_type::BOOLEAN,    "enable contradictory direction digital joystick input at the same time" },
 	{ OPTION_COIN_IMPULSE,                               "0",         core_options::option_type::INTEGER,    "set coin impulse time (n<0 disable impulse, n==0 obey driver, 0<n set time n)" },
+	{ OPTION_LATE_INPUT,                                 "0",         core_options::option_type::BOOLEAN,    "sample buttons and switches when the emulated machine reads them, rather than once per frame" },
 
 	// input autoenable options
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE INPUT AUTOMATIC ENABLE OPTIONS" },
@@ -187,6 +206,8 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_UPDATEINPAUSE,                              "0",         core_options::option_type::BOOLEAN,    "keep calling video updates while in pause" },
 	{ OPTION_DEBUGSCRIPT,                                nullptr,     core_options::option_type::PATH,       "script for debugger" },
 	{ OPTION_DEBUGLOG,                                   "0",         core_options::option_type::BOOLEAN,    "write debug console output to debug.log" },
+	{ OPTION_SCHEDSTATS,                                 nullptr,     core_options::option_type::PATH,       "write scheduler statistics to this file at exit (.json for JSON, otherwise CSV)" },
+	{ OPTION_MEMREPORT,                                  nullptr,     core_options::option_type::PATH,       "write a memory footprint report to this file at exit (.json for JSON, otherwise CSV)" },
 
 	// comm options
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE COMM OPTIONS" },
@@ -200,8 +221,21 @@ const options_entry emu_options::s_option_entries[] =
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE MISC OPTIONS" },
 	{ OPTION_DRC,                                        "1",         core_options::option_type::BOOLEAN,    "enable DRC CPU core if available" },
 	{ OPTION_DRC_USE_C,                                  "0",         core_options::option_type::BOOLEAN,    "force DRC to use C backend" },
+	{ OPTION_DRC_UNVERIFIED,                             "0",         core_options::option_type::BOOLEAN,    "also enable DRC CPU cores not yet checked against their interpreters" },
 	{ OPTION_DRC_LOG_UML,                                "0",         core_options::option_type::BOOLEAN,    "write DRC UML disassembly log" },
 	{ OPTION_DRC_LOG_NATIVE,                             "0",         core_options::option_type::BOOLEAN,    "write DRC native disassembly log" },
+	{ OPTION_DRC_OPTIMIZE_UML,                           "0",         core_options::option_type::BOOLEAN,    "run the UML optimization passes on translated DRC blocks" },
+	{ OPTION_DRC_PERSIST,                                "0",         core_options::option_type::BOOLEAN,    "keep translated DRC blocks on disk between runs" },
+	{ OPTION_DRC_HUGE_PAGES,                             "0",         core_options::option_type::BOOLEAN,    "back the DRC code cache with huge pages where supported" },
+	{ OPTION_RAM_HUGE_PAGES "(0-4096)",                  "0",         core_options::option_type::INTEGER,    "back emulated RAM shares and RAM devices of at least this many MB with huge pages where supported (0 = off)" },
+	{ OPTION_FPU_NATIVE,                                 "0",         core_options::option_type::BOOLEAN,    "use host floating point for FPU operations it rounds the same way as the emulated FPU" },
+	{ OPTION_FPU_NATIVE_CHECK,                           "0",         core_options::option_type::BOOLEAN,    "with fpu_native, also run SoftFloat and log any operation whose result or flags differ" },
+	{ OPTION_ROM_SHARE,                                  "0",         core_options::option_type::BOOLEAN,    "map loaded ROM regions from files so instances running the same system share the memory" },
+	{ OPTION_FAST_RESTART,                               "0",         core_options::option_type::BOOLEAN,    "keep loaded ROM regions in memory so a hard reset reuses those whose files haven't changed" },
+	{ OPTION_HASH_CACHE,                                 "",          core_options::option_type::PATH,       "file recording hashes of ROMs in archives, so they aren't hashed again until the archive changes" },
+	{ OPTION_SOFTLIST_CACHE,                             "",          core_options::option_type::PATH,       "directory for pre-parsed, indexed copies of software lists, so they aren't parsed again until the XML changes" },
+	{ OPTION_ARCHIVE_INDEX,                              "",          core_options::option_type::PATH,       "file recording the contents of archives in the search paths, so archives that can't hold a file aren't opened" },
+	{ OPTION_DECRYPT_CACHE,                              "",          core_options::option_type::PATH,       "directory for decrypted copies of encrypted program ROMs, so they aren't decrypted again until the ROM changes" },
 	{ OPTION_BIOS,                                       nullptr,     core_options::option_type::STRING,     "select the system BIOS to use" },
 	{ OPTION_CHEAT ";c",                                 "0",         core_options::option_type::BOOLEAN,    "enable cheat subsystem" },
 	{ OPTION_SKIP_GAMEINFO,                              "0",         core_options::option_type::BOOLEAN,    "skip displaying the system information screen at startup" },
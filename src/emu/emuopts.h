@@ -48,17 +48,31 @@
 #define OPTION_DIFF_DIRECTORY       "diff_directory"
 #define OPTION_COMMENT_DIRECTORY    "comment_directory"
 #define OPTION_SHARE_DIRECTORY      "share_directory"
+#define OPTION_DRC_CACHE_DIRECTORY  "drc_cache_directory"
+#define OPTION_ROM_SHARE_DIRECTORY  "rom_share_directory"
 
 // core state/playback options
 #define OPTION_STATE                "state"
 #define OPTION_AUTOSAVE             "autosave"
+#define OPTION_WARM_STATE           "warmstate"
+#define OPTION_FORK_SERVER          "forkserver"
 #define OPTION_REWIND               "rewind"
 #define OPTION_REWIND_CAPACITY      "rewind_capacity"
+#define OPTION_RUNAHEAD             "runahead"
+#define OPTION_DETERMINISTIC        "deterministic"
+#define OPTION_STATE_HASH_LOG       "statehashlog"
 #define OPTION_PLAYBACK             "playback"
 #define OPTION_RECORD               "record"
 #define OPTION_EXIT_AFTER_PLAYBACK  "exit_after_playback"
+#define OPTION_RECORD_KEYFRAME      "record_keyframe"
+#define OPTION_PLAYBACK_KEYFRAME    "playback_keyframe"
+#define OPTION_PLAYBACK_KEYFRAMES   "playback_keyframes"
 #define OPTION_MNGWRITE             "mngwrite"
 #define OPTION_AVIWRITE             "aviwrite"
+#define OPTION_MOVIE_QUEUE          "moviequeue"
+#define OPTION_MOVIE_DROP           "moviedrop"
+#define OPTION_SHM_EXPORT           "shmexport"
+#define OPTION_SHM_EXPORT_FRAMES    "shmexportframes"
 #define OPTION_WAVWRITE             "wavwrite"
 #define OPTION_SNAPNAME             "snapname"
 #define OPTION_SNAPSIZE             "snapsize"
@@ -76,6 +90,10 @@
 #define OPTION_SPEED                "speed"
 #define OPTION_REFRESHSPEED         "refreshspeed"
 #define OPTION_LOWLATENCY           "lowlatency"
+#define OPTION_HEADLESS             "headless"
+#define OPTION_BENCH_REPORT         "benchreport"
+#define OPTION_BENCH_WARMUP         "benchwarmup"
+#define OPTION_BENCH_PROFILE        "benchprofile"
 
 // core render options
 #define OPTION_KEEPASPECT           "keepaspect"
@@ -140,6 +158,7 @@
 #define OPTION_NATURAL_KEYBOARD     "natural"
 #define OPTION_JOYSTICK_CONTRADICTORY   "joystick_contradictory"
 #define OPTION_COIN_IMPULSE         "coin_impulse"
+#define OPTION_LATE_INPUT           "late_input"
 
 // input autoenable options
 #define OPTION_PADDLE_DEVICE        "paddle_device"
@@ -159,12 +178,27 @@
 #define OPTION_UPDATEINPAUSE        "update_in_pause"
 #define OPTION_DEBUGSCRIPT          "debugscript"
 #define OPTION_DEBUGLOG             "debuglog"
+#define OPTION_SCHEDSTATS           "schedstats"
+#define OPTION_MEMREPORT            "memreport"
 
 // core misc options
 #define OPTION_DRC                  "drc"
 #define OPTION_DRC_USE_C            "drc_use_c"
+#define OPTION_DRC_UNVERIFIED       "drc_unverified"
 #define OPTION_DRC_LOG_UML          "drc_log_uml"
 #define OPTION_DRC_LOG_NATIVE       "drc_log_native"
+#define OPTION_DRC_OPTIMIZE_UML     "drc_optimize_uml"
+#define OPTION_DRC_PERSIST          "drc_persist"
+#define OPTION_DRC_HUGE_PAGES       "drc_huge_pages"
+#define OPTION_RAM_HUGE_PAGES       "ram_huge_pages"
+#define OPTION_FPU_NATIVE           "fpu_native"
+#define OPTION_FPU_NATIVE_CHECK     "fpu_native_check"
+#define OPTION_ROM_SHARE            "rom_share"
+#define OPTION_FAST_RESTART         "fast_restart"
+#define OPTION_HASH_CACHE           "hash_cache"
+#define OPTION_SOFTLIST_CACHE       "softlist_cache"
+#define OPTION_ARCHIVE_INDEX        "archive_index"
+#define OPTION_DECRYPT_CACHE        "decrypt_cache"
 #define OPTION_BIOS                 "bios"
 #define OPTION_CHEAT                "cheat"
 #define OPTION_SKIP_GAMEINFO        "skip_gameinfo"
@@ -334,17 +368,31 @@ public:
 	const char *diff_directory() const { return value(OPTION_DIFF_DIRECTORY); }
 	const char *comment_directory() const { return value(OPTION_COMMENT_DIRECTORY); }
 	const char *share_directory() const { return value(OPTION_SHARE_DIRECTORY); }
+	const char *drc_cache_directory() const { return value(OPTION_DRC_CACHE_DIRECTORY); }
+	const char *rom_share_directory() const { return value(OPTION_ROM_SHARE_DIRECTORY); }
 
 	// core state/playback options
 	const char *state() const { return value(OPTION_STATE); }
 	bool autosave() const { return bool_value(OPTION_AUTOSAVE); }
+	const char *warm_state() const { return value(OPTION_WARM_STATE); }
+	const char *fork_server() const { return value(OPTION_FORK_SERVER); }
 	int rewind() const { return bool_value(OPTION_REWIND); }
 	int rewind_capacity() const { return int_value(OPTION_REWIND_CAPACITY); }
+	int runahead() const { return int_value(OPTION_RUNAHEAD); }
+	bool deterministic() const { return bool_value(OPTION_DETERMINISTIC); }
+	const char *state_hash_log() const { return value(OPTION_STATE_HASH_LOG); }
 	const char *playback() const { return value(OPTION_PLAYBACK); }
 	const char *record() const { return value(OPTION_RECORD); }
 	bool exit_after_playback() const { return bool_value(OPTION_EXIT_AFTER_PLAYBACK); }
+	int record_keyframe() const { return int_value(OPTION_RECORD_KEYFRAME); }
+	int playback_keyframe() const { return int_value(OPTION_PLAYBACK_KEYFRAME); }
+	int playback_keyframes() const { return int_value(OPTION_PLAYBACK_KEYFRAMES); }
 	const char *mng_write() const { return value(OPTION_MNGWRITE); }
 	const char *avi_write() const { return value(OPTION_AVIWRITE); }
+	int movie_queue() const { return int_value(OPTION_MOVIE_QUEUE); }
+	bool movie_drop() const { return bool_value(OPTION_MOVIE_DROP); }
+	const char *shm_export() const { return value(OPTION_SHM_EXPORT); }
+	int shm_export_frames() const { return int_value(OPTION_SHM_EXPORT_FRAMES); }
 	const char *wav_write() const { return value(OPTION_WAVWRITE); }
 	const char *snap_name() const { return value(OPTION_SNAPNAME); }
 	const char *snap_size() const { return value(OPTION_SNAPSIZE); }
@@ -362,6 +410,10 @@ public:
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return m_refresh_speed; }
 	bool low_latency() const { return bool_value(OPTION_LOWLATENCY); }
+	bool headless() const { return bool_value(OPTION_HEADLESS); }
+	const char *bench_report() const { return value(OPTION_BENCH_REPORT); }
+	int bench_warmup() const { return int_value(OPTION_BENCH_WARMUP); }
+	bool bench_profile() const { return bool_value(OPTION_BENCH_PROFILE); }
 
 	// core render options
 	bool keep_aspect() const { return bool_value(OPTION_KEEPASPECT); }
@@ -434,6 +486,7 @@ public:
 	bool natural_keyboard() const { return bool_value(OPTION_NATURAL_KEYBOARD); }
 	bool joystick_contradictory() const { return m_joystick_contradictory; }
 	int coin_impulse() const { return m_coin_impulse; }
+	bool late_input() const { return bool_value(OPTION_LATE_INPUT); }
 
 	// core debugging options
 	bool log() const { return bool_value(OPTION_LOG); }
@@ -443,12 +496,27 @@ public:
 	const char *debug_script() const { return value(OPTION_DEBUGSCRIPT); }
 	bool update_in_pause() const { return bool_value(OPTION_UPDATEINPAUSE); }
 	bool debuglog() const { return bool_value(OPTION_DEBUGLOG); }
+	const char *sched_stats() const { return value(OPTION_SCHEDSTATS); }
+	const char *mem_report() const { return value(OPTION_MEMREPORT); }
 
 	// core misc options
 	bool drc() const { return bool_value(OPTION_DRC); }
 	bool drc_use_c() const { return bool_value(OPTION_DRC_USE_C); }
+	bool drc_unverified() const { return bool_value(OPTION_DRC_UNVERIFIED); }
 	bool drc_log_uml() const { return bool_value(OPTION_DRC_LOG_UML); }
 	bool drc_log_native() const { return bool_value(OPTION_DRC_LOG_NATIVE); }
+	bool drc_optimize_uml() const { return bool_value(OPTION_DRC_OPTIMIZE_UML); }
+	bool drc_persist() const { return bool_value(OPTION_DRC_PERSIST); }
+	bool drc_huge_pages() const { return bool_value(OPTION_DRC_HUGE_PAGES); }
+	int ram_huge_pages() const { return int_value(OPTION_RAM_HUGE_PAGES); }
+	bool fpu_native() const { return bool_value(OPTION_FPU_NATIVE); }
+	bool fpu_native_check() const { return bool_value(OPTION_FPU_NATIVE_CHECK); }
+	bool rom_share() const { return bool_value(OPTION_ROM_SHARE); }
+	bool fast_restart() const { return bool_value(OPTION_FAST_RESTART); }
+	const char *hash_cache() const { return value(OPTION_HASH_CACHE); }
+	const char *softlist_cache() const { return value(OPTION_SOFTLIST_CACHE); }
+	const char *archive_index() const { return value(OPTION_ARCHIVE_INDEX); }
+	const char *decrypt_cache() const { return value(OPTION_DECRYPT_CACHE); }
 	const char *bios() const { return value(OPTION_BIOS); }
 	bool cheat() const { return bool_value(OPTION_CHEAT); }
 	bool skip_gameinfo() const { return bool_value(OPTION_SKIP_GAMEINFO); }
@@ -112,9 +112,12 @@ palette_device::palette_device(const machine_config &mconfig, const char *tag, d
 	, m_membits_supplied(false)
 	, m_endianness()
 	, m_endianness_supplied(false)
+	, m_deferred(false)
 	, m_prom_region(*this, finder_base::DUMMY_TAG)
 	, m_init(*this)
 	, m_raw_to_rgb()
+	, m_dirty_min(~u32(0))
+	, m_dirty_max(0)
 {
 }
 
@@ -380,8 +383,19 @@ inline void palette_device::update_for_write(offs_t byte_offset, int bytes_modif
 	assert(bpe != 0);
 	int count = (bytes_modified + bpe - 1) / bpe;
 
-	// for each entry modified, fetch the palette data and set the pen color or indirect color
+	// in deferred mode, just note which entries need converting
 	offs_t base = byte_offset / bpe;
+	if (m_deferred)
+	{
+		for (offs_t entry = base; entry < base + count; entry++)
+			m_dirty[entry / 32] |= u32(1) << (entry % 32);
+		m_dirty_min = std::min<u32>(m_dirty_min, base / 32);
+		m_dirty_max = std::max<u32>(m_dirty_max, (base + count - 1) / 32);
+		set_pending();
+		return;
+	}
+
+	// for each entry modified, fetch the palette data and set the pen color or indirect color
 	for (int index = 0; index < count; index++)
 	{
 		if (indirect)
@@ -392,6 +406,35 @@ inline void palette_device::update_for_write(offs_t byte_offset, int bytes_modif
 }
 
 
+//-------------------------------------------------
+//  palette_update_pending - in deferred mode,
+//  convert every entry written since the last
+//  time the colors were used
+//-------------------------------------------------
+
+void palette_device::palette_update_pending()
+{
+	bool const indirect = m_indirect_entries != 0;
+	for (u32 word = m_dirty_min; word <= m_dirty_max; word++)
+	{
+		u32 bits = m_dirty[word];
+		m_dirty[word] = 0;
+		for (pen_t entry = word * 32; bits != 0; entry++, bits >>= 1)
+		{
+			if (BIT(bits, 0))
+			{
+				if (indirect)
+					set_indirect_color(entry, m_raw_to_rgb(read_entry(entry)));
+				else
+					set_pen_color(entry, m_raw_to_rgb(read_entry(entry)));
+			}
+		}
+	}
+	m_dirty_min = ~u32(0);
+	m_dirty_max = 0;
+}
+
+
 //-------------------------------------------------
 //  write - write a byte to the base paletteram
 //-------------------------------------------------
@@ -537,6 +580,15 @@ void palette_device::device_start()
 				throw emu_fatalerror("palette_device(%s): Improper use of MCFG_PALETTE_ENDIANNESS", tag());
 			m_paletteram.set_endianness(m_endianness);
 		}
+
+		// in deferred mode, keep a bit for every entry the RAM can hold
+		if (m_deferred)
+			m_dirty.resize((m_paletteram.bytes() / m_paletteram.bytes_per_entry() + 31) / 32, 0);
+	}
+	else
+	{
+		// without palette RAM there's nothing to defer
+		m_deferred = false;
 	}
 
 	// call the initialization helper if present
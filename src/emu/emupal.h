@@ -331,6 +331,7 @@ public:
 	template <typename T> palette_device &set_format(T x, u32 entries, u32 indirect) { set_format(x, entries); set_indirect_entries(indirect); return *this; }
 	palette_device &set_membits(int membits) { m_membits = membits; m_membits_supplied = true; return *this; }
 	palette_device &set_endianness(endianness_t endianness) { m_endianness = endianness; m_endianness_supplied = true; return *this; }
+	palette_device &set_deferred(bool deferred) { m_deferred = deferred; return *this; }
 	palette_device &set_entries(u32 entries) { m_entries = entries; return *this; }
 	palette_device &set_entries(u32 entries, u32 indirect) { m_entries = entries; m_indirect_entries = indirect; return *this; }
 	palette_device &set_indirect_entries(u32 entries) { m_indirect_entries = entries; return *this; }
@@ -377,6 +378,7 @@ protected:
 	virtual u32 palette_indirect_entries() const noexcept override { return m_indirect_entries; }
 	virtual bool palette_shadows_enabled() const noexcept override { return m_enable_shadows; }
 	virtual bool palette_hilights_enabled() const noexcept override { return m_enable_hilights; }
+	virtual void palette_update_pending() override;
 
 	// generic palette init routines
 	void palette_init_all_black(palette_device &palette);
@@ -408,6 +410,7 @@ private:
 	bool                m_membits_supplied;     // true if membits forced in static config
 	endianness_t        m_endianness;           // endianness of palette RAM, if different from native
 	bool                m_endianness_supplied;  // true if endianness forced in static config
+	bool                m_deferred;             // convert written entries when next used rather than on write
 	optional_memory_region m_prom_region;       // region where the color PROMs are
 	init_delegate       m_init;
 
@@ -415,6 +418,11 @@ private:
 	raw_to_rgb_converter m_raw_to_rgb;          // format of palette RAM
 	memory_array        m_paletteram;           // base memory
 	memory_array        m_paletteram_ext;       // extended memory
+
+	// deferred updates
+	std::vector<u32>    m_dirty;                // one bit per entry written since the last update
+	u32                 m_dirty_min;            // lowest word of m_dirty with bits set
+	u32                 m_dirty_max;            // highest word of m_dirty with bits set
 };
 
 
@@ -11,9 +11,16 @@
 #include "emu.h"
 #include "fileio.h"
 
+#include "util/corestr.h"
 #include "util/path.h"
 #include "util/unzip.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <map>
+#include <mutex>
+
 //#define VERBOSE 1
 #define LOG_OUTPUT_FUNC osd_printf_verbose
 #include "logmacro.h"
@@ -179,6 +186,487 @@ const osd::directory::entry *file_enumerator::next(const char *subdir)
 
 
 
+//**************************************************************************
+//  ARCHIVE HASH CACHE
+//**************************************************************************
+
+namespace {
+
+// identifies the first line of a hash cache file
+char const HASH_CACHE_SIGNATURE[] = "mamehashcache 1";
+
+// sizes and modification times of paths, or ~0 for the size if missing
+using path_identity_map = std::map<std::string, std::pair<u64, s64> >;
+
+// stat each path once per session; what matters is whether it changed since it was recorded
+bool path_identity(path_identity_map &seen, const std::string &path, osd::directory::entry::entry_type type, u64 &size, s64 &time)
+{
+	auto found(seen.find(path));
+	if (seen.end() == found)
+	{
+		std::unique_ptr<osd::directory::entry> const info(osd_stat(path));
+		std::pair<u64, s64> identity(~u64(0), 0);
+		if (info && (type == info->type))
+			identity = std::make_pair(info->size, s64(std::chrono::duration_cast<std::chrono::microseconds>(info->last_modified.time_since_epoch()).count()));
+		found = seen.emplace(path, identity).first;
+	}
+	size = found->second.first;
+	time = found->second.second;
+	return ~u64(0) != size;
+}
+
+struct hash_cache_state
+{
+	struct entry
+	{
+		u64                 archivesize;    // size of the archive when hashed
+		s64                 archivetime;    // modification time of the archive when hashed
+		u32                 crc;            // CRC from the archive's directory
+		u64                 length;         // uncompressed length
+		std::string         hashes;         // hashes in internal format
+		std::string         name;           // member name
+		std::string         archive;        // archive path
+	};
+
+	std::mutex                                          lock;
+	std::string                                         path;       // file the cache is loaded from and saved to
+	bool                                                dirty = false;
+	std::map<std::string, entry>                        entries;    // keyed by archive, member name, CRC and length
+	path_identity_map                                   archives;   // archive sizes and times seen this session
+
+	static std::string make_key(std::string_view archive, std::string_view name, u32 crc, u64 length)
+	{
+		return util::string_format("%08x\t%u\t%s\t%s", crc, length, name, archive);
+	}
+
+	bool archive_identity(const std::string &archive, u64 &size, s64 &time)
+	{
+		return path_identity(archives, archive, osd::directory::entry::entry_type::FILE, size, time);
+	}
+};
+
+hash_cache_state &hash_cache()
+{
+	static hash_cache_state state;
+	return state;
+}
+
+} // anonymous namespace
+
+
+//-------------------------------------------------
+//  enable - load the hash cache from a file,
+//  keeping what was already there
+//-------------------------------------------------
+
+void archive_hash_cache::enable(std::string_view path)
+{
+	hash_cache_state &cache(hash_cache());
+	std::lock_guard<std::mutex> guard(cache.lock);
+	cache.path = path;
+	cache.dirty = false;
+	cache.entries.clear();
+	cache.archives.clear();
+
+	util::core_file::ptr file;
+	if (cache.path.empty() || util::core_file::open(cache.path, OPEN_FLAG_READ, file))
+		return;
+
+	// each line is archive size, time, CRC, length, hashes, member name then archive path
+	char buffer[4096];
+	if (!file->gets(buffer, std::size(buffer)) || (std::string_view(buffer).substr(0, std::size(HASH_CACHE_SIGNATURE) - 1) != HASH_CACHE_SIGNATURE))
+		return;
+	while (file->gets(buffer, std::size(buffer)))
+	{
+		std::string_view line(buffer);
+		while (!line.empty() && ((line.back() == '\n') || (line.back() == '\r')))
+			line.remove_suffix(1);
+
+		std::string_view fields[7];
+		unsigned count(0);
+		while ((count < (std::size(fields) - 1)) && (std::string_view::npos != line.find('\t')))
+		{
+			fields[count++] = line.substr(0, line.find('\t'));
+			line.remove_prefix(fields[count - 1].length() + 1);
+		}
+		fields[count++] = line;
+		if (std::size(fields) != count)
+			continue;
+
+		unsigned long long archivesize, length;
+		long long archivetime;
+		unsigned crc;
+		if ((std::sscanf(std::string(fields[0]).c_str(), "%llu", &archivesize) != 1) ||
+				(std::sscanf(std::string(fields[1]).c_str(), "%lld", &archivetime) != 1) ||
+				(std::sscanf(std::string(fields[2]).c_str(), "%x", &crc) != 1) ||
+				(std::sscanf(std::string(fields[3]).c_str(), "%llu", &length) != 1))
+			continue;
+		cache.entries.insert_or_assign(
+				hash_cache_state::make_key(fields[6], fields[5], crc, length),
+				hash_cache_state::entry{ archivesize, s64(archivetime), crc, length, std::string(fields[4]), std::string(fields[5]), std::string(fields[6]) });
+	}
+}
+
+
+//-------------------------------------------------
+//  disable - write back the hash cache if it has
+//  anything new
+//-------------------------------------------------
+
+void archive_hash_cache::disable()
+{
+	hash_cache_state &cache(hash_cache());
+	std::lock_guard<std::mutex> guard(cache.lock);
+	if (cache.path.empty())
+		return;
+
+	if (cache.dirty)
+	{
+		// write a temporary file and rename it into place so readers never see half of it
+		std::string const temppath(cache.path + ".new");
+		util::core_file::ptr file;
+		if (!util::core_file::open(temppath, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, file))
+		{
+			file->printf("%s\n", HASH_CACHE_SIGNATURE);
+			for (auto const &item : cache.entries)
+			{
+				hash_cache_state::entry const &entry(item.second);
+				file->printf("%u\t%d\t%08x\t%u\t%s\t%s\t%s\n", entry.archivesize, entry.archivetime, entry.crc, entry.length, entry.hashes, entry.name, entry.archive);
+			}
+			file.reset();
+			if (std::rename(temppath.c_str(), cache.path.c_str()))
+			{
+				osd_file::remove(cache.path);
+				if (std::rename(temppath.c_str(), cache.path.c_str()))
+					osd_file::remove(temppath);
+			}
+		}
+	}
+
+	cache.path.clear();
+	cache.dirty = false;
+	cache.entries.clear();
+	cache.archives.clear();
+}
+
+
+//-------------------------------------------------
+//  find - look up hashes for an archive member,
+//  as long as the archive hasn't changed
+//-------------------------------------------------
+
+bool archive_hash_cache::find(const std::string &archive, std::string_view name, u32 crc, u64 length, util::hash_collection &hashes)
+{
+	hash_cache_state &cache(hash_cache());
+	std::lock_guard<std::mutex> guard(cache.lock);
+	if (cache.path.empty())
+		return false;
+
+	auto const found(cache.entries.find(hash_cache_state::make_key(archive, name, crc, length)));
+	if (cache.entries.end() == found)
+		return false;
+
+	u64 size;
+	s64 time;
+	if (!cache.archive_identity(archive, size, time) || (found->second.archivesize != size) || (found->second.archivetime != time))
+		return false;
+
+	// don't trust an entry that disagrees with the archive's own CRC
+	util::hash_collection result;
+	u32 cachedcrc;
+	if (!result.from_internal_string(found->second.hashes) || !result.crc(cachedcrc) || (cachedcrc != crc))
+		return false;
+	hashes = std::move(result);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  add - record hashes computed for an archive
+//  member
+//-------------------------------------------------
+
+void archive_hash_cache::add(const std::string &archive, std::string_view name, u32 crc, u64 length, const util::hash_collection &hashes)
+{
+	hash_cache_state &cache(hash_cache());
+	std::lock_guard<std::mutex> guard(cache.lock);
+	if (cache.path.empty())
+		return;
+
+	// the file is line- and tab-separated; hashes without a CRC couldn't be checked later
+	u32 hashcrc;
+	if ((std::string_view::npos != name.find_first_of("\t\r\n")) || (std::string::npos != archive.find_first_of("\t\r\n")) || !hashes.crc(hashcrc) || (hashcrc != crc))
+		return;
+
+	u64 size;
+	s64 time;
+	if (!cache.archive_identity(archive, size, time))
+		return;
+	cache.entries.insert_or_assign(
+			hash_cache_state::make_key(archive, name, crc, length),
+			hash_cache_state::entry{ size, time, crc, length, hashes.internal_string(), std::string(name), archive });
+	cache.dirty = true;
+}
+
+
+
+//**************************************************************************
+//  ARCHIVE INDEX
+//**************************************************************************
+
+namespace {
+
+// identifies the first line of an archive index file
+char const ARCHIVE_INDEX_SIGNATURE[] = "mamearchiveindex 1";
+
+struct archive_index_state
+{
+	struct archive
+	{
+		u64                 size;           // size of the archive, or ~0 if it was missing
+		s64                 time;           // modification time of the archive, or of its directory if it was missing
+		std::vector<std::pair<u32, std::string> > members; // CRC and lowercase leaf name of each file
+	};
+
+	std::mutex                                          lock;
+	std::string                                         path;       // file the index is loaded from and saved to
+	bool                                                dirty = false;
+	std::map<std::string, archive>                      archives;   // keyed by archive path
+	path_identity_map                                   seen;       // archive and directory identities seen this session
+
+	// searches may match partial paths and ignore case, so only compare the last part
+	static std::string leaf(std::string_view name)
+	{
+		std::string_view::size_type const sep(name.find_last_of("/\\"));
+		if (std::string_view::npos != sep)
+			name.remove_prefix(sep + 1);
+		return strmakelower(name);
+	}
+
+	static std::string directory(const std::string &archive)
+	{
+		auto const sep(std::find_if(archive.rbegin(), archive.rend(), util::is_directory_separator));
+		return (archive.rend() == sep) ? std::string() : std::string(archive.begin(), sep.base() - 1);
+	}
+
+	// a missing archive is trusted until something in its directory changes
+	bool current(const std::string &archivepath, const archive &entry)
+	{
+		u64 size;
+		s64 time;
+		if (~u64(0) == entry.size)
+		{
+			std::string const dir(directory(archivepath));
+			return !dir.empty() && path_identity(seen, dir, osd::directory::entry::entry_type::DIR, size, time) && (entry.time == time);
+		}
+		return path_identity(seen, archivepath, osd::directory::entry::entry_type::FILE, size, time) && (entry.size == size) && (entry.time == time);
+	}
+};
+
+archive_index_state &archive_index_data()
+{
+	static archive_index_state state;
+	return state;
+}
+
+} // anonymous namespace
+
+
+//-------------------------------------------------
+//  enable - load the archive index from a file
+//-------------------------------------------------
+
+void archive_index::enable(std::string_view path)
+{
+	archive_index_state &index(archive_index_data());
+	std::lock_guard<std::mutex> guard(index.lock);
+	index.path = path;
+	index.dirty = false;
+	index.archives.clear();
+	index.seen.clear();
+
+	util::core_file::ptr file;
+	if (index.path.empty() || util::core_file::open(index.path, OPEN_FLAG_READ, file))
+		return;
+
+	// each archive line is size, time then path, followed by a tab-indented CRC and name line per member
+	char buffer[4096];
+	if (!file->gets(buffer, std::size(buffer)) || (std::string_view(buffer).substr(0, std::size(ARCHIVE_INDEX_SIGNATURE) - 1) != ARCHIVE_INDEX_SIGNATURE))
+		return;
+	archive_index_state::archive *current(nullptr);
+	while (file->gets(buffer, std::size(buffer)))
+	{
+		std::string_view line(buffer);
+		while (!line.empty() && ((line.back() == '\n') || (line.back() == '\r')))
+			line.remove_suffix(1);
+
+		bool const member(!line.empty() && (line.front() == '\t'));
+		if (member)
+			line.remove_prefix(1);
+		std::string_view::size_type const first(line.find('\t'));
+		std::string_view::size_type const second((std::string_view::npos != first) ? line.find('\t', first + 1) : first);
+		if (member)
+		{
+			unsigned crc;
+			if (current && (std::string_view::npos != first) && (std::sscanf(std::string(line.substr(0, first)).c_str(), "%x", &crc) == 1))
+				current->members.emplace_back(crc, std::string(line.substr(first + 1)));
+			continue;
+		}
+
+		unsigned long long size;
+		long long time;
+		current = nullptr;
+		if ((std::string_view::npos == second) ||
+				(std::sscanf(std::string(line.substr(0, first)).c_str(), "%llu", &size) != 1) ||
+				(std::sscanf(std::string(line.substr(first + 1, second - first - 1)).c_str(), "%lld", &time) != 1))
+			continue;
+		current = &index.archives.insert_or_assign(
+				std::string(line.substr(second + 1)),
+				archive_index_state::archive{ u64(size), s64(time), { } }).first->second;
+	}
+}
+
+
+//-------------------------------------------------
+//  disable - write back the archive index if it
+//  changed
+//-------------------------------------------------
+
+void archive_index::disable()
+{
+	archive_index_state &index(archive_index_data());
+	std::lock_guard<std::mutex> guard(index.lock);
+	if (index.path.empty())
+		return;
+
+	if (index.dirty)
+	{
+		// write a temporary file and rename it into place so readers never see half of it
+		std::string const temppath(index.path + ".new");
+		util::core_file::ptr file;
+		if (!util::core_file::open(temppath, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, file))
+		{
+			file->printf("%s\n", ARCHIVE_INDEX_SIGNATURE);
+			for (auto const &item : index.archives)
+			{
+				file->printf("%u\t%d\t%s\n", item.second.size, item.second.time, item.first);
+				for (auto const &member : item.second.members)
+					file->printf("\t%08x\t%s\n", member.first, member.second);
+			}
+			file.reset();
+			if (std::rename(temppath.c_str(), index.path.c_str()))
+			{
+				osd_file::remove(index.path);
+				if (std::rename(temppath.c_str(), index.path.c_str()))
+					osd_file::remove(temppath);
+			}
+		}
+	}
+
+	index.path.clear();
+	index.dirty = false;
+	index.archives.clear();
+	index.seen.clear();
+}
+
+
+//-------------------------------------------------
+//  find - check whether an archive could hold a
+//  file without opening it
+//-------------------------------------------------
+
+archive_index::result archive_index::find(const std::string &archive, std::string_view filename, bool has_crc, u32 crc)
+{
+	archive_index_state &index(archive_index_data());
+	std::lock_guard<std::mutex> guard(index.lock);
+	if (index.path.empty())
+		return result::UNKNOWN;
+
+	auto const found(index.archives.find(archive));
+	if (index.archives.end() == found)
+	{
+		// note the directory before the archive is tried, so one created in the meantime can't be recorded as missing
+		std::string const dir(archive_index_state::directory(archive));
+		u64 size;
+		s64 time;
+		if (!dir.empty())
+			path_identity(index.seen, dir, osd::directory::entry::entry_type::DIR, size, time);
+		return result::UNKNOWN;
+	}
+	if (!index.current(archive, found->second))
+	{
+		index.archives.erase(found);
+		index.dirty = true;
+		return result::UNKNOWN;
+	}
+	if (~u64(0) == found->second.size)
+		return result::MISSING;
+
+	std::string const name(archive_index_state::leaf(filename));
+	for (auto const &member : found->second.members)
+	{
+		if ((has_crc && (member.first == crc)) || (member.second == name))
+			return result::FOUND;
+	}
+	return result::NOT_FOUND;
+}
+
+
+//-------------------------------------------------
+//  add - record the files in an archive
+//-------------------------------------------------
+
+void archive_index::add(const std::string &archive, util::archive_file &file)
+{
+	archive_index_state &index(archive_index_data());
+	std::lock_guard<std::mutex> guard(index.lock);
+	if (index.path.empty() || (std::string::npos != archive.find_first_of("\t\r\n")))
+		return;
+
+	u64 size;
+	s64 time;
+	if (!path_identity(index.seen, archive, osd::directory::entry::entry_type::FILE, size, time))
+		return;
+
+	// the file is line- and tab-separated, so archives with awkward names can't be indexed
+	archive_index_state::archive entry{ size, time, { } };
+	for (int header = file.first_file(); header >= 0; header = file.next_file())
+	{
+		if (file.current_is_directory())
+			continue;
+		std::string name(archive_index_state::leaf(file.current_name()));
+		if (std::string::npos != name.find_first_of("\t\r\n"))
+			return;
+		entry.members.emplace_back(file.current_crc(), std::move(name));
+	}
+	index.archives.insert_or_assign(archive, std::move(entry));
+	index.dirty = true;
+}
+
+
+//-------------------------------------------------
+//  add_missing - record that an archive doesn't
+//  exist
+//-------------------------------------------------
+
+void archive_index::add_missing(const std::string &archive)
+{
+	archive_index_state &index(archive_index_data());
+	std::lock_guard<std::mutex> guard(index.lock);
+	if (index.path.empty() || (std::string::npos != archive.find_first_of("\t\r\n")))
+		return;
+
+	// only the directory's time from before the archive was tried will do
+	std::string const dir(archive_index_state::directory(archive));
+	auto const seen(index.seen.find(dir));
+	if (dir.empty() || (index.seen.end() == seen) || (~u64(0) == seen->second.first))
+		return;
+	index.archives.insert_or_assign(archive, archive_index_state::archive{ ~u64(0), seen->second.second, { } });
+	index.dirty = true;
+}
+
+
+
 //**************************************************************************
 //  EMU FILE
 //**************************************************************************
@@ -211,6 +699,7 @@ emu_file::emu_file(u32 openflags, empty_t)
 	, m_openflags(openflags)
 	, m_zipfile(nullptr)
 	, m_ziplength(0)
+	, m_zipcrc(0)
 	, m_remove_on_close(false)
 	, m_restrict_to_mediapath(0)
 {
@@ -266,6 +755,21 @@ util::hash_collection &emu_file::hashes(std::string_view types)
 	if (needed.empty())
 		return m_hashes;
 
+	// an unchanged archive may have been hashed before, saving decompressing it at all
+	if (!m_zippath.empty())
+	{
+		util::hash_collection cached;
+		if (archive_hash_cache::find(m_zippath, m_zipentry, m_zipcrc, m_ziplength, cached))
+		{
+			std::string const have = cached.hash_types();
+			if (std::all_of(needed.begin(), needed.end(), [&have] (char type) { return have.find(type) != std::string::npos; }))
+			{
+				m_hashes = cached;
+				return m_hashes;
+			}
+		}
+	}
+
 	// load the ZIP file if needed
 	if (compressed_file_ready())
 		return m_hashes;
@@ -276,6 +780,8 @@ util::hash_collection &emu_file::hashes(std::string_view types)
 	if (!m_zipdata.empty())
 	{
 		m_hashes.compute(&m_zipdata[0], m_zipdata.size(), needed.c_str());
+		if (!m_zippath.empty())
+			archive_hash_cache::add(m_zippath, m_zipentry, m_zipcrc, m_ziplength, m_hashes);
 		return m_hashes;
 	}
 
@@ -283,7 +789,13 @@ util::hash_collection &emu_file::hashes(std::string_view types)
 	if (m_file->length(length))
 		return m_hashes;
 
-	// hash the data
+	// hash the data in place if the file can be mapped
+	void const *const data = m_file->map();
+	if (data && (std::numeric_limits<u32>::max() >= length))
+	{
+		m_hashes.compute(reinterpret_cast<u8 const *>(data), u32(length), needed.c_str());
+		return m_hashes;
+	}
 	std::size_t actual;
 	(void)m_hashes.compute(*m_file, 0U, length, actual, needed.c_str()); // FIXME: need better interface to report errors
 
@@ -330,6 +842,7 @@ std::error_condition emu_file::open_next()
 	// if we're open from a previous attempt, close up now
 	if (m_file)
 		close();
+	m_zippath.clear();
 
 	// loop over paths
 	LOG("emu_file: open next '%s'\n", m_filename);
@@ -420,6 +933,8 @@ void emu_file::close()
 	m_file.reset();
 
 	m_zipdata.clear();
+	m_zippath.clear();
+	m_zipentry.clear();
 
 	if (m_remove_on_close)
 		osd_file::remove(m_fullpath);
@@ -519,6 +1034,32 @@ u64 emu_file::size()
 }
 
 
+//-------------------------------------------------
+//  identity - describe where the file's data
+//  came from, along with the size and
+//  modification time of the file backing it, so
+//  an unchanged file can be recognised without
+//  reading it; empty if that can't be determined
+//-------------------------------------------------
+
+std::string emu_file::identity() const
+{
+	if (!m_file && !m_zipfile && m_zipdata.empty())
+		return std::string();
+
+	std::string const &backing(m_zippath.empty() ? m_fullpath : m_zippath);
+	std::unique_ptr<osd::directory::entry> const info(osd_stat(backing));
+	if (!info || (osd::directory::entry::entry_type::FILE != info->type))
+		return std::string();
+
+	s64 const time(std::chrono::duration_cast<std::chrono::microseconds>(info->last_modified.time_since_epoch()).count());
+	if (m_zippath.empty())
+		return util::string_format("%u\t%d\t%s", info->size, time, m_fullpath);
+	else
+		return util::string_format("%u\t%d\t%08x\t%u\t%s\t%s", info->size, time, m_zipcrc, m_ziplength, m_zipentry, m_zippath);
+}
+
+
 //-------------------------------------------------
 //  read - read from a file
 //-------------------------------------------------
@@ -739,9 +1280,24 @@ std::error_condition emu_file::attempt_zipped()
 			m_fullpath.append(suffixes[i]);
 			LOG("emu_file: looking for '%s' in archive '%s'\n", filename, m_fullpath);
 
+			// skip archives known not to exist or not to hold the file
+			archive_index::result const indexed(archive_index::find(m_fullpath, filename, m_openflags & OPEN_FLAG_HAS_CRC, m_crc));
+			if ((archive_index::result::MISSING == indexed) || (archive_index::result::NOT_FOUND == indexed))
+			{
+				m_fullpath.resize(dirsep);
+				continue;
+			}
+
 			// attempt to open the archive file
 			util::archive_file::ptr zip;
 			std::error_condition ziperr = open_funcs[i](m_fullpath, zip);
+			if (archive_index::result::UNKNOWN == indexed)
+			{
+				if (!ziperr)
+					archive_index::add(m_fullpath, *zip);
+				else if (std::errc::no_such_file_or_directory == ziperr)
+					archive_index::add_missing(m_fullpath);
+			}
 
 			// chop the archive suffix back off the filename before continuing
 			m_fullpath = m_fullpath.substr(0, dirsep);
@@ -774,6 +1330,9 @@ std::error_condition emu_file::attempt_zipped()
 			{
 				m_zipfile = std::move(zip);
 				m_ziplength = m_zipfile->current_uncompressed_length();
+				m_zippath = m_fullpath + suffixes[i];
+				m_zipentry = m_zipfile->current_name();
+				m_zipcrc = m_zipfile->current_crc();
 
 				// build a hash with just the CRC
 				m_hashes.reset();
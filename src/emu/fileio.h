@@ -119,6 +119,47 @@ private:
 
 
 
+// ======================> archive_hash_cache
+
+// persistent record of hashes computed for files inside archives, trusted
+// for as long as the archive's size and modification time are unchanged
+class archive_hash_cache
+{
+public:
+	// load the cache from a file, and write it back when disabling
+	static void enable(std::string_view path);
+	static void disable();
+
+	// look up or record the hashes of an archive member
+	static bool find(const std::string &archive, std::string_view name, u32 crc, u64 length, util::hash_collection &hashes);
+	static void add(const std::string &archive, std::string_view name, u32 crc, u64 length, const util::hash_collection &hashes);
+};
+
+
+
+// ======================> archive_index
+
+// persistent record of which files each archive holds, and of archives that
+// don't exist, so searches can skip them without touching the filesystem
+class archive_index
+{
+public:
+	enum class result { UNKNOWN, MISSING, NOT_FOUND, FOUND };
+
+	// load the index from a file, and write it back when disabling
+	static void enable(std::string_view path);
+	static void disable();
+
+	// check whether an unchanged archive could hold a file
+	static result find(const std::string &archive, std::string_view filename, bool has_crc, u32 crc);
+
+	// record what an archive holds, or that it doesn't exist
+	static void add(const std::string &archive, util::archive_file &file);
+	static void add_missing(const std::string &archive);
+};
+
+
+
 // ======================> emu_file
 
 class emu_file
@@ -149,6 +190,8 @@ public:
 	const char *filename() const { return m_filename.c_str(); }
 	const char *fullpath() const { return m_fullpath.c_str(); }
 	u32 openflags() const { return m_openflags; }
+	bool archived() const { return !m_zippath.empty(); }
+	std::string identity() const;
 	util::hash_collection &hashes(std::string_view types);
 
 	// setters
@@ -231,6 +274,9 @@ private:
 	std::unique_ptr<util::archive_file> m_zipfile;  // ZIP file pointer
 	std::vector<u8>         m_zipdata;              // ZIP file data
 	u64                     m_ziplength;            // ZIP file length
+	std::string             m_zippath;              // path of the archive we came from
+	std::string             m_zipentry;             // name of our file within the archive
+	u32                     m_zipcrc;               // CRC from the archive's directory
 
 	bool                    m_remove_on_close;      // flag: remove the file when closing
 	int                     m_restrict_to_mediapath; // flag: restrict to paths inside the media-path
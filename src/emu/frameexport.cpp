@@ -0,0 +1,220 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    frameexport.cpp
+
+    Publishing rendered frames and sound in shared memory.
+
+***************************************************************************/
+
+#include "emu.h"
+
+#include "modules/lib/osdlib.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <new>
+
+
+namespace {
+
+// slots and the audio ring start on cache line boundaries
+constexpr u64 ALIGNMENT = 64;
+
+constexpr u64 align(u64 value)
+{
+	return (value + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+}
+
+} // anonymous namespace
+
+
+//**************************************************************************
+//  FRAME EXPORT
+//**************************************************************************
+
+//-------------------------------------------------
+//  frame_export - constructor
+//-------------------------------------------------
+
+frame_export::frame_export(std::unique_ptr<osd::shared_memory_region> &&region)
+	: m_region(std::move(region))
+	, m_header(*reinterpret_cast<header *>(m_region->get()))
+	, m_audio(reinterpret_cast<s16 *>(reinterpret_cast<u8 *>(m_region->get()) + m_header.m_audio_offset))
+	, m_frame(0)
+	, m_writing(false)
+{
+}
+
+
+//-------------------------------------------------
+//  ~frame_export - destructor
+//-------------------------------------------------
+
+frame_export::~frame_export()
+{
+	// let anyone still reading know no more frames are coming
+	m_header.m_writer_active.store(0, std::memory_order_release);
+}
+
+
+//-------------------------------------------------
+//  create - create the shared memory region and
+//  lay it out
+//-------------------------------------------------
+
+frame_export::ptr frame_export::create(running_machine &machine, std::string &&name, u32 slots, u32 max_pixels)
+{
+	static_assert(std::atomic<u64>::is_always_lock_free, "shared counters must be lock free");
+
+	slots = std::max<u32>(slots, 2);
+	max_pixels = std::max<u32>(max_pixels, 1);
+	u32 const sample_rate = std::max(machine.sample_rate(), 1);
+	u64 const slot_bytes = align(sizeof(slot_header)) + align(u64(max_pixels) * sizeof(u32));
+	u64 const slots_offset = align(sizeof(header));
+	u64 const audio_offset = slots_offset + (slot_bytes * slots);
+	u64 const total = audio_offset + align(u64(sample_rate) * 2 * sizeof(s16));
+	if ((slot_bytes > std::numeric_limits<u32>::max()) || (total > std::numeric_limits<std::size_t>::max()))
+		return nullptr;
+
+	auto region = std::make_unique<osd::shared_memory_region>(std::move(name), std::size_t(total));
+	if (!*region)
+		return nullptr;
+
+	// fill in the header last, so a reader that finds the magic sees the rest
+	u8 *const base = reinterpret_cast<u8 *>(region->get());
+	std::memset(base, 0, std::size_t(total));
+	for (u32 index = 0; index < slots; index++)
+	{
+		slot_header *const slot = new (base + slots_offset + (slot_bytes * index)) slot_header;
+		slot->m_sequence.store(0, std::memory_order_relaxed);
+		slot->m_format = FORMAT_XRGB8888;
+		slot->m_pixels_offset = u32(align(sizeof(slot_header)));
+	}
+	header *const head = new (base) header;
+	head->m_version = 1;
+	head->m_header_bytes = sizeof(header);
+	head->m_slot_count = slots;
+	head->m_slot_bytes = u32(slot_bytes);
+	head->m_slots_offset = slots_offset;
+	head->m_max_pixels = max_pixels;
+	head->m_sample_rate = sample_rate;
+	head->m_channels = 2;
+	head->m_audio_capacity = sample_rate;
+	head->m_audio_offset = audio_offset;
+	head->m_frames_published.store(0, std::memory_order_relaxed);
+	head->m_frames_dropped.store(0, std::memory_order_relaxed);
+	head->m_samples_written.store(0, std::memory_order_relaxed);
+	head->m_writer_active.store(1, std::memory_order_relaxed);
+	strncpy(head->m_system, machine.system().name, sizeof(head->m_system) - 1);
+	std::atomic_thread_fence(std::memory_order_release);
+	std::memcpy(head->m_magic, "MAMEFRX", 8);
+
+	return ptr(new frame_export(std::move(region)));
+}
+
+
+//-------------------------------------------------
+//  name - the name other processes open the
+//  region by
+//-------------------------------------------------
+
+std::string const &frame_export::name() const
+{
+	return m_region->name();
+}
+
+
+//-------------------------------------------------
+//  slot - the slot a frame is written to
+//-------------------------------------------------
+
+frame_export::slot_header &frame_export::slot(u64 frame)
+{
+	u8 *const base = reinterpret_cast<u8 *>(m_region->get());
+	return *reinterpret_cast<slot_header *>(base + m_header.m_slots_offset + (m_header.m_slot_bytes * (frame % m_header.m_slot_count)));
+}
+
+
+//-------------------------------------------------
+//  begin_frame - claim the next slot and return
+//  where its pixels go, or nullptr if the frame
+//  doesn't fit
+//-------------------------------------------------
+
+u32 *frame_export::begin_frame(s32 width, s32 height, s32 &rowpixels)
+{
+	assert(!m_writing);
+	if ((width <= 0) || (height <= 0) || ((u64(width) * u64(height)) > m_header.m_max_pixels))
+	{
+		m_header.m_frames_dropped.fetch_add(1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	// mark the slot as being written before touching the pixels
+	slot_header &target = slot(m_frame);
+	target.m_sequence.store((m_frame * 2) + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	target.m_frame = m_frame;
+	target.m_width = u32(width);
+	target.m_height = u32(height);
+	target.m_row_bytes = u32(width) * sizeof(u32);
+	m_writing = true;
+
+	rowpixels = width;
+	return reinterpret_cast<u32 *>(reinterpret_cast<u8 *>(&target) + target.m_pixels_offset);
+}
+
+
+//-------------------------------------------------
+//  end_frame - publish the frame started by
+//  begin_frame
+//-------------------------------------------------
+
+void frame_export::end_frame(attotime const &time)
+{
+	if (!m_writing)
+		return;
+
+	slot_header &target = slot(m_frame);
+	target.m_seconds = time.seconds();
+	target.m_attoseconds = time.attoseconds();
+	target.m_samples = m_header.m_samples_written.load(std::memory_order_relaxed);
+	target.m_sequence.store((m_frame * 2) + 2, std::memory_order_release);
+	m_header.m_frames_published.store(++m_frame, std::memory_order_release);
+	m_writing = false;
+}
+
+
+//-------------------------------------------------
+//  add_sound - append interleaved stereo samples
+//  to the ring
+//-------------------------------------------------
+
+void frame_export::add_sound(const s16 *sound, int numsamples)
+{
+	u32 const capacity = m_header.m_audio_capacity;
+	u64 position = m_header.m_samples_written.load(std::memory_order_relaxed);
+
+	// only the newest samples are any use if there are more than fit
+	if (u32(numsamples) > capacity)
+	{
+		sound += (numsamples - capacity) * 2;
+		position += numsamples - capacity;
+		numsamples = capacity;
+	}
+
+	u32 remaining = u32(numsamples);
+	while (remaining)
+	{
+		u32 const offset = u32(position % capacity);
+		u32 const chunk = std::min(remaining, capacity - offset);
+		std::memcpy(&m_audio[offset * 2], sound, chunk * 2 * sizeof(s16));
+		sound += chunk * 2;
+		position += chunk;
+		remaining -= chunk;
+	}
+	m_header.m_samples_written.store(position, std::memory_order_release);
+}
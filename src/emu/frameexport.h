@@ -0,0 +1,126 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    frameexport.h
+
+    Publishing rendered frames and sound in shared memory.
+
+****************************************************************************
+
+    The region starts with a frame_export::header, followed by slot_count
+    frame slots of slot_bytes each at slots_offset, and a ring of
+    audio_capacity interleaved 16-bit stereo sample frames at audio_offset.
+    All fields are native endian; offsets are from the start of the region.
+
+    Frame n goes into slot (n % slot_count).  While it's being written the
+    slot's sequence is 2n+1, and once it's complete it's 2n+2; after that
+    the header's frames_published becomes n+1.  A reader takes the newest
+    slot, checks its sequence is even, uses the pixels where they are and
+    checks the sequence again afterwards - if it changed, the writer came
+    round and the frame may be torn.
+
+    Samples are written in order at (position % audio_capacity), and only
+    then is samples_written advanced past them.  A reader that falls more
+    than audio_capacity sample frames behind has lost some.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __EMU_H__
+#error Dont include this file directly; include emu.h instead.
+#endif
+
+#ifndef MAME_EMU_FRAMEEXPORT_H
+#define MAME_EMU_FRAMEEXPORT_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> frame_export
+
+class frame_export
+{
+public:
+	// pixel formats
+	enum : u32
+	{
+		FORMAT_XRGB8888 = 1     // one u32 per pixel, 0xXXRRGGBB
+	};
+
+	// at the start of the region
+	struct header
+	{
+		char                m_magic[8];         // "MAMEFRX" followed by a NUL
+		u32                 m_version;          // layout version, currently 1
+		u32                 m_header_bytes;     // size of this header
+		u32                 m_slot_count;       // number of frame slots
+		u32                 m_slot_bytes;       // size of each slot including its header
+		u64                 m_slots_offset;     // offset of the first slot
+		u32                 m_max_pixels;       // largest frame (width * height) a slot holds
+		u32                 m_sample_rate;      // audio sample rate
+		u32                 m_channels;         // audio channels, currently 2
+		u32                 m_audio_capacity;   // audio ring size in sample frames
+		u64                 m_audio_offset;     // offset of the audio ring
+		std::atomic<u64>    m_frames_published; // frames completely written
+		std::atomic<u64>    m_frames_dropped;   // frames too big for a slot
+		std::atomic<u64>    m_samples_written;  // sample frames written
+		std::atomic<u32>    m_writer_active;    // non-zero until the emulator stops
+		char                m_system[36];       // short name of the running system
+	};
+
+	// at the start of each slot, followed by the pixels
+	struct slot_header
+	{
+		std::atomic<u64>    m_sequence;         // odd while the slot is being written
+		u64                 m_frame;            // frame number
+		s64                 m_seconds;          // emulated time: whole seconds
+		s64                 m_attoseconds;      // emulated time: attoseconds
+		u64                 m_samples;          // sample frames written when the frame was drawn
+		u32                 m_width;            // frame width in pixels
+		u32                 m_height;           // frame height in pixels
+		u32                 m_row_bytes;        // distance between rows
+		u32                 m_format;           // pixel format
+		u32                 m_pixels_offset;    // offset of the pixels from the slot
+		u32                 m_reserved;
+	};
+
+	typedef std::unique_ptr<frame_export> ptr;
+
+	// construction/destruction
+	~frame_export();
+
+	// frames; the pixels are written straight into the slot
+	u32 *begin_frame(s32 width, s32 height, s32 &rowpixels);
+	void end_frame(attotime const &time);
+
+	// sound
+	void add_sound(const s16 *sound, int numsamples);
+
+	// accessors
+	std::string const &name() const;
+
+	// statics
+	static ptr create(running_machine &machine, std::string &&name, u32 slots, u32 max_pixels);
+
+private:
+	frame_export(std::unique_ptr<osd::shared_memory_region> &&region);
+
+	slot_header &slot(u64 frame);
+
+	std::unique_ptr<osd::shared_memory_region> m_region;    // the shared memory
+	header &        m_header;               // header at the start of the region
+	s16 *           m_audio;                // sample ring
+	u64             m_frame;                // frame being written
+	bool            m_writing;              // flag: true between begin_frame and end_frame
+};
+
+
+#endif // MAME_EMU_FRAMEEXPORT_H
@@ -406,7 +406,10 @@ inline void accumulate_axis_value(
 //  input_manager - constructor
 //-------------------------------------------------
 
-input_manager::input_manager(running_machine &machine) : m_machine(machine)
+input_manager::input_manager(running_machine &machine)
+	: m_machine(machine)
+	, m_generation(0)
+	, m_poll_count(0)
 {
 	// reset code memory
 	reset_memory();
@@ -899,6 +902,168 @@ bool input_manager::seq_pressed(const input_seq &seq)
 }
 
 
+//-------------------------------------------------
+//  seq_pressed - return true if the given sequence
+//  is "pressed", reusing the result from the last
+//  call unless an item it reads has changed
+//-------------------------------------------------
+
+bool input_manager::seq_pressed(input_seq_program &program, const input_seq &seq)
+{
+	// recompile if the sequence or the mapping of codes to items has changed
+	if (!program.compiled_for(seq, m_generation))
+		compile_seq(seq, program);
+
+	if (program.stale([this] (u32 index) { return m_watched[index].m_changed; }))
+	{
+		auto profile = g_profiler.start(PROFILER_INPUT);
+
+		program.evaluate(
+				m_poll_count,
+				[] (input_device_item &item, input_item_class itemclass, input_item_modifier modifier) -> s32
+				{
+					switch (itemclass)
+					{
+					case ITEM_CLASS_ABSOLUTE:   return item.read_as_absolute(modifier);
+					case ITEM_CLASS_RELATIVE:   return item.read_as_relative(modifier);
+					case ITEM_CLASS_SWITCH:     return item.read_as_switch(modifier);
+					default:                    return 0;
+					}
+				});
+	}
+	return program.result();
+}
+
+
+//-------------------------------------------------
+//  compile_seq - resolve each code of a sequence
+//  to the items it reads, and add them to the
+//  watch list
+//-------------------------------------------------
+
+void input_manager::compile_seq(const input_seq &seq, input_seq_program &program)
+{
+	program.reset(seq, m_generation);
+
+	bool invert = false;
+	bool group = true;
+	for (int codenum = 0; ; codenum++)
+	{
+		input_code code = seq[codenum];
+		if (code == input_seq::not_code)
+		{
+			invert = true;
+		}
+		else if (code == input_seq::or_code)
+		{
+			invert = false;
+			group = true;
+		}
+		else if (code == input_seq::end_code)
+		{
+			break;
+		}
+		else
+		{
+			program.add_term(code.item_class(), code.item_modifier(), invert, group);
+			invert = group = false;
+
+			// resolve items the same way code_value does; invalid codes and disabled classes read nothing
+			input_class &devclass = *m_class[code.device_class()];
+			if (!device_from_code(code) || !devclass.enabled())
+				continue;
+			int startindex = code.device_index();
+			int stopindex = startindex;
+			if (!devclass.multi())
+			{
+				if (startindex != 0)
+					continue;
+				stopindex = devclass.maxindex();
+			}
+
+			for (int curindex = startindex; curindex <= stopindex; curindex++)
+			{
+				code.set_device_index(curindex);
+				input_device_item *const item = item_from_code(code);
+				if (!item)
+					continue;
+				program.add_item(*item);
+
+				// joystick directions are read from both axes
+				std::array<input_device_item *, 2> depends{ item, nullptr };
+				if ((item->itemclass() == ITEM_CLASS_ABSOLUTE) && (code.device_class() == DEVICE_CLASS_JOYSTICK) && (code.item_modifier() >= ITEM_MODIFIER_LEFT) && (code.item_modifier() <= ITEM_MODIFIER_DOWN))
+				{
+					depends[0] = item->device().item(ITEM_ID_XAXIS);
+					depends[1] = item->device().item(ITEM_ID_YAXIS);
+					if (!depends[0] || !depends[1])
+						depends = { item, nullptr };
+				}
+				for (input_device_item *const depend : depends)
+				{
+					if (depend)
+						program.add_watched(watch_item(*depend));
+				}
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  poll_watched_items - read every item used by
+//  a compiled sequence once, and note which have
+//  changed
+//-------------------------------------------------
+
+void input_manager::poll_watched_items()
+{
+	m_poll_count++;
+	for (watched_item &watched : m_watched)
+	{
+		s32 const value = watched_value(*watched.m_item);
+		if (value != watched.m_value)
+		{
+			watched.m_value = value;
+			watched.m_changed = m_poll_count;
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  watch_item - return the index of an item in
+//  the watch list, adding it if necessary
+//-------------------------------------------------
+
+u32 input_manager::watch_item(input_device_item &item)
+{
+	auto const found = m_watched_index.find(&item);
+	if (found != m_watched_index.end())
+		return found->second;
+
+	u32 const index = m_watched.size();
+	m_watched.emplace_back(watched_item{ &item, watched_value(item), m_poll_count });
+	m_watched_index.emplace(&item, index);
+	return index;
+}
+
+
+//-------------------------------------------------
+//  watched_value - read the value of an item that
+//  decides whether it has changed; switches are
+//  read as switches so the lightgun reload hack
+//  and steadykey are taken into account
+//-------------------------------------------------
+
+s32 input_manager::watched_value(input_device_item &item)
+{
+	if (item.itemclass() == ITEM_CLASS_SWITCH)
+		return item.read_as_switch(ITEM_MODIFIER_NONE);
+	else
+		return item.update_value();
+}
+
+
 //-------------------------------------------------
 //  seq_axis_value - return the value of an axis
 //  defined in an input sequence
@@ -21,6 +21,8 @@
 #include "interface/inputman.h"
 #include "interface/inputseq.h"
 
+#include "inputseqprog.h"
+
 #include <algorithm>
 #include <array>
 #include <cassert>
@@ -28,7 +30,9 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 
 //**************************************************************************
@@ -38,6 +42,10 @@
 using osd::input_seq; // too much trouble to qualify this everywhere
 
 
+// an input sequence resolved to the items it reads
+using input_seq_program = basic_input_seq_program<input_device_item>;
+
+
 // ======================> input_manager
 
 // global machine-level information about devices
@@ -75,6 +83,7 @@ public:
 
 	// input sequence readers
 	bool seq_pressed(const input_seq &seq);
+	bool seq_pressed(input_seq_program &program, const input_seq &seq);
 	s32 seq_axis_value(const input_seq &seq, input_item_class &itemclass);
 
 	// input sequence helpers
@@ -83,17 +92,38 @@ public:
 	std::string seq_to_tokens(const input_seq &seq) const;
 	void seq_from_tokens(input_seq &seq, std::string_view _token);
 
+	// compiled input sequences
+	void compile_seq(const input_seq &seq, input_seq_program &program);
+	void poll_watched_items();
+	void invalidate_seq_programs() { m_generation++; }
+
 	// misc
 	bool map_device_to_controller(const devicemap_table &table);
 
 private:
+	// an item read by a compiled sequence, and the poll its value last changed at
+	struct watched_item
+	{
+		input_device_item * m_item;
+		s32                 m_value;
+		u32                 m_changed;
+	};
+
 	// internal helpers
 	void reset_memory();
+	u32 watch_item(input_device_item &item);
+	s32 watched_value(input_device_item &item);
 
 	// internal state
 	running_machine &   m_machine;
 	input_code          m_switch_memory[64];
 
+	// compiled input sequence state
+	u32                 m_generation;           // bumped when the codes may map to different items
+	u32                 m_poll_count;           // number of polls of the watched items
+	std::vector<watched_item> m_watched;        // items read by compiled sequences
+	std::unordered_map<input_device_item *, u32> m_watched_index; // index of each item in m_watched
+
 	// classes
 	std::array<std::unique_ptr<input_class>, DEVICE_CLASS_MAXIMUM> m_class;
 };
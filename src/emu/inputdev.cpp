@@ -606,6 +606,9 @@ void input_class::remap_device_index(int oldindex, int newindex)
 
 	// update the maximum index found, since newindex may exceed current m_maxindex
 	m_maxindex = std::max(m_maxindex, newindex);
+
+	// codes now refer to different devices
+	m_manager.invalidate_seq_programs();
 }
 
 
@@ -283,8 +283,8 @@ public:
 	bool multi() const { return m_multi; }
 
 	// setters
-	void enable(bool state = true) { m_enabled = state; }
-	void set_multi(bool multi = true) { m_multi = multi; }
+	void enable(bool state = true) { m_enabled = state; m_manager.invalidate_seq_programs(); }
+	void set_multi(bool multi = true) { m_multi = multi; m_manager.invalidate_seq_programs(); }
 
 	// device management
 	input_device &add_device(std::string_view name, std::string_view id, void *internal = nullptr);
@@ -0,0 +1,145 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    inputseqprog.h
+
+    Input sequences resolved to the host items they read.  The input
+    manager compiles a sequence once, then only evaluates it again when
+    one of its items has changed since the last result.  The item type
+    and the way items are read are supplied by the caller.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_INPUTSEQPROG_H
+#define MAME_EMU_INPUTSEQPROG_H
+
+#pragma once
+
+#include "interface/inputcode.h"
+#include "interface/inputseq.h"
+
+#include <algorithm>
+#include <vector>
+
+
+// ======================> basic_input_seq_program
+
+// an input sequence resolved to the items it reads, with its last result
+template <typename Item>
+class basic_input_seq_program
+{
+public:
+	// construction/destruction
+	basic_input_seq_program() { }
+
+	// compilation
+	void reset(const osd::input_seq &seq, u32 generation)
+	{
+		m_seq = seq;
+		m_generation = generation;
+		m_terms.clear();
+		m_items.clear();
+		m_watched.clear();
+		m_evaluated = false;
+	}
+	void add_term(input_item_class itemclass, input_item_modifier modifier, bool invert, bool group)
+	{
+		m_terms.emplace_back(term{ u32(m_items.size()), 0, itemclass, modifier, invert, group });
+	}
+	void add_item(Item &item)
+	{
+		m_items.emplace_back(&item);
+		m_terms.back().m_count++;
+	}
+	void add_watched(u32 index)
+	{
+		if (std::find(m_watched.begin(), m_watched.end(), index) == m_watched.end())
+			m_watched.emplace_back(index);
+	}
+
+	// getters
+	bool compiled_for(const osd::input_seq &seq, u32 generation) const { return (m_generation == generation) && (m_seq == seq); }
+	bool result() const { return m_result; }
+
+	// true if the last result can't be reused: it was never evaluated, or
+	// changed(index) reports a watched item changed after it was
+	template <typename T> bool stale(T &&changed) const
+	{
+		if (!m_evaluated)
+			return true;
+		for (u32 const index : m_watched)
+			if (changed(index) > m_poll)
+				return true;
+		return false;
+	}
+
+	// evaluate with the same rules as input_manager::seq_pressed, where
+	// read(item, itemclass, modifier) returns an item's value
+	template <typename T> bool evaluate(u32 poll, T &&read)
+	{
+		bool result = false;
+		for (term const &curterm : m_terms)
+		{
+			// a positive result from the previous group is final; otherwise later codes are ANDed
+			if (curterm.m_group && result)
+				break;
+			else if (!curterm.m_group && !result)
+				continue;
+
+			s32 value = 0;
+			for (u32 itemnum = curterm.m_first; itemnum < (curterm.m_first + curterm.m_count); itemnum++)
+			{
+				s32 const itemvalue = read(*m_items[itemnum], curterm.m_itemclass, curterm.m_modifier);
+				switch (curterm.m_itemclass)
+				{
+				case ITEM_CLASS_ABSOLUTE:
+					if (value == 0)
+						value = itemvalue;
+					break;
+
+				case ITEM_CLASS_RELATIVE:
+					value += itemvalue;
+					break;
+
+				case ITEM_CLASS_SWITCH:
+					value |= itemvalue;
+					break;
+
+				default:
+					break;
+				}
+			}
+			result = (value != 0) ^ curterm.m_invert;
+		}
+
+		m_result = result;
+		m_poll = poll;
+		m_evaluated = true;
+		return result;
+	}
+
+private:
+	// one code of the sequence, read from a run of items
+	struct term
+	{
+		u32                 m_first;        // index of the first item
+		u32                 m_count;        // number of items
+		input_item_class    m_itemclass;    // class to read the items as
+		input_item_modifier m_modifier;     // modifier to read them with
+		bool                m_invert;       // preceded by NOT
+		bool                m_group;        // first code after an OR
+	};
+
+	// internal state
+	osd::input_seq          m_seq;                  // sequence this was compiled from
+	u32                     m_generation = ~u32(0); // generation of the item mapping it was compiled for
+	std::vector<term>       m_terms;                // codes, in sequence order
+	std::vector<Item *>     m_items;                // items read by the codes
+	std::vector<u32>        m_watched;              // caller's indices of the items that decide its result
+	u32                     m_poll = 0;             // poll the result was evaluated at
+	bool                    m_evaluated = false;    // result is valid
+	bool                    m_result = false;       // last result
+};
+
+#endif // MAME_EMU_INPUTSEQPROG_H
@@ -48,6 +48,9 @@ namespace {
 
 const int SPACE_COUNT = 3;
 
+// host input is polled at most this often between frames for late reads
+const int LATE_INPUT_POLLS_PER_SECOND = 1000;
+
 
 
 //**************************************************************************
@@ -289,6 +292,7 @@ class inp_header
 public:
 	// parameters
 	static constexpr unsigned MAJVERSION = 3;
+	static constexpr unsigned MAJVERSION_INDEXED = 4;
 	static constexpr unsigned MINVERSION = 0;
 
 	bool read(emu_file &f)
@@ -333,9 +337,9 @@ public:
 	{
 		put_u64le(m_data + OFFS_BASETIME, time);
 	}
-	void set_version()
+	void set_version(unsigned majversion = MAJVERSION)
 	{
-		m_data[OFFS_MAJVERSION] = MAJVERSION;
+		m_data[OFFS_MAJVERSION] = majversion;
 		m_data[OFFS_MINVERSION] = MINVERSION;
 	}
 	void set_sysname(std::string const &name)
@@ -375,6 +379,34 @@ private:
 	u8                              m_data[OFFS_END];
 };
 
+
+// ======================> inp_keyframe_header
+
+// indexed INP files: each keyframe is this header, then a zlib stream
+// holding the saved state and the frames up to the next keyframe, ending
+// with an empty frame; after the last keyframe the index lists them all,
+// and the footer at the end of the file says where the index is
+class inp_keyframe_header
+{
+public:
+	static constexpr std::size_t    OFFS_MAGIC       = 0x00;    // 0x04 bytes
+	static constexpr std::size_t    OFFS_STATESIZE   = 0x04;    // 0x04 bytes (little-endian binary integer)
+	static constexpr std::size_t    OFFS_FRAME       = 0x08;    // 0x08 bytes (little-endian binary integer)
+	static constexpr std::size_t    OFFS_SECONDS     = 0x10;    // 0x08 bytes (little-endian binary integer)
+	static constexpr std::size_t    OFFS_ATTOSECONDS = 0x18;    // 0x08 bytes (little-endian binary integer)
+	static constexpr std::size_t    OFFS_HASH        = 0x20;    // 0x08 bytes (little-endian binary integer)
+	static constexpr std::size_t    OFFS_END         = 0x28;
+
+	// the index is INDEX_MAGIC and a little-endian count, followed by the
+	// same fields for each keyframe with its file offset in place of the magic
+	static constexpr std::size_t    INDEX_HEADER     = 0x08;
+	static constexpr std::size_t    FOOTER_SIZE      = 0x10;    // index offset, then FOOTER_MAGIC
+
+	static u8 const                 MAGIC[OFFS_STATESIZE - OFFS_MAGIC];
+	static u8 const                 INDEX_MAGIC[4];
+	static u8 const                 FOOTER_MAGIC[8];
+};
+
 } // anonymous namespace
 
 
@@ -383,6 +415,9 @@ const char *const ioport_manager::seqtypestrings[] = { "standard", "increment",
 
 
 u8 const inp_header::MAGIC[inp_header::OFFS_BASETIME - inp_header::OFFS_MAGIC] = { 'M', 'A', 'M', 'E', 'I', 'N', 'P', 0 };
+u8 const inp_keyframe_header::MAGIC[inp_keyframe_header::OFFS_STATESIZE - inp_keyframe_header::OFFS_MAGIC] = { 'K', 'E', 'Y', 'F' };
+u8 const inp_keyframe_header::INDEX_MAGIC[4] = { 'I', 'N', 'D', 'X' };
+u8 const inp_keyframe_header::FOOTER_MAGIC[8] = { 'M', 'A', 'M', 'E', 'I', 'D', 'X', 0 };
 
 
 
@@ -556,14 +591,10 @@ void digital_joystick::frame_update()
 	m_current = 0;
 
 	// read all the associated ports
-	running_machine *machine = nullptr;
 	for (direction_t direction = JOYDIR_UP; direction < JOYDIR_COUNT; ++direction)
 		for (const std::reference_wrapper<ioport_field> &i : m_field[direction])
-		{
-			machine = &i.get().machine();
-			if (machine->input().seq_pressed(i.get().seq(SEQ_TYPE_STANDARD)))
+			if (i.get().seq_pressed(SEQ_TYPE_STANDARD))
 				m_current |= 1 << direction;
-		}
 
 	// lock out opposing directions (left + right or up + down)
 	if ((m_current & (UP_BIT | DOWN_BIT)) == (UP_BIT | DOWN_BIT))
@@ -1210,6 +1241,9 @@ void ioport_field::select_next_setting()
 
 void ioport_field::frame_update(ioport_value &result)
 {
+	// only plain buttons and switches are sampled again when read
+	m_live->late = false;
+
 	// skip if not enabled
 	if (!enabled())
 		return;
@@ -1235,7 +1269,7 @@ void ioport_field::frame_update(ioport_value &result)
 	}
 
 	// if the state changed, look for switch down/switch up
-	bool curstate = m_digital_value || machine().input().seq_pressed(seq());
+	bool curstate = m_digital_value || seq_pressed();
 	bool changed = false;
 	if (curstate != m_live->last)
 	{
@@ -1284,6 +1318,9 @@ void ioport_field::frame_update(ioport_value &result)
 	if (m_live->toggle)
 		curstate = false;
 
+	// impulse, toggle and coin inputs count presses per frame, so they aren't sampled late
+	m_live->late = !effective_impulse && !m_live->toggle && (m_type < IPT_COIN1 || m_type > IPT_COIN12);
+
 	// additional logic to restrict digital joysticks
 	if (curstate && !m_digital_value && m_live->joystick != nullptr && m_way != 16 && !machine().options().joystick_contradictory())
 	{
@@ -1316,6 +1353,52 @@ void ioport_field::frame_update(ioport_value &result)
 }
 
 
+//-------------------------------------------------
+//  late_update - sample a plain digital field
+//  again, between frames
+//-------------------------------------------------
+
+void ioport_field::late_update(ioport_value &result)
+{
+	bool curstate = m_digital_value || machine().input().seq_pressed(seq());
+	m_live->last = curstate;
+
+	// the same joystick restrictions as a frame update
+	if (curstate && !m_digital_value && m_live->joystick != nullptr && m_way != 16 && !machine().options().joystick_contradictory())
+	{
+		u8 mask = (m_way == 4) ? m_live->joystick->current4way() : m_live->joystick->current();
+		if (!(mask & (1 << m_live->joydir)))
+			curstate = false;
+	}
+
+	if (curstate)
+		result |= m_mask;
+}
+
+
+//-------------------------------------------------
+//  seq_pressed - return true if the sequence in
+//  effect is pressed, using its compiled form
+//-------------------------------------------------
+
+bool ioport_field::seq_pressed(input_seq_type seqtype)
+{
+	return machine().input().seq_pressed(m_live->program[seqtype], seq(seqtype));
+}
+
+
+//-------------------------------------------------
+//  compile_seqs - compile the sequences in effect
+//  ahead of the first frame that reads them
+//-------------------------------------------------
+
+void ioport_field::compile_seqs()
+{
+	for (input_seq_type seqtype = SEQ_TYPE_STANDARD; seqtype < SEQ_TYPE_TOTAL; ++seqtype)
+		machine().input().compile_seq(seq(seqtype), m_live->program[seqtype]);
+}
+
+
 //-------------------------------------------------
 //  crosshair_read - compute the crosshair
 //  position
@@ -1461,7 +1544,8 @@ ioport_field_live::ioport_field_live(ioport_field &field, analog_field *analog)
 		last(0),
 		toggle(field.toggle()),
 		joydir(digital_joystick::JOYDIR_COUNT),
-		lockout(false)
+		lockout(false),
+		late(false)
 {
 	// fill in the basic values
 	for (input_seq_type seqtype = SEQ_TYPE_STANDARD; seqtype < SEQ_TYPE_TOTAL; ++seqtype)
@@ -1574,6 +1658,10 @@ ioport_value ioport_port::read()
 	if (!manager().safe_to_read())
 		throw emu_fatalerror("Input ports cannot be read at init time!");
 
+	// look at buttons and switches again if the host input has changed since
+	if (m_live->latemask && manager().late_input())
+		manager().late_update(*this);
+
 	// start with the digital state
 	ioport_value result = m_live->digital;
 
@@ -1614,10 +1702,16 @@ void ioport_port::frame_update()
 {
 	// start with 0 values for the digital bits
 	m_live->digital = 0;
+	m_live->latemask = 0;
 
 	// now loop back and modify based on the inputs
 	for (ioport_field &field : m_fieldlist)
+	{
 		field.frame_update(m_live->digital);
+		if (field.live().late)
+			m_live->latemask |= field.mask();
+	}
+	m_live->latepoll = manager().m_late_poll;
 }
 
 
@@ -1736,7 +1830,9 @@ void ioport_port::update_defvalue(bool flush_defaults)
 ioport_port_live::ioport_port_live(ioport_port &port)
 	: defvalue(0),
 		digital(0),
-		outputvalue(0)
+		outputvalue(0),
+		latemask(0),
+		latepoll(0)
 {
 	// iterate over fields
 	for (ioport_field &field : port.fields())
@@ -1774,8 +1870,20 @@ ioport_manager::ioport_manager(running_machine &machine)
 	, m_safe_to_read(false)
 	, m_last_frame_time(attotime::zero)
 	, m_last_delta_nsec(0)
+	, m_late_input(false)
+	, m_late_interval(0)
+	, m_late_last_poll(0)
+	, m_late_poll(0)
 	, m_playback_accumulated_speed(0)
 	, m_playback_accumulated_frames(0)
+	, m_record_indexed(false)
+	, m_record_frames(0)
+	, m_playback_indexed(false)
+	, m_playback_keyframe(0)
+	, m_playback_stop(0)
+	, m_playback_cursor(0)
+	, m_playback_verified(0)
+	, m_playback_mismatched(0)
 	, m_deselected_card_config()
 	, m_applied_device_defaults(false)
 {
@@ -1866,6 +1974,16 @@ time_t ioport_manager::initialize()
 	// open playback and record files if specified
 	time_t basetime = playback_init();
 	record_init();
+
+	// recordings hold one value per port per frame, and deterministic runs can't depend on the host's timing
+	if (machine().options().late_input())
+	{
+		if (m_playback_file || m_record_file || machine().deterministic())
+			osd_printf_verbose("Late input sampling disabled for playback, record or deterministic mode\n");
+		else
+			m_late_input = true;
+		m_late_interval = osd_ticks_per_second() / LATE_INPUT_POLLS_PER_SECOND;
+	}
 	return basetime;
 }
 
@@ -2160,13 +2278,20 @@ void ioport_manager::frame_update()
 
 	// record/playback information about the current frame
 	attotime curtime = machine().time();
-	playback_frame(curtime);
+	playback_frame(curtime); // may move time on to a keyframe
 	record_frame(curtime);
 
 	// track the duration of the previous frame
 	m_last_delta_nsec = (curtime - m_last_frame_time).as_attoseconds() / ATTOSECONDS_PER_NANOSECOND;
 	m_last_frame_time = curtime;
 
+	// the OSD has just been polled, so late reads can wait a while
+	m_late_last_poll = osd_ticks();
+	m_late_poll++;
+
+	// note which host items have changed, so only sequences that read them are evaluated
+	machine().input().poll_watched_items();
+
 	// update the digital joysticks
 	for (digital_joystick &joystick : m_joystick_list)
 		joystick.frame_update();
@@ -2196,6 +2321,43 @@ void ioport_manager::frame_update()
 }
 
 
+//-------------------------------------------------
+//  late_update - poll the host input if it's
+//  been long enough, and sample a port's plain
+//  digital fields again if the poll is newer
+//  than its values
+//-------------------------------------------------
+
+void ioport_manager::late_update(ioport_port &port)
+{
+	// the OSD is only polled from the emulation thread, and the UI owns the inputs while a menu is up
+	if (machine().scheduler().parallel_running() || machine().ui().is_menu_active())
+		return;
+
+	osd_ticks_t const now = osd_ticks();
+	if ((now - m_late_last_poll) >= m_late_interval)
+	{
+		auto profile = g_profiler.start(PROFILER_INPUT);
+		m_late_last_poll = now;
+		m_late_poll++;
+		machine().osd().input_update(false);
+		for (digital_joystick &joystick : m_joystick_list)
+			joystick.frame_update();
+	}
+
+	ioport_port_live &live = port.live();
+	if (live.latepoll == m_late_poll)
+		return;
+	live.latepoll = m_late_poll;
+
+	ioport_value digital = live.digital & ~live.latemask;
+	for (ioport_field &field : port.fields())
+		if (field.live().late && field.enabled())
+			field.late_update(digital);
+	live.digital = digital;
+}
+
+
 //-------------------------------------------------
 //  frame_interpolate - interpolate between two
 //  values based on the time between frames
@@ -2234,6 +2396,10 @@ void ioport_manager::load_config(config_type cfg_type, config_level cfg_level, u
 	// in the completion phase, we finish the initialization with the final ports
 	if (cfg_type == config_type::FINAL)
 	{
+		for (auto &port : m_portlist)
+			for (ioport_field &field : port.second->fields())
+				field.compile_seqs();
+
 		m_safe_to_read = true;
 		frame_update();
 	}
@@ -2945,13 +3111,27 @@ Type ioport_manager::playback_read(Type &result)
 	if (!m_playback_stream)
 		return result = Type(0);
 
-	// read the value; if we fail, end playback
-	size_t read;
-	m_playback_stream->read(&result, sizeof(result), read);
-	if (sizeof(result) != read)
+	// indexed files have the whole frame read already
+	if (m_playback_indexed)
 	{
-		playback_end("End of file");
-		return result = Type(0);
+		if ((m_playback_frame.size() - m_playback_cursor) < sizeof(result))
+		{
+			playback_end("Out of sync");
+			return result = Type(0);
+		}
+		std::memcpy(&result, &m_playback_frame[m_playback_cursor], sizeof(result));
+		m_playback_cursor += sizeof(result);
+	}
+	else
+	{
+		// read the value; if we fail, end playback
+		size_t read;
+		m_playback_stream->read(&result, sizeof(result), read);
+		if (sizeof(result) != read)
+		{
+			playback_end("End of file");
+			return result = Type(0);
+		}
 	}
 
 	// normalize byte order
@@ -3003,7 +3183,7 @@ time_t ioport_manager::playback_init()
 		fatalerror("Input file is corrupt or invalid (missing header)\n");
 	if (!header.check_magic())
 		fatalerror("Input file invalid or in an older, unsupported format\n");
-	if (header.get_majversion() != inp_header::MAJVERSION)
+	if ((header.get_majversion() != inp_header::MAJVERSION) && (header.get_majversion() != inp_header::MAJVERSION_INDEXED))
 		fatalerror("Input file format version mismatch\n");
 
 	// output info to console
@@ -3018,12 +3198,189 @@ time_t ioport_manager::playback_init()
 	if (sysname != machine().system().name)
 		osd_printf_info("Input file is for machine '%s', not for current machine '%s'\n", sysname, machine().system().name);
 
-	// enable compression
-	m_playback_stream = util::zlib_read(*m_playback_file, 16386);
+	int const start = machine().options().playback_keyframe();
+	int const count = machine().options().playback_keyframes();
+	m_playback_indexed = header.get_majversion() == inp_header::MAJVERSION_INDEXED;
+	if (!m_playback_indexed)
+	{
+		if (start || count)
+			fatalerror("Input file has no keyframes\n");
+
+		// enable compression
+		m_playback_stream = util::zlib_read(*m_playback_file, 16386);
+		return basetime;
+	}
+
+	// find the keyframe to start from in the index
+	if (!playback_index())
+		fatalerror("Input file is corrupt or invalid (missing index)\n");
+	osd_printf_info("%u keyframes\n", unsigned(m_playback_index.size()));
+	if ((start < 0) || (unsigned(start) >= m_playback_index.size()))
+		fatalerror("Input file has no keyframe %d\n", start);
+	m_playback_keyframe = start;
+	m_playback_stop = (count > 0) ? (start + count) : 0;
+	if (m_playback_file->seek(m_playback_index[start].offset, SEEK_SET) || !playback_keyframe())
+		fatalerror("Input file is corrupt or invalid (bad keyframe %d)\n", start);
+
+	// the first keyframe is where the recording started, so there's no need to load it
+	if (!start)
+		m_playback_state.clear();
+	else if (m_playback_state.empty())
+		fatalerror("Input file keyframe %d has no saved state\n", start);
+	else
+		osd_printf_info("Starting from keyframe %d at %s\n", start, m_playback_index[start].time.as_string(9));
 	return basetime;
 }
 
 
+//-------------------------------------------------
+//  playback_index - read the keyframe index from
+//  the end of an indexed INP file
+//-------------------------------------------------
+
+bool ioport_manager::playback_index()
+{
+	u8 footer[inp_keyframe_header::FOOTER_SIZE];
+	u64 const filesize = m_playback_file->size();
+	if ((filesize < sizeof(footer)) || m_playback_file->seek(-s64(sizeof(footer)), SEEK_END) || (m_playback_file->read(footer, sizeof(footer)) != sizeof(footer)))
+		return false;
+	if (std::memcmp(footer + 8, inp_keyframe_header::FOOTER_MAGIC, sizeof(inp_keyframe_header::FOOTER_MAGIC)))
+		return false;
+
+	u8 header[inp_keyframe_header::INDEX_HEADER];
+	u64 const offset = get_u64le(footer);
+	if ((offset >= filesize) || m_playback_file->seek(offset, SEEK_SET) || (m_playback_file->read(header, sizeof(header)) != sizeof(header)))
+		return false;
+	if (std::memcmp(header, inp_keyframe_header::INDEX_MAGIC, sizeof(inp_keyframe_header::INDEX_MAGIC)))
+		return false;
+
+	u32 const count = get_u32le(header + 4);
+	if (!count || (count > ((filesize - offset) / inp_keyframe_header::OFFS_END)))
+		return false;
+	m_playback_index.clear();
+	m_playback_index.reserve(count);
+	for (u32 index = 0; index < count; index++)
+	{
+		u8 entry[inp_keyframe_header::OFFS_END];
+		if (m_playback_file->read(entry, sizeof(entry)) != sizeof(entry))
+			return false;
+		m_playback_index.emplace_back(inp_keyframe{
+				get_u64le(entry + inp_keyframe_header::OFFS_MAGIC),
+				get_u64le(entry + inp_keyframe_header::OFFS_FRAME),
+				attotime(s64(get_u64le(entry + inp_keyframe_header::OFFS_SECONDS)), s64(get_u64le(entry + inp_keyframe_header::OFFS_ATTOSECONDS))),
+				get_u64le(entry + inp_keyframe_header::OFFS_HASH) });
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  playback_keyframe - read the keyframe at the
+//  current file position and start reading the
+//  frames after it
+//-------------------------------------------------
+
+bool ioport_manager::playback_keyframe()
+{
+	u8 header[inp_keyframe_header::OFFS_END];
+	if (m_playback_file->read(header, sizeof(header)) != sizeof(header))
+		return false;
+	if (std::memcmp(header, inp_keyframe_header::MAGIC, sizeof(inp_keyframe_header::MAGIC)))
+		return false;
+
+	// the saved state comes first in the stream
+	m_playback_stream = util::zlib_read(*m_playback_file, 16386);
+	if (!m_playback_stream)
+		return false;
+	m_playback_state.resize(get_u32le(header + inp_keyframe_header::OFFS_STATESIZE));
+	size_t actual = 0;
+	if (!m_playback_state.empty() && (m_playback_stream->read(m_playback_state.data(), m_playback_state.size(), actual) || (actual != m_playback_state.size())))
+		return false;
+
+	// frames are XORed with the previous one, starting over at each keyframe
+	m_playback_previous.clear();
+	return true;
+}
+
+
+//-------------------------------------------------
+//  playback_next_frame - read the next frame of
+//  an indexed INP file, moving on to the next
+//  keyframe at the end of one
+//-------------------------------------------------
+
+bool ioport_manager::playback_next_frame()
+{
+	u8 length[4];
+	size_t actual;
+	if (m_playback_stream->read(length, sizeof(length), actual) || (actual != sizeof(length)))
+	{
+		playback_end("End of file");
+		return false;
+	}
+
+	// an empty frame ends the frames after a keyframe
+	if (!get_u32le(length))
+	{
+		m_playback_keyframe++;
+		if (m_playback_keyframe >= m_playback_index.size())
+		{
+			playback_end("End of file");
+			return false;
+		}
+		m_playback_stream.reset();
+		if (m_playback_file->seek(m_playback_index[m_playback_keyframe].offset, SEEK_SET) || !playback_keyframe())
+		{
+			playback_end("Corrupt keyframe");
+			return false;
+		}
+		std::vector<u8>().swap(m_playback_state);
+		playback_check_keyframe();
+		if (m_playback_keyframe == m_playback_stop)
+		{
+			playback_end("Reached the last keyframe");
+			return false;
+		}
+		return playback_next_frame();
+	}
+
+	m_playback_frame.resize(get_u32le(length));
+	if (m_playback_stream->read(m_playback_frame.data(), m_playback_frame.size(), actual) || (actual != m_playback_frame.size()))
+	{
+		playback_end("End of file");
+		return false;
+	}
+	m_playback_previous.resize(m_playback_frame.size(), 0);
+	for (size_t index = 0; index < m_playback_frame.size(); index++)
+		m_playback_previous[index] = m_playback_frame[index] ^= m_playback_previous[index];
+	m_playback_cursor = 0;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  playback_check_keyframe - compare the state
+//  with the one recorded at a keyframe
+//-------------------------------------------------
+
+void ioport_manager::playback_check_keyframe()
+{
+	inp_keyframe const &keyframe = m_playback_index[m_playback_keyframe];
+	if (!keyframe.hash)
+		return;
+
+	if (machine().state_hash() == keyframe.hash)
+	{
+		m_playback_verified++;
+	}
+	else
+	{
+		m_playback_mismatched++;
+		osd_printf_warning("Playback state differs from the recording at keyframe %u (%s)\n", m_playback_keyframe, keyframe.time.as_string(9));
+	}
+}
+
+
 //-------------------------------------------------
 //  playback_end - end INP playback
 //-------------------------------------------------
@@ -3046,6 +3403,8 @@ void ioport_manager::playback_end(const char *message)
 			m_playback_accumulated_speed /= m_playback_accumulated_frames;
 		osd_printf_info("Total playback frames: %d\n", u32(m_playback_accumulated_frames));
 		osd_printf_info("Average recorded speed: %d%%\n", u32((m_playback_accumulated_speed * 200 + 1) >> 21));
+		if (m_playback_indexed)
+			osd_printf_info("Keyframe states matched: %u, differed: %u\n", m_playback_verified, m_playback_mismatched);
 
 		// close the program at the end of inp file playback
 		if (machine().options().exit_after_playback())
@@ -3062,11 +3421,34 @@ void ioport_manager::playback_end(const char *message)
 //  playback
 //-------------------------------------------------
 
-void ioport_manager::playback_frame(const attotime &curtime)
+void ioport_manager::playback_frame(attotime &curtime)
 {
 	// if playing back, fetch the information and verify
 	if (m_playback_stream)
 	{
+		if (m_playback_indexed)
+		{
+			// on the first frame, either load the keyframe to start from or check the state is the same
+			if (!m_playback_state.empty())
+			{
+				save_error const err = machine().save().read_buffer(m_playback_state.data(), m_playback_state.size());
+				std::vector<u8>().swap(m_playback_state);
+				if (err != STATERR_NONE)
+				{
+					playback_end("Unable to load keyframe state");
+					return;
+				}
+				curtime = machine().time();
+			}
+			else if (!m_playback_accumulated_frames && !m_playback_keyframe)
+			{
+				playback_check_keyframe();
+			}
+
+			if (!playback_next_frame())
+				return;
+		}
+
 		// first the absolute time
 		seconds_t seconds_temp;
 		attoseconds_t attoseconds_temp;
@@ -3131,6 +3513,14 @@ void ioport_manager::record_write(Type value)
 	else if (sizeof(value) == 2)
 		value = little_endianize_int16(value);
 
+	// indexed files collect the frame to write it all at once
+	if (m_record_indexed)
+	{
+		u8 const *const bytes = reinterpret_cast<u8 const *>(&value);
+		m_record_frame.insert(m_record_frame.end(), bytes, bytes + sizeof(value));
+		return;
+	}
+
 	// write the value; if we fail, end recording
 	size_t written;
 	if (m_record_stream->write(&value, sizeof(value), written) || (sizeof(value) != written))
@@ -3166,17 +3556,29 @@ void ioport_manager::record_init()
 	system_time systime;
 	machine().base_datetime(systime);
 
+	// keyframes make an indexed file
+	int const interval = machine().options().record_keyframe();
+	m_record_indexed = interval > 0;
+
 	// fill in the header
 	inp_header header;
 	header.set_magic();
 	header.set_basetime(systime.time);
-	header.set_version();
+	header.set_version(m_record_indexed ? inp_header::MAJVERSION_INDEXED : inp_header::MAJVERSION);
 	header.set_sysname(machine().system().name);
 	header.set_appdesc(util::string_format("%s %s", emulator_info::get_appname(), emulator_info::get_build_version()));
 
 	// write it
 	header.write(*m_record_file);
 
+	// the first keyframe is written on the first frame, and starts the compressed stream
+	if (m_record_indexed)
+	{
+		m_record_interval = attotime::from_seconds(interval);
+		m_record_next_keyframe = attotime::zero;
+		return;
+	}
+
 	// enable compression
 	m_record_stream = util::zlib_write(*m_record_file, 6, 16384);
 }
@@ -3191,6 +3593,13 @@ void ioport_manager::record_end(const char *message)
 	// only applies if we have a live file
 	if (m_record_stream)
 	{
+		// indexed files end with the last frame and the index
+		if (m_record_indexed)
+		{
+			record_flush_frame();
+			record_index();
+		}
+
 		// close the file
 		m_record_stream.reset(); // TODO: check for errors flushing the last compressed block before doing this
 		m_record_file.reset();
@@ -3209,6 +3618,18 @@ void ioport_manager::record_end(const char *message)
 
 void ioport_manager::record_frame(const attotime &curtime)
 {
+	// indexed files write the previous frame now it's complete, then any keyframe that's due
+	if (m_record_indexed && m_record_file)
+	{
+		if (!record_flush_frame())
+		{
+			record_end("Out of space");
+			return;
+		}
+		if (curtime >= m_record_next_keyframe)
+			record_keyframe(curtime);
+	}
+
 	// if recording, record information about the current frame
 	if (m_record_stream)
 	{
@@ -3250,6 +3671,134 @@ void ioport_manager::record_port(ioport_port &port)
 }
 
 
+//-------------------------------------------------
+//  record_flush_frame - write the frame collected
+//  for an indexed file, XORed with the previous
+//  one so the unchanged values compress away
+//-------------------------------------------------
+
+bool ioport_manager::record_flush_frame()
+{
+	if (!m_record_stream || m_record_frame.empty())
+		return true;
+
+	u8 length[4];
+	put_u32le(length, u32(m_record_frame.size()));
+	m_record_previous.resize(m_record_frame.size(), 0);
+	for (size_t index = 0; index < m_record_frame.size(); index++)
+	{
+		u8 const value = m_record_frame[index];
+		m_record_frame[index] ^= m_record_previous[index];
+		m_record_previous[index] = value;
+	}
+
+	size_t written;
+	bool const ok =
+			!m_record_stream->write(length, sizeof(length), written) && (sizeof(length) == written) &&
+			!m_record_stream->write(m_record_frame.data(), m_record_frame.size(), written) && (m_record_frame.size() == written);
+	m_record_frame.clear();
+	m_record_frames++;
+	return ok;
+}
+
+
+//-------------------------------------------------
+//  record_keyframe - end the frames after the
+//  previous keyframe and save the state in a new
+//  one
+//-------------------------------------------------
+
+void ioport_manager::record_keyframe(const attotime &curtime)
+{
+	// an empty frame marks the end of the previous keyframe's frames
+	if (m_record_stream)
+	{
+		u8 const length[4] = { 0, 0, 0, 0 };
+		size_t written;
+		std::error_condition err = m_record_stream->write(length, sizeof(length), written);
+		if (!err)
+			err = m_record_stream->finalize();
+		m_record_stream.reset();
+		if (err)
+		{
+			m_record_file.reset();
+			machine().popmessage("Recording Ended\nReason: %s", "Out of space");
+			return;
+		}
+	}
+
+	// a system that can't save its state still gets keyframes, but playback can't start from them
+	std::vector<u8> state(ram_state::get_size(machine().save()));
+	if (state.empty() || (machine().save().write_buffer(state.data(), state.size()) != STATERR_NONE))
+		state.clear();
+	inp_keyframe const keyframe{ m_record_file->tell(), m_record_frames, curtime, state.empty() ? 0 : machine().state_hash() };
+
+	u8 header[inp_keyframe_header::OFFS_END];
+	std::memcpy(header + inp_keyframe_header::OFFS_MAGIC, inp_keyframe_header::MAGIC, sizeof(inp_keyframe_header::MAGIC));
+	put_u32le(header + inp_keyframe_header::OFFS_STATESIZE, u32(state.size()));
+	put_u64le(header + inp_keyframe_header::OFFS_FRAME, keyframe.frame);
+	put_u64le(header + inp_keyframe_header::OFFS_SECONDS, u64(curtime.seconds()));
+	put_u64le(header + inp_keyframe_header::OFFS_ATTOSECONDS, u64(curtime.attoseconds()));
+	put_u64le(header + inp_keyframe_header::OFFS_HASH, keyframe.hash);
+	if (m_record_file->write(header, sizeof(header)) != sizeof(header))
+	{
+		m_record_file.reset();
+		machine().popmessage("Recording Ended\nReason: %s", "Out of space");
+		return;
+	}
+
+	// the state starts the new compressed stream
+	m_record_stream = util::zlib_write(*m_record_file, 6, 16384);
+	size_t written;
+	if (!m_record_stream || (!state.empty() && (m_record_stream->write(state.data(), state.size(), written) || (state.size() != written))))
+	{
+		record_end("Out of space");
+		return;
+	}
+	m_record_previous.clear();
+	m_record_index.emplace_back(keyframe);
+	m_record_next_keyframe = curtime + m_record_interval;
+}
+
+
+//-------------------------------------------------
+//  record_index - end the last keyframe's frames
+//  and write the index of keyframes at the end of
+//  an indexed file
+//-------------------------------------------------
+
+bool ioport_manager::record_index()
+{
+	u8 const length[4] = { 0, 0, 0, 0 };
+	size_t written;
+	if (m_record_stream->write(length, sizeof(length), written) || m_record_stream->finalize())
+		return false;
+
+	u8 header[inp_keyframe_header::INDEX_HEADER];
+	u64 const offset = m_record_file->tell();
+	std::memcpy(header, inp_keyframe_header::INDEX_MAGIC, sizeof(inp_keyframe_header::INDEX_MAGIC));
+	put_u32le(header + 4, u32(m_record_index.size()));
+	if (m_record_file->write(header, sizeof(header)) != sizeof(header))
+		return false;
+	for (inp_keyframe const &keyframe : m_record_index)
+	{
+		u8 entry[inp_keyframe_header::OFFS_END];
+		put_u64le(entry + inp_keyframe_header::OFFS_MAGIC, keyframe.offset);
+		put_u64le(entry + inp_keyframe_header::OFFS_FRAME, keyframe.frame);
+		put_u64le(entry + inp_keyframe_header::OFFS_SECONDS, u64(keyframe.time.seconds()));
+		put_u64le(entry + inp_keyframe_header::OFFS_ATTOSECONDS, u64(keyframe.time.attoseconds()));
+		put_u64le(entry + inp_keyframe_header::OFFS_HASH, keyframe.hash);
+		if (m_record_file->write(entry, sizeof(entry)) != sizeof(entry))
+			return false;
+	}
+
+	u8 footer[inp_keyframe_header::FOOTER_SIZE];
+	put_u64le(footer, offset);
+	std::memcpy(footer + 8, inp_keyframe_header::FOOTER_MAGIC, sizeof(inp_keyframe_header::FOOTER_MAGIC));
+	return m_record_file->write(footer, sizeof(footer)) == sizeof(footer);
+}
+
+
 
 //**************************************************************************
 //  I/O PORT CONFIGURER
@@ -3889,7 +4438,7 @@ void analog_field::frame_update(running_machine &machine)
 	// if the decrement code sequence is pressed, add the key delta to
 	// the accumulated delta; also note that the last input was a digital one
 	bool keypressed = false;
-	if (machine.input().seq_pressed(m_field.seq(SEQ_TYPE_DECREMENT)))
+	if (m_field.seq_pressed(SEQ_TYPE_DECREMENT))
 	{
 		keypressed = true;
 		if (m_delta != 0)
@@ -3901,7 +4450,7 @@ void analog_field::frame_update(running_machine &machine)
 	}
 
 	// same for the increment code sequence
-	if (machine.input().seq_pressed(m_field.seq(SEQ_TYPE_INCREMENT)))
+	if (m_field.seq_pressed(SEQ_TYPE_INCREMENT))
 	{
 		keypressed = true;
 		if (m_delta)
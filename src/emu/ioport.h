@@ -644,8 +644,11 @@ public:
 	bool has_next_setting() const;
 	void select_next_setting();
 	float crosshair_read() const;
+	bool seq_pressed(input_seq_type seqtype = SEQ_TYPE_STANDARD);
+	void compile_seqs();
 	void init_live_state(analog_field *analog);
 	void frame_update(ioport_value &result);
+	void late_update(ioport_value &result);
 	void reduce_mask(ioport_value bits_to_remove) { m_mask &= ~bits_to_remove; }
 
 	// user-controllable settings for a field
@@ -723,12 +726,14 @@ struct ioport_field_live
 	analog_field *          analog;             // pointer to live analog data if this is an analog field
 	digital_joystick *      joystick;           // pointer to digital joystick information
 	input_seq               seq[SEQ_TYPE_TOTAL];// currently configured input sequences
+	input_seq_program       program[SEQ_TYPE_TOTAL];// sequences in effect, compiled for reading each frame
 	ioport_value            value;              // current value of this port
 	u8                      impulse;            // counter for impulse controls
 	bool                    last;               // were we pressed last time?
 	bool                    toggle;             // current toggle setting
 	digital_joystick::direction_t joydir;       // digital joystick direction index
 	bool                    lockout;            // user lockout
+	bool                    late;               // can be sampled again when the port is read
 	std::string             name;               // overridden name
 	std::string             cfg[SEQ_TYPE_TOTAL];// configuration strings
 };
@@ -919,6 +924,8 @@ struct ioport_port_live
 	ioport_value            defvalue;           // combined default value across the port
 	ioport_value            digital;            // current value from all digital inputs
 	ioport_value            outputvalue;        // current value for outputs
+	ioport_value            latemask;           // digital bits that can be sampled again when read
+	u32                     latepoll;           // late input poll the digital bits were last sampled at
 };
 
 
@@ -930,6 +937,7 @@ class ioport_manager
 	DISABLE_COPYING(ioport_manager);
 	friend class device_t;
 	friend class ioport_configurer;
+	friend class ioport_port;
 
 public:
 	// construction/destruction
@@ -941,6 +949,7 @@ public:
 	running_machine &machine() const noexcept { return m_machine; }
 	const ioport_list &ports() const noexcept { return m_portlist; }
 	bool safe_to_read() const noexcept { return m_safe_to_read; }
+	bool late_input() const noexcept { return m_late_input; }
 
 	// type helpers
 	const std::vector<input_type_entry> &types() const noexcept { return m_typelist; }
@@ -966,6 +975,7 @@ private:
 
 	void frame_update_callback();
 	void frame_update();
+	void late_update(ioport_port &port);
 
 	ioport_port *port(const std::string &tag) const { auto search = m_portlist.find(tag); if (search != m_portlist.end()) return search->second.get(); else return nullptr; }
 	void exit();
@@ -987,14 +997,21 @@ private:
 	template<typename Type> Type playback_read(Type &result);
 	time_t playback_init();
 	void playback_end(const char *message = nullptr);
-	void playback_frame(const attotime &curtime);
+	void playback_frame(attotime &curtime);
 	void playback_port(ioport_port &port);
+	bool playback_index();
+	bool playback_keyframe();
+	bool playback_next_frame();
+	void playback_check_keyframe();
 
 	template<typename Type> void record_write(Type value);
 	void record_init();
 	void record_end(const char *message = nullptr);
 	void record_frame(const attotime &curtime);
 	void record_port(ioport_port &port);
+	bool record_flush_frame();
+	void record_keyframe(const attotime &curtime);
+	bool record_index();
 
 	// internal state
 	running_machine &       m_machine;              // reference to owning machine
@@ -1012,6 +1029,12 @@ private:
 	attotime                m_last_frame_time;      // time of the last frame callback
 	attoseconds_t           m_last_delta_nsec;      // nanoseconds that passed since the previous callback
 
+	// late input sampling
+	bool                    m_late_input;           // sample simple digital inputs when they're read?
+	osd_ticks_t             m_late_interval;        // least host time between polls
+	osd_ticks_t             m_late_last_poll;       // host time of the last poll
+	u32                     m_late_poll;            // number of polls so far
+
 	// playback/record information
 	std::unique_ptr<emu_file> m_record_file;        // recording file (nullptr if not recording)
 	std::unique_ptr<emu_file> m_playback_file;      // playback file (nullptr if not recording)
@@ -1020,6 +1043,32 @@ private:
 	u64                     m_playback_accumulated_speed; // accumulated speed during playback
 	u32                     m_playback_accumulated_frames; // accumulated frames during playback
 
+	// indexed recordings: keyframes with saved states, then frames XORed with the one before
+	struct inp_keyframe
+	{
+		u64                 offset;                 // file offset of the keyframe
+		u64                 frame;                  // frames recorded before it
+		attotime            time;                   // emulated time
+		u64                 hash;                   // state hash, or 0 if there's no saved state
+	};
+	bool                    m_record_indexed;       // recording an indexed file?
+	attotime                m_record_interval;      // emulated time between keyframes
+	attotime                m_record_next_keyframe; // when the next keyframe is due
+	u64                     m_record_frames;        // frames recorded so far
+	std::vector<u8>         m_record_frame;         // values of the frame being recorded
+	std::vector<u8>         m_record_previous;      // values of the frame before it
+	std::vector<inp_keyframe> m_record_index;       // keyframes written so far
+	bool                    m_playback_indexed;     // playing back an indexed file?
+	std::vector<inp_keyframe> m_playback_index;     // keyframes in the file
+	u32                     m_playback_keyframe;    // last keyframe reached
+	u32                     m_playback_stop;        // keyframe to stop at, or 0 to play to the end
+	std::vector<u8>         m_playback_state;       // saved state to load at the first frame
+	std::vector<u8>         m_playback_frame;       // values of the frame being played back
+	std::vector<u8>         m_playback_previous;    // values of the frame before it
+	std::size_t             m_playback_cursor;      // next value in m_playback_frame
+	u32                     m_playback_verified;    // keyframes whose state hash matched
+	u32                     m_playback_mismatched;  // keyframes whose state hash didn't
+
 	// storage for inactive configuration
 	std::unique_ptr<util::xml::file> m_deselected_card_config;
 	bool m_applied_device_defaults;
@@ -21,6 +21,8 @@
 #include "http.h"
 #include "image.h"
 #include "main.h"
+#include "memprof.h"
+#include "memreport.h"
 #include "natkeyboard.h"
 #include "network.h"
 #include "render.h"
@@ -31,13 +33,17 @@
 #include "ui/uimain.h"
 
 #include "corestr.h"
+#include "path.h"
 #include "unzip.h"
 
 #include "osdepend.h"
+#include "modules/lib/osdlib.h"
 
+#include <rapidjson/prettywriter.h>
 #include <rapidjson/writer.h>
 #include <rapidjson/stringbuffer.h>
 
+#include <algorithm>
 #include <ctime>
 
 #if defined(__EMSCRIPTEN__)
@@ -76,6 +82,24 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 	, m_saveload_schedule(saveload_schedule::NONE)
 	, m_saveload_schedule_time(attotime::zero)
 	, m_saveload_searchpath(nullptr)
+	, m_saveload_queue(nullptr)
+	, m_saveload_item(nullptr)
+	, m_saveload_error(STATERR_NONE)
+	, m_warm_state_found(false)
+	, m_runahead_frames(_config.options().runahead())
+	, m_runahead_frame(0)
+	, m_runahead_count(0)
+	, m_runahead_save_ticks(0)
+	, m_runahead_run_ticks(0)
+	, m_runahead_load_ticks(0)
+	, m_runahead_save_bytes(0)
+	, m_runahead_load_bytes(0)
+	, m_deterministic(_config.options().deterministic())
+	, m_state_hash_frame(~u64(0))
+	, m_bench_warmup_end(attotime::never)
+	, m_bench_start_time(attotime::zero)
+	, m_bench_start_ticks(0)
+	, m_bench_start_frames(0)
 
 	, m_save(*this)
 	, m_memory(*this)
@@ -93,6 +117,10 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 	// fetch core options
 	if (options().debug())
 		debug_flags = (DEBUG_FLAG_ENABLED | DEBUG_FLAG_CALL_HOOK) | (DEBUG_FLAG_OSD_ENABLED);
+
+	// running ahead restores state behind the debugger's back
+	if (debug_flags & DEBUG_FLAG_ENABLED)
+		m_runahead_frames = 0;
 }
 
 
@@ -137,12 +165,24 @@ std::string running_machine::describe_context() const
 
 void running_machine::start()
 {
+	// time each phase, for -verbose
+	osd_ticks_t const start_time = osd_ticks();
+	osd_ticks_t phase_time = start_time;
+	auto const phase_done =
+			[&phase_time] (const char *phase)
+			{
+				osd_ticks_t const now = osd_ticks();
+				osd_printf_verbose("Startup: %s took %.1f ms\n", phase, double(now - phase_time) * 1000.0 / double(osd_ticks_per_second()));
+				phase_time = now;
+			};
+
 	// initialize basic can't-fail systems here
 	m_configuration = std::make_unique<configuration_manager>(*this);
 	m_input = std::make_unique<input_manager>(*this);
 	m_output = std::make_unique<output_manager>(*this);
 	m_render = std::make_unique<render_manager>(*this);
 	m_bookkeeping = std::make_unique<bookkeeping_manager>(*this);
+	m_memreport = std::make_unique<memory_report>(*this);
 
 	// allocate a soft_reset timer
 	m_soft_reset_timer = m_scheduler.timer_alloc(timer_expired_delegate(FUNC(running_machine::soft_reset), this));
@@ -157,9 +197,14 @@ void running_machine::start()
 	m_video = std::make_unique<video_manager>(*this);
 	m_ui = manager().create_ui(*this);
 	m_ui->set_startup_text("Initializing...", true);
+	phase_done("OSD, video and layout initialization");
 
-	// initialize the base time (needed for doing record/playback)
-	::time(&m_base_time);
+	// initialize the base time (needed for doing record/playback); a
+	// deterministic run starts at 2000-01-01 00:00:00 UTC wherever it is
+	if (m_deterministic)
+		m_base_time = 946684800;
+	else
+		::time(&m_base_time);
 
 	// initialize the input system and input ports for the game
 	// this must be done before memory_init in order to allow specifying
@@ -183,8 +228,12 @@ void running_machine::start()
 	// needs rom bases), and finally initialize CPUs (which needs
 	// complete address spaces).  These operations must proceed in this
 	// order
-	m_rom_load = std::make_unique<rom_load_manager>(*this);
+	phase_done("input port initialization");
+	m_rom_load = std::make_unique<rom_load_manager>(*this, warm_manifest_load());
+	warm_manifest_save();
+	phase_done("ROM loading");
 	m_memory.initialize();
+	phase_done("memory map population");
 
 	// save the random seed or save states might be broken in drivers that use the rand() method
 	save().save_item(NAME(m_rand_seed));
@@ -211,8 +260,40 @@ void running_machine::start()
 	// register callbacks for the devices, then start them
 	add_notifier(MACHINE_NOTIFY_RESET, machine_notify_delegate(&running_machine::reset_all_devices, this));
 	add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&running_machine::stop_all_devices, this));
+	add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&device_scheduler::frame_update, &m_scheduler));
+	add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&memory_profiler::frame_update, &m_memory.profiler()));
+	if (m_manager.http()->is_active())
+		add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&running_machine::perf_frame_update, this));
+	if (*options().bench_report())
+		add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&running_machine::bench_frame_update, this));
+	if (m_deterministic)
+		m_scheduler.set_serial(true);
+	if (*options().state_hash_log())
+	{
+		m_state_hash_log = std::make_unique<emu_file>(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		std::error_condition const filerr = m_state_hash_log->open(options().state_hash_log());
+		if (filerr)
+		{
+			osd_printf_error("Error creating state hash log %s (%s)\n", options().state_hash_log(), filerr.message());
+			m_state_hash_log.reset();
+		}
+		else
+		{
+			if (!m_deterministic)
+				osd_printf_warning("Warning: state hashes are only comparable between runs with -%s\n", OPTION_DETERMINISTIC);
+			add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&running_machine::state_hash_frame_update, this));
+		}
+	}
+	if (*options().sched_stats())
+	{
+		m_scheduler.set_collect_timing(true);
+		add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&device_scheduler::write_stats, &m_scheduler));
+	}
+	if (*options().mem_report())
+		add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&memory_report::write_at_exit, m_memreport.get()));
 	save().register_presave(save_prepost_delegate(FUNC(running_machine::presave_all_devices), this));
 	start_all_devices();
+	phase_done("device start");
 	save().register_postload(save_prepost_delegate(FUNC(running_machine::postload_all_devices), this));
 
 	// save outputs created before start time
@@ -232,16 +313,26 @@ void running_machine::start()
 	if (filename[0] != 0 && !m_video->is_recording())
 		m_video->begin_recording(filename, movie_recording::format::AVI);
 
+	// publish frames and sound in shared memory if asked to
+	if (options().shm_export()[0] != 0)
+		m_video->begin_frame_export(options().shm_export(), std::max(options().shm_export_frames(), 2));
+
 	// if we're coming in with a savegame request, process it now
 	const char *savegame = options().state();
 	if (savegame[0] != 0)
 		schedule_load(savegame);
 
+	// a warm start restores its state as soon as the machine is reset
+	else if (m_warm_state_found)
+		schedule_load(options().warm_state());
+
 	// if we're in autosave mode, schedule a load
 	else if (options().autosave() && (m_system.flags & MACHINE_SUPPORTS_SAVE) != 0)
 		schedule_load("auto");
 
 	manager().update_machine();
+	phase_done("remaining initialization");
+	osd_printf_verbose("Startup: machine started in %.1f ms\n", double(osd_ticks() - start_time) * 1000.0 / double(osd_ticks_per_second()));
 }
 
 
@@ -297,7 +388,7 @@ int running_machine::run(bool quiet)
 		nvram_load();
 
 		// set the time on RTCs (this may overwrite parts of NVRAM)
-		set_rtc_datetime(system_time(m_base_time));
+		set_rtc_datetime(machine_time(m_base_time));
 
 		sound().ui_mute(false);
 		if (!quiet)
@@ -316,8 +407,16 @@ int running_machine::run(bool quiet)
 		if (m_saveload_schedule != saveload_schedule::NONE)
 			handle_saveload();
 
+		// a fork server stops here, and each copy it makes carries on
+		if (*options().fork_server())
+			fork_serve();
+
 		export_http_api();
 
+		// -seconds_to_run and the benchmark count from after any initial state load
+		m_video->set_run_start(time());
+		bench_start();
+
 #if defined(__EMSCRIPTEN__)
 		// break out to our async javascript loop and halt
 		emscripten_set_running_machine(this);
@@ -330,7 +429,13 @@ int running_machine::run(bool quiet)
 
 			// execute CPUs if not paused
 			if (!m_paused)
+			{
 				m_scheduler.timeslice();
+
+				// run ahead after each frame if enabled
+				if (m_runahead_frames && (m_video->frame_update_count() != m_runahead_frame))
+					run_ahead();
+			}
 			// otherwise, just pump video updates through
 			else
 				m_video->frame_update();
@@ -338,11 +443,17 @@ int running_machine::run(bool quiet)
 			// handle save/load
 			if (m_saveload_schedule != saveload_schedule::NONE)
 				handle_saveload();
+
+			// report a save state once it has been written
+			if (m_saveload_item)
+				finish_save(false);
 		}
 		m_manager.http()->clear();
 
 		// and out via the exit phase
 		m_current_phase = machine_phase::EXIT;
+		runahead_report();
+		bench_report();
 
 		// save the NVRAM and configuration
 		sound().ui_mute(true);
@@ -387,6 +498,14 @@ int running_machine::run(bool quiet)
 	// in case we got here via exception
 	m_current_phase = machine_phase::EXIT;
 
+	// don't leave a save state half written
+	finish_save(true);
+	if (m_saveload_queue)
+	{
+		osd_work_queue_free(m_saveload_queue);
+		m_saveload_queue = nullptr;
+	}
+
 	// call all exit callbacks registered
 	call_notifiers(MACHINE_NOTIFY_EXIT);
 	util::archive_file::cache_clear();
@@ -407,8 +526,10 @@ void running_machine::schedule_exit()
 	// if we're executing, abort out immediately
 	m_scheduler.eat_all_cycles();
 
-	// if we're autosaving on exit, schedule a save as well
-	if (options().autosave() && (m_system.flags & MACHINE_SUPPORTS_SAVE) && this->time() > attotime::zero)
+	// if we're autosaving on exit, or making a warm start state, schedule a save as well
+	if (*options().warm_state() && !m_warm_state_found && (m_system.flags & MACHINE_SUPPORTS_SAVE) && this->time() > attotime::zero)
+		schedule_save(options().warm_state());
+	else if (options().autosave() && (m_system.flags & MACHINE_SUPPORTS_SAVE) && this->time() > attotime::zero)
 		schedule_save("auto");
 }
 
@@ -572,6 +693,127 @@ void running_machine::set_saveload_filename(std::string &&filename)
 }
 
 
+//-------------------------------------------------
+//  warm_manifest_filename - the manifest has the
+//  name of its state with a different extension
+//-------------------------------------------------
+
+static std::string warm_manifest_filename(std::string_view statefile)
+{
+	if (core_filename_ends_with(statefile, ".sta"))
+		statefile.remove_suffix(4);
+	return std::string(statefile) + ".man";
+}
+
+
+//-------------------------------------------------
+//  warm_manifest_load - look for the -warmstate
+//  state, and get the ROM files its manifest
+//  says verified when it was made
+//-------------------------------------------------
+
+std::set<std::string> running_machine::warm_manifest_load()
+{
+	std::set<std::string> result;
+	if (!*options().warm_state())
+		return result;
+
+	const char *searchpath;
+	std::string const statefile = compose_saveload_filename(options().warm_state(), &searchpath);
+	emu_file state(searchpath ? searchpath : "", OPEN_FLAG_READ);
+	m_warm_state_found = !state.open(statefile);
+	if (!m_warm_state_found)
+	{
+		osd_printf_verbose("Warm start: no state %s yet, it will be saved on exit\n", statefile);
+		return result;
+	}
+	state.close();
+
+	emu_file manifest(searchpath ? searchpath : "", OPEN_FLAG_READ);
+	std::vector<std::string> identities;
+	if (!manifest.open(warm_manifest_filename(statefile)) && save_manager::read_manifest(manifest, m_system.name, identities))
+		result.insert(identities.begin(), identities.end());
+	return result;
+}
+
+
+//-------------------------------------------------
+//  warm_manifest_save - record which ROM files
+//  verified, if there's anything new to record
+//-------------------------------------------------
+
+void running_machine::warm_manifest_save()
+{
+	if (!*options().warm_state())
+		return;
+
+	// only a clean load is worth trusting next time
+	std::vector<std::string> identities = m_rom_load->identities();
+	if (m_rom_load->trusted())
+		osd_printf_verbose("Warm start: %d of %d ROM files unchanged since they were verified\n", m_rom_load->trusted(), identities.size());
+	if (m_rom_load->warnings() || identities.empty() || (size_t(m_rom_load->trusted()) == identities.size()))
+		return;
+
+	std::sort(identities.begin(), identities.end());
+	identities.erase(std::unique(identities.begin(), identities.end()), identities.end());
+
+	const char *searchpath;
+	std::string const statefile = compose_saveload_filename(options().warm_state(), &searchpath);
+	emu_file manifest(searchpath ? searchpath : "", OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (manifest.open(warm_manifest_filename(statefile)) || (save_manager::write_manifest(manifest, m_system.name, identities) != STATERR_NONE))
+		osd_printf_warning("Warm start: unable to write the ROM manifest for %s\n", statefile);
+}
+
+
+//-------------------------------------------------
+//  fork_serve - make copies of the started
+//  machine on request; the original exits when
+//  the server is done, while each copy applies
+//  its request and runs
+//-------------------------------------------------
+
+void running_machine::fork_serve()
+{
+	// a copy only has the thread that forked it
+	if (m_manager.http()->is_active())
+		throw emu_fatalerror("-forkserver can't be combined with -http\n");
+
+	bool forked;
+	std::string request;
+	std::error_condition const err = osd::fork_server(options().fork_server(), forked, request);
+	if (!forked)
+	{
+		if (err)
+			osd_printf_error("Fork server on %s failed: %s\n", options().fork_server(), err.message());
+		m_exit_pending = true;
+		return;
+	}
+	osd_printf_verbose("Fork server: process %d started for \"%s\"\n", osd_getpid(), request);
+
+	// the request is a list of name=value words
+	std::string_view rest(request);
+	while (!rest.empty())
+	{
+		std::string_view::size_type const start(rest.find_first_not_of(" \t"));
+		if (std::string_view::npos == start)
+			break;
+		rest.remove_prefix(start);
+		std::string_view const word(rest.substr(0, rest.find_first_of(" \t")));
+		rest.remove_prefix(word.length());
+
+		std::string_view::size_type const split(word.find('='));
+		std::string_view const name(word.substr(0, split));
+		std::string_view const value((std::string_view::npos != split) ? word.substr(split + 1) : std::string_view());
+		if ((name == "state") && !value.empty())
+			immediate_load(value);
+		else if ((name == "script") && !value.empty())
+			manager().start_script(*this, value);
+		else
+			osd_printf_warning("Fork server: ignoring unknown request \"%s\"\n", word);
+	}
+}
+
+
 //-------------------------------------------------
 //  schedule_save - schedule a save to occur as
 //  soon as possible
@@ -606,6 +848,9 @@ void running_machine::immediate_save(std::string_view filename)
 
 	// jump right into the save, anonymous timers can't hurt us!
 	handle_saveload();
+
+	// and make sure it has been written when we return
+	finish_save(true);
 }
 
 
@@ -679,6 +924,303 @@ void running_machine::rewind_invalidate()
 }
 
 
+//-------------------------------------------------
+//  run_ahead - save state, emulate the configured
+//  number of frames with the current inputs,
+//  showing only the last one, then restore the
+//  state so the frames never happened
+//-------------------------------------------------
+
+void running_machine::run_ahead()
+{
+	m_runahead_frame = m_video->frame_update_count();
+	if (m_exit_pending || m_hard_reset_pending || (m_saveload_schedule != saveload_schedule::NONE))
+		return;
+
+	// allocate the state buffer on first use, after all registrations are done
+	if (!m_runahead_state)
+		m_runahead_state = std::make_unique<ram_state>(m_save);
+
+	osd_ticks_t const start_ticks = osd_ticks();
+	save_error const saveerr = m_runahead_state->save();
+	if (saveerr != STATERR_NONE)
+	{
+		osd_printf_warning("Run-ahead disabled: %s\n", (saveerr == STATERR_ILLEGAL_REGISTRATIONS) ? "system does not support saved states" : "unable to save state");
+		m_runahead_frames = 0;
+		return;
+	}
+	osd_ticks_t const save_ticks = osd_ticks();
+	size_t const save_bytes = m_runahead_state->copied();
+
+	// emulate the frames ahead, with the sound thrown away
+	u64 const target = m_runahead_frame + m_runahead_frames;
+	m_sound->set_speculative(true);
+	while ((m_video->frame_update_count() < target) && !m_exit_pending && !m_hard_reset_pending)
+	{
+		m_video->set_speculative(true, (target - m_video->frame_update_count()) == 1);
+		m_scheduler.timeslice();
+	}
+	osd_ticks_t const run_ticks = osd_ticks();
+
+	// restore the state while still speculative, so the timeline isn't disturbed
+	save_error const loaderr = m_runahead_state->load();
+	m_video->set_speculative(false);
+	m_sound->set_speculative(false);
+	m_runahead_frame = m_video->frame_update_count();
+	if (loaderr != STATERR_NONE)
+		throw emu_fatalerror("Run-ahead: unable to restore state");
+
+	// keep the profile
+	osd_ticks_t const end_ticks = osd_ticks();
+	m_runahead_count++;
+	m_runahead_save_ticks += save_ticks - start_ticks;
+	m_runahead_run_ticks += run_ticks - save_ticks;
+	m_runahead_load_ticks += end_ticks - run_ticks;
+	m_runahead_save_bytes += save_bytes;
+	m_runahead_load_bytes += m_runahead_state->copied();
+}
+
+
+//-------------------------------------------------
+//  runahead_report - report the state size and
+//  the average cost of running ahead, to tune
+//  the number of frames for this system
+//-------------------------------------------------
+
+void running_machine::runahead_report()
+{
+	if (!m_runahead_count)
+		return;
+
+	double const ms_per_run = 1000.0 / (double(osd_ticks_per_second()) * double(m_runahead_count));
+	osd_printf_info("Run-ahead %d frame(s) for %s: state %u bytes in %d entries\n",
+			m_runahead_frames,
+			m_system.name,
+			unsigned(ram_state::get_size(m_save)),
+			m_save.registration_count());
+	osd_printf_info("Average over %u frames: save %.3f ms, emulate ahead %.3f ms, load %.3f ms\n",
+			unsigned(m_runahead_count),
+			m_runahead_save_ticks * ms_per_run,
+			m_runahead_run_ticks * ms_per_run,
+			m_runahead_load_ticks * ms_per_run);
+	osd_printf_info("Bytes copied: %u per save, %u per load\n",
+			unsigned(m_runahead_save_bytes / m_runahead_count),
+			unsigned(m_runahead_load_bytes / m_runahead_count));
+}
+
+
+//-------------------------------------------------
+//  bench_start - set the point the -benchreport
+//  measurement starts at, once the warm-up has
+//  been emulated
+//-------------------------------------------------
+
+void running_machine::bench_start()
+{
+	if (!*options().bench_report())
+		return;
+
+	if (options().bench_profile())
+		g_profiler.enable(true);
+	m_bench_warmup_end = time() + attotime::from_seconds(std::max(options().bench_warmup(), 0));
+	bench_frame_update();
+}
+
+
+//-------------------------------------------------
+//  bench_frame_update - start measuring at the
+//  first frame after the warm-up
+//-------------------------------------------------
+
+void running_machine::bench_frame_update()
+{
+	if (m_bench_start_ticks || (time() < m_bench_warmup_end))
+		return;
+
+	m_bench_start_time = time();
+	m_bench_start_ticks = osd_ticks();
+	m_bench_start_frames = m_video->frame_update_count();
+	g_profiler.clear_totals();
+}
+
+
+//-------------------------------------------------
+//  state_hash - hash of everything registered
+//  with the save manager as of the latest frame;
+//  only the pages that changed since the last
+//  call are hashed again
+//-------------------------------------------------
+
+u64 running_machine::state_hash()
+{
+	u64 const frame = m_video->frame_update_count();
+	if (frame == m_state_hash_frame)
+		return m_state_hasher->hash();
+
+	if (!m_state_hasher)
+		m_state_hasher = std::make_unique<state_hasher>(m_save);
+	if (m_state_hasher->update() != STATERR_NONE)
+	{
+		m_state_hash_frame = ~u64(0);
+		return 0;
+	}
+	m_state_hash_frame = frame;
+	return m_state_hasher->hash();
+}
+
+
+//-------------------------------------------------
+//  state_hash_frame_update - log the state hash
+//  for this frame
+//-------------------------------------------------
+
+void running_machine::state_hash_frame_update()
+{
+	if (phase() != machine_phase::RUNNING)
+		return;
+	u64 const hash = state_hash();
+	m_state_hash_log->printf("%u %s %016x\n", m_video->frame_update_count(), time().as_string(9), hash);
+}
+
+
+//-------------------------------------------------
+//  bench_report - write the emulation speed since
+//  the warm-up, and where the time went if the
+//  profiler was enabled, as JSON
+//-------------------------------------------------
+
+void running_machine::bench_report()
+{
+	std::string const name = options().bench_report();
+	if (name.empty())
+		return;
+	if (!m_bench_start_ticks)
+	{
+		osd_printf_error("Benchmark warm-up of %d seconds did not finish; no report written\n", options().bench_warmup());
+		return;
+	}
+
+	double const emulated = (time() - m_bench_start_time).as_double();
+	double const host = double(osd_ticks() - m_bench_start_ticks) / double(osd_ticks_per_second());
+
+	rapidjson::StringBuffer s;
+	rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(s);
+	writer.StartObject();
+	writer.Key("system");
+	writer.String(m_system.name);
+	writer.Key("warmup_seconds");
+	writer.Int(std::max(options().bench_warmup(), 0));
+	writer.Key("emulated_seconds");
+	writer.Double(emulated);
+	writer.Key("host_seconds");
+	writer.Double(host);
+	writer.Key("speed");
+	writer.Double((host > 0.0) ? (emulated / host) : 0.0);
+	writer.Key("frames");
+	writer.Uint64(m_video->frame_update_count() - m_bench_start_frames);
+	writer.Key("profiled");
+	writer.Bool(g_profiler.enabled());
+
+	// profiler ticks have no fixed rate, so time is given as shares of the
+	// profiled total, and as host seconds in proportion to those shares
+	u64 profiled = 0;
+	for (profile_type type = PROFILER_DEVICE_FIRST; type < PROFILER_TOTAL; ++type)
+		profiled += g_profiler.total(type);
+	if (g_profiler.enabled() && profiled)
+	{
+		enum { CPU, VIDEO, SOUND, TIMERS, DRC, MEMORY, IDLE, OTHER, COUNT };
+		static char const *const category_names[COUNT] = { "cpu", "video", "sound", "timers", "drc_compile", "memory", "idle", "other" };
+		u64 categories[COUNT] = { 0 };
+		for (profile_type type = PROFILER_DEVICE_FIRST; type < PROFILER_TOTAL; ++type)
+		{
+			int category;
+			switch (type)
+			{
+			case PROFILER_VIDEO:
+			case PROFILER_DRAWGFX:
+			case PROFILER_COPYBITMAP:
+			case PROFILER_TILEMAP_DRAW:
+			case PROFILER_TILEMAP_DRAW_ROZ:
+			case PROFILER_TILEMAP_UPDATE:
+			case PROFILER_BLIT:
+				category = VIDEO;
+				break;
+			case PROFILER_SOUND:
+				category = SOUND;
+				break;
+			case PROFILER_TIMER_CALLBACK:
+			case PROFILER_TIMER_QUEUE:
+				category = TIMERS;
+				break;
+			case PROFILER_DRC_COMPILE:
+			case PROFILER_DRC_OPTIMIZE:
+				category = DRC;
+				break;
+			case PROFILER_MEM_REMAP:
+			case PROFILER_MEMREAD:
+			case PROFILER_MEMWRITE:
+				category = MEMORY;
+				break;
+			case PROFILER_IDLE:
+				category = IDLE;
+				break;
+			default:
+				category = (type <= PROFILER_DEVICE_MAX) ? CPU : OTHER;
+				break;
+			}
+			categories[category] += g_profiler.total(type);
+		}
+
+		auto const share =
+				[&writer, profiled, host] (char const *key, u64 ticks)
+				{
+					double const fraction = double(ticks) / double(profiled);
+					writer.Key(key);
+					writer.StartObject();
+					writer.Key("fraction");
+					writer.Double(fraction);
+					writer.Key("host_seconds");
+					writer.Double(fraction * host);
+					writer.EndObject();
+				};
+
+		writer.Key("breakdown");
+		writer.StartObject();
+		for (int category = 0; category < COUNT; category++)
+			share(category_names[category], categories[category]);
+		writer.EndObject();
+
+		writer.Key("devices");
+		writer.StartObject();
+		device_enumerator iter(root_device());
+		for (profile_type type = PROFILER_DEVICE_FIRST; type <= PROFILER_DEVICE_MAX; ++type)
+		{
+			device_t *const device = iter.byindex(type - PROFILER_DEVICE_FIRST);
+			if (device && g_profiler.total(type))
+				share(device->tag(), g_profiler.total(type));
+		}
+		writer.EndObject();
+
+		writer.Key("buckets");
+		writer.StartObject();
+		for (profile_type type = profile_type(PROFILER_DEVICE_MAX + 1); type < PROFILER_TOTAL; ++type)
+		{
+			if (g_profiler.total(type))
+				share(profiler_state::type_name(type), g_profiler.total(type));
+		}
+		writer.EndObject();
+	}
+
+	writer.EndObject();
+
+	emu_file file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(name))
+		osd_printf_error("Unable to write benchmark report to %s\n", name);
+	else
+		file.puts(std::string(s.GetString()) + '\n');
+}
+
+
 //-------------------------------------------------
 //  pause - pause the system
 //-------------------------------------------------
@@ -795,7 +1337,7 @@ void running_machine::debug_break()
 
 void running_machine::base_datetime(system_time &systime)
 {
-	systime.set(m_base_time);
+	systime = machine_time(m_base_time);
 }
 
 
@@ -807,7 +1349,22 @@ void running_machine::base_datetime(system_time &systime)
 
 void running_machine::current_datetime(system_time &systime)
 {
-	systime.set(m_base_time + this->time().seconds());
+	systime = machine_time(m_base_time + this->time().seconds());
+}
+
+
+//-------------------------------------------------
+//  machine_time - convert a host time for the
+//  emulated machine; deterministic runs ignore
+//  the host's time zone
+//-------------------------------------------------
+
+system_time running_machine::machine_time(time_t t) const
+{
+	system_time result(t);
+	if (m_deterministic)
+		result.local_time = result.utc_time;
+	return result;
 }
 
 
@@ -852,6 +1409,90 @@ void running_machine::call_notifiers(machine_notification which)
 }
 
 
+//-------------------------------------------------
+//  report_saveload - tell the user how a save or
+//  load went
+//-------------------------------------------------
+
+void running_machine::report_saveload(save_error saverr, bool load)
+{
+	const char *const opname = load ? "load" : "save";
+	const char *const opnamed = load ? "loaded" : "saved";
+
+	switch (saverr)
+	{
+	case STATERR_ILLEGAL_REGISTRATIONS:
+		popmessage("Error: Unable to %s state due to illegal registrations. See error.log for details.", opname);
+		break;
+
+	case STATERR_INVALID_HEADER:
+		popmessage("Error: Unable to %s state due to an invalid header. Make sure the save state is correct for this machine.", opname);
+		break;
+
+	case STATERR_READ_ERROR:
+		popmessage("Error: Unable to %s state due to a read error (file is likely corrupt).", opname);
+		break;
+
+	case STATERR_WRITE_ERROR:
+		popmessage("Error: Unable to %s state due to a write error. Verify there is enough disk space.", opname);
+		break;
+
+	case STATERR_NONE:
+		if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
+			popmessage("State successfully %s.\nWarning: Save states are not officially supported for this machine.", opnamed);
+		else
+			popmessage("State successfully %s.", opnamed);
+		break;
+
+	default:
+		popmessage("Error: Unknown error during state %s.", opnamed);
+		break;
+	}
+}
+
+
+//-------------------------------------------------
+//  write_save_async - compress and write the
+//  state snapshot, runs on a work queue
+//-------------------------------------------------
+
+void *running_machine::write_save_async(void *param, int threadid)
+{
+	running_machine &machine = *reinterpret_cast<running_machine *>(param);
+	machine.m_saveload_error = save_manager::write_file(*machine.m_saveload_file, machine.m_saveload_data.data(), machine.m_saveload_data.size());
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  finish_save - report and close a save state
+//  that has been written, optionally waiting for
+//  it to complete
+//-------------------------------------------------
+
+void running_machine::finish_save(bool wait)
+{
+	if (m_saveload_item)
+	{
+		if (!wait && !osd_work_item_wait(m_saveload_item, 0))
+			return;
+		while (!osd_work_item_wait(m_saveload_item, osd_ticks_per_second())) { }
+		osd_work_item_release(m_saveload_item);
+		m_saveload_item = nullptr;
+	}
+
+	if (m_saveload_file)
+	{
+		// close and perhaps delete the file
+		report_saveload(m_saveload_error, false);
+		if (m_saveload_error != STATERR_NONE)
+			m_saveload_file->remove_on_close();
+		m_saveload_file.reset();
+		m_saveload_data = std::vector<u8>();
+	}
+}
+
+
 //-------------------------------------------------
 //  handle_saveload - attempt to perform a save
 //  or load
@@ -876,52 +1517,47 @@ void running_machine::handle_saveload()
 		}
 		else
 		{
+			// a save still being written has to complete first, it may be the same file
+			finish_save(true);
+
 			u32 const openflags = (m_saveload_schedule == saveload_schedule::LOAD) ? OPEN_FLAG_READ : (OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
 
 			// open the file
-			emu_file file(m_saveload_searchpath ? m_saveload_searchpath : "", openflags);
-			auto const filerr = file.open(m_saveload_pending_file);
+			auto file = std::make_unique<emu_file>(m_saveload_searchpath ? m_saveload_searchpath : "", openflags);
+			auto const filerr = file->open(m_saveload_pending_file);
 			if (!filerr)
 			{
-				const char *const opnamed = (m_saveload_schedule == saveload_schedule::LOAD) ? "loaded" : "saved";
-
-				// read/write the save state
-				save_error saverr = (m_saveload_schedule == saveload_schedule::LOAD) ? m_save.read_file(file) : m_save.write_file(file);
-
-				// handle the result
-				switch (saverr)
+				if (m_saveload_schedule == saveload_schedule::LOAD)
 				{
-				case STATERR_ILLEGAL_REGISTRATIONS:
-					popmessage("Error: Unable to %s state due to illegal registrations. See error.log for details.", opname);
-					break;
-
-				case STATERR_INVALID_HEADER:
-					popmessage("Error: Unable to %s state due to an invalid header. Make sure the save state is correct for this machine.", opname);
-					break;
-
-				case STATERR_READ_ERROR:
-					popmessage("Error: Unable to %s state due to a read error (file is likely corrupt).", opname);
-					break;
-
-				case STATERR_WRITE_ERROR:
-					popmessage("Error: Unable to %s state due to a write error. Verify there is enough disk space.", opname);
-					break;
-
-				case STATERR_NONE:
-					if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
-						popmessage("State successfully %s.\nWarning: Save states are not officially supported for this machine.", opnamed);
+					// read the save state
+					report_saveload(m_save.read_file(*file), true);
+				}
+				else
+				{
+					// take a snapshot of the state now, compressing and writing it can happen in the background
+					m_saveload_data.resize(ram_state::get_size(m_save));
+					const save_error saverr = m_save.write_buffer(m_saveload_data.data(), m_saveload_data.size());
+					if (saverr == STATERR_NONE)
+					{
+						m_saveload_file = std::move(file);
+						if (!m_saveload_queue)
+							m_saveload_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+						if (m_saveload_queue)
+							m_saveload_item = osd_work_item_queue(m_saveload_queue, &running_machine::write_save_async, this, 0);
+
+						// fall back to writing it right away
+						if (!m_saveload_item)
+						{
+							write_save_async(this, 0);
+							finish_save(true);
+						}
+					}
 					else
-						popmessage("State successfully %s.", opnamed);
-					break;
-
-				default:
-					popmessage("Error: Unknown error during state %s.", opnamed);
-					break;
+					{
+						report_saveload(saverr, false);
+						file->remove_on_close();
+					}
 				}
-
-				// close and perhaps delete the file
-				if (saverr != STATERR_NONE && m_saveload_schedule == saveload_schedule::SAVE)
-					file.remove_on_close();
 			}
 			else if ((openflags == OPEN_FLAG_READ) && (std::errc::no_such_file_or_directory == filerr))
 			{
@@ -1217,9 +1853,222 @@ running_machine::logerror_callback_item::logerror_callback_item(logerror_callbac
 {
 }
 
+//-------------------------------------------------
+//  perf_feed - WebSocket clients receiving
+//  performance reports
+//-------------------------------------------------
+
+struct running_machine::perf_feed
+{
+	struct client
+	{
+		http_manager::websocket_connection_ptr  m_connection;   // where to send reports
+		u32                                     m_interval;     // frames between reports
+		u32                                     m_countdown;    // frames until the next report
+	};
+
+	void remove(http_manager::websocket_connection_ptr const &connection)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_clients.erase(
+				std::remove_if(m_clients.begin(), m_clients.end(), [&connection] (client const &c) { return c.m_connection == connection; }),
+				m_clients.end());
+	}
+
+	std::mutex              m_mutex;                            // clients are added and removed on the server thread
+	std::vector<client>     m_clients;                          // connected clients
+	std::string             m_last_report;                      // latest report, for /api/perf
+	std::atomic<bool>       m_polled = false;                   // has /api/perf been requested?
+	osd_ticks_t             m_last_ticks = 0;                   // host time of the last frame
+};
+
+
+//-------------------------------------------------
+//  perf_frame_update - send a report to any /perf
+//  clients that are due one
+//-------------------------------------------------
+
+void running_machine::perf_frame_update()
+{
+	if (!m_perf_feed)
+		return;
+
+	osd_ticks_t const now = osd_ticks();
+	double const frame_seconds = m_perf_feed->m_last_ticks ? double(now - m_perf_feed->m_last_ticks) / double(osd_ticks_per_second()) : 0.0;
+	m_perf_feed->m_last_ticks = now;
+
+	std::lock_guard<std::mutex> lock(m_perf_feed->m_mutex);
+	std::string report;
+	if (m_perf_feed->m_polled.load(std::memory_order_relaxed))
+	{
+		report = perf_report(frame_seconds);
+		m_perf_feed->m_last_report = report;
+	}
+	for (auto &client : m_perf_feed->m_clients)
+	{
+		if (--client.m_countdown)
+			continue;
+		client.m_countdown = client.m_interval;
+
+		// only build the report if somebody wants it this frame
+		if (report.empty())
+			report = perf_report(frame_seconds);
+		client.m_connection->send_message(report, 1);
+	}
+}
+
+
+//-------------------------------------------------
+//  perf_report - describe the last frame's
+//  performance as JSON
+//-------------------------------------------------
+
+std::string running_machine::perf_report(double frame_seconds) const
+{
+	rapidjson::StringBuffer s;
+	rapidjson::Writer<rapidjson::StringBuffer> writer(s);
+	writer.StartObject();
+
+	writer.Key("time");
+	writer.Double(time().as_double());
+	writer.Key("frames");
+	writer.Uint64(m_scheduler.stats_frames());
+	writer.Key("speed");
+	writer.Double(m_video->speed_percent());
+	writer.Key("frameskip");
+	writer.Int(m_video->effective_frameskip());
+	writer.Key("frame_seconds");
+	writer.Double(frame_seconds);
+
+	// scheduler activity
+	device_scheduler::schedule_stats const &sched = m_scheduler.last_frame_stats();
+	writer.Key("scheduler");
+	writer.StartObject();
+	writer.Key("timeslices");
+	writer.Uint64(sched.m_timeslices);
+	writer.Key("aborts");
+	writer.Uint64(sched.m_aborts);
+	writer.Key("timers_scheduled");
+	writer.Uint64(sched.m_scheduled);
+	writer.Key("timers_removed");
+	writer.Uint64(sched.m_removed);
+	writer.Key("timers_fired");
+	writer.Uint64(sched.m_fired);
+	if (m_scheduler.collect_timing())
+	{
+		writer.Key("timer_callback_seconds");
+		writer.Double(double(sched.m_callback_ticks) / double(osd_ticks_per_second()));
+	}
+	writer.EndObject();
+
+	// per-device execution
+	writer.Key("devices");
+	writer.StartObject();
+	for (device_execute_interface &exec : execute_interface_enumerator(root_device()))
+	{
+		device_execute_interface::execute_stats const &stats = exec.last_frame_stats();
+		writer.Key(exec.device().tag());
+		writer.StartObject();
+		writer.Key("executed");
+		writer.Uint64(stats.m_executed);
+		writer.Key("stolen");
+		writer.Uint64(stats.m_stolen);
+		writer.Key("eaten");
+		writer.Uint64(stats.m_eaten);
+		writer.Key("runs");
+		writer.Uint(stats.m_runs);
+		writer.Key("aborts");
+		writer.Uint(stats.m_aborts);
+		writer.Key("idled");
+		writer.Uint64(stats.m_idled);
+		writer.EndObject();
+	}
+	writer.EndObject();
+
+	// audio output buffering, if the sound module can tell
+	osd_audio_status status;
+	if (m_sound->output_status(status))
+	{
+		writer.Key("audio");
+		writer.StartObject();
+		writer.Key("sample_rate");
+		writer.Int(status.sample_rate);
+		writer.Key("queued_frames");
+		writer.Int(status.queued_frames);
+		writer.Key("device_frames");
+		writer.Int(status.device_frames);
+		writer.Key("latency_ms");
+		writer.Double(status.latency_ms());
+		writer.Key("underruns");
+		writer.Uint(status.underruns);
+		writer.Key("overruns");
+		writer.Uint(status.overruns);
+		writer.EndObject();
+	}
+
+	writer.EndObject();
+	return s.GetString();
+}
+
+
 void running_machine::export_http_api()
 {
 	if (m_manager.http()->is_active()) {
+		// live performance reports; a client may send a number to set the frames between reports
+		m_perf_feed = std::make_shared<perf_feed>();
+		std::weak_ptr<perf_feed> feed(m_perf_feed);
+		m_manager.http()->add_endpoint(
+				"/perf",
+				[feed] (http_manager::websocket_connection_ptr connection)
+				{
+					if (auto f = feed.lock())
+					{
+						std::lock_guard<std::mutex> lock(f->m_mutex);
+						f->m_clients.emplace_back(perf_feed::client{ std::move(connection), 1, 1 });
+					}
+				},
+				[feed] (http_manager::websocket_connection_ptr connection, const std::string &payload, int opcode)
+				{
+					if (auto f = feed.lock())
+					{
+						u32 const interval = std::clamp<u32>(u32(std::strtoul(payload.c_str(), nullptr, 10)), 1, 3600);
+						std::lock_guard<std::mutex> lock(f->m_mutex);
+						for (auto &client : f->m_clients)
+							if (client.m_connection == connection)
+								client.m_interval = client.m_countdown = interval;
+					}
+				},
+				[feed] (http_manager::websocket_connection_ptr connection, int status, const std::string &reason)
+				{
+					if (auto f = feed.lock())
+					{
+						f->remove(connection);
+					}
+				},
+				[feed] (http_manager::websocket_connection_ptr connection, const std::error_code &error_code)
+				{
+					if (auto f = feed.lock())
+					{
+						f->remove(connection);
+					}
+				});
+
+		// the latest report on request, for scrapers that would rather poll; the
+		// machine is running on another thread, so reports are built at frame end
+		m_manager.http()->add_http_handler("/api/perf", [feed](http_manager::http_request_ptr request, http_manager::http_response_ptr response)
+		{
+			std::string report;
+			if (auto f = feed.lock())
+			{
+				f->m_polled = true;
+				std::lock_guard<std::mutex> lock(f->m_mutex);
+				report = f->m_last_report;
+			}
+			response->set_status(200);
+			response->set_content_type("application/json");
+			response->set_body(report.empty() ? "{}" : report);
+		});
+
 		m_manager.http()->add_http_handler("/api/machine", [this](http_manager::http_request_ptr request, http_manager::http_response_ptr response)
 		{
 			rapidjson::StringBuffer s;
@@ -18,6 +18,7 @@
 #define MAME_EMU_MACHINE_H
 
 #include <functional>
+#include <set>
 
 #include <ctime>
 
@@ -140,6 +141,7 @@ public:
 	debug_view_manager &debug_view() const { assert(m_debug_view != nullptr); return *m_debug_view; }
 	debugger_manager &debugger() const { assert(m_debugger != nullptr); return *m_debugger; }
 	natural_keyboard &natkeyboard() noexcept { assert(m_natkeyboard != nullptr); return *m_natkeyboard; }
+	memory_report &memreport() const { assert(m_memreport != nullptr); return *m_memreport; }
 	template <class DriverClass> DriverClass *driver_data() const { return &downcast<DriverClass &>(root_device()); }
 	machine_phase phase() const { return m_current_phase; }
 	bool paused() const { return m_paused || (m_current_phase != machine_phase::RUNNING); }
@@ -183,6 +185,13 @@ public:
 	bool rewind_step();
 	void rewind_invalidate();
 
+	// run-ahead operations
+	int runahead_frames() const { return m_runahead_frames; }
+
+	// deterministic operation
+	bool deterministic() const { return m_deterministic; }
+	u64 state_hash();
+
 	// scheduled operations
 	void schedule_exit();
 	void schedule_hard_reset();
@@ -245,7 +254,22 @@ private:
 	template <typename T> struct is_null<T *> { template <typename U> static bool value(U &&x) { return !x; } };
 	void start();
 	void set_saveload_filename(std::string &&filename);
+	std::set<std::string> warm_manifest_load();
+	void warm_manifest_save();
+	void fork_serve();
 	void handle_saveload();
+	void report_saveload(save_error saverr, bool load);
+	void finish_save(bool wait);
+	static void *write_save_async(void *param, int threadid);
+	void run_ahead();
+	void runahead_report();
+	void perf_frame_update();
+	std::string perf_report(double frame_seconds) const;
+	void bench_start();
+	void bench_frame_update();
+	void bench_report();
+	void state_hash_frame_update();
+	system_time machine_time(time_t t) const;
 	void soft_reset(s32 param = 0);
 	std::string nvram_filename(device_t &device) const;
 	void nvram_load();
@@ -285,6 +309,7 @@ private:
 	std::unique_ptr<rom_load_manager> m_rom_load;      // internal data from romload.cpp
 	std::unique_ptr<debugger_manager> m_debugger;      // internal data from debugger.cpp
 	std::unique_ptr<natural_keyboard> m_natkeyboard;   // internal data from natkeyboard.cpp
+	std::unique_ptr<memory_report> m_memreport;        // internal data from memreport.cpp
 
 	// system state
 	machine_phase           m_current_phase;        // current execution phase
@@ -312,6 +337,39 @@ private:
 	attotime                m_saveload_schedule_time;
 	std::string             m_saveload_pending_file;
 	const char *            m_saveload_searchpath;
+	osd_work_queue *        m_saveload_queue;       // queue for writing save states in the background
+	osd_work_item *         m_saveload_item;        // save state currently being written
+	std::unique_ptr<emu_file> m_saveload_file;      // file it is written to
+	std::vector<u8>         m_saveload_data;        // snapshot of the machine state to write
+	save_error              m_saveload_error;       // result of writing it
+	bool                    m_warm_state_found;     // does the -warmstate state exist yet?
+
+	// run-ahead management
+	int                     m_runahead_frames;      // number of frames to emulate ahead of the displayed one
+	u64                     m_runahead_frame;       // frame update count when we last ran ahead
+	std::unique_ptr<ram_state> m_runahead_state;    // state restored after running ahead
+	u64                     m_runahead_count;       // number of times we've run ahead
+	osd_ticks_t             m_runahead_save_ticks;  // total time spent saving state
+	osd_ticks_t             m_runahead_run_ticks;   // total time spent emulating frames ahead
+	osd_ticks_t             m_runahead_load_ticks;  // total time spent restoring state
+	u64                     m_runahead_save_bytes;  // total bytes copied saving state
+	u64                     m_runahead_load_bytes;  // total bytes copied restoring state
+
+	// deterministic operation
+	bool                    m_deterministic;        // run the same way whatever the host does
+	std::unique_ptr<state_hasher> m_state_hasher;   // incremental hash of the saved state
+	u64                     m_state_hash_frame;     // frame update count the hash was last brought up to date at
+	std::unique_ptr<emu_file> m_state_hash_log;     // file the per-frame hashes are written to
+
+	// performance feed for the HTTP server
+	struct perf_feed;
+	std::shared_ptr<perf_feed> m_perf_feed;         // WebSocket clients of /perf
+
+	// benchmark report
+	attotime                m_bench_warmup_end;     // emulated time the measurement starts at
+	attotime                m_bench_start_time;     // emulated time it actually started
+	osd_ticks_t             m_bench_start_ticks;    // host time it started (0 = not yet)
+	u64                     m_bench_start_frames;   // frame updates when it started
 
 	// notifier callbacks
 	struct notifier_callback_item
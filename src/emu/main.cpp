@@ -13,6 +13,7 @@
 
 #include "emuopts.h"
 #include "http.h"
+#include "romload.h"
 
 
 machine_manager::machine_manager(emu_options& options, osd_interface& osd) :
@@ -38,3 +39,11 @@ http_manager *machine_manager::http()
 {
   return m_http.get();
 }
+
+
+rom_restart_cache &machine_manager::restart_cache()
+{
+	if (!m_restart_cache)
+		m_restart_cache = std::make_unique<rom_restart_cache>();
+	return *m_restart_cache;
+}
@@ -85,17 +85,22 @@ public:
 	virtual void load_cheatfiles(running_machine& machine) { }
 	virtual void ui_initialize(running_machine& machine) { }
 	virtual void before_load_settings(running_machine &machine) { }
+	virtual void start_script(running_machine &machine, std::string_view filename) { }
 
 	virtual void update_machine() { }
 
 	http_manager *http();
 	void start_http_server();
 
+	// ROM regions kept across hard resets (see -fast_restart)
+	rom_restart_cache &restart_cache();
+
 protected:
 	osd_interface &               m_osd;                  // reference to OSD system
 	emu_options &                 m_options;              // reference to options
 	running_machine *             m_machine;
 	std::unique_ptr<http_manager> m_http;
+	std::unique_ptr<rom_restart_cache> m_restart_cache;
 };
 
 #endif // MAME_EMU_MAIN_H
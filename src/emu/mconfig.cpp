@@ -41,11 +41,13 @@ private:
 machine_config::machine_config(const game_driver &gamedrv, emu_options &options)
 	: m_gamedrv(gamedrv)
 	, m_options(options)
+	, m_arena()
 	, m_root_device()
 	, m_default_layouts([] (char const *a, char const *b) { return 0 > std::strcmp(a, b); })
 	, m_current_device(nullptr)
 	, m_maximum_quantums([] (char const *a, char const *b) { return 0 > std::strcmp(a, b); })
 	, m_perfect_quantum_device(nullptr, "")
+	, m_adaptive_quantum(attotime::zero, attotime::zero)
 {
 	// add the root device
 	device_add("root", gamedrv.type, 0);
@@ -190,6 +192,17 @@ void machine_config::set_maximum_quantum(attotime const &quantum)
 }
 
 
+//-------------------------------------------------
+//  set_adaptive_quantum - set the range the
+//  scheduler may tune the quantum within
+//-------------------------------------------------
+
+void machine_config::set_adaptive_quantum(attotime const &minimum, attotime const &maximum)
+{
+	m_adaptive_quantum = std::make_pair(minimum, maximum);
+}
+
+
 //-------------------------------------------------
 //  device_add - configuration helper to add a
 //  new device
@@ -109,10 +109,12 @@ public:
 	device_t &root_device() const { assert(m_root_device); return *m_root_device; }
 	device_t &current_device() const { assert(m_current_device); return *m_current_device; }
 	emu_options &options() const { return m_options; }
+	util::arena &arena() const { return m_arena; }
 	device_t *device(const char *tag) const { return root_device().subdevice(tag); }
 	template <class DeviceClass> DeviceClass *device(const char *tag) const { return downcast<DeviceClass *>(device(tag)); }
 	attotime maximum_quantum(attotime const &default_quantum) const;
 	device_execute_interface *perfect_quantum_device() const;
+	std::pair<attotime, attotime> const &adaptive_quantum() const { return m_adaptive_quantum; }
 
 	/// \brief Apply visitor to internal layouts
 	///
@@ -156,6 +158,17 @@ public:
 	/// \param [in] quantum Maximum scheduling quantum in attoseconds.
 	void set_maximum_quantum(attotime const &quantum);
 
+	/// \brief Let the scheduler tune the scheduling quantum
+	///
+	/// Allow the scheduler to move the base scheduling quantum between
+	/// the given bounds while running, narrowing it when devices
+	/// synchronise often and widening it when they rarely do.  Each
+	/// change is logged.  Maximum quantums requested by devices still
+	/// cap the upper bound, and a perfect quantum device disables it.
+	/// \param [in] minimum Narrowest quantum to use.
+	/// \param [in] maximum Widest quantum to use.
+	void set_adaptive_quantum(attotime const &minimum, attotime const &maximum);
+
 	template <typename T>
 	void set_perfect_quantum(T &&tag)
 	{
@@ -242,11 +255,13 @@ private:
 	// internal state
 	game_driver const &                 m_gamedrv;
 	emu_options &                       m_options;
+	mutable util::arena                 m_arena;                    // devices, tags and callbacks; must outlive m_root_device
 	std::unique_ptr<device_t>           m_root_device;
 	default_layout_map                  m_default_layouts;
 	device_t *                          m_current_device;
 	maximum_quantum_map                 m_maximum_quantums;
 	std::pair<device_t *, std::string>  m_perfect_quantum_device;
+	std::pair<attotime, attotime>       m_adaptive_quantum;
 };
 
 #endif // MAME_EMU_MCONFIG_H
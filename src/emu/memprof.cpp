@@ -0,0 +1,338 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    memprof.cpp
+
+    Sampling memory access profiler.
+
+    A read/write tap covering the whole space counts accesses into a
+    table of pages.  The tap is only present for the first <window>
+    frames of every <period>, so outside those frames the space runs
+    with its normal dispatch and caches.  Counts are attributed to
+    handlers by looking up the handler at the start of each page when
+    a report is asked for, so use small pages where handlers are
+    packed closely together.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "memprof.h"
+
+#include <algorithm>
+#include <map>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+struct memory_profiler::space_profile
+{
+	address_space *             m_space;        // space being profiled
+	u32                         m_period;       // frames per sampling period
+	u32                         m_window;       // frames sampled at the start of each period
+	u8                          m_page_bits;    // address bits per page
+	u32                         m_phase;        // frame within the current period
+	u64                         m_frames;       // frames sampled so far
+	std::vector<counts>         m_pages;        // per-page counters
+	memory_passthrough_handler  m_tap;          // tap, while installed
+	bool                        m_installed;    // is the tap installed?
+};
+
+
+namespace {
+
+template <typename T>
+memory_passthrough_handler install_counting_tap(address_space &space, memory_profiler::counts *pages, u8 page_bits)
+{
+	offs_t const mask = space.addrmask();
+	return space.install_readwrite_tap(
+			0, mask, "memprof",
+			[pages, page_bits, mask] (offs_t offset, T &data, T mem_mask) { pages[(offset & mask) >> page_bits].m_reads++; },
+			[pages, page_bits, mask] (offs_t offset, T &data, T mem_mask) { pages[(offset & mask) >> page_bits].m_writes++; });
+}
+
+// taps wrap the handler names as "(tap) handler"; report the handler
+std::string strip_tap_names(std::string &&name)
+{
+	while (!name.empty() && (name[0] == '('))
+	{
+		std::string::size_type const end = name.find(") ");
+		if (end == std::string::npos)
+			break;
+		name.erase(0, end + 2);
+	}
+	return std::move(name);
+}
+
+} // anonymous namespace
+
+
+
+//**************************************************************************
+//  MEMORY PROFILER
+//**************************************************************************
+
+//-------------------------------------------------
+//  memory_profiler - constructor
+//-------------------------------------------------
+
+memory_profiler::memory_profiler()
+{
+}
+
+
+//-------------------------------------------------
+//  ~memory_profiler - destructor
+//-------------------------------------------------
+
+memory_profiler::~memory_profiler()
+{
+	stop_all();
+}
+
+
+//-------------------------------------------------
+//  start - begin (or restart) profiling a space,
+//  sampling <window> frames out of every <period>
+//-------------------------------------------------
+
+void memory_profiler::start(address_space &space, u32 period, u32 window, u8 page_bits)
+{
+	// keep the page table to at most 64K entries
+	int const width = space.addr_width();
+	page_bits = std::clamp<int>(page_bits, std::max(width - 16, 0), width);
+	period = std::max<u32>(period, 1);
+	window = std::clamp<u32>(window, 1, period);
+
+	space_profile *profile = find(space);
+	if (!profile)
+	{
+		m_profiles.emplace_back(std::make_unique<space_profile>());
+		profile = m_profiles.back().get();
+		profile->m_space = &space;
+		profile->m_installed = false;
+	}
+	else if (profile->m_installed)
+	{
+		// the tap points at the old page table
+		profile->m_tap.remove();
+		profile->m_installed = false;
+	}
+
+	profile->m_period = period;
+	profile->m_window = window;
+	profile->m_page_bits = page_bits;
+	profile->m_phase = 0;
+	profile->m_frames = 0;
+	profile->m_pages.assign(size_t(1) << (width - page_bits), counts{ 0, 0 });
+	install(*profile);
+}
+
+
+//-------------------------------------------------
+//  stop - stop profiling a space and discard its
+//  counts
+//-------------------------------------------------
+
+void memory_profiler::stop(address_space &space)
+{
+	auto const found = std::find_if(m_profiles.begin(), m_profiles.end(), [&space] (auto const &p) { return p->m_space == &space; });
+	if (found != m_profiles.end())
+	{
+		if ((*found)->m_installed)
+			(*found)->m_tap.remove();
+		m_profiles.erase(found);
+	}
+}
+
+
+//-------------------------------------------------
+//  stop_all - stop profiling every space
+//-------------------------------------------------
+
+void memory_profiler::stop_all()
+{
+	for (auto &profile : m_profiles)
+		if (profile->m_installed)
+			profile->m_tap.remove();
+	m_profiles.clear();
+}
+
+
+//-------------------------------------------------
+//  reset - clear the counts for a space, keeping
+//  it profiled
+//-------------------------------------------------
+
+void memory_profiler::reset(address_space &space)
+{
+	space_profile *const profile = find(space);
+	if (profile)
+	{
+		std::fill(profile->m_pages.begin(), profile->m_pages.end(), counts{ 0, 0 });
+		profile->m_frames = 0;
+	}
+}
+
+
+//-------------------------------------------------
+//  sampled_frames - number of frames the counts
+//  for a space cover
+//-------------------------------------------------
+
+u64 memory_profiler::sampled_frames(const address_space &space) const
+{
+	space_profile const *const profile = find(space);
+	return profile ? profile->m_frames : 0;
+}
+
+
+//-------------------------------------------------
+//  page_bits - address bits per page in use for
+//  a space
+//-------------------------------------------------
+
+u8 memory_profiler::page_bits(const address_space &space) const
+{
+	space_profile const *const profile = find(space);
+	return profile ? profile->m_page_bits : 0;
+}
+
+
+//-------------------------------------------------
+//  pages - return every page of a space that has
+//  been accessed, in address order
+//-------------------------------------------------
+
+std::vector<memory_profiler::page_counts> memory_profiler::pages(const address_space &space) const
+{
+	std::vector<page_counts> result;
+	space_profile const *const profile = find(space);
+	if (!profile)
+		return result;
+
+	offs_t const pagemask = make_bitmask<offs_t>(profile->m_page_bits);
+	for (size_t i = 0; i < profile->m_pages.size(); i++)
+	{
+		counts const &page = profile->m_pages[i];
+		if (page.m_reads || page.m_writes)
+		{
+			offs_t const start = offs_t(i) << profile->m_page_bits;
+			result.emplace_back(page_counts{ page, start, start | pagemask });
+		}
+	}
+	return result;
+}
+
+
+//-------------------------------------------------
+//  handlers - fold the page counts into the
+//  handlers they land on, busiest first
+//-------------------------------------------------
+
+std::vector<memory_profiler::handler_counts> memory_profiler::handlers(const address_space &space) const
+{
+	std::map<std::string, handler_counts> byname;
+	auto const add =
+			[&byname] (std::string &&name, offs_t start, offs_t end, u64 reads, u64 writes)
+			{
+				auto const ins = byname.emplace(name, handler_counts{ { 0, 0 }, name, start, end });
+				handler_counts &entry = ins.first->second;
+				entry.m_reads += reads;
+				entry.m_writes += writes;
+				entry.m_start = std::min(entry.m_start, start);
+				entry.m_end = std::max(entry.m_end, end);
+			};
+
+	for (page_counts const &page : pages(space))
+	{
+		if (page.m_reads)
+			add(strip_tap_names(space.get_handler_string(read_or_write::READ, page.m_start)), page.m_start, page.m_end, page.m_reads, 0);
+		if (page.m_writes)
+			add(strip_tap_names(space.get_handler_string(read_or_write::WRITE, page.m_start)), page.m_start, page.m_end, 0, page.m_writes);
+	}
+
+	std::vector<handler_counts> result;
+	result.reserve(byname.size());
+	for (auto &entry : byname)
+		result.emplace_back(std::move(entry.second));
+	std::sort(
+			result.begin(),
+			result.end(),
+			[] (handler_counts const &a, handler_counts const &b) { return (a.m_reads + a.m_writes) > (b.m_reads + b.m_writes); });
+	return result;
+}
+
+
+//-------------------------------------------------
+//  spaces - return the spaces being profiled
+//-------------------------------------------------
+
+std::vector<address_space *> memory_profiler::spaces() const
+{
+	std::vector<address_space *> result;
+	for (auto const &profile : m_profiles)
+		result.emplace_back(profile->m_space);
+	return result;
+}
+
+
+//-------------------------------------------------
+//  frame_update - count the frame just sampled
+//  and install or remove the taps for the next
+//-------------------------------------------------
+
+void memory_profiler::frame_update()
+{
+	for (auto &p : m_profiles)
+	{
+		space_profile &profile = *p;
+		if (profile.m_installed)
+			profile.m_frames++;
+
+		profile.m_phase = (profile.m_phase + 1) % profile.m_period;
+		bool const sample = profile.m_phase < profile.m_window;
+		if (sample && !profile.m_installed)
+		{
+			install(profile);
+		}
+		else if (!sample && profile.m_installed)
+		{
+			profile.m_tap.remove();
+			profile.m_installed = false;
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  find - return the profile for a space, if any
+//-------------------------------------------------
+
+memory_profiler::space_profile *memory_profiler::find(const address_space &space) const
+{
+	for (auto const &profile : m_profiles)
+		if (profile->m_space == &space)
+			return profile.get();
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  install - add the counting tap to a space
+//-------------------------------------------------
+
+void memory_profiler::install(space_profile &profile)
+{
+	address_space &space = *profile.m_space;
+	switch (space.data_width())
+	{
+	case  8: profile.m_tap = install_counting_tap<u8 >(space, profile.m_pages.data(), profile.m_page_bits); break;
+	case 16: profile.m_tap = install_counting_tap<u16>(space, profile.m_pages.data(), profile.m_page_bits); break;
+	case 32: profile.m_tap = install_counting_tap<u32>(space, profile.m_pages.data(), profile.m_page_bits); break;
+	case 64: profile.m_tap = install_counting_tap<u64>(space, profile.m_pages.data(), profile.m_page_bits); break;
+	}
+	profile.m_installed = true;
+}
@@ -0,0 +1,78 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    memprof.h
+
+    Sampling memory access profiler.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_MEMPROF_H
+#define MAME_EMU_MEMPROF_H
+
+#pragma once
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> memory_profiler
+
+// counts accesses per page of an address space, with taps that are only
+// installed for a few frames out of every period so the cost stays low
+class memory_profiler
+{
+public:
+	// accesses seen in one page, or on one handler
+	struct counts
+	{
+		u64                 m_reads;
+		u64                 m_writes;
+	};
+
+	struct page_counts : counts
+	{
+		offs_t              m_start;        // first address of the page
+		offs_t              m_end;          // last address of the page
+	};
+
+	struct handler_counts : counts
+	{
+		std::string         m_name;         // handler name, without any tap prefixes
+		offs_t              m_start;        // first address of the first page seen on it
+		offs_t              m_end;          // last address of the last page seen on it
+	};
+
+	// construction/destruction
+	memory_profiler();
+	~memory_profiler();
+
+	// control
+	void start(address_space &space, u32 period = 8, u32 window = 1, u8 page_bits = 4);
+	void stop(address_space &space);
+	void stop_all();
+	void reset(address_space &space);
+
+	// queries
+	bool profiling(const address_space &space) const { return find(space) != nullptr; }
+	u64 sampled_frames(const address_space &space) const;
+	u8 page_bits(const address_space &space) const;
+	std::vector<page_counts> pages(const address_space &space) const;
+	std::vector<handler_counts> handlers(const address_space &space) const;
+	std::vector<address_space *> spaces() const;
+
+	// once per frame, from the machine
+	void frame_update();
+
+private:
+	struct space_profile;
+
+	space_profile *find(const address_space &space) const;
+	void install(space_profile &profile);
+
+	std::vector<std::unique_ptr<space_profile>> m_profiles;
+};
+
+#endif // MAME_EMU_MEMPROF_H
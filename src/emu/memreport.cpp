@@ -0,0 +1,234 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    memreport.cpp
+
+    Memory footprint report, by subsystem and owner.
+
+    The report is gathered on request by walking the structures that
+    hold a machine's large allocations: memory regions and shares,
+    decoded graphics, tilemap pixmaps, sound stream buffers and the
+    rewind buffer.  Allocations the core can't see (recompiler caches,
+    the Lua heap) are added by sources registered by their owners.
+    Small objects and the allocator's own overhead aren't counted, so
+    the total is a floor on the process footprint rather than a match.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "memreport.h"
+
+#include "emuopts.h"
+#include "fileio.h"
+#include "tilemap.h"
+
+#include "corestr.h"
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+
+
+//-------------------------------------------------
+//  memory_report - constructor
+//-------------------------------------------------
+
+memory_report::memory_report(running_machine &machine)
+	: m_machine(machine)
+{
+}
+
+
+//-------------------------------------------------
+//  add_source - register a callback that adds
+//  entries the core can't find by itself
+//-------------------------------------------------
+
+void memory_report::add_source(source_delegate source)
+{
+	m_sources.emplace_back(std::move(source));
+}
+
+
+//-------------------------------------------------
+//  add - add an entry, ignoring empty ones
+//-------------------------------------------------
+
+void memory_report::add(std::string_view category, std::string_view owner, std::string_view item, u64 bytes)
+{
+	if (bytes)
+		m_entries.emplace_back(entry{ std::string(category), std::string(owner), std::string(item), bytes });
+}
+
+
+//-------------------------------------------------
+//  collect - gather the current footprint
+//-------------------------------------------------
+
+void memory_report::collect()
+{
+	m_entries.clear();
+
+	// memory regions and shares
+	for (auto const &region : m_machine.memory().regions())
+		add("regions", region.second->name(), "region", region.second->bytes());
+	for (auto const &share : m_machine.memory().shares())
+		add("shares", share.second->name(), "share", share.second->bytes());
+
+	// decoded graphics
+	for (device_gfx_interface &gfx : gfx_interface_enumerator(m_machine.root_device()))
+		for (int index = 0; index < MAX_GFX_ELEMENTS; index++)
+			if (gfx.gfx(index))
+				add("gfx", gfx.device().tag(), util::string_format("gfx %d", index), gfx.gfx(index)->allocated_bytes());
+
+	// tilemap pixmaps, flags and mappings
+	tilemap_manager &tilemaps = m_machine.tilemap();
+	for (int index = 0; index < tilemaps.count(); index++)
+	{
+		tilemap_t &tilemap = *tilemaps.find(index);
+		add("tilemaps",
+				tilemap.device() ? tilemap.device()->tag() : "",
+				util::string_format("tilemap %d (%dx%d)", index, tilemap.width(), tilemap.height()),
+				tilemap.allocated_bytes());
+	}
+
+	// sound stream buffers
+	for (auto const &stream : m_machine.sound().streams())
+	{
+		u64 bytes = 0;
+		for (u32 output = 0; output < stream->output_count(); output++)
+			bytes += stream->output(output).buffer_bytes();
+		add("sound", stream->device().tag(), stream->name(), bytes);
+	}
+
+	// rewind buffer, and the size of one saved state for comparison
+	if (m_machine.save().rewind())
+		add("rewind", "", "rewind states", m_machine.save().rewind()->memory_bytes());
+	add("save state", "", "one state", ram_state::get_size(m_machine.save()));
+
+	// everything else
+	for (source_delegate const &source : m_sources)
+		source(*this);
+
+	std::stable_sort(
+			m_entries.begin(),
+			m_entries.end(),
+			[] (entry const &a, entry const &b) { return a.m_bytes > b.m_bytes; });
+}
+
+
+//-------------------------------------------------
+//  categories - return the totals for each
+//  category, largest first
+//-------------------------------------------------
+
+std::vector<memory_report::category_total> memory_report::categories() const
+{
+	std::map<std::string, category_total> totals;
+	for (entry const &item : m_entries)
+	{
+		category_total &total = totals.emplace(item.m_category, category_total{ item.m_category, 0, 0 }).first->second;
+		total.m_bytes += item.m_bytes;
+		total.m_count++;
+	}
+
+	std::vector<category_total> result;
+	for (auto &total : totals)
+		result.emplace_back(std::move(total.second));
+	std::stable_sort(
+			result.begin(),
+			result.end(),
+			[] (category_total const &a, category_total const &b) { return a.m_bytes > b.m_bytes; });
+	return result;
+}
+
+
+//-------------------------------------------------
+//  total - return the total of all entries
+//-------------------------------------------------
+
+u64 memory_report::total() const
+{
+	u64 result = 0;
+	for (entry const &item : m_entries)
+		result += item.m_bytes;
+	return result;
+}
+
+
+//-------------------------------------------------
+//  text - format the category totals and the
+//  largest entries for display
+//-------------------------------------------------
+
+std::string memory_report::text(u32 count) const
+{
+	std::ostringstream out;
+	util::stream_format(out, "%10.1f KB total\n", double(total()) / 1024.0);
+	for (category_total const &category : categories())
+		util::stream_format(out, "%10.1f KB  %-12s %u items\n", double(category.m_bytes) / 1024.0, category.m_category, category.m_count);
+
+	if (count)
+	{
+		util::stream_format(out, "Largest:\n");
+		for (u32 index = 0; (index < count) && (index < m_entries.size()); index++)
+		{
+			entry const &item = m_entries[index];
+			util::stream_format(out, "%10.1f KB  %-12s %s %s\n", double(item.m_bytes) / 1024.0, item.m_category, item.m_owner, item.m_item);
+		}
+	}
+	return std::move(out).str();
+}
+
+
+//-------------------------------------------------
+//  write_at_exit - write the report to the file
+//  named by -memreport
+//-------------------------------------------------
+
+void memory_report::write_at_exit()
+{
+	collect();
+
+	std::string const name = m_machine.options().mem_report();
+	bool const json = (name.length() >= 5) && !core_stricmp(name.substr(name.length() - 5), ".json");
+
+	std::ostringstream out;
+	if (json)
+	{
+		util::stream_format(out, "{\n");
+		util::stream_format(out, "\t\"system\": \"%s\",\n", m_machine.system().name);
+		util::stream_format(out, "\t\"total\": %u,\n", total());
+		util::stream_format(out, "\t\"categories\": [");
+		char const *sep = "\n";
+		for (category_total const &category : categories())
+		{
+			util::stream_format(out, "%s\t\t{ \"category\": \"%s\", \"bytes\": %u, \"count\": %u }", sep, category.m_category, category.m_bytes, category.m_count);
+			sep = ",\n";
+		}
+		util::stream_format(out, "\n\t],\n");
+		util::stream_format(out, "\t\"entries\": [");
+		sep = "\n";
+		for (entry const &item : m_entries)
+		{
+			util::stream_format(out, "%s\t\t{ \"category\": \"%s\", \"owner\": \"%s\", \"item\": \"%s\", \"bytes\": %u }", sep, item.m_category, item.m_owner, item.m_item, item.m_bytes);
+			sep = ",\n";
+		}
+		util::stream_format(out, "\n\t]\n}\n");
+	}
+	else
+	{
+		util::stream_format(out, "system,total\n");
+		util::stream_format(out, "%s,%u\n", m_machine.system().name, total());
+		util::stream_format(out, "\ncategory,owner,item,bytes\n");
+		for (entry const &item : m_entries)
+			util::stream_format(out, "%s,%s,%s,%u\n", item.m_category, item.m_owner, item.m_item, item.m_bytes);
+	}
+
+	emu_file file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(name))
+		osd_printf_error("Unable to write memory report to %s\n", name);
+	else
+		file.puts(std::move(out).str());
+}
@@ -0,0 +1,73 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    memreport.h
+
+    Memory footprint report, by subsystem and owner.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_MEMREPORT_H
+#define MAME_EMU_MEMREPORT_H
+
+#pragma once
+
+#include <string_view>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> memory_report
+
+// gathers the sizes of the large allocations a running machine holds,
+// attributed to a category (regions, gfx, tilemaps...) and an owner
+class memory_report
+{
+public:
+	// one allocation, or a group of them counted together
+	struct entry
+	{
+		std::string         m_category;     // subsystem holding the memory
+		std::string         m_owner;        // device tag, or other owner
+		std::string         m_item;         // what it is within the owner
+		u64                 m_bytes;        // size in bytes
+	};
+
+	// total for one category
+	struct category_total
+	{
+		std::string         m_category;
+		u64                 m_bytes;
+		u32                 m_count;        // number of entries
+	};
+
+	// sources outside the core add their own entries
+	using source_delegate = delegate<void (memory_report &)>;
+
+	// construction/destruction
+	memory_report(running_machine &machine);
+
+	// sources
+	void add_source(source_delegate source);
+	void add(std::string_view category, std::string_view owner, std::string_view item, u64 bytes);
+
+	// gathering; entries are sorted largest first
+	void collect();
+	const std::vector<entry> &entries() const { return m_entries; }
+	std::vector<category_total> categories() const;
+	u64 total() const;
+
+	// output
+	std::string text(u32 count = 16) const;
+	void write_at_exit();
+
+private:
+	running_machine &               m_machine;
+	std::vector<source_delegate>    m_sources;
+	std::vector<entry>              m_entries;
+};
+
+#endif // MAME_EMU_MEMREPORT_H
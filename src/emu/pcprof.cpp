@@ -0,0 +1,334 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    pcprof.cpp
+
+    Sampling guest program counter profiler.
+
+    A periodic timer reads the PC of every device that executes and
+    has one, and counts it in a bucket of 2^<bucket_bits> addresses.
+    As the timer bounds the timeslice, the devices have all run up to
+    about the sample time when it fires.  Devices that are suspended
+    at the time are counted separately.  Address ranges may be given
+    names, so the results can be summed by routine rather than by
+    address, and written out as folded stacks for flame graph tools.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "pcprof.h"
+
+#include <algorithm>
+#include <map>
+#include <ostream>
+#include <unordered_map>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+struct pc_profiler::device_profile
+{
+	struct range
+	{
+		offs_t                      m_end;          // last address of the range
+		std::string                 m_name;         // name reported for the range
+	};
+
+	device_execute_interface *      m_exec;         // device being sampled
+	device_state_interface *        m_state;        // where its PC comes from
+	int                             m_addrchars;    // hex digits for its program addresses
+	u64                             m_samples;      // samples taken while it was running
+	u64                             m_suspended;    // samples taken while it was suspended
+	std::unordered_map<offs_t, u64> m_buckets;      // samples by PC bucket
+	std::map<offs_t, range>         m_ranges;       // named ranges by start address
+
+	std::map<offs_t, range>::value_type const *find_range(offs_t address) const
+	{
+		auto const found = m_ranges.upper_bound(address);
+		if (found == m_ranges.begin())
+			return nullptr;
+		auto const &candidate = *std::prev(found);
+		return (address <= candidate.second.m_end) ? &candidate : nullptr;
+	}
+};
+
+
+
+//**************************************************************************
+//  PC PROFILER
+//**************************************************************************
+
+//-------------------------------------------------
+//  pc_profiler - constructor
+//-------------------------------------------------
+
+pc_profiler::pc_profiler(device_scheduler &scheduler)
+	: m_scheduler(scheduler)
+	, m_timer(scheduler.timer_alloc(timer_expired_delegate(FUNC(pc_profiler::sample), this)))
+	, m_period(attotime::never)
+	, m_bucket_bits(0)
+	, m_running(false)
+	, m_ticks(0)
+{
+}
+
+
+//-------------------------------------------------
+//  ~pc_profiler - destructor
+//-------------------------------------------------
+
+pc_profiler::~pc_profiler()
+{
+}
+
+
+//-------------------------------------------------
+//  start - begin (or restart) sampling at the
+//  given interval of emulated time
+//-------------------------------------------------
+
+void pc_profiler::start(const attotime &period, u8 bucket_bits)
+{
+	populate();
+	reset();
+	m_period = (period.is_zero() || period.is_never()) ? attotime::from_usec(100) : period;
+	m_bucket_bits = std::min<u8>(bucket_bits, 31);
+	m_running = true;
+	m_timer->adjust(m_period, 0, m_period);
+}
+
+
+//-------------------------------------------------
+//  stop - stop sampling, keeping the counts
+//-------------------------------------------------
+
+void pc_profiler::stop()
+{
+	m_timer->reset();
+	m_running = false;
+}
+
+
+//-------------------------------------------------
+//  reset - discard the counts
+//-------------------------------------------------
+
+void pc_profiler::reset()
+{
+	for (auto &profile : m_profiles)
+	{
+		profile->m_samples = 0;
+		profile->m_suspended = 0;
+		profile->m_buckets.clear();
+	}
+	m_ticks = 0;
+}
+
+
+//-------------------------------------------------
+//  add_range - name a range of program addresses
+//  on a device, replacing any ranges it overlaps
+//-------------------------------------------------
+
+bool pc_profiler::add_range(device_t &device, offs_t start, offs_t end, std::string &&name)
+{
+	populate();
+	device_profile *const profile = find(device);
+	if (!profile || (end < start))
+		return false;
+
+	// semicolons separate frames in folded stacks
+	std::replace(name.begin(), name.end(), ';', '_');
+
+	auto first = profile->m_ranges.upper_bound(start);
+	if ((first != profile->m_ranges.begin()) && (std::prev(first)->second.m_end >= start))
+		--first;
+	profile->m_ranges.erase(first, profile->m_ranges.upper_bound(end));
+	profile->m_ranges.emplace(start, device_profile::range{ end, std::move(name) });
+	return true;
+}
+
+
+//-------------------------------------------------
+//  clear_ranges - forget the named ranges for a
+//  device
+//-------------------------------------------------
+
+void pc_profiler::clear_ranges(device_t &device)
+{
+	device_profile *const profile = find(device);
+	if (profile)
+		profile->m_ranges.clear();
+}
+
+
+//-------------------------------------------------
+//  samples - number of samples that found a
+//  device running
+//-------------------------------------------------
+
+u64 pc_profiler::samples(const device_t &device) const
+{
+	device_profile const *const profile = find(device);
+	return profile ? profile->m_samples : 0;
+}
+
+
+//-------------------------------------------------
+//  suspended - number of samples that found a
+//  device suspended
+//-------------------------------------------------
+
+u64 pc_profiler::suspended(const device_t &device) const
+{
+	device_profile const *const profile = find(device);
+	return profile ? profile->m_suspended : 0;
+}
+
+
+//-------------------------------------------------
+//  counts - samples for a device, with buckets
+//  inside a named range summed into it, busiest
+//  first
+//-------------------------------------------------
+
+std::vector<pc_profiler::sample_count> pc_profiler::counts(const device_t &device) const
+{
+	std::vector<sample_count> result;
+	device_profile const *const profile = find(device);
+	if (!profile)
+		return result;
+
+	offs_t const span = (offs_t(1) << m_bucket_bits) - 1;
+	std::map<offs_t, size_t> named;
+	for (auto const &bucket : profile->m_buckets)
+	{
+		offs_t const address = bucket.first << m_bucket_bits;
+		auto const *const range = profile->find_range(address);
+		if (range)
+		{
+			auto const found = named.emplace(range->first, result.size());
+			if (found.second)
+				result.emplace_back(sample_count{ range->first, range->second.m_end, range->second.m_name, bucket.second });
+			else
+				result[found.first->second].m_count += bucket.second;
+		}
+		else
+		{
+			result.emplace_back(sample_count{ address, address + span, std::string(), bucket.second });
+		}
+	}
+
+	std::sort(
+			result.begin(),
+			result.end(),
+			[] (sample_count const &a, sample_count const &b) { return (a.m_count > b.m_count) || ((a.m_count == b.m_count) && (a.m_start < b.m_start)); });
+	return result;
+}
+
+
+//-------------------------------------------------
+//  devices - list the devices that can be
+//  sampled
+//-------------------------------------------------
+
+std::vector<device_t *> pc_profiler::devices() const
+{
+	std::vector<device_t *> result;
+	result.reserve(m_profiles.size());
+	for (auto const &profile : m_profiles)
+		result.emplace_back(&profile->m_exec->device());
+	return result;
+}
+
+
+//-------------------------------------------------
+//  write_folded - write the counts as folded
+//  stacks, one "device;location count" line per
+//  bucket or named range
+//-------------------------------------------------
+
+void pc_profiler::write_folded(std::ostream &stream) const
+{
+	for (auto const &profile : m_profiles)
+	{
+		device_t &device = profile->m_exec->device();
+		for (sample_count const &count : counts(device))
+		{
+			if (!count.m_name.empty())
+				util::stream_format(stream, "%s;%s %u\n", device.tag(), count.m_name, count.m_count);
+			else
+				util::stream_format(stream, "%s;%0*X %u\n", device.tag(), profile->m_addrchars, count.m_start, count.m_count);
+		}
+		if (profile->m_suspended)
+			util::stream_format(stream, "%s;[suspended] %u\n", device.tag(), profile->m_suspended);
+	}
+}
+
+
+//-------------------------------------------------
+//  find - get the profile for a device
+//-------------------------------------------------
+
+pc_profiler::device_profile *pc_profiler::find(const device_t &device) const
+{
+	auto const found = std::find_if(m_profiles.begin(), m_profiles.end(), [&device] (auto const &p) { return &p->m_exec->device() == &device; });
+	return (found != m_profiles.end()) ? found->get() : nullptr;
+}
+
+
+//-------------------------------------------------
+//  populate - make a profile for every device
+//  that executes and has a PC
+//-------------------------------------------------
+
+void pc_profiler::populate()
+{
+	if (!m_profiles.empty())
+		return;
+
+	for (device_execute_interface &exec : execute_interface_enumerator(m_scheduler.machine().root_device()))
+	{
+		device_state_interface *state;
+		if (!exec.device().interface(state) || !state->state_find_entry(STATE_GENPCBASE))
+			continue;
+
+		int addrchars = 8;
+		device_memory_interface *memory;
+		if (exec.device().interface(memory) && memory->has_space(AS_PROGRAM))
+			addrchars = memory->space(AS_PROGRAM).logaddrchars();
+
+		auto &profile = *m_profiles.emplace_back(std::make_unique<device_profile>());
+		profile.m_exec = &exec;
+		profile.m_state = state;
+		profile.m_addrchars = addrchars;
+		profile.m_samples = 0;
+		profile.m_suspended = 0;
+	}
+}
+
+
+//-------------------------------------------------
+//  sample - timer callback that records the PC
+//  of every device
+//-------------------------------------------------
+
+void pc_profiler::sample(s32 param)
+{
+	m_ticks++;
+	for (auto &profile : m_profiles)
+	{
+		if (profile->m_exec->suspended())
+		{
+			profile->m_suspended++;
+		}
+		else
+		{
+			profile->m_samples++;
+			profile->m_buckets[offs_t(profile->m_state->pcbase()) >> m_bucket_bits]++;
+		}
+	}
+}
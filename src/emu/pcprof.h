@@ -0,0 +1,79 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    pcprof.h
+
+    Sampling guest program counter profiler.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_PCPROF_H
+#define MAME_EMU_PCPROF_H
+
+#pragma once
+
+#include <iosfwd>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> pc_profiler
+
+// records the PC of every executing device from a periodic timer, so it
+// costs nothing per instruction and works without the debugger
+class pc_profiler
+{
+public:
+	// samples seen at one address bucket, or in one named range
+	struct sample_count
+	{
+		offs_t              m_start;        // first address of the bucket or range
+		offs_t              m_end;          // last address of the bucket or range
+		std::string         m_name;         // range name, empty for plain buckets
+		u64                 m_count;        // samples that landed here
+	};
+
+	// construction/destruction
+	pc_profiler(device_scheduler &scheduler);
+	~pc_profiler();
+
+	// control
+	void start(const attotime &period, u8 bucket_bits = 0);
+	void stop();
+	void reset();
+	bool add_range(device_t &device, offs_t start, offs_t end, std::string &&name);
+	void clear_ranges(device_t &device);
+
+	// queries
+	bool profiling() const { return m_running; }
+	const attotime &period() const { return m_period; }
+	u8 bucket_bits() const { return m_bucket_bits; }
+	u64 ticks() const { return m_ticks; }
+	u64 samples(const device_t &device) const;
+	u64 suspended(const device_t &device) const;
+	std::vector<sample_count> counts(const device_t &device) const;
+	std::vector<device_t *> devices() const;
+
+	// output
+	void write_folded(std::ostream &stream) const;
+
+private:
+	struct device_profile;
+
+	device_profile *find(const device_t &device) const;
+	void populate();
+	void sample(s32 param);
+
+	device_scheduler &                          m_scheduler;    // owning scheduler
+	emu_timer *                                 m_timer;        // sampling timer
+	attotime                                    m_period;       // time between samples
+	u8                                          m_bucket_bits;  // low address bits ignored when counting
+	bool                                        m_running;      // is the timer running?
+	u64                                         m_ticks;        // timer firings since the last reset
+	std::vector<std::unique_ptr<device_profile>> m_profiles;    // one per executing device with a PC
+};
+
+#endif // MAME_EMU_PCPROF_H
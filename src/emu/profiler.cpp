@@ -24,6 +24,11 @@
 #include "emu.h"
 #include "profiler.h"
 
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
 
 
 //**************************************************************************
@@ -37,6 +42,29 @@ struct profile_string
 };
 
 
+namespace {
+
+// a completed scope recorded for a trace
+struct trace_event
+{
+	osd_ticks_t     start;                      // time the scope was entered
+	osd_ticks_t     end;                        // time the scope was left
+	char const *    detail;                     // device, callback, etc. or nullptr
+	profile_type    type;                       // profiler bucket
+};
+
+// the events recorded by one thread; never freed, so a
+// thread can hold on to its pointer for its lifetime
+struct trace_thread
+{
+	std::mutex                  mutex;          // guards events against the writer
+	std::vector<trace_event>    events;         // events in the order they finished
+	unsigned                    id;             // thread number in the trace
+};
+
+} // anonymous namespace
+
+
 
 //**************************************************************************
 //  GLOBAL VARIABLES
@@ -52,6 +80,48 @@ profiler_state g_profiler;
 
 #define TEXT_UPDATE_TIME        0.5
 
+// limit on events kept per thread; later ones are dropped
+#define TRACE_MAX_EVENTS        (1 << 22)
+
+static const profile_string s_names[] =
+{
+	{ PROFILER_DRC_COMPILE,      "DRC Compilation" },
+	{ PROFILER_DRC_OPTIMIZE,     "DRC Optimization" },
+	{ PROFILER_MEM_REMAP,        "Memory Remapping" },
+	{ PROFILER_MEMREAD,          "Memory Read" },
+	{ PROFILER_MEMWRITE,         "Memory Write" },
+	{ PROFILER_VIDEO,            "Video Update" },
+	{ PROFILER_DRAWGFX,          "drawgfx" },
+	{ PROFILER_COPYBITMAP,       "copybitmap" },
+	{ PROFILER_TILEMAP_DRAW,     "Tilemap Draw" },
+	{ PROFILER_TILEMAP_DRAW_ROZ, "Tilemap ROZ Draw" },
+	{ PROFILER_TILEMAP_UPDATE,   "Tilemap Update" },
+	{ PROFILER_BLIT,             "OSD Blitting" },
+	{ PROFILER_SOUND,            "Sound Generation" },
+	{ PROFILER_TIMER_CALLBACK,   "Timer Callbacks" },
+	{ PROFILER_TIMER_QUEUE,      "Timer Queue" },
+	{ PROFILER_INPUT,            "Input Processing" },
+	{ PROFILER_MOVIE_REC,        "Movie Recording" },
+	{ PROFILER_LOGERROR,         "Error Logging" },
+	{ PROFILER_LUA,              "LUA" },
+	{ PROFILER_EXTRA,            "Unaccounted/Overhead" },
+	{ PROFILER_USER1,            "User 1" },
+	{ PROFILER_USER2,            "User 2" },
+	{ PROFILER_USER3,            "User 3" },
+	{ PROFILER_USER4,            "User 4" },
+	{ PROFILER_USER5,            "User 5" },
+	{ PROFILER_USER6,            "User 6" },
+	{ PROFILER_USER7,            "User 7" },
+	{ PROFILER_USER8,            "User 8" },
+	{ PROFILER_PROFILER,         "Profiler" },
+	{ PROFILER_IDLE,             "Idle" }
+};
+
+// per-thread trace buffers
+static std::mutex s_trace_mutex;
+static std::vector<std::unique_ptr<trace_thread> > s_trace_threads;
+static thread_local trace_thread *s_trace_thread;
+
 
 
 //**************************************************************************
@@ -77,9 +147,12 @@ dummy_profiler_state::dummy_profiler_state()
 //-------------------------------------------------
 
 real_profiler_state::real_profiler_state()
+	: m_tracing(false)
+	, m_trace_base(0)
 {
 	memset(m_filo, 0, sizeof(m_filo));
 	memset(m_data, 0, sizeof(m_data));
+	memset(m_totals, 0, sizeof(m_totals));
 	reset(false);
 }
 
@@ -143,38 +216,6 @@ const char *real_profiler_state::text(running_machine &machine)
 
 void real_profiler_state::update_text(running_machine &machine)
 {
-	static const profile_string names[] =
-	{
-		{ PROFILER_DRC_COMPILE,      "DRC Compilation" },
-		{ PROFILER_MEM_REMAP,        "Memory Remapping" },
-		{ PROFILER_MEMREAD,          "Memory Read" },
-		{ PROFILER_MEMWRITE,         "Memory Write" },
-		{ PROFILER_VIDEO,            "Video Update" },
-		{ PROFILER_DRAWGFX,          "drawgfx" },
-		{ PROFILER_COPYBITMAP,       "copybitmap" },
-		{ PROFILER_TILEMAP_DRAW,     "Tilemap Draw" },
-		{ PROFILER_TILEMAP_DRAW_ROZ, "Tilemap ROZ Draw" },
-		{ PROFILER_TILEMAP_UPDATE,   "Tilemap Update" },
-		{ PROFILER_BLIT,             "OSD Blitting" },
-		{ PROFILER_SOUND,            "Sound Generation" },
-		{ PROFILER_TIMER_CALLBACK,   "Timer Callbacks" },
-		{ PROFILER_INPUT,            "Input Processing" },
-		{ PROFILER_MOVIE_REC,        "Movie Recording" },
-		{ PROFILER_LOGERROR,         "Error Logging" },
-		{ PROFILER_LUA,              "LUA" },
-		{ PROFILER_EXTRA,            "Unaccounted/Overhead" },
-		{ PROFILER_USER1,            "User 1" },
-		{ PROFILER_USER2,            "User 2" },
-		{ PROFILER_USER3,            "User 3" },
-		{ PROFILER_USER4,            "User 4" },
-		{ PROFILER_USER5,            "User 5" },
-		{ PROFILER_USER6,            "User 6" },
-		{ PROFILER_USER7,            "User 7" },
-		{ PROFILER_USER8,            "User 8" },
-		{ PROFILER_PROFILER,         "Profiler" },
-		{ PROFILER_IDLE,             "Idle" }
-	};
-
 	// compute the total time for all bits, not including profiler or idle
 	u64 computed = 0;
 	profile_type curtype;
@@ -216,19 +257,164 @@ void real_profiler_state::update_text(running_machine &machine)
 			if (curtype >= PROFILER_DEVICE_FIRST && curtype <= PROFILER_DEVICE_MAX)
 				util::stream_format(stream, "'%s'", iter.byindex(curtype - PROFILER_DEVICE_FIRST)->tag());
 			else
-				for (auto & name : names)
-					if (name.type == curtype)
-					{
-						stream << name.string;
-						break;
-					}
+				stream << type_name(curtype);
 
 			// followed by a carriage return
 			stream << '\n';
 		}
 	}
 
-	// reset data set to 0
+	// scheduler and timer queue activity for the last frame
+	device_scheduler::schedule_stats const &sched = machine.scheduler().last_frame_stats();
+	util::stream_format(stream, "Slices/frame: %u timeslices, %u aborts\n", sched.m_timeslices, sched.m_aborts);
+	util::stream_format(stream, "Timers/frame: %u scheduled, %u removed, %u fired\n", sched.m_scheduled, sched.m_removed, sched.m_fired);
+
+	// fold the data into the totals and reset it to 0
+	for (curtype = PROFILER_DEVICE_FIRST; curtype <= PROFILER_TOTAL; ++curtype)
+		m_totals[curtype] += m_data[curtype];
 	memset(m_data, 0, sizeof(m_data));
 	m_text = stream.str();
 }
+
+
+
+//-------------------------------------------------
+//  clear_totals - discard the time accumulated
+//  so far
+//-------------------------------------------------
+
+void real_profiler_state::clear_totals() noexcept
+{
+	memset(m_data, 0, sizeof(m_data));
+	memset(m_totals, 0, sizeof(m_totals));
+}
+
+
+
+//-------------------------------------------------
+//  type_name - get the display name for a
+//  profiler bucket
+//-------------------------------------------------
+
+const char *real_profiler_state::type_name(profile_type type) noexcept
+{
+	if (type >= PROFILER_DEVICE_FIRST && type <= PROFILER_DEVICE_MAX)
+		return "Device Execution";
+	for (auto const &name : s_names)
+		if (name.type == type)
+			return name.string;
+	return "";
+}
+
+
+
+//-------------------------------------------------
+//  trace_start - discard any recorded trace and
+//  begin recording scopes on every thread
+//-------------------------------------------------
+
+void real_profiler_state::trace_start()
+{
+	std::lock_guard<std::mutex> lock(s_trace_mutex);
+	for (auto &thread : s_trace_threads)
+	{
+		std::lock_guard<std::mutex> threadlock(thread->mutex);
+		thread->events.clear();
+	}
+	m_trace_base = osd_ticks();
+	m_tracing.store(true, std::memory_order_relaxed);
+}
+
+
+
+//-------------------------------------------------
+//  trace_record - log a scope that has just ended
+//  to the calling thread's buffer
+//-------------------------------------------------
+
+void real_profiler_state::trace_record(profile_type type, char const *detail, osd_ticks_t start) noexcept
+{
+	osd_ticks_t const end = osd_ticks();
+	if (!tracing())
+		return;
+
+	try
+	{
+		// first event on this thread needs a buffer
+		if (UNEXPECTED(!s_trace_thread))
+		{
+			std::lock_guard<std::mutex> lock(s_trace_mutex);
+			auto &thread = *s_trace_threads.emplace_back(std::make_unique<trace_thread>());
+			thread.id = s_trace_threads.size();
+			s_trace_thread = &thread;
+		}
+
+		std::lock_guard<std::mutex> lock(s_trace_thread->mutex);
+		if (s_trace_thread->events.size() < TRACE_MAX_EVENTS)
+			s_trace_thread->events.emplace_back(trace_event{ start, end, detail, type });
+	}
+	catch (...)
+	{
+		// out of memory - give up on the trace rather than the emulation
+		trace_stop();
+	}
+}
+
+
+
+//-------------------------------------------------
+//  trace_write - write the recorded trace in
+//  Chrome trace event format
+//-------------------------------------------------
+
+bool real_profiler_state::trace_write(std::ostream &stream) const
+{
+	// JSON strings can't contain quotes, backslashes or control characters
+	auto const quoted =
+			[] (char const *text)
+			{
+				std::string result;
+				for ( ; *text; ++text)
+				{
+					if ((*text == '"') || (*text == '\\'))
+						result.push_back('\\');
+					if (u8(*text) >= 0x20)
+						result.push_back(*text);
+				}
+				return result;
+			};
+
+	double const scale = 1'000'000.0 / double(osd_ticks_per_second());
+	std::lock_guard<std::mutex> lock(s_trace_mutex);
+	stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+	bool first = true;
+	for (auto const &thread : s_trace_threads)
+	{
+		std::lock_guard<std::mutex> threadlock(thread->mutex);
+		if (thread->events.empty())
+			continue;
+
+		util::stream_format(
+				stream,
+				"%s{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":\"Thread %u\"}}",
+				first ? "" : ",\n",
+				thread->id,
+				thread->id);
+		first = false;
+
+		for (trace_event const &event : thread->events)
+		{
+			char const *const category = type_name(event.type);
+			util::stream_format(
+					stream,
+					",\n{\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"cat\":\"%s\",\"name\":\"%s\"}",
+					thread->id,
+					double(s64(event.start - m_trace_base)) * scale,
+					double(event.end - event.start) * scale,
+					quoted(category),
+					quoted(event.detail ? event.detail : category));
+		}
+	}
+	stream << "\n]}\n";
+	return stream.good();
+}
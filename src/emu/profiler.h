@@ -19,6 +19,22 @@
 
     the profiler handles a FILO list so calls may be nested.
 
+    A scope may also be given a detail string naming the device, timer
+    callback or similar that it covers:
+
+    {
+        auto scope = g_profiler.start(PROFILER_VIDEO, screen.tag());
+        ...
+    }
+
+    While a trace is being recorded, every scope on every thread is
+    logged with its start and end time, so the nesting of scopes and
+    the individual devices and callbacks can be seen.  Traces are
+    written in Chrome trace event format, which Perfetto and
+    chrome://tracing can load.  Detail strings must remain valid
+    until the trace has been written (use tags, delegate names or
+    string literals).
+
 ***************************************************************************/
 
 #ifndef MAME_EMU_PROFILER_H
@@ -33,8 +49,10 @@
 #include "eminline.h" // for get_profile_ticks()
 #include "osdcore.h"
 
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
+#include <iosfwd>
 #include <string>
 
 
@@ -47,6 +65,7 @@ enum profile_type
 	PROFILER_DEVICE_FIRST = 0,
 	PROFILER_DEVICE_MAX = PROFILER_DEVICE_FIRST + 256,
 	PROFILER_DRC_COMPILE,
+	PROFILER_DRC_OPTIMIZE,
 	PROFILER_MEM_REMAP,
 	PROFILER_MEMREAD,
 	PROFILER_MEMWRITE,
@@ -59,6 +78,7 @@ enum profile_type
 	PROFILER_BLIT,
 	PROFILER_SOUND,
 	PROFILER_TIMER_CALLBACK,
+	PROFILER_TIMER_QUEUE,       // timer heap maintenance
 	PROFILER_INPUT,             // input.cpp and inptport.cpp
 	PROFILER_MOVIE_REC,         // movie recording
 	PROFILER_LOGERROR,          // logerror
@@ -99,23 +119,29 @@ public:
 	private:
 		real_profiler_state &m_host;
 		bool m_active;
+		profile_type m_type;
+		char const *m_detail;
+		osd_ticks_t m_trace_start;
 
 	public:
 		scope(scope const &) = delete;
 		scope &operator=(scope const &) = delete;
 
-		scope(scope &&that) noexcept : m_host(that.m_host), m_active(that.m_active)
+		scope(scope &&that) noexcept : m_host(that.m_host), m_active(that.m_active), m_type(that.m_type), m_detail(that.m_detail), m_trace_start(that.m_trace_start)
 		{
 			that.m_active = false;
+			that.m_trace_start = 0;
 		}
 
-		scope(real_profiler_state &host, profile_type type) noexcept : m_host(host), m_active(false)
+		scope(real_profiler_state &host, profile_type type, char const *detail) noexcept : m_host(host), m_active(false), m_type(type), m_detail(detail), m_trace_start(0)
 		{
 			if (m_host.enabled())
 			{
 				m_host.real_start(type);
 				m_active = true;
 			}
+			if (UNEXPECTED(m_host.tracing()))
+				m_trace_start = osd_ticks();
 		}
 
 		~scope()
@@ -130,6 +156,11 @@ public:
 				m_host.real_stop();
 				m_active = false;
 			}
+			if (UNEXPECTED(m_trace_start != 0))
+			{
+				m_host.trace_record(m_type, m_detail, m_trace_start);
+				m_trace_start = 0;
+			}
 		}
 	};
 
@@ -141,7 +172,13 @@ public:
 	{
 		return m_filoptr != nullptr;
 	}
+	bool tracing() const noexcept
+	{
+		return m_tracing.load(std::memory_order_relaxed);
+	}
 	const char *text(running_machine &machine);
+	static const char *type_name(profile_type type) noexcept;
+	osd_ticks_t total(profile_type type) const noexcept { return m_totals[type] + m_data[type]; }
 
 	// enable/disable
 	void enable(bool state = true) noexcept
@@ -153,7 +190,15 @@ public:
 	}
 
 	// start/stop
-	[[nodiscard]] auto start(profile_type type) noexcept { return scope(*this, type); }
+	[[nodiscard]] auto start(profile_type type, char const *detail = nullptr) noexcept { return scope(*this, type, detail); }
+
+	// accumulated totals, which survive the text updates
+	void clear_totals() noexcept;
+
+	// trace recording
+	void trace_start();
+	void trace_stop() noexcept { m_tracing.store(false, std::memory_order_relaxed); }
+	bool trace_write(std::ostream &stream) const;
 
 private:
 	// an entry in the FILO
@@ -165,6 +210,7 @@ private:
 
 	void reset(bool enabled) noexcept;
 	void update_text(running_machine &machine);
+	void trace_record(profile_type type, char const *detail, osd_ticks_t start) noexcept;
 
 	//-------------------------------------------------
 	//  real_start - mark the beginning of a
@@ -221,6 +267,9 @@ private:
 	attotime            m_text_time;                // profiler text last update
 	filo_entry          m_filo[32];                 // array of FILO entries
 	osd_ticks_t         m_data[PROFILER_TOTAL + 1]; // array of data
+	osd_ticks_t         m_totals[PROFILER_TOTAL + 1]; // data from before the last text update
+	std::atomic<bool>   m_tracing;                  // recording scopes for a trace?
+	osd_ticks_t         m_trace_base;               // time the trace was started
 };
 
 
@@ -238,7 +287,7 @@ public:
 		scope(scope const &) = delete;
 		scope &operator=(scope const &) = delete;
 		scope(scope &&that) noexcept = default;
-		scope(dummy_profiler_state &host, profile_type type) noexcept : m_host(host) { }
+		scope(dummy_profiler_state &host, profile_type type, char const *detail) noexcept : m_host(host) { }
 		~scope() { m_host.real_stop(); }
 		void stop() noexcept { }
 	};
@@ -248,13 +297,24 @@ public:
 
 	// getters
 	bool enabled() const noexcept { return false; }
+	bool tracing() const noexcept { return false; }
 	const char *text(running_machine &machine) { return ""; }
+	static const char *type_name(profile_type type) noexcept { return ""; }
+	osd_ticks_t total(profile_type type) const noexcept { return 0; }
 
 	// enable/disable
 	void enable(bool state = true) noexcept { }
 
 	// start/stop
-	[[nodiscard]] auto start(profile_type type) noexcept { return scope(*this, type); }
+	[[nodiscard]] auto start(profile_type type, char const *detail = nullptr) noexcept { return scope(*this, type, detail); }
+
+	// accumulated totals
+	void clear_totals() noexcept { }
+
+	// trace recording
+	void trace_start() { }
+	void trace_stop() noexcept { }
+	bool trace_write(std::ostream &stream) const { return false; }
 
 private:
 	void real_stop() noexcept { }
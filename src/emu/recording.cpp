@@ -10,6 +10,7 @@
 
 #include "emu.h"
 
+#include "emuopts.h"
 #include "fileio.h"
 #include "main.h"
 #include "screen.h"
@@ -28,11 +29,16 @@ namespace
 		{
 		}
 
+		~avi_movie_recording()
+		{
+			finish();
+		}
+
 		bool initialize(running_machine &machine, std::unique_ptr<emu_file> &&file, int32_t width, int32_t height);
-		virtual bool add_sound_to_recording(const s16 *sound, int numsamples) override;
 
 	protected:
 		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool append_sound_samples(const s16 *sound, int numsamples) override;
 
 	private:
 		avi_file::ptr m_avi_file; // handle to the open movie file
@@ -46,10 +52,10 @@ namespace
 		~mng_movie_recording();
 
 		bool initialize(std::unique_ptr<emu_file> &&file, bitmap_t &snap_bitmap);
-		virtual bool add_sound_to_recording(const s16 *sound, int numsamples) override;
 
 	protected:
 		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool append_sound_samples(const s16 *sound, int numsamples) override;
 
 	private:
 		std::unique_ptr<emu_file> m_mng_file; // handle to the open movie file
@@ -71,6 +77,12 @@ movie_recording::movie_recording(screen_device *screen)
 	, m_frame_period(attotime::zero)
 	, m_next_frame_time(attotime::zero)
 	, m_frame(0)
+	, m_frame_limit(0)
+	, m_frames_allocated(0)
+	, m_drop(false)
+	, m_stopping(false)
+	, m_error(false)
+	, m_dropped(0)
 {
 }
 
@@ -81,6 +93,8 @@ movie_recording::movie_recording(screen_device *screen)
 
 movie_recording::~movie_recording()
 {
+	// derived classes should have done this already, while they could still write
+	finish();
 }
 
 
@@ -90,21 +104,200 @@ movie_recording::~movie_recording()
 
 bool movie_recording::append_video_frame(bitmap_rgb32 &bitmap, attotime curtime)
 {
+	// count the movie frames up to curtime that this bitmap stands for
+	int count = 0;
+	while (next_frame_time() <= curtime)
+	{
+		count++;
+		set_next_frame_time(next_frame_time() + frame_period());
+	}
+	if (!count)
+		return true;
+
 	// identify the palette
 	bool has_palette = screen() && screen()->has_palette();
 	const rgb_t *palette = has_palette ? screen()->palette().palette()->entry_list_adjusted() : nullptr;
 	int palette_entries = has_palette ? screen()->palette().entries() : 0;
 
-	// keep appending frames until we're at curtime
-	while (next_frame_time() <= curtime)
+	// without an encoder thread, write it now
+	if (!m_encoder.joinable())
+		return write_frame(bitmap, palette, palette_entries, count);
+
+	// get a frame buffer, waiting for one or repeating the last frame if they're all in use
+	std::unique_ptr<video_frame> frame;
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		if (m_error)
+			return false;
+		if (m_free_frames.empty() && (m_frames_allocated >= m_frame_limit))
+		{
+			if (m_drop)
+			{
+				m_commands.emplace_back(command{ nullptr, std::vector<s16>(), count });
+				m_dropped += count;
+				m_work.notify_one();
+				return true;
+			}
+			m_space.wait(lock, [this] () { return !m_free_frames.empty() || m_error; });
+			if (m_error)
+				return false;
+		}
+		if (!m_free_frames.empty())
+		{
+			frame = std::move(m_free_frames.back());
+			m_free_frames.pop_back();
+		}
+		else
+		{
+			m_frames_allocated++;
+		}
+	}
+	if (!frame)
+		frame = std::make_unique<video_frame>();
+
+	// copy the screen so the emulation can carry on drawing
+	if ((frame->m_bitmap.width() != bitmap.width()) || (frame->m_bitmap.height() != bitmap.height()))
+		frame->m_bitmap.allocate(bitmap.width(), bitmap.height());
+	copybitmap(frame->m_bitmap, bitmap, 0, 0, 0, 0, bitmap.cliprect());
+	frame->m_palette.assign(palette, palette + palette_entries);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_commands.emplace_back(command{ std::move(frame), std::vector<s16>(), count });
+	m_work.notify_one();
+	return true;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::add_sound_to_recording - add
+//  interleaved stereo samples, queued behind the
+//  frames before them
+//-------------------------------------------------
+
+bool movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+{
+	auto profile = g_profiler.start(PROFILER_MOVIE_REC);
+
+	if (!m_encoder.joinable())
+		return append_sound_samples(sound, numsamples);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_error)
+		return false;
+	std::vector<s16> samples;
+	if (!m_free_sound.empty())
+	{
+		samples = std::move(m_free_sound.back());
+		m_free_sound.pop_back();
+	}
+	samples.assign(sound, sound + numsamples * 2);
+	m_commands.emplace_back(command{ nullptr, std::move(samples), 0 });
+	m_work.notify_one();
+	return true;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::finish - write out anything
+//  still queued and stop the encoder thread
+//-------------------------------------------------
+
+void movie_recording::finish()
+{
+	if (!m_encoder.joinable())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+		m_work.notify_one();
+	}
+	m_encoder.join();
+
+	if (m_dropped)
+		osd_printf_verbose("Movie encoder fell behind: %u frame(s) repeated\n", m_dropped);
+}
+
+
+//-------------------------------------------------
+//  movie_recording::start_encoder - start a thread
+//  to encode frames, allowing the given number to
+//  wait for it
+//-------------------------------------------------
+
+void movie_recording::start_encoder(int queued_frames, bool drop)
+{
+	if (queued_frames <= 0)
+		return;
+
+	// the last frame written is held on to for repeats
+	m_frame_limit = queued_frames + 1;
+	m_drop = drop;
+	m_encoder = std::thread([this] () { encoder_main(); });
+}
+
+
+//-------------------------------------------------
+//  movie_recording::encoder_main - write queued
+//  frames and sound in order until told to stop
+//-------------------------------------------------
+
+void movie_recording::encoder_main()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true)
+	{
+		m_work.wait(lock, [this] () { return !m_commands.empty() || m_stopping; });
+		if (m_commands.empty())
+			break;
+		command cmd = std::move(m_commands.front());
+		m_commands.pop_front();
+
+		// skip the work once writing has failed, but keep recycling buffers
+		bool const failed = m_error;
+		lock.unlock();
+
+		// only this thread touches the last frame
+		bool ok = true;
+		if (!failed)
+		{
+			video_frame *const frame = cmd.m_frame ? cmd.m_frame.get() : cmd.m_count ? m_last_frame.get() : nullptr;
+			if (frame)
+				ok = write_frame(frame->m_bitmap, frame->m_palette.empty() ? nullptr : frame->m_palette.data(), int(frame->m_palette.size()), cmd.m_count);
+			else if (!cmd.m_count)
+				ok = append_sound_samples(cmd.m_sound.data(), int(cmd.m_sound.size() / 2));
+		}
+
+		lock.lock();
+		if (!ok)
+			m_error = true;
+		if (cmd.m_frame)
+		{
+			if (m_last_frame)
+				m_free_frames.emplace_back(std::move(m_last_frame));
+			m_last_frame = std::move(cmd.m_frame);
+		}
+		else if (!cmd.m_count)
+		{
+			m_free_sound.emplace_back(std::move(cmd.m_sound));
+		}
+		m_space.notify_one();
+	}
+}
+
+
+//-------------------------------------------------
+//  movie_recording::write_frame - append a bitmap
+//  to the movie the given number of times
+//-------------------------------------------------
+
+bool movie_recording::write_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries, int count)
+{
+	while (count--)
 	{
-		// append this bitmap as a single frame
 		if (!append_single_video_frame(bitmap, palette, palette_entries))
 			return false;
 		m_frame++;
-
-		// advance time
-		set_next_frame_time(next_frame_time() + frame_period());
 	}
 	return true;
 }
@@ -146,7 +339,10 @@ movie_recording::ptr movie_recording::create(running_machine &machine, screen_de
 
 	// if we successfully create a recording, set the current time and return it
 	if (result)
+	{
 		result->set_next_frame_time(machine.time());
+		result->start_encoder(machine.options().movie_queue(), machine.options().movie_drop());
+	}
 	return result;
 }
 
@@ -217,13 +413,11 @@ bool avi_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const
 
 
 //-------------------------------------------------
-//  avi_movie_recording::append_video_frame
+//  avi_movie_recording::append_sound_samples
 //-------------------------------------------------
 
-bool avi_movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+bool avi_movie_recording::append_sound_samples(const s16 *sound, int numsamples)
 {
-	auto profile = g_profiler.start(PROFILER_MOVIE_REC);
-
 	// write the next frame
 	avi_file::error avierr = m_avi_file->append_sound_samples(0, sound + 0, numsamples, 1);
 	if (avierr == avi_file::error::NONE)
@@ -250,6 +444,7 @@ mng_movie_recording::mng_movie_recording(screen_device *screen, std::map<std::st
 
 mng_movie_recording::~mng_movie_recording()
 {
+	finish();
 	if (m_mng_file)
 		util::mng_capture_stop(*m_mng_file);
 }
@@ -294,10 +489,10 @@ bool mng_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const
 
 
 //-------------------------------------------------
-//  mng_movie_recording::add_sound_to_recording
+//  mng_movie_recording::append_sound_samples
 //-------------------------------------------------
 
-bool mng_movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+bool mng_movie_recording::append_sound_samples(const s16 *sound, int numsamples)
 {
 	// not supported; do nothing
 	return true;
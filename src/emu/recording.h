@@ -17,11 +17,16 @@
 #ifndef MAME_EMU_RECORDING_H
 #define MAME_EMU_RECORDING_H
 
-#include <memory>
-
 #include "attotime.h"
 #include "palette.h"
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 class screen_device;
 
 
@@ -54,9 +59,7 @@ public:
 
 	// methods
 	bool append_video_frame(bitmap_rgb32 &bitmap, attotime curtime);
-
-	// virtuals
-	virtual bool add_sound_to_recording(const s16 *sound, int numsamples) = 0;
+	bool add_sound_to_recording(const s16 *sound, int numsamples);
 
 	// statics
 	static movie_recording::ptr create(running_machine &machine, screen_device *screen, format fmt, std::unique_ptr<emu_file> &&file, bitmap_rgb32 &snap_bitmap);
@@ -68,18 +71,57 @@ protected:
 	movie_recording(const movie_recording &) = delete;
 	movie_recording(movie_recording &&) = delete;
 
-	// virtuals
+	// virtuals; called on the encoder thread if there is one
 	virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) = 0;
+	virtual bool append_sound_samples(const s16 *sound, int numsamples) = 0;
+
+	// finish encoding queued frames; must be called by derived destructors
+	void finish();
 
 	// accessors
 	int current_frame() const { return m_frame; }
 	void set_frame_period(attotime time) { m_frame_period = time; }
 
 private:
+	// a copy of a screen waiting to be encoded
+	struct video_frame
+	{
+		bitmap_rgb32        m_bitmap;       // frame contents
+		std::vector<rgb_t>  m_palette;      // palette at the time it was drawn
+	};
+
+	// work for the encoder thread, in the order it's written
+	struct command
+	{
+		std::unique_ptr<video_frame>    m_frame;    // frame to write (nullptr repeats the last one)
+		std::vector<s16>                m_sound;    // interleaved stereo samples if no frame is given
+		int                             m_count;    // number of times to write the frame (0 for sound)
+	};
+
+	void start_encoder(int queued_frames, bool drop);
+	void encoder_main();
+	bool write_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries, int count);
+
 	screen_device * m_screen;               // screen associated with this movie (can be nullptr)
 	attotime        m_frame_period;         // duration of movie frame
 	attotime        m_next_frame_time;      // time of next frame
-	int             m_frame;                // current movie frame number
+	int             m_frame;                // number of frames written
+
+	// encoder thread
+	std::thread                                 m_encoder;          // thread doing the writing, if any
+	std::mutex                                  m_mutex;            // guards everything below
+	std::condition_variable                     m_work;             // signalled when a command is queued
+	std::condition_variable                     m_space;            // signalled when a frame buffer is freed
+	std::deque<command>                         m_commands;         // work queued for the encoder
+	std::vector<std::unique_ptr<video_frame>>   m_free_frames;      // frame buffers ready for reuse
+	std::vector<std::vector<s16>>               m_free_sound;       // sample buffers ready for reuse
+	std::unique_ptr<video_frame>                m_last_frame;       // frame written last, for repeats
+	int                                         m_frame_limit;      // frame buffers allowed, including the last one
+	int                                         m_frames_allocated; // frame buffers allocated so far
+	bool                                        m_drop;             // repeat the last frame rather than wait?
+	bool                                        m_stopping;         // flag: true when the encoder should drain and exit
+	bool                                        m_error;            // flag: true if writing failed
+	u32                                         m_dropped;          // frames replaced by repeats
 };
 
 
@@ -99,6 +99,34 @@ struct render_target::object_transform
 };
 
 
+// a retained_element holds the primitive built for a layout element item
+// in the previous list, along with everything it was built from
+struct render_target::retained_element
+{
+	layout_view_item *  item = nullptr;     // item the primitive was built for
+	render_texture *    texture = nullptr;  // state texture it shows
+	object_transform    xform;              // transform it was built with
+	float               scroll[4];          // scroll size and position
+	bool                clipped = false;    // was it clipped out entirely?
+	render_primitive    prim;               // the primitive itself
+
+	bool matches(const layout_view_item &curitem, const render_texture *curtexture, const object_transform &curxform, const float (&curscroll)[4]) const;
+};
+
+
+// a retained_state holds what the previous list was built from, so the
+// next one can reuse element primitives and report what changed
+struct render_target::retained_state
+{
+	layout_view *                   view = nullptr;     // view the list was built for
+	s32                             width = 0;          // target width
+	s32                             height = 0;         // target height
+	int                             orientation = 0;    // target orientation
+	std::vector<retained_element>   elements;           // one entry per visible item
+	std::vector<render_primitive>   containers;         // container primitives, in order
+};
+
+
 
 //**************************************************************************
 //  GLOBAL VARIABLES
@@ -167,6 +195,53 @@ inline void normalize_bounds(render_bounds &bounds)
 }
 
 
+//-------------------------------------------------
+//  same_primitive - return true if two primitives
+//  would draw the same thing
+//-------------------------------------------------
+
+inline bool same_bounds(const render_bounds &a, const render_bounds &b)
+{
+	return (a.x0 == b.x0) && (a.y0 == b.y0) && (a.x1 == b.x1) && (a.y1 == b.y1);
+}
+
+inline bool same_color(const render_color &a, const render_color &b)
+{
+	return (a.a == b.a) && (a.r == b.r) && (a.g == b.g) && (a.b == b.b);
+}
+
+inline bool same_primitive(const render_primitive &a, const render_primitive &b)
+{
+	if ((a.type != b.type) || (a.flags != b.flags) || (a.width != b.width) || (a.container != b.container))
+		return false;
+	if (!same_bounds(a.bounds, b.bounds) || !same_bounds(a.full_bounds, b.full_bounds) || !same_color(a.color, b.color))
+		return false;
+	if ((a.texture.base != b.texture.base) || (a.texture.seqid != b.texture.seqid) || (a.texture.unique_id != b.texture.unique_id) || (a.texture.palette != b.texture.palette))
+		return false;
+	return
+			(a.texcoords.tl.u == b.texcoords.tl.u) && (a.texcoords.tl.v == b.texcoords.tl.v) &&
+			(a.texcoords.tr.u == b.texcoords.tr.u) && (a.texcoords.tr.v == b.texcoords.tr.v) &&
+			(a.texcoords.bl.u == b.texcoords.bl.u) && (a.texcoords.bl.v == b.texcoords.bl.v) &&
+			(a.texcoords.br.u == b.texcoords.br.u) && (a.texcoords.br.v == b.texcoords.br.v);
+}
+
+
+//-------------------------------------------------
+//  matches - return true if a retained element
+//  primitive was built from the same inputs
+//-------------------------------------------------
+
+inline bool render_target::retained_element::matches(const layout_view_item &curitem, const render_texture *curtexture, const object_transform &curxform, const float (&curscroll)[4]) const
+{
+	return
+			(item == &curitem) && (texture == curtexture) &&
+			(xform.xoffs == curxform.xoffs) && (xform.yoffs == curxform.yoffs) && (xform.xscale == curxform.xscale) && (xform.yscale == curxform.yscale) &&
+			same_color(xform.color, curxform.color) && (xform.orientation == curxform.orientation) &&
+			std::equal(std::begin(scroll), std::end(scroll), std::begin(curscroll));
+}
+
+
+
 //**************************************************************************
 //  RENDER PRIMITIVE
 //**************************************************************************
@@ -354,7 +429,6 @@ void render_texture::release()
 	m_sbounds.set(0, -1, 0, -1);
 	m_format = TEXFORMAT_ARGB32;
 	m_scaler = nullptr;
-	m_curseq = 0;
 }
 
 
@@ -495,6 +569,30 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 }
 
 
+//-------------------------------------------------
+//  get_retained - add a reference for a scaled
+//  bitmap handed out by an earlier get_scaled,
+//  if it's still current
+//-------------------------------------------------
+
+bool render_texture::get_retained(const render_texinfo &texinfo, render_primitive_list &primlist)
+{
+	// a texture that has been reset or given a new ID needs a fresh look
+	if ((texinfo.unique_id != m_id) || (m_old_id != ~0ULL))
+		return false;
+
+	for (scaled_texture &scaled : m_scaled)
+	{
+		if (scaled.bitmap && (scaled.seqid == texinfo.seqid) && (&scaled.bitmap->pix(0) == texinfo.base))
+		{
+			primlist.add_reference(scaled.bitmap.get());
+			return true;
+		}
+	}
+	return false;
+}
+
+
 //-------------------------------------------------
 //  get_adjusted_palette - return the adjusted
 //  palette for a texture
@@ -914,6 +1012,7 @@ template <typename T> render_target::render_target(render_manager &manager, T &&
 	, m_maxtexheight(65536)
 	, m_transform_container(true)
 	, m_external_artwork(false)
+	, m_retained(std::make_unique<retained_state>())
 {
 	// determine the base layer configuration based on options
 	m_base_layerconfig.set_zoom_to_screen(manager.machine().options().artwork_crop());
@@ -960,14 +1059,20 @@ template <typename T> render_target::render_target(render_manager &manager, T &&
 	m_layerconfig = m_base_layerconfig;
 
 	// load the layout files
+	osd_ticks_t const load_start = osd_ticks();
 	load_layout_files(std::forward<T>(layout), flags & RENDER_CREATE_SINGLE_FILE);
 	for (layout_file &file : m_filelist)
 		for (layout_view &view : file.views())
 			if (!(m_flags & RENDER_CREATE_NO_ART) || !view.has_art())
 				m_views.emplace_back(view, view.default_visibility_mask());
+	osd_ticks_t const load_end = osd_ticks();
 
-	// set the current view to the first one
+	// set the current view to the first one; its images load in the background
 	set_view(0);
+	osd_printf_verbose("Render target: %u layout views loaded in %.1f ms, first view prepared in %.1f ms\n",
+			unsigned(m_views.size()),
+			double(load_end - load_start) * 1000.0 / double(osd_ticks_per_second()),
+			double(osd_ticks() - load_end) * 1000.0 / double(osd_ticks_per_second()));
 
 	// make us the UI target if there is none
 	if (!hidden() && manager.m_ui_target == nullptr)
@@ -1046,6 +1151,9 @@ void render_target::set_max_texture_size(int maxwidth, int maxheight)
 {
 	m_maxtexwidth = maxwidth;
 	m_maxtexheight = maxheight;
+
+	// element primitives may need different texture sizes now
+	m_retained->view = nullptr;
 }
 
 
@@ -1403,11 +1511,32 @@ render_primitive_list &render_target::get_primitives()
 	root_xform.orientation = m_orientation;
 	root_xform.no_center = false;
 
-	if (m_manager.machine().phase() >= machine_phase::RESET)
+	// anything built for a different layout can't be reused
+	retained_state &retained = *m_retained;
+	bool const running = m_manager.machine().phase() >= machine_phase::RESET;
+	u8 changes = 0;
+	if (!running || (retained.view != &current_view()) || (retained.width != m_width) || (retained.height != m_height) || (retained.orientation != m_orientation))
+	{
+		changes |= RENDER_CHANGED_LAYOUT;
+		retained.view = running ? &current_view() : nullptr;
+		retained.width = m_width;
+		retained.height = m_height;
+		retained.orientation = m_orientation;
+		retained.elements.clear();
+	}
+
+	if (running)
 	{
 		// we're running - iterate over items in the view
 		current_view().prepare_items();
-		for (layout_view_item &curitem : current_view().visible_items())
+		auto const &items(current_view().visible_items());
+		if (retained.elements.size() != items.size())
+		{
+			changes |= RENDER_CHANGED_ELEMENTS;
+			retained.elements.resize(items.size());
+		}
+		size_t index = 0;
+		for (layout_view_item &curitem : items)
 		{
 			// first apply orientation to the bounds
 			render_bounds bounds = curitem.bounds();
@@ -1427,8 +1556,9 @@ render_primitive_list &render_target::get_primitives()
 			// if there is no associated element, it must be a screen element
 			if (curitem.screen())
 				add_container_primitives(list, root_xform, item_xform, curitem.screen()->container(), curitem.blend_mode());
-			else
-				add_element_primitives(list, item_xform, curitem);
+			else if (add_element_primitives(list, item_xform, curitem, retained.elements[index]))
+				changes |= RENDER_CHANGED_ELEMENTS;
+			index++;
 		}
 	}
 	else
@@ -1471,6 +1601,11 @@ render_primitive_list &render_target::get_primitives()
 		add_container_primitives(list, root_xform, ui_xform, m_manager.ui_container(), BLENDMODE_ALPHA);
 	}
 
+	// compare the container primitives against the last list's
+	if (update_retained_containers(list))
+		changes |= RENDER_CHANGED_CONTAINERS;
+	list.m_changes = changes;
+
 	// optimize the list before handing it off
 	add_clear_and_optimize_primitive_list(list);
 	list.release_lock();
@@ -2511,7 +2646,7 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 //  for an element in the current state
 //-------------------------------------------------
 
-void render_target::add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_view_item &item)
+bool render_target::add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_view_item &item, retained_element &retained)
 {
 	layout_element &element(*item.element());
 	int const blendmode(item.blend_mode());
@@ -2521,78 +2656,142 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 
 	// get a pointer to the relevant texture
 	render_texture *texture = element.state_texture(state);
-	if (texture)
+	if (!texture)
 	{
-		render_primitive *prim = list.alloc(render_primitive::QUAD);
-
-		// configure the basics
-		prim->color = xform.color;
-		prim->flags =
-				PRIMFLAG_TEXORIENT(xform.orientation) |
-				PRIMFLAG_TEXFORMAT(texture->format()) |
-				PRIMFLAG_BLENDMODE(blendmode) |
-				PRIMFLAG_TEXWRAP((item.scroll_wrap_x() || item.scroll_wrap_y()) ? 1 : 0);
-
-		// compute the bounds
-		float const primwidth(render_round_nearest(xform.xscale));
-		float const primheight(render_round_nearest(xform.yscale));
-		prim->bounds.set_wh(render_round_nearest(xform.xoffs), render_round_nearest(xform.yoffs), primwidth, primheight);
-		prim->full_bounds = prim->bounds;
+		bool const changed = (retained.item != &item) || retained.texture;
+		retained.item = &item;
+		retained.texture = nullptr;
+		return changed;
+	}
 
-		// get the scaled texture and append it
-		float const xsize(item.scroll_size_x());
-		float const ysize(item.scroll_size_y());
-		s32 texwidth = render_round_nearest(((xform.orientation & ORIENTATION_SWAP_XY) ? primheight : primwidth) / xsize);
-		s32 texheight = render_round_nearest(((xform.orientation & ORIENTATION_SWAP_XY) ? primwidth : primheight) / ysize);
-		texwidth = (std::min)(texwidth, m_maxtexwidth);
-		texheight = (std::min)(texheight, m_maxtexheight);
-		texture->get_scaled(texwidth, texheight, prim->texture, list, prim->flags);
-
-		// compute the clip rect
-		render_bounds cliprect = prim->bounds & m_bounds;
-
-		// determine UV coordinates and apply clipping
-		float const xwindow((xform.orientation & ORIENTATION_SWAP_XY) ? primheight : primwidth);
-		float const ywindow((xform.orientation & ORIENTATION_SWAP_XY) ? primwidth : primheight);
-		float const xrange(float(texwidth) - (item.scroll_wrap_x() ? 0.0f : xwindow));
-		float const yrange(float(texheight) - (item.scroll_wrap_y() ? 0.0f : ywindow));
-		float const xoffset(render_round_nearest(item.scroll_pos_x() * xrange) / float(texwidth));
-		float const yoffset(render_round_nearest(item.scroll_pos_y() * yrange) / float(texheight));
-		float const xend(xoffset + (xwindow / float(texwidth)));
-		float const yend(yoffset + (ywindow / float(texheight)));
-		switch (xform.orientation)
+	// reuse the last primitive if nothing it depends on has changed
+	float const scroll[4] = { item.scroll_size_x(), item.scroll_size_y(), item.scroll_pos_x(), item.scroll_pos_y() };
+	if (retained.matches(item, texture, xform, scroll))
+	{
+		if (retained.clipped)
+			return false;
+		if (texture->get_retained(retained.prim.texture, list))
 		{
-		default:
-		case 0:
-			prim->texcoords = render_quad_texuv{ { xoffset, yoffset }, { xend, yoffset }, { xoffset, yend }, { xend, yend } };
-			break;
-		case ORIENTATION_FLIP_X:
-			prim->texcoords = render_quad_texuv{ { xend, yoffset }, { xoffset, yoffset }, { xend, yend }, { xoffset, yend } };
-			break;
-		case ORIENTATION_FLIP_Y:
-			prim->texcoords = render_quad_texuv{ { xoffset, yend }, { xend, yend }, { xoffset, yoffset }, { xend, yoffset } };
-			break;
-		case ORIENTATION_FLIP_X | ORIENTATION_FLIP_Y:
-			prim->texcoords = render_quad_texuv{ { xend, yend }, { xoffset, yend }, { xend, yoffset }, { xoffset, yoffset } };
-			break;
-		case ORIENTATION_SWAP_XY:
-			prim->texcoords = render_quad_texuv{ { xoffset, yoffset }, { xoffset, yend }, { xend, yoffset }, { xend, yend } };
-			break;
-		case ORIENTATION_SWAP_XY | ORIENTATION_FLIP_X:
-			prim->texcoords = render_quad_texuv{ { xoffset, yend }, { xoffset, yoffset }, { xend, yend }, { xend, yoffset } };
-			break;
-		case ORIENTATION_SWAP_XY | ORIENTATION_FLIP_Y:
-			prim->texcoords = render_quad_texuv{ { xend, yoffset }, { xend, yend }, { xoffset, yoffset }, { xoffset, yend } };
-			break;
-		case ORIENTATION_SWAP_XY | ORIENTATION_FLIP_X | ORIENTATION_FLIP_Y:
-			prim->texcoords = render_quad_texuv{ { xend, yend }, { xend, yoffset }, { xoffset, yend }, { xoffset, yoffset } };
-			break;
+			render_primitive *prim = list.alloc(render_primitive::QUAD);
+			*prim = retained.prim;
+			prim->texture.old_id = ~0ULL;
+			list.append(*prim);
+			return false;
 		}
+	}
 
-		// add to the list or free if we're clipped out
-		bool const clipped = render_clip_quad(prim->bounds, cliprect, &prim->texcoords);
-		list.append_or_return(*prim, clipped);
+	render_primitive *prim = list.alloc(render_primitive::QUAD);
+
+	// configure the basics
+	prim->color = xform.color;
+	prim->flags =
+			PRIMFLAG_TEXORIENT(xform.orientation) |
+			PRIMFLAG_TEXFORMAT(texture->format()) |
+			PRIMFLAG_BLENDMODE(blendmode) |
+			PRIMFLAG_TEXWRAP((item.scroll_wrap_x() || item.scroll_wrap_y()) ? 1 : 0);
+
+	// compute the bounds
+	float const primwidth(render_round_nearest(xform.xscale));
+	float const primheight(render_round_nearest(xform.yscale));
+	prim->bounds.set_wh(render_round_nearest(xform.xoffs), render_round_nearest(xform.yoffs), primwidth, primheight);
+	prim->full_bounds = prim->bounds;
+
+	// get the scaled texture and append it
+	float const xsize(scroll[0]);
+	float const ysize(scroll[1]);
+	s32 texwidth = render_round_nearest(((xform.orientation & ORIENTATION_SWAP_XY) ? primheight : primwidth) / xsize);
+	s32 texheight = render_round_nearest(((xform.orientation & ORIENTATION_SWAP_XY) ? primwidth : primheight) / ysize);
+	texwidth = (std::min)(texwidth, m_maxtexwidth);
+	texheight = (std::min)(texheight, m_maxtexheight);
+	texture->get_scaled(texwidth, texheight, prim->texture, list, prim->flags);
+
+	// compute the clip rect
+	render_bounds cliprect = prim->bounds & m_bounds;
+
+	// determine UV coordinates and apply clipping
+	float const xwindow((xform.orientation & ORIENTATION_SWAP_XY) ? primheight : primwidth);
+	float const ywindow((xform.orientation & ORIENTATION_SWAP_XY) ? primwidth : primheight);
+	float const xrange(float(texwidth) - (item.scroll_wrap_x() ? 0.0f : xwindow));
+	float const yrange(float(texheight) - (item.scroll_wrap_y() ? 0.0f : ywindow));
+	float const xoffset(render_round_nearest(scroll[2] * xrange) / float(texwidth));
+	float const yoffset(render_round_nearest(scroll[3] * yrange) / float(texheight));
+	float const xend(xoffset + (xwindow / float(texwidth)));
+	float const yend(yoffset + (ywindow / float(texheight)));
+	switch (xform.orientation)
+	{
+	default:
+	case 0:
+		prim->texcoords = render_quad_texuv{ { xoffset, yoffset }, { xend, yoffset }, { xoffset, yend }, { xend, yend } };
+		break;
+	case ORIENTATION_FLIP_X:
+		prim->texcoords = render_quad_texuv{ { xend, yoffset }, { xoffset, yoffset }, { xend, yend }, { xoffset, yend } };
+		break;
+	case ORIENTATION_FLIP_Y:
+		prim->texcoords = render_quad_texuv{ { xoffset, yend }, { xend, yend }, { xoffset, yoffset }, { xend, yoffset } };
+		break;
+	case ORIENTATION_FLIP_X | ORIENTATION_FLIP_Y:
+		prim->texcoords = render_quad_texuv{ { xend, yend }, { xoffset, yend }, { xend, yoffset }, { xoffset, yoffset } };
+		break;
+	case ORIENTATION_SWAP_XY:
+		prim->texcoords = render_quad_texuv{ { xoffset, yoffset }, { xoffset, yend }, { xend, yoffset }, { xend, yend } };
+		break;
+	case ORIENTATION_SWAP_XY | ORIENTATION_FLIP_X:
+		prim->texcoords = render_quad_texuv{ { xoffset, yend }, { xoffset, yoffset }, { xend, yend }, { xend, yoffset } };
+		break;
+	case ORIENTATION_SWAP_XY | ORIENTATION_FLIP_Y:
+		prim->texcoords = render_quad_texuv{ { xend, yoffset }, { xend, yend }, { xoffset, yoffset }, { xoffset, yend } };
+		break;
+	case ORIENTATION_SWAP_XY | ORIENTATION_FLIP_X | ORIENTATION_FLIP_Y:
+		prim->texcoords = render_quad_texuv{ { xend, yend }, { xend, yoffset }, { xoffset, yend }, { xoffset, yoffset } };
+		break;
+	}
+
+	// remember it for next time, then add to the list or free if we're clipped out
+	bool const clipped = render_clip_quad(prim->bounds, cliprect, &prim->texcoords);
+	retained.item = &item;
+	retained.texture = texture;
+	retained.xform = xform;
+	std::copy(std::begin(scroll), std::end(scroll), std::begin(retained.scroll));
+	retained.clipped = clipped;
+	retained.prim = *prim;
+	list.append_or_return(*prim, clipped);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  update_retained_containers - record the
+//  container primitives in a new list, returning
+//  true if any differ from the previous list's
+//-------------------------------------------------
+
+bool render_target::update_retained_containers(render_primitive_list &list)
+{
+	std::vector<render_primitive> &retained = m_retained->containers;
+	bool changed = false;
+	size_t count = 0;
+	for (render_primitive const &prim : list)
+	{
+		if (!prim.container)
+			continue;
+		if (count == retained.size())
+		{
+			retained.emplace_back(prim);
+			changed = true;
+		}
+		else if (!same_primitive(retained[count], prim))
+		{
+			retained[count] = prim;
+			changed = true;
+		}
+		count++;
+	}
+	if (count != retained.size())
+	{
+		retained.resize(count);
+		changed = true;
 	}
+	return changed;
 }
 
 
@@ -3106,6 +3305,7 @@ render_manager::render_manager(running_machine &machine)
 	, m_live_textures(0)
 	, m_texture_id(0)
 	, m_ui_container(std::make_unique<render_container>(*this))
+	, m_artwork_queue(nullptr)
 {
 	// register callbacks
 	machine.configuration().config_register(
@@ -3129,11 +3329,29 @@ render_manager::~render_manager()
 	m_ui_container.reset();
 	m_screen_container_list.clear();
 
+	// layouts wait for their background loads, so free them before the queue
+	m_targetlist.reset();
+	if (m_artwork_queue)
+		osd_work_queue_free(m_artwork_queue);
+
 	// better not be any outstanding textures when we die
 	assert(m_live_textures == 0);
 }
 
 
+//-------------------------------------------------
+//  artwork_queue - return the work queue used to
+//  load layout images in the background
+//-------------------------------------------------
+
+osd_work_queue *render_manager::artwork_queue()
+{
+	if (!m_artwork_queue)
+		m_artwork_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	return m_artwork_queue;
+}
+
+
 //-------------------------------------------------
 //  is_live - return if the screen is 'live'
 //-------------------------------------------------
@@ -66,6 +66,11 @@ constexpr u8 RENDER_CREATE_NO_ART       = 0x01;         // ignore any views that
 constexpr u8 RENDER_CREATE_SINGLE_FILE  = 0x02;         // only load views from the file specified
 constexpr u8 RENDER_CREATE_HIDDEN       = 0x04;         // don't make this target visible
 
+// primitive list change flags
+constexpr u8 RENDER_CHANGED_LAYOUT      = 0x01;         // target size, orientation or view changed
+constexpr u8 RENDER_CHANGED_ELEMENTS    = 0x02;         // layout element primitives changed
+constexpr u8 RENDER_CHANGED_CONTAINERS  = 0x04;         // screen or UI container primitives changed
+
 // render scaling modes
 enum
 {
@@ -147,6 +152,8 @@ constexpr u32 PRIMFLAG_GET_VECTORBUF(u32 x) { return (x & PRIMFLAG_VECTORBUF_MAS
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+struct osd_work_queue;
+
 // texture scaling callback
 typedef void (*texture_scaler_func)(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param);
 
@@ -260,6 +267,7 @@ class render_primitive_list
 public:
 	// getters
 	render_primitive *first() const { return m_primlist.first(); }
+	u8 changes() const { return m_changes; }
 
 	// range iterators
 	using auto_iterator = simple_list<render_primitive>::auto_iterator;
@@ -293,6 +301,7 @@ private:
 	// internal state
 	simple_list<render_primitive> m_primlist;               // list of primitives
 	simple_list<reference> m_reflist;                       // list of references
+	u8                  m_changes = RENDER_CHANGED_LAYOUT;  // RENDER_CHANGED_* flags relative to the target's previous list
 
 	fixed_allocator<render_primitive> m_primitive_allocator;// allocator for primitives
 	fixed_allocator<reference> m_reference_allocator;       // allocator for references
@@ -338,6 +347,7 @@ public:
 private:
 	// internal helpers
 	void get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags = 0);
+	bool get_retained(const render_texinfo &texinfo, render_primitive_list &primlist);
 	const rgb_t *get_adjusted_palette(render_container &container, u32 &out_length);
 
 	static constexpr int MAX_TEXTURE_SCALES = 100;
@@ -564,6 +574,8 @@ private:
 
 	// private classes declared in render.cpp
 	struct object_transform;
+	struct retained_element;
+	struct retained_state;
 
 	// internal helpers
 	enum constructor_impl_t { CONSTRUCTOR_IMPL };
@@ -576,7 +588,8 @@ private:
 	bool load_layout_file(const char *dirname, const internal_layout &layout_data, device_t *device = nullptr);
 	bool load_layout_file(device_t &device, util::xml::data_node const &rootnode, const char *searchpath, const char *dirname);
 	void add_container_primitives(render_primitive_list &list, const object_transform &root_xform, const object_transform &xform, render_container &container, int blendmode);
-	void add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_view_item &item);
+	bool add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_view_item &item, retained_element &retained);
+	bool update_retained_containers(render_primitive_list &list);
 	std::pair<float, float> map_point_internal(s32 target_x, s32 target_y);
 
 	// config callbacks
@@ -629,6 +642,7 @@ private:
 	bool                    m_transform_container;      // determines whether the screen container is transformed by the core renderer,
 														// otherwise the respective render API will handle the transformation (scale, offset)
 	bool                    m_external_artwork;         // external artwork was loaded (driver file or override)
+	std::unique_ptr<retained_state> m_retained;         // primitives kept from the previous list
 };
 
 
@@ -674,6 +688,9 @@ public:
 	// fonts
 	std::unique_ptr<render_font> font_alloc(const char *filename = nullptr);
 
+	// background loading of layout images
+	osd_work_queue *artwork_queue();
+
 	// reference tracking
 	void invalidate_all(void *refptr);
 
@@ -700,6 +717,7 @@ private:
 	// containers for the UI and for screens
 	std::unique_ptr<render_container> m_ui_container;   // UI container
 	std::list<render_container>     m_screen_container_list; // list of containers for the screen
+	osd_work_queue *                m_artwork_queue;    // queue for loading layout images
 };
 
 #endif  // MAME_EMU_RENDER_H
@@ -11,6 +11,7 @@
 
 #include "emucore.h"
 #include "eminline.h"
+#include "video/rendspan.h"
 #include "video/rgbutil.h"
 #include "render.h"
 
@@ -28,6 +29,9 @@ private:
 		s32 endx, endy;
 	};
 
+	// row operations for the common cases
+	using span = render_span<PixelType, SrcShiftR, SrcShiftG, SrcShiftB, DstShiftR, DstShiftG, DstShiftB, NoDestRead>;
+
 	// internal helpers
 	static constexpr bool is_opaque(float alpha) { return (alpha >= (NoDestRead ? 0.5f : 1.0f)); }
 	static constexpr bool is_transparent(float alpha) { return (alpha < (NoDestRead ? 0.5f : 0.0001f)); }
@@ -402,6 +406,32 @@ private:
 	}
 
 
+	//-------------------------------------------------
+	//  draw_row - fetch a row of texels a chunk at
+	//  a time and hand each chunk to a span
+	//  operation
+	//-------------------------------------------------
+
+	template <u32 (*Texel)(render_texinfo const &, s32, s32), typename SpanFunc>
+	static inline void draw_row(render_primitive const &prim, PixelType *dest, s32 curu, s32 curv, quad_setup_data const &setup, SpanFunc &&op)
+	{
+		u32 texels[64];
+		for (s32 x = setup.startx; x < setup.endx; )
+		{
+			s32 const count = std::min<s32>(setup.endx - x, std::size(texels));
+			for (s32 i = 0; i < count; i++)
+			{
+				texels[i] = Texel(prim.texture, curu, curv);
+				curu += setup.dudx;
+				curv += setup.dvdx;
+			}
+			op(dest, texels, u32(count));
+			dest += count;
+			x += count;
+		}
+	}
+
+
 	//-------------------------------------------------
 	//  draw_aa_pixel - draw an antialiased pixel
 	//-------------------------------------------------
@@ -1045,15 +1075,7 @@ private:
 				if (!palbase)
 				{
 					// no lookup case
-
-					// loop over cols
-					for (s32 x = setup.startx; x < setup.endx; x++)
-					{
-						u32 const pix = get_texel_rgb32<Wrap>(prim.texture, curu, curv);
-						*dest++ = source32_to_dest(pix);
-						curu += setup.dudx;
-						curv += setup.dvdx;
-					}
+					draw_row<&get_texel_rgb32<Wrap> >(prim, dest, curu, curv, setup, &span::copy);
 				}
 				else
 				{
@@ -1092,20 +1114,10 @@ private:
 
 				if (!palbase)
 				{
-					// no lookup case
-
-					// loop over cols
-					for (s32 x = setup.startx; x < setup.endx; x++)
-					{
-						u32 const pix = get_texel_rgb32<Wrap>(prim.texture, curu, curv);
-						u32 const r = (source32_r(pix) * sr) >> 8;
-						u32 const g = (source32_g(pix) * sg) >> 8;
-						u32 const b = (source32_b(pix) * sb) >> 8;
-
-						*dest++ = dest_assemble_rgb(r, g, b);
-						curu += setup.dudx;
-						curv += setup.dvdx;
-					}
+					// no lookup case; this is a blend that ignores the destination
+					draw_row<&get_texel_rgb32<Wrap> >(
+							prim, dest, curu, curv, setup,
+							[sr, sg, sb] (PixelType *d, u32 const *s, u32 n) { span::blend(d, s, n, sr, sg, sb, 0); });
 				}
 				else
 				{
@@ -1146,20 +1158,9 @@ private:
 				if (!palbase)
 				{
 					// no lookup case
-
-					// loop over cols
-					for (s32 x = setup.startx; x < setup.endx; x++)
-					{
-						u32 const pix = get_texel_rgb32<Wrap>(prim.texture, curu, curv);
-						u32 const dpix = NoDestRead ? 0 : *dest;
-						u32 const r = (source32_r(pix) * sr + dest_r(dpix) * invsa) >> 8;
-						u32 const g = (source32_g(pix) * sg + dest_g(dpix) * invsa) >> 8;
-						u32 const b = (source32_b(pix) * sb + dest_b(dpix) * invsa) >> 8;
-
-						*dest++ = dest_assemble_rgb(r, g, b);
-						curu += setup.dudx;
-						curv += setup.dvdx;
-					}
+					draw_row<&get_texel_rgb32<Wrap> >(
+							prim, dest, curu, curv, setup,
+							[sr, sg, sb, invsa] (PixelType *d, u32 const *s, u32 n) { span::blend(d, s, n, sr, sg, sb, invsa); });
 				}
 				else
 				{
@@ -1212,22 +1213,7 @@ private:
 				if (!palbase)
 				{
 					// no lookup case
-
-					// loop over cols
-					for (s32 x = setup.startx; x < setup.endx; x++)
-					{
-						u32 const pix = get_texel_argb32<Wrap>(prim.texture, curu, curv);
-						u32 const dpix = NoDestRead ? 0 : *dest;
-						u32 r = source32_r(pix) + dest_r(dpix);
-						u32 g = source32_g(pix) + dest_g(dpix);
-						u32 b = source32_b(pix) + dest_b(dpix);
-						r = (r | -(r >> (8 - SrcShiftR))) & (0xff >> SrcShiftR);
-						g = (g | -(g >> (8 - SrcShiftG))) & (0xff >> SrcShiftG);
-						b = (b | -(b >> (8 - SrcShiftB))) & (0xff >> SrcShiftB);
-						*dest++ = dest_assemble_rgb(r, g, b);
-						curu += setup.dudx;
-						curv += setup.dvdx;
-					}
+					draw_row<&get_texel_argb32<Wrap> >(prim, dest, curu, curv, setup, &span::add);
 				}
 				else
 				{
@@ -1341,20 +1327,7 @@ private:
 				if (!palbase)
 				{
 					// no lookup case
-
-					// loop over cols
-					for (s32 x = setup.startx; x < setup.endx; x++)
-					{
-						u32 const pix = get_texel_argb32<Wrap>(prim.texture, curu, curv);
-						u32 const dpix = NoDestRead ? 0 : *dest;
-						u32 const r = (source32_r(pix) * dest_r(dpix)) >> (8 - SrcShiftR);
-						u32 const g = (source32_g(pix) * dest_g(dpix)) >> (8 - SrcShiftG);
-						u32 const b = (source32_b(pix) * dest_b(dpix)) >> (8 - SrcShiftB);
-
-						*dest++ = dest_assemble_rgb(r, g, b);
-						curu += setup.dudx;
-						curv += setup.dvdx;
-					}
+					draw_row<&get_texel_argb32<Wrap> >(prim, dest, curu, curv, setup, &span::multiply);
 				}
 				else
 				{
@@ -1461,26 +1434,7 @@ private:
 				if (!palbase)
 				{
 					// no lookup case
-
-					// loop over cols
-					for (s32 x = setup.startx; x < setup.endx; x++)
-					{
-						u32 const pix = get_texel_argb32<Wrap>(prim.texture, curu, curv);
-						u32 const ta = pix >> 24;
-						if (ta != 0)
-						{
-							u32 const dpix = NoDestRead ? 0 : *dest;
-							u32 const invta = 0x100 - ta;
-							u32 const r = (source32_r(pix) * ta + dest_r(dpix) * invta) >> 8;
-							u32 const g = (source32_g(pix) * ta + dest_g(dpix) * invta) >> 8;
-							u32 const b = (source32_b(pix) * ta + dest_b(dpix) * invta) >> 8;
-
-							*dest = dest_assemble_rgb(r, g, b);
-						}
-						dest++;
-						curu += setup.dudx;
-						curv += setup.dvdx;
-					}
+					draw_row<&get_texel_argb32<Wrap> >(prim, dest, curu, curv, setup, &span::alpha);
 				}
 				else
 				{
@@ -1605,27 +1559,7 @@ private:
 				if (!palbase)
 				{
 					// no lookup case
-
-					// loop over cols
-					for (s32 x = setup.startx; x < setup.endx; x++)
-					{
-						u32 const pix = get_texel_argb32<Wrap>(prim.texture, curu, curv);
-						u32 const ta = pix >> 24;
-						if (ta != 0)
-						{
-							u32 const dpix = NoDestRead ? 0 : *dest;
-							u32 r = ((source32_r(pix) * ta) >> 8) + dest_r(dpix);
-							u32 g = ((source32_g(pix) * ta) >> 8) + dest_g(dpix);
-							u32 b = ((source32_b(pix) * ta) >> 8) + dest_b(dpix);
-							r = (r | -(r >> (8 - SrcShiftR))) & (0xff >> SrcShiftR);
-							g = (g | -(g >> (8 - SrcShiftG))) & (0xff >> SrcShiftG);
-							b = (b | -(b >> (8 - SrcShiftB))) & (0xff >> SrcShiftB);
-							*dest = dest_assemble_rgb(r, g, b);
-						}
-						dest++;
-						curu += setup.dudx;
-						curv += setup.dvdx;
-					}
+					draw_row<&get_texel_argb32<Wrap> >(prim, dest, curu, curv, setup, &span::add_alpha);
 				}
 				else
 				{
@@ -1278,6 +1278,7 @@ layout_element::layout_element(environment &env, util::xml::data_node const &ele
 	, m_statemask(0)
 	, m_foldhigh(false)
 	, m_invalidated(false)
+	, m_loading(false)
 {
 	// parse components in order
 	bool first = true;
@@ -1667,6 +1668,7 @@ void layout_element::preload()
 {
 	for (component::ptr const &curcomp : m_complist)
 		curcomp->preload(machine());
+	m_loading = std::any_of(m_complist.begin(), m_complist.end(), [] (component::ptr const &curcomp) { return curcomp->loading(); });
 }
 
 
@@ -1677,6 +1679,14 @@ void layout_element::preload()
 
 void layout_element::prepare()
 {
+	// redraw once images loading in the background have arrived
+	if (m_loading)
+	{
+		m_loading = std::any_of(m_complist.begin(), m_complist.end(), [] (component::ptr const &curcomp) { return curcomp->loading(); });
+		if (!m_loading)
+			m_invalidated = true;
+	}
+
 	if (m_invalidated)
 	{
 		m_invalidated = false;
@@ -1728,18 +1738,47 @@ public:
 	{
 	}
 
+	virtual ~image_component()
+	{
+		if (m_load_item)
+		{
+			while (!osd_work_item_wait(m_load_item, osd_ticks_per_second())) { }
+			osd_work_item_release(m_load_item);
+		}
+	}
+
 	// overrides
 	virtual void preload(running_machine &machine) override
 	{
-		if (!m_bitmap.valid() && !m_svg)
-			load_image(machine);
+		// decode on a worker thread, and draw nothing until it's done
+		if (!m_load_item && !m_bitmap.valid() && !m_svg)
+		{
+			osd_work_queue *const queue(machine.render().artwork_queue());
+			if (queue)
+				m_load_item = osd_work_item_queue(queue, &image_component::load_image_work, this, 0);
+			if (!m_load_item)
+				load_image();
+		}
+	}
+
+	virtual bool loading() override
+	{
+		if (!m_load_item)
+			return false;
+		if (!osd_work_item_wait(m_load_item, 0))
+			return true;
+		osd_work_item_release(m_load_item);
+		m_load_item = nullptr;
+		return false;
 	}
 
 protected:
 	virtual void draw_aligned(running_machine &machine, bitmap_argb32 &dest, rectangle const &bounds, int state) override
 	{
+		if (loading())
+			return;
 		if (!m_bitmap.valid() && !m_svg)
-			load_image(machine);
+			load_image();
 
 		if (m_bitmap.valid())
 			draw_bitmap(dest, bounds, state);
@@ -1862,7 +1901,13 @@ private:
 		}
 	}
 
-	void load_image(running_machine &machine)
+	static void *load_image_work(void *param, int threadid)
+	{
+		reinterpret_cast<image_component *>(param)->load_image();
+		return nullptr;
+	}
+
+	void load_image()
 	{
 		// if we have a filename, go with that
 		emu_file file(m_searchpath.empty() ? m_dirname : m_searchpath, OPEN_FLAG_READ);
@@ -2119,6 +2164,7 @@ private:
 	std::shared_ptr<NSVGrasterizer> m_rasterizer;       // SVG rasteriser
 	bitmap_argb32                   m_bitmap;           // source bitmap for images
 	bool                            m_hasalpha = false; // is there any alpha component present?
+	osd_work_item *                 m_load_item = nullptr; // background load, until it's been seen to finish
 
 	// cold state
 	std::string                     m_searchpath;       // asset search path (for lazy loading)
@@ -3677,6 +3723,17 @@ void layout_element::component::preload(running_machine &machine)
 }
 
 
+//-------------------------------------------------
+//  loading - return true while data started by
+//  preload is still arriving in the background
+//-------------------------------------------------
+
+bool layout_element::component::loading()
+{
+	return false;
+}
+
+
 //-------------------------------------------------
 //  draw - draw element to texture for a given
 //  state
@@ -121,6 +121,7 @@ private:
 
 		// operations
 		virtual void preload(running_machine &machine);
+		virtual bool loading();
 		virtual void draw(running_machine &machine, bitmap_argb32 &dest, int state);
 
 	protected:
@@ -200,6 +201,7 @@ private:
 	std::vector<texture>        m_elemtex;      // array of element textures used for managing the scaled bitmaps
 	draw_delegate               m_draw;         // draw delegate (called after components are drawn)
 	bool                        m_invalidated;  // force redrawing on next frame if set
+	bool                        m_loading;      // are components still loading images in the background?
 };
 
 
@@ -0,0 +1,196 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    resample.h
+
+    Kernels for the default resampler stream.  A resampled output sample
+    is the average of the input over the period it covers, treating the
+    input as constant across each of its samples.  The kernels work on
+    linear runs of samples and compute each output's position directly
+    rather than stepping to it, so four outputs can be done at a time
+    with SIMD where it's available; the scalar forms do the same
+    arithmetic, so the results don't depend on which is used.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_RESAMPLE_H
+#define MAME_EMU_RESAMPLE_H
+
+#pragma once
+
+// use SSE on 64-bit implementations, where it can be assumed
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define MAME_RESAMPLE_SSE2
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+
+
+/***************************************************************************
+    HELPERS
+***************************************************************************/
+
+#if defined(MAME_RESAMPLE_SSE2)
+
+/*-------------------------------------------------
+    resample_gather4 - load the four samples at
+    the given indices
+-------------------------------------------------*/
+
+inline __m128 resample_gather4(const float *src, __m128i index)
+{
+	alignas(16) s32 lanes[4];
+	_mm_store_si128(reinterpret_cast<__m128i *>(lanes), index);
+	return _mm_set_ps(src[lanes[3]], src[lanes[2]], src[lanes[1]], src[lanes[0]]);
+}
+
+
+/*-------------------------------------------------
+    resample_select4 - pick 'a' where 'mask' is
+    set, 'b' elsewhere
+-------------------------------------------------*/
+
+inline __m128 resample_select4(__m128 mask, __m128 a, __m128 b)
+{
+	return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+
+/*-------------------------------------------------
+    resample_position4 - positions in the input
+    of outputs 'n' to 'n + 3'
+-------------------------------------------------*/
+
+inline __m128 resample_position4(u32 n, float srcpos, float step)
+{
+	__m128 const index = _mm_cvtepi32_ps(_mm_add_epi32(_mm_set1_epi32(s32(n)), _mm_set_epi32(3, 2, 1, 0)));
+	return _mm_add_ps(_mm_set1_ps(srcpos), _mm_mul_ps(index, _mm_set1_ps(step)));
+}
+
+#endif // MAME_RESAMPLE_SSE2
+
+
+/***************************************************************************
+    KERNELS
+***************************************************************************/
+
+/*-------------------------------------------------
+    resample_up - 'count' outputs for an input
+    rate below the output rate ('step', the input
+    samples per output, is under 1.0); each output
+    is within one input sample or straddles two of
+    them; 'srcpos' is the position of the first
+    output within src[0], and reads are limited to
+    the 'srccount' input samples
+-------------------------------------------------*/
+
+inline void resample_up(float *dest, u32 count, const float *src, u32 srccount, float srcpos, float step, float stepinv)
+{
+	s32 const last = s32(srccount) - 1;
+	u32 x = 0;
+#if defined(MAME_RESAMPLE_SSE2)
+	__m128 const one = _mm_set1_ps(1.0f);
+	__m128 const vstep = _mm_set1_ps(step);
+	__m128 const vstepinv = _mm_set1_ps(stepinv);
+	__m128i const vlast = _mm_set1_epi32(last);
+	for ( ; (x + 4) <= count; x += 4)
+	{
+		__m128 const pos = resample_position4(x, srcpos, step);
+		__m128i const index = _mm_cvttps_epi32(pos);
+		__m128 const end = _mm_add_ps(_mm_sub_ps(pos, _mm_cvtepi32_ps(index)), vstep);
+		__m128 const frac = _mm_sub_ps(end, one);
+
+		// clamp the neighbour index (min_epi32 needs SSE4.1)
+		__m128i next = _mm_add_epi32(index, _mm_set1_epi32(1));
+		__m128i const over = _mm_cmpgt_epi32(next, vlast);
+		next = _mm_or_si128(_mm_and_si128(over, vlast), _mm_andnot_si128(over, next));
+
+		__m128 const cur = resample_gather4(src, index);
+		__m128 const blend = _mm_mul_ps(vstepinv, _mm_add_ps(_mm_mul_ps(cur, _mm_sub_ps(vstep, frac)), _mm_mul_ps(frac, resample_gather4(src, next))));
+		_mm_storeu_ps(dest + x, resample_select4(_mm_cmpgt_ps(end, one), blend, cur));
+	}
+#endif
+	for ( ; x < count; x++)
+	{
+		float const pos = srcpos + float(s32(x)) * step;
+		s32 const index = s32(pos);
+		float const end = (pos - float(index)) + step;
+		float const cur = src[index];
+		if (end > 1.0f)
+		{
+			float const frac = end - 1.0f;
+			dest[x] = stepinv * (cur * (step - frac) + frac * src[std::min(index + 1, last)]);
+		}
+		else
+			dest[x] = cur;
+	}
+}
+
+
+/*-------------------------------------------------
+    resample_down - 'count' outputs for an input
+    rate at or above the output rate ('step' is 1.0
+    or more); each output sums the part of
+    its first input sample it covers, the whole
+    samples after it, and the part of its last
+    one; the arguments are as for resample_up
+-------------------------------------------------*/
+
+inline void resample_down(float *dest, u32 count, const float *src, u32 srccount, float srcpos, float step, float stepinv)
+{
+	s32 const last = s32(srccount) - 1;
+	u32 x = 0;
+#if defined(MAME_RESAMPLE_SSE2)
+	__m128 const one = _mm_set1_ps(1.0f);
+	__m128 const vstep = _mm_set1_ps(step);
+	__m128i const vlast = _mm_set1_epi32(last);
+	for ( ; (x + 4) <= count; x += 4)
+	{
+		__m128 const pos = resample_position4(x, srcpos, step);
+		__m128i const index = _mm_cvttps_epi32(pos);
+		__m128 const end = _mm_add_ps(pos, vstep);
+		__m128i const endindex = _mm_cvttps_epi32(end);
+		__m128 const remaining = _mm_sub_ps(end, _mm_cvtepi32_ps(endindex));
+
+		// partial first sample
+		__m128 sum = _mm_mul_ps(resample_gather4(src, index), _mm_sub_ps(one, _mm_sub_ps(pos, _mm_cvtepi32_ps(index))));
+
+		// whole samples, as many steps as the widest lane needs
+		alignas(16) s32 spans[4];
+		_mm_store_si128(reinterpret_cast<__m128i *>(spans), _mm_sub_epi32(endindex, index));
+		s32 const widest = std::max(std::max(spans[0], spans[1]), std::max(spans[2], spans[3]));
+		__m128i middle = index;
+		for (s32 i = 1; i < widest; i++)
+		{
+			middle = _mm_add_epi32(middle, _mm_set1_epi32(1));
+			__m128i const inside = _mm_cmplt_epi32(middle, endindex);
+			__m128i const clamped = _mm_or_si128(_mm_and_si128(inside, middle), _mm_andnot_si128(inside, index));
+			sum = resample_select4(_mm_castsi128_ps(inside), _mm_add_ps(sum, resample_gather4(src, clamped)), sum);
+		}
+
+		// partial last sample
+		__m128i const over = _mm_cmpgt_epi32(endindex, vlast);
+		__m128i const lastindex = _mm_or_si128(_mm_and_si128(over, vlast), _mm_andnot_si128(over, endindex));
+		sum = _mm_add_ps(sum, _mm_mul_ps(resample_gather4(src, lastindex), remaining));
+		_mm_storeu_ps(dest + x, _mm_mul_ps(sum, _mm_set1_ps(stepinv)));
+	}
+#endif
+	for ( ; x < count; x++)
+	{
+		float const pos = srcpos + float(s32(x)) * step;
+		s32 const index = s32(pos);
+		float const end = pos + step;
+		s32 const endindex = s32(end);
+		float const remaining = end - float(endindex);
+
+		float sum = src[index] * (1.0f - (pos - float(index)));
+		for (s32 i = index + 1; i < endindex; i++)
+			sum = sum + src[i];
+		sum = sum + src[std::min(endindex, last)] * remaining;
+		dest[x] = sum * stepinv;
+	}
+}
+
+#endif // MAME_EMU_RESAMPLE_H
@@ -19,11 +19,16 @@
 
 #include "ui/uimain.h"
 
+#include "hashing.h"
+
 #include "corestr.h"
 #include "path.h"
 
+#include "modules/lib/osdlib.h"
+
 #include <algorithm>
 #include <cstdarg>
+#include <cstdio>
 #include <set>
 
 
@@ -36,6 +41,7 @@
 ***************************************************************************/
 
 #define TEMPBUFFER_MAX_SIZE     (1024 * 1024 * 1024)
+#define PREFETCH_MAX_SIZE       (64 * 1024 * 1024)
 
 /***************************************************************************
     HELPERS
@@ -586,7 +592,7 @@ void rom_load_manager::dump_wrong_and_correct_checksums(const util::hash_collect
     and hash signatures of a file
 -------------------------------------------------*/
 
-void rom_load_manager::verify_length_and_hash(emu_file *file, std::string_view name, u32 explength, const util::hash_collection &hashes)
+void rom_load_manager::verify_length_and_hash(emu_file *file, std::string_view name, u32 explength, const util::hash_collection &hashes, bool trusted)
 {
 	// we've already complained if there is no file
 	if (!file)
@@ -608,8 +614,8 @@ void rom_load_manager::verify_length_and_hash(emu_file *file, std::string_view n
 	}
 	else
 	{
-		// verify checksums
-		util::hash_collection const &acthashes(file->hashes(hashes.hash_types()));
+		// verify checksums, unless the file hasn't changed since it last verified
+		util::hash_collection const &acthashes(trusted ? hashes : file->hashes(hashes.hash_types()));
 		if (hashes != acthashes)
 		{
 			// otherwise, it's just bad
@@ -717,41 +723,177 @@ void rom_load_manager::region_post_process(memory_region *region, bool invert)
 
 
 /*-------------------------------------------------
-    open_rom_file - open a ROM file, searching
-    up the parent and loading by checksum
+    region_share - replace a loaded region with a
+    copy-on-write view of a file named after its
+    contents, so other instances loading the same
+    data share the host pages
+-------------------------------------------------*/
+
+void rom_load_manager::region_share(memory_region *region)
+{
+	// small regions would waste most of a host page
+	if (!region || (region->bytes() < 0x10000) || region->mapped())
+		return;
+
+	util::sha1_t const digest(util::sha1_creator::simple(region->base(), region->bytes()));
+	std::string const name(digest.as_string() + ".bin");
+	char const *const directory(machine().options().rom_share_directory());
+
+	// write the image under a name of our own and rename it into place, so
+	// another instance never maps a partly written file
+	emu_file existing(directory, OPEN_FLAG_READ);
+	if (existing.open(name) || (existing.size() != region->bytes()))
+	{
+		existing.close();
+		std::string const tempname(util::string_format("%s.%d", name, osd_getpid()));
+		emu_file temp(directory, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		if (temp.open(tempname))
+		{
+			LOG("Couldn't create shared image %s\n", tempname.c_str());
+			return;
+		}
+		std::string temppath(temp.fullpath());
+		bool const written(temp.write(region->base(), region->bytes()) == region->bytes());
+		temp.close();
+
+		std::string finalpath(temppath);
+		finalpath.replace(finalpath.size() - tempname.size(), tempname.size(), name);
+		if (!written || std::rename(temppath.c_str(), finalpath.c_str()))
+			osd_file::remove(temppath);
+		if (existing.open(name) || (existing.size() != region->bytes()))
+			return;
+	}
+
+	// the file may be stale or shared with something else, so check what we mapped
+	auto view(std::make_unique<osd::mapped_file_view>(existing.fullpath(), region->bytes()));
+	existing.close();
+	if (!*view || (util::sha1_creator::simple(view->get(), region->bytes()) != digest))
+	{
+		LOG("Couldn't map shared image %s for region %s\n", name.c_str(), region->name().c_str());
+		return;
+	}
+
+	LOG("Region %s mapped from shared image %s\n", region->name().c_str(), name.c_str());
+	region->set_view(std::move(view));
+}
+
+
+/*-------------------------------------------------
+    file_prefetch - a ROM file being opened,
+    decompressed and hashed on a worker thread
+    ahead of loading
+-------------------------------------------------*/
+
+struct rom_load_manager::file_prefetch
+{
+	file_prefetch(rom_load_manager &manager, const std::vector<std::string> &searchpath, const rom_entry *romp)
+		: m_manager(manager)
+		, m_searchpath(searchpath)
+		, m_romp(romp)
+	{
+	}
+
+	~file_prefetch()
+	{
+		// a worker may still be using this if loading failed part way through
+		if (m_item)
+			osd_work_item_release(m_item);
+	}
+
+	rom_load_manager &                  m_manager;
+	const std::vector<std::string> &    m_searchpath;
+	const rom_entry *                   m_romp;
+	osd_work_item *                     m_item = nullptr;
+	std::unique_ptr<emu_file>           m_file;
+	std::vector<std::string>            m_tried;
+	std::error_condition                m_filerr = std::errc::no_such_file_or_directory;
+	std::string                         m_identity;
+	bool                                m_trusted = false;
+};
+
+
+/*-------------------------------------------------
+    prefetch_rom_file - open a ROM file and
+    compute its hashes, which decompresses it if
+    it's in an archive
+-------------------------------------------------*/
+
+void *rom_load_manager::prefetch_rom_file(void *param, int threadid)
+{
+	file_prefetch &prefetch(*reinterpret_cast<file_prefetch *>(param));
+	const rom_entry *const romp(prefetch.m_romp);
+	try
+	{
+		// extract CRC to use for searching
+		util::hash_collection const hashes(romp->hashdata());
+		u32 crc = 0;
+		bool const has_crc = hashes.crc(crc);
+
+		// attempt reading up the chain through the parents
+		// it also automatically attempts any kind of load by checksum supported by the archives.
+		prefetch.m_file = prefetch.m_manager.open_rom_file(prefetch.m_searchpath, prefetch.m_tried, has_crc, crc, ROM_GETNAME(romp), prefetch.m_filerr);
+
+		// a file that hasn't changed since it last verified needn't be hashed
+		if (prefetch.m_file && prefetch.m_manager.m_identify)
+		{
+			prefetch.m_identity = prefetch.m_file->identity();
+			prefetch.m_trusted = !prefetch.m_identity.empty() && prefetch.m_manager.m_trusted.count(prefetch.m_identity);
+		}
+
+		// hashing now leaves verification with nothing but a comparison
+		if (prefetch.m_file && !prefetch.m_trusted && !hashes.flag(util::hash_collection::FLAG_NO_DUMP))
+			prefetch.m_file->hashes(hashes.hash_types());
+	}
+	catch (...)
+	{
+		prefetch.m_file.reset();
+		prefetch.m_filerr = std::errc::not_enough_memory;
+	}
+	return nullptr;
+}
+
+
+/*-------------------------------------------------
+    open_rom_file - collect a ROM file opened by
+    prefetch_rom_file, in ROM definition order
 -------------------------------------------------*/
 
 std::unique_ptr<emu_file> rom_load_manager::open_rom_file(
-		const std::vector<std::string> &searchpath,
-		const rom_entry *romp,
+		file_prefetch &prefetch,
 		std::vector<std::string> &tried_file_names,
 		bool from_list)
 {
-	std::error_condition filerr = std::errc::no_such_file_or_directory;
+	const rom_entry *const romp(prefetch.m_romp);
 	u32 const romsize = rom_file_size(romp);
-	tried_file_names.clear();
 
 	// update status display
 	display_loading_rom_message(ROM_GETNAME(romp), from_list);
 
-	// extract CRC to use for searching
-	u32 crc = 0;
-	bool const has_crc = util::hash_collection(romp->hashdata()).crc(crc);
-
-	// attempt reading up the chain through the parents
-	// it also automatically attempts any kind of load by checksum supported by the archives.
-	std::unique_ptr<emu_file> result(
-			open_rom_file(searchpath, tried_file_names, has_crc, crc, ROM_GETNAME(romp), filerr));
+	// wait for the worker, or do the work here if it was never queued
+	if (prefetch.m_item)
+	{
+		osd_work_item_release(prefetch.m_item);
+		prefetch.m_item = nullptr;
+	}
+	else
+	{
+		prefetch_rom_file(&prefetch, 0);
+	}
+	tried_file_names = std::move(prefetch.m_tried);
 
 	// update counters
 	m_romsloaded++;
 	m_romsloadedsize += romsize;
+	if (!prefetch.m_identity.empty())
+		m_identities.emplace_back(prefetch.m_identity);
+	if (prefetch.m_trusted)
+		m_trustedcount++;
 
 	// return the result
-	if (filerr)
+	if (prefetch.m_filerr)
 		return nullptr;
 	else
-		return result;
+		return std::move(prefetch.m_file);
 }
 
 
@@ -924,6 +1066,41 @@ int rom_load_manager::read_rom_data(
 }
 
 
+/*-------------------------------------------------
+    map_rom_data - point a region at a private
+    mapping of a loose ROM file that fills it
+    exactly, instead of reading a copy
+-------------------------------------------------*/
+
+bool rom_load_manager::map_rom_data(
+		emu_file &file,
+		memory_region &region,
+		const rom_entry *parent_region,
+		const rom_entry *romp)
+{
+	// only plain loads of the region's sole file with nothing to post-process
+	if (!machine().options().rom_share() || (region.bytes() < 0x10000) || region.mapped())
+		return false;
+	if ((romp != (parent_region + 1)) || !ROMENTRY_ISREGIONEND(romp + 1) || ROM_INHERITSFLAGS(romp))
+		return false;
+	if (ROM_GETOFFSET(romp) || (ROM_GETLENGTH(romp) != region.bytes()) || (ROM_GETBITWIDTH(romp) != 8) || ROM_GETBITSHIFT(romp) || ROM_GETSKIPCOUNT(romp) || ((ROM_GETGROUPSIZE(romp) != 1) && ROM_ISREVERSED(romp)))
+		return false;
+	if (ROMREGION_ISINVERTED(parent_region) || ((region.bytewidth() > 1) && (region.endianness() != ENDIANNESS_NATIVE)))
+		return false;
+	if (file.archived() || (file.size() != region.bytes()))
+		return false;
+
+	// written pages become private, so drivers can still patch the data in place
+	auto view(std::make_unique<osd::mapped_file_view>(file.fullpath(), region.bytes()));
+	if (!*view)
+		return false;
+
+	LOG("Region %s mapped from %s\n", region.name().c_str(), file.fullpath());
+	region.set_view(std::move(view));
+	return true;
+}
+
+
 /*-------------------------------------------------
     fill_rom_data - fill a region of ROM space
 -------------------------------------------------*/
@@ -1005,6 +1182,33 @@ void rom_load_manager::process_rom_entries(
 	u32 lastflags = 0;
 	std::vector<std::string> tried_file_names;
 
+	// find the files we'll need so they can be opened, decompressed and hashed
+	// on worker threads while earlier ones are loaded
+	std::vector<std::unique_ptr<file_prefetch> > prefetch;
+	for (const rom_entry *scan = romp; !ROMENTRY_ISREGIONEND(scan); scan++)
+	{
+		if (ROMENTRY_ISFILE(scan) && (!ROM_GETBIOSFLAGS(scan) || (ROM_GETBIOSFLAGS(scan) == bios)))
+			prefetch.emplace_back(std::make_unique<file_prefetch>(*this, searchpath, scan));
+	}
+	if ((prefetch.size() > 1) && !m_prefetch_queue)
+		m_prefetch_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
+	// keep a bounded amount of decompressed data in flight
+	auto nextqueue(prefetch.begin());
+	auto nextload(prefetch.begin());
+	u64 queuedsize(0);
+	auto const queue_prefetch =
+			[this, &prefetch, &nextqueue, &nextload, &queuedsize] ()
+			{
+				while ((prefetch.size() > 1) && (prefetch.end() != nextqueue) && ((nextqueue == nextload) || (queuedsize < PREFETCH_MAX_SIZE)))
+				{
+					queuedsize += rom_file_size((*nextqueue)->m_romp);
+					(*nextqueue)->m_item = osd_work_item_queue(m_prefetch_queue, prefetch_rom_file, nextqueue->get(), 0);
+					++nextqueue;
+				}
+			};
+	queue_prefetch();
+
 	// loop until we hit the end of this region
 	while (!ROMENTRY_ISREGIONEND(romp))
 	{
@@ -1036,15 +1240,25 @@ void rom_load_manager::process_rom_entries(
 			bool const irrelevantbios = (ROM_GETBIOSFLAGS(romp) != 0) && (ROM_GETBIOSFLAGS(romp) != bios);
 			rom_entry const *baserom = romp;
 			int explength = 0;
+			bool mapped = false;
+			bool trusted = false;
 
 			// open the file if it is a non-BIOS or matches the current BIOS
 			LOG("Opening ROM file: %s\n", ROM_GETNAME(romp));
 			std::unique_ptr<emu_file> file;
 			if (!irrelevantbios)
 			{
-				file = open_rom_file(searchpath, romp, tried_file_names, from_list);
+				assert((prefetch.end() != nextload) && ((*nextload)->m_romp == romp));
+				file = open_rom_file(**nextload, tried_file_names, from_list);
+				trusted = (*nextload)->m_trusted;
+				if (nextload < nextqueue)
+					queuedsize -= rom_file_size(romp);
+				++nextload;
+				queue_prefetch();
 				if (!file)
 					handle_missing_file(romp, tried_file_names, std::error_condition());
+				else
+					mapped = map_rom_data(*file, region, parent_region, romp);
 			}
 
 			// loop until we run out of reloads
@@ -1065,7 +1279,7 @@ void rom_load_manager::process_rom_entries(
 					explength += ROM_GETLENGTH(&modified_romp);
 
 					// attempt to read using the modified entry
-					if (!ROMENTRY_ISIGNORE(&modified_romp) && !irrelevantbios)
+					if (!ROMENTRY_ISIGNORE(&modified_romp) && !irrelevantbios && !mapped)
 						/*readresult = */read_rom_data(file.get(), region, parent_region, &modified_romp);
 				}
 				while (ROMENTRY_ISCONTINUE(romp) || ROMENTRY_ISIGNORE(romp));
@@ -1074,7 +1288,7 @@ void rom_load_manager::process_rom_entries(
 				if (baserom)
 				{
 					LOG("Verifying length (%X) and checksums\n", explength);
-					verify_length_and_hash(file.get(), baserom->name(), explength, util::hash_collection(baserom->hashdata()));
+					verify_length_and_hash(file.get(), baserom->name(), explength, util::hash_collection(baserom->hashdata()), trusted);
 					LOG("Verify finished\n");
 				}
 
@@ -1455,19 +1669,83 @@ void rom_load_manager::load_software_part_region(device_t &device, software_list
 
 	// now go back and post-process all the regions
 	for (const rom_entry *region = start_region; region != nullptr; region = rom_next_region(region))
+	{
 		region_post_process(device.memregion(region->name()), ROMREGION_ISINVERTED(region));
+		if (ROMREGION_ISROMDATA(region) && machine().options().rom_share())
+			region_share(device.memregion(region->name()));
+	}
 
 	// display the results and exit
 	display_rom_load_results(true);
 }
 
 
+/*-------------------------------------------------
+    reuse_region - copy a region kept from before
+    a hard reset if every file that went into it
+    is unchanged
+-------------------------------------------------*/
+
+bool rom_load_manager::reuse_region(
+		const rom_restart_cache::region &cached,
+		const std::vector<std::string> &searchpath,
+		u8 bios,
+		memory_region &region,
+		const rom_entry *romp)
+{
+	if ((cached.data.size() != region.bytes()) || (cached.width != region.bytewidth()) || (cached.endian != region.endianness()))
+		return false;
+
+	// opening a file gives its identity without reading or decompressing it
+	std::vector<std::string> identities;
+	u64 size = 0;
+	for (const rom_entry *scan = romp; !ROMENTRY_ISREGIONEND(scan); scan++)
+	{
+		if (ROMENTRY_ISFILE(scan) && (!ROM_GETBIOSFLAGS(scan) || (ROM_GETBIOSFLAGS(scan) == bios)))
+		{
+			util::hash_collection const hashes(scan->hashdata());
+			u32 crc = 0;
+			bool const has_crc = hashes.crc(crc);
+			std::vector<std::string> tried;
+			std::error_condition filerr;
+			std::unique_ptr<emu_file> file = open_rom_file(searchpath, tried, has_crc, crc, ROM_GETNAME(scan), filerr);
+			if (!file)
+				return false;
+			identities.emplace_back(file->identity());
+			if (identities.back().empty() || (identities.size() > cached.identities.size()) || (identities.back() != cached.identities[identities.size() - 1]))
+				return false;
+			size += rom_file_size(scan);
+		}
+	}
+	if (identities.size() != cached.identities.size())
+		return false;
+
+	memcpy(region.base(), &cached.data[0], cached.data.size());
+	m_romsloaded += identities.size();
+	m_romsloadedsize += size;
+	m_trustedcount += identities.size();
+	m_identities.insert(m_identities.end(), identities.begin(), identities.end());
+	return true;
+}
+
+
 /*-------------------------------------------------
     process_region_list - process a region list
 -------------------------------------------------*/
 
 void rom_load_manager::process_region_list()
 {
+	// a hard reset of the same system can reuse the regions it loaded last time
+	std::string const cachekey = util::string_format("%s:%s", machine().system().name, machine().options().bios());
+	if (m_restart && (m_restart->m_system != cachekey))
+	{
+		m_restart->m_regions.clear();
+		m_restart->m_trusted.clear();
+		m_restart->m_system = cachekey;
+	}
+	std::set<std::string> reused;
+	std::map<std::string, std::pair<size_t, size_t> > loaded;
+
 	// loop until we hit the end
 	device_enumerator deviter(machine().root_device());
 	std::vector<std::string> searchpath;
@@ -1497,6 +1775,21 @@ void rom_load_manager::process_region_list()
 				memory_region *const memregion = machine().memory().region_alloc(regiontag, regionlength, width, endianness);
 				LOG("Allocated %X bytes @ %p\n", memregion->bytes(), memregion->base());
 
+				if (searchpath.empty())
+					searchpath = device.searchpath();
+				assert(!searchpath.empty());
+
+				if (m_restart)
+				{
+					auto const cached = m_restart->m_regions.find(regiontag);
+					if ((m_restart->m_regions.end() != cached) && reuse_region(cached->second, searchpath, device.system_bios(), *memregion, region + 1))
+					{
+						LOG("Reused region \"%s\" from before the restart\n", regiontag.c_str());
+						reused.emplace(regiontag);
+						continue;
+					}
+				}
+
 				if (ROMREGION_ISERASE(region)) // clear the region if it's requested
 					memset(memregion->base(), ROMREGION_GETERASEVAL(region), memregion->bytes());
 				else if (memregion->bytes() <= 0x400000) // or if it's sufficiently small (<= 4MB)
@@ -1507,10 +1800,9 @@ void rom_load_manager::process_region_list()
 #endif
 
 				// now process the entries in the region
-				if (searchpath.empty())
-					searchpath = device.searchpath();
-				assert(!searchpath.empty());
+				size_t const firstfile = m_identities.size();
 				process_rom_entries(searchpath, device.system_bios(), *memregion, region, region + 1, false);
+				loaded.emplace(regiontag, std::make_pair(firstfile, m_identities.size()));
 			}
 			else if (ROMREGION_ISDISKDATA(region))
 			{
@@ -1531,10 +1823,36 @@ void rom_load_manager::process_region_list()
 		}
 	}
 
-	// now go back and post-process all the regions
+	// now go back and post-process all the regions; reused ones were kept post-processed
 	for (device_t &device : deviter)
 		for (const rom_entry *region = rom_first_region(device); region != nullptr; region = rom_next_region(region))
-			region_post_process(device.memregion(region->name()), ROMREGION_ISINVERTED(region));
+		{
+			memory_region *const memregion = device.memregion(region->name());
+			if (!memregion || !reused.count(memregion->name()))
+				region_post_process(memregion, ROMREGION_ISINVERTED(region));
+
+			// keep a copy of cleanly loaded regions for the next hard reset
+			auto const files = memregion ? loaded.find(memregion->name()) : loaded.end();
+			if (m_restart && (loaded.end() != files) && !m_warnings && !m_errors)
+			{
+				rom_restart_cache::region &cached = m_restart->m_regions[memregion->name()];
+				cached.width = memregion->bytewidth();
+				cached.endian = memregion->endianness();
+				cached.identities.assign(m_identities.begin() + files->second.first, m_identities.begin() + files->second.second);
+				cached.data.assign(memregion->base(), memregion->base() + memregion->bytes());
+			}
+
+			if (ROMREGION_ISROMDATA(region) && machine().options().rom_share())
+				region_share(memregion);
+		}
+
+	if (m_restart)
+	{
+		if (!m_warnings && !m_errors)
+			m_restart->m_trusted.insert(m_identities.begin(), m_identities.end());
+		if (m_restart->m_restarts++)
+			osd_printf_verbose("Fast restart: %d of %d ROM regions reused\n", int(reused.size()), int(reused.size() + loaded.size()));
+	}
 
 	// and finally register all per-game parameters
 	for (device_t &device : deviter)
@@ -1553,7 +1871,7 @@ void rom_load_manager::process_region_list()
     images associated with the given machine
 -------------------------------------------------*/
 
-rom_load_manager::rom_load_manager(running_machine &machine)
+rom_load_manager::rom_load_manager(running_machine &machine, std::set<std::string> &&trusted)
 	: m_machine(machine)
 	, m_warnings(0)
 	, m_knownbad(0)
@@ -1563,9 +1881,18 @@ rom_load_manager::rom_load_manager(running_machine &machine)
 	, m_romsloadedsize(0)
 	, m_romstotalsize(0)
 	, m_chd_list()
+	, m_prefetch_queue(nullptr)
 	, m_errorstring()
 	, m_softwarningstring()
+	, m_trusted(std::move(trusted))
+	, m_identify(!m_trusted.empty() || *machine.options().warm_state() || machine.options().fast_restart())
+	, m_trustedcount(0)
+	, m_restart(machine.options().fast_restart() ? &machine.manager().restart_cache() : nullptr)
 {
+	// files that verified before a hard reset needn't be hashed again
+	if (m_restart)
+		m_trusted.insert(m_restart->m_trusted.begin(), m_restart->m_trusted.end());
+
 	// figure out which BIOS we are using
 	std::map<std::string_view, std::string> card_bios;
 	for (device_t &device : device_enumerator(machine.config().root_device()))
@@ -1613,6 +1940,13 @@ rom_load_manager::rom_load_manager(running_machine &machine)
 }
 
 
+rom_load_manager::~rom_load_manager()
+{
+	if (m_prefetch_queue)
+		osd_work_queue_free(m_prefetch_queue);
+}
+
+
 // -------------------------------------------------
 // rom_build_entries - builds a rom_entry vector
 // from a tiny_rom_entry array
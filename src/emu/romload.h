@@ -17,7 +17,9 @@
 
 #include <functional>
 #include <initializer_list>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <string_view>
 #include <system_error>
@@ -381,6 +383,28 @@ public:
 TYPE DEFINITIONS
 ***************************************************************************/
 
+// ======================> rom_restart_cache
+
+// ROM regions as loaded for the last machine, kept by the machine manager
+// so a hard reset can copy them back instead of reading the files again
+class rom_restart_cache
+{
+public:
+	struct region
+	{
+		u8                          width;       // region width and endianness when loaded
+		endianness_t                endian;
+		std::vector<std::string>    identities;  // identities of the files loaded into it, in order
+		std::vector<u8>             data;        // contents after post-processing
+	};
+
+	std::string                     m_system;    // system and BIOS the regions were loaded for
+	std::set<std::string>           m_trusted;   // identities of files that verified
+	std::map<std::string, region>   m_regions;   // regions by full tag
+	unsigned                        m_restarts = 0;
+};
+
+
 // ======================> rom_load_manager
 
 class rom_load_manager
@@ -402,9 +426,12 @@ class rom_load_manager
 		chd_file    m_diffchd;  // handle to the diff CHD
 	};
 
+	struct file_prefetch;
+
 public:
-	// construction/destruction
-	rom_load_manager(running_machine &machine);
+	// construction/destruction; trusted files are not hashed again (see emu_file::identity)
+	rom_load_manager(running_machine &machine, std::set<std::string> &&trusted = std::set<std::string>());
+	~rom_load_manager();
 
 	// getters
 	running_machine &machine() const { return m_machine; }
@@ -417,6 +444,10 @@ public:
 	/* return the number of BAD_DUMP/NO_DUMP warnings we generated */
 	int knownbad() const { return m_knownbad; }
 
+	/* identities of the ROM files loaded, if any were trusted or asked for */
+	const std::vector<std::string> &identities() const { return m_identities; }
+	int trusted() const { return m_trustedcount; }
+
 	/* ----- disk handling ----- */
 
 	/* return a pointer to the CHD file associated with the given region */
@@ -442,13 +473,14 @@ private:
 	void fill_random(u8 *base, u32 length);
 	void handle_missing_file(const rom_entry *romp, const std::vector<std::string> &tried_file_names, std::error_condition chderr);
 	void dump_wrong_and_correct_checksums(const util::hash_collection &hashes, const util::hash_collection &acthashes);
-	void verify_length_and_hash(emu_file *file, std::string_view name, u32 explength, const util::hash_collection &hashes);
+	void verify_length_and_hash(emu_file *file, std::string_view name, u32 explength, const util::hash_collection &hashes, bool trusted);
 	void display_loading_rom_message(const char *name, bool from_list);
 	void display_rom_load_results(bool from_list);
 	void region_post_process(memory_region *region, bool invert);
+	void region_share(memory_region *region);
+	static void *prefetch_rom_file(void *param, int threadid);
 	std::unique_ptr<emu_file> open_rom_file(
-			const std::vector<std::string> &searchpath,
-			const rom_entry *romp,
+			file_prefetch &prefetch,
 			std::vector<std::string> &tried_file_names,
 			bool from_list);
 	std::unique_ptr<emu_file> open_rom_file(
@@ -460,6 +492,7 @@ private:
 			std::error_condition &filerr);
 	int rom_fread(emu_file *file, u8 *buffer, int length, const rom_entry *parent_region);
 	int read_rom_data(emu_file *file, memory_region &region, const rom_entry *parent_region, const rom_entry *romp);
+	bool map_rom_data(emu_file &file, memory_region &region, const rom_entry *parent_region, const rom_entry *romp);
 	void fill_rom_data(memory_region &region, const rom_entry *romp);
 	void copy_rom_data(memory_region &region, const rom_entry *romp);
 	void process_rom_entries(
@@ -481,6 +514,7 @@ private:
 			std::function<const rom_entry * ()> next_parent,
 			const chd_file::open_parent_func &open_parent);
 	void normalize_flags_for_device(std::string_view rgntag, u8 &width, endianness_t &endian);
+	bool reuse_region(const rom_restart_cache::region &cached, const std::vector<std::string> &searchpath, u8 bios, memory_region &region, const rom_entry *romp);
 	void process_region_list();
 
 	// internal state
@@ -496,9 +530,16 @@ private:
 	u64                 m_romstotalsize;      // total size of ROMs to read
 
 	std::vector<std::unique_ptr<open_chd>> m_chd_list;     /* disks */
+	osd_work_queue *    m_prefetch_queue;     // queue for opening and hashing ROM files ahead of loading
 
 	std::string         m_errorstring;        // error string
 	std::string         m_softwarningstring;  // software warning string
+
+	std::set<std::string> m_trusted;          // identities of files known to verify
+	bool                m_identify;           // whether to record file identities
+	std::vector<std::string> m_identities;    // identities of the files loaded
+	int                 m_trustedcount;       // files loaded without hashing
+	rom_restart_cache * m_restart;            // regions kept across hard resets, if enabled
 };
 
 
@@ -12,14 +12,24 @@
 
     00..07  'MAMESAVE'
     08      Format version (this is format 2)
-    09      Flags
+    09      Flags (0x02 = MSB first, 0x04 = zstd compressed)
     0A..1B  Game name padded with \0
     1C..1F  Signature
-    20..end Save game data (compressed)
+    20..end Save game data (zlib or zstd compressed)
 
     Data is always written as native-endian.
     Data is converted from the endiannness it was written upon load.
 
+    Warm start manifest format (text, one item per line):
+
+    'mamewarmstate 1'
+    System name
+    One identity per ROM file, as given by emu_file::identity
+
+    A manifest sits beside a warm start state and lists the ROM files
+    that passed verification when it was written.  Files whose identity
+    is unchanged are trusted without being hashed again.
+
 ***************************************************************************/
 
 #include "emu.h"
@@ -31,6 +41,10 @@
 #include "util/ioprocs.h"
 #include "util/ioprocsfilter.h"
 
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -49,14 +63,21 @@
 const int SAVE_VERSION      = 2;
 const int HEADER_SIZE       = 32;
 
+// granularity for only copying the changed parts of large items
+const size_t SAVE_PAGE_SIZE = 4096;
+
 // Available flags
 enum
 {
-	SS_MSB_FIRST = 0x02
+	SS_MSB_FIRST = 0x02,
+	SS_ZSTD      = 0x04
 };
 
 #define STATE_MAGIC_NUM         "MAMESAVE"
 
+// identifies the first line of a warm start manifest
+char const MANIFEST_SIGNATURE[] = "mamewarmstate 1";
+
 //**************************************************************************
 //  INITIALIZATION
 //**************************************************************************
@@ -262,30 +283,102 @@ void save_manager::dispatch_presave()
 
 save_error save_manager::write_file(util::core_file &file)
 {
-	util::write_stream::ptr writer;
-	save_error err = do_write(
-			[] (size_t total_size) { return true; },
-			[&writer] (const void *data, size_t size)
-			{
-				size_t written;
-				std::error_condition filerr = writer->write(data, size, written);
-				return !filerr && (size == written);
-			},
-			[&file, &writer] ()
+	// take a snapshot first, then compress it
+	std::vector<u8> data;
+	try { data.resize(ram_state::get_size(*this)); }
+	catch (std::bad_alloc const &) { return STATERR_WRITE_ERROR; }
+	save_error const err = write_buffer(data.data(), data.size());
+	if (STATERR_NONE != err)
+		return err;
+	return write_file(file, data.data(), data.size());
+}
+
+
+//-------------------------------------------------
+//  write_file - writes a snapshot made with
+//  write_buffer to a file; this doesn't touch
+//  the machine, so it may be called on a worker
+//  thread
+//-------------------------------------------------
+
+save_error save_manager::write_file(util::core_file &file, const void *buf, size_t size)
+{
+	if (HEADER_SIZE > size)
+		return STATERR_WRITE_ERROR;
+
+	// the header is written uncompressed and flags the data as zstd
+	u8 header[HEADER_SIZE];
+	memcpy(header, buf, HEADER_SIZE);
+	header[9] |= SS_ZSTD;
+
+	if (file.seek(0, SEEK_SET))
+		return STATERR_WRITE_ERROR;
+	size_t written;
+	std::error_condition filerr = file.write(header, HEADER_SIZE, written);
+	if (filerr || (HEADER_SIZE != written))
+		return STATERR_WRITE_ERROR;
+
+	util::write_stream::ptr writer = util::zstd_write(file, 3, 16384);
+	if (!writer)
+		return STATERR_WRITE_ERROR;
+	filerr = writer->write(reinterpret_cast<const u8 *>(buf) + HEADER_SIZE, size - HEADER_SIZE, written);
+	if (filerr || ((size - HEADER_SIZE) != written))
+		return STATERR_WRITE_ERROR;
+	return writer->finalize() ? STATERR_WRITE_ERROR : STATERR_NONE;
+}
+
+
+//-------------------------------------------------
+//  read_manifest - read the ROM file identities
+//  from a warm start manifest, failing if it is
+//  for a different system
+//-------------------------------------------------
+
+bool save_manager::read_manifest(util::core_file &file, std::string_view system, std::vector<std::string> &identities)
+{
+	identities.clear();
+
+	char buffer[4096];
+	auto const next_line =
+			[&file, &buffer] (std::string_view &line)
 			{
-				if (file.seek(0, SEEK_SET))
+				if (!file.gets(buffer, std::size(buffer)))
 					return false;
-				util::core_file::ptr proxy;
-				std::error_condition filerr = util::core_file::open_proxy(file, proxy);
-				writer = std::move(proxy);
-				return !filerr && writer;
-			},
-			[&file, &writer] ()
-			{
-				writer = util::zlib_write(file, 6, 16384);
-				return bool(writer);
-			});
-	return (STATERR_NONE != err) ? err : writer->finalize() ? STATERR_WRITE_ERROR : STATERR_NONE;
+				line = buffer;
+				while (!line.empty() && ((line.back() == '\n') || (line.back() == '\r')))
+					line.remove_suffix(1);
+				return true;
+			};
+
+	std::string_view line;
+	if (file.seek(0, SEEK_SET) || !next_line(line) || (line != MANIFEST_SIGNATURE))
+		return false;
+	if (!next_line(line) || (line != system))
+		return false;
+	while (next_line(line))
+	{
+		if (!line.empty())
+			identities.emplace_back(line);
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  write_manifest - write the ROM file
+//  identities for a warm start
+//-------------------------------------------------
+
+save_error save_manager::write_manifest(util::core_file &file, std::string_view system, const std::vector<std::string> &identities)
+{
+	if (file.seek(0, SEEK_SET) || (file.printf("%s\n%s\n", MANIFEST_SIGNATURE, system) < 0))
+		return STATERR_WRITE_ERROR;
+	for (std::string const &identity : identities)
+	{
+		if (file.printf("%s\n", identity) < 0)
+			return STATERR_WRITE_ERROR;
+	}
+	return STATERR_NONE;
 }
 
 
@@ -315,7 +408,15 @@ save_error save_manager::read_file(util::core_file &file)
 			},
 			[&file, &reader] ()
 			{
-				reader = util::zlib_read(file, 16384);
+				// peek at the flags to see which decompressor the data needs
+				u8 flags;
+				size_t actual;
+				if (file.seek(9, SEEK_SET) || file.read(&flags, 1, actual) || (1 != actual) || file.seek(HEADER_SIZE, SEEK_SET))
+					return false;
+				if (flags & SS_ZSTD)
+					reader = util::zstd_read(file, 16384);
+				else
+					reader = util::zlib_read(file, 16384);
 				return bool(reader);
 			});
 }
@@ -377,6 +478,37 @@ save_error save_manager::write_buffer(void *buf, size_t size)
 }
 
 
+//-------------------------------------------------
+//  write_buffer - update a buffer holding an
+//  earlier state of this machine, only copying
+//  the pages that changed since
+//-------------------------------------------------
+
+save_error save_manager::write_buffer(void *buf, size_t size, size_t &copied)
+{
+	copied = 0;
+	return do_write(
+			[size] (size_t total_size) { return size == total_size; },
+			[ptr = reinterpret_cast<u8 *>(buf), &copied] (const void *data, size_t size) mutable
+			{
+				const u8 *const src = reinterpret_cast<const u8 *>(data);
+				for (size_t offs = 0; offs < size; offs += SAVE_PAGE_SIZE)
+				{
+					const size_t chunk = std::min(SAVE_PAGE_SIZE, size - offs);
+					if (memcmp(ptr + offs, src + offs, chunk))
+					{
+						memcpy(ptr + offs, src + offs, chunk);
+						copied += chunk;
+					}
+				}
+				ptr += size;
+				return true;
+			},
+			[] () { return true; },
+			[] () { return true; });
+}
+
+
 //-------------------------------------------------
 //  read_buffer - restore the machine state from a
 //  buffer
@@ -401,6 +533,48 @@ save_error save_manager::read_buffer(const void *buf, size_t size)
 }
 
 
+//-------------------------------------------------
+//  read_buffer - restore the machine state from a
+//  buffer, only copying the pages that differ
+//  from the current state
+//-------------------------------------------------
+
+save_error save_manager::read_buffer(const void *buf, size_t size, size_t &copied)
+{
+	// data that needs flipping can't be compared
+	const u8 *ptr = reinterpret_cast<const u8 *>(buf);
+	if ((HEADER_SIZE <= size) && ((ptr[9] & SS_MSB_FIRST) != NATIVE_ENDIAN_VALUE_LE_BE(0, SS_MSB_FIRST)))
+	{
+		copied = size;
+		return read_buffer(buf, size);
+	}
+
+	const u8 *const end = ptr + size;
+	copied = 0;
+	return do_read(
+			[size] (size_t total_size) { return size == total_size; },
+			[&ptr, &end, &copied] (void *data, size_t size) -> bool
+			{
+				if ((ptr + size) > end)
+					return false;
+				u8 *const dst = reinterpret_cast<u8 *>(data);
+				for (size_t offs = 0; offs < size; offs += SAVE_PAGE_SIZE)
+				{
+					const size_t chunk = std::min(SAVE_PAGE_SIZE, size - offs);
+					if (memcmp(dst + offs, ptr + offs, chunk))
+					{
+						memcpy(dst + offs, ptr + offs, chunk);
+						copied += chunk;
+					}
+				}
+				ptr += size;
+				return true;
+			},
+			[] () { return true; },
+			[] () { return true; });
+}
+
+
 //-------------------------------------------------
 //  do_write - serialisation logic
 //-------------------------------------------------
@@ -602,14 +776,10 @@ save_manager::state_callback::state_callback(save_prepost_delegate callback)
 ram_state::ram_state(save_manager &save)
 	: m_save(save)
 	, m_data()
+	, m_copied(0)
 	, m_valid(false)
 	, m_time(m_save.machine().time())
 {
-	m_data.reserve(get_size(save));
-	m_data.clear();
-	m_data.rdbuf()->clear();
-	m_data.seekp(0);
-	m_data.seekg(0);
 }
 
 
@@ -631,17 +801,28 @@ size_t ram_state::get_size(save_manager &save)
 
 //-------------------------------------------------
 //  save - write the current machine state to the
-//  allocated stream
+//  buffer, only copying what changed if it holds
+//  an earlier state
 //-------------------------------------------------
 
 save_error ram_state::save()
 {
 	// initialize
 	m_valid = false;
-	m_data.seekp(0);
+	const size_t size = get_size(m_save);
 
 	// get the save manager to write state
-	const save_error err = m_save.write_stream(m_data);
+	save_error err;
+	if (m_data.size() == size)
+	{
+		err = m_save.write_buffer(m_data.data(), size, m_copied);
+	}
+	else
+	{
+		m_data.resize(size);
+		m_copied = size;
+		err = m_save.write_buffer(m_data.data(), size);
+	}
 	if (err != STATERR_NONE)
 		return err;
 
@@ -655,23 +836,184 @@ save_error ram_state::save()
 
 //-------------------------------------------------
 //  load - restore the machine state from the
-//  stream
+//  buffer, only copying what differs from the
+//  current state
 //-------------------------------------------------
 
 save_error ram_state::load()
 {
-	// initialize
-	m_data.seekg(0);
-
 	// if we have illegal registrations, return an error
 	if (m_save.m_illegal_regs > 0)
 		return STATERR_ILLEGAL_REGISTRATIONS;
 
 	// get the save manager to load state
-	return m_save.read_stream(m_data);
+	return m_save.read_buffer(m_data.data(), m_data.size(), m_copied);
+}
+
+
+//-------------------------------------------------
+//  state hash helpers - each page is hashed a
+//  machine word at a time, and the page hashes
+//  are summed so a changed page can be swapped
+//  out without touching the others
+//-------------------------------------------------
+
+namespace {
+
+constexpr u64 HASH_PRIME1 = 0x9e3779b185ebca87U;
+constexpr u64 HASH_PRIME2 = 0xc2b2ae3d27d4eb4fU;
+
+inline u64 hash_mix(u64 hash, u64 word)
+{
+	return rotl_64(hash ^ (word * HASH_PRIME2), 31) * HASH_PRIME1;
+}
+
+u64 hash_page(const u8 *data, size_t size, size_t index)
+{
+	u64 hash = (u64(index) + 1) * HASH_PRIME1;
+	size_t offs = 0;
+	for ( ; (offs + sizeof(u64)) <= size; offs += sizeof(u64))
+	{
+		u64 word;
+		std::memcpy(&word, data + offs, sizeof(word));
+		hash = hash_mix(hash, word);
+	}
+	if (offs < size)
+	{
+		u64 word = 0;
+		std::memcpy(&word, data + offs, size - offs);
+		hash = hash_mix(hash, word);
+	}
+	hash = hash_mix(hash, size);
+
+	// spread every input bit over the whole result, so the sum stays sensitive to all of them
+	hash ^= hash >> 33;
+	hash *= HASH_PRIME2;
+	hash ^= hash >> 29;
+	hash *= HASH_PRIME1;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+} // anonymous namespace
+
+
+//-------------------------------------------------
+//  state_hasher - constructor
+//-------------------------------------------------
+
+state_hasher::state_hasher(save_manager &save)
+	: m_save(save)
+	, m_hash(0)
+	, m_hashed(0)
+{
 }
 
 
+//-------------------------------------------------
+//  update - bring the hash up to date with the
+//  current machine state, only hashing the pages
+//  that changed since the last update
+//-------------------------------------------------
+
+save_error state_hasher::update()
+{
+	// a different layout means starting again
+	const size_t size = ram_state::get_size(m_save);
+	const bool fresh = m_data.size() != size;
+	if (fresh)
+	{
+		m_data.assign(size, 0);
+		m_pages.clear();
+		m_hash = 0;
+	}
+
+	m_hashed = 0;
+	size_t page = 0;
+	size_t position = 0;
+	const save_error err = m_save.do_write(
+			[size] (size_t total_size) { return size == total_size; },
+			[this, fresh, &page, &position] (const void *data, size_t size)
+			{
+				const u8 *const src = reinterpret_cast<const u8 *>(data);
+				for (size_t offs = 0; offs < size; offs += SAVE_PAGE_SIZE, page++)
+				{
+					const size_t chunk = std::min(SAVE_PAGE_SIZE, size - offs);
+					u8 *const dst = &m_data[position + offs];
+					if (fresh)
+						m_pages.push_back(0);
+					else if (!memcmp(dst, src + offs, chunk))
+						continue;
+					memcpy(dst, src + offs, chunk);
+					const u64 hash = hash_page(dst, chunk, page);
+					m_hash += hash - m_pages[page];
+					m_pages[page] = hash;
+					m_hashed += chunk;
+				}
+				position += size;
+				return true;
+			},
+			[] () { return true; },
+			[] () { return true; });
+
+	// don't compare against a partial state next time
+	if (err != STATERR_NONE)
+	{
+		m_data.clear();
+		m_pages.clear();
+		m_hash = 0;
+	}
+	return err;
+}
+
+
+//-------------------------------------------------
+//  rewind delta helpers - the differences against
+//  a keyframe are searched for a machine word at
+//  a time, so capturing stays cheap even for
+//  machines with many megabytes of state
+//-------------------------------------------------
+
+namespace {
+
+// identical words needed to end a run of changed bytes
+constexpr size_t REWIND_MIN_GAP = 2;
+
+// changes bigger than this fraction of the state start a new keyframe
+constexpr size_t REWIND_KEYFRAME_RATIO = 4;
+
+inline u64 rewind_word(const u8 *data, size_t word)
+{
+	u64 result;
+	std::memcpy(&result, data + word * sizeof(u64), sizeof(result));
+	return result;
+}
+
+void rewind_put_count(std::vector<u8> &delta, size_t count)
+{
+	while (count >= 0x80)
+	{
+		delta.push_back(u8(count) | 0x80);
+		count >>= 7;
+	}
+	delta.push_back(u8(count));
+}
+
+size_t rewind_get_count(const u8 *&src)
+{
+	size_t count = 0;
+	for (unsigned shift = 0; ; shift += 7)
+	{
+		const u8 byte = *src++;
+		count |= size_t(byte & 0x7f) << shift;
+		if (!(byte & 0x80))
+			return count;
+	}
+}
+
+} // anonymous namespace
+
+
 //-------------------------------------------------
 //  rewinder - constuctor
 //-------------------------------------------------
@@ -733,9 +1075,13 @@ void rewinder::invalidate()
 		// all states starting from the current one will be invalid
 		m_first_invalid_index = m_current_index;
 
-		// actually invalidate
+		// actually invalidate, and release the memory they use
 		for (auto it = m_state_list.begin() + m_first_invalid_index; it < m_state_list.end(); ++it)
-			it->get()->m_valid = false;
+		{
+			it->m_valid = false;
+			it->m_keyframe.reset();
+			it->m_delta = std::vector<u8>();
+		}
 	}
 }
 
@@ -753,45 +1099,42 @@ bool rewinder::capture()
 		return false;
 	}
 
+	// get the save manager to write state
+	if (!m_scratch)
+		m_scratch = std::make_unique<ram_state>(m_save);
+	const save_error error = m_scratch->save();
+	if (error != STATERR_NONE)
+	{
+		// internal error, complain and evacuate
+		report_error(error, rewind_operation::SAVE);
+		return false;
+	}
+
+	s32 newest;
 	if (current_index_is_last())
 	{
 		// we need to create a new state
-		std::unique_ptr<ram_state> state = std::make_unique<ram_state>(m_save);
-		const save_error error = state->save();
-
-		// validate the state
-		if (error == STATERR_NONE)
-			// it's safe to append
-			m_state_list.push_back(std::move(state));
-		else
-		{
-			// internal error, complain and evacuate
-			report_error(error, rewind_operation::SAVE);
-			return false;
-		}
+		m_state_list.emplace_back();
+		newest = m_state_list.size() - 1;
 	}
 	else
 	{
-		// invalidate the future states
+		// invalidate the future states and update the existing one
 		invalidate();
+		newest = m_current_index;
+	}
 
-		// update the existing state
-		ram_state *state = m_state_list.at(m_current_index).get();
-		const save_error error = state->save();
-
-		// validate the state
-		if (error != STATERR_NONE)
-		{
-			// internal error, complain and evacuate
-			report_error(error, rewind_operation::SAVE);
-			return false;
-		}
+	rewind_state &state = m_state_list[newest];
+	compress(state);
+	state.m_valid = true;
+	if (VERBOSE)
+	{
+		m_save.machine().logerror("Rewind: captured state %d, %u of %u bytes copied, %u bytes of changes\n",
+				newest + 1, unsigned(m_scratch->copied()), unsigned(m_scratch->m_data.size()), unsigned(state.m_delta.size()));
 	}
 
-	// make sure we will fit in
-	if (!check_size())
-		// the list keeps growing
-		m_current_index++;
+	// the list keeps growing, unless old states had to make room
+	m_current_index += 1 - check_size(newest);
 
 	// update first invalid index
 	if (current_index_is_last())
@@ -830,11 +1173,17 @@ bool rewinder::step()
 	if (m_first_invalid_index > REWIND_INDEX_NONE && m_current_index > m_first_invalid_index)
 		m_current_index = m_first_invalid_index;
 
-	// step back and obtain the state pointer
-	ram_state *state = m_state_list.at(--m_current_index).get();
+	// step back and rebuild the state
+	const rewind_state &state = m_state_list.at(--m_current_index);
+	if (!m_scratch)
+		m_scratch = std::make_unique<ram_state>(m_save);
+	decompress(state);
+
+	// captures from here on are based on the same keyframe
+	m_keyframe = state.m_keyframe;
 
 	// try to load and report the result
-	const save_error error = state->load();
+	const save_error error = m_scratch->load();
 	report_error(error, rewind_operation::LOAD);
 
 	if (error == save_error::STATERR_NONE)
@@ -845,64 +1194,188 @@ bool rewinder::step()
 
 
 //-------------------------------------------------
-//  check_size - shrink the state list if it is
-//  about to hit the capacity. returns true if
-//  the list got shrank
+//  compress - store the state just written to the
+//  scratch buffer, either as the changes against
+//  the current keyframe or as a new keyframe
 //-------------------------------------------------
 
-bool rewinder::check_size()
+void rewinder::compress(rewind_state &state)
 {
-	if (!m_enabled)
-		return false;
+	const std::vector<u8> &data = m_scratch->m_data;
+	const size_t size = data.size();
 
-	// state sizes in bytes
-	const size_t singlesize = ram_state::get_size(m_save);
-	size_t totalsize = m_state_list.size() * singlesize;
+	state.m_delta.clear();
+	if (m_keyframe && (m_keyframe->size() == size))
+	{
+		const u8 *const cur = data.data();
+		const u8 *const key = m_keyframe->data();
+		const size_t words = size / sizeof(u64);
+		const size_t total = (size + sizeof(u64) - 1) / sizeof(u64);
+		const size_t limit = size / REWIND_KEYFRAME_RATIO;
+
+		auto const same =
+			[cur, key, size, words] (size_t word)
+			{
+				if (word < words)
+					return rewind_word(cur, word) == rewind_word(key, word);
+				const size_t offset = word * sizeof(u64);
+				return !std::memcmp(cur + offset, key + offset, size - offset);
+			};
+
+		size_t last = 0;
+		size_t word = 0;
+		while (state.m_delta.size() <= limit)
+		{
+			// skip identical data, four words at a time while possible
+			while ((word + 4) <= words)
+			{
+				const u64 diff =
+						(rewind_word(cur, word + 0) ^ rewind_word(key, word + 0)) |
+						(rewind_word(cur, word + 1) ^ rewind_word(key, word + 1)) |
+						(rewind_word(cur, word + 2) ^ rewind_word(key, word + 2)) |
+						(rewind_word(cur, word + 3) ^ rewind_word(key, word + 3));
+				if (diff)
+					break;
+				word += 4;
+			}
+			while ((word < total) && same(word))
+				word++;
 
-	// convert our limit from megabytes
-	const size_t capsize = m_capacity * 1024 * 1024;
+			// reached the end, keep the changes
+			if (word == total)
+			{
+				state.m_delta.shrink_to_fit();
+				state.m_keyframe = m_keyframe;
+				return;
+			}
 
-	// safety check that shouldn't be allowed to trigger
-	if (totalsize > capsize)
-	{
-		// states to remove
-		const u32 count = (totalsize - capsize) / singlesize;
+			// find the end of the run, short identical stretches are included
+			const size_t start = word;
+			size_t end = ++word;
+			while ((word < total) && ((word - end) < REWIND_MIN_GAP))
+			{
+				if (!same(word))
+					end = word + 1;
+				word++;
+			}
 
-		// drop everything that's beyond capacity
-		m_state_list.erase(m_state_list.begin(), m_state_list.begin() + count);
+			// record it as (skip, length, bytes)
+			const size_t first = start * sizeof(u64);
+			const size_t stop = std::min(end * sizeof(u64), size);
+			rewind_put_count(state.m_delta, first - last);
+			rewind_put_count(state.m_delta, stop - first);
+			state.m_delta.insert(state.m_delta.end(), cur + first, cur + stop);
+			last = stop;
+		}
 	}
 
-	// update before new check
-	totalsize = m_state_list.size() * singlesize;
+	// no usable keyframe, or too many changes: this one becomes the keyframe
+	state.m_delta = std::vector<u8>();
+	m_keyframe = std::make_shared<const std::vector<u8>>(data);
+	state.m_keyframe = m_keyframe;
+}
+
 
-	// check if capacity will be hit by the newly captured state
-	if (totalsize + singlesize >= capsize)
+//-------------------------------------------------
+//  decompress - rebuild a state in the scratch
+//  buffer from its keyframe and changes
+//-------------------------------------------------
+
+void rewinder::decompress(const rewind_state &state)
+{
+	assert(state.m_keyframe);
+	std::vector<u8> &data = m_scratch->m_data;
+	data = *state.m_keyframe;
+
+	const u8 *src = state.m_delta.data();
+	const u8 *const end = src + state.m_delta.size();
+	size_t offset = 0;
+	while (src < end)
 	{
-		// check if we have spare states ahead
-		if (!current_index_is_last())
-			// no need to move states around
-			return false;
+		offset += rewind_get_count(src);
+		const size_t length = rewind_get_count(src);
+		assert((offset + length) <= data.size());
+		std::memcpy(&data[offset], src, length);
+		src += length;
+		offset += length;
+	}
+}
+
+
+//-------------------------------------------------
+//  state_size - memory used by a single state,
+//  counting a shared keyframe only once
+//-------------------------------------------------
+
+size_t rewinder::state_size(size_t index) const
+{
+	const rewind_state &state = m_state_list[index];
+	size_t size = state.m_delta.size();
+	if (state.m_keyframe && (!index || (state.m_keyframe != m_state_list[index - 1].m_keyframe)))
+		size += state.m_keyframe->size();
+	return size;
+}
+
+
+//-------------------------------------------------
+//  memory_bytes - memory used by all states and
+//  the scratch state
+//-------------------------------------------------
+
+size_t rewinder::memory_bytes() const
+{
+	size_t size = m_scratch ? m_scratch->bytes() : 0;
+	for (size_t index = 0; index < m_state_list.size(); index++)
+		size += state_size(index);
+	return size;
+}
+
+
+//-------------------------------------------------
+//  check_size - drop the oldest states if the
+//  list exceeds the capacity, but never the
+//  newest one. returns the number of states
+//  dropped
+//-------------------------------------------------
 
-		// we can now get the first state and invalidate it
-		std::unique_ptr<ram_state> first(std::move(m_state_list.front()));
-		first->m_valid = false;
+s32 rewinder::check_size(s32 newest)
+{
+	if (!m_enabled)
+		return 0;
+
+	// actual memory used by the states
+	size_t totalsize = 0;
+	for (size_t i = 0; i < m_state_list.size(); i++)
+		totalsize += state_size(i);
 
-		// move it to the end for future use
-		m_state_list.push_back(std::move(first));
-		m_state_list.erase(m_state_list.begin());
+	// convert our limit from megabytes
+	const size_t capsize = m_capacity * 1024 * 1024;
+
+	// a keyframe is only freed when the next state doesn't share it
+	s32 count = 0;
+	while ((totalsize > capsize) && (count < newest))
+	{
+		const rewind_state &state = m_state_list[count];
+		totalsize -= state.m_delta.size();
+		if (state.m_keyframe && (state.m_keyframe != m_state_list[count + 1].m_keyframe))
+			totalsize -= state.m_keyframe->size();
+		count++;
+	}
+
+	if (count)
+	{
+		m_state_list.erase(m_state_list.begin(), m_state_list.begin() + count);
 
 		if (m_first_time_note)
 		{
 			m_save.machine().logerror("Rewind note: Capacity has been reached. Old savestates will be erased.\n");
 			m_save.machine().logerror("Capacity: %d bytes. Savestate size: %d bytes. Savestate count: %d.\n",
-				totalsize, singlesize, m_state_list.size());
+				totalsize, m_scratch->m_data.size(), m_state_list.size());
 			m_first_time_note = false;
 		}
-
-		return true;
 	}
 
-	return false;
+	return count;
 }
 
 
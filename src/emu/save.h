@@ -21,6 +21,7 @@
 #include <cassert>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -90,6 +91,7 @@ typedef named_delegate<void ()> save_prepost_delegate;
 
 class ram_state;
 class rewinder;
+class state_hasher;
 
 class save_manager
 {
@@ -144,6 +146,7 @@ class save_manager
 
 	friend class ram_state;
 	friend class rewinder;
+	friend class state_hasher;
 
 public:
 	// stuff to allow STRUCT_MEMBER to work with pointers
@@ -302,13 +305,20 @@ public:
 	// file processing
 	static save_error check_file(running_machine &machine, util::core_file &file, const char *gamename, void (CLIB_DECL *errormsg)(const char *fmt, ...));
 	save_error write_file(util::core_file &file);
+	static save_error write_file(util::core_file &file, const void *buf, size_t size);
 	save_error read_file(util::core_file &file);
 
+	// warm start manifests, listing the ROM files that verified when a state was made
+	static bool read_manifest(util::core_file &file, std::string_view system, std::vector<std::string> &identities);
+	static save_error write_manifest(util::core_file &file, std::string_view system, const std::vector<std::string> &identities);
+
 	save_error write_stream(std::ostream &str);
 	save_error read_stream(std::istream &str);
 
 	save_error write_buffer(void *buf, size_t size);
 	save_error read_buffer(const void *buf, size_t size);
+	save_error write_buffer(void *buf, size_t size, size_t &copied);
+	save_error read_buffer(const void *buf, size_t size, size_t &copied);
 
 private:
 	// state callback item
@@ -344,8 +354,11 @@ private:
 
 class ram_state
 {
+	friend class rewinder;
+
 	save_manager &     m_save;                        // reference to save_manager
-	util::vectorstream m_data;                        // save data buffer
+	std::vector<u8>    m_data;                        // save data buffer
+	size_t             m_copied;                      // bytes copied by the last save or load
 
 public:
 	bool               m_valid;                       // can we load this state?
@@ -353,10 +366,27 @@ public:
 
 	ram_state(save_manager &save);
 	static size_t get_size(save_manager &save);
+	size_t copied() const { return m_copied; }
+	size_t bytes() const { return m_data.size(); }
 	save_error save();
 	save_error load();
 };
 
+class state_hasher
+{
+	save_manager &     m_save;                        // reference to save_manager
+	std::vector<u8>    m_data;                        // state the page hashes were taken from
+	std::vector<u64>   m_pages;                       // hash of each page, in the order they're written
+	u64                m_hash;                        // combined hash of every page
+	size_t             m_hashed;                      // bytes hashed by the last update
+
+public:
+	state_hasher(save_manager &save);
+	u64 hash() const { return m_hash; }
+	size_t hashed() const { return m_hashed; }
+	save_error update();
+};
+
 class rewinder
 {
 	save_manager & m_save;                            // reference to save_manager
@@ -366,7 +396,21 @@ class rewinder
 	s32            m_first_invalid_index;             // all states before this one are guarateed to be valid
 	bool           m_first_time_warning;              // keep track of warnings we report
 	bool           m_first_time_note;                 // keep track of notes
-	std::vector<std::unique_ptr<ram_state>> m_state_list; // rewinder's own ram states
+
+	// a captured state is stored as the runs of bytes that differ from a
+	// keyframe, which is a full copy of an earlier state; states captured
+	// in sequence share a keyframe until the differences grow too large
+	using keyframe_ptr = std::shared_ptr<const std::vector<u8>>;
+	struct rewind_state
+	{
+		keyframe_ptr    m_keyframe;                   // full state the changes apply to
+		std::vector<u8> m_delta;                      // (skip, length, bytes) records
+		bool            m_valid = false;              // can we load this state?
+	};
+
+	std::vector<rewind_state>  m_state_list;          // rewinder's own states
+	std::unique_ptr<ram_state> m_scratch;             // uncompressed state for saving and loading
+	keyframe_ptr               m_keyframe;            // keyframe for the next capture
 
 	// load/save management
 	enum class rewind_operation
@@ -381,13 +425,17 @@ class rewinder
 		REWIND_INDEX_FIRST
 	};
 
-	bool check_size();
+	s32 check_size(s32 newest);
+	size_t state_size(size_t index) const;
+	void compress(rewind_state &state);
+	void decompress(const rewind_state &state);
 	bool current_index_is_last() { return m_current_index == m_state_list.size() - 1; }
 	void report_error(save_error type, rewind_operation operation);
 
 public:
 	rewinder(save_manager &save);
 	bool enabled() { return m_enabled; }
+	size_t memory_bytes() const;
 	void clamp_capacity();
 	void invalidate();
 	bool capture();
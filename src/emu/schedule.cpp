@@ -10,6 +10,13 @@
 
 #include "emu.h"
 #include "debugger.h"
+#include "emuopts.h"
+#include "fileio.h"
+#include "pcprof.h"
+
+#include "corestr.h"
+
+#include <sstream>
 
 //**************************************************************************
 //  DEBUGGING
@@ -48,6 +55,8 @@ inline emu_timer::emu_timer() noexcept :
 	m_scheduler(nullptr),
 	m_next(nullptr),
 	m_prev(nullptr),
+	m_heap_index(NO_HEAP),
+	m_sequence(0),
 	m_param(0),
 	m_enabled(false),
 	m_temporary(false),
@@ -83,6 +92,7 @@ inline emu_timer &emu_timer::init(
 	m_scheduler = &machine.scheduler();
 	m_next = nullptr;
 	m_prev = nullptr;
+	m_heap_index = NO_HEAP;
 	m_callback = std::move(callback);
 	m_param = param;
 	m_temporary = temporary;
@@ -112,6 +122,7 @@ inline emu_timer &emu_timer::init(
 bool emu_timer::enable(bool enable) noexcept
 {
 	assert(m_scheduler);
+	auto const lock = m_scheduler->timer_lock();
 
 	// reschedule only if the state has changed
 	const bool old = m_enabled;
@@ -137,6 +148,7 @@ bool emu_timer::enable(bool enable) noexcept
 void emu_timer::adjust(attotime start_delay, s32 param, const attotime &period) noexcept
 {
 	assert(m_scheduler);
+	auto const lock = m_scheduler->timer_lock();
 
 	// if this is the callback timer, mark it modified
 	if (m_scheduler->m_callback_timer == this)
@@ -204,7 +216,7 @@ void emu_timer::register_save(save_manager &manager)
 	// determine our instance number - timers are indexed based on the callback function name
 	int index = 0;
 	std::string name = m_callback.name() ? m_callback.name() : "unnamed";
-	for (const emu_timer *curtimer = m_scheduler->first_timer(); curtimer; curtimer = curtimer->m_next)
+	for (const emu_timer *curtimer : m_scheduler->m_timer_heap)
 	{
 		if (!curtimer->m_temporary)
 		{
@@ -274,6 +286,8 @@ void emu_timer::dump() const
 //  DEVICE SCHEDULER
 //**************************************************************************
 
+thread_local device_execute_interface *device_scheduler::s_domain_device = nullptr;
+
 //-------------------------------------------------
 //  device_scheduler - constructor
 //-------------------------------------------------
@@ -283,25 +297,46 @@ device_scheduler::device_scheduler(running_machine &machine) :
 	m_executing_device(nullptr),
 	m_execute_list(nullptr),
 	m_basetime(attotime::zero),
-	m_timer_list(nullptr),
+	m_domain_queue(nullptr),
+	m_parallel_running(false),
+	m_serial(false),
+	m_never_timer(nullptr),
+	m_timer_sequence(0),
 	m_inactive_timers(nullptr),
+	m_stats{ 0, 0, 0, 0, 0, 0 },
+	m_stats_last{ 0, 0, 0, 0, 0, 0 },
+	m_stats_total{ 0, 0, 0, 0, 0, 0 },
+	m_stats_frames(0),
+	m_collect_timing(false),
 	m_callback_timer(nullptr),
 	m_callback_timer_modified(false),
 	m_callback_timer_expire_time(attotime::zero),
 	m_suspend_changes_pending(true),
-	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000)
+	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000),
+	m_adaptive_low(0),
+	m_adaptive_high(0),
+	m_adaptive_current(0),
+	m_adaptive_applied(0),
+	m_adaptive_since(attotime::zero),
+	m_adaptive_syncs(0)
 {
-	// append a single never-expiring timer so there is always one in the list
+	// add a single never-expiring timer so there is always one in the heap
 	// need to subvert it because it would naturally be inserted in the inactive list
-	m_timer_list = &timer_list_remove(m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), attotime::never, 0, true));
+	emu_timer &never = timer_list_remove(m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), attotime::never, 0, true));
+	m_timer_heap.push_back(&never);
+	never.m_heap_index = 0;
+	m_never_timer = &never;
 
-	assert(m_timer_list);
-	assert(!m_timer_list->m_prev);
-	assert(!m_timer_list->m_next);
+	assert(!never.m_prev);
+	assert(!never.m_next);
 	assert(!m_inactive_timers);
 
+	// the profiler's timer is allocated up front so it is part of the saved state
+	m_profiler = std::make_unique<pc_profiler>(*this);
+
 	// register global states
 	machine.save().save_item(NAME(m_basetime));
+	machine.save().save_item(NAME(m_adaptive_current));
 	machine.save().register_presave(save_prepost_delegate(FUNC(device_scheduler::presave), this));
 	machine.save().register_postload(save_prepost_delegate(FUNC(device_scheduler::postload), this));
 }
@@ -313,11 +348,15 @@ device_scheduler::device_scheduler(running_machine &machine) :
 
 device_scheduler::~device_scheduler()
 {
+	if (m_domain_queue)
+		osd_work_queue_free(m_domain_queue);
+	m_profiler.reset();
+
 	// remove all timers
 	while (m_inactive_timers)
 		m_timer_allocator.reclaim(timer_list_remove(*m_inactive_timers));
-	while (m_timer_list)
-		m_timer_allocator.reclaim(timer_list_remove(*m_timer_list));
+	while (!m_timer_heap.empty())
+		m_timer_allocator.reclaim(timer_list_remove(*m_timer_heap.back()));
 }
 
 
@@ -333,7 +372,8 @@ attotime device_scheduler::time() const noexcept
 
 	// if we're executing as a particular CPU, use its local time as a base
 	// otherwise, return the global base time
-	return (m_executing_device != nullptr) ? m_executing_device->local_time() : m_basetime;
+	device_execute_interface *const executing = currently_executing();
+	return (executing != nullptr) ? executing->local_time() : m_basetime;
 }
 
 
@@ -345,7 +385,7 @@ attotime device_scheduler::time() const noexcept
 bool device_scheduler::can_save() const
 {
 	// if any live temporary timers exit, fail
-	for (emu_timer *timer = m_timer_list; timer; timer = timer->m_next)
+	for (emu_timer *timer : m_timer_heap)
 	{
 		if (timer->m_temporary && !timer->expire().is_never())
 		{
@@ -384,6 +424,139 @@ inline void device_scheduler::apply_suspend_changes()
 }
 
 
+//-------------------------------------------------
+//  execute_device - run one device up to the
+//  target, pulling the target back if it stops
+//  early
+//-------------------------------------------------
+
+inline void device_scheduler::execute_device(device_execute_interface &exec, attotime &target, bool call_debugger)
+{
+	// only process if this CPU is executing or truly halted (not yielding)
+	// and if our target is later than the CPU's current time (coarse check)
+	if (EXPECTED((exec.m_suspend == 0 || exec.m_eatcycles) && target.seconds() >= exec.m_localtime.seconds()))
+	{
+		// compute how many attoseconds to execute this CPU
+		attoseconds_t delta = target.attoseconds() - exec.m_localtime.attoseconds();
+		if (delta < 0 && target.seconds() > exec.m_localtime.seconds())
+			delta += ATTOSECONDS_PER_SECOND;
+		assert(delta == (target - exec.m_localtime).as_attoseconds());
+
+		if (exec.m_attoseconds_per_cycle == 0)
+		{
+			exec.m_localtime = target;
+		}
+		// if we have enough for at least 1 cycle, do the math
+		else if (delta >= exec.m_attoseconds_per_cycle)
+		{
+			// compute how many cycles we want to execute
+			int ran = exec.m_cycles_running = divu_64x32(u64(delta) >> exec.m_divshift, exec.m_divisor);
+			LOG("  cpu '%s': %d (%d cycles)\n", exec.device().tag(), delta, exec.m_cycles_running);
+
+			// if we're not suspended, actually execute
+			if (exec.m_suspend == 0)
+			{
+				auto profile = g_profiler.start(exec.m_profiler, exec.device().tag());
+
+				// note that this global variable cycles_stolen can be modified
+				// via the call to cpu_execute
+				exec.m_cycles_stolen = 0;
+				exec.m_stats.m_runs++;
+				if (m_parallel_running)
+					s_domain_device = &exec;
+				else
+					m_executing_device = &exec;
+				*exec.m_icountptr = exec.m_cycles_running;
+				if (!call_debugger)
+					exec.run();
+				else
+				{
+					exec.debugger_start_cpu_hook(target);
+					exec.run();
+					exec.debugger_stop_cpu_hook();
+				}
+
+				// adjust for any cycles we took back
+				assert(ran >= *exec.m_icountptr);
+				ran -= *exec.m_icountptr;
+				assert(ran >= exec.m_cycles_stolen);
+				ran -= exec.m_cycles_stolen;
+				exec.m_stats.m_executed += ran;
+				exec.m_stats.m_stolen += exec.m_cycles_stolen;
+			}
+			else
+			{
+				exec.m_stats.m_eaten += ran;
+			}
+
+			// account for these cycles
+			exec.m_totalcycles += ran;
+
+			// update the local time for this CPU
+			attotime deltatime;
+			if (ran < exec.m_cycles_per_second)
+				deltatime = attotime(0, exec.m_attoseconds_per_cycle * ran);
+			else
+			{
+				u32 remainder;
+				s32 secs = divu_64x32_rem(ran, exec.m_cycles_per_second, remainder);
+				deltatime = attotime(secs, u64(remainder) * exec.m_attoseconds_per_cycle);
+			}
+			assert(deltatime >= attotime::zero);
+			exec.m_localtime += deltatime;
+			LOG("         %d ran, %d total, time = %s\n", ran, s32(exec.m_totalcycles), exec.m_localtime.as_string(PRECISION));
+
+			// if the new local CPU time is less than our target, move the target up, but not before the base
+			if (exec.m_localtime < target)
+			{
+				target = std::max(exec.m_localtime, m_basetime);
+				LOG("         (new target)\n");
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  execute_domain - run every device of a sync
+//  domain on the calling thread
+//-------------------------------------------------
+
+void *device_scheduler::execute_domain(void *param, int threadid)
+{
+	sync_domain &domain = *reinterpret_cast<sync_domain *>(param);
+	for (device_execute_interface *exec : domain.m_devices)
+		domain.m_scheduler->execute_device(*exec, domain.m_target, false);
+	s_domain_device = nullptr;
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  execute_domains - run domain 0 on this thread
+//  and the others on the work queue, then meet
+//  at the earliest point any of them reached
+//-------------------------------------------------
+
+attotime device_scheduler::execute_domains(const attotime &target)
+{
+	for (sync_domain &domain : m_domains)
+		domain.m_target = target;
+
+	m_parallel_running = true;
+	osd_work_item_queue_multiple(m_domain_queue, &device_scheduler::execute_domain, m_domains.size() - 1, &m_domains[1], sizeof(sync_domain), WORK_ITEM_FLAG_AUTO_RELEASE);
+	execute_domain(&m_domains[0], 0);
+	while (!osd_work_queue_wait(m_domain_queue, osd_ticks_per_second()))
+		;
+	m_parallel_running = false;
+
+	attotime result = target;
+	for (sync_domain const &domain : m_domains)
+		result = std::min(result, domain.m_target);
+	return result;
+}
+
+
 //-------------------------------------------------
 //  timeslice - execute all devices for a single
 //  timeslice
@@ -402,97 +575,32 @@ void device_scheduler::timeslice()
 		m_quantum_allocator.reclaim(m_quantum_list.detach_head());
 
 	// loop until we hit the next timer
-	while (m_basetime < m_timer_list->m_expire)
+	while (m_basetime < m_timer_heap.front()->m_expire)
 	{
 		// by default, assume our target is the end of the next quantum
 		attotime target(m_basetime + attotime(0, m_quantum_list.first()->m_actual));
 
 		// however, if the next timer is going to fire before then, override
-		if (m_timer_list->m_expire < target)
-			target = m_timer_list->m_expire;
+		if (m_timer_heap.front()->m_expire < target)
+			target = m_timer_heap.front()->m_expire;
 
 		LOG("------------------\n");
 		LOG("cpu_timeslice: target = %s\n", target.as_string(PRECISION));
+		m_stats.m_timeslices++;
 
 		// do we have pending suspension changes?
 		if (m_suspend_changes_pending)
 			apply_suspend_changes();
 
-		// loop over all CPUs
-		for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+		// run the sync domains side by side if there are several, otherwise loop over all CPUs
+		if (!m_domains.empty() && !m_serial && !call_debugger && !g_profiler.enabled())
 		{
-			// only process if this CPU is executing or truly halted (not yielding)
-			// and if our target is later than the CPU's current time (coarse check)
-			if (EXPECTED((exec->m_suspend == 0 || exec->m_eatcycles) && target.seconds() >= exec->m_localtime.seconds()))
-			{
-				// compute how many attoseconds to execute this CPU
-				attoseconds_t delta = target.attoseconds() - exec->m_localtime.attoseconds();
-				if (delta < 0 && target.seconds() > exec->m_localtime.seconds())
-					delta += ATTOSECONDS_PER_SECOND;
-				assert(delta == (target - exec->m_localtime).as_attoseconds());
-
-				if (exec->m_attoseconds_per_cycle == 0)
-				{
-					exec->m_localtime = target;
-				}
-				// if we have enough for at least 1 cycle, do the math
-				else if (delta >= exec->m_attoseconds_per_cycle)
-				{
-					// compute how many cycles we want to execute
-					int ran = exec->m_cycles_running = divu_64x32(u64(delta) >> exec->m_divshift, exec->m_divisor);
-					LOG("  cpu '%s': %d (%d cycles)\n", exec->device().tag(), delta, exec->m_cycles_running);
-
-					// if we're not suspended, actually execute
-					if (exec->m_suspend == 0)
-					{
-						auto profile = g_profiler.start(exec->m_profiler);
-
-						// note that this global variable cycles_stolen can be modified
-						// via the call to cpu_execute
-						exec->m_cycles_stolen = 0;
-						m_executing_device = exec;
-						*exec->m_icountptr = exec->m_cycles_running;
-						if (!call_debugger)
-							exec->run();
-						else
-						{
-							exec->debugger_start_cpu_hook(target);
-							exec->run();
-							exec->debugger_stop_cpu_hook();
-						}
-
-						// adjust for any cycles we took back
-						assert(ran >= *exec->m_icountptr);
-						ran -= *exec->m_icountptr;
-						assert(ran >= exec->m_cycles_stolen);
-						ran -= exec->m_cycles_stolen;
-					}
-
-					// account for these cycles
-					exec->m_totalcycles += ran;
-
-					// update the local time for this CPU
-					attotime deltatime;
-					if (ran < exec->m_cycles_per_second)
-						deltatime = attotime(0, exec->m_attoseconds_per_cycle * ran);
-					else
-					{
-						u32 remainder;
-						s32 secs = divu_64x32_rem(ran, exec->m_cycles_per_second, remainder);
-						deltatime = attotime(secs, u64(remainder) * exec->m_attoseconds_per_cycle);
-					}
-					assert(deltatime >= attotime::zero);
-					exec->m_localtime += deltatime;
-					LOG("         %d ran, %d total, time = %s\n", ran, s32(exec->m_totalcycles), exec->m_localtime.as_string(PRECISION));
-
-					// if the new local CPU time is less than our target, move the target up, but not before the base
-					if (exec->m_localtime < target)
-					{
-						target = std::max(exec->m_localtime, m_basetime);
-						LOG("         (new target)\n");
-					}
-				}
-			}
+			target = execute_domains(target);
+		}
+		else
+		{
+			for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+				execute_device(*exec, target, call_debugger);
 		}
 		m_executing_device = nullptr;
 
@@ -512,8 +620,9 @@ void device_scheduler::timeslice()
 
 void device_scheduler::abort_timeslice() noexcept
 {
-	if (m_executing_device != nullptr)
-		m_executing_device->abort_timeslice();
+	device_execute_interface *const executing = currently_executing();
+	if (executing != nullptr)
+		executing->abort_timeslice();
 }
 
 
@@ -523,6 +632,11 @@ void device_scheduler::abort_timeslice() noexcept
 
 void device_scheduler::trigger(int trigid, const attotime &after)
 {
+	{
+		auto const lock = timer_lock();
+		m_adaptive_syncs++;
+	}
+
 	// ensure we have a list of executing devices
 	if (m_execute_list == nullptr)
 		rebuild_execute_list();
@@ -603,6 +717,7 @@ void device_scheduler::perfect_quantum(const attotime &duration)
 
 emu_timer *device_scheduler::timer_alloc(timer_expired_delegate callback)
 {
+	auto const lock = timer_lock();
 	return &m_timer_allocator.alloc()->init(machine(), std::move(callback), attotime::never, 0, false);
 }
 
@@ -615,6 +730,7 @@ emu_timer *device_scheduler::timer_alloc(timer_expired_delegate callback)
 
 void device_scheduler::timer_set(const attotime &duration, timer_expired_delegate callback, s32 param)
 {
+	auto const lock = timer_lock();
 	[[maybe_unused]] emu_timer &timer = m_timer_allocator.alloc()->init(
 			machine(),
 			std::move(callback),
@@ -632,6 +748,8 @@ void device_scheduler::timer_set(const attotime &duration, timer_expired_delegat
 
 void device_scheduler::synchronize(timer_expired_delegate callback, s32 param)
 {
+	auto const lock = timer_lock();
+	m_adaptive_syncs++;
 	m_timer_allocator.alloc()->init(
 			machine(),
 			std::move(callback),
@@ -694,30 +812,38 @@ void device_scheduler::postload()
 		timer_list_remove(timer).m_next = private_list;
 		private_list = &timer;
 	}
-	while (m_timer_list->m_next)
+
+	// the loaded expiry times no longer match the heap order, so take the
+	// timers out directly rather than by position, keeping only our special
+	// never-expiring one
+	std::vector<emu_timer *> heap;
+	heap.swap(m_timer_heap);
+	for (emu_timer *timer : heap)
 	{
-		emu_timer &timer = *m_timer_list;
+		timer->m_heap_index = emu_timer::NO_HEAP;
+		if (timer == m_never_timer)
+			continue;
 
-		if (timer.m_temporary)
+		if (timer->m_temporary)
 		{
-			assert(!timer.expire().is_never());
-
-			// temporary timers go away entirely (except our special never-expiring one)
-			timer.m_callback.reset();
-			m_timer_allocator.reclaim(timer_list_remove(timer));
+			// temporary timers go away entirely
+			timer->m_callback.reset();
+			m_timer_allocator.reclaim(*timer);
 		}
 		else
 		{
 			// permanent ones get added to our private list
-			timer_list_remove(timer).m_next = private_list;
-			private_list = &timer;
+			timer->m_next = private_list;
+			private_list = timer;
 		}
 	}
 
-	// special dummy timer
-	assert(!m_timer_list->m_enabled);
-	assert(m_timer_list->m_temporary);
-	assert(m_timer_list->m_expire.is_never());
+	// start the heap again with just the special dummy timer
+	assert(!m_never_timer->m_enabled);
+	assert(m_never_timer->m_temporary);
+	assert(m_never_timer->m_expire.is_never());
+	m_timer_heap.push_back(m_never_timer);
+	m_never_timer->m_heap_index = 0;
 
 	// now re-insert them; this effectively re-sorts them by time
 	while (private_list)
@@ -730,6 +856,21 @@ void device_scheduler::postload()
 	m_suspend_changes_pending = true;
 	rebuild_execute_list();
 
+	// go back to the adaptive quantum the state was saved with, and measure
+	// from the loaded time, which may be earlier than where we were
+	if (m_adaptive_low != 0)
+	{
+		if (m_adaptive_current == 0)
+			m_adaptive_current = m_adaptive_applied;
+		const attoseconds_t quantum = std::clamp(m_adaptive_current, m_adaptive_low, m_adaptive_high);
+		if (quantum != m_adaptive_applied)
+			set_adaptive_quantum(quantum);
+		else
+			m_adaptive_current = quantum;
+		m_adaptive_since = m_basetime;
+		m_adaptive_syncs = 0;
+	}
+
 	// report the timer state after a log
 	LOG("After resetting/reordering timers:\n");
 #if VERBOSE
@@ -800,6 +941,24 @@ void device_scheduler::rebuild_execute_list()
 		if (exec)
 			min_quantum = (std::min)(attotime(0, exec->minimum_quantum()), min_quantum);
 
+		// an adaptive quantum starts from that and moves within the configured range
+		std::pair<attotime, attotime> const &adaptive = machine().config().adaptive_quantum();
+		if (!exec && !adaptive.second.is_zero())
+		{
+			const attotime high = machine().config().maximum_quantum(adaptive.second);
+			const attotime low = std::min(adaptive.first, high);
+			if (high.seconds() == 0 && !low.is_zero())
+			{
+				min_quantum = std::clamp(min_quantum, low, high);
+				m_adaptive_low = low.attoseconds();
+				m_adaptive_high = high.attoseconds();
+				m_adaptive_current = m_adaptive_applied = min_quantum.attoseconds();
+				m_adaptive_since = m_basetime;
+				m_adaptive_syncs = 0;
+				machine().logerror("Adaptive quantum: starting at %s, range %s to %s\n", min_quantum.as_string(), low.as_string(), high.as_string());
+			}
+		}
+
 		// inform the timer system of our decision
 		add_quantum(min_quantum, attotime::never);
 	}
@@ -831,48 +990,132 @@ void device_scheduler::rebuild_execute_list()
 
 	// append the suspend list to the end of the active list
 	*active_tailptr = suspend_list;
+
+	// group the list by sync domain, keeping the order within each group
+	m_domains.clear();
+	std::vector<int> ids;
+	for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+	{
+		const int id = exec->sync_domain();
+		auto const found = std::find(ids.begin(), ids.end(), id);
+		if (found == ids.end())
+		{
+			// domain 0 always runs on the emulation thread, so keep it first
+			auto const pos = (id == 0) ? ids.begin() : ids.end();
+			m_domains.insert(m_domains.begin() + (pos - ids.begin()), sync_domain{ this, { exec }, attotime::zero });
+			ids.insert(pos, id);
+		}
+		else
+		{
+			m_domains[found - ids.begin()].m_devices.push_back(exec);
+		}
+	}
+	if (ids.size() < 2 || ids[0] != 0)
+		m_domains.clear();
+	else if (!m_domain_queue)
+		m_domain_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
 }
 
 
 //-------------------------------------------------
-//  timer_list_insert - insert a new timer into
-//  the list at the appropriate location
+//  timer_lock - serialise changes to the timer
+//  lists while sync domains run in parallel
 //-------------------------------------------------
 
-inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
+inline std::unique_lock<std::recursive_mutex> device_scheduler::timer_lock()
 {
-	// disabled timers never expire
-	if (!timer.m_expire.is_never() && timer.m_enabled)
+	return m_parallel_running ? std::unique_lock<std::recursive_mutex>(m_timer_mutex) : std::unique_lock<std::recursive_mutex>();
+}
+
+
+//-------------------------------------------------
+//  timer_before - heap ordering: earlier expiry
+//  first, then earlier insertion
+//-------------------------------------------------
+
+inline bool device_scheduler::timer_before(const emu_timer &a, const emu_timer &b) noexcept
+{
+	if (a.m_expire != b.m_expire)
+		return a.m_expire < b.m_expire;
+	return a.m_sequence < b.m_sequence;
+}
+
+
+//-------------------------------------------------
+//  timer_heap_place - store a timer in a heap
+//  slot and remember where it went
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_place(emu_timer &timer, u32 index) noexcept
+{
+	m_timer_heap[index] = &timer;
+	timer.m_heap_index = index;
+}
+
+
+//-------------------------------------------------
+//  timer_heap_up - move a timer towards the front
+//  of the heap until its parent is earlier
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_up(u32 index) noexcept
+{
+	emu_timer &timer = *m_timer_heap[index];
+	while (index > 0)
 	{
-		// loop over the timer list
-		emu_timer *prevtimer = nullptr;
-		for (emu_timer *curtimer = m_timer_list; curtimer; prevtimer = curtimer, curtimer = curtimer->m_next)
-		{
-			// if the current list entry expires after us, we should be inserted before it
-			if (curtimer->m_expire > timer.m_expire)
-			{
-				// link the new guy in before the current list entry
-				timer.m_prev = prevtimer;
-				timer.m_next = curtimer;
+		const u32 parent = (index - 1) >> 1;
+		if (!timer_before(timer, *m_timer_heap[parent]))
+			break;
+		timer_heap_place(*m_timer_heap[parent], index);
+		index = parent;
+	}
+	timer_heap_place(timer, index);
+}
 
-				if (prevtimer)
-					prevtimer->m_next = &timer;
-				else
-					m_timer_list = &timer;
 
-				curtimer->m_prev = &timer;
-				return timer;
-			}
-		}
+//-------------------------------------------------
+//  timer_heap_down - move a timer towards the
+//  back of the heap until its children are later
+//-------------------------------------------------
 
-		// need to insert after the last one
-		if (prevtimer)
-			prevtimer->m_next = &timer;
-		else
-			m_timer_list = &timer;
+void device_scheduler::timer_heap_down(u32 index) noexcept
+{
+	const u32 count = m_timer_heap.size();
+	emu_timer &timer = *m_timer_heap[index];
+	while (true)
+	{
+		u32 child = (index << 1) + 1;
+		if (child >= count)
+			break;
+		if ((child + 1) < count && timer_before(*m_timer_heap[child + 1], *m_timer_heap[child]))
+			child++;
+		if (!timer_before(*m_timer_heap[child], timer))
+			break;
+		timer_heap_place(*m_timer_heap[child], index);
+		index = child;
+	}
+	timer_heap_place(timer, index);
+}
+
+
+//-------------------------------------------------
+//  timer_list_insert - insert a new timer into
+//  the heap, or the inactive list if it will
+//  never fire
+//-------------------------------------------------
+
+inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
+{
+	auto profile = g_profiler.start(PROFILER_TIMER_QUEUE);
+	m_stats.m_scheduled++;
 
-		timer.m_prev = prevtimer;
-		timer.m_next = nullptr;
+	// disabled timers never expire
+	if (!timer.m_expire.is_never() && timer.m_enabled)
+	{
+		// add at the back and let it rise to its place
+		timer.m_sequence = m_timer_sequence++;
+		m_timer_heap.push_back(&timer);
+		timer_heap_up(m_timer_heap.size() - 1);
 	}
 	else
 	{
@@ -891,19 +1134,36 @@ inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
 
 //-------------------------------------------------
 //  timer_list_remove - remove a timer from the
-//  linked list
+//  heap or the inactive list
 //-------------------------------------------------
 
 inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 {
-	// remove it from the list
-	if (timer.m_prev)
+	auto profile = g_profiler.start(PROFILER_TIMER_QUEUE);
+	m_stats.m_removed++;
+
+	if (timer.m_heap_index != emu_timer::NO_HEAP)
 	{
-		timer.m_prev->m_next = timer.m_next;
+		// fill the hole with the last timer and move that one up or down as needed
+		const u32 index = timer.m_heap_index;
+		emu_timer &last = *m_timer_heap.back();
+		m_timer_heap.pop_back();
+		timer.m_heap_index = emu_timer::NO_HEAP;
+		if (&last != &timer)
+		{
+			timer_heap_place(last, index);
+			if (index > 0 && timer_before(last, *m_timer_heap[(index - 1) >> 1]))
+				timer_heap_up(index);
+			else
+				timer_heap_down(index);
+		}
+		return timer;
 	}
-	else if (&timer == m_timer_list)
+
+	// remove it from the inactive list
+	if (timer.m_prev)
 	{
-		m_timer_list = timer.m_next;
+		timer.m_prev->m_next = timer.m_next;
 	}
 	else
 	{
@@ -924,13 +1184,13 @@ inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 
 inline void device_scheduler::execute_timers()
 {
-	LOG("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), m_timer_list->m_expire.as_string(PRECISION));
+	LOG("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), m_timer_heap.front()->m_expire.as_string(PRECISION));
 
 	// now process any timers that are overdue
-	while (m_timer_list->m_expire <= m_basetime)
+	while (m_timer_heap.front()->m_expire <= m_basetime)
 	{
 		// if this is a one-shot timer, disable it now
-		emu_timer &timer = *m_timer_list;
+		emu_timer &timer = *m_timer_heap.front();
 		bool was_enabled = timer.m_enabled;
 		if (timer.m_period.is_zero() || timer.m_period.is_never())
 			timer.m_enabled = false;
@@ -943,12 +1203,22 @@ inline void device_scheduler::execute_timers()
 		// call the callback
 		if (was_enabled)
 		{
-			auto profile = g_profiler.start(PROFILER_TIMER_CALLBACK);
+			auto profile = g_profiler.start(PROFILER_TIMER_CALLBACK, timer.m_callback.isnull() ? nullptr : timer.m_callback.name());
+			m_stats.m_fired++;
 
 			if (!timer.m_callback.isnull())
 			{
 				LOG("execute_timers: timer callback %s\n", timer.m_callback.name());
-				timer.m_callback(timer.m_param);
+				if (!m_collect_timing)
+				{
+					timer.m_callback(timer.m_param);
+				}
+				else
+				{
+					osd_ticks_t const start = osd_ticks();
+					timer.m_callback(timer.m_param);
+					m_stats.m_callback_ticks += osd_ticks() - start;
+				}
 			}
 		}
 
@@ -982,9 +1252,194 @@ void device_scheduler::dump_timers() const
 {
 	machine().logerror("=============================================\n");
 	machine().logerror("Timer Dump: Time = %15s\n", time().as_string(PRECISION));
-	for (emu_timer *timer = m_timer_list; timer; timer = timer->m_next)
+	machine().logerror("Last frame: %u scheduled, %u removed, %u fired\n", m_stats_last.m_scheduled, m_stats_last.m_removed, m_stats_last.m_fired);
+
+	// the heap is only partially ordered, so sort a copy for the dump
+	std::vector<emu_timer *> active(m_timer_heap);
+	std::sort(active.begin(), active.end(), [] (const emu_timer *a, const emu_timer *b) { return timer_before(*a, *b); });
+	for (emu_timer *timer : active)
 		timer->dump();
 	for (emu_timer *timer = m_inactive_timers; timer; timer = timer->m_next)
 		timer->dump();
 	machine().logerror("=============================================\n");
 }
+
+
+//-------------------------------------------------
+//  frame_update - start counting timer activity
+//  for a new frame
+//-------------------------------------------------
+
+void device_scheduler::frame_update()
+{
+	roll_stats();
+
+	if (m_adaptive_low != 0)
+		adapt_quantum();
+}
+
+
+//-------------------------------------------------
+//  roll_stats - close the current frame's
+//  statistics, for the scheduler and for each
+//  device, and add them to the totals
+//-------------------------------------------------
+
+void device_scheduler::roll_stats()
+{
+	for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+	{
+		device_execute_interface::execute_stats &frame = exec->m_stats;
+		device_execute_interface::execute_stats &total = exec->m_stats_total;
+		total.m_executed += frame.m_executed;
+		total.m_stolen += frame.m_stolen;
+		total.m_eaten += frame.m_eaten;
+		total.m_runs += frame.m_runs;
+		total.m_aborts += frame.m_aborts;
+		total.m_idled += frame.m_idled;
+		m_stats.m_aborts += frame.m_aborts;
+		exec->m_stats_last = frame;
+		frame = device_execute_interface::execute_stats{ 0, 0, 0, 0, 0, 0 };
+	}
+
+	m_stats_total.m_timeslices += m_stats.m_timeslices;
+	m_stats_total.m_aborts += m_stats.m_aborts;
+	m_stats_total.m_scheduled += m_stats.m_scheduled;
+	m_stats_total.m_removed += m_stats.m_removed;
+	m_stats_total.m_fired += m_stats.m_fired;
+	m_stats_total.m_callback_ticks += m_stats.m_callback_ticks;
+	m_stats_frames++;
+
+	m_stats_last = m_stats;
+	m_stats = schedule_stats{ 0, 0, 0, 0, 0, 0 };
+}
+
+
+//-------------------------------------------------
+//  write_stats - write the totals to the file
+//  named by -schedstats, as JSON if the name
+//  ends in .json and as CSV otherwise
+//-------------------------------------------------
+
+void device_scheduler::write_stats()
+{
+	// fold in the partial frame we stopped in
+	roll_stats();
+
+	std::string const name = machine().options().sched_stats();
+	bool const json = (name.length() >= 5) && !core_stricmp(name.substr(name.length() - 5), ".json");
+	double const frames = double(std::max<u64>(m_stats_frames, 1));
+	double const callback_ms = double(m_stats_total.m_callback_ticks) * 1000.0 / double(osd_ticks_per_second());
+
+	std::ostringstream out;
+	if (json)
+	{
+		util::stream_format(out, "{\n");
+		util::stream_format(out, "\t\"system\": \"%s\",\n", machine().system().name);
+		util::stream_format(out, "\t\"seconds\": %.6f,\n", m_basetime.as_double());
+		util::stream_format(out, "\t\"frames\": %u,\n", m_stats_frames);
+		util::stream_format(out, "\t\"timeslices\": %u,\n", m_stats_total.m_timeslices);
+		util::stream_format(out, "\t\"aborts\": %u,\n", m_stats_total.m_aborts);
+		util::stream_format(out, "\t\"timers_scheduled\": %u,\n", m_stats_total.m_scheduled);
+		util::stream_format(out, "\t\"timers_removed\": %u,\n", m_stats_total.m_removed);
+		util::stream_format(out, "\t\"timers_fired\": %u,\n", m_stats_total.m_fired);
+		util::stream_format(out, "\t\"timer_callback_ms\": %.3f,\n", callback_ms);
+		util::stream_format(out, "\t\"devices\": [");
+		char const *sep = "\n";
+		for (device_execute_interface &exec : execute_interface_enumerator(machine().root_device()))
+		{
+			device_execute_interface::execute_stats const &total = exec.m_stats_total;
+			util::stream_format(out, "%s\t\t{ \"tag\": \"%s\", \"type\": \"%s\", \"clock\": %u, ", sep, exec.device().tag(), exec.device().shortname(), exec.device().clock());
+			util::stream_format(out, "\"executed\": %u, \"stolen\": %u, \"eaten\": %u, \"runs\": %u, \"aborts\": %u, \"idled\": %u, ", total.m_executed, total.m_stolen, total.m_eaten, total.m_runs, total.m_aborts, total.m_idled);
+			util::stream_format(out, "\"executed_per_frame\": %.1f, \"runs_per_frame\": %.1f }", double(total.m_executed) / frames, double(total.m_runs) / frames);
+			sep = ",\n";
+		}
+		util::stream_format(out, "\n\t]\n}\n");
+	}
+	else
+	{
+		util::stream_format(out, "system,seconds,frames,timeslices,aborts,timers_scheduled,timers_removed,timers_fired,timer_callback_ms\n");
+		util::stream_format(out, "%s,%.6f,%u,%u,%u,%u,%u,%u,%.3f\n",
+				machine().system().name, m_basetime.as_double(), m_stats_frames,
+				m_stats_total.m_timeslices, m_stats_total.m_aborts,
+				m_stats_total.m_scheduled, m_stats_total.m_removed, m_stats_total.m_fired, callback_ms);
+		util::stream_format(out, "\ndevice,type,clock,executed,stolen,eaten,runs,aborts,idled,executed_per_frame,runs_per_frame\n");
+		for (device_execute_interface &exec : execute_interface_enumerator(machine().root_device()))
+		{
+			device_execute_interface::execute_stats const &total = exec.m_stats_total;
+			util::stream_format(out, "%s,%s,%u,%u,%u,%u,%u,%u,%u,%.1f,%.1f\n",
+					exec.device().tag(), exec.device().shortname(), exec.device().clock(),
+					total.m_executed, total.m_stolen, total.m_eaten, total.m_runs, total.m_aborts, total.m_idled,
+					double(total.m_executed) / frames, double(total.m_runs) / frames);
+		}
+	}
+
+	emu_file file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(name))
+		osd_printf_error("Unable to write scheduler statistics to %s\n", name);
+	else
+		file.puts(std::move(out).str());
+}
+
+
+//-------------------------------------------------
+//  adapt_quantum - narrow the base quantum if
+//  devices synchronised in most timeslices since
+//  the last check, or widen it if they hardly did
+//-------------------------------------------------
+
+void device_scheduler::adapt_quantum()
+{
+	// wait until enough timeslices have gone by for the ratio to mean something
+	const attotime elapsed = m_basetime - m_adaptive_since;
+	if (elapsed.seconds() < 0)
+	{
+		// time has gone backwards, so the measurement means nothing; start again
+		m_adaptive_since = m_basetime;
+		m_adaptive_syncs = 0;
+		return;
+	}
+	if (elapsed.seconds() == 0 && elapsed.attoseconds() < m_adaptive_current * 16)
+		return;
+
+	const u64 slices = (elapsed.seconds() != 0)
+			? u64(elapsed.seconds()) * u64(ATTOSECONDS_PER_SECOND / m_adaptive_current)
+			: u64(elapsed.attoseconds() / m_adaptive_current);
+	const u64 syncs = m_adaptive_syncs;
+	m_adaptive_since = m_basetime;
+	m_adaptive_syncs = 0;
+
+	attoseconds_t quantum = m_adaptive_current;
+	if (syncs * 2 > slices)
+		quantum = std::max(quantum / 2, m_adaptive_low);
+	else if (syncs * 16 < slices)
+		quantum = std::min(quantum * 2, m_adaptive_high);
+	if (quantum == m_adaptive_current)
+		return;
+
+	machine().logerror("Adaptive quantum: %s -> %s (%.0f Hz), %u syncs over %u timeslices\n",
+			attotime(0, m_adaptive_current).as_string(), attotime(0, quantum).as_string(), ATTOSECONDS_TO_HZ(quantum),
+			u32(syncs), u32(std::min<u64>(slices, ~u32(0))));
+	set_adaptive_quantum(quantum);
+}
+
+
+//-------------------------------------------------
+//  set_adaptive_quantum - replace the adaptive
+//  base quantum in the quantum list
+//-------------------------------------------------
+
+void device_scheduler::set_adaptive_quantum(attoseconds_t quantum)
+{
+	// swap the permanent quantum for the new one; temporary boosts are left alone
+	for (quantum_slot &quant : m_quantum_list)
+	{
+		if (quant.m_expire.is_never() && quant.m_requested == m_adaptive_applied)
+		{
+			m_quantum_allocator.reclaim(m_quantum_list.detach(quant));
+			break;
+		}
+	}
+	m_adaptive_current = m_adaptive_applied = quantum;
+	add_quantum(attotime(0, quantum), attotime::never);
+}
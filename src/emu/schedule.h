@@ -76,8 +76,10 @@ private:
 
 	// internal state
 	device_scheduler *  m_scheduler;    // reference to the owning machine
-	emu_timer *         m_next;         // next timer in order in the list
-	emu_timer *         m_prev;         // previous timer in order in the list
+	emu_timer *         m_next;         // next timer in the inactive list
+	emu_timer *         m_prev;         // previous timer in the inactive list
+	u32                 m_heap_index;   // position in the scheduler's heap, or NO_HEAP
+	u64                 m_sequence;     // insertion order, so equal expiry times fire first come, first served
 	timer_expired_delegate m_callback;  // callback function
 	s32                 m_param;        // integer parameter
 	bool                m_enabled;      // is the timer enabled?
@@ -86,6 +88,8 @@ private:
 	attotime            m_start;        // time when the timer was started
 	attotime            m_expire;       // time when the timer will expire
 
+	static constexpr u32 NO_HEAP = ~u32(0);
+
 	friend class device_scheduler;
 	friend class fixed_allocator<emu_timer>;
 	friend class simple_list<emu_timer>; // FIXME: fixed_allocator requires this
@@ -100,6 +104,17 @@ class device_scheduler
 	friend class emu_timer;
 
 public:
+	// scheduler activity, counted per frame and in total
+	struct schedule_stats
+	{
+		u64                     m_timeslices;               // passes through the device list
+		u64                     m_aborts;                   // abort_timeslice calls that cut a device short
+		u64                     m_scheduled;                // timers inserted into or moved within the queue
+		u64                     m_removed;                  // timers taken out of the queue
+		u64                     m_fired;                    // timer callbacks run
+		osd_ticks_t             m_callback_ticks;           // host time spent in timer callbacks, if collecting timing
+	};
+
 	// construction/destruction
 	device_scheduler(running_machine &machine);
 	~device_scheduler();
@@ -107,8 +122,14 @@ public:
 	// getters
 	running_machine &machine() const noexcept { return m_machine; }
 	attotime time() const noexcept;
-	emu_timer *first_timer() const noexcept { return m_timer_list; }
-	device_execute_interface *currently_executing() const noexcept { return m_executing_device; }
+	emu_timer *first_timer() const noexcept { return m_timer_heap.empty() ? nullptr : m_timer_heap.front(); }
+	const schedule_stats &last_frame_stats() const noexcept { return m_stats_last; }
+	const schedule_stats &total_stats() const noexcept { return m_stats_total; }
+	u64 stats_frames() const noexcept { return m_stats_frames; }
+	bool collect_timing() const noexcept { return m_collect_timing; }
+	bool parallel_running() const noexcept { return m_parallel_running; }
+	pc_profiler &profiler() const noexcept { return *m_profiler; }
+	device_execute_interface *currently_executing() const noexcept { return m_parallel_running ? s_domain_device : m_executing_device; }
 	bool can_save() const;
 
 	// execution
@@ -118,6 +139,8 @@ public:
 	void add_quantum(const attotime &quantum, const attotime &duration);
 	void perfect_quantum(const attotime &duration);
 	void suspend_resume_changed() { m_suspend_changes_pending = true; }
+	void set_collect_timing(bool collect) noexcept { m_collect_timing = collect; }
+	void set_serial(bool serial) noexcept { m_serial = serial; }
 
 	// timers, specified by callback/name
 	emu_timer *timer_alloc(timer_expired_delegate callback);
@@ -127,6 +150,8 @@ public:
 
 	// debugging
 	void dump_timers() const;
+	void frame_update();
+	void write_stats();
 
 	// for emergencies only!
 	void eat_all_cycles();
@@ -139,12 +164,23 @@ private:
 
 	// scheduling helpers
 	void compute_perfect_interleave();
+	void adapt_quantum();
+	void set_adaptive_quantum(attoseconds_t quantum);
+	void roll_stats();
 	void rebuild_execute_list();
 	void apply_suspend_changes();
+	void execute_device(device_execute_interface &exec, attotime &target, bool call_debugger);
+	attotime execute_domains(const attotime &target);
+	static void *execute_domain(void *param, int threadid);
 
 	// timer helpers
+	std::unique_lock<std::recursive_mutex> timer_lock();
 	emu_timer &timer_list_insert(emu_timer &timer);
 	emu_timer &timer_list_remove(emu_timer &timer);
+	static bool timer_before(const emu_timer &a, const emu_timer &b) noexcept;
+	void timer_heap_place(emu_timer &timer, u32 index) noexcept;
+	void timer_heap_up(u32 index) noexcept;
+	void timer_heap_down(u32 index) noexcept;
 	void execute_timers();
 
 	// internal state
@@ -153,11 +189,35 @@ private:
 	device_execute_interface *  m_execute_list;             // list of devices to be executed
 	attotime                    m_basetime;                 // global basetime; everything moves forward from here
 
-	// list of active timers
-	emu_timer *                 m_timer_list;               // head of the active list
+	// devices grouped by sync domain, for running the groups in parallel
+	struct sync_domain
+	{
+		device_scheduler *                      m_scheduler;    // owning scheduler
+		std::vector<device_execute_interface *> m_devices;      // devices in execution order
+		attotime                                m_target;       // where this group stopped
+	};
+	std::vector<sync_domain>    m_domains;                  // domain 0 first; empty unless two or more are in use
+	osd_work_queue *            m_domain_queue;             // worker threads for the other domains
+	bool                        m_parallel_running;         // domains are running on several threads
+	bool                        m_serial;                   // never run domains in parallel, so timers are always queued in the same order
+	std::recursive_mutex        m_timer_mutex;              // guards the timers while domains run in parallel
+	static thread_local device_execute_interface *s_domain_device; // device executing on this thread
+
+	// active timers, as a binary heap ordered by expiry
+	std::vector<emu_timer *>    m_timer_heap;               // the earliest timer is at the front
+	emu_timer *                 m_never_timer;              // never-expiring timer that keeps the heap from being empty
+	u64                         m_timer_sequence;           // next insertion order number
 	emu_timer *                 m_inactive_timers;          // head of the inactive timer list
 	fixed_allocator<emu_timer>  m_timer_allocator;          // allocator for timers
 
+	// statistics
+	schedule_stats              m_stats;                    // activity in the current frame
+	schedule_stats              m_stats_last;               // activity in the last full frame
+	schedule_stats              m_stats_total;              // activity since the machine started
+	u64                         m_stats_frames;             // frames folded into the totals
+	bool                        m_collect_timing;           // time the timer callbacks on the host
+	std::unique_ptr<pc_profiler> m_profiler;                // sampling guest PC profiler
+
 	// other internal states
 	emu_timer *                 m_callback_timer;           // pointer to the current callback timer
 	bool                        m_callback_timer_modified;  // true if the current callback timer was modified
@@ -180,6 +240,14 @@ private:
 	simple_list<quantum_slot>   m_quantum_list;             // list of active quanta
 	fixed_allocator<quantum_slot> m_quantum_allocator;      // allocator for quanta
 	attoseconds_t               m_quantum_minimum;          // duration of minimum quantum
+
+	// adaptive quantum
+	attoseconds_t               m_adaptive_low;             // narrowest base quantum allowed; 0 if not adapting
+	attoseconds_t               m_adaptive_high;            // widest base quantum allowed
+	attoseconds_t               m_adaptive_current;         // base quantum wanted; saved, so a loaded state replays with its own
+	attoseconds_t               m_adaptive_applied;         // base quantum in the quantum list
+	attotime                    m_adaptive_since;           // start of the current measurement
+	u32                         m_adaptive_syncs;           // synchronize() and trigger() calls since then
 };
 
 
@@ -16,6 +16,7 @@
 #include "main.h"
 #include "render.h"
 #include "rendutil.h"
+#include "tilemap.h"
 
 #include "nanosvg.h"
 #include "png.h"
@@ -30,6 +31,9 @@
 #define VERBOSE                     (0)
 #define LOG_PARTIAL_UPDATES(x)      do { if (VERBOSE) logerror x; } while (0)
 
+// redraw every parallel update serially and report any rows that differ
+#define VALIDATE_PARALLEL_UPDATES   (0)
+
 
 
 //**************************************************************************
@@ -43,6 +47,10 @@ const attotime screen_device::DEFAULT_FRAME_PERIOD(attotime::from_hz(DEFAULT_FRA
 
 u32 screen_device::m_id_counter = 0;
 
+// parallel updates split the rows into at most this many bands of at least this many rows
+constexpr int PARALLEL_MAX_BANDS = 8;
+constexpr int PARALLEL_BAND_ROWS = 16;
+
 class screen_device::svg_renderer {
 public:
 	svg_renderer(memory_region *region);
@@ -555,6 +563,10 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_curbitmap(0)
 	, m_curtexture(0)
 	, m_changed(true)
+	, m_damage_valid(false)
+	, m_damage_synced(false)
+	, m_frame_damage(0, -1, 0, -1)
+	, m_band_queue(nullptr)
 	, m_last_partial_scan(0)
 	, m_partial_scan_hpos(0)
 	, m_color(rgb_t(0xff, 0xff, 0xff, 0xff))
@@ -569,6 +581,8 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_vblank_end_timer(nullptr)
 	, m_scanline0_timer(nullptr)
 	, m_scanline_timer(nullptr)
+	, m_scanline_event_timer(nullptr)
+	, m_next_event_scanline(-1)
 	, m_frame_number(0)
 	, m_partial_updates_this_frame(0)
 {
@@ -819,6 +833,10 @@ void screen_device::device_start()
 	}
 	register_screen_bitmap(m_priority);
 
+	// allocate worker threads for updating bands in parallel
+	if (m_video_attributes & VIDEO_UPDATE_PARALLEL_SAFE)
+		m_band_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 	// allocate raw textures
 	m_texture[0] = machine().render().texture_alloc();
 	m_texture[0]->set_id(u64(m_unique_id) << 57);
@@ -855,6 +873,9 @@ void screen_device::device_start()
 	if ((m_video_attributes & VIDEO_UPDATE_SCANLINE) != 0 || !m_scanline_cb.isunset())
 		m_scanline_timer->adjust(time_until_pos(0));
 
+	// start the timer for any scanline events registered so far
+	schedule_scanline_event();
+
 	// create burn-in bitmap
 	if (machine().options().burnin())
 	{
@@ -915,6 +936,11 @@ void screen_device::device_stop()
 	machine().render().texture_free(m_texture[1]);
 	if (m_burnin.valid())
 		finalize_burnin();
+	if (m_band_queue)
+	{
+		osd_work_queue_free(m_band_queue);
+		m_band_queue = nullptr;
+	}
 }
 
 
@@ -926,6 +952,7 @@ void screen_device::device_stop()
 void screen_device::device_post_load()
 {
 	realloc_screen_bitmaps();
+	schedule_scanline_event();
 }
 
 
@@ -965,6 +992,23 @@ TIMER_CALLBACK_MEMBER(screen_device::scanline_tick)
 	m_scanline_timer->adjust(time_until_pos(param), param);
 }
 
+TIMER_CALLBACK_MEMBER(screen_device::scanline_event_tick)
+{
+	// fire every event on this scanline, in the order they were added; a
+	// callback may move its own or another event, so reschedule afterwards
+	s32 const scanline = m_next_event_scanline;
+	for (auto &item : m_scanline_events)
+	{
+		if (item->m_scanline == scanline)
+		{
+			if (item->m_update_partial_first)
+				update_partial(scanline);
+			item->m_callback(*this, scanline);
+		}
+	}
+	schedule_scanline_event();
+}
+
 
 //-------------------------------------------------
 //  configure - configure screen parameters
@@ -1022,6 +1066,9 @@ void screen_device::configure(int width, int height, const rectangle &visarea, a
 	else
 		m_scanline0_timer->adjust(time_until_pos(0));
 
+	// the scanline events move with the new timing
+	schedule_scanline_event();
+
 	// adjust speed if necessary
 	machine().video().update_refresh_speed();
 }
@@ -1052,6 +1099,9 @@ void screen_device::reset_origin(int beamy, int beamx)
 		vblank_begin(0);
 	else
 		m_vblank_begin_timer->adjust(time_until_vblank_start());
+
+	// the scanline events move with the new origin
+	schedule_scanline_event();
 }
 
 
@@ -1106,6 +1156,10 @@ void screen_device::realloc_screen_bitmaps()
 	m_texture[0]->set_bitmap(m_bitmap[0], m_visarea, m_bitmap[0].texformat());
 	m_texture[1]->set_bitmap(m_bitmap[1], m_visarea, m_bitmap[1].texformat());
 
+	// the previous frame can't be kept across a resize
+	m_damage_valid = false;
+	m_damage_synced = false;
+
 	allocate_scan_bitmaps();
 }
 
@@ -1154,13 +1208,17 @@ bool screen_device::update_partial(int scanline)
 		}
 
 		// skip if this screen is not visible anywhere
-		if (!machine().render().is_live(*this))
+		if (!machine().video().headless() && !machine().render().is_live(*this))
 		{
 			LOG_PARTIAL_UPDATES(("skipped because screen not live\n"));
 			return false;
 		}
 	}
 
+	// apply any held-back palette changes before they're drawn
+	if (m_palette)
+		m_palette->update_pending();
+
 	// skip if we already rendered this line
 	if (scanline < m_last_partial_scan)
 	{
@@ -1179,12 +1237,32 @@ bool screen_device::update_partial(int scanline)
 		return false;
 	}
 
+	// with tilemap damage tracking, only draw the rows that changed since the displayed frame
+	if (damage_tracked() && damage_reusable())
+	{
+		rectangle const damage = machine().tilemap().damage(*this);
+		if (m_frame_damage.empty())
+			m_frame_damage = damage;
+		else if (!damage.empty())
+			m_frame_damage |= damage;
+
+		clip.sety((std::max)(clip.top(), m_frame_damage.top()), (std::min)(clip.bottom(), m_frame_damage.bottom()));
+		if (m_frame_damage.empty() || (clip.top() > clip.bottom()))
+		{
+			LOG_PARTIAL_UPDATES(("skipped because tilemaps are undamaged\n"));
+			m_last_partial_scan = scanline + 1;
+			m_partial_scan_hpos = 0;
+			return true;
+		}
+		damage_sync();
+	}
+
 	// otherwise, render
 	LOG_PARTIAL_UPDATES(("updating %d-%d\n", clip.top(), clip.bottom()));
 
 	u32 flags = 0;
 	{
-		auto profile = g_profiler.start(PROFILER_VIDEO);
+		auto profile = g_profiler.start(PROFILER_VIDEO, tag());
 		if (m_video_attributes & VIDEO_VARIABLE_WIDTH)
 		{
 			rectangle scan_clip(clip);
@@ -1208,13 +1286,10 @@ bool screen_device::update_partial(int scanline)
 		{
 			if (m_type != SCREEN_TYPE_SVG)
 			{
-				screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
-				switch (curbitmap.format())
-				{
-					default:
-					case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
-					case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
-				}
+				if (parallel_update() && (clip.height() >= (PARALLEL_BAND_ROWS * 2)))
+					flags = update_bands(clip);
+				else
+					flags = update_rows(clip);
 			}
 			else
 			{
@@ -1253,13 +1328,17 @@ void screen_device::update_now()
 		}
 
 		// skip if this screen is not visible anywhere
-		if (!machine().render().is_live(*this))
+		if (!machine().video().headless() && !machine().render().is_live(*this))
 		{
 			LOG_PARTIAL_UPDATES(("skipped because screen not live\n"));
 			return;
 		}
 	}
 
+	// apply any held-back palette changes before they're drawn
+	if (m_palette)
+		m_palette->update_pending();
+
 	int current_vpos = vpos();
 	int current_hpos = hpos();
 	rectangle clip = m_visarea;
@@ -1295,9 +1374,11 @@ void screen_device::update_now()
 			// if there's something to draw, do it
 			if (!clip.empty())
 			{
-				auto profile = g_profiler.start(PROFILER_VIDEO);
+				auto profile = g_profiler.start(PROFILER_VIDEO, tag());
 
 				u32 flags = 0;
+				if (damage_tracked())
+					damage_sync();
 				screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
 				if (m_video_attributes & VIDEO_VARIABLE_WIDTH)
 				{
@@ -1347,11 +1428,13 @@ void screen_device::update_now()
 		// and if there's something to draw, do it
 		if (!clip.empty())
 		{
-			auto profile = g_profiler.start(PROFILER_VIDEO);
+			auto profile = g_profiler.start(PROFILER_VIDEO, tag());
 
 			LOG_PARTIAL_UPDATES(("doing scanline partial draw: Y %d X %d-%d\n", clip.bottom(), clip.left(), clip.right()));
 
 			u32 flags = 0;
+			if (damage_tracked())
+				damage_sync();
 			screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
 			if (m_video_attributes & VIDEO_VARIABLE_WIDTH)
 			{
@@ -1386,6 +1469,126 @@ void screen_device::update_now()
 }
 
 
+//-------------------------------------------------
+//  damage_sync - before drawing the first damaged
+//  rows since the last flip, copy the displayed
+//  frame to the current bitmap so the rows that
+//  aren't drawn keep their contents
+//-------------------------------------------------
+
+void screen_device::damage_sync()
+{
+	if (m_damage_synced || !damage_reusable())
+		return;
+
+	bitmap_t &dest = m_bitmap[m_curbitmap];
+	bitmap_t &src = m_bitmap[m_curtexture];
+	size_t const bytes = size_t(m_visarea.width()) * dest.bpp() / 8;
+	for (int y = m_visarea.top(); y <= m_visarea.bottom(); y++)
+		memcpy(dest.raw_pixptr(y, m_visarea.left()), src.raw_pixptr(y, m_visarea.left()), bytes);
+	m_damage_synced = true;
+}
+
+
+//-------------------------------------------------
+//  parallel_update - return true if updates can
+//  be split into bands on worker threads
+//-------------------------------------------------
+
+bool screen_device::parallel_update() const
+{
+	return m_band_queue
+			&& !(m_video_attributes & (VIDEO_VARIABLE_WIDTH | VIDEO_UPDATE_TILEMAP_DAMAGE))
+			&& (m_type != SCREEN_TYPE_SVG)
+			&& !g_profiler.enabled()
+			&& !(machine().debug_flags & DEBUG_FLAG_ENABLED)
+			&& !machine().video().updating_screens();
+}
+
+
+//-------------------------------------------------
+//  update_rows - call the screen update for some
+//  rows of the current bitmap
+//-------------------------------------------------
+
+u32 screen_device::update_rows(const rectangle &clip)
+{
+	screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
+	switch (curbitmap.format())
+	{
+		default:
+		case BITMAP_FORMAT_IND16:   return m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);
+		case BITMAP_FORMAT_RGB32:   return m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);
+	}
+}
+
+
+//-------------------------------------------------
+//  update_band - work item to update one band of
+//  a parallel update
+//-------------------------------------------------
+
+void *screen_device::update_band(void *param, int threadid)
+{
+	band &b = *reinterpret_cast<band *>(param);
+	b.m_flags = b.m_screen->update_rows(b.m_clip);
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  update_bands - update some rows of the current
+//  bitmap as bands on the worker threads; the
+//  result counts as unchanged only if every band
+//  says so
+//-------------------------------------------------
+
+u32 screen_device::update_bands(const rectangle &clip)
+{
+	int const count = std::min(clip.height() / PARALLEL_BAND_ROWS, PARALLEL_MAX_BANDS);
+	m_bands.resize(count);
+	for (int i = 0; i < count; i++)
+	{
+		m_bands[i].m_screen = this;
+		m_bands[i].m_clip = clip;
+		m_bands[i].m_clip.sety(clip.top() + (clip.height() * i / count), clip.top() + (clip.height() * (i + 1) / count) - 1);
+		m_bands[i].m_flags = 0;
+	}
+
+	// run the first band on this thread and the others on the queue
+	machine().tilemap().begin_parallel_draw();
+	osd_work_item_queue_multiple(m_band_queue, &screen_device::update_band, count - 1, &m_bands[1], sizeof(band), WORK_ITEM_FLAG_AUTO_RELEASE);
+	update_band(&m_bands[0], 0);
+	while (!osd_work_queue_wait(m_band_queue, osd_ticks_per_second()))
+		;
+	machine().tilemap().end_parallel_draw();
+
+	u32 flags = m_bands[0].m_flags;
+	for (int i = 1; i < count; i++)
+		flags &= m_bands[i].m_flags;
+
+	if (VALIDATE_PARALLEL_UPDATES)
+	{
+		// keep the parallel result, draw the rows again serially, and compare
+		bitmap_t &curbitmap = m_bitmap[m_curbitmap];
+		size_t const bytes = size_t(clip.width()) * curbitmap.bpp() / 8;
+		m_band_validate.resize(bytes * clip.height());
+		for (int y = clip.top(); y <= clip.bottom(); y++)
+			memcpy(&m_band_validate[bytes * (y - clip.top())], curbitmap.raw_pixptr(y, clip.left()), bytes);
+
+		u32 const serial = update_rows(clip);
+		if ((serial & UPDATE_HAS_NOT_CHANGED) != (flags & UPDATE_HAS_NOT_CHANGED))
+			osd_printf_warning("%s: parallel update flags %X differ from serial flags %X\n", tag(), flags, serial);
+		for (int y = clip.top(); y <= clip.bottom(); y++)
+			if (memcmp(&m_band_validate[bytes * (y - clip.top())], curbitmap.raw_pixptr(y, clip.left()), bytes))
+				osd_printf_warning("%s: parallel update differs from serial in frame %d row %d\n", tag(), m_frame_number, y);
+		flags = serial;
+	}
+
+	return flags;
+}
+
+
 //-------------------------------------------------
 //  reset_partial_updates - reset the partial
 //  updating state
@@ -1396,6 +1599,7 @@ void screen_device::reset_partial_updates()
 	m_last_partial_scan = 0;
 	m_partial_scan_hpos = 0;
 	m_partial_updates_this_frame = 0;
+	m_frame_damage.set(0, -1, 0, -1);
 	m_scanline0_timer->adjust(time_until_pos(0));
 }
 
@@ -1611,6 +1815,78 @@ void screen_device::register_vblank_callback(vblank_state_delegate vblank_callba
 }
 
 
+//-------------------------------------------------
+//  add_scanline_event - registers a callback for
+//  the start of a scanline (-1 for none yet),
+//  returning an index for set_scanline_event;
+//  must be called during startup
+//-------------------------------------------------
+
+int screen_device::add_scanline_event(int scanline, scanline_event_delegate callback, bool update_partial_first)
+{
+	// validate arguments
+	assert(!callback.isnull());
+	assert(scanline >= -1);
+
+	int const index = m_scanline_events.size();
+	m_scanline_events.push_back(std::make_unique<scanline_event_item>(scanline, std::move(callback), update_partial_first));
+	save_item(NAME(m_scanline_events[index]->m_scanline), index);
+
+	if (!m_scanline_event_timer)
+		m_scanline_event_timer = timer_alloc(FUNC(screen_device::scanline_event_tick), this);
+	if (started())
+		schedule_scanline_event();
+	return index;
+}
+
+
+//-------------------------------------------------
+//  set_scanline_event - move a scanline event to
+//  another scanline, or disable it with -1
+//-------------------------------------------------
+
+void screen_device::set_scanline_event(int index, int scanline)
+{
+	assert(index >= 0 && unsigned(index) < m_scanline_events.size());
+	assert(scanline >= -1);
+
+	if (m_scanline_events[index]->m_scanline != scanline)
+	{
+		m_scanline_events[index]->m_scanline = scanline;
+		schedule_scanline_event();
+	}
+}
+
+
+//-------------------------------------------------
+//  schedule_scanline_event - set the event timer
+//  for the nearest scanline with an event
+//-------------------------------------------------
+
+void screen_device::schedule_scanline_event()
+{
+	if (!m_scanline_event_timer)
+		return;
+
+	attotime next = attotime::never;
+	m_next_event_scanline = -1;
+	for (auto &item : m_scanline_events)
+	{
+		// events on scanlines the screen doesn't have never fire
+		if (item->m_scanline < 0 || item->m_scanline >= m_height || item->m_scanline == m_next_event_scanline)
+			continue;
+
+		attotime const delta = time_until_pos(item->m_scanline);
+		if (delta < next)
+		{
+			next = delta;
+			m_next_event_scanline = item->m_scanline;
+		}
+	}
+	m_scanline_event_timer->adjust(next);
+}
+
+
 //-------------------------------------------------
 //  register_screen_bitmap - registers a bitmap
 //  that should track the screen size
@@ -1739,8 +2015,8 @@ void screen_device::create_composited_bitmap()
 
 bool screen_device::update_quads()
 {
-	// only update if live
-	if (machine().render().is_live(*this))
+	// only update if live; headless screens keep their textures current for snapshots
+	if (machine().video().headless() || machine().render().is_live(*this))
 	{
 		// only update if empty and not a vector game; otherwise assume the driver did it directly
 		if (m_type != SCREEN_TYPE_VECTOR && (m_video_attributes & VIDEO_SELF_RENDER) == 0)
@@ -1755,6 +2031,10 @@ bool screen_device::update_quads()
 				m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], m_visarea, m_bitmap[m_curbitmap].texformat());
 				m_curtexture = m_curbitmap;
 				m_curbitmap = 1 - m_curbitmap;
+
+				// every row of the frame was either drawn or kept from the one before
+				m_damage_valid = damage_tracked();
+				m_damage_synced = false;
 			}
 
 			// brightness adjusted render color
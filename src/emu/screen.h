@@ -60,6 +60,24 @@ constexpr u32 UPDATE_HAS_NOT_CHANGED = 0x0001;   // the video has not changed
  @def VIDEO_VARIABLE_WIDTH
  causes the screen to construct its final bitmap from a composite upscale of individual scanline bitmaps
 
+ @def VIDEO_UPDATE_TILEMAP_DAMAGE
+ only calls VIDEO_UPDATE for the rows the tilemaps report as changed, keeping the rest of the previous frame;
+ for screens drawn entirely from tilemaps with tilemap_t::draw()/draw_roz(), which hide layers with
+ tilemap_t::enable() rather than by not drawing them; ignored with VIDEO_VARIABLE_WIDTH and for SVG screens
+
+ @def VIDEO_UPDATE_PARALLEL_SAFE
+ allows VIDEO_UPDATE to be called for separate bands of rows at the same time on worker threads; only for updates
+ that read the video state without changing it (including tilemap scroll and other tilemap state) and write
+ nothing but the bitmap and priority bitmap inside the cliprect; ignored with VIDEO_VARIABLE_WIDTH,
+ VIDEO_UPDATE_TILEMAP_DAMAGE, for SVG screens, and while profiling or debugging
+
+ @def VIDEO_UPDATE_INDEPENDENT
+ allows the end-of-frame update of this screen to run on a worker thread at the same time as those of other
+ screens with this flag; only for updates that read the video state shared with the other screens without
+ changing it (including tilemap scroll and other tilemap state), and that use no palette with changes held
+ back other than ones flushed before the frame is finished; ignored with VIDEO_UPDATE_TILEMAP_DAMAGE and while
+ profiling or debugging, and bands of VIDEO_UPDATE_PARALLEL_SAFE screens aren't split while screens run this way
+
  @}
  */
 
@@ -70,6 +88,9 @@ constexpr u32 VIDEO_SELF_RENDER             = 0x0008;
 constexpr u32 VIDEO_ALWAYS_UPDATE           = 0x0080;
 constexpr u32 VIDEO_UPDATE_SCANLINE         = 0x0100;
 constexpr u32 VIDEO_VARIABLE_WIDTH          = 0x0200;
+constexpr u32 VIDEO_UPDATE_TILEMAP_DAMAGE   = 0x0400;
+constexpr u32 VIDEO_UPDATE_PARALLEL_SAFE    = 0x0800;
+constexpr u32 VIDEO_UPDATE_INDEPENDENT      = 0x1000;
 
 
 //**************************************************************************
@@ -154,6 +175,7 @@ private:
 // ======================> other delegate types
 
 typedef delegate<void (screen_device &, bool)> vblank_state_delegate;
+typedef delegate<void (screen_device &, int)> scanline_event_delegate;
 
 typedef device_delegate<u32 (screen_device &, bitmap_ind16 &, const rectangle &)> screen_update_ind16_delegate;
 typedef device_delegate<u32 (screen_device &, bitmap_rgb32 &, const rectangle &)> screen_update_rgb32_delegate;
@@ -408,11 +430,18 @@ public:
 	bool update_partial(int scanline);
 	void update_now();
 	void reset_partial_updates();
+	bool independent_update() const { return (m_video_attributes & VIDEO_UPDATE_INDEPENDENT) && !damage_tracked(); }
 
 	// additional helpers
 	void register_vblank_callback(vblank_state_delegate vblank_callback);
 	void register_screen_bitmap(bitmap_t &bitmap);
 
+	// sparse scanline events; the screen keeps one timer set for the next
+	// registered scanline, so drivers needn't tick on every line
+	int add_scanline_event(int scanline, scanline_event_delegate callback, bool update_partial_first = false);
+	void set_scanline_event(int index, int scanline);
+	int scanline_event(int index) const { return m_scanline_events[index]->m_scanline; }
+
 	// internal to the video system
 	bool update_quads();
 	void update_burnin();
@@ -440,6 +469,8 @@ private:
 	TIMER_CALLBACK_MEMBER(vblank_end);
 	TIMER_CALLBACK_MEMBER(first_scanline_tick);
 	TIMER_CALLBACK_MEMBER(scanline_tick);
+	TIMER_CALLBACK_MEMBER(scanline_event_tick);
+	void schedule_scanline_event();
 	void finalize_burnin();
 	void load_effect_overlay(const char *filename);
 	void update_scan_bitmap_size(int y);
@@ -447,6 +478,13 @@ private:
 	void create_composited_bitmap();
 	void destroy_scan_bitmaps();
 	void allocate_scan_bitmaps();
+	bool damage_tracked() const { return (m_video_attributes & VIDEO_UPDATE_TILEMAP_DAMAGE) && !(m_video_attributes & VIDEO_VARIABLE_WIDTH) && (m_type != SCREEN_TYPE_SVG); }
+	bool damage_reusable() const { return m_damage_valid && (m_curbitmap != m_curtexture); }
+	void damage_sync();
+	bool parallel_update() const;
+	u32 update_rows(const rectangle &clip);
+	u32 update_bands(const rectangle &clip);
+	static void *update_band(void *param, int threadid);
 
 	// inline configuration data
 	screen_type_enum    m_type;                     // type of screen
@@ -485,6 +523,20 @@ private:
 	u8                  m_curbitmap;                // current bitmap index
 	u8                  m_curtexture;               // current texture index
 	bool                m_changed;                  // has this bitmap changed?
+	bool                m_damage_valid;             // is the displayed bitmap a complete frame to keep undamaged rows from?
+	bool                m_damage_synced;            // has the displayed frame been copied to the current bitmap?
+	rectangle           m_frame_damage;             // rows damaged so far this frame
+
+	// parallel updates
+	struct band
+	{
+		screen_device *     m_screen;                   // screen to update
+		rectangle           m_clip;                     // rows to update
+		u32                 m_flags;                    // flags returned by the update
+	};
+	osd_work_queue *    m_band_queue;               // worker threads for parallel updates
+	std::vector<band>   m_bands;                    // bands of the current parallel update
+	std::vector<u8>     m_band_validate;            // parallel result, when comparing it with a serial update
 	s32                 m_last_partial_scan;        // scanline of last partial update
 	s32                 m_partial_scan_hpos;        // horizontal pixel last rendered on this partial scanline
 	bitmap_argb32       m_screen_overlay_bitmap;    // screen overlay bitmap
@@ -503,6 +555,8 @@ private:
 	emu_timer *         m_vblank_end_timer;         // timer to signal VBLANK end
 	emu_timer *         m_scanline0_timer;          // scanline 0 timer
 	emu_timer *         m_scanline_timer;           // scanline timer
+	emu_timer *         m_scanline_event_timer;     // timer for the next scanline event
+	s32                 m_next_event_scanline;      // scanline the event timer is set for
 	u64                 m_frame_number;             // the current frame number
 	u32                 m_partial_updates_this_frame;// partial update counter this frame
 
@@ -519,6 +573,19 @@ private:
 	};
 	std::vector<std::unique_ptr<callback_item>> m_callback_list;     // list of VBLANK callbacks
 
+	// scanline events
+	class scanline_event_item
+	{
+	public:
+		scanline_event_item(s32 scanline, scanline_event_delegate callback, bool update_partial_first)
+			: m_callback(std::move(callback)), m_scanline(scanline), m_update_partial_first(update_partial_first) { }
+
+		scanline_event_delegate     m_callback;
+		s32                         m_scanline;             // scanline to fire on, or -1 if disabled
+		bool                        m_update_partial_first; // update the screen up to the scanline first
+	};
+	std::vector<std::unique_ptr<scanline_event_item>> m_scanline_events; // list of scanline events
+
 	// auto-sizing bitmaps
 	class auto_bitmap_item
 	{
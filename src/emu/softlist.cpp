@@ -13,11 +13,14 @@
 
 #include "hash.h"
 
+#include "multibyte.h"
+
 #include "expat.h"
 
 #include <array>
 #include <cstring>
 #include <regex>
+#include <unordered_map>
 
 
 
@@ -282,15 +285,18 @@ softlist_parser::softlist_parser(
 	XML_SetElementHandler(m_parser, &softlist_parser::start_handler, &softlist_parser::end_handler);
 	XML_SetCharacterDataHandler(m_parser, &softlist_parser::data_handler);
 
-	// parse the file contents
-	char buffer[1024];
+	// parse the file contents, reading straight into the parser's buffer
+	constexpr int BUFFER_SIZE = 65536;
 	for (bool done = false; !done; )
 	{
+		void *const buffer = XML_GetBuffer(m_parser, BUFFER_SIZE);
+		if (!buffer)
+			throw std::bad_alloc();
 		size_t length;
-		file.read(buffer, sizeof(buffer), length); // TODO: better error handling
+		file.read(buffer, BUFFER_SIZE, length); // TODO: better error handling
 		if (!length)
 			done = true;
-		if (XML_Parse(m_parser, buffer, length, done) == XML_STATUS_ERROR)
+		if (XML_ParseBuffer(m_parser, int(length), done) == XML_STATUS_ERROR)
 		{
 			parse_error("%s", parser_error());
 			break;
@@ -905,6 +911,270 @@ void softlist_parser::parse_soft_end(const char *tagname)
 	}
 }
 
+
+
+//**************************************************************************
+//  SOFTWARE LIST CACHE
+//**************************************************************************
+
+struct softlist_cache_contents
+{
+	std::string_view key;
+	std::string_view stamp;
+	std::string_view listname;
+	std::string_view description;
+	std::string_view errors;
+	std::vector<std::pair<u32, u32> > entries;          // offset and length of each entry, in order
+	std::unordered_map<std::string_view, u32> index;    // entry number for each short name
+};
+
+
+class softlist_cache
+{
+public:
+	// the stored form is a header, an index of entries by short name, and
+	// the entries themselves, so that any one of them can be restored alone
+	static void save(std::vector<u8> &data, std::string_view key, std::string_view stamp, std::string_view listname, std::string_view description, std::string_view errors, const std::list<software_info> &infolist);
+	static bool open(const std::vector<u8> &data, softlist_cache_contents &result);
+	static const software_info *load(const std::vector<u8> &data, u32 offset, u32 length, std::list<software_info> &infolist);
+
+private:
+	static constexpr char MAGIC[8] = { 'M', 'A', 'M', 'E', 'S', 'L', 'C', 0 };
+	static constexpr u32 VERSION = 2;
+
+	// writing
+	static void put_u32(std::vector<u8> &data, u32 value)
+	{
+		u8 bytes[4];
+		put_u32le(bytes, value);
+		data.insert(data.end(), std::begin(bytes), std::end(bytes));
+	}
+
+	static void put_string(std::vector<u8> &data, std::string_view value)
+	{
+		put_u32(data, u32(value.length()));
+		data.insert(data.end(), value.begin(), value.end());
+	}
+
+	static void put_entry(std::vector<u8> &data, const software_info &info);
+
+	// reading; once anything runs off the end, everything after reads as empty
+	class reader
+	{
+	public:
+		reader(const u8 *data, std::size_t length) : m_data(data), m_length(length), m_offset(0), m_ok(true) { }
+
+		bool ok() const { return m_ok; }
+		bool at_end() const { return m_offset == m_length; }
+		std::size_t offset() const { return m_offset; }
+
+		u32 get_u32()
+		{
+			if (!check(4))
+				return 0;
+			u32 const result = get_u32le(&m_data[m_offset]);
+			m_offset += 4;
+			return result;
+		}
+
+		std::string_view get_view(std::size_t length)
+		{
+			if (!check(length))
+				return std::string_view();
+			std::string_view const result(reinterpret_cast<const char *>(&m_data[m_offset]), length);
+			m_offset += length;
+			return result;
+		}
+
+		std::string_view get_view() { return get_view(get_u32()); }
+		std::string get_string() { return std::string(get_view()); }
+
+		u32 get_count(std::size_t minsize)
+		{
+			// a count that can't possibly fit is damage, not a huge list
+			u32 const result = get_u32();
+			return check(std::size_t(result) * minsize) ? result : 0;
+		}
+
+	private:
+		bool check(std::size_t length)
+		{
+			if (m_ok && ((m_length - m_offset) < length))
+				m_ok = false;
+			return m_ok;
+		}
+
+		const u8 *m_data;
+		std::size_t m_length;
+		std::size_t m_offset;
+		bool m_ok;
+	};
+};
+
+
+void softlist_cache::put_entry(std::vector<u8> &data, const software_info &info)
+{
+	auto const put_items =
+			[&data] (auto const &items)
+			{
+				put_u32(data, u32(items.size()));
+				for (software_info_item const &item : items)
+				{
+					put_string(data, item.name());
+					put_string(data, item.value());
+				}
+			};
+
+	put_string(data, info.m_shortname);
+	put_string(data, info.m_longname);
+	put_string(data, info.m_parentname);
+	put_string(data, info.m_year);
+	put_string(data, info.m_publisher);
+	put_u32(data, u32(info.m_supported));
+	put_items(info.m_info);
+	put_items(info.m_shared_features);
+
+	put_u32(data, u32(info.m_partdata.size()));
+	for (software_part const &part : info.m_partdata)
+	{
+		put_string(data, part.m_name);
+		put_string(data, part.m_interface);
+		put_items(part.m_features);
+
+		put_u32(data, u32(part.m_romdata.size()));
+		for (rom_entry const &rom : part.m_romdata)
+		{
+			put_string(data, rom.name());
+			put_string(data, rom.hashdata());
+			put_u32(data, rom.get_offset());
+			put_u32(data, rom.get_length());
+			put_u32(data, rom.get_flags());
+		}
+	}
+}
+
+
+void softlist_cache::save(std::vector<u8> &data, std::string_view key, std::string_view stamp, std::string_view listname, std::string_view description, std::string_view errors, const std::list<software_info> &infolist)
+{
+	// store the entries first to find out where they go
+	std::vector<u8> entries;
+	std::vector<std::pair<u32, u32> > ranges;
+	ranges.reserve(infolist.size());
+	for (software_info const &info : infolist)
+	{
+		u32 const offset = u32(entries.size());
+		put_entry(entries, info);
+		ranges.emplace_back(offset, u32(entries.size()) - offset);
+	}
+
+	data.clear();
+	data.insert(data.end(), std::begin(MAGIC), std::end(MAGIC));
+	put_u32(data, VERSION);
+	put_string(data, key);
+	put_string(data, stamp);
+	put_string(data, listname);
+	put_string(data, description);
+	put_string(data, errors);
+
+	// the index holds the names, then where each entry is stored
+	put_u32(data, u32(infolist.size()));
+	for (software_info const &info : infolist)
+		put_string(data, info.m_shortname);
+	u32 const base = u32(data.size() + (ranges.size() * 8));
+	for (auto const &range : ranges)
+	{
+		put_u32(data, base + range.first);
+		put_u32(data, range.second);
+	}
+	data.insert(data.end(), entries.begin(), entries.end());
+}
+
+
+bool softlist_cache::open(const std::vector<u8> &data, softlist_cache_contents &result)
+{
+	reader in(data.data(), data.size());
+	if ((in.get_view(sizeof(MAGIC)) != std::string_view(MAGIC, sizeof(MAGIC))) || (in.get_u32() != VERSION))
+		return false;
+
+	result.key = in.get_view();
+	result.stamp = in.get_view();
+	result.listname = in.get_view();
+	result.description = in.get_view();
+	result.errors = in.get_view();
+
+	// names come first, then an offset and length for each
+	u32 const count = in.get_count(4 + 8);
+	std::vector<std::string_view> names;
+	names.reserve(count);
+	for (u32 i = 0; in.ok() && (i < count); i++)
+		names.emplace_back(in.get_view());
+
+	result.entries.clear();
+	result.entries.reserve(count);
+	result.index.clear();
+	result.index.reserve(count);
+	for (u32 i = 0; in.ok() && (i < count); i++)
+	{
+		u32 const offset = in.get_u32();
+		u32 const length = in.get_u32();
+		if ((offset > data.size()) || (length > (data.size() - offset)))
+			return false;
+		result.entries.emplace_back(offset, length);
+		result.index.emplace(names[i], i);
+	}
+	return in.ok();
+}
+
+
+const software_info *softlist_cache::load(const std::vector<u8> &data, u32 offset, u32 length, std::list<software_info> &infolist)
+{
+	// every count is followed by at least one length per item
+	reader in(data.data() + offset, length);
+	std::string shortname = in.get_string();
+	software_info &info = infolist.emplace_back(std::move(shortname), std::string(), std::string_view());
+	info.m_longname = in.get_string();
+	info.m_parentname = in.get_string();
+	info.m_year = in.get_string();
+	info.m_publisher = in.get_string();
+	u32 const supported = in.get_u32();
+	info.m_supported = software_support(std::min(supported, u32(software_support::UNSUPPORTED)));
+	for (u32 count = in.get_count(8); in.ok() && count--; )
+	{
+		std::string name = in.get_string();
+		info.m_info.emplace_back(std::move(name), in.get_string());
+	}
+	for (u32 count = in.get_count(8); in.ok() && count--; )
+	{
+		std::string name = in.get_string();
+		info.m_shared_features.emplace(std::move(name), in.get_string());
+	}
+
+	for (u32 partcount = in.get_count(4 * 4); in.ok() && partcount--; )
+	{
+		std::string name = in.get_string();
+		software_part &part = info.m_partdata.emplace_back(info, std::move(name), in.get_string());
+		for (u32 count = in.get_count(8); in.ok() && count--; )
+		{
+			std::string name = in.get_string();
+			part.m_features.emplace(std::move(name), in.get_string());
+		}
+		for (u32 count = in.get_count(4 * 5); in.ok() && count--; )
+		{
+			std::string name = in.get_string();
+			std::string hashdata = in.get_string();
+			u32 const offset = in.get_u32();
+			u32 const length = in.get_u32();
+			part.m_romdata.emplace_back(std::move(name), std::move(hashdata), offset, length, in.get_u32());
+		}
+	}
+	if (!in.ok() || !in.at_end() || (supported > u32(software_support::UNSUPPORTED)))
+	{
+		infolist.pop_back();
+		return nullptr;
+	}
+	return &info;
+}
+
 } // namespace detail
 
 
@@ -920,6 +1190,94 @@ void parse_software_list(
 }
 
 
+std::vector<u8> save_software_list(
+		std::string_view key,
+		std::string_view stamp,
+		std::string_view listname,
+		std::string_view description,
+		std::string_view errors,
+		const std::list<software_info> &infolist)
+{
+	std::vector<u8> result;
+	detail::softlist_cache::save(result, key, stamp, listname, description, errors, infolist);
+	return result;
+}
+
+
+
+//**************************************************************************
+//  STORED SOFTWARE LIST
+//**************************************************************************
+
+software_list_cache::software_list_cache()
+{
+}
+
+
+software_list_cache::~software_list_cache()
+{
+}
+
+
+bool software_list_cache::open(std::vector<u8> &&data)
+{
+	close();
+	auto contents = std::make_unique<detail::softlist_cache_contents>();
+	m_data = std::move(data);
+	if (!detail::softlist_cache::open(m_data, *contents))
+	{
+		m_data.clear();
+		return false;
+	}
+	m_contents = std::move(contents);
+	return true;
+}
+
+
+void software_list_cache::close()
+{
+	m_contents.reset();
+	m_data.clear();
+}
+
+
+std::string_view software_list_cache::key() const { return m_contents->key; }
+std::string_view software_list_cache::stamp() const { return m_contents->stamp; }
+std::string_view software_list_cache::listname() const { return m_contents->listname; }
+std::string_view software_list_cache::description() const { return m_contents->description; }
+std::string_view software_list_cache::errors() const { return m_contents->errors; }
+std::size_t software_list_cache::size() const { return m_contents->entries.size(); }
+
+
+bool software_list_cache::contains(std::string_view shortname) const
+{
+	return m_contents->index.find(shortname) != m_contents->index.end();
+}
+
+
+const software_info *software_list_cache::load(std::string_view shortname, std::list<software_info> &infolist) const
+{
+	auto const found = m_contents->index.find(shortname);
+	if (found == m_contents->index.end())
+		return nullptr;
+	auto const &entry = m_contents->entries[found->second];
+	return detail::softlist_cache::load(m_data, entry.first, entry.second, infolist);
+}
+
+
+bool software_list_cache::load_all(std::list<software_info> &infolist) const
+{
+	std::list<software_info> newinfolist;
+	for (auto const &entry : m_contents->entries)
+	{
+		if (!detail::softlist_cache::load(m_data, entry.first, entry.second, newinfolist))
+			return false;
+	}
+	infolist.splice(infolist.end(), newinfolist);
+	return true;
+}
+
+
 //-------------------------------------------------
 //  software_name_parse - helper that splits a
 //  software identifier (software_list:software:part)
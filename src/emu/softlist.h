@@ -19,16 +19,18 @@
 #include "corefile.h"
 
 #include <list>
+#include <memory>
 #include <set>
 #include <string>
 #include <string_view>
+#include <vector>
 
 
 //**************************************************************************
 //  FORWARD DECLARATIONS
 //**************************************************************************
 
-namespace detail { class softlist_parser; }
+namespace detail { class softlist_parser; class softlist_cache; struct softlist_cache_contents; }
 
 
 //**************************************************************************
@@ -84,6 +86,7 @@ private:
 class software_part
 {
 	friend class detail::softlist_parser;
+	friend class detail::softlist_cache;
 
 public:
 	// construction/destruction
@@ -118,6 +121,7 @@ private:
 class software_info
 {
 	friend class detail::softlist_parser;
+	friend class detail::softlist_cache;
 
 public:
 	// construction/destruction
@@ -168,6 +172,49 @@ void parse_software_list(
 		std::list<software_info> &infolist,
 		std::ostream &errors);
 
+// stores a parsed software list in binary form, along with a key
+// identifying the file it was parsed from and a stamp (such as its size
+// and modification time) that is quicker to check
+std::vector<u8> save_software_list(
+		std::string_view key,
+		std::string_view stamp,
+		std::string_view listname,
+		std::string_view description,
+		std::string_view errors,
+		const std::list<software_info> &infolist);
+
+// a software list stored by save_software_list; it's indexed by short
+// name, so that entries can be restored one at a time as they're needed
+class software_list_cache
+{
+public:
+	software_list_cache();
+	~software_list_cache();
+
+	// takes stored data, returning false if it's damaged or out of date
+	bool open(std::vector<u8> &&data);
+	void close();
+	bool is_open() const { return bool(m_contents); }
+
+	// getters, while open
+	std::string_view key() const;
+	std::string_view stamp() const;
+	std::string_view listname() const;
+	std::string_view description() const;
+	std::string_view errors() const;
+	std::size_t size() const;
+
+	// restore the entry with the given short name, or every entry, adding
+	// to the list; these fail if the name isn't there or data is damaged
+	bool contains(std::string_view shortname) const;
+	const software_info *load(std::string_view shortname, std::list<software_info> &infolist) const;
+	bool load_all(std::list<software_info> &infolist) const;
+
+private:
+	std::vector<u8>                                         m_data;
+	std::unique_ptr<detail::softlist_cache_contents>        m_contents;
+};
+
 // parses a software identifier (e.g. - 'apple2e:agentusa:flop1') into its constituent parts (returns false if cannot parse)
 bool software_name_parse(std::string_view identifier, std::string *list_name = nullptr, std::string *software_name = nullptr, std::string *part_name = nullptr);
 
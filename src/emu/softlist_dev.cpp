@@ -18,9 +18,12 @@
 #include "validity.h"
 
 #include "corestr.h"
+#include "hashing.h"
+#include "path.h"
 #include "unicode.h"
 
 #include <cctype>
+#include <cstdio>
 
 
 //**************************************************************************
@@ -90,7 +93,8 @@ software_list_device::software_list_device(const machine_config &mconfig, const
 	m_list_type(softlist_type::ORIGINAL_SYSTEM),
 	m_filter(nullptr),
 	m_parsed(false),
-	m_description("")
+	m_description(""),
+	m_cache_checked(false)
 {
 }
 
@@ -183,6 +187,9 @@ void software_list_device::release()
 	m_description.clear();
 	m_errors.clear();
 	m_infolist.clear();
+	m_cache_checked = false;
+	m_cache.close();
+	m_cachedlist.clear();
 }
 
 
@@ -258,6 +265,22 @@ const software_info *software_list_device::find(std::string_view look_for)
 
 	const bool iswild = look_for.find_first_of("*?") != std::string::npos;
 
+	// a plain name can be restored from the pre-parsed copy without the rest of the list
+	if (!m_parsed && !iswild && open_cache())
+	{
+		std::string const lcname = strmakelower(look_for);
+		for (const software_info &info : m_cachedlist)
+		{
+			if (info.shortname() == lcname)
+				return &info;
+		}
+		if (!m_cache.contains(lcname))
+			return nullptr;
+		const software_info *const info = m_cache.load(lcname, m_cachedlist);
+		if (info)
+			return info;
+	}
+
 	// find a match (will cause a parse if needed when calling get_info)
 	const auto &info_list = get_info();
 	auto iter = std::find_if(
@@ -284,6 +307,17 @@ void software_list_device::parse()
 	if (m_parsed)
 		return;
 
+	// an up-to-date pre-parsed copy saves reading the XML at all
+	if (open_cache())
+	{
+		if (m_cache.load_all(m_infolist))
+		{
+			m_parsed = true;
+			return;
+		}
+		m_cache.close();
+	}
+
 	// reset the errors
 	m_errors.clear();
 
@@ -294,10 +328,18 @@ void software_list_device::parse()
 	if (!filerr)
 	{
 		// parse if no error
-		std::ostringstream errs;
-		parse_software_list(file, m_filename, m_shortname, m_description, m_infolist, errs);
+		char const *const cachedir = mconfig().options().softlist_cache();
+		if (cachedir && *cachedir)
+		{
+			parse_cached(file, cachedir);
+		}
+		else
+		{
+			std::ostringstream errs;
+			parse_software_list(file, m_filename, m_shortname, m_description, m_infolist, errs);
+			m_errors = errs.str();
+		}
 		file.close();
-		m_errors = errs.str();
 	}
 	else if (std::errc::no_such_file_or_directory == filerr)
 	{
@@ -313,6 +355,133 @@ void software_list_device::parse()
 }
 
 
+//-------------------------------------------------
+//  parse_cached - use the pre-parsed copy of our
+//  softlist file if it was made from the same XML,
+//  or parse it and save a new copy
+//-------------------------------------------------
+
+void software_list_device::parse_cached(emu_file &file, std::string_view cachedir)
+{
+	// the cached copy is keyed on the hash of the XML, so it has to be read anyway
+	std::vector<u8> xml(file.size());
+	if (!xml.empty() && (file.read(&xml[0], xml.size()) != xml.size()))
+	{
+		m_errors = string_format("Error reading file: %s\n", m_filename);
+		return;
+	}
+	std::string const key = util::sha1_creator::simple(xml.data(), xml.size()).as_string();
+	std::string const stamp = cache_stamp(file);
+
+	// the XML may only have been touched, in which case the copy just needs a new stamp
+	software_list_cache cache;
+	std::vector<u8> cached;
+	if (!util::core_file::load(util::path_concat(cachedir, m_list_name + ".slc"), cached) && cache.open(std::move(cached)) && (cache.key() == key) && cache.load_all(m_infolist))
+	{
+		m_shortname = cache.listname();
+		m_description = cache.description();
+		m_errors = cache.errors();
+		if (cache.stamp() != stamp)
+			save_cache(cachedir, key, stamp);
+		return;
+	}
+
+	// parse the XML from memory
+	std::ostringstream errs;
+	util::random_read::ptr const stream = util::ram_read(xml.data(), xml.size());
+	if (!stream)
+		throw std::bad_alloc();
+	parse_software_list(*stream, m_filename, m_shortname, m_description, m_infolist, errs);
+	m_errors = errs.str();
+	save_cache(cachedir, key, stamp);
+}
+
+
+//-------------------------------------------------
+//  open_cache - open the pre-parsed copy of our
+//  softlist file if its stamp shows it was made
+//  from the XML as it is now, without reading
+//  the XML
+//-------------------------------------------------
+
+bool software_list_device::open_cache()
+{
+	if (m_cache_checked)
+		return m_cache.is_open();
+	m_cache_checked = true;
+
+	char const *const cachedir = mconfig().options().softlist_cache();
+	if (!cachedir || !*cachedir)
+		return false;
+
+	emu_file file(mconfig().options().hash_path(), OPEN_FLAG_READ);
+	if (file.open(m_list_name + ".xml"))
+		return false;
+	std::string const stamp = cache_stamp(file);
+	if (stamp.empty())
+		return false;
+
+	std::vector<u8> cached;
+	if (util::core_file::load(util::path_concat(cachedir, m_list_name + ".slc"), cached) || !m_cache.open(std::move(cached)) || (m_cache.stamp() != stamp))
+	{
+		m_cache.close();
+		return false;
+	}
+
+	m_filename = file.filename();
+	m_shortname = m_cache.listname();
+	m_description = m_cache.description();
+	m_errors = m_cache.errors();
+	return true;
+}
+
+
+//-------------------------------------------------
+//  cache_stamp - identify the current state of
+//  our softlist file from its size and time, or
+//  return an empty string if they can't be found
+//-------------------------------------------------
+
+std::string software_list_device::cache_stamp(emu_file &file) const
+{
+	std::unique_ptr<osd::directory::entry> const entry = osd_stat(file.fullpath());
+	if (!entry || (entry->type != osd::directory::entry::entry_type::FILE))
+		return std::string();
+	return string_format("%u:%d", entry->size, entry->last_modified.time_since_epoch().count());
+}
+
+
+//-------------------------------------------------
+//  save_cache - save a pre-parsed copy of our
+//  softlist file
+//-------------------------------------------------
+
+void software_list_device::save_cache(std::string_view cachedir, std::string_view key, std::string_view stamp)
+{
+	// write a temporary file and rename it into place so readers never see half of it
+	std::vector<u8> const cached = save_software_list(key, stamp, m_shortname, m_description, m_errors, m_infolist);
+	std::string const cachepath = util::path_concat(cachedir, m_list_name + ".slc");
+	std::string const temppath = cachepath + ".new";
+	util::core_file::ptr cachefile;
+	if (!util::core_file::open(temppath, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, cachefile))
+	{
+		size_t actual;
+		std::error_condition const err = cachefile->write(cached.data(), cached.size(), actual);
+		cachefile.reset();
+		if (err || (actual != cached.size()))
+		{
+			osd_file::remove(temppath);
+		}
+		else if (std::rename(temppath.c_str(), cachepath.c_str()))
+		{
+			osd_file::remove(cachepath);
+			if (std::rename(temppath.c_str(), cachepath.c_str()))
+				osd_file::remove(temppath);
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  is_compatible - determine if we are compatible
 //  with the given software_list_device
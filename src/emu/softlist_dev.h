@@ -114,10 +114,11 @@ public:
 	bool is_compatible() const { return softlist_type::COMPATIBLE_SYSTEM == m_list_type; }
 	const char *filter() const { return m_filter; }
 
-	// getters that may trigger a parse
-	const std::string &description() { if (!m_parsed) parse(); return m_description; }
-	bool valid() { if (!m_parsed) parse(); return !m_infolist.empty(); }
-	const char *errors_string() { if (!m_parsed) parse(); return m_errors.c_str(); }
+	// getters that may trigger a parse; the first three are answered from
+	// the pre-parsed copy if there's an up-to-date one
+	const std::string &description() { if (!m_parsed && !open_cache()) parse(); return m_description; }
+	bool valid() { if (!m_parsed && open_cache()) return m_cache.size() != 0; if (!m_parsed) parse(); return !m_infolist.empty(); }
+	const char *errors_string() { if (!m_parsed && !open_cache()) parse(); return m_errors.c_str(); }
 	const std::list<software_info> &get_info() { if (!m_parsed) parse(); return m_infolist; }
 
 	// operations
@@ -140,6 +141,10 @@ protected:
 private:
 	// internal helpers
 	void parse();
+	void parse_cached(emu_file &file, std::string_view cachedir);
+	bool open_cache();
+	std::string cache_stamp(emu_file &file) const;
+	void save_cache(std::string_view cachedir, std::string_view key, std::string_view stamp);
 	void internal_validity_check(validity_checker &valid) ATTR_COLD;
 
 	// configuration state
@@ -154,6 +159,11 @@ private:
 	std::string                 m_description;
 	std::string                 m_errors;
 	std::list<software_info>    m_infolist;
+
+	// pre-parsed copy, and the entries restored from it one at a time
+	bool                        m_cache_checked;
+	software_list_cache         m_cache;
+	std::list<software_info>    m_cachedlist;
 };
 
 
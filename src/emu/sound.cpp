@@ -13,6 +13,7 @@
 #include "config.h"
 #include "emuopts.h"
 #include "main.h"
+#include "resample.h"
 #include "speaker.h"
 
 #include "wavwrite.h"
@@ -53,6 +54,7 @@ stream_buffer::stream_buffer(u32 sample_rate) :
 	m_end_sample(0),
 	m_sample_rate(sample_rate),
 	m_sample_attos((sample_rate == 0) ? ATTOSECONDS_PER_SECOND : ((ATTOSECONDS_PER_SECOND + sample_rate - 1) / sample_rate)),
+	m_silent_start(attotime::never),
 	m_buffer(sample_rate)
 {
 }
@@ -82,6 +84,9 @@ void stream_buffer::set_sample_rate(u32 rate, bool resample)
 	if (rate == m_sample_rate)
 		return;
 
+	// the resampled contents are no longer known to be silent
+	mark_sounding();
+
 	// force resampling off if coming to or from an invalid rate, or if we're at time 0 (startup)
 	sound_assert(rate >= SAMPLE_RATE_MINIMUM - 1);
 	if (rate < SAMPLE_RATE_MINIMUM || m_sample_rate < SAMPLE_RATE_MINIMUM || (m_end_second == 0 && m_end_sample == 0))
@@ -556,6 +561,8 @@ sound_stream::sound_stream(device_t &device, u32 inputs, u32 outputs, u32 output
 	m_output_adaptive(sample_rate == SAMPLE_RATE_OUTPUT_ADAPTIVE),
 	m_synchronous((flags & STREAM_SYNCHRONOUS) != 0),
 	m_resampling_disabled((flags & STREAM_DISABLE_INPUT_RESAMPLING) != 0),
+	m_parallel_safe((flags & STREAM_PARALLEL_SAFE) != 0),
+	m_silent(false),
 	m_sync_timer(nullptr),
 	m_last_update_end_time(attotime::zero),
 	m_input(inputs),
@@ -704,7 +711,7 @@ read_stream_view sound_stream::update_view(attotime start, attotime end, u32 out
 	if (start > end)
 		start = end;
 
-	auto profile = g_profiler.start(PROFILER_SOUND);
+	auto profile = g_profiler.start(PROFILER_SOUND, m_device.tag());
 
 	// reposition our start to coincide with the current buffer end
 	attotime update_start = m_output[outputnum].end_time();
@@ -732,14 +739,29 @@ read_stream_view sound_stream::update_view(attotime start, attotime end, u32 out
 				sound_assert(m_resampling_disabled || m_input_view[inputnum].sample_rate() == m_sample_rate);
 			}
 
+			if (m_silent)
+			{
+				// the device says it's silent: skip the callback and just produce
+				// zeros, noting it so that consumers can skip them too
+				for (unsigned int outindex = 0; outindex < m_output.size(); outindex++)
+				{
+					m_output_view[outindex].fill(0);
+					m_output[outindex].mark_silent(m_output_view[outindex].start_time());
+				}
+			}
+			else
+			{
 #if (SOUND_DEBUG)
-			// clear each output view to NANs before we call the callback
-			for (unsigned int outindex = 0; outindex < m_output.size(); outindex++)
-				m_output_view[outindex].fill(NAN);
+				// clear each output view to NANs before we call the callback
+				for (unsigned int outindex = 0; outindex < m_output.size(); outindex++)
+					m_output_view[outindex].fill(NAN);
 #endif
 
-			// if we have an extended callback, that's all we need
-			m_callback_ex(*this, m_input_view, m_output_view);
+				// if we have an extended callback, that's all we need
+				m_callback_ex(*this, m_input_view, m_output_view);
+				for (unsigned int outindex = 0; outindex < m_output.size(); outindex++)
+					m_output[outindex].mark_sounding();
+			}
 
 #if (SOUND_DEBUG)
 			// make sure everything was overwritten
@@ -858,7 +880,10 @@ void sound_stream::postload()
 {
 	// set the end time of all of our streams to the value saved in m_last_update_end_time
 	for (auto &output : m_output)
+	{
 		output.set_end_time(m_last_update_end_time);
+		output.mark_sounding();
+	}
 
 	// recompute the sample rate information
 	sample_rate_changed();
@@ -912,6 +937,7 @@ read_stream_view sound_stream::empty_view(attotime start, attotime end)
 	// if our dummy buffer doesn't match our sample rate, update and clear it
 	if (m_empty_buffer.sample_rate() != m_sample_rate)
 		m_empty_buffer.set_sample_rate(m_sample_rate, false);
+	m_empty_buffer.mark_silent(attotime::zero);
 
 	// allocate a write view so that it can expand, and convert back to a read view
 	// on the return
@@ -1000,59 +1026,32 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 	stream_buffer::sample_t srcpos = stream_buffer::sample_t(double(delta.attoseconds()) / double(rebased.sample_period_attoseconds()));
 	sound_assert(srcpos <= 1.0f);
 
-	// input is undersampled: point sample except where our sample period covers a boundary
-	s32 srcindex = 0;
-	if (step < 1.0)
+	// nothing to resample if the input is silent, including the latency samples
+	if (rebased.silent())
 	{
-		stream_buffer::sample_t cursample = rebased.get(srcindex++);
-		for ( ; dstindex < numsamples; dstindex++)
-		{
-			// if still within the current sample, just replicate
-			srcpos += step;
-			if (srcpos <= 1.0)
-				output.put(dstindex, cursample);
-
-			// if crossing a sample boundary, blend with the neighbor
-			else
-			{
-				srcpos -= 1.0;
-				sound_assert(srcpos <= step + 1e-5);
-				stream_buffer::sample_t prevsample = cursample;
-				cursample = rebased.get(srcindex++);
-				output.put(dstindex, stepinv * (prevsample * (step - srcpos) + srcpos * cursample));
-			}
-		}
-		sound_assert(srcindex <= rebased.samples());
+		output.fill(0, dstindex);
+		return;
 	}
 
-	// input is oversampled: sum the energy
-	else
-	{
-		float cursample = rebased.get(srcindex++);
-		for ( ; dstindex < numsamples; dstindex++)
-		{
-			// compute the partial first sample and advance
-			stream_buffer::sample_t scale = 1.0 - srcpos;
-			stream_buffer::sample_t sample = cursample * scale;
+	// linearize the input, then resample into a linear output and store
+	// that; the kernels compute each sample's position directly, so runs
+	// of them can be done at once
+	u32 const srccount = rebased.samples();
+	s32 const count = numsamples - dstindex;
+	sound_assert(srccount > 0);
+	m_input.resize(srccount);
+	m_output.resize(count);
+	rebased.get_span(0, srccount, &m_input[0]);
 
-			// add in complete samples until we only have a fraction left
-			stream_buffer::sample_t remaining = step - scale;
-			while (remaining >= 1.0)
-			{
-				sample += rebased.get(srcindex++);
-				remaining -= 1.0;
-			}
+	// input is undersampled: point sample except where our sample period covers a boundary
+	if (step < 1.0)
+		resample_up(&m_output[0], count, &m_input[0], srccount, srcpos, step, stepinv);
 
-			// add in the final partial sample
-			cursample = rebased.get(srcindex++);
-			sample += cursample * remaining;
-			output.put(dstindex, sample * stepinv);
+	// input is oversampled: sum the energy
+	else
+		resample_down(&m_output[0], count, &m_input[0], srccount, srcpos, step, stepinv);
 
-			// our position is now the remainder
-			srcpos = remaining;
-			sound_assert(srcindex <= rebased.samples());
-		}
-	}
+	output.put_span(dstindex, count, &m_output[0]);
 }
 
 
@@ -1080,9 +1079,11 @@ sound_manager::sound_manager(running_machine &machine) :
 	m_compressor_enabled(machine.options().compressor()),
 	m_muted(0),
 	m_nosound_mode(machine.osd().no_sound()),
+	m_speculative(false),
 	m_attenuation(0),
 	m_unique_id(0),
 	m_wavfile(),
+	m_stream_group_queue(nullptr),
 	m_first_reset(true)
 {
 	// count the mixers
@@ -1119,6 +1120,8 @@ sound_manager::sound_manager(running_machine &machine) :
 
 sound_manager::~sound_manager()
 {
+	if (m_stream_group_queue)
+		osd_work_queue_free(m_stream_group_queue);
 }
 
 
@@ -1183,6 +1186,17 @@ void sound_manager::set_attenuation(float attenuation)
 }
 
 
+//-------------------------------------------------
+//  output_status - fetch the OSD's audio output
+//  buffering state
+//-------------------------------------------------
+
+bool sound_manager::output_status(osd_audio_status &status) const
+{
+	return machine().osd().audio_status(status);
+}
+
+
 //-------------------------------------------------
 //  indexed_mixer_input - return the mixer
 //  device and input index of the global mixer
@@ -1258,6 +1272,181 @@ void sound_manager::recursive_remove_stream_from_orphan_list(sound_stream *which
 }
 
 
+//-------------------------------------------------
+//  build_stream_groups - split the streams
+//  feeding the speakers into subgraphs that share
+//  no streams, so they can be updated at the same
+//  time; streams read from several subgraphs are
+//  left to the final mix on this thread, peeling
+//  back from the speakers until the rest splits
+//-------------------------------------------------
+
+void sound_manager::build_stream_groups()
+{
+	m_stream_groups.clear();
+
+	// number the streams feeding the speakers, in allocation order
+	std::vector<sound_stream *> nodes;
+	std::unordered_map<sound_stream *, int> index;
+	for (auto &stream : m_stream_list)
+		if (m_orphan_stream_list.find(stream.get()) == m_orphan_stream_list.end())
+		{
+			index.emplace(stream.get(), int(nodes.size()));
+			nodes.push_back(stream.get());
+		}
+
+	// note who reads each one, and which belong to the same device, since they may share its state
+	std::vector<std::vector<int> > sources(nodes.size()), consumers(nodes.size()), peers(nodes.size());
+	std::unordered_map<device_t *, int> first_of_device;
+	for (int node = 0; node < nodes.size(); node++)
+	{
+		auto const first = first_of_device.emplace(&nodes[node]->device(), node);
+		if (!first.second)
+		{
+			peers[node].push_back(first.first->second);
+			peers[first.first->second].push_back(node);
+		}
+	}
+	for (int node = 0; node < nodes.size(); node++)
+		for (int inputnum = 0; inputnum < nodes[node]->input_count(); inputnum++)
+		{
+			auto &input = nodes[node]->input(inputnum);
+			if (input.valid())
+			{
+				auto const found = index.find(&input.source().stream());
+				if (found != index.end())
+				{
+					sources[node].push_back(found->second);
+					consumers[found->second].push_back(node);
+				}
+			}
+		}
+
+	// the speakers' own streams are always part of the final mix
+	std::vector<bool> final_mix(nodes.size(), false);
+	for (speaker_device &speaker : m_speakers)
+	{
+		int dummy;
+		sound_stream *const output = speaker.output_to_stream_output(0, dummy);
+		auto const found = output ? index.find(output) : index.end();
+		if (found != index.end())
+			final_mix[found->second] = true;
+	}
+
+	std::vector<int> group(nodes.size());
+	int groups;
+	while (true)
+	{
+		// label the connected subgraphs of what's left
+		std::fill(group.begin(), group.end(), -1);
+		groups = 0;
+		for (int node = 0; node < nodes.size(); node++)
+		{
+			if (final_mix[node] || (group[node] >= 0))
+				continue;
+			std::vector<int> pending(1, node);
+			group[node] = groups;
+			while (!pending.empty())
+			{
+				int const current = pending.back();
+				pending.pop_back();
+				for (auto const *const edges : { &sources[current], &consumers[current], &peers[current] })
+					for (int const other : *edges)
+						if (!final_mix[other] && (group[other] < 0))
+						{
+							group[other] = groups;
+							pending.push_back(other);
+						}
+			}
+			groups++;
+		}
+		if (groups != 1)
+			break;
+
+		// a single subgraph: move the streams only the final mix reads into it
+		bool peeled = false;
+		for (int node = 0; node < nodes.size(); node++)
+			if (!final_mix[node] && !consumers[node].empty() && std::all_of(consumers[node].begin(), consumers[node].end(), [&final_mix] (int other) { return final_mix[other]; }))
+				final_mix[node] = peeled = true;
+		if (!peeled)
+			break;
+	}
+	if (groups < 2)
+		return;
+
+	// each group updates the streams the final mix reads, and can run on a worker if all its handlers allow it
+	m_stream_groups.resize(groups);
+	for (stream_group &g : m_stream_groups)
+		g.parallel = true;
+	for (int node = 0; node < nodes.size(); node++)
+	{
+		if (final_mix[node])
+			continue;
+		stream_group &g = m_stream_groups[group[node]];
+		g.parallel = g.parallel && nodes[node]->parallel_safe();
+		if (std::any_of(consumers[node].begin(), consumers[node].end(), [&final_mix] (int other) { return final_mix[other]; }))
+			g.sinks.push_back(nodes[node]);
+	}
+	if (std::none_of(m_stream_groups.begin(), m_stream_groups.end(), [] (stream_group const &g) { return g.parallel; }))
+	{
+		m_stream_groups.clear();
+		return;
+	}
+
+	osd_printf_verbose("Sound: %d independent stream groups, %d on worker threads\n",
+			groups,
+			int(std::count_if(m_stream_groups.begin(), m_stream_groups.end(), [] (stream_group const &g) { return g.parallel; })));
+	m_stream_group_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+}
+
+
+//-------------------------------------------------
+//  update_stream_group - work item to bring one
+//  group of streams up to date
+//-------------------------------------------------
+
+void *sound_manager::update_stream_group(void *param, int threadid)
+{
+	stream_group &g = *reinterpret_cast<stream_group *>(param);
+	for (sound_stream *stream : g.sinks)
+		stream->update_view(g.end, g.end);
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  update_stream_groups - bring the independent
+//  groups up to the end of this update, so the
+//  final mix finds them done; every stream still
+//  generates exactly the samples it would have
+//  in a serial update, so the output is the same
+//-------------------------------------------------
+
+void sound_manager::update_stream_groups(attotime end)
+{
+	// queue the groups that can go to workers, keeping one back for this thread if they all can
+	bool const all_parallel = std::all_of(m_stream_groups.begin(), m_stream_groups.end(), [] (stream_group const &g) { return g.parallel; });
+	stream_group *local = nullptr;
+	for (stream_group &g : m_stream_groups)
+	{
+		g.end = end;
+		if (!g.parallel)
+			continue;
+		if (all_parallel && !local)
+			local = &g;
+		else
+			osd_work_item_queue(m_stream_group_queue, &sound_manager::update_stream_group, &g, WORK_ITEM_FLAG_AUTO_RELEASE);
+	}
+
+	// the others run here, while the workers get on with theirs
+	for (stream_group &g : m_stream_groups)
+		if (!g.parallel || (&g == local))
+			update_stream_group(&g, 0);
+	while (!osd_work_queue_wait(m_stream_group_queue, osd_ticks_per_second()))
+		;
+}
+
+
 //-------------------------------------------------
 //  apply_sample_rate_changes - recursively
 //  update sample rates throughout the system
@@ -1314,6 +1503,9 @@ void sound_manager::reset()
 			m_speakers.emplace_back(speaker);
 		}
 
+		// find the parts of the graph that can be updated independently
+		build_stream_groups();
+
 #if (SOUND_DEBUG)
 		// dump the sound graph when we start up
 		for (speaker_device &speaker : speaker_device_enumerator(machine().root_device()))
@@ -1529,10 +1721,25 @@ void sound_manager::update(s32 param)
 	std::fill_n(&m_leftmix[0], m_samples_this_update, 0);
 	std::fill_n(&m_rightmix[0], m_samples_this_update, 0);
 
+	// bring independent parts of the graph up to date on worker threads first
+	if (!m_stream_groups.empty() && !g_profiler.enabled() && !(machine().debug_flags & DEBUG_FLAG_ENABLED))
+		update_stream_groups(endtime);
+
 	// force all the speaker streams to generate the proper number of samples
 	for (speaker_device &speaker : m_speakers)
 		speaker.mix(&m_leftmix[0], &m_rightmix[0], m_last_update, endtime, m_samples_this_update, (m_muted & MUTE_REASON_SYSTEM));
 
+	// if we're running ahead, the streams are up to date and the samples get thrown away
+	if (m_speculative)
+	{
+		for (auto &stream : m_orphan_stream_list)
+			stream.first->update();
+		m_last_update = endtime;
+		m_update_number++;
+		apply_sample_rate_changes();
+		return;
+	}
+
 	// determine the maximum in this section
 	stream_buffer::sample_t curmax = 0;
 	for (int sampindex = 0; sampindex < m_samples_this_update; sampindex++)
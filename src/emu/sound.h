@@ -146,6 +146,16 @@ private:
 		m_end_sample = u32(time.attoseconds() / m_sample_attos);
 	}
 
+	// return the time from which everything in the buffer is silent, or
+	// attotime::never if the latest samples may be sounding
+	attotime silent_start() const { return m_silent_start; }
+
+	// note that the samples from the given time to the end are silent
+	void mark_silent(attotime start) { if (start < m_silent_start) m_silent_start = start; }
+
+	// note that the latest samples may be sounding
+	void mark_sounding() { m_silent_start = attotime::never; }
+
 	// return the effective buffer size; currently it is a full second of audio
 	// at the current sample rate, but this maybe change in the future
 	u32 size() const { return m_sample_rate; }
@@ -187,6 +197,9 @@ private:
 	// fill the buffer with the given value
 	void fill(sample_t value) { std::fill_n(&m_buffer[0], m_buffer.size(), value); }
 
+	// return the memory the samples occupy
+	size_t bytes() const { return m_buffer.size() * sizeof(sample_t); }
+
 	// return the attotime of a given index within the buffer
 	attotime index_time(s32 index) const;
 
@@ -204,6 +217,7 @@ private:
 	u32 m_end_sample;                     // current sample number within the final second
 	u32 m_sample_rate;                    // sample rate of the data in the buffer
 	attoseconds_t m_sample_attos;         // pre-computed attoseconds per sample
+	attotime m_silent_start;              // start of the trailing run of silence, if any
 	std::vector<sample_t> m_buffer;       // vector of actual buffer data
 
 #if (SOUND_DEBUG)
@@ -301,6 +315,9 @@ public:
 	attotime start_time() const { return m_buffer->index_time(m_start); }
 	attotime end_time() const { return m_buffer->index_time(m_end); }
 
+	// is every sample in the view known to be zero?
+	bool silent() const { return (m_gain == 0) || (start_time() >= m_buffer->silent_start()); }
+
 	// set the gain
 	read_stream_view &set_gain(float gain) { m_gain = gain; return *this; }
 
@@ -317,6 +334,34 @@ public:
 		return m_buffer->get(index) * m_gain;
 	}
 
+	// fetch a run of gain-scaled samples into a linear buffer
+	void get_span(s32 index, s32 count, sample_t *dest) const
+	{
+		while (count > 0)
+		{
+			s32 run = count;
+			sample_t const *const src = raw_span(index, run);
+			for (s32 sampindex = 0; sampindex < run; sampindex++)
+				dest[sampindex] = src[sampindex] * m_gain;
+			index += run;
+			dest += run;
+			count -= run;
+		}
+	}
+
+	// return a pointer to the raw samples from the given index, reducing
+	// count to the number that follow contiguously in the buffer; if you
+	// use this, you need to apply the gain yourself for correctness
+	sample_t const *raw_span(s32 index, s32 &count) const
+	{
+		sound_assert(index >= 0 && u32(index + count) <= samples());
+		index += m_start;
+		if (index >= m_buffer->size())
+			index -= m_buffer->size();
+		count = std::min<s32>(count, m_buffer->size() - index);
+		return &m_buffer->m_buffer[index];
+	}
+
 	// safely fetch a raw sample from the buffer; if you use this, you need to
 	// apply the gain yourself for correctness
 	sample_t getraw(s32 index) const
@@ -377,6 +422,12 @@ public:
 		m_buffer->put(index_to_buffer_index(start), sample);
 	}
 
+	// write a run of samples from a linear buffer
+	void put_span(s32 start, s32 count, sample_t const *src)
+	{
+		process(start, count, src, [] (sample_t *dest, sample_t const *src, s32 run) { std::copy_n(src, run, dest); });
+	}
+
 	// write a sample to the buffer, clamping to +/- the clamp value
 	void put_clamp(s32 index, sample_t sample, sample_t clamp = 1.0)
 	{
@@ -411,16 +462,28 @@ public:
 		add(index, sample_t(sample) * (1.0f / sample_t(max)));
 	}
 
+	// add a run of samples from a linear buffer to our current values
+	void add_span(s32 start, s32 count, sample_t const *src)
+	{
+		process(start, count, src,
+				[] (sample_t *dest, sample_t const *src, s32 run)
+				{
+					for (s32 sampindex = 0; sampindex < run; sampindex++)
+						dest[sampindex] += src[sampindex];
+				});
+	}
+
 	// fill part of the view with the given value
 	void fill(sample_t value, s32 start, s32 count)
 	{
 		if (start + count > samples())
 			count = samples() - start;
-		u32 index = index_to_buffer_index(start);
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
+		while (count > 0)
 		{
-			m_buffer->put(index, value);
-			index = m_buffer->next_index(index);
+			s32 run = count;
+			std::fill_n(span(start, run), run, value);
+			start += run;
+			count -= run;
 		}
 	}
 	void fill(sample_t value, s32 start) { fill(value, start, samples() - start); }
@@ -429,33 +492,55 @@ public:
 	// copy data from another view
 	void copy(read_stream_view const &src, s32 start, s32 count)
 	{
-		if (start + count > samples())
-			count = samples() - start;
-		u32 index = index_to_buffer_index(start);
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
-		{
-			m_buffer->put(index, src.get(start + sampindex));
-			index = m_buffer->next_index(index);
-		}
+		process(src, start, count,
+				[gain = src.gain()] (sample_t *dest, sample_t const *src, s32 run)
+				{
+					for (s32 sampindex = 0; sampindex < run; sampindex++)
+						dest[sampindex] = src[sampindex] * gain;
+				});
 	}
 	void copy(read_stream_view const &src, s32 start) { copy(src, start, samples() - start); }
 	void copy(read_stream_view const &src) { copy(src, 0, samples()); }
 
+	// copy data from another view, scaled by an additional factor
+	void copy_scaled(read_stream_view const &src, sample_t scale, s32 start, s32 count)
+	{
+		process(src, start, count,
+				[gain = src.gain(), scale] (sample_t *dest, sample_t const *src, s32 run)
+				{
+					for (s32 sampindex = 0; sampindex < run; sampindex++)
+						dest[sampindex] = (src[sampindex] * gain) * scale;
+				});
+	}
+	void copy_scaled(read_stream_view const &src, sample_t scale, s32 start) { copy_scaled(src, scale, start, samples() - start); }
+	void copy_scaled(read_stream_view const &src, sample_t scale) { copy_scaled(src, scale, 0, samples()); }
+
 	// add data from another view to our current values
 	void add(read_stream_view const &src, s32 start, s32 count)
 	{
-		if (start + count > samples())
-			count = samples() - start;
-		u32 index = index_to_buffer_index(start);
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
-		{
-			m_buffer->put(index, m_buffer->get(index) + src.get(start + sampindex));
-			index = m_buffer->next_index(index);
-		}
+		process(src, start, count,
+				[gain = src.gain()] (sample_t *dest, sample_t const *src, s32 run)
+				{
+					for (s32 sampindex = 0; sampindex < run; sampindex++)
+						dest[sampindex] += src[sampindex] * gain;
+				});
 	}
 	void add(read_stream_view const &src, s32 start) { add(src, start, samples() - start); }
 	void add(read_stream_view const &src) { add(src, 0, samples()); }
 
+	// add data from another view, scaled by an additional factor, to our current values
+	void mix_scaled(read_stream_view const &src, sample_t scale, s32 start, s32 count)
+	{
+		process(src, start, count,
+				[gain = src.gain(), scale] (sample_t *dest, sample_t const *src, s32 run)
+				{
+					for (s32 sampindex = 0; sampindex < run; sampindex++)
+						dest[sampindex] += (src[sampindex] * gain) * scale;
+				});
+	}
+	void mix_scaled(read_stream_view const &src, sample_t scale, s32 start) { mix_scaled(src, scale, start, samples() - start); }
+	void mix_scaled(read_stream_view const &src, sample_t scale) { mix_scaled(src, scale, 0, samples()); }
+
 private:
 	// given a stream starting offset, return the buffer index
 	u32 index_to_buffer_index(s32 start) const
@@ -465,6 +550,50 @@ private:
 			index -= m_buffer->size();
 		return index;
 	}
+
+	// return a pointer to the samples from the given offset, reducing count
+	// to the number that follow contiguously in the buffer
+	sample_t *span(s32 start, s32 &count)
+	{
+		sound_assert(start >= 0 && u32(start + count) <= samples());
+		u32 const index = index_to_buffer_index(start);
+		count = std::min<s32>(count, m_buffer->size() - index);
+		return &m_buffer->m_buffer[index];
+	}
+
+	// apply an operation to runs of samples that are contiguous both here
+	// and in a linear source buffer
+	template <typename Op>
+	void process(s32 start, s32 count, sample_t const *src, Op &&op)
+	{
+		while (count > 0)
+		{
+			s32 run = count;
+			sample_t *const dest = span(start, run);
+			op(dest, src, run);
+			start += run;
+			src += run;
+			count -= run;
+		}
+	}
+
+	// apply an operation to runs of samples that are contiguous both here
+	// and in the same range of another view
+	template <typename Op>
+	void process(read_stream_view const &src, s32 start, s32 count, Op &&op)
+	{
+		if (start + count > samples())
+			count = samples() - start;
+		while (count > 0)
+		{
+			s32 run = count;
+			sample_t *const dest = span(start, run);
+			sample_t const *const source = src.raw_span(start, run);
+			op(dest, source, run);
+			start += run;
+			count -= run;
+		}
+	}
 };
 
 
@@ -493,6 +622,7 @@ public:
 	u32 index() const { return m_index; }
 	stream_buffer::sample_t gain() const { return m_gain; }
 	u32 buffer_sample_rate() const { return m_buffer.sample_rate(); }
+	size_t buffer_bytes() const { return m_buffer.bytes(); }
 
 	// simple setters
 	void set_gain(float gain) { m_gain = gain; }
@@ -509,6 +639,10 @@ public:
 	// resync the buffer to the given end time
 	void set_end_time(attotime end) { m_buffer.set_end_time(end); }
 
+	// note whether the buffer's latest samples are known to be silent
+	void mark_silent(attotime start) { m_buffer.mark_silent(start); }
+	void mark_sounding() { m_buffer.mark_sounding(); }
+
 	// attempt to optimize resamplers by reusing them where possible
 	sound_stream_output &optimize_resampler(sound_stream_output *input_resampler);
 
@@ -596,7 +730,12 @@ enum sound_stream_flags : u32
 
 	// specify that input streams should not be resampled; stream update handler
 	// must be able to accommodate multiple strams of differing input rates
-	STREAM_DISABLE_INPUT_RESAMPLING = 0x02
+	STREAM_DISABLE_INPUT_RESAMPLING = 0x02,
+
+	// specify that the update handler may run on a worker thread alongside
+	// other streams; only for handlers that touch nothing but their own
+	// device's state (including its own ROM and memory spaces)
+	STREAM_PARALLEL_SAFE = 0x04
 };
 
 
@@ -622,6 +761,8 @@ public:
 	bool output_adaptive() const { return m_output_adaptive; }
 	bool synchronous() const { return m_synchronous; }
 	bool resampling_disabled() const { return m_resampling_disabled; }
+	bool parallel_safe() const { return m_parallel_safe && !m_synchronous; }
+	bool silent() const { return m_silent; }
 
 	// input and output getters
 	u32 input_count() const { return m_input.size(); }
@@ -639,6 +780,11 @@ public:
 	// set the sample rate of the stream; will kick in at the next global update
 	void set_sample_rate(u32 sample_rate);
 
+	// tell the stream whether its device is making any sound; while it isn't,
+	// updates produce zeros without calling the update handler, so bring the
+	// stream up to date before changing this
+	void set_silent(bool silent) { m_silent = silent; }
+
 	// connect the output 'outputnum' of given input_stream to this stream's input 'inputnum'
 	void set_input(int inputnum, sound_stream *input_stream, int outputnum = 0, float gain = 1.0f);
 
@@ -694,6 +840,8 @@ private:
 	bool m_output_adaptive;                        // adaptive stream that runs at the sample rate of its output
 	bool m_synchronous;                            // synchronous stream that runs at the rate of its input
 	bool m_resampling_disabled;                    // is resampling of input streams disabled?
+	bool m_parallel_safe;                          // can the update handler run on a worker thread?
+	bool m_silent;                                 // is the device known to be silent?
 	emu_timer *m_sync_timer;                       // update timer for synchronous streams
 
 	attotime m_last_update_end_time;               // last end_time() in update
@@ -714,6 +862,70 @@ private:
 };
 
 
+// ======================> sound_voice_mask
+
+// tracks which voices of a multi-voice sound chip are sounding, so that
+// updates can visit only those and the stream can be marked silent when
+// there are none
+template <unsigned Voices>
+class sound_voice_mask
+{
+	static_assert(Voices > 0 && Voices <= 64, "sound_voice_mask supports 1 to 64 voices");
+
+public:
+	// voice state
+	void set(unsigned voice, bool active = true) { if (active) m_mask |= u64(1) << voice; else clear(voice); }
+	void clear(unsigned voice) { m_mask &= ~(u64(1) << voice); }
+	void reset() { m_mask = 0; }
+	bool test(unsigned voice) const { return BIT(m_mask, voice); }
+	bool any() const { return m_mask != 0; }
+	u64 bits() const { return m_mask; }
+
+	// call 'func' with the index of each active voice, lowest first
+	template <typename T> void for_each(T &&func) const
+	{
+		for (u64 mask = m_mask; mask != 0; mask &= mask - 1)
+			func(unsigned(63 - count_leading_zeros_64(mask & (~mask + 1))));
+	}
+
+	// mark the stream silent if nothing is sounding; the stream must
+	// already be up to date
+	void apply(sound_stream &stream) const { stream.set_silent(!any()); }
+
+private:
+	u64 m_mask = 0;
+};
+
+
+// ======================> sound_render_runs
+
+// number of further steps of 'step' that leave a position 'distance'
+// short of a boundary still short of it; a voice can be rendered that
+// many samples without checking for loop ends or other events at the
+// boundary, and a zero step never reaches it
+template <typename T>
+constexpr T sound_steps_before(T distance, T step)
+{
+	return (distance <= 0) ? T(0) : (step == 0) ? std::numeric_limits<T>::max() : T((distance - 1) / step);
+}
+
+// render 'samples' samples of a voice as runs that need no per-sample
+// checks, separated by single samples that do: 'run(index, count)' renders
+// as many of the 'count' samples from 'index' as it can without checks
+// (possibly none) and returns how many it did, and 'step(index)' renders
+// one sample the slow way
+template <typename Run, typename Step>
+void sound_render_runs(int samples, Run &&run, Step &&step)
+{
+	for (int index = 0; index < samples; )
+	{
+		index += run(index, samples - index);
+		if (index < samples)
+			step(index++);
+	}
+}
+
+
 // ======================> default_resampler_stream
 
 class default_resampler_stream : public sound_stream
@@ -728,6 +940,8 @@ public:
 private:
 	// internal state
 	u32 m_max_latency;
+	std::vector<stream_buffer::sample_t> m_input;   // linearized input samples
+	std::vector<stream_buffer::sample_t> m_output;  // resampled output samples
 };
 
 
@@ -754,6 +968,15 @@ class sound_manager
 	// stream updates
 	static const attotime STREAMS_UPDATE_ATTOTIME;
 
+	// a subgraph of streams that shares nothing with the others feeding
+	// the speakers, so it can be brought up to date on its own
+	struct stream_group
+	{
+		std::vector<sound_stream *> sinks;      // streams read from outside the group, in update order
+		bool parallel;                          // can the group run on a worker thread?
+		attotime end;                           // time to bring the group up to
+	};
+
 public:
 	static constexpr int STREAMS_UPDATE_FREQUENCY = 50;
 
@@ -782,6 +1005,9 @@ public:
 	// set the global OSD attenuation level
 	void set_attenuation(float attenuation);
 
+	// output buffering as measured by the OSD sound module, if it can
+	bool output_status(osd_audio_status &status) const;
+
 	// mute sound for one of various independent reasons
 	bool muted() const { return bool(m_muted); }
 	bool ui_mute() const { return bool(m_muted & MUTE_REASON_UI); }
@@ -791,6 +1017,9 @@ public:
 	void debugger_mute(bool turn_off) { mute(turn_off, MUTE_REASON_DEBUGGER); }
 	void system_mute(bool turn_off) { mute(turn_off, MUTE_REASON_SYSTEM); }
 
+	// while speculative, streams are updated but nothing is mixed down or output
+	void set_speculative(bool speculative) { m_speculative = speculative; }
+
 	// return information about the given mixer input, by index
 	bool indexed_mixer_input(int index, mixer_input &info) const;
 
@@ -804,6 +1033,11 @@ private:
 	// helper to remove items from the orphan list
 	void recursive_remove_stream_from_orphan_list(sound_stream *stream);
 
+	// parallel updates of independent parts of the graph
+	void build_stream_groups();
+	void update_stream_groups(attotime end);
+	static void *update_stream_group(void *param, int threadid);
+
 	// apply pending sample rate changes
 	void apply_sample_rate_changes();
 
@@ -843,6 +1077,7 @@ private:
 
 	u8 m_muted;                           // bitmask of muting reasons
 	bool m_nosound_mode;                  // true if we're in "nosound" mode
+	bool m_speculative;                   // true if we're running ahead, with the output to be thrown away
 	int m_attenuation;                    // current attentuation level (at the OSD)
 	int m_unique_id;                      // unique ID used for stream identification
 	util::wav_file_ptr m_wavfile;         // WAV file for streaming
@@ -850,6 +1085,8 @@ private:
 	// streams data
 	std::vector<std::unique_ptr<sound_stream>> m_stream_list; // list of streams
 	std::map<sound_stream *, u8> m_orphan_stream_list; // list of orphaned streams
+	std::vector<stream_group> m_stream_groups; // independent subgraphs, when there are several
+	osd_work_queue *m_stream_group_queue; // worker threads for updating them
 	bool m_first_reset;                   // is this our first reset?
 };
 
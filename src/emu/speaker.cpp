@@ -39,6 +39,8 @@ speaker_device::speaker_device(const machine_config &mconfig, const char *tag, d
 	, m_z(0.0)
 	, m_pan(0.0)
 	, m_defpan(0.0)
+	, m_left_gain(1.0)
+	, m_right_gain(1.0)
 	, m_current_max(0)
 	, m_samples_this_bucket(0)
 {
@@ -82,6 +84,19 @@ speaker_device &speaker_device::set_position(double x, double y, double z)
 }
 
 
+//-------------------------------------------------
+//  set_pan - set the pan position, and with it the
+//  gains into each side of the final mix
+//-------------------------------------------------
+
+void speaker_device::set_pan(float pan)
+{
+	m_pan = std::clamp(pan, -1.0f, 1.0f);
+	m_left_gain = (m_pan <= 0.0f) ? 1.0f : 1.0f - m_pan;
+	m_right_gain = (m_pan >= 0.0f) ? 1.0f : 1.0f + m_pan;
+}
+
+
 //-------------------------------------------------
 //  mix - mix in samples from the speaker's stream
 //-------------------------------------------------
@@ -116,31 +131,34 @@ void speaker_device::mix(stream_buffer::sample_t *leftmix, stream_buffer::sample
 		}
 	}
 
-	// mix if sound is enabled
-	if (!suppress)
+	// mix if sound is enabled and there's anything to mix
+	if (!suppress && !view.silent())
 	{
-		// if the speaker is hard panned to the left, send only to the left
-		if (m_pan == -1.0f)
-			for (int sample = 0; sample < expected_samples; sample++)
-				leftmix[sample] += view.get(sample);
-
-		// if the speaker is hard panned to the right, send only to the right
-		else if (m_pan == 1.0f)
-			for (int sample = 0; sample < expected_samples; sample++)
-				rightmix[sample] += view.get(sample);
-
-		// otherwise, send to both
-		else
+		// work directly on the contiguous runs of the buffer, doing both sides
+		// in one pass; hard-panned speakers only touch one side
+		stream_buffer::sample_t const gain = view.gain();
+		stream_buffer::sample_t const leftgain = m_left_gain;
+		stream_buffer::sample_t const rightgain = m_right_gain;
+		for (int sample = 0; sample < expected_samples; )
 		{
-			const float leftpan = (m_pan <= 0.0f) ? 1.0f : 1.0f - m_pan;
-			const float rightpan = (m_pan >= 0.0f) ? 1.0f : 1.0f + m_pan;
-
-			for (int sample = 0; sample < expected_samples; sample++)
-			{
-				stream_buffer::sample_t cursample = view.get(sample);
-				leftmix[sample] += cursample * leftpan;
-				rightmix[sample] += cursample * rightpan;
-			}
+			s32 run = expected_samples - sample;
+			stream_buffer::sample_t const *const src = view.raw_span(sample, run);
+			stream_buffer::sample_t *const left = leftmix + sample;
+			stream_buffer::sample_t *const right = rightmix + sample;
+			if (rightgain == 0.0f)
+				for (s32 index = 0; index < run; index++)
+					left[index] += src[index] * gain;
+			else if (leftgain == 0.0f)
+				for (s32 index = 0; index < run; index++)
+					right[index] += src[index] * gain;
+			else
+				for (s32 index = 0; index < run; index++)
+				{
+					stream_buffer::sample_t const cursample = src[index] * gain;
+					left[index] += cursample * leftgain;
+					right[index] += cursample * rightgain;
+				}
+			sample += run;
 		}
 	}
 }
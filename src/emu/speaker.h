@@ -72,7 +72,7 @@ public:
 	void mix(stream_buffer::sample_t *leftmix, stream_buffer::sample_t *rightmix, attotime start, attotime end, int expected_samples, bool suppress);
 
 	// user panning configuration
-	void set_pan(float pan) { m_pan = std::clamp(pan, -1.0f, 1.0f); }
+	void set_pan(float pan);
 	float pan() { return m_pan; }
 	float defpan() { return m_defpan; }
 
@@ -87,6 +87,8 @@ protected:
 	double m_z;
 	float m_pan;
 	float m_defpan;
+	stream_buffer::sample_t m_left_gain;    // gains into the final mix, derived from the pan
+	stream_buffer::sample_t m_right_gain;
 
 	// internal state
 	static constexpr int BUCKETS_PER_SECOND = 10;
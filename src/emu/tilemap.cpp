@@ -12,6 +12,13 @@
 #include "tilemap.h"
 
 #include "screen.h"
+#include "video/rozspan.h"
+
+// use SSE on 64-bit implementations, where it can be assumed
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define MAME_TILEMAP_SSE2
+#include <emmintrin.h>
+#endif
 
 
 //**************************************************************************
@@ -98,6 +105,132 @@ inline bool tilemap_t::gfx_elements_changed()
 }
 
 
+//**************************************************************************
+//  SCANLINE BLOCK HELPERS
+//**************************************************************************
+
+// The rasterizers below work on blocks of 16 pixels, using SIMD where it's
+// available to test the mask and update the priority bytes a block at a
+// time; the palette lookups for RGB destinations are still done a pixel at
+// a time, but blocks with nothing to draw are skipped outright.
+
+namespace {
+
+// pixels in a block that pass the mask test
+struct scanline_block
+{
+#if defined(MAME_TILEMAP_SSE2)
+	__m128i     sel;        // 0xff in each selected byte
+#endif
+	u32         bits;       // bit n set if pixel n is selected
+};
+
+
+//-------------------------------------------------
+//  scanline_match16 - select the pixels of a
+//  block for which (maskptr[i] & mask) == value
+//-------------------------------------------------
+
+inline scanline_block scanline_match16(const u8 *maskptr, u8 mask, u8 value)
+{
+	scanline_block result;
+#if defined(MAME_TILEMAP_SSE2)
+	__m128i const flags = _mm_loadu_si128(reinterpret_cast<const __m128i *>(maskptr));
+	result.sel = _mm_cmpeq_epi8(_mm_and_si128(flags, _mm_set1_epi8(char(mask))), _mm_set1_epi8(char(value)));
+	result.bits = _mm_movemask_epi8(result.sel);
+#else
+	result.bits = 0;
+	for (int i = 0; i < 16; i++)
+		result.bits |= u32((maskptr[i] & mask) == value) << i;
+#endif
+	return result;
+}
+
+
+//-------------------------------------------------
+//  scanline_priority16 - update the priority of a
+//  whole block, or of the selected pixels
+//-------------------------------------------------
+
+inline void scanline_priority16(u8 *pri, u32 pcode)
+{
+#if defined(MAME_TILEMAP_SSE2)
+	__m128i const data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pri));
+	__m128i const result = _mm_or_si128(_mm_and_si128(data, _mm_set1_epi8(char(u8(pcode >> 8)))), _mm_set1_epi8(char(u8(pcode))));
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(pri), result);
+#else
+	for (int i = 0; i < 16; i++)
+		pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+#endif
+}
+
+inline void scanline_priority16(u8 *pri, const scanline_block &block, u32 pcode)
+{
+#if defined(MAME_TILEMAP_SSE2)
+	__m128i const data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pri));
+	__m128i const result = _mm_or_si128(_mm_and_si128(data, _mm_set1_epi8(char(u8(pcode >> 8)))), _mm_set1_epi8(char(u8(pcode))));
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(pri), _mm_or_si128(_mm_and_si128(block.sel, result), _mm_andnot_si128(block.sel, data)));
+#else
+	for (int i = 0; i < 16; i++)
+		if (BIT(block.bits, i))
+			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+#endif
+}
+
+
+//-------------------------------------------------
+//  scanline_rebase16 - add 'pal' to a whole block
+//  of pens, or to the selected pixels
+//-------------------------------------------------
+
+inline void scanline_rebase16(u16 *dest, const u16 *source, int pal)
+{
+#if defined(MAME_TILEMAP_SSE2)
+	__m128i const vpal = _mm_set1_epi16(s16(u16(pal)));
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 0), _mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 0)), vpal));
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 8), _mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 8)), vpal));
+#else
+	for (int i = 0; i < 16; i++)
+		dest[i] = source[i] + pal;
+#endif
+}
+
+inline void scanline_rebase16(u16 *dest, const u16 *source, const scanline_block &block, int pal)
+{
+#if defined(MAME_TILEMAP_SSE2)
+	__m128i const vpal = _mm_set1_epi16(s16(u16(pal)));
+	__m128i const sel[2] = { _mm_unpacklo_epi8(block.sel, block.sel), _mm_unpackhi_epi8(block.sel, block.sel) };
+	for (int half = 0; half < 2; half++)
+	{
+		__m128i const data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dest + half * 8));
+		__m128i const pens = _mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source + half * 8)), vpal);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dest + half * 8), _mm_or_si128(_mm_and_si128(sel[half], pens), _mm_andnot_si128(sel[half], data)));
+	}
+#else
+	for (int i = 0; i < 16; i++)
+		if (BIT(block.bits, i))
+			dest[i] = source[i] + pal;
+#endif
+}
+
+//-------------------------------------------------
+//  scanline_priority - update the priority
+//  across a scanline
+//-------------------------------------------------
+
+inline void scanline_priority(u8 *pri, int count, u32 pcode)
+{
+	int i = 0;
+	for ( ; (i + 16) <= count; i += 16)
+		scanline_priority16(&pri[i], pcode);
+	for ( ; i < count; i++)
+		pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+}
+
+} // anonymous namespace
+
+
+
 //**************************************************************************
 //  SCANLINE RASTERIZERS
 //**************************************************************************
@@ -114,8 +247,7 @@ inline void tilemap_t::scanline_draw_opaque_null(int count, u8 *pri, u32 pcode)
 		return;
 
 	// update priority across the scanline
-	for (int i = 0; i < count; i++)
-		pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+	scanline_priority(pri, count, pcode);
 }
 
 
@@ -130,8 +262,20 @@ inline void tilemap_t::scanline_draw_masked_null(const u8 *maskptr, int mask, in
 	if (pcode == 0xff00)
 		return;
 
-	// update priority across the scanline, checking the mask
-	for (int i = 0; i < count; i++)
+	// update priority a block at a time; values that don't fit in a byte can never match
+	int i = 0;
+	if (u32(value) <= 0xff)
+	{
+		for ( ; (i + 16) <= count; i += 16)
+		{
+			scanline_block const block = scanline_match16(&maskptr[i], mask, value);
+			if (block.bits != 0)
+				scanline_priority16(&pri[i], block, pcode);
+		}
+	}
+
+	// update priority across the rest of the scanline, checking the mask
+	for ( ; i < count; i++)
 		if ((maskptr[i] & mask) == value)
 			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
 }
@@ -151,32 +295,19 @@ inline void tilemap_t::scanline_draw_opaque_ind16(u16 *dest, const u16 *source,
 	{
 		// use memcpy which should be well-optimized for the platform
 		memcpy(dest, source, count * 2);
-
-		// skip the rest if not changing priority
-		if (pcode == 0xff00)
-			return;
-
-		// update priority across the scanline
-		for (int i = 0; i < count; i++)
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
 	}
-
-	// priority case
-	else if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-		{
-			dest[i] = source[i] + pal;
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
-	}
-
-	// no priority case
 	else
 	{
-		for (int i = 0; i < count; i++)
+		int i = 0;
+		for ( ; (i + 16) <= count; i += 16)
+			scanline_rebase16(&dest[i], &source[i], pal);
+		for ( ; i < count; i++)
 			dest[i] = source[i] + pal;
 	}
+
+	// update priority across the scanline
+	if ((pcode & 0xffff) != 0xff00)
+		scanline_priority(pri, count, pcode);
 }
 
 
@@ -188,11 +319,27 @@ inline void tilemap_t::scanline_draw_opaque_ind16(u16 *dest, const u16 *source,
 inline void tilemap_t::scanline_draw_masked_ind16(u16 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, u8 *pri, u32 pcode)
 {
 	int pal = pcode >> 16;
+	bool const priority = (pcode & 0xffff) != 0xff00;
+
+	// draw a block at a time; values that don't fit in a byte can never match
+	int i = 0;
+	if (u32(value) <= 0xff)
+	{
+		for ( ; (i + 16) <= count; i += 16)
+		{
+			scanline_block const block = scanline_match16(&maskptr[i], mask, value);
+			if (block.bits == 0)
+				continue;
+			scanline_rebase16(&dest[i], &source[i], block, pal);
+			if (priority)
+				scanline_priority16(&pri[i], block, pcode);
+		}
+	}
 
 	// priority case
-	if ((pcode & 0xffff) != 0xff00)
+	if (priority)
 	{
-		for (int i = 0; i < count; i++)
+		for ( ; i < count; i++)
 			if ((maskptr[i] & mask) == value)
 			{
 				dest[i] = source[i] + pal;
@@ -203,7 +350,7 @@ inline void tilemap_t::scanline_draw_masked_ind16(u16 *dest, const u16 *source,
 	// no priority case
 	else
 	{
-		for (int i = 0; i < count; i++)
+		for ( ; i < count; i++)
 			if ((maskptr[i] & mask) == value)
 				dest[i] = source[i] + pal;
 	}
@@ -220,22 +367,12 @@ inline void tilemap_t::scanline_draw_opaque_rgb32(u32 *dest, const u16 *source,
 {
 	const rgb_t *clut = &pens[pcode >> 16];
 
-	// priority case
-	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-		{
-			dest[i] = clut[source[i]];
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
-	}
+	for (int i = 0; i < count; i++)
+		dest[i] = clut[source[i]];
 
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			dest[i] = clut[source[i]];
-	}
+	// update priority across the scanline
+	if ((pcode & 0xffff) != 0xff00)
+		scanline_priority(pri, count, pcode);
 }
 
 
@@ -247,11 +384,37 @@ inline void tilemap_t::scanline_draw_opaque_rgb32(u32 *dest, const u16 *source,
 inline void tilemap_t::scanline_draw_masked_rgb32(u32 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, const rgb_t *pens, u8 *pri, u32 pcode)
 {
 	const rgb_t *clut = &pens[pcode >> 16];
+	bool const priority = (pcode & 0xffff) != 0xff00;
+
+	// draw a block at a time; values that don't fit in a byte can never match
+	int i = 0;
+	if (u32(value) <= 0xff)
+	{
+		for ( ; (i + 16) <= count; i += 16)
+		{
+			scanline_block const block = scanline_match16(&maskptr[i], mask, value);
+			if (block.bits == 0)
+				continue;
+			if (block.bits == 0xffff)
+			{
+				for (int j = 0; j < 16; j++)
+					dest[i + j] = clut[source[i + j]];
+			}
+			else
+			{
+				for (int j = 0; j < 16; j++)
+					if (BIT(block.bits, j))
+						dest[i + j] = clut[source[i + j]];
+			}
+			if (priority)
+				scanline_priority16(&pri[i], block, pcode);
+		}
+	}
 
 	// priority case
-	if ((pcode & 0xffff) != 0xff00)
+	if (priority)
 	{
-		for (int i = 0; i < count; i++)
+		for ( ; i < count; i++)
 			if ((maskptr[i] & mask) == value)
 			{
 				dest[i] = clut[source[i]];
@@ -262,7 +425,7 @@ inline void tilemap_t::scanline_draw_masked_rgb32(u32 *dest, const u16 *source,
 	// no priority case
 	else
 	{
-		for (int i = 0; i < count; i++)
+		for ( ; i < count; i++)
 			if ((maskptr[i] & mask) == value)
 				dest[i] = clut[source[i]];
 	}
@@ -278,22 +441,12 @@ inline void tilemap_t::scanline_draw_opaque_rgb32_alpha(u32 *dest, const u16 *so
 {
 	const rgb_t *clut = &pens[pcode >> 16];
 
-	// priority case
-	if ((pcode & 0xffff) != 0xff00)
-	{
-		for (int i = 0; i < count; i++)
-		{
-			dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
-	}
+	for (int i = 0; i < count; i++)
+		dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
 
-	// no priority case
-	else
-	{
-		for (int i = 0; i < count; i++)
-			dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
-	}
+	// update priority across the scanline
+	if ((pcode & 0xffff) != 0xff00)
+		scanline_priority(pri, count, pcode);
 }
 
 
@@ -306,11 +459,29 @@ inline void tilemap_t::scanline_draw_opaque_rgb32_alpha(u32 *dest, const u16 *so
 inline void tilemap_t::scanline_draw_masked_rgb32_alpha(u32 *dest, const u16 *source, const u8 *maskptr, int mask, int value, int count, const rgb_t *pens, u8 *pri, u32 pcode, u8 alpha)
 {
 	const rgb_t *clut = &pens[pcode >> 16];
+	bool const priority = (pcode & 0xffff) != 0xff00;
+
+	// draw a block at a time; values that don't fit in a byte can never match
+	int i = 0;
+	if (u32(value) <= 0xff)
+	{
+		for ( ; (i + 16) <= count; i += 16)
+		{
+			scanline_block const block = scanline_match16(&maskptr[i], mask, value);
+			if (block.bits == 0)
+				continue;
+			for (int j = 0; j < 16; j++)
+				if (BIT(block.bits, j))
+					dest[i + j] = alpha_blend_r32(dest[i + j], clut[source[i + j]], alpha);
+			if (priority)
+				scanline_priority16(&pri[i], block, pcode);
+		}
+	}
 
 	// priority case
-	if ((pcode & 0xffff) != 0xff00)
+	if (priority)
 	{
-		for (int i = 0; i < count; i++)
+		for ( ; i < count; i++)
 			if ((maskptr[i] & mask) == value)
 			{
 				dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
@@ -321,7 +492,7 @@ inline void tilemap_t::scanline_draw_masked_rgb32_alpha(u32 *dest, const u16 *so
 	// no priority case
 	else
 	{
-		for (int i = 0; i < count; i++)
+		for ( ; i < count; i++)
 			if ((maskptr[i] & mask) == value)
 				dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
 	}
@@ -384,6 +555,13 @@ void tilemap_t::init_common(
 	m_gfx_used = 0;
 	memset(m_gfx_dirtyseq, 0, sizeof(m_gfx_dirtyseq));
 
+	// nothing has been drawn yet
+	m_pixmap_damage.set(0, -1, 0, -1);
+	m_damage_all = true;
+	m_damage_roz = false;
+	m_damage_shared = false;
+	m_damage_screen = nullptr;
+
 	// reset scroll information
 	m_scrollrows = 1;
 	m_scrollcols = 1;
@@ -491,6 +669,19 @@ tilemap_t::~tilemap_t()
 }
 
 
+//-------------------------------------------------
+//  allocated_bytes - return the memory held for
+//  the pixmap, flags and tile mappings
+//-------------------------------------------------
+
+size_t tilemap_t::allocated_bytes() const
+{
+	return m_pixmap.allocated_bytes() + m_flagsmap.allocated_bytes() + m_tileflags.size() +
+			(m_memory_to_logical.size() * sizeof(logical_index)) + (m_logical_to_memory.size() * sizeof(tilemap_memory_index)) +
+			((m_rowscroll.size() + m_colscroll.size()) * sizeof(s32));
+}
+
+
 //-------------------------------------------------
 //  mark_tile_dirty - mark a single tile dirty
 //  based on its memory index
@@ -814,6 +1005,13 @@ void tilemap_t::tile_update(logical_index logindex, u32 col, u32 row)
 	if ((flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && m_tileinfo.mask_data != nullptr)
 		m_tileflags[logindex] = tile_apply_bitmask(m_tileinfo.mask_data, x0, y0, m_tileinfo.category, flags);
 
+	// the tile's area of the pixmap needs to be drawn again
+	rectangle const tile(x0, x0 + m_tilewidth - 1, y0, y0 + m_tileheight - 1);
+	if (m_pixmap_damage.empty())
+		m_pixmap_damage = tile;
+	else
+		m_pixmap_damage |= tile;
+
 	// track which gfx have been used for this tilemap
 	if (m_tileinfo.gfxnum != 0xff && (m_gfx_used & (1 << m_tileinfo.gfxnum)) == 0)
 	{
@@ -991,7 +1189,10 @@ void tilemap_t::draw_common(screen_device &screen, _BitmapClass &dest, const rec
 {
 	// skip if disabled
 	if (!m_enable)
+	{
+		damage_reset(screen, false);
 		return;
+	}
 
 	auto profile = g_profiler.start(PROFILER_TILEMAP_DRAW);
 
@@ -1092,6 +1293,8 @@ void tilemap_t::draw_common(screen_device &screen, _BitmapClass &dest, const rec
 			}
 		}
 	}
+
+	damage_reset(screen, false);
 }
 
 void tilemap_t::draw(screen_device &screen, bitmap_ind16 &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask)
@@ -1119,7 +1322,10 @@ void tilemap_t::draw_roz_common(screen_device &screen, _BitmapClass &dest, const
 
 	// skip if disabled
 	if (!m_enable)
+	{
+		damage_reset(screen, false);
 		return;
+	}
 
 	// see if this is just a regular render and if so, do a regular render
 	if (incxx == (1 << 16) && incxy == 0 && incyx == 0 && incyy == (1 << 16) && wraparound)
@@ -1143,6 +1349,7 @@ void tilemap_t::draw_roz_common(screen_device &screen, _BitmapClass &dest, const
 
 	// then do the roz copy
 	draw_roz_core(screen, dest, blit, startx, starty, incxx, incxy, incyx, incyy, wraparound);
+	damage_reset(screen, true);
 }
 
 void tilemap_t::draw_roz(screen_device &screen, bitmap_ind16 &dest, const rectangle &cliprect,
@@ -1156,6 +1363,81 @@ void tilemap_t::draw_roz(screen_device &screen, bitmap_rgb32 &dest, const rectan
 { draw_roz_common(screen, dest, cliprect, startx, starty, incxx, incxy, incyx, incyy, wraparound, flags, priority, priority_mask); }
 
 
+//-------------------------------------------------
+//  damage_reset - note that the tilemap has just
+//  been drawn to a screen in its current state
+//-------------------------------------------------
+
+void tilemap_t::damage_reset(screen_device &screen, bool roz)
+{
+	// draws on worker threads mustn't write shared state
+	if (m_manager->m_parallel_draw)
+		return;
+
+	if (m_damage_screen && (m_damage_screen != &screen))
+		m_damage_shared = true;
+	m_damage_screen = &screen;
+	m_damage_roz = roz;
+	m_damage_all = false;
+	m_pixmap_damage.set(0, -1, 0, -1);
+}
+
+
+//-------------------------------------------------
+//  add_damage - add the visible rows of a screen
+//  that drawing the tilemap again would change;
+//  only full rows are reported, and anything
+//  besides tiles being redrawn in a tilemap
+//  with a single vertical scroll value damages
+//  the whole visible area
+//-------------------------------------------------
+
+void tilemap_t::add_damage(screen_device &screen, rectangle &damage)
+{
+	// tilemaps that haven't been drawn to this screen don't affect it
+	if ((m_damage_screen != &screen) && !m_damage_shared)
+		return;
+
+	// tilemaps that stayed disabled draw nothing
+	if (!m_enable && !m_damage_all)
+		return;
+
+	// render any dirty tiles now so they're counted
+	rectangle const visarea = screen.visible_area();
+	rectangle changed = visarea;
+	if (!m_damage_shared)
+		pixmap_update();
+	if (!m_damage_shared && !m_damage_all && !m_damage_roz && (m_scrollcols == 1))
+	{
+		if (m_pixmap_damage.empty())
+			return;
+
+		// map the redrawn pixmap rows to each place they wrap around to, as draw_common does
+		u32 const yextent = visarea.bottom() + visarea.top() + 1;
+		int const scrolly = effective_colscroll(0, yextent);
+		changed.sety(0, -1);
+		for (int ypos = scrolly - m_height; ypos <= visarea.bottom(); ypos += m_height)
+		{
+			rectangle span(visarea.left(), visarea.right(), m_pixmap_damage.top() + ypos, m_pixmap_damage.bottom() + ypos);
+			span &= visarea;
+			if (span.empty())
+				continue;
+			if (changed.empty())
+				changed = span;
+			else
+				changed |= span;
+		}
+		if (changed.empty())
+			return;
+	}
+
+	if (damage.empty())
+		damage = changed;
+	else
+		damage |= changed;
+}
+
+
 //-------------------------------------------------
 //  draw_instance - draw a single instance of the
 //  tilemap to the internal pixmap at the given
@@ -1333,6 +1615,23 @@ void tilemap_t::draw_instance(screen_device &screen, _BitmapClass &dest, const b
 }
 
 
+//-------------------------------------------------
+//  draw_roz_span - draw a run of ROZ pixels known
+//  to be inside the pixmap, or wrapped into it
+//-------------------------------------------------
+
+template <bool Wrap, typename PixelType>
+static inline void draw_roz_span(PixelType *dest, u8 *pri, u32 count, u32 cx, u32 cy, int incxx, int incxy, const roz_span_source &source, u8 mask, u8 value, u32 priority, const rgb_t *clut, u8 alpha)
+{
+	if constexpr (sizeof(PixelType) == 2)
+		roz_span_draw_ind16<Wrap>(dest, pri, count, cx, cy, incxx, incxy, source, mask, value, priority);
+	else if (alpha >= 0xff)
+		roz_span_draw<Wrap>(dest, pri, count, cx, cy, incxx, incxy, source, mask, value, priority, [clut] (PixelType &d, u16 pixel) { d = clut[pixel]; });
+	else
+		roz_span_draw<Wrap>(dest, pri, count, cx, cy, incxx, incxy, source, mask, value, priority, [clut, alpha] (PixelType &d, u16 pixel) { d = alpha_blend_r32(d, clut[pixel], alpha); });
+}
+
+
 //-------------------------------------------------
 //  tilemap_draw_roz_core - render the tilemap's
 //  pixmap to the destination with rotation
@@ -1356,8 +1655,6 @@ void tilemap_t::draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, c
 	// pre-cache all the inner loop values
 	const rgb_t *clut = m_palette->palette()->entry_list_adjusted() + (blit.tilemap_priority_code >> 16);
 	bitmap_ind8 &priority_bitmap = *blit.priority;
-	const int xmask = m_pixmap.width() - 1;
-	const int ymask = m_pixmap.height() - 1;
 	const int widthshifted = m_pixmap.width() << 16;
 	const int heightshifted = m_pixmap.height() << 16;
 	const u32 priority = blit.tilemap_priority_code;
@@ -1365,6 +1662,10 @@ void tilemap_t::draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, c
 	u8 value = blit.value;
 	u8 alpha = blit.alpha;
 
+	// the source as the span kernels see it
+	assert(m_pixmap.rowpixels() == m_flagsmap.rowpixels());
+	const roz_span_source source{ &m_pixmap.pix(0), &m_flagsmap.pix(0), u32(m_pixmap.rowpixels()), u32(m_pixmap.width()), u32(m_pixmap.height()) };
+
 	// pre-advance based on the cliprect
 	startx += blit.cliprect.left() * incxx + blit.cliprect.top() * incyx;
 	starty += blit.cliprect.left() * incxy + blit.cliprect.top() * incyy;
@@ -1406,6 +1707,14 @@ void tilemap_t::draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, c
 				const u8 *maskptr = &m_flagsmap.pix(cy);
 				typename _BitmapClass::pixel_t *dest = &destbitmap.pix(sy, sx);
 
+				// the run of columns inside the pixmap, unless X passes 2^32
+				u32 first, end;
+				if (roz_span_clip_axis(cx, incxx, widthshifted, ex - sx + 1, first, end) && !first)
+				{
+					draw_roz_span<false>(dest, pri, end, cx, starty, incxx, 0, source, mask, value, priority, clut, alpha);
+					x = ex + 1;
+				}
+
 				// loop over columns
 				while (x <= ex && cx < widthshifted)
 				{
@@ -1447,25 +1756,8 @@ void tilemap_t::draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, c
 			typename _BitmapClass::pixel_t *dest = &destbitmap.pix(sy, sx);
 			u8 *pri = (priority != 0xff00) ? &priority_bitmap.pix(sy, sx) : nullptr;
 
-			// loop over columns
-			while (x <= ex)
-			{
-				// plot if we match the mask
-				if ((m_flagsmap.pix((cy >> 16) & ymask, (cx >> 16) & xmask) & mask) == value)
-				{
-					ROZ_PLOT_PIXEL(m_pixmap.pix((cy >> 16) & ymask, (cx >> 16) & xmask));
-					if (priority != 0xff00)
-						*pri = (*pri & (priority >> 8)) | priority;
-				}
-
-				// advance in X
-				cx += incxx;
-				cy += incxy;
-				x++;
-				++dest;
-				if (priority != 0xff00)
-					pri++;
-			}
+			// wrapped coordinates are always inside
+			draw_roz_span<true>(dest, pri, ex - x + 1, cx, cy, incxx, incxy, source, mask, value, priority, clut, alpha);
 
 			// advance in Y
 			startx += incyx;
@@ -1489,6 +1781,15 @@ void tilemap_t::draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, c
 			typename _BitmapClass::pixel_t *dest = &destbitmap.pix(sy, sx);
 			u8 *pri = (priority != 0xff00) ? &priority_bitmap.pix(sy, sx) : nullptr;
 
+			// draw just the run of columns inside the pixmap, unless a
+			// coordinate passes 2^32 and the inside pixels aren't one run
+			u32 first, end;
+			if (roz_span_clip(cx, cy, incxx, incxy, source, ex - sx + 1, first, end))
+			{
+				draw_roz_span<false>(dest + first, pri ? (pri + first) : nullptr, end - first, cx + first * incxx, cy + first * incxy, incxx, incxy, source, mask, value, priority, clut, alpha);
+				x = ex + 1;
+			}
+
 			// loop over columns
 			while (x <= ex)
 			{
@@ -1585,7 +1886,8 @@ void tilemap_t::get_info_debug(u32 col, u32 row, u8 &gfxnum, u32 &code, u32 &col
 
 tilemap_manager::tilemap_manager(running_machine &machine)
 	: m_machine(machine),
-		m_instance(0)
+		m_instance(0),
+		m_parallel_draw(false)
 {
 }
 
@@ -1655,6 +1957,58 @@ void tilemap_manager::mark_all_dirty()
 }
 
 
+//-------------------------------------------------
+//  damage - return the visible rows of a screen
+//  that drawing its tilemaps again would change,
+//  or an empty rectangle if there are none
+//-------------------------------------------------
+
+rectangle tilemap_manager::damage(screen_device &screen)
+{
+	// watch every palette in use for colour changes
+	for (tilemap_t &tmap : m_tilemap_list)
+	{
+		palette_t *const palette = tmap.palette().palette();
+		auto const found = std::find_if(
+				m_damage_palettes.begin(),
+				m_damage_palettes.end(),
+				[palette] (std::unique_ptr<palette_client> const &client) { return &client->palette() == palette; });
+		if (found == m_damage_palettes.end())
+			m_damage_palettes.emplace_back(std::make_unique<palette_client>(*palette));
+	}
+
+	// a colour change damages every tilemap using the palette
+	for (std::unique_ptr<palette_client> const &client : m_damage_palettes)
+	{
+		u32 mindirty, maxdirty;
+		if (client->dirty_list(mindirty, maxdirty))
+			for (tilemap_t &tmap : m_tilemap_list)
+				if (tmap.palette().palette() == &client->palette())
+					tmap.m_damage_all = true;
+	}
+
+	rectangle result(0, -1, 0, -1);
+	for (tilemap_t &tmap : m_tilemap_list)
+		tmap.add_damage(screen, result);
+	return result;
+}
+
+
+//-------------------------------------------------
+//  begin_parallel_draw - render every dirty tile
+//  now, so that drawing only reads tilemap state
+//  until end_parallel_draw() is called
+//-------------------------------------------------
+
+void tilemap_manager::begin_parallel_draw()
+{
+	for (tilemap_t &tmap : m_tilemap_list)
+		if (tmap.enabled())
+			tmap.pixmap_update();
+	m_parallel_draw = true;
+}
+
+
 
 //**************************************************************************
 //  TILEMAP DEVICE
@@ -445,6 +445,8 @@ public:
 	u32 cols() const { return m_cols; }
 	u16 tilewidth() const { return m_tilewidth; }
 	u16 tileheight() const { return m_tileheight; }
+	device_t *device() const { return m_device; }
+	size_t allocated_bytes() const;
 	u32 width() const { return m_width; }
 	u32 height() const { return m_height; }
 	bool enabled() const { return m_enable; }
@@ -460,24 +462,27 @@ public:
 	void get_info_debug(u32 col, u32 row, u8 &gfxnum, u32 &code, u32 &color);
 
 	// setters
-	void enable(bool enable = true) { m_enable = enable; }
+	void enable(bool enable = true) { if (m_enable != enable) { m_enable = enable; m_damage_all = true; } }
 	void set_user_data(void *user_data) { m_user_data = user_data; }
-	void set_palette(device_palette_interface &palette) { m_palette = &palette; }
-	void set_palette_offset(u32 offset) { m_palette_offset = offset; }
-	void set_scrolldx(int dx, int dx_flipped) { m_dx = dx; m_dx_flipped = dx_flipped; }
-	void set_scrolldy(int dy, int dy_flipped) { m_dy = dy; m_dy_flipped = dy_flipped; }
-	void set_scrollx(int which, int value) { if (which < m_scrollrows) m_rowscroll[which] = value; }
-	void set_scrolly(int which, int value) { if (which < m_scrollcols) m_colscroll[which] = value; }
+	void set_palette(device_palette_interface &palette) { if (m_palette != &palette) { m_palette = &palette; m_damage_all = true; } }
+	void set_palette_offset(u32 offset) { if (m_palette_offset != offset) { m_palette_offset = offset; m_damage_all = true; } }
+	void set_scrolldx(int dx, int dx_flipped) { if ((m_dx != dx) || (m_dx_flipped != dx_flipped)) { m_dx = dx; m_dx_flipped = dx_flipped; m_damage_all = true; } }
+	void set_scrolldy(int dy, int dy_flipped) { if ((m_dy != dy) || (m_dy_flipped != dy_flipped)) { m_dy = dy; m_dy_flipped = dy_flipped; m_damage_all = true; } }
+	void set_scrollx(int which, int value) { if ((which < m_scrollrows) && (m_rowscroll[which] != value)) { m_rowscroll[which] = value; m_damage_all = true; } }
+	void set_scrolly(int which, int value) { if ((which < m_scrollcols) && (m_colscroll[which] != value)) { m_colscroll[which] = value; m_damage_all = true; } }
 	void set_scrollx(int value) { set_scrollx(0, value); }
 	void set_scrolly(int value) { set_scrolly(0, value); }
-	void set_scroll_rows(u32 scroll_rows) { assert(scroll_rows <= m_height); m_scrollrows = scroll_rows; }
-	void set_scroll_cols(u32 scroll_cols) { assert(scroll_cols <= m_width); m_scrollcols = scroll_cols; }
+	void set_scroll_rows(u32 scroll_rows) { assert(scroll_rows <= m_height); if (m_scrollrows != scroll_rows) { m_scrollrows = scroll_rows; m_damage_all = true; } }
+	void set_scroll_cols(u32 scroll_cols) { assert(scroll_cols <= m_width); if (m_scrollcols != scroll_cols) { m_scrollcols = scroll_cols; m_damage_all = true; } }
 	void set_flip(u32 attributes) { if (m_attributes != attributes) { m_attributes = attributes; mappings_update(); } }
 
 	// dirtying
 	void mark_mapping_dirty() { mappings_update(); }
 	void mark_tile_dirty(tilemap_memory_index memindex);
-	void mark_all_dirty() { m_all_tiles_dirty = true; m_all_tiles_clean = false; }
+	void mark_all_dirty() { m_all_tiles_dirty = true; m_all_tiles_clean = false; m_damage_all = true; }
+
+	// damage tracking
+	void add_damage(screen_device &screen, rectangle &damage);
 
 	// pen mapping
 	void map_pens_to_layer(int group, pen_t pen, pen_t mask, u8 layermask);
@@ -550,6 +555,7 @@ private:
 	// internal drawing
 	void pixmap_update();
 	void tile_update(logical_index logindex, u32 col, u32 row);
+	void damage_reset(screen_device &screen, bool roz);
 	u8 tile_draw(const u8 *pendata, u32 x0, u32 y0, u32 palette_base, u8 category, u8 group, u8 flags, u8 pen_mask);
 	u8 tile_apply_bitmask(const u8 *maskdata, u32 x0, u32 y0, u8 category, u8 flags);
 	void configure_blit_parameters(blit_parameters &blit, bitmap_ind8 &priority_bitmap, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
@@ -608,6 +614,13 @@ private:
 	bitmap_ind8                 m_flagsmap;             // per-pixel flags
 	std::vector<u8>             m_tileflags;            // per-tile flags
 	u8                          m_pen_to_flags[MAX_PEN_TO_FLAGS * TILEMAP_NUM_GROUPS]; // mapping of pens to flags
+
+	// damage tracking
+	rectangle                   m_pixmap_damage;        // pixmap area redrawn since the last draw
+	bool                        m_damage_all;           // true if anything besides tiles changed since the last draw
+	bool                        m_damage_roz;           // true if the last draw was rotated or zoomed
+	bool                        m_damage_shared;        // true if drawn to more than one screen
+	screen_device *             m_damage_screen;        // screen last drawn to, or nullptr if never drawn
 };
 
 
@@ -642,6 +655,13 @@ public:
 	void mark_all_dirty();
 	void set_flip_all(u32 attributes);
 
+	// visible rows of a screen with tilemap changes since it was last drawn
+	rectangle damage(screen_device &screen);
+
+	// bracket screen updates running on several threads at once
+	void begin_parallel_draw();
+	void end_parallel_draw() { m_parallel_draw = false; }
+
 private:
 	// tilemap creation
 	tilemap_t &create(device_gfx_interface &decoder, tilemap_get_info_delegate tile_get_info, tilemap_mapper_delegate mapper, u16 tilewidth, u16 tileheight, u32 cols, u32 rows, tilemap_t *allocated);
@@ -654,6 +674,8 @@ private:
 	running_machine &       m_machine;
 	simple_list<tilemap_t>  m_tilemap_list;
 	int                     m_instance;
+	bool                    m_parallel_draw;        // true while tilemaps may be drawn from several threads
+	std::vector<std::unique_ptr<palette_client>> m_damage_palettes; // one per palette in use, to see colour changes
 };
 
 
@@ -21,7 +21,13 @@
 #include "path.h"
 #include "unicode.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <thread>
 #include <type_traits>
 #include <typeinfo>
 
@@ -1742,6 +1748,9 @@ void validate_delegates_functoid()
 		osd_printf_error("Error testing delegate with functoid requiring adapter %p (expected %p)\n", addr, static_cast<void const *>(&cb1));
 }
 
+// checker collecting messages on the current worker thread
+thread_local validity_checker *s_worker = nullptr;
+
 } // anonymous namespace
 
 
@@ -1763,6 +1772,20 @@ inline int validity_checker::get_defstr_index(const char *string, bool suppress_
 
 
 
+//-------------------------------------------------
+//  already_checked - returns true if the string
+//  has been seen before, marking it as seen
+//-------------------------------------------------
+
+bool validity_checker::already_checked(const char *string)
+{
+	validity_checker &shared(m_master ? *m_master : *this);
+	std::lock_guard<std::mutex> lock(shared.m_shared_mutex);
+	return !shared.m_already_checked.insert(string).second;
+}
+
+
+
 //-------------------------------------------------
 //  validate_tag - ensure that the given tag
 //  meets the general requirements
@@ -1832,6 +1855,7 @@ validity_checker::validity_checker(emu_options &options, bool quick)
 	, m_current_ioport(nullptr)
 	, m_checking_card(false)
 	, m_quick(quick)
+	, m_master(nullptr)
 {
 	// pre-populate the defstr map with all the default strings
 	for (int strnum = 1; strnum < INPUT_STRING_COUNT; strnum++)
@@ -1842,6 +1866,22 @@ validity_checker::validity_checker(emu_options &options, bool quick)
 	}
 }
 
+
+validity_checker::validity_checker(validity_checker &master)
+	: m_drivlist(master.m_drivlist.options())
+	, m_errors(0)
+	, m_warnings(0)
+	, m_print_verbose(master.m_print_verbose)
+	, m_defstr_map(master.m_defstr_map)
+	, m_current_driver(nullptr)
+	, m_current_device(nullptr)
+	, m_current_ioport(nullptr)
+	, m_checking_card(false)
+	, m_quick(master.m_quick)
+	, m_master(&master)
+{
+}
+
 //-------------------------------------------------
 //  validity_checker - destructor
 //-------------------------------------------------
@@ -1875,10 +1915,12 @@ void validity_checker::check_shared_source(const game_driver &driver)
 	validate_begin();
 
 	// then iterate over all drivers and check the ones that share the same source file
+	std::vector<const game_driver *> drivers;
 	m_drivlist.reset();
 	while (m_drivlist.next())
 		if (strcmp(driver.type.source(), m_drivlist.driver().type.source()) == 0)
-			validate_one(m_drivlist.driver());
+			drivers.emplace_back(&m_drivlist.driver());
+	validate_drivers(drivers);
 
 	// cleanup
 	validate_end();
@@ -1915,16 +1957,15 @@ bool validity_checker::check_all_matching(const char *string)
 	}
 
 	// then iterate over all drivers and check them
+	std::vector<const game_driver *> drivers;
 	m_drivlist.reset();
-	bool validated_any = false;
 	while (m_drivlist.next())
 	{
 		if (driver_list::matches(string, m_drivlist.driver().name))
-		{
-			validate_one(m_drivlist.driver());
-			validated_any = true;
-		}
+			drivers.emplace_back(&m_drivlist.driver());
 	}
+	bool const validated_any = !drivers.empty();
+	validate_drivers(drivers);
 
 	// validate devices
 	if (!string)
@@ -1981,7 +2022,122 @@ void validity_checker::validate_end()
 
 
 //-------------------------------------------------
-//  validate_drivers - master validity checker
+//  validate_drivers - check a list of drivers,
+//  spreading the work over several threads
+//-------------------------------------------------
+
+void validity_checker::validate_drivers(const std::vector<const game_driver *> &drivers)
+{
+	// not worth starting threads for a single driver
+	std::size_t const threads = (std::min)(std::size_t(std::thread::hardware_concurrency()), drivers.size());
+	if (threads <= 1)
+	{
+		for (const game_driver *driver : drivers)
+			validate_one(*driver);
+		return;
+	}
+
+	// messages collected for each driver
+	struct driver_result
+	{
+		int                 errors = 0;
+		int                 warnings = 0;
+		std::string         error_text;
+		std::string         warning_text;
+		std::string         verbose_text;
+		std::exception_ptr  exception;
+		bool                done = false;
+	};
+	std::vector<driver_result> results(drivers.size());
+	std::mutex mutex;
+	std::condition_variable cond;
+	std::atomic<std::size_t> next(0);
+
+	// each thread checks drivers with its own state, taking them in order
+	std::vector<std::unique_ptr<validity_checker> > workers;
+	for (std::size_t i = 0; threads > i; ++i)
+		workers.emplace_back(new validity_checker(*this));
+	std::vector<std::future<void> > tasks;
+	for (auto &worker : workers)
+	{
+		tasks.emplace_back(std::async(
+				std::launch::async,
+				[&drivers, &results, &mutex, &cond, &next, checker = worker.get()] ()
+				{
+					s_worker = checker;
+					for (std::size_t index = next++; drivers.size() > index; index = next++)
+					{
+						driver_result &result(results[index]);
+						try
+						{
+							checker->m_errors = 0;
+							checker->m_warnings = 0;
+							checker->m_error_text.clear();
+							checker->m_warning_text.clear();
+							checker->m_verbose_text.clear();
+							checker->check_one(*drivers[index]);
+							result.errors = checker->m_errors;
+							result.warnings = checker->m_warnings;
+							result.error_text = std::move(checker->m_error_text);
+							result.warning_text = std::move(checker->m_warning_text);
+							result.verbose_text = std::move(checker->m_verbose_text);
+						}
+						catch (...)
+						{
+							result.exception = std::current_exception();
+						}
+						{
+							std::lock_guard<std::mutex> lock(mutex);
+							result.done = true;
+						}
+						cond.notify_all();
+					}
+					s_worker = nullptr;
+				}));
+	}
+
+	// merge the results in order, checking for duplicate names as we go
+	for (std::size_t index = 0; drivers.size() > index; ++index)
+	{
+		driver_result &result(results[index]);
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			cond.wait(lock, [&result] () { return result.done; });
+		}
+		if (result.exception)
+		{
+			next = drivers.size();
+			std::rethrow_exception(result.exception);
+		}
+
+		const game_driver &driver(*drivers[index]);
+		if (m_print_verbose)
+			output_via_delegate(OSD_OUTPUT_CHANNEL_ERROR, "Validating driver %s (%s)...\n", driver.name, core_filename_extract_base(driver.type.source()));
+
+		int const start_errors = m_errors;
+		int const start_warnings = m_warnings;
+		m_error_text.clear();
+		m_warning_text.clear();
+		m_verbose_text.clear();
+
+		m_current_driver = &driver;
+		validate_driver_names();
+		m_current_driver = nullptr;
+
+		m_errors += result.errors;
+		m_warnings += result.warnings;
+		m_error_text.append(result.error_text);
+		m_warning_text.append(result.warning_text);
+		m_verbose_text.append(result.verbose_text);
+		result = driver_result();
+		output_one(driver, start_errors, start_warnings);
+	}
+}
+
+
+//-------------------------------------------------
+//  validate_one - check a single driver and
+//  output the results
 //-------------------------------------------------
 
 void validity_checker::validate_one(const game_driver &driver)
@@ -1990,6 +2146,25 @@ void validity_checker::validate_one(const game_driver &driver)
 	if (m_print_verbose)
 		output_via_delegate(OSD_OUTPUT_CHANNEL_ERROR, "Validating driver %s (%s)...\n", driver.name, core_filename_extract_base(driver.type.source()));
 
+	// reset error/warning state
+	int start_errors = m_errors;
+	int start_warnings = m_warnings;
+	m_error_text.clear();
+	m_warning_text.clear();
+	m_verbose_text.clear();
+
+	check_one(driver);
+	output_one(driver, start_errors, start_warnings);
+}
+
+
+//-------------------------------------------------
+//  check_one - run the checks for a single
+//  driver, collecting messages
+//-------------------------------------------------
+
+void validity_checker::check_one(const game_driver &driver)
+{
 	// set the current driver
 	m_current_driver = &driver;
 	m_current_device = nullptr;
@@ -1998,13 +2173,6 @@ void validity_checker::validate_one(const game_driver &driver)
 	m_ioport_set.clear();
 	m_checking_card = false;
 
-	// reset error/warning state
-	int start_errors = m_errors;
-	int start_warnings = m_warnings;
-	m_error_text.clear();
-	m_warning_text.clear();
-	m_verbose_text.clear();
-
 	// wrap in try/catch to catch fatalerrors
 	try
 	{
@@ -2019,6 +2187,23 @@ void validity_checker::validate_one(const game_driver &driver)
 		osd_printf_error("Fatal error %s", err.what());
 	}
 
+	// reset the driver/device
+	m_current_driver = nullptr;
+	m_current_device = nullptr;
+	m_current_ioport = nullptr;
+	m_region_map.clear();
+	m_ioport_set.clear();
+	m_checking_card = false;
+}
+
+
+//-------------------------------------------------
+//  output_one - output messages collected for a
+//  driver
+//-------------------------------------------------
+
+void validity_checker::output_one(const game_driver &driver, int start_errors, int start_warnings)
+{
 	// if we had warnings or errors, output
 	if (m_errors > start_errors || m_warnings > start_warnings || !m_verbose_text.empty())
 	{
@@ -2033,23 +2218,15 @@ void validity_checker::validate_one(const game_driver &driver)
 			output_indented_errors(m_verbose_text, "Messages");
 		output_via_delegate(OSD_OUTPUT_CHANNEL_ERROR, "\n");
 	}
-
-	// reset the driver/device
-	m_current_driver = nullptr;
-	m_current_device = nullptr;
-	m_current_ioport = nullptr;
-	m_region_map.clear();
-	m_ioport_set.clear();
-	m_checking_card = false;
 }
 
 
 //-------------------------------------------------
-//  validate_driver - validate basic driver
-//  information
+//  validate_driver_names - check for duplicate
+//  driver names and descriptions
 //-------------------------------------------------
 
-void validity_checker::validate_driver(device_t &root)
+void validity_checker::validate_driver_names()
 {
 	// check for duplicate names
 	if (!m_names_map.insert(std::make_pair(m_current_driver->name, m_current_driver)).second)
@@ -2064,6 +2241,19 @@ void validity_checker::validate_driver(device_t &root)
 		const game_driver *match = m_descriptions_map.find(m_current_driver->type.fullname())->second;
 		osd_printf_error("Driver description is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
 	}
+}
+
+
+//-------------------------------------------------
+//  validate_driver - validate basic driver
+//  information
+//-------------------------------------------------
+
+void validity_checker::validate_driver(device_t &root)
+{
+	// parallel workers leave duplicate checks to the master
+	if (!m_master)
+		validate_driver_names();
 
 	// determine if we are a clone
 	bool is_clone = (strcmp(m_current_driver->parent, "0") != 0);
@@ -2665,8 +2855,13 @@ void validity_checker::validate_devices(machine_config &config)
 					continue;
 
 				// if we need to save time, instantiate and validate each slot card type at most once
-				if (m_quick && !m_slotcard_set.insert(option.second->devtype().shortname()).second)
-					continue;
+				if (m_quick)
+				{
+					validity_checker &shared(m_master ? *m_master : *this);
+					std::lock_guard<std::mutex> lock(shared.m_shared_mutex);
+					if (!shared.m_slotcard_set.insert(option.second->devtype().shortname()).second)
+						continue;
+				}
 
 				m_checking_card = true;
 				device_t *card;
@@ -2895,6 +3090,13 @@ void validity_checker::build_output_prefix(std::ostream &str) const
 
 void validity_checker::output_callback(osd_output_channel channel, const util::format_argument_pack<char> &args)
 {
+	// messages from worker threads belong to the driver being checked there
+	if (s_worker && (s_worker != this))
+	{
+		s_worker->output_callback(channel, args);
+		return;
+	}
+
 	std::ostringstream output;
 	switch (channel)
 	{
@@ -2935,7 +3137,7 @@ void validity_checker::output_callback(osd_output_channel channel, const util::f
 		break;
 
 	default:
-		chain_output(channel, args);
+		(m_master ? m_master : this)->chain_output(channel, args);
 		break;
 	}
 }
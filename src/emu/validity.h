@@ -16,6 +16,9 @@
 #include "drivenum.h"
 #include "emuopts.h"
 
+#include <mutex>
+#include <vector>
+
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -47,7 +50,7 @@ public:
 	bool ioport_missing(const char *tag) { return !m_checking_card && (m_ioport_set.find(tag) == m_ioport_set.end()); }
 
 	// generic registry of already-checked stuff
-	bool already_checked(const char *string) { return !m_already_checked.insert(string).second; }
+	bool already_checked(const char *string);
 
 protected:
 	// osd_output interface
@@ -59,15 +62,22 @@ private:
 	using int_map = std::unordered_map<std::string, uintptr_t>;
 	using string_set = std::unordered_set<std::string>;
 
+	// worker for checking drivers in parallel
+	validity_checker(validity_checker &master);
+
 	// internal helpers
 	int get_defstr_index(const char *string, bool suppress_error = false);
 
 	// core helpers
 	void validate_begin();
 	void validate_end();
+	void validate_drivers(const std::vector<const game_driver *> &drivers);
 	void validate_one(const game_driver &driver);
+	void check_one(const game_driver &driver);
+	void output_one(const game_driver &driver, int start_errors, int start_warnings);
 
 	// internal sub-checks
+	void validate_driver_names();
 	void validate_driver(device_t &root);
 	void validate_roms(device_t &root);
 	void validate_analog_input_field(const ioport_field &field);
@@ -112,6 +122,10 @@ private:
 	string_set              m_slotcard_set;
 	bool                    m_checking_card;
 	bool const              m_quick;
+
+	// state shared with parallel workers
+	validity_checker *const m_master;
+	std::mutex              m_shared_mutex;
 };
 
 #endif // MAME_EMU_VALIDITY_H
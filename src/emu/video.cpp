@@ -17,6 +17,7 @@
 #include "main.h"
 #include "output.h"
 #include "screen.h"
+#include "tilemap.h"
 
 #include "ui/uimain.h"
 
@@ -96,9 +97,12 @@ video_manager::video_manager(running_machine &machine)
 	, m_throttle_rate(1.0f)
 	, m_fastforward(false)
 	, m_seconds_to_run(machine.options().seconds_to_run())
+	, m_run_start_time(attotime::zero)
 	, m_auto_frameskip(machine.options().auto_frameskip())
 	, m_speed(original_speed_setting())
 	, m_low_latency(machine.options().low_latency())
+	, m_headless(machine.options().headless())
+	, m_deterministic(machine.options().deterministic())
 	, m_empty_skip_count(0)
 	, m_frameskip_max(m_auto_frameskip ? machine.options().frameskip() : 0)
 	, m_frameskip_level(m_auto_frameskip ? 0 : machine.options().frameskip())
@@ -106,6 +110,17 @@ video_manager::video_manager(running_machine &machine)
 	, m_frameskip_adjust(0)
 	, m_skipping_this_frame(false)
 	, m_average_oversleep(0)
+	, m_frame_timing_total(0)
+	, m_frame_end_ticks(0)
+	, m_screen_queue(nullptr)
+	, m_updating_screens(false)
+	, m_frame_update_count(0)
+	, m_speculative(false)
+	, m_present_speculative(false)
+	, m_frame_callback_interval(0)
+	, m_frame_callback_countdown(0)
+	, m_frames_requested(0)
+	, m_snapshot_pending(false)
 	, m_snap_target(nullptr)
 	, m_snap_native(true)
 	, m_snap_width(0)
@@ -121,6 +136,14 @@ video_manager::video_manager(running_machine &machine)
 	const unsigned screen_count(screen_device_enumerator(machine.root_device()).count());
 	const bool no_screens(!screen_count);
 
+	// allocate worker threads if several screens can be finished at the same time
+	unsigned independent_count(0);
+	for (screen_device &screen : screen_device_enumerator(machine.root_device()))
+		if (screen.independent_update())
+			++independent_count;
+	if (independent_count > 1)
+		m_screen_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 	// create a render target for snapshots
 	const char *viewname = machine.options().snap_view();
 	m_snap_native = !no_screens && !strcmp(viewname, "native");
@@ -212,15 +235,40 @@ void video_manager::set_frameskip(int frameskip)
 
 void video_manager::frame_update(bool from_debugger)
 {
+	osd_ticks_t const start_ticks = osd_ticks();
+
 	// only render sound and video if we're in the running phase
 	machine_phase const phase = machine().phase();
+
+	// frames being run ahead aren't throttled, recorded or given to the UI;
+	// only the last of them is drawn, in place of the frame before it
+	if (!from_debugger)
+		m_frame_update_count++;
+	if (m_speculative)
+	{
+		if (m_present_speculative && (phase == machine_phase::RUNNING))
+		{
+			finish_screen_updates();
+			auto profile = g_profiler.start(PROFILER_BLIT);
+			machine().osd().update(false);
+		}
+		return;
+	}
+	bool const present = from_debugger || !machine().runahead_frames() || machine().paused() || (phase != machine_phase::RUNNING);
+
 	bool skipped_it = m_skipping_this_frame;
 	bool const update_screens = (phase == machine_phase::RUNNING) && (!machine().paused() || machine().options().update_in_pause());
+	bool const drawn = update_screens && !m_skipping_this_frame;
 	bool anything_changed = update_screens && finish_screen_updates();
 
-	// update inputs and draw the user interface
+	// hand the finished frame to whoever asked for it
+	if (drawn && !from_debugger)
+		deliver_frame();
+
+	// update inputs and draw the user interface; a headless machine has none
 	machine().osd().input_update(true);
-	anything_changed = emulator_info::draw_user_interface(machine()) || anything_changed;
+	if (!m_headless)
+		anything_changed = emulator_info::draw_user_interface(machine()) || anything_changed;
 
 	// let plugins draw over the UI
 	anything_changed = emulator_info::frame_hook() || anything_changed;
@@ -233,21 +281,40 @@ void video_manager::frame_update(bool from_debugger)
 	else
 		m_empty_skip_count = 0;
 
-	// if we're throttling, synchronize before rendering
+	// if we're throttling, synchronize before rendering; on a variable refresh
+	// display this always comes first, so frames are shown at their emulated
+	// boundaries rather than whenever rendering finishes
 	attotime current_time = machine().time();
-	if (!from_debugger && phase > machine_phase::INIT && !m_low_latency && effective_throttle())
+	osd_ticks_t const render_ticks = osd_ticks();
+	bool const low_latency = m_low_latency && !machine().osd().variable_refresh();
+	if (!from_debugger && phase > machine_phase::INIT && !low_latency && effective_throttle())
 		update_throttle(current_time);
+	osd_ticks_t const sleep_ticks = osd_ticks();
 
 	// ask the OSD to update
 	{
 		auto profile = g_profiler.start(PROFILER_BLIT);
-		machine().osd().update(!from_debugger && skipped_it);
+		machine().osd().update(m_headless || (!from_debugger && (skipped_it || !present)));
 	}
+	osd_ticks_t const present_ticks = osd_ticks();
 
 	// we synchronize after rendering instead of before, if low latency mode is enabled
-	if (!from_debugger && phase > machine_phase::INIT && m_low_latency && effective_throttle())
+	if (!from_debugger && phase > machine_phase::INIT && low_latency && effective_throttle())
 		update_throttle(current_time);
 
+	// record where the time went
+	if (!from_debugger)
+	{
+		osd_ticks_t const end_ticks = osd_ticks();
+		frame_timing &timing = m_frame_timing[m_frame_timing_total++ % FRAME_TIMING_HISTORY];
+		timing.emulate = m_frame_end_ticks ? (start_ticks - m_frame_end_ticks) : 0;
+		timing.render = render_ticks - start_ticks;
+		timing.present = present_ticks - sleep_ticks;
+		timing.sleep = (sleep_ticks - render_ticks) + (end_ticks - present_ticks);
+		timing.skipped = skipped_it;
+		m_frame_end_ticks = end_ticks;
+	}
+
 	machine().osd().input_update(false);
 	emulator_info::periodic_check();
 
@@ -260,9 +327,10 @@ void video_manager::frame_update(bool from_debugger)
 		if (phase > machine_phase::INIT)
 			update_frameskip();
 
-		// update speed computations
-		if (!skipped_it && phase > machine_phase::INIT)
-			recompute_speed(current_time);
+		// update speed computations; headless frames are mostly undrawn, so
+		// they all count
+		if ((!skipped_it || m_headless) && phase > machine_phase::INIT)
+			recompute_speed(current_time, drawn);
 	}
 
 	// call the end-of-frame callback
@@ -278,6 +346,33 @@ void video_manager::frame_update(bool from_debugger)
 }
 
 
+//-------------------------------------------------
+//  frame_timing_csv - return the frame timing
+//  history as comma-separated values, with times
+//  in milliseconds
+//-------------------------------------------------
+
+std::string video_manager::frame_timing_csv() const
+{
+	double const ms_per_tick = 1000.0 / double(osd_ticks_per_second());
+	std::ostringstream str;
+	str << "frame,emulate_ms,render_ms,present_ms,sleep_ms,skipped\n";
+	unsigned const count = frame_timing_count();
+	for (unsigned i = 0; i < count; i++)
+	{
+		frame_timing const &timing = frame_timing_entry(i);
+		util::stream_format(str, "%u,%.3f,%.3f,%.3f,%.3f,%d\n",
+				unsigned(m_frame_timing_total - count + i),
+				timing.emulate * ms_per_tick,
+				timing.render * ms_per_tick,
+				timing.present * ms_per_tick,
+				timing.sleep * ms_per_tick,
+				timing.skipped ? 1 : 0);
+	}
+	return str.str();
+}
+
+
 //-------------------------------------------------
 //  speed_text - print the text to be displayed
 //  into a string buffer
@@ -354,12 +449,42 @@ void video_manager::save_snapshot(screen_device *screen, util::core_file &file)
 //-------------------------------------------------
 
 void video_manager::save_active_screen_snapshots()
+{
+	// headless screens are only drawn on demand, so wait for the next frame
+	if (m_headless)
+		m_snapshot_pending = true;
+	else
+		write_active_screen_snapshots();
+}
+
+
+//-------------------------------------------------
+//  set_frame_callback - set a function to receive
+//  every <interval>th frame, or only requested
+//  frames if the interval is zero
+//-------------------------------------------------
+
+void video_manager::set_frame_callback(frame_callback &&callback, u32 interval)
+{
+	m_frame_callback = std::move(callback);
+	m_frame_callback_interval = interval;
+	m_frame_callback_countdown = 0;
+}
+
+
+//-------------------------------------------------
+//  write_active_screen_snapshots - write a
+//  snapshot of all active screens from their
+//  current contents
+//-------------------------------------------------
+
+void video_manager::write_active_screen_snapshots()
 {
 	if (m_snap_native)
 	{
 		// if we're native, then write one snapshot per visible screen
 		for (screen_device &screen : screen_device_enumerator(machine().root_device()))
-			if (machine().render().is_live(screen))
+			if (m_headless || machine().render().is_live(screen))
 			{
 				emu_file file(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
 				std::error_condition const filerr = open_next(file, "png");
@@ -486,6 +611,8 @@ void video_manager::add_sound_to_recording(const s16 *sound, int numsamples)
 {
 	for (auto &recording : m_movie_recordings)
 		recording->add_sound_to_recording(sound, numsamples);
+	if (m_frame_export)
+		m_frame_export->add_sound(sound, numsamples);
 }
 
 
@@ -497,11 +624,19 @@ void video_manager::exit()
 {
 	// stop recording any movie
 	m_movie_recordings.clear();
+	m_frame_export.reset();
 
 	// free the snapshot target
 	machine().render().target_free(m_snap_target);
 	m_snap_bitmap.reset();
 
+	// free the worker threads
+	if (m_screen_queue)
+	{
+		osd_work_queue_free(m_screen_queue);
+		m_screen_queue = nullptr;
+	}
+
 	// print a final result if we have at least 2 seconds' worth of data
 	if (!emulator_info::standalone() && m_overall_emutime.seconds() >= 1)
 	{
@@ -532,6 +667,10 @@ void video_manager::screenless_update_callback(s32 param)
 
 void video_manager::postload()
 {
+	// restoring the state after running ahead doesn't disturb the timeline
+	if (m_speculative)
+		return;
+
 	attotime const emutime = machine().time();
 	for (const auto &x : m_movie_recordings)
 		x->set_next_frame_time(emutime);
@@ -615,9 +754,11 @@ inline int video_manager::original_speed_setting() const
 
 bool video_manager::finish_screen_updates()
 {
-	// finish updating the screens
-	screen_device_enumerator iter(machine().root_device());
+	// finish the independent screens together, then the rest (which
+	// finds the independent ones already done)
+	finish_independent_screens();
 
+	screen_device_enumerator iter(machine().root_device());
 	bool has_live_screen = false;
 	for (screen_device &screen : iter)
 	{
@@ -638,9 +779,10 @@ bool video_manager::finish_screen_updates()
 			anything_changed = true;
 
 	// update our movie recording and burn-in state
-	if (!machine().paused())
+	if (!machine().paused() && !m_speculative)
 	{
 		record_frame();
+		export_frame();
 
 		// iterate over screens and update the burnin for the ones that care
 		for (screen_device &screen : iter)
@@ -655,6 +797,56 @@ bool video_manager::finish_screen_updates()
 }
 
 
+//-------------------------------------------------
+//  finish_independent_screens - finish updating
+//  the screens that don't change shared state at
+//  the same time on worker threads
+//-------------------------------------------------
+
+void video_manager::finish_independent_screens()
+{
+	if (!m_screen_queue || skip_this_frame() || g_profiler.enabled() || (machine().debug_flags & DEBUG_FLAG_ENABLED))
+		return;
+
+	m_independent_screens.clear();
+	for (screen_device &screen : screen_device_enumerator(machine().root_device()))
+		if (screen.independent_update() && (m_headless || machine().render().is_live(screen)))
+			m_independent_screens.push_back(&screen);
+	if (m_independent_screens.size() < 2)
+		return;
+
+	// held-back palette changes and dirty tiles are shared, so deal with them here
+	for (device_palette_interface &palette : palette_interface_enumerator(machine().root_device()))
+		palette.update_pending();
+	machine().tilemap().begin_parallel_draw();
+	m_updating_screens = true;
+
+	// run the first screen on this thread and the others on the queue
+	osd_work_item_queue_multiple(m_screen_queue, &video_manager::finish_screen, m_independent_screens.size() - 1, &m_independent_screens[1], sizeof(screen_device *), WORK_ITEM_FLAG_AUTO_RELEASE);
+	finish_screen(&m_independent_screens[0], 0);
+	while (!osd_work_queue_wait(m_screen_queue, osd_ticks_per_second()))
+		;
+
+	m_updating_screens = false;
+	machine().tilemap().end_parallel_draw();
+}
+
+
+//-------------------------------------------------
+//  finish_screen - work item to finish updating
+//  one independent screen
+//-------------------------------------------------
+
+void *video_manager::finish_screen(void *param, int threadid)
+{
+	screen_device &screen = **reinterpret_cast<screen_device **>(param);
+	if (screen.partial_scan_hpos() > 0) // previous update ended mid-scanline
+		screen.update_now();
+	screen.update_partial(screen.visible_area().max_y);
+	return nullptr;
+}
+
+
 
 //-------------------------------------------------
 //  update_throttle - throttle to the game's
@@ -894,6 +1086,56 @@ void video_manager::update_frameskip()
 	// increment the frameskip counter and determine if we will skip the next frame
 	m_frameskip_counter = (m_frameskip_counter + 1) % FRAMESKIP_LEVELS;
 	m_skipping_this_frame = s_skiptable[effective_frameskip()][m_frameskip_counter];
+
+	// headless machines only draw the frames someone will look at
+	if (m_frame_callback_countdown)
+		m_frame_callback_countdown--;
+	if (m_headless)
+		m_skipping_this_frame = !frame_wanted();
+
+	// screen updates can change the machine's state, so deterministic runs draw every frame
+	if (m_deterministic)
+		m_skipping_this_frame = false;
+}
+
+
+//-------------------------------------------------
+//  frame_wanted - determine whether the next
+//  frame has to be drawn for a snapshot, movie,
+//  request or callback
+//-------------------------------------------------
+
+bool video_manager::frame_wanted() const
+{
+	if (m_frames_requested || m_snapshot_pending || is_recording() || is_exporting())
+		return true;
+	return m_frame_callback && m_frame_callback_interval && !m_frame_callback_countdown;
+}
+
+
+//-------------------------------------------------
+//  deliver_frame - write pending snapshots and
+//  pass a newly drawn frame to the callback
+//-------------------------------------------------
+
+void video_manager::deliver_frame()
+{
+	bool const requested = m_frames_requested != 0;
+	if (requested)
+		m_frames_requested--;
+
+	if (m_snapshot_pending)
+	{
+		m_snapshot_pending = false;
+		write_active_screen_snapshots();
+	}
+
+	if (m_frame_callback && (requested || (m_frame_callback_interval && !m_frame_callback_countdown)))
+	{
+		m_frame_callback_countdown = m_frame_callback_interval;
+		for (screen_device &screen : screen_device_enumerator(machine().root_device()))
+			m_frame_callback(screen, static_cast<bitmap_t &>(screen.curbitmap()));
+	}
 }
 
 
@@ -941,10 +1183,10 @@ void video_manager::update_refresh_speed()
 //-------------------------------------------------
 //  recompute_speed - recompute the current
 //  overall speed; we assume this is called only
-//  if we did not skip a frame
+//  if we did not skip a frame, or if headless
 //-------------------------------------------------
 
-void video_manager::recompute_speed(const attotime &emutime)
+void video_manager::recompute_speed(const attotime &emutime, bool drawn)
 {
 	// if we don't have a starting time yet, or if we're paused, reset our starting point
 	if (m_speed_last_realtime == 0 || machine().paused())
@@ -987,8 +1229,15 @@ void video_manager::recompute_speed(const attotime &emutime)
 	}
 
 	// if we're past the "time-to-execute" requested, signal an exit
-	if (m_seconds_to_run != 0 && emutime.seconds() >= m_seconds_to_run)
+	if (m_seconds_to_run != 0 && (emutime - m_run_start_time).seconds() >= m_seconds_to_run)
 	{
+		// a headless machine has to draw one more frame for the screenshot
+		if (m_headless && !drawn)
+		{
+			request_frame();
+			return;
+		}
+
 		// create a final screenshot
 		if (m_snap_native)
 		{
@@ -1038,17 +1287,28 @@ void video_manager::create_snapshot_bitmap(screen_device *screen)
 	// get the minimum width/height and set it on the target and bitmap
 	s32 width, height;
 	compute_snapshot_size(width, height);
-	m_snap_target->set_bounds(width, height);
 	if (width != m_snap_bitmap.width() || height != m_snap_bitmap.height())
 		m_snap_bitmap.resize(width, height);
 
 	// render the screen there
+	render_snapshot(&m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels());
+}
+
+
+//-------------------------------------------------
+//  render_snapshot - render the snapshot target
+//  at the given size into a buffer of pixels
+//-------------------------------------------------
+
+void video_manager::render_snapshot(u32 *dest, s32 width, s32 height, s32 rowpixels)
+{
+	m_snap_target->set_bounds(width, height);
 	render_primitive_list &primlist = m_snap_target->get_primitives();
 	primlist.acquire_lock();
 	if (machine().options().snap_bilinear())
-		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer_bilinear::draw_primitives(primlist, dest, width, height, rowpixels);
 	else
-		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer::draw_primitives(primlist, dest, width, height, rowpixels);
 	primlist.release_lock();
 }
 
@@ -1255,6 +1515,58 @@ void video_manager::record_frame()
 }
 
 
+//-------------------------------------------------
+//  export_frame - render a frame straight into
+//  the shared memory export
+//-------------------------------------------------
+
+void video_manager::export_frame()
+{
+	// ignore if nothing to do
+	if (!m_frame_export)
+		return;
+
+	auto profile = g_profiler.start(PROFILER_MOVIE_REC);
+	s32 width, height, rowpixels;
+	compute_snapshot_size(width, height);
+	u32 *const dest = m_frame_export->begin_frame(width, height, rowpixels);
+	if (dest)
+	{
+		render_snapshot(dest, width, height, rowpixels);
+		m_frame_export->end_frame(machine().time());
+	}
+}
+
+
+//-------------------------------------------------
+//  begin_frame_export - start publishing frames
+//  and sound in a named shared memory region
+//-------------------------------------------------
+
+bool video_manager::begin_frame_export(std::string &&name, u32 slots)
+{
+	m_frame_export.reset();
+
+	// slots are sized by the snapshot size, with room to grow if it's automatic
+	s32 width, height;
+	compute_snapshot_size(width, height);
+	u64 pixels = u64(std::max(width, 1)) * u64(std::max(height, 1));
+	if (!m_snap_width || !m_snap_height)
+		pixels *= 4;
+	pixels = std::min<u64>(pixels, std::numeric_limits<u32>::max() / sizeof(u32));
+
+	std::string const shown(name);
+	m_frame_export = frame_export::create(machine(), std::move(name), slots, u32(pixels));
+	if (!m_frame_export)
+	{
+		osd_printf_error("Error creating shared memory frame export %s\n", shown);
+		return false;
+	}
+	osd_printf_verbose("Exporting frames of up to %u pixels to shared memory %s\n", u32(pixels), shown);
+	return true;
+}
+
+
 //-------------------------------------------------
 //  toggle_record_movie
 //-------------------------------------------------
@@ -17,8 +17,11 @@
 #ifndef MAME_EMU_VIDEO_H
 #define MAME_EMU_VIDEO_H
 
+#include "frameexport.h"
 #include "recording.h"
 
+#include <array>
+#include <functional>
 #include <system_error>
 
 
@@ -30,6 +33,9 @@
 constexpr int FRAMESKIP_LEVELS = 12;
 constexpr int MAX_FRAMESKIP = FRAMESKIP_LEVELS - 2;
 
+// number of frames of timing history kept
+constexpr unsigned FRAME_TIMING_HISTORY = 256;
+
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -42,17 +48,32 @@ class video_manager
 	friend class screen_device;
 
 public:
+	// where the real time went for one frame, in OSD ticks
+	struct frame_timing
+	{
+		osd_ticks_t     emulate;    // emulation since the previous frame update
+		osd_ticks_t     render;     // finishing screen updates and drawing the UI
+		osd_ticks_t     present;    // OSD update (rendering, presenting and any vsync wait)
+		osd_ticks_t     sleep;      // throttling
+		bool            skipped;    // frame was skipped
+	};
+
+	// receives each screen's bitmap for a delivered frame; the bitmap is the
+	// screen's own and is only valid for the duration of the call
+	using frame_callback = std::function<void (screen_device &screen, const bitmap_t &bitmap)>;
+
 	// construction/destruction
 	video_manager(running_machine &machine);
 
 	// getters
 	running_machine &machine() const { return m_machine; }
-	bool skip_this_frame() const { return m_skipping_this_frame; }
+	bool skip_this_frame() const { return m_speculative ? !m_present_speculative : m_skipping_this_frame; }
 	int speed_factor() const { return m_speed; }
 	int frameskip() const { return m_auto_frameskip ? -1 : m_frameskip_level; }
 	bool throttled() const { return m_throttled; }
 	float throttle_rate() const { return m_throttle_rate; }
 	bool fastforward() const { return m_fastforward; }
+	bool headless() const { return m_headless; }
 
 	// setters
 	void set_frameskip(int frameskip);
@@ -60,6 +81,12 @@ public:
 	void set_throttle_rate(float throttle_rate) { m_throttle_rate = throttle_rate; }
 	void set_fastforward(bool ffwd) { m_fastforward = ffwd; }
 	void set_output_changed() { m_output_changed = true; }
+	void set_speculative(bool speculative, bool present = false) { m_speculative = speculative; m_present_speculative = present; }
+	void set_run_start(const attotime &time) { m_run_start_time = time; }
+
+	// frame delivery; in headless mode these decide which frames are drawn at all
+	void set_frame_callback(frame_callback &&callback, u32 interval = 1);
+	void request_frame(u32 count = 1) { m_frames_requested += count; }
 
 	// misc
 	void toggle_record_movie(movie_recording::format format);
@@ -69,12 +96,20 @@ public:
 
 	// render a frame
 	void frame_update(bool from_debugger = false);
+	u64 frame_update_count() const { return m_frame_update_count; }
+	bool speculative() const { return m_speculative; }
+	bool updating_screens() const { return m_updating_screens; }
 
 	// current speed helpers
 	std::string speed_text();
 	double speed_percent() const { return m_speed_percent; }
 	int effective_frameskip() const;
 
+	// frame timing history, oldest first
+	unsigned frame_timing_count() const { return unsigned(std::min<u64>(m_frame_timing_total, FRAME_TIMING_HISTORY)); }
+	frame_timing const &frame_timing_entry(unsigned index) const { return m_frame_timing[(m_frame_timing_total - frame_timing_count() + index) % FRAME_TIMING_HISTORY]; }
+	std::string frame_timing_csv() const;
+
 	// snapshots
 	bool snap_native() const { return m_snap_native; }
 	render_target &snapshot_target() { return *m_snap_target; }
@@ -87,6 +122,11 @@ public:
 	void add_sound_to_recording(const s16 *sound, int numsamples);
 	bool is_recording() const { return !m_movie_recordings.empty(); }
 
+	// shared memory export
+	bool begin_frame_export(std::string &&name, u32 slots);
+	void end_frame_export() { m_frame_export.reset(); }
+	bool is_exporting() const { return bool(m_frame_export); }
+
 private:
 	// internal helpers
 	void exit();
@@ -100,15 +140,24 @@ private:
 	// speed and throttling helpers
 	int original_speed_setting() const;
 	bool finish_screen_updates();
+	void finish_independent_screens();
+	static void *finish_screen(void *param, int threadid);
 	void update_throttle(attotime emutime);
 	osd_ticks_t throttle_until_ticks(osd_ticks_t target_ticks);
 	void update_frameskip();
 	void update_refresh_speed();
-	void recompute_speed(const attotime &emutime);
+	void recompute_speed(const attotime &emutime, bool drawn);
+
+	// frame delivery helpers
+	bool frame_wanted() const;
+	void deliver_frame();
 
 	// snapshot/movie helpers
+	void write_active_screen_snapshots();
 	void create_snapshot_bitmap(screen_device *screen);
+	void render_snapshot(u32 *dest, s32 width, s32 height, s32 rowpixels);
 	void record_frame();
+	void export_frame();
 
 	// movies
 	void begin_recording_screen(const std::string &filename, uint32_t index, screen_device *screen, movie_recording::format format);
@@ -142,9 +191,12 @@ private:
 	float               m_throttle_rate;            // target rate for throttling
 	bool                m_fastforward;              // flag: true if we're currently fast-forwarding
 	u32                 m_seconds_to_run;           // number of seconds to run before quitting
+	attotime            m_run_start_time;           // emulated time the seconds to run are counted from
 	bool                m_auto_frameskip;           // flag: true if we're automatically frameskipping
 	u32                 m_speed;                    // overall speed (*1000)
 	bool                m_low_latency;              // flag: true if we are throttling after blitting
+	bool                m_headless;                 // flag: true if only requested frames are drawn
+	bool                m_deterministic;            // flag: true if every frame is drawn however fast the host is
 
 	// frameskipping
 	u8                  m_empty_skip_count;         // number of empty frames we have skipped
@@ -155,6 +207,28 @@ private:
 	bool                m_skipping_this_frame;      // flag: true if we are skipping the current frame
 	osd_ticks_t         m_average_oversleep;        // average number of ticks the OSD oversleeps
 
+	// frame timing
+	std::array<frame_timing, FRAME_TIMING_HISTORY> m_frame_timing; // ring buffer of recent frames
+	u64                 m_frame_timing_total;       // number of frames recorded
+	osd_ticks_t         m_frame_end_ticks;          // when the previous frame update finished
+
+	// independent screens
+	osd_work_queue *    m_screen_queue;             // worker threads for finishing independent screens
+	std::vector<screen_device *> m_independent_screens; // screens being finished at the same time
+	bool                m_updating_screens;         // flag: true while independent screens are being finished
+
+	// run-ahead
+	u64                 m_frame_update_count;       // number of frame updates, other than from the debugger
+	bool                m_speculative;              // flag: true if frames are being run ahead, to be thrown away
+	bool                m_present_speculative;      // flag: true if the current run-ahead frame should be shown
+
+	// frame delivery
+	frame_callback      m_frame_callback;           // receives delivered frames
+	u32                 m_frame_callback_interval;  // frames between deliveries (0 = only on request)
+	u32                 m_frame_callback_countdown; // frames until the next delivery is due
+	u32                 m_frames_requested;         // frames asked for with request_frame
+	bool                m_snapshot_pending;         // flag: true if a snapshot waits for a drawn frame
+
 	// snapshot stuff
 	render_target *     m_snap_target;              // screen shapshot target
 	bitmap_rgb32        m_snap_bitmap;              // screen snapshot bitmap
@@ -165,6 +239,9 @@ private:
 	// movie recordings
 	std::vector<movie_recording::ptr> m_movie_recordings;
 
+	// frames and sound published in shared memory
+	frame_export::ptr   m_frame_export;
+
 	static const bool   s_skiptable[FRAMESKIP_LEVELS][FRAMESKIP_LEVELS];
 
 	static const attoseconds_t ATTOSECONDS_PER_SPEED_UPDATE = ATTOSECONDS_PER_SECOND / 4;
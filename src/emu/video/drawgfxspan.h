@@ -0,0 +1,240 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    drawgfxspan.h
+
+    Row operations for the common drawgfx cases.  Each one produces the
+    same result as running the matching PIXEL_OP_* over the row, using
+    SIMD where it's available to test and write 16 pixels at a time.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_VIDEO_DRAWGFXSPAN_H
+#define MAME_EMU_VIDEO_DRAWGFXSPAN_H
+
+#pragma once
+
+// use SSE on 64-bit implementations, where it can be assumed
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define MAME_DRAWGFX_SPAN_SSE2
+#include <emmintrin.h>
+#endif
+
+
+/***************************************************************************
+    BLOCK TESTS
+***************************************************************************/
+
+/*-------------------------------------------------
+    drawgfx_span_match16 - return a mask with bit
+    n set if src[n] is equal to 'pen', for the
+    16 pixels at 'src'; pens above 0xff never
+    match, as in the per-pixel tests
+-------------------------------------------------*/
+
+inline u32 drawgfx_span_match16(const u8 *src, u32 pen)
+{
+	if (pen > 0xff)
+		return 0;
+#if defined(MAME_DRAWGFX_SPAN_SSE2)
+	__m128i const pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+	return u32(_mm_movemask_epi8(_mm_cmpeq_epi8(pixels, _mm_set1_epi8(char(u8(pen))))));
+#else
+	u32 result = 0;
+	for (int i = 0; i < 16; i++)
+		result |= u32(src[i] == pen) << i;
+	return result;
+#endif
+}
+
+
+/***************************************************************************
+    REBASE OPERATIONS
+***************************************************************************/
+
+#if defined(MAME_DRAWGFX_SPAN_SSE2)
+
+/*-------------------------------------------------
+    drawgfx_span_rebase16 - add 'color' to 16
+    pixels and store them at 'dest', keeping the
+    destination wherever the corresponding byte
+    of 'keep' is all ones ('bits' is its mask)
+-------------------------------------------------*/
+
+inline void drawgfx_span_rebase16(u16 *dest, __m128i pixels, __m128i keep, u32 bits, __m128i color)
+{
+	__m128i const zero = _mm_setzero_si128();
+	__m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(pixels, zero), color);
+	__m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(pixels, zero), color);
+	if (bits != 0)
+	{
+		__m128i const keeplo = _mm_unpacklo_epi8(keep, keep);
+		__m128i const keephi = _mm_unpackhi_epi8(keep, keep);
+		lo = _mm_or_si128(_mm_and_si128(keeplo, _mm_loadu_si128(reinterpret_cast<const __m128i *>(dest + 0))), _mm_andnot_si128(keeplo, lo));
+		hi = _mm_or_si128(_mm_and_si128(keephi, _mm_loadu_si128(reinterpret_cast<const __m128i *>(dest + 8))), _mm_andnot_si128(keephi, hi));
+	}
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 0), lo);
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 8), hi);
+}
+
+inline void drawgfx_span_rebase16(u32 *dest, __m128i pixels, __m128i keep, u32 bits, __m128i color)
+{
+	__m128i const zero = _mm_setzero_si128();
+	__m128i const words[2] = { _mm_unpacklo_epi8(pixels, zero), _mm_unpackhi_epi8(pixels, zero) };
+	__m128i const keepwords[2] = { _mm_unpacklo_epi8(keep, keep), _mm_unpackhi_epi8(keep, keep) };
+	for (int half = 0; half < 2; half++)
+	{
+		__m128i lo = _mm_add_epi32(_mm_unpacklo_epi16(words[half], zero), color);
+		__m128i hi = _mm_add_epi32(_mm_unpackhi_epi16(words[half], zero), color);
+		u32 *const out = dest + half * 8;
+		if (bits != 0)
+		{
+			__m128i const keeplo = _mm_unpacklo_epi16(keepwords[half], keepwords[half]);
+			__m128i const keephi = _mm_unpackhi_epi16(keepwords[half], keepwords[half]);
+			lo = _mm_or_si128(_mm_and_si128(keeplo, _mm_loadu_si128(reinterpret_cast<const __m128i *>(out + 0))), _mm_andnot_si128(keeplo, lo));
+			hi = _mm_or_si128(_mm_and_si128(keephi, _mm_loadu_si128(reinterpret_cast<const __m128i *>(out + 4))), _mm_andnot_si128(keephi, hi));
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(out + 0), lo);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(out + 4), hi);
+	}
+}
+
+inline __m128i drawgfx_span_color(u16 *dest, u32 color) { return _mm_set1_epi16(s16(u16(color))); }
+inline __m128i drawgfx_span_color(u32 *dest, u32 color) { return _mm_set1_epi32(s32(color)); }
+
+#endif // MAME_DRAWGFX_SPAN_SSE2
+
+
+/*-------------------------------------------------
+    drawgfx_span_rebase_opaque - PIXEL_OP_REBASE_OPAQUE
+    over 'count' pixels
+-------------------------------------------------*/
+
+template <typename DestType>
+inline void drawgfx_span_rebase_opaque(DestType *dest, const u8 *src, u32 count, u32 color)
+{
+	u32 x = 0;
+#if defined(MAME_DRAWGFX_SPAN_SSE2)
+	__m128i const vcolor = drawgfx_span_color(dest, color);
+	for ( ; (x + 16) <= count; x += 16)
+		drawgfx_span_rebase16(dest + x, _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x)), _mm_setzero_si128(), 0, vcolor);
+#endif
+	for ( ; x < count; x++)
+		dest[x] = color + src[x];
+}
+
+
+/*-------------------------------------------------
+    drawgfx_span_rebase_transpen - PIXEL_OP_REBASE_TRANSPEN
+    over 'count' pixels
+-------------------------------------------------*/
+
+template <typename DestType>
+inline void drawgfx_span_rebase_transpen(DestType *dest, const u8 *src, u32 count, u32 color, u32 trans_pen)
+{
+	u32 x = 0;
+#if defined(MAME_DRAWGFX_SPAN_SSE2)
+	if (trans_pen <= 0xff)
+	{
+		__m128i const vcolor = drawgfx_span_color(dest, color);
+		__m128i const vpen = _mm_set1_epi8(char(u8(trans_pen)));
+		for ( ; (x + 16) <= count; x += 16)
+		{
+			__m128i const pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x));
+			__m128i const keep = _mm_cmpeq_epi8(pixels, vpen);
+			u32 const bits = _mm_movemask_epi8(keep);
+			if (bits != 0xffff)
+				drawgfx_span_rebase16(dest + x, pixels, keep, bits, vcolor);
+		}
+	}
+#else
+	for ( ; (x + 16) <= count; x += 16)
+	{
+		// skip fully transparent blocks without touching the destination
+		u32 const bits = drawgfx_span_match16(src + x, trans_pen);
+		if (bits != 0xffff)
+			for (int i = 0; i < 16; i++)
+				if (!BIT(bits, i))
+					dest[x + i] = color + src[x + i];
+	}
+#endif
+	for ( ; x < count; x++)
+	{
+		u32 const srcdata = src[x];
+		if (srcdata != trans_pen)
+			dest[x] = color + srcdata;
+	}
+}
+
+
+/***************************************************************************
+    REMAP OPERATIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    drawgfx_span_remap_transpen - PIXEL_OP_REMAP_TRANSPEN
+    over 'count' pixels; the palette lookups are
+    done a pixel at a time, but blocks with no
+    transparent pixels run without tests and
+    blocks with no opaque ones are skipped
+-------------------------------------------------*/
+
+inline void drawgfx_span_remap_transpen(u32 *dest, const u8 *src, u32 count, const pen_t *paldata, u32 trans_pen)
+{
+	u32 x = 0;
+	for ( ; (x + 16) <= count; x += 16)
+	{
+		u32 const bits = drawgfx_span_match16(src + x, trans_pen);
+		if (bits == 0)
+		{
+			for (int i = 0; i < 16; i++)
+				dest[x + i] = paldata[src[x + i]];
+		}
+		else if (bits != 0xffff)
+		{
+			for (int i = 0; i < 16; i++)
+				if (!BIT(bits, i))
+					dest[x + i] = paldata[src[x + i]];
+		}
+	}
+	for ( ; x < count; x++)
+	{
+		u32 const srcdata = src[x];
+		if (srcdata != trans_pen)
+			dest[x] = paldata[srcdata];
+	}
+}
+
+
+/***************************************************************************
+    PRIORITY OPERATIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    drawgfx_span_transpen_priority - run a
+    per-pixel PIXEL_OP_*_TRANSPEN_PRIORITY
+    operation over 'count' pixels, skipping
+    blocks of 16 that are fully transparent; the
+    priority test needs a variable shift per
+    pixel, so the opaque pixels go one at a time
+-------------------------------------------------*/
+
+template <typename DestType, typename FunctionClass>
+inline void drawgfx_span_transpen_priority(DestType *dest, u8 *pri, const u8 *src, u32 count, u32 trans_pen, FunctionClass pixel_op)
+{
+	u32 x = 0;
+	for ( ; (x + 16) <= count; x += 16)
+	{
+		u32 const bits = drawgfx_span_match16(src + x, trans_pen);
+		if (bits != 0xffff)
+			for (int i = 0; i < 16; i++)
+				if (!BIT(bits, i))
+					pixel_op(dest[x + i], pri[x + i], src[x + i]);
+	}
+	for ( ; x < count; x++)
+		if (src[x] != trans_pen)
+			pixel_op(dest[x], pri[x], src[x]);
+}
+
+#endif // MAME_EMU_VIDEO_DRAWGFXSPAN_H
@@ -0,0 +1,327 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    rendspan.h
+
+    Row operations for the software renderer.  Each one combines a row
+    of 32bpp source texels with the destination exactly the way the
+    matching per-pixel loop in rendersw.hxx does, for any destination
+    format, using SIMD where it's available to do four pixels at a time.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_VIDEO_RENDSPAN_H
+#define MAME_EMU_VIDEO_RENDSPAN_H
+
+#pragma once
+
+// use SSE on 64-bit implementations, where it can be assumed
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define MAME_RENDER_SPAN_SSE2
+#include <emmintrin.h>
+#endif
+
+#include <cstring>
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+// the template parameters are the same as software_renderer's
+template <typename PixelType, int SrcShiftR, int SrcShiftG, int SrcShiftB, int DstShiftR, int DstShiftG, int DstShiftB, bool NoDestRead = false>
+class render_span
+{
+	// per-pixel forms, also used for the ends of rows
+	static constexpr u32 source32_r(u32 pixel) { return (pixel >> (16 + SrcShiftR)) & (0xff >> SrcShiftR); }
+	static constexpr u32 source32_g(u32 pixel) { return (pixel >> ( 8 + SrcShiftG)) & (0xff >> SrcShiftG); }
+	static constexpr u32 source32_b(u32 pixel) { return (pixel >> ( 0 + SrcShiftB)) & (0xff >> SrcShiftB); }
+	static constexpr u32 dest_r(PixelType pixel) { return (pixel >> DstShiftR) & (0xff >> SrcShiftR); }
+	static constexpr u32 dest_g(PixelType pixel) { return (pixel >> DstShiftG) & (0xff >> SrcShiftG); }
+	static constexpr u32 dest_b(PixelType pixel) { return (pixel >> DstShiftB) & (0xff >> SrcShiftB); }
+	static constexpr PixelType dest_assemble_rgb(u32 r, u32 g, u32 b) { return (r << DstShiftR) | (g << DstShiftG) | (b << DstShiftB); }
+	static constexpr bool identity() { return SrcShiftR == 0 && SrcShiftG == 0 && SrcShiftB == 0 && DstShiftR == 16 && DstShiftG == 8 && DstShiftB == 0 && sizeof(PixelType) == 4; }
+
+#if defined(MAME_RENDER_SPAN_SSE2)
+	// four pixels are held as 32-bit lanes whatever the destination size;
+	// products are formed with pmaddwd, pairing a source value in the low
+	// half of a lane with a destination value in the high half
+	static inline __m128i load4(PixelType const *dest)
+	{
+		if constexpr (sizeof(PixelType) == 4)
+			return _mm_loadu_si128(reinterpret_cast<__m128i const *>(dest));
+		else
+			return _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(dest)), _mm_setzero_si128());
+	}
+
+	static inline void store4(PixelType *dest, __m128i pixels)
+	{
+		if constexpr (sizeof(PixelType) == 4)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dest), pixels);
+		}
+		else
+		{
+			// sign-extend the low halves so packssdw keeps them intact
+			__m128i const words = _mm_srai_epi32(_mm_slli_epi32(pixels, 16), 16);
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(dest), _mm_packs_epi32(words, words));
+		}
+	}
+
+	template <int Shift, int Bits>
+	static inline __m128i component4(__m128i pixels)
+	{
+		return _mm_and_si128(_mm_srli_epi32(pixels, Shift), _mm_set1_epi32(0xff >> Bits));
+	}
+
+	static inline __m128i assemble4(__m128i r, __m128i g, __m128i b)
+	{
+		return _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, DstShiftR), _mm_slli_epi32(g, DstShiftG)), _mm_slli_epi32(b, DstShiftB));
+	}
+
+	static inline __m128i pair4(__m128i lo, __m128i hi)
+	{
+		return _mm_or_si128(lo, _mm_slli_epi32(hi, 16));
+	}
+
+	static inline __m128i select4(__m128i keep, __m128i original, __m128i result)
+	{
+		return _mm_or_si128(_mm_and_si128(keep, original), _mm_andnot_si128(keep, result));
+	}
+#endif
+
+public:
+	//-------------------------------------------------
+	//  copy - opaque texels, converted to the
+	//  destination format
+	//-------------------------------------------------
+
+	static void copy(PixelType *dest, u32 const *src, u32 count)
+	{
+		if constexpr (identity())
+		{
+			std::memcpy(dest, src, count * sizeof(*dest));
+			return;
+		}
+
+		u32 x = 0;
+#if defined(MAME_RENDER_SPAN_SSE2)
+		for ( ; (x + 4) <= count; x += 4)
+		{
+			__m128i const pix = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + x));
+			store4(dest + x, assemble4(
+					component4<16 + SrcShiftR, SrcShiftR>(pix),
+					component4< 8 + SrcShiftG, SrcShiftG>(pix),
+					component4< 0 + SrcShiftB, SrcShiftB>(pix)));
+		}
+#endif
+		for ( ; x < count; x++)
+			dest[x] = dest_assemble_rgb(source32_r(src[x]), source32_g(src[x]), source32_b(src[x]));
+	}
+
+
+	//-------------------------------------------------
+	//  alpha - blend texels over the destination
+	//  by their own alpha, leaving the destination
+	//  alone where they're fully transparent
+	//-------------------------------------------------
+
+	static void alpha(PixelType *dest, u32 const *src, u32 count)
+	{
+		u32 x = 0;
+#if defined(MAME_RENDER_SPAN_SSE2)
+		if constexpr (!NoDestRead)
+		{
+			__m128i const zero = _mm_setzero_si128();
+			__m128i const full = _mm_set1_epi32(0x100);
+			for ( ; (x + 4) <= count; x += 4)
+			{
+				__m128i const pix = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + x));
+				__m128i const ta = _mm_srli_epi32(pix, 24);
+				__m128i const keep = _mm_cmpeq_epi32(ta, zero);
+				if (_mm_movemask_epi8(keep) == 0xffff)
+					continue;
+				__m128i const weights = pair4(ta, _mm_sub_epi32(full, ta));
+				__m128i const dpix = load4(dest + x);
+				__m128i const r = _mm_srli_epi32(_mm_madd_epi16(pair4(component4<16 + SrcShiftR, SrcShiftR>(pix), component4<DstShiftR, SrcShiftR>(dpix)), weights), 8);
+				__m128i const g = _mm_srli_epi32(_mm_madd_epi16(pair4(component4< 8 + SrcShiftG, SrcShiftG>(pix), component4<DstShiftG, SrcShiftG>(dpix)), weights), 8);
+				__m128i const b = _mm_srli_epi32(_mm_madd_epi16(pair4(component4< 0 + SrcShiftB, SrcShiftB>(pix), component4<DstShiftB, SrcShiftB>(dpix)), weights), 8);
+				store4(dest + x, select4(keep, dpix, assemble4(r, g, b)));
+			}
+		}
+#endif
+		for ( ; x < count; x++)
+		{
+			u32 const pix = src[x];
+			u32 const ta = pix >> 24;
+			if (ta != 0)
+			{
+				u32 const dpix = NoDestRead ? 0 : dest[x];
+				u32 const invta = 0x100 - ta;
+				u32 const r = (source32_r(pix) * ta + dest_r(dpix) * invta) >> 8;
+				u32 const g = (source32_g(pix) * ta + dest_g(dpix) * invta) >> 8;
+				u32 const b = (source32_b(pix) * ta + dest_b(dpix) * invta) >> 8;
+				dest[x] = dest_assemble_rgb(r, g, b);
+			}
+		}
+	}
+
+
+	//-------------------------------------------------
+	//  blend - mix scaled texels with the
+	//  destination scaled by 'invsa'; the scales
+	//  are 0-256
+	//-------------------------------------------------
+
+	static void blend(PixelType *dest, u32 const *src, u32 count, u32 sr, u32 sg, u32 sb, u32 invsa)
+	{
+		u32 x = 0;
+#if defined(MAME_RENDER_SPAN_SSE2)
+		if constexpr (!NoDestRead)
+		{
+			__m128i const wr = _mm_set1_epi32(sr | (invsa << 16));
+			__m128i const wg = _mm_set1_epi32(sg | (invsa << 16));
+			__m128i const wb = _mm_set1_epi32(sb | (invsa << 16));
+			for ( ; (x + 4) <= count; x += 4)
+			{
+				__m128i const pix = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + x));
+				__m128i const dpix = load4(dest + x);
+				__m128i const r = _mm_srli_epi32(_mm_madd_epi16(pair4(component4<16 + SrcShiftR, SrcShiftR>(pix), component4<DstShiftR, SrcShiftR>(dpix)), wr), 8);
+				__m128i const g = _mm_srli_epi32(_mm_madd_epi16(pair4(component4< 8 + SrcShiftG, SrcShiftG>(pix), component4<DstShiftG, SrcShiftG>(dpix)), wg), 8);
+				__m128i const b = _mm_srli_epi32(_mm_madd_epi16(pair4(component4< 0 + SrcShiftB, SrcShiftB>(pix), component4<DstShiftB, SrcShiftB>(dpix)), wb), 8);
+				store4(dest + x, assemble4(r, g, b));
+			}
+		}
+#endif
+		for ( ; x < count; x++)
+		{
+			u32 const pix = src[x];
+			u32 const dpix = NoDestRead ? 0 : dest[x];
+			u32 const r = (source32_r(pix) * sr + dest_r(dpix) * invsa) >> 8;
+			u32 const g = (source32_g(pix) * sg + dest_g(dpix) * invsa) >> 8;
+			u32 const b = (source32_b(pix) * sb + dest_b(dpix) * invsa) >> 8;
+			dest[x] = dest_assemble_rgb(r, g, b);
+		}
+	}
+
+
+	//-------------------------------------------------
+	//  add - add texels to the destination,
+	//  saturating each component
+	//-------------------------------------------------
+
+	static void add(PixelType *dest, u32 const *src, u32 count)
+	{
+		if constexpr (NoDestRead)
+			return;
+
+		u32 x = 0;
+#if defined(MAME_RENDER_SPAN_SSE2)
+		for ( ; (x + 4) <= count; x += 4)
+		{
+			__m128i const pix = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + x));
+			__m128i const dpix = load4(dest + x);
+			__m128i const r = _mm_min_epi16(_mm_add_epi32(component4<16 + SrcShiftR, SrcShiftR>(pix), component4<DstShiftR, SrcShiftR>(dpix)), _mm_set1_epi32(0xff >> SrcShiftR));
+			__m128i const g = _mm_min_epi16(_mm_add_epi32(component4< 8 + SrcShiftG, SrcShiftG>(pix), component4<DstShiftG, SrcShiftG>(dpix)), _mm_set1_epi32(0xff >> SrcShiftG));
+			__m128i const b = _mm_min_epi16(_mm_add_epi32(component4< 0 + SrcShiftB, SrcShiftB>(pix), component4<DstShiftB, SrcShiftB>(dpix)), _mm_set1_epi32(0xff >> SrcShiftB));
+			store4(dest + x, assemble4(r, g, b));
+		}
+#endif
+		for ( ; x < count; x++)
+		{
+			u32 const pix = src[x];
+			u32 const dpix = dest[x];
+			u32 r = source32_r(pix) + dest_r(dpix);
+			u32 g = source32_g(pix) + dest_g(dpix);
+			u32 b = source32_b(pix) + dest_b(dpix);
+			r = (r | -(r >> (8 - SrcShiftR))) & (0xff >> SrcShiftR);
+			g = (g | -(g >> (8 - SrcShiftG))) & (0xff >> SrcShiftG);
+			b = (b | -(b >> (8 - SrcShiftB))) & (0xff >> SrcShiftB);
+			dest[x] = dest_assemble_rgb(r, g, b);
+		}
+	}
+
+
+	//-------------------------------------------------
+	//  add_alpha - add texels scaled by their own
+	//  alpha to the destination, saturating each
+	//  component
+	//-------------------------------------------------
+
+	static void add_alpha(PixelType *dest, u32 const *src, u32 count)
+	{
+		if constexpr (NoDestRead)
+			return;
+
+		u32 x = 0;
+#if defined(MAME_RENDER_SPAN_SSE2)
+		__m128i const zero = _mm_setzero_si128();
+		for ( ; (x + 4) <= count; x += 4)
+		{
+			__m128i const pix = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + x));
+			__m128i const ta = _mm_srli_epi32(pix, 24);
+			__m128i const keep = _mm_cmpeq_epi32(ta, zero);
+			if (_mm_movemask_epi8(keep) == 0xffff)
+				continue;
+			__m128i const dpix = load4(dest + x);
+			__m128i const r = _mm_min_epi16(_mm_add_epi32(_mm_srli_epi32(_mm_madd_epi16(component4<16 + SrcShiftR, SrcShiftR>(pix), ta), 8), component4<DstShiftR, SrcShiftR>(dpix)), _mm_set1_epi32(0xff >> SrcShiftR));
+			__m128i const g = _mm_min_epi16(_mm_add_epi32(_mm_srli_epi32(_mm_madd_epi16(component4< 8 + SrcShiftG, SrcShiftG>(pix), ta), 8), component4<DstShiftG, SrcShiftG>(dpix)), _mm_set1_epi32(0xff >> SrcShiftG));
+			__m128i const b = _mm_min_epi16(_mm_add_epi32(_mm_srli_epi32(_mm_madd_epi16(component4< 0 + SrcShiftB, SrcShiftB>(pix), ta), 8), component4<DstShiftB, SrcShiftB>(dpix)), _mm_set1_epi32(0xff >> SrcShiftB));
+			store4(dest + x, select4(keep, dpix, assemble4(r, g, b)));
+		}
+#endif
+		for ( ; x < count; x++)
+		{
+			u32 const pix = src[x];
+			u32 const ta = pix >> 24;
+			if (ta != 0)
+			{
+				u32 const dpix = dest[x];
+				u32 r = ((source32_r(pix) * ta) >> 8) + dest_r(dpix);
+				u32 g = ((source32_g(pix) * ta) >> 8) + dest_g(dpix);
+				u32 b = ((source32_b(pix) * ta) >> 8) + dest_b(dpix);
+				r = (r | -(r >> (8 - SrcShiftR))) & (0xff >> SrcShiftR);
+				g = (g | -(g >> (8 - SrcShiftG))) & (0xff >> SrcShiftG);
+				b = (b | -(b >> (8 - SrcShiftB))) & (0xff >> SrcShiftB);
+				dest[x] = dest_assemble_rgb(r, g, b);
+			}
+		}
+	}
+
+
+	//-------------------------------------------------
+	//  multiply - multiply the destination by the
+	//  texels
+	//-------------------------------------------------
+
+	static void multiply(PixelType *dest, u32 const *src, u32 count)
+	{
+		if constexpr (NoDestRead)
+			return;
+
+		u32 x = 0;
+#if defined(MAME_RENDER_SPAN_SSE2)
+		for ( ; (x + 4) <= count; x += 4)
+		{
+			__m128i const pix = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + x));
+			__m128i const dpix = load4(dest + x);
+			__m128i const r = _mm_srli_epi32(_mm_madd_epi16(component4<16 + SrcShiftR, SrcShiftR>(pix), component4<DstShiftR, SrcShiftR>(dpix)), 8 - SrcShiftR);
+			__m128i const g = _mm_srli_epi32(_mm_madd_epi16(component4< 8 + SrcShiftG, SrcShiftG>(pix), component4<DstShiftG, SrcShiftG>(dpix)), 8 - SrcShiftG);
+			__m128i const b = _mm_srli_epi32(_mm_madd_epi16(component4< 0 + SrcShiftB, SrcShiftB>(pix), component4<DstShiftB, SrcShiftB>(dpix)), 8 - SrcShiftB);
+			store4(dest + x, assemble4(r, g, b));
+		}
+#endif
+		for ( ; x < count; x++)
+		{
+			u32 const pix = src[x];
+			u32 const dpix = dest[x];
+			u32 const r = (source32_r(pix) * dest_r(dpix)) >> (8 - SrcShiftR);
+			u32 const g = (source32_g(pix) * dest_g(dpix)) >> (8 - SrcShiftG);
+			u32 const b = (source32_b(pix) * dest_b(dpix)) >> (8 - SrcShiftB);
+			dest[x] = dest_assemble_rgb(r, g, b);
+		}
+	}
+};
+
+#endif // MAME_EMU_VIDEO_RENDSPAN_H
@@ -19,6 +19,9 @@
 #ifdef __SSE4_1__
 #include <smmintrin.h>
 #endif
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 
 /***************************************************************************
@@ -304,6 +307,38 @@ public:
 
 	void scale_and_clamp(const rgbaint_t& scale);
 
+	// two pixels at once, with the same results as calling blend() and
+	// scale_and_clamp() on each; with AVX2 both go in one 256-bit register
+	static inline void blend_x2(rgbaint_t& color0, rgbaint_t& color1, const rgbaint_t& other0, const rgbaint_t& other1, u8 factor0, u8 factor1)
+	{
+#ifdef __AVX2__
+		const __m256i scale1 = combine_x2(_mm_set1_epi32(factor0), _mm_set1_epi32(factor1));
+		const __m256i scale2 = _mm256_sub_epi32(_mm256_set1_epi32(0x100), scale1);
+		__m256i result = _mm256_mullo_epi32(combine_x2(color0.m_value, color1.m_value), scale1);
+		result = _mm256_add_epi32(result, _mm256_mullo_epi32(combine_x2(other0.m_value, other1.m_value), scale2));
+		result = _mm256_srai_epi32(result, 8);
+		color0.m_value = _mm256_castsi256_si128(result);
+		color1.m_value = _mm256_extracti128_si256(result, 1);
+#else
+		color0.blend(other0, factor0);
+		color1.blend(other1, factor1);
+#endif
+	}
+
+	static inline void scale_and_clamp_x2(rgbaint_t& color0, rgbaint_t& color1, const rgbaint_t& scale0, const rgbaint_t& scale1)
+	{
+#ifdef __AVX2__
+		__m256i result = _mm256_mullo_epi32(combine_x2(color0.m_value, color1.m_value), combine_x2(scale0.m_value, scale1.m_value));
+		result = _mm256_srai_epi32(result, 8);
+		result = _mm256_min_epi32(_mm256_max_epi32(result, _mm256_setzero_si256()), _mm256_set1_epi32(0xff));
+		color0.m_value = _mm256_castsi256_si128(result);
+		color1.m_value = _mm256_extracti128_si256(result, 1);
+#else
+		color0.scale_and_clamp(scale0);
+		color1.scale_and_clamp(scale1);
+#endif
+	}
+
 	// Leave this here in case Model3 blows up...
 	//inline void scale_imm_and_clamp(const s32 scale)
 	//{
@@ -492,6 +527,9 @@ protected:
 	static __m128i green_mask() { return *(__m128i *)&statics.green_mask[0]; }
 	static __m128i blue_mask() { return *(__m128i *)&statics.blue_mask[0]; }
 	static __m128i scale_factor(u8 index) { return *(__m128i *)&statics.scale_table[index][0]; }
+#ifdef __AVX2__
+	static __m256i combine_x2(__m128i lo, __m128i hi) { return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1); }
+#endif
 
 	__m128i m_value;
 
@@ -492,6 +492,21 @@ public:
 	void blend(const rgbaint_t& other, u8 factor);
 
 	void scale_and_clamp(const rgbaint_t& scale);
+
+	// two pixels at once, with the same results as calling blend() and
+	// scale_and_clamp() on each
+	static inline void blend_x2(rgbaint_t& color0, rgbaint_t& color1, const rgbaint_t& other0, const rgbaint_t& other1, u8 factor0, u8 factor1)
+	{
+		color0.blend(other0, factor0);
+		color1.blend(other1, factor1);
+	}
+
+	static inline void scale_and_clamp_x2(rgbaint_t& color0, rgbaint_t& color1, const rgbaint_t& scale0, const rgbaint_t& scale1)
+	{
+		color0.scale_and_clamp(scale0);
+		color1.scale_and_clamp(scale1);
+	}
+
 	void scale_imm_and_clamp(s32 scale);
 
 	void scale_add_and_clamp(const rgbaint_t& scale, const rgbaint_t& other)
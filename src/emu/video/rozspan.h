@@ -0,0 +1,240 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    rozspan.h
+
+    Row operations for drawing a tilemap pixmap with rotation and zoom.
+    A row steps a 16.16 source coordinate per destination pixel; the
+    clip test is solved for the whole row up front, so that the kernels
+    only see pixels known to be inside the pixmap (or wrapped into it).
+    Rows drawn to 16-bit destinations test and write 8 pixels at a time
+    using SIMD where it's available.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_VIDEO_ROZSPAN_H
+#define MAME_EMU_VIDEO_ROZSPAN_H
+
+#pragma once
+
+#include <algorithm>
+
+// use SSE on 64-bit implementations, where it can be assumed
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define MAME_ROZ_SPAN_SSE2
+#include <emmintrin.h>
+#endif
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+// the pixmap and flags map a row is drawn from; both share a row stride,
+// and wrapping assumes power-of-two dimensions
+struct roz_span_source
+{
+	const u16 *     pixmap;                 // pixel at (0,0) of the pixmap
+	const u8 *      flagsmap;               // pixel at (0,0) of the flags map
+	u32             rowpixels;              // pixels between rows of both
+	u32             width;                  // width in pixels
+	u32             height;                 // height in pixels
+};
+
+
+/***************************************************************************
+    CLIPPING
+***************************************************************************/
+
+/*-------------------------------------------------
+    roz_span_clip_axis - find the pixels of a row
+    whose coordinate along one axis is below
+    'limit'; returns false if the coordinate
+    passes 2^32 within the row, when the pixels
+    don't form a single run
+-------------------------------------------------*/
+
+inline bool roz_span_clip_axis(u32 start, s32 inc, u32 limit, u32 count, u32 &first, u32 &end)
+{
+	s64 const last = s64(start) + s64(inc) * s64(count - 1);
+	if ((last < 0) || (last > s64(u32(~0))))
+		return false;
+
+	first = 0;
+	end = count;
+	if (start >= limit)
+	{
+		// already past the limit: only a decreasing coordinate comes back
+		if (inc >= 0)
+			end = 0;
+		else
+			first = u32(std::min<u64>(count, (u64(start - limit) / u64(-s64(inc))) + 1));
+	}
+	else if (inc > 0)
+	{
+		end = u32(std::min<u64>(count, (u64(limit - start) + inc - 1) / u64(inc)));
+	}
+	return true;
+}
+
+
+/*-------------------------------------------------
+    roz_span_clip - find the run of pixels in a
+    row that land inside the source; returns
+    false if they can't be found this way
+-------------------------------------------------*/
+
+inline bool roz_span_clip(u32 cx, u32 cy, s32 incx, s32 incy, roz_span_source const &src, u32 count, u32 &first, u32 &end)
+{
+	if (!count)
+	{
+		first = end = 0;
+		return true;
+	}
+
+	u32 xfirst, xend, yfirst, yend;
+	if (!roz_span_clip_axis(cx, incx, src.width << 16, count, xfirst, xend) || !roz_span_clip_axis(cy, incy, src.height << 16, count, yfirst, yend))
+		return false;
+
+	first = std::max(xfirst, yfirst);
+	end = std::max(first, std::min(xend, yend));
+	return true;
+}
+
+
+/***************************************************************************
+    DRAWING
+***************************************************************************/
+
+/*-------------------------------------------------
+    roz_span_offset - pixmap offset of a source
+    coordinate, wrapped if requested
+-------------------------------------------------*/
+
+template <bool Wrap>
+inline u32 roz_span_offset(u32 cx, u32 cy, roz_span_source const &src)
+{
+	u32 x = cx >> 16;
+	u32 y = cy >> 16;
+	if (Wrap)
+	{
+		x &= src.width - 1;
+		y &= src.height - 1;
+	}
+	return y * src.rowpixels + x;
+}
+
+
+/*-------------------------------------------------
+    roz_span_draw - draw 'count' pixels of a row,
+    calling plot(dest, pixel) for each one whose
+    flags match and updating the priority bitmap
+    if 'pri' isn't null; without wrapping, every
+    pixel must be inside the source
+-------------------------------------------------*/
+
+template <bool Wrap, typename DestType, typename PlotFunc>
+inline void roz_span_draw(DestType *dest, u8 *pri, u32 count, u32 cx, u32 cy, s32 incx, s32 incy, roz_span_source const &src, u8 mask, u8 value, u32 priority, PlotFunc &&plot)
+{
+	for (u32 x = 0; x < count; x++, cx += incx, cy += incy)
+	{
+		u32 const offs = roz_span_offset<Wrap>(cx, cy, src);
+		if ((src.flagsmap[offs] & mask) == value)
+		{
+			plot(dest[x], src.pixmap[offs]);
+			if (pri)
+				pri[x] = (pri[x] & (priority >> 8)) | priority;
+		}
+	}
+}
+
+
+/*-------------------------------------------------
+    roz_span_draw_ind16 - roz_span_draw to a 16-bit
+    destination, adding 'priority >> 16' to each
+    pixel as the tilemap code does
+-------------------------------------------------*/
+
+template <bool Wrap>
+inline void roz_span_draw_ind16(u16 *dest, u8 *pri, u32 count, u32 cx, u32 cy, s32 incx, s32 incy, roz_span_source const &src, u8 mask, u8 value, u32 priority)
+{
+	u16 const color = u16(priority >> 16);
+	u32 x = 0;
+#if defined(MAME_ROZ_SPAN_SSE2)
+	// offsets are formed with 16-bit multiplies, which bounds the source size
+	if ((count >= 8) && (src.rowpixels < 0x8000) && (src.width <= 0x8000) && (src.height <= 0x8000))
+	{
+		__m128i const four_incx = _mm_set1_epi32(s32(u32(incx) * 4));
+		__m128i const four_incy = _mm_set1_epi32(s32(u32(incy) * 4));
+		__m128i const eight_incx = _mm_set1_epi32(s32(u32(incx) * 8));
+		__m128i const eight_incy = _mm_set1_epi32(s32(u32(incy) * 8));
+		__m128i const xmask = _mm_set1_epi32(Wrap ? s32(src.width - 1) : 0xffff);
+		__m128i const ymask = _mm_set1_epi32(Wrap ? s32(src.height - 1) : 0xffff);
+		__m128i const stride = _mm_set1_epi32(s32(1 | (src.rowpixels << 16)));
+		__m128i const vmask = _mm_set1_epi16(mask);
+		__m128i const vvalue = _mm_set1_epi16(value);
+		__m128i const vcolor = _mm_set1_epi16(s16(color));
+		__m128i const priand = _mm_set1_epi8(char(u8(priority >> 8)));
+		__m128i const prior = _mm_set1_epi8(char(u8(priority)));
+
+		// the low 16 bits of each lane hold x and the high 16 y, so one
+		// multiply-add makes y * rowpixels + x
+		auto const offsets4 =
+				[xmask, ymask, stride] (__m128i vcx, __m128i vcy)
+				{
+					__m128i const px = _mm_and_si128(_mm_srli_epi32(vcx, 16), xmask);
+					__m128i const py = _mm_and_si128(_mm_srli_epi32(vcy, 16), ymask);
+					return _mm_madd_epi16(_mm_or_si128(px, _mm_slli_epi32(py, 16)), stride);
+				};
+
+		__m128i vcx0 = _mm_setr_epi32(s32(cx), s32(cx + u32(incx)), s32(cx + u32(incx) * 2), s32(cx + u32(incx) * 3));
+		__m128i vcy0 = _mm_setr_epi32(s32(cy), s32(cy + u32(incy)), s32(cy + u32(incy) * 2), s32(cy + u32(incy) * 3));
+		__m128i vcx1 = _mm_add_epi32(vcx0, four_incx);
+		__m128i vcy1 = _mm_add_epi32(vcy0, four_incy);
+
+		alignas(16) u32 offs[8];
+		for ( ; (x + 8) <= count; x += 8)
+		{
+			_mm_store_si128(reinterpret_cast<__m128i *>(&offs[0]), offsets4(vcx0, vcy0));
+			_mm_store_si128(reinterpret_cast<__m128i *>(&offs[4]), offsets4(vcx1, vcy1));
+			vcx0 = _mm_add_epi32(vcx0, eight_incx);
+			vcy0 = _mm_add_epi32(vcy0, eight_incy);
+			vcx1 = _mm_add_epi32(vcx1, eight_incx);
+			vcy1 = _mm_add_epi32(vcy1, eight_incy);
+
+			// gather the flags first, and skip blocks with nothing to draw
+			__m128i const flags = _mm_setr_epi16(
+					src.flagsmap[offs[0]], src.flagsmap[offs[1]], src.flagsmap[offs[2]], src.flagsmap[offs[3]],
+					src.flagsmap[offs[4]], src.flagsmap[offs[5]], src.flagsmap[offs[6]], src.flagsmap[offs[7]]);
+			__m128i const draw = _mm_cmpeq_epi16(_mm_and_si128(flags, vmask), vvalue);
+			u32 const bits = _mm_movemask_epi8(draw);
+			if (!bits)
+				continue;
+
+			__m128i const pixels = _mm_add_epi16(vcolor, _mm_setr_epi16(
+					src.pixmap[offs[0]], src.pixmap[offs[1]], src.pixmap[offs[2]], src.pixmap[offs[3]],
+					src.pixmap[offs[4]], src.pixmap[offs[5]], src.pixmap[offs[6]], src.pixmap[offs[7]]));
+			__m128i *const out = reinterpret_cast<__m128i *>(dest + x);
+			if (bits == 0xffff)
+				_mm_storeu_si128(out, pixels);
+			else
+				_mm_storeu_si128(out, _mm_or_si128(_mm_and_si128(draw, pixels), _mm_andnot_si128(draw, _mm_loadu_si128(out))));
+
+			if (pri)
+			{
+				__m128i const drawbytes = _mm_packs_epi16(draw, draw);
+				__m128i const oldpri = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(pri + x));
+				__m128i const newpri = _mm_or_si128(_mm_and_si128(oldpri, priand), prior);
+				_mm_storel_epi64(reinterpret_cast<__m128i *>(pri + x), _mm_or_si128(_mm_and_si128(drawbytes, newpri), _mm_andnot_si128(drawbytes, oldpri)));
+			}
+		}
+		cx += u32(incx) * x;
+		cy += u32(incy) * x;
+	}
+#endif
+	roz_span_draw<Wrap>(dest + x, pri ? (pri + x) : nullptr, count - x, cx, cy, incx, incy, src, mask, value, priority,
+			[color] (u16 &d, u16 pixel) { d = pixel + color; });
+}
+
+#endif // MAME_EMU_VIDEO_ROZSPAN_H
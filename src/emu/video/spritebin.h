@@ -0,0 +1,179 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    spritebin.h
+
+    Per-scanline-band sprite lists.  A driver adds its sprites once per
+    list (in drawing order, with the rows each one covers), and each
+    screen update then only visits the sprites that intersect its
+    cliprect, still in drawing order.  This keeps drivers that do a
+    partial update every few lines from walking the whole sprite list
+    for every slice of the screen.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_VIDEO_SPRITEBIN_H
+#define MAME_EMU_VIDEO_SPRITEBIN_H
+
+#pragma once
+
+#include "bitmap.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+// ======================> sprite_bin_list
+
+template <typename T>
+class sprite_bin_list
+{
+public:
+	// a cliprect covering more bands than this is served by walking the whole list
+	static constexpr int MAX_MERGE_BANDS = 4;
+
+	// construction/destruction
+	sprite_bin_list(int bandshift = 4) : m_bandshift(bandshift) { }
+
+	// getters
+	bool empty() const { return m_entries.empty(); }
+	std::size_t size() const { return m_entries.size(); }
+
+	/*-------------------------------------------------
+	    reset - forget all sprites and set the rows
+	    that the bins cover; sprites are clamped to
+	    these rows
+	-------------------------------------------------*/
+
+	void reset(int min_y, int max_y)
+	{
+		m_entries.clear();
+		m_min_y = min_y;
+		m_max_y = max_y;
+
+		std::size_t const bands = (max_y >= min_y) ? (((max_y - min_y) >> m_bandshift) + 1) : 0;
+		if (m_bands.size() < bands)
+			m_bands.resize(bands);
+		for (std::size_t band = 0; band < bands; band++)
+			m_bands[band].clear();
+	}
+
+	void reset(const rectangle &area) { reset(area.top(), area.bottom()); }
+
+	/*-------------------------------------------------
+	    add - append a sprite covering rows min_y
+	    to max_y inclusive; sprites that cover no
+	    row of the bins are dropped
+	-------------------------------------------------*/
+
+	void add(const T &item, int min_y, int max_y)
+	{
+		min_y = std::max(min_y, m_min_y);
+		max_y = std::min(max_y, m_max_y);
+		if (min_y > max_y)
+			return;
+
+		u32 const index = m_entries.size();
+		m_entries.push_back(entry{ item, min_y, max_y });
+		for (int band = band_of(min_y), last = band_of(max_y); band <= last; band++)
+			m_bands[band].push_back(index);
+	}
+
+	/*-------------------------------------------------
+	    visit - call func(item) for every sprite
+	    covering any row from min_y to max_y, in the
+	    order they were added
+	-------------------------------------------------*/
+
+	template <typename F>
+	void visit(int min_y, int max_y, F &&func) const
+	{
+		min_y = std::max(min_y, m_min_y);
+		max_y = std::min(max_y, m_max_y);
+		if (min_y > max_y || m_entries.empty())
+			return;
+
+		int const first = band_of(min_y);
+		int const last = band_of(max_y);
+
+		// one band: its list is already in order
+		if (first == last)
+		{
+			for (u32 index : m_bands[first])
+				if (overlaps(m_entries[index], min_y, max_y))
+					func(m_entries[index].item);
+			return;
+		}
+
+		// a wide cliprect: the whole list is cheaper than merging
+		if (last - first + 1 > MAX_MERGE_BANDS)
+		{
+			for (const entry &e : m_entries)
+				if (overlaps(e, min_y, max_y))
+					func(e.item);
+			return;
+		}
+
+		// a few bands: merge their lists, taking each sprite only from
+		// the first band where it meets the cliprect
+		std::size_t cursor[MAX_MERGE_BANDS] = { };
+		while (true)
+		{
+			int best = -1;
+			u32 bestindex = 0;
+			for (int band = first; band <= last; band++)
+			{
+				const std::vector<u32> &list = m_bands[band];
+				std::size_t &pos = cursor[band - first];
+				while (pos < list.size() && !owned_by(m_entries[list[pos]], band, min_y, max_y))
+					pos++;
+				if (pos < list.size() && (best < 0 || list[pos] < bestindex))
+				{
+					best = band;
+					bestindex = list[pos];
+				}
+			}
+			if (best < 0)
+				break;
+			cursor[best - first]++;
+			func(m_entries[bestindex].item);
+		}
+	}
+
+	template <typename F>
+	void visit(const rectangle &cliprect, F &&func) const { visit(cliprect.top(), cliprect.bottom(), std::forward<F>(func)); }
+
+private:
+	// an added sprite and the rows it covers
+	struct entry
+	{
+		T       item;
+		int     min_y;
+		int     max_y;
+	};
+
+	int band_of(int y) const { return (y - m_min_y) >> m_bandshift; }
+
+	static bool overlaps(const entry &e, int min_y, int max_y) { return e.min_y <= max_y && e.max_y >= min_y; }
+
+	// true if this is the first band where the entry meets rows min_y..max_y
+	bool owned_by(const entry &e, int band, int min_y, int max_y) const
+	{
+		return overlaps(e, min_y, max_y) && band_of(std::max(e.min_y, min_y)) == band;
+	}
+
+	// internal state
+	int                             m_bandshift;        // log2 of the rows per band
+	int                             m_min_y = 0;        // first row covered by the bins
+	int                             m_max_y = -1;       // last row covered by the bins
+	std::vector<entry>              m_entries;          // sprites in drawing order
+	std::vector<std::vector<u32>>   m_bands;            // indices of the sprites touching each band
+};
+
+#endif // MAME_EMU_VIDEO_SPRITEBIN_H
@@ -38,8 +38,11 @@
 #include "osdepend.h"
 
 #include <algorithm>
+#include <future>
 #include <new>
+#include <queue>
 #include <set>
+#include <thread>
 #include <tuple>
 #include <cctype>
 #include <iostream>
@@ -132,11 +135,17 @@ const options_entry cli_option_entries[] =
 };
 
 
+struct audit_result
+{
+	media_auditor::summary  summary;
+	std::string             report;
+};
+
+
 void print_summary(
-		const media_auditor &auditor, media_auditor::summary summary, bool record_none_needed,
+		std::string const &report, media_auditor::summary summary, bool record_none_needed,
 		const char *type, const char *name, const char *parent,
-		unsigned &correct, unsigned &incorrect, unsigned &notfound,
-		util::ovectorstream &buffer)
+		unsigned &correct, unsigned &incorrect, unsigned &notfound)
 {
 	if (summary == media_auditor::NOTFOUND)
 	{
@@ -146,11 +155,7 @@ void print_summary(
 	else if (record_none_needed || (summary != media_auditor::NONE_NEEDED))
 	{
 		// output the summary of the audit
-		buffer.clear();
-		buffer.seekp(0);
-		auditor.summarize(name, &buffer);
-		buffer.put('\0');
-		osd_printf_info("%s", &buffer.vec()[0]);
+		osd_printf_info("%s", report);
 
 		// output the name of the driver and its parent
 		osd_printf_info("%sset %s ", type, name);
@@ -185,6 +190,85 @@ void print_summary(
 	}
 }
 
+
+void print_summary(
+		const media_auditor &auditor, media_auditor::summary summary, bool record_none_needed,
+		const char *type, const char *name, const char *parent,
+		unsigned &correct, unsigned &incorrect, unsigned &notfound,
+		util::ovectorstream &buffer)
+{
+	std::string report;
+	if ((summary != media_auditor::NOTFOUND) && (record_none_needed || (summary != media_auditor::NONE_NEEDED)))
+	{
+		buffer.clear();
+		buffer.seekp(0);
+		auditor.summarize(name, &buffer);
+		buffer.put('\0');
+		report = &buffer.vec()[0];
+	}
+	print_summary(report, summary, record_none_needed, type, name, parent, correct, incorrect, notfound);
+}
+
+
+//-------------------------------------------------
+//  audit_drivers - audit a list of drivers on
+//  worker threads, passing the results back in
+//  the order the drivers were given
+//-------------------------------------------------
+
+template <typename T, typename U>
+void audit_drivers(emu_options &options, std::vector<int> const &drivers, bool record_none_needed, T &&audit, U &&report)
+{
+	// each task audits a few drivers with its own enumerator and auditor
+	constexpr std::size_t BATCH_SIZE = 4;
+	std::size_t const maximum_outstanding = 2 * (std::max)(std::thread::hardware_concurrency(), 1U);
+	std::queue<std::future<std::vector<audit_result> > > tasks;
+
+	auto it = drivers.begin();
+	while ((drivers.end() != it) || !tasks.empty())
+	{
+		// keep enough batches in flight to cover the time spent waiting on storage
+		while ((drivers.end() != it) && (tasks.size() < maximum_outstanding))
+		{
+			auto const end = it + (std::min)(BATCH_SIZE, std::size_t(drivers.end() - it));
+			auto task_proc = [&options, &audit, record_none_needed, begin = it, end] ()
+					{
+						driver_enumerator drivlist(options);
+						drivlist.exclude_all();
+						for (auto index = begin; end != index; ++index)
+							drivlist.include(*index);
+
+						media_auditor auditor(drivlist);
+						util::ovectorstream buffer;
+						std::vector<audit_result> results;
+						results.reserve(end - begin);
+						while (drivlist.next())
+						{
+							audit_result &result = results.emplace_back();
+							result.summary = audit(auditor);
+							if ((result.summary != media_auditor::NOTFOUND) && (record_none_needed || (result.summary != media_auditor::NONE_NEEDED)))
+							{
+								buffer.clear();
+								buffer.seekp(0);
+								auditor.summarize(drivlist.driver().name, &buffer);
+								buffer.put('\0');
+								result.report = &buffer.vec()[0];
+							}
+						}
+						return results;
+					};
+			tasks.emplace(std::async(std::launch::async, std::move(task_proc)));
+			it = end;
+		}
+
+		// report the oldest batch, in the spirit of determinism
+		std::vector<audit_result> const results = tasks.front().get();
+		tasks.pop();
+		for (audit_result const &result : results)
+			report(result);
+	}
+}
+
 } // anonymous namespace
 
 
@@ -257,6 +341,8 @@ void cli_frontend::start_execution(mame_machine_manager *manager, const std::vec
 		mame_options::parse_standard_inis(m_options, option_errors);
 		m_osd.set_verbose(m_options.verbose());
 	}
+	archive_hash_cache::enable(m_options.hash_cache());
+	archive_index::enable(m_options.archive_index());
 
 	// otherwise, check for a valid system
 	load_translation(m_options);
@@ -350,6 +436,8 @@ int cli_frontend::execute(std::vector<std::string> &args)
 		m_result = EMU_ERR_FATALERROR;
 	}
 
+	archive_hash_cache::disable();
+	archive_index::disable();
 	util::archive_file::cache_clear();
 	delete manager;
 
@@ -991,23 +1079,14 @@ void cli_frontend::verifyroms(const std::vector<std::string> &args)
 	unsigned incorrect = 0;
 	unsigned notfound = 0;
 
-	// iterate over drivers
+	// find matching drivers
 	driver_enumerator drivlist(m_options);
-	media_auditor auditor(drivlist);
-	util::ovectorstream summary_string;
+	std::vector<int> drivers;
 	while (drivlist.next())
 	{
 		if (included(drivlist.driver().name))
 		{
-			// audit the ROMs in this set
-			media_auditor::summary summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
-
-			auto const clone_of = drivlist.clone();
-			print_summary(
-					auditor, summary, true,
-					"rom", drivlist.driver().name, (clone_of >= 0) ? drivlist.driver(clone_of).name : nullptr,
-					correct, incorrect, notfound,
-					summary_string);
+			drivers.emplace_back(drivlist.current());
 
 			// if it wasn't a wildcard, there can only be one
 			if (!iswild)
@@ -1015,6 +1094,24 @@ void cli_frontend::verifyroms(const std::vector<std::string> &args)
 		}
 	}
 
+	// audit the ROMs in these sets
+	auto driver = drivers.begin();
+	audit_drivers(
+			m_options, drivers, true,
+			[] (media_auditor &auditor) { return auditor.audit_media(AUDIT_VALIDATE_FAST); },
+			[&driver, &correct, &incorrect, &notfound] (audit_result const &result)
+			{
+				auto const clone_of = driver_list::clone(*driver);
+				print_summary(
+						result.report, result.summary, true,
+						"rom", driver_list::driver(*driver).name, (clone_of >= 0) ? driver_list::driver(clone_of).name : nullptr,
+						correct, incorrect, notfound);
+				++driver;
+			});
+
+	media_auditor auditor(drivlist);
+	util::ovectorstream summary_string;
+
 	if (iswild || !matchcount)
 	{
 		machine_config config(GAME_NAME(___empty), m_options);
@@ -1091,23 +1188,28 @@ void cli_frontend::verifysamples(const std::vector<std::string> &args)
 	unsigned matched = 0;
 
 	// iterate over drivers
-	media_auditor auditor(drivlist);
-	util::ovectorstream summary_string;
+	std::vector<int> drivers;
 	while (drivlist.next())
 	{
 		matched++;
-
-		// audit the samples in this set
-		media_auditor::summary summary = auditor.audit_samples();
-
-		auto const clone_of = drivlist.clone();
-		print_summary(
-				auditor, summary, false,
-				"sample", drivlist.driver().name, (clone_of >= 0) ? drivlist.driver(clone_of).name : nullptr,
-				correct, incorrect, notfound,
-				summary_string);
+		drivers.emplace_back(drivlist.current());
 	}
 
+	// audit the samples in these sets
+	auto driver = drivers.begin();
+	audit_drivers(
+			m_options, drivers, false,
+			[] (media_auditor &auditor) { return auditor.audit_samples(); },
+			[&driver, &correct, &incorrect, &notfound] (audit_result const &result)
+			{
+				auto const clone_of = driver_list::clone(*driver);
+				print_summary(
+						result.report, result.summary, false,
+						"sample", driver_list::driver(*driver).name, (clone_of >= 0) ? driver_list::driver(clone_of).name : nullptr,
+						correct, incorrect, notfound);
+				++driver;
+			});
+
 	// clear out any cached files
 	util::archive_file::cache_clear();
 
@@ -1758,6 +1860,8 @@ void cli_frontend::execute_commands(std::string_view exename)
 	mame_options::parse_standard_inis(m_options,option_errors);
 	if (option_errors.tellp() > 0)
 		osd_printf_error("%s\n", option_errors.str());
+	archive_hash_cache::enable(m_options.hash_cache());
+	archive_index::enable(m_options.archive_index());
 
 	// createconfig?
 	if (m_options.command() == CLICOMMAND_CREATECONFIG)
@@ -32,10 +32,16 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
+#include <condition_variable>
 #include <cstring>
+#include <exception>
 #include <future>
 #include <locale>
+#include <mutex>
+#include <optional>
 #include <queue>
+#include <thread>
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
@@ -102,6 +108,111 @@ private:
 };
 
 
+// runs batches of work asynchronously and hands results back in the order
+// they were added, capping both running and finished-but-unclaimed tasks
+template <typename T>
+class ordered_task_queue
+{
+public:
+	ordered_task_queue()
+		: m_maximum_active(std::thread::hardware_concurrency() + 10)
+		, m_maximum_outstanding(m_maximum_active + 20)
+		, m_active(0)
+	{
+	}
+
+	~ordered_task_queue()
+	{
+		// threads refer to the mutex, so wait for them to finish
+		while (!m_tasks.empty())
+		{
+			m_tasks.front().m_thread.wait();
+			m_tasks.pop();
+		}
+	}
+
+	// accessors
+	bool empty() const { return m_tasks.empty(); }
+	bool can_add() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return room();
+	}
+
+	// start a task
+	template <typename F>
+	void add(F &&proc)
+	{
+		std::promise<T> promise;
+		task t;
+		t.m_result = promise.get_future();
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			++m_active;
+		}
+		t.m_thread = std::async(
+				std::launch::async,
+				[this, proc = std::forward<F>(proc), promise = std::move(promise)] () mutable
+				{
+					try
+					{
+						promise.set_value(proc());
+					}
+					catch (...)
+					{
+						promise.set_exception(std::current_exception());
+					}
+					{
+						std::lock_guard<std::mutex> lock(m_mutex);
+						--m_active;
+					}
+					m_cond.notify_one();
+				});
+		m_tasks.emplace(std::move(t));
+	}
+
+	// if more tasks can be added, returns nothing as soon as there's room
+	// for another one; otherwise waits for the oldest task's result
+	std::optional<T> next(bool more)
+	{
+		task &front(m_tasks.front());
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_cond.wait(
+					lock,
+					[this, &front, more] ()
+					{
+						return (std::future_status::ready == front.m_result.wait_for(std::chrono::seconds(0)))
+								|| (more && room());
+					});
+		}
+		if (std::future_status::ready != front.m_result.wait_for(std::chrono::seconds(0)))
+			return std::nullopt;
+
+		std::optional<T> result(front.m_result.get());
+		front.m_thread.wait();
+		m_tasks.pop();
+		return result;
+	}
+
+private:
+	struct task
+	{
+		std::future<T>      m_result;
+		std::future<void>   m_thread;
+	};
+
+	bool room() const { return (m_active < m_maximum_active) && (m_tasks.size() < m_maximum_outstanding); }
+
+	unsigned int const          m_maximum_active;
+	std::size_t const           m_maximum_outstanding;
+	mutable std::mutex          m_mutex;
+	std::condition_variable     m_cond;
+	unsigned int                m_active;
+	std::queue<task>            m_tasks;
+};
+
+
 using device_type_set = std::set<std::add_pointer_t<device_type>, device_type_compare>;
 using device_type_vector = std::vector<std::add_pointer_t<device_type> >;
 
@@ -498,25 +609,17 @@ void info_xml_creator::output(std::ostream &out, const std::function<bool(const
 	if (include_devices && filter)
 		devset.emplace();
 
-	// prepare a queue of tasks - this is a FIFO queue because of the
-	// need to be deterministic
-	std::queue<std::future<prepared_info> > tasks;
-
-	// while we want to be deterministic, asynchronous task scheduling is not; so we want to
-	// track the amount of active tasks so that we can keep on spawning tasks even if we're
+	// prepare a queue of tasks - results come back in FIFO order because of
+	// the need to be deterministic, but we keep on spawning tasks while we're
 	// waiting on the task in the front of the queue
-	std::atomic<unsigned int> active_task_count = 0;
-	unsigned int const maximum_active_task_count = std::thread::hardware_concurrency() + 10;
-	unsigned int const maximum_outstanding_task_count = maximum_active_task_count + 20;
+	ordered_task_queue<prepared_info> tasks;
 
 	// loop until we're done enumerating drivers, and until there are no outstanding tasks
 	while (!filtered_drivlist.done() || !tasks.empty())
 	{
 		// loop until there are as many outstanding tasks as possible (we want to separately cap outstanding
 		// tasks and active tasks)
-		while (!filtered_drivlist.done()
-				&& (active_task_count < maximum_active_task_count)
-				&& (tasks.size() < maximum_outstanding_task_count))
+		while (!filtered_drivlist.done() && tasks.can_add())
 		{
 			// we want to launch a task; grab a packet of drivers to process
 			std::vector<std::reference_wrapper<const game_driver> > drivers = filtered_drivlist.next(20);
@@ -524,7 +627,7 @@ void info_xml_creator::output(std::ostream &out, const std::function<bool(const
 				break;
 
 			// do the dirty work asynchronously
-			auto task_proc = [&drivlist, drivers = std::move(drivers), include_devices, &active_task_count]
+			auto task_proc = [&drivlist, drivers = std::move(drivers), include_devices]
 					{
 						prepared_info result;
 						std::ostringstream stream;
@@ -536,33 +639,30 @@ void info_xml_creator::output(std::ostream &out, const std::function<bool(const
 
 						// capture the XML snippet
 						result.m_xml_snippet = std::move(stream).str();
-
-						// we're done with the task; decrement the counter and return
-						active_task_count--;
 						return result;
 					};
 
 			// add this task to the queue
-			active_task_count++;
-			tasks.emplace(std::async(std::launch::async, std::move(task_proc)));
+			tasks.add(std::move(task_proc));
 		}
 
 		// we've put as many outstanding tasks out as we can; are there any tasks outstanding?
 		if (!tasks.empty())
 		{
 			// wait for the oldest task to complete and get the info, in the spirit of determinism
-			prepared_info pi = tasks.front().get();
-			tasks.pop();
-
-			// emit whatever XML we accumulated in the task
-			output_header_if_necessary(out);
-			out << pi.m_xml_snippet;
-
-			// merge devices into devset, if appropriate
-			if (devset)
+			std::optional<prepared_info> pi = tasks.next(!filtered_drivlist.done());
+			if (pi)
 			{
-				for (const auto &x : pi.m_dev_set)
-					devset->insert(x);
+				// emit whatever XML we accumulated in the task
+				output_header_if_necessary(out);
+				out << pi->m_xml_snippet;
+
+				// merge devices into devset, if appropriate
+				if (devset)
+				{
+					for (const auto &x : pi->m_dev_set)
+						devset->insert(x);
+				}
 			}
 		}
 	}
@@ -878,19 +978,14 @@ void output_devices(std::ostream &out, emu_options &lookup_options, device_type_
 	auto const action = [&lookup_options, &out] (auto &types, auto deref)
 			{
 				// machinery for making output order deterministic and capping outstanding tasks
-				std::queue<std::future<std::string> > tasks;
-				std::atomic<unsigned int> active_task_count = 0;
-				unsigned int const maximum_active_task_count = std::thread::hardware_concurrency() + 10;
-				unsigned int const maximum_outstanding_task_count = maximum_active_task_count + 20;
+				ordered_task_queue<std::string> tasks;
 
 				// loop until we're done enumerating devices and there are no outstanding tasks
 				auto it = std::begin(types);
 				while ((std::end(types) != it) || !tasks.empty())
 				{
 					// look until there are as many outstanding tasks as possible
-					while ((std::end(types) != it)
-							&& (active_task_count < maximum_active_task_count)
-							&& (tasks.size() < maximum_outstanding_task_count))
+					while ((std::end(types) != it) && tasks.can_add())
 					{
 						device_type_vector batch;
 						batch.reserve(10);
@@ -900,7 +995,7 @@ void output_devices(std::ostream &out, emu_options &lookup_options, device_type_
 							break;
 
 						// do the dirty work asynchronously
-						auto task_proc = [&active_task_count, &lookup_options, batch = std::move(batch)]
+						auto task_proc = [&lookup_options, batch = std::move(batch)]
 								{
 									// use a single machine configuration and stream for a batch of devices
 									machine_config config(GAME_NAME(___empty), lookup_options);
@@ -926,25 +1021,22 @@ void output_devices(std::ostream &out, emu_options &lookup_options, device_type_
 										config.device_remove("_tmp");
 									}
 
-									// we're done with the task; decrement the counter and return
-									active_task_count--;
 									return std::move(stream).str();
 								};
 
 						// add this task to the queue
-						active_task_count++;
-						tasks.emplace(std::async(std::launch::async, std::move(task_proc)));
+						tasks.add(std::move(task_proc));
 					}
 
 					// we've put as many outstanding tasks out as we can; are there any tasks outstanding?
 					if (!tasks.empty())
 					{
 						// wait for the oldest task to complete and get the info, in the spirit of determinism
-						std::string snippet = tasks.front().get();
-						tasks.pop();
+						std::optional<std::string> snippet = tasks.next(std::end(types) != it);
 
 						// emit whatever XML we accumulated in the task
-						out << snippet;
+						if (snippet)
+							out << *snippet;
 					}
 				}
 			};
@@ -23,17 +23,23 @@
 #include "emuopts.h"
 #include "fileio.h"
 #include "inputdev.h"
+#include "memreport.h"
 #include "natkeyboard.h"
+#include "pcprof.h"
 #include "screen.h"
 #include "softlist.h"
 #include "uiinput.h"
 
+#include "chd.h"
 #include "corestr.h"
+#include "osdepend.h"
 
 #include <algorithm>
 #include <condition_variable>
 #include <cstring>
+#include <fstream>
 #include <mutex>
+#include <sstream>
 #include <thread>
 
 
@@ -677,6 +683,9 @@ void lua_engine::on_machine_resume()
 
 void lua_engine::on_machine_frame()
 {
+	// refresh memory snapshots before any scripts run
+	m_notifiers->on_frame_snapshot();
+
 	std::vector<int> tasks = std::move(m_frame_tasks);
 	m_frame_tasks.clear();
 	resume_tasks(m_lua_state, tasks, true); // TODO: doesn't need to return anything
@@ -749,10 +758,16 @@ void lua_engine::attach_notifiers()
 	machine().add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&lua_engine::on_machine_frame, this));
 	machine().save().register_presave(save_prepost_delegate(FUNC(lua_engine::on_machine_presave), this));
 	machine().save().register_postload(save_prepost_delegate(FUNC(lua_engine::on_machine_postload), this));
+	machine().memreport().add_source(memory_report::source_delegate(&lua_engine::report_memory, this));
 
 	m_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(lua_engine::resume), this));
 }
 
+void lua_engine::report_memory(memory_report &report)
+{
+	report.add("lua", "", "heap", (u64(lua_gc(m_lua_state, LUA_GCCOUNT, 0)) * 1024) + lua_gc(m_lua_state, LUA_GCCOUNTB, 0));
+}
+
 //-------------------------------------------------
 //  initialize - initialize lua hookup to emu engine
 //-------------------------------------------------
@@ -876,6 +891,15 @@ void lua_engine::initialize()
 	emu.set_function("add_machine_frame_notifier", make_notifier_adder(m_notifiers->on_frame, "machine frame"));
 	emu.set_function("add_machine_pre_save_notifier", make_notifier_adder(m_notifiers->on_presave, "machine pre-save"));
 	emu.set_function("add_machine_post_load_notifier", make_notifier_adder(m_notifiers->on_postload, "machine post-load"));
+	emu.set_function("profiler_trace_start", [] () { g_profiler.trace_start(); });
+	emu.set_function("profiler_trace_stop", [] () { g_profiler.trace_stop(); });
+	emu.set_function("profiler_trace_save",
+			[] (std::string const &filename)
+			{
+				std::ofstream file(filename, std::ios_base::out | std::ios_base::trunc);
+				return file.good() && g_profiler.trace_write(file);
+			});
+	emu.set_function("profiler_tracing", [] () { return g_profiler.tracing(); });
 	emu.set_function("print_error", [] (const char *str) { osd_printf_error("%s\n", str); });
 	emu.set_function("print_warning", [] (const char *str) { osd_printf_warning("%s\n", str); });
 	emu.set_function("print_info", [] (const char *str) { osd_printf_info("%s\n", str); });
@@ -1387,6 +1411,7 @@ void lua_engine::initialize()
 	machine_type.set_function("soft_reset", &running_machine::schedule_soft_reset);
 	machine_type.set_function("save", &running_machine::schedule_save); // TODO: some kind of completion notification?
 	machine_type.set_function("load", &running_machine::schedule_load); // TODO: some kind of completion notification?
+	machine_type.set_function("state_hash", [] (running_machine &m) { return util::string_format("%016x", m.state_hash()); });
 	machine_type.set_function("buffer_save",
 			[] (running_machine &m, sol::this_state s)
 			{
@@ -1430,6 +1455,24 @@ void lua_engine::initialize()
 					m.popmessage();
 			});
 	machine_type.set_function("logerror", [] (running_machine &m, char const *str) { m.logerror("[luaengine] %s\n", str); });
+	machine_type.set_function("memory_report",
+			[this] (running_machine &m)
+			{
+				memory_report &report = m.memreport();
+				report.collect();
+				sol::table result = sol().create_table();
+				int index = 1;
+				for (memory_report::entry const &entry : report.entries())
+				{
+					sol::table item = sol().create_table();
+					item["category"] = entry.m_category;
+					item["owner"] = entry.m_owner;
+					item["item"] = entry.m_item;
+					item["bytes"] = entry.m_bytes;
+					result[index++] = item;
+				}
+				return result;
+			});
 	machine_type["time"] = sol::property(&running_machine::time);
 	machine_type["system"] = sol::property(&running_machine::system);
 	machine_type["parameters"] = sol::property(&running_machine::parameters);
@@ -1453,6 +1496,7 @@ void lua_engine::initialize()
 	machine_type["options"] = sol::property(&running_machine::options);
 	machine_type["samplerate"] = sol::property(&running_machine::sample_rate);
 	machine_type["paused"] = sol::property(&running_machine::paused);
+	machine_type["deterministic"] = sol::property(&running_machine::deterministic);
 	machine_type["exit_pending"] = sol::property(&running_machine::exit_pending);
 	machine_type["hard_reset_pending"] = sol::property(&running_machine::hard_reset_pending);
 	machine_type["devices"] = sol::property([] (running_machine &m) { return devenum<device_enumerator>(m.root_device()); });
@@ -1461,6 +1505,93 @@ void lua_engine::initialize()
 	machine_type["cassettes"] = sol::property([] (running_machine &m) { return devenum<cassette_device_enumerator>(m.root_device()); });
 	machine_type["images"] = sol::property([] (running_machine &m) { return devenum<image_interface_enumerator>(m.root_device()); });
 	machine_type["slots"] = sol::property([](running_machine &m) { return devenum<slot_interface_enumerator>(m.root_device()); });
+	machine_type["scheduler"] = sol::property(&running_machine::scheduler);
+
+
+	auto scheduler_type = sol().registry().new_usertype<device_scheduler>("scheduler", sol::no_constructor);
+	auto const schedule_stats_table =
+			[this] (device_scheduler::schedule_stats const &stats)
+			{
+				sol::table table = sol().create_table();
+				table["timeslices"] = stats.m_timeslices;
+				table["aborts"] = stats.m_aborts;
+				table["timers_scheduled"] = stats.m_scheduled;
+				table["timers_removed"] = stats.m_removed;
+				table["timers_fired"] = stats.m_fired;
+				table["timer_callback_seconds"] = double(stats.m_callback_ticks) / double(osd_ticks_per_second());
+				return table;
+			};
+	auto const execute_stats_table =
+			[this] (device_execute_interface::execute_stats const &stats)
+			{
+				sol::table table = sol().create_table();
+				table["executed"] = stats.m_executed;
+				table["stolen"] = stats.m_stolen;
+				table["eaten"] = stats.m_eaten;
+				table["runs"] = stats.m_runs;
+				table["aborts"] = stats.m_aborts;
+				return table;
+			};
+	scheduler_type.set_function("dump_timers", &device_scheduler::dump_timers);
+	scheduler_type["time"] = sol::property(&device_scheduler::time);
+	scheduler_type["frames"] = sol::property(&device_scheduler::stats_frames);
+	scheduler_type["collect_timing"] = sol::property(&device_scheduler::collect_timing, &device_scheduler::set_collect_timing);
+	scheduler_type["last_frame"] = sol::property([schedule_stats_table] (device_scheduler &sched) { return schedule_stats_table(sched.last_frame_stats()); });
+	scheduler_type["total"] = sol::property([schedule_stats_table] (device_scheduler &sched) { return schedule_stats_table(sched.total_stats()); });
+	scheduler_type.set_function("profile_start",
+			[] (device_scheduler &sched, std::optional<u32> period, std::optional<u8> bucket_bits)
+			{
+				sched.profiler().start(attotime::from_usec(period ? std::max<u32>(*period, 1) : 100), bucket_bits ? *bucket_bits : 0);
+			});
+	scheduler_type.set_function("profile_stop", [] (device_scheduler &sched) { sched.profiler().stop(); });
+	scheduler_type.set_function("profile_reset", [] (device_scheduler &sched) { sched.profiler().reset(); });
+	scheduler_type.set_function("profile_add_range",
+			[] (device_scheduler &sched, device_t &device, offs_t start, offs_t end, std::string &&name)
+			{
+				return sched.profiler().add_range(device, start, end, std::move(name));
+			});
+	scheduler_type.set_function("profile_clear_ranges", [] (device_scheduler &sched, device_t &device) { sched.profiler().clear_ranges(device); });
+	scheduler_type.set_function("profile_counts",
+			[this] (device_scheduler &sched, device_t &device)
+			{
+				sol::table result = sol().create_table();
+				int index = 1;
+				for (auto const &count : sched.profiler().counts(device))
+				{
+					sol::table entry = sol().create_table();
+					entry["address_start"] = count.m_start;
+					entry["address_end"] = count.m_end;
+					if (!count.m_name.empty())
+						entry["name"] = count.m_name;
+					entry["count"] = count.m_count;
+					result[index++] = entry;
+				}
+				return result;
+			});
+	scheduler_type.set_function("profile_samples", [] (device_scheduler &sched, device_t &device) { return sched.profiler().samples(device); });
+	scheduler_type.set_function("profile_suspended", [] (device_scheduler &sched, device_t &device) { return sched.profiler().suspended(device); });
+	scheduler_type.set_function("profile_folded",
+			[] (device_scheduler &sched)
+			{
+				std::ostringstream result;
+				sched.profiler().write_folded(result);
+				return std::move(result).str();
+			});
+	scheduler_type["profiling"] = sol::property([] (device_scheduler &sched) { return sched.profiler().profiling(); });
+	scheduler_type["profile_ticks"] = sol::property([] (device_scheduler &sched) { return sched.profiler().ticks(); });
+	scheduler_type["devices"] = sol::property(
+			[this, execute_stats_table] (device_scheduler &sched)
+			{
+				sol::table table = sol().create_table();
+				for (device_execute_interface &exec : execute_interface_enumerator(sched.machine().root_device()))
+				{
+					sol::table entry = sol().create_table();
+					entry["last_frame"] = execute_stats_table(exec.last_frame_stats());
+					entry["total"] = execute_stats_table(exec.total_stats());
+					table[exec.device().tag()] = entry;
+				}
+				return table;
+			});
 
 
 	auto game_driver_type = sol().registry().new_usertype<game_driver>("game_driver", sol::no_constructor);
@@ -1929,6 +2060,20 @@ void lua_engine::initialize()
 				return si ? si->parentname().c_str() : nullptr;
 			});
 	image_type["device"] = sol::property(static_cast<device_t & (device_image_interface::*)()>(&device_image_interface::device));
+	image_type["chd_readahead"] = sol::property(
+			[] (device_image_interface &di, sol::this_state s) -> sol::object
+			{
+				chd_file const *const chd(di.image_chd());
+				if (!chd || !chd->readahead())
+					return sol::lua_nil;
+				chd_file::readahead_stats const &stats(chd->readahead_statistics());
+				sol::table result(sol::state_view(s).create_table());
+				result["hunks"] = chd->readahead();
+				result["queued"] = stats.m_queued;
+				result["hits"] = stats.m_hits;
+				result["misses"] = stats.m_misses;
+				return result;
+			});
 
 
 	auto state_entry_type = sol().registry().new_usertype<device_state_entry>("state_entry", sol::no_constructor);
@@ -2003,6 +2148,7 @@ void lua_engine::initialize()
 	auto video_type = sol().registry().new_usertype<video_manager>("video", sol::no_constructor);
 	video_type["frame_update"] = [] (video_manager &vm) { vm.frame_update(true); };
 	video_type["snapshot"] = &video_manager::save_active_screen_snapshots;
+	video_type["request_frame"] = [] (video_manager &vm, std::optional<u32> count) { vm.request_frame(count ? *count : 1); };
 	video_type["begin_recording"] =
 		[this] (video_manager &vm, const char *filename, const char *format_string)
 		{
@@ -2036,6 +2182,25 @@ void lua_engine::initialize()
 			luaL_pushresultsize(&buff, size);
 			return sol::make_reference(s, sol::stack_reference(s, -1));
 		};
+	video_type["frame_timing_csv"] = &video_manager::frame_timing_csv;
+	video_type["frame_timings"] = sol::property(
+			[this] (video_manager &vm)
+			{
+				double const seconds_per_tick = 1.0 / double(osd_ticks_per_second());
+				sol::table table = sol().create_table();
+				for (unsigned i = 0; i < vm.frame_timing_count(); i++)
+				{
+					video_manager::frame_timing const &timing = vm.frame_timing_entry(i);
+					sol::table entry = sol().create_table();
+					entry["emulate_seconds"] = timing.emulate * seconds_per_tick;
+					entry["render_seconds"] = timing.render * seconds_per_tick;
+					entry["present_seconds"] = timing.present * seconds_per_tick;
+					entry["sleep_seconds"] = timing.sleep * seconds_per_tick;
+					entry["skipped"] = timing.skipped;
+					table[i + 1] = entry;
+				}
+				return table;
+			});
 	video_type["speed_factor"] = sol::property(&video_manager::speed_factor);
 	video_type["throttled"] = sol::property(&video_manager::throttled, &video_manager::set_throttled);
 	video_type["throttle_rate"] = sol::property(&video_manager::throttle_rate, &video_manager::set_throttle_rate);
@@ -2043,6 +2208,7 @@ void lua_engine::initialize()
 	video_type["speed_percent"] = sol::property(&video_manager::speed_percent);
 	video_type["effective_frameskip"] = sol::property(&video_manager::effective_frameskip);
 	video_type["skip_this_frame"] = sol::property(&video_manager::skip_this_frame);
+	video_type["headless"] = sol::property(&video_manager::headless);
 	video_type["snap_native"] = sol::property(&video_manager::snap_native);
 	video_type["is_recording"] = sol::property(&video_manager::is_recording);
 	video_type["snapshot_target"] = sol::property(&video_manager::snapshot_target);
@@ -2079,6 +2245,21 @@ void lua_engine::initialize()
 			&sound_manager::attenuation,
 			&sound_manager::set_attenuation);
 	sound_type["recording"] = sol::property(&sound_manager::is_recording);
+	sound_type["output_status"] = sol::property(
+			[this] (sound_manager &sm) -> sol::object
+			{
+				osd_audio_status status;
+				if (!sm.output_status(status))
+					return sol::lua_nil;
+				sol::table result = sol().create_table();
+				result["sample_rate"] = status.sample_rate;
+				result["queued_frames"] = status.queued_frames;
+				result["device_frames"] = status.device_frames;
+				result["latency"] = status.latency_ms();
+				result["underruns"] = status.underruns;
+				result["overruns"] = status.overruns;
+				return result;
+			});
 
 
 	auto ui_type = sol().registry().new_usertype<mame_ui_manager>("ui", sol::no_constructor);
@@ -2097,6 +2278,7 @@ void lua_engine::initialize()
 	ui_type["single_step"] = sol::property(&mame_ui_manager::single_step, &mame_ui_manager::set_single_step);
 	ui_type["show_fps"] = sol::property(&mame_ui_manager::show_fps, &mame_ui_manager::set_show_fps);
 	ui_type["show_profiler"] = sol::property(&mame_ui_manager::show_profiler, &mame_ui_manager::set_show_profiler);
+	ui_type["show_frame_timing"] = sol::property(&mame_ui_manager::show_frame_timing, &mame_ui_manager::set_show_frame_timing);
 	ui_type["image_display_enabled"] = sol::property(&mame_ui_manager::image_display_enabled, &mame_ui_manager::set_image_display_enabled);
 
 
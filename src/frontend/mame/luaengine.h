@@ -148,6 +148,7 @@ private:
 		util::notifier<> on_pause;
 		util::notifier<> on_resume;
 		util::notifier<> on_frame;
+		util::notifier<> on_frame_snapshot;
 		util::notifier<> on_presave;
 		util::notifier<> on_postload;
 	};
@@ -159,6 +160,7 @@ private:
 	class palette_wrapper;
 	template <typename T> class bitmap_helper;
 	class tap_helper;
+	class watch_set;
 	class addr_space_change_notif;
 	class symbol_table_wrapper;
 	class expression_wrapper;
@@ -195,6 +197,7 @@ private:
 	void on_machine_frame();
 	void on_machine_presave();
 	void on_machine_postload();
+	void report_memory(memory_report &report);
 
 	void resume(s32 param);
 	void register_function(sol::function func, const char *id);
@@ -11,7 +11,10 @@
 #include "emu.h"
 #include "luaengine.ipp"
 
+#include "memprof.h"
+
 #include <cstring>
+#include <vector>
 
 
 namespace {
@@ -314,6 +317,68 @@ private:
 };
 
 
+//-------------------------------------------------
+//  watch_set - list of addresses read natively at
+//  the end of every frame
+//-------------------------------------------------
+
+class lua_engine::watch_set
+{
+public:
+	watch_set(watch_set const &) = delete;
+	watch_set(watch_set &&) = delete;
+
+	watch_set(lua_engine &host, addr_space const &space, std::vector<offs_t> &&addresses, int width)
+		: m_space(space)
+		, m_addresses(std::move(addresses))
+		, m_values(m_addresses.size(), 0U)
+		, m_width(width)
+	{
+		update();
+		m_subscription = host.m_notifiers->on_frame_snapshot.subscribe(delegate<void ()>(&watch_set::update, this));
+	}
+
+	std::size_t count() const noexcept { return m_values.size(); }
+	int width() const noexcept { return m_width; }
+	bool enabled() const noexcept { return bool(m_subscription); }
+	void set_enabled(lua_engine &host, bool enable)
+	{
+		if (!enable)
+			m_subscription.reset();
+		else if (!m_subscription)
+			m_subscription = host.m_notifiers->on_frame_snapshot.subscribe(delegate<void ()>(&watch_set::update, this));
+	}
+
+	u64 value(std::size_t index) const { return m_values[index]; }
+	std::vector<u64> const &values() const noexcept { return m_values; }
+
+	void update()
+	{
+		switch (m_width)
+		{
+		case  8: do_update<u8>();  break;
+		case 16: do_update<u16>(); break;
+		case 32: do_update<u32>(); break;
+		case 64: do_update<u64>(); break;
+		}
+	}
+
+private:
+	template <typename T>
+	void do_update()
+	{
+		for (std::size_t i = 0; m_addresses.size() > i; ++i)
+			m_values[i] = m_space.mem_read<T>(m_addresses[i]);
+	}
+
+	addr_space m_space;
+	std::vector<offs_t> const m_addresses;
+	std::vector<u64> m_values;
+	int const m_width;
+	util::notifier_subscription m_subscription;
+};
+
+
 //-------------------------------------------------
 //  mem_read - templated memory readers for <sign>,<size>
 //  -> manager:machine().devices[":maincpu"].spaces["program"]:read_i8(0xC000)
@@ -647,6 +712,158 @@ void lua_engine::initialize_memory(sol::table &emu)
 				luaL_pushresultsize(&buff, byte_count);
 				return sol::make_reference(s, sol::stack_reference(s, -1));
 			});
+	addr_space_type.set_function("read_values",
+			[] (addr_space &sp, sol::this_state s, u64 first, u64 last, int width, sol::object opt_step, sol::object opt_table) -> sol::object
+			{
+				u64 step = 1;
+				if (opt_step.is<u64>())
+				{
+					step = opt_step.as<u64>();
+					if ((step < 1) || (step > last - first))
+					{
+						luaL_error(s, "Invalid step");
+						return sol::lua_nil;
+					}
+				}
+
+				offs_t space_size = sp.space.addrmask();
+				if ((first > space_size) || (last > space_size) || (last < first))
+				{
+					luaL_error(s, "Invalid offset");
+					return sol::lua_nil;
+				}
+
+				// fill the supplied table if there is one so scripts can reuse it every frame
+				u64 const count = (last - first) / step + 1;
+				sol::table result = opt_table.is<sol::table>() ? opt_table.as<sol::table>() : sol::state_view(s).create_table(count, 0);
+				auto const fill = [&result, first, last, step] (auto read)
+						{
+							int index = 1;
+							for (u64 address = first; address <= last; address += step)
+								result.raw_set(index++, read(address));
+						};
+				switch (width)
+				{
+				case 8:  fill([&sp] (offs_t address) { return sp.mem_read<u8>(address); });  break;
+				case 16: fill([&sp] (offs_t address) { return sp.mem_read<u16>(address); }); break;
+				case 32: fill([&sp] (offs_t address) { return sp.mem_read<u32>(address); }); break;
+				case 64: fill([&sp] (offs_t address) { return sp.mem_read<u64>(address); }); break;
+				default:
+					luaL_error(s, "Invalid width. Must be 8/16/32/64");
+					return sol::lua_nil;
+				}
+				return result;
+			});
+	addr_space_type.set_function("write_values",
+			[] (addr_space &sp, sol::this_state s, u64 first, int width, sol::table values, sol::object opt_step)
+			{
+				u64 step = 1;
+				if (opt_step.is<u64>())
+				{
+					step = opt_step.as<u64>();
+					if (step < 1)
+					{
+						luaL_error(s, "Invalid step");
+						return;
+					}
+				}
+
+				std::size_t const count = values.size();
+				offs_t space_size = sp.space.addrmask();
+				if ((first > space_size) || (count && ((space_size - first) / step < (count - 1))))
+				{
+					luaL_error(s, "Invalid offset");
+					return;
+				}
+
+				auto const store = [&values, count, first, step] (auto write)
+						{
+							u64 address = first;
+							for (std::size_t index = 1; count >= index; ++index, address += step)
+								write(address, values.raw_get<u64>(index));
+						};
+				switch (width)
+				{
+				case 8:  store([&sp] (offs_t address, u64 value) { sp.mem_write<u8>(address, u8(value)); });   break;
+				case 16: store([&sp] (offs_t address, u64 value) { sp.mem_write<u16>(address, u16(value)); }); break;
+				case 32: store([&sp] (offs_t address, u64 value) { sp.mem_write<u32>(address, u32(value)); }); break;
+				case 64: store([&sp] (offs_t address, u64 value) { sp.mem_write<u64>(address, value); });      break;
+				default:
+					luaL_error(s, "Invalid width. Must be 8/16/32/64");
+					break;
+				}
+			});
+	addr_space_type.set_function("write_range",
+			[] (addr_space &sp, sol::this_state s, u64 first, int width, std::string_view data, sol::object opt_step)
+			{
+				u64 step = 1;
+				if (opt_step.is<u64>())
+				{
+					step = opt_step.as<u64>();
+					if (step < 1)
+					{
+						luaL_error(s, "Invalid step");
+						return;
+					}
+				}
+
+				if ((width != 8) && (width != 16) && (width != 32) && (width != 64))
+				{
+					luaL_error(s, "Invalid width. Must be 8/16/32/64");
+					return;
+				}
+
+				// data is packed in host byte order, as returned by read_range
+				std::size_t const count = data.length() / (width / 8);
+				offs_t space_size = sp.space.addrmask();
+				if ((first > space_size) || (count && ((space_size - first) / step < (count - 1))))
+				{
+					luaL_error(s, "Invalid offset");
+					return;
+				}
+
+				auto const store = [&sp, &data, count, first, step] (auto value)
+						{
+							using T = decltype(value);
+							u64 address = first;
+							for (std::size_t index = 0; count > index; ++index, address += step)
+							{
+								std::memcpy(&value, &data[index * sizeof(T)], sizeof(T));
+								sp.mem_write<T>(address, value);
+							}
+						};
+				switch (width)
+				{
+				case 8:  store(u8(0));  break;
+				case 16: store(u16(0)); break;
+				case 32: store(u32(0)); break;
+				case 64: store(u64(0)); break;
+				}
+			});
+	addr_space_type.set_function("add_watch_set",
+			[this] (addr_space &sp, sol::this_state s, sol::table addresses, int width) -> std::unique_ptr<watch_set>
+			{
+				if ((width != 8) && (width != 16) && (width != 32) && (width != 64))
+				{
+					luaL_error(s, "Invalid width. Must be 8/16/32/64");
+					return nullptr;
+				}
+
+				offs_t const space_size = sp.space.addrmask();
+				std::vector<offs_t> list;
+				list.reserve(addresses.size());
+				for (std::size_t index = 1; addresses.size() >= index; ++index)
+				{
+					u64 const address = addresses.raw_get<u64>(index);
+					if (address > space_size)
+					{
+						luaL_error(s, "Invalid offset");
+						return nullptr;
+					}
+					list.emplace_back(offs_t(address));
+				}
+				return std::make_unique<watch_set>(*this, sp, std::move(list), width);
+			});
 	addr_space_type.set_function("add_change_notifier",
 			[this] (addr_space &sp, sol::protected_function &&cb)
 			{
@@ -678,6 +895,48 @@ void lua_engine::initialize_memory(sol::table &emu)
 			{
 				return std::make_unique<tap_helper>(*this, sp.space, read_or_write::WRITE, start, end, std::move(name), std::move(cb));
 			});
+	addr_space_type.set_function("profile_start",
+			[] (addr_space &sp, std::optional<u32> period, std::optional<u32> window, std::optional<u8> page_bits)
+			{
+				sp.space.device().machine().memory().profiler().start(sp.space, period ? *period : 8, window ? *window : 1, page_bits ? *page_bits : 4);
+			});
+	addr_space_type.set_function("profile_stop", [] (addr_space &sp) { sp.space.device().machine().memory().profiler().stop(sp.space); });
+	addr_space_type.set_function("profile_reset", [] (addr_space &sp) { sp.space.device().machine().memory().profiler().reset(sp.space); });
+	addr_space_type.set_function("profile_handlers",
+			[] (addr_space &sp, sol::this_state s)
+			{
+				sol::table result = sol::state_view(s).create_table();
+				int index = 1;
+				for (auto const &handler : sp.space.device().machine().memory().profiler().handlers(sp.space))
+				{
+					sol::table entry = sol::state_view(s).create_table();
+					entry["name"] = handler.m_name;
+					entry["address_start"] = handler.m_start;
+					entry["address_end"] = handler.m_end;
+					entry["reads"] = handler.m_reads;
+					entry["writes"] = handler.m_writes;
+					result[index++] = entry;
+				}
+				return result;
+			});
+	addr_space_type.set_function("profile_pages",
+			[] (addr_space &sp, sol::this_state s)
+			{
+				sol::table result = sol::state_view(s).create_table();
+				int index = 1;
+				for (auto const &page : sp.space.device().machine().memory().profiler().pages(sp.space))
+				{
+					sol::table entry = sol::state_view(s).create_table();
+					entry["address_start"] = page.m_start;
+					entry["address_end"] = page.m_end;
+					entry["reads"] = page.m_reads;
+					entry["writes"] = page.m_writes;
+					result[index++] = entry;
+				}
+				return result;
+			});
+	addr_space_type["profiling"] = sol::property([] (addr_space &sp) { return sp.space.device().machine().memory().profiler().profiling(sp.space); });
+	addr_space_type["profile_frames"] = sol::property([] (addr_space &sp) { return sp.space.device().machine().memory().profiler().sampled_frames(sp.space); });
 	addr_space_type["name"] = sol::property([] (addr_space &sp) { return sp.space.name(); });
 	addr_space_type["shift"] = sol::property([] (addr_space &sp) { return sp.space.addr_shift(); });
 	addr_space_type["index"] = sol::property([] (addr_space &sp) { return sp.space.spacenum(); });
@@ -695,6 +954,32 @@ void lua_engine::initialize_memory(sol::table &emu)
 	tap_type["name"] = sol::property(&tap_helper::name);
 
 
+	auto watch_type = sol().registry().new_usertype<watch_set>("watch_set", sol::no_constructor);
+	watch_type.set_function("update", &watch_set::update);
+	watch_type.set_function("value",
+			[] (watch_set const &ws, sol::this_state s, std::size_t index) -> sol::object
+			{
+				if ((index < 1) || (index > ws.count()))
+					return sol::lua_nil;
+				return sol::make_object(s, ws.value(index - 1));
+			});
+	watch_type.set_function("values",
+			[] (watch_set const &ws, sol::this_state s, sol::object opt_table)
+			{
+				// fill the supplied table if there is one so scripts can reuse it every frame
+				std::vector<u64> const &values(ws.values());
+				sol::table result = opt_table.is<sol::table>() ? opt_table.as<sol::table>() : sol::state_view(s).create_table(values.size(), 0);
+				for (std::size_t index = 0; values.size() > index; ++index)
+					result.raw_set(index + 1, values[index]);
+				return result;
+			});
+	watch_type["count"] = sol::property(&watch_set::count);
+	watch_type["width"] = sol::property(&watch_set::width);
+	watch_type["enabled"] = sol::property(
+			&watch_set::enabled,
+			[this] (watch_set &ws, bool enable) { ws.set_enabled(*this, enable); });
+
+
 	auto addrmap_type = sol().registry().new_usertype<address_map>("addrmap", sol::no_constructor);
 	addrmap_type["spacenum"] = sol::readonly(&address_map::m_spacenum);
 	addrmap_type["device"] = sol::readonly(&address_map::m_device);
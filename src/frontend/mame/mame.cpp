@@ -370,6 +370,14 @@ void mame_machine_manager::before_load_settings(running_machine& machine)
 	m_lua->on_machine_before_load_settings();
 }
 
+void mame_machine_manager::start_script(running_machine &machine, std::string_view filename)
+{
+	// run it as the autoboot script, straight away
+	options().set_value(OPTION_AUTOBOOT_SCRIPT, filename, OPTION_PRIORITY_CMDLINE);
+	load_autoboot_script();
+	m_autoboot_timer->adjust(attotime::zero);
+}
+
 void mame_machine_manager::create_custom(running_machine &machine)
 {
 	// start the inifile manager
@@ -382,6 +390,11 @@ void mame_machine_manager::create_custom(running_machine &machine)
 	m_favorite = std::make_unique<favorite_manager>(m_ui->options());
 
 	// attempt to load the autoboot script if configured
+	load_autoboot_script();
+}
+
+void mame_machine_manager::load_autoboot_script()
+{
 	m_autoboot_script.reset();
 	if (*options().autoboot_script())
 	{
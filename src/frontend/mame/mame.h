@@ -60,6 +60,8 @@ public:
 
 	virtual void before_load_settings(running_machine& machine) override;
 
+	virtual void start_script(running_machine &machine, std::string_view filename) override;
+
 	std::vector<std::reference_wrapper<const std::string>> missing_mandatory_images();
 
 	/* execute as configured by the OPTION_SYSTEMNAME option on the specified options */
@@ -79,6 +81,8 @@ private:
 	mame_machine_manager &operator=(mame_machine_manager const &) = delete;
 	mame_machine_manager &operator=(mame_machine_manager &&) = delete;
 
+	void load_autoboot_script();
+
 	std::unique_ptr<plugin_options>    m_plugins;           // pointer to plugin options
 	std::unique_ptr<lua_engine>        m_lua;
 
@@ -167,6 +167,7 @@ mame_ui_manager::mame_ui_manager(running_machine &machine)
 	, m_showfps(false)
 	, m_showfps_end(0)
 	, m_show_profiler(false)
+	, m_show_frame_timing(false)
 	, m_popup_text_end(0)
 	, m_mouse_bitmap(32, 32)
 	, m_mouse_arrow_texture(nullptr)
@@ -405,8 +406,8 @@ void mame_ui_manager::display_startup_screens(bool first_time)
 	bool video_none = strcmp(downcast<osd_options &>(machine().options()).video(), OSDOPTVAL_NONE) == 0;
 
 	// disable everything if we are using -str for 300 or fewer seconds, or if we're the empty driver,
-	// or if we are debugging, or if there's no mame window to send inputs to
-	if (!first_time || (str > 0 && str < 60*5) || &machine().system() == &GAME_NAME(___empty) || (machine().debug_flags & DEBUG_FLAG_ENABLED) != 0 || video_none)
+	// or if we are debugging, or if there's no mame window to send inputs to, or nothing is drawn
+	if (!first_time || (str > 0 && str < 60*5) || &machine().system() == &GAME_NAME(___empty) || (machine().debug_flags & DEBUG_FLAG_ENABLED) != 0 || video_none || machine().video().headless())
 		show_gameinfo = show_warnings = show_mandatory_fileman = false;
 
 #if defined(__EMSCRIPTEN__)
@@ -1156,9 +1157,15 @@ bool mame_ui_manager::can_paste()
 
 void mame_ui_manager::draw_fps_counter(render_container &container)
 {
+	// add the audio output latency when the sound module can measure it
+	std::string text = machine().video().speed_text();
+	osd_audio_status audio;
+	if (machine().sound().output_status(audio))
+		text += string_format(_("\nAudio %1$.1f ms, %2$u underruns"), audio.latency_ms(), audio.underruns);
+
 	draw_text_full(
 			container,
-			machine().video().speed_text(),
+			text,
 			0.0f, 0.0f, 1.0f,
 			ui::text_layout::text_justify::RIGHT, ui::text_layout::word_wrapping::WORD,
 			OPAQUE_, rgb_t::white(), rgb_t::black(), nullptr, nullptr);
@@ -1181,6 +1188,58 @@ void mame_ui_manager::draw_profiler(render_container &container)
 }
 
 
+//-------------------------------------------------
+//  draw_frame_timing - draw a graph of where the
+//  time went for recent frames along the bottom
+//  of the screen
+//-------------------------------------------------
+
+void mame_ui_manager::draw_frame_timing(render_container &container)
+{
+	video_manager const &video = machine().video();
+	unsigned const count = video.frame_timing_count();
+
+	// the graph is two frame periods tall, with a line marking one period
+	screen_device const *const screen = screen_device_enumerator(machine().root_device()).first();
+	double const period = screen ? screen->frame_period().as_double() : (1.0 / 60.0);
+	float const scale = 0.5f / float(period * double(osd_ticks_per_second()));
+	float const x0 = 0.0f, x1 = 1.0f, y1 = 1.0f, height = 0.2f;
+	float const y0 = y1 - height;
+	float const width = (x1 - x0) / float(FRAME_TIMING_HISTORY);
+	u32 const flags = PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA);
+
+	container.add_rect(x0, y0, x1, y1, rgb_t(0xa0, 0x00, 0x00, 0x00), flags);
+	for (unsigned i = 0; i < count; i++)
+	{
+		video_manager::frame_timing const &timing = video.frame_timing_entry(i);
+		float const x = x1 - float(count - i) * width;
+		float y = y1;
+		auto const segment =
+				[&container, &y, x, width, y0, scale, height, flags] (osd_ticks_t ticks, rgb_t color)
+				{
+					float const top = std::max(y - float(ticks) * scale * height, y0);
+					if (top < y)
+						container.add_rect(x, top, x + width, y, color, flags);
+					y = top;
+				};
+		segment(timing.emulate, rgb_t(0xe0, 0x40, 0xc0, 0x40));
+		segment(timing.render, rgb_t(0xe0, 0xc0, 0xc0, 0x40));
+		segment(timing.present, rgb_t(0xe0, 0x40, 0x80, 0xe0));
+		segment(timing.sleep, rgb_t(0xe0, 0x80, 0x80, 0x80));
+		if (timing.skipped)
+			container.add_rect(x, y0, x + width, y0 + (height * 0.05f), rgb_t(0xe0, 0xe0, 0x20, 0x20), flags);
+	}
+	container.add_line(x0, y1 - (height * 0.5f), x1, y1 - (height * 0.5f), UI_LINE_WIDTH, rgb_t(0xc0, 0xff, 0xff, 0xff), flags);
+
+	draw_text_full(
+			container,
+			_("emulate / render / present / sleep"),
+			x0, y0, x1 - x0,
+			ui::text_layout::text_justify::LEFT, ui::text_layout::word_wrapping::NEVER,
+			OPAQUE_, rgb_t::white(), rgb_t::black(), nullptr, nullptr);
+}
+
+
 //-------------------------------------------------
 //  image_handler_ingame - execute display
 //  callback function for each image device
@@ -1234,6 +1293,10 @@ uint32_t mame_ui_manager::handler_ingame(render_container &container)
 	if (show_profiler())
 		draw_profiler(container);
 
+	// draw the frame timing graph if visible
+	if (show_frame_timing())
+		draw_frame_timing(container);
+
 	// if we're single-stepping, pause now
 	if (single_step())
 	{
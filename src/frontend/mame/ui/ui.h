@@ -183,6 +183,8 @@ public:
 	bool show_fps_counter();
 	void set_show_profiler(bool show);
 	bool show_profiler() const;
+	void set_show_frame_timing(bool show) { m_show_frame_timing = show; }
+	bool show_frame_timing() const { return m_show_frame_timing; }
 	void show_menu();
 	void show_mouse(bool status);
 	virtual bool is_menu_active() override;
@@ -194,6 +196,7 @@ public:
 	void request_quit();
 	void draw_fps_counter(render_container &container);
 	void draw_profiler(render_container &container);
+	void draw_frame_timing(render_container &container);
 
 	// slider controls
 	std::vector<ui::menu_item>&  get_slider_list();
@@ -245,6 +248,7 @@ private:
 	bool                    m_showfps;
 	osd_ticks_t             m_showfps_end;
 	bool                    m_show_profiler;
+	bool                    m_show_frame_timing;
 	osd_ticks_t             m_popup_text_end;
 	std::unique_ptr<uint8_t []> m_non_char_keys_down;
 
@@ -15,6 +15,8 @@
 #include "../plib/plists.h"
 #include "../plib/pstring.h"
 
+#include <vector>
+
 namespace netlist
 {
 	// -------------------------------------------------------------------------
@@ -55,6 +57,9 @@ namespace netlist
 		template <typename... Args>
 		void queue_push(Args &&...args) noexcept
 		{
+			if (config::use_queue_trace::value && m_queue_trace != nullptr)
+				trace_queue(detail::queue_trace_entry_t::PUSH,
+					detail::queue_t::entry_t(args...));
 			if (config::use_queue_stats::value && m_use_stats)
 				m_queue.emplace<true>(std::forward<Args>(
 					args)...); // NOLINT(performance-move-const-arg)
@@ -66,12 +71,29 @@ namespace netlist
 		template <class R>
 		void queue_remove(R &&elem) noexcept
 		{
+			if (config::use_queue_trace::value && m_queue_trace != nullptr)
+				trace_queue(detail::queue_trace_entry_t::REMOVE,
+					detail::queue_t::entry_t(netlist_time_ext::zero(), elem));
 			if (config::use_queue_stats::value && m_use_stats)
 				m_queue.remove<true>(std::forward<R>(elem));
 			else
 				m_queue.remove<false>(std::forward<R>(elem));
 		}
 
+		/// \brief record queue operations
+		///
+		/// Pushes, removes and pops on the main queue are appended to
+		/// `trace` until its capacity is reached. This only has an effect
+		/// if \ref NL_USE_QUEUE_TRACE is enabled. nltool uses this to
+		/// compare the queue types on real netlists. Pass nullptr to stop
+		/// recording.
+		///
+		void set_queue_trace(
+			std::vector<detail::queue_trace_entry_t> *trace) noexcept
+		{
+			m_queue_trace = trace;
+		}
+
 		// Control functions
 
 		void stop();
@@ -102,6 +124,9 @@ namespace netlist
 		template <bool KEEP_STATS>
 		void process_queue_stats(netlist_time_ext delta) noexcept;
 
+		void trace_queue(detail::queue_trace_entry_t::op_t op,
+			const detail::queue_t::entry_t &e) noexcept;
+
 		netlist_state_t &    m_state;
 		devices::nld_solver *m_solver;
 
@@ -114,6 +139,7 @@ namespace netlist
 		// PALIGNAS(16)
 		bool            m_use_stats;
 		detail::queue_t m_queue;
+		std::vector<detail::queue_trace_entry_t> *m_queue_trace;
 		// performance
 		plib::pperftime_t<true>  m_stat_mainloop;
 		plib::pperfcount_t<true> m_perf_out_processed;
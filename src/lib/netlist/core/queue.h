@@ -102,6 +102,23 @@ namespace netlist::detail
 
 	using queue_t = queue_base<device_arena, net_t>;
 
+	/// \brief A recorded queue operation
+	///
+	/// See netlist_t::set_queue_trace.
+	///
+	struct queue_trace_entry_t
+	{
+		enum op_t : std::uint8_t
+		{
+			PUSH,
+			REMOVE,
+			POP
+		};
+
+		op_t                                             m_op;
+		plib::queue_entry_t<netlist_time_ext, net_t *> m_entry;
+	};
+
 } // namespace netlist::detail
 
 #endif // NL_CORE_QUEUE_H_
@@ -59,8 +59,10 @@ namespace netlist::devices {
 		{
 			if (m_reset)
 				log_value(m_I());
-			m_sem_w.release();
+			// set done first: the writer only checks it once it has run
+			// out of buffers, and would otherwise wait forever
 			m_done = true;
+			m_sem_w.release();
 			m_write_thread.join();
 		}
 
@@ -94,6 +94,7 @@ namespace netlist
 		  state.pool(), config::max_queue_size::value,
 		  detail::queue_t::id_delegate(&netlist_state_t ::find_net_id, &state),
 		  detail::queue_t::obj_delegate(&netlist_state_t ::net_by_id, &state))
+	, m_queue_trace(nullptr)
 	{
 		state.save(*this,
 				   static_cast<plib::state_manager_t::callback_t &>(m_queue),
@@ -123,6 +124,13 @@ namespace netlist
 		m_state.reset();
 	}
 
+	void netlist_t::trace_queue(detail::queue_trace_entry_t::op_t op,
+		const detail::queue_t::entry_t &e) noexcept
+	{
+		if (m_queue_trace->size() < m_queue_trace->capacity())
+			m_queue_trace->push_back({op, e});
+	}
+
 	void netlist_t::stop()
 	{
 		log().debug("Printing statistics ...\n");
@@ -1092,6 +1100,8 @@ namespace netlist
 		{
 			m_time = m_queue.top().exec_time();
 			detail::net_t *obj(m_queue.top().object());
+			if (config::use_queue_trace::value && m_queue_trace != nullptr)
+				trace_queue(detail::queue_trace_entry_t::POP, m_queue.top());
 			m_queue.pop();
 
 			while (obj != nullptr)
@@ -1102,6 +1112,8 @@ namespace netlist
 				const detail::queue_t::entry_t *top = &m_queue.top();
 				m_time = top->exec_time();
 				obj = top->object();
+				if (config::use_queue_trace::value && m_queue_trace != nullptr)
+					trace_queue(detail::queue_trace_entry_t::POP, *top);
 				m_queue.pop();
 			}
 		}
@@ -1125,6 +1137,8 @@ namespace netlist
 
 				m_time = top->exec_time();
 				detail::net_t *const obj(top->object());
+				if (config::use_queue_trace::value && m_queue_trace != nullptr)
+					trace_queue(detail::queue_trace_entry_t::POP, *top);
 				m_queue.pop();
 
 				if (!!(obj == nullptr))
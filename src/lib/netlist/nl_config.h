@@ -99,6 +99,16 @@
 	#define NL_USE_FLOAT128 PUSE_FLOAT128
 #endif
 
+/// \brief Record event queue operations for `nltool --queue-bench`.
+///
+/// Even a disabled recording hook on the push path slows pong down by
+/// about 20%, so this has to be compiled in. `make queuebench` builds a
+/// separate nltool with this enabled.
+///
+#ifndef NL_USE_QUEUE_TRACE
+	#define NL_USE_QUEUE_TRACE (0)
+#endif
+
 // -----------------------------------------------------------------------------
 //  DEBUGGING
 // -----------------------------------------------------------------------------
@@ -158,6 +168,12 @@ namespace netlist
 		///
 		using use_queue_stats = std::integral_constant<bool, false>;
 
+		/// \brief  Enable recording of queue operations.
+		///
+		/// See \ref NL_USE_QUEUE_TRACE.
+		///
+		using use_queue_trace = std::integral_constant<bool, NL_USE_QUEUE_TRACE != 0>;
+
 		// ---------------------------------------------------------------------
 		// Time resolution
 		// ---------------------------------------------------------------------
@@ -259,11 +275,21 @@ namespace netlist
 		/// linear processing queue. This slows down execution by about 35%
 		/// on a Kaby Lake.
 		///
+		/// Use timed_queue_calendar to keep entries in buckets of about
+		/// 100ns. This processes events in exactly the same order as the
+		/// linear queue. The queue of TTL netlists is short, though: pong
+		/// and breakout average three to five entries, where the linear
+		/// queue is about twice as fast. `nltool --queue-bench` compares
+		/// the queues on a recording of a real run.
+		///
 		/// The default is the  linear queue.
 
 		// template <class A, class T>
 		// using timed_queue = plib::timed_queue_heap<A, T>;
 
+		// template <class A, class T>
+		// using timed_queue = plib::timed_queue_calendar<A, T>;
+
 		template <typename A, typename T>
 		using timed_queue = plib::timed_queue_linear<A, T>;
 	};
@@ -406,35 +406,31 @@ namespace netlist
 	bool
 	nlparse_t::parse_stream(plib::istream_uptr &&in_stream, const pstring &name)
 	{
-#if 0
-		auto key = in_stream.filename();
+		// A library file is opened once for every netlist it is asked for,
+		// so keep its tokens keyed by file name and contents. The defines
+		// and includes don't change once parsing has started.
+		const auto filename = in_stream.filename();
+		std::ostringstream raw;
+		raw << in_stream->rdbuf();
+		std::string text(raw.str());
 
-		if (m_source_cache.find(key) != m_source_cache.end())
-		{
-			return parser_t(*this).parse(m_source_cache[key], name);
-		}
-		else
+		const pstring key = filename + ":"
+			+ plib::pfmt("{1:x}")(plib::hash<std::uint64_t>(text.data(), text.size()));
+		auto cached = m_source_cache.find(key);
+		if (cached == m_source_cache.end())
 		{
+			auto source = std::make_unique<std::istringstream>(std::move(text));
+			source->imbue(std::locale::classic());
 			auto preprocessed = std::make_unique<std::stringstream>(
-					plib::ppreprocessor(m_includes, &m_defines).process(std::move(in_stream), in_stream.filename()));
+				putf8string(plib::ppreprocessor(m_includes, &m_defines)
+								.process(plib::istream_uptr(std::move(source), filename), filename)));
 
-			parser_t::token_store_t &st = m_source_cache[key];
+			cached = m_source_cache.emplace(key, parser_t::token_store_t()).first;
 			parser_t parser(*this);
-			parser.parse_tokens(plib::istream_uptr(std::move(preprocessed), key), st);
-			return parser.parse(st, name);
+			parser.parse_tokens(
+				plib::istream_uptr(std::move(preprocessed), filename), cached->second);
 		}
-#else
-		const auto filename = in_stream.filename();
-		auto       preprocessed = std::make_unique<std::stringstream>(
-			putf8string(plib::ppreprocessor(m_includes, &m_defines)
-							.process(std::move(in_stream), filename)));
-
-		parser_t::token_store_t st;
-		parser_t                parser(*this);
-		parser.parse_tokens(
-			plib::istream_uptr(std::move(preprocessed), filename), st);
-		return parser.parse(st, name);
-#endif
+		return parser_t(*this).parse(cached->second, name);
 	}
 
 	void nlparse_t::add_define(const pstring &define)
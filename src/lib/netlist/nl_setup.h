@@ -15,6 +15,7 @@
 #include "plib/psource.h"
 #include "plib/pstream.h"
 #include "plib/pstring.h"
+#include "plib/ptokenizer.h"
 
 #include <initializer_list>
 #include <memory>
@@ -281,6 +282,7 @@ namespace netlist
 		std::stack<pstring>                   m_namespace_stack;
 		plib::psource_collection_t            m_sources;
 		detail::abstract_t                   &m_abstract;
+		std::unordered_map<pstring, plib::detail::token_store_t> m_source_cache;
 
 		log_type &m_log;
 		unsigned  m_frontier_cnt;
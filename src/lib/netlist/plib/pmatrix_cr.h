@@ -19,6 +19,7 @@
 #include "pomp.h"
 #include "ptypes.h"
 #include "putil.h"              // <- container::contains
+#include "vector_ops.h"
 
 #include <algorithm>
 #include <array>
@@ -297,6 +298,14 @@ namespace plib
 			return { fill_max, ops };
 		}
 
+		template <typename M>
+		void build_from_fill_mat(const M &f, std::size_t max_fill = base_type::FILL_INFINITY - 1,
+			std::size_t band_width = base_type::FILL_INFINITY) noexcept(false)
+		{
+			base_type::build_from_fill_mat(f, max_fill, band_width);
+			build_gaussian_elimination_scheme();
+		}
+
 		template <typename V>
 		void gaussian_elimination(V & RHS) noexcept
 		{
@@ -304,36 +313,21 @@ namespace plib
 
 			for (std::size_t i = 0; i < iN - 1; i++)
 			{
-				std::size_t nzbdp = 0;
-				std::size_t pi = base_type::diagonal[i];
-				auto f = reciprocal(base_type::A[pi++]);
-				const std::size_t piie = base_type::row_idx[i+1];
+				const auto f = reciprocal(base_type::A[base_type::diagonal[i]]);
 
-				const auto *nz = base_type::m_nzbd[i];
-				while (auto j = nz[nzbdp++]) // NOLINT(bugprone-infinite-loop)
+				for (std::size_t o = m_ge_row_ops[i]; o < m_ge_row_ops[i + 1]; o++)
 				{
-					// proceed to column i
-
-					std::size_t pj = base_type::row_idx[j];
-					std::size_t pje = base_type::row_idx[j+1];
-
-					while (base_type::col_idx[pj] < i)
-						pj++;
+					const auto &op = m_ge_ops[o];
+					const typename base_type::value_type f1 = - base_type::A[op.pivot] * f;
 
-					const typename base_type::value_type f1 = - base_type::A[pj++] * f;
-
-					// subtract row i from j
-					// fill-in available assumed, i.e. matrix was prepared
-
-					for (std::size_t pii = pi; pii<piie && pj < pje; pii++)
-					{
-						while (base_type::col_idx[pj] < base_type::col_idx[pii])
-							pj++;
-						if (base_type::col_idx[pj] == base_type::col_idx[pii])
-							base_type::A[pj++] += base_type::A[pii] * f1;
-					}
+					// subtract row i from row j
+					if (op.contiguous)
+						vec_add_mult_scalar_p(op.count, &base_type::A[m_ge_dst[op.first]], &base_type::A[m_ge_src[op.first]], f1);
+					else
+						for (std::size_t k = op.first; k < op.first + op.count; k++)
+							base_type::A[m_ge_dst[k]] += base_type::A[m_ge_src[k]] * f1;
 
-					RHS[j] += f1 * RHS[i];
+					RHS[op.row] += f1 * RHS[i];
 				}
 			}
 		}
@@ -424,6 +418,75 @@ namespace plib
 		}
 
 	private:
+		// one row operation of the elimination: row -= A(row, i) / A(i, i) * row i
+		struct ge_op
+		{
+			std::size_t row;        // row j
+			std::size_t pivot;      // position of A(j, i)
+			std::size_t first;      // first entry in m_ge_src/m_ge_dst
+			std::size_t count;      // number of elements updated
+			bool contiguous;        // both rows are consecutive runs
+		};
+
+		// Work out once which elements each row operation reads and
+		// updates, so the elimination doesn't have to merge column indices
+		// on every solve. Operations on consecutive runs of both rows are
+		// left to the vector kernel.
+		void build_gaussian_elimination_scheme()
+		{
+			const std::size_t iN = base_type::size();
+
+			m_ge_ops.clear();
+			m_ge_src.clear();
+			m_ge_dst.clear();
+			m_ge_row_ops.assign(iN + 1, 0);
+
+			for (std::size_t i = 0; i + 1 < iN; i++)
+			{
+				m_ge_row_ops[i] = m_ge_ops.size();
+
+				std::size_t nzbdp = 0;
+				const std::size_t pi = base_type::diagonal[i] + 1;
+				const std::size_t piie = base_type::row_idx[i+1];
+
+				const auto *nz = base_type::m_nzbd[i];
+				while (auto j = nz[nzbdp++]) // NOLINT(bugprone-infinite-loop)
+				{
+					// proceed to column i
+					std::size_t pj = base_type::row_idx[j];
+					const std::size_t pje = base_type::row_idx[j+1];
+
+					while (base_type::col_idx[pj] < i)
+						pj++;
+
+					ge_op op{ j, pj++, m_ge_src.size(), 0, false };
+
+					// fill-in available assumed, i.e. matrix was prepared
+					for (std::size_t pii = pi; pii<piie && pj < pje; pii++)
+					{
+						while (base_type::col_idx[pj] < base_type::col_idx[pii])
+							pj++;
+						if (base_type::col_idx[pj] == base_type::col_idx[pii])
+						{
+							m_ge_src.push_back(narrow_cast<index_type>(pii));
+							m_ge_dst.push_back(narrow_cast<index_type>(pj++));
+						}
+					}
+
+					op.count = m_ge_src.size() - op.first;
+					op.contiguous = op.count > 0;
+					for (std::size_t k = op.first + 1; k < op.first + op.count; k++)
+						if (m_ge_src[k] != m_ge_src[k - 1] + 1 || m_ge_dst[k] != m_ge_dst[k - 1] + 1)
+							op.contiguous = false;
+
+					m_ge_ops.push_back(op);
+				}
+			}
+			m_ge_row_ops[iN] = m_ge_ops.size();
+			if (iN > 0)
+				m_ge_row_ops[iN - 1] = m_ge_ops.size();
+		}
+
 		template <typename M>
 		void build_parallel_gaussian_execution_scheme(const M &fill) noexcept
 		{
@@ -481,6 +544,12 @@ namespace plib
 			//  printf("%d %d\n", (int) k, (int) m_ge_par[k].size());
 		}
 		std::vector<std::vector<std::size_t>> m_ge_par; // parallel execution support for Gauss
+
+		// precomputed gaussian elimination
+		std::vector<ge_op> m_ge_ops;
+		std::vector<std::size_t> m_ge_row_ops;  // first operation for each row, n + 1 entries
+		std::vector<index_type> m_ge_src;
+		std::vector<index_type> m_ge_dst;
 	};
 
 	template<typename B>
@@ -14,6 +14,7 @@
 #include "ptypes.h"
 
 #include <algorithm>
+#include <array>
 #include <mutex>
 #include <type_traits>
 #include <utility>
@@ -352,6 +353,280 @@ namespace plib {
 		pperfcount_t<true> m_prof_remove; // NOLINT
 	};
 
+	/// \brief Calendar queue
+	///
+	/// Entries due within the next `BUCKETS << SHIFT` time units are kept in
+	/// buckets of `1 << SHIFT` units each, entries beyond that in a sorted
+	/// overflow list. Each bucket is sorted like timed_queue_linear, top at
+	/// the end and the newest of equal times first, so entries come out in
+	/// exactly the same order as from the linear queue.
+	///
+	/// A push only has to sort itself into the few entries of its bucket
+	/// instead of moving past everything due earlier, which pays off once
+	/// queues get deep. With netlist's 100ps resolution the default buckets
+	/// are about 100ns wide, matching the gate delays of TTL logic.
+	///
+	template <class A, class T, std::size_t SHIFT = 10, std::size_t BUCKETS = 32>
+	class timed_queue_calendar
+	{
+	public:
+		static_assert((BUCKETS & (BUCKETS - 1)) == 0, "BUCKETS must be a power of two");
+
+		using list_type = plib::arena_vector<A, T>;
+
+		explicit timed_queue_calendar(A &arena, const std::size_t list_size)
+		: m_overflow(arena)
+		, m_snapshot(arena)
+		, m_capacity(list_size)
+		{
+			for (auto &b : m_buckets)
+				b.reserve(8);
+			clear();
+		}
+		~timed_queue_calendar() = default;
+
+		PCOPYASSIGNMOVE(timed_queue_calendar, delete)
+
+		std::size_t capacity() const noexcept { return m_capacity; }
+		bool empty() const noexcept { return m_size == 0; }
+
+		template <bool KEEPSTAT, typename... Args>
+		void emplace(Args&&... args) noexcept
+		{
+			push<KEEPSTAT>(T(std::forward<Args>(args)...));
+		}
+
+		template <bool KEEPSTAT>
+		void push(T &&e) noexcept
+		{
+			const raw_type t(e.exec_time().as_raw());
+			if (m_size == 0)
+				set_base(t);
+			else if (t < m_base)
+				rewind(t);
+			m_size++;
+			if (t < m_horizon)
+			{
+				m_wheel_size++;
+				insert<KEEPSTAT>(m_buckets[index(t)], std::move(e));
+			}
+			else
+				insert<KEEPSTAT>(m_overflow, std::move(e));
+			if constexpr (KEEPSTAT)
+				m_prof_call.inc();
+		}
+
+		void pop() noexcept
+		{
+			m_size--;
+			if (!m_buckets[m_cur].empty() || advance())
+			{
+				m_buckets[m_cur].pop_back();
+				m_wheel_size--;
+			}
+			else
+				m_overflow.pop_back();
+		}
+
+		const T &top() noexcept
+		{
+			if (!m_buckets[m_cur].empty())
+				return m_buckets[m_cur].back();
+			if (m_size == 0)
+				return m_never;
+			return advance() ? m_buckets[m_cur].back() : m_overflow.back();
+		}
+
+		bool exists(const typename T::element_type &elem) const noexcept
+		{
+			for (const auto &b : m_buckets)
+				if (std::find(b.begin(), b.end(), elem) != b.end())
+					return true;
+			return std::find(m_overflow.begin(), m_overflow.end(), elem) != m_overflow.end();
+		}
+
+		template <bool KEEPSTAT>
+		void remove(const T &elem) noexcept
+		{
+			// == operator ignores time!
+			remove<KEEPSTAT>(elem.object());
+		}
+
+		template <bool KEEPSTAT>
+		void remove(const typename T::element_type &elem) noexcept
+		{
+			if constexpr (KEEPSTAT)
+				m_prof_remove.inc();
+			// search in time order, as the linear queue does
+			std::size_t left = m_wheel_size;
+			for (std::size_t i = m_cur; left > 0; i = (i + 1) & MASK)
+			{
+				if (remove_from(m_buckets[i], elem))
+				{
+					m_wheel_size--;
+					m_size--;
+					return;
+				}
+				left -= m_buckets[i].size();
+			}
+			if (remove_from(m_overflow, elem))
+				m_size--;
+		}
+
+		void clear() noexcept
+		{
+			for (auto &b : m_buckets)
+				b.clear();
+			m_overflow.clear();
+			m_size = 0;
+			m_wheel_size = 0;
+			set_base(0);
+		}
+
+		// save state support & mame disassembler
+		//
+		// The entries are returned in the order of the linear queue. This
+		// is not for the hot path: the list is built on each call.
+
+		const T *list_pointer() const noexcept
+		{
+			m_snapshot.clear();
+			m_snapshot.insert(m_snapshot.end(), m_overflow.begin(), m_overflow.end());
+			for (std::size_t n = 0, i = (m_cur + MASK) & MASK; n < BUCKETS; n++, i = (i + MASK) & MASK)
+				m_snapshot.insert(m_snapshot.end(), m_buckets[i].begin(), m_buckets[i].end());
+			return m_snapshot.data();
+		}
+		std::size_t size() const noexcept { return m_size; }
+		const T & operator[](std::size_t index) const noexcept { return list_pointer()[index]; }
+
+	private:
+		using raw_type = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<T>().exec_time().as_raw())>>;
+
+		static constexpr std::size_t MASK = BUCKETS - 1;
+		static constexpr raw_type WIDTH = raw_type(1) << SHIFT;
+		static constexpr raw_type SPAN = WIDTH * raw_type(BUCKETS);
+
+		static constexpr std::size_t index(raw_type t) noexcept
+		{
+			return static_cast<std::size_t>(t >> SHIFT) & MASK;
+		}
+
+		void set_base(raw_type t) noexcept
+		{
+			m_base = t - (t & (WIDTH - 1));
+			m_cur = index(t);
+			set_horizon();
+		}
+
+		void set_horizon() noexcept
+		{
+			const raw_type never(T::never().exec_time().as_raw());
+			m_horizon = m_base <= never - SPAN ? m_base + SPAN : never;
+		}
+
+		template <bool KEEPSTAT, typename L>
+		void insert(L &l, T &&e) noexcept
+		{
+			l.push_back(std::move(e));
+			for (auto i = l.end() - 1; i != l.begin() && *(i - 1) < *i; --i)
+			{
+				std::swap(*(i - 1), *i);
+				if constexpr (KEEPSTAT)
+					m_prof_sort_move.inc();
+			}
+		}
+
+		template <typename L>
+		static bool remove_from(L &l, const typename T::element_type &elem) noexcept
+		{
+			for (auto i = l.end(); i != l.begin(); )
+			{
+				--i;
+				if (*i == elem)
+				{
+					l.erase(i);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		// move the overflow entries now within reach into their buckets
+		void migrate() noexcept
+		{
+			auto first(m_overflow.end());
+			while (first != m_overflow.begin() && (first - 1)->exec_time().as_raw() < m_horizon)
+				--first;
+			for (auto i = first; i != m_overflow.end(); ++i)
+				m_buckets[index(i->exec_time().as_raw())].push_back(std::move(*i));
+			m_wheel_size += narrow_cast<std::size_t>(m_overflow.end() - first);
+			m_overflow.erase(first, m_overflow.end());
+		}
+
+		// move on to the next bucket holding entries; returns false if the
+		// top entry is left in the overflow list
+		bool advance() noexcept
+		{
+			if (m_wheel_size == 0)
+			{
+				// nothing close by: jump ahead to the next entry
+				set_base(m_overflow.back().exec_time().as_raw());
+				migrate();
+				if (m_wheel_size == 0)
+					return false;
+			}
+			while (m_buckets[m_cur].empty())
+			{
+				// the bucket left behind now covers the end of the wheel
+				m_cur = (m_cur + 1) & MASK;
+				m_base += WIDTH;
+				set_horizon();
+				if (!m_overflow.empty() && m_overflow.back().exec_time().as_raw() < m_horizon)
+					migrate();
+			}
+			return true;
+		}
+
+		// an entry due before the current bucket: step back, moving the
+		// buckets at the end of the wheel, now out of reach, to the overflow
+		// list. They are due before anything already there.
+		void rewind(raw_type t) noexcept
+		{
+			while (t < m_base)
+			{
+				if (m_wheel_size == 0)
+				{
+					set_base(t);
+					return;
+				}
+				m_cur = (m_cur + MASK) & MASK;
+				m_base -= WIDTH;
+				set_horizon();
+				auto &b(m_buckets[m_cur]);
+				m_wheel_size -= b.size();
+				m_overflow.insert(m_overflow.end(), b.begin(), b.end());
+				b.clear();
+			}
+		}
+
+		std::array<std::vector<T>, BUCKETS> m_buckets;
+		list_type                           m_overflow;
+		mutable list_type                   m_snapshot;
+		std::size_t                         m_capacity;
+		std::size_t                         m_size = 0;
+		std::size_t                         m_wheel_size = 0;
+		std::size_t                         m_cur = 0;
+		raw_type                            m_base = 0;
+		raw_type                            m_horizon = 0;
+		const T                             m_never = T::never();
+
+	public:
+		// profiling
+		pperfcount_t<true> m_prof_sort_move; // NOLINT
+		pperfcount_t<true> m_prof_call; // NOLINT
+		pperfcount_t<true> m_prof_remove; // NOLINT
+	};
+
 } // namespace plib
 
 #endif // PTIMED_QUEUE_H_
@@ -22,10 +22,16 @@
 
 #include "plib/ptests.h"
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstdio> // scanf
+#include <cstdlib>
+#include <future>
 #include <iomanip> // scanf
 #include <ios>
 #include <iostream> // scanf
+#include <map>
 
 #ifndef NL_DISABLE_DYNAMIC_LOAD
 #define NL_DISABLE_DYNAMIC_LOAD 0
@@ -52,6 +58,7 @@ extern const plib::static_library::symbol nl_static_solver_syms[];
 // Forward declarations
 
 class netlist_tool_t;
+class solver_cache_t;
 
 class tool_app_t : public plib::app
 {
@@ -94,6 +101,9 @@ public:
 		opt_load_state(*this,"", "load-state",   "",        "load state from file and continue from there"),
 		opt_save_state(*this,"", "save-state",   "",        "save state to file at end of run"),
 		opt_fp_error(*this,  "", "fp-error",                "raise exception on floating point errors. This is intended to be used during debugging."),
+		opt_solver_cache(*this, "", "solver-cache", "",     "directory for static solvers compiled at runtime. Solvers which are neither built in nor found there are compiled in the background and used as soon as they are ready."),
+		opt_solver_cxx(*this, "", "solver-cxx", "c++ -O2 -shared -fPIC", "compiler command used for the solver cache. The output and source file are appended."),
+		opt_queue_bench(*this, "", "queue-bench",         "record the event queue operations of the run and replay them on each queue type. Needs nltool built with NL_USE_QUEUE_TRACE, see make queuebench."),
 
 		opt_grp5(*this,     "Options for convert command",  "These options are only used by the convert command."),
 		opt_type(*this,     "y", "type",        0,           std::vector<pstring>({"spice","eagle","rinf"}), "type of file to be converted: spice,eagle,rinf"),
@@ -167,6 +177,9 @@ private:
 	plib::option_str    opt_load_state;
 	plib::option_str    opt_save_state;
 	plib::option_bool   opt_fp_error;
+	plib::option_str    opt_solver_cache;
+	plib::option_str    opt_solver_cxx;
+	plib::option_bool   opt_queue_bench;
 
 	plib::option_group  opt_grp5;
 	plib::option_str_limit<unsigned> opt_type;
@@ -199,6 +212,8 @@ private:
 	void logger(plib::plog_level l, const pstring &ls);
 
 	void run_with_progress(netlist_tool_t &nt, netlist::netlist_time_ext start, netlist::netlist_time_ext duration);
+	void process_queue(netlist_tool_t &nt, netlist::netlist_time_ext duration);
+	void queue_bench(const std::vector<netlist::detail::queue_trace_entry_t> &trace);
 
 	void run();
 	void validate();
@@ -220,6 +235,7 @@ private:
 	void list_devices();
 
 	std::vector<pstring> m_defines;
+	solver_cache_t *m_solver_cache = nullptr;
 
 };
 
@@ -254,6 +270,118 @@ private:
 	pstring m_folder;
 };
 
+// Static solvers compiled at runtime. Symbols are looked up in the
+// built-in solvers first, then in one shared library per solver in the
+// cache directory. Missing solvers are written to the cache directory and
+// compiled on a background thread; a library only gets its final name once
+// the compiler has succeeded, so lookups never see a partial file.
+
+class solver_cache_t : public plib::dynamic_library_base
+{
+public:
+	solver_cache_t(const pstring &dir, const pstring &compiler)
+	: m_builtin(nl_static_solver_syms)
+	, m_dir(dir)
+	, m_compiler(compiler)
+	{
+		set_loaded(true);
+	}
+
+	~solver_cache_t() override { wait(); }
+
+	PCOPYASSIGNMOVE(solver_cache_t, delete)
+
+	// write the solvers not available yet and start compiling them;
+	// returns the number of solvers being compiled
+	std::size_t compile(const netlist::solver::static_compile_container &solvers)
+	{
+		std::vector<std::pair<pstring, pstring>> jobs;
+		for (const auto &e : solvers)
+		{
+			if (get_symbol_pointer(e.first) != nullptr)
+				continue;
+			pstring src(plib::util::build_path({m_dir, e.first + ".cpp"}));
+			plib::ofstream strm(plib::filesystem::u8path(src));
+			if (strm.fail())
+				throw netlist::nl_exception(netlist::MF_FILE_OPEN_ERROR(src));
+			strm << "// spell-checker: disable\n\n";
+			strm << "namespace plib { template<typename... Ts> inline void unused_var(Ts&&...) noexcept {} }\n\n";
+			strm << putf8string(e.second);
+			jobs.emplace_back(src, library_name(e.first));
+		}
+		if (!jobs.empty())
+		{
+			m_job = std::async(std::launch::async, [this, jobs]()
+			{
+				std::size_t failed = 0;
+				for (const auto &j : jobs)
+				{
+					putf8string tmp(j.second + ".tmp");
+					putf8string cmd(m_compiler + " -o \"" + pstring(tmp) + "\" \"" + j.first + "\" > \"" + j.first + ".log\" 2>&1");
+					if (std::system(cmd.c_str()) != 0 || std::rename(tmp.c_str(), putf8string(j.second).c_str()) != 0)
+						failed++;
+				}
+				return failed;
+			});
+		}
+		return jobs.size();
+	}
+
+	bool busy() const { return m_job.valid(); }
+
+	// returns true once, when the background compile has finished
+	bool finished()
+	{
+		if (!m_job.valid() || m_job.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			return false;
+		m_failed = m_job.get();
+		return true;
+	}
+
+	void wait()
+	{
+		if (m_job.valid())
+			m_failed = m_job.get();
+	}
+
+	std::size_t failed() const { return m_failed; }
+
+protected:
+	void *get_symbol_pointer(const pstring &name) const noexcept override
+	{
+		void *p = m_builtin.get_symbol<void *>(name);
+		if (p != nullptr)
+			return p;
+		auto it = m_libs.find(name);
+		if (it == m_libs.end())
+		{
+			// not cached as missing: the library may be built later
+			pstring lib(library_name(name));
+			if (!plib::util::exists(lib))
+				return nullptr;
+			it = m_libs.emplace(name, std::make_unique<plib::dynamic_library>(lib)).first;
+		}
+		return it->second->isLoaded() ? it->second->get_symbol<void *>(name) : nullptr;
+	}
+
+private:
+	pstring library_name(const pstring &name) const
+	{
+#ifdef _WIN32
+		return plib::util::build_path({m_dir, name + ".dll"});
+#else
+		return plib::util::build_path({m_dir, name + ".so"});
+#endif
+	}
+
+	plib::static_library m_builtin;
+	pstring m_dir;
+	pstring m_compiler;
+	mutable std::map<pstring, std::unique_ptr<plib::dynamic_library>> m_libs;
+	std::future<std::size_t> m_job;
+	std::size_t m_failed = 0;
+};
+
 class netlist_tool_t : public netlist::netlist_state_t
 {
 public:
@@ -419,7 +547,7 @@ static std::vector<input_t> read_input(const netlist::setup_t &setup, const pstr
 void tool_app_t::run_with_progress(netlist_tool_t &nt, netlist::netlist_time_ext start, netlist::netlist_time_ext duration)
 {
 	if (!opt_progress())
-		nt.exec().process_queue(duration);
+		process_queue(nt, duration);
 	else
 	{
 		auto now = nt.exec().time();
@@ -433,11 +561,11 @@ void tool_app_t::run_with_progress(netlist_tool_t &nt, netlist::netlist_time_ext
 			auto next_sec = start + netlist::netlist_time_ext::from_sec(elapsed_sec);
 			if (end < next_sec)
 			{
-				nt.exec().process_queue(end - now);
+				process_queue(nt, end - now);
 			}
 			else
 			{
-				nt.exec().process_queue(next_sec - now);
+				process_queue(nt, next_sec - now);
 				std_out("progress {1:4}s : {2}\r", elapsed_sec, pstring(gsl::narrow_cast<std::size_t>(elapsed_sec), '*'));
 				std_out.flush();
 			}
@@ -446,6 +574,24 @@ void tool_app_t::run_with_progress(netlist_tool_t &nt, netlist::netlist_time_ext
 	}
 }
 
+void tool_app_t::process_queue(netlist_tool_t &nt, netlist::netlist_time_ext duration)
+{
+	// while solvers are being compiled, run in slices so that they can be
+	// switched over as soon as they are ready
+	const auto slice(netlist::netlist_time_ext::from_msec(10));
+	while (m_solver_cache != nullptr && m_solver_cache->busy() && duration > slice)
+	{
+		nt.exec().process_queue(slice);
+		duration -= slice;
+		if (m_solver_cache->finished())
+		{
+			auto count = nt.exec().solver()->load_static_solvers();
+			std_out("solver cache: {1} static solvers in use at {2:.6f}\n", count, nt.exec().time().as_double());
+		}
+	}
+	nt.exec().process_queue(duration);
+}
+
 void tool_app_t::logger(plib::plog_level l, const pstring &ls)
 {
 	pstring err = plib::pfmt("{}: {}\n")(l.name())(ls.c_str());
@@ -474,8 +620,22 @@ void tool_app_t::run()
 
 	netlist_tool_t nt(plib::plog_delegate(&tool_app_t::logger, this), "netlist", opt_boost_lib());
 
+	if (opt_solver_cache.was_specified())
+	{
+		if (NL_DISABLE_DYNAMIC_LOAD)
+			throw netlist::nl_exception("Dynamic library loading not supported due to project security concerns.");
+		auto cache(std::make_unique<solver_cache_t>(opt_solver_cache(), opt_solver_cxx()));
+		m_solver_cache = cache.get();
+		nt.set_static_solver_lib(std::move(cache));
+	}
+
+	if (opt_queue_bench() && !netlist::config::use_queue_trace::value)
+		throw netlist::nl_exception("nltool: --queue-bench needs a build with NL_USE_QUEUE_TRACE");
+
 	nt.exec().enable_stats(opt_stats());
 
+	std::vector<netlist::detail::queue_trace_entry_t> queue_trace;
+
 	if (!opt_verb())
 		nt.log().verbose.set_enabled(false);
 	if (opt_quiet())
@@ -488,8 +648,21 @@ void tool_app_t::run()
 	// Inputs must be read before reset -> will clear setup and parser
 	inputs = read_input(nt.setup(), opt_inp());
 	nt.free_setup_resources();
+	if (opt_queue_bench())
+	{
+		// start recording before reset, which sets up the queue
+		queue_trace.reserve(4'000'000);
+		nt.exec().set_queue_trace(&queue_trace);
+	}
 	nt.exec().reset();
 
+	if (m_solver_cache != nullptr)
+	{
+		auto count = m_solver_cache->compile(nt.exec().solver()->create_solver_code(netlist::solver::CXX_EXTERNAL_C));
+		if (count > 0)
+			std_out("solver cache: compiling {1} static solvers in the background\n", count);
+	}
+
 	duration = netlist::netlist_time_ext::from_fp(opt_ttr());
 	t.stop();
 	std_out("startup time ==> {1:5.3f}\n", t.as_seconds<netlist::nl_fptype>() );
@@ -550,6 +723,22 @@ void tool_app_t::run()
 	}
 	nt.exec().stop();
 
+	if (m_solver_cache != nullptr)
+	{
+		// finish compiling so that the next run can use the solvers
+		m_solver_cache->wait();
+		if (m_solver_cache->failed() > 0)
+			std_out("solver cache: {1} static solvers failed to compile, see the logs in {2}\n",
+				m_solver_cache->failed(), opt_solver_cache());
+		m_solver_cache = nullptr;
+	}
+
+	if (opt_queue_bench())
+	{
+		nt.exec().set_queue_trace(nullptr);
+		queue_bench(queue_trace);
+	}
+
 	if (opt_progress())
 		std_out("\n");
 	auto emulation_time(t.as_seconds<netlist::nl_fptype>());
@@ -558,6 +747,73 @@ void tool_app_t::run()
 			(duration - start).as_fp<netlist::nl_fptype>() / emulation_time * netlist::nlconst::hundred());
 }
 
+// Replay a recorded trace. Returns the time taken and counts the pops
+// which differ from the recorded ones, i.e. ties taken in another order.
+template <typename Q>
+static netlist::nl_fptype replay_queue(const std::vector<netlist::detail::queue_trace_entry_t> &trace, std::size_t &mismatches)
+{
+	using trace_entry = netlist::detail::queue_trace_entry_t;
+	plib::chrono::timer<plib::chrono::system_ticks> t;
+	Q queue(plib::aligned_arena<>::instance(), netlist::config::max_queue_size::value);
+
+	mismatches = 0;
+	t.start();
+	for (const auto &e : trace)
+	{
+		switch (e.m_op)
+		{
+			case trace_entry::PUSH:
+				queue.template push<false>(netlist::detail::queue_t::entry_t(e.m_entry));
+				break;
+			case trace_entry::REMOVE:
+				queue.template remove<false>(e.m_entry.object());
+				break;
+			case trace_entry::POP:
+				// an entry of equal time came first: take the recorded one
+				// instead, the rest of the trace depends on it
+				if (queue.top().object() != e.m_entry.object() || queue.top().exec_time() != e.m_entry.exec_time())
+				{
+					mismatches++;
+					queue.template remove<false>(e.m_entry.object());
+				}
+				else
+					queue.pop();
+				break;
+		}
+	}
+	t.stop();
+	return t.as_seconds<netlist::nl_fptype>();
+}
+
+void tool_app_t::queue_bench(const std::vector<netlist::detail::queue_trace_entry_t> &trace)
+{
+	using entry_t = netlist::detail::queue_t::entry_t;
+	using arena_type = plib::aligned_arena<>;
+
+	std::array<std::size_t, 3> ops = {0, 0, 0};
+	for (const auto &e : trace)
+		ops[e.m_op]++;
+	std_out("queue benchmark: {1} operations ({2} pushes, {3} removes, {4} pops)\n",
+		trace.size(), ops[0], ops[1], ops[2]);
+	if (trace.empty())
+		return;
+
+	// best of a few runs, to keep other load on the host out of the way
+	auto bench = [this, &trace](const pstring &name, auto replay)
+	{
+		netlist::nl_fptype best(netlist::nlconst::magic(1e30));
+		std::size_t mismatches = 0;
+		for (int i = 0; i < 3; i++)
+			best = std::min(best, replay(trace, mismatches));
+		std_out("{1:10}: {2:8.3f} ns/op {3:12} pops out of order\n", name,
+			best * netlist::nlconst::magic(1e9) / static_cast<netlist::nl_fptype>(trace.size()), mismatches);
+	};
+
+	bench("linear", replay_queue<plib::timed_queue_linear<arena_type, entry_t>>);
+	bench("heap", replay_queue<plib::timed_queue_heap<arena_type, entry_t>>);
+	bench("calendar", replay_queue<plib::timed_queue_calendar<arena_type, entry_t>>);
+}
+
 void tool_app_t::validate()
 {
 	netlist_tool_t nt(plib::plog_delegate(&tool_app_t::logger, this), "netlist", opt_boost_lib());
@@ -102,6 +102,7 @@ namespace netlist::solver
 			return netlist_time::quantum().as_fp<nl_fptype>();
 		}
 		static constexpr int m_parallel() { return 0; }
+		static constexpr std::size_t m_parallel_min_size() { return 16; }
 
 		static constexpr nl_fptype m_min_ts_ts()
 		{
@@ -169,6 +170,11 @@ namespace netlist::solver
 														  //!< solve attempt if
 														  //!< nr loops exceeded
 		, m_parallel(parent, prefix + "PARALLEL", defaults.m_parallel())
+		, m_parallel_min_size(parent, prefix + "PARALLEL_MIN_SIZE",
+							  defaults.m_parallel_min_size()) //!< Smaller
+															  //!< solvers are
+															  //!< not solved
+															  //!< in parallel
 		, m_min_ts_ts(parent, prefix + "MIN_TS_TS",
 					  defaults.m_min_ts_ts()) //!< The minimum time step for
 											  //!< solvers with time stepping
@@ -217,6 +223,7 @@ namespace netlist::solver
 		param_logic_t                    m_pivot;
 		param_fp_t                       m_nr_recalc_delay;
 		param_int_t                      m_parallel;
+		param_num_t<std::size_t>         m_parallel_min_size;
 		param_fp_t                       m_min_ts_ts;
 		param_logic_t                    m_dynamic_ts;
 		param_fp_t                       m_dynamic_lte;
@@ -376,9 +383,18 @@ namespace netlist::solver
 					plib::pfmt("// solver doesn't support static compile\n\n")};
 		}
 
+		// look up the static solver again, e.g. after it has been compiled;
+		// returns true if a static solver is in use
+		virtual bool load_static_solver() { return false; }
+
 		// return number of floating point operations for solve
 		constexpr std::size_t ops() const { return m_ops; }
 
+		// return number of nets solved
+		std::size_t net_count() const noexcept { return m_terms.size(); }
+
+		const solver_parameters_t &params() const noexcept { return m_params; }
+
 	protected:
 		matrix_solver_t(devices::nld_solver &main_solver, const pstring &name,
 						const net_list_t          &nets,
@@ -71,12 +71,20 @@ namespace netlist::solver
 				const auto &nzrd = this->m_terms[i].m_nzrd;
 				const auto &nzbd = this->m_terms[i].m_nzbd;
 
+				// once fill-in has made the row a single run of columns
+				// the rows can be combined with the vector kernel
+				const std::size_t nzrd_count = nzrd.size();
+				const bool dense = nzrd_count > 0 && nzrd[nzrd_count - 1] - nzrd[0] + 1 == nzrd_count;
+
 				for (auto &j : nzbd)
 				{
 					auto &Aj = m_A[j];
 					const FT f1 = -f * Aj[i];
-					for (auto &k : nzrd)
-						Aj[k] += Ai[k] * f1;
+					if (dense)
+						plib::vec_add_mult_scalar_p(nzrd_count, &Aj[nzrd[0]], &Ai[nzrd[0]], f1);
+					else
+						for (auto &k : nzrd)
+							Aj[k] += Ai[k] * f1;
 					this->m_RHS[j] += this->m_RHS[i] * f1;
 				}
 			}
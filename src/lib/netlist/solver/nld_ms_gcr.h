@@ -91,25 +91,27 @@ namespace netlist::solver
 			// FIXME: Move me
 			//
 
-			if (this->state().static_solver_lib().isLoaded())
-			{
-				pstring symname = static_compile_name();
-				m_proc.load(this->state().static_solver_lib(), symname);
-				if (m_proc.resolved())
-				{
-					this->state().log().info("External static solver {1} found ...", symname);
-				}
-				else
-				{
-					this->state().log().warning("External static solver {1} not found ...", symname);
-				}
-			}
+			if (this->state().static_solver_lib().isLoaded() && !load_static_solver())
+				this->state().log().warning("External static solver {1} not found ...", m_static_name);
 		}
 
 		void upstream_solve_non_dynamic() override;
 
 		std::pair<pstring, pstring> create_solver_code(static_compile_target target) override;
 
+		bool load_static_solver() override
+		{
+			if (!m_proc.resolved() && this->state().static_solver_lib().isLoaded())
+			{
+				if (m_static_name.empty())
+					m_static_name = static_compile_name();
+				m_proc.load(this->state().static_solver_lib(), m_static_name);
+				if (m_proc.resolved())
+					this->state().log().info("External static solver {1} found ...", m_static_name);
+			}
+			return m_proc.resolved();
+		}
+
 	private:
 
 		using mat_index_type = typename plib::pmatrix_cr<arena_type, FT, SIZE>::index_type;
@@ -129,6 +131,7 @@ namespace netlist::solver
 
 		mat_type mat;
 		plib::dynamic_library::function<void, FT *, fptype *, fptype *, fptype *, fptype ** > m_proc;
+		pstring m_static_name;
 
 	};
 
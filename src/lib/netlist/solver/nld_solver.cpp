@@ -67,6 +67,41 @@ namespace netlist::devices
 	{
 		for (auto &s : m_mat_solvers)
 			s->log_stats();
+
+		// Solve times summed up per solver type, e.g. to compare kernels
+		// with "nltool -c run -s -v". One and two net systems always get
+		// the dedicated direct solvers.
+		if (exec().stats_enabled() && log().verbose.is_enabled())
+		{
+			struct type_stats
+			{
+				pstring       name;
+				std::size_t   solvers;
+				std::size_t   calls;
+				nl_fptype     seconds;
+			};
+			std::vector<type_stats> types;
+
+			for (auto &s : m_mat_solvers)
+			{
+				const pstring name = s->net_count() <= 2
+					? pstring(plib::pfmt("DIRECT{1}")(s->net_count()))
+					: pstring(s->params().m_method().name());
+				auto it = std::find_if(types.begin(), types.end(),
+					[&name](const type_stats &t) { return t.name == name; });
+				if (it == types.end())
+					it = types.insert(types.end(), {name, 0, 0, nlconst::zero()});
+				it->solvers++;
+				it->calls += s->stats()->m_stat_total_time.count();
+				it->seconds += s->stats()->m_stat_total_time.as_seconds<nl_fptype>();
+			}
+
+			for (const auto &t : types)
+				log().verbose("Solver type {1:10}: {2:4} solvers {3:12} calls {4:10.6f} s {5:10.3f} us/call",
+					t.name, t.solvers, t.calls, t.seconds,
+					t.calls == 0 ? nlconst::zero()
+						: t.seconds * nlconst::magic(1e6) / static_cast<nl_fptype>(t.calls));
+		}
 	}
 
 #if 1
@@ -81,33 +116,31 @@ namespace netlist::devices
 											 static_cast<std::size_t>(
 												 m_params.m_parallel()),
 											 plib::omp::get_max_threads());
-		const netlist_time_ext sched(
-			now
-			+ (nthreads <= 1 ? netlist_time_ext::zero()
-							 : netlist_time_ext::from_nsec(100)));
 		plib::uninitialised_array<solver::matrix_solver_t *,
 								  config::max_solver_queue_size::value>
 			tmp; // NOLINT
 		plib::uninitialised_array<netlist_time,
 								  config::max_solver_queue_size::value>
 					nt; // NOLINT
+		plib::uninitialised_array<std::size_t,
+								  config::max_solver_queue_size::value>
+			par; // NOLINT
 		std::size_t p = 0;
+		std::size_t large = 0;
 
-		while (!m_queue.empty())
+		// Only solvers that are due are taken: solving others early to give
+		// the threads more work would change the results. Small solvers are
+		// cheaper to solve here than to hand to a thread.
+		while (!m_queue.empty() && m_queue.top().exec_time() <= now)
 		{
-			const auto t = m_queue.top().exec_time();
-			auto *     o = m_queue.top().object();
-			if (t != now)
-				if (t > sched)
-					break;
-			tmp[p++] = o;
+			auto *o = m_queue.top().object();
 			m_queue.pop();
+			if (nthreads > 1 && o->net_count() >= m_params.m_parallel_min_size())
+				par[large++] = p;
+			tmp[p++] = o;
 		}
 
-		// FIXME: Disabled for now since parallel processing will decrease
-		// performance
-		//        for tested applications. More testing required here
-		if (true || nthreads < 2)
+		if (KEEP_STATS || large < 2)
 		{
 			if (!KEEP_STATS)
 			{
@@ -135,10 +168,21 @@ namespace netlist::devices
 		}
 		else
 		{
-			plib::omp::set_num_threads(nthreads);
-			plib::omp::for_static(static_cast<std::size_t>(0), p,
-								  [&tmp, &nt, now](std::size_t i)
-								  { nt[i] = tmp[i]->solve(now, "parallel"); });
+			// Solvers share no nets, and anything a solve changes outside
+			// its own matrix is left to update_inputs() below.
+			plib::omp::set_num_threads(std::min(nthreads, large));
+			plib::omp::for_static(static_cast<std::size_t>(0), large,
+								  [&tmp, &nt, &par, now](std::size_t j)
+								  { nt[par[j]] = tmp[par[j]]->solve(now, "parallel"); });
+			for (std::size_t i = 0, j = 0; i < p; i++)
+			{
+				if (j < large && par[j] == i)
+					j++;
+				else
+					nt[i] = tmp[i]->solve(now, "no-parallel");
+			}
+
+			// requeue in the order taken, as the serial path does
 			for (std::size_t i = 0; i < p; i++)
 			{
 				if (nt[i] != netlist_time::zero())
@@ -589,6 +633,15 @@ namespace netlist::devices
 		return mp;
 	}
 
+	std::size_t NETLIB_NAME(solver)::load_static_solvers()
+	{
+		std::size_t count = 0;
+		for (auto &s : m_mat_solvers)
+			if (s->load_static_solver())
+				count++;
+		return count;
+	}
+
 	std::size_t NETLIB_NAME(solver)::get_solver_id(
 		const solver::matrix_solver_t *net) const
 	{
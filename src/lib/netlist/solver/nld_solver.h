@@ -46,6 +46,14 @@ namespace netlist::devices
 		solver::static_compile_container
 		create_solver_code(solver::static_compile_target target);
 
+		/// \brief look up missing static solvers again
+		///
+		/// Used after the static solver library has gained symbols, e.g.
+		/// once solvers compiled in the background are available.
+		///
+		/// \returns number of solvers using a static solver
+		std::size_t load_static_solvers();
+
 		NETLIB_RESETI();
 		// NETLIB_UPDATE_PARAMI();
 
@@ -0,0 +1,137 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+
+///
+/// \file test_pmatrix_cr.cpp
+///
+/// tests for the gaussian elimination in `plib::pGEmatrix_cr`
+///
+
+#include "plib/ptests.h"
+
+#include "plib/palloc.h"
+#include "plib/pmatrix_cr.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+class test_pmatrix_cr : public plib::testing::Test
+{
+protected:
+	using arena_type = plib::aligned_arena<>;
+	using mat_type = plib::pGEmatrix_cr<plib::pmatrix_cr<arena_type, double, 0>>;
+
+	static constexpr std::size_t n = 12;
+
+	// A sparse, diagonally dominant system: a band plus a few long range
+	// connections, so that elimination produces fill-in and both
+	// consecutive and scattered row operations.
+	test_pmatrix_cr()
+	: m_dense(n, std::vector<double>(n, 0.0))
+	, m_rhs(n)
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			connect(i, i, 10.0 + double(i));
+			if (i + 1 < n)
+				connect(i, i + 1, -1.0 - 0.1 * double(i));
+			m_rhs[i] = 1.0 + 0.5 * double(i);
+		}
+		connect(0, 7, -0.7);
+		connect(2, 11, -1.3);
+		connect(4, 9, -0.4);
+	}
+
+	void connect(std::size_t r, std::size_t c, double g)
+	{
+		m_dense[r][c] = g;
+		m_dense[c][r] = g;
+	}
+
+	void build(mat_type &mat) const
+	{
+		std::vector<std::vector<unsigned>> fill(n, std::vector<unsigned>(n, mat_type::FILL_INFINITY));
+		for (std::size_t r = 0; r < n; r++)
+			for (std::size_t c = 0; c < n; c++)
+				if (m_dense[r][c] != 0.0)
+					fill[r][c] = 0;
+		mat.gaussian_extend_fill_mat(fill);
+		mat.build_from_fill_mat(fill);
+
+		for (std::size_t r = 0; r < n; r++)
+			for (std::size_t k = mat.row_idx[r]; k < mat.row_idx[r + 1]; k++)
+				mat.A[k] = m_dense[r][mat.col_idx[k]];
+	}
+
+	// the elimination as it was done before the scheme was precomputed
+	static void reference_elimination(mat_type &mat, std::vector<double> &RHS)
+	{
+		for (std::size_t i = 0; i < n - 1; i++)
+		{
+			std::size_t pi = mat.diagonal[i];
+			const double f = 1.0 / mat.A[pi++];
+			const std::size_t piie = mat.row_idx[i+1];
+
+			const auto *nz = mat.nzbd(i);
+			for (std::size_t nzbdp = 0; auto j = nz[nzbdp]; nzbdp++)
+			{
+				std::size_t pj = mat.row_idx[j];
+				const std::size_t pje = mat.row_idx[j+1];
+				while (mat.col_idx[pj] < i)
+					pj++;
+				const double f1 = - mat.A[pj++] * f;
+				for (std::size_t pii = pi; pii<piie && pj < pje; pii++)
+				{
+					while (mat.col_idx[pj] < mat.col_idx[pii])
+						pj++;
+					if (mat.col_idx[pj] == mat.col_idx[pii])
+						mat.A[pj++] += mat.A[pii] * f1;
+				}
+				RHS[j] += f1 * RHS[i];
+			}
+		}
+	}
+
+	std::vector<std::vector<double>> m_dense;
+	std::vector<double> m_rhs;
+};
+
+PTEST_F(test_pmatrix_cr, solves)
+{
+	mat_type mat(arena_type::instance(), n);
+	build(mat);
+
+	std::vector<double> RHS(m_rhs);
+	std::vector<double> V(n);
+	mat.gaussian_elimination(RHS);
+	mat.gaussian_back_substitution(V, RHS);
+
+	for (std::size_t r = 0; r < n; r++)
+	{
+		double sum = 0.0;
+		for (std::size_t c = 0; c < n; c++)
+			sum += m_dense[r][c] * V[c];
+		PEXPECT_LT(std::abs(sum - m_rhs[r]), 1e-12);
+	}
+}
+
+PTEST_F(test_pmatrix_cr, matches_reference)
+{
+	// the precomputed scheme does the same operations in the same order,
+	// so the results must match exactly
+	mat_type mat(arena_type::instance(), n);
+	mat_type ref(arena_type::instance(), n);
+	build(mat);
+	build(ref);
+
+	std::vector<double> RHS(m_rhs);
+	std::vector<double> ref_RHS(m_rhs);
+	mat.gaussian_elimination(RHS);
+	reference_elimination(ref, ref_RHS);
+
+	for (std::size_t k = 0; k < mat.nz_num; k++)
+		PEXPECT_EQ(mat.A[k], ref.A[k]);
+	for (std::size_t r = 0; r < n; r++)
+		PEXPECT_EQ(RHS[r], ref_RHS[r]);
+}
@@ -0,0 +1,124 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+
+///
+/// \file test_ptimed_queue.cpp
+///
+/// tests for the timed queues in ptimed_queue.h
+///
+
+#include "plib/ptests.h"
+
+#include "plib/palloc.h"
+#include "plib/ptime.h"
+#include "plib/ptimed_queue.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+	using time_type = plib::ptime<std::int64_t, 10'000'000'000LL>;
+	using entry_type = plib::queue_entry_t<time_type, const int *>;
+	using arena_type = plib::aligned_arena<>;
+	using linear_queue = plib::timed_queue_linear<arena_type, entry_type>;
+	// small buckets and wheel, so that the tests cross the wheel often
+	using calendar_queue = plib::timed_queue_calendar<arena_type, entry_type, 3, 16>;
+
+	// simple lcg, the sequence must not depend on the library
+	struct test_random
+	{
+		std::uint32_t operator()(std::uint32_t range) noexcept
+		{
+			m_state = m_state * 1664525U + 1013904223U;
+			return (m_state >> 8) % range;
+		}
+		std::uint32_t m_state = 1;
+	};
+} // anonymous namespace
+
+PTEST(ptimed_queue, calendar_matches_linear)
+{
+	// Pushes with short delays, ties, far away entries and entries before
+	// the last popped one, plus removes: the calendar queue must hand out
+	// the same entries in the same order as the linear queue.
+	static std::array<int, 64> objects;
+	linear_queue lq(arena_type::instance(), 2048);
+	calendar_queue cq(arena_type::instance(), 2048);
+	std::vector<bool> queued(objects.size(), false);
+	test_random rnd;
+	std::int64_t now = 0;
+	std::size_t mismatches = 0;
+
+	for (std::size_t step = 0; step < 200000; step++)
+	{
+		const auto op = rnd(10);
+		if (op < 5)
+		{
+			const auto obj = rnd(std::uint32_t(objects.size()));
+			if (queued[obj])
+				continue;
+			std::int64_t t;
+			switch (rnd(8))
+			{
+				case 0:  t = now + std::int64_t(rnd(1000)); break;      // beyond the wheel
+				case 1:  t = now - std::int64_t(rnd(40)); break;        // before the current bucket
+				case 2:  t = now; break;
+				default: t = now + std::int64_t(rnd(4) * 8); break;     // ties
+			}
+			if (t < 0)
+				t = 0;
+			lq.push<false>(entry_type(time_type(t), &objects[obj]));
+			cq.push<false>(entry_type(time_type(t), &objects[obj]));
+			queued[obj] = true;
+		}
+		else if (op < 6)
+		{
+			const auto obj = rnd(std::uint32_t(objects.size()));
+			lq.remove<false>(&objects[obj]);
+			cq.remove<false>(&objects[obj]);
+			queued[obj] = false;
+		}
+		else if (!lq.empty())
+		{
+			const entry_type l(lq.top());
+			const entry_type c(cq.top());
+			if (cq.empty() || l.object() != c.object() || l.exec_time() != c.exec_time())
+				mismatches++;
+			now = l.exec_time().as_raw();
+			queued[std::size_t(l.object() - objects.data())] = false;
+			lq.pop();
+			cq.pop();
+		}
+		if (lq.size() != cq.size())
+			mismatches++;
+	}
+	PEXPECT_EQ(mismatches, 0U);
+
+	// the linearised list used for save states has the same order, too
+	PEXPECT_GT(lq.size(), 0U);
+	for (std::size_t i = 0; i < lq.size(); i++)
+		if (lq[i].object() != cq[i].object() || lq[i].exec_time() != cq[i].exec_time())
+			mismatches++;
+	PEXPECT_EQ(mismatches, 0U);
+}
+
+PTEST(ptimed_queue, calendar_never)
+{
+	calendar_queue cq(arena_type::instance(), 16);
+	static int a;
+	static int b;
+	PEXPECT_TRUE(cq.empty());
+	PEXPECT_TRUE(cq.top().exec_time() == time_type::never());
+	cq.push<false>(entry_type(time_type::never(), nullptr));
+	cq.push<false>(entry_type(time_type(std::int64_t(100)), &a));
+	cq.push<false>(entry_type(time_type(std::int64_t(1'000'000)), &b));
+	PEXPECT_TRUE(cq.top().object() == &a);
+	cq.pop();
+	PEXPECT_TRUE(cq.top().object() == &b);
+	cq.pop();
+	PEXPECT_TRUE(cq.top().object() == nullptr);
+	cq.pop();
+	PEXPECT_TRUE(cq.empty());
+}
@@ -0,0 +1,226 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    arena.cpp
+
+    Monotonic arena for objects that are all released together.
+
+***************************************************************************/
+
+#include "arena.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+
+namespace util {
+
+namespace {
+
+constexpr std::size_t DEFAULT_ALIGN = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+inline std::size_t round_up(std::size_t value, std::size_t align)
+{
+	return (value + align - 1) & ~(align - 1);
+}
+
+} // anonymous namespace
+
+
+//**************************************************************************
+//  ARENA
+//**************************************************************************
+
+// at the start of each block, followed by the memory handed out
+struct arena::block
+{
+	block *next;
+	std::size_t size;
+
+	static constexpr std::size_t header_size() { return (sizeof(block) + DEFAULT_ALIGN - 1) & ~(DEFAULT_ALIGN - 1); }
+	char *data() { return reinterpret_cast<char *>(this) + header_size(); }
+};
+
+
+//-------------------------------------------------
+//  arena - constructor
+//-------------------------------------------------
+
+arena::arena(std::size_t block_size) noexcept
+	: m_blocks(nullptr)
+	, m_ptr(nullptr)
+	, m_end(nullptr)
+	, m_block_size(std::max<std::size_t>(block_size, 1024))
+	, m_allocated(0)
+	, m_reserved(0)
+{
+}
+
+
+//-------------------------------------------------
+//  ~arena - destructor
+//-------------------------------------------------
+
+arena::~arena()
+{
+	release();
+}
+
+
+//-------------------------------------------------
+//  allocate - hand out memory with the given
+//  alignment, which must be a power of two
+//-------------------------------------------------
+
+void *arena::allocate(std::size_t size, std::size_t align)
+{
+	assert(align && !(align & (align - 1)));
+
+	// the common case is that it fits in the current block
+	std::uintptr_t const ptr(round_up(std::uintptr_t(m_ptr), align));
+	if (m_ptr && ((ptr + size) <= std::uintptr_t(m_end)))
+	{
+		m_ptr = reinterpret_cast<char *>(ptr + size);
+		m_allocated += size;
+		return reinterpret_cast<void *>(ptr);
+	}
+
+	// large requests get a block to themselves so the current one isn't wasted
+	std::size_t const needed(size + ((align > DEFAULT_ALIGN) ? (align - DEFAULT_ALIGN) : 0));
+	if (needed > (m_block_size / 4))
+	{
+		block *const large(add_block(needed));
+		m_allocated += size;
+		return reinterpret_cast<void *>(round_up(std::uintptr_t(large->data()), align));
+	}
+
+	// otherwise start a new block
+	block *const fresh(add_block(m_block_size));
+	m_ptr = fresh->data();
+	m_end = m_ptr + fresh->size;
+	return allocate(size, align);
+}
+
+
+//-------------------------------------------------
+//  copy - make a NUL-terminated copy of a string
+//-------------------------------------------------
+
+std::string_view arena::copy(std::string_view text)
+{
+	char *const result(reinterpret_cast<char *>(allocate(text.length() + 1, 1)));
+	std::copy(text.begin(), text.end(), result);
+	result[text.length()] = '\0';
+	return std::string_view(result, text.length());
+}
+
+
+//-------------------------------------------------
+//  copy - make a NUL-terminated copy of several
+//  strings joined together
+//-------------------------------------------------
+
+std::string_view arena::copy(std::initializer_list<std::string_view> parts)
+{
+	std::size_t length(0);
+	for (std::string_view const &part : parts)
+		length += part.length();
+
+	char *const result(reinterpret_cast<char *>(allocate(length + 1, 1)));
+	char *dest(result);
+	for (std::string_view const &part : parts)
+		dest = std::copy(part.begin(), part.end(), dest);
+	*dest = '\0';
+	return std::string_view(result, length);
+}
+
+
+//-------------------------------------------------
+//  release - free all the blocks
+//-------------------------------------------------
+
+void arena::release() noexcept
+{
+	while (m_blocks)
+	{
+		block *const next(m_blocks->next);
+		::operator delete(m_blocks);
+		m_blocks = next;
+	}
+	m_ptr = m_end = nullptr;
+	m_allocated = m_reserved = 0;
+}
+
+
+//-------------------------------------------------
+//  add_block - allocate a block and put it on the
+//  list
+//-------------------------------------------------
+
+arena::block *arena::add_block(std::size_t size)
+{
+	block *const result(reinterpret_cast<block *>(::operator new(block::header_size() + size)));
+	result->next = m_blocks;
+	result->size = size;
+	m_blocks = result;
+	m_reserved += size;
+	return result;
+}
+
+
+
+//**************************************************************************
+//  ARENA OBJECT
+//**************************************************************************
+
+//-------------------------------------------------
+//  allocate - get memory for an object, putting
+//  the arena it came from (if any) just before it
+//-------------------------------------------------
+
+void *arena_object::allocate(std::size_t size, std::size_t align, arena *where)
+{
+	align = std::max(align, DEFAULT_ALIGN);
+	std::size_t const prefix(round_up(sizeof(arena *), align));
+	void *base;
+	if (where)
+		base = where->allocate(prefix + size, align);
+	else if (align > DEFAULT_ALIGN)
+		base = ::operator new(prefix + size, std::align_val_t(align));
+	else
+		base = ::operator new(prefix + size);
+
+	char *const result(reinterpret_cast<char *>(base) + prefix);
+	std::memcpy(result - sizeof(arena *), &where, sizeof(arena *));
+	return result;
+}
+
+
+//-------------------------------------------------
+//  deallocate - free memory for an object unless
+//  it belongs to an arena
+//-------------------------------------------------
+
+void arena_object::deallocate(void *ptr, std::size_t align) noexcept
+{
+	if (!ptr)
+		return;
+
+	char *const object(reinterpret_cast<char *>(ptr));
+	arena *where;
+	std::memcpy(&where, object - sizeof(arena *), sizeof(arena *));
+	if (where)
+		return;
+
+	align = std::max(align, DEFAULT_ALIGN);
+	void *const base(object - round_up(sizeof(arena *), align));
+	if (align > DEFAULT_ALIGN)
+		::operator delete(base, std::align_val_t(align));
+	else
+		::operator delete(base);
+}
+
+} // namespace util
@@ -0,0 +1,89 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    arena.h
+
+    Monotonic arena for objects that are all released together.
+
+***************************************************************************/
+
+#ifndef MAME_LIB_UTIL_ARENA_H
+#define MAME_LIB_UTIL_ARENA_H
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <string_view>
+
+
+namespace util {
+
+// ======================> arena
+
+// hands out memory from large blocks by bumping a pointer; nothing is
+// given back until the arena is released or destroyed, and it isn't
+// thread safe
+class arena
+{
+public:
+	// construction/destruction
+	arena(std::size_t block_size = 32 * 1024) noexcept;
+	arena(arena const &) = delete;
+	arena &operator=(arena const &) = delete;
+	~arena();
+
+	// allocation
+	void *allocate(std::size_t size, std::size_t align = __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+	std::string_view copy(std::string_view text);
+	std::string_view copy(std::initializer_list<std::string_view> parts);
+
+	// free everything at once
+	void release() noexcept;
+
+	// statistics
+	std::size_t allocated() const noexcept { return m_allocated; }
+	std::size_t reserved() const noexcept { return m_reserved; }
+
+private:
+	struct block;
+
+	block *add_block(std::size_t size);
+
+	block *         m_blocks;       // every block, newest first
+	char *          m_ptr;          // next free byte in the current block
+	char *          m_end;          // end of the current block
+	std::size_t     m_block_size;   // size of a normal block
+	std::size_t     m_allocated;    // bytes handed out
+	std::size_t     m_reserved;     // bytes in blocks
+};
+
+
+// ======================> arena_object
+
+// base for classes whose objects can be placed in an arena with
+// new (arena) T(...); they're deleted as usual, and deleting one that
+// lives in an arena runs its destructor but leaves the memory to the
+// arena, which must outlive it
+class arena_object
+{
+public:
+	static void *operator new(std::size_t size) { return allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, nullptr); }
+	static void *operator new(std::size_t size, std::align_val_t align) { return allocate(size, std::size_t(align), nullptr); }
+	static void *operator new(std::size_t size, arena &where) { return allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, &where); }
+	static void *operator new(std::size_t size, std::align_val_t align, arena &where) { return allocate(size, std::size_t(align), &where); }
+	static void operator delete(void *ptr) noexcept { deallocate(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+	static void operator delete(void *ptr, std::align_val_t align) noexcept { deallocate(ptr, std::size_t(align)); }
+	static void operator delete(void *ptr, arena &where) noexcept { deallocate(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+	static void operator delete(void *ptr, std::align_val_t align, arena &where) noexcept { deallocate(ptr, std::size_t(align)); }
+
+private:
+	static void *allocate(std::size_t size, std::size_t align, arena *where);
+	static void deallocate(void *ptr, std::size_t align) noexcept;
+};
+
+} // namespace util
+
+#endif // MAME_LIB_UTIL_ARENA_H
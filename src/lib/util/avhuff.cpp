@@ -64,8 +64,11 @@
 #include "huffman.h"
 #include "multibyte.h"
 
+#include "osdcore.h"
+
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <new>
 
 
@@ -119,6 +122,44 @@ inline int rlecount_to_code(int rlecount)
 }
 
 
+//-------------------------------------------------
+//  take_deltas - compute the differences between
+//  consecutive items of a row; with the stride
+//  known, compilers can vectorize this
+//-------------------------------------------------
+
+template <uint32_t ItemAdvance>
+inline void take_deltas(uint8_t *dest, const uint8_t *source, uint32_t count, uint8_t prevdata)
+{
+	if (count == 0)
+		return;
+	dest[0] = source[0] - prevdata;
+	for (uint32_t item = 1; item < count; item++)
+		dest[item] = source[item * ItemAdvance] - source[(item - 1) * ItemAdvance];
+}
+
+
+//-------------------------------------------------
+//  zero_run_end - return the index after a run of
+//  zero deltas, checking eight at a time
+//-------------------------------------------------
+
+inline uint32_t zero_run_end(const uint8_t *delta, uint32_t item, uint32_t count)
+{
+	while (item + 8 <= count)
+	{
+		uint64_t word;
+		memcpy(&word, delta + item, sizeof(word));
+		if (word != 0)
+			break;
+		item += 8;
+	}
+	while (item < count && delta[item] == 0)
+		item++;
+	return item;
+}
+
+
 //-------------------------------------------------
 //  encode_one - encode data
 //-------------------------------------------------
@@ -188,6 +229,20 @@ m_flac_encoder.set_num_channels(1);
 m_flac_encoder.set_strip_metadata(true);
 }
 
+/**
+ * @fn  avhuff_encoder::~avhuff_encoder()
+ *
+ * @brief   -------------------------------------------------
+ *            ~avhuff_encoder - destructor
+ *          -------------------------------------------------.
+ */
+
+avhuff_encoder::~avhuff_encoder()
+{
+	if (m_work_queue)
+		osd_work_queue_free(m_work_queue);
+}
+
 /**
  * @fn  avhuff_error avhuff_encoder::encode_data(const uint8_t *source, uint8_t *dest, uint32_t &complength)
  *
@@ -234,36 +289,63 @@ avhuff_error avhuff_encoder::encode_data(const uint8_t *source, uint8_t *dest, u
 		dstoffs += metasize;
 	}
 
-	// encode the audio channels
+	// encode the audio channels, alongside the video on another thread if we can
+	audio_job audio = { this, source, int(channels), int(samples), dest + dstoffs, &dest[8], AVHERR_NONE };
+	osd_work_item *audioitem = nullptr;
 	if (channels > 0)
 	{
-		// encode the audio
-		avhuff_error err = encode_audio(source, channels, samples, dest + dstoffs, &dest[8]);
+		if (m_threaded && width > 0 && height > 0 && work_queue())
+			audioitem = osd_work_item_queue(m_work_queue, audio_job::execute, &audio, 0);
+		if (!audioitem)
+			audio_job::execute(&audio, 0);
 		source += channels * samples * 2;
-		if (err != AVHERR_NONE)
-			return err;
+	}
+	else
+	{
+		dest[8] = 0;
+		dest[9] = 0;
+	}
 
-		// advance the pointers past the data
+	// where the video goes isn't known until the audio is done, so meanwhile encode it to a scratch buffer
+	uint32_t vidlength = 0;
+	avhuff_error videoerr = AVHERR_NONE;
+	if (audioitem)
+	{
+		m_videobuffer.resize(width * height * 2);
+		videoerr = encode_video(source, width, height, &m_videobuffer[0], vidlength);
+		while (!osd_work_item_wait(audioitem, osd_ticks_per_second())) { }
+		osd_work_item_release(audioitem);
+	}
+	if (audio.result != AVHERR_NONE)
+		return audio.result;
+	if (videoerr != AVHERR_NONE)
+		return videoerr;
+
+	// advance the pointers past the audio data
+	if (channels > 0)
+	{
 		uint16_t treesize = get_u16be(&dest[8]);
 		if (treesize != 0xffff)
 			dstoffs += treesize;
 		for (int chnum = 0; chnum < channels; chnum++)
 			dstoffs += get_u16be(&dest[10 + 2 * chnum]);
 	}
-	else
-	{
-		dest[8] = 0;
-		dest[9] = 0;
-	}
 
 	// encode the video data
 	if (width > 0 && height > 0)
 	{
-		// encode the video
-		uint32_t vidlength = 0;
-		avhuff_error err = encode_video(source, width, height, dest + dstoffs, vidlength);
-		if (err != AVHERR_NONE)
-			return err;
+		// encode the video, unless it was done already
+		if (audioitem)
+		{
+			// an overflowing bitstream reports its full length but only writes what fits
+			memcpy(dest + dstoffs, &m_videobuffer[0], std::min<uint32_t>(vidlength, m_videobuffer.size()));
+		}
+		else
+		{
+			avhuff_error err = encode_video(source, width, height, dest + dstoffs, vidlength);
+			if (err != AVHERR_NONE)
+				return err;
+		}
 
 		// advance the pointers past the data
 		dstoffs += vidlength;
@@ -546,10 +628,35 @@ avhuff_error avhuff_encoder::encode_video_lossless(const uint8_t *source, int wi
 	bitstream_out bitbuf(dest, width * height * 2);
 	bitbuf.write(0x80, 8);
 
-	// compute the histograms for the data
-	uint16_t *yrle = m_ycontext.rle_and_histo_bitmap(source + 0, width, 2, height);
-	uint16_t *cbrle = m_cbcontext.rle_and_histo_bitmap(source + 1, width / 2, 4, height);
-	uint16_t *crrle = m_crcontext.rle_and_histo_bitmap(source + 3, width / 2, 4, height);
+	// compute the histograms for the data, for Cb and Cr on other threads if we can
+	histo_job jobs[3] =
+	{
+		{ &m_ycontext, source + 0, uint32_t(width), 2, uint32_t(height), nullptr },
+		{ &m_cbcontext, source + 1, uint32_t(width / 2), 4, uint32_t(height), nullptr },
+		{ &m_crcontext, source + 3, uint32_t(width / 2), 4, uint32_t(height), nullptr }
+	};
+	osd_work_item *items[3] = { nullptr, nullptr, nullptr };
+	if (m_threaded && work_queue())
+	{
+		for (int jobnum = 1; jobnum < 3; jobnum++)
+			items[jobnum] = osd_work_item_queue(m_work_queue, histo_job::execute, &jobs[jobnum], 0);
+	}
+	for (int jobnum = 0; jobnum < 3; jobnum++)
+	{
+		if (!items[jobnum])
+			histo_job::execute(&jobs[jobnum], 0);
+	}
+	for (osd_work_item *item : items)
+	{
+		if (item)
+		{
+			while (!osd_work_item_wait(item, osd_ticks_per_second())) { }
+			osd_work_item_release(item);
+		}
+	}
+	uint16_t *yrle = jobs[0].result;
+	uint16_t *cbrle = jobs[1].result;
+	uint16_t *crrle = jobs[2].result;
 
 	// export the trees to the data stream
 	huffman_error hufferr = m_ycontext.export_tree_rle(bitbuf);
@@ -585,6 +692,53 @@ avhuff_error avhuff_encoder::encode_video_lossless(const uint8_t *source, int wi
 	return AVHERR_NONE;
 }
 
+/**
+ * @fn  osd_work_queue *avhuff_encoder::work_queue()
+ *
+ * @brief   -------------------------------------------------
+ *            work_queue - get the queue for threaded encoding, creating it on first use
+ *          -------------------------------------------------.
+ *
+ * @return  null if it can't be created, else the queue.
+ */
+
+osd_work_queue *avhuff_encoder::work_queue()
+{
+	if (!m_work_queue)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	return m_work_queue;
+}
+
+/**
+ * @fn  void *avhuff_encoder::histo_job::execute(void *param, int threadid)
+ *
+ * @brief   -------------------------------------------------
+ *            histo_job::execute - RLE compress and histogram one channel of a frame
+ *          -------------------------------------------------.
+ */
+
+void *avhuff_encoder::histo_job::execute(void *param, int threadid)
+{
+	histo_job &job = *reinterpret_cast<histo_job *>(param);
+	job.result = job.context->rle_and_histo_bitmap(job.source, job.items_per_row, job.item_advance, job.row_count);
+	return nullptr;
+}
+
+/**
+ * @fn  void *avhuff_encoder::audio_job::execute(void *param, int threadid)
+ *
+ * @brief   -------------------------------------------------
+ *            audio_job::execute - encode the audio of a frame
+ *          -------------------------------------------------.
+ */
+
+void *avhuff_encoder::audio_job::execute(void *param, int threadid)
+{
+	audio_job &job = *reinterpret_cast<audio_job *>(param);
+	job.result = job.encoder->encode_audio(job.source, job.channels, job.samples, job.dest, job.sizes);
+	return nullptr;
+}
+
 
 
 //**************************************************************************
@@ -608,54 +762,62 @@ avhuff_error avhuff_encoder::encode_video_lossless(const uint8_t *source, int wi
 
 uint16_t *avhuff_encoder::deltarle_encoder::rle_and_histo_bitmap(const uint8_t *source, uint32_t items_per_row, uint32_t item_advance, uint32_t row_count)
 {
-	// resize our RLE buffer
+	// resize our buffers
 	m_rlebuffer.resize(items_per_row * row_count);
+	m_deltabuffer.resize(items_per_row);
 	uint16_t *dest = &m_rlebuffer[0];
+	uint8_t *const delta = &m_deltabuffer[0];
 
 	// iterate over rows
 	m_encoder.histo_reset();
 	uint8_t prevdata = 0;
-	for (uint32_t row = 0; row < row_count; row++)
+	for (uint32_t row = 0; row < row_count && items_per_row > 0; row++)
 	{
-		const uint8_t *end = source + items_per_row * item_advance;
-		for ( ; source < end; source += item_advance)
+		// take the deltas for the whole row first
+		switch (item_advance)
 		{
-			// fetch current data
-			uint8_t curdelta = *source - prevdata;
-			prevdata = *source;
-
-			// 0 deltas scan forward for a count
-			if (curdelta == 0)
+		case 2:     take_deltas<2>(delta, source, items_per_row, prevdata); break;
+		case 4:     take_deltas<4>(delta, source, items_per_row, prevdata); break;
+		default:
+			for (uint32_t item = 0; item < items_per_row; item++)
 			{
-				int zerocount = 1;
+				delta[item] = source[item * item_advance] - prevdata;
+				prevdata = source[item * item_advance];
+			}
+			break;
+		}
+		prevdata = source[(items_per_row - 1) * item_advance];
 
-				// count the number of consecutive values
-				const uint8_t *scandata;
-				for (scandata = source + item_advance; scandata < end; scandata += item_advance)
-					if (*scandata == prevdata)
-						zerocount++;
-					else
-						break;
+		for (uint32_t item = 0; item < items_per_row; )
+		{
+			// encode the actual data for nonzero deltas
+			uint8_t const curdelta = delta[item];
+			if (curdelta != 0)
+			{
+				m_encoder.histo_one(*dest++ = curdelta);
+				item++;
+				continue;
+			}
 
+			// 0 deltas scan forward for a count, then encode the maximal counts we can
+			uint32_t const runend = zero_run_end(delta, item + 1, items_per_row);
+			bool const atend = runend >= items_per_row;
+			int zerocount = runend - item;
+			while (zerocount > 0)
+			{
 				// if we hit the end of a row, maximize the count
-				if (scandata >= end && zerocount >= 8)
-					zerocount = 100000;
-
-				// encode the maximal count we can
-				int rlecode = rlecount_to_code(zerocount);
+				int const rlecode = rlecount_to_code((atend && zerocount >= 8) ? 100000 : zerocount);
 				m_encoder.histo_one(*dest++ = rlecode);
 
 				// advance past the run
-				source += (code_to_rlecount(rlecode) - 1) * item_advance;
+				int const rlecount = code_to_rlecount(rlecode);
+				zerocount -= rlecount;
+				item += rlecount;
 			}
-
-			// otherwise, encode the actual data
-			else
-				m_encoder.histo_one(*dest++ = curdelta);
 		}
 
 		// advance to the next row
-		source = end;
+		source += items_per_row * item_advance;
 	}
 
 	// compute the tree for our histogram
@@ -20,6 +20,9 @@
 #include <algorithm>
 
 
+struct osd_work_queue;
+
+
 //**************************************************************************
 //  CONSTANTS
 //**************************************************************************
@@ -57,6 +60,13 @@ class avhuff_encoder
 public:
 	// construction/destruction
 	avhuff_encoder();
+	avhuff_encoder(const avhuff_encoder &) = delete;
+	~avhuff_encoder();
+	avhuff_encoder &operator=(const avhuff_encoder &) = delete;
+
+	// configuration; a threaded encoder splits each frame over a work queue,
+	// which only helps if frames aren't already being encoded in parallel
+	void set_threaded(bool threaded) { m_threaded = threaded; }
 
 	// encode/decode
 	avhuff_error encode_data(const uint8_t *source, uint8_t *dest, uint32_t &complength);
@@ -87,12 +97,45 @@ private:
 		int                         m_rlecount = 0;
 		huffman_encoder<256 + 16>   m_encoder;
 		std::vector<uint16_t>       m_rlebuffer;
+		std::vector<uint8_t>        m_deltabuffer;
+	};
+
+	// work that can be done on another thread
+	struct histo_job
+	{
+		static void *execute(void *param, int threadid);
+
+		deltarle_encoder *      context;
+		const uint8_t *         source;
+		uint32_t                items_per_row;
+		uint32_t                item_advance;
+		uint32_t                row_count;
+		uint16_t *              result;
+	};
+
+	struct audio_job
+	{
+		static void *execute(void *param, int threadid);
+
+		avhuff_encoder *        encoder;
+		const uint8_t *         source;
+		int                     channels;
+		int                     samples;
+		uint8_t *               dest;
+		uint8_t *               sizes;
+		avhuff_error            result;
 	};
 
 	// internal helpers
 	avhuff_error encode_audio(const uint8_t *source, int channels, int samples, uint8_t *dest, uint8_t *sizes);
 	avhuff_error encode_video(const uint8_t *source, int width, int height, uint8_t *dest, uint32_t &complength);
 	avhuff_error encode_video_lossless(const uint8_t *source, int width, int height, uint8_t *dest, uint32_t &complength);
+	osd_work_queue *work_queue();
+
+	// threading
+	bool                        m_threaded = false;
+	osd_work_queue *            m_work_queue = nullptr;
+	std::vector<uint8_t>        m_videobuffer;
 
 	// video encoding contexts
 	deltarle_encoder            m_ycontext;
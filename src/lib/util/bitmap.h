@@ -155,6 +155,7 @@ public:
 	int32_t height() const noexcept { return m_height; }
 	int32_t rowpixels() const noexcept { return m_rowpixels; }
 	int32_t rowbytes() const noexcept { return m_rowpixels * m_bpp / 8; }
+	uint32_t allocated_bytes() const noexcept { return m_alloc ? m_allocbytes : 0; }
 	uint8_t bpp() const noexcept { return m_bpp; }
 	bitmap_format format() const noexcept { return m_format; }
 	bool valid() const noexcept { return (m_base != nullptr); }
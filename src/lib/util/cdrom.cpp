@@ -378,7 +378,7 @@ std::error_condition cdrom_file::read_partial_sector(void *dest, uint32_t lbasec
 			chdsector += cdtoc.tracks[tracknum].pregap;
 		}
 
-		result = chd->read_bytes(uint64_t(chdsector) * uint64_t(FRAME_SIZE) + startoffs, dest, length);
+		result = read_cached_bytes(uint64_t(chdsector) * uint64_t(FRAME_SIZE) + startoffs, dest, length);
 
 		// swap CDDA in the case of LE GDROMs
 		if ((cdtoc.flags & CD_FLAG_GDROMLE) && (cdtoc.tracks[tracknum].trktype == CD_TRACK_AUDIO))
@@ -421,6 +421,71 @@ std::error_condition cdrom_file::read_partial_sector(void *dest, uint32_t lbasec
 }
 
 
+/*-------------------------------------------------
+    read_cached_bytes - read bytes from the CHD
+    through a small LRU of decoded hunks
+-------------------------------------------------*/
+
+/**
+ * @fn  std::error_condition read_cached_bytes(uint64_t offset, void *dest, uint32_t length)
+ *
+ * @brief   Reads bytes from the CHD a whole hunk at a time.
+ *
+ * Sector data, subcode and neighbouring sectors usually share a hunk, so
+ * keeping the last few decoded hunks around means streaming reads and
+ * repeated reads of the same sectors only decompress each hunk once.
+ *
+ * @param   offset          The byte offset within the CHD.
+ * @param [in,out]  dest    Destination for the data.
+ * @param   length          The length.
+ *
+ * @return  The error, if any.
+ */
+
+std::error_condition cdrom_file::read_cached_bytes(uint64_t offset, void *dest, uint32_t length)
+{
+	uint32_t const hunkbytes = chd->hunk_bytes();
+	auto *bufptr = (uint8_t *)dest;
+
+	while (length != 0)
+	{
+		uint32_t const hunknum = offset / hunkbytes;
+		uint32_t const hunkoffs = offset % hunkbytes;
+		uint32_t const chunk = std::min<uint32_t>(length, hunkbytes - hunkoffs);
+
+		// find the hunk, or the least recently used entry to replace
+		hunk_cache_entry *entry = &hunkcache[0];
+		for (hunk_cache_entry &candidate : hunkcache)
+		{
+			if (candidate.hunknum == hunknum)
+			{
+				entry = &candidate;
+				break;
+			}
+			if (candidate.lastuse < entry->lastuse)
+				entry = &candidate;
+		}
+
+		if (entry->hunknum != hunknum)
+		{
+			entry->data.resize(hunkbytes);
+			entry->hunknum = ~uint32_t(0);
+			std::error_condition err = chd->read_hunk(hunknum, &entry->data[0]);
+			if (err)
+				return err;
+			entry->hunknum = hunknum;
+		}
+		entry->lastuse = ++hunkcache_clock;
+
+		memcpy(bufptr, &entry->data[hunkoffs], chunk);
+		bufptr += chunk;
+		offset += chunk;
+		length -= chunk;
+	}
+	return std::error_condition();
+}
+
+
 /*-------------------------------------------------
     cdrom_read_data - read one or more sectors
     from a CD-ROM
@@ -1283,18 +1348,6 @@ const uint16_t cdrom_file::qoffsets[ECC_Q_NUM_BYTES][ECC_Q_COMP] =
 };
 
 
-//-------------------------------------------------
-//  ecc_source_byte - return data from the sector
-//  at the given offset, masking anything
-//  particular to a mode
-//-------------------------------------------------
-
-uint8_t cdrom_file::ecc_source_byte(const uint8_t *sector, uint32_t offset)
-{
-	// in mode 2 always treat these as 0 bytes
-	return (sector[MODE_OFFSET] == 2 && offset < 4) ? 0x00 : sector[SYNC_OFFSET + SYNC_NUM_BYTES + offset];
-}
-
 /**
  * @fn  void ecc_compute_bytes(const uint8_t *sector, const uint16_t *row, int rowlen, uint8_t &val1, uint8_t &val2)
  *
@@ -1314,14 +1367,36 @@ void cdrom_file::ecc_compute_bytes(const uint8_t *sector, const uint16_t *row, i
 	val1 = val2 = 0;
 	for (int component = 0; component < rowlen; component++)
 	{
-		val1 ^= ecc_source_byte(sector, row[component]);
-		val2 ^= ecc_source_byte(sector, row[component]);
-		val1 = ecclow[val1];
+		uint8_t const byte = sector[row[component]];
+		val1 = ecclow[val1 ^ byte];
+		val2 ^= byte;
 	}
 	val1 = ecchigh[ecclow[val1] ^ val2];
 	val2 ^= val1;
 }
 
+/**
+ * @fn  void ecc_source(const uint8_t *sector, uint8_t *source)
+ *
+ * @brief   -------------------------------------------------
+ *            ecc_source - copy the part of a sector covered by ECC,
+ *            masking anything particular to a mode, so rows can
+ *            be indexed directly
+ *          -------------------------------------------------.
+ *
+ * @param   sector          The sector.
+ * @param [out]     source  ECC_SOURCE_BYTES bytes of source data.
+ */
+
+void cdrom_file::ecc_source(const uint8_t *sector, uint8_t *source)
+{
+	memcpy(source, &sector[SYNC_OFFSET + SYNC_NUM_BYTES], ECC_SOURCE_BYTES);
+
+	// in mode 2 always treat the header as 0 bytes
+	if (sector[MODE_OFFSET] == 2)
+		memset(source, 0, 4);
+}
+
 /**
  * @fn  bool ecc_verify(const uint8_t *sector)
  *
@@ -1336,11 +1411,14 @@ void cdrom_file::ecc_compute_bytes(const uint8_t *sector, const uint16_t *row, i
 
 bool cdrom_file::ecc_verify(const uint8_t *sector)
 {
+	uint8_t source[ECC_SOURCE_BYTES];
+	ecc_source(sector, source);
+
 	// first verify P bytes
 	for (int byte = 0; byte < ECC_P_NUM_BYTES; byte++)
 	{
 		uint8_t val1, val2;
-		ecc_compute_bytes(sector, poffsets[byte], ECC_P_COMP, val1, val2);
+		ecc_compute_bytes(source, poffsets[byte], ECC_P_COMP, val1, val2);
 		if (sector[ECC_P_OFFSET + byte] != val1 || sector[ECC_P_OFFSET + ECC_P_NUM_BYTES + byte] != val2)
 			return false;
 	}
@@ -1349,7 +1427,7 @@ bool cdrom_file::ecc_verify(const uint8_t *sector)
 	for (int byte = 0; byte < ECC_Q_NUM_BYTES; byte++)
 	{
 		uint8_t val1, val2;
-		ecc_compute_bytes(sector, qoffsets[byte], ECC_Q_COMP, val1, val2);
+		ecc_compute_bytes(source, qoffsets[byte], ECC_Q_COMP, val1, val2);
 		if (sector[ECC_Q_OFFSET + byte] != val1 || sector[ECC_Q_OFFSET + ECC_Q_NUM_BYTES + byte] != val2)
 			return false;
 	}
@@ -1369,13 +1447,19 @@ bool cdrom_file::ecc_verify(const uint8_t *sector)
 
 void cdrom_file::ecc_generate(uint8_t *sector)
 {
-	// first verify P bytes
+	uint8_t source[ECC_SOURCE_BYTES];
+	ecc_source(sector, source);
+
+	// first generate P bytes
 	for (int byte = 0; byte < ECC_P_NUM_BYTES; byte++)
-		ecc_compute_bytes(sector, poffsets[byte], ECC_P_COMP, sector[ECC_P_OFFSET + byte], sector[ECC_P_OFFSET + ECC_P_NUM_BYTES + byte]);
+		ecc_compute_bytes(source, poffsets[byte], ECC_P_COMP, sector[ECC_P_OFFSET + byte], sector[ECC_P_OFFSET + ECC_P_NUM_BYTES + byte]);
 
-	// then verify Q bytes
+	// Q covers the P bytes just written
+	memcpy(&source[ECC_P_OFFSET - SYNC_NUM_BYTES], &sector[ECC_P_OFFSET], 2 * ECC_P_NUM_BYTES);
+
+	// then generate Q bytes
 	for (int byte = 0; byte < ECC_Q_NUM_BYTES; byte++)
-		ecc_compute_bytes(sector, qoffsets[byte], ECC_Q_COMP, sector[ECC_Q_OFFSET + byte], sector[ECC_Q_OFFSET + ECC_Q_NUM_BYTES + byte]);
+		ecc_compute_bytes(source, qoffsets[byte], ECC_Q_COMP, sector[ECC_Q_OFFSET + byte], sector[ECC_Q_OFFSET + ECC_Q_NUM_BYTES + byte]);
 }
 
 /**
@@ -16,6 +16,8 @@
 #include "ioprocs.h"
 #include "osdcore.h"
 
+#include <vector>
+
 class cdrom_file {
 public:
 	// tracks are padded to a multiple of this many frames
@@ -228,6 +230,8 @@ private:
 	static constexpr int ECC_Q_NUM_BYTES = 52;
 	/** @brief  43 bytes each. */
 	static constexpr int ECC_Q_COMP = 43;
+	/** @brief  bytes covered by P and Q, from the header to the end of P. */
+	static constexpr int ECC_SOURCE_BYTES = ECC_Q_OFFSET - SYNC_NUM_BYTES;
 
 	// ECC tables
 	static const uint8_t ecclow[256];
@@ -235,6 +239,17 @@ private:
 	static const uint16_t poffsets[ECC_P_NUM_BYTES][ECC_P_COMP];
 	static const uint16_t qoffsets[ECC_Q_NUM_BYTES][ECC_Q_COMP];
 
+	/** @brief  number of decoded CHD hunks kept per file. */
+	static constexpr int HUNK_CACHE_SIZE = 4;
+
+	/** @brief  A decoded CHD hunk. */
+	struct hunk_cache_entry
+	{
+		uint32_t             hunknum = ~uint32_t(0);
+		uint32_t             lastuse = 0;
+		std::vector<uint8_t> data;
+	};
+
 	/** @brief  The chd. */
 	chd_file *           chd;                /* CHD file */
 	/** @brief  The cdtoc. */
@@ -243,13 +258,18 @@ private:
 	track_input_info     cdtrack_info;       /* track info */
 	/** @brief  The fhandle[ CD maximum tracks]. */
 	util::random_read::ptr fhandle[MAX_TRACKS];/* file handle */
+	/** @brief  Recently decoded CHD hunks, least recently used replaced first. */
+	hunk_cache_entry     hunkcache[HUNK_CACHE_SIZE];
+	/** @brief  Use counter for the hunk cache. */
+	uint32_t             hunkcache_clock = 0;
 
 	inline uint32_t physical_to_chd_lba(uint32_t physlba, uint32_t &tracknum) const;
 	inline uint32_t logical_to_chd_lba(uint32_t physlba, uint32_t &tracknum) const;
 
 	static void get_info_from_type_string(const char *typestring, uint32_t *trktype, uint32_t *datasize);
-	static uint8_t ecc_source_byte(const uint8_t *sector, uint32_t offset);
+	static void ecc_source(const uint8_t *sector, uint8_t *source);
 	static void ecc_compute_bytes(const uint8_t *sector, const uint16_t *row, int rowlen, uint8_t &val1, uint8_t &val2);
+	std::error_condition read_cached_bytes(uint64_t offset, void *dest, uint32_t length);
 	std::error_condition read_partial_sector(void *dest, uint32_t lbasector, uint32_t chdsector, uint32_t tracknum, uint32_t startoffs, uint32_t length, bool phys);
 
 	static std::string get_file_path(std::string &path);
@@ -22,11 +22,13 @@
 
 #include <zlib.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdlib>
 #include <ctime>
 #include <new>
+#include <thread>
 
 
 //**************************************************************************
@@ -164,6 +166,13 @@ inline void chd_file::file_read(uint64_t offset, void *dest, uint32_t length) co
 	if (!m_file)
 		throw std::error_condition(error::NOT_OPEN);
 
+	// copy straight out of the mapping if we have one
+	if (m_mapped && (offset <= m_mappedbytes) && (length <= (m_mappedbytes - offset)))
+	{
+		memcpy(dest, m_mapped + offset, length);
+		return;
+	}
+
 	// seek and read
 	m_file->seek(offset, SEEK_SET);
 	size_t count;
@@ -175,6 +184,21 @@ inline void chd_file::file_read(uint64_t offset, void *dest, uint32_t length) co
 }
 
 
+//-------------------------------------------------
+//  file_data - get a pointer to data from the
+//  file, in place if it's mapped or else read
+//  into the supplied buffer
+//-------------------------------------------------
+
+inline const uint8_t *chd_file::file_data(uint64_t offset, void *buffer, uint32_t length) const
+{
+	if (m_mapped && (offset <= m_mappedbytes) && (length <= (m_mappedbytes - offset)))
+		return m_mapped + offset;
+	file_read(offset, buffer, length);
+	return reinterpret_cast<const uint8_t *>(buffer);
+}
+
+
 //-------------------------------------------------
 //  file_write - write to the file at the given
 //  offset; on failure throw an error
@@ -283,6 +307,8 @@ inline uint8_t chd_file::bits_for_value(uint64_t value)
  */
 
 chd_file::chd_file()
+	: m_readahead_queue(nullptr)
+	, m_readahead_hunks(0)
 {
 	// reset state
 	close();
@@ -821,6 +847,13 @@ std::error_condition chd_file::open(
 	m_file = std::move(file);
 	m_parent = std::shared_ptr<chd_file>(std::shared_ptr<chd_file>(), parent);
 	m_cachehunk = ~0;
+
+	// a read-only file may be mapped, so compressed hunks can be decompressed in place
+	auto *const core = writeable ? nullptr : dynamic_cast<util::core_file *>(m_file.get());
+	if (core && !core->length(m_mappedbytes))
+		m_mapped = reinterpret_cast<const uint8_t *>(core->map());
+	if (!m_mapped)
+		m_mappedbytes = 0;
 	return open_common(writeable, open_parent);
 }
 
@@ -836,6 +869,8 @@ void chd_file::close()
 {
 	// reset file characteristics
 	m_file.reset();
+	m_mapped = nullptr;
+	m_mappedbytes = 0;
 	m_allow_reads = false;
 	m_allow_writes = false;
 
@@ -867,10 +902,22 @@ void chd_file::close()
 	for (auto & elem : m_decompressor)
 		elem.reset();
 	m_compressed.clear();
+	m_dictionary.clear();
 
 	// reset caching
 	m_cache.clear();
 	m_cachehunk = ~0;
+
+	// stop reading ahead
+	readahead_reset();
+	m_readahead.clear();
+	if (m_readahead_queue)
+		osd_work_queue_free(m_readahead_queue);
+	m_readahead_queue = nullptr;
+	m_readahead_hunks = 0;
+	m_readahead_last = ~0;
+	m_readahead_clock = 0;
+	m_readahead_stats = readahead_stats();
 }
 
 /**
@@ -897,6 +944,47 @@ void chd_file::close()
  */
 
 std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
+{
+	// only full hunks of files that are open and read ahead go through the cache
+	if (!m_readahead_hunks || !buffer || !m_file || (hunknum >= m_hunkcount))
+		return read_hunk_direct(hunknum, buffer);
+
+	// keep the next hunks coming while the reads are sequential
+	const bool sequential = (hunknum == m_readahead_last + 1) || (hunknum == m_readahead_last);
+	m_readahead_last = hunknum;
+	if (readahead_read(hunknum, buffer))
+	{
+		m_readahead_stats.m_hits++;
+		if (sequential)
+			for (uint32_t ahead = 1; (ahead <= m_readahead_hunks) && (ahead < m_hunkcount - hunknum); ahead++)
+				readahead_queue(hunknum + ahead);
+		return std::error_condition();
+	}
+
+	// queue the next hunks before decompressing this one, so they are
+	// decompressed at the same time
+	m_readahead_stats.m_misses++;
+	if (sequential)
+		for (uint32_t ahead = 1; (ahead <= m_readahead_hunks) && (ahead < m_hunkcount - hunknum); ahead++)
+			readahead_queue(hunknum + ahead);
+	return read_hunk_direct(hunknum, buffer);
+}
+
+/**
+ * @fn  std::error_condition chd_file::read_hunk_direct(uint32_t hunknum, void *buffer)
+ *
+ * @brief   -------------------------------------------------
+ *            read_hunk_direct - read a single hunk from the CHD file, without going through
+ *            the read-ahead cache
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum         The hunknum.
+ * @param [in,out]  buffer  If non-null, the buffer.
+ *
+ * @return  The hunk.
+ */
+
+std::error_condition chd_file::read_hunk_direct(uint32_t hunknum, void *buffer)
 {
 	// wrap this for clean reporting
 	try
@@ -927,8 +1015,7 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 				{
 					case V34_MAP_ENTRY_TYPE_COMPRESSED:
 						blocklen = get_u16be(&rawmap[12]) + (rawmap[14] << 16);
-						file_read(blockoffs, &m_compressed[0], blocklen);
-						m_decompressor[0]->decompress(&m_compressed[0], blocklen, dest, m_hunkbytes);
+						m_decompressor[0]->decompress(file_data(blockoffs, &m_compressed[0], blocklen), blocklen, dest, m_hunkbytes);
 						if (!(rawmap[15] & V34_MAP_ENTRY_FLAG_NO_CRC) && dest != nullptr && util::crc32_creator::simple(dest, m_hunkbytes) != blockcrc)
 							throw std::error_condition(error::DECOMPRESSION_ERROR);
 						return std::error_condition();
@@ -948,7 +1035,7 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 						return std::error_condition();
 
 					case V34_MAP_ENTRY_TYPE_SELF_HUNK:
-						return read_hunk(blockoffs, dest);
+						return read_hunk_direct(blockoffs, dest);
 
 					case V34_MAP_ENTRY_TYPE_PARENT_HUNK:
 						if (m_parent_missing)
@@ -986,13 +1073,15 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 					case COMPRESSION_TYPE_1:
 					case COMPRESSION_TYPE_2:
 					case COMPRESSION_TYPE_3:
-						file_read(blockoffs, &m_compressed[0], blocklen);
-						m_decompressor[rawmap[0]]->decompress(&m_compressed[0], blocklen, dest, m_hunkbytes);
+					{
+						const uint8_t *const source = file_data(blockoffs, &m_compressed[0], blocklen);
+						m_decompressor[rawmap[0]]->decompress(source, blocklen, dest, m_hunkbytes);
 						if (!m_decompressor[rawmap[0]]->lossy() && dest != nullptr && util::crc16_creator::simple(dest, m_hunkbytes) != blockcrc)
 							throw std::error_condition(error::DECOMPRESSION_ERROR);
-						if (m_decompressor[rawmap[0]]->lossy() && util::crc16_creator::simple(&m_compressed[0], blocklen) != blockcrc)
+						if (m_decompressor[rawmap[0]]->lossy() && util::crc16_creator::simple(source, blocklen) != blockcrc)
 							throw std::error_condition(error::DECOMPRESSION_ERROR);
 						return std::error_condition();
+					}
 
 					case COMPRESSION_NONE:
 						file_read(blockoffs, dest, m_hunkbytes);
@@ -1001,7 +1090,7 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 						return std::error_condition();
 
 					case COMPRESSION_SELF:
-						return read_hunk(blockoffs, dest);
+						return read_hunk_direct(blockoffs, dest);
 
 					case COMPRESSION_PARENT:
 						if (m_parent_missing)
@@ -1647,6 +1736,8 @@ std::error_condition chd_file::codec_configure(chd_codec_type codec, int param,
 		for (int codecnum = 0; codecnum < std::size(m_compression); codecnum++)
 			if (m_compression[codecnum] == codec)
 			{
+				// the read-ahead decompressors wouldn't see the configuration
+				set_readahead(0);
 				m_decompressor[codecnum]->configure(param, config);
 				return std::error_condition();
 			}
@@ -1659,6 +1750,209 @@ std::error_condition chd_file::codec_configure(chd_codec_type codec, int param,
 	}
 }
 
+//**************************************************************************
+//  READ-AHEAD
+//**************************************************************************
+
+// a hunk decompressed ahead of use, with its own decompressors so that it
+// can be worked on by another thread
+struct chd_file::readahead_hunk
+{
+	osd_work_item *             m_osd = nullptr;    // OSD work item decompressing this hunk
+	uint32_t                    m_hunknum = ~0U;    // number of the hunk held here
+	uint64_t                    m_lastuse = 0;      // clock value when last queued or read
+	uint8_t                     m_codec = 0;        // index of the codec to use
+	uint32_t                    m_complen = 0;      // length of the compressed data
+	util::crc16_t               m_crc16;            // expected CRC-16 of the data
+	bool                        m_valid = false;    // did the data decompress correctly?
+	std::vector<uint8_t>        m_compressed;       // compressed data
+	std::vector<uint8_t>        m_data;             // decompressed data
+	chd_decompressor::ptr       m_decompressor[4];  // decompression codecs
+
+	// wait for the work item to complete and release it
+	void finish()
+	{
+		if (m_osd)
+		{
+			while (!osd_work_item_wait(m_osd, osd_ticks_per_second())) { }
+			osd_work_item_release(m_osd);
+			m_osd = nullptr;
+		}
+	}
+};
+
+/**
+ * @fn  void chd_file::set_readahead(uint32_t hunks)
+ *
+ * @brief   -------------------------------------------------
+ *            set_readahead - set the number of hunks to decompress ahead of sequential
+ *            reads on other threads, or 0 to disable reading ahead
+ *          -------------------------------------------------.
+ *
+ * @param   hunks   The number of hunks.
+ */
+
+void chd_file::set_readahead(uint32_t hunks)
+{
+	// only v5 compressed hunks can be decompressed ahead
+	if (!m_file || (m_version < 5) || !compressed())
+		hunks = 0;
+
+	readahead_reset();
+	if (hunks != m_readahead_hunks)
+	{
+		// twice as many hunks as we read ahead, so the ones being read
+		// aren't replaced by the ones being queued
+		m_readahead.clear();
+		for (uint32_t index = 0; index < hunks * 2; index++)
+			m_readahead.emplace_back(std::make_unique<readahead_hunk>());
+		m_readahead_hunks = hunks;
+	}
+	if (hunks && !m_readahead_queue)
+		m_readahead_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+}
+
+/**
+ * @fn  void chd_file::readahead_reset()
+ *
+ * @brief   -------------------------------------------------
+ *            readahead_reset - wait for hunks being decompressed ahead and forget all of
+ *            them
+ *          -------------------------------------------------.
+ */
+
+void chd_file::readahead_reset()
+{
+	for (auto &hunk : m_readahead)
+	{
+		hunk->finish();
+		hunk->m_hunknum = ~0U;
+	}
+}
+
+/**
+ * @fn  void chd_file::readahead_queue(uint32_t hunknum)
+ *
+ * @brief   -------------------------------------------------
+ *            readahead_queue - read the compressed data for a hunk and queue it for
+ *            decompressing on another thread, if it isn't held already
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The hunknum.
+ */
+
+void chd_file::readahead_queue(uint32_t hunknum)
+{
+	// only hunks that need a codec are worth it
+	const uint8_t *const rawmap = &m_rawmap[m_mapentrybytes * hunknum];
+	if (rawmap[0] > COMPRESSION_TYPE_3)
+		return;
+
+	// find the least recently used hunk, unless we have this one already
+	readahead_hunk *target = nullptr;
+	for (auto &hunk : m_readahead)
+	{
+		if (hunk->m_hunknum == hunknum)
+			return;
+		if (!target || (hunk->m_lastuse < target->m_lastuse))
+			target = hunk.get();
+	}
+	target->finish();
+
+	// the file is only accessed from this thread
+	target->m_hunknum = ~0U;
+	target->m_codec = rawmap[0];
+	target->m_complen = get_u24be(&rawmap[1]);
+	target->m_crc16 = get_u16be(&rawmap[10]);
+	target->m_compressed.resize(m_hunkbytes);
+	target->m_data.resize(m_hunkbytes);
+	if (!target->m_decompressor[target->m_codec])
+		target->m_decompressor[target->m_codec] = chd_codec_list::new_decompressor(m_compression[target->m_codec], *this);
+	if (!target->m_decompressor[target->m_codec] || (target->m_complen > m_hunkbytes))
+		return;
+	try
+	{
+		file_read(get_u48be(&rawmap[4]), &target->m_compressed[0], target->m_complen);
+	}
+	catch (std::error_condition const &)
+	{
+		// leave it to the normal read to report
+		return;
+	}
+	target->m_hunknum = hunknum;
+	target->m_lastuse = ++m_readahead_clock;
+	m_readahead_stats.m_queued++;
+
+	// decompress it here if it can't be queued
+	target->m_osd = osd_work_item_queue(m_readahead_queue, readahead_decompress_static, target, 0);
+	if (!target->m_osd)
+		readahead_decompress_static(target, 0);
+}
+
+/**
+ * @fn  void *chd_file::readahead_decompress_static(void *param, int threadid)
+ *
+ * @brief   -------------------------------------------------
+ *            readahead_decompress_static - decompress a hunk queued by readahead_queue
+ *          -------------------------------------------------.
+ *
+ * @param [in,out]  param   If non-null, the parameter.
+ * @param   threadid        The threadid.
+ *
+ * @return  null if it fails, else a void*.
+ */
+
+void *chd_file::readahead_decompress_static(void *param, int threadid)
+{
+	auto &hunk = *reinterpret_cast<readahead_hunk *>(param);
+	try
+	{
+		hunk.m_decompressor[hunk.m_codec]->decompress(&hunk.m_compressed[0], hunk.m_complen, &hunk.m_data[0], hunk.m_data.size());
+		hunk.m_valid = util::crc16_creator::simple(&hunk.m_data[0], hunk.m_data.size()) == hunk.m_crc16;
+	}
+	catch (std::error_condition const &)
+	{
+		hunk.m_valid = false;
+	}
+	return nullptr;
+}
+
+/**
+ * @fn  bool chd_file::readahead_read(uint32_t hunknum, void *buffer)
+ *
+ * @brief   -------------------------------------------------
+ *            readahead_read - copy a hunk that was decompressed ahead, waiting for it if
+ *            it's still being worked on
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum         The hunknum.
+ * @param [in,out]  buffer  The buffer.
+ *
+ * @return  true if the hunk was held and decompressed correctly.
+ */
+
+bool chd_file::readahead_read(uint32_t hunknum, void *buffer)
+{
+	for (auto &hunk : m_readahead)
+	{
+		if (hunk->m_hunknum != hunknum)
+			continue;
+
+		hunk->finish();
+
+		// errors are reported by reading it again the normal way
+		if (!hunk->m_valid)
+		{
+			hunk->m_hunknum = ~0U;
+			return false;
+		}
+		memcpy(buffer, &hunk->m_data[0], m_hunkbytes);
+		hunk->m_lastuse = ++m_readahead_clock;
+		return true;
+	}
+	return false;
+}
+
 /**
  * @fn  const char *chd_file::error_string(chd_error err)
  *
@@ -2464,6 +2758,14 @@ std::error_condition chd_file::open_common(bool writeable, const open_parent_fun
 
 		// finish opening the file
 		create_open_common();
+
+		// read compressed files ahead, unless a codec needs more than the hunk data
+		bool readahead = !writeable && (m_version >= 5) && compressed();
+		for (auto &decompressor : m_decompressor)
+			if (decompressor && decompressor->lossy())
+				readahead = false;
+		if (readahead)
+			set_readahead(READAHEAD_HUNKS);
 		return std::error_condition();
 	}
 	catch (std::error_condition const &err)
@@ -2487,6 +2789,12 @@ std::error_condition chd_file::open_common(bool writeable, const open_parent_fun
 
 void chd_file::create_open_common()
 {
+	// load the trained dictionary if any codec needs it
+	m_dictionary.clear();
+	if (std::any_of(std::begin(m_compression), std::end(m_compression), &chd_codec_list::codec_uses_dictionary))
+		if (read_metadata(CODEC_DICTIONARY_METADATA_TAG, 0, m_dictionary))
+			m_dictionary.clear();
+
 	// verify the compression types and initialize the codecs
 	for (int decompnum = 0; decompnum < std::size(m_compression); decompnum++)
 	{
@@ -2797,6 +3105,7 @@ chd_file_compressor::chd_file_compressor()
 		m_read_done_offset(0),
 		m_read_error(false),
 		m_work_queue(nullptr),
+		m_work_hunks(0),
 		m_write_hunk(0)
 {
 	// zap arrays
@@ -2804,7 +3113,7 @@ chd_file_compressor::chd_file_compressor()
 
 	// allocate work queues
 	m_read_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
-	m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_BATCH);
 }
 
 /**
@@ -2851,11 +3160,17 @@ void chd_file_compressor::compress_begin()
 	m_read_done_offset = 0;
 	m_read_error = false;
 
+	// size the work buffer so there are enough batches to keep many threads
+	// busy, with each half holding whole batches
+	m_work_hunks = std::clamp(WORK_BUFFER_BYTES / hunk_bytes(), WORK_BUFFER_MIN_HUNKS, WORK_BUFFER_MAX_HUNKS);
+	m_work_hunks -= m_work_hunks % (2 * WORK_BATCH_HUNKS);
+
 	// reset work item state
-	m_work_buffer.resize(hunk_bytes() * (WORK_BUFFER_HUNKS + 1));
+	m_work_buffer.resize(hunk_bytes() * (m_work_hunks + 1));
 	memset(&m_work_buffer[0], 0, m_work_buffer.size());
-	m_compressed_buffer.resize(hunk_bytes() * WORK_BUFFER_HUNKS);
-	for (int itemnum = 0; itemnum < WORK_BUFFER_HUNKS; itemnum++)
+	m_compressed_buffer.resize(hunk_bytes() * m_work_hunks);
+	m_work_item.reset(new work_item[m_work_hunks]);
+	for (uint32_t itemnum = 0; itemnum < m_work_hunks; itemnum++)
 	{
 		work_item &item = m_work_item[itemnum];
 		item.m_compressor = this;
@@ -2864,12 +3179,17 @@ void chd_file_compressor::compress_begin()
 		item.m_hash.resize(hunk_bytes() / unit_bytes());
 	}
 
-	// initialize codec instances
+	// the codecs need the dictionary, so train it before creating them
+	train_dictionary();
+
+	// create the first codec instance up front so bad codecs are reported
+	// here; the rest are created by the threads that use them
 	for (auto & elem : m_codecs)
 	{
 		delete elem;
-		elem = new chd_compressor_group(*this, m_compression);
+		elem = nullptr;
 	}
+	m_codecs[0] = new chd_compressor_group(*this, m_compression);
 
 	// reset write state
 	m_write_hunk = 0;
@@ -2899,10 +3219,10 @@ std::error_condition chd_file_compressor::compress_continue(double &progress, do
 	{
 		// see if we have enough free work items to read the next half of a buffer
 		uint32_t startitem = m_read_queue_offset / hunk_bytes();
-		uint32_t enditem = startitem + WORK_BUFFER_HUNKS / 2;
+		uint32_t enditem = startitem + m_work_hunks / 2;
 		uint32_t curitem;
 		for (curitem = startitem; curitem < enditem; curitem++)
-			if (m_work_item[curitem % WORK_BUFFER_HUNKS].m_status != WS_READY)
+			if (m_work_item[curitem % m_work_hunks].m_status != WS_READY)
 				break;
 
 		// if it's not all clear, defer
@@ -2911,25 +3231,31 @@ std::error_condition chd_file_compressor::compress_continue(double &progress, do
 
 		// if we're walking the parent, we want one more item to have cleared so we
 		// can read an extra hunk there
-		if (m_walking_parent && m_work_item[curitem % WORK_BUFFER_HUNKS].m_status != WS_READY)
+		if (m_walking_parent && m_work_item[curitem % m_work_hunks].m_status != WS_READY)
 			break;
 
 		// queue the next read
 		for (curitem = startitem; curitem < enditem; curitem++)
-			m_work_item[curitem % WORK_BUFFER_HUNKS].m_status = WS_READING;
+			m_work_item[curitem % m_work_hunks].m_status = WS_READING;
 		osd_work_item_queue(m_read_queue, async_read_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
-		m_read_queue_offset += WORK_BUFFER_HUNKS * hunk_bytes() / 2;
+		m_read_queue_offset += m_work_hunks * hunk_bytes() / 2;
 	}
 
 	// flush out any finished items
-	while (m_work_item[m_write_hunk % WORK_BUFFER_HUNKS].m_status == WS_COMPLETE)
+	while (m_work_item[m_write_hunk % m_work_hunks].m_status == WS_COMPLETE)
 	{
-		work_item &item = m_work_item[m_write_hunk % WORK_BUFFER_HUNKS];
+		work_item &item = m_work_item[m_write_hunk % m_work_hunks];
 
-		// free any OSD work item
-		if (item.m_osd != nullptr)
-			osd_work_item_release(item.m_osd);
-		item.m_osd = nullptr;
+		// free the OSD work item after the last hunk of its batch; the read
+		// thread may not have stored it yet if the batch finished quickly
+		if ((item.m_hunknum % WORK_BATCH_HUNKS == WORK_BATCH_HUNKS - 1) || (item.m_hunknum == m_hunkcount - 1))
+		{
+			work_item &first = batch_item(item.m_hunknum);
+			osd_work_item *osd;
+			while ((osd = first.m_osd.exchange(nullptr)) == nullptr)
+				std::this_thread::yield();
+			osd_work_item_release(osd);
+		}
 
 		if (m_walking_parent)
 		{
@@ -2998,8 +3324,8 @@ std::error_condition chd_file_compressor::compress_continue(double &progress, do
 				m_walking_parent = false;
 				m_read_queue_offset = m_read_done_offset = 0;
 				m_write_hunk = 0;
-				for (auto & elem : m_work_item)
-					elem.m_status = WS_READY;
+				for (uint32_t itemnum = 0; itemnum < m_work_hunks; itemnum++)
+					m_work_item[itemnum].m_status = WS_READY;
 			}
 
 			// wait for all reads to finish and if we're compressed, write the final SHA1 and map
@@ -3021,33 +3347,44 @@ std::error_condition chd_file_compressor::compress_continue(double &progress, do
 		progress = double(m_write_hunk) / double(m_hunkcount);
 	ratio = (m_total_in == 0) ? 1.0 : double(m_total_out) / double(m_total_in);
 
-	// if we're waiting for work, wait
-	// sometimes code can get here with .m_status == WS_READY and .m_osd != nullptr, TODO find out why this happens
-	while (m_work_item[m_write_hunk % WORK_BUFFER_HUNKS].m_status != WS_READY &&
-		m_work_item[m_write_hunk % WORK_BUFFER_HUNKS].m_status != WS_COMPLETE &&
-		m_work_item[m_write_hunk % WORK_BUFFER_HUNKS].m_osd != nullptr)
-		osd_work_item_wait(m_work_item[m_write_hunk % WORK_BUFFER_HUNKS].m_osd, osd_ticks_per_second());
+	// if we're waiting for work, wait for the batch it's in
+	work_item &item = m_work_item[m_write_hunk % m_work_hunks];
+	if (item.m_status == WS_QUEUED)
+	{
+		osd_work_item *const osd = batch_item(m_write_hunk).m_osd;
+		if (osd != nullptr)
+			osd_work_item_wait(osd, osd_ticks_per_second());
+	}
 
 	return m_walking_parent ? error::WALKING_PARENT : error::COMPRESSING;
 }
 
 /**
- * @fn  void *chd_file_compressor::async_walk_parent_static(void *param, int threadid)
+ * @fn  void *chd_file_compressor::async_batch_static(void *param, int threadid)
  *
  * @brief   -------------------------------------------------
- *            async_walk_parent - handle asynchronous parent walking operations
+ *            async_batch - handle a batch of consecutive hunks, either walking the parent
+ *            or compressing
  *          -------------------------------------------------.
  *
- * @param [in,out]  param   If non-null, the parameter.
+ * @param [in,out]  param   The first work item of the batch.
  * @param   threadid        The threadid.
  *
  * @return  null if it fails, else a void*.
  */
 
-void *chd_file_compressor::async_walk_parent_static(void *param, int threadid)
+void *chd_file_compressor::async_batch_static(void *param, int threadid)
 {
-	auto *item = reinterpret_cast<work_item *>(param);
-	item->m_compressor->async_walk_parent(*item);
+	auto *const first = reinterpret_cast<work_item *>(param);
+	chd_file_compressor &compressor = *first->m_compressor;
+	for (uint32_t index = 0; index < first->m_batch; index++)
+	{
+		work_item &item = compressor.m_work_item[(first->m_hunknum + index) % compressor.m_work_hunks];
+		if (compressor.m_walking_parent)
+			compressor.async_walk_parent(item);
+		else
+			compressor.async_compress_hunk(item, threadid);
+	}
 	return nullptr;
 }
 
@@ -3073,26 +3410,6 @@ void chd_file_compressor::async_walk_parent(work_item &item)
 	item.m_status = WS_COMPLETE;
 }
 
-/**
- * @fn  void *chd_file_compressor::async_compress_hunk_static(void *param, int threadid)
- *
- * @brief   -------------------------------------------------
- *            async_compress_hunk - handle asynchronous hunk compression
- *          -------------------------------------------------.
- *
- * @param [in,out]  param   If non-null, the parameter.
- * @param   threadid        The threadid.
- *
- * @return  null if it fails, else a void*.
- */
-
-void *chd_file_compressor::async_compress_hunk_static(void *param, int threadid)
-{
-	auto *const item = reinterpret_cast<work_item *>(param);
-	item->m_compressor->async_compress_hunk(*item, threadid);
-	return nullptr;
-}
-
 /**
  * @fn  void chd_file_compressor::async_compress_hunk(work_item &item, int threadid)
  *
@@ -3104,8 +3421,10 @@ void *chd_file_compressor::async_compress_hunk_static(void *param, int threadid)
 
 void chd_file_compressor::async_compress_hunk(work_item &item, int threadid)
 {
-	// use our thread's codec
+	// use our thread's codec, only this thread touches it
 	assert(threadid < std::size(m_codecs));
+	if (!m_codecs[threadid])
+		m_codecs[threadid] = new chd_compressor_group(*this, m_compression);
 	item.m_codecs = m_codecs[threadid];
 
 	// compute CRC-16 and SHA-1 hashes
@@ -3142,6 +3461,52 @@ void *chd_file_compressor::async_read_static(void *param, int threadid)
 	return nullptr;
 }
 
+/**
+ * @fn  void chd_file_compressor::train_dictionary()
+ *
+ * @brief   -------------------------------------------------
+ *            train_dictionary - sample hunks spread across the input and train a
+ *            dictionary for the first codec that uses one, storing it as metadata
+ *          -------------------------------------------------.
+ */
+
+void chd_file_compressor::train_dictionary()
+{
+	// any dictionary cloned from another CHD doesn't belong to this one
+	while (!delete_metadata(CODEC_DICTIONARY_METADATA_TAG, 0)) { }
+	m_dictionary.clear();
+
+	auto const codec = std::find_if(std::begin(m_compression), std::end(m_compression), &chd_codec_list::codec_uses_dictionary);
+	if (codec == std::end(m_compression))
+		return;
+
+	// read evenly spaced hunks, skipping empty ones that would teach nothing
+	uint32_t const count = std::min<uint64_t>(m_hunkcount, DICTIONARY_SAMPLE_BYTES / hunk_bytes());
+	std::vector<uint8_t> samples;
+	std::vector<uint8_t> hunk(hunk_bytes());
+	for (uint32_t index = 0; index < count; index++)
+	{
+		uint64_t const offset = uint64_t(uint64_t(index) * m_hunkcount / count) * hunk_bytes();
+		uint32_t const length = std::min<uint64_t>(hunk_bytes(), m_logicalbytes - offset);
+		std::fill(hunk.begin(), hunk.end(), 0);
+		read_data(&hunk[0], offset, length);
+		if (std::find_if(hunk.begin(), hunk.end(), [] (uint8_t value) { return value != 0; }) != hunk.end())
+			samples.insert(samples.end(), hunk.begin(), hunk.end());
+	}
+
+	// a failed training just means compressing without a dictionary
+	if (!chd_codec_list::train_dictionary(*codec, samples, hunk_bytes(), DICTIONARY_BYTES, m_dictionary))
+		return;
+	std::error_condition err = write_metadata(CODEC_DICTIONARY_METADATA_TAG, 0, m_dictionary, 0);
+	if (err)
+		throw err;
+
+	// decompressors made when the file was created didn't have the dictionary yet
+	for (int decompnum = 0; decompnum < std::size(m_compression); decompnum++)
+		if (chd_codec_list::codec_uses_dictionary(m_compression[decompnum]))
+			m_decompressor[decompnum] = chd_codec_list::new_decompressor(m_compression[decompnum], *this);
+}
+
 /**
  * @fn  void chd_file_compressor::async_read()
  *
@@ -3155,7 +3520,7 @@ void chd_file_compressor::async_read()
 		return;
 
 	// determine parameters for the read
-	uint32_t work_buffer_bytes = WORK_BUFFER_HUNKS * hunk_bytes();
+	uint32_t work_buffer_bytes = m_work_hunks * hunk_bytes();
 	uint32_t numbytes = work_buffer_bytes / 2;
 	if (m_read_done_offset + numbytes > logical_bytes())
 		numbytes = logical_bytes() - m_read_done_offset;
@@ -3183,15 +3548,21 @@ void chd_file_compressor::async_read()
 		else
 			read_data(dest, m_read_done_offset, numbytes);
 
-		// spawn off work for each hunk
-		for (uint64_t curoffs = m_read_done_offset; curoffs < end_offset; curoffs += hunk_bytes())
+		// spawn off work for each batch of hunks
+		uint32_t const endhunk = (end_offset + hunk_bytes() - 1) / hunk_bytes();
+		for (uint32_t hunknum = m_read_done_offset / hunk_bytes(); hunknum < endhunk; hunknum += WORK_BATCH_HUNKS)
 		{
-			uint32_t hunknum = curoffs / hunk_bytes();
-			work_item &item = m_work_item[hunknum % WORK_BUFFER_HUNKS];
-			assert(item.m_status == WS_READING);
-			item.m_status = WS_QUEUED;
-			item.m_hunknum = hunknum;
-			item.m_osd = osd_work_item_queue(m_work_queue, m_walking_parent ? async_walk_parent_static : async_compress_hunk_static, &item, 0);
+			uint32_t const count = std::min(WORK_BATCH_HUNKS, endhunk - hunknum);
+			for (uint32_t index = 0; index < count; index++)
+			{
+				work_item &item = m_work_item[(hunknum + index) % m_work_hunks];
+				assert(item.m_status == WS_READING);
+				item.m_status = WS_QUEUED;
+				item.m_hunknum = hunknum + index;
+			}
+			work_item &first = m_work_item[hunknum % m_work_hunks];
+			first.m_batch = count;
+			first.m_osd = osd_work_item_queue(m_work_queue, async_batch_static, &first, 0);
 		}
 
 		// continue the running SHA-1
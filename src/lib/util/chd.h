@@ -243,6 +243,9 @@ extern const char *AV_METADATA_FORMAT;
 // A/V laserdisc frame metadata
 constexpr chd_metadata_tag AV_LD_METADATA_TAG = CHD_MAKE_TAG('A','V','L','D');
 
+// trained dictionary for codecs that use one
+constexpr chd_metadata_tag CODEC_DICTIONARY_METADATA_TAG = CHD_MAKE_TAG('D','I','C','T');
+
 
 
 //**************************************************************************
@@ -296,6 +299,17 @@ public:
 
 	using open_parent_func = std::function<std::unique_ptr<chd_file> (util::sha1_t const &)>;
 
+	// counters for hunks read through the read-ahead cache
+	struct readahead_stats
+	{
+		uint64_t                m_hits = 0;         // hunks that were already decompressed ahead
+		uint64_t                m_misses = 0;       // hunks decompressed on demand
+		uint64_t                m_queued = 0;       // hunks queued for decompressing ahead
+	};
+
+	// default number of hunks decompressed ahead of sequential reads
+	static constexpr uint32_t READAHEAD_HUNKS = 4;
+
 	// construction/destruction
 	chd_file();
 	virtual ~chd_file();
@@ -359,6 +373,12 @@ public:
 
 	// codec interfaces
 	std::error_condition codec_configure(chd_codec_type codec, int param, void *config);
+	const std::vector<uint8_t> &codec_dictionary() const noexcept { return m_dictionary; }
+
+	// read-ahead
+	void set_readahead(uint32_t hunks);
+	uint32_t readahead() const noexcept { return m_readahead_hunks; }
+	const readahead_stats &readahead_statistics() const noexcept { return m_readahead_stats; }
 
 	// typing
 	bool is_hd() const;
@@ -370,11 +390,13 @@ public:
 private:
 	struct metadata_entry;
 	struct metadata_hash;
+	struct readahead_hunk;
 
 	// inline helpers
 	util::sha1_t be_read_sha1(const uint8_t *base) const;
 	void be_write_sha1(uint8_t *base, util::sha1_t value);
 	void file_read(uint64_t offset, void *dest, uint32_t length) const;
+	const uint8_t *file_data(uint64_t offset, void *buffer, uint32_t length) const;
 	void file_write(uint64_t offset, const void *source, uint32_t length);
 	uint64_t file_append(const void *source, uint32_t length, uint32_t alignment = 0);
 	uint8_t bits_for_value(uint64_t value);
@@ -393,6 +415,11 @@ private:
 	void hunk_write_compressed(uint32_t hunknum, int8_t compression, const uint8_t *compressed, uint32_t complength, util::crc16_t crc16);
 	void hunk_copy_from_self(uint32_t hunknum, uint32_t otherhunk);
 	void hunk_copy_from_parent(uint32_t hunknum, uint64_t parentunit);
+	std::error_condition read_hunk_direct(uint32_t hunknum, void *buffer);
+	bool readahead_read(uint32_t hunknum, void *buffer);
+	void readahead_queue(uint32_t hunknum);
+	void readahead_reset();
+	static void *readahead_decompress_static(void *param, int threadid);
 	bool metadata_find(chd_metadata_tag metatag, int32_t metaindex, metadata_entry &metaentry, bool resume = false) const;
 	void metadata_set_previous_next(uint64_t prevoffset, uint64_t nextoffset);
 	void metadata_update_hash();
@@ -400,6 +427,8 @@ private:
 
 	// file characteristics
 	util::random_read_write::ptr m_file;        // handle to the open core file
+	const uint8_t *         m_mapped;           // contents of a read-only file mapped in place
+	uint64_t                m_mappedbytes;      // size of the mapped contents
 	bool                    m_allow_reads;      // permit reads from this CHD?
 	bool                    m_allow_writes;     // permit writes to this CHD?
 
@@ -430,10 +459,19 @@ private:
 	// compression management
 	chd_decompressor::ptr   m_decompressor[4];  // array of decompression codecs
 	std::vector<uint8_t>    m_compressed;       // temporary buffer for compressed data
+	std::vector<uint8_t>    m_dictionary;       // trained dictionary shared by codecs
 
 	// caching
 	std::vector<uint8_t>    m_cache;            // single-hunk cache for partial reads/writes
 	uint32_t                m_cachehunk;        // which hunk is in the cache?
+
+	// read-ahead
+	std::vector<std::unique_ptr<readahead_hunk>> m_readahead; // hunks decompressed ahead of use
+	osd_work_queue *        m_readahead_queue;  // queue for decompressing on other threads
+	uint32_t                m_readahead_hunks;  // number of hunks to decompress ahead
+	uint32_t                m_readahead_last;   // last hunk read, to detect sequential access
+	uint64_t                m_readahead_clock;  // counter for finding the least recently used hunk
+	readahead_stats         m_readahead_stats;  // read-ahead counters
 };
 
 
@@ -520,6 +558,7 @@ private:
 			, m_compressor(nullptr)
 			, m_status(WS_READY)
 			, m_hunknum(0)
+			, m_batch(0)
 			, m_data(nullptr)
 			, m_compressed(nullptr)
 			, m_complen(0)
@@ -527,12 +566,13 @@ private:
 			, m_codecs(nullptr)
 		{ }
 
-		osd_work_item *     m_osd;              // OSD work item running on this block
+		std::atomic<osd_work_item *> m_osd;     // OSD work item running on this batch (first item of a batch only)
 		chd_file_compressor *m_compressor;      // pointer back to the compressor
 		// TODO: had to change this to be able to use atomic_* functions on this
 		//volatile work_status m_status;          // current status of this item
 		std::atomic<int32_t>  m_status;           // current status of this item
 		uint32_t              m_hunknum;          // number of the hunk we're working on
+		uint32_t              m_batch;            // number of hunks in the batch started by this item
 		uint8_t *             m_data;             // pointer to the data we are working on
 		uint8_t *             m_compressed;       // pointer to the compressed data
 		uint32_t              m_complen;          // compressed data length
@@ -542,12 +582,13 @@ private:
 	};
 
 	// internal helpers
-	static void *async_walk_parent_static(void *param, int threadid);
+	work_item &batch_item(uint32_t hunknum) { return m_work_item[(hunknum - hunknum % WORK_BATCH_HUNKS) % m_work_hunks]; }
+	static void *async_batch_static(void *param, int threadid);
 	void async_walk_parent(work_item &item);
-	static void *async_compress_hunk_static(void *param, int threadid);
 	void async_compress_hunk(work_item &item, int threadid);
 	static void *async_read_static(void *param, int threadid);
 	void async_read();
+	void train_dictionary();
 
 	// current compression status
 	bool                    m_walking_parent;   // are we building the parent map?
@@ -566,13 +607,21 @@ private:
 	bool                    m_read_error;       // error during reading?
 
 	// work item thread
-	static constexpr int WORK_BUFFER_HUNKS = 256;
+	static constexpr uint32_t WORK_BUFFER_BYTES = 64 * 1024 * 1024; // preferred size of the work buffer
+	static constexpr uint32_t WORK_BUFFER_MIN_HUNKS = 256;    // fewest hunks in the work buffer
+	static constexpr uint32_t WORK_BUFFER_MAX_HUNKS = 4096;   // most hunks in the work buffer
+	static constexpr uint32_t WORK_BATCH_HUNKS = 4;           // hunks handled by a single OSD work item
 	osd_work_queue *        m_work_queue;       // queue for doing work on other threads
+	uint32_t                m_work_hunks;       // number of hunks in the work buffer
 	std::vector<uint8_t>    m_work_buffer;      // buffer containing hunk data to work on
 	std::vector<uint8_t>    m_compressed_buffer;// buffer containing compressed data
-	work_item               m_work_item[WORK_BUFFER_HUNKS]; // status of each hunk
+	std::unique_ptr<work_item []> m_work_item;  // status of each hunk
 	chd_compressor_group *  m_codecs[WORK_MAX_THREADS]; // codecs to use
 
+	// dictionary training
+	static constexpr uint32_t DICTIONARY_BYTES = 64 * 1024;               // largest dictionary to train
+	static constexpr uint32_t DICTIONARY_SAMPLE_BYTES = 16 * 1024 * 1024; // most hunk data to train from
+
 	// output state
 	uint32_t                m_write_hunk;       // next hunk to write
 };
@@ -21,8 +21,12 @@
 #include "lzma/C/LzmaEnc.h"
 
 #include <zlib.h>
+#include <zdict.h>
 #include <zstd.h>
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
 #include <new>
 
 
@@ -111,12 +115,15 @@ class chd_zstd_compressor : public chd_compressor
 {
 public:
 	// construction/destruction
-	chd_zstd_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy);
+	chd_zstd_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy) : chd_zstd_compressor(chd, hunkbytes, lossy, false) { }
 	~chd_zstd_compressor();
 
 	// core functionality
 	virtual uint32_t compress(const uint8_t *src, uint32_t srclen, uint8_t *dest) override;
 
+protected:
+	chd_zstd_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy, bool dictionary);
+
 private:
 	// internal state
 	ZSTD_CStream *          m_stream;
@@ -130,18 +137,41 @@ class chd_zstd_decompressor : public chd_decompressor
 {
 public:
 	// construction/destruction
-	chd_zstd_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy);
+	chd_zstd_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy) : chd_zstd_decompressor(chd, hunkbytes, lossy, false) { }
 	~chd_zstd_decompressor();
 
 	// core functionality
 	virtual void decompress(const uint8_t *src, uint32_t complen, uint8_t *dest, uint32_t destlen) override;
 
+protected:
+	chd_zstd_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy, bool dictionary);
+
 private:
 	// internal state
 	ZSTD_DStream *          m_stream;
 };
 
 
+// ======================> chd_zstd_dict_compressor
+
+// Zstandard compressor using the CHD's trained dictionary
+class chd_zstd_dict_compressor : public chd_zstd_compressor
+{
+public:
+	chd_zstd_dict_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy) : chd_zstd_compressor(chd, hunkbytes, lossy, true) { }
+};
+
+
+// ======================> chd_zstd_dict_decompressor
+
+// Zstandard decompressor using the CHD's trained dictionary
+class chd_zstd_dict_decompressor : public chd_zstd_decompressor
+{
+public:
+	chd_zstd_dict_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy) : chd_zstd_decompressor(chd, hunkbytes, lossy, true) { }
+};
+
+
 // ======================> chd_lzma_allocator
 
 // allocation helper clas for zlib
@@ -533,6 +563,7 @@ const codec_entry f_codec_list[] =
 	// general codecs
 	{ CHD_CODEC_ZLIB,       false,  "Deflate",              &codec_entry::construct_compressor<chd_zlib_compressor>,     &codec_entry::construct_decompressor<chd_zlib_decompressor> },
 	{ CHD_CODEC_ZSTD,       false,  "Zstandard",            &codec_entry::construct_compressor<chd_zstd_compressor>,     &codec_entry::construct_decompressor<chd_zstd_decompressor> },
+	{ CHD_CODEC_ZSTD_DICT,  false,  "Zstandard (dictionary)", &codec_entry::construct_compressor<chd_zstd_dict_compressor>, &codec_entry::construct_decompressor<chd_zstd_dict_decompressor> },
 	{ CHD_CODEC_LZMA,       false,  "LZMA",                 &codec_entry::construct_compressor<chd_lzma_compressor>,     &codec_entry::construct_decompressor<chd_lzma_decompressor> },
 	{ CHD_CODEC_HUFFMAN,    false,  "Huffman",              &codec_entry::construct_compressor<chd_huffman_compressor>,  &codec_entry::construct_decompressor<chd_huffman_decompressor> },
 	{ CHD_CODEC_FLAC,       false,  "FLAC",                 &codec_entry::construct_compressor<chd_flac_compressor>,     &codec_entry::construct_decompressor<chd_flac_decompressor> },
@@ -540,6 +571,7 @@ const codec_entry f_codec_list[] =
 	// general codecs with CD frontend
 	{ CHD_CODEC_CD_ZLIB,    false,  "CD Deflate",           &codec_entry::construct_compressor<chd_cd_compressor<chd_zlib_compressor, chd_zlib_compressor> >,        &codec_entry::construct_decompressor<chd_cd_decompressor<chd_zlib_decompressor, chd_zlib_decompressor> > },
 	{ CHD_CODEC_CD_ZSTD,    false,  "CD Zstandard",         &codec_entry::construct_compressor<chd_cd_compressor<chd_zstd_compressor, chd_zstd_compressor> >,        &codec_entry::construct_decompressor<chd_cd_decompressor<chd_zstd_decompressor, chd_zstd_decompressor> > },
+	{ CHD_CODEC_CD_ZSTD_DICT, false, "CD Zstandard (dictionary)", &codec_entry::construct_compressor<chd_cd_compressor<chd_zstd_dict_compressor, chd_zstd_compressor> >, &codec_entry::construct_decompressor<chd_cd_decompressor<chd_zstd_dict_decompressor, chd_zstd_decompressor> > },
 	{ CHD_CODEC_CD_LZMA,    false,  "CD LZMA",              &codec_entry::construct_compressor<chd_cd_compressor<chd_lzma_compressor, chd_zlib_compressor> >,        &codec_entry::construct_decompressor<chd_cd_decompressor<chd_lzma_decompressor, chd_zlib_decompressor> > },
 	{ CHD_CODEC_CD_FLAC,    false,  "CD FLAC",              &codec_entry::construct_compressor<chd_cd_flac_compressor>,                                              &codec_entry::construct_decompressor<chd_cd_flac_decompressor> },
 
@@ -688,6 +720,66 @@ const char *chd_codec_list::codec_name(chd_codec_type type)
 }
 
 
+//-------------------------------------------------
+//  codec_uses_dictionary - return true if the
+//  given codec uses the CHD's trained dictionary
+//-------------------------------------------------
+
+bool chd_codec_list::codec_uses_dictionary(chd_codec_type type)
+{
+	return (type == CHD_CODEC_ZSTD_DICT) || (type == CHD_CODEC_CD_ZSTD_DICT);
+}
+
+
+//-------------------------------------------------
+//  train_dictionary - build a dictionary for the
+//  given codec from a buffer of whole sample hunks
+//-------------------------------------------------
+
+bool chd_codec_list::train_dictionary(chd_codec_type type, const std::vector<uint8_t> &samples, uint32_t hunkbytes, uint32_t maxbytes, std::vector<uint8_t> &dictionary)
+{
+	dictionary.clear();
+	if (!codec_uses_dictionary(type) || samples.size() < hunkbytes)
+		return false;
+
+	// the CD codec only sees sector data, with sync and ECC cleared where it can be regenerated
+	std::vector<uint8_t> sectors;
+	const std::vector<uint8_t> *source = &samples;
+	uint32_t samplebytes = hunkbytes;
+	if (type == CHD_CODEC_CD_ZSTD_DICT)
+	{
+		if (hunkbytes % cdrom_file::FRAME_SIZE != 0)
+			return false;
+		uint32_t const frames = hunkbytes / cdrom_file::FRAME_SIZE;
+		samplebytes = frames * cdrom_file::MAX_SECTOR_DATA;
+		sectors.resize((samples.size() / hunkbytes) * samplebytes);
+		for (size_t framenum = 0; framenum < sectors.size() / cdrom_file::MAX_SECTOR_DATA; framenum++)
+		{
+			uint8_t *const sector = &sectors[framenum * cdrom_file::MAX_SECTOR_DATA];
+			memcpy(sector, &samples[framenum * cdrom_file::FRAME_SIZE], cdrom_file::MAX_SECTOR_DATA);
+			if (memcmp(sector, f_cd_sync_header, sizeof(f_cd_sync_header)) == 0 && cdrom_file::ecc_verify(sector))
+			{
+				memset(sector, 0, sizeof(f_cd_sync_header));
+				cdrom_file::ecc_clear(sector);
+			}
+		}
+		source = &sectors;
+	}
+
+	// aim for a dictionary no more than a sixteenth of the sample data
+	std::vector<size_t> sizes(source->size() / samplebytes, samplebytes);
+	dictionary.resize(std::min<size_t>(maxbytes, source->size() / 16));
+	size_t const result = ZDICT_trainFromBuffer(&dictionary[0], dictionary.size(), &(*source)[0], &sizes[0], sizes.size());
+	if (ZDICT_isError(result))
+	{
+		dictionary.clear();
+		return false;
+	}
+	dictionary.resize(result);
+	return true;
+}
+
+
 
 //**************************************************************************
 //  CODEC INSTANCE
@@ -699,16 +791,38 @@ const char *chd_codec_list::codec_name(chd_codec_type type)
 
 chd_compressor_group::chd_compressor_group(chd_file &chd, uint32_t compressor_list[4])
 	: m_hunkbytes(chd.hunk_bytes())
+	, m_probe(-1)
 	, m_compress_test(m_hunkbytes)
 #if CHDCODEC_VERIFY_COMPRESSION
 	, m_decompressed(m_hunkbytes)
 #endif
 {
 	// verify the compression types and initialize the codecs
+	bool signal = false;
 	for (int codecnum = 0; codecnum < std::size(m_compressor); codecnum++)
 	{
 		if (compressor_list[codecnum] != CHD_CODEC_NONE)
 		{
+			// the first deflate-style codec can cheaply prove a hunk incompressible,
+			// but not for codecs that model audio/video rather than bytes
+			switch (compressor_list[codecnum])
+			{
+			case CHD_CODEC_ZLIB:
+			case CHD_CODEC_ZSTD:
+			case CHD_CODEC_ZSTD_DICT:
+			case CHD_CODEC_CD_ZLIB:
+			case CHD_CODEC_CD_ZSTD:
+			case CHD_CODEC_CD_ZSTD_DICT:
+				if (m_probe < 0)
+					m_probe = codecnum;
+				break;
+			case CHD_CODEC_FLAC:
+			case CHD_CODEC_CD_FLAC:
+			case CHD_CODEC_AVHUFF:
+				signal = true;
+				break;
+			}
+
 			m_compressor[codecnum] = chd_codec_list::new_compressor(compressor_list[codecnum], chd);
 			if (!m_compressor[codecnum])
 				throw std::error_condition(chd_file::error::UNKNOWN_COMPRESSION);
@@ -719,6 +833,10 @@ chd_compressor_group::chd_compressor_group(chd_file &chd, uint32_t compressor_li
 #endif
 		}
 	}
+
+	// only worth probing if there is something slower to skip
+	if (signal || std::count_if(std::begin(m_compressor), std::end(m_compressor), [] (auto const &c) { return bool(c); }) < 2)
+		m_probe = -1;
 }
 
 
@@ -743,54 +861,100 @@ int8_t chd_compressor_group::find_best_compressor(const uint8_t *src, uint8_t *c
 	// determine best compression technique
 	complen = m_hunkbytes;
 	int8_t compression = -1;
+
+	// if the bytes look random, give the fast codec first go; if it can't
+	// shrink the hunk meaningfully, the slower codecs won't either
+	int8_t const probe = (m_probe >= 0 && high_entropy(src)) ? m_probe : -1;
+	if (probe >= 0)
+	{
+		try_compressor(probe, src, compressed, complen, compression);
+		if (complen >= m_hunkbytes - m_hunkbytes / 128)
+		{
+			if (compression == -1)
+				memcpy(compressed, src, m_hunkbytes);
+			return compression;
+		}
+	}
+
 	for (int codecnum = 0; codecnum < std::size(m_compressor); codecnum++)
-		if (m_compressor[codecnum])
+		if (m_compressor[codecnum] && codecnum != probe)
+			try_compressor(codecnum, src, compressed, complen, compression);
+
+	// if the best is none, copy it over
+	if (compression == -1)
+		memcpy(compressed, src, m_hunkbytes);
+	return compression;
+}
+
+
+//-------------------------------------------------
+//  try_compressor - compress with a single codec,
+//  keeping the result if it beats the best so far
+//-------------------------------------------------
+
+void chd_compressor_group::try_compressor(int codecnum, const uint8_t *src, uint8_t *compressed, uint32_t &complen, int8_t &compression)
+{
+	// attempt to compress, swallowing errors
+	try
+	{
+		// if this is the best one, copy the data into the permanent buffer
+		uint32_t compbytes = m_compressor[codecnum]->compress(src, m_hunkbytes, &m_compress_test[0]);
+#if CHDCODEC_VERIFY_COMPRESSION
+		try
 		{
-			// attempt to compress, swallowing errors
+			memset(m_decompressed, 0, m_hunkbytes);
+			m_decompressor[codecnum]->decompress(m_compress_test, compbytes, m_decompressed, m_hunkbytes);
+		}
+		catch (...)
+		{
+		}
+
+		if (memcmp(src, m_decompressed, m_hunkbytes) != 0)
+		{
+			compbytes = m_compressor[codecnum]->compress(src, m_hunkbytes, m_compress_test);
 			try
 			{
-				// if this is the best one, copy the data into the permanent buffer
-				uint32_t compbytes = m_compressor[codecnum]->compress(src, m_hunkbytes, &m_compress_test[0]);
-#if CHDCODEC_VERIFY_COMPRESSION
-				try
-				{
-					memset(m_decompressed, 0, m_hunkbytes);
-					m_decompressor[codecnum]->decompress(m_compress_test, compbytes, m_decompressed, m_hunkbytes);
-				}
-				catch (...)
-				{
-				}
-
-				if (memcmp(src, m_decompressed, m_hunkbytes) != 0)
-				{
-					compbytes = m_compressor[codecnum]->compress(src, m_hunkbytes, m_compress_test);
-					try
-					{
-						m_decompressor[codecnum]->decompress(m_compress_test, compbytes, m_decompressed, m_hunkbytes);
-					}
-					catch (...)
-					{
-						memset(m_decompressed, 0, m_hunkbytes);
-					}
-				}
-printf("   codec%d=%d bytes            \n", codecnum, compbytes);
-#endif
-				if (compbytes < complen)
-				{
-					compression = codecnum;
-					complen = compbytes;
-					memcpy(compressed, &m_compress_test[0], compbytes);
-				}
+				m_decompressor[codecnum]->decompress(m_compress_test, compbytes, m_decompressed, m_hunkbytes);
 			}
 			catch (...)
 			{
+				memset(m_decompressed, 0, m_hunkbytes);
 			}
 		}
+printf("   codec%d=%d bytes            \n", codecnum, compbytes);
+#endif
+		// ties go to the earlier codec, whatever order they were tried in
+		if (compbytes < complen || (compbytes == complen && compression > codecnum))
+		{
+			compression = codecnum;
+			complen = compbytes;
+			memcpy(compressed, &m_compress_test[0], compbytes);
+		}
+	}
+	catch (...)
+	{
+	}
+}
 
-	// if the best is none, copy it over
-	if (compression == -1)
-		memcpy(compressed, src, m_hunkbytes);
-	return compression;
+
+//-------------------------------------------------
+//  high_entropy - return true if the order-0
+//  byte entropy of a hunk is close to 8 bits
+//-------------------------------------------------
+
+bool chd_compressor_group::high_entropy(const uint8_t *src) const
+{
+	uint32_t histogram[256] = { 0 };
+	for (uint32_t offset = 0; offset < m_hunkbytes; offset++)
+		histogram[src[offset]]++;
+
+	// total information content in bits, compared against 7.9 bits per byte
+	double const total = double(m_hunkbytes);
+	double bits = 0.0;
+	for (uint32_t count : histogram)
+		if (count != 0)
+			bits -= double(count) * std::log2(double(count) / total);
+	return bits >= total * 7.9;
 }
 
 
@@ -1032,7 +1196,7 @@ void chd_zlib_decompressor::decompress(const uint8_t *src, uint32_t complen, uin
 //  chd_zstd_compressor - constructor
 //-------------------------------------------------
 
-chd_zstd_compressor::chd_zstd_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy)
+chd_zstd_compressor::chd_zstd_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy, bool dictionary)
 	: chd_compressor(chd, hunkbytes, lossy)
 	, m_stream(nullptr)
 {
@@ -1042,6 +1206,16 @@ chd_zstd_compressor::chd_zstd_compressor(chd_file &chd, uint32_t hunkbytes, bool
 	// convert errors
 	if (!m_stream)
 		throw std::bad_alloc();
+
+	// the level and dictionary persist across frames, so only set them once
+	auto result = ZSTD_CCtx_setParameter(m_stream, ZSTD_c_compressionLevel, ZSTD_maxCLevel());
+	if (!ZSTD_isError(result) && dictionary && !chd.codec_dictionary().empty())
+		result = ZSTD_CCtx_loadDictionary(m_stream, &chd.codec_dictionary()[0], chd.codec_dictionary().size());
+	if (ZSTD_isError(result))
+	{
+		ZSTD_freeCStream(m_stream);
+		throw std::error_condition(chd_file::error::CODEC_ERROR);
+	}
 }
 
 
@@ -1063,7 +1237,7 @@ chd_zstd_compressor::~chd_zstd_compressor()
 uint32_t chd_zstd_compressor::compress(const uint8_t *src, uint32_t srclen, uint8_t *dest)
 {
 	// reset the compressor
-	auto result = ZSTD_initCStream(m_stream, ZSTD_maxCLevel());
+	auto result = ZSTD_CCtx_reset(m_stream, ZSTD_reset_session_only);
 	if (ZSTD_isError(result))
 		throw std::error_condition(chd_file::error::COMPRESSION_ERROR);
 
@@ -1094,10 +1268,10 @@ uint32_t chd_zstd_compressor::compress(const uint8_t *src, uint32_t srclen, uint
 //**************************************************************************
 
 //-------------------------------------------------
-//  chd_zstd_compressor - constructor
+//  chd_zstd_decompressor - constructor
 //-------------------------------------------------
 
-chd_zstd_decompressor::chd_zstd_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy)
+chd_zstd_decompressor::chd_zstd_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy, bool dictionary)
 	: chd_decompressor(chd, hunkbytes, lossy)
 	, m_stream(nullptr)
 {
@@ -1107,6 +1281,17 @@ chd_zstd_decompressor::chd_zstd_decompressor(chd_file &chd, uint32_t hunkbytes,
 	// convert errors
 	if (!m_stream)
 		throw std::bad_alloc();
+
+	// the dictionary is digested once here and kept across frames
+	if (dictionary && !chd.codec_dictionary().empty())
+	{
+		auto const result = ZSTD_DCtx_loadDictionary(m_stream, &chd.codec_dictionary()[0], chd.codec_dictionary().size());
+		if (ZSTD_isError(result))
+		{
+			ZSTD_freeDStream(m_stream);
+			throw std::error_condition(chd_file::error::CODEC_ERROR);
+		}
+	}
 }
 
 
@@ -1128,7 +1313,7 @@ chd_zstd_decompressor::~chd_zstd_decompressor()
 void chd_zstd_decompressor::decompress(const uint8_t *src, uint32_t complen, uint8_t *dest, uint32_t destlen)
 {
 	// reset the decompressor
-	auto result = ZSTD_initDStream(m_stream);
+	auto result = ZSTD_DCtx_reset(m_stream, ZSTD_reset_session_only);
 	if (ZSTD_isError(result))
 		throw std::error_condition(chd_file::error::DECOMPRESSION_ERROR);
 
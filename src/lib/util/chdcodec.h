@@ -106,6 +106,10 @@ public:
 	// utilities
 	static bool codec_exists(chd_codec_type type);
 	static const char *codec_name(chd_codec_type type);
+
+	// trained dictionaries
+	static bool codec_uses_dictionary(chd_codec_type type);
+	static bool train_dictionary(chd_codec_type type, const std::vector<uint8_t> &samples, uint32_t hunkbytes, uint32_t maxbytes, std::vector<uint8_t> &dictionary);
 };
 
 
@@ -123,9 +127,14 @@ public:
 	int8_t find_best_compressor(const uint8_t *src, uint8_t *compressed, uint32_t &complen);
 
 private:
+	// internal helpers
+	void try_compressor(int codecnum, const uint8_t *src, uint8_t *compressed, uint32_t &complen, int8_t &compression);
+	bool high_entropy(const uint8_t *src) const;
+
 	// internal state
 	uint32_t                m_hunkbytes;        // number of bytes in a hunk
 	chd_compressor::ptr     m_compressor[4];    // array of active codecs
+	int8_t                  m_probe;            // fast codec used to reject incompressible hunks, or -1
 	std::vector<uint8_t>    m_compress_test;    // test buffer for compression
 #if CHDCODEC_VERIFY_COMPRESSION
 	chd_decompressor::ptr   m_decompressor[4];  // array of active codecs
@@ -156,6 +165,7 @@ constexpr chd_codec_type CHD_CODEC_NONE     = 0;
 // general codecs
 constexpr chd_codec_type CHD_CODEC_ZLIB     = CHD_MAKE_TAG('z','l','i','b');
 constexpr chd_codec_type CHD_CODEC_ZSTD     = CHD_MAKE_TAG('z','s','t','d');
+constexpr chd_codec_type CHD_CODEC_ZSTD_DICT = CHD_MAKE_TAG('z','s','d','c');
 constexpr chd_codec_type CHD_CODEC_LZMA     = CHD_MAKE_TAG('l','z','m','a');
 constexpr chd_codec_type CHD_CODEC_HUFFMAN  = CHD_MAKE_TAG('h','u','f','f');
 constexpr chd_codec_type CHD_CODEC_FLAC     = CHD_MAKE_TAG('f','l','a','c');
@@ -163,6 +173,7 @@ constexpr chd_codec_type CHD_CODEC_FLAC     = CHD_MAKE_TAG('f','l','a','c');
 // general codecs with CD frontend
 constexpr chd_codec_type CHD_CODEC_CD_ZLIB  = CHD_MAKE_TAG('c','d','z','l');
 constexpr chd_codec_type CHD_CODEC_CD_ZSTD  = CHD_MAKE_TAG('c','d','z','s');
+constexpr chd_codec_type CHD_CODEC_CD_ZSTD_DICT = CHD_MAKE_TAG('c','d','z','d');
 constexpr chd_codec_type CHD_CODEC_CD_LZMA  = CHD_MAKE_TAG('c','d','l','z');
 constexpr chd_codec_type CHD_CODEC_CD_FLAC  = CHD_MAKE_TAG('c','d','f','l');
 
@@ -65,6 +65,7 @@ public:
 	virtual int puts(std::string_view s) override { return m_file.puts(s); }
 	virtual int vprintf(util::format_argument_pack<char> const &args) override { return m_file.vprintf(args); }
 	virtual std::error_condition truncate(std::uint64_t offset) override { return m_file.truncate(offset); }
+	virtual void const *map() noexcept override { return m_file.map(); }
 
 private:
 	core_file &m_file;
@@ -178,6 +179,7 @@ public:
 	void const *buffer() const { return m_data; }
 
 	virtual std::error_condition truncate(std::uint64_t offset) override;
+	virtual void const *map() noexcept override { return m_data; }
 
 protected:
 	void *allocate() noexcept
@@ -226,6 +228,7 @@ public:
 	virtual std::error_condition write_at(std::uint64_t offset, void const *buffer, std::size_t length, std::size_t &actual) noexcept override;
 
 	virtual std::error_condition truncate(std::uint64_t offset) override;
+	virtual void const *map() noexcept override { return write_access() ? nullptr : m_file->map(); }
 
 protected:
 	bool is_buffered(std::uint64_t offset) const noexcept { return (offset >= m_bufferbase) && (offset < (m_bufferbase + m_bufferbytes)); }
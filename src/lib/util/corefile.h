@@ -95,6 +95,9 @@ public:
 
 	// file truncation
 	virtual std::error_condition truncate(std::uint64_t offset) = 0;
+
+	// get the whole contents in place if they're in memory or can be mapped read-only, or nullptr
+	virtual void const *map() noexcept = 0;
 };
 
 } // namespace util
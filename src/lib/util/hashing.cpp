@@ -19,6 +19,37 @@
 #include <algorithm>
 #include <iomanip>
 #include <sstream>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define MAME_HASH_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__)) && (defined(__linux__) || defined(__APPLE__))
+#define MAME_HASH_ARM64
+#include <arm_acle.h>
+#include <arm_neon.h>
+#if defined(__clang__)
+#define MAME_HASH_ARM64_CRC "crc"
+#define MAME_HASH_ARM64_SHA "sha2"
+#else
+#define MAME_HASH_ARM64_CRC "+crc"
+#define MAME_HASH_ARM64_SHA "+crypto"
+#endif
+#if defined(__APPLE__)
+// every Apple ARM CPU has both
+#define MAME_HASH_ARM64_HAS_CRC true
+#define MAME_HASH_ARM64_HAS_SHA1 true
+#else
+#include <sys/auxv.h>
+#define MAME_HASH_ARM64_HAS_CRC (getauxval(AT_HWCAP) & (1U << 7)) // HWCAP_CRC32
+#define MAME_HASH_ARM64_HAS_SHA1 (getauxval(AT_HWCAP) & (1U << 5)) // HWCAP_SHA1
+#endif
+#endif
 
 
 namespace util {
@@ -103,6 +134,318 @@ inline void sha1_process(std::array<uint32_t, 5> &st, uint32_t *data) noexcept
 		st[i] += d[i];
 }
 
+void sha1_blocks_portable(std::array<uint32_t, 5> &st, const uint8_t *data, size_t blocks) noexcept
+{
+	uint32_t words[16];
+	for ( ; blocks; blocks--, data += 64)
+	{
+		for (unsigned i = 0U; i < 16U; i++)
+			words[i] = (uint32_t(data[i * 4]) << 24) | (uint32_t(data[i * 4 + 1]) << 16) | (uint32_t(data[i * 4 + 2]) << 8) | uint32_t(data[i * 4 + 3]);
+		sha1_process(st, words);
+	}
+}
+
+uint32_t crc32_portable(uint32_t crc, const uint8_t *data, size_t length) noexcept
+{
+	return uint32_t(crc32_z(crc, reinterpret_cast<const Bytef *>(data), length));
+}
+
+
+//-------------------------------------------------
+//  hardware implementations - the host's CRC and
+//  SHA instructions are found at run time, so
+//  these are compiled for them regardless of the
+//  baseline the rest of the code targets
+//-------------------------------------------------
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MAME_HASH_TARGET(features) __attribute__((target(features)))
+#else
+#define MAME_HASH_TARGET(features)
+#endif
+
+using crc32_function = uint32_t (*)(uint32_t crc, const uint8_t *data, size_t length) noexcept;
+using sha1_function = void (*)(std::array<uint32_t, 5> &st, const uint8_t *data, size_t blocks) noexcept;
+
+#if defined(MAME_HASH_X86)
+
+MAME_HASH_TARGET("pclmul,sse2")
+inline __m128i crc32_pclmul_fold(__m128i x, __m128i next, __m128i k) noexcept
+{
+	return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x11), _mm_clmulepi64_si128(x, k, 0x00)), next);
+}
+
+// CRC-32 by folding 64 bytes at a time with carry-less multiplies, as
+// described in Intel's "Fast CRC Computation for Generic Polynomials
+// Using PCLMULQDQ Instruction"; the constants are for zlib's reflected
+// polynomial, and the tail that doesn't fill 16 bytes goes to zlib
+MAME_HASH_TARGET("pclmul,sse2")
+uint32_t crc32_pclmul(uint32_t crc, const uint8_t *data, size_t length) noexcept
+{
+	if (length < 64)
+		return crc32_portable(crc, data, length);
+
+	__m128i const k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+	__m128i const k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+	__m128i const k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+	__m128i const poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+	__m128i const mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+	// four lanes of 16 bytes, with the incoming CRC folded into the first
+	__m128i x1 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x00)), _mm_cvtsi32_si128(int(~crc)));
+	__m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x10));
+	__m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x20));
+	__m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x30));
+	data += 64;
+	length -= 64;
+
+	while (length >= 64)
+	{
+		__m128i const x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+		__m128i const x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+		__m128i const x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+		__m128i const x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+		x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k1k2, 0x11), x5), _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x00)));
+		x2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x2, k1k2, 0x11), x6), _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x10)));
+		x3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x3, k1k2, 0x11), x7), _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x20)));
+		x4 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x4, k1k2, 0x11), x8), _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x30)));
+		data += 64;
+		length -= 64;
+	}
+
+	// fold the lanes together, then any remaining 16-byte blocks
+	x1 = crc32_pclmul_fold(x1, x2, k3k4);
+	x1 = crc32_pclmul_fold(x1, x3, k3k4);
+	x1 = crc32_pclmul_fold(x1, x4, k3k4);
+	for ( ; length >= 16; data += 16, length -= 16)
+		x1 = crc32_pclmul_fold(x1, _mm_loadu_si128(reinterpret_cast<const __m128i *>(data)), k3k4);
+
+	// fold 128 bits to 64, then Barrett reduce to 32
+	x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), _mm_clmulepi64_si128(x1, k3k4, 0x10));
+	x1 = _mm_xor_si128(_mm_srli_si128(x1, 4), _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5k0, 0x00));
+	x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+	x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), poly, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+	crc = ~uint32_t(_mm_cvtsi128_si32(_mm_srli_si128(x1, 4)));
+
+	return length ? crc32_portable(crc, data, length) : crc;
+}
+
+// one group of four SHA-1 rounds with SHA-NI; the message words for
+// later groups are expanded alongside, and the two E registers alternate
+template <unsigned Group>
+MAME_HASH_TARGET("sha,sse4.1")
+inline void sha1_shani_group(__m128i &abcd, __m128i (&e)[2], __m128i (&msg)[4]) noexcept
+{
+	if (Group == 0)
+		e[0] = _mm_add_epi32(e[0], msg[0]);
+	else
+		e[Group & 1] = _mm_sha1nexte_epu32(e[Group & 1], msg[Group & 3]);
+	e[~Group & 1] = abcd;
+	if ((Group >= 3) && (Group <= 18))
+		msg[(Group + 1) & 3] = _mm_sha1msg2_epu32(msg[(Group + 1) & 3], msg[Group & 3]);
+	abcd = _mm_sha1rnds4_epu32(abcd, e[Group & 1], Group / 5);
+	if ((Group >= 1) && (Group <= 16))
+		msg[(Group - 1) & 3] = _mm_sha1msg1_epu32(msg[(Group - 1) & 3], msg[Group & 3]);
+	if ((Group >= 2) && (Group <= 17))
+		msg[(Group - 2) & 3] = _mm_xor_si128(msg[(Group - 2) & 3], msg[Group & 3]);
+}
+
+template <unsigned... Groups>
+MAME_HASH_TARGET("sha,sse4.1")
+inline void sha1_shani_block(__m128i &abcd, __m128i (&e)[2], __m128i (&msg)[4], std::integer_sequence<unsigned, Groups...>) noexcept
+{
+	(sha1_shani_group<Groups>(abcd, e, msg), ...);
+}
+
+MAME_HASH_TARGET("sha,sse4.1")
+void sha1_blocks_shani(std::array<uint32_t, 5> &st, const uint8_t *data, size_t blocks) noexcept
+{
+	// the state is kept as E, D, C, B, A, which is the lane order SHA-NI wants
+	__m128i const swap = _mm_set_epi64x(0x0001020304050607, 0x08090a0b0c0d0e0f);
+	__m128i abcd = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&st[1]));
+	__m128i e0 = _mm_set_epi32(int(st[0]), 0, 0, 0);
+
+	for ( ; blocks; blocks--, data += 64)
+	{
+		__m128i const abcd_save = abcd;
+		__m128i const e0_save = e0;
+		__m128i msg[4];
+		for (unsigned i = 0U; i < 4U; i++)
+			msg[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + (i * 16))), swap);
+
+		__m128i e[2] = { e0, _mm_setzero_si128() };
+		sha1_shani_block(abcd, e, msg, std::make_integer_sequence<unsigned, 20>());
+		e0 = _mm_sha1nexte_epu32(e[0], e0_save);
+		abcd = _mm_add_epi32(abcd, abcd_save);
+	}
+
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(&st[1]), abcd);
+	st[0] = uint32_t(_mm_extract_epi32(e0, 3));
+}
+
+#endif // defined(MAME_HASH_X86)
+
+#if defined(MAME_HASH_ARM64)
+
+// CRC-32 with the ARMv8 CRC instructions, which use zlib's polynomial
+MAME_HASH_TARGET(MAME_HASH_ARM64_CRC)
+uint32_t crc32_armv8(uint32_t crc, const uint8_t *data, size_t length) noexcept
+{
+	crc = ~crc;
+	for ( ; length && (uintptr_t(data) & 7); data++, length--)
+		crc = __crc32b(crc, *data);
+	for ( ; length >= 8; data += 8, length -= 8)
+	{
+		uint64_t word;
+		std::memcpy(&word, data, sizeof(word));
+		crc = __crc32d(crc, word);
+	}
+	for ( ; length; data++, length--)
+		crc = __crc32b(crc, *data);
+	return ~crc;
+}
+
+// one group of four SHA-1 rounds with the ARMv8 SHA instructions; the
+// sums of message words and round constants run two groups ahead
+template <unsigned Group>
+MAME_HASH_TARGET(MAME_HASH_ARM64_SHA)
+inline void sha1_armv8_group(uint32x4_t &abcd, uint32_t (&e)[2], uint32x4_t (&msg)[4], uint32x4_t (&tmp)[2]) noexcept
+{
+	static constexpr uint32_t k[4] = { 0x5a827999U, 0x6ed9eba1U, 0x8f1bbcdcU, 0xca62c1d6U };
+
+	e[~Group & 1] = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+	if (Group < 5)
+		abcd = vsha1cq_u32(abcd, e[Group & 1], tmp[Group & 1]);
+	else if ((Group >= 10) && (Group < 15))
+		abcd = vsha1mq_u32(abcd, e[Group & 1], tmp[Group & 1]);
+	else
+		abcd = vsha1pq_u32(abcd, e[Group & 1], tmp[Group & 1]);
+	if (Group <= 17)
+		tmp[Group & 1] = vaddq_u32(msg[(Group + 2) & 3], vdupq_n_u32(k[(Group + 2) / 5]));
+	if ((Group >= 1) && (Group <= 16))
+		msg[(Group - 1) & 3] = vsha1su1q_u32(msg[(Group - 1) & 3], msg[(Group + 2) & 3]);
+	if (Group <= 15)
+		msg[Group & 3] = vsha1su0q_u32(msg[Group & 3], msg[(Group + 1) & 3], msg[(Group + 2) & 3]);
+}
+
+template <unsigned... Groups>
+MAME_HASH_TARGET(MAME_HASH_ARM64_SHA)
+inline void sha1_armv8_block(uint32x4_t &abcd, uint32_t (&e)[2], uint32x4_t (&msg)[4], uint32x4_t (&tmp)[2], std::integer_sequence<unsigned, Groups...>) noexcept
+{
+	(sha1_armv8_group<Groups>(abcd, e, msg, tmp), ...);
+}
+
+MAME_HASH_TARGET(MAME_HASH_ARM64_SHA)
+void sha1_blocks_armv8(std::array<uint32_t, 5> &st, const uint8_t *data, size_t blocks) noexcept
+{
+	// the instructions want A in the lowest lane, the reverse of the state order
+	uint32_t const initial[4] = { st[4], st[3], st[2], st[1] };
+	uint32x4_t abcd = vld1q_u32(initial);
+	uint32_t e0 = st[0];
+
+	for ( ; blocks; blocks--, data += 64)
+	{
+		uint32x4_t const abcd_save = abcd;
+		uint32_t const e0_save = e0;
+		uint32x4_t msg[4];
+		for (unsigned i = 0U; i < 4U; i++)
+			msg[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + (i * 16))));
+
+		uint32x4_t tmp[2] = { vaddq_u32(msg[0], vdupq_n_u32(0x5a827999U)), vaddq_u32(msg[1], vdupq_n_u32(0x5a827999U)) };
+		uint32_t e[2] = { e0, 0U };
+		sha1_armv8_block(abcd, e, msg, tmp, std::make_integer_sequence<unsigned, 20>());
+		e0 = e[0] + e0_save;
+		abcd = vaddq_u32(abcd, abcd_save);
+	}
+
+	uint32_t result[4];
+	vst1q_u32(result, abcd);
+	st[4] = result[0];
+	st[3] = result[1];
+	st[2] = result[2];
+	st[1] = result[3];
+	st[0] = e0;
+}
+
+#endif // defined(MAME_HASH_ARM64)
+
+
+//-------------------------------------------------
+//  select_crc32/select_sha1 - pick the fastest
+//  implementation the host supports
+//-------------------------------------------------
+
+#if defined(MAME_HASH_X86)
+void host_x86_features(bool &pclmul, bool &sha) noexcept
+{
+	// PCLMULQDQ is leaf 1 ECX bit 1; SHA is leaf 7 EBX bit 29, and needs SSSE3 and SSE4.1 (leaf 1 ECX bits 9 and 19)
+	unsigned regs[4] = { 0U, 0U, 0U, 0U };
+#if defined(_MSC_VER) && !defined(__clang__)
+	__cpuid(reinterpret_cast<int *>(regs), 0);
+	unsigned const maxleaf = regs[0];
+	regs[2] = 0U;
+	if (maxleaf >= 1)
+		__cpuid(reinterpret_cast<int *>(regs), 1);
+	unsigned const leaf1 = regs[2];
+	regs[1] = 0U;
+	if (maxleaf >= 7)
+		__cpuidex(reinterpret_cast<int *>(regs), 7, 0);
+#else
+	unsigned const maxleaf = __get_cpuid_max(0, nullptr);
+	if (maxleaf >= 1)
+		__cpuid(1, regs[0], regs[1], regs[2], regs[3]);
+	unsigned const leaf1 = regs[2];
+	regs[1] = 0U;
+	if (maxleaf >= 7)
+		__cpuid_count(7, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+	pclmul = (leaf1 >> 1) & 1;
+	sha = ((leaf1 >> 9) & 1) && ((leaf1 >> 19) & 1) && ((regs[1] >> 29) & 1);
+}
+#endif
+
+crc32_function select_crc32() noexcept
+{
+#if defined(MAME_HASH_X86)
+	bool pclmul, sha;
+	host_x86_features(pclmul, sha);
+	if (pclmul)
+		return &crc32_pclmul;
+#elif defined(MAME_HASH_ARM64)
+	if (MAME_HASH_ARM64_HAS_CRC)
+		return &crc32_armv8;
+#endif
+	return &crc32_portable;
+}
+
+sha1_function select_sha1() noexcept
+{
+#if defined(MAME_HASH_X86)
+	bool pclmul, sha;
+	host_x86_features(pclmul, sha);
+	if (sha)
+		return &sha1_blocks_shani;
+#elif defined(MAME_HASH_ARM64)
+	if (MAME_HASH_ARM64_HAS_SHA1)
+		return &sha1_blocks_armv8;
+#endif
+	return &sha1_blocks_portable;
+}
+
+// chosen on first use, so hashing during static initialisation still works
+inline crc32_function crc32_impl() noexcept
+{
+	static crc32_function const impl = select_crc32();
+	return impl;
+}
+
+inline sha1_function sha1_impl() noexcept
+{
+	static sha1_function const impl = select_sha1();
+	return impl;
+}
+
 } // anonymous namespace
 
 
@@ -188,32 +531,28 @@ void sha1_creator::reset() noexcept
 
 void sha1_creator::append(const void *data, uint32_t length) noexcept
 {
-#ifdef LSB_FIRST
-	constexpr unsigned swizzle = 3U;
-#else
-	constexpr unsigned swizzle = 0U;
-#endif
+	// the buffer holds the bytes of a partial block until it fills
+	uint8_t *const buf = reinterpret_cast<uint8_t *>(m_buf);
+	const uint8_t *src = reinterpret_cast<const uint8_t *>(data);
 	uint32_t residual = (uint32_t(m_cnt) >> 3) & 63U;
 	m_cnt += uint64_t(length) << 3;
-	uint32_t offset = 0U;
-	if (length >= (64U - residual))
+	if (residual)
+	{
+		uint32_t const count = (std::min)(64U - residual, length);
+		std::memcpy(buf + residual, src, count);
+		src += count;
+		length -= count;
+		if ((residual + count) < 64U)
+			return;
+		sha1_impl()(m_st, buf, 1U);
+	}
+	if (length >= 64U)
 	{
-		if (residual)
-		{
-			for (offset = 0U; (offset + residual) < 64U; offset++)
-				reinterpret_cast<uint8_t *>(m_buf)[(offset + residual) ^ swizzle] = reinterpret_cast<const uint8_t *>(data)[offset];
-			sha1_process(m_st, m_buf);
-		}
-		while ((length - offset) >= 64U)
-		{
-			for (residual = 0U; residual < 64U; residual++, offset++)
-				reinterpret_cast<uint8_t *>(m_buf)[residual ^ swizzle] = reinterpret_cast<const uint8_t *>(data)[offset];
-			sha1_process(m_st, m_buf);
-		}
-		residual = 0U;
+		sha1_impl()(m_st, src, length >> 6);
+		src += length & ~63U;
+		length &= 63U;
 	}
-	for ( ; offset < length; residual++, offset++)
-		reinterpret_cast<uint8_t *>(m_buf)[residual ^ swizzle] = reinterpret_cast<const uint8_t *>(data)[offset];
+	std::memcpy(buf, src, length);
 }
 
 
@@ -336,7 +675,7 @@ std::string crc32_t::as_string() const
 
 void crc32_creator::append(const void *data, uint32_t length) noexcept
 {
-	m_accum.m_raw = crc32(m_accum, reinterpret_cast<const Bytef *>(data), length);
+	m_accum.m_raw = crc32_impl()(m_accum, reinterpret_cast<const uint8_t *>(data), length);
 }
 
 
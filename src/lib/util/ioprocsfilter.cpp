@@ -14,6 +14,8 @@
 #include "ioprocsfill.h"
 
 #include <zlib.h>
+#include <zstd.h>
+#include <zstd_errors.h>
 
 #include <algorithm>
 #include <cassert>
@@ -657,6 +659,227 @@ private:
 	}
 };
 
+
+
+// helper for converting Zstandard errors
+
+std::error_condition convert_zstd_error(std::size_t result) noexcept
+{
+	if (!ZSTD_isError(result))
+		return std::error_condition();
+	switch (ZSTD_getErrorCode(result))
+	{
+	case ZSTD_error_memory_allocation:
+		return std::errc::not_enough_memory;
+	default:
+		return std::errc::invalid_argument; // TODO: revisit this error code
+	}
+}
+
+
+// filter for decompressing Zstandard data
+
+template <typename Stream>
+class zstd_read_filter : public read_stream, protected filter_base<Stream>
+{
+public:
+	zstd_read_filter(std::unique_ptr<Stream> &&stream, std::size_t read_chunk) noexcept :
+		filter_base<Stream>(std::move(stream)),
+		m_buffer_size(read_chunk)
+	{
+		assert(read_chunk);
+	}
+
+	zstd_read_filter(Stream &stream, std::size_t read_chunk) noexcept :
+		filter_base<Stream>(stream),
+		m_buffer_size(read_chunk)
+	{
+		assert(read_chunk);
+	}
+
+	~zstd_read_filter()
+	{
+		if (m_stream)
+			ZSTD_freeDStream(m_stream);
+	}
+
+	virtual std::error_condition read(void *buffer, std::size_t length, std::size_t &actual) noexcept override
+	{
+		actual = 0U;
+
+		if (!m_stream)
+		{
+			if (!m_buffer)
+				m_buffer.reset(new (std::nothrow) std::uint8_t [m_buffer_size]);
+			m_stream = ZSTD_createDStream();
+			if (!m_buffer || !m_stream)
+				return std::errc::not_enough_memory;
+			m_input = ZSTD_inBuffer{ m_buffer.get(), 0U, 0U };
+		}
+
+		ZSTD_outBuffer output{ buffer, length, 0U };
+		while (output.size > output.pos)
+		{
+			if (m_input.size == m_input.pos)
+			{
+				std::size_t filled;
+				std::error_condition err = this->object().read(m_buffer.get(), m_buffer_size, filled);
+				m_input = ZSTD_inBuffer{ m_buffer.get(), filled, 0U };
+				if (err || !filled)
+				{
+					actual = output.pos;
+					return err;
+				}
+			}
+
+			std::size_t const result = ZSTD_decompressStream(m_stream, &output, &m_input);
+			actual = output.pos;
+			if (ZSTD_isError(result))
+				return convert_zstd_error(result);
+
+			if (!result)
+			{
+				// end of the frame, don't consume any input beyond it
+				if constexpr (std::is_base_of_v<random_read, Stream>)
+				{
+					if (m_input.size > m_input.pos)
+					{
+						std::int64_t const overshoot = std::uint64_t(m_input.size - m_input.pos);
+						m_input = ZSTD_inBuffer{ m_buffer.get(), 0U, 0U };
+						return this->object().seek(-overshoot, SEEK_CUR);
+					}
+				}
+				return std::error_condition();
+			}
+		}
+
+		return std::error_condition();
+	}
+
+private:
+	std::size_t const m_buffer_size;
+	std::unique_ptr<std::uint8_t []> m_buffer;
+	ZSTD_DStream *m_stream = nullptr;
+	ZSTD_inBuffer m_input{ nullptr, 0U, 0U };
+};
+
+
+// filter for compressing data with Zstandard
+
+class zstd_write_filter : public write_stream, protected filter_base<write_stream>
+{
+public:
+	zstd_write_filter(write_stream::ptr &&stream, int level, std::size_t buffer_size) noexcept :
+		filter_base<write_stream>(std::move(stream)),
+		m_level(level),
+		m_buffer_size(buffer_size)
+	{
+		assert(buffer_size);
+	}
+
+	zstd_write_filter(write_stream &stream, int level, std::size_t buffer_size) noexcept :
+		filter_base<write_stream>(stream),
+		m_level(level),
+		m_buffer_size(buffer_size)
+	{
+		assert(buffer_size);
+	}
+
+	~zstd_write_filter()
+	{
+		finalize();
+		if (m_stream)
+			ZSTD_freeCStream(m_stream);
+	}
+
+	virtual std::error_condition finalize() noexcept override
+	{
+		if (!m_started)
+			return std::error_condition();
+
+		ZSTD_inBuffer input{ nullptr, 0U, 0U };
+		std::size_t remaining;
+		do
+		{
+			ZSTD_outBuffer output{ m_buffer.get(), m_buffer_size, 0U };
+			remaining = ZSTD_compressStream2(m_stream, &output, &input, ZSTD_e_end);
+			std::error_condition err = convert_zstd_error(remaining);
+			if (!err)
+				err = write_output(output.pos);
+			if (err)
+				return err;
+		}
+		while (remaining);
+
+		m_started = false;
+		return std::error_condition();
+	}
+
+	virtual std::error_condition flush() noexcept override
+	{
+		return object().flush();
+	}
+
+	virtual std::error_condition write(void const *buffer, std::size_t length, std::size_t &actual) noexcept override
+	{
+		actual = 0U;
+
+		if (!m_started)
+		{
+			if (!m_stream)
+			{
+				m_buffer.reset(new (std::nothrow) std::uint8_t [m_buffer_size]);
+				m_stream = ZSTD_createCStream();
+				if (!m_buffer || !m_stream)
+					return std::errc::not_enough_memory;
+			}
+			std::error_condition err = convert_zstd_error(ZSTD_CCtx_reset(m_stream, ZSTD_reset_session_only));
+			if (!err)
+				err = convert_zstd_error(ZSTD_CCtx_setParameter(m_stream, ZSTD_c_compressionLevel, m_level));
+			if (err)
+				return err;
+			m_started = true;
+		}
+
+		ZSTD_inBuffer input{ buffer, length, 0U };
+		while (input.size > input.pos)
+		{
+			ZSTD_outBuffer output{ m_buffer.get(), m_buffer_size, 0U };
+			std::size_t const result = ZSTD_compressStream2(m_stream, &output, &input, ZSTD_e_continue);
+			actual = input.pos;
+			std::error_condition err = convert_zstd_error(result);
+			if (!err)
+				err = write_output(output.pos);
+			if (err)
+				return err;
+		}
+
+		return std::error_condition();
+	}
+
+private:
+	std::error_condition write_output(std::size_t length) noexcept
+	{
+		std::uint8_t const *data = m_buffer.get();
+		while (length)
+		{
+			std::size_t written;
+			std::error_condition err = object().write(data, length, written);
+			if (err)
+				return err;
+			data += written;
+			length -= written;
+		}
+		return std::error_condition();
+	}
+
+	int const m_level;
+	std::size_t const m_buffer_size;
+	std::unique_ptr<std::uint8_t []> m_buffer;
+	ZSTD_CStream *m_stream = nullptr;
+	bool m_started = false;
+};
+
 } // anonymous namespace
 
 
@@ -789,4 +1012,49 @@ write_stream::ptr zlib_write(write_stream &stream, int level, std::size_t buffer
 	return write_stream::ptr(new (std::nothrow) zlib_write_filter(stream, level, buffer_size));
 }
 
+
+// creating Zstandard decompressing filters
+
+read_stream::ptr zstd_read(read_stream::ptr &&stream, std::size_t read_chunk) noexcept
+{
+	read_stream::ptr result;
+	if (stream)
+		result.reset(new (std::nothrow) zstd_read_filter<read_stream>(std::move(stream), read_chunk));
+	return result;
+}
+
+read_stream::ptr zstd_read(random_read::ptr &&stream, std::size_t read_chunk) noexcept
+{
+	read_stream::ptr result;
+	if (stream)
+		result.reset(new (std::nothrow) zstd_read_filter<random_read>(std::move(stream), read_chunk));
+	return result;
+}
+
+read_stream::ptr zstd_read(read_stream &stream, std::size_t read_chunk) noexcept
+{
+	return read_stream::ptr(new (std::nothrow) zstd_read_filter<read_stream>(stream, read_chunk));
+}
+
+read_stream::ptr zstd_read(random_read &stream, std::size_t read_chunk) noexcept
+{
+	return read_stream::ptr(new (std::nothrow) zstd_read_filter<random_read>(stream, read_chunk));
+}
+
+
+// creating Zstandard compressing filters
+
+write_stream::ptr zstd_write(write_stream::ptr &&stream, int level, std::size_t buffer_size) noexcept
+{
+	write_stream::ptr result;
+	if (stream)
+		result.reset(new (std::nothrow) zstd_write_filter(std::move(stream), level, buffer_size));
+	return result;
+}
+
+write_stream::ptr zstd_write(write_stream &stream, int level, std::size_t buffer_size) noexcept
+{
+	return write_stream::ptr(new (std::nothrow) zstd_write_filter(stream, level, buffer_size));
+}
+
 } // namespace util
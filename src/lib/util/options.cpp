@@ -14,6 +14,7 @@
 #include "corestr.h"
 #include "osdcore.h"
 
+#include <charconv>
 #include <locale>
 #include <string>
 
@@ -603,6 +604,7 @@ const char *core_options::simple_entry::maximum() const noexcept
 //-------------------------------------------------
 
 core_options::core_options()
+	: m_entrymap_used(0)
 {
 }
 
@@ -622,30 +624,75 @@ core_options::~core_options()
 
 void core_options::add_entry(entry::shared_ptr &&entry, const char *after_header)
 {
-	// update the entry map
-	for (const std::string &name : entry->names())
+	// add the entry to the vector
+	std::size_t const index = m_entries.size();
+	m_entries.emplace_back(std::move(entry));
+
+	// and update the entry map, keeping it at most half full so probe
+	// sequences stay short; rebuilding it picks up the new names too
+	std::size_t const count = m_entries[index]->names().size();
+	if (((m_entrymap_used + count) * 2) > m_entrymap.size())
 	{
-		// append the entry
-		add_to_entry_map(name, entry);
+		std::size_t capacity = std::max<std::size_t>(m_entrymap.size(), 64);
+		while (((m_entrymap_used + count) * 2) > capacity)
+			capacity *= 2;
+		rebuild_entry_map(capacity);
+	}
+	else
+	{
+		for (const std::string &name : m_entries[index]->names())
+			add_to_entry_map(name, index);
 	}
-
-	// and add the entry to the vector
-	m_entries.emplace_back(std::move(entry));
 }
 
 
 //-------------------------------------------------
-//  add_to_entry_map - adds an entry to the entry
+//  add_to_entry_map - adds a name to the entry
 //  map
 //-------------------------------------------------
 
-void core_options::add_to_entry_map(const std::string &name, entry::shared_ptr &entry)
+void core_options::add_to_entry_map(std::string_view name, std::size_t index)
 {
 	// it is illegal to call this method for something that already exists
-	assert(m_entrymap.find(name) == m_entrymap.end());
+	key const k(name);
+	assert(find_entry(k) == NO_ENTRY);
+	assert(((m_entrymap_used + 1) * 2) <= m_entrymap.size());
+
+	std::size_t const mask = m_entrymap.size() - 1;
+	std::size_t slot = k.hash() & mask;
+	while (m_entrymap[slot].index != NO_ENTRY)
+		slot = (slot + 1) & mask;
+	m_entrymap[slot] = entry_slot{ name, k.hash(), index };
+	m_entrymap_used++;
+}
+
 
-	// append the entry
-	m_entrymap.emplace(std::make_pair(std::string_view(name), entry::weak_ptr(entry)));
+//-------------------------------------------------
+//  rebuild_entry_map - fill in a table of the
+//  given size, a power of two, with the names of
+//  all the entries
+//-------------------------------------------------
+
+void core_options::rebuild_entry_map(std::size_t capacity)
+{
+	assert(!(capacity & (capacity - 1)));
+	m_entrymap.assign(capacity, entry_slot{ std::string_view(), 0, NO_ENTRY });
+	m_entrymap_used = 0;
+
+	std::size_t const mask = capacity - 1;
+	for (std::size_t index = 0; index < m_entries.size(); index++)
+	{
+		for (const std::string &name : m_entries[index]->names())
+		{
+			std::size_t const hash = key::hash_name(name);
+			std::size_t slot = hash & mask;
+			while (m_entrymap[slot].index != NO_ENTRY)
+				slot = (slot + 1) & mask;
+			m_entrymap[slot] = entry_slot{ name, hash, index };
+			m_entrymap_used++;
+		}
+	}
+	assert((m_entrymap_used * 2) <= capacity);
 }
 
 
@@ -902,52 +949,48 @@ void core_options::parse_ini_file(util::core_file &inifile, int priority, bool i
 	std::ostringstream error_stream;
 	condition_type condition = condition_type::NONE;
 
-	// loop over lines in the file
+	// loop over lines in the file; the name and data are views into the line buffer
 	char buffer[4096];
 	while (inifile.gets(buffer, std::size(buffer)) != nullptr)
 	{
+		std::string_view const line(buffer);
+
 		// find the extent of the name
-		char *optionname;
-		for (optionname = buffer; *optionname != 0; optionname++)
-			if (!isspace((uint8_t)*optionname))
-				break;
+		std::string_view::size_type const namestart = std::find_if_not(line.begin(), line.end(), [] (char ch) { return isspace(uint8_t(ch)); }) - line.begin();
 
 		// skip comments
-		if (*optionname == 0 || *optionname == '#')
+		if (namestart == line.length() || line[namestart] == '#')
 			continue;
 
 		// scan forward to find the first space
-		char *temp;
-		for (temp = optionname; *temp != 0; temp++)
-			if (isspace((uint8_t)*temp))
-				break;
+		std::string_view::size_type const nameend = std::find_if(line.begin() + namestart, line.end(), [] (char ch) { return isspace(uint8_t(ch)); }) - line.begin();
 
 		// if we hit the end early, print a warning and continue
-		if (*temp == 0)
+		if (nameend == line.length())
 		{
 			condition = std::max(condition, condition_type::WARN);
-			util::stream_format(error_stream, "Warning: invalid line in INI: %s", buffer);
+			util::stream_format(error_stream, "Warning: invalid line in INI: %s", line);
 			continue;
 		}
-
-		// NULL-terminate
-		*temp++ = 0;
-		char *optiondata = temp;
+		std::string_view const optionname = line.substr(namestart, nameend - namestart);
 
 		// scan the data, stopping when we hit a comment
+		std::string_view optiondata = line.substr(nameend + 1);
 		bool inquotes = false;
-		for (temp = optiondata; *temp != 0; temp++)
+		for (std::string_view::size_type pos = 0; pos < optiondata.length(); pos++)
 		{
-			if (*temp == '"')
+			if (optiondata[pos] == '"')
 				inquotes = !inquotes;
-			if (*temp == '#' && !inquotes)
+			if (optiondata[pos] == '#' && !inquotes)
+			{
+				optiondata = optiondata.substr(0, pos);
 				break;
+			}
 		}
-		*temp = 0;
 
 		// find our entry
-		entry::shared_ptr curentry = get_entry(optionname);
-		if (!curentry)
+		std::size_t const index = find_entry(optionname);
+		if (index == NO_ENTRY)
 		{
 			if (!ignore_unknown_options)
 			{
@@ -958,7 +1001,7 @@ void core_options::parse_ini_file(util::core_file &inifile, int priority, bool i
 		}
 
 		// set the new data
-		do_set_value(*curentry, trim_spaces_and_quotes(optiondata), priority, error_stream, condition, true);
+		do_set_value(*m_entries[index], trim_spaces_and_quotes(optiondata), priority, error_stream, condition, true);
 	}
 
 	// did we have any errors that may need to be aggregated?
@@ -1110,10 +1153,10 @@ std::string core_options::output_help() const
 //  value - return the raw option value
 //-------------------------------------------------
 
-const char *core_options::value(std::string_view option) const noexcept
+const char *core_options::value(const key &option) const noexcept
 {
-	auto const entry = get_entry(option);
-	return entry ? entry->value() : nullptr;
+	std::size_t const index = find_entry(option);
+	return (index != NO_ENTRY) ? m_entries[index]->value() : nullptr;
 }
 
 
@@ -1121,10 +1164,10 @@ const char *core_options::value(std::string_view option) const noexcept
 //  description - return description of option
 //-------------------------------------------------
 
-const char *core_options::description(std::string_view option) const noexcept
+const char *core_options::description(const key &option) const noexcept
 {
-	auto const entry = get_entry(option);
-	return entry ? entry->description() : nullptr;
+	std::size_t const index = find_entry(option);
+	return (index != NO_ENTRY) ? m_entries[index]->description() : nullptr;
 }
 
 
@@ -1132,18 +1175,20 @@ const char *core_options::description(std::string_view option) const noexcept
 //  value - return the option value as an integer
 //-------------------------------------------------
 
-int core_options::int_value(std::string_view option) const
+int core_options::int_value(const key &option) const
 {
 	char const *const data = value(option);
 	if (!data)
 		return 0;
-	std::istringstream str(data);
-	str.imbue(std::locale::classic());
+
+	// same as reading it from a stream in the classic locale, without the stream
+	std::string_view str(data);
+	str.remove_prefix(std::find_if_not(str.begin(), str.end(), [] (char ch) { return isspace(uint8_t(ch)); }) - str.begin());
+	if ((str.length() > 1) && (str[0] == '+') && (str[1] != '-'))
+		str.remove_prefix(1);
 	int ival;
-	if (str >> ival)
-		return ival;
-	else
-		return 0;
+	auto const result = std::from_chars(str.data(), str.data() + str.length(), ival);
+	return (result.ec == std::errc()) ? ival : 0;
 }
 
 
@@ -1151,7 +1196,7 @@ int core_options::int_value(std::string_view option) const
 //  value - return the option value as a float
 //-------------------------------------------------
 
-float core_options::float_value(std::string_view option) const
+float core_options::float_value(const key &option) const
 {
 	char const *const data = value(option);
 	if (!data)
@@ -1216,12 +1261,9 @@ void core_options::remove_entry(core_options::entry &delentry)
 			[&delentry](const auto &x) { return &*x == &delentry; });
 	assert(iter != m_entries.end());
 
-	// erase each of the items out of the entry map
-	for (const std::string &name : delentry.names())
-		m_entrymap.erase(name);
-
-	// finally erase it
+	// erase it, and rebuild the entry map since the later entries have moved
 	m_entries.erase(iter);
+	rebuild_entry_map(m_entrymap.size());
 }
 
 
@@ -1256,16 +1298,38 @@ void core_options::do_set_value(entry &curentry, std::string_view data, int prio
 //  get_entry
 //-------------------------------------------------
 
-core_options::entry::shared_const_ptr core_options::get_entry(std::string_view name) const noexcept
+core_options::entry::shared_const_ptr core_options::get_entry(const key &name) const noexcept
 {
-	auto curentry = m_entrymap.find(name);
-	return (curentry != m_entrymap.end()) ? curentry->second.lock() : nullptr;
+	std::size_t const index = find_entry(name);
+	return (index != NO_ENTRY) ? m_entries[index] : nullptr;
 }
 
-core_options::entry::shared_ptr core_options::get_entry(std::string_view name) noexcept
+core_options::entry::shared_ptr core_options::get_entry(const key &name) noexcept
 {
-	auto curentry = m_entrymap.find(name);
-	return (curentry != m_entrymap.end()) ? curentry->second.lock() : nullptr;
+	std::size_t const index = find_entry(name);
+	return (index != NO_ENTRY) ? m_entries[index] : nullptr;
+}
+
+
+//-------------------------------------------------
+//  find_entry - look a name up in the entry map,
+//  returning the index of its entry
+//-------------------------------------------------
+
+std::size_t core_options::find_entry(const key &name) const noexcept
+{
+	if (m_entrymap.empty())
+		return NO_ENTRY;
+
+	std::size_t const mask = m_entrymap.size() - 1;
+	for (std::size_t slot = name.hash() & mask; ; slot = (slot + 1) & mask)
+	{
+		entry_slot const &cur = m_entrymap[slot];
+		if (cur.index == NO_ENTRY)
+			return NO_ENTRY;
+		else if ((cur.hash == name.hash()) && (cur.name == name.name()))
+			return cur.index;
+	}
 }
 
 
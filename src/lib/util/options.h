@@ -15,11 +15,12 @@
 #include "utilfwd.h"
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <iosfwd>
 #include <memory>
-#include <unordered_map>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -109,6 +110,32 @@ public:
 		MULTIPATH        // semicolon-delimited paths option
 	};
 
+	// an option name along with its hash; declare one constexpr to have
+	// the hash worked out at compile time
+	class key
+	{
+	public:
+		constexpr key(const char *name) noexcept : key(std::string_view(name)) { }
+		constexpr key(std::string_view name) noexcept : m_name(name), m_hash(hash_name(name)) { }
+		key(const std::string &name) noexcept : key(std::string_view(name)) { }
+
+		constexpr std::string_view name() const noexcept { return m_name; }
+		constexpr std::size_t hash() const noexcept { return m_hash; }
+
+		static constexpr std::size_t hash_name(std::string_view name) noexcept
+		{
+			// FNV-1a
+			std::size_t result = std::size_t(0xcbf29ce484222325ULL);
+			for (char ch : name)
+				result = (result ^ std::uint8_t(ch)) * std::size_t(0x100000001b3ULL);
+			return result;
+		}
+
+	private:
+		std::string_view    m_name;
+		std::size_t         m_hash;
+	};
+
 	// information about a single entry in the options
 	class entry
 	{
@@ -173,10 +200,10 @@ public:
 	// getters
 	const std::string &command() const noexcept { return m_command; }
 	const std::vector<std::string> &command_arguments() const noexcept { assert(!m_command.empty()); return m_command_arguments; }
-	entry::shared_const_ptr get_entry(std::string_view name) const noexcept;
-	entry::shared_ptr get_entry(std::string_view name) noexcept;
+	entry::shared_const_ptr get_entry(const key &name) const noexcept;
+	entry::shared_ptr get_entry(const key &name) noexcept;
 	const std::vector<entry::shared_ptr> &entries() const noexcept { return m_entries; }
-	bool exists(std::string_view name) const noexcept { return get_entry(name) != nullptr; }
+	bool exists(const key &name) const noexcept { return find_entry(name) != NO_ENTRY; }
 	bool header_exists(const char *description) const noexcept;
 
 	// configuration
@@ -203,11 +230,11 @@ public:
 	std::string output_help() const;
 
 	// reading
-	const char *value(std::string_view option) const noexcept;
-	const char *description(std::string_view option) const noexcept;
-	bool bool_value(std::string_view option) const { return int_value(option) != 0; }
-	int int_value(std::string_view option) const;
-	float float_value(std::string_view option) const;
+	const char *value(const key &option) const noexcept;
+	const char *description(const key &option) const noexcept;
+	bool bool_value(const key &option) const { return int_value(option) != 0; }
+	int int_value(const key &option) const;
+	float float_value(const key &option) const;
 
 	// setting
 	void set_value(std::string_view name, std::string_view value, int priority);
@@ -268,14 +295,27 @@ private:
 		ERR
 	};
 
+	// a name in the lookup table, and the index of its entry
+	struct entry_slot
+	{
+		std::string_view    name;
+		std::size_t         hash;
+		std::size_t         index;
+	};
+
+	static constexpr std::size_t NO_ENTRY = ~std::size_t(0);
+
 	// internal helpers
-	void add_to_entry_map(const std::string &name, entry::shared_ptr &entry);
+	std::size_t find_entry(const key &name) const noexcept;
+	void add_to_entry_map(std::string_view name, std::size_t index);
+	void rebuild_entry_map(std::size_t capacity);
 	void do_set_value(entry &curentry, std::string_view data, int priority, std::ostream &error_stream, condition_type &condition, bool perform_substitutions);
 	void throw_options_exception_if_appropriate(condition_type condition, std::ostringstream &error_stream);
 
 	// internal state
 	std::vector<entry::shared_ptr>                      m_entries;              // canonical list of entries
-	std::unordered_map<std::string_view, entry::weak_ptr> m_entrymap;           // map for fast lookup
+	std::vector<entry_slot>                             m_entrymap;             // open-addressed table of names, for fast lookup
+	std::size_t                                         m_entrymap_used;        // names in the table
 	std::string                                         m_command;              // command found
 	std::vector<std::string>                            m_command_arguments;    // command arguments
 	static const char *const                            s_option_unadorned[];   // array of unadorned option "names"
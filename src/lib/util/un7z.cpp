@@ -29,10 +29,12 @@
 #include <array>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
+#include <memory>
 #include <mutex>
 #include <ratio>
 #include <utility>
@@ -166,8 +168,13 @@ public:
 	static void cache_clear() noexcept
 	{
 		// clear call cache entries
-		std::lock_guard<std::mutex> guard(s_cache_mutex);
-		for (auto &cached : s_cache)
+		{
+			std::lock_guard<std::mutex> guard(s_cache_mutex);
+			for (auto &cached : s_cache)
+				cached.reset();
+		}
+		std::lock_guard<std::mutex> guard(s_block_mutex);
+		for (auto &cached : s_blocks)
 			cached.reset();
 	}
 
@@ -219,6 +226,30 @@ private:
 			bool matchcrc,
 			bool matchname,
 			bool partialpath) noexcept;
+	// a decoded solid block shared by every open instance of an archive
+	struct solid_block
+	{
+		solid_block(std::string const &f, std::uint64_t l, UInt32 i) : filename(f), length(l), index(i) { }
+		~solid_block()
+		{
+			ISzAlloc const alloc{ &SzAlloc, &SzFree };
+			if (data)
+				ISzAlloc_Free(&alloc, data);
+		}
+
+		std::string const       filename;           // archive the block came from
+		std::uint64_t const     length;             // archive length, in case it was replaced
+		UInt32 const            index;              // solid block (folder) index
+		std::mutex              mutex;
+		std::condition_variable cond;               // signalled when decoding finishes
+		bool                    done = false;       // decoding finished
+		SRes                    result = SZ_OK;     // decoding result
+		Byte *                  data = nullptr;     // decoded data (allocated with SzAlloc)
+		std::size_t             size = 0;           // decoded size
+	};
+
+	std::error_condition decompress_shared(void *buffer, std::size_t length, UInt32 folder) noexcept;
+	static std::error_condition extract_error(SRes res) noexcept;
 	void make_utf8_name(int index);
 	void set_curr_modified() noexcept;
 
@@ -226,6 +257,12 @@ private:
 	static std::array<ptr, CACHE_SIZE>      s_cache;
 	static std::mutex                       s_cache_mutex;
 
+	// the most recent block of each of a few archives, within a total budget
+	static constexpr std::size_t            BLOCK_CACHE_SIZE = 8;
+	static constexpr std::size_t            BLOCK_CACHE_BYTES = 256 * 1024 * 1024;
+	static std::array<std::shared_ptr<solid_block>, BLOCK_CACHE_SIZE> s_blocks;
+	static std::mutex                       s_block_mutex;
+
 	const std::string                       m_filename;             // copy of _7Z filename (for caching)
 
 	int                                     m_curr_file_idx;        // current file index
@@ -246,7 +283,7 @@ private:
 	ISzAlloc                                m_alloc_temp_imp;
 	bool                                    m_inited;
 
-	// cached stuff for solid blocks
+	// cached stuff for solid blocks when there's no filename to share them by
 	UInt32                                  m_block_index;
 	Byte *                                  m_out_buffer;
 	std::size_t                             m_out_buffer_size;
@@ -296,6 +333,8 @@ private:
 
 std::array<m7z_file_impl::ptr, m7z_file_impl::CACHE_SIZE> m7z_file_impl::s_cache;
 std::mutex m7z_file_impl::s_cache_mutex;
+std::array<std::shared_ptr<m7z_file_impl::solid_block>, m7z_file_impl::BLOCK_CACHE_SIZE> m7z_file_impl::s_blocks;
+std::mutex m7z_file_impl::s_block_mutex;
 
 
 
@@ -468,6 +507,11 @@ std::error_condition m7z_file_impl::decompress(void *buffer, std::size_t length)
 		osd_printf_verbose("un7z: reopened archive file %s\n", m_filename);
 	}
 
+	// blocks of named archives are shared, so members read by different instances only decode them once
+	UInt32 const folder(m_db.FileToFolder[m_curr_file_idx]);
+	if (!m_filename.empty() && (UInt32(-1) != folder))
+		return decompress_shared(buffer, length, folder);
+
 	std::size_t offset(0);
 	std::size_t out_size_processed(0);
 	SRes const res = SzArEx_Extract(
@@ -478,21 +522,148 @@ std::error_condition m7z_file_impl::decompress(void *buffer, std::size_t length)
 	if (res != SZ_OK)
 	{
 		osd_printf_error("un7z: error decompressing %s from %s (%d)\n", m_curr_name, m_filename, int(res));
-		switch (res)
+		return extract_error(res);
+	}
+
+	// copy to destination buffer
+	std::memcpy(buffer, m_out_buffer + offset, (std::min<std::size_t>)(length, out_size_processed));
+	return std::error_condition();
+}
+
+
+/*-------------------------------------------------
+    decompress_shared - decompress a file using
+    the shared solid block cache, decoding the
+    block only if nobody else has or is
+-------------------------------------------------*/
+
+std::error_condition m7z_file_impl::decompress_shared(void *buffer, std::size_t length, UInt32 folder) noexcept
+{
+	// find the block, or claim the job of decoding it
+	std::shared_ptr<solid_block> block;
+	bool decode(false);
+	{
+		std::lock_guard<std::mutex> guard(s_block_mutex);
+		std::size_t found;
+		for (found = 0; found < s_blocks.size(); found++)
 		{
-		case SZ_ERROR_UNSUPPORTED:  return archive_file::error::UNSUPPORTED;
-		case SZ_ERROR_MEM:          return std::errc::not_enough_memory;
-		case SZ_ERROR_INPUT_EOF:    return archive_file::error::FILE_TRUNCATED;
-		default:                    return archive_file::error::DECOMPRESS_ERROR;
+			if (s_blocks[found] && (s_blocks[found]->filename == m_filename) && (s_blocks[found]->length == m_archive_stream.length) && (s_blocks[found]->index == folder))
+				break;
+		}
+		if (s_blocks.size() != found)
+		{
+			block = s_blocks[found];
+		}
+		else
+		{
+			try { block = std::make_shared<solid_block>(m_filename, m_archive_stream.length, folder); }
+			catch (...) { return std::errc::not_enough_memory; }
+			decode = true;
+
+			// only keep one block per archive, and drop the oldest if there's no room
+			for (found = 0; found < s_blocks.size(); found++)
+			{
+				if (!s_blocks[found] || (s_blocks[found]->filename == m_filename))
+					break;
+			}
+			if (s_blocks.size() == found)
+				found--;
+			s_blocks[found].reset();
+		}
+
+		// move it to the top
+		for ( ; found > 0; found--)
+			s_blocks[found] = std::move(s_blocks[found - 1]);
+		s_blocks[0] = block;
+	}
+
+	if (decode)
+	{
+		// decode outside the lock, so other archives aren't held up
+		UInt32 index(UInt32(-1));
+		Byte *data(nullptr);
+		std::size_t size(0), offset(0), processed(0);
+		SRes const res = SzArEx_Extract(
+				&m_db, &m_look_stream.vt, m_curr_file_idx,
+				&index, &data, &size,
+				&offset, &processed,
+				&m_alloc_imp, &m_alloc_temp_imp);
+		{
+			std::lock_guard<std::mutex> guard(block->mutex);
+			block->result = res;
+			block->data = data;
+			block->size = size;
+			block->done = true;
+		}
+		block->cond.notify_all();
+
+		// drop failed or oversized blocks, and older ones that won't fit in the budget
+		std::lock_guard<std::mutex> guard(s_block_mutex);
+		bool const keep((SZ_OK == res) && (size <= BLOCK_CACHE_BYTES));
+		std::size_t total(keep ? size : 0);
+		for (auto &cached : s_blocks)
+		{
+			if (cached == block)
+			{
+				if (!keep)
+					cached.reset();
+			}
+			else if (cached)
+			{
+				std::size_t cachedsize;
+				{
+					std::lock_guard<std::mutex> blockguard(cached->mutex);
+					cachedsize = cached->size;
+				}
+				if ((total + cachedsize) <= BLOCK_CACHE_BYTES)
+					total += cachedsize;
+				else
+					cached.reset();
+			}
 		}
 	}
+	else
+	{
+		// somebody else may still be decoding it
+		std::unique_lock<std::mutex> lock(block->mutex);
+		block->cond.wait(lock, [&block] () { return block->done; });
+	}
+
+	if (SZ_OK != block->result)
+	{
+		osd_printf_error("un7z: error decompressing %s from %s (%d)\n", m_curr_name, m_filename, int(block->result));
+		return extract_error(block->result);
+	}
+
+	// check the member as SzArEx_Extract would, since it may have decoded the block for another one
+	UInt64 const start(m_db.UnpackPositions[m_db.FolderToFile[folder]]);
+	std::size_t const offset(std::size_t(m_db.UnpackPositions[m_curr_file_idx] - start));
+	std::size_t const size(std::size_t(SzArEx_GetFileSize(&m_db, m_curr_file_idx)));
+	if ((offset > block->size) || (size > (block->size - offset)) ||
+			(SzBitWithVals_Check(&m_db.CRCs, m_curr_file_idx) && (CrcCalc(block->data + offset, size) != m_db.CRCs.Vals[m_curr_file_idx])))
+	{
+		osd_printf_error("un7z: error decompressing %s from %s (%d)\n", m_curr_name, m_filename, int(SZ_ERROR_CRC));
+		return archive_file::error::DECOMPRESS_ERROR;
+	}
 
 	// copy to destination buffer
-	std::memcpy(buffer, m_out_buffer + offset, (std::min<std::size_t>)(length, out_size_processed));
+	std::memcpy(buffer, block->data + offset, (std::min<std::size_t>)(length, size));
 	return std::error_condition();
 }
 
 
+std::error_condition m7z_file_impl::extract_error(SRes res) noexcept
+{
+	switch (res)
+	{
+	case SZ_ERROR_UNSUPPORTED:  return archive_file::error::UNSUPPORTED;
+	case SZ_ERROR_MEM:          return std::errc::not_enough_memory;
+	case SZ_ERROR_INPUT_EOF:    return archive_file::error::FILE_TRUNCATED;
+	default:                    return archive_file::error::DECOMPRESS_ERROR;
+	}
+}
+
+
 int m7z_file_impl::search(
 		int i,
 		std::uint32_t search_crc,
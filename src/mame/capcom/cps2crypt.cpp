@@ -117,8 +117,14 @@ the decryption keys.
 
 #include "cpu/m68000/m68000.h"
 
+#include "emuopts.h"
 #include "ui/uimain.h"
 
+#include "hashing.h"
+#include "path.h"
+
+#include <cstdio>
+
 
 namespace {
 
@@ -629,10 +635,9 @@ void optimise_sboxes(optimised_sbox* out, const sbox* in)
 		out[box].optimise(in[box]);
 }
 
-} // anonymous namespace
 
 
-void cps2_decrypt(running_machine &machine, uint16_t *rom, uint16_t *dec, int length, const uint32_t *master_key, uint32_t lower_limit, uint32_t upper_limit)
+void decrypt_opcodes(running_machine &machine, uint16_t *rom, uint16_t *dec, int length, const uint32_t *master_key, uint32_t lower_limit, uint32_t upper_limit)
 {
 	optimised_sbox sboxes1[4*4];
 	optimise_sboxes(&sboxes1[0*4], fn1_r1_boxes);
@@ -711,3 +716,61 @@ void cps2_decrypt(running_machine &machine, uint16_t *rom, uint16_t *dec, int le
 		}
 	}
 }
+
+
+
+// the decrypted copy depends on nothing but the ROM contents, key and limits
+std::string cache_key(const uint16_t *rom, int length, const uint32_t *master_key, uint32_t lower_limit, uint32_t upper_limit)
+{
+	uint32_t const params[] = { master_key[0], master_key[1], lower_limit, upper_limit, uint32_t(length) };
+	util::sha1_creator sha1;
+	sha1.append(rom, length);
+	sha1.append(params, sizeof(params));
+	return sha1.finish().as_string();
+}
+
+} // anonymous namespace
+
+
+void cps2_decrypt(running_machine &machine, uint16_t *rom, uint16_t *dec, int length, const uint32_t *master_key, uint32_t lower_limit, uint32_t upper_limit)
+{
+	char const *const cachedir = machine.options().decrypt_cache();
+	if (!cachedir || !*cachedir)
+	{
+		decrypt_opcodes(machine, rom, dec, length, master_key, lower_limit, upper_limit);
+		return;
+	}
+
+	// use a previously decrypted copy if there is one
+	std::string const cachepath = util::path_concat(cachedir, "cps2-" + cache_key(rom, length, master_key, lower_limit, upper_limit) + ".dec");
+	util::core_file::ptr cachefile;
+	if (!util::core_file::open(cachepath, OPEN_FLAG_READ, cachefile))
+	{
+		size_t actual;
+		uint64_t size;
+		if (!cachefile->length(size) && (size == uint64_t(length)) && !cachefile->read(dec, length, actual) && (actual == size_t(length)))
+			return;
+		cachefile.reset();
+	}
+
+	decrypt_opcodes(machine, rom, dec, length, master_key, lower_limit, upper_limit);
+
+	// write a temporary file and rename it into place so readers never see half of it
+	std::string const temppath = cachepath + ".new";
+	if (!util::core_file::open(temppath, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, cachefile))
+	{
+		size_t actual;
+		std::error_condition const err = cachefile->write(dec, length, actual);
+		cachefile.reset();
+		if (err || (actual != size_t(length)))
+		{
+			osd_file::remove(temppath);
+		}
+		else if (std::rename(temppath.c_str(), cachepath.c_str()))
+		{
+			osd_file::remove(cachepath);
+			if (std::rename(temppath.c_str(), cachepath.c_str()))
+				osd_file::remove(temppath);
+		}
+	}
+}
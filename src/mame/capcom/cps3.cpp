@@ -1100,43 +1100,13 @@ void cps3_state::draw_fg_layer(screen_device &screen, bitmap_rgb32 &bitmap, cons
 	}
 }
 
-u32 cps3_state::screen_update(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
+// walk the display list captured by the last sprite DMA, and bin every
+// tile and tilemap line it draws by the render buffer rows it covers
+void cps3_state::build_sprite_bins()
 {
-	int width = ((m_ppu_crtc_zoom[1] & 0xffff0000) >> 16) - (m_ppu_crtc_zoom[0] & 0xffff);
-	if (width > 0 && m_screenwidth != width)
-	{
-		attoseconds_t period = screen.frame_period().attoseconds();
-		rectangle visarea = screen.visible_area();
-
-		int height = ((m_ppu_crtc_zoom[5] & 0xffff0000) >> 16) - (m_ppu_crtc_zoom[4] & 0xffff);
-		visarea.set(0, width - 1, 0, height - 1);
-		screen.configure(width, height, visarea, period);
-		m_screenwidth = width;
-	}
-
-	u32 fullscreenzoomx = m_ppu_crtc_zoom[3] & 0x000000ff;
-	u32 fullscreenzoomy = m_ppu_crtc_zoom[7] & 0x000000ff;
-	/* clamp at 0x80, I don't know if this is accurate */
-	if (fullscreenzoomx > 0x80) fullscreenzoomx = 0x80;
-	if (fullscreenzoomy > 0x80) fullscreenzoomy = 0x80;
-
-	u32 fszx = (fullscreenzoomx << 16) / 0x40;
-	u32 fszy = (fullscreenzoomy << 16) / 0x40;
-
-	if (fullscreenzoomx == 0x40 && fullscreenzoomy == 0x40)
-	{
-		m_renderbuffer_clip = cliprect;
-	}
-	else
-	{
-		m_renderbuffer_clip.set(
-			(cliprect.left() * fszx) >> 16, (((cliprect.right() + 1) * fszx + 0x8000) >> 16) - 1,
-			(cliprect.top() * fszy) >> 16, (((cliprect.bottom() + 1) * fszy + 0x8000) >> 16) - 1);
-	}
-	m_renderbuffer_bitmap.fill(0, m_renderbuffer_clip);
+	m_sprite_bins.reset(m_renderbuffer_bitmap.cliprect());
+	m_sprite_bins_dirty = false;
 
-	/* Sprites */
-	//logerror("Spritelist start:\n");
 	for (int i = 0x00000 / 4; i < 0x2000 / 4; i += 4)
 	{
 		if (m_spritelist[i + 0] & 0x80000000)
@@ -1197,7 +1167,6 @@ u32 cps3_state::screen_update(screen_device &screen, bitmap_rgb32 &bitmap, const
 			if (xsize2 == 0) // xsize of 0 tiles seems to be a special command to draw tilemaps
 			{
 				int tilemapnum = ((value3 & 0x00000030) >> 4);
-				u32* regs = &m_tilemap_regs[tilemapnum * 4];
 
 				for (int yy = 0; yy < ysizedraw2; yy++)
 				{
@@ -1207,8 +1176,11 @@ u32 cps3_state::screen_update(screen_device &screen, bitmap_rgb32 &bitmap, const
 					cury_pos -= 18;
 					cury_pos &= 0x3ff;
 
-					if (cury_pos >= m_renderbuffer_clip.top() && cury_pos <= m_renderbuffer_clip.bottom())
-						draw_tilemapsprite_line(regs, cury_pos, m_renderbuffer_bitmap, m_renderbuffer_clip);
+					cps3_sprite sprite{};
+					sprite.tilemap = true;
+					sprite.code = tilemapnum;
+					sprite.sy = cury_pos;
+					m_sprite_bins.add(sprite, cury_pos, cury_pos);
 				}
 			}
 			else
@@ -1247,7 +1219,7 @@ u32 cps3_state::screen_update(screen_device &screen, bitmap_rgb32 &bitmap, const
 				int actualpal = whichpal ? global_pal : pal;
 
 				/* use the bpp value from the main list or the sublists? */
-				m_gfxdecode->gfx(1)->set_granularity((whichbpp ? global_bpp : bpp) ? 64 : 256);
+				u16 const granularity = (whichbpp ? global_bpp : bpp) ? 64 : 256;
 
 				int trans = (global_alpha || alpha) ? CPS3_TRANSPARENCY_PEN_INDEX_BLEND : CPS3_TRANSPARENCY_PEN_INDEX;
 
@@ -1280,13 +1252,78 @@ u32 cps3_state::screen_update(screen_device &screen, bitmap_rgb32 &bitmap, const
 
 						//if ( (whichbpp) && (m_screen->frame_number() & 1)) continue;
 
-						cps3_drawgfxzoom(m_renderbuffer_bitmap, m_renderbuffer_clip, m_gfxdecode->gfx(1), tileno + count, actualpal, 0 ^ flipx, 0 ^ flipy, current_xpos, current_ypos, trans, 0, xscale, yscale);
+						cps3_sprite sprite{};
+						sprite.code = tileno + count;
+						sprite.color = actualpal;
+						sprite.flipx = flipx;
+						sprite.flipy = flipy;
+						sprite.sx = current_xpos;
+						sprite.sy = current_ypos;
+						sprite.xscale = xscale;
+						sprite.yscale = yscale;
+						sprite.trans = trans;
+						sprite.granularity = granularity;
+						if (xscale && yscale)
+							m_sprite_bins.add(sprite, current_ypos, current_ypos + ((yscale * 16 + 0x8000) >> 16) - 1);
 						count++;
 					}
 				}
 			}
 		}
 	}
+}
+
+u32 cps3_state::screen_update(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
+{
+	int width = ((m_ppu_crtc_zoom[1] & 0xffff0000) >> 16) - (m_ppu_crtc_zoom[0] & 0xffff);
+	if (width > 0 && m_screenwidth != width)
+	{
+		attoseconds_t period = screen.frame_period().attoseconds();
+		rectangle visarea = screen.visible_area();
+
+		int height = ((m_ppu_crtc_zoom[5] & 0xffff0000) >> 16) - (m_ppu_crtc_zoom[4] & 0xffff);
+		visarea.set(0, width - 1, 0, height - 1);
+		screen.configure(width, height, visarea, period);
+		m_screenwidth = width;
+	}
+
+	u32 fullscreenzoomx = m_ppu_crtc_zoom[3] & 0x000000ff;
+	u32 fullscreenzoomy = m_ppu_crtc_zoom[7] & 0x000000ff;
+	/* clamp at 0x80, I don't know if this is accurate */
+	if (fullscreenzoomx > 0x80) fullscreenzoomx = 0x80;
+	if (fullscreenzoomy > 0x80) fullscreenzoomy = 0x80;
+
+	u32 fszx = (fullscreenzoomx << 16) / 0x40;
+	u32 fszy = (fullscreenzoomy << 16) / 0x40;
+
+	if (fullscreenzoomx == 0x40 && fullscreenzoomy == 0x40)
+	{
+		m_renderbuffer_clip = cliprect;
+	}
+	else
+	{
+		m_renderbuffer_clip.set(
+			(cliprect.left() * fszx) >> 16, (((cliprect.right() + 1) * fszx + 0x8000) >> 16) - 1,
+			(cliprect.top() * fszy) >> 16, (((cliprect.bottom() + 1) * fszy + 0x8000) >> 16) - 1);
+	}
+	m_renderbuffer_bitmap.fill(0, m_renderbuffer_clip);
+
+	/* Sprites */
+	if (m_sprite_bins_dirty)
+		build_sprite_bins();
+
+	m_sprite_bins.visit(m_renderbuffer_clip, [this] (const cps3_sprite &sprite)
+	{
+		if (sprite.tilemap)
+		{
+			draw_tilemapsprite_line(&m_tilemap_regs[sprite.code * 4], sprite.sy, m_renderbuffer_bitmap, m_renderbuffer_clip);
+		}
+		else
+		{
+			m_gfxdecode->gfx(1)->set_granularity(sprite.granularity);
+			cps3_drawgfxzoom(m_renderbuffer_bitmap, m_renderbuffer_clip, m_gfxdecode->gfx(1), sprite.code, sprite.color, sprite.flipx, sprite.flipy, sprite.sx, sprite.sy, sprite.trans, 0, sprite.xscale, sprite.yscale);
+		}
+	});
 
 	if (fullscreenzoomx == 0x40 && fullscreenzoomy == 0x40)
 	{
@@ -1417,6 +1454,7 @@ void cps3_state::spritedma_w(offs_t offset, u16 data, u16 mem_mask)
 			std::copy(&m_spriteram[offs], &m_spriteram[offs + length*4], &m_spritelist[offs]); // copy sublist
 		}
 		std::copy(&m_ppu_gscroll[0], &m_ppu_gscroll[8], &m_ppu_gscroll_buff[0]);
+		m_sprite_bins_dirty = true;
 
 		m_dma_status |= 1;
 		m_spritelist_dma_timer->adjust(attotime::from_usec(4)); // slight delay to skip multiple 8/9 writes. actual DMA speed is unknown.
@@ -2326,6 +2364,7 @@ void cps3_state::device_post_load()
 	copy_from_nvram();
 	m_gfxdecode->gfx(0)->mark_all_dirty();
 	m_gfxdecode->gfx(1)->mark_all_dirty();
+	m_sprite_bins_dirty = true;
 }
 
 
@@ -15,6 +15,7 @@
 #include "cpu/sh/sh7604.h"
 #include "cps3_a.h"
 #include "machine/timer.h"
+#include "video/spritebin.h"
 #include "emupal.h"
 
 
@@ -104,6 +105,19 @@ protected:
 	optional_memory_region      m_user5_region;
 
 private:
+	// one tile or tilemap line drawn by the display list
+	struct cps3_sprite
+	{
+		u32 code;           // tile number, or tilemap number for a tilemap line
+		u32 color;
+		int sx, sy;         // sy is the render buffer row for a tilemap line
+		int xscale, yscale;
+		u16 granularity;
+		u8 flipx, flipy;
+		u8 trans;
+		bool tilemap;
+	};
+
 	u32 m_cram_gfxflash_bank = 0;
 	std::unique_ptr<u32[]> m_char_ram;
 	std::unique_ptr<u32[]> m_eeprom;
@@ -117,6 +131,8 @@ private:
 	std::unique_ptr<u32[]> m_mame_colours;
 	bitmap_rgb32 m_renderbuffer_bitmap;
 	rectangle m_renderbuffer_clip;
+	sprite_bin_list<cps3_sprite> m_sprite_bins;
+	bool m_sprite_bins_dirty = true;
 	u8* m_user4 = nullptr;
 	std::unique_ptr<u8[]> m_user4_allocated;
 	u32 m_key1 = 0;
@@ -166,6 +182,7 @@ private:
 	void outport_w(offs_t offset, u16 data, u16 mem_mask = ~0);
 	void spritedma_w(offs_t offset, u16 data, u16 mem_mask = ~0);
 	SH2_DMA_KLUDGE_CB(dma_callback);
+	void build_sprite_bins();
 	void draw_fg_layer(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect);
 	u32 screen_update(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect);
 	void vbl_interrupt(int state);
@@ -7503,6 +7503,7 @@ void galaxian_state::konami_sound_1x_ay8910(machine_config &config)
 
 	NETLIST_SOUND(config, "konami", 48000)
 		.set_source(netlist_konami1x)
+		.set_buffered_inputs(true)
 		.add_route(ALL_OUTPUTS, "speaker", 1.0);
 
 	// Filter
@@ -7550,6 +7551,7 @@ void galaxian_state::konami_sound_2x_ay8910(machine_config &config)
 
 	NETLIST_SOUND(config, "konami", 48000)
 		.set_source(netlist_konami2x)
+		.set_buffered_inputs(true)
 		.add_route(ALL_OUTPUTS, "speaker", 1.0);
 
 	// Filter
@@ -72,7 +72,6 @@ Stephh's additional notes :
 #include "kaneko_hit.h"
 
 #include "cpu/m68000/m68000.h"
-#include "machine/timer.h"
 #include "machine/watchdog.h"
 #include "sound/okim6295.h"
 
@@ -124,7 +123,7 @@ private:
 
 	uint32_t screen_update(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect);
 	void screen_vblank(int state);
-	TIMER_DEVICE_CALLBACK_MEMBER(scanline);
+	void scanline(screen_device &screen, int scanline);
 	void draw_fgbitmap(bitmap_ind16 &bitmap, const rectangle &cliprect);
 
 	void galpanic_map(address_map &map);
@@ -191,6 +190,9 @@ uint32_t galpanic_state::screen_update(screen_device &screen, bitmap_ind16 &bitm
 void galpanic_state::machine_start()
 {
 	m_okibank->configure_entries(0, 16, memregion("oki")->base(), 0x10000);
+
+	m_screen->add_scanline_event(224, scanline_event_delegate(&galpanic_state::scanline, this));
+	m_screen->add_scanline_event(32, scanline_event_delegate(&galpanic_state::scanline, this));
 }
 
 void galpanic_state::screen_vblank(int state)
@@ -202,10 +204,8 @@ void galpanic_state::screen_vblank(int state)
 	}
 }
 
-TIMER_DEVICE_CALLBACK_MEMBER(galpanic_state::scanline)
+void galpanic_state::scanline(screen_device &screen, int scanline)
 {
-	int scanline = param;
-
 	if(scanline == 224) // vblank-out irq
 		m_maincpu->set_input_line(3, HOLD_LINE);
 
@@ -334,7 +334,6 @@ void galpanic_state::galpanic(machine_config &config)
 	// basic machine hardware
 	M68000(config, m_maincpu, XTAL(12'000'000)); // verified on PCB
 	m_maincpu->set_addrmap(AS_PROGRAM, &galpanic_state::galpanic_map);
-	TIMER(config, "scantimer").configure_scanline(FUNC(galpanic_state::scanline), "screen", 0, 1);
 
 	WATCHDOG_TIMER(config, "watchdog");
 
@@ -2813,6 +2813,7 @@ void cave_state::unpack_sprites(int chip)
 	}
 	m_sprite_gfx[chip] = make_unique_clear<u8[]>(m_sprite_gfx_mask[chip]);
 
+	m_spr_gfxdecode[chip]->predecode_gfx(0);
 	u8 *dst = m_sprite_gfx[chip].get();
 	for (int e = 0; e < gfx->elements(); e++)
 	{
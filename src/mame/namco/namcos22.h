@@ -157,19 +157,39 @@ public:
 	void init();
 
 private:
+	static constexpr int SETUP_CHUNK_NODES = 128;
+
+	// a quad projected to the screen and clipped against the near plane
+	struct quad_setup
+	{
+		int clipverts;
+		vertex_t clipv[6];
+	};
+
+	struct setup_chunk
+	{
+		namcos22_renderer *renderer;
+		int start, end;
+	};
+
 	namcos22_state &m_state;
 
 	struct namcos22_scenenode m_scenenode_root;
 	struct namcos22_scenenode *m_scenenode_cur;
 	std::list<namcos22_scenenode> m_scenenode_alloc;
 	rectangle m_cliprect;
+	std::vector<namcos22_scenenode *> m_render_nodes;
+	std::vector<quad_setup> m_quad_setup;
+	std::vector<setup_chunk> m_setup_chunks;
 
 	static u8 nthbyte(const u32 *src, int n) { return util::big_endian_cast<u8>(src)[n]; }
 	static u16 nthword(const u32 *src, int n) { return util::big_endian_cast<u16>(src)[n]; }
 
-	void render_scene_nodes(screen_device &screen, bitmap_rgb32 &bitmap, struct namcos22_scenenode *node);
+	void collect_scene_nodes(struct namcos22_scenenode *node);
 	void render_sprite(screen_device &screen, bitmap_rgb32 &bitmap, struct namcos22_scenenode *node);
-	void poly3d_drawquad(screen_device &screen, bitmap_rgb32 &bitmap, struct namcos22_scenenode *node);
+	void poly3d_projectquad(const struct namcos22_scenenode *node, quad_setup &setup);
+	void poly3d_drawquad(screen_device &screen, bitmap_rgb32 &bitmap, struct namcos22_scenenode *node, const quad_setup &setup);
+	static void *project_chunk_callback(void *param, int threadid);
 	void poly3d_drawsprite(screen_device &screen, bitmap_rgb32 &dest_bmp, u32 code, u32 color, int flipx, int flipy, int sx, int sy, int scalex, int scaley, int cz_factor, int prioverchar, bool fade_enabled, int alpha);
 
 	void free_scenenode(struct namcos22_scenenode *node);
@@ -265,6 +285,7 @@ public:
 	int m_fog_g_per_cztype[4];
 	int m_fog_b_per_cztype[4];
 	u16 m_czattr[8] = { };
+	osd_work_queue *m_render_queue = nullptr;
 
 	required_device<palette_device> m_palette;
 	optional_shared_ptr<u32> m_czram;
@@ -391,6 +412,10 @@ protected:
 	void draw_sprites();
 	void draw_sprite_group(const u32 *src, const u32 *attr, int num_sprites, int deltax, int deltay, int y_lowres);
 	void namcos22_mix_text_layer(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect);
+	void mix_bands(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect, int prival, bool text, bool gamma);
+	virtual void mix_band(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect, int prival, bool text, bool gamma);
+	static void *mix_band_callback(void *param, int threadid);
+	void video_exit();
 
 	void install_c74_speedup();
 
@@ -505,6 +530,22 @@ protected:
 	int m_camera_ambient = 0; // 0.0..1.0
 	int m_camera_power = 0;   // 0.0..1.0
 
+	// the final mix is done in bands of scanlines on m_render_queue
+	static constexpr int MIX_BANDS = 16;
+
+	struct mix_band_params
+	{
+		namcos22_state *state;
+		screen_device *screen;
+		bitmap_rgb32 *bitmap;
+		rectangle clip;
+		int prival;
+		bool text;
+		bool gamma;
+	};
+
+	mix_band_params m_mix_bands[MIX_BANDS];
+
 	bool m_skipped_this_frame = false;
 	void render_frame_active();
 	void screen_vblank(int state);
@@ -544,6 +585,8 @@ protected:
 
 	void recalc_czram();
 	void namcos22s_mix_text_layer(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect, int prival);
+	void apply_gamma(bitmap_rgb32 &bitmap, const rectangle &cliprect);
+	virtual void mix_band(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect, int prival, bool text, bool gamma) override;
 	u32 screen_update_namcos22s(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect);
 
 	void namcos22s_czattr_w(offs_t offset, u16 data, u16 mem_mask = ~0);
@@ -286,19 +286,16 @@ void namcos22_renderer::renderscanline_sprite(int32_t scanline, const extent_t &
 
 /*********************************************************************************************/
 
-void namcos22_renderer::poly3d_drawquad(screen_device &screen, bitmap_rgb32 &bitmap, struct namcos22_scenenode *node)
+void namcos22_renderer::poly3d_projectquad(const struct namcos22_scenenode *node, quad_setup &setup)
 {
 	vertex_t v[4];
-	vertex_t clipv[6];
-	int clipverts;
+	vertex_t *const clipv = setup.clipv;
+	int &clipverts = setup.clipverts;
 	int vertnum;
 	int direct = node->data.quad.direct;
 
-	// scene clip
 	int cx = 320 + node->data.quad.vx;
 	int cy = 240 + node->data.quad.vy;
-	m_cliprect.set(cx + node->data.quad.vl, cx - node->data.quad.vr - 1, cy + node->data.quad.vu, cy - node->data.quad.vd - 1);
-	m_cliprect &= screen.visible_area();
 
 	// non-direct case: project and z-clip
 	if (!direct)
@@ -314,7 +311,7 @@ void namcos22_renderer::poly3d_drawquad(screen_device &screen, bitmap_rgb32 &bit
 		}
 
 		clipverts = zclip_if_less<4>(4, v, clipv, 0.00001);
-		assert(clipverts <= std::size(clipv));
+		assert(clipverts <= std::size(setup.clipv));
 		if (clipverts < 3)
 			return;
 
@@ -345,6 +342,20 @@ void namcos22_renderer::poly3d_drawquad(screen_device &screen, bitmap_rgb32 &bit
 			clipv[vertnum].p[3] = (node->data.quad.v[vertnum].bri + 0.5) * ooz;
 		}
 	}
+}
+
+void namcos22_renderer::poly3d_drawquad(screen_device &screen, bitmap_rgb32 &bitmap, struct namcos22_scenenode *node, const quad_setup &setup)
+{
+	if (setup.clipverts < 3)
+		return;
+
+	int direct = node->data.quad.direct;
+
+	// scene clip
+	int cx = 320 + node->data.quad.vx;
+	int cy = 240 + node->data.quad.vy;
+	m_cliprect.set(cx + node->data.quad.vl, cx - node->data.quad.vr - 1, cy + node->data.quad.vu, cy - node->data.quad.vd - 1);
+	m_cliprect &= screen.visible_area();
 
 	int color = node->data.quad.color;
 	int cz_value = node->data.quad.cz_value;
@@ -450,9 +461,9 @@ void namcos22_renderer::poly3d_drawquad(screen_device &screen, bitmap_rgb32 &bit
 	}
 
 	if (m_state.m_is_ss22)
-		render_triangle_fan<4>(m_cliprect, render_delegate(&namcos22_renderer::renderscanline_poly_ss22, this), clipverts, clipv);
+		render_triangle_fan<4>(m_cliprect, render_delegate(&namcos22_renderer::renderscanline_poly_ss22, this), setup.clipverts, setup.clipv);
 	else
-		render_triangle_fan<4>(m_cliprect, render_delegate(&namcos22_renderer::renderscanline_poly, this), clipverts, clipv);
+		render_triangle_fan<4>(m_cliprect, render_delegate(&namcos22_renderer::renderscanline_poly, this), setup.clipverts, setup.clipv);
 }
 
 
@@ -637,7 +648,7 @@ struct namcos22_scenenode *namcos22_renderer::new_scenenode(running_machine &mac
 	}
 }
 
-void namcos22_renderer::render_scene_nodes(screen_device &screen, bitmap_rgb32 &bitmap, struct namcos22_scenenode *node)
+void namcos22_renderer::collect_scene_nodes(struct namcos22_scenenode *node)
 {
 	if (node)
 	{
@@ -645,7 +656,7 @@ void namcos22_renderer::render_scene_nodes(screen_device &screen, bitmap_rgb32 &
 		{
 			for (int i = NAMCOS22_RADIX_BUCKETS - 1; i >= 0; i--)
 			{
-				render_scene_nodes(screen, bitmap, node->data.nonleaf.next[i]);
+				collect_scene_nodes(node->data.nonleaf.next[i]);
 			}
 			free_scenenode(node);
 		}
@@ -653,37 +664,75 @@ void namcos22_renderer::render_scene_nodes(screen_device &screen, bitmap_rgb32 &
 		{
 			while (node)
 			{
-				struct namcos22_scenenode *next = node->next;
-
-				switch (node->type)
-				{
-					case NAMCOS22_SCENENODE_QUAD:
-						poly3d_drawquad(screen, bitmap, node);
-						break;
-
-					case NAMCOS22_SCENENODE_SPRITE:
-						render_sprite(screen, bitmap, node);
-						break;
-
-					default:
-						fatalerror("invalid node->type\n");
-				}
-				free_scenenode(node);
-				node = next;
+				m_render_nodes.push_back(node);
+				node = node->next;
 			}
 		}
 	}
 }
 
+void *namcos22_renderer::project_chunk_callback(void *param, int threadid)
+{
+	setup_chunk &chunk = *reinterpret_cast<setup_chunk *>(param);
+	namcos22_renderer &renderer = *chunk.renderer;
+
+	for (int i = chunk.start; i < chunk.end; i++)
+	{
+		if (renderer.m_render_nodes[i]->type == NAMCOS22_SCENENODE_QUAD)
+			renderer.poly3d_projectquad(renderer.m_render_nodes[i], renderer.m_quad_setup[i]);
+	}
+	return nullptr;
+}
+
 void namcos22_renderer::render_scene(screen_device &screen, bitmap_rgb32 &bitmap)
 {
+	// flatten the scene into drawing order
+	m_render_nodes.clear();
 	struct namcos22_scenenode *node = &m_scenenode_root;
 	for (int i = NAMCOS22_RADIX_BUCKETS - 1; i >= 0; i--)
 	{
-		render_scene_nodes(screen, bitmap, node->data.nonleaf.next[i]);
+		collect_scene_nodes(node->data.nonleaf.next[i]);
 		node->data.nonleaf.next[i] = nullptr;
 	}
 
+	// project and z-clip the quads in parallel, this only reads the nodes
+	const int count = m_render_nodes.size();
+	m_quad_setup.resize(count);
+	m_setup_chunks.clear();
+	for (int start = 0; start < count; start += SETUP_CHUNK_NODES)
+		m_setup_chunks.push_back(setup_chunk{ this, start, std::min(start + SETUP_CHUNK_NODES, count) });
+
+	if (m_state.m_render_queue && m_setup_chunks.size() > 1)
+	{
+		osd_work_item_queue_multiple(m_state.m_render_queue, project_chunk_callback, m_setup_chunks.size(), &m_setup_chunks[0], sizeof(m_setup_chunks[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(m_state.m_render_queue, osd_ticks_per_second())) { }
+	}
+	else
+	{
+		for (setup_chunk &chunk : m_setup_chunks)
+			project_chunk_callback(&chunk, 0);
+	}
+
+	// the rest of the setup depends on the order the sprites and polys are drawn in
+	for (int i = 0; i < count; i++)
+	{
+		node = m_render_nodes[i];
+		switch (node->type)
+		{
+			case NAMCOS22_SCENENODE_QUAD:
+				poly3d_drawquad(screen, bitmap, node, m_quad_setup[i]);
+				break;
+
+			case NAMCOS22_SCENENODE_SPRITE:
+				render_sprite(screen, bitmap, node);
+				break;
+
+			default:
+				fatalerror("invalid node->type\n");
+		}
+		free_scenenode(node);
+	}
+
 	wait("render_scene");
 }
 
@@ -1528,7 +1577,6 @@ void namcos22_state::draw_polygons()
 	if (m_pdp_render_done && m_slave_simulation_active)
 	{
 		simulate_slavedsp();
-		m_poly->wait("draw_polygons");
 	}
 }
 
@@ -2165,6 +2213,56 @@ void namcos22_state::namcos22_mix_text_layer(screen_device &screen, bitmap_rgb32
 	}
 }
 
+void namcos22_state::mix_band(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect, int prival, bool text, bool gamma)
+{
+	if (text)
+		namcos22_mix_text_layer(screen, bitmap, cliprect);
+}
+
+void namcos22s_state::mix_band(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect, int prival, bool text, bool gamma)
+{
+	if (text)
+		namcos22s_mix_text_layer(screen, bitmap, cliprect, prival);
+	if (gamma)
+		apply_gamma(bitmap, cliprect);
+}
+
+void *namcos22_state::mix_band_callback(void *param, int threadid)
+{
+	mix_band_params &band = *reinterpret_cast<mix_band_params *>(param);
+	band.state->mix_band(*band.screen, *band.bitmap, band.clip, band.prival, band.text, band.gamma);
+	return nullptr;
+}
+
+void namcos22_state::mix_bands(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect, int prival, bool text, bool gamma)
+{
+	// every scanline of the mix is independent, so split it into bands that run in parallel
+	const int lines = (cliprect.height() + MIX_BANDS - 1) / MIX_BANDS;
+	int bands = 0;
+	for (int y = cliprect.top(); y <= cliprect.bottom(); y += lines)
+	{
+		mix_band_params &band = m_mix_bands[bands++];
+		band.state = this;
+		band.screen = &screen;
+		band.bitmap = &bitmap;
+		band.clip.set(cliprect.left(), cliprect.right(), y, std::min(y + lines - 1, cliprect.bottom()));
+		band.prival = prival;
+		band.text = text;
+		band.gamma = gamma;
+	}
+
+	if (m_render_queue && bands > 1)
+	{
+		osd_work_item_queue_multiple(m_render_queue, mix_band_callback, bands, m_mix_bands, sizeof(m_mix_bands[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(m_render_queue, osd_ticks_per_second())) { }
+	}
+	else
+	{
+		for (int i = 0; i < bands; i++)
+			mix_band_callback(&m_mix_bands[i], 0);
+	}
+}
+
 void namcos22_state::update_text_rowscroll()
 {
 	u64 frame = m_screen->frame_number();
@@ -2203,7 +2301,7 @@ void namcos22_state::draw_text_layer(screen_device &screen, bitmap_rgb32 &bitmap
 	m_bgtilemap->set_palette_offset(m_text_palbase);
 
 	m_bgtilemap->draw(screen, *m_mix_bitmap, cliprect, 0, 2, 3);
-	namcos22_mix_text_layer(screen, bitmap, cliprect);
+	mix_bands(screen, bitmap, cliprect, 2, true, false);
 }
 
 void namcos22s_state::draw_text_layer(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
@@ -2212,7 +2310,7 @@ void namcos22s_state::draw_text_layer(screen_device &screen, bitmap_rgb32 &bitma
 	m_bgtilemap->set_palette_offset(m_text_palbase);
 
 	m_bgtilemap->draw(screen, *m_mix_bitmap, cliprect, 0, 4, 4);
-	namcos22s_mix_text_layer(screen, bitmap, cliprect, 4);
+	mix_bands(screen, bitmap, cliprect, 4, true, false);
 }
 
 
@@ -2528,9 +2626,15 @@ u32 namcos22s_state::screen_update_namcos22s(screen_device &screen, bitmap_rgb32
 	if (layer & 2) draw_sprites();
 	if (layer & 1) draw_polygons();
 	m_poly->render_scene(screen, bitmap);
-	if (layer & 4) namcos22s_mix_text_layer(screen, bitmap, cliprect, 6);
 
-	// apply gamma
+	// text layer over polys/sprites, then gamma
+	mix_bands(screen, bitmap, cliprect, 6, (layer & 4) != 0, true);
+
+	return 0;
+}
+
+void namcos22s_state::apply_gamma(bitmap_rgb32 &bitmap, const rectangle &cliprect)
+{
 	const u8 *rlut = (const u8 *)&m_mixer[0x100/4];
 	const u8 *glut = (const u8 *)&m_mixer[0x200/4];
 	const u8 *blut = (const u8 *)&m_mixer[0x300/4];
@@ -2546,8 +2650,6 @@ u32 namcos22s_state::screen_update_namcos22s(screen_device &screen, bitmap_rgb32
 			dest[x] = (r << 16) | (g << 8) | b;
 		}
 	}
-
-	return 0;
 }
 
 u32 namcos22_state::screen_update_namcos22(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
@@ -2605,8 +2707,7 @@ void namcos22_state::init_tables()
 	save_pointer(NAME(m_pointram), 0x20000);
 
 	// force all texture tiles to be decoded now
-	for (int i = 0; i < m_gfxdecode->gfx(1)->elements(); i++)
-		m_gfxdecode->gfx(1)->get_data(i);
+	m_gfxdecode->predecode_gfx(1);
 
 	m_texture_tilemap = (u16 *)memregion("textilemap")->base();
 	m_texture_tiledata = (u8 *)m_gfxdecode->gfx(1)->get_data(0);
@@ -2714,4 +2815,16 @@ void namcos22_state::video_start()
 	m_gfxdecode->gfx(0)->set_source((u8 *)m_cgram.target());
 
 	m_poly = std::make_unique<namcos22_renderer>(*this);
+
+	m_render_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&namcos22_state::video_exit, this));
+}
+
+void namcos22_state::video_exit()
+{
+	if (m_render_queue)
+	{
+		osd_work_queue_free(m_render_queue);
+		m_render_queue = nullptr;
+	}
 }
@@ -17,6 +17,8 @@
 #include "emu.h"
 #include "namcos2_roz.h"
 
+#include "video/rozspan.h"
+
 static const gfx_layout layout =
 {
 	8,8,
@@ -78,6 +80,22 @@ draw_roz_helper_block(const struct roz_param *rozInfo, int destx, int desty,
 	uint16_t *dest = &destbitmap.pix(desty, destx);
 	int dest_rowinc = destbitmap.rowpixels() - width;
 
+	if (rozInfo->wrap)
+	{
+		// wrapped rows never need clipping, so hand them to the span kernel
+		const roz_span_source source{ &srcbitmap.pix(0), &flagsbitmap.pix(0), uint32_t(srcbitmap.rowpixels()), size_mask + 1, size_mask + 1 };
+		while (desty < desty_end)
+		{
+			roz_span_draw_ind16<true>(dest, nullptr, width, srcx, srcy, rozInfo->incxx, rozInfo->incxy, source,
+					TILEMAP_PIXEL_LAYER0, TILEMAP_PIXEL_LAYER0, uint32_t(rozInfo->color) << 16);
+			srcx += rozInfo->incyx;
+			srcy += rozInfo->incyy;
+			dest += destbitmap.rowpixels();
+			desty++;
+		}
+		return;
+	}
+
 	while (desty < desty_end)
 	{
 		uint16_t *dest_end = dest + width;
@@ -164,6 +164,7 @@ uint32_t n64_state::screen_update(screen_device &screen, bitmap_rgb32 &bitmap, c
 	*/
 
 	m_rdp->mark_frame();
+	m_rdp->wait_pipe("Screen update");
 
 	if (m_rcp_periphs->vi_blank)
 	{
@@ -1912,6 +1913,14 @@ void n64_rdp::draw_triangle(uint64_t *cmd_buf, bool shade, bool texture, bool zb
 		return;
 	}
 
+	// span aux data stays live until the work reading it has run, so the
+	// buffer is only recycled once the pipe has drained
+	const uint32_t span_count = std::min<uint32_t>(((ylfar - ycur) >> 2) + 1, 4096);
+	if ((m_aux_buf_ptr + span_count * sizeof(rdp_span_aux)) > EXTENT_AUX_COUNT || object_data().count() >= MAX_QUEUED_OBJECTS)
+	{
+		wait_pipe("Render queue full");
+	}
+
 	bool new_object = true;
 	rdp_poly_state* object = nullptr;
 	bool valid = false;
@@ -2064,7 +2073,6 @@ void n64_rdp::draw_triangle(uint64_t *cmd_buf, bool shade, bool texture, bool zb
 	{
 		render_spans(yh >> 2, yl >> 2, tilenum, flip ? true : false, spans, rect, object);
 	}
-	m_aux_buf_ptr = 0;  // Spans can be reused once render completes
 	//wait("draw_triangle");
 }
 
@@ -2077,7 +2085,6 @@ void n64_rdp::draw_triangle(uint64_t *cmd_buf, bool shade, bool texture, bool zb
 void n64_rdp::triangle(uint64_t *cmd_buf, bool shade, bool texture, bool zbuffer)
 {
 	draw_triangle(cmd_buf, shade, texture, zbuffer, false);
-	m_pipe_clean = false;
 }
 
 void n64_rdp::cmd_tex_rect(uint64_t *cmd_buf)
@@ -2182,7 +2189,7 @@ void n64_rdp::cmd_sync_tile(uint64_t *cmd_buf)
 
 void n64_rdp::cmd_sync_full(uint64_t *cmd_buf)
 {
-	//wait("SyncFull");
+	wait_pipe("SyncFull");
 	m_n64_periphs->dp_full_sync();
 }
 
@@ -2207,7 +2214,7 @@ void n64_rdp::cmd_set_convert(uint64_t *cmd_buf)
 {
 	const uint64_t w1 = cmd_buf[0];
 
-	if(!m_pipe_clean) { m_pipe_clean = true; wait("SetConvert"); }
+	wait_pipe("SetConvert");
 	int32_t k0 = int32_t(w1 >> 45) & 0x1ff;
 	int32_t k1 = int32_t(w1 >> 36) & 0x1ff;
 	int32_t k2 = int32_t(w1 >> 27) & 0x1ff;
@@ -2303,6 +2310,8 @@ void n64_rdp::cmd_load_tlut(uint64_t *cmd_buf)
 		fatalerror("Load tlut: tl=%d, th=%d\n",tl,th);
 	}
 
+	wait_rdram((m_misc_state.m_ti_address + (tl >> 2) * (m_misc_state.m_ti_width << 1) + (sl >> 1)) & ~1, ((sh >> 2) - (sl >> 2) + 1) << 1, "LoadTLUT");
+
 	m_capture.data_begin();
 
 	const int32_t count = ((sh >> 2) - (sl >> 2) + 1) << 2;
@@ -2406,6 +2415,8 @@ void n64_rdp::cmd_load_block(uint64_t *cmd_buf)
 
 	const uint32_t src = (m_misc_state.m_ti_address >> 1) + (tl * tiwinwords) + slinwords;
 
+	wait_rdram(src << 1, (width + tile[tilenum].line) << 3, "LoadBlock");
+
 	m_capture.data_begin();
 
 	if (dxt != 0)
@@ -2590,6 +2601,10 @@ void n64_rdp::cmd_load_tile(uint64_t *cmd_buf)
 
 	const int32_t width = (sh - sl) + 1;
 	const int32_t height = (th - tl) + 1;
+
+	const uint32_t first = ((tl * m_misc_state.m_ti_width + sl) << m_misc_state.m_ti_size) >> 1;
+	const uint32_t last = ((th * m_misc_state.m_ti_width + sh + 1) << m_misc_state.m_ti_size) >> 1;
+	wait_rdram(m_misc_state.m_ti_address + first, last - first, "LoadTile");
 /*
     int32_t topad;
     if (m_misc_state.m_ti_size < 3)
@@ -2999,6 +3014,8 @@ n64_rdp::n64_rdp(n64_state &state, uint32_t* rdram, uint32_t* dmem) : poly_manag
 	m_aux_buf_ptr = 0;
 	m_aux_buf = nullptr;
 	m_pipe_clean = true;
+	m_pending_start = ~0U;
+	m_pending_end = 0;
 
 	m_pending_mode_block = false;
 
@@ -3125,6 +3142,18 @@ void n64_rdp::render_spans(int32_t start, int32_t end, int32_t tilenum, bool fli
 	object->m_fill_color = m_fill_color;
 	object->rect = rect;
 
+	// note the RDRAM rows this may write, so loads from them wait for it
+	const uint32_t fb_row_bytes = (m_misc_state.m_fb_width << m_misc_state.m_fb_size) >> 1;
+	m_pending_start = std::min(m_pending_start, m_misc_state.m_fb_address + start * fb_row_bytes);
+	m_pending_end = std::max(m_pending_end, m_misc_state.m_fb_address + (end + 2) * fb_row_bytes);
+	if (m_other_modes.z_update_en && (m_other_modes.cycle_type == CYCLE_TYPE_1 || m_other_modes.cycle_type == CYCLE_TYPE_2))
+	{
+		const uint32_t zb_row_bytes = m_misc_state.m_fb_width << 1;
+		m_pending_start = std::min(m_pending_start, m_misc_state.m_zb_address + start * zb_row_bytes);
+		m_pending_end = std::max(m_pending_end, m_misc_state.m_zb_address + (end + 2) * zb_row_bytes);
+	}
+	m_pipe_clean = false;
+
 	switch(m_other_modes.cycle_type)
 	{
 		case CYCLE_TYPE_1:
@@ -3143,7 +3172,27 @@ void n64_rdp::render_spans(int32_t start, int32_t end, int32_t tilenum, bool fli
 			render_extents<8>(clip, render_delegate(&n64_rdp::span_draw_fill, this), start, (end - start) + 1, spans + offset);
 			break;
 	}
-	wait("render spans");
+}
+
+void n64_rdp::wait_pipe(const char *debug_reason)
+{
+	if (!m_pipe_clean)
+	{
+		wait(debug_reason);
+		m_pipe_clean = true;
+	}
+	m_aux_buf_ptr = 0;
+	m_pending_start = ~0U;
+	m_pending_end = 0;
+}
+
+void n64_rdp::wait_rdram(uint32_t address, uint32_t length, const char *debug_reason)
+{
+	// only wait if queued spans may still be writing what's about to be read
+	if (!m_pipe_clean && address < m_pending_end && (address + length) > m_pending_start)
+	{
+		wait_pipe(debug_reason);
+	}
 }
 
 void n64_rdp::rgbaz_clip(int32_t sr, int32_t sg, int32_t sb, int32_t sa, int32_t* sz, rdp_span_aux* userdata)
@@ -117,6 +117,7 @@
 #define SPAN_Z      (7)
 
 #define EXTENT_AUX_COUNT            (sizeof(rdp_span_aux)*(480*192)) // Screen coverage *192, more or less
+#define MAX_QUEUED_OBJECTS          (1024) // Primitives queued before draining the pipe; each holds a TMEM copy
 
 /*****************************************************************************/
 
@@ -162,6 +163,7 @@ public:
 	}
 
 	void        process_command_list();
+	void        wait_pipe(const char *debug_reason);
 	uint64_t    read_data(uint32_t address);
 	std::string disassemble(const uint64_t *cmd_buf);
 
@@ -329,6 +331,8 @@ private:
 	void    fill_pixel16(uint32_t curpixel, const rdp_poly_state &object);
 	void    fill_pixel32(uint32_t curpixel, const rdp_poly_state &object);
 
+	void    wait_rdram(uint32_t address, uint32_t length, const char *debug_reason);
+
 	void    precalc_cvmask_derivatives(void);
 	void    z_build_com_table(void);
 
@@ -353,6 +357,8 @@ private:
 	combine_modes_t m_combine;
 	bool            m_pending_mode_block;
 	bool            m_pipe_clean;
+	uint32_t        m_pending_start;    // RDRAM range queued spans may write, in bytes
+	uint32_t        m_pending_end;
 
 	cv_mask_derivative_t cvarray[(1 << 8)];
 
@@ -784,6 +784,7 @@ void model1_state::bank_w(offs_t offset, u16 data, u16 mem_mask)
 		switch(data & 0xf) {
 		case 0x1: // 100000-1fffff data roms banking
 			membank("bank1")->set_base(memregion("maincpu")->base() + 0x1000000 + 0x100000*((data >> 4) & 0x7)); // netmerc has bit 0x80 set when banking, probably not a bank bit.
+			m_maincpu->flush_decode_cache();
 			logerror("BANK %x\n", 0x1000000 + 0x100000*((data >> 4) & 0xf));
 			break;
 		case 0x2: // 200000-2fffff data roms banking (unused, all known games have only one bank)
@@ -229,7 +229,8 @@ protected:
 
 	void model2_3d_frame_start( void );
 	void geo_parse( void );
-	void model2_3d_frame_end( bitmap_rgb32 &bitmap, const rectangle &cliprect );
+	void model2_3d_frame_end( const rectangle &cliprect );
+	void model2_3d_frame_draw( bitmap_rgb32 &bitmap, const rectangle &cliprect );
 	void draw_framebuffer(bitmap_rgb32 &bitmap, const rectangle &cliprect );
 
 	void model2_timers(machine_config &config);
@@ -607,6 +608,7 @@ struct m2_poly_extra_data
 	u32      texx, texy;
 	u8       texmirrorx;
 	u8       texmirrory;
+	u32      texcolor[16];  // final colour for each of the 16 texel values
 };
 
 
@@ -796,6 +796,36 @@ void model2_renderer::model2_3d_render(triangle *tri, const rectangle &cliprect)
 		extra.texmirrory = 0;//(tri->texheader[0] >> 8) & 1;
 		extra.texsheet = (tri->texheader[2] & 0x1000) ? m_state.m_textureram1 : m_state.m_textureram0;
 
+		/* a texel only has 16 possible values, so look up their final colours once per polygon */
+		const u16 *colortable_r = &m_state.m_colorxlat[0x0000/2];
+		const u16 *colortable_g = &m_state.m_colorxlat[0x4000/2];
+		const u16 *colortable_b = &m_state.m_colorxlat[0x8000/2];
+		const u16 *lumaram = &m_state.m_lumaram[0];
+		const u8 *gamma_value = &m_state.m_gamma_table[0];
+		u32 const colorbase = m_state.m_palram[(extra.colorbase + 0x1000)] & 0x7fff;
+
+		colortable_r += ((colorbase >>  0) & 0x1f) << 8;
+		colortable_g += ((colorbase >>  5) & 0x1f) << 8;
+		colortable_b += ((colorbase >> 10) & 0x1f) << 8;
+
+		for (int t = 0; t < 16; t++)
+		{
+			u8 luma = lumaram[(extra.lumabase + (t << 3))];
+
+			// Virtua Striker sets up a luma of 0x40 for national flags on bleachers, fix here.
+			luma = std::min((int)luma,0x3f);
+			// (Again) Virtua Striker seem to lookup colortable with a reversed endianness (stadium ads)
+			// TODO: it breaks Mexican flag colors tho ...
+//          luma^= 1;
+
+			/* we have the 6 bits of luma information along with 5 bits per color component */
+			/* now build and index into the master color lookup table and extract the raw RGB values */
+			u8 const tr = gamma_value[colortable_r[(luma)] & 0xff];
+			u8 const tg = gamma_value[colortable_g[(luma)] & 0xff];
+			u8 const tb = gamma_value[colortable_b[(luma)] & 0xff];
+			extra.texcolor[t] = rgb_t(tr, tg, tb);
+		}
+
 		tri->v[0].pz = 1.0f / (1.0f + tri->v[0].pz);
 		tri->v[0].pu = tri->v[0].pu * tri->v[0].pz * (1.0f / 8.0f);
 		tri->v[0].pv = tri->v[0].pv * tri->v[0].pz * (1.0f / 8.0f);
@@ -891,15 +921,16 @@ void model2_state::model2_3d_frame_start( void )
 	/* reset the triangle list index */
 	raster->tri_list_index = 0;
 
-	/* reset the sorted z list */
-	memset( raster->tri_sorted_list, 0, 0x10000 * sizeof( triangle * ) );
+	/* the sorted z list is left empty by model2_3d_frame_end */
 
 	/* reset the min-max sortable Z values */
 	raster->min_z = 0xFFFF;
 	raster->max_z = 0;
 }
 
-void model2_state::model2_3d_frame_end( bitmap_rgb32 &bitmap, const rectangle &cliprect )
+// queues the frame's triangles on the rasterizer's work queue; they're
+// drawn while the caller carries on until model2_3d_frame_draw()
+void model2_state::model2_3d_frame_end( const rectangle &cliprect )
 {
 	raster_state *raster = m_raster.get();
 	int32_t z;
@@ -930,6 +961,17 @@ void model2_state::model2_3d_frame_end( bitmap_rgb32 &bitmap, const rectangle &c
 			}
 		}
 	}
+
+	/* empty the sorted z list for the next frame; only this range was used */
+	memset( &raster->tri_sorted_list[raster->min_z], 0, (raster->max_z - raster->min_z + 1) * sizeof( triangle * ) );
+}
+
+// waits for the rasterizer and draws its output over the bitmap
+void model2_state::model2_3d_frame_draw( bitmap_rgb32 &bitmap, const rectangle &cliprect )
+{
+	if ( m_raster->tri_list_index == 0 )
+		return;
+
 	m_poly->wait("End of frame");
 
 	copybitmap_trans(bitmap, m_poly->destmap(), 0, 0, 0, 0, cliprect, 0x00000000);
@@ -2613,15 +2655,19 @@ u32 model2_state::screen_update_model2(screen_device &screen, bitmap_rgb32 &bitm
 		// TODO: move it from here
 		geo_parse();
 
-		/* have the rasterizer output the frame */
-		model2_3d_frame_end( bitmap, cliprect );
+		/* have the rasterizer start on the frame */
+		model2_3d_frame_end( cliprect );
 	}
 
+	/* the upper tile layers go to their own bitmap while the rasterizer runs */
 	m_sys24_bitmap.fill(0, cliprect);
 
 	for (int layer = 3; layer >= 0; layer--)
 		m_tiles->draw(screen, m_sys24_bitmap, cliprect, (layer<<1) | 1, 0, 0);
 
+	if(m_render_test_mode == false)
+		model2_3d_frame_draw( bitmap, cliprect );
+
 	copybitmap_trans(bitmap, m_sys24_bitmap, 0, 0, 0, 0, cliprect, 0);
 
 	return 0;
@@ -117,26 +117,19 @@ void MODEL2_FUNC_NAME(int32_t scanline, const extent_t& extent, const m2_poly_ex
 /* textured render path */
 void MODEL2_FUNC_NAME(int32_t scanline, const extent_t& extent, const m2_poly_extra_data& object, int threadid)
 {
-	model2_state *state = object.state;
 	u32 *const p = &m_destmap.pix(scanline);
 
 	u32  tex_width = object.texwidth;
 	u32  tex_height = object.texheight;
 
-	/* extract color information */
-	const u16 *colortable_r = &state->m_colorxlat[0x0000/2];
-	const u16 *colortable_g = &state->m_colorxlat[0x4000/2];
-	const u16 *colortable_b = &state->m_colorxlat[0x8000/2];
-	const u16 *lumaram = &state->m_lumaram[0];
-	u32  colorbase = object.colorbase;
-	u32  lumabase = object.lumabase;
+	/* the luma, colour table and gamma lookups for each texel value were done at setup */
+	const u32 *texcolor = object.texcolor;
 	u32  tex_x = object.texx;
 	u32  tex_y = object.texy;
 	u32  tex_x_mask, tex_y_mask;
 	u32  tex_mirr_x = object.texmirrorx;
 	u32  tex_mirr_y = object.texmirrory;
 	u32 *sheet = object.texsheet;
-	u8  *gamma_value = &state->m_gamma_table[0];
 	float ooz = extent.param[0].start;
 	float uoz = extent.param[1].start;
 	float voz = extent.param[2].start;
@@ -148,20 +141,12 @@ void MODEL2_FUNC_NAME(int32_t scanline, const extent_t& extent, const m2_poly_ex
 	tex_x_mask  = tex_width - 1;
 	tex_y_mask  = tex_height - 1;
 
-	colorbase = state->m_palram[(colorbase + 0x1000)] & 0x7fff;
-
-	colortable_r += ((colorbase >>  0) & 0x1f) << 8;
-	colortable_g += ((colorbase >>  5) & 0x1f) << 8;
-	colortable_b += ((colorbase >> 10) & 0x1f) << 8;
-
 	for(x = extent.startx; x < extent.stopx; x++, uoz += duoz, voz += dvoz, ooz += dooz)
 	{
 		float z = recip_approx(ooz) * 256.0f;
 		int32_t u = uoz * z;
 		int32_t v = voz * z;
-		int  tr, tg, tb;
 		u16  t;
-		u8 luma;
 		int u2;
 		int v2;
 
@@ -184,24 +169,7 @@ void MODEL2_FUNC_NAME(int32_t scanline, const extent_t& extent, const m2_poly_ex
 		if ( t == 0x0f )
 			continue;
 #endif
-		luma = lumaram[(lumabase + (t << 3))];
-
-		// Virtua Striker sets up a luma of 0x40 for national flags on bleachers, fix here.
-		luma = std::min((int)luma,0x3f);
-		// (Again) Virtua Striker seem to lookup colortable with a reversed endianness (stadium ads)
-		// TODO: it breaks Mexican flag colors tho ...
-//      luma^= 1;
-
-		/* we have the 6 bits of luma information along with 5 bits per color component */
-		/* now build and index into the master color lookup table and extract the raw RGB values */
-		tr = colortable_r[(luma)] & 0xff;
-		tg = colortable_g[(luma)] & 0xff;
-		tb = colortable_b[(luma)] & 0xff;
-		tr = gamma_value[tr];
-		tg = gamma_value[tg];
-		tb = gamma_value[tb];
-
-		p[x] = rgb_t(tr, tg, tb);
+		p[x] = texcolor[t];
 	}
 }
 
@@ -67,6 +67,58 @@ struct m3_triangle
 	int color;
 };
 
+// one polygon of a model, as decoded from polygon RAM or VROM
+struct m3_model_polygon
+{
+	uint32_t header[7];
+	int num_vertices;
+	m3_vertex vertex[4];
+};
+
+// everything a model's transformed vertices depend on besides the model itself
+struct m3_transform_state
+{
+	MATRIX transform;
+	MATRIX vp;
+	VECTOR3 parallel_light;
+	float parallel_light_intensity;
+	float ambient_light_intensity;
+	float viewport_x;
+	float viewport_y;
+	float viewport_width;
+	float viewport_height;
+	float viewport_near;
+	float viewport_far;
+
+	bool operator==(const m3_transform_state &that) const { return !memcmp(this, &that, sizeof(*this)); }
+};
+
+// a model transformed, lit and clipped under one transform state: the
+// clipped vertex count of each polygon, followed by their vertices
+struct m3_model_instance
+{
+	m3_transform_state state;
+	std::vector<uint8_t> counts;
+	std::vector<m3_clip_vertex> vertices;
+	uint32_t frame = 0;
+};
+
+struct m3_cached_model
+{
+	std::vector<m3_model_polygon> polys;
+	std::vector<std::unique_ptr<m3_model_instance>> instances;
+};
+
+// a model reached by the scene graph traversal, drawn when its viewport is flushed
+struct m3_model_job
+{
+	const m3_cached_model *model;
+	m3_model_instance *instance;
+	bool transform;
+	std::unique_ptr<m3_cached_model> transient_model;
+	std::unique_ptr<m3_model_instance> transient_instance;
+};
+
 struct model3_polydata
 {
 	cached_texture *texture;
@@ -305,6 +357,11 @@ private:
 	int m_tri_alpha_buffer_ptr = 0;
 	int m_viewport_tri_index[4]{};
 	int m_viewport_tri_alpha_index[4]{};
+	std::unordered_map<uint32_t, std::unique_ptr<m3_cached_model>> m_model_cache;
+	std::vector<m3_model_job> m_model_jobs;
+	std::vector<m3_model_job *> m_model_transforms;
+	osd_work_queue *m_model_queue = nullptr;
+	uint32_t m_model_cache_frame = 0;
 
 	uint32_t rtc72421_r(offs_t offset);
 	void rtc72421_w(offs_t offset, uint32_t data);
@@ -404,6 +461,11 @@ private:
 	void multiply_matrix_stack(MATRIX matrix);
 	void translate_matrix_stack(float x, float y, float z);
 	void draw_model(uint32_t addr);
+	void decode_model(const uint32_t *model, m3_cached_model &out);
+	static void transform_model(const m3_cached_model &model, m3_model_instance &instance);
+	static void *transform_model_callback(void *param, int threadid);
+	void flush_models();
+	void purge_model_cache();
 	uint32_t *get_memory_pointer(uint32_t address);
 	void set_projection(float left, float right, float top, float bottom, float near, float far);
 	void load_matrix(int matrix_num, MATRIX *out);
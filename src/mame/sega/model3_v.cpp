@@ -104,6 +104,12 @@ void model3_state::model3_exit()
 
 	invalidate_texture(0, 0, 0, 6, 5);
 	invalidate_texture(1, 0, 0, 6, 5);
+
+	if (m_model_queue)
+	{
+		osd_work_queue_free(m_model_queue);
+		m_model_queue = nullptr;
+	}
 }
 
 void model3_state::video_start()
@@ -138,6 +144,8 @@ void model3_state::video_start()
 	m_tri_buffer = std::make_unique<m3_triangle[]>(TRI_BUFFER_SIZE);
 	m_tri_alpha_buffer = std::make_unique<m3_triangle[]>(TRI_ALPHA_BUFFER_SIZE);
 
+	m_model_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&model3_state::model3_exit, this));
 
 	m_m3_char_ram = make_unique_clear<uint64_t[]>(0x100000/8);
@@ -1326,13 +1334,13 @@ void model3_state::real3d_cmd_w(uint64_t data)
 /*****************************************************************************/
 /* matrix and vector operations */
 
-static inline float dot_product3(VECTOR3 a, VECTOR3 b)
+static inline float dot_product3(const VECTOR3 a, const VECTOR3 b)
 {
 	return (a[0] * b[0]) + (a[1] * b[1]) + (a[2] * b[2]);
 }
 
 /* multiplies a 4-element vector by a 4x4 matrix */
-static void matrix_multiply_vector(MATRIX matrix, const VECTOR v, VECTOR *p)
+static void matrix_multiply_vector(const MATRIX matrix, const VECTOR v, VECTOR *p)
 {
 	(*p)[0] = (v[0] * matrix[0][0]) + (v[1] * matrix[1][0]) + (v[2] * matrix[2][0]) + (v[3] * matrix[3][0]);
 	(*p)[1] = (v[0] * matrix[0][1]) + (v[1] * matrix[1][1]) + (v[2] * matrix[2][1]) + (v[3] * matrix[3][1]);
@@ -1482,54 +1490,43 @@ m3_triangle *model3_state::push_triangle(bool alpha)
 	}
 }
 
-void model3_state::draw_model(uint32_t addr)
-{
-	// Polygon RAM is mapped to the low 4MB of VROM
-	uint32_t *model = (addr >= 0x100000) ? &m_vrom[addr] :  &m_polygon_ram[addr];
+/*
+    Models are drawn in two passes.  The display list traversal only
+    records which model is drawn under which transform state; when a
+    viewport is finished, flush_models() transforms, lights and clips the
+    recorded models on a work queue and then emits their triangles in the
+    order they were reached.
+
+    VROM models never change, so their decoded polygons are kept in
+    m_model_cache, along with the transformed result for each transform
+    state they were drawn under.  A model drawn with the same matrices and
+    viewport as in the previous frame - static scenery - skips the
+    transform entirely.  Colours looked up from polygon RAM and textures
+    are resolved when the triangles are emitted, so a cached transform
+    stays valid when either changes.  Models in polygon RAM are decoded
+    afresh every time they are drawn.
+*/
 
-	uint32_t header[7];
+void model3_state::decode_model(const uint32_t *model, m3_cached_model &out)
+{
 	int index = 0;
-	bool last_polygon = false, first_polygon = true, back_face = false;
-	int num_vertices;
-	int i, v, vi;
+	bool last_polygon = false, first_polygon = true;
 	float fixed_point_fraction;
-	m3_vertex vertex[4];
 	m3_vertex prev_vertex[4];
-	m3_clip_vertex clip_vert[10];
-
-	MATRIX transform_matrix;
-	MATRIX vp_matrix;
-	MATRIX coord_matrix;
-
-	memset(&coord_matrix, 0, sizeof(coord_matrix));
-	coord_matrix[0][0] = m_coordinate_system[0][1];
-	coord_matrix[1][1] = m_coordinate_system[1][2];
-	coord_matrix[2][2] = -m_coordinate_system[2][0];
-	coord_matrix[3][3] = 1.0f;
 
 	if (m_step < 0x15)      // position coordinates are 17.7 fixed-point in Step 1.0
 		fixed_point_fraction = 1.0f / 128.0f;
 	else                    // 13.11 fixed-point in other Steps
 		fixed_point_fraction = 1.0f / 2048.0f;
 
-	get_top_matrix(&transform_matrix);
-
-	// make view-projection matrix
-	matrix_multiply(transform_matrix, coord_matrix, &transform_matrix);
-	matrix_multiply(transform_matrix, m_projection_matrix, &vp_matrix);
-
 	memset(prev_vertex, 0, sizeof(prev_vertex));
 
 	while (!last_polygon)
 	{
-		float texture_coord_scale;
-		uint32_t color;
-		VECTOR3 normal;
-		VECTOR3 sn;
-		VECTOR p[4];
-		int polygon_transparency;
+		m3_model_polygon poly;
+		uint32_t *header = poly.header;
 
-		for (i = 0; i < 7; i++)
+		for (int i = 0; i < 7; i++)
 			header[i] = model[index++];
 
 		if (first_polygon && (header[0] & 0x0f) != 0)
@@ -1545,113 +1542,134 @@ void model3_state::draw_model(uint32_t addr)
 		if ((header[0] & 0x300) == 0x300)       // TODO: broken polygons in srally2 have these bits set
 			return;
 
-		num_vertices = (header[0] & 0x40) ? 4 : 3;
+		if (header[6] & 0x0000400)
+		{
+			int tex_width = ((header[3] >> 3) & 0x7);
+			int tex_height = (header[3] & 0x7);
 
-		/* texture coordinates are 16.0 or 13.3 fixed-point */
-		texture_coord_scale = (header[1] & 0x40) ? 1.0f : (1.0f / 8.0f);
+			if (tex_width >= 6 || tex_height >= 6)      // srally2 poly ram has degenerate polys with 2k tex size (cpu bug or intended?)
+				return;
+		}
 
-		/* polygon normal (sign + 1.22 fixed-point) */
-		normal[0] = (float)((int32_t)header[1] >> 8) * (1.0f / 4194304.0f);
-		normal[1] = (float)((int32_t)header[2] >> 8) * (1.0f / 4194304.0f);
-		normal[2] = (float)((int32_t)header[3] >> 8) * (1.0f / 4194304.0f);
+		poly.num_vertices = (header[0] & 0x40) ? 4 : 3;
 
 		/* load reused vertices */
-		vi = 0;
-		for (v = 0; v < 4; v++)
+		int vi = 0;
+		for (int v = 0; v < 4; v++)
 			if (header[0] & (1 << v))
-				vertex[vi++] = prev_vertex[v];
+				poly.vertex[vi++] = prev_vertex[v];
 
 		/* load new vertices */
-		for ( ; vi < num_vertices; vi++)
+		for ( ; vi < poly.num_vertices; vi++)
 		{
 			uint32_t xw = model[index++];
 			uint32_t yw = model[index++];
 			uint32_t zw = model[index++];
 
-			vertex[vi].x = (float)((int32_t)(xw) >> 8) * fixed_point_fraction;
-			vertex[vi].y = (float)((int32_t)(yw) >> 8) * fixed_point_fraction;
-			vertex[vi].z = (float)((int32_t)(zw) >> 8) * fixed_point_fraction;
-			vertex[vi].u = (uint16_t)(model[index] >> 16);
-			vertex[vi].v = (uint16_t)(model[index++]);
-//          vertex[vi].nx = normal[0] + ((float)((int8_t)(xw)) / 127.0f);
-//          vertex[vi].ny = normal[1] + ((float)((int8_t)(yw)) / 127.0f);
-//          vertex[vi].nz = normal[2] + ((float)((int8_t)(zw)) / 127.0f);
-
-			vertex[vi].nx = ((float)((int8_t)(xw)) / 127.0f);
-			vertex[vi].ny = ((float)((int8_t)(yw)) / 127.0f);
-			vertex[vi].nz = ((float)((int8_t)(zw)) / 127.0f);
+			poly.vertex[vi].x = (float)((int32_t)(xw) >> 8) * fixed_point_fraction;
+			poly.vertex[vi].y = (float)((int32_t)(yw) >> 8) * fixed_point_fraction;
+			poly.vertex[vi].z = (float)((int32_t)(zw) >> 8) * fixed_point_fraction;
+			poly.vertex[vi].u = (uint16_t)(model[index] >> 16);
+			poly.vertex[vi].v = (uint16_t)(model[index++]);
+//          poly.vertex[vi].nx = normal[0] + ((float)((int8_t)(xw)) / 127.0f);
+//          poly.vertex[vi].ny = normal[1] + ((float)((int8_t)(yw)) / 127.0f);
+//          poly.vertex[vi].nz = normal[2] + ((float)((int8_t)(zw)) / 127.0f);
+
+			poly.vertex[vi].nx = ((float)((int8_t)(xw)) / 127.0f);
+			poly.vertex[vi].ny = ((float)((int8_t)(yw)) / 127.0f);
+			poly.vertex[vi].nz = ((float)((int8_t)(zw)) / 127.0f);
 		}
 
 		/* Copy current vertices as previous vertices */
-		memcpy(prev_vertex, vertex, sizeof(m3_vertex) * 4);
+		memcpy(prev_vertex, poly.vertex, sizeof(m3_vertex) * 4);
 
-		if (header[1] & 0x2)
-		{
-			color = (header[4] >> 8) & 0xffffff;
-		}
-		else
-		{
-			int ci = (header[4] >> 8) & 0x7ff;
-			color = m_polygon_ram[0x400 + ci];
-		}
+		out.polys.push_back(poly);
+	}
+}
 
-		polygon_transparency =  (header[6] & 0x800000) ? 32 : ((header[6] >> 18) & 0x1f);
+void model3_state::transform_model(const m3_cached_model &model, m3_model_instance &instance)
+{
+	const m3_transform_state &state = instance.state;
+	m3_clip_vertex clip_vert[10];
+
+	instance.counts.clear();
+	instance.vertices.clear();
+	instance.counts.reserve(model.polys.size());
+
+	for (const m3_model_polygon &poly : model.polys)
+	{
+		const uint32_t *header = poly.header;
+		int num_vertices = poly.num_vertices;
+		float texture_coord_scale;
+		VECTOR3 normal;
+		VECTOR3 sn;
+		VECTOR p[4];
+		bool back_face;
+
+		/* texture coordinates are 16.0 or 13.3 fixed-point */
+		texture_coord_scale = (header[1] & 0x40) ? 1.0f : (1.0f / 8.0f);
+
+		/* polygon normal (sign + 1.22 fixed-point) */
+		normal[0] = (float)((int32_t)header[1] >> 8) * (1.0f / 4194304.0f);
+		normal[1] = (float)((int32_t)header[2] >> 8) * (1.0f / 4194304.0f);
+		normal[2] = (float)((int32_t)header[3] >> 8) * (1.0f / 4194304.0f);
 
 		/* transform polygon normal to view-space */
-		sn[0] = (normal[0] * transform_matrix[0][0]) +
-				(normal[1] * transform_matrix[0][1]) +
-				(normal[2] * transform_matrix[0][2]);
-		sn[1] = (normal[0] * transform_matrix[1][0]) +
-				(normal[1] * transform_matrix[1][1]) +
-				(normal[2] * transform_matrix[1][2]);
-		sn[2] = (normal[0] * transform_matrix[2][0]) +
-				(normal[1] * transform_matrix[2][1]) +
-				(normal[2] * transform_matrix[2][2]);
+		sn[0] = (normal[0] * state.transform[0][0]) +
+				(normal[1] * state.transform[0][1]) +
+				(normal[2] * state.transform[0][2]);
+		sn[1] = (normal[0] * state.transform[1][0]) +
+				(normal[1] * state.transform[1][1]) +
+				(normal[2] * state.transform[1][2]);
+		sn[2] = (normal[0] * state.transform[2][0]) +
+				(normal[1] * state.transform[2][1]) +
+				(normal[2] * state.transform[2][2]);
 
 		// TODO: depth bias
 		// transform and light vertices
-		for (i = 0; i < num_vertices; i++)
+		for (int i = 0; i < num_vertices; i++)
 		{
+			const m3_vertex &vertex = poly.vertex[i];
 			VECTOR vect;
 
-			vect[0] = vertex[i].x;
-			vect[1] = vertex[i].y;
-			vect[2] = vertex[i].z;
+			vect[0] = vertex.x;
+			vect[1] = vertex.y;
+			vect[2] = vertex.z;
 			vect[3] = 1.0f;
 
 			// transform to projection space
-			matrix_multiply_vector(vp_matrix, vect, &p[i]);
+			matrix_multiply_vector(state.vp, vect, &p[i]);
 
 			clip_vert[i].x = p[i][0];
 			clip_vert[i].y = p[i][1];
 			clip_vert[i].z = p[i][2];
 			clip_vert[i].w = p[i][3];
 
-			clip_vert[i].p[0] = vertex[i].u * texture_coord_scale * 256.0f;        // 8 bits of subtexel accuracy for bilinear filtering
-			clip_vert[i].p[1] = vertex[i].v * texture_coord_scale * 256.0f;
+			clip_vert[i].p[0] = vertex.u * texture_coord_scale * 256.0f;        // 8 bits of subtexel accuracy for bilinear filtering
+			clip_vert[i].p[1] = vertex.v * texture_coord_scale * 256.0f;
 
 			// transform vertex normal
 			VECTOR3 n;
-			n[0] = (vertex[i].nx * transform_matrix[0][0]) +
-					(vertex[i].ny * transform_matrix[0][1]) +
-					(vertex[i].nz * transform_matrix[0][2]);
-			n[1] = (vertex[i].nx * transform_matrix[1][0]) +
-					(vertex[i].ny * transform_matrix[1][1]) +
-					(vertex[i].nz * transform_matrix[1][2]);
-			n[2] = (vertex[i].nx * transform_matrix[2][0]) +
-					(vertex[i].ny * transform_matrix[2][1]) +
-					(vertex[i].nz * transform_matrix[2][2]);
+			n[0] = (vertex.nx * state.transform[0][0]) +
+					(vertex.ny * state.transform[0][1]) +
+					(vertex.nz * state.transform[0][2]);
+			n[1] = (vertex.nx * state.transform[1][0]) +
+					(vertex.ny * state.transform[1][1]) +
+					(vertex.nz * state.transform[1][2]);
+			n[2] = (vertex.nx * state.transform[2][0]) +
+					(vertex.ny * state.transform[2][1]) +
+					(vertex.nz * state.transform[2][2]);
 
 			// lighting
 			float intensity;
 			if ((header[6] & 0x10000) == 0)
 			{
-				float dot = dot_product3(n, m_parallel_light);
+				float dot = dot_product3(n, state.parallel_light);
 
 				if (header[1] & 0x10)
 					dot = fabs(dot);
 
-				intensity = ((dot * m_parallel_light_intensity) + m_ambient_light_intensity) * 255.0f;
+				intensity = ((dot * state.parallel_light_intensity) + state.ambient_light_intensity) * 255.0f;
 				if (intensity > 255.0f)
 				{
 					intensity = 255.0f;
@@ -1673,7 +1691,7 @@ void model3_state::draw_model(uint32_t addr)
 		num_vertices = frustum_clip_all<float, 4>(clip_vert, num_vertices, clip_vert);
 
 		/* divide by W, transform to screen coords */
-		for(i=0; i < num_vertices; i++)
+		for (int i = 0; i < num_vertices; i++)
 		{
 			float oow = 1.0f / clip_vert[i].w;
 
@@ -1683,9 +1701,9 @@ void model3_state::draw_model(uint32_t addr)
 			clip_vert[i].p[0] *= oow;
 			clip_vert[i].p[1] *= oow;
 
-			clip_vert[i].x = (((clip_vert[i].x * 0.5f) + 0.5f) * m_viewport_width) + m_viewport_x;
-			clip_vert[i].y = (((clip_vert[i].y * 0.5f) + 0.5f) * m_viewport_height) + m_viewport_y;
-			clip_vert[i].z = (((clip_vert[i].z * 0.5f) + 0.5f) * (m_viewport_far - m_viewport_near)) + m_viewport_near;
+			clip_vert[i].x = (((clip_vert[i].x * 0.5f) + 0.5f) * state.viewport_width) + state.viewport_x;
+			clip_vert[i].y = (((clip_vert[i].y * 0.5f) + 0.5f) * state.viewport_height) + state.viewport_y;
+			clip_vert[i].z = (((clip_vert[i].z * 0.5f) + 0.5f) * (state.viewport_far - state.viewport_near)) + state.viewport_near;
 		}
 
 		/* backface culling */
@@ -1703,59 +1721,208 @@ void model3_state::draw_model(uint32_t addr)
 
 		back_face = 0;
 
-		if (!back_face)
+		if (back_face)
+			num_vertices = 0;
+
+		instance.counts.push_back(num_vertices);
+		instance.vertices.insert(instance.vertices.end(), &clip_vert[0], &clip_vert[num_vertices]);
+	}
+}
+
+void *model3_state::transform_model_callback(void *param, int threadid)
+{
+	m3_model_job &job = **reinterpret_cast<m3_model_job **>(param);
+	transform_model(*job.model, *job.instance);
+	return nullptr;
+}
+
+void model3_state::draw_model(uint32_t addr)
+{
+	m3_model_job &job = m_model_jobs.emplace_back();
+	m3_transform_state state;
+	MATRIX coord_matrix;
+
+	memset(&coord_matrix, 0, sizeof(coord_matrix));
+	coord_matrix[0][0] = m_coordinate_system[0][1];
+	coord_matrix[1][1] = m_coordinate_system[1][2];
+	coord_matrix[2][2] = -m_coordinate_system[2][0];
+	coord_matrix[3][3] = 1.0f;
+
+	// zero the whole key so that any padding compares equal
+	memset(&state, 0, sizeof(state));
+
+	get_top_matrix(&state.transform);
+
+	// make view-projection matrix
+	matrix_multiply(state.transform, coord_matrix, &state.transform);
+	matrix_multiply(state.transform, m_projection_matrix, &state.vp);
+
+	state.parallel_light[0] = m_parallel_light[0];
+	state.parallel_light[1] = m_parallel_light[1];
+	state.parallel_light[2] = m_parallel_light[2];
+	state.parallel_light_intensity = m_parallel_light_intensity;
+	state.ambient_light_intensity = m_ambient_light_intensity;
+	state.viewport_x = m_viewport_x;
+	state.viewport_y = m_viewport_y;
+	state.viewport_width = m_viewport_width;
+	state.viewport_height = m_viewport_height;
+	state.viewport_near = m_viewport_near;
+	state.viewport_far = m_viewport_far;
+
+	// Polygon RAM is mapped to the low 4MB of VROM
+	if (addr < 0x100000)
+	{
+		job.transient_model = std::make_unique<m3_cached_model>();
+		job.transient_instance = std::make_unique<m3_model_instance>();
+		decode_model(&m_polygon_ram[addr], *job.transient_model);
+		job.transient_instance->state = state;
+		job.model = job.transient_model.get();
+		job.instance = job.transient_instance.get();
+		job.transform = true;
+		return;
+	}
+
+	std::unique_ptr<m3_cached_model> &model = m_model_cache[addr];
+	if (!model)
+	{
+		model = std::make_unique<m3_cached_model>();
+		decode_model(&m_vrom[addr], *model);
+	}
+	job.model = model.get();
+
+	for (std::unique_ptr<m3_model_instance> &instance : model->instances)
+	{
+		if (instance->state == state)
 		{
-			bool colormod = false;
-			cached_texture* texture;
+			// a model drawn twice under one state in this frame is only transformed once
+			instance->frame = m_model_cache_frame;
+			job.instance = instance.get();
+			job.transform = false;
+			return;
+		}
+	}
 
-			if (header[6] & 0x0000400)
-			{
-				int tex_x = ((header[4] & 0x1f) << 1) | ((header[5] >> 7) & 0x1);
-				int tex_y = (header[5] & 0x1f);
-				int tex_width = ((header[3] >> 3) & 0x7);
-				int tex_height = (header[3] & 0x7);
-				int tex_format = (header[6] >> 7) & 0x7;
+	m3_model_instance &instance = *model->instances.emplace_back(std::make_unique<m3_model_instance>());
+	instance.state = state;
+	instance.frame = m_model_cache_frame;
+	job.instance = &instance;
+	job.transform = true;
+}
 
-				if (tex_format != 0 && tex_format != 7)     // enable color modulation if this is not a color texture
-					colormod = true;
+void model3_state::flush_models()
+{
+	m_model_transforms.clear();
+	for (m3_model_job &job : m_model_jobs)
+		if (job.transform)
+			m_model_transforms.push_back(&job);
 
-				if (tex_width >= 6 || tex_height >= 6)      // srally2 poly ram has degenerate polys with 2k tex size (cpu bug or intended?)
-					return;
+	if (m_model_queue && m_model_transforms.size() > 1)
+	{
+		osd_work_item_queue_multiple(m_model_queue, transform_model_callback, m_model_transforms.size(), &m_model_transforms[0], sizeof(m_model_transforms[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(m_model_queue, osd_ticks_per_second())) { }
+	}
+	else
+	{
+		for (m3_model_job *job : m_model_transforms)
+			transform_model(*job->model, *job->instance);
+	}
 
-				texture = get_texture((header[4] & 0x40) ? 1 : 0, tex_x, tex_y, tex_width, tex_height, tex_format);
-			}
-			else
-			{
-				texture = nullptr;
-			}
+	for (m3_model_job &job : m_model_jobs)
+	{
+		const m3_model_instance &instance = *job.instance;
+		const m3_clip_vertex *clip_vert = instance.vertices.data();
+		bool full = false;
+
+		for (int pi = 0; pi < instance.counts.size() && !full; pi++)
+		{
+			const uint32_t *header = job.model->polys[pi].header;
+			int num_vertices = instance.counts[pi];
 
-			for (i=2; i < num_vertices; i++)
+			if (num_vertices >= 3)
 			{
-				bool alpha = (header[6] & 0x1) || ((header[6] & 0x800000) == 0);        // put to alpha buffer if there's any transparency involved
-				m3_triangle* tri = push_triangle(alpha);
-
-				// bail out if tri buffer is maxed out (happens during harley boot)
-				if (!tri)
-					return;
-
-				memcpy(&tri->v[0], &clip_vert[0], sizeof(m3_clip_vertex));
-				memcpy(&tri->v[1], &clip_vert[i-1], sizeof(m3_clip_vertex));
-				memcpy(&tri->v[2], &clip_vert[i], sizeof(m3_clip_vertex));
-
-				tri->texture = texture;
-				tri->transparency = polygon_transparency;
-				tri->color = color;
-
-				tri->param = 0;
-				tri->param |= (header[4] & 0x40) ? TRI_PARAM_TEXTURE_PAGE : 0;
-				tri->param |= (header[6] & 0x00000400) ? TRI_PARAM_TEXTURE_ENABLE : 0;
-				tri->param |= (header[2] & 0x2) ? TRI_PARAM_TEXTURE_MIRROR_U : 0;
-				tri->param |= (header[2] & 0x1) ? TRI_PARAM_TEXTURE_MIRROR_V : 0;
-				tri->param |= (header[6] & 0x80000000) ? TRI_PARAM_ALPHA_TEST : 0;
-				tri->param |= (colormod) ? TRI_PARAM_COLOR_MOD : 0;
+				uint32_t color;
+				int polygon_transparency;
+				bool colormod = false;
+				cached_texture* texture;
+
+				if (header[1] & 0x2)
+				{
+					color = (header[4] >> 8) & 0xffffff;
+				}
+				else
+				{
+					int ci = (header[4] >> 8) & 0x7ff;
+					color = m_polygon_ram[0x400 + ci];
+				}
+
+				polygon_transparency =  (header[6] & 0x800000) ? 32 : ((header[6] >> 18) & 0x1f);
+
+				if (header[6] & 0x0000400)
+				{
+					int tex_x = ((header[4] & 0x1f) << 1) | ((header[5] >> 7) & 0x1);
+					int tex_y = (header[5] & 0x1f);
+					int tex_width = ((header[3] >> 3) & 0x7);
+					int tex_height = (header[3] & 0x7);
+					int tex_format = (header[6] >> 7) & 0x7;
+
+					if (tex_format != 0 && tex_format != 7)     // enable color modulation if this is not a color texture
+						colormod = true;
+
+					texture = get_texture((header[4] & 0x40) ? 1 : 0, tex_x, tex_y, tex_width, tex_height, tex_format);
+				}
+				else
+				{
+					texture = nullptr;
+				}
+
+				for (int i = 2; i < num_vertices; i++)
+				{
+					bool alpha = (header[6] & 0x1) || ((header[6] & 0x800000) == 0);        // put to alpha buffer if there's any transparency involved
+					m3_triangle* tri = push_triangle(alpha);
+
+					// bail out if tri buffer is maxed out (happens during harley boot)
+					if (!tri)
+					{
+						full = true;
+						break;
+					}
+
+					memcpy(&tri->v[0], &clip_vert[0], sizeof(m3_clip_vertex));
+					memcpy(&tri->v[1], &clip_vert[i-1], sizeof(m3_clip_vertex));
+					memcpy(&tri->v[2], &clip_vert[i], sizeof(m3_clip_vertex));
+
+					tri->texture = texture;
+					tri->transparency = polygon_transparency;
+					tri->color = color;
+
+					tri->param = 0;
+					tri->param |= (header[4] & 0x40) ? TRI_PARAM_TEXTURE_PAGE : 0;
+					tri->param |= (header[6] & 0x00000400) ? TRI_PARAM_TEXTURE_ENABLE : 0;
+					tri->param |= (header[2] & 0x2) ? TRI_PARAM_TEXTURE_MIRROR_U : 0;
+					tri->param |= (header[2] & 0x1) ? TRI_PARAM_TEXTURE_MIRROR_V : 0;
+					tri->param |= (header[6] & 0x80000000) ? TRI_PARAM_ALPHA_TEST : 0;
+					tri->param |= (colormod) ? TRI_PARAM_COLOR_MOD : 0;
+				}
 			}
+
+			clip_vert += num_vertices;
 		}
 	}
+
+	m_model_jobs.clear();
+}
+
+void model3_state::purge_model_cache()
+{
+	// drop the transforms that weren't reused this frame; the rest are likely to be reused in the next
+	for (auto &entry : m_model_cache)
+	{
+		std::vector<std::unique_ptr<m3_model_instance>> &instances = entry.second->instances;
+		instances.erase(
+				std::remove_if(instances.begin(), instances.end(), [this] (const std::unique_ptr<m3_model_instance> &instance) { return instance->frame != m_model_cache_frame; }),
+				instances.end());
+	}
+	m_model_cache_frame++;
 }
 
 
@@ -1978,7 +2145,10 @@ void model3_state::real3d_traverse_display_list()
 		m_viewport_tri_index[pri] = m_tri_buffer_ptr;
 		m_viewport_tri_alpha_index[pri] = m_tri_alpha_buffer_ptr;
 		draw_viewport(pri, 0x800000);
+		flush_models();
 	}
+
+	purge_model_cache();
 }
 
 void model3_renderer::draw(bitmap_rgb32 &bitmap, const rectangle &cliprect)
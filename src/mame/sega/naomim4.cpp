@@ -74,6 +74,7 @@ void naomi_m4_board::device_start()
 
 	save_pointer(NAME(buffer), BUFFER_SIZE);
 	save_item(NAME(rom_cur_address));
+	save_item(NAME(buffer_start));
 	save_item(NAME(buffer_actual_size));
 	save_item(NAME(encryption));
 	save_item(NAME(cfi_mode));
@@ -112,6 +113,7 @@ void naomi_m4_board::device_reset()
 {
 	naomi_board::device_reset();
 	rom_cur_address = 0;
+	buffer_start = 0;
 	buffer_actual_size = 0;
 	encryption = false;
 	cfi_mode = false;
@@ -145,8 +147,8 @@ void naomi_m4_board::board_get_buffer(uint8_t *&base, uint32_t &limit)
 	}
 
 	if(encryption) {
-		base = buffer.get();
-		limit = BUFFER_SIZE;
+		base = buffer.get() + buffer_start;
+		limit = buffer_actual_size - buffer_start;
 
 	} else {
 		uint32_t size = m_region->bytes();
@@ -164,12 +166,18 @@ void naomi_m4_board::board_get_buffer(uint8_t *&base, uint32_t &limit)
 void naomi_m4_board::board_advance(uint32_t size)
 {
 	if(encryption) {
-		if(size < buffer_actual_size) {
-			memmove(buffer.get(), buffer.get() + size, buffer_actual_size - size);
-			buffer_actual_size -= size;
-		} else
+		// only top the buffer up once half of it has been consumed, so short reads don't shift the whole buffer
+		buffer_start += size;
+		if(buffer_start >= buffer_actual_size) {
+			buffer_start = 0;
 			buffer_actual_size = 0;
-		enc_fill();
+		}
+		if(buffer_actual_size - buffer_start < BUFFER_SIZE / 2) {
+			memmove(buffer.get(), buffer.get() + buffer_start, buffer_actual_size - buffer_start);
+			buffer_actual_size -= buffer_start;
+			buffer_start = 0;
+			enc_fill();
+		}
 
 	} else
 		rom_cur_address += size;
@@ -177,6 +185,7 @@ void naomi_m4_board::board_advance(uint32_t size)
 
 void naomi_m4_board::enc_reset()
 {
+	buffer_start = 0;
 	buffer_actual_size = 0;
 	iv = 0;
 	counter = 0;
@@ -190,17 +199,32 @@ uint16_t naomi_m4_board::decrypt_one_round(uint16_t word, uint16_t subkey)
 void naomi_m4_board::enc_fill()
 {
 	const uint8_t *base = m_region->base() + rom_cur_address;
-	while(buffer_actual_size < BUFFER_SIZE) {
+	uint8_t *dst = buffer.get() + buffer_actual_size;
+	uint32_t words = (BUFFER_SIZE - buffer_actual_size) / 2;
+	buffer_actual_size += words * 2;
+	rom_cur_address += words * 2;
+
+	// the feed is reset every 16 words, so whole groups are independent of each other
+	while(words) {
+		if(!counter && words >= 16 * 4) {
+			uint32_t const groups = words / 16;
+			enc_decrypt_groups(base, dst, groups);
+			base += groups * 32;
+			dst += groups * 32;
+			words -= groups * 16;
+			continue;
+		}
+
 		uint16_t enc = base[0] | (base[1] << 8);
 		uint16_t dec = iv;
 		iv = decrypt_one_round(enc ^ iv, subkey1);
 		dec ^= decrypt_one_round(iv, subkey2);
 
-		buffer[buffer_actual_size++] = dec;
-		buffer[buffer_actual_size++] = dec >> 8;
+		*dst++ = dec;
+		*dst++ = dec >> 8;
 
 		base += 2;
-		rom_cur_address += 2;
+		words--;
 
 		counter++;
 		if(counter == 16) {
@@ -210,6 +234,39 @@ void naomi_m4_board::enc_fill()
 	}
 }
 
+void naomi_m4_board::enc_decrypt_groups(const uint8_t *src, uint8_t *dst, uint32_t groups)
+{
+	// decrypt four groups side by side so their table lookups overlap
+	const uint16_t *const table = one_round.get();
+	uint16_t const k1 = subkey1, k2 = subkey2;
+	for(; groups >= 4; groups -= 4, src += 32 * 4, dst += 32 * 4) {
+		uint16_t feed[4] = { 0, 0, 0, 0 };
+		for(int word = 0; word < 16; word++) {
+			for(int group = 0; group < 4; group++) {
+				const uint8_t *const s = src + group * 32 + word * 2;
+				uint16_t const enc = s[0] | (s[1] << 8);
+				uint16_t dec = feed[group];
+				feed[group] = table[enc ^ feed[group] ^ k1] ^ k1;
+				dec ^= table[feed[group] ^ k2] ^ k2;
+				uint8_t *const d = dst + group * 32 + word * 2;
+				d[0] = dec;
+				d[1] = dec >> 8;
+			}
+		}
+	}
+	for(; groups; groups--, src += 32, dst += 32) {
+		uint16_t feed = 0;
+		for(int word = 0; word < 16; word++) {
+			uint16_t const enc = src[word * 2] | (src[word * 2 + 1] << 8);
+			uint16_t dec = feed;
+			feed = table[enc ^ feed ^ k1] ^ k1;
+			dec ^= table[feed ^ k2] ^ k2;
+			dst[word * 2] = dec;
+			dst[word * 2 + 1] = dec >> 8;
+		}
+	}
+}
+
 uint16_t naomi_m4_board::m4_id_r()
 {
 	return m4id & 0xff80;
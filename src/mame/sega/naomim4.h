@@ -43,7 +43,7 @@ private:
 	std::unique_ptr<uint16_t[]> one_round;
 
 	std::unique_ptr<uint8_t[]> buffer;
-	uint32_t rom_cur_address, buffer_actual_size;
+	uint32_t rom_cur_address, buffer_start, buffer_actual_size;
 	uint16_t iv;
 	uint8_t counter;
 	bool encryption;
@@ -52,6 +52,7 @@ private:
 	void enc_init();
 	void enc_reset();
 	void enc_fill();
+	void enc_decrypt_groups(const uint8_t *src, uint8_t *dst, uint32_t groups);
 	uint16_t decrypt_one_round(uint16_t word, uint16_t subkey);
 };
 
@@ -984,6 +984,7 @@ void powervr2_device::softreset_w(offs_t offset, uint32_t data, uint32_t mem_mas
 		LOGTACMD("Core Pipeline soft reset\n");
 
 		if (start_render_received == 1) {
+			finish_render();
 			for (int a=0;a < NUM_BUFFERS;a++)
 				if (grab[a].busy == 1)
 					grab[a].busy = 0;
@@ -1001,6 +1002,9 @@ void powervr2_device::startrender_w(address_space &space, uint32_t data)
 	dc_state *state = machine().driver_data<dc_state>();
 	auto profile = g_profiler.start(PROFILER_USER1);
 
+	// the previous render has to reach the framebuffer first
+	finish_render();
+
 	LOGTACMD("Start render, region=%08x, params=%08x\n", region_base, param_base);
 
 	// select buffer to draw using param_base
@@ -1014,13 +1018,19 @@ void powervr2_device::startrender_w(address_space &space, uint32_t data)
 			grab[a].fbwsof1 = fb_w_sof1;
 			grab[a].fbwsof2 = fb_w_sof2;
 
+			m_render_fb_w_ctrl = fb_w_ctrl;
+			m_render_fb_r_ctrl = fb_r_ctrl;
+			m_render_fb_w_sof1 = fb_w_sof1;
+			m_render_fb_w_linestride = fb_w_linestride;
+
 			rectangle clip(0, 1023, 0, 1023);
 
 			// we've got a request to draw, so, draw to the accumulation buffer!
-			// this should really be done for each tile!
+			// this is done a band of tiles at a time on the render queue, while
+			// the CPU carries on until the end of render or a framebuffer read
 			render_to_accumulation_buffer(*fake_accumulationbuffer_bitmap,clip);
 
-			/* copy the tiles to the framebuffer (really the rendering should be in this loop too) */
+			/* collect the tiles to copy to the framebuffer once the render is done */
 			int sizera = fpu_param_cfg & 0x200000 ? 6 : 5;
 			int offsetra=region_base;
 
@@ -1050,12 +1060,7 @@ void powervr2_device::startrender_w(address_space &space, uint32_t data)
 					int y = ((st[0]&0x00003f00)>>8)*32;
 					//printf("tiledata %08x %d %d - %08x %08x %08x %08x %08x\n",st[0],x,y,st[1],st[2],st[3],st[4],st[5]);
 
-					// should render to the accumulation buffer here using pointers we filled in when processing the data
-					// sent to the TA.  HOWEVER, we don't process the TA data and create the real format object lists, so
-					// instead just use these co-ordinates to copy data from our fake full-screnen accumnulation buffer into
-					// the framebuffer
-
-					pvr_accumulationbuffer_to_framebuffer(space, x,y);
+					m_render_tiles.emplace_back(x, y);
 				}
 
 				if (st[0] & 0x80000000)
@@ -1079,6 +1084,9 @@ void powervr2_device::startrender_w(address_space &space, uint32_t data)
 				screen().frame_number(), screen().vpos(), isp_completion
 			);
 			endofrender_timer_isp->adjust(state->m_maincpu->cycles_to_attotime(isp_completion));
+
+			if (!m_render_pending)
+				finish_render();
 			break;
 		}
 	}
@@ -2478,7 +2486,7 @@ inline void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int
 }
 
 template <powervr2_device::pix_sample_fn sample_fn, int group_no>
-inline void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
+inline void powervr2_device::render_span(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti,
 									float y0, float y1,
 									float xl, float xr,
 									float ul, float ur,
@@ -2502,10 +2510,13 @@ inline void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
 	if (std::isnan(y0) || std::isnan(y1))
 		return;
 
-	if(y1 <= 0)
+	// only the lines of the band being drawn, and never below the w-buffer
+	float const miny = cliprect.min_y;
+	float const endy = std::min(cliprect.max_y + 1, 480);
+	if(y1 <= miny)
 		return;
-	if(y1 > 480)
-		y1 = 480;
+	if(y1 > endy)
+		y1 = endy;
 
 	float bl[4], br[4], offl[4], offr[4];
 	memcpy(bl, bl_in, sizeof(bl));
@@ -2513,23 +2524,24 @@ inline void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
 	memcpy(offl, offl_in, sizeof(offl));
 	memcpy(offr, offr_in, sizeof(offr));
 
-	if(y0 < 0) {
-		xl += -dxldy*y0;
-		xr += -dxrdy*y0;
-		ul += -duldy*y0;
-		ur += -durdy*y0;
-		vl += -dvldy*y0;
-		vr += -dvrdy*y0;
-		wl += -dwldy*y0;
-		wr += -dwrdy*y0;
+	if(y0 < miny) {
+		float const skip = miny - y0;
+		xl += dxldy*skip;
+		xr += dxrdy*skip;
+		ul += duldy*skip;
+		ur += durdy*skip;
+		vl += dvldy*skip;
+		vr += dvrdy*skip;
+		wl += dwldy*skip;
+		wr += dwrdy*skip;
 
 		for (idx = 0; idx < 4; idx++) {
-			bl[idx] += -dbldy[idx] * y0;
-			br[idx] += -dbrdy[idx] * y0;
-			offl[idx] += -doldy[idx] * y0;
-			offr[idx] += -dordy[idx] * y0;
+			bl[idx] += dbldy[idx] * skip;
+			br[idx] += dbrdy[idx] * skip;
+			offl[idx] += doldy[idx] * skip;
+			offr[idx] += dordy[idx] * skip;
 		}
-		y0 = 0;
+		y0 = miny;
 	}
 
 	yy0 = round(y0);
@@ -2614,13 +2626,13 @@ void powervr2_device::sort_vertices(const vert *v, int *i0, int *i1, int *i2)
 
 
 template <powervr2_device::pix_sample_fn sample_fn, int group_no>
-inline void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v0, const vert *v1, const vert *v2)
+inline void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti, const vert *v0, const vert *v1, const vert *v2)
 {
 	float dy01, dy02, dy12;
 
 	float dx01dy, dx02dy, dx12dy, du01dy, du02dy, du12dy, dv01dy, dv02dy, dv12dy, dw01dy, dw02dy, dw12dy;
 
-	if(v0->y >= 480 || v2->y < 0)
+	if(v0->y >= std::min(cliprect.max_y + 1, 480) || v2->y < cliprect.min_y)
 		return;
 
 	float db01[4] = {
@@ -2732,15 +2744,15 @@ inline void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti
 			return;
 
 		if(v1->x > v0->x)
-			render_span<sample_fn, group_no>(bitmap, ti, v1->y, v2->y, v0->x, v1->x, v0->u, v1->u, v0->v, v1->v, v0->w, v1->w, v0->b, v1->b, v0->o, v1->o, dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy, db02dy, db12dy, do02dy, do12dy);
+			render_span<sample_fn, group_no>(bitmap, cliprect, ti, v1->y, v2->y, v0->x, v1->x, v0->u, v1->u, v0->v, v1->v, v0->w, v1->w, v0->b, v1->b, v0->o, v1->o, dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy, db02dy, db12dy, do02dy, do12dy);
 		else
-			render_span<sample_fn, group_no>(bitmap, ti, v1->y, v2->y, v1->x, v0->x, v1->u, v0->u, v1->v, v0->v, v1->w, v0->w, v1->b, v0->b, v1->o, v0->o, dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy, db12dy, db02dy, do12dy, do02dy);
+			render_span<sample_fn, group_no>(bitmap, cliprect, ti, v1->y, v2->y, v1->x, v0->x, v1->u, v0->u, v1->v, v0->v, v1->w, v0->w, v1->b, v0->b, v1->o, v0->o, dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy, db12dy, db02dy, do12dy, do02dy);
 
 	} else if(!dy12) {
 		if(v2->x > v1->x)
-			render_span<sample_fn, group_no>(bitmap, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o, dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy, db01dy, db02dy, do01dy, do02dy);
+			render_span<sample_fn, group_no>(bitmap, cliprect, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o, dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy, db01dy, db02dy, do01dy, do02dy);
 		else
-			render_span<sample_fn, group_no>(bitmap, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o, dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy, db02dy, db01dy, do02dy, do01dy);
+			render_span<sample_fn, group_no>(bitmap, cliprect, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o, dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy, db02dy, db01dy, do02dy, do01dy);
 
 	} else {
 			float idk_b[4] = {
@@ -2756,17 +2768,17 @@ inline void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti
 				v0->o[3] + do02dy[3] * dy01
 			};
 		if(dx01dy < dx02dy) {
-			render_span<sample_fn, group_no>(bitmap, ti, v0->y, v1->y,
+			render_span<sample_fn, group_no>(bitmap, cliprect, ti, v0->y, v1->y,
 						v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o,
 						dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy, db01dy, db02dy, do01dy, do02dy);
-			render_span<sample_fn, group_no>(bitmap, ti, v1->y, v2->y,
+			render_span<sample_fn, group_no>(bitmap, cliprect, ti, v1->y, v2->y,
 						v1->x, v0->x + dx02dy*dy01, v1->u, v0->u + du02dy*dy01, v1->v, v0->v + dv02dy*dy01, v1->w, v0->w + dw02dy*dy01, v1->b, idk_b, v1->o, idk_o,
 						dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy, db12dy, db02dy, do12dy, do02dy);
 		} else {
-			render_span<sample_fn, group_no>(bitmap, ti, v0->y, v1->y,
+			render_span<sample_fn, group_no>(bitmap, cliprect, ti, v0->y, v1->y,
 						v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, v0->b, v0->b, v0->o, v0->o,
 						dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy, db02dy, db01dy, do02dy, do01dy);
-			render_span<sample_fn, group_no>(bitmap, ti, v1->y, v2->y,
+			render_span<sample_fn, group_no>(bitmap, cliprect, ti, v1->y, v2->y,
 						v0->x + dx02dy*dy01, v1->x, v0->u + du02dy*dy01, v1->u, v0->v + dv02dy*dy01, v1->v, v0->w + dw02dy*dy01, v1->w, idk_b, v1->b, idk_o, v1->o,
 						dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy, db02dy, db12dy, do02dy, do12dy);
 		}
@@ -2774,7 +2786,7 @@ inline void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti
 }
 
 template <int group_no>
-void powervr2_device::render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v)
+void powervr2_device::render_tri(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti, const vert *v)
 {
 	int i0, i1, i2;
 
@@ -2787,16 +2799,16 @@ void powervr2_device::render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *
 		if (bilinear) {
 			switch (ti->tsinstruction) {
 			case 0:
-				render_tri_sorted<&powervr2_device::sample_textured<0,true>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<0,true>, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 				break;
 			case 1:
-				render_tri_sorted<&powervr2_device::sample_textured<1,true>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<1,true>, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 				break;
 			case 2:
-				render_tri_sorted<&powervr2_device::sample_textured<2,true>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<2,true>, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 				break;
 			case 3:
-				render_tri_sorted<&powervr2_device::sample_textured<3,true>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<3,true>, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 				break;
 			default:
 				/*
@@ -2804,21 +2816,21 @@ void powervr2_device::render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *
 				 * AND'd with 3
 				 */
 				logerror("%s - tsinstruction is 0x%08x\n", (unsigned)ti->tsinstruction);
-				render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 			}
 		} else {
 			switch (ti->tsinstruction) {
 			case 0:
-				render_tri_sorted<&powervr2_device::sample_textured<0,false>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<0,false>, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 				break;
 			case 1:
-				render_tri_sorted<&powervr2_device::sample_textured<1,false>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<1,false>, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 				break;
 			case 2:
-				render_tri_sorted<&powervr2_device::sample_textured<2,false>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<2,false>, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 				break;
 			case 3:
-				render_tri_sorted<&powervr2_device::sample_textured<3,false>, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_textured<3,false>, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 				break;
 			default:
 				/*
@@ -2826,11 +2838,11 @@ void powervr2_device::render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *
 				 * AND'd with 3
 				 */
 				logerror("%s - tsinstruction is 0x%08x\n", (unsigned)ti->tsinstruction);
-				render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+				render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 			}
 		}
 	} else {
-			render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, ti, v+i0, v+i1, v+i2);
+			render_tri_sorted<&powervr2_device::sample_nontextured, group_no>(bitmap, cliprect, ti, v+i0, v+i1, v+i2);
 	}
 }
 
@@ -2864,40 +2876,136 @@ void powervr2_device::render_group_to_accumulation_buffer(bitmap_rgb32 &bitmap,c
 		if(ev == -1)
 			continue;
 
-		for(i=sv; i <= ev; i++)
+		for(i=sv; i <= ev-2; i++)
+		{
+			if (!(debug_dip_status&0x2))
+				render_tri<group_no>(bitmap, cliprect, &ts->ti, grab[rs].verts + i);
+
+		}
+	}
+}
+
+// scale the texture coordinates of a group once, before its strips are
+// drawn by each band
+template <int group_no>
+void powervr2_device::prepare_group_vertices()
+{
+	int rs=renderselect;
+
+	struct poly_group *grp = grab[rs].groups + group_no;
+
+	int ns=grp->strips_size;
+
+	for (int cs=0;cs < ns;cs++)
+	{
+		strip *ts = &grp->strips[cs];
+		int sv = ts->svert;
+		int ev = ts->evert;
+		if(ev == -1)
+			continue;
+
+		for(int i=sv; i <= ev; i++)
 		{
 			vert *tv = grab[rs].verts + i;
 			tv->u = tv->u * ts->ti.sizex * tv->w;
 			tv->v = tv->v * ts->ti.sizey * tv->w;
 		}
+	}
+}
 
-		for(i=sv; i <= ev-2; i++)
-		{
-			if (!(debug_dip_status&0x2))
-				render_tri<group_no>(bitmap, &ts->ti, grab[rs].verts + i);
+// draw everything that falls in one band of lines; bands don't share
+// pixels or w-buffer lines, so they can be drawn at the same time
+void powervr2_device::render_band_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect)
+{
+	for (int y = cliprect.min_y; (y <= cliprect.max_y) && (y < 480); y++)
+		std::fill(std::begin(wbuffer[y]), std::end(wbuffer[y]), 0.0f);
 
-		}
-	}
+	bitmap.fill(m_render_background, cliprect);
+
+	// TODO: modifier volumes
+	render_group_to_accumulation_buffer<DISPLAY_LIST_OPAQUE>(bitmap, cliprect);
+	render_group_to_accumulation_buffer<DISPLAY_LIST_TRANS>(bitmap, cliprect);
+	render_group_to_accumulation_buffer<DISPLAY_LIST_PUNCH_THROUGH>(bitmap, cliprect);
+}
+
+void *powervr2_device::render_band_callback(void *param, int threadid)
+{
+	render_band const &band = *reinterpret_cast<render_band const *>(param);
+	band.device->render_band_to_accumulation_buffer(*band.device->fake_accumulationbuffer_bitmap, band.clip);
+	return nullptr;
 }
 
 void powervr2_device::render_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect) {
 	if (renderselect < 0)
 		return;
 
-	memset(wbuffer, 0x00, sizeof(wbuffer));
-
 	dc_state *state = machine().driver_data<dc_state>();
 	address_space &space = state->m_maincpu->space(AS_PROGRAM);
 
 	// TODO: read ISP/TSP command from isp_background_t instead of assuming Gourad-shaded
 	// full-screen polygon.
-	uint32_t c=space.read_dword(0x05000000+(param_base&0xf00000)+((isp_backgnd_t&0xfffff8)>>1)+(3+3)*4);
-	bitmap.fill(c, cliprect);
+	m_render_background=space.read_dword(0x05000000+(param_base&0xf00000)+((isp_backgnd_t&0xfffff8)>>1)+(3+3)*4);
 
-	// TODO: modifier volumes
-	render_group_to_accumulation_buffer<DISPLAY_LIST_OPAQUE>(bitmap, cliprect);
-	render_group_to_accumulation_buffer<DISPLAY_LIST_TRANS>(bitmap, cliprect);
-	render_group_to_accumulation_buffer<DISPLAY_LIST_PUNCH_THROUGH>(bitmap, cliprect);
+	prepare_group_vertices<DISPLAY_LIST_OPAQUE>();
+	prepare_group_vertices<DISPLAY_LIST_TRANS>();
+	prepare_group_vertices<DISPLAY_LIST_PUNCH_THROUGH>();
+
+	// split the accumulation buffer into bands one tile high
+	int bands = 0;
+	for (int y = cliprect.min_y; y <= cliprect.max_y; y += RENDER_BAND_LINES)
+	{
+		m_render_bands[bands].device = this;
+		m_render_bands[bands].clip.set(cliprect.min_x, cliprect.max_x, y, std::min(y + RENDER_BAND_LINES - 1, cliprect.max_y));
+		bands++;
+	}
+
+	if (m_render_queue)
+	{
+		osd_work_item_queue_multiple(m_render_queue, render_band_callback, bands, m_render_bands, sizeof(m_render_bands[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		m_render_pending = true;
+	}
+	else
+	{
+		for (int i = 0; i < bands; i++)
+			render_band_to_accumulation_buffer(bitmap, m_render_bands[i].clip);
+	}
+}
+
+// wait for the bands to be drawn, then copy the tiles to the framebuffer
+// with the framebuffer settings latched by STARTRENDER
+void powervr2_device::finish_render()
+{
+	if (renderselect < 0 || !grab[renderselect].busy)
+		return;
+
+	if (m_render_pending)
+	{
+		auto profile = g_profiler.start(PROFILER_USER1);
+		while (!osd_work_queue_wait(m_render_queue, osd_ticks_per_second())) { }
+		m_render_pending = false;
+	}
+
+	dc_state *state = machine().driver_data<dc_state>();
+	address_space &space = state->m_maincpu->space(AS_PROGRAM);
+
+	uint32_t const w_ctrl = fb_w_ctrl, r_ctrl = fb_r_ctrl, w_sof1 = fb_w_sof1, w_linestride = fb_w_linestride;
+	fb_w_ctrl = m_render_fb_w_ctrl;
+	fb_r_ctrl = m_render_fb_r_ctrl;
+	fb_w_sof1 = m_render_fb_w_sof1;
+	fb_w_linestride = m_render_fb_w_linestride;
+
+	// should render to the accumulation buffer here using pointers we filled in when processing the data
+	// sent to the TA.  HOWEVER, we don't process the TA data and create the real format object lists, so
+	// instead just use these co-ordinates to copy data from our fake full-screnen accumnulation buffer into
+	// the framebuffer
+	for (std::pair<int, int> const &tile : m_render_tiles)
+		pvr_accumulationbuffer_to_framebuffer(space, tile.first, tile.second);
+	m_render_tiles.clear();
+
+	fb_w_ctrl = w_ctrl;
+	fb_r_ctrl = r_ctrl;
+	fb_w_sof1 = w_sof1;
+	fb_w_linestride = w_linestride;
 
 	grab[renderselect].busy=0;
 }
@@ -3771,6 +3879,8 @@ TIMER_CALLBACK_MEMBER(powervr2_device::endofrender_tsp)
 
 TIMER_CALLBACK_MEMBER(powervr2_device::endofrender_isp)
 {
+	finish_render();
+
 	irq_cb(EOR_ISP_IRQ); // ISP end of render
 	irq_cb(EOR_TSP_IRQ); // TSP end of render
 	irq_cb(EOR_VIDEO_IRQ); // VIDEO end of render
@@ -3813,6 +3923,8 @@ uint32_t powervr2_device::screen_update(screen_device &screen, bitmap_rgb32 &bit
 #endif
 
 	//FIXME: additional Chroma bit
+	finish_render();
+
 	bitmap.fill(rgb_t(0xff, (vo_border_col >> 16) & 0xff,
 							(vo_border_col >> 8 ) & 0xff,
 							(vo_border_col      ) & 0xff), cliprect);
@@ -3907,6 +4019,8 @@ powervr2_device::powervr2_device(const machine_config &mconfig, const char *tag,
 	, device_video_interface(mconfig, *this)
 	, irq_cb(*this)
 	, m_mamedebug(*this, "PVR_DEBUG")
+	, m_render_queue(nullptr)
+	, m_render_pending(false)
 {
 }
 
@@ -3935,6 +4049,8 @@ void powervr2_device::device_start()
 	dma_irq_timer = timer_alloc(FUNC(powervr2_device::pvr_dma_irq), this);
 
 	fake_accumulationbuffer_bitmap = std::make_unique<bitmap_rgb32>(2048,2048);
+	m_render_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	renderselect = -1;
 
 	softreset = 0;
 	param_base = 0;
@@ -4051,8 +4167,25 @@ void powervr2_device::device_start()
 	save_item(NAME(next_y));
 }
 
+void powervr2_device::device_stop()
+{
+	if (m_render_queue)
+	{
+		finish_render();
+		osd_work_queue_free(m_render_queue);
+		m_render_queue = nullptr;
+	}
+}
+
+void powervr2_device::device_pre_save()
+{
+	finish_render();
+}
+
 void powervr2_device::device_reset()
 {
+	finish_render();
+
 	softreset =                 0x00000007;
 	vo_control =                0x00000108;
 	vo_startx =                 0x0000009d;
@@ -339,7 +339,9 @@ public:
 
 protected:
 	virtual void device_start() override;
+	virtual void device_stop() override;
 	virtual void device_reset() override;
+	virtual void device_pre_save() override;
 	ioport_constructor device_input_ports() const override;
 
 private:
@@ -374,6 +376,23 @@ private:
 	// PD DMA registers
 	uint32_t sb_pdstap, sb_pdstar, sb_pdlen, sb_pddir, sb_pdtsel, sb_pden, sb_pdst, sb_pdapro;
 
+	// Deferred rendering: the accumulation buffer is drawn a band of tiles
+	// at a time on a work queue, and copied to the framebuffer at the next
+	// sync point
+	static constexpr int RENDER_BAND_LINES = 32;
+	static constexpr int RENDER_BANDS = 1024 / RENDER_BAND_LINES;
+	struct render_band
+	{
+		powervr2_device *device;
+		rectangle clip;
+	};
+	osd_work_queue *m_render_queue;
+	render_band m_render_bands[RENDER_BANDS];
+	std::vector<std::pair<int, int> > m_render_tiles;
+	uint32_t m_render_background;
+	uint32_t m_render_fb_w_ctrl, m_render_fb_r_ctrl, m_render_fb_w_sof1, m_render_fb_w_linestride;
+	bool m_render_pending;
+
 	// Timer callbacks
 	emu_timer *opaque_irq_timer = nullptr;
 	emu_timer *opaque_modifier_volume_irq_timer = nullptr;
@@ -512,7 +531,7 @@ private:
 									float const offl[4], float const offr[4]);
 
 	template <pix_sample_fn sample_fn, int group_no>
-		inline void render_span(bitmap_rgb32 &bitmap, texinfo *ti,
+		inline void render_span(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti,
 								float y0, float y1,
 								float xl, float xr,
 								float ul, float ur,
@@ -528,18 +547,24 @@ private:
 								float const doldy[4], float const dordy[4]);
 
 	template <pix_sample_fn sample_fn, int group_no>
-		inline void render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti,
+		inline void render_tri_sorted(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti,
 										const vert *v0,
 										const vert *v1, const vert *v2);
 
 	template <int group_no>
-		void render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v);
+		void render_tri(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti, const vert *v);
 
 	template <int group_no>
 		void render_group_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 
+	template <int group_no>
+		void prepare_group_vertices();
+
 	void sort_vertices(const vert *v, int *i0, int *i1, int *i2);
+	void render_band_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect);
+	static void *render_band_callback(void *param, int threadid);
 	void render_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect);
+	void finish_render();
 	void pvr_accumulationbuffer_to_framebuffer(address_space &space, int x, int y);
 	void pvr_drawframebuffer(bitmap_rgb32 &bitmap,const rectangle &cliprect);
 	static uint32_t dilate0(uint32_t value,int bits);
@@ -171,41 +171,43 @@ protected:
 	void stv_vdp1_change_framebuffers( void );
 	void video_update_vdp1( void );
 	void stv_vdp1_process_list( void );
-	void stv_vdp1_set_drawpixel( void );
-
-	void stv_vdp1_draw_normal_sprite(const rectangle &cliprect, int sprite_type);
-	void stv_vdp1_draw_scaled_sprite(const rectangle &cliprect);
-	void stv_vdp1_draw_distorted_sprite(const rectangle &cliprect);
-	void stv_vdp1_draw_poly_line(const rectangle &cliprect);
-	void stv_vdp1_draw_line(const rectangle &cliprect);
-	int x2s(int v);
-	int y2s(int v);
-	void vdp1_fill_quad(const rectangle &cliprect, int patterndata, int xsize, const struct spoint *q);
-	void vdp1_fill_line(const rectangle &cliprect, int patterndata, int xsize, int32_t y, int32_t x1, int32_t x2, int32_t u1, int32_t u2, int32_t v1, int32_t v2);
-	void (saturn_state::*drawpixel)(int x, int y, int patterndata, int offsetcnt);
-	void drawpixel_poly(int x, int y, int patterndata, int offsetcnt);
-	void drawpixel_8bpp_trans(int x, int y, int patterndata, int offsetcnt);
-	void drawpixel_4bpp_notrans(int x, int y, int patterndata, int offsetcnt);
-	void drawpixel_4bpp_trans(int x, int y, int patterndata, int offsetcnt);
-	void drawpixel_generic(int x, int y, int patterndata, int offsetcnt);
-	void vdp1_fill_slope(const rectangle &cliprect, int patterndata, int xsize,
+	struct vdp1_draw_context;
+	void stv_vdp1_draw_commands(vdp1_draw_context &ctx, const rectangle &band);
+	static void *stv_vdp1_draw_band_callback(void *param, int threadid);
+	void stv_vdp1_set_drawpixel(vdp1_draw_context &ctx);
+
+	void stv_vdp1_draw_normal_sprite(vdp1_draw_context &ctx, const rectangle &cliprect, int sprite_type);
+	void stv_vdp1_draw_scaled_sprite(vdp1_draw_context &ctx, const rectangle &cliprect);
+	void stv_vdp1_draw_distorted_sprite(vdp1_draw_context &ctx, const rectangle &cliprect);
+	void stv_vdp1_draw_poly_line(vdp1_draw_context &ctx, const rectangle &cliprect);
+	void stv_vdp1_draw_line(vdp1_draw_context &ctx, const rectangle &cliprect);
+	int x2s(vdp1_draw_context &ctx, int v);
+	int y2s(vdp1_draw_context &ctx, int v);
+	void vdp1_fill_quad(vdp1_draw_context &ctx, const rectangle &cliprect, int patterndata, int xsize, const struct spoint *q);
+	void vdp1_fill_line(vdp1_draw_context &ctx, const rectangle &cliprect, int patterndata, int xsize, int32_t y, int32_t x1, int32_t x2, int32_t u1, int32_t u2, int32_t v1, int32_t v2);
+	void drawpixel_poly(vdp1_draw_context &ctx, int x, int y, int patterndata, int offsetcnt);
+	void drawpixel_8bpp_trans(vdp1_draw_context &ctx, int x, int y, int patterndata, int offsetcnt);
+	void drawpixel_4bpp_notrans(vdp1_draw_context &ctx, int x, int y, int patterndata, int offsetcnt);
+	void drawpixel_4bpp_trans(vdp1_draw_context &ctx, int x, int y, int patterndata, int offsetcnt);
+	void drawpixel_generic(vdp1_draw_context &ctx, int x, int y, int patterndata, int offsetcnt);
+	void vdp1_fill_slope(vdp1_draw_context &ctx, const rectangle &cliprect, int patterndata, int xsize,
 							int32_t x1, int32_t x2, int32_t sl1, int32_t sl2, int32_t *nx1, int32_t *nx2,
 							int32_t u1, int32_t u2, int32_t slu1, int32_t slu2, int32_t *nu1, int32_t *nu2,
 							int32_t v1, int32_t v2, int32_t slv1, int32_t slv2, int32_t *nv1, int32_t *nv2,
 							int32_t _y1, int32_t y2);
-	void stv_vdp1_setup_shading_for_line(int32_t y, int32_t x1, int32_t x2,
+	void stv_vdp1_setup_shading_for_line(vdp1_draw_context &ctx, int32_t y, int32_t x1, int32_t x2,
 												int32_t r1, int32_t g1, int32_t b1,
 												int32_t r2, int32_t g2, int32_t b2);
-	void stv_vdp1_setup_shading_for_slope(
+	void stv_vdp1_setup_shading_for_slope(vdp1_draw_context &ctx,
 							int32_t x1, int32_t x2, int32_t sl1, int32_t sl2, int32_t *nx1, int32_t *nx2,
 							int32_t r1, int32_t r2, int32_t slr1, int32_t slr2, int32_t *nr1, int32_t *nr2,
 							int32_t g1, int32_t g2, int32_t slg1, int32_t slg2, int32_t *ng1, int32_t *ng2,
 							int32_t b1, int32_t b2, int32_t slb1, int32_t slb2, int32_t *nb1, int32_t *nb2,
 							int32_t _y1, int32_t y2);
-	uint16_t stv_vdp1_apply_gouraud_shading( int x, int y, uint16_t pix );
-	void stv_vdp1_setup_shading(const struct spoint* q, const rectangle &cliprect);
-	uint8_t stv_read_gouraud_table( void );
-	void stv_clear_gouraud_shading(void);
+	uint16_t stv_vdp1_apply_gouraud_shading(vdp1_draw_context &ctx, int x, int y, uint16_t pix );
+	void stv_vdp1_setup_shading(vdp1_draw_context &ctx, const struct spoint* q, const rectangle &cliprect);
+	uint8_t stv_read_gouraud_table(vdp1_draw_context &ctx);
+	void stv_clear_gouraud_shading(vdp1_draw_context &ctx);
 
 	void stv_clear_framebuffer( int which_framebuffer );
 	void stv_vdp1_state_save_postload( void );
@@ -228,8 +230,6 @@ protected:
 		struct  stv_vdp1_poly_scanline scanline[512];
 	};
 
-	std::unique_ptr<struct stv_vdp1_poly_scanline_data> stv_vdp1_shading_data;
-
 	struct stv_vdp2_sprite_list
 	{
 		int CMDCTRL = 0, CMDLINK = 0, CMDPMOD = 0, CMDCOLR = 0, CMDSRCA = 0, CMDSIZE = 0, CMDGRDA = 0;
@@ -251,9 +251,41 @@ protected:
 		uint16_t  GB = 0;
 		uint16_t  GC = 0;
 		uint16_t  GD = 0;
-	} stv_gouraud_shading;
+	};
+
+	// everything a VDP1 command draws with; one per band when the bands are drawn in parallel
+	struct vdp1_draw_context
+	{
+		stv_vdp2_sprite_list sprite;
+		_stv_gouraud_shading gouraud;
+		std::unique_ptr<stv_vdp1_poly_scanline_data> shading;
+		void (saturn_state::*drawpixel)(vdp1_draw_context &ctx, int x, int y, int patterndata, int offsetcnt) = nullptr;
+		uint16_t colorbank = 0;
+		int local_x = 0;
+		int local_y = 0;
+	};
+
+	// a drawing command from the list, with the clipping and local co-ordinates in effect for it
+	struct vdp1_command
+	{
+		stv_vdp2_sprite_list sprite;
+		rectangle cliprect;
+		int local_x, local_y;
+	};
+
+	static constexpr int VDP1_BANDS = 8;
+	static constexpr int VDP1_BAND_LINES = 512 / VDP1_BANDS;
+
+	struct vdp1_band
+	{
+		saturn_state *state;
+		rectangle clip;
+		vdp1_draw_context ctx;
+	};
 
-	uint16_t m_sprite_colorbank = 0;
+	std::vector<vdp1_command> m_vdp1_commands;
+	vdp1_band m_vdp1_bands[VDP1_BANDS];
+	osd_work_queue *m_vdp1_queue = nullptr;
 
 	/* VDP1 Framebuffer handling */
 	int      stv_sprite_priorities_used[8]{};
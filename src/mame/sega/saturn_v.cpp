@@ -40,6 +40,9 @@ Framebuffer todo:
 
 #define VDP1_LOG 0
 
+// draw the VDP1 command list on the calling thread instead of in bands (reference for debugging)
+#define VDP1_SERIAL 0
+
 
 enum { FRAC_SHIFT = 16 };
 
@@ -521,22 +524,22 @@ the rest are data used by it
 
 */
 
-void saturn_state::stv_clear_gouraud_shading(void)
+void saturn_state::stv_clear_gouraud_shading(vdp1_draw_context &ctx)
 {
-	memset( &stv_gouraud_shading, 0, sizeof( stv_gouraud_shading ) );
+	memset( &ctx.gouraud, 0, sizeof( ctx.gouraud ) );
 }
 
-uint8_t saturn_state::stv_read_gouraud_table( void )
+uint8_t saturn_state::stv_read_gouraud_table(vdp1_draw_context &ctx)
 {
 	int gaddr;
 
-	if ( stv2_current_sprite.CMDPMOD & 0x4 )
+	if ( ctx.sprite.CMDPMOD & 0x4 )
 	{
-		gaddr = stv2_current_sprite.CMDGRDA * 8;
-		stv_gouraud_shading.GA = (m_vdp1_vram[gaddr/4] >> 16) & 0xffff;
-		stv_gouraud_shading.GB = (m_vdp1_vram[gaddr/4] >> 0) & 0xffff;
-		stv_gouraud_shading.GC = (m_vdp1_vram[gaddr/4 + 1] >> 16) & 0xffff;
-		stv_gouraud_shading.GD = (m_vdp1_vram[gaddr/4 + 1] >> 0) & 0xffff;
+		gaddr = ctx.sprite.CMDGRDA * 8;
+		ctx.gouraud.GA = (m_vdp1_vram[gaddr/4] >> 16) & 0xffff;
+		ctx.gouraud.GB = (m_vdp1_vram[gaddr/4] >> 0) & 0xffff;
+		ctx.gouraud.GC = (m_vdp1_vram[gaddr/4 + 1] >> 16) & 0xffff;
+		ctx.gouraud.GD = (m_vdp1_vram[gaddr/4 + 1] >> 0) & 0xffff;
 		return 1;
 	}
 	else
@@ -556,16 +559,16 @@ static inline int32_t _shading( int32_t color, int32_t correction )
 	return color;
 }
 
-uint16_t saturn_state::stv_vdp1_apply_gouraud_shading( int x, int y, uint16_t pix )
+uint16_t saturn_state::stv_vdp1_apply_gouraud_shading(vdp1_draw_context &ctx, int x, int y, uint16_t pix )
 {
 	int32_t r,g,b, msb;
 
 	msb = pix & 0x8000;
 
 #ifdef MAME_DEBUG
-	if ( (stv_vdp1_shading_data->scanline[y].x[0] >> 16) != x )
+	if ( (ctx.shading->scanline[y].x[0] >> 16) != x )
 	{
-		logerror( "ERROR in computing x coordinates (line %d, x = %x, %d, xc = %x, %d)\n", y, x, x, stv_vdp1_shading_data->scanline[y].x[0], stv_vdp1_shading_data->scanline[y].x[0] >> 16 );
+		logerror( "ERROR in computing x coordinates (line %d, x = %x, %d, xc = %x, %d)\n", y, x, x, ctx.shading->scanline[y].x[0], ctx.shading->scanline[y].x[0] >> 16 );
 	};
 #endif
 
@@ -573,20 +576,20 @@ uint16_t saturn_state::stv_vdp1_apply_gouraud_shading( int x, int y, uint16_t pi
 	g = RGB_G(pix);
 	r = RGB_R(pix);
 
-	b = _shading( b, stv_vdp1_shading_data->scanline[y].b[0] );
-	g = _shading( g, stv_vdp1_shading_data->scanline[y].g[0] );
-	r = _shading( r, stv_vdp1_shading_data->scanline[y].r[0] );
+	b = _shading( b, ctx.shading->scanline[y].b[0] );
+	g = _shading( g, ctx.shading->scanline[y].g[0] );
+	r = _shading( r, ctx.shading->scanline[y].r[0] );
 
-	stv_vdp1_shading_data->scanline[y].b[0] += stv_vdp1_shading_data->scanline[y].db;
-	stv_vdp1_shading_data->scanline[y].g[0] += stv_vdp1_shading_data->scanline[y].dg;
-	stv_vdp1_shading_data->scanline[y].r[0] += stv_vdp1_shading_data->scanline[y].dr;
+	ctx.shading->scanline[y].b[0] += ctx.shading->scanline[y].db;
+	ctx.shading->scanline[y].g[0] += ctx.shading->scanline[y].dg;
+	ctx.shading->scanline[y].r[0] += ctx.shading->scanline[y].dr;
 
-	stv_vdp1_shading_data->scanline[y].x[0] += 1 << FRAC_SHIFT;
+	ctx.shading->scanline[y].x[0] += 1 << FRAC_SHIFT;
 
 	return msb | b << 10 | g << 5 | r;
 }
 
-void saturn_state::stv_vdp1_setup_shading_for_line(int32_t y, int32_t x1, int32_t x2,
+void saturn_state::stv_vdp1_setup_shading_for_line(vdp1_draw_context &ctx, int32_t y, int32_t x1, int32_t x2,
 											int32_t r1, int32_t g1, int32_t b1,
 											int32_t r2, int32_t g2, int32_t b2)
 {
@@ -623,24 +626,24 @@ void saturn_state::stv_vdp1_setup_shading_for_line(int32_t y, int32_t x1, int32_
 			if (r2 < r1) grd = -grd;
 		}
 
-		stv_vdp1_shading_data->scanline[y].x[0] = x1;
-		stv_vdp1_shading_data->scanline[y].x[1] = x2;
+		ctx.shading->scanline[y].x[0] = x1;
+		ctx.shading->scanline[y].x[1] = x2;
 
-		stv_vdp1_shading_data->scanline[y].b[0] = b1;
-		stv_vdp1_shading_data->scanline[y].g[0] = g1;
-		stv_vdp1_shading_data->scanline[y].r[0] = r1;
-		stv_vdp1_shading_data->scanline[y].b[1] = b2;
-		stv_vdp1_shading_data->scanline[y].g[1] = g2;
-		stv_vdp1_shading_data->scanline[y].r[1] = r2;
+		ctx.shading->scanline[y].b[0] = b1;
+		ctx.shading->scanline[y].g[0] = g1;
+		ctx.shading->scanline[y].r[0] = r1;
+		ctx.shading->scanline[y].b[1] = b2;
+		ctx.shading->scanline[y].g[1] = g2;
+		ctx.shading->scanline[y].r[1] = r2;
 
-		stv_vdp1_shading_data->scanline[y].db = gbd;
-		stv_vdp1_shading_data->scanline[y].dg = ggd;
-		stv_vdp1_shading_data->scanline[y].dr = grd;
+		ctx.shading->scanline[y].db = gbd;
+		ctx.shading->scanline[y].dg = ggd;
+		ctx.shading->scanline[y].dr = grd;
 
 	}
 }
 
-void saturn_state::stv_vdp1_setup_shading_for_slope(
+void saturn_state::stv_vdp1_setup_shading_for_slope(vdp1_draw_context &ctx,
 							int32_t x1, int32_t x2, int32_t sl1, int32_t sl2, int32_t *nx1, int32_t *nx2,
 							int32_t r1, int32_t r2, int32_t slr1, int32_t slr2, int32_t *nr1, int32_t *nr2,
 							int32_t g1, int32_t g2, int32_t slg1, int32_t slg2, int32_t *ng1, int32_t *ng2,
@@ -664,7 +667,7 @@ void saturn_state::stv_vdp1_setup_shading_for_slope(
 
 	while(_y1 < y2)
 	{
-		stv_vdp1_setup_shading_for_line(_y1, x1, x2, r1, g1, b1, r2, g2, b2);
+		stv_vdp1_setup_shading_for_line(ctx, _y1, x1, x2, r1, g1, b1, r2, g2, b2);
 		x1 += sl1;
 		r1 += slr1;
 		g1 += slg1;
@@ -687,7 +690,7 @@ void saturn_state::stv_vdp1_setup_shading_for_slope(
 	*ng2 = g2;
 }
 
-void saturn_state::stv_vdp1_setup_shading(const struct spoint* q, const rectangle &cliprect)
+void saturn_state::stv_vdp1_setup_shading(vdp1_draw_context &ctx, const struct spoint* q, const rectangle &cliprect)
 {
 	int32_t x1, x2, delta, cury, limy;
 	int32_t r1, g1, b1, r2, g2, b2;
@@ -697,12 +700,12 @@ void saturn_state::stv_vdp1_setup_shading(const struct spoint* q, const rectangl
 	struct shaded_point p[8];
 	uint16_t gd[4];
 
-	if ( stv_read_gouraud_table() == 0 ) return;
+	if ( stv_read_gouraud_table(ctx) == 0 ) return;
 
-	gd[0] = stv_gouraud_shading.GA;
-	gd[1] = stv_gouraud_shading.GB;
-	gd[2] = stv_gouraud_shading.GC;
-	gd[3] = stv_gouraud_shading.GD;
+	gd[0] = ctx.gouraud.GA;
+	gd[1] = ctx.gouraud.GB;
+	gd[2] = ctx.gouraud.GC;
+	gd[3] = ctx.gouraud.GD;
 
 	for(i=0; i<4; i++) {
 		p[i].x = p[i+4].x = q[i].x << FRAC_SHIFT;
@@ -723,8 +726,8 @@ void saturn_state::stv_vdp1_setup_shading(const struct spoint* q, const rectangl
 	cury = p[pmin].y;
 	limy = p[pmax].y;
 
-	stv_vdp1_shading_data->sy = cury;
-	stv_vdp1_shading_data->ey = limy;
+	ctx.shading->sy = cury;
+	ctx.shading->ey = limy;
 
 	if(cury == limy) {
 		x1 = x2 = p[0].x;
@@ -739,7 +742,7 @@ void saturn_state::stv_vdp1_setup_shading(const struct spoint* q, const rectangl
 				ps2 = i;
 			}
 		}
-		stv_vdp1_setup_shading_for_line(cury, x1, x2, p[ps1].r, p[ps1].g, p[ps1].b, p[ps2].r, p[ps2].g, p[ps2].b);
+		stv_vdp1_setup_shading_for_line(ctx, cury, x1, x2, p[ps1].r, p[ps1].g, p[ps1].b, p[ps2].r, p[ps2].g, p[ps2].b);
 		goto finish;
 	}
 
@@ -750,8 +753,7 @@ void saturn_state::stv_vdp1_setup_shading(const struct spoint* q, const rectangl
 
 	for(;;) {
 		if(p[ps1-1].y == p[ps2+1].y) {
-			stv_vdp1_setup_shading_for_slope(
-							x1, x2, sl1, sl2, &x1, &x2,
+			stv_vdp1_setup_shading_for_slope(ctx, x1, x2, sl1, sl2, &x1, &x2,
 							r1, r2, slr1, slr2, &r1, &r2,
 							g1, g2, slg1, slg2, &g1, &g2,
 							b1, b2, slb1, slb2, &b1, &b2,
@@ -788,8 +790,7 @@ void saturn_state::stv_vdp1_setup_shading(const struct spoint* q, const rectangl
 			slg2 = (g2-p[ps2+1].g)/delta;
 			slb2 = (b2-p[ps2+1].b)/delta;
 		} else if(p[ps1-1].y < p[ps2+1].y) {
-			stv_vdp1_setup_shading_for_slope(
-							x1, x2, sl1, sl2, &x1, &x2,
+			stv_vdp1_setup_shading_for_slope(ctx, x1, x2, sl1, sl2, &x1, &x2,
 							r1, r2, slr1, slr2, &r1, &r2,
 							g1, g2, slg1, slg2, &g1, &g2,
 							b1, b2, slb1, slb2, &b1, &b2,
@@ -811,8 +812,7 @@ void saturn_state::stv_vdp1_setup_shading(const struct spoint* q, const rectangl
 			slg1 = (g1-p[ps1-1].g)/delta;
 			slb1 = (b1-p[ps1-1].b)/delta;
 		} else {
-			stv_vdp1_setup_shading_for_slope(
-							x1, x2, sl1, sl2, &x1, &x2,
+			stv_vdp1_setup_shading_for_slope(ctx, x1, x2, sl1, sl2, &x1, &x2,
 							r1, r2, slr1, slr2, &r1, &r2,
 							g1, g2, slg1, slg2, &g1, &g2,
 							b1, b2, slb1, slb2, &b1, &b2,
@@ -836,23 +836,23 @@ void saturn_state::stv_vdp1_setup_shading(const struct spoint* q, const rectangl
 		}
 	}
 	if(cury == limy)
-		stv_vdp1_setup_shading_for_line(cury, x1, x2, r1, g1, b1, r2, g2, b2 );
+		stv_vdp1_setup_shading_for_line(ctx, cury, x1, x2, r1, g1, b1, r2, g2, b2 );
 
 finish:
 
-	if ( stv_vdp1_shading_data->sy < 0 ) stv_vdp1_shading_data->sy = 0;
-	if ( stv_vdp1_shading_data->sy >= 512 ) return;
-	if ( stv_vdp1_shading_data->ey < 0 ) return;
-	if ( stv_vdp1_shading_data->ey >= 512 ) stv_vdp1_shading_data->ey = 511;
+	if ( ctx.shading->sy < 0 ) ctx.shading->sy = 0;
+	if ( ctx.shading->sy >= 512 ) return;
+	if ( ctx.shading->ey < 0 ) return;
+	if ( ctx.shading->ey >= 512 ) ctx.shading->ey = 511;
 
-	for ( cury = stv_vdp1_shading_data->sy; cury <= stv_vdp1_shading_data->ey; cury++ )
+	for ( cury = ctx.shading->sy; cury <= ctx.shading->ey; cury++ )
 	{
-		while( (stv_vdp1_shading_data->scanline[cury].x[0] >> 16) < cliprect.min_x )
+		while( (ctx.shading->scanline[cury].x[0] >> 16) < cliprect.min_x )
 		{
-			stv_vdp1_shading_data->scanline[cury].x[0] += (1 << FRAC_SHIFT);
-			stv_vdp1_shading_data->scanline[cury].b[0] += stv_vdp1_shading_data->scanline[cury].db;
-			stv_vdp1_shading_data->scanline[cury].g[0] += stv_vdp1_shading_data->scanline[cury].dg;
-			stv_vdp1_shading_data->scanline[cury].r[0] += stv_vdp1_shading_data->scanline[cury].dr;
+			ctx.shading->scanline[cury].x[0] += (1 << FRAC_SHIFT);
+			ctx.shading->scanline[cury].b[0] += ctx.shading->scanline[cury].db;
+			ctx.shading->scanline[cury].g[0] += ctx.shading->scanline[cury].dg;
+			ctx.shading->scanline[cury].r[0] += ctx.shading->scanline[cury].dr;
 		}
 	}
 
@@ -865,50 +865,50 @@ why they would want to */
 
 
 
-void saturn_state::drawpixel_poly(int x, int y, int patterndata, int offsetcnt)
+void saturn_state::drawpixel_poly(vdp1_draw_context &ctx, int x, int y, int patterndata, int offsetcnt)
 {
 	/* Capcom Collection Dai 4 uses a dummy polygon to clear VDP1 framebuffer that goes over our current max size ... */
 	if(x >= 1024 || y >= 512)
 		return;
 
-	m_vdp1.framebuffer_draw_lines[y][x] = stv2_current_sprite.CMDCOLR;
+	m_vdp1.framebuffer_draw_lines[y][x] = ctx.sprite.CMDCOLR;
 }
 
-void saturn_state::drawpixel_8bpp_trans(int x, int y, int patterndata, int offsetcnt)
+void saturn_state::drawpixel_8bpp_trans(vdp1_draw_context &ctx, int x, int y, int patterndata, int offsetcnt)
 {
 	uint16_t pix;
 
 	pix = m_vdp1.gfx_decode[patterndata+offsetcnt] & 0xff;
 	if ( pix != 0 )
 	{
-		m_vdp1.framebuffer_draw_lines[y][x] = pix | m_sprite_colorbank;
+		m_vdp1.framebuffer_draw_lines[y][x] = pix | ctx.colorbank;
 	}
 }
 
-void saturn_state::drawpixel_4bpp_notrans(int x, int y, int patterndata, int offsetcnt)
+void saturn_state::drawpixel_4bpp_notrans(vdp1_draw_context &ctx, int x, int y, int patterndata, int offsetcnt)
 {
 	uint16_t pix;
 
 	pix = m_vdp1.gfx_decode[patterndata+offsetcnt/2];
 	pix = offsetcnt&1 ? (pix & 0x0f) : ((pix & 0xf0)>>4);
-	m_vdp1.framebuffer_draw_lines[y][x] = pix | m_sprite_colorbank;
+	m_vdp1.framebuffer_draw_lines[y][x] = pix | ctx.colorbank;
 }
 
-void saturn_state::drawpixel_4bpp_trans(int x, int y, int patterndata, int offsetcnt)
+void saturn_state::drawpixel_4bpp_trans(vdp1_draw_context &ctx, int x, int y, int patterndata, int offsetcnt)
 {
 	uint16_t pix;
 
 	pix = m_vdp1.gfx_decode[patterndata+offsetcnt/2];
 	pix = offsetcnt&1 ? (pix & 0x0f) : ((pix & 0xf0)>>4);
 	if ( pix != 0 )
-		m_vdp1.framebuffer_draw_lines[y][x] = pix | m_sprite_colorbank;
+		m_vdp1.framebuffer_draw_lines[y][x] = pix | ctx.colorbank;
 }
 
-void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcnt)
+void saturn_state::drawpixel_generic(vdp1_draw_context &ctx, int x, int y, int patterndata, int offsetcnt)
 {
-	int pix,transpen, spd = stv2_current_sprite.CMDPMOD & 0x40;
+	int pix,transpen, spd = ctx.sprite.CMDPMOD & 0x40;
 //  int mode;
-	int mesh = stv2_current_sprite.CMDPMOD & 0x100;
+	int mesh = ctx.sprite.CMDPMOD & 0x100;
 	int raw,endcode;
 
 	if ( mesh && !((x ^ y) & 1) )
@@ -919,9 +919,9 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 	if(x >= 1024 || y >= 512)
 		return;
 
-	if ( stv2_current_sprite.ispoly )
+	if ( ctx.sprite.ispoly )
 	{
-		raw = pix = stv2_current_sprite.CMDCOLR&0xffff;
+		raw = pix = ctx.sprite.CMDCOLR&0xffff;
 
 		transpen = 0;
 		endcode = 0xffff;
@@ -938,13 +938,13 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 	}
 	else
 	{
-		switch (stv2_current_sprite.CMDPMOD&0x0038)
+		switch (ctx.sprite.CMDPMOD&0x0038)
 		{
 			case 0x0000: // mode 0 16 colour bank mode (4bits) (hanagumi blocks)
 				// most of the shienryu sprites use this mode
 				raw = m_vdp1.gfx_decode[(patterndata+offsetcnt/2) & 0xfffff];
 				raw = offsetcnt&1 ? (raw & 0x0f) : ((raw & 0xf0)>>4);
-				pix = raw+((stv2_current_sprite.CMDCOLR&0xfff0));
+				pix = raw+((ctx.sprite.CMDCOLR&0xfff0));
 				//mode = 0;
 				transpen = 0;
 				endcode = 0xf;
@@ -954,8 +954,8 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 				raw = m_vdp1.gfx_decode[(patterndata+offsetcnt/2) & 0xfffff];
 				raw = offsetcnt&1 ? (raw & 0x0f) : ((raw & 0xf0)>>4);
 				pix = raw&1 ?
-				((((m_vdp1_vram[(((stv2_current_sprite.CMDCOLR&0xffff)*8)>>2)+((raw&0xfffe)/2)])) & 0x0000ffff) >> 0):
-				((((m_vdp1_vram[(((stv2_current_sprite.CMDCOLR&0xffff)*8)>>2)+((raw&0xfffe)/2)])) & 0xffff0000) >> 16);
+				((((m_vdp1_vram[(((ctx.sprite.CMDCOLR&0xffff)*8)>>2)+((raw&0xfffe)/2)])) & 0x0000ffff) >> 0):
+				((((m_vdp1_vram[(((ctx.sprite.CMDCOLR&0xffff)*8)>>2)+((raw&0xfffe)/2)])) & 0xffff0000) >> 16);
 				//mode = 5;
 				transpen = 0;
 				endcode = 0xf;
@@ -963,7 +963,7 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 			case 0x0010: // mode 2 64 colour bank mode (8bits) (character select portraits on hanagumi)
 				raw = m_vdp1.gfx_decode[(patterndata+offsetcnt) & 0xfffff] & 0xff;
 				//mode = 2;
-				pix = raw+(stv2_current_sprite.CMDCOLR&0xffc0);
+				pix = raw+(ctx.sprite.CMDCOLR&0xffc0);
 				transpen = 0;
 				endcode = 0xff;
 				// Notes of interest:
@@ -972,14 +972,14 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 				break;
 			case 0x0018: // mode 3 128 colour bank mode (8bits) (little characters on hanagumi use this mode)
 				raw = m_vdp1.gfx_decode[(patterndata+offsetcnt) & 0xfffff] & 0xff;
-				pix = raw+(stv2_current_sprite.CMDCOLR&0xff80);
+				pix = raw+(ctx.sprite.CMDCOLR&0xff80);
 				transpen = 0;
 				endcode = 0xff;
 				//mode = 3;
 				break;
 			case 0x0020: // mode 4 256 colour bank mode (8bits) (hanagumi title)
 				raw = m_vdp1.gfx_decode[(patterndata+offsetcnt) & 0xfffff] & 0xff;
-				pix = raw+(stv2_current_sprite.CMDCOLR&0xff00);
+				pix = raw+(ctx.sprite.CMDCOLR&0xff00);
 				transpen = 0;
 				endcode = 0xff;
 				//mode = 4;
@@ -1006,12 +1006,12 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 				//mode = 0;
 				transpen = 0;
 				endcode = 0xff;
-				popmessage("Illegal Sprite Mode %02x, contact MAMEdev",stv2_current_sprite.CMDPMOD&0x0038);
+				popmessage("Illegal Sprite Mode %02x, contact MAMEdev",ctx.sprite.CMDPMOD&0x0038);
 		}
 
 
 		// preliminary end code disable support
-		if ( ((stv2_current_sprite.CMDPMOD & 0x80) == 0) &&
+		if ( ((ctx.sprite.CMDPMOD & 0x80) == 0) &&
 			(raw == endcode) )
 		{
 			return;
@@ -1020,7 +1020,7 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 
 	/* MSBON */
 	// TODO: does this always applies to the frame buffer regardless of the mode?
-	pix |= stv2_current_sprite.CMDPMOD & 0x8000;
+	pix |= ctx.sprite.CMDPMOD & 0x8000;
 	/*
 	TODO: from docs:
 	"Except for the color calculation of replace and shadow, color calculation can only be performed when the color code of the original picture is RGB code.
@@ -1040,10 +1040,10 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 	{
 		if ( (raw != transpen) || spd )
 		{
-			if ( stv2_current_sprite.CMDPMOD & 0x4 ) /* Gouraud shading */
-				pix = stv_vdp1_apply_gouraud_shading( x, y, pix );
+			if ( ctx.sprite.CMDPMOD & 0x4 ) /* Gouraud shading */
+				pix = stv_vdp1_apply_gouraud_shading(ctx, x, y, pix );
 
-			switch( stv2_current_sprite.CMDPMOD & 0x3 )
+			switch( ctx.sprite.CMDPMOD & 0x3 )
 			{
 				case 0: /* replace */
 					m_vdp1.framebuffer_draw_lines[y][x] = pix;
@@ -1077,7 +1077,7 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 					// TODO: latter looks really bad.
 				default:
 					// TODO: mode 5: prohibited, mode 6: gouraud shading + half-luminance, mode 7: gouraud-shading + half-transparent
-					popmessage("VDP1 PMOD = %02x, contact MAMEdev",stv2_current_sprite.CMDPMOD & 0x7);
+					popmessage("VDP1 PMOD = %02x, contact MAMEdev",ctx.sprite.CMDPMOD & 0x7);
 					m_vdp1.framebuffer_draw_lines[y][x] = pix;
 					break;
 			}
@@ -1086,54 +1086,54 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 }
 
 
-void saturn_state::stv_vdp1_set_drawpixel( void )
+void saturn_state::stv_vdp1_set_drawpixel(vdp1_draw_context &ctx)
 {
-	int sprite_type = stv2_current_sprite.CMDCTRL & 0x000f;
-	int sprite_mode = stv2_current_sprite.CMDPMOD&0x0038;
-	int spd = stv2_current_sprite.CMDPMOD & 0x40;
-	int mesh = stv2_current_sprite.CMDPMOD & 0x100;
-	int ecd = stv2_current_sprite.CMDPMOD & 0x80;
+	int sprite_type = ctx.sprite.CMDCTRL & 0x000f;
+	int sprite_mode = ctx.sprite.CMDPMOD&0x0038;
+	int spd = ctx.sprite.CMDPMOD & 0x40;
+	int mesh = ctx.sprite.CMDPMOD & 0x100;
+	int ecd = ctx.sprite.CMDPMOD & 0x80;
 
-	if ( mesh || !ecd || ((stv2_current_sprite.CMDPMOD & 0x7) != 0) )
+	if ( mesh || !ecd || ((ctx.sprite.CMDPMOD & 0x7) != 0) )
 	{
-		drawpixel = &saturn_state::drawpixel_generic;
+		ctx.drawpixel = &saturn_state::drawpixel_generic;
 		return;
 	}
 
-	if(stv2_current_sprite.CMDPMOD & 0x8000)
+	if(ctx.sprite.CMDPMOD & 0x8000)
 	{
-		drawpixel = &saturn_state::drawpixel_generic;
+		ctx.drawpixel = &saturn_state::drawpixel_generic;
 		return;
 	}
 
 	// polygon / polyline / line with replace case
-	if (sprite_type & 4 && ((stv2_current_sprite.CMDPMOD & 0x7) == 0))
+	if (sprite_type & 4 && ((ctx.sprite.CMDPMOD & 0x7) == 0))
 	{
-		drawpixel = &saturn_state::drawpixel_poly;
+		ctx.drawpixel = &saturn_state::drawpixel_poly;
 	}
 	else if ( (sprite_mode == 0x20) && !spd )
 	{
-		m_sprite_colorbank = (stv2_current_sprite.CMDCOLR&0xff00);
-		drawpixel = &saturn_state::drawpixel_8bpp_trans;
+		ctx.colorbank = (ctx.sprite.CMDCOLR&0xff00);
+		ctx.drawpixel = &saturn_state::drawpixel_8bpp_trans;
 	}
 	else if ((sprite_mode == 0x00) && spd)
 	{
-		m_sprite_colorbank = (stv2_current_sprite.CMDCOLR&0xfff0);
-		drawpixel = &saturn_state::drawpixel_4bpp_notrans;
+		ctx.colorbank = (ctx.sprite.CMDCOLR&0xfff0);
+		ctx.drawpixel = &saturn_state::drawpixel_4bpp_notrans;
 	}
 	else if (sprite_mode == 0x00 && !spd )
 	{
-		m_sprite_colorbank = (stv2_current_sprite.CMDCOLR&0xfff0);
-		drawpixel = &saturn_state::drawpixel_4bpp_trans;
+		ctx.colorbank = (ctx.sprite.CMDCOLR&0xfff0);
+		ctx.drawpixel = &saturn_state::drawpixel_4bpp_trans;
 	}
 	else
 	{
-		drawpixel = &saturn_state::drawpixel_generic;
+		ctx.drawpixel = &saturn_state::drawpixel_generic;
 	}
 }
 
 
-void saturn_state::vdp1_fill_slope(const rectangle &cliprect, int patterndata, int xsize,
+void saturn_state::vdp1_fill_slope(vdp1_draw_context &ctx, const rectangle &cliprect, int patterndata, int xsize,
 							int32_t x1, int32_t x2, int32_t sl1, int32_t sl2, int32_t *nx1, int32_t *nx2,
 							int32_t u1, int32_t u2, int32_t slu1, int32_t slu2, int32_t *nu1, int32_t *nu2,
 							int32_t v1, int32_t v2, int32_t slv1, int32_t slv2, int32_t *nv1, int32_t *nv2,
@@ -1223,7 +1223,7 @@ void saturn_state::vdp1_fill_slope(const rectangle &cliprect, int patterndata, i
 					xx2 = cliprect.max_x;
 
 				while(xx1 <= xx2) {
-					(this->*drawpixel)(xx1,_y1, patterndata, (v>>FRAC_SHIFT)*xsize+(u>>FRAC_SHIFT));
+					(this->*ctx.drawpixel)(ctx, xx1,_y1, patterndata, (v>>FRAC_SHIFT)*xsize+(u>>FRAC_SHIFT));
 					xx1++;
 					u += slux;
 					v += slvx;
@@ -1247,7 +1247,7 @@ void saturn_state::vdp1_fill_slope(const rectangle &cliprect, int patterndata, i
 	*nv2 = v2;
 }
 
-void saturn_state::vdp1_fill_line(const rectangle &cliprect, int patterndata, int xsize, int32_t y,
+void saturn_state::vdp1_fill_line(vdp1_draw_context &ctx, const rectangle &cliprect, int patterndata, int xsize, int32_t y,
 							int32_t x1, int32_t x2, int32_t u1, int32_t u2, int32_t v1, int32_t v2)
 {
 	int xx1 = x1>>FRAC_SHIFT;
@@ -1275,7 +1275,7 @@ void saturn_state::vdp1_fill_line(const rectangle &cliprect, int patterndata, in
 			xx2 = cliprect.max_x;
 
 		while(xx1 <= xx2) {
-			(this->*drawpixel)(xx1,y,patterndata,(v>>FRAC_SHIFT)*xsize+(u>>FRAC_SHIFT));
+			(this->*ctx.drawpixel)(ctx, xx1,y,patterndata,(v>>FRAC_SHIFT)*xsize+(u>>FRAC_SHIFT));
 			xx1++;
 			u += slux;
 			v += slvx;
@@ -1283,7 +1283,7 @@ void saturn_state::vdp1_fill_line(const rectangle &cliprect, int patterndata, in
 	}
 }
 
-void saturn_state::vdp1_fill_quad(const rectangle &cliprect, int patterndata, int xsize, const struct spoint *q)
+void saturn_state::vdp1_fill_quad(vdp1_draw_context &ctx, const rectangle &cliprect, int patterndata, int xsize, const struct spoint *q)
 {
 	int32_t sl1, sl2, slu1, slu2, slv1, slv2, cury, limy, x1, x2, u1, u2, v1, v2, delta;
 	int pmin, pmax, i, ps1, ps2;
@@ -1323,7 +1323,7 @@ void saturn_state::vdp1_fill_quad(const rectangle &cliprect, int patterndata, in
 				v2 = p[i].v;
 			}
 		}
-		vdp1_fill_line(cliprect, patterndata, xsize, cury, x1, x2, u1, u2, v1, v2);
+		vdp1_fill_line(ctx, cliprect, patterndata, xsize, cury, x1, x2, u1, u2, v1, v2);
 		return;
 	}
 
@@ -1342,7 +1342,7 @@ void saturn_state::vdp1_fill_quad(const rectangle &cliprect, int patterndata, in
 
 	for(;;) {
 		if(p[ps1-1].y == p[ps2+1].y) {
-			vdp1_fill_slope(cliprect, patterndata, xsize,
+			vdp1_fill_slope(ctx, cliprect, patterndata, xsize,
 							x1, x2, sl1, sl2, &x1, &x2,
 							u1, u2, slu1, slu2, &u1, &u2,
 							v1, v2, slv1, slv2, &v1, &v2,
@@ -1375,7 +1375,7 @@ void saturn_state::vdp1_fill_quad(const rectangle &cliprect, int patterndata, in
 			slu2 = (u2-p[ps2+1].u)/delta;
 			slv2 = (v2-p[ps2+1].v)/delta;
 		} else if(p[ps1-1].y < p[ps2+1].y) {
-			vdp1_fill_slope(cliprect, patterndata, xsize,
+			vdp1_fill_slope(ctx, cliprect, patterndata, xsize,
 							x1, x2, sl1, sl2, &x1, &x2,
 							u1, u2, slu1, slu2, &u1, &u2,
 							v1, v2, slv1, slv2, &v1, &v2,
@@ -1395,7 +1395,7 @@ void saturn_state::vdp1_fill_quad(const rectangle &cliprect, int patterndata, in
 			slu1 = (u1-p[ps1-1].u)/delta;
 			slv1 = (v1-p[ps1-1].v)/delta;
 		} else {
-			vdp1_fill_slope(cliprect, patterndata, xsize,
+			vdp1_fill_slope(ctx, cliprect, patterndata, xsize,
 							x1, x2, sl1, sl2, &x1, &x2,
 							u1, u2, slu1, slu2, &u1, &u2,
 							v1, v2, slv1, slv2, &v1, &v2,
@@ -1417,102 +1417,102 @@ void saturn_state::vdp1_fill_quad(const rectangle &cliprect, int patterndata, in
 		}
 	}
 	if(cury == limy)
-		vdp1_fill_line(cliprect, patterndata, xsize, cury, x1, x2, u1, u2, v1, v2);
+		vdp1_fill_line(ctx, cliprect, patterndata, xsize, cury, x1, x2, u1, u2, v1, v2);
 }
 
-int saturn_state::x2s(int v)
+int saturn_state::x2s(vdp1_draw_context &ctx, int v)
 {
-	return (int32_t)(int16_t)v + m_vdp1.local_x;
+	return (int32_t)(int16_t)v + ctx.local_x;
 }
 
-int saturn_state::y2s(int v)
+int saturn_state::y2s(vdp1_draw_context &ctx, int v)
 {
-	return (int32_t)(int16_t)v + m_vdp1.local_y;
+	return (int32_t)(int16_t)v + ctx.local_y;
 }
 
-void saturn_state::stv_vdp1_draw_line(const rectangle &cliprect)
+void saturn_state::stv_vdp1_draw_line(vdp1_draw_context &ctx, const rectangle &cliprect)
 {
 	struct spoint q[4];
 
-	q[0].x = x2s(stv2_current_sprite.CMDXA);
-	q[0].y = y2s(stv2_current_sprite.CMDYA);
-	q[1].x = x2s(stv2_current_sprite.CMDXB);
-	q[1].y = y2s(stv2_current_sprite.CMDYB);
-	q[2].x = x2s(stv2_current_sprite.CMDXA);
-	q[2].y = y2s(stv2_current_sprite.CMDYA);
-	q[3].x = x2s(stv2_current_sprite.CMDXB);
-	q[3].y = y2s(stv2_current_sprite.CMDYB);
+	q[0].x = x2s(ctx, ctx.sprite.CMDXA);
+	q[0].y = y2s(ctx, ctx.sprite.CMDYA);
+	q[1].x = x2s(ctx, ctx.sprite.CMDXB);
+	q[1].y = y2s(ctx, ctx.sprite.CMDYB);
+	q[2].x = x2s(ctx, ctx.sprite.CMDXA);
+	q[2].y = y2s(ctx, ctx.sprite.CMDYA);
+	q[3].x = x2s(ctx, ctx.sprite.CMDXB);
+	q[3].y = y2s(ctx, ctx.sprite.CMDYB);
 
 	q[0].u = q[3].u = q[1].u = q[2].u = 0;
 	q[0].v = q[1].v = q[2].v = q[3].v = 0;
 
-	vdp1_fill_quad(cliprect, 0, 1, q);
+	vdp1_fill_quad(ctx, cliprect, 0, 1, q);
 }
 
-void saturn_state::stv_vdp1_draw_poly_line(const rectangle &cliprect)
+void saturn_state::stv_vdp1_draw_poly_line(vdp1_draw_context &ctx, const rectangle &cliprect)
 {
 	struct spoint q[4];
 
-	q[0].x = x2s(stv2_current_sprite.CMDXA);
-	q[0].y = y2s(stv2_current_sprite.CMDYA);
-	q[1].x = x2s(stv2_current_sprite.CMDXB);
-	q[1].y = y2s(stv2_current_sprite.CMDYB);
-	q[2].x = x2s(stv2_current_sprite.CMDXA);
-	q[2].y = y2s(stv2_current_sprite.CMDYA);
-	q[3].x = x2s(stv2_current_sprite.CMDXB);
-	q[3].y = y2s(stv2_current_sprite.CMDYB);
+	q[0].x = x2s(ctx, ctx.sprite.CMDXA);
+	q[0].y = y2s(ctx, ctx.sprite.CMDYA);
+	q[1].x = x2s(ctx, ctx.sprite.CMDXB);
+	q[1].y = y2s(ctx, ctx.sprite.CMDYB);
+	q[2].x = x2s(ctx, ctx.sprite.CMDXA);
+	q[2].y = y2s(ctx, ctx.sprite.CMDYA);
+	q[3].x = x2s(ctx, ctx.sprite.CMDXB);
+	q[3].y = y2s(ctx, ctx.sprite.CMDYB);
 
 	q[0].u = q[3].u = q[1].u = q[2].u = 0;
 	q[0].v = q[1].v = q[2].v = q[3].v = 0;
 
-	vdp1_fill_quad(cliprect, 0, 1, q);
+	vdp1_fill_quad(ctx, cliprect, 0, 1, q);
 
-	q[0].x = x2s(stv2_current_sprite.CMDXB);
-	q[0].y = y2s(stv2_current_sprite.CMDYB);
-	q[1].x = x2s(stv2_current_sprite.CMDXC);
-	q[1].y = y2s(stv2_current_sprite.CMDYC);
-	q[2].x = x2s(stv2_current_sprite.CMDXB);
-	q[2].y = y2s(stv2_current_sprite.CMDYB);
-	q[3].x = x2s(stv2_current_sprite.CMDXC);
-	q[3].y = y2s(stv2_current_sprite.CMDYC);
+	q[0].x = x2s(ctx, ctx.sprite.CMDXB);
+	q[0].y = y2s(ctx, ctx.sprite.CMDYB);
+	q[1].x = x2s(ctx, ctx.sprite.CMDXC);
+	q[1].y = y2s(ctx, ctx.sprite.CMDYC);
+	q[2].x = x2s(ctx, ctx.sprite.CMDXB);
+	q[2].y = y2s(ctx, ctx.sprite.CMDYB);
+	q[3].x = x2s(ctx, ctx.sprite.CMDXC);
+	q[3].y = y2s(ctx, ctx.sprite.CMDYC);
 
 	q[0].u = q[3].u = q[1].u = q[2].u = 0;
 	q[0].v = q[1].v = q[2].v = q[3].v = 0;
 
-	vdp1_fill_quad(cliprect, 0, 1, q);
+	vdp1_fill_quad(ctx, cliprect, 0, 1, q);
 
-	q[0].x = x2s(stv2_current_sprite.CMDXC);
-	q[0].y = y2s(stv2_current_sprite.CMDYC);
-	q[1].x = x2s(stv2_current_sprite.CMDXD);
-	q[1].y = y2s(stv2_current_sprite.CMDYD);
-	q[2].x = x2s(stv2_current_sprite.CMDXC);
-	q[2].y = y2s(stv2_current_sprite.CMDYC);
-	q[3].x = x2s(stv2_current_sprite.CMDXD);
-	q[3].y = y2s(stv2_current_sprite.CMDYD);
+	q[0].x = x2s(ctx, ctx.sprite.CMDXC);
+	q[0].y = y2s(ctx, ctx.sprite.CMDYC);
+	q[1].x = x2s(ctx, ctx.sprite.CMDXD);
+	q[1].y = y2s(ctx, ctx.sprite.CMDYD);
+	q[2].x = x2s(ctx, ctx.sprite.CMDXC);
+	q[2].y = y2s(ctx, ctx.sprite.CMDYC);
+	q[3].x = x2s(ctx, ctx.sprite.CMDXD);
+	q[3].y = y2s(ctx, ctx.sprite.CMDYD);
 
 	q[0].u = q[3].u = q[1].u = q[2].u = 0;
 	q[0].v = q[1].v = q[2].v = q[3].v = 0;
 
-	vdp1_fill_quad(cliprect, 0, 1, q);
+	vdp1_fill_quad(ctx, cliprect, 0, 1, q);
 
-	q[0].x = x2s(stv2_current_sprite.CMDXD);
-	q[0].y = y2s(stv2_current_sprite.CMDYD);
-	q[1].x = x2s(stv2_current_sprite.CMDXA);
-	q[1].y = y2s(stv2_current_sprite.CMDYA);
-	q[2].x = x2s(stv2_current_sprite.CMDXD);
-	q[2].y = y2s(stv2_current_sprite.CMDYD);
-	q[3].x = x2s(stv2_current_sprite.CMDXA);
-	q[3].y = y2s(stv2_current_sprite.CMDYA);
+	q[0].x = x2s(ctx, ctx.sprite.CMDXD);
+	q[0].y = y2s(ctx, ctx.sprite.CMDYD);
+	q[1].x = x2s(ctx, ctx.sprite.CMDXA);
+	q[1].y = y2s(ctx, ctx.sprite.CMDYA);
+	q[2].x = x2s(ctx, ctx.sprite.CMDXD);
+	q[2].y = y2s(ctx, ctx.sprite.CMDYD);
+	q[3].x = x2s(ctx, ctx.sprite.CMDXA);
+	q[3].y = y2s(ctx, ctx.sprite.CMDYA);
 
 	q[0].u = q[3].u = q[1].u = q[2].u = 0;
 	q[0].v = q[1].v = q[2].v = q[3].v = 0;
 
-	stv_vdp1_setup_shading(q, cliprect);
-	vdp1_fill_quad(cliprect, 0, 1, q);
+	stv_vdp1_setup_shading(ctx, q, cliprect);
+	vdp1_fill_quad(ctx, cliprect, 0, 1, q);
 
 }
 
-void saturn_state::stv_vdp1_draw_distorted_sprite(const rectangle &cliprect)
+void saturn_state::stv_vdp1_draw_distorted_sprite(vdp1_draw_context &ctx, const rectangle &cliprect)
 {
 	struct spoint q[4];
 
@@ -1520,36 +1520,36 @@ void saturn_state::stv_vdp1_draw_distorted_sprite(const rectangle &cliprect)
 	int direction;
 	int patterndata;
 
-	direction = (stv2_current_sprite.CMDCTRL & 0x0030)>>4;
+	direction = (ctx.sprite.CMDCTRL & 0x0030)>>4;
 
-	if ( stv2_current_sprite.ispoly )
+	if ( ctx.sprite.ispoly )
 	{
 		xsize = ysize = 1;
 		patterndata = 0;
 	}
 	else
 	{
-		xsize = (stv2_current_sprite.CMDSIZE & 0x3f00) >> 8;
+		xsize = (ctx.sprite.CMDSIZE & 0x3f00) >> 8;
 		xsize = xsize * 8;
 		if (xsize == 0) return; /* setting prohibited */
 
-		ysize = (stv2_current_sprite.CMDSIZE & 0x00ff);
+		ysize = (ctx.sprite.CMDSIZE & 0x00ff);
 		if (ysize == 0) return; /* setting prohibited */
 
-		patterndata = (stv2_current_sprite.CMDSRCA) & 0xffff;
+		patterndata = (ctx.sprite.CMDSRCA) & 0xffff;
 		patterndata = patterndata * 0x8;
 
 	}
 
 
-	q[0].x = x2s(stv2_current_sprite.CMDXA);
-	q[0].y = y2s(stv2_current_sprite.CMDYA);
-	q[1].x = x2s(stv2_current_sprite.CMDXB);
-	q[1].y = y2s(stv2_current_sprite.CMDYB);
-	q[2].x = x2s(stv2_current_sprite.CMDXC);
-	q[2].y = y2s(stv2_current_sprite.CMDYC);
-	q[3].x = x2s(stv2_current_sprite.CMDXD);
-	q[3].y = y2s(stv2_current_sprite.CMDYD);
+	q[0].x = x2s(ctx, ctx.sprite.CMDXA);
+	q[0].y = y2s(ctx, ctx.sprite.CMDYA);
+	q[1].x = x2s(ctx, ctx.sprite.CMDXB);
+	q[1].y = y2s(ctx, ctx.sprite.CMDYB);
+	q[2].x = x2s(ctx, ctx.sprite.CMDXC);
+	q[2].y = y2s(ctx, ctx.sprite.CMDYC);
+	q[3].x = x2s(ctx, ctx.sprite.CMDXD);
+	q[3].y = y2s(ctx, ctx.sprite.CMDYD);
 
 	if(direction & 1) { // xflip
 		q[0].u = q[3].u = xsize-1;
@@ -1566,11 +1566,11 @@ void saturn_state::stv_vdp1_draw_distorted_sprite(const rectangle &cliprect)
 		q[2].v = q[3].v = ysize-1;
 	}
 
-	stv_vdp1_setup_shading(q, cliprect);
-	vdp1_fill_quad(cliprect, patterndata, xsize, q);
+	stv_vdp1_setup_shading(ctx, q, cliprect);
+	vdp1_fill_quad(ctx, cliprect, patterndata, xsize, q);
 }
 
-void saturn_state::stv_vdp1_draw_scaled_sprite(const rectangle &cliprect)
+void saturn_state::stv_vdp1_draw_scaled_sprite(vdp1_draw_context &ctx, const rectangle &cliprect)
 {
 	struct spoint q[4];
 
@@ -1582,29 +1582,29 @@ void saturn_state::stv_vdp1_draw_scaled_sprite(const rectangle &cliprect)
 	int x2,y2;
 	int screen_width,screen_height,screen_height_negative = 0;
 
-	direction = (stv2_current_sprite.CMDCTRL & 0x0030)>>4;
+	direction = (ctx.sprite.CMDCTRL & 0x0030)>>4;
 
-	xsize = (stv2_current_sprite.CMDSIZE & 0x3f00) >> 8;
+	xsize = (ctx.sprite.CMDSIZE & 0x3f00) >> 8;
 	xsize = xsize * 8;
 
-	ysize = (stv2_current_sprite.CMDSIZE & 0x00ff);
+	ysize = (ctx.sprite.CMDSIZE & 0x00ff);
 
-	patterndata = (stv2_current_sprite.CMDSRCA) & 0xffff;
+	patterndata = (ctx.sprite.CMDSRCA) & 0xffff;
 	patterndata = patterndata * 0x8;
 
-	zoompoint = (stv2_current_sprite.CMDCTRL & 0x0f00)>>8;
+	zoompoint = (ctx.sprite.CMDCTRL & 0x0f00)>>8;
 
-	x = stv2_current_sprite.CMDXA;
-	y = stv2_current_sprite.CMDYA;
+	x = ctx.sprite.CMDXA;
+	y = ctx.sprite.CMDYA;
 
-	screen_width = (int16_t)stv2_current_sprite.CMDXB;
+	screen_width = (int16_t)ctx.sprite.CMDXB;
 	if ( (screen_width < 0) && zoompoint)
 	{
 		screen_width = -screen_width;
 		direction |= 1;
 	}
 
-	screen_height = (int16_t)stv2_current_sprite.CMDYB;
+	screen_height = (int16_t)ctx.sprite.CMDYB;
 	if ( (screen_height < 0) && zoompoint )
 	{
 		screen_height_negative = 1;
@@ -1612,8 +1612,8 @@ void saturn_state::stv_vdp1_draw_scaled_sprite(const rectangle &cliprect)
 		direction |= 2;
 	}
 
-	x2 = stv2_current_sprite.CMDXC; // second co-ordinate set x
-	y2 = stv2_current_sprite.CMDYC; // second co-ordinate set y
+	x2 = ctx.sprite.CMDXC; // second co-ordinate set x
+	y2 = ctx.sprite.CMDYC; // second co-ordinate set y
 
 	switch (zoompoint)
 	{
@@ -1668,14 +1668,14 @@ void saturn_state::stv_vdp1_draw_scaled_sprite(const rectangle &cliprect)
 
 	if (zoompoint)
 	{
-		q[0].x = x2s(x);
-		q[0].y = y2s(y);
-		q[1].x = x2s(x)+screen_width;
-		q[1].y = y2s(y);
-		q[2].x = x2s(x)+screen_width;
-		q[2].y = y2s(y)+screen_height;
-		q[3].x = x2s(x);
-		q[3].y = y2s(y)+screen_height;
+		q[0].x = x2s(ctx, x);
+		q[0].y = y2s(ctx, y);
+		q[1].x = x2s(ctx, x)+screen_width;
+		q[1].y = y2s(ctx, y);
+		q[2].x = x2s(ctx, x)+screen_width;
+		q[2].y = y2s(ctx, y)+screen_height;
+		q[3].x = x2s(ctx, x);
+		q[3].y = y2s(ctx, y)+screen_height;
 
 		if ( screen_height_negative )
 		{
@@ -1687,14 +1687,14 @@ void saturn_state::stv_vdp1_draw_scaled_sprite(const rectangle &cliprect)
 	}
 	else
 	{
-		q[0].x = x2s(x);
-		q[0].y = y2s(y);
-		q[1].x = x2s(x2);
-		q[1].y = y2s(y);
-		q[2].x = x2s(x2);
-		q[2].y = y2s(y2);
-		q[3].x = x2s(x);
-		q[3].y = y2s(y2);
+		q[0].x = x2s(ctx, x);
+		q[0].y = y2s(ctx, y);
+		q[1].x = x2s(ctx, x2);
+		q[1].y = y2s(ctx, y);
+		q[2].x = x2s(ctx, x2);
+		q[2].y = y2s(ctx, y2);
+		q[3].x = x2s(ctx, x);
+		q[3].y = y2s(ctx, y2);
 	}
 
 
@@ -1713,14 +1713,14 @@ void saturn_state::stv_vdp1_draw_scaled_sprite(const rectangle &cliprect)
 		q[2].v = q[3].v = ysize-1;
 	}
 
-	stv_vdp1_setup_shading(q, cliprect);
-	vdp1_fill_quad(cliprect, patterndata, xsize, q);
+	stv_vdp1_setup_shading(ctx, q, cliprect);
+	vdp1_fill_quad(ctx, cliprect, patterndata, xsize, q);
 }
 
 
 
 
-void saturn_state::stv_vdp1_draw_normal_sprite(const rectangle &cliprect, int sprite_type)
+void saturn_state::stv_vdp1_draw_normal_sprite(vdp1_draw_context &ctx, const rectangle &cliprect, int sprite_type)
 {
 	int y, ysize, drawypos;
 	int x, xsize, drawxpos;
@@ -1730,17 +1730,17 @@ void saturn_state::stv_vdp1_draw_normal_sprite(const rectangle &cliprect, int sp
 	int su, u, dux, duy;
 	int maxdrawypos, maxdrawxpos;
 
-	x = x2s(stv2_current_sprite.CMDXA);
-	y = y2s(stv2_current_sprite.CMDYA);
+	x = x2s(ctx, ctx.sprite.CMDXA);
+	y = y2s(ctx, ctx.sprite.CMDYA);
 
-	direction = (stv2_current_sprite.CMDCTRL & 0x0030)>>4;
+	direction = (ctx.sprite.CMDCTRL & 0x0030)>>4;
 
-	xsize = (stv2_current_sprite.CMDSIZE & 0x3f00) >> 8;
+	xsize = (ctx.sprite.CMDSIZE & 0x3f00) >> 8;
 	xsize = xsize * 8;
 
-	ysize = (stv2_current_sprite.CMDSIZE & 0x00ff);
+	ysize = (ctx.sprite.CMDSIZE & 0x00ff);
 
-	patterndata = (stv2_current_sprite.CMDSRCA) & 0xffff;
+	patterndata = (ctx.sprite.CMDSRCA) & 0xffff;
 	patterndata = patterndata * 0x8;
 
 	if (VDP1_LOG) logerror ("Drawing Normal Sprite x %04x y %04x xsize %04x ysize %04x patterndata %06x\n",x,y,xsize,ysize,patterndata);
@@ -1748,7 +1748,7 @@ void saturn_state::stv_vdp1_draw_normal_sprite(const rectangle &cliprect, int sp
 	if ( x > cliprect.max_x ) return;
 	if ( y > cliprect.max_y ) return;
 
-	shading = stv_read_gouraud_table();
+	shading = stv_read_gouraud_table(ctx);
 	if ( shading )
 	{
 		struct spoint q[4];
@@ -1757,7 +1757,7 @@ void saturn_state::stv_vdp1_draw_normal_sprite(const rectangle &cliprect, int sp
 		q[2].x = x + xsize; q[2].y = y + ysize;
 		q[3].x = x; q[3].y = y + ysize;
 
-		stv_vdp1_setup_shading( q, cliprect );
+		stv_vdp1_setup_shading(ctx, q, cliprect );
 	}
 
 	u = 0;
@@ -1775,7 +1775,7 @@ void saturn_state::stv_vdp1_draw_normal_sprite(const rectangle &cliprect, int sp
 	}
 	if ( y < cliprect.min_y ) //clip y
 	{
-		u += xsize*(cliprect.min_y - y);
+		u += duy*(cliprect.min_y - y);
 		ysize -= (cliprect.min_y - y);
 		y = cliprect.min_y;
 	}
@@ -1793,7 +1793,7 @@ void saturn_state::stv_vdp1_draw_normal_sprite(const rectangle &cliprect, int sp
 		su = u;
 		for (drawxpos = x; drawxpos <= maxdrawxpos; drawxpos++ )
 		{
-			(this->*drawpixel)( drawxpos, drawypos, patterndata, u );
+			(this->*ctx.drawpixel)(ctx, drawxpos, drawypos, patterndata, u );
 			u += dux;
 		}
 		u = su + duy;
@@ -1818,6 +1818,57 @@ TIMER_CALLBACK_MEMBER(saturn_state::vdp1_draw_end )
 }
 
 
+void saturn_state::stv_vdp1_draw_commands(vdp1_draw_context &ctx, const rectangle &band)
+{
+	stv_clear_gouraud_shading(ctx);
+
+	for (const vdp1_command &command : m_vdp1_commands)
+	{
+		rectangle cliprect = command.cliprect;
+		cliprect &= band;
+		if (cliprect.empty())
+			continue;
+
+		ctx.sprite = command.sprite;
+		ctx.local_x = command.local_x;
+		ctx.local_y = command.local_y;
+
+		stv_vdp1_set_drawpixel(ctx);
+
+		switch (ctx.sprite.CMDCTRL & 0x000f)
+		{
+			case 0x0000:
+				stv_vdp1_draw_normal_sprite(ctx, cliprect, 0);
+				break;
+
+			case 0x0001:
+				stv_vdp1_draw_scaled_sprite(ctx, cliprect);
+				break;
+
+			case 0x0002:
+			case 0x0003:
+			case 0x0004:
+				stv_vdp1_draw_distorted_sprite(ctx, cliprect);
+				break;
+
+			case 0x0005:
+				stv_vdp1_draw_poly_line(ctx, cliprect);
+				break;
+
+			case 0x0006:
+				stv_vdp1_draw_line(ctx, cliprect);
+				break;
+		}
+	}
+}
+
+void *saturn_state::stv_vdp1_draw_band_callback(void *param, int threadid)
+{
+	vdp1_band &band = *reinterpret_cast<vdp1_band *>(param);
+	band.state->stv_vdp1_draw_commands(band.ctx, band.clip);
+	return nullptr;
+}
+
 void saturn_state::stv_vdp1_process_list( void )
 {
 	int position;
@@ -1832,7 +1883,7 @@ void saturn_state::stv_vdp1_process_list( void )
 
 	vdp1_nest = -1;
 
-	stv_clear_gouraud_shading();
+	m_vdp1_commands.clear();
 
 	/*Set CEF bit to 0*/
 	CEF_0;
@@ -1972,20 +2023,18 @@ void saturn_state::stv_vdp1_process_list( void )
 				cliprect = &m_vdp1.system_cliprect;
 			}
 
-			stv_vdp1_set_drawpixel();
-
 			switch (stv2_current_sprite.CMDCTRL & 0x000f)
 			{
 				case 0x0000:
 					if (VDP1_LOG) logerror ("Sprite List Normal Sprite (%d %d)\n",stv2_current_sprite.CMDXA,stv2_current_sprite.CMDYA);
 					stv2_current_sprite.ispoly = 0;
-					stv_vdp1_draw_normal_sprite(*cliprect, 0);
+					m_vdp1_commands.push_back(vdp1_command{ stv2_current_sprite, *cliprect, m_vdp1.local_x, m_vdp1.local_y });
 					break;
 
 				case 0x0001:
 					if (VDP1_LOG) logerror ("Sprite List Scaled Sprite (%d %d)\n",stv2_current_sprite.CMDXA,stv2_current_sprite.CMDYA);
 					stv2_current_sprite.ispoly = 0;
-					stv_vdp1_draw_scaled_sprite(*cliprect);
+					m_vdp1_commands.push_back(vdp1_command{ stv2_current_sprite, *cliprect, m_vdp1.local_x, m_vdp1.local_y });
 					break;
 
 				case 0x0002:
@@ -1998,26 +2047,26 @@ void saturn_state::stv_vdp1_process_list( void )
 					if (VDP1_LOG) logerror ("CMDPMOD = %04x\n",stv2_current_sprite.CMDPMOD);
 
 					stv2_current_sprite.ispoly = 0;
-					stv_vdp1_draw_distorted_sprite(*cliprect);
+					m_vdp1_commands.push_back(vdp1_command{ stv2_current_sprite, *cliprect, m_vdp1.local_x, m_vdp1.local_y });
 					break;
 
 				case 0x0004:
 					if (VDP1_LOG) logerror ("Sprite List Polygon\n");
 					stv2_current_sprite.ispoly = 1;
-					stv_vdp1_draw_distorted_sprite(*cliprect);
+					m_vdp1_commands.push_back(vdp1_command{ stv2_current_sprite, *cliprect, m_vdp1.local_x, m_vdp1.local_y });
 					break;
 
 				case 0x0005:
 //              case 0x0007: // mirror? Baroque uses it, crashes for whatever reason
 					if (VDP1_LOG) logerror ("Sprite List Polyline\n");
 					stv2_current_sprite.ispoly = 1;
-					stv_vdp1_draw_poly_line(*cliprect);
+					m_vdp1_commands.push_back(vdp1_command{ stv2_current_sprite, *cliprect, m_vdp1.local_x, m_vdp1.local_y });
 					break;
 
 				case 0x0006:
 					if (VDP1_LOG) logerror ("Sprite List Line\n");
 					stv2_current_sprite.ispoly = 1;
-					stv_vdp1_draw_line(*cliprect);
+					m_vdp1_commands.push_back(vdp1_command{ stv2_current_sprite, *cliprect, m_vdp1.local_x, m_vdp1.local_y });
 					break;
 
 				case 0x0008:
@@ -2053,6 +2102,17 @@ void saturn_state::stv_vdp1_process_list( void )
 	end:
 	m_vdp1.copr = (position * 0x20) >> 3;
 
+	// commands only overlap where they share framebuffer lines, so each band can draw the whole list clipped to itself
+	if (VDP1_SERIAL || !m_vdp1_queue)
+	{
+		stv_vdp1_draw_commands(m_vdp1_bands[0].ctx, rectangle(0, 1023, 0, 511));
+	}
+	else if (!m_vdp1_commands.empty())
+	{
+		osd_work_item_queue_multiple(m_vdp1_queue, stv_vdp1_draw_band_callback, VDP1_BANDS, m_vdp1_bands, sizeof(m_vdp1_bands[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(m_vdp1_queue, osd_ticks_per_second())) { }
+	}
+
 
 	/* TODO: what's the exact formula? Guess it should be a mix between number of pixels written and actual command data fetched. */
 	// if spritecount = 10000 don't send a vdp1 draw end
@@ -2185,7 +2245,13 @@ int saturn_state::stv_vdp1_start ( void )
 	m_vdp1_vram = make_unique_clear<uint32_t[]>(0x100000/4 );
 	m_vdp1.gfx_decode = std::make_unique<uint8_t[]>(0x100000 );
 
-	stv_vdp1_shading_data = std::make_unique<struct stv_vdp1_poly_scanline_data>();
+	for (int i = 0; i < VDP1_BANDS; i++)
+	{
+		m_vdp1_bands[i].state = this;
+		m_vdp1_bands[i].clip.set(0, 1023, i * VDP1_BAND_LINES, (i + 1) * VDP1_BAND_LINES - 1);
+		m_vdp1_bands[i].ctx.shading = std::make_unique<struct stv_vdp1_poly_scanline_data>();
+	}
+	m_vdp1_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
 
 	m_vdp1.framebuffer[0] = std::make_unique<uint16_t[]>(1024 * 256 * 2 ); /* *2 is for double interlace */
 	m_vdp1.framebuffer[1] = std::make_unique<uint16_t[]>(1024 * 256 * 2 );
@@ -8442,6 +8508,12 @@ void saturn_state::stv_vdp2_exit ( void )
 {
 	m_vdp2.roz_bitmap[0].reset();
 	m_vdp2.roz_bitmap[1].reset();
+
+	if (m_vdp1_queue)
+	{
+		osd_work_queue_free(m_vdp1_queue);
+		m_vdp1_queue = nullptr;
+	}
 }
 
 int saturn_state::stv_vdp2_start ( void )
@@ -724,6 +724,7 @@ void tecmosys_state::descramble()
 	m_sprite_gfx = make_unique_clear<u8[]>(m_sprite_gfx_mask);
 
 	gfx_element *gfx = m_gfxdecode->gfx(4);
+	m_gfxdecode->predecode_gfx(4);
 	u8 *dst = m_sprite_gfx.get();
 	for (int e = 0; e < gfx->elements(); e++)
 	{
@@ -181,6 +181,13 @@ void mac_osd_interface::extract_video_config()
 	video_config.switchres     = options().switch_res();
 	video_config.waitvsync     = options().wait_vsync();
 	video_config.syncrefresh   = options().sync_refresh();
+	video_config.vrr           = options().vrr();
+	if (video_config.vrr)
+	{
+		// the display follows our presentation, so wait for vsync to avoid tearing and throttle to the game time
+		video_config.waitvsync = 1;
+		video_config.syncrefresh = 0;
+	}
 	if (!video_config.waitvsync && video_config.syncrefresh)
 	{
 		osd_printf_warning("-syncrefresh specified without -waitvsync. Reverting to -nosyncrefresh\n");
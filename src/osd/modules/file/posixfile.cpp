@@ -47,10 +47,12 @@
 #include "osdcore.h"
 #include "unicode.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cerrno>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <vector>
@@ -58,6 +60,9 @@
 #include <fcntl.h>
 #include <climits>
 #include <sys/stat.h>
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#endif
 #include <cstdlib>
 #include <unistd.h>
 
@@ -86,18 +91,30 @@ public:
 	posix_osd_file& operator=(posix_osd_file const &) = delete;
 	posix_osd_file& operator=(posix_osd_file &&) = delete;
 
-	posix_osd_file(int fd) noexcept : m_fd(fd)
+	posix_osd_file(int fd, std::uint64_t mapsize) noexcept : m_fd(fd), m_mapsize(mapsize)
 	{
 		assert(m_fd >= 0);
 	}
 
 	virtual ~posix_osd_file() override
 	{
+#if !defined(_WIN32)
+		if (m_map)
+			::munmap(const_cast<void *>(m_map), std::size_t(m_mapsize));
+#endif
 		::close(m_fd);
 	}
 
 	virtual std::error_condition read(void *buffer, std::uint64_t offset, std::uint32_t count, std::uint32_t &actual) noexcept override
 	{
+		// the mapping covers the whole file, and nothing can write through this handle
+		if (m_map)
+		{
+			actual = (offset < m_mapsize) ? std::uint32_t((std::min<std::uint64_t>)(count, m_mapsize - offset)) : 0U;
+			std::memcpy(buffer, reinterpret_cast<std::uint8_t const *>(m_map) + offset, actual);
+			return std::error_condition();
+		}
+
 		ssize_t result;
 
 #if defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || defined(__bsdi__) || defined(__DragonFly__) || defined(__EMSCRIPTEN__) || defined(__ANDROID__)
@@ -160,8 +177,26 @@ public:
 		return std::error_condition();
 	}
 
+	virtual void const *map() noexcept override
+	{
+#if !defined(_WIN32)
+		// a size of zero means the file isn't mappable or was opened for writing
+		if (!m_map && m_mapsize && (std::numeric_limits<std::size_t>::max() >= m_mapsize))
+		{
+			void *const result = ::mmap(nullptr, std::size_t(m_mapsize), PROT_READ, MAP_SHARED, m_fd, 0);
+			if (MAP_FAILED != result)
+				m_map = result;
+			else
+				m_mapsize = 0U;
+		}
+#endif
+		return m_map;
+	}
+
 private:
 	int m_fd;
+	std::uint64_t m_mapsize;
+	void const *m_map = nullptr;
 };
 
 
@@ -317,7 +352,9 @@ std::error_condition osd_file::open(std::string const &path, std::uint32_t openf
 		return staterr;
 	}
 
-	osd_file::ptr result(new (std::nothrow) posix_osd_file(fd));
+	// only map regular files opened read-only, since writes could change the size
+	std::uint64_t const mapsize((!(openflags & OPEN_FLAG_WRITE) && S_ISREG(st.st_mode)) ? std::uint64_t(st.st_size) : 0U);
+	osd_file::ptr result(new (std::nothrow) posix_osd_file(fd, mapsize));
 	if (!result)
 	{
 		::close(fd);
@@ -17,8 +17,10 @@
 // MAME headers
 #include "osdcore.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <limits>
 #include <memory>
 
 // standard windows headers
@@ -44,7 +46,7 @@ public:
 	win_osd_file& operator=(win_osd_file const &) = delete;
 	win_osd_file& operator=(win_osd_file &&) = delete;
 
-	win_osd_file(HANDLE handle) noexcept : m_handle(handle)
+	win_osd_file(HANDLE handle, std::uint64_t mapsize) noexcept : m_handle(handle), m_mapsize(mapsize)
 	{
 		assert(m_handle);
 		assert(INVALID_HANDLE_VALUE != m_handle);
@@ -52,12 +54,22 @@ public:
 
 	virtual ~win_osd_file() override
 	{
+		if (m_map)
+			UnmapViewOfFile(m_map);
 		FlushFileBuffers(m_handle);
 		CloseHandle(m_handle);
 	}
 
 	virtual std::error_condition read(void *buffer, std::uint64_t offset, std::uint32_t length, std::uint32_t &actual) noexcept override
 	{
+		// the view covers the whole file, and nothing can write through this handle
+		if (m_map)
+		{
+			actual = (offset < m_mapsize) ? std::uint32_t((std::min<std::uint64_t>)(length, m_mapsize - offset)) : 0U;
+			std::memcpy(buffer, reinterpret_cast<std::uint8_t const *>(m_map) + offset, actual);
+			return std::error_condition();
+		}
+
 		// attempt to set the file pointer
 		LARGE_INTEGER largeOffset;
 		largeOffset.QuadPart = offset;
@@ -111,8 +123,28 @@ public:
 		return std::error_condition();
 	}
 
+	virtual void const *map() noexcept override
+	{
+		// a size of zero means the file isn't mappable or was opened for writing
+		if (!m_map && m_mapsize && ((std::numeric_limits<SIZE_T>::max)() >= m_mapsize))
+		{
+			HANDLE const mapping = CreateFileMapping(m_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (mapping)
+			{
+				// the view keeps the mapping object alive
+				m_map = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, SIZE_T(m_mapsize));
+				CloseHandle(mapping);
+			}
+			if (!m_map)
+				m_mapsize = 0U;
+		}
+		return m_map;
+	}
+
 private:
 	HANDLE m_handle;
+	std::uint64_t m_mapsize;
+	void const *m_map = nullptr;
 };
 
 
@@ -259,7 +291,12 @@ std::error_condition osd_file::open(std::string const &path, uint32_t openflags,
 		}
 	}
 
-	osd_file::ptr result(new (std::nothrow) win_osd_file(h));
+	// only map regular files opened read-only, since writes could change the size
+	std::uint64_t const mapsize(
+			(!(openflags & OPEN_FLAG_WRITE) && !is_path_to_physical_drive(path.c_str()) && (FILE_TYPE_DISK == GetFileType(h)))
+				? ((std::uint64_t(upper) << 32) | lower)
+				: 0U);
+	osd_file::ptr result(new (std::nothrow) win_osd_file(h, mapsize));
 	if (!result)
 	{
 		CloseHandle(h);
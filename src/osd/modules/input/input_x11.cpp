@@ -29,8 +29,13 @@
 #include <X11/extensions/XInput.h>
 #include <X11/Xutil.h>
 
+#include <poll.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <cerrno>
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
@@ -38,6 +43,7 @@
 #include <mutex>
 #include <queue>
 #include <string>
+#include <thread>
 #include <unordered_map>
 
 
@@ -330,9 +336,40 @@ private:
 	template <typename T> using x_ptr = std::unique_ptr<T, x_cleanup>;
 
 	x_ptr<Display> m_display;
+	std::thread m_thread;
+	std::atomic<bool> m_stop = false;
+	std::atomic<bool> m_threaded = false;
+	int m_wake[2] = { -1, -1 };
 
 	x11_event_manager() = default;
 
+	~x11_event_manager()
+	{
+		stop_thread();
+	}
+
+	void run()
+	{
+		pollfd fds[2];
+		fds[0].fd = ConnectionNumber(m_display.get());
+		fds[0].events = POLLIN;
+		fds[1].fd = m_wake[0];
+		fds[1].events = POLLIN;
+
+		while (!m_stop.load(std::memory_order_acquire))
+		{
+			// drain anything Xlib has already read before blocking on the connection
+			process_events();
+			fds[0].revents = fds[1].revents = 0;
+			if ((poll(fds, 2, -1) < 0) && (errno != EINTR))
+			{
+				osd_printf_error("X11 input thread: poll failed, falling back to polling once per frame\n");
+				break;
+			}
+		}
+		m_threaded.store(false, std::memory_order_release);
+	}
+
 public:
 	Display *display() const { return m_display.get(); }
 
@@ -366,6 +403,42 @@ public:
 		return 0;
 	}
 
+	bool thread_running() const { return m_threaded.load(std::memory_order_acquire); }
+
+	void start_thread()
+	{
+		// only start once subscriptions and event registration are done, Xlib isn't thread-safe
+		if (!m_display || m_thread.joinable())
+			return;
+		if (pipe(m_wake) < 0)
+		{
+			osd_printf_verbose("X11 input thread: unable to create wake pipe\n");
+			m_wake[0] = m_wake[1] = -1;
+			return;
+		}
+		m_stop.store(false, std::memory_order_relaxed);
+		m_threaded.store(true, std::memory_order_relaxed);
+		m_thread = std::thread([this] () { run(); });
+	}
+
+	void stop_thread()
+	{
+		if (m_thread.joinable())
+		{
+			m_stop.store(true, std::memory_order_release);
+			char const wake = 0;
+			[[maybe_unused]] auto const written = write(m_wake[1], &wake, 1);
+			m_thread.join();
+		}
+		m_threaded.store(false, std::memory_order_relaxed);
+		for (int &fd : m_wake)
+		{
+			if (fd >= 0)
+				close(fd);
+			fd = -1;
+		}
+	}
+
 	void process_events()
 	{
 		std::lock_guard<std::mutex> scope_lock(subscription_mutex());
@@ -657,11 +730,17 @@ public:
 		osd_printf_verbose("Events types to register: motion:%d, press:%d, release:%d\n", motion_type, button_press_type, button_release_type);
 		subscribe(x11_event_manager::instance(), event_types);
 
+		// read events as they arrive rather than when the emulation thread polls
+		x11_event_manager::instance().start_thread();
+
 		osd_printf_verbose("Lightgun: End initialization\n");
 	}
 
 	virtual void exit() override
 	{
+		// stop reading events before the devices go away
+		x11_event_manager::instance().stop_thread();
+
 		// unsubscribe from events
 		unsubscribe();
 
@@ -678,8 +757,9 @@ public:
 		// trigger the SDL event manager so it can process window events
 		input_module_impl<x11_input_device, osd_common_t>::before_poll();
 
-		// Tell the event manager to process events and push them to the devices
-		if (should_poll_devices())
+		// Tell the event manager to process events and push them to the devices,
+		// unless its thread is already doing it
+		if (should_poll_devices() && !x11_event_manager::instance().thread_running())
 			x11_event_manager::instance().process_events();
 	}
 
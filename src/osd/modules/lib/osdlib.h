@@ -104,19 +104,19 @@ public:
 	{
 		m_memory = do_alloc(blocks, intent, m_size, m_page_size);
 	}
-	virtual_memory_allocation(virtual_memory_allocation &&that) noexcept : m_memory(that.m_memory), m_size(that.m_size), m_page_size(that.m_page_size)
+	virtual_memory_allocation(virtual_memory_allocation &&that) noexcept : m_memory(that.m_memory), m_alias(that.m_alias), m_size(that.m_size), m_page_size(that.m_page_size)
 	{
-		that.m_memory = nullptr;
+		that.m_memory = that.m_alias = nullptr;
 		that.m_size = that.m_page_size = 0U;
 	}
 	~virtual_memory_allocation()
 	{
-		if (m_memory)
-			do_free(m_memory, m_size);
+		release();
 	}
 
 	explicit operator bool() const noexcept { return bool(m_memory); }
 	void *get() noexcept { return m_memory; }
+	void *alias() noexcept { return m_alias; }
 	std::size_t size() const noexcept { return m_size; }
 	std::size_t page_size() const noexcept { return m_page_size; }
 
@@ -128,11 +128,28 @@ public:
 			return do_set_access(reinterpret_cast<std::uint8_t *>(m_memory) + start, size, access);
 	}
 
+	// map the whole allocation a second time with different access - writes through one view are visible through the other
+	bool create_alias(unsigned access) noexcept
+	{
+		if (!m_memory || m_alias)
+			return false;
+		m_alias = do_alias(m_memory, m_size, access);
+		return bool(m_alias);
+	}
+
+	// hint that a range should be backed by large pages where the host supports it
+	bool advise_huge_pages(std::size_t start, std::size_t size) noexcept
+	{
+		if ((start % m_page_size) || (size % m_page_size) || (start > m_size) || ((m_size - start) < size))
+			return false;
+		else
+			return do_advise_huge_pages(reinterpret_cast<std::uint8_t *>(m_memory) + start, size);
+	}
+
 	virtual_memory_allocation &operator=(std::nullptr_t) noexcept
 	{
-		if (m_memory)
-			do_free(m_memory, m_size);
-		m_memory = nullptr;
+		release();
+		m_memory = m_alias = nullptr;
 		m_size = m_page_size = 0U;
 		return *this;
 	}
@@ -141,12 +158,12 @@ public:
 	{
 		if (&that != this)
 		{
-			if (m_memory)
-				do_free(m_memory, m_size);
+			release();
 			m_memory = that.m_memory;
+			m_alias = that.m_alias;
 			m_size = that.m_size;
 			m_page_size = that.m_page_size;
-			that.m_memory = nullptr;
+			that.m_memory = that.m_alias = nullptr;
 			that.m_size = that.m_page_size = 0U;
 		}
 		return *this;
@@ -156,12 +173,168 @@ private:
 	static void *do_alloc(std::initializer_list<std::size_t> blocks, unsigned intent, std::size_t &size, std::size_t &page_size) noexcept;
 	static void do_free(void *start, std::size_t size) noexcept;
 	static bool do_set_access(void *start, std::size_t size, unsigned access) noexcept;
+	static void *do_alias(void *start, std::size_t size, unsigned access) noexcept;
+	static bool do_advise_huge_pages(void *start, std::size_t size) noexcept;
+
+	void release() noexcept
+	{
+		if (m_alias)
+			do_free(m_alias, m_size);
+		if (m_memory)
+			do_free(m_memory, m_size);
+	}
+
+	void *m_memory = nullptr;
+	void *m_alias = nullptr;
+	std::size_t m_size = 0U, m_page_size = 0U;
+};
+
+
+// private, writable view of a file - pages that are only read stay shared with every other process mapping the file, written pages become private copies
+class mapped_file_view
+{
+public:
+	mapped_file_view(mapped_file_view const &) = delete;
+	mapped_file_view &operator=(mapped_file_view const &) = delete;
+
+	mapped_file_view() noexcept { }
+	mapped_file_view(std::string const &path, std::size_t size) noexcept
+	{
+		m_memory = do_map(path, size);
+		if (m_memory)
+			m_size = size;
+	}
+	mapped_file_view(mapped_file_view &&that) noexcept : m_memory(that.m_memory), m_size(that.m_size)
+	{
+		that.m_memory = nullptr;
+		that.m_size = 0U;
+	}
+	~mapped_file_view()
+	{
+		if (m_memory)
+			do_unmap(m_memory, m_size);
+	}
+
+	explicit operator bool() const noexcept { return bool(m_memory); }
+	void *get() noexcept { return m_memory; }
+	std::size_t size() const noexcept { return m_size; }
+
+private:
+	static void *do_map(std::string const &path, std::size_t size) noexcept;
+	static void do_unmap(void *start, std::size_t size) noexcept;
+
+	void *m_memory = nullptr;
+	std::size_t m_size = 0U;
+};
+
+
+// named, writable memory that other processes can map by name - the name is removed again when the region is destroyed
+class shared_memory_region
+{
+public:
+	shared_memory_region(shared_memory_region const &) = delete;
+	shared_memory_region &operator=(shared_memory_region const &) = delete;
+
+	shared_memory_region() noexcept { }
+	shared_memory_region(std::string &&name, std::size_t size) noexcept : m_name(std::move(name))
+	{
+		m_memory = do_create(m_name, size, m_handle);
+		if (m_memory)
+			m_size = size;
+	}
+	shared_memory_region(shared_memory_region &&that) noexcept : m_name(std::move(that.m_name)), m_memory(that.m_memory), m_handle(that.m_handle), m_size(that.m_size)
+	{
+		that.m_memory = nullptr;
+		that.m_handle = nullptr;
+		that.m_size = 0U;
+	}
+	~shared_memory_region()
+	{
+		if (m_memory)
+			do_destroy(m_name, m_memory, m_size, m_handle);
+	}
+
+	explicit operator bool() const noexcept { return bool(m_memory); }
+	void *get() noexcept { return m_memory; }
+	std::size_t size() const noexcept { return m_size; }
+	std::string const &name() const noexcept { return m_name; }
+
+private:
+	static void *do_create(std::string const &name, std::size_t size, void *&handle) noexcept;
+	static void do_destroy(std::string const &name, void *start, std::size_t size, void *handle) noexcept;
+
+	std::string m_name;
+	void *m_memory = nullptr;
+	void *m_handle = nullptr;
+	std::size_t m_size = 0U;
+};
+
+
+// private, zero-filled, writable memory aligned to the host's large page size and backed by large pages where the host can provide them - falls back to ordinary pages, so ask huge_page_bytes() what was obtained
+class large_page_allocation
+{
+public:
+	large_page_allocation(large_page_allocation const &) = delete;
+	large_page_allocation &operator=(large_page_allocation const &) = delete;
+
+	large_page_allocation() noexcept { }
+	large_page_allocation(std::size_t size) noexcept
+	{
+		m_memory = do_alloc(size, m_size, m_page_size, m_locked);
+	}
+	large_page_allocation(large_page_allocation &&that) noexcept : m_memory(that.m_memory), m_size(that.m_size), m_page_size(that.m_page_size), m_locked(that.m_locked)
+	{
+		that.m_memory = nullptr;
+		that.m_size = that.m_page_size = 0U;
+		that.m_locked = false;
+	}
+	~large_page_allocation()
+	{
+		if (m_memory)
+			do_free(m_memory, m_size);
+	}
+
+	explicit operator bool() const noexcept { return bool(m_memory); }
+	void *get() noexcept { return m_memory; }
+	std::size_t size() const noexcept { return m_size; }
+	std::size_t page_size() const noexcept { return m_page_size; }
+
+	// whether the whole allocation was reserved as large pages up front, rather than left for the host to promote
+	bool locked() const noexcept { return m_locked; }
+
+	// bytes currently backed by large pages - pages the host promotes on its own are only counted once touched
+	std::size_t huge_page_bytes() const noexcept
+	{
+		return !m_memory ? 0U : m_locked ? m_size : do_huge_page_bytes(m_memory, m_size);
+	}
+
+private:
+	static void *do_alloc(std::size_t size, std::size_t &actual, std::size_t &page_size, bool &locked) noexcept;
+	static void do_free(void *start, std::size_t size) noexcept;
+	static std::size_t do_huge_page_bytes(void const *start, std::size_t size) noexcept;
 
 	void *m_memory = nullptr;
 	std::size_t m_size = 0U, m_page_size = 0U;
+	bool m_locked = false;
 };
 
 
+/// \brief Serve copies of this process over a local socket
+///
+/// Listens on a Unix domain socket.  Each client sends a single line
+/// of text, and the process forks; the copy returns with the line,
+/// while the original sends the copy's process ID back to the client
+/// and waits for the next one.  The copy keeps the client's connection
+/// open until it exits.  A line reading "exit" makes the original
+/// return.  Only the calling thread survives in the copies.
+/// \param [in] path Filesystem path of the socket.
+/// \param [out] forked Set in the copies.
+/// \param [out] request The line a copy was made for.
+/// \return An error condition if the socket could not be set up or
+///   copying processes is unsupported.
+std::error_condition fork_server(std::string const &path, bool &forked, std::string &request) noexcept;
+
+
 /*-----------------------------------------------------------------------------
     dynamic_module: load functions from optional shared libraries
 
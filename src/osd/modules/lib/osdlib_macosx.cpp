@@ -15,16 +15,23 @@
 #include <csignal>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iomanip>
 #include <memory>
+#include <new>
 
 #include <dlfcn.h>
+#include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
 #include <sys/sysctl.h>
 #include <sys/types.h>
+#include <sys/un.h>
 #include <unistd.h>
 
 #include <mach/mach.h>
+#include <mach/mach_vm.h>
 #include <mach/mach_time.h>
 #include <Carbon/Carbon.h>
 
@@ -327,6 +334,222 @@ bool virtual_memory_allocation::do_set_access(void *start, std::size_t size, uns
 	return mprotect(start, size, prot) == 0;
 }
 
+void *virtual_memory_allocation::do_alias(void *start, std::size_t size, unsigned access) noexcept
+{
+	mach_vm_address_t result(0);
+	vm_prot_t cur, max;
+	kern_return_t const err(mach_vm_remap(
+			mach_task_self(), &result, size, 0, VM_FLAGS_ANYWHERE,
+			mach_task_self(), mach_vm_address_t(uintptr_t(start)), FALSE,
+			&cur, &max, VM_INHERIT_NONE));
+	if (err != KERN_SUCCESS)
+		return nullptr;
+	int prot((NONE == access) ? PROT_NONE : 0);
+	if (access & READ)
+		prot |= PROT_READ;
+	if (access & WRITE)
+		prot |= PROT_WRITE;
+	if (access & EXECUTE)
+		prot |= PROT_EXEC;
+	if (mprotect(reinterpret_cast<void *>(uintptr_t(result)), size, prot) != 0)
+	{
+		munmap(reinterpret_cast<void *>(uintptr_t(result)), size);
+		return nullptr;
+	}
+	return reinterpret_cast<void *>(uintptr_t(result));
+}
+
+bool virtual_memory_allocation::do_advise_huge_pages(void *start, std::size_t size) noexcept
+{
+	// superpages can only be requested when the mapping is created
+	return false;
+}
+
+
+void *mapped_file_view::do_map(std::string const &path, std::size_t size) noexcept
+{
+	if (!size)
+		return nullptr;
+	int const fd(open(path.c_str(), O_RDONLY | O_CLOEXEC));
+	if (fd < 0)
+		return nullptr;
+	struct stat st;
+	void *result(MAP_FAILED);
+	if ((fstat(fd, &st) == 0) && (std::uint64_t(st.st_size) >= size))
+		result = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	return (result == MAP_FAILED) ? nullptr : result;
+}
+
+void mapped_file_view::do_unmap(void *start, std::size_t size) noexcept
+{
+	munmap(start, size);
+}
+
+
+void *shared_memory_region::do_create(std::string const &name, std::size_t size, void *&handle) noexcept
+{
+	handle = nullptr;
+	if (!size || name.empty() || (name.find('/') != std::string::npos))
+		return nullptr;
+	std::string path;
+	try { path = '/' + name; }
+	catch (...) { return nullptr; }
+
+	// a region left behind by a process that didn't exit cleanly is replaced
+	shm_unlink(path.c_str());
+	int const fd(shm_open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR));
+	if (fd < 0)
+		return nullptr;
+	void *result(MAP_FAILED);
+	if (ftruncate(fd, off_t(size)) == 0)
+		result = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (result == MAP_FAILED)
+	{
+		shm_unlink(path.c_str());
+		return nullptr;
+	}
+	return result;
+}
+
+void shared_memory_region::do_destroy(std::string const &name, void *start, std::size_t size, void *handle) noexcept
+{
+	munmap(start, size);
+	try { shm_unlink(('/' + name).c_str()); }
+	catch (...) { }
+}
+
+
+void *large_page_allocation::do_alloc(std::size_t size, std::size_t &actual, std::size_t &page_size, bool &locked) noexcept
+{
+	if (!size)
+		return nullptr;
+
+#if defined(VM_FLAGS_SUPERPAGE_SIZE_2MB)
+	// superpages are wired when mapped, and are only available on x86-64
+	std::size_t const huge(std::size_t(2) << 20);
+	std::size_t const s((size + huge - 1) & ~(huge - 1));
+	void *const reserved(mmap(nullptr, s, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, VM_FLAGS_SUPERPAGE_SIZE_2MB, 0));
+	if (reserved != MAP_FAILED)
+	{
+		actual = s;
+		page_size = huge;
+		locked = true;
+		return reserved;
+	}
+#endif
+
+	long const p(sysconf(_SC_PAGE_SIZE));
+	if (0 >= p)
+		return nullptr;
+	std::size_t const s((size + p - 1) / p * p);
+	void *const result(mmap(nullptr, s, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0));
+	if (result == MAP_FAILED)
+		return nullptr;
+	actual = s;
+	page_size = p;
+	locked = false;
+	return result;
+}
+
+void large_page_allocation::do_free(void *start, std::size_t size) noexcept
+{
+	munmap(start, size);
+}
+
+std::size_t large_page_allocation::do_huge_page_bytes(void const *start, std::size_t size) noexcept
+{
+	// ordinary pages are never promoted
+	return 0U;
+}
+
+
+std::error_condition fork_server(std::string const &path, bool &forked, std::string &request) noexcept
+{
+	forked = false;
+	request.clear();
+
+	struct sockaddr_un sau;
+	std::memset(&sau, 0, sizeof(sau));
+	sau.sun_family = AF_UNIX;
+	if (path.length() >= sizeof(sau.sun_path))
+		return std::errc::filename_too_long;
+	std::strncpy(sau.sun_path, path.c_str(), sizeof(sau.sun_path) - 1);
+
+	int const sock = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	if (sock < 0)
+		return std::error_condition(errno, std::generic_category());
+	::unlink(path.c_str());
+	if ((::bind(sock, reinterpret_cast<struct sockaddr const *>(&sau), sizeof(sau)) < 0) || (::listen(sock, 16) < 0))
+	{
+		std::error_condition const err(errno, std::generic_category());
+		::close(sock);
+		return err;
+	}
+
+	// the copies are never waited for, so don't let them linger as zombies
+	struct sigaction reap, original;
+	std::memset(&reap, 0, sizeof(reap));
+	reap.sa_handler = SIG_IGN;
+	reap.sa_flags = SA_NOCLDWAIT;
+	sigemptyset(&reap.sa_mask);
+	::sigaction(SIGCHLD, &reap, &original);
+
+	std::error_condition result;
+	try
+	{
+		while (true)
+		{
+			int const conn = ::accept(sock, nullptr, nullptr);
+			if (conn < 0)
+			{
+				if (EINTR == errno)
+					continue;
+				result = std::error_condition(errno, std::generic_category());
+				break;
+			}
+
+			// each client sends a single line describing what its copy should do
+			std::string line;
+			char ch;
+			while ((::read(conn, &ch, 1) == 1) && (ch != '\n'))
+				line.push_back(ch);
+			if (!line.empty() && (line.back() == '\r'))
+				line.pop_back();
+			if (line == "exit")
+			{
+				::close(conn);
+				break;
+			}
+
+			pid_t const pid = ::fork();
+			if (!pid)
+			{
+				// the copy keeps the connection open until it exits, so the client can wait for it
+				::close(sock);
+				::sigaction(SIGCHLD, &original, nullptr);
+				forked = true;
+				request = std::move(line);
+				return std::error_condition();
+			}
+
+			std::string const reply = (pid < 0) ? std::string("error\n") : (std::to_string(pid) + '\n');
+			[[maybe_unused]] ssize_t const written = ::write(conn, reply.c_str(), reply.length());
+			::close(conn);
+		}
+	}
+	catch (std::bad_alloc const &)
+	{
+		result = std::errc::not_enough_memory;
+	}
+
+	::close(sock);
+	::unlink(path.c_str());
+	::sigaction(SIGCHLD, &original, nullptr);
+	return result;
+}
+
 
 dynamic_module::ptr dynamic_module::open(std::vector<std::string> &&names)
 {
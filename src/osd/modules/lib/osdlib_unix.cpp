@@ -14,15 +14,23 @@
 
 #include <SDL2/SDL.h>
 
+#include <algorithm>
 #include <csignal>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iomanip>
 #include <memory>
+#include <new>
 
 #include <dlfcn.h>
+#include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/un.h>
 #include <unistd.h>
 
 
@@ -264,6 +272,261 @@ bool virtual_memory_allocation::do_set_access(void *start, std::size_t size, uns
 	return mprotect(reinterpret_cast<char *>(start), size, prot) == 0;
 }
 
+void *virtual_memory_allocation::do_alias(void *start, std::size_t size, unsigned access) noexcept
+{
+#if defined(__linux__)
+	// growing a shared mapping from zero size creates a second view of the same pages
+	int prot((NONE == access) ? PROT_NONE : 0);
+	if (access & READ)
+		prot |= PROT_READ;
+	if (access & WRITE)
+		prot |= PROT_WRITE;
+	if (access & EXECUTE)
+		prot |= PROT_EXEC;
+	void *const result(mremap(start, 0, size, MREMAP_MAYMOVE));
+	if (result == MAP_FAILED)
+		return nullptr;
+	if (mprotect(result, size, prot) != 0)
+	{
+		munmap(result, size);
+		return nullptr;
+	}
+	return result;
+#else
+	return nullptr;
+#endif
+}
+
+bool virtual_memory_allocation::do_advise_huge_pages(void *start, std::size_t size) noexcept
+{
+#if defined(MADV_HUGEPAGE)
+	return madvise(reinterpret_cast<char *>(start), size, MADV_HUGEPAGE) == 0;
+#else
+	return false;
+#endif
+}
+
+
+void *mapped_file_view::do_map(std::string const &path, std::size_t size) noexcept
+{
+	if (!size)
+		return nullptr;
+	int const fd(open(path.c_str(), O_RDONLY | O_CLOEXEC));
+	if (fd < 0)
+		return nullptr;
+	struct stat st;
+	void *result(MAP_FAILED);
+	if ((fstat(fd, &st) == 0) && (std::uint64_t(st.st_size) >= size))
+		result = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	return (result == MAP_FAILED) ? nullptr : result;
+}
+
+void mapped_file_view::do_unmap(void *start, std::size_t size) noexcept
+{
+	munmap(start, size);
+}
+
+
+void *shared_memory_region::do_create(std::string const &name, std::size_t size, void *&handle) noexcept
+{
+	handle = nullptr;
+	if (!size || name.empty() || (name.find('/') != std::string::npos))
+		return nullptr;
+	std::string path;
+	try { path = '/' + name; }
+	catch (...) { return nullptr; }
+
+	// a region left behind by a process that didn't exit cleanly is replaced
+	shm_unlink(path.c_str());
+	int const fd(shm_open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR));
+	if (fd < 0)
+		return nullptr;
+	void *result(MAP_FAILED);
+	if (ftruncate(fd, off_t(size)) == 0)
+		result = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (result == MAP_FAILED)
+	{
+		shm_unlink(path.c_str());
+		return nullptr;
+	}
+	return result;
+}
+
+void shared_memory_region::do_destroy(std::string const &name, void *start, std::size_t size, void *handle) noexcept
+{
+	munmap(start, size);
+	try { shm_unlink(('/' + name).c_str()); }
+	catch (...) { }
+}
+
+
+void *large_page_allocation::do_alloc(std::size_t size, std::size_t &actual, std::size_t &page_size, bool &locked) noexcept
+{
+	if (!size)
+		return nullptr;
+
+	// the size the kernel promotes anonymous memory to, assuming the usual 2MB if it won't say
+	std::size_t huge(std::size_t(2) << 20);
+#if defined(__linux__)
+	if (FILE *const f = std::fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r"))
+	{
+		unsigned long long value;
+		if ((std::fscanf(f, "%llu", &value) == 1) && value && !(value & (value - 1)))
+			huge = std::size_t(value);
+		std::fclose(f);
+	}
+#endif
+	std::size_t const s((size + huge - 1) & ~(huge - 1));
+
+#if defined(MAP_HUGETLB)
+	// pages reserved in hugetlbfs are only there if the administrator set some aside
+	void *const reserved(mmap(nullptr, s, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON | MAP_HUGETLB, -1, 0));
+	if (reserved != MAP_FAILED)
+	{
+		actual = s;
+		page_size = huge;
+		locked = true;
+		return reserved;
+	}
+#endif
+
+	// otherwise map enough to align the start, trim the excess, and ask for promotion
+	char *const base(reinterpret_cast<char *>(mmap(nullptr, s + huge, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0)));
+	if (base == MAP_FAILED)
+		return nullptr;
+	char *const result(reinterpret_cast<char *>((std::uintptr_t(base) + huge - 1) & ~std::uintptr_t(huge - 1)));
+	if (result != base)
+		munmap(base, result - base);
+	if ((base + s + huge) != (result + s))
+		munmap(result + s, (base + s + huge) - (result + s));
+#if defined(MADV_HUGEPAGE)
+	madvise(result, s, MADV_HUGEPAGE);
+#endif
+	actual = s;
+	page_size = huge;
+	locked = false;
+	return result;
+}
+
+void large_page_allocation::do_free(void *start, std::size_t size) noexcept
+{
+	munmap(start, size);
+}
+
+std::size_t large_page_allocation::do_huge_page_bytes(void const *start, std::size_t size) noexcept
+{
+#if defined(__linux__)
+	// sum the promoted pages of the mappings overlapping the allocation - a mapping merged with a neighbour is counted whole, so cap the result
+	FILE *const f(std::fopen("/proc/self/smaps", "r"));
+	if (!f)
+		return 0U;
+	std::uintptr_t const first(reinterpret_cast<std::uintptr_t>(start)), last(first + size);
+	bool overlaps(false);
+	std::size_t result(0);
+	char line[256];
+	while (std::fgets(line, sizeof(line), f))
+	{
+		unsigned long long lo, hi, kb;
+		if (std::sscanf(line, "%llx-%llx ", &lo, &hi) == 2)
+			overlaps = (lo < last) && (hi > first);
+		else if (overlaps && (std::sscanf(line, "AnonHugePages: %llu kB", &kb) == 1))
+			result += std::size_t(kb) << 10;
+	}
+	std::fclose(f);
+	return std::min(result, size);
+#else
+	return 0U;
+#endif
+}
+
+
+std::error_condition fork_server(std::string const &path, bool &forked, std::string &request) noexcept
+{
+	forked = false;
+	request.clear();
+
+	struct sockaddr_un sau;
+	std::memset(&sau, 0, sizeof(sau));
+	sau.sun_family = AF_UNIX;
+	if (path.length() >= sizeof(sau.sun_path))
+		return std::errc::filename_too_long;
+	std::strncpy(sau.sun_path, path.c_str(), sizeof(sau.sun_path) - 1);
+
+	int const sock = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	if (sock < 0)
+		return std::error_condition(errno, std::generic_category());
+	::unlink(path.c_str());
+	if ((::bind(sock, reinterpret_cast<struct sockaddr const *>(&sau), sizeof(sau)) < 0) || (::listen(sock, 16) < 0))
+	{
+		std::error_condition const err(errno, std::generic_category());
+		::close(sock);
+		return err;
+	}
+
+	// the copies are never waited for, so don't let them linger as zombies
+	struct sigaction reap, original;
+	std::memset(&reap, 0, sizeof(reap));
+	reap.sa_handler = SIG_IGN;
+	reap.sa_flags = SA_NOCLDWAIT;
+	sigemptyset(&reap.sa_mask);
+	::sigaction(SIGCHLD, &reap, &original);
+
+	std::error_condition result;
+	try
+	{
+		while (true)
+		{
+			int const conn = ::accept(sock, nullptr, nullptr);
+			if (conn < 0)
+			{
+				if (EINTR == errno)
+					continue;
+				result = std::error_condition(errno, std::generic_category());
+				break;
+			}
+
+			// each client sends a single line describing what its copy should do
+			std::string line;
+			char ch;
+			while ((::read(conn, &ch, 1) == 1) && (ch != '\n'))
+				line.push_back(ch);
+			if (!line.empty() && (line.back() == '\r'))
+				line.pop_back();
+			if (line == "exit")
+			{
+				::close(conn);
+				break;
+			}
+
+			pid_t const pid = ::fork();
+			if (!pid)
+			{
+				// the copy keeps the connection open until it exits, so the client can wait for it
+				::close(sock);
+				::sigaction(SIGCHLD, &original, nullptr);
+				forked = true;
+				request = std::move(line);
+				return std::error_condition();
+			}
+
+			std::string const reply = (pid < 0) ? std::string("error\n") : (std::to_string(pid) + '\n');
+			[[maybe_unused]] ssize_t const written = ::write(conn, reply.c_str(), reply.length());
+			::close(conn);
+		}
+	}
+	catch (std::bad_alloc const &)
+	{
+		result = std::errc::not_enough_memory;
+	}
+
+	::close(sock);
+	::unlink(path.c_str());
+	::sigaction(SIGCHLD, &original, nullptr);
+	return result;
+}
+
 
 dynamic_module::ptr dynamic_module::open(std::vector<std::string> &&names)
 {
@@ -364,6 +364,158 @@ bool virtual_memory_allocation::do_set_access(void *start, std::size_t size, uns
 	return VirtualAlloc(start, size, MEM_COMMIT, p) != nullptr;
 }
 
+void *virtual_memory_allocation::do_alias(void *start, std::size_t size, unsigned access) noexcept
+{
+	// memory from VirtualAlloc can't be mapped a second time
+	return nullptr;
+}
+
+bool virtual_memory_allocation::do_advise_huge_pages(void *start, std::size_t size) noexcept
+{
+	// large pages need a privilege and must be requested when the memory is committed
+	return false;
+}
+
+
+void *mapped_file_view::do_map(std::string const &path, std::size_t size) noexcept
+{
+	if (!size)
+		return nullptr;
+	osd::text::tstring t_path;
+	try { t_path = osd::text::to_tstring(path); }
+	catch (...) { return nullptr; }
+	HANDLE const file(CreateFile(t_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+	if (INVALID_HANDLE_VALUE == file)
+		return nullptr;
+	LARGE_INTEGER length;
+	HANDLE mapping(nullptr);
+	if (GetFileSizeEx(file, &length) && (std::uint64_t(length.QuadPart) >= size))
+		mapping = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (!mapping)
+		return nullptr;
+
+	// the view keeps the mapping alive once it has been created
+	LPVOID const result(MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, size));
+	CloseHandle(mapping);
+	return result;
+}
+
+void mapped_file_view::do_unmap(void *start, std::size_t size) noexcept
+{
+	UnmapViewOfFile(start);
+}
+
+
+void *shared_memory_region::do_create(std::string const &name, std::size_t size, void *&handle) noexcept
+{
+	handle = nullptr;
+	if (!size || name.empty())
+		return nullptr;
+	osd::text::tstring t_name;
+	try { t_name = osd::text::to_tstring(name); }
+	catch (...) { return nullptr; }
+	HANDLE const mapping(CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, DWORD(std::uint64_t(size) >> 32), DWORD(size), t_name.c_str()));
+	if (!mapping)
+		return nullptr;
+
+	// don't take over a region that another process is still using
+	if (GetLastError() == ERROR_ALREADY_EXISTS)
+	{
+		CloseHandle(mapping);
+		return nullptr;
+	}
+
+	// the name only stays visible while the mapping is open, so the handle is kept
+	LPVOID const result(MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size));
+	if (!result)
+	{
+		CloseHandle(mapping);
+		return nullptr;
+	}
+	handle = mapping;
+	return result;
+}
+
+void shared_memory_region::do_destroy(std::string const &name, void *start, std::size_t size, void *handle) noexcept
+{
+	UnmapViewOfFile(start);
+	CloseHandle(HANDLE(handle));
+}
+
+
+void *large_page_allocation::do_alloc(std::size_t size, std::size_t &actual, std::size_t &page_size, bool &locked) noexcept
+{
+	if (!size)
+		return nullptr;
+
+	// large pages need the lock memory privilege, which has to be enabled before it counts
+	SIZE_T const huge(GetLargePageMinimum());
+	if (huge)
+	{
+		static bool const privileged(
+				[] ()
+				{
+					HANDLE token;
+					if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+						return false;
+					TOKEN_PRIVILEGES privileges;
+					privileges.PrivilegeCount = 1;
+					privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+					bool const result(
+							LookupPrivilegeValue(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid) &&
+							AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr) &&
+							(GetLastError() == ERROR_SUCCESS));
+					CloseHandle(token);
+					return result;
+				}());
+		if (privileged)
+		{
+			SIZE_T const s((size + huge - 1) & ~(huge - 1));
+			LPVOID const result(VirtualAlloc(nullptr, s, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE));
+			if (result)
+			{
+				actual = s;
+				page_size = huge;
+				locked = true;
+				return result;
+			}
+		}
+	}
+
+	// otherwise ordinary pages - Windows never promotes them
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	SIZE_T const s((size + info.dwPageSize - 1) / info.dwPageSize * info.dwPageSize);
+	LPVOID const result(VirtualAlloc(nullptr, s, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+	if (result)
+	{
+		actual = s;
+		page_size = info.dwPageSize;
+		locked = false;
+	}
+	return result;
+}
+
+void large_page_allocation::do_free(void *start, std::size_t size) noexcept
+{
+	VirtualFree(start, 0, MEM_RELEASE);
+}
+
+std::size_t large_page_allocation::do_huge_page_bytes(void const *start, std::size_t size) noexcept
+{
+	return 0U;
+}
+
+
+std::error_condition fork_server(std::string const &path, bool &forked, std::string &request) noexcept
+{
+	// Windows can't copy a running process
+	forked = false;
+	request.clear();
+	return std::errc::function_not_supported;
+}
+
 
 dynamic_module::ptr dynamic_module::open(std::vector<std::string> &&names)
 {
@@ -74,6 +74,7 @@ const options_entry osd_options::s_option_entries[] =
 	{ OSDOPTION_MAXIMIZE ";max",                 "1",              core_options::option_type::BOOLEAN,   "default to maximized windows" },
 	{ OSDOPTION_WAITVSYNC ";vs",                 "0",              core_options::option_type::BOOLEAN,   "enable waiting for the start of VBLANK before flipping screens (reduces tearing effects)" },
 	{ OSDOPTION_SYNCREFRESH ";srf",              "0",              core_options::option_type::BOOLEAN,   "enable using the start of VBLANK for throttling instead of the game time" },
+	{ OSDOPTION_VRR,                             "0",              core_options::option_type::BOOLEAN,   "present at emulated frame boundaries on variable refresh rate (adaptive sync) displays" },
 	{ OSD_MONITOR_PROVIDER,                      OSDOPTVAL_AUTO,   core_options::option_type::STRING,    "monitor discovery method: " },
 
 	// per-window options
@@ -175,6 +176,7 @@ const options_entry osd_options::s_option_entries[] =
 
 	{ nullptr,                                   nullptr,           core_options::option_type::HEADER,   "BGFX POST-PROCESSING OPTIONS" },
 	{ OSDOPTION_BGFX_PATH,                       "bgfx",            core_options::option_type::PATH,     "path to BGFX-related files" },
+	{ OSDOPTION_BGFX_CACHE,                      "bgfx_cache",      core_options::option_type::PATH,     "path to store compiled BGFX shader programs and pipeline states in (empty to disable)" },
 	{ OSDOPTION_BGFX_BACKEND,                    "auto",            core_options::option_type::STRING,   "BGFX backend to use (d3d9, d3d11, d3d12, metal, opengl, gles, vulkan)" },
 	{ OSDOPTION_BGFX_DEBUG,                      "0",               core_options::option_type::BOOLEAN,  "enable BGFX debugging statistics" },
 	{ OSDOPTION_BGFX_SCREEN_CHAINS,              "",                core_options::option_type::STRING,   "comma-delimited list of screen chain JSON names, colon-delimited per-window" },
@@ -661,11 +663,27 @@ bool osd_common_t::window_init()
 	return true;
 }
 
+bool osd_common_t::variable_refresh()
+{
+	// only if every window is on a display that follows the presentation rate
+	if (!video_config.vrr || s_window_list.empty())
+		return false;
+	for (auto const &window : s_window_list)
+		if (!window->monitor() || !window->monitor()->variable_refresh())
+			return false;
+	return true;
+}
+
 bool osd_common_t::no_sound()
 {
 	return (strcmp(options().sound(),"none")==0) ? true : false;
 }
 
+bool osd_common_t::audio_status(osd_audio_status &status)
+{
+	return m_sound && m_sound->audio_status(status);
+}
+
 bool osd_common_t::input_init()
 {
 	m_keyboard_input->input_init(machine());
@@ -12,7 +12,7 @@
 
 // standard windows headers
 #include <windows.h>
-#include <dxgi1_2.h>
+#include <dxgi1_5.h>
 #include <wrl/client.h>
 #undef interface
 
@@ -31,10 +31,11 @@ private:
 	ComPtr<IDXGIOutput>    m_output;    // The output interface
 
 public:
-	dxgi_monitor_info(monitor_module& module, HMONITOR handle, const char* monitor_device, float aspect, ComPtr<IDXGIOutput> output)
+	dxgi_monitor_info(monitor_module& module, HMONITOR handle, const char* monitor_device, float aspect, ComPtr<IDXGIOutput> output, bool variable_refresh)
 		: osd_monitor_info(module, reinterpret_cast<std::uint64_t>(handle), monitor_device, aspect),
 			m_output(output)
 	{
+		m_variable_refresh = variable_refresh;
 		dxgi_monitor_info::refresh();
 	}
 
@@ -117,6 +118,12 @@ protected:
 			return 1;
 		}
 
+		// variable refresh in a window needs tearing to be allowed, so take that as the sign of support
+		BOOL allow_tearing = FALSE;
+		ComPtr<IDXGIFactory5> factory5;
+		if (SUCCEEDED(factory.As(&factory5)) && FAILED(factory5->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING, &allow_tearing, sizeof(allow_tearing))))
+			allow_tearing = FALSE;
+
 		UINT iAdapter = 0;
 		while (!factory->EnumAdapters(iAdapter, adapter.ReleaseAndGetAddressOf()))
 		{
@@ -135,7 +142,7 @@ protected:
 				std::string devicename = osd::text::from_wstring(desc.DeviceName);
 
 				// allocate a new monitor info
-				auto monitor = std::make_shared<dxgi_monitor_info>(*this, desc.Monitor, devicename.c_str(), aspect, output);
+				auto monitor = std::make_shared<dxgi_monitor_info>(*this, desc.Monitor, devicename.c_str(), aspect, output, allow_tearing != FALSE);
 
 				// hook us into the list
 				add_monitor(monitor);
@@ -31,7 +31,7 @@ class osd_monitor_info
 {
 public:
 	osd_monitor_info(monitor_module &module, std::uint64_t handle, const char *monitor_device, float aspect)
-		: m_is_primary(false), m_name(monitor_device), m_module(module), m_handle(handle), m_aspect(aspect)
+		: m_is_primary(false), m_variable_refresh(true), m_name(monitor_device), m_module(module), m_handle(handle), m_aspect(aspect)
 	{
 	}
 
@@ -58,10 +58,14 @@ public:
 	void set_aspect(const float a) { m_aspect = a; }
 	bool is_primary() const { return m_is_primary; }
 
+	// can the display follow the presentation rate (adaptive sync)?  modules that can't tell trust -vrr
+	bool variable_refresh() const { return m_variable_refresh; }
+
 protected:
 	osd_rect            m_pos_size;
 	osd_rect            m_usuable_pos_size;
 	bool                m_is_primary;
+	bool                m_variable_refresh;
 	std::string         m_name;
 private:
 	monitor_module&     m_module;
@@ -109,6 +109,7 @@ struct netdev_pcap_context {
 	int packetlens[32];
 	int head;
 	int tail;
+	bool busy; // the frame at the tail is still in use
 };
 #endif
 
@@ -118,9 +119,9 @@ public:
 	netdev_pcap(const char *name, class device_network_interface *ifdev, int rate);
 	~netdev_pcap();
 
-	virtual int send(uint8_t *buf, int len) override;
 	virtual void set_mac(const char *mac) override;
 protected:
+	virtual int send_dev(uint8_t *buf, int len) override;
 	virtual int recv_dev(uint8_t **buf) override;
 private:
 	pcap_t *m_p;
@@ -137,11 +138,15 @@ static void netdev_pcap_handler(u_char *user, const struct pcap_pkthdr *h, const
 	if(!ctx->p) return;
 
 	if(OSAtomicCompareAndSwapInt((ctx->head+1) & 0x1F, ctx->tail, &ctx->tail)) {
-		printf("buffer full, dropping packet\n");
+		osd_printf_verbose("pcap: buffer full, dropping packet\n");
 		return;
 	}
-	memcpy(ctx->packets[ctx->head], bytes, h->len);
-	ctx->packetlens[ctx->head] = h->len;
+	if(h->caplen > sizeof(ctx->packets[0])) {
+		osd_printf_verbose("pcap: dropping %u byte packet\n", h->caplen);
+		return;
+	}
+	memcpy(ctx->packets[ctx->head], bytes, h->caplen);
+	ctx->packetlens[ctx->head] = h->caplen;
 	OSAtomicCompareAndSwapInt(ctx->head, (ctx->head+1) & 0x1F, &ctx->head);
 }
 
@@ -182,6 +187,7 @@ netdev_pcap::netdev_pcap(const char *name, class device_network_interface *ifdev
 #ifdef SDLMAME_MACOSX
 	m_ctx.head = 0;
 	m_ctx.tail = 0;
+	m_ctx.busy = false;
 	m_ctx.p = m_p;
 	pthread_create(&m_thread, nullptr, netdev_pcap_blocker, &m_ctx);
 #endif
@@ -204,42 +210,38 @@ void netdev_pcap::set_mac(const char *mac)
 	}
 }
 
-int netdev_pcap::send(uint8_t *buf, int len)
+int netdev_pcap::send_dev(uint8_t *buf, int len)
 {
-	int ret;
-	if(!m_p) {
-		printf("send invoked, but no pcap context\n");
-		return 0;
-	}
-	ret = (*module->pcap_sendpacket_dl)(m_p, buf, len);
-	printf("sent packet length %d, returned %d\n", len, ret);
-	return ret ? len : 0;
-	//return (!pcap_sendpacket_dl(m_p, buf, len))?len:0;
+	if(!m_p) return 0;
+	return (!(*module->pcap_sendpacket_dl)(m_p, buf, len))?len:0;
 }
 
 int netdev_pcap::recv_dev(uint8_t **buf)
 {
 #ifdef SDLMAME_MACOSX
-	uint8_t pktbuf[2048];
-	int ret;
-
 	// no device open?
 	if(!m_p) return 0;
 
+	// the previous frame was used in place, so its slot can go back now
+	if(m_ctx.busy) {
+		OSAtomicCompareAndSwapInt(m_ctx.tail, (m_ctx.tail+1) & 0x1F, &m_ctx.tail);
+		m_ctx.busy = false;
+	}
+
 	// Empty
 	if(OSAtomicCompareAndSwapInt(m_ctx.head, m_ctx.tail, &m_ctx.tail)) {
 		return 0;
 	}
 
-	memcpy(pktbuf, m_ctx.packets[m_ctx.tail], m_ctx.packetlens[m_ctx.tail]);
-	ret = m_ctx.packetlens[m_ctx.tail];
-	OSAtomicCompareAndSwapInt(m_ctx.tail, (m_ctx.tail+1) & 0x1F, &m_ctx.tail);
-	*buf = pktbuf;
-	return ret;
+	m_ctx.busy = true;
+	*buf = m_ctx.packets[m_ctx.tail];
+	return m_ctx.packetlens[m_ctx.tail];
 #else
+	// the frame is used where libpcap captured it, and stays valid until
+	// the next call
 	struct pcap_pkthdr *header;
 	if(!m_p) return 0;
-	return ((*module->pcap_next_ex_dl)(m_p, &header, (const u_char **)buf) == 1)?header->len:0;
+	return ((*module->pcap_next_ex_dl)(m_p, &header, (const u_char **)buf) == 1)?header->caplen:0;
 #endif
 }
 
@@ -64,9 +64,9 @@ public:
 	netdev_tap(const char *name, class device_network_interface *ifdev, int rate);
 	~netdev_tap();
 
-	int send(uint8_t *buf, int len) override;
 	void set_mac(const char *mac) override;
 protected:
+	int send_dev(uint8_t *buf, int len) override;
 	int recv_dev(uint8_t **buf) override;
 private:
 #if defined(_WIN32)
@@ -177,7 +177,7 @@ static u32 finalise_frame(u8 buf[], u32 length)
 }
 
 #if defined(_WIN32)
-int netdev_tap::send(uint8_t *buf, int len)
+int netdev_tap::send_dev(uint8_t *buf, int len)
 {
 	OVERLAPPED overlapped = {};
 
@@ -323,7 +323,7 @@ static std::vector<std::wstring> get_tap_adapters()
 	return result;
 }
 #else
-int netdev_tap::send(uint8_t *buf, int len)
+int netdev_tap::send_dev(uint8_t *buf, int len)
 {
 	if(m_fd == -1) return 0;
 	len = write(m_fd, buf, len);
@@ -175,6 +175,7 @@ public:
 	virtual void add_audio_to_recording(const int16_t *buffer, int samples_this_frame) { }
 	virtual std::vector<ui::menu_item> get_slider_list() { return m_sliders; }
 	virtual int draw(const int update) = 0;
+	virtual bool threaded_draw() const { return false; } // draw() may be called from a thread other than the one that created the renderer
 	virtual int xy_to_render_target(const int x, const int y, int *xt, int *yt) { return 0; }
 	virtual void save() { }
 	virtual void record() { }
@@ -217,7 +218,9 @@ struct osd_video_config
 	// hardware options
 	int                 waitvsync;                  // spin until vsync
 	int                 syncrefresh;                // sync only to refresh rate
+	int                 vrr;                        // display follows the presentation rate
 	int                 switchres;                  // switch resolutions
+	int                 renderthread;               // draw on a separate thread
 
 	// d3d, accel, opengl
 	int                 filter;                     // enable filtering
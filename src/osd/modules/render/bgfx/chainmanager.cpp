@@ -47,6 +47,43 @@
 
 using namespace rapidjson;
 
+static bool prepare_chain_document(const std::string &path, Document &document)
+{
+	bx::FileReader reader;
+	if (!bx::open(&reader, path.c_str()))
+	{
+		osd_printf_warning("Unable to open chain file %s\n", path);
+		return false;
+	}
+
+	const int32_t size(bx::getSize(&reader));
+
+	bx::ErrorAssert err;
+	std::unique_ptr<char []> data(new (std::nothrow) char [size + 1]);
+	if (!data)
+	{
+		osd_printf_error("Out of memory reading chain file %s\n", path);
+		bx::close(&reader);
+		return false;
+	}
+
+	bx::read(&reader, reinterpret_cast<void*>(data.get()), size, &err);
+	bx::close(&reader);
+	data[size] = 0;
+
+	document.Parse<kParseCommentsFlag>(data.get());
+	data.reset();
+
+	if (document.HasParseError())
+	{
+		std::string error(GetParseError_En(document.GetParseError()));
+		osd_printf_warning("Unable to parse chain %s. Errors returned:\n%s\n", path, error);
+		return false;
+	}
+
+	return true;
+}
+
 chain_manager::screen_prim::screen_prim(render_primitive *prim)
 {
 	m_prim = prim;
@@ -87,6 +124,7 @@ chain_manager::chain_manager(
 	refresh_available_chains();
 	parse_chain_selections(options.bgfx_screen_chains());
 	init_texture_converters();
+	queue_chain_effects(options.bgfx_screen_chains());
 }
 
 chain_manager::~chain_manager()
@@ -227,36 +265,10 @@ std::unique_ptr<bgfx_chain> chain_manager::load_chain(std::string name, uint32_t
 	}
 	const std::string path = util::path_concat(m_options.bgfx_path(), "chains", name);
 
-	bx::FileReader reader;
-	if (!bx::open(&reader, path.c_str()))
-	{
-		osd_printf_warning("Unable to open chain file %s, falling back to no post processing\n", path);
-		return nullptr;
-	}
-
-	const int32_t size(bx::getSize(&reader));
-
-	bx::ErrorAssert err;
-	std::unique_ptr<char []> data(new (std::nothrow) char [size + 1]);
-	if (!data)
-	{
-		osd_printf_error("Out of memory reading chain file %s\n", path);
-		bx::close(&reader);
-		return nullptr;
-	}
-
-	bx::read(&reader, reinterpret_cast<void*>(data.get()), size, &err);
-	bx::close(&reader);
-	data[size] = 0;
-
 	Document document;
-	document.Parse<kParseCommentsFlag>(data.get());
-	data.reset();
-
-	if (document.HasParseError())
+	if (!prepare_chain_document(path, document))
 	{
-		std::string error(GetParseError_En(document.GetParseError()));
-		osd_printf_warning("Unable to parse chain %s. Errors returned:\n%s\n", path, error);
+		osd_printf_warning("Falling back to no post processing\n");
 		return nullptr;
 	}
 
@@ -344,6 +356,42 @@ std::vector<std::string_view> chain_manager::split_option_string(std::string_vie
 	return chain_names;
 }
 
+void chain_manager::queue_chain_effects(std::string_view chain_str)
+{
+	// every chain named for any window, so switching doesn't have to wait
+	// for effects to be loaded and their programs compiled
+	std::vector<std::string> queued;
+	size_t start = 0;
+	for (size_t i = 0; i <= chain_str.length(); i++)
+	{
+		if ((i < chain_str.length()) && (chain_str[i] != ',') && (chain_str[i] != ':'))
+			continue;
+
+		const std::string_view name = chain_str.substr(start, i - start);
+		start = i + 1;
+		const auto desc = std::find_if(
+				m_available_chains.begin(),
+				m_available_chains.end(),
+				[&name] (chain_desc const &avail) { return avail.m_name == name; });
+		if ((m_available_chains.end() == desc) || desc->m_name == "none" || (std::find(queued.begin(), queued.end(), desc->m_name) != queued.end()))
+			continue;
+		queued.emplace_back(desc->m_name);
+
+		Document document;
+		if (!prepare_chain_document(util::path_concat(m_options.bgfx_path(), "chains", util::path_concat(desc->m_path, desc->m_name) + ".json"), document))
+			continue;
+		if (!document.HasMember("passes") || !document["passes"].IsArray())
+			continue;
+		const Value& entry_array = document["passes"];
+		for (uint32_t j = 0; j < entry_array.Size(); j++)
+		{
+			const Value& entry = entry_array[j];
+			if (entry.IsObject() && entry.HasMember("effect") && entry["effect"].IsString())
+				m_effects.queue_effect(entry["effect"].GetString());
+		}
+	}
+}
+
 void chain_manager::load_chains()
 {
 	for (size_t chain = 0; chain < m_current_chain.size() && chain < m_screen_chains.size(); chain++)
@@ -375,6 +423,21 @@ void chain_manager::reload_chains()
 	load_chains();
 }
 
+void chain_manager::reload_chain(uint32_t screen)
+{
+	if (screen >= m_screen_chains.size() || screen >= m_current_chain.size())
+		return;
+
+	delete m_screen_chains[screen];
+	m_screen_chains[screen] = nullptr;
+	if (m_current_chain[screen] != CHAIN_NONE)
+	{
+		chain_desc& desc = m_available_chains[m_current_chain[screen]];
+		m_chain_names[screen] = desc.m_name;
+		m_screen_chains[screen] = load_chain(util::path_concat(desc.m_path, desc.m_name), screen).release();
+	}
+}
+
 bgfx_chain* chain_manager::screen_chain(uint32_t screen)
 {
 	if (screen >= m_screen_chains.size())
@@ -387,6 +450,15 @@ bgfx_chain* chain_manager::screen_chain(uint32_t screen)
 	}
 }
 
+std::vector<uint8_t> &chain_manager::uploaded_palette(uint32_t screen)
+{
+	if (screen >= m_screen_palette_data.size())
+	{
+		m_screen_palette_data.resize(screen + 1);
+	}
+	return m_screen_palette_data[screen];
+}
+
 void chain_manager::process_screen_quad(uint32_t view, uint32_t screen, screen_prim &prim, osd_window& window)
 {
 	const bool any_targets_rebuilt = m_targets.update_target_sizes(screen, prim.m_tex_width, prim.m_tex_height, TARGET_STYLE_GUEST, m_user_prescale, m_max_prescale_size);
@@ -482,11 +554,9 @@ int32_t chain_manager::slider_changed(int id, std::string *str, int32_t newval)
 {
 	if (newval != SLIDER_NOCHANGE)
 	{
+		// only the screen being changed needs its chain rebuilt
 		set_current_chain(id, newval);
-
-		std::vector<std::vector<float>> settings = slider_settings();
-		reload_chains();
-		restore_slider_settings(id, settings);
+		reload_chain(id);
 
 		m_slider_notifier.set_sliders_dirty();
 	}
@@ -573,9 +643,10 @@ uint32_t chain_manager::update_screen_textures(uint32_t view, render_primitive *
 			{
 				uint16_t palette_width = uint16_t(std::min(prim.m_palette_length, 256U));
 				uint16_t palette_height = uint16_t(std::max((prim.m_palette_length + 255) / 256, 1U));
-				m_palette_temp.resize(palette_width * palette_height * 4);
-				memcpy(&m_palette_temp[0], prim.m_prim->texture.palette, prim.m_palette_length * 4);
-				const bgfx::Memory *palmem = bgfx::copy(&m_palette_temp[0], palette_width * palette_height * 4);
+				std::vector<uint8_t> &uploaded = uploaded_palette(screen);
+				uploaded.resize(palette_width * palette_height * 4);
+				memcpy(&uploaded[0], prim.m_prim->texture.palette, prim.m_palette_length * 4);
+				const bgfx::Memory *palmem = bgfx::copy(&uploaded[0], palette_width * palette_height * 4);
 				auto newpal = std::make_unique<bgfx_texture>(palette_name, bgfx::TextureFormat::BGRA8, palette_width, 0, palette_height, palmem, BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP | BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT | BGFX_SAMPLER_MIP_POINT, palette_width * 4);
 				palette = newpal.get();
 				m_textures.add_provider(palette_name, std::move(newpal));
@@ -605,13 +676,22 @@ uint32_t chain_manager::update_screen_textures(uint32_t view, render_primitive *
 				uint16_t palette_width = uint16_t(std::min(prim.m_palette_length, 256U));
 				uint16_t palette_height = uint16_t(std::max((prim.m_palette_length + 255) / 256, 1U));
 				const uint32_t palette_size = palette_width * palette_height * 4;
-				m_palette_temp.resize(palette_size);
-				memcpy(&m_palette_temp[0], prim.m_prim->texture.palette, prim.m_palette_length * 4);
-				const bgfx::Memory *palmem = bgfx::copy(&m_palette_temp[0], palette_size);
+
+				// the palette rarely changes, so only upload it when it does
+				std::vector<uint8_t> &uploaded = uploaded_palette(screen);
+				const bool changed = (uploaded.size() != palette_size) || memcmp(&uploaded[0], prim.m_prim->texture.palette, prim.m_palette_length * 4);
+				const bgfx::Memory *palmem = nullptr;
+				if (changed || !palette)
+				{
+					uploaded.resize(palette_size);
+					memcpy(&uploaded[0], prim.m_prim->texture.palette, prim.m_palette_length * 4);
+					palmem = bgfx::copy(&uploaded[0], palette_size);
+				}
 
 				if (palette)
 				{
-					palette->update(palmem);
+					if (palmem)
+						palette->update(palmem);
 				}
 				else
 				{
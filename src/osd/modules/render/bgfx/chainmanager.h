@@ -109,6 +109,8 @@ private:
 	void load_chains();
 	void destroy_chains();
 	void reload_chains();
+	void reload_chain(uint32_t screen);
+	void queue_chain_effects(std::string_view chain_str);
 
 	void init_texture_converters();
 
@@ -128,6 +130,7 @@ private:
 
 	uint32_t count_screens(render_primitive* prim);
 	void process_screen_quad(uint32_t view, uint32_t screen, screen_prim &prim, osd_window& window);
+	std::vector<uint8_t> &uploaded_palette(uint32_t screen);
 
 	running_machine&            m_machine;
 	const osd_options&          m_options;
@@ -151,7 +154,7 @@ private:
 	std::vector<bgfx_effect*>   m_converters;
 	bgfx_effect *               m_adjuster;
 	std::vector<screen_prim>    m_screen_prims;
-	std::vector<uint8_t>        m_palette_temp;
+	std::vector<std::vector<uint8_t>> m_screen_palette_data; // last palette uploaded for each screen
 
 	static inline constexpr uint32_t CHAIN_NONE = 0;
 };
@@ -115,6 +115,28 @@ bgfx_effect* effect_manager::load_effect(const osd_options &options, const std::
 	return m_effects.emplace(name, std::move(effect)).first->second.get();
 }
 
+void effect_manager::queue_effect(std::string &&name)
+{
+	m_queued.emplace_back(std::move(name));
+}
+
+bool effect_manager::load_queued_effect(const osd_options &options)
+{
+	// skip anything that got loaded in the meantime
+	while (!m_queued.empty())
+	{
+		const std::string name = std::move(m_queued.front());
+		m_queued.pop_front();
+		if (m_effects.find(name) == m_effects.end())
+		{
+			osd_printf_verbose("BGFX: Precompiling effect %s\n", name);
+			load_effect(options, name);
+			return true;
+		}
+	}
+	return false;
+}
+
 bool effect_manager::validate_effect(const osd_options &options, const std::string &name)
 {
 	rapidjson::Document document;
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <deque>
 #include <map>
 #include <memory>
 #include <string>
@@ -33,11 +34,16 @@ public:
 	bgfx_effect* get_or_load_effect(const osd_options &options, const std::string &name);
 	static bool validate_effect(const osd_options &options, const std::string &name);
 
+	// Precompilation, a bounded amount at a time
+	void queue_effect(std::string &&name);
+	bool load_queued_effect(const osd_options &options);
+
 private:
 	bgfx_effect* load_effect(const osd_options &options, const std::string &name);
 
 	shader_manager &m_shaders;
 	std::map<std::string, std::unique_ptr<bgfx_effect> > m_effects;
+	std::deque<std::string> m_queued;
 };
 
 #endif // MAME_RENDER_BGFX_EFFECTMANAGER_H
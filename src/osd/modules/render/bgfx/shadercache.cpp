@@ -0,0 +1,124 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+//============================================================
+//
+//  shadercache.cpp - BGFX program and pipeline state cache
+//
+//  Implements the BGFX library callbacks, keeping the
+//  compiled programs and pipeline states the backend hands
+//  us in files, so they don't have to be compiled again on
+//  the next run.
+//
+//============================================================
+
+#include "shadercache.h"
+
+#include "osdcore.h"
+#include "osdfile.h"
+
+#include "util/hashing.h"
+#include "util/path.h"
+#include "util/strformat.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+
+namespace {
+
+// each cache file starts with a magic number, the payload size and a CRC of
+// the payload, so truncated or stale files are never handed to the driver
+constexpr uint32_t CACHE_MAGIC = 0x4353424d; // 'MBSC'
+constexpr uint32_t HEADER_SIZE = 3 * sizeof(uint32_t);
+
+bool read_entry(const std::string &path, std::unique_ptr<uint8_t []> &payload, uint32_t &size)
+{
+	osd_file::ptr file;
+	uint64_t filesize;
+	if (osd_file::open(path, OPEN_FLAG_READ, file, filesize) || (filesize < HEADER_SIZE) || (filesize > 0x7fffffff))
+		return false;
+
+	uint32_t header[3];
+	uint32_t actual;
+	if (file->read(header, 0, HEADER_SIZE, actual) || (actual != HEADER_SIZE) || (header[0] != CACHE_MAGIC) || (header[1] != (filesize - HEADER_SIZE)))
+		return false;
+
+	size = header[1];
+	payload.reset(new (std::nothrow) uint8_t[size]);
+	if (!payload || file->read(payload.get(), HEADER_SIZE, size, actual) || (actual != size))
+		return false;
+
+	return uint32_t(util::crc32_creator::simple(payload.get(), size)) == header[2];
+}
+
+} // anonymous namespace
+
+
+void shader_cache::fatal(const char *file_path, uint16_t line, bgfx::Fatal::Enum code, const char *str)
+{
+	osd_printf_error("BGFX: %s(%d): fatal error 0x%08x: %s\n", file_path, line, uint32_t(code), str);
+	if (code != bgfx::Fatal::DebugCheck)
+		std::abort();
+}
+
+void shader_cache::traceVargs(const char *file_path, uint16_t line, const char *format, va_list arg_list)
+{
+	char buffer[1024];
+	std::vsnprintf(buffer, sizeof(buffer), format, arg_list);
+	osd_printf_verbose("BGFX: %s", buffer);
+}
+
+std::string shader_cache::entry_path(uint64_t id) const
+{
+	return util::path_concat(m_path, util::string_format("%016x.bin", id));
+}
+
+uint32_t shader_cache::cacheReadSize(uint64_t id)
+{
+	if (m_path.empty())
+		return 0;
+
+	std::unique_ptr<uint8_t []> payload;
+	uint32_t size;
+	return read_entry(entry_path(id), payload, size) ? size : 0;
+}
+
+bool shader_cache::cacheRead(uint64_t id, void *data, uint32_t size)
+{
+	if (m_path.empty())
+		return false;
+
+	std::unique_ptr<uint8_t []> payload;
+	uint32_t actual;
+	if (!read_entry(entry_path(id), payload, actual) || (actual != size))
+		return false;
+
+	std::memcpy(data, payload.get(), size);
+	return true;
+}
+
+void shader_cache::cacheWrite(uint64_t id, const void *data, uint32_t size)
+{
+	if (m_path.empty())
+		return;
+
+	const std::string path = entry_path(id);
+	osd_file::ptr file;
+	uint64_t filesize;
+	if (osd_file::open(path, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, file, filesize))
+	{
+		osd_printf_verbose("BGFX: Unable to write shader cache file %s\n", path);
+		return;
+	}
+
+	const uint32_t header[3] = { CACHE_MAGIC, size, uint32_t(util::crc32_creator::simple(data, size)) };
+	uint32_t actual;
+	if (file->write(header, 0, HEADER_SIZE, actual) || (actual != HEADER_SIZE) || file->write(data, HEADER_SIZE, size, actual) || (actual != size))
+	{
+		// don't leave a partial entry behind
+		file.reset();
+		osd_file::remove(path);
+	}
+}
@@ -0,0 +1,52 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+//============================================================
+//
+//  shadercache.h - BGFX program and pipeline state cache
+//
+//  Implements the BGFX library callbacks, keeping the
+//  compiled programs and pipeline states the backend hands
+//  us in files, so they don't have to be compiled again on
+//  the next run.
+//
+//============================================================
+
+#ifndef MAME_RENDER_BGFX_SHADERCACHE_H
+#define MAME_RENDER_BGFX_SHADERCACHE_H
+
+#pragma once
+
+#include <bgfx/bgfx.h>
+
+#include <cstdarg>
+#include <cstdint>
+#include <string>
+
+
+class shader_cache : public bgfx::CallbackI
+{
+public:
+	shader_cache(std::string &&path) : m_path(std::move(path)) { }
+	virtual ~shader_cache() { }
+
+	// bgfx::CallbackI
+	virtual void fatal(const char *file_path, uint16_t line, bgfx::Fatal::Enum code, const char *str) override;
+	virtual void traceVargs(const char *file_path, uint16_t line, const char *format, va_list arg_list) override;
+	virtual void profilerBegin(const char *name, uint32_t abgr, const char *file_path, uint16_t line) override { }
+	virtual void profilerBeginLiteral(const char *name, uint32_t abgr, const char *file_path, uint16_t line) override { }
+	virtual void profilerEnd() override { }
+	virtual uint32_t cacheReadSize(uint64_t id) override;
+	virtual bool cacheRead(uint64_t id, void *data, uint32_t size) override;
+	virtual void cacheWrite(uint64_t id, const void *data, uint32_t size) override;
+	virtual void screenShot(const char *file_path, uint32_t width, uint32_t height, uint32_t pitch, const void *data, uint32_t size, bool yflip) override { }
+	virtual void captureBegin(uint32_t width, uint32_t height, uint32_t pitch, bgfx::TextureFormat::Enum format, bool yflip) override { }
+	virtual void captureEnd() override { }
+	virtual void captureFrame(const void *data, uint32_t size) override { }
+
+private:
+	std::string entry_path(uint64_t id) const;
+
+	const std::string m_path;   // directory holding the cache files, or empty when disabled
+};
+
+#endif // MAME_RENDER_BGFX_SHADERCACHE_H
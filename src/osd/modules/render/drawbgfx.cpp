@@ -11,6 +11,7 @@
 // render/bgfx
 #include "bgfx/effect.h"
 #include "bgfx/effectmanager.h"
+#include "bgfx/shadercache.h"
 #include "bgfx/shadermanager.h"
 #include "bgfx/slider.h"
 #include "bgfx/target.h"
@@ -186,6 +187,7 @@ private:
 	static bool set_platform_data(bgfx::PlatformData &platform_data, osd_window const &window);
 
 	bool m_bgfx_library_initialized;
+	std::unique_ptr<shader_cache> m_shader_cache; // must outlive the BGFX library
 };
 
 
@@ -255,6 +257,7 @@ void video_bgfx::exit()
 		m_bgfx_library_initialized = false;
 	}
 	m_max_texture_size = 0;
+	m_shader_cache.reset();
 	m_persistent_settings.reset();
 	m_options = nullptr;
 }
@@ -339,6 +342,12 @@ bool video_bgfx::init_bgfx_library(osd_window &window)
 	init.resolution.height = wdim.height();
 	init.resolution.numBackBuffers = 1;
 	init.resolution.reset = video_config.waitvsync ? BGFX_RESET_VSYNC : BGFX_RESET_NONE;
+
+	// keep compiled programs and pipeline states between runs
+	if (!m_shader_cache)
+		m_shader_cache = std::make_unique<shader_cache>(std::string(m_options->bgfx_cache()));
+	init.callback = m_shader_cache.get();
+
 	if (!set_platform_data(init.platformData, window))
 	{
 		osd_printf_error("Setting BGFX platform data failed\n");
@@ -1316,6 +1325,10 @@ int renderer_bgfx::draw(int update)
 		bgfx::frame();
 	}
 
+	// precompile one of the effects the configured chains use each frame, so
+	// switching chains later doesn't stall
+	m_effects->load_queued_effect(m_module().options());
+
 	return 0;
 }
 
@@ -140,6 +140,12 @@ namespace {
 #define GL_PIXEL_UNPACK_BUFFER_ARB        0x88EC
 #endif
 
+// persistently mapped pixel buffers need headers new enough to declare
+// GL_ARB_buffer_storage and GL_ARB_sync
+#if defined(GL_ARB_buffer_storage) && defined(GL_ARB_sync) && defined(GL_ARB_map_buffer_range) && !defined(OSD_MAC)
+#define OGL_PERSISTENT_PBO 1
+#endif
+
 #ifndef GL_FRAMEBUFFER_EXT
 #define GL_FRAMEBUFFER_EXT              0x8D40
 #define GL_FRAMEBUFFER_COMPLETE_EXT         0x8CD5
@@ -240,6 +246,11 @@ public:
 	uint32_t            mpass_fbo_scrn[2];              // framebuffer object for this texture, multipass
 
 	uint32_t            pbo = 0;                        // pixel buffer object for this texture (DYNAMIC only!)
+#if defined(OGL_PERSISTENT_PBO)
+	uint32_t            *pbo_map = nullptr;             // persistent mapping of both PBO pages, if there is one
+	GLsync              pbo_fence[2] = { nullptr, nullptr }; // uploads still reading each page
+	int                 pbo_page = 0;                   // page to fill next
+#endif
 	uint32_t            *data = nullptr;                // pixels for the texture
 	bool                data_own = false;               // do we own / allocated it ?
 	GLfloat             texCoord[8];
@@ -265,6 +276,7 @@ public:
 		, m_texpoweroftwo(0)
 		, m_usevbo(0)
 		, m_usepbo(0)
+		, m_usepersistentpbo(0)
 		, m_usefbo(0)
 		, m_useglsl(0)
 		, m_glsl_program_num(0)
@@ -291,6 +303,7 @@ public:
 
 	virtual int create() override;
 	virtual int draw(const int update) override;
+	virtual bool threaded_draw() const override { return true; }
 
 #ifndef OSD_WINDOWS
 	virtual int xy_to_render_target(const int x, const int y, int *xt, int *yt) override;
@@ -378,6 +391,7 @@ private:
 	int             m_texpoweroftwo;          // must textures be power-of-2 sized?
 	int             m_usevbo;         // runtime check if VBO is available
 	int             m_usepbo;         // runtime check if PBO is available
+	int             m_usepersistentpbo; // runtime check if PBOs can be mapped persistently
 	int             m_usefbo;         // runtime check if FBO is available
 	int             m_useglsl;        // runtime check if GLSL is available
 
@@ -423,6 +437,15 @@ private:
 	PFNGLMAPBUFFERPROC                 m_glMapBuffer      = nullptr;
 	PFNGLUNMAPBUFFERPROC               m_glUnmapBuffer    = nullptr;
 
+	// persistently mapped PBO
+#if defined(OGL_PERSISTENT_PBO)
+	PFNGLBUFFERSTORAGEPROC             m_glBufferStorage  = nullptr;
+	PFNGLMAPBUFFERRANGEPROC            m_glMapBufferRange = nullptr;
+	PFNGLFENCESYNCPROC                 m_glFenceSync      = nullptr;
+	PFNGLCLIENTWAITSYNCPROC            m_glClientWaitSync = nullptr;
+	PFNGLDELETESYNCPROC                m_glDeleteSync     = nullptr;
+#endif
+
 	// FBO
 	PFNGLISFRAMEBUFFEREXTPROC          m_glIsFramebuffer          = nullptr;
 	PFNGLBINDFRAMEBUFFEREXTPROC        m_glBindFramebuffer        = nullptr;
@@ -607,6 +630,7 @@ void renderer_ogl::initialize_gl()
 	m_texpoweroftwo = 1;
 	m_usevbo = 0;
 	m_usepbo = 0;
+	m_usepersistentpbo = 0;
 	m_usefbo = 0;
 	m_useglsl = 0;
 
@@ -672,6 +696,15 @@ void renderer_ogl::initialize_gl()
 				else
 					osd_printf_verbose("OpenGL: pixel buffers supported, but disabled\n");
 			}
+
+#if defined(OGL_PERSISTENT_PBO)
+			if (m_usepbo && strstr(extstr, "GL_ARB_buffer_storage") && strstr(extstr, "GL_ARB_sync") && strstr(extstr, "GL_ARB_map_buffer_range"))
+			{
+				m_usepersistentpbo = 1;
+				if (!s_shown_video_info)
+					osd_printf_verbose("OpenGL: persistently mapped pixel buffers supported\n");
+			}
+#endif
 		}
 		else
 		{
@@ -783,6 +816,10 @@ int renderer_ogl::create()
 
 	m_init_context = 0;
 
+	// leave the context free for the render thread
+	if (video_config.renderthread)
+		m_gl_context->release_current();
+
 	osd_printf_verbose("Leave renderer_ogl::create\n");
 	return 0;
 }
@@ -839,6 +876,15 @@ void renderer_ogl::destroy_all_textures()
 
 			if (m_usepbo && texture->pbo)
 			{
+#if defined(OGL_PERSISTENT_PBO)
+				for (GLsync &fence : texture->pbo_fence)
+				{
+					if (fence)
+						m_glDeleteSync(fence);
+					fence = nullptr;
+				}
+				texture->pbo_map = nullptr;
+#endif
 				m_glDeleteBuffers( 1, (GLuint *)&(texture->pbo) );
 				texture->pbo=0;
 			}
@@ -874,6 +920,10 @@ void renderer_ogl::destroy_all_textures()
 
 	if (lock)
 		window().m_primlist->release_lock();
+
+	// the context can only be current on one thread at a time
+	if (video_config.renderthread)
+		m_gl_context->release_current();
 }
 //============================================================
 //  loadGLExtensions
@@ -923,6 +973,16 @@ void renderer_ogl::loadGLExtensions()
 		m_gl_context->get_proc_address(m_glMapBuffer,   "glMapBuffer");
 		m_gl_context->get_proc_address(m_glUnmapBuffer, "glUnmapBuffer");
 	}
+#if defined(OGL_PERSISTENT_PBO)
+	if (m_usepbo && m_usepersistentpbo)
+	{
+		m_gl_context->get_proc_address(m_glBufferStorage,  "glBufferStorage");
+		m_gl_context->get_proc_address(m_glMapBufferRange, "glMapBufferRange");
+		m_gl_context->get_proc_address(m_glFenceSync,      "glFenceSync");
+		m_gl_context->get_proc_address(m_glClientWaitSync, "glClientWaitSync");
+		m_gl_context->get_proc_address(m_glDeleteSync,     "glDeleteSync");
+	}
+#endif
 	// FBO:
 	if (m_usefbo)
 	{
@@ -974,6 +1034,17 @@ void renderer_ogl::loadGLExtensions()
 		}
 	}
 
+	if (!m_usepbo)
+		m_usepersistentpbo = false;
+#if defined(OGL_PERSISTENT_PBO)
+	if (m_usepersistentpbo && (!m_glBufferStorage || !m_glMapBufferRange || !m_glFenceSync || !m_glClientWaitSync || !m_glDeleteSync))
+	{
+		m_usepersistentpbo = false;
+		if (_once)
+			osd_printf_verbose("OpenGL: persistently mapped PBO not supported, missing entry points\n");
+	}
+#endif
+
 	if ( m_usefbo &&
 		( !m_glIsFramebuffer || !m_glBindFramebuffer || !m_glDeleteFramebuffers ||
 			!m_glGenFramebuffers || !m_glCheckFramebufferStatus || !m_glFramebufferTexture2D
@@ -1007,7 +1078,7 @@ void renderer_ogl::loadGLExtensions()
 			osd_printf_warning("OpenGL: VBO not supported\n");
 
 		if (m_usepbo)
-			osd_printf_verbose("OpenGL: PBO supported\n");
+			osd_printf_verbose("OpenGL: PBO supported%s\n", m_usepersistentpbo ? ", persistently mapped" : "");
 		else
 			osd_printf_warning("OpenGL: PBO not supported\n");
 
@@ -1532,6 +1603,8 @@ int renderer_ogl::draw(const int update)
 	m_init_context = 0;
 
 	m_gl_context->swap_buffer();
+	if (video_config.renderthread)
+		m_gl_context->release_current();
 
 	return 0;
 }
@@ -2152,10 +2225,31 @@ ogl_texture_info *renderer_ogl::texture_create(const render_texinfo *texsource,
 
 		m_glBindBuffer( GL_PIXEL_UNPACK_BUFFER_ARB, texture->pbo);
 
-		// set up the PBO dimension, ..
-		m_glBufferData(GL_PIXEL_UNPACK_BUFFER_ARB,
-							texture->rawwidth * texture->rawheight * sizeof(uint32_t),
-					nullptr, GL_STREAM_DRAW);
+#if defined(OGL_PERSISTENT_PBO)
+		if (m_usepersistentpbo)
+		{
+			// two pages mapped for good, so one can be filled while an
+			// upload from the other may still be in flight
+			GLbitfield const access = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			GLsizeiptr const size = 2 * texture->rawwidth * texture->rawheight * sizeof(uint32_t);
+			m_glBufferStorage(GL_PIXEL_UNPACK_BUFFER_ARB, size, nullptr, access);
+			texture->pbo_map = (uint32_t *)m_glMapBufferRange(GL_PIXEL_UNPACK_BUFFER_ARB, 0, size, access);
+			if (!texture->pbo_map)
+			{
+				// storage is immutable, so start again with a plain buffer
+				m_glDeleteBuffers(1, (GLuint *)&texture->pbo);
+				m_glGenBuffers(1, (GLuint *)&texture->pbo);
+				m_glBindBuffer(GL_PIXEL_UNPACK_BUFFER_ARB, texture->pbo);
+			}
+		}
+		if (!texture->pbo_map)
+#endif
+		{
+			// set up the PBO dimension, ..
+			m_glBufferData(GL_PIXEL_UNPACK_BUFFER_ARB,
+								texture->rawwidth * texture->rawheight * sizeof(uint32_t),
+						nullptr, GL_STREAM_DRAW);
+		}
 	}
 
 	if ( !texture->nocopy && texture->type!=TEXTURE_TYPE_DYNAMIC )
@@ -2454,7 +2548,27 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 		assert(texture->pbo);
 		assert(!texture->nocopy);
 
-		texture->data = (uint32_t *) m_glMapBuffer(GL_PIXEL_UNPACK_BUFFER_ARB, GL_WRITE_ONLY);
+#if defined(OGL_PERSISTENT_PBO)
+		if (texture->pbo_map)
+		{
+			// convert straight into the mapped page once the GPU is done with it
+			GLsync &fence = texture->pbo_fence[texture->pbo_page];
+			if (fence)
+			{
+				while (m_glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED) { }
+				m_glDeleteSync(fence);
+				fence = nullptr;
+			}
+			texture->data = texture->pbo_map + (texture->pbo_page * texture->rawwidth * texture->rawheight);
+		}
+		else
+#endif
+		{
+			// orphan the old storage, so mapping doesn't have to wait for
+			// the last upload from it to finish
+			m_glBufferData(GL_PIXEL_UNPACK_BUFFER_ARB, texture->rawwidth * texture->rawheight * sizeof(uint32_t), nullptr, GL_STREAM_DRAW);
+			texture->data = (uint32_t *) m_glMapBuffer(GL_PIXEL_UNPACK_BUFFER_ARB, GL_WRITE_ONLY);
+		}
 	}
 
 	// note that nocopy and borderpix are mutually exclusive, IOW
@@ -2539,12 +2653,26 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 
 		glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->rawwidth);
 
-		// unmap the buffer from the CPU space so it can DMA
-		m_glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER_ARB);
+#if defined(OGL_PERSISTENT_PBO)
+		if (texture->pbo_map)
+		{
+			// kick off the DMA from the page just filled, and fence it
+			uintptr_t const offset = texture->pbo_page * texture->rawwidth * texture->rawheight * sizeof(uint32_t);
+			glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
+						GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, reinterpret_cast<void *>(offset));
+			texture->pbo_fence[texture->pbo_page] = m_glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			texture->pbo_page ^= 1;
+		}
+		else
+#endif
+		{
+			// unmap the buffer from the CPU space so it can DMA
+			m_glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER_ARB);
 
-		// kick off the DMA
-		glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
-					GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, nullptr);
+			// kick off the DMA
+			glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
+						GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, nullptr);
+		}
 	}
 	else
 	{
@@ -16,6 +16,7 @@
 
 #include "modules/lib/osdobj_common.h"
 #include "osdcore.h"
+#include "osdepend.h"
 
 #include <portaudio.h>
 
@@ -54,6 +55,7 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, const s16 *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
+	virtual bool audio_status(osd_audio_status &status) override;
 
 private:
 	// Lock free SPSC ring buffer
@@ -158,6 +160,7 @@ private:
 	PaError             err;
 
 	int                 m_sample_rate;
+	int                 m_device_frames;
 	int                 m_audio_latency;
 	int                 m_attenuation;
 
@@ -267,6 +270,7 @@ int sound_pa::init(osd_interface &osd, osd_options const &options)
 
 	// in milliseconds
 	callback_interval = static_cast<double>(stream_info->outputLatency) * 1000.0;
+	m_device_frames = int(stream_info->outputLatency * m_sample_rate + 0.5);
 
 	// clamp to a probable figure
 	callback_interval = std::min<double>(callback_interval, 20.0);
@@ -434,6 +438,19 @@ void sound_pa::set_mastervolume(int attenuation)
 	m_attenuation = attenuation;
 }
 
+bool sound_pa::audio_status(osd_audio_status &status)
+{
+	if (!m_sample_rate)
+		return false;
+
+	status.sample_rate = m_sample_rate;
+	status.queued_frames = m_ab->count() / 2;
+	status.device_frames = m_device_frames;
+	status.underruns = m_underflows;
+	status.overruns = m_overflows;
+	return true;
+}
+
 void sound_pa::exit()
 {
 	if (!m_sample_rate)
@@ -9,6 +9,7 @@
 *******************************************************************c********/
 
 #include "sound_module.h"
+#include "sound_ring.h"
 #include "modules/osdmodule.h"
 
 #ifndef NO_USE_PULSEAUDIO
@@ -20,11 +21,15 @@
 #include <stdlib.h>
 #include <poll.h>
 
+#include <algorithm>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 #include <pulse/pulseaudio.h>
 
 #include "modules/lib/osdobj_common.h"
+#include "osdepend.h"
 
 using osd::s16;
 using osd::u32;
@@ -42,22 +47,20 @@ public:
 	virtual void exit() override;
 	virtual void update_audio_stream(bool is_throttled, const s16 *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
+	virtual bool audio_status(osd_audio_status &status) override;
 
 private:
-	struct abuffer {
-		size_t cpos;
-		std::vector<u32> data;
-	};
-
 	std::thread *m_thread;
 	pa_mainloop *m_mainloop;
 	pa_context *m_context;
 	pa_stream *m_stream;
 	std::mutex m_mutex;
 
-	std::vector<abuffer> m_buffers;
+	std::unique_ptr<osd::sound_ring> m_ring;
+	std::vector<s16> m_xfer;
+	int m_sample_rate;
+	int m_device_frames;
 
-	u32 m_last_sample;
 	int m_new_volume_value;
 	bool m_setting_volume;
 	bool m_new_volume;
@@ -227,31 +230,12 @@ void sound_pulse::stream_write_request(size_t size)
 	}
 	size >>= 2;
 
-	std::unique_lock<std::mutex> lock(m_mutex);
-	while(size) {
-		if(m_buffers.empty()) {
-			std::vector<u32> zero(size, m_last_sample);
-			int err = pa_stream_write(m_stream, zero.data(), size << 2, nullptr, 0, PA_SEEK_RELATIVE);
-			if(err)
-				generic_pa_error("stream write", err);
-			size = 0;
-
-		} else {
-			auto &buf = m_buffers[0];
-			size_t csz = size;
-			size_t cur = buf.data.size() - buf.cpos;
-			if(csz > cur)
-				csz = cur;
-			int err = pa_stream_write(m_stream, buf.data.data() + buf.cpos, csz << 2, nullptr, 0, PA_SEEK_RELATIVE);
-			if(err)
-				generic_pa_error("stream write", err);
-			if(csz == cur)
-				m_buffers.erase(m_buffers.begin());
-			else
-				buf.cpos += csz;
-			size -= csz;
-		}
-	}
+	// runs on the mainloop thread, pulling from the lock-free ring
+	m_xfer.resize(size * 2);
+	m_ring->read(m_xfer.data(), size);
+	int err = pa_stream_write(m_stream, m_xfer.data(), size << 2, nullptr, 0, PA_SEEK_RELATIVE);
+	if(err)
+		generic_pa_error("stream write", err);
 }
 
 void sound_pulse::i_stream_write_request(pa_stream *, size_t size, void *self)
@@ -275,7 +259,6 @@ void sound_pulse::stop_mainloop(int err)
 
 int sound_pulse::init(osd_interface &osd, osd_options const &options)
 {
-	m_last_sample = 0;
 	m_setting_volume = false;
 	m_new_volume = false;
 	m_new_volume_value = 0;
@@ -298,6 +281,14 @@ int sound_pulse::init(osd_interface &osd, osd_options const &options)
 
 	const int sample_rate = options.sample_rate();
 
+	// the queue holds a fifth of a second; an audio_latency of 0 selects
+	// low-latency mode, where it's kept to a few milliseconds beyond what
+	// the server asks for, otherwise each step allows 1/30 s
+	m_sample_rate = sample_rate;
+	m_ring = std::make_unique<osd::sound_ring>(sample_rate / 5);
+	int const audio_latency = std::clamp(options.audio_latency(), 0, 5);
+	m_ring->set_target(audio_latency ? (sample_rate * audio_latency / 30) : (sample_rate / 250), sample_rate);
+
 	pa_sample_spec ss;
 #ifdef LSB_FIRST
 	ss.format = PA_SAMPLE_S16LE;
@@ -316,6 +307,7 @@ int sound_pulse::init(osd_interface &osd, osd_options const &options)
 	battr.minreq = sample_rate / 1000;
 	battr.prebuf = uint32_t(-1);
 	battr.tlength = sample_rate / 1000;
+	m_device_frames = battr.tlength / 4;
 
 	err = pa_stream_connect_playback(m_stream, nullptr, &battr, PA_STREAM_ADJUST_LATENCY, nullptr, nullptr);
 	if(err)
@@ -329,23 +321,25 @@ int sound_pulse::init(osd_interface &osd, osd_options const &options)
 
 void sound_pulse::update_audio_stream(bool is_throttled, const s16 *buffer, int samples_this_frame)
 {
-	std::unique_lock<std::mutex> lock(m_mutex);
-	m_buffers.resize(m_buffers.size() + 1);
-	auto &buf = m_buffers.back();
-	buf.cpos = 0;
-	buf.data.resize(samples_this_frame);
-	memcpy(buf.data.data(), buffer, samples_this_frame*4);
-	m_last_sample = buf.data.back();
-
-	if(m_buffers.size() > 10)
-		// If there way too many buffers, drop some so only 10 are left (roughly 0.2s)
-		m_buffers.erase(m_buffers.begin(), m_buffers.begin() + m_buffers.size() - 10);
-
-	else if(m_buffers.size() >= 5)
-		// If there are too many buffers, remove five sample per buffer
-		// to slowly resync to reduce latency (4 seconds to
-		// compensate one buffer roughly)
-		buf.cpos = 5;
+	if(!m_ring)
+		return;
+
+	// samples that don't fit are dropped; the consumer trims the queue
+	// back to the target when it stays too full
+	m_ring->write(buffer, samples_this_frame);
+}
+
+bool sound_pulse::audio_status(osd_audio_status &status)
+{
+	if(!m_ring)
+		return false;
+
+	status.sample_rate = m_sample_rate;
+	status.queued_frames = m_ring->queued();
+	status.device_frames = m_device_frames;
+	status.underruns = m_ring->underruns();
+	status.overruns = m_ring->overruns();
+	return true;
 }
 
 void sound_pulse::volume_set_notify(int success)
@@ -405,7 +399,7 @@ void sound_pulse::exit()
 	m_mainloop = nullptr;
 	m_context = nullptr;
 	m_stream = nullptr;
-	m_buffers.clear();
+	m_ring.reset();
 }
 
 #else
@@ -9,6 +9,7 @@
 //============================================================
 
 #include "sound_module.h"
+#include "sound_ring.h"
 
 #include "modules/osdmodule.h"
 
@@ -16,6 +17,7 @@
 
 #include "modules/lib/osdobj_common.h"
 #include "osdcore.h"
+#include "osdepend.h"
 
 // standard sdl header
 #include <SDL2/SDL.h>
@@ -49,17 +51,18 @@ public:
 	// number of samples per SDL callback
 	static inline constexpr int SDL_XFER_SAMPLES = 512;
 
+	// length of an SDL callback in low-latency mode
+	static inline constexpr int LOW_LATENCY_XFER_MS = 2;
+
 	sound_sdl() :
 		osd_module(OSD_SOUND_PROVIDER, "sdl"), sound_module(),
 		sample_rate(0),
 		sdl_xfer_samples(SDL_XFER_SAMPLES),
 		stream_in_initialized(0),
 		attenuation(0),
-		buf_locked(0),
+		low_latency(false),
 		stream_buffer(nullptr),
-		stream_buffer_size(0),
-		buffer_underflows(0),
-		buffer_overflows(0)
+		stream_buffer_frames(0)
 	{
 	}
 	virtual ~sound_sdl() { }
@@ -71,30 +74,12 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, const int16_t *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
+	virtual bool audio_status(osd_audio_status &status) override;
 
 private:
-	class ring_buffer
-	{
-	public:
-		ring_buffer(size_t size);
-
-		size_t data_size() const { return (tail - head + buffer_size) % buffer_size; }
-		size_t free_size() const { return (head - tail - 1 + buffer_size) % buffer_size; }
-		int append(const void *data, size_t size);
-		int pop(void *data, size_t size);
-
-	private:
-		std::unique_ptr<int8_t []> const buffer;
-		size_t const buffer_size;
-		int head = 0, tail = 0;
-	};
-
 	static void sdl_callback(void *userdata, Uint8 *stream, int len);
 
-	void lock_buffer();
-	void unlock_buffer();
 	void attenuate(int16_t *data, int bytes);
-	void copy_sample_data(bool is_throttled, const int16_t *data, int bytes_to_copy);
 	int sdl_create_buffers();
 	void sdl_destroy_buffers();
 
@@ -103,14 +88,12 @@ private:
 	int stream_in_initialized;
 	int attenuation;
 
-	int              buf_locked;
-	std::unique_ptr<ring_buffer> stream_buffer;
-	uint32_t         stream_buffer_size;
+	bool             low_latency;
+	std::unique_ptr<sound_ring> stream_buffer;
+	uint32_t         stream_buffer_frames;
 
 
 	// diagnostics
-	int              buffer_underflows;
-	int              buffer_overflows;
 	std::unique_ptr<std::ofstream> sound_log;
 };
 
@@ -122,98 +105,6 @@ private:
 // maximum audio latency
 #define MAX_AUDIO_LATENCY       5
 
-//============================================================
-//  ring_buffer - constructor
-//============================================================
-
-sound_sdl::ring_buffer::ring_buffer(size_t size)
-	: buffer(std::make_unique<int8_t []>(size + 1)), buffer_size(size + 1)
-{
-	// A size+1 bytes buffer is allocated because it can never be full.
-	// Otherwise the case head == tail couldn't be distinguished between a
-	// full buffer and an empty buffer.
-	std::fill_n(buffer.get(), size + 1, 0);
-}
-
-//============================================================
-//  ring_buffer::append
-//============================================================
-
-int sound_sdl::ring_buffer::append(const void *data, size_t size)
-{
-	if (free_size() < size)
-		return -1;
-
-	int8_t const *const data8 = reinterpret_cast<int8_t const *>(data);
-	size_t sz = buffer_size - tail;
-	if (size <= sz)
-		sz = size;
-	else
-		std::copy_n(&data8[sz], size - sz, &buffer[0]);
-
-	std::copy_n(data8, sz, &buffer[tail]);
-	tail = (tail + size) % buffer_size;
-
-	return 0;
-}
-
-//============================================================
-//  ring_buffer::pop
-//============================================================
-
-int sound_sdl::ring_buffer::pop(void *data, size_t size)
-{
-	if (data_size() < size)
-		return -1;
-
-	int8_t *const data8 = reinterpret_cast<int8_t *>(data);
-	size_t sz = buffer_size - head;
-	if (size <= sz)
-		sz = size;
-	else
-	{
-		std::copy_n(&buffer[0], size - sz, &data8[sz]);
-		std::fill_n(&buffer[0], size - sz, 0);
-	}
-
-	std::copy_n(&buffer[head], sz, data8);
-	std::fill_n(&buffer[head], sz, 0);
-	head = (head + size) % buffer_size;
-
-	return 0;
-}
-
-//============================================================
-//  sound_sdl - destructor
-//============================================================
-
-//============================================================
-//  lock_buffer
-//============================================================
-void sound_sdl::lock_buffer()
-{
-	if (!buf_locked)
-		SDL_LockAudio();
-	buf_locked++;
-
-	if (LOG_SOUND)
-		*sound_log << "locking\n";
-}
-
-//============================================================
-//  unlock_buffer
-//============================================================
-void sound_sdl::unlock_buffer()
-{
-	buf_locked--;
-	if (!buf_locked)
-		SDL_UnlockAudio();
-
-	if (LOG_SOUND)
-		*sound_log << "unlocking\n";
-
-}
-
 //============================================================
 //  Apply attenuation
 //============================================================
@@ -230,21 +121,6 @@ void sound_sdl::attenuate(int16_t *data, int bytes_to_copy)
 	}
 }
 
-//============================================================
-//  copy_sample_data
-//============================================================
-
-void sound_sdl::copy_sample_data(bool is_throttled, const int16_t *data, int bytes_to_copy)
-{
-	lock_buffer();
-	int const err = stream_buffer->append(data, bytes_to_copy);
-	unlock_buffer();
-
-	if (LOG_SOUND && err)
-		*sound_log << "Late detection of overflow. This shouldn't happen.\n";
-}
-
-
 //============================================================
 //  update_audio_stream
 //============================================================
@@ -257,34 +133,24 @@ void sound_sdl::update_audio_stream(bool is_throttled, const int16_t *buffer, in
 
 	if (!stream_in_initialized)
 	{
-		// Fill in some zeros to prevent an initial buffer underflow
-		int8_t zero = 0;
-		size_t zsize = stream_buffer->free_size() / 2;
-		while (zsize--)
-			stream_buffer->append(&zero, 1);
+		// Fill in some zeros to prevent an initial buffer underflow; in
+		// low-latency mode, just enough to cover the first callbacks
+		stream_buffer->write_silence(low_latency ? (sdl_xfer_samples * 2) : (stream_buffer->capacity() / 2));
 
 		// start playing
 		SDL_PauseAudio(0);
 		stream_in_initialized = 1;
 	}
 
-	size_t bytes_this_frame = samples_this_frame * sizeof(*buffer) * 2;
-	size_t free_size = stream_buffer->free_size();
-	size_t data_size = stream_buffer->data_size();
-
-	if (stream_buffer->free_size() < bytes_this_frame) {
-		if (LOG_SOUND)
-			util::stream_format(*sound_log, "Overflow: DS=%u FS=%u BTF=%u\n", data_size, free_size, bytes_this_frame);
-		buffer_overflows++;
-		return;
-	}
-
-	copy_sample_data(is_throttled, buffer, bytes_this_frame);
-
-	size_t nfree_size = stream_buffer->free_size();
-	size_t ndata_size = stream_buffer->data_size();
+	unsigned const queued = stream_buffer->queued();
+	unsigned const written = stream_buffer->write(buffer, samples_this_frame);
 	if (LOG_SOUND)
-		util::stream_format(*sound_log, "Appended data: DS=%u(%u) FS=%u(%u) BTF=%u\n", data_size, ndata_size, free_size, nfree_size, bytes_this_frame);
+	{
+		if (written < samples_this_frame)
+			util::stream_format(*sound_log, "Overflow: queued=%u frames=%d\n", queued, samples_this_frame);
+		else
+			util::stream_format(*sound_log, "Appended data: queued=%u frames=%d\n", queued, samples_this_frame);
+	}
 }
 
 
@@ -312,29 +178,40 @@ void sound_sdl::set_mastervolume(int _attenuation)
 //============================================================
 void sound_sdl::sdl_callback(void *userdata, Uint8 *stream, int len)
 {
+	// runs on SDL's audio thread; the ring is lock-free, so this never
+	// waits for the emulation side
 	sound_sdl *thiz = reinterpret_cast<sound_sdl *>(userdata);
-	size_t const free_size = thiz->stream_buffer->free_size();
-	size_t const data_size = thiz->stream_buffer->data_size();
+	unsigned const frames = len / (2 * sizeof(int16_t));
+	unsigned const queued = thiz->stream_buffer->queued();
 
-	if (data_size < len)
+	if (thiz->stream_buffer->read(reinterpret_cast<int16_t *>(stream), frames) < frames)
 	{
-		thiz->buffer_underflows++;
 		if (LOG_SOUND)
-			util::stream_format(*thiz->sound_log, "Underflow at sdl_callback: DS=%u FS=%u Len=%d\n", data_size, free_size, len);
-
-		// Maybe read whatever is left in the stream_buffer anyway?
-		memset(stream, 0, len);
-		return;
+			util::stream_format(*thiz->sound_log, "Underflow at sdl_callback: queued=%u frames=%u\n", queued, frames);
 	}
 
-	int err = thiz->stream_buffer->pop((void *)stream, len);
-	if (LOG_SOUND && err)
-		*thiz->sound_log << "Late detection of underflow. This shouldn't happen.\n";
-
 	thiz->attenuate((int16_t *)stream, len);
 
 	if (LOG_SOUND)
-		util::stream_format(*thiz->sound_log, "callback: xfer DS=%u FS=%u Len=%d\n", data_size, free_size, len);
+		util::stream_format(*thiz->sound_log, "callback: xfer queued=%u frames=%u\n", queued, frames);
+}
+
+
+//============================================================
+//  audio_status
+//============================================================
+
+bool sound_sdl::audio_status(osd_audio_status &status)
+{
+	if (sample_rate == 0 || !stream_buffer)
+		return false;
+
+	status.sample_rate = sample_rate;
+	status.queued_frames = stream_buffer->queued();
+	status.device_frames = sdl_xfer_samples;
+	status.underruns = stream_buffer->underruns();
+	status.overruns = stream_buffer->overruns();
+	return true;
 }
 
 
@@ -365,7 +242,16 @@ int sound_sdl::init(osd_interface &osd, const osd_options &options)
 		char const *const audio_driver = SDL_GetCurrentAudioDriver();
 		osd_printf_verbose("Audio: Driver is %s\n", audio_driver ? audio_driver : "not initialized");
 
+		// an audio_latency of 0 selects low-latency mode: short callbacks,
+		// and the queue is kept to a couple of them
+		low_latency = (options.audio_latency() <= 0);
 		sdl_xfer_samples = SDL_XFER_SAMPLES;
+		if (low_latency)
+		{
+			sdl_xfer_samples = 64;
+			while (sdl_xfer_samples < (sample_rate * LOW_LATENCY_XFER_MS / 1000))
+				sdl_xfer_samples <<= 1;
+		}
 		stream_in_initialized = 0;
 
 		// set up the audio specs
@@ -385,13 +271,14 @@ int sound_sdl::init(osd_interface &osd, const osd_options &options)
 		sdl_xfer_samples = obtained.samples;
 
 		// pin audio latency
-		audio_latency = std::clamp(options.audio_latency(), 1, MAX_AUDIO_LATENCY);
+		audio_latency = std::clamp(options.audio_latency(), 0, MAX_AUDIO_LATENCY);
 
-		// compute the buffer sizes
-		stream_buffer_size = (sample_rate * 2 * sizeof(int16_t) * (2 + audio_latency)) / 30;
-		stream_buffer_size = (stream_buffer_size / 1024) * 1024;
-		if (stream_buffer_size < 1024)
-			stream_buffer_size = 1024;
+		// compute the buffer sizes; the queue has to hold at least an
+		// update's worth even when the latency is low
+		stream_buffer_frames = (sample_rate * (2 + audio_latency)) / 30;
+		stream_buffer_frames = (stream_buffer_frames / 256) * 256;
+		if (stream_buffer_frames < 256)
+			stream_buffer_frames = 256;
 
 		// create the buffers
 		if (sdl_create_buffers())
@@ -430,16 +317,16 @@ void sound_sdl::exit()
 
 	SDL_QuitSubSystem(SDL_INIT_AUDIO);
 
-	// kill the buffers
-	sdl_destroy_buffers();
-
 	// print out over/underflow stats
-	if (buffer_overflows || buffer_underflows)
-		osd_printf_verbose("Sound buffer: overflows=%d underflows=%d\n", buffer_overflows, buffer_underflows);
+	unsigned const overflows = stream_buffer ? stream_buffer->overruns() : 0;
+	unsigned const underflows = stream_buffer ? stream_buffer->underruns() : 0;
+	sdl_destroy_buffers();
+	if (overflows || underflows)
+		osd_printf_verbose("Sound buffer: overflows=%u underflows=%u\n", overflows, underflows);
 
 	if (LOG_SOUND)
 	{
-		util::stream_format(*sound_log, "Sound buffer: overflows=%d underflows=%d\n", buffer_overflows, buffer_underflows);
+		util::stream_format(*sound_log, "Sound buffer: overflows=%u underflows=%u\n", overflows, underflows);
 		sound_log.reset();
 	}
 }
@@ -452,10 +339,11 @@ void sound_sdl::exit()
 
 int sound_sdl::sdl_create_buffers()
 {
-	osd_printf_verbose("sdl_create_buffers: creating stream buffer of %u bytes\n", stream_buffer_size);
+	osd_printf_verbose("sdl_create_buffers: creating stream buffer of %u frames\n", stream_buffer_frames);
 
-	stream_buffer = std::make_unique<ring_buffer>(stream_buffer_size);
-	buf_locked = 0;
+	stream_buffer = std::make_unique<sound_ring>(stream_buffer_frames);
+	if (low_latency)
+		stream_buffer->set_target(sdl_xfer_samples * 2, sample_rate);
 	return 0;
 }
 
@@ -17,6 +17,8 @@
 
 #define OSD_SOUND_PROVIDER   "sound"
 
+struct osd_audio_status;
+
 class sound_module
 {
 public:
@@ -24,6 +26,9 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, const int16_t *buffer, int samples_this_frame) = 0;
 	virtual void set_mastervolume(int attenuation) = 0;
+
+	// report output buffering, for modules that can measure it
+	virtual bool audio_status(osd_audio_status &status) { return false; }
 };
 
 #endif // MAME_OSD_SOUND_SOUND_MODULE_H
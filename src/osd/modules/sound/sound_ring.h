@@ -0,0 +1,164 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/*
+ * sound_ring.h
+ *
+ * Lock-free single-producer single-consumer queue of stereo frames, for
+ * sound modules whose device pulls samples from a callback.  The
+ * emulation side writes each update's samples; the device callback reads
+ * as many frames as it needs and never blocks.
+ *
+ * In low-latency mode the consumer also caps the queue: if the least it
+ * held over about a second stayed above the target, the excess is
+ * dropped, so latency built up by a stall doesn't persist.
+ *
+ */
+#ifndef MAME_OSD_SOUND_SOUND_RING_H
+#define MAME_OSD_SOUND_SOUND_RING_H
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <memory>
+
+
+namespace osd {
+
+class sound_ring
+{
+public:
+	// capacity in stereo frames; one slot is kept free to tell full from empty
+	sound_ring(unsigned frames) :
+		m_buffer(std::make_unique<int16_t []>((frames + 1) * 2)),
+		m_size(frames + 1),
+		m_target(0),
+		m_window(0),
+		m_window_left(0),
+		m_window_min(UINT_MAX),
+		m_starved(false),
+		m_head(0),
+		m_tail(0),
+		m_underruns(0),
+		m_overruns(0)
+	{
+		std::fill_n(m_buffer.get(), m_size * 2, 0);
+	}
+
+	unsigned capacity() const { return m_size - 1; }
+	unsigned queued() const { return (m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire) + m_size) % m_size; }
+	unsigned underruns() const { return m_underruns.load(std::memory_order_relaxed); }
+	unsigned overruns() const { return m_overruns.load(std::memory_order_relaxed); }
+
+	// set before the device starts: keep no more than 'frames' queued,
+	// checked over 'window' frames of output; zero disables the cap
+	void set_target(unsigned frames, unsigned window)
+	{
+		m_target = frames;
+		m_window = m_window_left = window;
+		m_window_min = UINT_MAX;
+	}
+
+	// producer: queue up to 'frames' frames, dropping what doesn't fit
+	unsigned write(int16_t const *data, unsigned frames)
+	{
+		unsigned const head = m_head.load(std::memory_order_acquire);
+		unsigned const tail = m_tail.load(std::memory_order_relaxed);
+		unsigned const room = (head - tail - 1 + m_size) % m_size;
+		if (room < frames)
+		{
+			m_overruns.fetch_add(1, std::memory_order_relaxed);
+			frames = room;
+		}
+
+		unsigned const first = std::min(frames, m_size - tail);
+		std::copy_n(data, first * 2, &m_buffer[tail * 2]);
+		std::copy_n(data + first * 2, (frames - first) * 2, &m_buffer[0]);
+		m_tail.store((tail + frames) % m_size, std::memory_order_release);
+		return frames;
+	}
+
+	// producer: queue 'frames' frames of silence, as far as they fit
+	void write_silence(unsigned frames)
+	{
+		unsigned const head = m_head.load(std::memory_order_acquire);
+		unsigned const tail = m_tail.load(std::memory_order_relaxed);
+		frames = std::min(frames, (head - tail - 1 + m_size) % m_size);
+
+		unsigned const first = std::min(frames, m_size - tail);
+		std::fill_n(&m_buffer[tail * 2], first * 2, 0);
+		std::fill_n(&m_buffer[0], (frames - first) * 2, 0);
+		m_tail.store((tail + frames) % m_size, std::memory_order_release);
+	}
+
+	// consumer: fetch 'frames' frames, padding any shortfall with silence
+	unsigned read(int16_t *data, unsigned frames)
+	{
+		unsigned head = m_head.load(std::memory_order_relaxed);
+		unsigned const tail = m_tail.load(std::memory_order_acquire);
+		unsigned available = (tail - head + m_size) % m_size;
+		unsigned count = frames;
+		bool const starved = available < frames;
+		if (starved)
+		{
+			// count each run of short reads once, so a paused producer
+			// doesn't look like a stream of underruns
+			if (!m_starved)
+				m_underruns.fetch_add(1, std::memory_order_relaxed);
+			std::fill_n(data + available * 2, (frames - available) * 2, 0);
+			count = available;
+		}
+		m_starved = starved;
+
+		unsigned const first = std::min(count, m_size - head);
+		std::copy_n(&m_buffer[head * 2], first * 2, data);
+		std::copy_n(&m_buffer[0], (count - first) * 2, data + first * 2);
+		head = (head + count) % m_size;
+		available -= count;
+
+		// track the low point, and drop anything beyond the target it leaves
+		if (m_target)
+		{
+			m_window_min = std::min(m_window_min, available);
+			if (m_window_left > frames)
+			{
+				m_window_left -= frames;
+			}
+			else
+			{
+				if (m_window_min > m_target)
+				{
+					head = (head + m_window_min - m_target) % m_size;
+					m_overruns.fetch_add(1, std::memory_order_relaxed);
+				}
+				m_window_left = m_window;
+				m_window_min = UINT_MAX;
+			}
+		}
+
+		m_head.store(head, std::memory_order_release);
+		return count;
+	}
+
+private:
+	std::unique_ptr<int16_t []> const m_buffer;
+	unsigned const m_size;
+
+	// consumer-side latency cap
+	unsigned m_target;
+	unsigned m_window;
+	unsigned m_window_left;
+	unsigned m_window_min;
+	bool m_starved;
+
+	std::atomic<unsigned> m_head;   // next frame to read, written by the consumer
+	std::atomic<unsigned> m_tail;   // next frame to write, written by the producer
+	std::atomic<unsigned> m_underruns;
+	std::atomic<unsigned> m_overruns;
+};
+
+} // namespace osd
+
+#endif // MAME_OSD_SOUND_SOUND_RING_H
@@ -134,13 +134,18 @@ void osd_sleep(osd_ticks_t duration) noexcept;
 
 /* this is the maximum number of supported threads for a single work queue */
 /* threadid values are expected to range from 0..WORK_MAX_THREADS-1 */
-#define WORK_MAX_THREADS            16
+#define WORK_MAX_THREADS            64
+
+/* this is the number of threads a queue is limited to unless WORK_QUEUE_FLAG_BATCH is set */
+#define WORK_DEFAULT_MAX_THREADS    16
 
 /* these flags can be set when creating a queue to give hints to the code about
    how to configure the queue */
 #define WORK_QUEUE_FLAG_IO          0x0001
 #define WORK_QUEUE_FLAG_MULTI       0x0002
 #define WORK_QUEUE_FLAG_HIGH_FREQ   0x0004
+/* throughput-bound offline work (e.g. chdman) that may use up to WORK_MAX_THREADS threads */
+#define WORK_QUEUE_FLAG_BATCH       0x0008
 
 /* these flags can be set when queueing a work item to indicate how to handle
    its deconstruction */
@@ -336,6 +341,42 @@ void *osd_work_item_result(osd_work_item *item);
 void osd_work_item_release(osd_work_item *item);
 
 
+/* statistics kept for each work queue; times are in osd_ticks_per_second() */
+struct osd_work_queue_stats
+{
+	uint32_t        threads;        // worker threads
+	uint64_t        items;          // items queued
+	uint64_t        steals;         // items taken from another thread's list
+	osd_ticks_t     latency;        // total time items waited from queueing to starting
+	osd_ticks_t     latency_max;    // longest time an item waited
+	osd_ticks_t     run;            // total time spent in callbacks
+	osd_ticks_t     spin;           // total time spent spinning for more work
+	osd_ticks_t     idle;           // total time worker threads spent parked
+};
+
+
+/*-----------------------------------------------------------------------------
+    osd_work_queue_get_stats: get the statistics for a work queue
+
+    Parameters:
+
+        queue - pointer to an osd_work_queue that was previously created via
+            osd_work_queue_alloc
+
+        stats - filled in with the totals since the queue was created
+
+    Return value:
+
+        None.
+
+    Notes:
+
+        Setting the OSDWORKQUEUESTATS environment variable to 1 prints them
+        when each queue is freed.
+-----------------------------------------------------------------------------*/
+void osd_work_queue_get_stats(osd_work_queue *queue, osd_work_queue_stats &stats);
+
+
 
 /***************************************************************************
     MISCELLANEOUS INTERFACES
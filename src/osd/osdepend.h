@@ -56,6 +56,21 @@ public:
 	virtual bool get_bitmap(char32_t chnum, bitmap_argb32 &bitmap, std::int32_t &width, std::int32_t &xoffs, std::int32_t &yoffs) = 0;
 };
 
+// ======================> osd_audio_status
+
+// buffering state of the audio output, as reported by the sound module
+struct osd_audio_status
+{
+	int sample_rate = 0;            // output sample rate
+	int queued_frames = 0;          // frames queued for the device
+	int device_frames = 0;          // frames the device takes per callback
+	unsigned underruns = 0;         // device callbacks that found too little queued
+	unsigned overruns = 0;          // times queued audio was dropped
+
+	// estimated time from an update reaching the OSD to it being played
+	double latency_ms() const { return sample_rate ? (1000.0 * (queued_frames + device_frames) / sample_rate) : 0.0; }
+};
+
 // ======================> osd_interface
 
 // description of the currently-running machine
@@ -78,6 +93,7 @@ public:
 	virtual void update_audio_stream(const int16_t *buffer, int samples_this_frame) = 0;
 	virtual void set_mastervolume(int attenuation) = 0;
 	virtual bool no_sound() = 0;
+	virtual bool audio_status(osd_audio_status &status) = 0;
 
 	// input overridables
 	virtual void customize_input_type_list(std::vector<input_type_entry> &typelist) = 0;
@@ -85,6 +101,7 @@ public:
 	// video overridables
 	virtual void add_audio_to_recording(const int16_t *buffer, int samples_this_frame) = 0;
 	virtual std::vector<ui::menu_item> get_slider_list() = 0;
+	virtual bool variable_refresh() = 0;
 
 	// font interface
 	virtual osd_font::ptr font_alloc() = 0;
@@ -151,6 +151,20 @@ public:
 	/// \return Result of the operation.
 	virtual std::error_condition flush() noexcept = 0;
 
+	/// \brief Map the contents of an open file into memory
+	///
+	/// Provides read-only access to the entire contents of a file
+	/// without copying them, so the pages may be shared with other
+	/// processes through the host's cache.  Only supported for regular
+	/// files opened for reading but not writing.  The mapping is
+	/// created on first use, and remains valid until the file is
+	/// closed.  Reads from a mapped file are served from the mapping.
+	/// The default implementation does not support mapping.
+	/// \return Pointer to the start of the file contents, or nullptr
+	///   if the file can't be mapped (e.g. stream-like objects, files
+	///   opened for writing, or empty files).
+	virtual void const *map() noexcept { return nullptr; }
+
 	/// \brief Delete a file
 	///
 	/// \param [in] filename Path to the file to delete.
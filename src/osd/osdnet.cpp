@@ -41,17 +41,28 @@ class osd_netdev *open_netdev(int id, class device_network_interface *ifdev, int
 osd_netdev::osd_netdev(class device_network_interface *ifdev, int rate)
 {
 	m_dev = ifdev;
+	m_rate = rate;
 	m_timer = ifdev->device().timer_alloc(FUNC(osd_netdev::recv), this);
 	m_timer->adjust(attotime::from_hz(rate), 0, attotime::from_hz(rate));
 }
 
 osd_netdev::~osd_netdev()
 {
+	if (m_stats.rx_frames || m_stats.tx_frames || m_stats.tx_failed)
+	{
+		osd_printf_verbose("%s: received %u frames (%u bytes) in %u polls, sent %u frames (%u bytes), %u failed\n",
+				m_dev->device().tag(),
+				m_stats.rx_frames, m_stats.rx_bytes, m_stats.polls,
+				m_stats.tx_frames, m_stats.tx_bytes, m_stats.tx_failed);
+	}
 }
 
 void osd_netdev::start()
 {
-	m_timer->enable(true);
+	// frames may have queued up while the interface was busy, so check
+	// straight away rather than waiting for the next poll
+	if (!m_timer->enabled())
+		m_timer->adjust(attotime::zero, 0, attotime::from_hz(m_rate));
 }
 
 void osd_netdev::stop()
@@ -60,6 +71,21 @@ void osd_netdev::stop()
 }
 
 int osd_netdev::send(uint8_t *buf, int len)
+{
+	int const result = send_dev(buf, len);
+	if (result > 0)
+	{
+		m_stats.tx_frames++;
+		m_stats.tx_bytes += result;
+	}
+	else
+	{
+		m_stats.tx_failed++;
+	}
+	return result;
+}
+
+int osd_netdev::send_dev(uint8_t *buf, int len)
 {
 	return 0;
 }
@@ -69,6 +95,9 @@ void osd_netdev::recv(int32_t param)
 	uint8_t *buf;
 	int len;
 	//const char atalkmac[] = { 0x09, 0x00, 0x07, 0xff, 0xff, 0xff };
+	// deliver everything that's waiting until the interface is busy; frames
+	// are used where the host left them and stay queued there until then
+	m_stats.polls++;
 	while(m_timer->enabled() && (len = recv_dev(&buf)))
 	{
 #if 0
@@ -83,6 +112,8 @@ void osd_netdev::recv(int32_t param)
 		}
 #endif
 
+		m_stats.rx_frames++;
+		m_stats.rx_bytes += len;
 		m_dev->recv_cb(buf, len);
 	}
 }
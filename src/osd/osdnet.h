@@ -28,19 +28,31 @@ public:
 		char description[256];
 		create_netdev func = nullptr;
 	};
+	struct statistics
+	{
+		uint64_t rx_frames = 0;     // frames passed to the emulated interface
+		uint64_t rx_bytes = 0;
+		uint64_t tx_frames = 0;     // frames the host accepted
+		uint64_t tx_bytes = 0;
+		uint64_t tx_failed = 0;     // frames the host didn't accept
+		uint64_t polls = 0;         // times the host was checked for frames
+	};
+
 	osd_netdev(class device_network_interface *ifdev, int rate);
 	virtual ~osd_netdev();
 	void start();
 	void stop();
 
-	virtual int send(uint8_t *buf, int len);
+	int send(uint8_t *buf, int len);
 	virtual void set_mac(const char *mac);
 	virtual void set_promisc(bool promisc);
 
 	const char *get_mac();
 	bool get_promisc();
+	const statistics &stats() const { return m_stats; }
 
 protected:
+	virtual int send_dev(uint8_t *buf, int len);
 	virtual int recv_dev(uint8_t **buf);
 
 private:
@@ -48,6 +60,8 @@ private:
 
 	class device_network_interface *m_dev;
 	emu_timer *m_timer;
+	int m_rate;
+	statistics m_stats;
 };
 
 class osd_netdev *open_netdev(int id, class device_network_interface *ifdev, int rate);
@@ -30,12 +30,13 @@
 #if defined(SDLMAME_LINUX) || defined(SDLMAME_BSD) || defined(SDLMAME_HAIKU) || defined(SDLMAME_EMSCRIPTEN) || defined(SDLMAME_MACOSX)
 #include <pthread.h>
 #endif
+#if defined(SDLMAME_LINUX)
+#include <sched.h>
+#endif
 
-//============================================================
-//  DEBUGGING
-//============================================================
-
-#define KEEP_STATISTICS         (0)
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
 
 //============================================================
 //  PARAMETERS
@@ -43,22 +44,26 @@
 
 #define ENV_PROCESSORS               "OSDPROCESSORS"
 #define ENV_WORKQUEUEMAXTHREADS      "OSDWORKQUEUEMAXTHREADS"
+#define ENV_WORKQUEUEAFFINITY        "OSDWORKQUEUEAFFINITY"
+#define ENV_WORKQUEUESTATS           "OSDWORKQUEUESTATS"
 
+// high frequency queue threads spin between these times before parking
 #define SPIN_LOOP_TIME          (osd_ticks_per_second() / 10000)
+#define MIN_SPIN_LOOP_TIME      (osd_ticks_per_second() / 200000)
 
 //============================================================
 //  MACROS
 //============================================================
 
-#if KEEP_STATISTICS
-#define add_to_stat(v,x)        do { (v) += (x); } while (0)
-#define begin_timing(v)         do { (v) -= get_profile_ticks(); } while (0)
-#define end_timing(v)           do { (v) += get_profile_ticks(); } while (0)
-#else
-#define add_to_stat(v,x)        do { } while (0)
-#define begin_timing(v)         do { } while (0)
-#define end_timing(v)           do { } while (0)
+// tell the processor we're spinning, so it can give the other hardware thread a go
+static inline void spin_pause()
+{
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+	_mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+	__asm__ __volatile__("yield");
 #endif
+}
 
 template<typename _AtomType, typename _MainType>
 static void spin_while(const volatile _AtomType * volatile atom, const _MainType val, const osd_ticks_t timeout, const int invert = 0)
@@ -108,13 +113,17 @@ struct work_thread_info
 		, handle(nullptr)
 		, wakeevent(true, false)  // manual reset, not signalled
 		, id(aid)
-#if KEEP_STATISTICS
+		, head(nullptr)
+		, tail(nullptr)
+		, count(0)
+		, spinbudget(SPIN_LOOP_TIME)
 		, itemsdone(0)
-		, actruntime(0)
+		, steals(0)
 		, runtime(0)
 		, spintime(0)
-		, waittime(0)
-#endif
+		, idletime(0)
+		, latency(0)
+		, latencymax(0)
 	{
 	}
 
@@ -123,57 +132,56 @@ struct work_thread_info
 	osd_event           wakeevent;      // wake event for the thread
 	uint32_t            id;
 
-#if KEEP_STATISTICS
-	int32_t             itemsdone;
-	osd_ticks_t         actruntime;
-	osd_ticks_t         runtime;
-	osd_ticks_t         spintime;
-	osd_ticks_t         waittime;
-#endif
+	// this thread's own items; other threads steal from here when they run out
+	std::mutex          lock;           // lock for protecting the list
+	osd_work_item *     head;           // next item to run
+	osd_work_item *     tail;           // last item in the list
+	std::atomic<int32_t> count;         // items in the list
+
+	osd_ticks_t         spinbudget;     // how long to spin for more work before parking
+
+	// statistics, only written by the thread itself
+	std::atomic<uint64_t> itemsdone;    // items this thread ran
+	std::atomic<uint64_t> steals;       // items this thread took from other threads
+	std::atomic<osd_ticks_t> runtime;   // time spent in callbacks
+	std::atomic<osd_ticks_t> spintime;  // time spent spinning for more work
+	std::atomic<osd_ticks_t> idletime;  // time spent parked
+	std::atomic<osd_ticks_t> latency;   // total time items waited from queueing to starting here
+	std::atomic<osd_ticks_t> latencymax; // longest time an item waited
 };
 
 
 struct osd_work_queue
 {
 	osd_work_queue()
-		: list(nullptr)
-		, tailptr(nullptr)
-		, free(nullptr)
+		: free(nullptr)
 		, items(0)
+		, pending(0)
 		, livethreads(0)
 		, waiting(0)
 		, exiting(0)
+		, nextthread(0)
 		, threads(0)
 		, flags(0)
 		, doneevent(true, true)     // manual reset, signalled
-#if KEEP_STATISTICS
 		, itemsqueued(0)
-		, setevents(0)
-		, extraitems(0)
-		, spinloops(0)
-#endif
 	{
 	}
 
-	std::mutex          lock;           // lock for protecting the queue
-	std::atomic<osd_work_item *> list;  // list of items in the queue
-	osd_work_item ** volatile tailptr;  // pointer to the tail pointer of work items in the queue
+	std::mutex          lock;           // lock for the free list and item events
 	std::atomic<osd_work_item *> free;  // free list of work items
-	std::atomic<int32_t>  items;          // items in the queue
+	std::atomic<int32_t>  items;          // items queued or running
+	std::atomic<int32_t>  pending;        // items queued and not yet started
 	std::atomic<int32_t>  livethreads;    // number of live threads
 	std::atomic<int32_t>  waiting;        // is someone waiting on the queue to complete?
 	std::atomic<int32_t>  exiting;        // should the threads exit on their next opportunity?
+	std::atomic<uint32_t> nextthread;     // thread to give the next batch of items to
 	uint32_t              threads;        // number of threads in this queue
 	uint32_t              flags;          // creation flags
 	std::vector<work_thread_info *>  thread;         // array of thread information
 	osd_event           doneevent;      // event signalled when work is complete
 
-#if KEEP_STATISTICS
-	std::atomic<int32_t>  itemsqueued;    // total items queued
-	std::atomic<int32_t>  setevents;      // number of times we called SetEvent
-	std::atomic<int32_t>  extraitems;     // how many extra items we got after the first in the queue loop
-	std::atomic<int32_t>  spinloops;      // how many times spinning bought us more items
-#endif
+	std::atomic<uint64_t> itemsqueued;    // total items queued
 };
 
 
@@ -187,6 +195,7 @@ struct osd_work_item
 		, result(nullptr)
 		, event(nullptr)                // manual reset, not signalled
 		, flags(0)
+		, queued(0)
 		, done(false)
 	{
 	}
@@ -198,6 +207,7 @@ struct osd_work_item
 	void *              result;         // callback result
 	osd_event *         event;          // event signalled when complete
 	uint32_t            flags;          // creation flags
+	osd_ticks_t         queued;         // when the item was queued
 	std::atomic<int32_t>  done;           // is the item done?
 };
 
@@ -215,6 +225,18 @@ static int effective_num_processors(bool heavy_mt);
 static void *worker_thread_entry(void *param);
 static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread);
 static bool queue_has_list_items(osd_work_queue *queue);
+static void thread_set_affinity(std::thread *thread, unsigned cpu);
+
+//============================================================
+//  INLINE FUNCTIONS
+//============================================================
+
+// add to a statistic that only one thread writes
+template <typename T, typename U>
+static inline void add_to_stat(std::atomic<T> &stat, U value)
+{
+	stat.store(stat.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
 
 //============================================================
 //  osd_thread_adjust_priority
@@ -244,6 +266,27 @@ int thread_adjust_priority(std::thread *thread, int adjust)
 	return true;
 }
 
+//============================================================
+//  thread_set_affinity
+//============================================================
+
+static void thread_set_affinity(std::thread *thread, unsigned cpu)
+{
+#if defined(OSD_WINDOWS) || defined(SDLMAME_WIN32)
+	if (cpu < (sizeof(DWORD_PTR) * 8))
+		SetThreadAffinityMask((HANDLE)thread->native_handle(), DWORD_PTR(1) << cpu);
+#elif defined(SDLMAME_LINUX) && defined(CPU_SET)
+	cpu_set_t cpus;
+	CPU_ZERO(&cpus);
+	CPU_SET(cpu, &cpus);
+	pthread_setaffinity_np(thread->native_handle(), sizeof(cpus), &cpus);
+#else
+	// no portable way to pin threads here; the scheduler decides
+	(void)thread;
+	(void)cpu;
+#endif
+}
+
 //============================================================
 //  osd_work_queue_alloc
 //============================================================
@@ -256,12 +299,12 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	int osdthreadnum = 0;
 	int allocthreadnum;
 	const char *osdworkqueuemaxthreads = osd_getenv(ENV_WORKQUEUEMAXTHREADS);
+	const char *osdworkqueueaffinity = osd_getenv(ENV_WORKQUEUEAFFINITY);
 
 	// allocate a new queue
 	queue = new osd_work_queue();
 
 	// initialize basic queue members
-	queue->tailptr = (osd_work_item **)&queue->list;
 	queue->flags = flags;
 
 	// determine how many threads to create...
@@ -280,8 +323,13 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	threadnum = 0;
 #endif
 
-	// clamp to the maximum
-	queue->threads = std::min(threadnum, WORK_MAX_THREADS);
+	// clamp to the maximum; batch queues may scale further, leaving a threadid for the caller of a multi queue
+	if (!(flags & WORK_QUEUE_FLAG_BATCH))
+		queue->threads = std::min(threadnum, WORK_DEFAULT_MAX_THREADS);
+	else if (flags & WORK_QUEUE_FLAG_MULTI)
+		queue->threads = std::min(threadnum, WORK_MAX_THREADS - 1);
+	else
+		queue->threads = std::min(threadnum, WORK_MAX_THREADS);
 
 	// allocate memory for thread array (+1 to count the calling thread if WORK_QUEUE_FLAG_MULTI)
 	if (flags & WORK_QUEUE_FLAG_MULTI)
@@ -289,13 +337,14 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	else
 		allocthreadnum = std::max(queue->threads, 1u);
 
-#if KEEP_STATISTICS
-	printf("osdprocs: %d effecprocs: %d threads: %d allocthreads: %d osdthreads: %d maxthreads: %d queuethreads: %d\n", osd_num_processors, numprocs, threadnum, allocthreadnum, osdthreadnum, WORK_MAX_THREADS, queue->threads);
-#endif
-
 	for (threadnum = 0; threadnum < allocthreadnum; threadnum++)
 		queue->thread.push_back(new work_thread_info(threadnum, *queue));
 
+	// pin the threads of multi queues to CPUs if asked to, starting after the first so the
+	// calling thread keeps one; consecutive CPUs tend to share caches and a NUMA node
+	unsigned const cpus = std::max(std::thread::hardware_concurrency(), 1U);
+	bool const pin = (flags & WORK_QUEUE_FLAG_MULTI) && (osdworkqueueaffinity != nullptr) && atoi(osdworkqueueaffinity) && (cpus > 1);
+
 	// iterate over threads
 	for (threadnum = 0; threadnum < queue->threads; threadnum++)
 	{
@@ -312,12 +361,9 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 			thread_adjust_priority(thread->handle, 1);
 		else
 			thread_adjust_priority(thread->handle, 0);
-	}
 
-	// start a timer going for "waittime" on the main thread
-	if (flags & WORK_QUEUE_FLAG_MULTI)
-	{
-		begin_timing(queue->thread[queue->threads]->waittime);
+		if (pin)
+			thread_set_affinity(thread->handle, 1 + (threadnum % (cpus - 1)));
 	}
 	return queue;
 
@@ -357,8 +403,6 @@ bool osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout)
 	{
 		work_thread_info *thread = queue->thread[queue->threads];
 
-		end_timing(thread->waittime);
-
 		// process what we can as a worker thread
 		worker_thread_process(queue, thread);
 
@@ -366,14 +410,12 @@ bool osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout)
 		if (queue->flags & WORK_QUEUE_FLAG_HIGH_FREQ && queue->items != 0)
 		{
 			// spin until we're done
-			begin_timing(thread->spintime);
+			osd_ticks_t const start = osd_ticks();
 			spin_while_not<std::atomic<int>,int>(&queue->items, 0, timeout);
-			end_timing(thread->spintime);
+			add_to_stat(thread->spintime, osd_ticks() - start);
 
-			begin_timing(thread->waittime);
 			return (queue->items == 0);
 		}
-		begin_timing(thread->waittime);
 	}
 
 	// reset our done event and double-check the items before waiting
@@ -389,17 +431,37 @@ bool osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout)
 
 
 //============================================================
-//  osd_work_queue_free
+//  osd_work_queue_get_stats
 //============================================================
 
-void osd_work_queue_free(osd_work_queue *queue)
+void osd_work_queue_get_stats(osd_work_queue *queue, osd_work_queue_stats &stats)
 {
-	// stop the timer for "waittime" on the main thread
-	if (queue->flags & WORK_QUEUE_FLAG_MULTI)
+	stats.threads = queue->threads;
+	stats.items = queue->itemsqueued.load(std::memory_order_relaxed);
+	stats.steals = 0;
+	stats.latency = 0;
+	stats.latency_max = 0;
+	stats.run = 0;
+	stats.spin = 0;
+	stats.idle = 0;
+	for (work_thread_info const *thread : queue->thread)
 	{
-		end_timing(queue->thread[queue->threads]->waittime);
+		stats.steals += thread->steals.load(std::memory_order_relaxed);
+		stats.latency += thread->latency.load(std::memory_order_relaxed);
+		stats.latency_max = std::max(stats.latency_max, thread->latencymax.load(std::memory_order_relaxed));
+		stats.run += thread->runtime.load(std::memory_order_relaxed);
+		stats.spin += thread->spintime.load(std::memory_order_relaxed);
+		stats.idle += thread->idletime.load(std::memory_order_relaxed);
 	}
+}
 
+
+//============================================================
+//  osd_work_queue_free
+//============================================================
+
+void osd_work_queue_free(osd_work_queue *queue)
+{
 	// signal all the threads to exit
 	queue->exiting = true;
 	for (int threadnum = 0; threadnum < queue->threads; threadnum++)
@@ -422,24 +484,40 @@ void osd_work_queue_free(osd_work_queue *queue)
 
 	}
 
-#if KEEP_STATISTICS
-	// output per-thread statistics
-	for (work_thread_info *thread : queue->thread)
+	// output per-thread statistics if asked to
+	const char *osdworkqueuestats = osd_getenv(ENV_WORKQUEUESTATS);
+	if (osdworkqueuestats != nullptr && atoi(osdworkqueuestats) && queue->itemsqueued)
 	{
-		osd_ticks_t total = thread->runtime + thread->waittime + thread->spintime;
-		printf("Thread %d:  items=%9d run=%5.2f%% (%5.2f%%)  spin=%5.2f%%  wait/other=%5.2f%% total=%9d\n",
-				thread->id, thread->itemsdone,
-				(double)thread->runtime * 100.0 / (double)total,
-				(double)thread->actruntime * 100.0 / (double)total,
-				(double)thread->spintime * 100.0 / (double)total,
-				(double)thread->waittime * 100.0 / (double)total,
-				(uint32_t) total);
+		double const ms = 1000.0 / double(osd_ticks_per_second());
+		osd_work_queue_stats stats;
+		osd_work_queue_get_stats(queue, stats);
+		printf("Work queue flags=%x threads=%u items=%llu steals=%llu latency avg=%.3fms max=%.3fms\n",
+				queue->flags, stats.threads,
+				(unsigned long long)stats.items, (unsigned long long)stats.steals,
+				double(stats.latency) * ms / double(stats.items), double(stats.latency_max) * ms);
+		for (work_thread_info *thread : queue->thread)
+		{
+			printf("Thread %d:  items=%9llu steals=%9llu run=%10.3fms spin=%10.3fms idle=%10.3fms\n",
+					thread->id,
+					(unsigned long long)thread->itemsdone.load(), (unsigned long long)thread->steals.load(),
+					double(thread->runtime.load()) * ms,
+					double(thread->spintime.load()) * ms,
+					double(thread->idletime.load()) * ms);
+		}
 	}
-#endif
 
-	// free the list
-	for (auto & th : queue->thread)
-		delete th;
+	// free all items left in the threads' lists
+	for (work_thread_info *thread : queue->thread)
+	{
+		while (thread->head != nullptr)
+		{
+			osd_work_item *item = thread->head;
+			thread->head = item->next;
+			delete item->event;
+			delete item;
+		}
+		delete thread;
+	}
 	queue->thread.clear();
 
 	// free all items in the free list
@@ -451,22 +529,6 @@ void osd_work_queue_free(osd_work_queue *queue)
 		delete item;
 	}
 
-	// free all items in the active list
-	while (queue->list.load() != nullptr)
-	{
-		auto *item = (osd_work_item *)queue->list;
-		queue->list = item->next;
-		delete item->event;
-		delete item;
-	}
-
-#if KEEP_STATISTICS
-	printf("Items queued   = %9d\n", queue->itemsqueued.load());
-	printf("SetEvent calls = %9d\n", queue->setevents.load());
-	printf("Extra items    = %9d\n", queue->extraitems.load());
-	printf("Spin loops     = %9d\n", queue->spinloops.load());
-#endif
-
 	// free the queue itself
 	delete queue;
 }
@@ -480,6 +542,7 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 {
 	osd_work_item *itemlist = nullptr, *lastitem = nullptr;
 	osd_work_item **item_tailptr = &itemlist;
+	osd_ticks_t const now = osd_ticks();
 	int itemnum;
 
 	// loop over items, building up a local list of work
@@ -515,6 +578,7 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 		item->param = parambase;
 		item->result = nullptr;
 		item->flags = flags;
+		item->queued = now;
 
 		// advance to the next
 		lastitem = item;
@@ -523,46 +587,59 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 		parambase = (uint8_t *)parambase + paramstep;
 	}
 
-	// enqueue the whole thing within the critical section
-	{
-		std::lock_guard<std::mutex> lock(queue->lock);
-		*queue->tailptr = itemlist;
-		queue->tailptr = item_tailptr;
-	}
-
-	// increment the number of items in the queue
+	// count the items before anyone can run them
 	queue->items += numitems;
-	add_to_stat(queue->itemsqueued, numitems);
+	queue->pending += numitems;
+	queue->itemsqueued += numitems;
 
-	// look for free threads to do the work
-	if (queue->livethreads < queue->threads)
+	// if no threads, run the queue now on this thread
+	if (queue->threads == 0)
 	{
-		int threadnum;
-
-		// iterate over all the threads
-		for (threadnum = 0; threadnum < queue->threads; threadnum++)
+		work_thread_info *thread = queue->thread[0];
 		{
-			work_thread_info *thread = queue->thread[threadnum];
-
-			// Attempt to wake the thread
-			if (thread->wakeevent.set())
+			std::lock_guard<std::mutex> lock(thread->lock);
+			if (thread->tail != nullptr)
+				thread->tail->next = itemlist;
+			else
+				thread->head = itemlist;
+			thread->tail = lastitem;
+			thread->count += numitems;
+		}
+		worker_thread_process(queue, thread);
+	}
+	else
+	{
+		// deal the items out in runs to as many threads as there are items, starting after
+		// whichever thread got the last batch; idle threads will steal from busy ones
+		uint32_t const targets = std::min<uint32_t>(numitems, queue->threads);
+		uint32_t const first = queue->nextthread.fetch_add(targets, std::memory_order_relaxed);
+		osd_work_item *item = itemlist;
+		for (uint32_t target = 0; target < targets; target++)
+		{
+			int32_t const run = (numitems / targets) + ((target < (numitems % targets)) ? 1 : 0);
+			osd_work_item *const runhead = item;
+			osd_work_item *runtail = item;
+			for (int32_t index = 1; index < run; index++)
+				runtail = runtail->next;
+			item = runtail->next;
+			runtail->next = nullptr;
+
+			work_thread_info *thread = queue->thread[(first + target) % queue->threads];
 			{
-				add_to_stat(queue->setevents, 1);
-
-				// for non-shared, the first one we find is good enough
-				if (--numitems == 0)
-					break;
+				std::lock_guard<std::mutex> lock(thread->lock);
+				if (thread->tail != nullptr)
+					thread->tail->next = runhead;
+				else
+					thread->head = runhead;
+				thread->tail = runtail;
+				thread->count += run;
 			}
+
+			// wake the thread if it's parked
+			thread->wakeevent.set();
 		}
 	}
 
-	// if no threads, run the queue now on this thread
-	if (queue->threads == 0)
-	{
-		end_timing(queue->thread[0]->waittime);
-		worker_thread_process(queue, queue->thread[0]);
-		begin_timing(queue->thread[0]->waittime);
-	}
 	// only return the item if it won't get released automatically
 	return (flags & WORK_ITEM_FLAG_AUTO_RELEASE) ? nullptr : lastitem;
 }
@@ -590,7 +667,6 @@ bool osd_work_item_wait(osd_work_item *item, osd_ticks_t timeout)
 	// if we don't have an event, we need to spin (shouldn't ever really happen)
 	if (item->event == nullptr)
 	{
-		// TODO: do we need to measure the spin time here as well? and how can we do it?
 		spin_while<std::atomic<int>,int>(&item->done, 0, timeout);
 	}
 
@@ -682,9 +758,9 @@ static void *worker_thread_entry(void *param)
 
 		if (!queue_has_list_items(&queue))
 		{
-			begin_timing(thread->waittime);
+			osd_ticks_t const start = osd_ticks();
 			thread->wakeevent.wait( OSD_EVENT_WAIT_INFINITE);
-			end_timing(thread->waittime);
+			add_to_stat(thread->idletime, osd_ticks() - start);
 		}
 
 		if (queue.exiting)
@@ -699,19 +775,30 @@ static void *worker_thread_entry(void *param)
 			// process as much as we can
 			worker_thread_process(&queue, thread);
 
-			// if we're a high frequency queue, spin for a while before giving up
-			if (queue.flags & WORK_QUEUE_FLAG_HIGH_FREQ && queue.list.load() == nullptr)
+			// if we're a high frequency queue, spin for a while before giving up; the time
+			// grows while spinning finds more work, and shrinks while it doesn't
+			if (queue.flags & WORK_QUEUE_FLAG_HIGH_FREQ && !queue_has_list_items(&queue))
 			{
-				// spin for a while looking for more work
-				begin_timing(thread->spintime);
-				spin_while<std::atomic<osd_work_item *>, osd_work_item *>(&queue.list, (osd_work_item *)nullptr, SPIN_LOOP_TIME);
-				end_timing(thread->spintime);
+				osd_ticks_t const start = osd_ticks();
+				osd_ticks_t const stopspin = start + thread->spinbudget;
+				osd_ticks_t now = start;
+				while (!queue_has_list_items(&queue) && !queue.exiting && (now < stopspin))
+				{
+					for (int spin = 0; spin < 64; spin++)
+						spin_pause();
+					now = osd_ticks();
+				}
+				add_to_stat(thread->spintime, now - start);
+
+				if (queue_has_list_items(&queue))
+					thread->spinbudget = std::min<osd_ticks_t>(thread->spinbudget * 2, SPIN_LOOP_TIME);
+				else
+					thread->spinbudget = std::max<osd_ticks_t>(thread->spinbudget / 2, MIN_SPIN_LOOP_TIME);
 			}
 
 			// if nothing more, release the processor
 			if (!queue_has_list_items(&queue))
 				break;
-			add_to_stat(queue.spinloops, 1);
 		}
 
 		// decrement the live thread count
@@ -724,94 +811,152 @@ static void *worker_thread_entry(void *param)
 
 
 //============================================================
-//  worker_thread_process
+//  take_own_item - take the next item from a
+//  thread's own list
 //============================================================
 
-static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread)
+static osd_work_item *take_own_item(work_thread_info *thread)
 {
-	int threadid = thread->id;
+	if (thread->count.load(std::memory_order_relaxed) == 0)
+		return nullptr;
 
-	begin_timing(thread->runtime);
-
-	// loop until everything is processed
-	while (true)
+	std::lock_guard<std::mutex> lock(thread->lock);
+	osd_work_item *item = thread->head;
+	if (item != nullptr)
 	{
-		osd_work_item *item = nullptr;
+		thread->head = item->next;
+		if (thread->head == nullptr)
+			thread->tail = nullptr;
+		--thread->count;
+	}
+	return item;
+}
 
-		bool end_loop = false;
 
-		// use a critical section to synchronize the removal of items
-		{
-			std::lock_guard<std::mutex> lock(queue->lock);
+//============================================================
+//  steal_items - take half of the items from the
+//  busiest other thread, run the first and keep
+//  the rest
+//============================================================
 
-			if (queue->list.load() == nullptr)
-			{
-				end_loop = true;
-			}
-			else
+static osd_work_item *steal_items(osd_work_queue *queue, work_thread_info *thread)
+{
+	while (queue->pending.load(std::memory_order_relaxed) > 0)
+	{
+		// find the thread with the most items waiting
+		work_thread_info *victim = nullptr;
+		int32_t most = 0;
+		for (work_thread_info *other : queue->thread)
+		{
+			int32_t const count = other->count.load(std::memory_order_relaxed);
+			if ((other != thread) && (count > most))
 			{
-				// pull the item from the queue
-				item = (osd_work_item *)queue->list;
-				if (item != nullptr)
-				{
-					queue->list = item->next;
-					if (queue->list.load() == nullptr)
-						queue->tailptr = (osd_work_item **)&queue->list;
-				}
+				victim = other;
+				most = count;
 			}
 		}
+		if (victim == nullptr)
+			return nullptr;
 
-		if (end_loop)
-			break;
+		// take the first half of its list
+		osd_work_item *stolen;
+		int32_t taken = 0;
+		{
+			std::lock_guard<std::mutex> lock(victim->lock);
+			int32_t const count = victim->count.load(std::memory_order_relaxed);
+			if (count == 0)
+				continue;
+			stolen = victim->head;
+			osd_work_item *last = stolen;
+			for (taken = 1; taken < ((count + 1) / 2); taken++)
+				last = last->next;
+			victim->head = last->next;
+			if (victim->head == nullptr)
+				victim->tail = nullptr;
+			victim->count -= taken;
+			last->next = nullptr;
+		}
+		add_to_stat(thread->steals, taken);
 
-		// process non-NULL items
-		if (item != nullptr)
+		// keep all but the first for later, where others can steal them in turn
+		if (taken > 1)
 		{
-			// call the callback and stash the result
-			begin_timing(thread->actruntime);
-			item->result = (*item->callback)(item->param, threadid);
-			end_timing(thread->actruntime);
+			std::lock_guard<std::mutex> lock(thread->lock);
+			osd_work_item *rest = stolen->next;
+			osd_work_item *last = rest;
+			while (last->next != nullptr)
+				last = last->next;
+			if (thread->tail != nullptr)
+				thread->tail->next = rest;
+			else
+				thread->head = rest;
+			thread->tail = last;
+			thread->count += taken - 1;
+		}
+		stolen->next = nullptr;
+		return stolen;
+	}
+	return nullptr;
+}
 
-			// decrement the item count after we are done
-			--queue->items;
-			item->done = true;
-			add_to_stat(thread->itemsdone, 1);
 
-			// if it's an auto-release item, release it
-			if (item->flags & WORK_ITEM_FLAG_AUTO_RELEASE)
-				osd_work_item_release(item);
+//============================================================
+//  worker_thread_process
+//============================================================
 
-			// set the result and signal the event
-			else
-			{
-				std::lock_guard<std::mutex> lock(queue->lock);
+static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread)
+{
+	int threadid = thread->id;
 
-				if (item->event != nullptr)
-				{
-					item->event->set();
-					add_to_stat(item->queue.setevents, 1);
-				}
-			}
+	// loop until everything is processed
+	while (true)
+	{
+		// our own items first, then other threads'
+		osd_work_item *item = take_own_item(thread);
+		if (item == nullptr)
+			item = steal_items(queue, thread);
+		if (item == nullptr)
+			break;
+		--queue->pending;
+
+		// keep track of how long it waited to start
+		osd_ticks_t const start = osd_ticks();
+		osd_ticks_t const latency = start - item->queued;
+		add_to_stat(thread->latency, latency);
+		if (latency > thread->latencymax.load(std::memory_order_relaxed))
+			thread->latencymax.store(latency, std::memory_order_relaxed);
+
+		// call the callback and stash the result
+		item->result = (*item->callback)(item->param, threadid);
+		add_to_stat(thread->runtime, osd_ticks() - start);
+		add_to_stat(thread->itemsdone, 1);
+
+		// decrement the item count after we are done; once it's marked done the queuer
+		// may release it and queue it again, so check the flags first
+		bool const autorelease = item->flags & WORK_ITEM_FLAG_AUTO_RELEASE;
+		--queue->items;
+		item->done = true;
+
+		// if it's an auto-release item, release it
+		if (autorelease)
+			osd_work_item_release(item);
+
+		// set the result and signal the event
+		else
+		{
+			std::lock_guard<std::mutex> lock(queue->lock);
 
-			// if we removed an item and there's still work to do, bump the stats
-			if (queue_has_list_items(queue))
-				add_to_stat(queue->extraitems, 1);
+			if (item->event != nullptr)
+				item->event->set();
 		}
 	}
 
 	// we don't need to set the doneevent for multi queues because they spin
 	if (queue->waiting)
-	{
 		queue->doneevent.set();
-		add_to_stat(queue->setevents, 1);
-	}
-
-	end_timing(thread->runtime);
 }
 
 bool queue_has_list_items(osd_work_queue *queue)
 {
-	std::lock_guard<std::mutex> lock(queue->lock);
-	bool has_list_items = (queue->list.load() != nullptr);
-	return has_list_items;
+	return queue->pending.load(std::memory_order_acquire) > 0;
 }
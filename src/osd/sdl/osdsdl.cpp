@@ -686,7 +686,10 @@ void sdl_osd_interface::check_osd_inputs()
 	{
 		// destroy the renderers first so that the render module can bounce if it depends on having a window handle
 		for (auto it = osd_common_t::window_list().rbegin(); osd_common_t::window_list().rend() != it; ++it)
+		{
+			dynamic_cast<sdl_window_info &>(**it).wait_for_render();
 			(*it)->renderer_reset();
+		}
 		for (auto const &curwin : osd_common_t::window_list())
 			dynamic_cast<sdl_window_info &>(*curwin).toggle_full_screen();
 	}
@@ -46,6 +46,7 @@ const options_entry f_sdl_option_entries[] =
 	// performance options
 	{ nullptr,                               nullptr,        core_options::option_type::HEADER,     "SDL PERFORMANCE OPTIONS" },
 	{ SDLOPTION_SDLVIDEOFPS,                 "0",            core_options::option_type::BOOLEAN,    "show sdl video performance" },
+	{ SDLOPTION_RENDERTHREAD,                "0",            core_options::option_type::BOOLEAN,    "draw on a separate thread so GPU and vsync waits don't stall emulation (-video opengl only)" },
 	// video options
 	{ nullptr,                               nullptr,        core_options::option_type::HEADER,     "SDL VIDEO OPTIONS" },
 // OS X can be trusted to have working hardware OpenGL, so default to it on for the best user experience
@@ -127,15 +127,26 @@ void sdl_osd_interface::extract_video_config()
 	video_config.restrictonemonitor = !options().use_all_heads();
 	#endif
 
-	// if we are in debug mode, never go full screen
+	// if we are in debug mode, never go full screen, and keep drawing on the main thread
+	video_config.renderthread = options().render_thread();
 	if (machine().debug_flags & DEBUG_FLAG_OSD_ENABLED)
+	{
 		video_config.windowed = true;
+		video_config.renderthread = false;
+	}
 
 	video_config.switchres     = options().switch_res();
 	video_config.centerh       = options().centerh();
 	video_config.centerv       = options().centerv();
 	video_config.waitvsync     = options().wait_vsync();
 	video_config.syncrefresh   = options().sync_refresh();
+	video_config.vrr           = options().vrr();
+	if (video_config.vrr)
+	{
+		// the display follows our presentation, so wait for vsync to avoid tearing and throttle to the game time
+		video_config.waitvsync = 1;
+		video_config.syncrefresh = 0;
+	}
 	if (!video_config.waitvsync && video_config.syncrefresh)
 	{
 		osd_printf_warning("-syncrefresh specified without -waitvsync. Reverting to -nosyncrefresh\n");
@@ -207,6 +207,7 @@ void sdl_window_info::resize(int32_t width, int32_t height)
 
 	if (width != cd.width() || height != cd.height())
 	{
+		wait_for_render();
 		SDL_SetWindowSize(platform_window(), width, height);
 		renderer().notify_changed();
 	}
@@ -219,10 +220,24 @@ void sdl_window_info::resize(int32_t width, int32_t height)
 
 void sdl_window_info::notify_changed()
 {
+	wait_for_render();
 	renderer().notify_changed();
 }
 
 
+//============================================================
+//  wait_for_render - wait for the render thread
+//  to finish with the current primitive list
+//  (main thread)
+//============================================================
+
+void sdl_window_info::wait_for_render()
+{
+	if (m_render_queue)
+		osd_work_queue_wait(m_render_queue, osd_ticks_per_second() * 10);
+}
+
+
 //============================================================
 //  sdlwindow_toggle_full_screen
 //============================================================
@@ -240,6 +255,7 @@ void sdl_window_info::toggle_full_screen()
 	}
 
 	// kill off the drawers
+	wait_for_render();
 	renderer_reset();
 	bool is_osx = false;
 #ifdef SDLMAME_MACOSX
@@ -347,6 +363,9 @@ int sdl_window_info::window_init()
 
 	create_target();
 
+	if (video_config.renderthread)
+		m_render_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+
 	int result = complete_create();
 
 	// handle error conditions
@@ -367,6 +386,9 @@ error:
 
 void sdl_window_info::complete_destroy()
 {
+	// make sure the render thread is done with the window
+	wait_for_render();
+
 	// Release pointer grab and hide if needed
 	show_pointer();
 	release_pointer();
@@ -499,8 +521,6 @@ void sdl_window_info::update()
 
 		if (m_rendered_event.wait(event_wait_ticks))
 		{
-			const int update = 1;
-
 			// ensure the target bounds are up-to-date, and then get the primitives
 
 			render_primitive_list &primlist = *renderer().get_primitives();
@@ -519,26 +539,50 @@ void sdl_window_info::update()
 
 			m_primlist = &primlist;
 
-			if (m_primlist == nullptr)
-			{
-				// if no bitmap, just fill
-			}
+			// the primitive list is a snapshot, so the render thread can draw it
+			// while emulation carries on with the next frame
+			if (m_render_queue && renderer().threaded_draw())
+				osd_work_item_queue(m_render_queue, &sdl_window_info::draw_primitives_wt, this, WORK_ITEM_FLAG_AUTO_RELEASE);
 			else
-			{
-				// otherwise, render with our drawing system
-				if (video_config.perftest)
-					measure_fps(update);
-				else
-					renderer().draw(update);
-			}
-
-			// all done, ready for next
-			m_rendered_event.set();
+				draw_primitives();
 		}
 	}
 }
 
 
+//============================================================
+//  draw_primitives
+//  (main or render thread)
+//============================================================
+
+void sdl_window_info::draw_primitives()
+{
+	const int update = 1;
+
+	if (m_primlist == nullptr)
+	{
+		// if no bitmap, just fill
+	}
+	else
+	{
+		// otherwise, render with our drawing system
+		if (video_config.perftest)
+			measure_fps(update);
+		else
+			renderer().draw(update);
+	}
+
+	// all done, ready for next
+	m_rendered_event.set();
+}
+
+OSDWORK_CALLBACK(sdl_window_info::draw_primitives_wt)
+{
+	reinterpret_cast<sdl_window_info *>(param)->draw_primitives();
+	return nullptr;
+}
+
+
 //============================================================
 //  complete_create
 //============================================================
@@ -1037,6 +1081,7 @@ sdl_window_info::sdl_window_info(
 	, m_minimum_dim(0, 0)
 	, m_windowed_dim(0, 0)
 	, m_rendered_event(0, 1)
+	, m_render_queue(nullptr)
 	, m_extra_flags(0)
 	, m_mouse_captured(false)
 	, m_mouse_hidden(false)
@@ -1051,6 +1096,8 @@ sdl_window_info::sdl_window_info(
 
 sdl_window_info::~sdl_window_info()
 {
+	if (m_render_queue)
+		osd_work_queue_free(m_render_queue);
 }
 
 
@@ -65,6 +65,8 @@ public:
 
 	int xy_to_render_target(int x, int y, int *xt, int *yt);
 
+	void wait_for_render();
+
 private:
 	// window handle and info
 	int                 m_startmaximized;
@@ -75,6 +77,7 @@ private:
 
 	// rendering info
 	osd_event           m_rendered_event;
+	osd_work_queue *    m_render_queue;     // draws on a separate thread, with -renderthread
 
 	// Original display_mode
 	std::unique_ptr<SDL_DM_Wrapper> m_original_mode;
@@ -99,7 +102,9 @@ private:
 	bool                               m_mouse_hidden;
 
 	void measure_fps(int update);
+	void draw_primitives();
 
+	static OSDWORK_CALLBACK(draw_primitives_wt);
 };
 
 #endif // MAME_OSD_SDL_WINDOW_H
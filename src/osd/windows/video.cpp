@@ -171,6 +171,13 @@ void windows_osd_interface::extract_video_config()
 
 	video_config.waitvsync     = options().wait_vsync();
 	video_config.syncrefresh   = options().sync_refresh();
+	video_config.vrr           = options().vrr();
+	if (video_config.vrr)
+	{
+		// the display follows our presentation, so wait for vsync to avoid tearing and throttle to the game time
+		video_config.waitvsync = 1;
+		video_config.syncrefresh = 0;
+	}
 	video_config.triplebuf     = options().triple_buffer();
 	video_config.switchres     = options().switch_res();
 
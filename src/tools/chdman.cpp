@@ -23,6 +23,7 @@
 
 #include <cassert>
 #include <cctype>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -33,6 +34,7 @@
 #include <optional>
 #include <new>
 #include <string_view>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -646,7 +648,7 @@ static const option_description s_options[] =
 	{ OPTION_INDEX,                 "ix",   true, " <index>: indexed instance of this metadata tag" },
 	{ OPTION_VALUE_TEXT,            "vt",   true, " <text>: text for the metadata" },
 	{ OPTION_VALUE_FILE,            "vf",   true, " <file>: file containing data to add" },
-	{ OPTION_NUMPROCESSORS,         "np",   true, " <processors>: limit the number of processors to use during compression" },
+	{ OPTION_NUMPROCESSORS,         "np",   true, " <processors>: limit the number of processors to use during compression or decompression" },
 	{ OPTION_NO_CHECKSUM,           "nocs", false, ": do not include this metadata information in the overall SHA-1" },
 	{ OPTION_FIX,                   "f",    false, ": fix the SHA-1 if it is incorrect" },
 	{ OPTION_VERBOSE,               "v",    false, ": output additional information" },
@@ -669,7 +671,8 @@ static const command_description s_commands[] =
 		{
 			REQUIRED OPTION_INPUT,
 			OPTION_INPUT_PARENT,
-			OPTION_FIX
+			OPTION_FIX,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -761,7 +764,8 @@ static const command_description s_commands[] =
 			OPTION_INPUT_START_BYTE,
 			OPTION_INPUT_START_HUNK,
 			OPTION_INPUT_LENGTH_BYTES,
-			OPTION_INPUT_LENGTH_HUNKS
+			OPTION_INPUT_LENGTH_HUNKS,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -774,7 +778,8 @@ static const command_description s_commands[] =
 			OPTION_INPUT_START_BYTE,
 			OPTION_INPUT_START_HUNK,
 			OPTION_INPUT_LENGTH_BYTES,
-			OPTION_INPUT_LENGTH_HUNKS
+			OPTION_INPUT_LENGTH_HUNKS,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -785,6 +790,7 @@ static const command_description s_commands[] =
 			OPTION_OUTPUT_FORCE,
 			REQUIRED OPTION_INPUT,
 			OPTION_INPUT_PARENT,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -797,7 +803,8 @@ static const command_description s_commands[] =
 			OPTION_INPUT_START_BYTE,
 			OPTION_INPUT_START_HUNK,
 			OPTION_INPUT_LENGTH_BYTES,
-			OPTION_INPUT_LENGTH_HUNKS
+			OPTION_INPUT_LENGTH_HUNKS,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -1357,6 +1364,37 @@ static void parse_numprocessors(const parameters_map &params)
 }
 
 
+//-------------------------------------------------
+//  start_readahead - decompress enough hunks of
+//  an input CHD ahead of sequential reads to keep
+//  every processor busy
+//-------------------------------------------------
+
+static void start_readahead(chd_file &input_chd)
+{
+	// nothing to do if the CHD can't be read ahead
+	if (!input_chd.readahead())
+		return;
+
+	extern int osd_num_processors;
+	uint32_t const processors = (osd_num_processors > 0) ? osd_num_processors : std::max(1U, std::thread::hardware_concurrency());
+	input_chd.set_readahead(std::clamp<uint32_t>(2 * processors, chd_file::READAHEAD_HUNKS, 64));
+}
+
+
+//-------------------------------------------------
+//  report_throughput - print how fast data was
+//  read from a CHD
+//-------------------------------------------------
+
+static void report_throughput(uint64_t bytes, std::chrono::steady_clock::time_point start)
+{
+	double const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	if (seconds > 0.0)
+		util::stream_format(std::cout, "Throughput:   %.1f MB/s (%s bytes in %.1f seconds)\n", double(bytes) / (1024.0 * 1024.0) / seconds, big_int_string(bytes), seconds);
+}
+
+
 //-------------------------------------------------
 //  compression_string - create a friendly string
 //  describing a set of compressors
@@ -1637,6 +1675,8 @@ static void do_info(parameters_map &params)
 	util::stream_format(std::cout, "Total Units:  %s\n", big_int_string(input_chd.unit_count()));
 	util::stream_format(std::cout, "Compression:  %s\n", compression_string(compression));
 	util::stream_format(std::cout, "CHD size:     %s bytes\n", big_int_string(filesize));
+	if (input_chd.readahead())
+		util::stream_format(std::cout, "Read-ahead:   %u hunks\n", input_chd.readahead());
 	if (compression[0] != CHD_CODEC_NONE)
 		util::stream_format(std::cout, "Ratio:        %.1f%%\n", 100.0 * double(filesize) / double(input_chd.logical_bytes()));
 
@@ -1763,10 +1803,14 @@ static void do_info(parameters_map &params)
 
 static void do_verify(parameters_map &params)
 {
+	// process numprocessors before the input opens its work queue
+	parse_numprocessors(params);
+
 	// parse out input files
 	chd_file input_parent_chd;
 	chd_file input_chd;
 	parse_input_chd_parameters(params, input_chd, input_parent_chd);
+	start_readahead(input_chd);
 
 	// only makes sense for compressed CHDs with valid SHA-1's
 	if (!input_chd.compressed())
@@ -1779,6 +1823,7 @@ static void do_verify(parameters_map &params)
 	std::vector<uint8_t> buffer((TEMP_BUFFER_SIZE / input_chd.hunk_bytes()) * input_chd.hunk_bytes());
 
 	// read all the data and build up an SHA-1
+	auto const start_time = std::chrono::steady_clock::now();
 	util::sha1_creator rawsha1;
 	for (uint64_t offset = 0; offset < input_chd.logical_bytes(); )
 	{
@@ -1795,6 +1840,13 @@ static void do_verify(parameters_map &params)
 		offset += bytes_to_read;
 	}
 	util::sha1_t computed_sha1 = rawsha1.finish();
+	report_throughput(input_chd.logical_bytes(), start_time);
+	if (input_chd.readahead())
+	{
+		chd_file::readahead_stats const &stats = input_chd.readahead_statistics();
+		util::stream_format(std::cout, "Read-ahead: %s hunks read ahead, %s hits, %s misses\n",
+				big_int_string(stats.m_queued), big_int_string(stats.m_hits), big_int_string(stats.m_misses));
+	}
 
 	// finish up
 	if (raw_sha1 != computed_sha1)
@@ -2501,10 +2553,14 @@ static void do_copy(parameters_map &params)
 
 static void do_extract_raw(parameters_map &params)
 {
+	// process numprocessors before the input opens its work queue
+	parse_numprocessors(params);
+
 	// parse out input files
 	chd_file input_parent_chd;
 	chd_file input_chd;
 	parse_input_chd_parameters(params, input_chd, input_parent_chd);
+	start_readahead(input_chd);
 
 	// parse out input start/end
 	const auto [input_start, input_end] = parse_input_start_end(params, input_chd.logical_bytes(), input_chd.hunk_bytes(), input_chd.hunk_bytes());
@@ -2533,6 +2589,7 @@ static void do_extract_raw(parameters_map &params)
 			report_error(1, "Unable to open file (%s): %s", *output_file_str->second, filerr.message());
 
 		// copy all data
+		auto const start_time = std::chrono::steady_clock::now();
 		std::vector<uint8_t> buffer((TEMP_BUFFER_SIZE / input_chd.hunk_bytes()) * input_chd.hunk_bytes());
 		for (uint64_t offset = input_start; offset < input_end; )
 		{
@@ -2557,6 +2614,7 @@ static void do_extract_raw(parameters_map &params)
 		// finish up
 		output_file.reset();
 		util::stream_format(std::cout, "Extraction complete                                    \n");
+		report_throughput(input_end - input_start, start_time);
 	}
 	catch (...)
 	{
@@ -2578,10 +2636,14 @@ static void do_extract_raw(parameters_map &params)
 
 static void do_extract_cd(parameters_map &params)
 {
+	// process numprocessors before the input opens its work queue
+	parse_numprocessors(params);
+
 	// parse out input files
 	chd_file input_parent_chd;
 	chd_file input_chd;
 	parse_input_chd_parameters(params, input_chd, input_parent_chd);
+	start_readahead(input_chd);
 
 	// further process input file
 	cdrom_file *cdrom = new cdrom_file(&input_chd);
@@ -2643,6 +2705,7 @@ static void do_extract_cd(parameters_map &params)
 		}
 
 		// determine total frames
+		auto const start_time = std::chrono::steady_clock::now();
 		uint64_t total_bytes = 0;
 		for (int tracknum = 0; tracknum < toc.numtrks; tracknum++)
 			total_bytes += toc.tracks[tracknum].frames * (toc.tracks[tracknum].datasize + toc.tracks[tracknum].subsize);
@@ -2787,6 +2850,7 @@ static void do_extract_cd(parameters_map &params)
 		output_bin_file.reset();
 		output_toc_file.reset();
 		util::stream_format(std::cout, "Extraction complete                                    \n");
+		report_throughput(total_bytes, start_time);
 	}
 	catch (...)
 	{
@@ -2902,6 +2966,7 @@ static void do_extract_ld(parameters_map &params)
 		}
 
 		// iterate over frames
+		auto const start_time = std::chrono::steady_clock::now();
 		bitmap_yuy16 fullbitmap(width, height * interlace_factor);
 		for (uint64_t framenum = input_start; framenum < input_end; framenum++)
 		{
@@ -2940,6 +3005,7 @@ static void do_extract_ld(parameters_map &params)
 		// close and return
 		output_file.reset();
 		util::stream_format(std::cout, "Extraction complete                                    \n");
+		report_throughput((input_end - input_start) * input_chd.hunk_bytes(), start_time);
 	}
 	catch (...)
 	{
@@ -0,0 +1,177 @@
+#!/usr/bin/python
+##
+## license:BSD-3-Clause
+## copyright-holders:agent
+
+# Run a pinned list of systems with -bench and -benchreport several times
+# each and summarise the results as JSON, so that a speed change can be
+# put down to the CPU cores, video, sound, timers or DRC compilation
+#
+# Each line of the list names a system, optionally followed by settings:
+#
+#   # system     settings
+#   pacman       seconds=60 warmup=5
+#   sf2          seconds=30 warmup=10 state=bench playback=sf2.inp
+#   galaga       seconds=60 args="-cheat"
+#
+# seconds  emulated seconds measured (default 60)
+# warmup   emulated seconds run first and left out (default 5)
+# state    save state to start from (-state)
+# playback recorded input to play back (-playback)
+# args     further command line arguments
+#
+# Speed is emulated seconds per host second.  Timed runs don't enable the
+# profiler, as it slows emulation down and turns off some fast paths; with
+# --profile one more run per system is made with -benchprofile to get the
+# breakdown, which is reported as shares of the profiled time.
+# For Python 3
+
+import argparse
+import json
+import math
+import os
+import shlex
+import statistics
+import subprocess
+import sys
+import tempfile
+
+
+def parseList(filename):
+    entries = []
+    with open(filename, 'r') as f:
+        for number, line in enumerate(f, 1):
+            words = shlex.split(line, comments=True)
+            if not words:
+                continue
+            entry = { 'system': words[0], 'seconds': 60, 'warmup': 5, 'state': None, 'playback': None, 'args': [ ] }
+            for word in words[1:]:
+                key, sep, value = word.partition('=')
+                if not sep or (key not in entry) or (key == 'system'):
+                    raise ValueError('%s:%d: unknown setting %s' % (filename, number, word))
+                if key in ('seconds', 'warmup'):
+                    entry[key] = int(value)
+                elif key == 'args':
+                    entry[key] = shlex.split(value)
+                else:
+                    entry[key] = value
+            entries.append(entry)
+    return entries
+
+
+def runOnce(options, entry, profile):
+    handle, report = tempfile.mkstemp(suffix='.json', prefix='mamebench')
+    os.close(handle)
+    os.remove(report)
+    command = [
+            options.executable, entry['system'],
+            '-bench', str(entry['warmup'] + entry['seconds']),
+            '-benchwarmup', str(entry['warmup']),
+            '-benchreport', report,
+            '-nothrottle',
+            '-skip_gameinfo']
+    if profile:
+        command.append('-benchprofile')
+    if entry['state']:
+        command += ['-state', entry['state']]
+    if entry['playback']:
+        command += ['-playback', entry['playback']]
+    command += entry['args'] + options.extra
+    try:
+        result = subprocess.run(command, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, universal_newlines=True)
+        if not os.path.exists(report):
+            raise RuntimeError('%s exited with status %d and no report:\n%s' % (entry['system'], result.returncode, result.stderr.strip()))
+        with open(report, 'r') as f:
+            return json.load(f)
+    finally:
+        if os.path.exists(report):
+            os.remove(report)
+
+
+def summarise(values):
+    result = {
+            'mean': statistics.mean(values),
+            'median': statistics.median(values),
+            'min': min(values),
+            'max': max(values) }
+    if len(values) > 1:
+        result['stdev'] = statistics.stdev(values)
+        result['cv'] = (result['stdev'] / result['mean']) if result['mean'] else 0.0
+        # half width of an approximate 95% confidence interval for the mean
+        result['ci95'] = 1.96 * result['stdev'] / math.sqrt(len(values))
+    return result
+
+
+def benchmark(options, entry):
+    result = { 'system': entry['system'], 'seconds': entry['seconds'], 'warmup': entry['warmup'] }
+    if entry['state']:
+        result['state'] = entry['state']
+    if entry['playback']:
+        result['playback'] = entry['playback']
+
+    # untimed runs first, so the files are in the OS cache for the timed ones
+    for run in range(options.discard):
+        runOnce(options, entry, False)
+
+    reports = [runOnce(options, entry, False) for run in range(options.runs)]
+    speeds = [report['speed'] for report in reports]
+    result['speed'] = summarise(speeds)
+    result['runs'] = speeds
+    result['frames'] = reports[0]['frames']
+
+    if options.profile:
+        profiled = runOnce(options, entry, True)
+        if profiled.get('profiled'):
+            result['profiled_speed'] = profiled['speed']
+            for key in ('breakdown', 'devices', 'buckets'):
+                if key in profiled:
+                    result[key] = profiled[key]
+        else:
+            sys.stderr.write('%s: profiler not available in this build\n' % entry['system'])
+    return result
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Benchmark a pinned list of systems.')
+    parser.add_argument('executable', help='emulator to run')
+    parser.add_argument('list', help='file listing the systems and their settings')
+    parser.add_argument('-r', '--runs', type=int, default=5, help='timed runs per system (default 5)')
+    parser.add_argument('-d', '--discard', type=int, default=1, help='untimed runs per system before the timed ones (default 1)')
+    parser.add_argument('-p', '--profile', action='store_true', help='make a profiled run per system for the breakdown')
+    parser.add_argument('-o', '--output', help='file to write the JSON results to (default standard output)')
+    parser.epilog = 'Arguments after -- are passed to every run.'
+    args = sys.argv[1:]
+    extra = args.index('--') if '--' in args else len(args)
+    options = parser.parse_args(args[:extra])
+    options.extra = args[extra + 1:]
+    if options.runs < 1:
+        parser.error('at least one run is needed')
+
+    try:
+        entries = parseList(options.list)
+    except (OSError, ValueError) as e:
+        sys.stderr.write('%s: %s\n' % (sys.argv[0], e))
+        sys.exit(1)
+
+    results = []
+    failed = False
+    for entry in entries:
+        sys.stderr.write('%s...' % entry['system'])
+        sys.stderr.flush()
+        try:
+            result = benchmark(options, entry)
+        except (OSError, RuntimeError, ValueError, KeyError) as e:
+            sys.stderr.write(' failed\n%s\n' % e)
+            failed = True
+            continue
+        speed = result['speed']
+        sys.stderr.write(' %.2f%% (median %.2f%%, %d runs)\n' % (speed['mean'] * 100.0, speed['median'] * 100.0, len(result['runs'])))
+        results.append(result)
+
+    text = json.dumps({ 'executable': options.executable, 'runs': options.runs, 'systems': results }, indent=4)
+    if options.output:
+        with open(options.output, 'w') as f:
+            f.write(text + '\n')
+    else:
+        sys.stdout.write(text + '\n')
+    sys.exit(1 if failed else 0)
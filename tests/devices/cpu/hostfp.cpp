@@ -0,0 +1,116 @@
+#include "catch.hpp"
+
+#include "emucore.h"
+
+// SoftFloat 2 lacks an include guard
+#ifndef softfloat2_h
+#define softfloat2_h 1
+#include "softfloat/milieu.h"
+#include "softfloat/softfloat.h"
+#endif
+
+#include "cpu/hostfp.h"
+
+#include <cstring>
+
+
+namespace {
+
+struct value_generator
+{
+	u64 state;
+	u64 next() { state = state * 6364136223846793005U + 1442695040888963407U; return state ^ (state >> 29); }
+
+	// a double with a short or long significand and an exponent near the
+	// middle, near the limits of what the host path takes, or beyond them
+	floatx80 value()
+	{
+		u64 const r = next();
+		u64 mantissa = next() & 0x000fffffffffffffU;
+		if (r & 1)
+			mantissa &= 0x000fff0000000000U;
+		int exp;
+		switch ((r >> 1) & 3)
+		{
+		case 0:  exp = 1023 + int((r >> 8) % 64) - 32; break;
+		case 1:  exp = 1023 + int((r >> 8) % 300) - 150; break;
+		case 2:  exp = 1 + int((r >> 8) % 140); break;
+		default: exp = 2046 - int((r >> 8) % 8); break;
+		}
+		return float64_to_floatx80((r & 0x80000000U ? 0x8000000000000000U : 0) | (u64(exp) << 52) | mantissa);
+	}
+};
+
+using soft_function = float64 (*)(float64, float64);
+
+void check_op(host_fp::function host, soft_function soft, floatx80 a, floatx80 b, unsigned &taken)
+{
+	floatx80 result;
+	int8 flags;
+	if (!host(a, b, result, flags))
+		return;
+	++taken;
+
+	float_exception_flags = 0;
+	floatx80 const expected = float64_to_floatx80(soft(floatx80_to_float64(a), floatx80_to_float64(b)));
+	INFO("a " << std::hex << a.high << ':' << a.low << " b " << b.high << ':' << b.low);
+	CHECK(result.high == expected.high);
+	CHECK(result.low == expected.low);
+	CHECK(flags == float_exception_flags);
+}
+
+} // anonymous namespace
+
+
+TEST_CASE("Host double arithmetic matches SoftFloat", "[cpu][hostfp]")
+{
+	float_rounding_mode = float_round_nearest_even;
+
+	value_generator gen{ 1 };
+	unsigned taken[4] = { 0, 0, 0, 0 };
+	for (int i = 0; i < 200000; i++)
+	{
+		floatx80 const a = gen.value();
+		floatx80 b = gen.value();
+
+		// exact cases: equal magnitudes, and small integers
+		if (i % 7 == 0)
+			b = a;
+		if (i % 11 == 0)
+			b = int32_to_floatx80(int32(gen.next() % 1000) - 500);
+
+		check_op(host_fp::add, float64_add, a, b, taken[0]);
+		check_op(host_fp::sub, float64_sub, a, b, taken[1]);
+		check_op(host_fp::mul, float64_mul, a, b, taken[2]);
+		check_op(host_fp::div, float64_div, a, b, taken[3]);
+	}
+
+	// a good share of the generated pairs go through the host path
+	for (unsigned const count : taken)
+		CHECK(count > 50000U);
+}
+
+
+TEST_CASE("Host double arithmetic leaves edge cases to SoftFloat", "[cpu][hostfp]")
+{
+	floatx80 const one = int32_to_floatx80(1);
+	floatx80 const zero = int32_to_floatx80(0);
+	floatx80 const extended = { 0x3fff, 0xc000000000000001U };   // needs 64 bits of significand
+	floatx80 const tiny = float64_to_floatx80(0x0010000000000000U); // smallest normal double
+	floatx80 const huge = float64_to_floatx80(0x7fefffffffffffffU); // largest double
+	floatx80 const infinity = float64_to_floatx80(0x7ff0000000000000U);
+
+	floatx80 result;
+	int8 flags;
+	CHECK_FALSE(host_fp::add(one, extended, result, flags));
+	CHECK_FALSE(host_fp::mul(one, tiny, result, flags));
+	CHECK_FALSE(host_fp::add(huge, huge, result, flags));
+	CHECK_FALSE(host_fp::add(one, infinity, result, flags));
+	CHECK_FALSE(host_fp::div(one, zero, result, flags));
+
+	// exact cancellation gives positive zero
+	REQUIRE(host_fp::sub(one, one, result, flags));
+	CHECK(result.high == 0);
+	CHECK(result.low == 0);
+	CHECK(flags == 0);
+}
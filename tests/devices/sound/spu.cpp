@@ -0,0 +1,182 @@
+#include "catch.hpp"
+
+#include "sound/spukernel.h"
+
+#include <cstdint>
+#include <vector>
+
+
+namespace {
+
+// full-scale 16-bit noise, so the interpolation and reverb sums see
+// both extremes
+struct sample_generator
+{
+	uint32_t state;
+	uint32_t next() { state = state * 1664525U + 1013904223U; return state ^ (state >> 15); }
+	signed short sample() { return static_cast<signed short>(next() >> 16); }
+};
+
+// the stepping loop the voice generator used before the kernel
+std::vector<int> reference_interpolate(signed short const *sp, unsigned int count, unsigned int &dptr, unsigned int pitch, signed short const *&end)
+{
+	std::vector<int> result(count);
+	for (unsigned int i = 0; i < count; i++)
+	{
+		int v = sp[0];
+		v += ((sp[1] - v) * int(dptr)) >> 12;
+		result[i] = v;
+		dptr += pitch;
+		sp += dptr >> 12;
+		dptr &= 0xfff;
+	}
+	end = sp;
+	return result;
+}
+
+// the interleaved one-sample-at-a-time comb/allpass loop the reverb used
+// before the kernel
+struct reference_reverb
+{
+	static constexpr int MAX_DELAY = 1024;
+
+	std::vector<signed short> y[2][4], x[2], ax[2], ay[2];
+	int yp = 0;
+
+	reference_reverb()
+	{
+		for (int c = 0; c < 2; c++)
+		{
+			for (auto &f : y[c])
+				f.assign(MAX_DELAY, 0);
+			x[c].assign(MAX_DELAY, 0);
+			ax[c].assign(MAX_DELAY, 0);
+			ay[c].assign(MAX_DELAY, 0);
+		}
+	}
+
+	void process(signed short const *sp, signed short *dp, int const (&comb_delay)[2][4], int comb_gain, int allpass_delay, int allpass_gain, int const *rvol, unsigned int frames)
+	{
+		for (unsigned int i = 0; i < frames; i++, sp += 2, dp += 2)
+		{
+			for (int c = 0; c < 2; c++)
+			{
+				int v = 0;
+				for (int f = 0; f < 4; f++)
+				{
+					int const yck = (yp - comb_delay[c][f]) & (MAX_DELAY - 1);
+					y[c][f][yp] = spu_clamp(x[c][yck] + ((comb_gain * y[c][f][yck]) >> 15));
+					v += y[c][f][yp];
+				}
+				v >>= 2;
+
+				if (allpass_delay)
+				{
+					ax[c][yp] = v;
+					int const ypa = (yp - allpass_delay) & (MAX_DELAY - 1);
+					v = spu_clamp(((allpass_gain * (ay[c][ypa] - x[c][yp])) >> 15) + ax[c][ypa]);
+					ay[c][yp] = v;
+				}
+
+				dp[c] = spu_clamp(((v * rvol[c]) >> 15) + dp[c] + sp[c]);
+			}
+			yp = (yp + 1) & (MAX_DELAY - 1);
+		}
+	}
+};
+
+} // anonymous namespace
+
+
+TEST_CASE("Voice interpolation matches stepping", "[sound][spu]")
+{
+	sample_generator gen{ 1 };
+	std::vector<signed short> src(0x20000);
+	for (auto &s : src)
+		s = gen.sample();
+
+	// full-scale steps in both directions exercise the widest differences
+	src[0] = -32768;
+	src[1] = 32767;
+	src[2] = -32768;
+
+	for (unsigned int const pitch : { 0U, 1U, 0x3ffU, 0x1000U, 0x1234U, 0x3fffU })
+	{
+		for (unsigned int const count : { 1U, 3U, 4U, 5U, 64U, 67U })
+		{
+			unsigned int refptr = gen.next() & 0xfff;
+			unsigned int dptr = refptr;
+			signed short const *refend;
+			std::vector<int> const expected = reference_interpolate(src.data(), count, refptr, pitch, refend);
+
+			std::vector<int> result(count);
+			signed short const *const end = spu_interpolate(result.data(), count, src.data(), dptr, pitch);
+
+			CHECK(result == expected);
+			CHECK(end == refend);
+			CHECK(dptr == refptr);
+		}
+	}
+}
+
+
+TEST_CASE("Reverb comb/allpass matches interleaved loop", "[sound][spu]")
+{
+	sample_generator gen{ 2 };
+	reference_reverb ref;
+	reference_reverb blk;
+
+	int const comb_delay[2][4] = { { 0, 4, 124, 640 }, { 8, 256, 512, 1020 } };
+	int const rvol[2] = { 0x7fff, -0x8000 };
+
+	// odd block sizes move the delay line position off four-sample alignment
+	for (unsigned int const frames : { 1U, 7U, 64U, 3U, 256U, 129U, 512U, 2U, 1000U })
+	{
+		int const comb_gain = int16_t(gen.next());
+		int const allpass_gain = int16_t(gen.next());
+		int const allpass_delay = (frames & 1) ? 0 : 516;
+
+		std::vector<signed short> src(frames * 2);
+		std::vector<signed short> dst(frames * 2);
+		for (auto &s : src)
+			s = gen.sample();
+		for (auto &s : dst)
+			s = gen.sample();
+		std::vector<signed short> expected = dst;
+
+		// the bandpass stage fills x ahead of the comb/allpass stage
+		for (int c = 0; c < 2; c++)
+		{
+			for (unsigned int i = 0; i < frames; i++)
+			{
+				signed short const v = gen.sample();
+				ref.x[c][(ref.yp + i) & (reference_reverb::MAX_DELAY - 1)] = v;
+				blk.x[c][(blk.yp + i) & (reference_reverb::MAX_DELAY - 1)] = v;
+			}
+		}
+
+		ref.process(src.data(), expected.data(), comb_delay, comb_gain, allpass_delay, allpass_gain, rvol, frames);
+
+		for (int c = 0; c < 2; c++)
+		{
+			signed short *const y[4] = { blk.y[c][0].data(), blk.y[c][1].data(), blk.y[c][2].data(), blk.y[c][3].data() };
+			spu_comb_allpass(
+					y, blk.x[c].data(), blk.ax[c].data(), blk.ay[c].data(),
+					reference_reverb::MAX_DELAY, blk.yp,
+					comb_delay[c], comb_gain,
+					allpass_delay, allpass_gain,
+					rvol[c],
+					src.data() + c, dst.data() + c, 2,
+					frames);
+		}
+		blk.yp = (blk.yp + frames) & (reference_reverb::MAX_DELAY - 1);
+
+		CHECK(dst == expected);
+		for (int c = 0; c < 2; c++)
+		{
+			for (int f = 0; f < 4; f++)
+				CHECK(blk.y[c][f] == ref.y[c][f]);
+			CHECK(blk.ay[c] == ref.ay[c]);
+		}
+	}
+}
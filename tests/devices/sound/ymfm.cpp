@@ -0,0 +1,242 @@
+#include "catch.hpp"
+
+#include "ymfm_opl.h"
+#include "ymfm_opm.h"
+#include "ymfm_opn.h"
+
+#include <cstdint>
+#include <vector>
+
+
+namespace {
+
+// register write at a given output sample; 'port' selects the upper
+// register bank on chips that have one
+struct chip_write
+{
+	uint32_t sample;
+	uint8_t port;
+	uint8_t reg;
+	uint8_t data;
+};
+
+// render 'total' samples, applying the writes as their samples come up, and
+// return an FNV-1a hash of every output value
+template <typename ChipClass>
+uint64_t render(ChipClass &chip, std::vector<chip_write> const &writes, uint32_t start, uint32_t total)
+{
+	typename ChipClass::output_data output;
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	auto next = writes.begin();
+	for (uint32_t sample = start; sample < total; sample++)
+	{
+		for ( ; next != writes.end() && next->sample <= sample; ++next)
+		{
+			if (next->sample < start)
+				continue;
+			chip.write(next->port * 2, next->reg);
+			chip.write(next->port * 2 + 1, next->data);
+		}
+		chip.generate(&output, 1);
+		for (int32_t value : output.data)
+		{
+			hash ^= uint32_t(value);
+			hash *= 0x100000001b3ULL;
+		}
+	}
+	return hash;
+}
+
+// notes that key on and off on every channel in turn, with fast releases so
+// that channels go fully quiet between notes and then start again
+std::vector<chip_write> opm_script()
+{
+	std::vector<chip_write> writes;
+	auto w = [&writes] (uint32_t sample, uint8_t reg, uint8_t data) { writes.push_back({ sample, 0, reg, data }); };
+
+	w(0, 0x18, 0x48);            // LFO frequency
+	w(0, 0x19, 0x80 | 0x30);     // PM depth
+	w(0, 0x19, 0x20);            // AM depth
+	for (uint8_t ch = 0; ch < 8; ch++)
+	{
+		w(0, 0x20 + ch, 0xc0 | ((ch & 7) << 3) | (ch & 7));
+		w(0, 0x38 + ch, (ch == 3) ? 0x71 : 0x00);
+		for (uint8_t op = 0; op < 4; op++)
+		{
+			uint8_t const slot = op * 8 + ch;
+			w(0, 0x40 + slot, ((op + ch) & 7) | ((ch & 3) << 4));
+			w(0, 0x60 + slot, (op == 3) ? 0x08 : 0x20 + op * 4);
+			w(0, 0x80 + slot, 0x1f - ch);
+			w(0, 0xa0 + slot, ((ch == 5) ? 0x80 : 0x00) | (0x08 + op));
+			w(0, 0xc0 + slot, 0x04);
+			w(0, 0xe0 + slot, 0x2f);
+		}
+	}
+	for (uint32_t note = 0; note < 48; note++)
+	{
+		uint8_t const ch = note & 7;
+		uint32_t const on = 200 + note * 1500;
+		w(on, 0x28 + ch, 0x30 + (note * 5) % 0x4e);
+		w(on, 0x30 + ch, (note * 13) & 0xfc);
+		w(on, 0x08, 0x78 | ch);
+		w(on + 700 + ch * 50, 0x08, ch);
+	}
+	return writes;
+}
+
+std::vector<chip_write> opna_script()
+{
+	std::vector<chip_write> writes;
+	auto w = [&writes] (uint32_t sample, uint8_t port, uint8_t reg, uint8_t data) { writes.push_back({ sample, port, reg, data }); };
+
+	w(0, 0, 0x29, 0x80);     // 6-channel mode
+	w(0, 0, 0x22, 0x0b);     // LFO on
+	for (uint8_t ch = 0; ch < 6; ch++)
+	{
+		uint8_t const port = ch / 3;
+		uint8_t const c = ch % 3;
+		w(0, port, 0xb0 + c, ((ch & 7) << 3) | ((ch + 2) & 7));
+		w(0, port, 0xb4 + c, 0xc0 | ((ch == 1) ? 0x37 : 0x00));
+		for (uint8_t op = 0; op < 4; op++)
+		{
+			uint8_t const slot = op * 4 + c;
+			w(0, port, 0x30 + slot, ((op + ch) & 0x0f) | ((op & 3) << 4));
+			w(0, port, 0x40 + slot, (op == 3) ? 0x04 : 0x18 + op * 6);
+			w(0, port, 0x50 + slot, 0x1f - ch * 2);
+			w(0, port, 0x60 + slot, ((ch == 2) ? 0x80 : 0x00) | (0x06 + op));
+			w(0, port, 0x70 + slot, 0x03);
+			w(0, port, 0x80 + slot, 0x2e);
+			w(0, port, 0x90 + slot, (ch == 4 && op == 0) ? 0x0a : 0x00);
+		}
+	}
+
+	// a square wave on SSG channel A
+	w(0, 0, 0x00, 0x40);
+	w(0, 0, 0x01, 0x01);
+	w(0, 0, 0x07, 0x3e);
+	w(0, 0, 0x08, 0x0c);
+
+	for (uint32_t note = 0; note < 36; note++)
+	{
+		uint8_t const ch = note % 6;
+		uint8_t const port = ch / 3;
+		uint8_t const c = ch % 3;
+		uint32_t const on = 100 + note * 1800;
+		w(on, port, 0xa4 + c, 0x20 | ((note >> 2) & 7));
+		w(on, port, 0xa0 + c, (note * 37) & 0xff);
+		w(on, 0, 0x28, 0xf0 | (port << 2) | c);
+		w(on + 900 + ch * 40, 0, 0x28, (port << 2) | c);
+	}
+	return writes;
+}
+
+std::vector<chip_write> opl3_script()
+{
+	static uint8_t const opoffs[9] = { 0x00, 0x01, 0x02, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12 };
+	std::vector<chip_write> writes;
+	auto w = [&writes] (uint32_t sample, uint8_t port, uint8_t reg, uint8_t data) { writes.push_back({ sample, port, reg, data }); };
+
+	w(0, 1, 0x05, 0x01);     // OPL3 mode
+	w(0, 1, 0x04, 0x01);     // channels 0 and 3 paired as 4-operator
+	w(0, 0, 0x01, 0x20);     // waveform select
+	w(0, 0, 0xbd, 0xc0);     // deep AM and vibrato
+	for (uint8_t port = 0; port < 2; port++)
+		for (uint8_t ch = 0; ch < 9; ch++)
+		{
+			w(0, port, 0xc0 + ch, 0x30 | ((ch & 7) << 1) | (ch & 1));
+			for (uint8_t op = 0; op < 2; op++)
+			{
+				uint8_t const slot = opoffs[ch] + op * 3;
+				w(0, port, 0x20 + slot, ((ch == 2) ? 0xc0 : 0x20) | ((ch + op) & 0x0f));
+				w(0, port, 0x40 + slot, (op == 1) ? 0x04 : 0x10 + ch);
+				w(0, port, 0x60 + slot, 0xf4 - ch * 0x10);
+				w(0, port, 0x80 + slot, 0x2c);
+				w(0, port, 0xe0 + slot, (ch + op) & 7);
+			}
+		}
+	for (uint32_t note = 0; note < 54; note++)
+	{
+		uint8_t const port = (note / 9) & 1;
+		uint8_t const ch = note % 9;
+		uint32_t const on = 150 + note * 1200;
+		w(on, port, 0xa0 + ch, (note * 29) & 0xff);
+		w(on, port, 0xb0 + ch, 0x20 | (((note >> 1) & 7) << 2) | 1);
+		w(on + 600 + ch * 30, port, 0xb0 + ch, (((note >> 1) & 7) << 2) | 1);
+	}
+
+	// then rhythm mode, with each drum struck in turn
+	uint32_t const drums = 150 + 54 * 1200;
+	for (uint32_t hit = 0; hit < 20; hit++)
+	{
+		w(drums + hit * 1000, 0, 0xbd, 0xe0 | (1 << (hit % 5)));
+		w(drums + hit * 1000 + 400, 0, 0xbd, 0xe0);
+	}
+	return writes;
+}
+
+// minimal interface; timers and external memory are unused
+class test_interface : public ymfm::ymfm_interface
+{
+};
+
+} // anonymous namespace
+
+
+TEST_CASE("ymfm output is unchanged", "[devices][sound]")
+{
+	/*
+	    These hashes were taken from the engine before idle channels
+	    stopped being clocked; any change to them means a change in the
+	    generated sound.
+	*/
+
+	SECTION("YM2151")
+	{
+		test_interface intf;
+		ymfm::ym2151 chip(intf);
+		chip.reset();
+		REQUIRE(render(chip, opm_script(), 0, 80000) == 0xd5d83a49706653a3ULL);
+	}
+
+	SECTION("YM2608")
+	{
+		test_interface intf;
+		ymfm::ym2608 chip(intf);
+		chip.reset();
+		REQUIRE(render(chip, opna_script(), 0, 70000) == 0x6b989035a649592dULL);
+	}
+
+	SECTION("YMF262")
+	{
+		test_interface intf;
+		ymfm::ymf262 chip(intf);
+		chip.reset();
+		REQUIRE(render(chip, opl3_script(), 0, 90000) == 0x97f2d7f8d5df49afULL);
+	}
+}
+
+
+TEST_CASE("ymfm state survives a save and restore", "[devices][sound]")
+{
+	// restoring into a fresh chip midway through a release gives the same
+	// output as carrying on
+	auto const writes = opna_script();
+	uint32_t const split = 100 + 1800 * 7;
+
+	test_interface intf;
+	ymfm::ym2608 reference(intf);
+	reference.reset();
+	render(reference, writes, 0, split);
+
+	std::vector<uint8_t> blob;
+	ymfm::ymfm_saved_state saver(blob, true);
+	reference.save_restore(saver);
+
+	test_interface intf2;
+	ymfm::ym2608 restored(intf2);
+	restored.reset();
+	ymfm::ymfm_saved_state loader(blob, false);
+	restored.save_restore(loader);
+
+	REQUIRE(render(restored, writes, split, split + 20000) == render(reference, writes, split, split + 20000));
+}
@@ -9,3 +9,29 @@ TEST_CASE("convert 1 sec to attotime", "[emu]")
    attotime value = attotime::from_seconds(1);
    REQUIRE(value.as_attoseconds() == 1000000000000000000);
 }
+
+TEST_CASE("multiply attotime carries into seconds", "[emu]")
+{
+   REQUIRE(attotime(1, 500000000000000000) * 3 == attotime(4, 500000000000000000));
+   REQUIRE(attotime(0, 999999999999999999) * 4 == attotime(3, 999999999999999996));
+   REQUIRE((attotime(0, 999999999999999999) * 0xffffffffU).is_never());
+   REQUIRE(attotime::from_hz(3) * 3 == attotime(0, 999999999999999999));
+   REQUIRE((attotime(2, 0) * 600000000).is_never());
+   REQUIRE(attotime(5, 5) * 0 == attotime::zero);
+}
+
+TEST_CASE("divide attotime rounds on the remainder", "[emu]")
+{
+   REQUIRE(attotime(1, 0) / 3 == attotime(0, 333333333333333334));
+   REQUIRE(attotime(2, 0) / 3 == attotime(0, 666666666666666667));
+   REQUIRE(attotime(7, 500000000000000000) / 2 == attotime(3, 750000000000000000));
+   REQUIRE(attotime(999999999, 999999999999999999) / 0xffffffffU == attotime(0, 232830643708079738));
+   REQUIRE(attotime(5, 5) / 0 == attotime(5, 5));
+}
+
+TEST_CASE("multiply then divide attotime round trips", "[emu]")
+{
+   attotime const period = attotime::from_hz(XTAL(14'318'181));
+   for (u32 factor = 2; factor < 100000; factor += 997)
+      REQUIRE((period * factor) / factor == period);
+}
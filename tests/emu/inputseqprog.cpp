@@ -0,0 +1,124 @@
+#include "catch.hpp"
+#include "emucore.h"
+#include "inputseqprog.h"
+
+#include <vector>
+
+
+namespace {
+
+struct test_item
+{
+	s32 value;
+};
+
+using test_program = basic_input_seq_program<test_item>;
+
+// a watch list where every item has its own index, stamped with the poll it last changed at
+struct test_inputs
+{
+	std::vector<test_item> items;
+	std::vector<u32> changed;
+	u32 poll = 0;
+
+	explicit test_inputs(std::size_t count) : items(count, test_item{ 0 }), changed(count, 0) { }
+
+	void set(std::size_t index, s32 value)
+	{
+		items[index].value = value;
+		changed[index] = ++poll;
+	}
+
+	bool pressed(test_program &program)
+	{
+		if (program.stale([this] (u32 index) { return changed[index]; }))
+			program.evaluate(poll, [] (test_item &item, input_item_class, input_item_modifier) { return item.value; });
+		return program.result();
+	}
+};
+
+// add a switch code reading one item
+void add_switch(test_program &program, test_inputs &inputs, u32 index, bool invert, bool group)
+{
+	program.add_term(ITEM_CLASS_SWITCH, ITEM_MODIFIER_NONE, invert, group);
+	program.add_item(inputs.items[index]);
+	program.add_watched(index);
+}
+
+} // anonymous namespace
+
+
+TEST_CASE("input sequence held at compile time reads as pressed", "[emu][input]")
+{
+	test_inputs inputs(1);
+	inputs.items[0].value = 1;
+
+	// compiled after the item was last stamped, as at configuration load
+	test_program program;
+	program.reset(osd::input_seq(), 0);
+	add_switch(program, inputs, 0, false, true);
+	REQUIRE(inputs.pressed(program));
+}
+
+TEST_CASE("input sequence of only NOT reads as pressed at start", "[emu][input]")
+{
+	test_inputs inputs(1);
+
+	test_program program;
+	program.reset(osd::input_seq(), 0);
+	add_switch(program, inputs, 0, true, true);
+	REQUIRE(inputs.pressed(program));
+
+	inputs.set(0, 1);
+	REQUIRE(!inputs.pressed(program));
+}
+
+TEST_CASE("input sequence result is kept until an item changes", "[emu][input]")
+{
+	test_inputs inputs(2);
+
+	// item 0 AND NOT item 1
+	test_program program;
+	program.reset(osd::input_seq(), 0);
+	add_switch(program, inputs, 0, false, true);
+	add_switch(program, inputs, 1, true, false);
+	REQUIRE(!inputs.pressed(program));
+
+	inputs.set(0, 1);
+	REQUIRE(inputs.pressed(program));
+
+	// a change the program doesn't watch leaves the cached result in place
+	inputs.items[1].value = 1;
+	REQUIRE(inputs.pressed(program));
+
+	inputs.changed[1] = ++inputs.poll;
+	REQUIRE(!inputs.pressed(program));
+
+	// recompiling discards the cached result
+	program.reset(osd::input_seq(), 1);
+	add_switch(program, inputs, 0, false, true);
+	REQUIRE(inputs.pressed(program));
+}
+
+TEST_CASE("input sequence groups are ORed", "[emu][input]")
+{
+	test_inputs inputs(3);
+
+	// item 0 AND item 1, OR item 2
+	test_program program;
+	program.reset(osd::input_seq(), 0);
+	add_switch(program, inputs, 0, false, true);
+	add_switch(program, inputs, 1, false, false);
+	add_switch(program, inputs, 2, false, true);
+	REQUIRE(!inputs.pressed(program));
+
+	inputs.set(0, 1);
+	REQUIRE(!inputs.pressed(program));
+
+	inputs.set(2, 1);
+	REQUIRE(inputs.pressed(program));
+
+	inputs.set(2, 0);
+	inputs.set(1, 1);
+	REQUIRE(inputs.pressed(program));
+}
@@ -0,0 +1,143 @@
+#include "catch.hpp"
+#include "emucore.h"
+#include "video/drawgfxspan.h"
+
+#include <vector>
+
+
+namespace {
+
+#undef rand
+inline u32 random_u32() { return rand() ^ (rand() << 15); }
+
+// source rows mixing solid runs of the transparent pen with noisy ones, so
+// every block kind (fully transparent, fully opaque, mixed) gets exercised
+std::vector<u8> random_row(u32 count, u8 trans_pen)
+{
+	std::vector<u8> result(count);
+	for (u32 x = 0; x < count; )
+	{
+		u32 const run = 1 + (random_u32() % 40);
+		u32 const kind = random_u32() % 3;
+		for (u32 i = 0; (i < run) && (x < count); i++, x++)
+		{
+			if (kind == 0)
+				result[x] = trans_pen;
+			else if (kind == 1)
+				result[x] = u8(random_u32() | 1) ^ (trans_pen & 1);
+			else
+				result[x] = (random_u32() & 3) ? u8(random_u32()) : trans_pen;
+		}
+	}
+	return result;
+}
+
+template <typename T>
+std::vector<T> random_dest(u32 count)
+{
+	std::vector<T> result(count);
+	for (T &d : result)
+		d = T(random_u32() ^ (random_u32() << 16));
+	return result;
+}
+
+} // anonymous namespace
+
+
+TEST_CASE("drawgfx spans match the pixel operations", "[emu][video]")
+{
+	/*
+	    Each span operation is compared against the per-pixel loop it
+	    replaces, over rows of every length up to a few blocks and at
+	    every alignment within a block, including out-of-range pens.
+	*/
+
+	std::vector<pen_t> paldata(256);
+	for (pen_t &p : paldata)
+		p = random_u32() ^ (random_u32() << 16);
+
+	for (u32 trans_pen : { 0U, 15U, 0xffU, 0x100U })
+	{
+		for (u32 count = 0; count < 72; count++)
+		{
+			for (u32 offset = 0; offset < 16; offset += 5)
+			{
+				std::vector<u8> const src = random_row(count + offset, u8(trans_pen));
+				u8 const *const srcp = src.data() + offset;
+				u32 const color = random_u32();
+				u32 const pmask = (random_u32() ^ (random_u32() << 16)) | (1U << 31);
+
+				// PIXEL_OP_REBASE_OPAQUE and PIXEL_OP_REBASE_TRANSPEN, 16bpp
+				{
+					std::vector<u16> expected = random_dest<u16>(count);
+					std::vector<u16> actual = expected;
+					for (u32 x = 0; x < count; x++)
+						expected[x] = color + srcp[x];
+					drawgfx_span_rebase_opaque(actual.data(), srcp, count, color);
+					REQUIRE(expected == actual);
+
+					expected = random_dest<u16>(count);
+					actual = expected;
+					for (u32 x = 0; x < count; x++)
+						if (srcp[x] != trans_pen)
+							expected[x] = color + srcp[x];
+					drawgfx_span_rebase_transpen(actual.data(), srcp, count, color, trans_pen);
+					REQUIRE(expected == actual);
+				}
+
+				// PIXEL_OP_REBASE_OPAQUE and PIXEL_OP_REBASE_TRANSPEN, 32bpp
+				{
+					std::vector<u32> expected = random_dest<u32>(count);
+					std::vector<u32> actual = expected;
+					for (u32 x = 0; x < count; x++)
+						expected[x] = color + srcp[x];
+					drawgfx_span_rebase_opaque(actual.data(), srcp, count, color);
+					REQUIRE(expected == actual);
+
+					expected = random_dest<u32>(count);
+					actual = expected;
+					for (u32 x = 0; x < count; x++)
+						if (srcp[x] != trans_pen)
+							expected[x] = color + srcp[x];
+					drawgfx_span_rebase_transpen(actual.data(), srcp, count, color, trans_pen);
+					REQUIRE(expected == actual);
+				}
+
+				// PIXEL_OP_REMAP_TRANSPEN
+				{
+					std::vector<u32> expected = random_dest<u32>(count);
+					std::vector<u32> actual = expected;
+					for (u32 x = 0; x < count; x++)
+						if (srcp[x] != trans_pen)
+							expected[x] = paldata[srcp[x]];
+					drawgfx_span_remap_transpen(actual.data(), srcp, count, paldata.data(), trans_pen);
+					REQUIRE(expected == actual);
+				}
+
+				// PIXEL_OP_REBASE_TRANSPEN_PRIORITY
+				{
+					auto const pixel_op =
+							[pmask, trans_pen, color] (u16 &dest, u8 &pri, const u8 &src)
+							{
+								u32 const srcdata = src;
+								if (srcdata != trans_pen)
+								{
+									if (((1 << (pri & 0x1f)) & pmask) == 0)
+										dest = color + srcdata;
+									pri = 31;
+								}
+							};
+					std::vector<u16> expected = random_dest<u16>(count);
+					std::vector<u16> actual = expected;
+					std::vector<u8> expectedpri = random_dest<u8>(count);
+					std::vector<u8> actualpri = expectedpri;
+					for (u32 x = 0; x < count; x++)
+						pixel_op(expected[x], expectedpri[x], srcp[x]);
+					drawgfx_span_transpen_priority(actual.data(), actualpri.data(), srcp, count, trans_pen, pixel_op);
+					REQUIRE(expected == actual);
+					REQUIRE(expectedpri == actualpri);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,242 @@
+#include "catch.hpp"
+#include "emucore.h"
+#include "video/rendspan.h"
+
+#include <vector>
+
+
+namespace {
+
+// fixed generator, so the golden images don't depend on the C library
+struct image_generator
+{
+	u32 state;
+	u32 next() { state = state * 1664525U + 1013904223U; return state ^ (state >> 15); }
+};
+
+// texels mixing fully transparent, fully opaque and partly transparent runs,
+// so every alpha path gets exercised
+std::vector<u32> make_texels(image_generator &gen, u32 count)
+{
+	std::vector<u32> result(count);
+	for (u32 x = 0; x < count; )
+	{
+		u32 const run = 1 + (gen.next() % 12);
+		u32 const kind = gen.next() % 3;
+		for (u32 i = 0; (i < run) && (x < count); i++, x++)
+		{
+			u32 const rgb = gen.next() & 0x00ffffff;
+			if (kind == 0)
+				result[x] = rgb;
+			else if (kind == 1)
+				result[x] = rgb | 0xff000000;
+			else
+				result[x] = rgb | (gen.next() << 24);
+		}
+	}
+	return result;
+}
+
+template <typename T>
+std::vector<T> make_dest(image_generator &gen, u32 count)
+{
+	std::vector<T> result(count);
+	for (T &d : result)
+		d = T(gen.next());
+	return result;
+}
+
+template <typename T>
+u32 image_hash(std::vector<T> const &image)
+{
+	u32 result = 2166136261U;
+	for (T const &d : image)
+	{
+		for (unsigned i = 0; i < sizeof(T); i++)
+			result = (result ^ u8(d >> (i * 8))) * 16777619U;
+	}
+	return result;
+}
+
+// the per-pixel loops from rendersw.hxx
+template <typename PixelType, int SrcShiftR, int SrcShiftG, int SrcShiftB, int DstShiftR, int DstShiftG, int DstShiftB>
+struct reference
+{
+	static constexpr u32 source32_r(u32 pixel) { return (pixel >> (16 + SrcShiftR)) & (0xff >> SrcShiftR); }
+	static constexpr u32 source32_g(u32 pixel) { return (pixel >> ( 8 + SrcShiftG)) & (0xff >> SrcShiftG); }
+	static constexpr u32 source32_b(u32 pixel) { return (pixel >> ( 0 + SrcShiftB)) & (0xff >> SrcShiftB); }
+	static constexpr u32 dest_r(PixelType pixel) { return (pixel >> DstShiftR) & (0xff >> SrcShiftR); }
+	static constexpr u32 dest_g(PixelType pixel) { return (pixel >> DstShiftG) & (0xff >> SrcShiftG); }
+	static constexpr u32 dest_b(PixelType pixel) { return (pixel >> DstShiftB) & (0xff >> SrcShiftB); }
+	static constexpr PixelType assemble(u32 r, u32 g, u32 b) { return (r << DstShiftR) | (g << DstShiftG) | (b << DstShiftB); }
+	static constexpr u32 saturate(u32 c, int shift) { return (c | -(c >> (8 - shift))) & (0xff >> shift); }
+
+	static void copy(PixelType &dest, u32 pix)
+	{
+		if (SrcShiftR == 0 && SrcShiftG == 0 && SrcShiftB == 0 && DstShiftR == 16 && DstShiftG == 8 && DstShiftB == 0)
+			dest = pix;
+		else
+			dest = assemble(source32_r(pix), source32_g(pix), source32_b(pix));
+	}
+
+	static void alpha(PixelType &dest, u32 pix)
+	{
+		u32 const ta = pix >> 24;
+		if (ta != 0)
+		{
+			u32 const invta = 0x100 - ta;
+			dest = assemble(
+					(source32_r(pix) * ta + dest_r(dest) * invta) >> 8,
+					(source32_g(pix) * ta + dest_g(dest) * invta) >> 8,
+					(source32_b(pix) * ta + dest_b(dest) * invta) >> 8);
+		}
+	}
+
+	static void blend(PixelType &dest, u32 pix, u32 sr, u32 sg, u32 sb, u32 invsa)
+	{
+		dest = assemble(
+				(source32_r(pix) * sr + dest_r(dest) * invsa) >> 8,
+				(source32_g(pix) * sg + dest_g(dest) * invsa) >> 8,
+				(source32_b(pix) * sb + dest_b(dest) * invsa) >> 8);
+	}
+
+	static void add(PixelType &dest, u32 pix)
+	{
+		dest = assemble(
+				saturate(source32_r(pix) + dest_r(dest), SrcShiftR),
+				saturate(source32_g(pix) + dest_g(dest), SrcShiftG),
+				saturate(source32_b(pix) + dest_b(dest), SrcShiftB));
+	}
+
+	static void add_alpha(PixelType &dest, u32 pix)
+	{
+		u32 const ta = pix >> 24;
+		if (ta != 0)
+		{
+			dest = assemble(
+					saturate(((source32_r(pix) * ta) >> 8) + dest_r(dest), SrcShiftR),
+					saturate(((source32_g(pix) * ta) >> 8) + dest_g(dest), SrcShiftG),
+					saturate(((source32_b(pix) * ta) >> 8) + dest_b(dest), SrcShiftB));
+		}
+	}
+
+	static void multiply(PixelType &dest, u32 pix)
+	{
+		dest = assemble(
+				(source32_r(pix) * dest_r(dest)) >> (8 - SrcShiftR),
+				(source32_g(pix) * dest_g(dest)) >> (8 - SrcShiftG),
+				(source32_b(pix) * dest_b(dest)) >> (8 - SrcShiftB));
+	}
+};
+
+enum class blend_mode { COPY, ALPHA, BLEND, ADD, ADD_ALPHA, MULTIPLY };
+
+template <typename PixelType, int SrcShiftR, int SrcShiftG, int SrcShiftB, int DstShiftR, int DstShiftG, int DstShiftB>
+std::vector<PixelType> draw(blend_mode mode, std::vector<PixelType> dest, u32 const *src, u32 count, bool use_span)
+{
+	using span = render_span<PixelType, SrcShiftR, SrcShiftG, SrcShiftB, DstShiftR, DstShiftG, DstShiftB>;
+	using ref = reference<PixelType, SrcShiftR, SrcShiftG, SrcShiftB, DstShiftR, DstShiftG, DstShiftB>;
+	u32 const sr = 0x100, sg = 0xa0, sb = 0x38, invsa = 0x80;
+	if (use_span)
+	{
+		switch (mode)
+		{
+		case blend_mode::COPY:      span::copy(dest.data(), src, count); break;
+		case blend_mode::ALPHA:     span::alpha(dest.data(), src, count); break;
+		case blend_mode::BLEND:     span::blend(dest.data(), src, count, sr, sg, sb, invsa); break;
+		case blend_mode::ADD:       span::add(dest.data(), src, count); break;
+		case blend_mode::ADD_ALPHA: span::add_alpha(dest.data(), src, count); break;
+		case blend_mode::MULTIPLY:  span::multiply(dest.data(), src, count); break;
+		}
+	}
+	else
+	{
+		for (u32 x = 0; x < count; x++)
+		{
+			switch (mode)
+			{
+			case blend_mode::COPY:      ref::copy(dest[x], src[x]); break;
+			case blend_mode::ALPHA:     ref::alpha(dest[x], src[x]); break;
+			case blend_mode::BLEND:     ref::blend(dest[x], src[x], sr, sg, sb, invsa); break;
+			case blend_mode::ADD:       ref::add(dest[x], src[x]); break;
+			case blend_mode::ADD_ALPHA: ref::add_alpha(dest[x], src[x]); break;
+			case blend_mode::MULTIPLY:  ref::multiply(dest[x], src[x]); break;
+			}
+		}
+	}
+	return dest;
+}
+
+constexpr blend_mode f_modes[] = { blend_mode::COPY, blend_mode::ALPHA, blend_mode::BLEND, blend_mode::ADD, blend_mode::ADD_ALPHA, blend_mode::MULTIPLY };
+
+template <typename PixelType, int SrcShiftR, int SrcShiftG, int SrcShiftB, int DstShiftR, int DstShiftG, int DstShiftB>
+void check_rows()
+{
+	auto const run = &draw<PixelType, SrcShiftR, SrcShiftG, SrcShiftB, DstShiftR, DstShiftG, DstShiftB>;
+	image_generator gen{ 1 };
+	for (blend_mode mode : f_modes)
+	{
+		for (u32 count = 0; count < 40; count++)
+		{
+			for (u32 offset = 0; offset < 4; offset++)
+			{
+				std::vector<u32> const src = make_texels(gen, count + offset);
+				std::vector<PixelType> const dest = make_dest<PixelType>(gen, count);
+				REQUIRE(run(mode, dest, src.data() + offset, count, false) == run(mode, dest, src.data() + offset, count, true));
+			}
+		}
+	}
+}
+
+template <typename PixelType, int SrcShiftR, int SrcShiftG, int SrcShiftB, int DstShiftR, int DstShiftG, int DstShiftB>
+std::vector<u32> golden_hashes()
+{
+	// a 64x64 image drawn over a 64x64 background in each mode
+	auto const run = &draw<PixelType, SrcShiftR, SrcShiftG, SrcShiftB, DstShiftR, DstShiftG, DstShiftB>;
+	std::vector<u32> result;
+	for (blend_mode mode : f_modes)
+	{
+		image_generator gen{ 0x5eed };
+		std::vector<u32> const src = make_texels(gen, 64 * 64);
+		std::vector<PixelType> const dest = make_dest<PixelType>(gen, 64 * 64);
+		std::vector<PixelType> const image = run(mode, dest, src.data(), 64 * 64, true);
+		REQUIRE(image == run(mode, dest, src.data(), 64 * 64, false));
+		result.emplace_back(image_hash(image));
+	}
+	return result;
+}
+
+} // anonymous namespace
+
+
+TEST_CASE("render spans match the pixel loops", "[emu][video]")
+{
+	/*
+	    Each span operation is compared against the per-pixel loop it
+	    replaces in the software renderer, for every destination format
+	    the OSD renderers use, over rows of every length up to several
+	    SIMD blocks and at every texel alignment.
+	*/
+
+	check_rows<u32, 0,0,0, 16,8,0>();
+	check_rows<u32, 0,0,0, 24,16,8>();
+	check_rows<u32, 0,0,0, 0,8,16>();
+	check_rows<u16, 3,2,3, 11,5,0>();
+	check_rows<u16, 3,3,3, 10,5,0>();
+}
+
+
+TEST_CASE("render spans produce the golden images", "[emu][video]")
+{
+	// hashes of the images drawn in copy, alpha, blend, add, add_alpha and
+	// multiply modes, in that order
+	std::vector<u32> const rgb32  = golden_hashes<u32, 0,0,0, 16,8,0>();
+	std::vector<u32> const bgrx32 = golden_hashes<u32, 0,0,0, 24,16,8>();
+	std::vector<u32> const rgb565 = golden_hashes<u16, 3,2,3, 11,5,0>();
+	std::vector<u32> const rgb555 = golden_hashes<u16, 3,3,3, 10,5,0>();
+
+	REQUIRE(rgb32  == std::vector<u32>({ 0x1c459d6c, 0x81eb92d9, 0x3fffff5f, 0xdbac8a0c, 0xe8e741d2, 0xf712c3d0 }));
+	REQUIRE(bgrx32 == std::vector<u32>({ 0x11844f09, 0x906ef5d1, 0x8da2ee4e, 0x6e609b4f, 0x776d40f6, 0xc712dd3f }));
+	REQUIRE(rgb565 == std::vector<u32>({ 0x372ee6bf, 0x782b64cc, 0x6ca8ceb3, 0x727d77c8, 0xd213c4c4, 0x019c0ca4 }));
+	REQUIRE(rgb555 == std::vector<u32>({ 0x39a4e1ab, 0x2dd5f6b6, 0x272b07a7, 0xd7f3564c, 0x7c0514f7, 0x36ebcaad }));
+}
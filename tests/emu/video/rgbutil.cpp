@@ -1034,3 +1034,49 @@ TEST_CASE("check rgb", "[emu][video]")
 		check_expected();
 	}
 }
+
+
+TEST_CASE("rgb two-pixel operations match the single ones", "[emu][video]")
+{
+	/*
+	    blend_x2 and scale_and_clamp_x2 may process both pixels in one
+	    wide register, so check them against the single-pixel versions
+	    on channel values and scales in the ranges the renderers use,
+	    plus some out-of-range ones to exercise the clamping.
+	*/
+
+	auto const random_channel = [] { return s32(random_u32() % 0x300) - 0x100; };
+	auto const random_rgba = [&random_channel] { return rgbaint_t(random_channel(), random_channel(), random_channel(), random_channel()); };
+	auto const check_same = [] (const rgbaint_t &expected, const rgbaint_t &actual)
+	{
+		REQUIRE(expected.get_a32() == actual.get_a32());
+		REQUIRE(expected.get_r32() == actual.get_r32());
+		REQUIRE(expected.get_g32() == actual.get_g32());
+		REQUIRE(expected.get_b32() == actual.get_b32());
+	};
+
+	for (int i = 0; i < 1000; i++)
+	{
+		rgbaint_t const color0 = random_rgba(), color1 = random_rgba();
+		rgbaint_t const other0 = random_rgba(), other1 = random_rgba();
+		u8 const factor0 = u8(random_u32()), factor1 = u8(random_u32());
+
+		rgbaint_t expected0(color0), expected1(color1);
+		rgbaint_t actual0(color0), actual1(color1);
+		expected0.blend(other0, factor0);
+		expected1.blend(other1, factor1);
+		rgbaint_t::blend_x2(actual0, actual1, other0, other1, factor0, factor1);
+		check_same(expected0, actual0);
+		check_same(expected1, actual1);
+
+		expected0 = color0;
+		expected1 = color1;
+		actual0 = color0;
+		actual1 = color1;
+		expected0.scale_and_clamp(other0);
+		expected1.scale_and_clamp(other1);
+		rgbaint_t::scale_and_clamp_x2(actual0, actual1, other0, other1);
+		check_same(expected0, actual0);
+		check_same(expected1, actual1);
+	}
+}
@@ -0,0 +1,108 @@
+#include "catch.hpp"
+#include "emucore.h"
+#include "video/rozspan.h"
+
+#include <vector>
+
+
+namespace {
+
+#undef rand
+inline u32 random_u32() { return rand() ^ (rand() << 15); }
+
+struct roz_source
+{
+	u32 width, height, rowpixels;
+	std::vector<u16> pixmap;
+	std::vector<u8> flagsmap;
+
+	roz_source(u32 w, u32 h, u32 pad) : width(w), height(h), rowpixels(w + pad), pixmap(rowpixels * h), flagsmap(rowpixels * h)
+	{
+		for (u16 &p : pixmap)
+			p = u16(random_u32());
+		for (u8 &f : flagsmap)
+			f = u8(random_u32() & 0x33);
+	}
+
+	roz_span_source span() const { return roz_span_source{ pixmap.data(), flagsmap.data(), rowpixels, width, height }; }
+};
+
+// the per-pixel loop the tilemap code used before the kernels
+void reference_row(u16 *dest, u8 *pri, u32 count, u32 cx, u32 cy, s32 incx, s32 incy, roz_source const &src, bool wrap, u8 mask, u8 value, u32 priority)
+{
+	for (u32 x = 0; x < count; x++, cx += incx, cy += incy)
+	{
+		u32 px = cx >> 16, py = cy >> 16;
+		if (wrap)
+		{
+			px &= src.width - 1;
+			py &= src.height - 1;
+		}
+		else if ((cx >= (src.width << 16)) || (cy >= (src.height << 16)))
+		{
+			continue;
+		}
+		u32 const offs = py * src.rowpixels + px;
+		if ((src.flagsmap[offs] & mask) == value)
+		{
+			dest[x] = src.pixmap[offs] + (priority >> 16);
+			if (pri)
+				pri[x] = (pri[x] & (priority >> 8)) | priority;
+		}
+	}
+}
+
+} // anonymous namespace
+
+
+TEST_CASE("ROZ spans match the per-pixel loop", "[emu][video]")
+{
+	roz_source const source(256, 128, 24);
+	roz_span_source const span = source.span();
+
+	for (int iteration = 0; iteration < 4000; iteration++)
+	{
+		bool const wrap = iteration & 1;
+		bool const usepri = iteration & 2;
+		u32 const count = 1 + (random_u32() % 100);
+
+		// mostly coordinates near the source, sometimes anywhere, with
+		// increments from tiny to large and of either sign
+		u32 cx = (random_u32() % (source.width << 17)) - (source.width << 15);
+		u32 cy = (random_u32() % (source.height << 17)) - (source.height << 15);
+		if ((iteration % 7) == 0)
+			cx = random_u32() ^ (random_u32() << 30);
+		s32 const incx = s32(random_u32() % 0x40000) - 0x20000;
+		s32 const incy = ((iteration % 5) == 0) ? 0 : s32(random_u32() % 0x40000) - 0x20000;
+		u8 const mask = (iteration % 3) ? 0x11 : 0x30;
+		u8 const value = mask & u8(random_u32());
+		u32 const priority = (random_u32() << 16) | (random_u32() & 0xffff);
+
+		std::vector<u16> expected(count), result(count);
+		std::vector<u8> expectedpri(count), resultpri(count);
+		for (u32 x = 0; x < count; x++)
+		{
+			expected[x] = result[x] = u16(random_u32());
+			expectedpri[x] = resultpri[x] = u8(random_u32());
+		}
+
+		reference_row(expected.data(), usepri ? expectedpri.data() : nullptr, count, cx, cy, incx, incy, source, wrap, mask, value, priority);
+		if (wrap)
+		{
+			roz_span_draw_ind16<true>(result.data(), usepri ? resultpri.data() : nullptr, count, cx, cy, incx, incy, span, mask, value, priority);
+		}
+		else
+		{
+			u32 first, end;
+			if (!roz_span_clip(cx, cy, incx, incy, span, count, first, end))
+				continue;
+			REQUIRE(first <= end);
+			REQUIRE(end <= count);
+			roz_span_draw_ind16<false>(result.data() + first, usepri ? (resultpri.data() + first) : nullptr, end - first, cx + first * incx, cy + first * incy, incx, incy, span, mask, value, priority);
+		}
+
+		INFO("iteration " << iteration);
+		CHECK(result == expected);
+		CHECK(resultpri == expectedpri);
+	}
+}
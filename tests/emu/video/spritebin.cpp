@@ -0,0 +1,81 @@
+#include "catch.hpp"
+#include "emucore.h"
+#include "video/spritebin.h"
+
+#include <algorithm>
+#include <vector>
+
+
+namespace {
+
+#undef rand
+inline u32 random_u32() { return rand() ^ (rand() << 15); }
+
+struct test_sprite
+{
+	int index;
+	int min_y;
+	int max_y;
+};
+
+// the sprites a caller walking the whole list would draw within min_y..max_y
+std::vector<int> brute_force(const std::vector<test_sprite> &sprites, int area_min, int area_max, int min_y, int max_y)
+{
+	std::vector<int> result;
+	for (const test_sprite &s : sprites)
+		if (std::max({ s.min_y, area_min, min_y }) <= std::min({ s.max_y, area_max, max_y }))
+			result.push_back(s.index);
+	return result;
+}
+
+} // anonymous namespace
+
+
+TEST_CASE("sprite bins visit sprites in order", "[emu][video]")
+{
+	for (int bandshift = 2; bandshift <= 5; bandshift++)
+	{
+		int const area_min = 0;
+		int const area_max = 223 + bandshift;
+		sprite_bin_list<int> bins(bandshift);
+		bins.reset(area_min, area_max);
+
+		std::vector<test_sprite> sprites;
+		for (int i = 0; i < 500; i++)
+		{
+			int const y = int(random_u32() % 320) - 48;
+			int const height = int(random_u32() % 64) + 1;
+			sprites.push_back(test_sprite{ i, y, y + height - 1 });
+			bins.add(i, y, y + height - 1);
+		}
+
+		for (int pass = 0; pass < 400; pass++)
+		{
+			// mostly short slices, as a driver doing raster effects would ask for
+			int const min_y = int(random_u32() % 240) - 8;
+			int const lines = (pass & 3) ? int(random_u32() % 12) + 1 : int(random_u32() % 240) + 1;
+			int const max_y = min_y + lines - 1;
+
+			std::vector<int> visited;
+			bins.visit(min_y, max_y, [&visited] (int index) { visited.push_back(index); });
+			REQUIRE(visited == brute_force(sprites, area_min, area_max, min_y, max_y));
+		}
+	}
+}
+
+TEST_CASE("sprite bins reset", "[emu][video]")
+{
+	sprite_bin_list<int> bins;
+	bins.reset(0, 63);
+	bins.add(1, 0, 63);
+	bins.add(2, 64, 80);
+	REQUIRE(bins.size() == 1);
+
+	bins.reset(rectangle(0, 255, 16, 31));
+	REQUIRE(bins.empty());
+	bins.add(3, 0, 16);
+
+	std::vector<int> visited;
+	bins.visit(rectangle(0, 255, 0, 255), [&visited] (int index) { visited.push_back(index); });
+	REQUIRE(visited == std::vector<int>{ 3 });
+}
@@ -0,0 +1,67 @@
+#include "catch.hpp"
+
+#include "arena.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace {
+
+struct counted : util::arena_object
+{
+	counted(int &count) : m_count(count) { ++m_count; }
+	~counted() { --m_count; }
+	int &m_count;
+};
+
+struct alignas(64) overaligned : util::arena_object
+{
+	char data[64];
+};
+
+} // anonymous namespace
+
+TEST_CASE("Arena allocations honour alignment", "[util]")
+{
+	util::arena arena;
+	arena.allocate(1, 1);
+	REQUIRE((std::uintptr_t(arena.allocate(8, 8)) % 8) == 0);
+	arena.allocate(3, 1);
+	REQUIRE((std::uintptr_t(arena.allocate(16, 64)) % 64) == 0);
+	REQUIRE((std::uintptr_t(arena.allocate(100000, 32)) % 32) == 0);
+	REQUIRE(arena.allocated() >= (1 + 8 + 3 + 16 + 100000));
+	REQUIRE(arena.reserved() >= arena.allocated());
+
+	arena.release();
+	REQUIRE(arena.allocated() == 0);
+	REQUIRE(arena.reserved() == 0);
+}
+
+TEST_CASE("Arena string copies are NUL-terminated", "[util]")
+{
+	util::arena arena;
+	std::string_view const single(arena.copy("tag"));
+	REQUIRE(single == "tag");
+	REQUIRE(single.data()[single.length()] == '\0');
+
+	std::string_view const joined(arena.copy({ ":owner", ":", "child" }));
+	REQUIRE(joined == ":owner:child");
+	REQUIRE(joined.data()[joined.length()] == '\0');
+}
+
+TEST_CASE("Arena objects are destroyed wherever they were allocated", "[util]")
+{
+	int count = 0;
+	util::arena arena;
+	{
+		std::unique_ptr<counted> in_arena(new (arena) counted(count));
+		std::unique_ptr<counted> on_heap(new counted(count));
+		REQUIRE(count == 2);
+	}
+	REQUIRE(count == 0);
+
+	std::unique_ptr<overaligned> aligned_arena(new (arena) overaligned);
+	std::unique_ptr<overaligned> aligned_heap(new overaligned);
+	REQUIRE((std::uintptr_t(aligned_arena.get()) % 64) == 0);
+	REQUIRE((std::uintptr_t(aligned_heap.get()) % 64) == 0);
+}
@@ -2,8 +2,89 @@
 
 #include "options.h"
 
+#include "corefile.h"
+
 TEST_CASE("Empty options should return size of zero", "[util]")
 {
 	core_options options;
 	REQUIRE(options.entries().size() == 0);
 }
+
+TEST_CASE("Options are found by any of their names", "[util]")
+{
+	static const options_entry entries[] =
+	{
+		{ nullptr,            nullptr, core_options::option_type::HEADER,  "TEST OPTIONS" },
+		{ "first;f",          "12",    core_options::option_type::INTEGER, "first" },
+		{ "second",           "1",     core_options::option_type::BOOLEAN, "second" },
+		{ nullptr }
+	};
+
+	core_options options;
+	options.add_entries(entries);
+	REQUIRE(options.exists("first"));
+	REQUIRE(options.exists("f"));
+	REQUIRE(options.exists("second"));
+	REQUIRE(options.exists("nosecond"));
+	REQUIRE(!options.exists("third"));
+	REQUIRE(options.get_entry("f") == options.get_entry("first"));
+
+	static constexpr core_options::key first("first");
+	REQUIRE(options.int_value(first) == 12);
+	REQUIRE(options.bool_value(std::string("second")));
+}
+
+TEST_CASE("Options can still be found after many are added and some removed", "[util]")
+{
+	core_options options;
+	for (int i = 0; i < 500; i++)
+		options.add_entry({ util::string_format("option%d", i) }, "option", core_options::option_type::INTEGER, util::string_format("%d", i));
+
+	for (int i = 0; i < 500; i += 3)
+		options.remove_entry(*options.get_entry(util::string_format("option%d", i)));
+
+	for (int i = 0; i < 500; i++)
+	{
+		std::string const name = util::string_format("option%d", i);
+		if (i % 3)
+			REQUIRE(options.int_value(name) == i);
+		else
+			REQUIRE(!options.exists(name));
+	}
+}
+
+TEST_CASE("Integer option values are read like a stream would", "[util]")
+{
+	core_options options;
+	options.add_entry({ "value" }, "value", core_options::option_type::STRING);
+
+	options.set_value("value", " 42", OPTION_PRIORITY_NORMAL);
+	REQUIRE(options.int_value("value") == 42);
+	options.set_value("value", "+7", OPTION_PRIORITY_NORMAL);
+	REQUIRE(options.int_value("value") == 7);
+	options.set_value("value", "-3x", OPTION_PRIORITY_NORMAL);
+	REQUIRE(options.int_value("value") == -3);
+	options.set_value("value", "x3", OPTION_PRIORITY_NORMAL);
+	REQUIRE(options.int_value("value") == 0);
+	options.set_value("value", "99999999999999999999", OPTION_PRIORITY_NORMAL);
+	REQUIRE(options.int_value("value") == 0);
+	REQUIRE(options.int_value("missing") == 0);
+}
+
+TEST_CASE("INI files set options, skipping comments", "[util]")
+{
+	core_options options;
+	options.add_entry({ "name" }, "name", core_options::option_type::STRING, "unset");
+	options.add_entry({ "count" }, "count", core_options::option_type::INTEGER, "0");
+
+	static const char ini[] =
+			"# a comment\n"
+			"\n"
+			"  name    \"some # thing\"  # trailing\r\n"
+			"count 5\n";
+	util::core_file::ptr file;
+	REQUIRE(!util::core_file::open_ram(ini, sizeof(ini) - 1, OPEN_FLAG_READ, file));
+	options.parse_ini_file(*file, OPTION_PRIORITY_NORMAL, false, false);
+	REQUIRE(std::string(options.value("name")) == "some # thing");
+	REQUIRE(options.int_value("count") == 5);
+}